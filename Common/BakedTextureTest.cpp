@@ -0,0 +1,80 @@
+// checks the water textures baked into Patches/WaterEnhancement_*.h against their source PNGs: each one is decoded
+// with stb like GfxCreateTextureFromFile does, swizzled to A8R8G8B8 and given its mips by MipChain::Build, and the
+// result has to match the baked header byte for byte. run it after editing a PNG or MipChain to catch a stale bake.
+// nothing here touches D3D, so it builds and runs on Linux.
+//
+// usage: run from the repository root
+//   g++ -std=c++17 -O2 -I. -IExternal/reshade/deps/stb -o BakedTextureTest Common/BakedTextureTest.cpp Common/MipChain.cpp
+//   ./BakedTextureTest
+
+#include "Common/MipChain.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#define STBI_NO_STDIO
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#define CHECK(condition) \
+    do { if (!(condition)) { std::printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); return 1; } } while (0)
+
+// same layout as in Common/GfxUtils.h, which pulls in d3d8
+struct GfxRawTexture {
+    uint32_t        width;
+    uint32_t        height;
+    uint32_t        numMips;
+    const uint32_t* pixels;
+};
+
+#include "Patches/WaterEnhancement_dudv.h"
+#include "Patches/WaterEnhancement_caustics.h"
+
+static int CheckBaked(const char* pngPath, const GfxRawTexture& baked) {
+    std::ifstream file(pngPath, std::ios::binary);
+    const std::vector<uint8_t> fileData((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    CHECK(!fileData.empty());
+
+    int width = 0, height = 0, channels = 0;
+    stbi_uc* pixels = stbi_load_from_memory(fileData.data(), static_cast<int>(fileData.size()), &width, &height, &channels, STBI_rgb_alpha);
+    CHECK(pixels != nullptr);
+    CHECK(static_cast<uint32_t>(width) == baked.width && static_cast<uint32_t>(height) == baked.height);
+    CHECK(baked.numMips == MipChain::LevelCount(baked.width, baked.height));
+
+    std::vector<uint8_t> chain(MipChain::ChainSize(baked.width, baked.height, baked.numMips));
+    std::memcpy(chain.data(), pixels, static_cast<size_t>(width) * height * 4);
+    stbi_image_free(pixels);
+
+    // stb gives RGBA, A8R8G8B8 is BGRA in memory
+    MipChain::SwapRedBlue(chain.data(), static_cast<size_t>(width) * height);
+    MipChain::Build(chain.data(), baked.width, baked.height, baked.numMips);
+
+    // report the first level that differs, a mismatch only from level 1 on points at the filter rather than the PNG
+    const uint8_t* bakedBytes = reinterpret_cast<const uint8_t*>(baked.pixels);
+    for (uint32_t level = 0, offset = 0; level < baked.numMips; ++level) {
+        const uint32_t levelSize = static_cast<uint32_t>(MipChain::ChainSize(baked.width, baked.height, level + 1)) - offset;
+        if (std::memcmp(chain.data() + offset, bakedBytes + offset, levelSize)) {
+            std::printf("FAILED %s: level %u differs from the baked header\n", pngPath, level);
+            return 1;
+        }
+        offset += levelSize;
+    }
+
+    std::printf("%s: %ux%u, %u mips match\n", pngPath, baked.width, baked.height, baked.numMips);
+    return 0;
+}
+
+int main() {
+    CHECK(sizeof(DuDv_128x128_pixels) == MipChain::ChainSize(DuDv_128x128.width, DuDv_128x128.height, DuDv_128x128.numMips));
+    CHECK(sizeof(Caustics_128x128_pixels) == MipChain::ChainSize(Caustics_128x128.width, Caustics_128x128.height, Caustics_128x128.numMips));
+
+    if (CheckBaked("Resources/Textures/dudv128.png", DuDv_128x128) || CheckBaked("Resources/Textures/caustics128.png", Caustics_128x128)) {
+        return 1;
+    }
+
+    std::printf("all baked texture checks passed\n");
+    return 0;
+}
@@ -0,0 +1,291 @@
+/**
+* Copyright (C) 2024 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "FramePacer.h"
+#include <algorithm>
+#include <iterator>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <errno.h>
+#include <time.h>
+#include <sched.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+#endif
+
+#ifdef _WIN32
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+namespace
+{
+	LARGE_INTEGER Frequency = {};
+	HANDLE hWaitTimer = nullptr;
+}
+
+bool PacerClock::Init()
+{
+	if (!Frequency.QuadPart)
+	{
+		QueryPerformanceFrequency(&Frequency);
+	}
+	if (!hWaitTimer)
+	{
+		// High resolution timers are only available on Windows 10 1803 and newer
+		hWaitTimer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+		if (!hWaitTimer)
+		{
+			hWaitTimer = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+		}
+	}
+	return hWaitTimer != nullptr;
+}
+
+int64_t PacerClock::NowNs()
+{
+	if (!Frequency.QuadPart)
+	{
+		QueryPerformanceFrequency(&Frequency);
+	}
+	LARGE_INTEGER Ticks = {};
+	QueryPerformanceCounter(&Ticks);
+
+	// Split to avoid overflowing when converting ticks to nanoseconds
+	const int64_t Seconds = Ticks.QuadPart / Frequency.QuadPart;
+	const int64_t Remainder = Ticks.QuadPart % Frequency.QuadPart;
+	return Seconds * 1000000000LL + (Remainder * 1000000000LL) / Frequency.QuadPart;
+}
+
+void PacerClock::SleepNs(int64_t DurationNs)
+{
+	if (DurationNs <= 0)
+	{
+		return;
+	}
+	if (hWaitTimer)
+	{
+		// Negative due time is relative, in 100 ns units
+		LARGE_INTEGER DueTime = {};
+		DueTime.QuadPart = -(DurationNs / 100);
+		if (SetWaitableTimer(hWaitTimer, &DueTime, 0, nullptr, nullptr, FALSE))
+		{
+			WaitForSingleObject(hWaitTimer, INFINITE);
+			return;
+		}
+	}
+	Sleep(static_cast<DWORD>(DurationNs / 1000000LL));
+}
+
+void PacerClock::Spin()
+{
+	YieldProcessor();
+}
+
+#else
+
+bool PacerClock::Init()
+{
+	return true;
+}
+
+int64_t PacerClock::NowNs()
+{
+	timespec ts = {};
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+void PacerClock::SleepNs(int64_t DurationNs)
+{
+	if (DurationNs <= 0)
+	{
+		return;
+	}
+	timespec ts = {};
+	ts.tv_sec = static_cast<time_t>(DurationNs / 1000000000LL);
+	ts.tv_nsec = static_cast<long>(DurationNs % 1000000000LL);
+	// Resume with the remaining time after a signal, on any other error the caller spins for the rest
+	while (clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, &ts) == EINTR) {}
+}
+
+void PacerClock::Spin()
+{
+#if defined(__x86_64__) || defined(__i386__)
+	_mm_pause();
+#else
+	sched_yield();
+#endif
+}
+
+#endif
+
+uint32_t FrameTimeStats::GetBucket(int64_t FrameNs)
+{
+	const int64_t Bucket = FrameNs / BucketNs;
+	return static_cast<uint32_t>((std::min)((std::max)(Bucket, static_cast<int64_t>(0)), static_cast<int64_t>(HistogramBuckets - 1)));
+}
+
+void FrameTimeStats::Push(int64_t TimeNs, int64_t FrameNs)
+{
+	const uint32_t Tail = (Head + Count) % MaxFrames;
+	Frames[Tail] = { TimeNs, FrameNs };
+	Count++;
+	TotalNs += FrameNs;
+	Histogram[GetBucket(FrameNs)]++;
+}
+
+void FrameTimeStats::Pop()
+{
+	const FRAME& Oldest = Frames[Head];
+	TotalNs -= Oldest.FrameNs;
+	Histogram[GetBucket(Oldest.FrameNs)]--;
+	Head = (Head + 1) % MaxFrames;
+	Count--;
+}
+
+void FrameTimeStats::AddFrame(int64_t TimeNs, int64_t FrameNs)
+{
+	if (Count == MaxFrames)
+	{
+		Pop();
+	}
+	Push(TimeNs, FrameNs);
+
+	// Each frame is pushed and popped once so this is amortized O(1)
+	while (Count > 1 && TimeNs - Frames[Head].TimeNs > WindowNs)
+	{
+		Pop();
+	}
+}
+
+void FrameTimeStats::Reset()
+{
+	std::fill(std::begin(Histogram), std::end(Histogram), 0u);
+	Head = 0;
+	Count = 0;
+	TotalNs = 0;
+}
+
+double FrameTimeStats::GetMeanMs() const
+{
+	return Count ? (static_cast<double>(TotalNs) / Count) / 1000000.0 : 0.0;
+}
+
+double FrameTimeStats::GetFPS() const
+{
+	return TotalNs > 0 ? (Count * 1000000000.0) / TotalNs : 0.0;
+}
+
+double FrameTimeStats::GetPercentileMs(double Percentile) const
+{
+	if (!Count)
+	{
+		return 0.0;
+	}
+
+	// Walk down from the slowest bucket until the tail above the percentile is covered
+	const uint32_t Tail = static_cast<uint32_t>(Count * (1.0 - Percentile / 100.0));
+	uint32_t Seen = 0;
+	for (uint32_t x = HistogramBuckets; x-- > 0;)
+	{
+		Seen += Histogram[x];
+		if (Seen > Tail)
+		{
+			return ((x + 1) * BucketNs) / 1000000.0;
+		}
+	}
+	return 0.0;
+}
+
+void FramePacer::Reset()
+{
+	LastDeadlineNs = 0;
+	LastWaitNs = 0;
+}
+
+void FramePacer::Calibrate(int64_t OversleepNs)
+{
+	// Smoothed mean and deviation of the oversleep, the margin covers the mean plus four deviations
+	const int64_t Error = OversleepNs - OversleepMeanNs;
+	OversleepMeanNs += Error / 8;
+	OversleepDevNs += ((Error < 0 ? -Error : Error) - OversleepDevNs) / 4;
+	SpinMarginNs = (std::min)((std::max)(OversleepMeanNs + 4 * OversleepDevNs + MinSpinMarginNs / 2, MinSpinMarginNs), MaxSpinMarginNs);
+}
+
+void FramePacer::WaitUntil(int64_t TargetNs)
+{
+	int64_t NowNs = PacerClock::NowNs();
+	const int64_t WakeNs = TargetNs - SpinMarginNs;
+
+	// Sleep for the bulk of the remaining time
+	if (WakeNs > NowNs)
+	{
+		PacerClock::SleepNs(WakeNs - NowNs);
+		NowNs = PacerClock::NowNs();
+		Calibrate(NowNs - WakeNs);
+	}
+
+	// Spin for the rest
+	while (NowNs < TargetNs)
+	{
+		PacerClock::Spin();
+		NowNs = PacerClock::NowNs();
+	}
+}
+
+bool FramePacer::WaitForNextFrame(double FrameRate)
+{
+	FrameCount++;
+
+	if (FrameRate <= 0.0)
+	{
+		return false;
+	}
+
+	const int64_t PerFrameNs = static_cast<int64_t>(1000000000.0 / FrameRate);
+	const int64_t StartNs = PacerClock::NowNs();
+	const int64_t TargetNs = LastDeadlineNs + PerFrameNs;
+
+	if (LastDeadlineNs == 0)
+	{
+		PacerClock::Init();
+	}
+
+	// First frame or if we fell behind, reset base time
+	if (LastDeadlineNs == 0 || StartNs >= TargetNs)
+	{
+		const bool Missed = (LastDeadlineNs != 0);
+		if (Missed)
+		{
+			MissedDeadlines++;
+		}
+		LastDeadlineNs = StartNs;
+		LastWaitNs = 0;
+		return Missed;
+	}
+
+	WaitUntil(TargetNs);
+
+	// Store target time for next frame
+	LastDeadlineNs = TargetNs;
+	LastWaitNs = PacerClock::NowNs() - StartNs;
+	return false;
+}
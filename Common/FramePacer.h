@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+
+// Monotonic clock and sleep backend, QueryPerformanceCounter and waitable timers on Windows, clock_gettime and clock_nanosleep elsewhere
+namespace PacerClock
+{
+	int64_t NowNs();
+	bool Init();
+	void SleepNs(int64_t DurationNs);
+	void Spin();
+}
+
+// Rolling frame time statistics over a fixed time window, updated in O(1) per frame
+class FrameTimeStats
+{
+public:
+	static constexpr int64_t WindowNs = 1000000000LL;		// 1 second
+	static constexpr uint32_t MaxFrames = 2048;				// Enough for a 1 second window up to 2000 FPS
+	static constexpr uint32_t HistogramBuckets = 512;
+	static constexpr int64_t BucketNs = 250000LL;			// 0.25 ms per bucket, last bucket catches anything above 127.75 ms
+
+	void AddFrame(int64_t TimeNs, int64_t FrameNs);
+	void Reset();
+
+	uint32_t GetFrameCount() const { return Count; }
+	double GetMeanMs() const;
+	double GetFPS() const;
+	double GetPercentileMs(double Percentile) const;
+
+private:
+	void Push(int64_t TimeNs, int64_t FrameNs);
+	void Pop();
+	static uint32_t GetBucket(int64_t FrameNs);
+
+	struct FRAME
+	{
+		int64_t TimeNs;
+		int64_t FrameNs;
+	};
+
+	FRAME Frames[MaxFrames] = {};
+	uint32_t Histogram[HistogramBuckets] = {};
+	uint32_t Head = 0;
+	uint32_t Count = 0;
+	int64_t TotalNs = 0;
+};
+
+// Sleeps on a high resolution timer for most of the frame and spins for the remaining margin
+class FramePacer
+{
+public:
+	static constexpr int64_t MinSpinMarginNs = 200000LL;	// 0.2 ms
+	static constexpr int64_t MaxSpinMarginNs = 20000000LL;	// 20 ms, only reached with a coarse system timer
+	static constexpr int64_t InitSpinMarginNs = 2000000LL;	// 2 ms
+
+	// Waits until the next frame deadline for the given frame rate and returns true if the deadline was already missed
+	bool WaitForNextFrame(double FrameRate);
+	void Reset();
+
+	uint64_t GetFrameCount() const { return FrameCount; }
+	uint64_t GetMissedDeadlines() const { return MissedDeadlines; }
+	double GetSpinMarginMs() const { return SpinMarginNs / 1000000.0; }
+	double GetLastWaitMs() const { return LastWaitNs / 1000000.0; }
+
+private:
+	void WaitUntil(int64_t TargetNs);
+	void Calibrate(int64_t OversleepNs);
+
+	int64_t LastDeadlineNs = 0;
+	int64_t LastWaitNs = 0;
+	int64_t SpinMarginNs = InitSpinMarginNs;
+	int64_t OversleepMeanNs = 0;
+	int64_t OversleepDevNs = 0;
+	uint64_t FrameCount = 0;
+	uint64_t MissedDeadlines = 0;
+};
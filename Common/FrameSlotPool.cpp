@@ -0,0 +1,145 @@
+/**
+* Copyright (C) 2024 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "FrameSlotPool.h"
+#include <algorithm>
+
+void FrameSlotPool::SetSlotCount(uint32_t Count)
+{
+	Count = std::min(std::max(Count, 1u), MaxSlots);
+	if (Count != WantedCount)
+	{
+		WantedCount = Count;
+		Pending = true;
+	}
+	if (Pending)
+	{
+		Update();
+	}
+}
+
+void FrameSlotPool::SetSlotBytes(size_t SlotBytes)
+{
+	if (SlotBytes != SlotSize)
+	{
+		SlotSize = SlotBytes;
+		Pending = true;
+	}
+	if (Pending)
+	{
+		Update();
+	}
+}
+
+uint32_t FrameSlotPool::GetSlotCount() const
+{
+	if (!SlotSize)
+	{
+		return 0;
+	}
+	return static_cast<uint32_t>(std::min<size_t>(WantedCount, std::max<size_t>(1, Budget / SlotSize)));
+}
+
+void FrameSlotPool::Update()
+{
+	const uint32_t Count = GetSlotCount();
+	bool Done = true;
+	UsableMask = 0;
+
+	for (uint32_t x = 0; x < MaxSlots; x++)
+	{
+		const uint32_t Bit = 1u << x;
+		const bool Wanted = x < Count;
+
+		if (!(AllocatedMask & Bit))
+		{
+			if (Wanted)
+			{
+				Slots[x].Data.resize(SlotSize);
+				AllocatedMask |= Bit;
+				UsableMask |= Bit;
+				FreeMask.fetch_or(Bit, std::memory_order_acq_rel);
+			}
+			continue;
+		}
+
+		if (Wanted && Slots[x].Data.size() == SlotSize)
+		{
+			UsableMask |= Bit;
+			continue;
+		}
+
+		// The consumer only touches slots it was handed, so a free slot can be changed, the others have to wait
+		if (!(FreeMask.load(std::memory_order_acquire) & Bit))
+		{
+			Done = false;
+			continue;
+		}
+
+		if (Wanted)
+		{
+			Slots[x].Data.resize(SlotSize);
+			Slots[x].Data.shrink_to_fit();
+			UsableMask |= Bit;
+		}
+		else
+		{
+			FreeMask.fetch_and(~Bit, std::memory_order_acq_rel);
+			AllocatedMask &= ~Bit;
+			std::vector<uint8_t>().swap(Slots[x].Data);
+		}
+	}
+
+	Pending = !Done;
+}
+
+FrameSlotPool::SLOT *FrameSlotPool::Acquire()
+{
+	if (Pending)
+	{
+		Update();
+	}
+
+	// Slots released since the last update may still have the old size, they wait for the next one
+	uint32_t Mask = FreeMask.load(std::memory_order_acquire) & UsableMask;
+	if (!Mask)
+	{
+		Dropped.fetch_add(1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	// Only the producer clears bits, so the lowest free slot cannot be taken by anyone else
+	uint32_t Index = 0;
+	while (!(Mask & (1u << Index)))
+	{
+		Index++;
+	}
+	FreeMask.fetch_and(~(1u << Index), std::memory_order_acq_rel);
+
+	return &Slots[Index];
+}
+
+void FrameSlotPool::Submit(SLOT *pSlot)
+{
+	// Ready has room for every slot, so this cannot fail
+	Ready.Push(static_cast<uint32_t>(pSlot - Slots));
+}
+
+void FrameSlotPool::Release(SLOT *pSlot)
+{
+	pSlot->Path.clear();
+	FreeMask.fetch_or(1u << static_cast<uint32_t>(pSlot - Slots), std::memory_order_acq_rel);
+}
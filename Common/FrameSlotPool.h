@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <string>
+#include <vector>
+#include "SPSCQueue.h"
+
+// Pool of preallocated frame buffers shared by one producer (render thread) and one consumer (encoder thread)
+//
+// The producer acquires a free slot, fills it and submits it, the consumer waits for submitted slots and releases
+// them once written. Nothing is allocated per frame, when every slot is busy Acquire fails and the frame is counted
+// as dropped instead of blocking the render thread or growing memory.
+//
+// The slot size and count can change at any time. Free slots are resized right away, slots the consumer holds are
+// resized or freed by the producer once they come back, so a resize never drops a frame.
+class FrameSlotPool
+{
+public:
+	static constexpr uint32_t MaxSlots = 16;
+
+	struct SLOT
+	{
+		std::vector<uint8_t> Data;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		uint32_t Pitch = 0;
+		bool Burst = false;			// Part of a burst capture
+		uint32_t FrameIndex = 0;	// Index within the burst, dropped frames leave gaps
+		int64_t TimeNs = 0;			// Capture time
+		uint32_t DroppedBefore = 0;	// Frames dropped in the burst before this one
+		std::wstring Path;
+	};
+
+	explicit FrameSlotPool(size_t BudgetBytes) : Budget(BudgetBytes) {}
+
+	// Producer: slots wanted, the memory budget can lower it, at least one slot is kept once a size is set
+	void SetSlotCount(uint32_t Count);
+	// Producer: size of every slot, no slot is allocated before the first call
+	void SetSlotBytes(size_t SlotBytes);
+	size_t GetSlotBytes() const { return SlotSize; }
+	uint32_t GetSlotCount() const;
+
+	// Producer
+	SLOT *Acquire();
+	void Submit(SLOT *pSlot);
+	uint64_t GetDropped() const { return Dropped.load(std::memory_order_relaxed); }
+
+	// Consumer
+	template <typename Rep, typename Period>
+	SLOT *WaitReady(std::chrono::duration<Rep, Period> Timeout)
+	{
+		uint32_t Index;
+		return Ready.Pop(Index, Timeout) ? &Slots[Index] : nullptr;
+	}
+	void Release(SLOT *pSlot);
+
+private:
+	// Producer: brings the slots in line with the wanted size and count as far as the consumer allows
+	void Update();
+
+	const size_t Budget;
+	size_t SlotSize = 0;
+	uint32_t WantedCount = 1;
+	uint32_t AllocatedMask = 0;	// Producer only
+	uint32_t UsableMask = 0;	// Producer only, allocated slots of the wanted size within the wanted count
+	bool Pending = false;		// Some slots still have to be resized or freed
+	SLOT Slots[MaxSlots];
+	std::atomic<uint32_t> FreeMask { 0 };
+	std::atomic<uint64_t> Dropped { 0 };
+	SPSCQueue<uint32_t, MaxSlots> Ready;
+};
@@ -1,7 +1,11 @@
 #include "Common/GfxUtils.h"
+#include "Common/MipChain.h"
+#include "Common/Hash.h"
+#include "Common/TextureCache.h"
+#include "Common/TextureLoader.h"
+#include "Patches/Patches.h"
 
 #include <stb_image.h>
-#include <stb_image_resize.h>
 #include <stb_image_dds.h>
 
 #include <cmath>
@@ -98,19 +102,39 @@ struct DDS_HEADER_DXT10 {
 #define BC7_BLOCK_SIZE    16
 
 
-static size_t Log2I(size_t v) {
-    size_t result = 0;
-    while (v >>= 1) {
-        ++result;
+static std::filesystem::path GetMipCachePath(uint64_t sourceHash) {
+    wchar_t path[MAX_PATH] = {};
+    if (!GetSH2FolderPath(path, MAX_PATH)) {
+        return {};
     }
-    return result;
+    if (wchar_t* pdest = wcsrchr(path, L'\\')) {
+        *pdest = L'\0';
+    }
+
+    wchar_t name[32];
+    swprintf_s(name, L"%016llx.mip", sourceHash);
+    return std::filesystem::path(path) / L"cache" / L"mips" / name;
 }
 
-static void BuildMip(const uint8_t* srcImage, int srcWidth, int srcHeight, uint8_t* dstImage, int dstWidth, int dstHeight) {
-    stbir_resize_uint8_generic(srcImage, srcWidth, srcHeight, 0,
-                               dstImage, dstWidth, dstHeight, 0,
-                               4, -1, 0, STBIR_EDGE_CLAMP,
-                               STBIR_FILTER_MITCHELL, STBIR_COLORSPACE_LINEAR, nullptr);
+// copies a tightly packed chain into the texture levels one by one honoring the pitch
+static HRESULT UploadMipChain(LPDIRECT3DTEXTURE8 texture, const uint8_t* chain, UINT width, UINT height, UINT numMips) {
+    HRESULT hr = D3D_OK;
+    for (UINT i = 0; i < numMips && SUCCEEDED(hr); ++i) {
+        const size_t mipW = (std::max)(width >> i, 1u);
+        const size_t mipH = (std::max)(height >> i, 1u);
+
+        D3DLOCKED_RECT lockedRect{};
+        hr = texture->LockRect(i, &lockedRect, nullptr, 0);
+        if (SUCCEEDED(hr)) {
+            uint8_t* dstPointer = reinterpret_cast<uint8_t*>(lockedRect.pBits);
+            for (size_t y = 0; y < mipH; ++y) {
+                std::memcpy(dstPointer + y * lockedRect.Pitch, chain + y * mipW * 4, mipW * 4);
+            }
+            hr = texture->UnlockRect(i);
+        }
+        chain += mipW * mipH * 4;
+    }
+    return hr;
 }
 
 static bool ExtensionEqual(LPCWSTR filePath, LPCWSTR extToCompare) {
@@ -133,18 +157,31 @@ static size_t ReadFromFile(HANDLE hFile, size_t bytesToRead, void* buffer) {
 }
 
 
+static TextureCache& GetTextureCache() {
+    static TextureCache cache(static_cast<size_t>((std::max)(TextureCacheSizeMB, 0)) * 1024 * 1024);
+    return cache;
+}
 
+// last write time and size, so a replaced file is never served from the cache
+static bool GetFileTimestamp(LPCWSTR srcFile, uint64_t& timestamp) {
+    WIN32_FILE_ATTRIBUTE_DATA attributes{};
+    if (!::GetFileAttributesExW(srcFile, GetFileExInfoStandard, &attributes)) {
+        return false;
+    }
+
+    const uint64_t writeTime = (static_cast<uint64_t>(attributes.ftLastWriteTime.dwHighDateTime) << 32) | attributes.ftLastWriteTime.dwLowDateTime;
+    const uint64_t fileSize = (static_cast<uint64_t>(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow;
+    timestamp = writeTime ^ (fileSize * 0x9E3779B185EBCA87ULL);
+    return true;
+}
 
 HRESULT GfxCreateTextureFromFileA(LPDIRECT3DDEVICE8 device, LPCSTR srcFile, LPDIRECT3DTEXTURE8* dstTexture, DWORD flags) {
     std::filesystem::path filePath = srcFile;
     return GfxCreateTextureFromFileW(device, filePath.wstring().c_str(), dstTexture, flags);
 }
 
-HRESULT GfxCreateTextureFromFileW(LPDIRECT3DDEVICE8 device, LPCWSTR srcFile, LPDIRECT3DTEXTURE8* dstTexture, DWORD flags) {
-    if (!device || (!srcFile || !srcFile[0]) || !dstTexture) {
-        return D3DERR_INVALIDCALL;
-    }
-
+// decodes the file into the image, a tightly packed mip chain for PNG/TGA and the raw payload for DDS
+static HRESULT LoadTextureFile(LPCWSTR srcFile, DWORD flags, TextureCache::Image& image) {
     HANDLE fh = ::CreateFileW(srcFile, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
     if (!fh || fh == INVALID_HANDLE_VALUE) {
         return D3DERR_NOTAVAILABLE;
@@ -155,6 +192,7 @@ HRESULT GfxCreateTextureFromFileW(LPDIRECT3DDEVICE8 device, LPCWSTR srcFile, LPD
     uint8_t* pixels = nullptr;
     D3DFORMAT format = D3DFMT_UNKNOWN;
     size_t fullDDSDataSize = 0;
+    std::vector<uint8_t> mipChain;
 
     const bool isDDS = ExtensionEqual(srcFile, L"dds");
     if (isDDS) {
@@ -232,13 +270,49 @@ HRESULT GfxCreateTextureFromFileW(LPDIRECT3DDEVICE8 device, LPCWSTR srcFile, LPD
             },
         };
 
+        const bool buildMips = (flags & GCTFF_BUILD_MIPS) == GCTFF_BUILD_MIPS;
+        std::filesystem::path cacheFile;
+        uint64_t sourceHash = 0;
+
         int channels = 0;
-        pixels = stbi_load_from_callbacks(&callbacks, fh, &width, &height, &channels, STBI_rgb_alpha);
+        if (buildMips && EnableMipCache) {
+            // the cache is keyed by the hash of the whole file, so read it in one go
+            LARGE_INTEGER liFileSize{};
+            ::GetFileSizeEx(fh, &liFileSize);
+
+            std::vector<uint8_t> fileData(static_cast<size_t>(liFileSize.QuadPart));
+            if (!fileData.empty() && ReadFromFile(fh, fileData.size(), fileData.data()) == fileData.size()) {
+                sourceHash = Hash64(fileData.data(), fileData.size());
+                cacheFile = GetMipCachePath(sourceHash);
+
+                uint32_t cachedW = 0, cachedH = 0, cachedMips = 0;
+                if (!cacheFile.empty() && MipChain::LoadCached(cacheFile, sourceHash, cachedW, cachedH, cachedMips, mipChain)) {
+                    width = static_cast<int>(cachedW);
+                    height = static_cast<int>(cachedH);
+                    numMips = cachedMips;
+                } else {
+                    pixels = stbi_load_from_memory(fileData.data(), static_cast<int>(fileData.size()), &width, &height, &channels, STBI_rgb_alpha);
+                }
+            }
+        } else {
+            pixels = stbi_load_from_callbacks(&callbacks, fh, &width, &height, &channels, STBI_rgb_alpha);
+        }
 
         if (pixels) {
             // convert ABGR -> ARGB
-            for (int i = 0, numPixels = width * height; i < numPixels; ++i) {
-                std::swap(pixels[i * 4 + 0], pixels[i * 4 + 2]);
+            MipChain::SwapRedBlue(pixels, static_cast<size_t>(width) * height);
+
+            numMips = buildMips ? MipChain::LevelCount(width, height) : 1u;
+            mipChain.resize(MipChain::ChainSize(width, height, numMips));
+            std::memcpy(mipChain.data(), pixels, static_cast<size_t>(width) * height * 4);
+            stbi_image_free(pixels);
+            pixels = nullptr;
+
+            // each level is box filtered from the previous one
+            MipChain::Build(mipChain.data(), width, height, numMips);
+
+            if (!cacheFile.empty()) {
+                MipChain::StoreCached(cacheFile, sourceHash, width, height, numMips, mipChain);
             }
         }
 
@@ -247,68 +321,155 @@ HRESULT GfxCreateTextureFromFileW(LPDIRECT3DDEVICE8 device, LPCWSTR srcFile, LPD
 
     ::CloseHandle(fh);
 
-    if (!pixels || format == D3DFMT_UNKNOWN) {
+    if ((isDDS ? !pixels : mipChain.empty()) || format == D3DFMT_UNKNOWN) {
+        free(pixels);
         return D3DXERR_INVALIDDATA;
     }
 
-    if (!isDDS) {
-        const UINT biggestDimension = static_cast<UINT>((std::max)(width, height));
-        numMips = ((flags & GCTFF_BUILD_MIPS) == GCTFF_BUILD_MIPS) ? (Log2I(biggestDimension) + 1) : 1u;
-    } else if (numMips == 1u && (flags & GCTFF_BUILD_MIPS) == GCTFF_BUILD_MIPS) {
+    if (isDDS && numMips == 1u && (flags & GCTFF_BUILD_MIPS) == GCTFF_BUILD_MIPS) {
         numMips = 0u; // setting it to zero will force Direct3D runtime to generate all mips
     }
 
-    HRESULT hr = device->CreateTexture(static_cast<UINT>(width),
-                                       static_cast<UINT>(height),
-                                       numMips, 0u,
-                                       format,
+    image.width = static_cast<uint32_t>(width);
+    image.height = static_cast<uint32_t>(height);
+    image.numMips = numMips;
+    image.format = static_cast<uint32_t>(format);
+    if (isDDS) {
+        image.data.assign(pixels, pixels + fullDDSDataSize);
+        free(pixels);
+    } else {
+        image.data = std::move(mipChain);
+    }
+
+    return D3D_OK;
+}
+
+// thread safe, returns the decoded image from the cache or loads it
+static TextureCache::ImagePtr GetTextureImage(LPCWSTR srcFile, DWORD flags, HRESULT& hr) {
+    uint64_t timestamp = 0;
+    if (!GetFileTimestamp(srcFile, timestamp)) {
+        hr = D3DERR_NOTAVAILABLE;
+        return nullptr;
+    }
+
+    // the same file loaded with and without mips gives different images
+    std::wstring key = srcFile;
+    if ((flags & GCTFF_BUILD_MIPS) == GCTFF_BUILD_MIPS) {
+        key += L"|mips";
+    }
+
+    hr = D3D_OK;
+    return GetTextureCache().Get(key, timestamp, [&](TextureCache::Image& decoded) {
+        hr = LoadTextureFile(srcFile, flags, decoded);
+        return SUCCEEDED(hr);
+    });
+}
+
+static HRESULT CreateTextureFromImage(LPDIRECT3DDEVICE8 device, const TextureCache::Image& image, bool isDDS, LPDIRECT3DTEXTURE8* dstTexture) {
+    HRESULT hr = device->CreateTexture(image.width,
+                                       image.height,
+                                       image.numMips, 0u,
+                                       static_cast<D3DFORMAT>(image.format),
                                        D3DPOOL_MANAGED,
                                        dstTexture);
     if (SUCCEEDED(hr)) {
-        D3DLOCKED_RECT lockedRect{};
-        hr = dstTexture[0]->LockRect(0u, &lockedRect, nullptr, 0);
+        if (!isDDS) {
+            hr = UploadMipChain(dstTexture[0], image.data.data(), image.width, image.height, image.numMips);
+        } else {
+            D3DLOCKED_RECT lockedRect{};
+            hr = dstTexture[0]->LockRect(0u, &lockedRect, nullptr, 0);
+
+            if (SUCCEEDED(hr)) {
+                std::memcpy(lockedRect.pBits, image.data.data(), image.data.size());
+                hr = dstTexture[0]->UnlockRect(0u);
+            }
+        }
+    }
 
-        if (SUCCEEDED(hr)) {
-            if (!isDDS) {
-                std::memcpy(lockedRect.pBits, pixels, static_cast<size_t>(width * height * 4));
+    return hr;
+}
 
-                if (numMips > 1u) {
-                    uint8_t* dstPointer = reinterpret_cast<uint8_t*>(lockedRect.pBits);
-                    std::vector<uint8_t*> mipPointers(numMips);
-                    mipPointers[0] = dstPointer;
-                    dstPointer += width * height * 4;
+HRESULT GfxCreateTextureFromFileW(LPDIRECT3DDEVICE8 device, LPCWSTR srcFile, LPDIRECT3DTEXTURE8* dstTexture, DWORD flags) {
+    if (!device || (!srcFile || !srcFile[0]) || !dstTexture) {
+        return D3DERR_INVALIDCALL;
+    }
 
-                    for (int i = 1; i < static_cast<int>(numMips); ++i) {
-                        const int mipW = (std::max)(width >> i, 1);
-                        const int mipH = (std::max)(height >> i, 1);
+    HRESULT hr = D3D_OK;
+    TextureCache::ImagePtr image = GetTextureImage(srcFile, flags, hr);
+    if (!image) {
+        return hr;
+    }
 
-                        mipPointers[i] = dstPointer;
+    return CreateTextureFromImage(device, *image, ExtensionEqual(srcFile, L"dds"), dstTexture);
+}
 
-                        // for each subsequent mip we go as far as 3 steps up for a source for a compromise between quality and the speed
-                        const int srcMip = (std::max)(0, i - 3);
-                        const int srcMipW = (std::max)(width >> srcMip, 1);
-                        const int srcMipH = (std::max)(height >> srcMip, 1);
+// async loads, decoded on the loader threads and uploaded from GfxPumpTextureLoads
 
-                        BuildMip(mipPointers[srcMip], srcMipW, srcMipH, mipPointers[i], mipW, mipH);
+constexpr size_t kMaxTextureUploadsPerFrame = 4;
 
-                        dstPointer += mipW * mipH * 4;
-                    }
-                }
-            } else {
-                std::memcpy(lockedRect.pBits, pixels, fullDDSDataSize);
+static TextureLoader* gTextureLoader = nullptr;
+static DWORD gTextureLoaderRoom = 0;
+
+uint64_t GfxLoadTextureFromFileAsync(LPDIRECT3DDEVICE8 device, LPCWSTR srcFile, DWORD flags, int priority, bool roomScoped, GfxTextureReadyFn onReady) {
+    if (!device || (!srcFile || !srcFile[0]) || !onReady) {
+        return 0;
+    }
+
+    // never destroyed, joining the workers while the dll is unloading would deadlock
+    if (!gTextureLoader) {
+        gTextureLoader = new TextureLoader((std::max)(1u, (std::min)(2u, std::thread::hardware_concurrency() / 2)));
+    }
+
+    // room scoped jobs are grouped by room + 1, group 0 is never cancelled
+    const uint32_t group = roomScoped ? GetRoomID() + 1 : 0;
+
+    auto result = std::make_shared<HRESULT>(D3D_OK);
+    const std::wstring path = srcFile;
+    return gTextureLoader->Enqueue(
+        [path, flags, result]() {
+            return GetTextureImage(path.c_str(), flags, *result);
+        },
+        [device, path, result, onReady](const TextureCache::ImagePtr& image) {
+            LPDIRECT3DTEXTURE8 texture = nullptr;
+            HRESULT hr = image ? CreateTextureFromImage(device, *image, ExtensionEqual(path.c_str(), L"dds"), &texture) : *result;
+            if (FAILED(hr) && texture) {
+                texture->Release();
+                texture = nullptr;
             }
+            onReady(hr, texture);
+        },
+        priority, group);
+}
 
-            hr = dstTexture[0]->UnlockRect(0u);
-        }
+void GfxCancelTextureLoad(uint64_t loadId) {
+    if (gTextureLoader && loadId) {
+        gTextureLoader->Cancel(loadId);
     }
+}
 
-    if (isDDS) {
-        free(pixels);
-    } else {
-        stbi_image_free(pixels);
+void GfxPumpTextureLoads() {
+    if (!gTextureLoader) {
+        return;
     }
 
-    return hr;
+    const DWORD room = GetRoomID();
+    if (room != gTextureLoaderRoom) {
+        gTextureLoader->CancelGroup(gTextureLoaderRoom + 1);
+        gTextureLoaderRoom = room;
+    }
+
+    gTextureLoader->Pump(kMaxTextureUploadsPerFrame);
+}
+
+void GfxLogTextureCacheStats() {
+    const TextureCache::Stats stats = GetTextureCache().GetStats();
+    const uint64_t requests = stats.hits + stats.misses;
+    if (!requests) {
+        return;
+    }
+
+    Logging::Log() << "Texture cache: " << stats.hits << " hits, " << stats.misses << " misses (" << (stats.hits * 100 / requests) << "% hit rate), " <<
+        (stats.bytesSaved / 1024) << " KB not reloaded, " << stats.entries << " textures in " << (stats.bytesResident / 1024) << " KB, " << stats.evictions << " evicted";
 }
 
 HRESULT GfxCreateTextureFromFileInMem(LPDIRECT3DDEVICE8 device, void* fileMem, DWORD fileSize, LPDIRECT3DTEXTURE8* dstTexture) {
@@ -325,9 +486,7 @@ HRESULT GfxCreateTextureFromFileInMem(LPDIRECT3DDEVICE8 device, void* fileMem, D
 
     if (pixels) {
         // convert ABGR -> ARGB
-        for (int i = 0, numPixels = width * height; i < numPixels; ++i) {
-            std::swap(pixels[i * 4 + 0], pixels[i * 4 + 2]);
-        }
+        MipChain::SwapRedBlue(pixels, static_cast<size_t>(width) * height);
     }
 
     format = D3DFMT_A8R8G8B8;
@@ -356,3 +515,16 @@ HRESULT GfxCreateTextureFromFileInMem(LPDIRECT3DDEVICE8 device, void* fileMem, D
 
     return hr;
 }
+
+HRESULT GfxCreateTextureFromRaw(LPDIRECT3DDEVICE8 device, const GfxRawTexture& raw, LPDIRECT3DTEXTURE8* dstTexture) {
+    if (!device || !raw.pixels || !raw.width || !raw.height || !raw.numMips || !dstTexture) {
+        return D3DERR_INVALIDCALL;
+    }
+
+    HRESULT hr = device->CreateTexture(raw.width, raw.height, raw.numMips, 0u, D3DFMT_A8R8G8B8, D3DPOOL_MANAGED, dstTexture);
+    if (SUCCEEDED(hr)) {
+        hr = UploadMipChain(dstTexture[0], reinterpret_cast<const uint8_t*>(raw.pixels), raw.width, raw.height, raw.numMips);
+    }
+
+    return hr;
+}
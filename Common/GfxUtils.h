@@ -4,6 +4,8 @@
 
 #include "Wrappers\d3d8\d3d8wrapper.h"
 
+#include <functional>
+
 // flags for the GfxCreateTextureFromFile
 #define GCTFF_BUILD_MIPS    0x00000001  // will generate mips if not present in the file
 
@@ -11,8 +13,28 @@
 HRESULT GfxCreateTextureFromFileA(LPDIRECT3DDEVICE8 device, LPCSTR srcFile, LPDIRECT3DTEXTURE8* dstTexture, DWORD flags);
 HRESULT GfxCreateTextureFromFileW(LPDIRECT3DDEVICE8 device, LPCWSTR srcFile, LPDIRECT3DTEXTURE8* dstTexture, DWORD flags);
 
+// loads the texture on a worker thread, onReady is called with the result on the render thread from GfxPumpTextureLoads,
+// room scoped loads are cancelled if the room changes before they finish and then never call onReady
+using GfxTextureReadyFn = std::function<void(HRESULT hr, LPDIRECT3DTEXTURE8 texture)>;
+uint64_t GfxLoadTextureFromFileAsync(LPDIRECT3DDEVICE8 device, LPCWSTR srcFile, DWORD flags, int priority, bool roomScoped, GfxTextureReadyFn onReady);
+void GfxCancelTextureLoad(uint64_t loadId);
+void GfxPumpTextureLoads();
+
+// textures loaded from files are kept decoded in memory, so recreating them after a reset skips the disk
+void GfxLogTextureCacheStats();
+
 HRESULT GfxCreateTextureFromFileInMem(LPDIRECT3DDEVICE8 device, void* fileMem, DWORD fileSize, LPDIRECT3DTEXTURE8* dstTexture);
 
+// a texture decoded at build time (see Resources/Textures/BakeTexture.py), levels are tightly packed A8R8G8B8
+struct GfxRawTexture {
+    uint32_t        width;
+    uint32_t        height;
+    uint32_t        numMips;
+    const uint32_t* pixels;
+};
+
+HRESULT GfxCreateTextureFromRaw(LPDIRECT3DDEVICE8 device, const GfxRawTexture& raw, LPDIRECT3DTEXTURE8* dstTexture);
+
 #ifdef UNICODE
 #define GfxCreateTextureFromFile GfxCreateTextureFromFileW
 #else
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+// Fast non-cryptographic 64-bit hash, used to fingerprint resource contents and cache keys
+inline uint64_t Hash64(const void *pData, size_t Size, uint64_t Seed = 0)
+{
+	constexpr uint64_t Prime1 = 0x9E3779B185EBCA87ULL;
+	constexpr uint64_t Prime2 = 0xC2B2AE3D27D4EB4FULL;
+
+	const uint8_t *pBytes = static_cast<const uint8_t*>(pData);
+	uint64_t Hash = Seed ^ (Size * Prime1);
+
+	// Mix eight bytes at a time
+	while (Size >= 8)
+	{
+		uint64_t Word;
+		memcpy(&Word, pBytes, sizeof(Word));
+		Word *= Prime2;
+		Word = (Word << 31) | (Word >> 33);
+		Hash ^= Word * Prime1;
+		Hash = ((Hash << 27) | (Hash >> 37)) * Prime1 + Prime2;
+		pBytes += 8;
+		Size -= 8;
+	}
+
+	// Tail bytes
+	while (Size--)
+	{
+		Hash ^= (*pBytes++) * Prime1;
+		Hash = ((Hash << 11) | (Hash >> 53)) * Prime2;
+	}
+
+	// Final avalanche
+	Hash ^= Hash >> 33;
+	Hash *= Prime2;
+	Hash ^= Hash >> 29;
+	Hash *= Prime1;
+	Hash ^= Hash >> 32;
+	return Hash;
+}
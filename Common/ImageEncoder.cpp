@@ -0,0 +1,681 @@
+/**
+* Copyright (C) 2024 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "ImageEncoder.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define IMAGEENCODER_SSE2
+#endif
+
+namespace
+{
+	constexpr uint32_t BytesPerPixel = 4;
+	constexpr uint32_t MinRowsPerStrip = 32;
+
+	// CRC-32 used by PNG chunks, slicing by four bytes
+	struct CRCTABLE
+	{
+		uint32_t Table[4][256];
+
+		CRCTABLE()
+		{
+			for (uint32_t n = 0; n < 256; n++)
+			{
+				uint32_t c = n;
+				for (int k = 0; k < 8; k++)
+				{
+					c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+				}
+				Table[0][n] = c;
+			}
+			for (uint32_t n = 0; n < 256; n++)
+			{
+				for (int k = 1; k < 4; k++)
+				{
+					Table[k][n] = Table[0][Table[k - 1][n] & 0xFF] ^ (Table[k - 1][n] >> 8);
+				}
+			}
+		}
+	};
+	const CRCTABLE CRC;
+
+	uint32_t UpdateCRC(uint32_t Crc, const uint8_t *pData, size_t Size)
+	{
+		Crc = ~Crc;
+		for (; Size >= 4; Size -= 4, pData += 4)
+		{
+			Crc ^= static_cast<uint32_t>(pData[0]) | static_cast<uint32_t>(pData[1]) << 8 | static_cast<uint32_t>(pData[2]) << 16 | static_cast<uint32_t>(pData[3]) << 24;
+			Crc = CRC.Table[3][Crc & 0xFF] ^ CRC.Table[2][(Crc >> 8) & 0xFF] ^ CRC.Table[1][(Crc >> 16) & 0xFF] ^ CRC.Table[0][Crc >> 24];
+		}
+		while (Size--)
+		{
+			Crc = CRC.Table[0][(Crc ^ *pData++) & 0xFF] ^ (Crc >> 8);
+		}
+		return ~Crc;
+	}
+
+	// Adler-32 used by the zlib stream, strips are checksummed in parallel and combined afterwards
+	constexpr uint32_t AdlerBase = 65521;
+
+	uint32_t Adler32(const uint8_t *pData, size_t Size)
+	{
+		uint32_t a = 1, b = 0;
+		while (Size)
+		{
+			// Largest run that cannot overflow 32 bits before the modulo
+			size_t Run = std::min<size_t>(Size, 5552);
+			Size -= Run;
+			while (Run--)
+			{
+				a += *pData++;
+				b += a;
+			}
+			a %= AdlerBase;
+			b %= AdlerBase;
+		}
+		return a | (b << 16);
+	}
+
+	uint32_t CombineAdler32(uint32_t Adler1, uint32_t Adler2, size_t Size2)
+	{
+		const uint32_t Rem = static_cast<uint32_t>(Size2 % AdlerBase);
+		uint32_t Sum1 = Adler1 & 0xFFFF;
+		uint32_t Sum2 = (Rem * Sum1) % AdlerBase;
+		Sum1 += (Adler2 & 0xFFFF) + AdlerBase - 1;
+		Sum2 += ((Adler1 >> 16) & 0xFFFF) + ((Adler2 >> 16) & 0xFFFF) + AdlerBase - Rem;
+		if (Sum1 >= AdlerBase) Sum1 -= AdlerBase;
+		if (Sum1 >= AdlerBase) Sum1 -= AdlerBase;
+		if (Sum2 >= (AdlerBase << 1)) Sum2 -= (AdlerBase << 1);
+		if (Sum2 >= AdlerBase) Sum2 -= AdlerBase;
+		return Sum1 | (Sum2 << 16);
+	}
+
+	// Fixed Huffman code tables from RFC 1951 section 3.2.6, codes are stored bit reversed
+	struct DEFLATETABLES
+	{
+		uint16_t LitCode[288];
+		uint8_t LitBits[288];
+		uint16_t LenSym[259];
+		uint8_t LenExtraBits[259];
+		uint16_t LenExtra[259];
+		uint8_t DistSym[512];
+		uint8_t DistCode[30];
+		uint8_t DistExtraBits[30];
+		uint16_t DistBase[30];
+
+		static uint16_t Reverse(uint32_t Code, uint32_t Bits)
+		{
+			uint32_t Result = 0;
+			while (Bits--)
+			{
+				Result = (Result << 1) | (Code & 1);
+				Code >>= 1;
+			}
+			return static_cast<uint16_t>(Result);
+		}
+
+		DEFLATETABLES()
+		{
+			for (uint32_t Sym = 0; Sym < 288; Sym++)
+			{
+				uint32_t Code, Bits;
+				if (Sym < 144) { Code = 0x30 + Sym; Bits = 8; }
+				else if (Sym < 256) { Code = 0x190 + Sym - 144; Bits = 9; }
+				else if (Sym < 280) { Code = Sym - 256; Bits = 7; }
+				else { Code = 0xC0 + Sym - 280; Bits = 8; }
+				LitCode[Sym] = Reverse(Code, Bits);
+				LitBits[Sym] = static_cast<uint8_t>(Bits);
+			}
+
+			static constexpr uint16_t LenBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+			static constexpr uint8_t LenBits[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+			for (uint32_t Code = 0; Code < 29; Code++)
+			{
+				for (uint32_t Len = LenBase[Code]; Len < LenBase[Code] + (1u << LenBits[Code]) && Len <= 258; Len++)
+				{
+					LenSym[Len] = static_cast<uint16_t>(257 + Code);
+					LenExtraBits[Len] = LenBits[Code];
+					LenExtra[Len] = static_cast<uint16_t>(Len - LenBase[Code]);
+				}
+			}
+
+			static constexpr uint16_t DBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+			static constexpr uint8_t DBits[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+			for (uint32_t Code = 0; Code < 30; Code++)
+			{
+				DistCode[Code] = static_cast<uint8_t>(Reverse(Code, 5));
+				DistExtraBits[Code] = DBits[Code];
+				DistBase[Code] = DBase[Code];
+				for (uint32_t Dist = DBase[Code]; Dist < DBase[Code] + (1u << DBits[Code]); Dist++)
+				{
+					DistSym[Dist - 1 < 256 ? Dist - 1 : 256 + ((Dist - 1) >> 7)] = static_cast<uint8_t>(Code);
+				}
+			}
+		}
+	};
+	const DEFLATETABLES Deflate;
+
+	// LSB first bit writer into a preallocated buffer
+	class BITWRITER
+	{
+	public:
+		explicit BITWRITER(uint8_t *pOut) : pData(pOut), pStart(pOut) {}
+
+		void Put(uint32_t Value, uint32_t Count)
+		{
+			Bits |= static_cast<uint64_t>(Value) << BitCount;
+			BitCount += Count;
+			if (BitCount >= 32)
+			{
+				const uint32_t Word = static_cast<uint32_t>(Bits);
+				memcpy(pData, &Word, sizeof(Word));
+				pData += 4;
+				Bits >>= 32;
+				BitCount -= 32;
+			}
+		}
+
+		void Align()
+		{
+			while (BitCount > 0)
+			{
+				*pData++ = static_cast<uint8_t>(Bits);
+				Bits >>= 8;
+				BitCount = BitCount > 8 ? BitCount - 8 : 0;
+			}
+			Bits = 0;
+		}
+
+		void PutByte(uint8_t Value) { *pData++ = Value; }
+		size_t Size() const { return pData - pStart; }
+
+	private:
+		uint8_t *pData;
+		uint8_t *pStart;
+		uint64_t Bits = 0;
+		uint32_t BitCount = 0;
+	};
+
+	inline uint32_t Read32(const uint8_t *p)
+	{
+		uint32_t Value;
+		memcpy(&Value, p, sizeof(Value));
+		return Value;
+	}
+
+	// Deflates one strip as raw deflate blocks that end on a byte boundary, so strips can simply be concatenated
+	void DeflateStrip(const uint8_t *pData, size_t Size, bool Last, int Level, std::vector<uint8_t> &Out, size_t Offset)
+	{
+		if (Level <= ImageEncoder::PNG_STORED)
+		{
+			Out.resize(Offset + Size + (Size / 65535 + 1) * 5);
+			uint8_t *pOut = Out.data() + Offset;
+			do {
+				const size_t Block = std::min<size_t>(Size, 65535);
+				Size -= Block;
+				*pOut++ = (Last && !Size) ? 1 : 0;
+				*pOut++ = static_cast<uint8_t>(Block);
+				*pOut++ = static_cast<uint8_t>(Block >> 8);
+				*pOut++ = static_cast<uint8_t>(~Block);
+				*pOut++ = static_cast<uint8_t>(~Block >> 8);
+				memcpy(pOut, pData, Block);
+				pOut += Block;
+				pData += Block;
+			} while (Size);
+			Out.resize(pOut - Out.data());
+			return;
+		}
+
+		// Worst case is every byte as a 9 bit literal
+		Out.resize(Offset + Size + Size / 8 + 64);
+		BITWRITER Writer(Out.data() + Offset);
+
+		const auto PutLiteral = [&](uint8_t Value)
+		{
+			Writer.Put(Deflate.LitCode[Value], Deflate.LitBits[Value]);
+		};
+
+		Writer.Put(Last ? 1 : 0, 1);	// BFINAL
+		Writer.Put(1, 2);				// BTYPE fixed Huffman
+
+		constexpr uint32_t HashBits = 15;
+		std::vector<int32_t> Head(1u << HashBits, -1);
+		const auto Hash = [](uint32_t Value) { return (Value * 2654435761u) >> (32 - HashBits); };
+
+		size_t Pos = 0;
+		while (Pos + 4 <= Size)
+		{
+			const uint32_t Value = Read32(pData + Pos);
+			const uint32_t h = Hash(Value);
+			const int32_t Candidate = Head[h];
+			Head[h] = static_cast<int32_t>(Pos);
+
+			if (Candidate < 0 || Pos - Candidate > 32768 || Read32(pData + Candidate) != Value)
+			{
+				PutLiteral(pData[Pos++]);
+				continue;
+			}
+
+			// Extend the match eight bytes at a time
+			const size_t MaxLen = std::min<size_t>(258, Size - Pos);
+			size_t Len = 4;
+			while (Len + 8 <= MaxLen)
+			{
+				uint64_t a, b;
+				memcpy(&a, pData + Candidate + Len, sizeof(a));
+				memcpy(&b, pData + Pos + Len, sizeof(b));
+				if (a != b)
+				{
+					break;
+				}
+				Len += 8;
+			}
+			while (Len < MaxLen && pData[Candidate + Len] == pData[Pos + Len])
+			{
+				Len++;
+			}
+
+			const uint32_t Dist = static_cast<uint32_t>(Pos - Candidate);
+			const uint16_t LenSym = Deflate.LenSym[Len];
+			Writer.Put(Deflate.LitCode[LenSym], Deflate.LitBits[LenSym]);
+			Writer.Put(Deflate.LenExtra[Len], Deflate.LenExtraBits[Len]);
+			const uint8_t DistSym = Deflate.DistSym[Dist - 1 < 256 ? Dist - 1 : 256 + ((Dist - 1) >> 7)];
+			Writer.Put(Deflate.DistCode[DistSym], 5);
+			Writer.Put(Dist - Deflate.DistBase[DistSym], Deflate.DistExtraBits[DistSym]);
+
+			// Index the matched bytes too for a better ratio
+			if (Level >= ImageEncoder::PNG_BALANCED)
+			{
+				for (size_t x = Pos + 1; x < Pos + Len && x + 4 <= Size; x++)
+				{
+					Head[Hash(Read32(pData + x))] = static_cast<int32_t>(x);
+				}
+			}
+			Pos += Len;
+		}
+		while (Pos < Size)
+		{
+			PutLiteral(pData[Pos++]);
+		}
+
+		// End of block
+		Writer.Put(Deflate.LitCode[256], Deflate.LitBits[256]);
+
+		// Empty stored block to realign to a byte boundary, the same as a zlib sync flush
+		if (!Last)
+		{
+			Writer.Put(0, 3);
+			Writer.Align();
+			Writer.PutByte(0x00);
+			Writer.PutByte(0x00);
+			Writer.PutByte(0xFF);
+			Writer.PutByte(0xFF);
+		}
+		Writer.Align();
+
+		Out.resize(Offset + Writer.Size());
+	}
+
+	inline uint8_t Paeth(int a, int b, int c)
+	{
+		const int p = a + b - c;
+		const int pa = abs(p - a);
+		const int pb = abs(p - b);
+		const int pc = abs(p - c);
+		return static_cast<uint8_t>((pa <= pb && pa <= pc) ? a : (pb <= pc) ? b : c);
+	}
+
+	// Applies one PNG filter to a row, returns the sum of absolute signed residuals
+	uint32_t FilterRow(uint8_t Type, const uint8_t *pCur, const uint8_t *pPrev, uint8_t *pOut, size_t RowBytes)
+	{
+		uint32_t Sum = 0;
+		for (size_t x = 0; x < RowBytes; x++)
+		{
+			const uint8_t a = x >= BytesPerPixel ? pCur[x - BytesPerPixel] : 0;
+			const uint8_t b = pPrev[x];
+			const uint8_t c = x >= BytesPerPixel ? pPrev[x - BytesPerPixel] : 0;
+			uint8_t Value = pCur[x];
+			switch (Type)
+			{
+			case 1: Value -= a; break;
+			case 2: Value -= b; break;
+			case 3: Value -= static_cast<uint8_t>((a + b) >> 1); break;
+			case 4: Value -= Paeth(a, b, c); break;
+			}
+			pOut[x] = Value;
+			Sum += static_cast<uint32_t>(abs(static_cast<int8_t>(Value)));
+		}
+		return Sum;
+	}
+
+	struct STRIP
+	{
+		uint32_t FirstRow = 0;
+		uint32_t Rows = 0;
+		uint32_t Adler = 1;
+		size_t FilteredSize = 0;
+		std::vector<uint8_t> Chunk;		// Complete IDAT chunk for this strip
+	};
+
+	void WriteBE32(uint8_t *p, uint32_t Value)
+	{
+		p[0] = static_cast<uint8_t>(Value >> 24);
+		p[1] = static_cast<uint8_t>(Value >> 16);
+		p[2] = static_cast<uint8_t>(Value >> 8);
+		p[3] = static_cast<uint8_t>(Value);
+	}
+
+	void AppendChunk(std::vector<uint8_t> &Out, const char *Type, const uint8_t *pData, uint32_t Size)
+	{
+		const size_t Start = Out.size();
+		Out.resize(Start + 12 + Size);
+		uint8_t *p = Out.data() + Start;
+		WriteBE32(p, Size);
+		memcpy(p + 4, Type, 4);
+		if (Size)
+		{
+			memcpy(p + 8, pData, Size);
+		}
+		WriteBE32(p + 8 + Size, UpdateCRC(0, p + 4, Size + 4));
+	}
+
+	void EncodeStrip(STRIP &Strip, const uint8_t *pBGRA, uint32_t Width, uint32_t Pitch, int Level, bool First, bool Last)
+	{
+		const size_t RowBytes = static_cast<size_t>(Width) * BytesPerPixel;
+		std::vector<uint8_t> Filtered((RowBytes + 1) * Strip.Rows);
+		std::vector<uint8_t> Rows(RowBytes * 2, 0);
+		std::vector<uint8_t> Scratch(Level >= ImageEncoder::PNG_BALANCED ? RowBytes * 2 : 0);
+		uint8_t *pPrev = Rows.data();
+		uint8_t *pCur = Rows.data() + RowBytes;
+
+		// Filters reference the last row of the previous strip
+		if (Strip.FirstRow)
+		{
+			ImageEncoder::SwizzleBGRAToRGBA(pBGRA + static_cast<size_t>(Strip.FirstRow - 1) * Pitch, pPrev, Width);
+		}
+
+		uint8_t *pOut = Filtered.data();
+		for (uint32_t y = 0; y < Strip.Rows; y++)
+		{
+			ImageEncoder::SwizzleBGRAToRGBA(pBGRA + static_cast<size_t>(Strip.FirstRow + y) * Pitch, pCur, Width);
+
+			if (Level <= ImageEncoder::PNG_STORED)
+			{
+				*pOut = 0;
+				memcpy(pOut + 1, pCur, RowBytes);
+			}
+			else if (Level == ImageEncoder::PNG_FAST)
+			{
+				*pOut = 1;
+				FilterRow(1, pCur, pPrev, pOut + 1, RowBytes);
+			}
+			else
+			{
+				// Pick the filter with the smallest residuals
+				uint8_t *pBest = pOut + 1;
+				uint8_t *pTry = Scratch.data();
+				uint32_t BestSum = FilterRow(0, pCur, pPrev, pBest, RowBytes);
+				uint8_t BestType = 0;
+				for (uint8_t Type = 1; Type <= 4; Type++)
+				{
+					const uint32_t Sum = FilterRow(Type, pCur, pPrev, pTry, RowBytes);
+					if (Sum < BestSum)
+					{
+						BestSum = Sum;
+						BestType = Type;
+						std::swap(pBest, pTry);
+					}
+				}
+				if (pBest != pOut + 1)
+				{
+					memcpy(pOut + 1, pBest, RowBytes);
+				}
+				*pOut = BestType;
+			}
+
+			pOut += RowBytes + 1;
+			std::swap(pPrev, pCur);
+		}
+
+		Strip.FilteredSize = Filtered.size();
+		Strip.Adler = Adler32(Filtered.data(), Filtered.size());
+
+		// Chunk header, zlib header on the first strip, then the deflate data
+		const size_t Header = 8 + (First ? 2 : 0);
+		DeflateStrip(Filtered.data(), Filtered.size(), Last, Level, Strip.Chunk, Header);
+		uint8_t *p = Strip.Chunk.data();
+		memcpy(p + 4, "IDAT", 4);
+		if (First)
+		{
+			p[8] = 0x78;	// Deflate with a 32K window
+			p[9] = 0x01;	// No preset dictionary, lowest level hint
+		}
+		const uint32_t DataSize = static_cast<uint32_t>(Strip.Chunk.size() - 8);
+		WriteBE32(p, DataSize);
+		Strip.Chunk.resize(Strip.Chunk.size() + 4);
+		p = Strip.Chunk.data();
+		WriteBE32(p + 8 + DataSize, UpdateCRC(0, p + 4, DataSize + 4));
+	}
+}
+
+void ImageEncoder::SwizzleBGRAToRGBA(const uint8_t *pSrc, uint8_t *pDst, size_t Pixels)
+{
+	size_t x = 0;
+
+#ifdef IMAGEENCODER_SSE2
+	// Swap the red and blue bytes of four pixels at a time and force alpha to 0xFF
+	const __m128i MaskGreen = _mm_set1_epi32(0x0000FF00);
+	const __m128i MaskByte = _mm_set1_epi32(0x000000FF);
+	const __m128i Alpha = _mm_set1_epi32(static_cast<int>(0xFF000000));
+	for (; x + 4 <= Pixels; x += 4)
+	{
+		const __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + x * 4));
+		const __m128i g = _mm_and_si128(p, MaskGreen);
+		const __m128i r = _mm_and_si128(_mm_srli_epi32(p, 16), MaskByte);
+		const __m128i b = _mm_slli_epi32(_mm_and_si128(p, MaskByte), 16);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + x * 4), _mm_or_si128(_mm_or_si128(g, Alpha), _mm_or_si128(r, b)));
+	}
+#endif
+
+	for (; x < Pixels; x++)
+	{
+		uint32_t p;
+		memcpy(&p, pSrc + x * 4, sizeof(p));
+		p = (p & 0x0000FF00) | ((p >> 16) & 0xFF) | ((p & 0xFF) << 16) | 0xFF000000;
+		memcpy(pDst + x * 4, &p, sizeof(p));
+	}
+}
+
+bool ImageEncoder::EncodePNG(const uint8_t *pBGRA, uint32_t Width, uint32_t Height, uint32_t Pitch, int Level, std::vector<uint8_t> &Out, uint32_t Threads)
+{
+	if (!pBGRA || !Width || !Height || Pitch < Width * BytesPerPixel)
+	{
+		return false;
+	}
+
+	// Split the image into horizontal strips, one per thread
+	if (!Threads)
+	{
+		Threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	const uint32_t StripCount = std::max(1u, std::min(Threads, Height / MinRowsPerStrip));
+	std::vector<STRIP> Strips(StripCount);
+	for (uint32_t x = 0; x < StripCount; x++)
+	{
+		Strips[x].FirstRow = Height * x / StripCount;
+		Strips[x].Rows = Height * (x + 1) / StripCount - Strips[x].FirstRow;
+	}
+
+	std::vector<std::thread> Workers;
+	Workers.reserve(StripCount - 1);
+	for (uint32_t x = 1; x < StripCount; x++)
+	{
+		Workers.emplace_back(EncodeStrip, std::ref(Strips[x]), pBGRA, Width, Pitch, Level, false, x == StripCount - 1);
+	}
+	EncodeStrip(Strips[0], pBGRA, Width, Pitch, Level, true, StripCount == 1);
+	for (auto &Worker : Workers)
+	{
+		Worker.join();
+	}
+
+	// Assemble the file
+	size_t TotalSize = 8 + 25 + 16 + 12;
+	for (const auto &Strip : Strips)
+	{
+		TotalSize += Strip.Chunk.size();
+	}
+	Out.clear();
+	Out.reserve(TotalSize);
+
+	static constexpr uint8_t Signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	Out.insert(Out.end(), Signature, Signature + sizeof(Signature));
+
+	uint8_t IHDR[13] = {};
+	WriteBE32(IHDR, Width);
+	WriteBE32(IHDR + 4, Height);
+	IHDR[8] = 8;	// Bit depth
+	IHDR[9] = 6;	// RGBA
+	AppendChunk(Out, "IHDR", IHDR, sizeof(IHDR));
+
+	uint32_t Adler = Strips[0].Adler;
+	for (uint32_t x = 0; x < StripCount; x++)
+	{
+		if (x)
+		{
+			Adler = CombineAdler32(Adler, Strips[x].Adler, Strips[x].FilteredSize);
+		}
+		Out.insert(Out.end(), Strips[x].Chunk.begin(), Strips[x].Chunk.end());
+	}
+
+	// The zlib trailer goes in its own IDAT chunk, PNG decoders join all IDAT chunks into one stream
+	uint8_t Trailer[4];
+	WriteBE32(Trailer, Adler);
+	AppendChunk(Out, "IDAT", Trailer, sizeof(Trailer));
+	AppendChunk(Out, "IEND", nullptr, 0);
+
+	return true;
+}
+
+bool ImageEncoder::EncodeQOI(const uint8_t *pBGRA, uint32_t Width, uint32_t Height, uint32_t Pitch, std::vector<uint8_t> &Out)
+{
+	if (!pBGRA || !Width || !Height || Pitch < Width * BytesPerPixel)
+	{
+		return false;
+	}
+
+	enum : uint8_t
+	{
+		QOI_OP_INDEX = 0x00,
+		QOI_OP_DIFF = 0x40,
+		QOI_OP_LUMA = 0x80,
+		QOI_OP_RUN = 0xC0,
+		QOI_OP_RGB = 0xFE,
+	};
+
+	// Worst case is every pixel as QOI_OP_RGB
+	Out.resize(14 + static_cast<size_t>(Width) * Height * 4 + 8);
+	uint8_t *p = Out.data();
+	memcpy(p, "qoif", 4);
+	WriteBE32(p + 4, Width);
+	WriteBE32(p + 8, Height);
+	p[12] = 3;	// RGB, alpha is always opaque
+	p[13] = 0;	// sRGB
+	p += 14;
+
+	uint32_t Index[64] = {};
+	uint32_t Prev = 0xFF000000;		// r, g, b = 0, a = 255 in RGBA byte order
+	uint32_t Run = 0;
+	std::vector<uint8_t> Row(static_cast<size_t>(Width) * BytesPerPixel);
+
+	for (uint32_t y = 0; y < Height; y++)
+	{
+		SwizzleBGRAToRGBA(pBGRA + static_cast<size_t>(y) * Pitch, Row.data(), Width);
+		const bool LastRow = (y == Height - 1);
+
+		for (uint32_t x = 0; x < Width; x++)
+		{
+			uint32_t Pixel;
+			memcpy(&Pixel, Row.data() + x * 4, sizeof(Pixel));
+
+			if (Pixel == Prev)
+			{
+				if (++Run == 62 || (LastRow && x == Width - 1))
+				{
+					*p++ = static_cast<uint8_t>(QOI_OP_RUN | (Run - 1));
+					Run = 0;
+				}
+				continue;
+			}
+
+			if (Run)
+			{
+				*p++ = static_cast<uint8_t>(QOI_OP_RUN | (Run - 1));
+				Run = 0;
+			}
+
+			const uint8_t r = static_cast<uint8_t>(Pixel);
+			const uint8_t g = static_cast<uint8_t>(Pixel >> 8);
+			const uint8_t b = static_cast<uint8_t>(Pixel >> 16);
+			const uint32_t Hash = (r * 3 + g * 5 + b * 7 + 255 * 11) % 64;
+
+			if (Index[Hash] == Pixel)
+			{
+				*p++ = static_cast<uint8_t>(QOI_OP_INDEX | Hash);
+			}
+			else
+			{
+				Index[Hash] = Pixel;
+
+				const int8_t vr = static_cast<int8_t>(r - static_cast<uint8_t>(Prev));
+				const int8_t vg = static_cast<int8_t>(g - static_cast<uint8_t>(Prev >> 8));
+				const int8_t vb = static_cast<int8_t>(b - static_cast<uint8_t>(Prev >> 16));
+				const int8_t vg_r = static_cast<int8_t>(vr - vg);
+				const int8_t vg_b = static_cast<int8_t>(vb - vg);
+
+				if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2)
+				{
+					*p++ = static_cast<uint8_t>(QOI_OP_DIFF | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2));
+				}
+				else if (vg_r > -9 && vg_r < 8 && vg > -33 && vg < 32 && vg_b > -9 && vg_b < 8)
+				{
+					*p++ = static_cast<uint8_t>(QOI_OP_LUMA | (vg + 32));
+					*p++ = static_cast<uint8_t>((vg_r + 8) << 4 | (vg_b + 8));
+				}
+				else
+				{
+					*p++ = QOI_OP_RGB;
+					*p++ = r;
+					*p++ = g;
+					*p++ = b;
+				}
+			}
+			Prev = Pixel;
+		}
+	}
+
+	// End marker
+	static constexpr uint8_t Padding[8] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+	memcpy(p, Padding, sizeof(Padding));
+	p += sizeof(Padding);
+
+	Out.resize(p - Out.data());
+	return true;
+}
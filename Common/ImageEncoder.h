@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Screenshot encoders for 32-bit BGRA frames read back from the device, alpha is always written as opaque
+namespace ImageEncoder
+{
+	// PNG compression levels
+	enum PNGLEVEL : int
+	{
+		PNG_STORED = 0,		// No compression, fastest
+		PNG_FAST = 1,		// Sub filter and greedy LZ77 with fixed Huffman codes
+		PNG_BALANCED = 2,	// Adaptive filter per row and a denser match search
+	};
+
+	// Swizzles a row of BGRA pixels to RGBA with an opaque alpha channel
+	void SwizzleBGRAToRGBA(const uint8_t *pSrc, uint8_t *pDst, size_t Pixels);
+
+	// Filters and deflates horizontal strips of the image in parallel, Threads = 0 uses all cores
+	bool EncodePNG(const uint8_t *pBGRA, uint32_t Width, uint32_t Height, uint32_t Pitch, int Level, std::vector<uint8_t> &Out, uint32_t Threads = 0);
+
+	// Lossless "Quite OK Image" format, single pass and several times faster than PNG
+	bool EncodeQOI(const uint8_t *pBGRA, uint32_t Width, uint32_t Height, uint32_t Pitch, std::vector<uint8_t> &Out);
+}
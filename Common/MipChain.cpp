@@ -0,0 +1,172 @@
+#include "MipChain.h"
+
+#include <emmintrin.h>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace {
+    constexpr uint32_t kCacheMagic   = 0x4D324853;  // 'SH2M'
+    constexpr uint32_t kCacheVersion = 1;
+
+    struct CacheHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t sourceHash;
+        uint32_t width;
+        uint32_t height;
+        uint32_t numLevels;
+        uint32_t reserved;
+    };
+
+    inline void AverageQuad(const uint8_t* a, const uint8_t* b, const uint8_t* c, const uint8_t* d, uint8_t* dst) {
+        for (int i = 0; i < 4; ++i) {
+            dst[i] = static_cast<uint8_t>((a[i] + b[i] + c[i] + d[i] + 2) >> 2);
+        }
+    }
+
+    // adds the two 16-bit pixels of a row sum together, the result lands in the low half
+    inline __m128i SumPairs(__m128i rowSum) {
+        return _mm_add_epi16(rowSum, _mm_srli_si128(rowSum, 8));
+    }
+}
+
+uint32_t MipChain::LevelCount(uint32_t width, uint32_t height) {
+    uint32_t biggest = (std::max)(width, height), result = 1;
+    while (biggest >>= 1) {
+        ++result;
+    }
+    return result;
+}
+
+size_t MipChain::ChainSize(uint32_t width, uint32_t height, uint32_t numLevels) {
+    size_t result = 0;
+    for (uint32_t i = 0; i < numLevels; ++i) {
+        result += static_cast<size_t>((std::max)(width >> i, 1u)) * (std::max)(height >> i, 1u) * 4;
+    }
+    return result;
+}
+
+void MipChain::SwapRedBlue(uint8_t* pixels, size_t numPixels) {
+    const __m128i maskGA = _mm_set1_epi32(0xFF00FF00);
+    const __m128i maskRB = _mm_set1_epi32(0x000000FF);
+
+    size_t i = 0;
+    for (; i + 4 <= numPixels; i += 4) {
+        __m128i* p = reinterpret_cast<__m128i*>(pixels + i * 4);
+        const __m128i v = _mm_loadu_si128(p);
+        const __m128i lo = _mm_and_si128(_mm_srli_epi32(v, 16), maskRB);
+        const __m128i hi = _mm_slli_epi32(_mm_and_si128(v, maskRB), 16);
+        _mm_storeu_si128(p, _mm_or_si128(_mm_and_si128(v, maskGA), _mm_or_si128(lo, hi)));
+    }
+    for (; i < numPixels; ++i) {
+        std::swap(pixels[i * 4 + 0], pixels[i * 4 + 2]);
+    }
+}
+
+void MipChain::Downsample(const uint8_t* src, uint32_t srcWidth, uint32_t srcHeight, uint8_t* dst) {
+    const uint32_t dstWidth = (std::max)(srcWidth >> 1, 1u);
+    const uint32_t dstHeight = (std::max)(srcHeight >> 1, 1u);
+    const size_t srcPitch = static_cast<size_t>(srcWidth) * 4;
+
+    // 1-pixel wide or tall sources reuse the same column or row
+    const uint32_t stepX = srcWidth > 1 ? 1 : 0;
+    const size_t stepY = srcHeight > 1 ? srcPitch : 0;
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi16(2);
+
+    for (uint32_t y = 0; y < dstHeight; ++y) {
+        const uint8_t* row0 = src + static_cast<size_t>(y) * 2 * stepY;
+        const uint8_t* row1 = row0 + stepY;
+        uint8_t* out = dst + static_cast<size_t>(y) * dstWidth * 4;
+
+        uint32_t x = 0;
+        if (stepX) {
+            // 8 source pixels from each row into 4 destination pixels
+            for (; x + 4 <= dstWidth; x += 4) {
+                const __m128i a0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + x * 8));
+                const __m128i a1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + x * 8 + 16));
+                const __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + x * 8));
+                const __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + x * 8 + 16));
+
+                const __m128i s0 = SumPairs(_mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero)));
+                const __m128i s1 = SumPairs(_mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero)));
+                const __m128i s2 = SumPairs(_mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero)));
+                const __m128i s3 = SumPairs(_mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero)));
+
+                const __m128i p01 = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(s0, s1), round), 2);
+                const __m128i p23 = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(s2, s3), round), 2);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x * 4), _mm_packus_epi16(p01, p23));
+            }
+        }
+        for (; x < dstWidth; ++x) {
+            const uint8_t* a = row0 + static_cast<size_t>(x) * 2 * stepX * 4;
+            const uint8_t* b = row1 + static_cast<size_t>(x) * 2 * stepX * 4;
+            AverageQuad(a, a + stepX * 4, b, b + stepX * 4, out + x * 4);
+        }
+    }
+}
+
+void MipChain::Build(uint8_t* chain, uint32_t width, uint32_t height, uint32_t numLevels) {
+    uint8_t* src = chain;
+    for (uint32_t i = 1; i < numLevels; ++i) {
+        const uint32_t srcW = (std::max)(width >> (i - 1), 1u);
+        const uint32_t srcH = (std::max)(height >> (i - 1), 1u);
+        uint8_t* dst = src + static_cast<size_t>(srcW) * srcH * 4;
+
+        Downsample(src, srcW, srcH, dst);
+        src = dst;
+    }
+}
+
+bool MipChain::LoadCached(const std::filesystem::path& cacheFile, uint64_t sourceHash, uint32_t& width, uint32_t& height, uint32_t& numLevels, std::vector<uint8_t>& chain) {
+    std::ifstream file(cacheFile, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    CacheHeader header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != kCacheMagic || header.version != kCacheVersion || header.sourceHash != sourceHash ||
+        !header.width || !header.height || !header.numLevels || header.numLevels > LevelCount(header.width, header.height)) {
+        return false;
+    }
+
+    chain.resize(ChainSize(header.width, header.height, header.numLevels));
+    if (!file.read(reinterpret_cast<char*>(chain.data()), chain.size())) {
+        chain.clear();
+        return false;
+    }
+
+    width = header.width;
+    height = header.height;
+    numLevels = header.numLevels;
+    return true;
+}
+
+bool MipChain::StoreCached(const std::filesystem::path& cacheFile, uint64_t sourceHash, uint32_t width, uint32_t height, uint32_t numLevels, const std::vector<uint8_t>& chain) {
+    if (chain.size() != ChainSize(width, height, numLevels)) {
+        return false;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(cacheFile.parent_path(), ec);
+
+    // write to a temporary name first so a crash never leaves a truncated entry behind
+    std::filesystem::path tempFile = cacheFile;
+    tempFile += L".tmp";
+    {
+        std::ofstream file(tempFile, std::ios::binary | std::ios::trunc);
+        const CacheHeader header{ kCacheMagic, kCacheVersion, sourceHash, width, height, numLevels, 0 };
+        if (!file.write(reinterpret_cast<const char*>(&header), sizeof(header)) ||
+            !file.write(reinterpret_cast<const char*>(chain.data()), chain.size())) {
+            file.close();
+            std::filesystem::remove(tempFile, ec);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempFile, cacheFile, ec);
+    return !ec;
+}
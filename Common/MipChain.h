@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+// mip chain generation for 32bpp textures, levels are stored tightly packed one after another
+namespace MipChain {
+    // number of levels down to 1x1
+    uint32_t LevelCount(uint32_t width, uint32_t height);
+    // size in bytes of the first numLevels levels
+    size_t ChainSize(uint32_t width, uint32_t height, uint32_t numLevels);
+
+    // RGBA <-> BGRA in place
+    void SwapRedBlue(uint8_t* pixels, size_t numPixels);
+
+    // 2x2 box filter of one level into the next, odd trailing rows and columns are dropped
+    void Downsample(const uint8_t* src, uint32_t srcWidth, uint32_t srcHeight, uint8_t* dst);
+
+    // fills levels 1..numLevels-1 from level 0, each one from the previous
+    void Build(uint8_t* chain, uint32_t width, uint32_t height, uint32_t numLevels);
+
+    // on-disk cache of built chains, keyed by the hash of the source file
+    bool LoadCached(const std::filesystem::path& cacheFile, uint64_t sourceHash, uint32_t& width, uint32_t& height, uint32_t& numLevels, std::vector<uint8_t>& chain);
+    bool StoreCached(const std::filesystem::path& cacheFile, uint64_t sourceHash, uint32_t width, uint32_t height, uint32_t numLevels, const std::vector<uint8_t>& chain);
+}
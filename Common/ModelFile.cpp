@@ -0,0 +1,679 @@
+#include "ModelFile.h"
+
+#define TINYGLTF_IMPLEMENTATION
+#define TINYGLTF_NOEXCEPTION
+#define TINYGLTF_NO_STB_IMAGE
+#define TINYGLTF_NO_STB_IMAGE_WRITE
+#define TINYGLTF_NO_INCLUDE_STB_IMAGE
+#define TINYGLTF_NO_INCLUDE_STB_IMAGE_WRITE
+#define TINYGLTF_USE_CPP14
+#include <tinygltf/tiny_gltf.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+
+namespace {
+    constexpr uint32_t kFileMagic   = 0x47324853;  // 'SH2G'
+    constexpr uint32_t kFileVersion = 3;
+
+    struct FileHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t sourceSize;
+        uint64_t sourceWriteTime;
+        uint32_t layout;
+        uint32_t reserved;
+    };
+
+    bool ExtensionEqual(const char* filePath, const char* extToCompare) {
+        const size_t len = strnlen(filePath, 1024);
+        return len >= 3 &&
+               tolower(filePath[len - 3]) == tolower(extToCompare[0]) &&
+               tolower(filePath[len - 2]) == tolower(extToCompare[1]) &&
+               tolower(filePath[len - 1]) == tolower(extToCompare[2]);
+    }
+
+    template <typename K, typename T>
+    bool map_contains(const std::map<K, T>& m, const K& key) {
+        return m.find(key) != m.end();
+    }
+
+    uint32_t EncodeVertexColor(const float r, const float g, const float b, const float a) {
+        const uint32_t rb = static_cast<uint8_t>(std::clamp(r * 255.0f, 0.0f, 255.0f));
+        const uint32_t gb = static_cast<uint8_t>(std::clamp(g * 255.0f, 0.0f, 255.0f));
+        const uint32_t bb = static_cast<uint8_t>(std::clamp(b * 255.0f, 0.0f, 255.0f));
+        const uint32_t ab = static_cast<uint8_t>(std::clamp(a * 255.0f, 0.0f, 255.0f));
+
+        // D3DCOLOR_ARGB
+        return (ab << 24) | (rb << 16) | (gb << 8) | bb;
+    }
+
+    void DecodeGLTFVertexColor(ModelFile::VertexPNCT& v, const tinygltf::Accessor* colorAcc, const tinygltf::BufferView* colorView, const tinygltf::Buffer* colorBuff, const size_t idx) {
+        const uint8_t* colorPtrRaw = colorBuff->data.data() + colorAcc->byteOffset + colorView->byteOffset;
+
+        switch (colorAcc->componentType) {
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE: {
+                const uint8_t* colorPtr = colorPtrRaw + (idx * 4);
+                v.color = EncodeVertexColor(colorPtr[0] / 255.0f, colorPtr[1] / 255.0f, colorPtr[2] / 255.0f, colorPtr[3] / 255.0f);
+            } break;
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: {
+                const uint16_t* colorPtr = reinterpret_cast<const uint16_t*>(colorPtrRaw) + (idx * 4);
+                v.color = EncodeVertexColor(colorPtr[0] / 65535.0f, colorPtr[1] / 65535.0f, colorPtr[2] / 65535.0f, colorPtr[3] / 65535.0f);
+            } break;
+            case TINYGLTF_COMPONENT_TYPE_FLOAT: {
+                const float* colorPtr = reinterpret_cast<const float*>(colorPtrRaw) + (idx * 4);
+                v.color = EncodeVertexColor(colorPtr[0], colorPtr[1], colorPtr[2], colorPtr[3]);
+            } break;
+        }
+    }
+
+    template <bool normalized>
+    size_t UnpackComponent(const void* srcData, float& dstData, const int componentType) {
+        switch (componentType) {
+            case TINYGLTF_COMPONENT_TYPE_BYTE: {
+                if constexpr (normalized) {
+                    dstData = fmaxf(*reinterpret_cast<const int8_t*>(srcData) / 127.0f, -1.0f);
+                } else {
+                    dstData = *reinterpret_cast<const int8_t*>(srcData);
+                }
+                return 1;
+            } break;
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE: {
+                if constexpr (normalized) {
+                    dstData = *reinterpret_cast<const uint8_t*>(srcData) / 255.0f;
+                } else {
+                    dstData = *reinterpret_cast<const uint8_t*>(srcData);
+                }
+                return 1;
+            } break;
+            case TINYGLTF_COMPONENT_TYPE_SHORT: {
+                if constexpr (normalized) {
+                    dstData = fmaxf(*reinterpret_cast<const int16_t*>(srcData) / 32767.0f, -1.0f);
+                } else {
+                    dstData = *reinterpret_cast<const int16_t*>(srcData);
+                }
+                return 2;
+            } break;
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: {
+                if constexpr (normalized) {
+                    dstData = *reinterpret_cast<const uint16_t*>(srcData) / 65535.0f;
+                } else {
+                    dstData = *reinterpret_cast<const uint16_t*>(srcData);
+                }
+                return 2;
+            } break;
+
+            default: {
+                dstData = *reinterpret_cast<const float*>(srcData);
+                return 4;
+            }
+        }
+    }
+
+    template <size_t vecSize, bool normalized>
+    size_t UnpackVec(const void* srcData, float* dstData, const int componentType) {
+        size_t offset = UnpackComponent<normalized>(srcData, dstData[0], componentType);
+        offset += UnpackComponent<normalized>(reinterpret_cast<const uint8_t*>(srcData) + offset, dstData[1], componentType);
+        if constexpr (vecSize > 2) {
+            offset += UnpackComponent<normalized>(reinterpret_cast<const uint8_t*>(srcData) + offset, dstData[2], componentType);
+            if constexpr (vecSize > 3) {
+                offset += UnpackComponent<normalized>(reinterpret_cast<const uint8_t*>(srcData) + offset, dstData[3], componentType);
+            }
+        }
+
+        return offset;
+    }
+
+    const uint8_t* AccessorData(const tinygltf::Model& model, const tinygltf::Accessor& acc) {
+        const tinygltf::BufferView& view = model.bufferViews[acc.bufferView];
+        return model.buffers[view.buffer].data.data() + acc.byteOffset + view.byteOffset;
+    }
+
+    ModelFile::Range AppendRange(const size_t first, const size_t count) {
+        return { static_cast<uint32_t>(first), static_cast<uint32_t>(count) };
+    }
+
+    void ReadGLTFTransformation(const tinygltf::Node& srcNode, ModelFile::Node& dstNode) {
+        static const float kPosition[3] = { 0.0f, 0.0f, 0.0f };
+        static const float kRotation[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+        static const float kScale[3] = { 1.0f, 1.0f, 1.0f };
+        std::memcpy(dstNode.position, kPosition, sizeof(kPosition));
+        std::memcpy(dstNode.rotation, kRotation, sizeof(kRotation));
+        std::memcpy(dstNode.scale, kScale, sizeof(kScale));
+
+        if (srcNode.matrix.size() == 16) {
+            assert(false && "Implement matrix decompose !!!");
+            return;
+        }
+
+        if (srcNode.translation.size() == 3) {
+            for (size_t i = 0; i < 3; ++i) {
+                dstNode.position[i] = static_cast<float>(srcNode.translation[i]);
+            }
+        }
+        if (srcNode.rotation.size() == 4) {
+            for (size_t i = 0; i < 4; ++i) {
+                dstNode.rotation[i] = static_cast<float>(srcNode.rotation[i]);
+            }
+        }
+        if (srcNode.scale.size() == 3) {
+            for (size_t i = 0; i < 3; ++i) {
+                dstNode.scale[i] = static_cast<float>(srcNode.scale[i]);
+            }
+        }
+    }
+
+    void CollectAnimation(const tinygltf::Model& src, ModelFile::Model& model) {
+        const tinygltf::Animation& anim = src.animations.front();
+        // iOrange: I assume only one input sampler for simplicity
+        const int timelineSampler = anim.samplers[0].input;
+
+        const tinygltf::Accessor& timelineAcc = src.accessors[timelineSampler];
+        assert(timelineAcc.type == TINYGLTF_TYPE_SCALAR && timelineAcc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT);
+        model.timeline.resize(timelineAcc.count);
+        std::memcpy(model.timeline.data(), AccessorData(src, timelineAcc), timelineAcc.count * sizeof(float));
+
+        for (const tinygltf::AnimationChannel& channel : anim.channels) {
+            const tinygltf::AnimationSampler& sampler = anim.samplers[channel.sampler];
+            assert(sampler.input == timelineSampler);
+            const int targetNode = channel.target_node;
+
+            auto it = std::find_if(model.tracks.begin(), model.tracks.end(), [targetNode](const ModelFile::AnimTrack& track)->bool {
+                return track.target == targetNode;
+            });
+
+            ModelFile::AnimTrack* track;
+            if (it == model.tracks.end()) {
+                model.nodes[targetNode].animTrackIdx = static_cast<int32_t>(model.tracks.size());
+
+                model.tracks.push_back({});
+                track = &model.tracks.back();
+                track->target = targetNode;
+            } else {
+                track = &(*it);
+            }
+
+            const tinygltf::Accessor& channelAcc = src.accessors[sampler.output];
+            assert(channelAcc.count == timelineAcc.count);
+            const uint8_t* srcData = AccessorData(src, channelAcc);
+
+            if (channel.target_path == "rotation") {
+                assert(channelAcc.type == TINYGLTF_TYPE_VEC4);
+                assert(!track->rotations.count);
+
+                const size_t first = model.trackVec4.size() / 4;
+                model.trackVec4.resize(model.trackVec4.size() + channelAcc.count * 4);
+                for (size_t i = 0, offset = 0; i < channelAcc.count; ++i) {
+                    offset += UnpackVec<4, true>(srcData + offset, &model.trackVec4[(first + i) * 4], channelAcc.componentType);
+                }
+                track->rotations = AppendRange(first, channelAcc.count);
+            } else if (channel.target_path == "translation" || channel.target_path == "scale") {
+                assert(channelAcc.type == TINYGLTF_TYPE_VEC3 && channelAcc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT);
+
+                ModelFile::Range& range = (channel.target_path == "translation") ? track->offsets : track->scales;
+                assert(!range.count);
+
+                const size_t first = model.trackVec3.size() / 3;
+                model.trackVec3.resize(model.trackVec3.size() + channelAcc.count * 3);
+                std::memcpy(&model.trackVec3[first * 3], srcData, channelAcc.count * 3 * sizeof(float));
+                range = AppendRange(first, channelAcc.count);
+            }
+        }
+    }
+
+    void CollectSkinning(const tinygltf::Model& src, ModelFile::Model& model) {
+        model.skins.resize(src.skins.size());
+
+        for (ModelFile::Skin& dstSkin : model.skins) {
+            const tinygltf::Skin& srcSkin = src.skins.front();
+
+            dstSkin.joints = AppendRange(model.joints.size(), srcSkin.joints.size());
+            model.joints.insert(model.joints.end(), srcSkin.joints.begin(), srcSkin.joints.end());
+
+            const tinygltf::Accessor& invBindMatsAcc = src.accessors[srcSkin.inverseBindMatrices];
+            assert(invBindMatsAcc.type == TINYGLTF_TYPE_MAT4 && invBindMatsAcc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT);
+
+            dstSkin.invBindMatrices = AppendRange(model.invBindMatrices.size() / 16, invBindMatsAcc.count);
+            const float* invBindMatsPtr = reinterpret_cast<const float*>(AccessorData(src, invBindMatsAcc));
+            model.invBindMatrices.insert(model.invBindMatrices.end(), invBindMatsPtr, invBindMatsPtr + invBindMatsAcc.count * 16);
+        }
+    }
+
+    // the binary file is the header followed by every table as a 32 bit element count and the elements
+    class Writer {
+    public:
+        explicit Writer(std::vector<uint8_t>& out) : mOut(out) {}
+
+        void Raw(const void* data, const size_t size) {
+            mOut.insert(mOut.end(), reinterpret_cast<const uint8_t*>(data), reinterpret_cast<const uint8_t*>(data) + size);
+        }
+
+        template <typename T>
+        void Table(const std::vector<T>& table) {
+            const uint32_t count = static_cast<uint32_t>(table.size());
+            this->Raw(&count, sizeof(count));
+            this->Raw(table.data(), table.size() * sizeof(T));
+        }
+
+    private:
+        std::vector<uint8_t>& mOut;
+    };
+
+    class Reader {
+    public:
+        Reader(const uint8_t* data, const size_t size) : mCur(data), mEnd(data + size) {}
+
+        bool Raw(void* data, const size_t size) {
+            if (static_cast<size_t>(mEnd - mCur) < size) {
+                return false;
+            }
+            if (!size) {
+                return true;
+            }
+            std::memcpy(data, mCur, size);
+            mCur += size;
+            return true;
+        }
+
+        template <typename T>
+        bool Table(std::vector<T>& table) {
+            uint32_t count = 0;
+            if (!this->Raw(&count, sizeof(count)) || count > static_cast<size_t>(mEnd - mCur) / sizeof(T)) {
+                return false;
+            }
+            table.resize(count);
+            return this->Raw(table.data(), count * sizeof(T));
+        }
+
+        bool AtEnd() const {
+            return mCur == mEnd;
+        }
+
+    private:
+        const uint8_t* mCur;
+        const uint8_t* mEnd;
+    };
+
+    template <typename ModelT, typename Visitor>
+    bool VisitTables(ModelT& model, Visitor&& visit) {
+        return visit(model.vertices) && visit(model.indices) && visit(model.skinVertices) &&
+               visit(model.sections) && visit(model.meshes) &&
+               visit(model.nodes) && visit(model.children) &&
+               visit(model.timeline) && visit(model.tracks) && visit(model.trackVec3) && visit(model.trackVec4) &&
+               visit(model.skins) && visit(model.joints) && visit(model.invBindMatrices) &&
+               visit(model.images) && visit(model.imageData);
+    }
+
+    bool InRange(const ModelFile::Range& range, const size_t size) {
+        return range.first <= size && range.count <= size - range.first;
+    }
+
+    bool InRange(const int32_t idx, const size_t size) {
+        return idx >= 0 && static_cast<size_t>(idx) < size;
+    }
+
+    // a damaged or hand edited file must not make the loader read out of bounds
+    bool Validate(const ModelFile::Model& model) {
+        const size_t numVertices = model.vertices.size() / ModelFile::GetVertexSize(model.layout);
+        if (model.vertices.size() % ModelFile::GetVertexSize(model.layout) || !InRange(model.rootChildren, model.children.size())) {
+            return false;
+        }
+
+        for (const ModelFile::Section& section : model.sections) {
+            if (!InRange({ section.vbOffset, section.numVertices }, numVertices) || !InRange({ section.ibOffset, section.numIndices }, model.indices.size()) ||
+                section.textureIdx >= model.images.size() ||
+                (section.skinningOffset != ~0u && !InRange({ section.skinningOffset, section.numVertices }, model.skinVertices.size()))) {
+                return false;
+            }
+            for (uint32_t i = 0; i < section.numIndices; ++i) {
+                if (model.indices[section.ibOffset + i] >= section.numVertices) {
+                    return false;
+                }
+            }
+        }
+        for (const ModelFile::Range& mesh : model.meshes) {
+            if (!InRange(mesh, model.sections.size())) {
+                return false;
+            }
+        }
+        for (const ModelFile::Node& node : model.nodes) {
+            if ((node.meshIdx >= 0 && !InRange(node.meshIdx, model.meshes.size())) ||
+                (node.animTrackIdx >= 0 && !InRange(node.animTrackIdx, model.tracks.size())) ||
+                (node.skinIdx >= 0 && !InRange(node.skinIdx, model.skins.size())) ||
+                !InRange(node.children, model.children.size())) {
+                return false;
+            }
+        }
+        for (const int32_t child : model.children) {
+            if (!InRange(child, model.nodes.size())) {
+                return false;
+            }
+        }
+        for (const ModelFile::AnimTrack& track : model.tracks) {
+            const size_t numKeys = model.timeline.size();
+            if (!InRange(track.target, model.nodes.size()) ||
+                !InRange(track.offsets, model.trackVec3.size() / 3) || (track.offsets.count && track.offsets.count != numKeys) ||
+                !InRange(track.rotations, model.trackVec4.size() / 4) || (track.rotations.count && track.rotations.count != numKeys) ||
+                !InRange(track.scales, model.trackVec3.size() / 3) || (track.scales.count && track.scales.count != numKeys)) {
+                return false;
+            }
+        }
+        for (const ModelFile::Skin& skin : model.skins) {
+            if (!InRange(skin.joints, model.joints.size()) || !InRange(skin.invBindMatrices, model.invBindMatrices.size() / 16) ||
+                skin.invBindMatrices.count > skin.joints.count) {
+                return false;
+            }
+            for (uint32_t i = 0; i < skin.joints.count; ++i) {
+                if (!InRange(model.joints[skin.joints.first + i], model.nodes.size())) {
+                    return false;
+                }
+            }
+        }
+        // skinning blends the joint transforms of the node's own skin by bone index, only weighted influences are
+        // ever read, and a mesh drawn by several nodes has to fit every skin it is drawn with
+        for (const ModelFile::Node& node : model.nodes) {
+            if (node.meshIdx < 0 || node.skinIdx < 0) {
+                continue;
+            }
+            const uint32_t numJoints = model.skins[node.skinIdx].invBindMatrices.count;
+            const ModelFile::Range& mesh = model.meshes[node.meshIdx];
+            for (uint32_t i = 0; i < mesh.count; ++i) {
+                const ModelFile::Section& section = model.sections[mesh.first + i];
+                if (section.skinningOffset == ~0u) {
+                    return false;
+                }
+                for (uint32_t j = 0; j < section.numVertices; ++j) {
+                    const ModelFile::VertexSkin& vs = model.skinVertices[section.skinningOffset + j];
+                    for (size_t k = 0; k < 4; ++k) {
+                        if (vs.weights[k] > 0.0f && vs.bones[k] >= numJoints) {
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
+        for (const ModelFile::Range& image : model.images) {
+            if (!InRange(image, model.imageData.size())) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+size_t ModelFile::GetVertexSize(const VertexLayout layout) {
+    return (layout == VertexLayout::PosNormalTexcoord) ? sizeof(VertexPNT) : sizeof(VertexPNCT);
+}
+
+bool ModelFile::ImportGLTF(const std::string& filePath, const VertexLayout layout, Model& model) {
+    std::error_code errorCode{};
+    if (!std::filesystem::exists(filePath, errorCode)) {
+        return false;
+    }
+
+    const bool isBinary = ExtensionEqual(filePath.c_str(), "glb");
+
+    tinygltf::Model src;
+    tinygltf::TinyGLTF loader;
+    std::string errors, warnings;
+
+    loader.SetImageLoader([](tinygltf::Image* image, const int /*image_idx*/, std::string* /*err*/,
+        std::string* /*warn*/, int /*req_width*/, int /*req_height*/,
+        const unsigned char* bytes, int size, void* /*user_data*/)->bool {
+            // just read image as is for now
+            image->width = image->height = image->component = -1;
+            image->bits = image->pixel_type = -1;
+            image->image.resize(static_cast<size_t>(size));
+            std::copy(bytes, bytes + size, image->image.begin());
+            return true;
+        }, nullptr);
+
+    bool loaded = false;
+    if (isBinary) {
+        loaded = loader.LoadBinaryFromFile(&src, &errors, &warnings, filePath);
+    } else {
+        loaded = loader.LoadASCIIFromFile(&src, &errors, &warnings, filePath);
+    }
+
+    if (!loaded || src.scenes.empty()) {
+        return false;
+    }
+
+    model = {};
+    model.layout = layout;
+
+    const size_t vertexSize = GetVertexSize(layout);
+
+    // now collect our meshes
+    for (const tinygltf::Mesh& srcMesh : src.meshes) {
+        model.meshes.push_back(AppendRange(model.sections.size(), srcMesh.primitives.size()));
+
+        for (const tinygltf::Primitive& prim : srcMesh.primitives) {
+            assert(prim.mode == TINYGLTF_MODE_TRIANGLES);
+
+            Section section;
+            section.skinningOffset = ~0u;
+
+            const int posIdx = map_contains(prim.attributes, std::string("POSITION")) ? prim.attributes.at("POSITION") : -1;
+            const int normIdx = map_contains(prim.attributes, std::string("NORMAL")) ? prim.attributes.at("NORMAL") : -1;
+            const int colorIdx = map_contains(prim.attributes, std::string("COLOR_0")) ? prim.attributes.at("COLOR_0") : -1;
+            const int uvIdx = map_contains(prim.attributes, std::string("TEXCOORD_0")) ? prim.attributes.at("TEXCOORD_0") : -1;
+
+            // skinning
+            const int bonesIdx = map_contains(prim.attributes, std::string("JOINTS_0")) ? prim.attributes.at("JOINTS_0") : -1;
+            const int weightsIdx = map_contains(prim.attributes, std::string("WEIGHTS_0")) ? prim.attributes.at("WEIGHTS_0") : -1;
+
+            if (posIdx < 0 || normIdx < 0 || uvIdx < 0 || prim.indices < 0) {
+                return false;
+            }
+
+            const tinygltf::Accessor& posAcc = src.accessors[posIdx];
+            const tinygltf::Accessor& normAcc = src.accessors[normIdx];
+            const tinygltf::Accessor* colorAcc = (colorIdx != -1) ? &src.accessors[colorIdx] : nullptr;
+            const tinygltf::Accessor& uvAcc = src.accessors[uvIdx];
+
+            const tinygltf::Accessor* bonesAcc = (bonesIdx != -1) ? &src.accessors[bonesIdx] : nullptr;
+            const tinygltf::Accessor* weightsAcc = (weightsIdx != -1) ? &src.accessors[weightsIdx] : nullptr;
+
+            assert(posAcc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT && posAcc.type == TINYGLTF_TYPE_VEC3);
+            assert(normAcc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT && normAcc.type == TINYGLTF_TYPE_VEC3);
+            if (colorAcc) {
+                assert((colorAcc->componentType == TINYGLTF_COMPONENT_TYPE_FLOAT || colorAcc->componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT || colorAcc->componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE) && colorAcc->type == TINYGLTF_TYPE_VEC4);
+            }
+            assert(uvAcc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT && uvAcc.type == TINYGLTF_TYPE_VEC2);
+
+            assert(posAcc.count == normAcc.count && posAcc.count == uvAcc.count);
+
+            if (bonesAcc && weightsAcc) {
+                assert((bonesAcc->componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE || bonesAcc->componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT) && bonesAcc->type == TINYGLTF_TYPE_VEC4);
+                assert(weightsAcc->type == TINYGLTF_TYPE_VEC4);
+
+                assert(posAcc.count == bonesAcc->count && posAcc.count == weightsAcc->count);
+            }
+
+            const tinygltf::BufferView* colorView = colorAcc ? &src.bufferViews[colorAcc->bufferView] : nullptr;
+            const tinygltf::Buffer* colorBuff = colorView ? &src.buffers[colorView->buffer] : nullptr;
+
+            const float* posData = reinterpret_cast<const float*>(AccessorData(src, posAcc));
+            const float* normData = reinterpret_cast<const float*>(AccessorData(src, normAcc));
+            const float* uvData = reinterpret_cast<const float*>(AccessorData(src, uvAcc));
+
+            const size_t vertsOffset = model.vertices.size() / vertexSize;
+            model.vertices.resize(model.vertices.size() + (posAcc.count * vertexSize));
+            for (size_t j = 0; j < posAcc.count; ++j) {
+                const float* posPtr = posData + (j * 3);
+                const float* normPtr = normData + (j * 3);
+                const float* uvPtr = uvData + (j * 2);
+
+                if (layout == VertexLayout::PosNormalTexcoord) {
+                    VertexPNT& v = reinterpret_cast<VertexPNT*>(model.vertices.data())[vertsOffset + j];
+                    std::memcpy(v.pos, posPtr, sizeof(v.pos));
+                    std::memcpy(v.normal, normPtr, sizeof(v.normal));
+                    std::memcpy(v.uv, uvPtr, sizeof(v.uv));
+                } else {
+                    VertexPNCT& v = reinterpret_cast<VertexPNCT*>(model.vertices.data())[vertsOffset + j];
+                    std::memcpy(v.pos, posPtr, sizeof(v.pos));
+                    std::memcpy(v.normal, normPtr, sizeof(v.normal));
+                    if (colorAcc) {
+                        DecodeGLTFVertexColor(v, colorAcc, colorView, colorBuff, j);
+                    } else {
+                        v.color = ~0u;
+                    }
+                    std::memcpy(v.uv, uvPtr, sizeof(v.uv));
+                }
+            }
+
+            if (bonesAcc && weightsAcc) {
+                const size_t skinVertsOffset = model.skinVertices.size();
+                model.skinVertices.resize(model.skinVertices.size() + posAcc.count);
+                const bool bonesAreU8 = bonesAcc->componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE;
+                const uint8_t* bonesPtr = AccessorData(src, *bonesAcc);
+                const uint8_t* weightsPtr = AccessorData(src, *weightsAcc);
+                for (size_t j = 0, weightsOff = 0; j < posAcc.count; ++j) {
+                    const uint16_t* bonesPtrU16 = reinterpret_cast<const uint16_t*>(bonesPtr) + (j * 4);
+                    const uint8_t* bonesPtrU8 = bonesPtr + (j * 4);
+
+                    VertexSkin& vs = model.skinVertices[skinVertsOffset + j];
+                    for (size_t k = 0; k < 4; ++k) {
+                        vs.bones[k] = bonesAreU8 ? bonesPtrU8[k] : static_cast<uint8_t>(bonesPtrU16[k]);
+                    }
+                    weightsOff += UnpackVec<4, true>(weightsPtr + weightsOff, vs.weights, weightsAcc->componentType);
+                }
+
+                section.skinningOffset = static_cast<uint32_t>(skinVertsOffset);
+            }
+
+            const tinygltf::Accessor& idxAcc = src.accessors[prim.indices];
+            assert((idxAcc.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT || idxAcc.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT) && idxAcc.type == TINYGLTF_TYPE_SCALAR);
+
+            const size_t indicesOffset = model.indices.size();
+            model.indices.resize(model.indices.size() + idxAcc.count);
+            if (idxAcc.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT) {
+                std::memcpy(model.indices.data() + indicesOffset, AccessorData(src, idxAcc), idxAcc.count * sizeof(uint16_t));
+            } else {
+                const uint32_t* srcIndices = reinterpret_cast<const uint32_t*>(AccessorData(src, idxAcc));
+                for (size_t j = 0; j < idxAcc.count; ++j) {
+                    model.indices[indicesOffset + j] = static_cast<uint16_t>(srcIndices[j]);
+                }
+            }
+
+            section.numVertices = static_cast<uint32_t>(posAcc.count);
+            section.numIndices = static_cast<uint32_t>(idxAcc.count);
+            section.vbOffset = static_cast<uint32_t>(vertsOffset);
+            section.ibOffset = static_cast<uint32_t>(indicesOffset);
+            const int albedoIdx = src.materials[prim.material].pbrMetallicRoughness.baseColorTexture.index;
+            section.textureIdx = static_cast<uint32_t>(src.textures[albedoIdx].source);
+            model.sections.push_back(section);
+        }
+    }
+
+    for (const tinygltf::Image& img : src.images) {
+        model.images.push_back(AppendRange(model.imageData.size(), img.image.size()));
+        model.imageData.insert(model.imageData.end(), img.image.begin(), img.image.end());
+    }
+
+    model.nodes.resize(src.nodes.size());
+    for (size_t i = 0, end = src.nodes.size(); i < end; ++i) {
+        const tinygltf::Node& srcNode = src.nodes[i];
+        Node& dstNode = model.nodes[i];
+
+        dstNode.meshIdx = srcNode.mesh;
+        dstNode.animTrackIdx = -1;
+        dstNode.skinIdx = srcNode.skin;
+        ReadGLTFTransformation(srcNode, dstNode);
+        dstNode.children = AppendRange(model.children.size(), srcNode.children.size());
+        model.children.insert(model.children.end(), srcNode.children.begin(), srcNode.children.end());
+    }
+
+    const tinygltf::Scene& scene = src.scenes.front();
+    model.rootChildren = AppendRange(model.children.size(), scene.nodes.size());
+    model.children.insert(model.children.end(), scene.nodes.begin(), scene.nodes.end());
+
+    if (!src.animations.empty()) {
+        CollectAnimation(src, model);
+    }
+
+    if (!src.skins.empty()) {
+        CollectSkinning(src, model);
+    }
+
+    return Validate(model);
+}
+
+bool ModelFile::GetSource(const std::filesystem::path& filePath, Source& source) {
+    std::error_code errorCode{};
+    const uintmax_t fileSize = std::filesystem::file_size(filePath, errorCode);
+    if (errorCode) {
+        return false;
+    }
+    const std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(filePath, errorCode);
+    if (errorCode) {
+        return false;
+    }
+
+    source.size = fileSize;
+    source.writeTime = static_cast<uint64_t>(writeTime.time_since_epoch().count());
+    return true;
+}
+
+bool ModelFile::Write(const Model& model, const Source& source, std::vector<uint8_t>& out) {
+    out.clear();
+
+    Writer writer(out);
+    const FileHeader header{ kFileMagic, kFileVersion, source.size, source.writeTime, static_cast<uint32_t>(model.layout), 0 };
+    writer.Raw(&header, sizeof(header));
+    writer.Raw(&model.rootChildren, sizeof(model.rootChildren));
+
+    return VisitTables(model, [&writer](const auto& table) {
+        writer.Table(table);
+        return true;
+    });
+}
+
+bool ModelFile::Read(const uint8_t* data, const size_t size, const VertexLayout layout, const Source& source, Model& model) {
+    Reader reader(data, size);
+
+    FileHeader header{};
+    if (!reader.Raw(&header, sizeof(header)) || header.magic != kFileMagic || header.version != kFileVersion ||
+        header.layout != static_cast<uint32_t>(layout) || header.sourceSize != source.size || header.sourceWriteTime != source.writeTime) {
+        return false;
+    }
+
+    model = {};
+    model.layout = layout;
+
+    const bool read = reader.Raw(&model.rootChildren, sizeof(model.rootChildren)) && VisitTables(model, [&reader](auto& table) {
+        return reader.Table(table);
+    });
+
+    return read && reader.AtEnd() && Validate(model);
+}
+
+bool ModelFile::Save(const std::filesystem::path& filePath, const Model& model, const Source& source) {
+    std::vector<uint8_t> data;
+    if (!Write(model, source, data)) {
+        return false;
+    }
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    return file && file.write(reinterpret_cast<const char*>(data.data()), data.size());
+}
+
+bool ModelFile::Load(const std::filesystem::path& filePath, const VertexLayout layout, const Source& source, Model& model) {
+    std::error_code errorCode{};
+    const uintmax_t fileSize = std::filesystem::file_size(filePath, errorCode);
+    if (errorCode || fileSize < sizeof(FileHeader)) {
+        return false;
+    }
+
+    std::ifstream file(filePath, std::ios::binary);
+    std::vector<uint8_t> data(static_cast<size_t>(fileSize));
+    if (!file || !file.read(reinterpret_cast<char*>(data.data()), data.size())) {
+        return false;
+    }
+
+    return Read(data.data(), data.size(), layout, source, model);
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// CPU side data of a ModelGLTF: imported from glTF through tinygltf, or from the preprocessed binary format that
+// Resources/Models/ModelConvert writes. Everything is stored as flat tables, so the binary file is those tables one
+// after another and loads with a single read and a copy per table, no JSON, base64 or accessor unpacking
+namespace ModelFile {
+    constexpr const wchar_t* kExtension = L".sh2m";
+
+    enum class VertexLayout : uint32_t {
+        PosNormalTexcoord = 0,
+        PosNormalColorTexcoord = 1
+    };
+
+    // same layouts as ModelGLTF::Vertex_PNT, Vertex_PNCT and Vertex_Skin
+    struct VertexPNT {
+        float    pos[3];
+        float    normal[3];
+        float    uv[2];
+    };
+    static_assert(sizeof(VertexPNT) == 32);
+
+    struct VertexPNCT {
+        float    pos[3];
+        float    normal[3];
+        uint32_t color;
+        float    uv[2];
+    };
+    static_assert(sizeof(VertexPNCT) == 36);
+
+    struct VertexSkin {
+        uint8_t  bones[4];
+        float    weights[4];
+    };
+    static_assert(sizeof(VertexSkin) == 20);
+
+    struct Section {
+        uint32_t numVertices;
+        uint32_t numIndices;
+        uint32_t vbOffset;
+        uint32_t ibOffset;
+        uint32_t textureIdx;
+        uint32_t skinningOffset;    // ~0u when not skinned
+    };
+
+    struct Range {
+        uint32_t first;
+        uint32_t count;
+    };
+
+    struct Node {
+        int32_t  meshIdx;
+        int32_t  animTrackIdx;
+        int32_t  skinIdx;
+        float    position[3];
+        float    rotation[4];
+        float    scale[3];
+        Range    children;          // into Model::children
+    };
+
+    struct AnimTrack {
+        int32_t  target;            // index into Model::nodes
+        Range    offsets;           // into Model::trackVec3
+        Range    rotations;         // into Model::trackVec4
+        Range    scales;            // into Model::trackVec3
+    };
+
+    struct Skin {
+        Range    joints;            // into Model::joints
+        Range    invBindMatrices;   // into Model::invBindMatrices
+    };
+
+    struct Model {
+        VertexLayout            layout = VertexLayout::PosNormalTexcoord;
+
+        std::vector<uint8_t>    vertices;           // interleaved in the layout above
+        std::vector<uint16_t>   indices;
+        std::vector<VertexSkin> skinVertices;
+
+        std::vector<Section>    sections;
+        std::vector<Range>      meshes;             // into sections
+
+        std::vector<Node>       nodes;
+        std::vector<int32_t>    children;
+        Range                   rootChildren = {};  // into children
+
+        std::vector<float>      timeline;           // key times shared by every track
+        std::vector<AnimTrack>  tracks;
+        std::vector<float>      trackVec3;          // 3 floats per key
+        std::vector<float>      trackVec4;          // 4 floats per key
+
+        std::vector<Skin>       skins;
+        std::vector<int32_t>    joints;
+        std::vector<float>      invBindMatrices;    // 16 floats each, same order as D3DXMATRIX
+
+        std::vector<Range>      images;             // into imageData
+        std::vector<uint8_t>    imageData;          // encoded image files as stored in the glTF
+    };
+
+    size_t      GetVertexSize(const VertexLayout layout);
+
+    // parses a .gltf or .glb file
+    bool        ImportGLTF(const std::string& filePath, const VertexLayout layout, Model& model);
+
+    // identifies the glTF file a model was converted from, so a converted file that no longer matches it is ignored.
+    // Only the file system entry is read, so checking it on every load costs nothing next to the model itself
+    struct Source {
+        uint64_t size = 0;
+        uint64_t writeTime = 0;     // last write time in file clock ticks
+    };
+
+    bool        GetSource(const std::filesystem::path& filePath, Source& source);
+
+    // Read rejects files converted from another source or with a different vertex layout, so the caller can fall back
+    // to the glTF
+    bool        Write(const Model& model, const Source& source, std::vector<uint8_t>& out);
+    bool        Read(const uint8_t* data, const size_t size, const VertexLayout layout, const Source& source, Model& model);
+
+    bool        Save(const std::filesystem::path& filePath, const Model& model, const Source& source);
+    bool        Load(const std::filesystem::path& filePath, const VertexLayout layout, const Source& source, Model& model);
+}
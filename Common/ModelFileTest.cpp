@@ -0,0 +1,164 @@
+// checks the .sh2m format on a model built in code: write and read give back the same tables, files of another source
+// or layout are rejected, skinned meshes only index joints of their own skin, and truncated or damaged files are
+// either rejected or still valid, never read out of bounds. nothing here touches D3D, so it builds and runs on Linux.
+//
+// usage: run from the repository root
+//   g++ -std=c++17 -O2 -I. -IInclude -o ModelFileTest Common/ModelFileTest.cpp Common/ModelFile.cpp
+//   ./ModelFileTest
+
+#include "Common/ModelFile.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+
+#define CHECK(condition) \
+    do { if (!(condition)) { std::printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); return 1; } } while (0)
+
+namespace fs = std::filesystem;
+
+template <typename T>
+static bool Same(const std::vector<T>& a, const std::vector<T>& b) {
+    return a.size() == b.size() && (a.empty() || !std::memcmp(a.data(), b.data(), a.size() * sizeof(T)));
+}
+
+static bool Equal(const ModelFile::Model& a, const ModelFile::Model& b) {
+    return a.layout == b.layout && Same(a.vertices, b.vertices) && Same(a.indices, b.indices) && Same(a.skinVertices, b.skinVertices) &&
+           Same(a.sections, b.sections) && Same(a.meshes, b.meshes) && Same(a.nodes, b.nodes) && Same(a.children, b.children) &&
+           !std::memcmp(&a.rootChildren, &b.rootChildren, sizeof(a.rootChildren)) && Same(a.timeline, b.timeline) && Same(a.tracks, b.tracks) &&
+           Same(a.trackVec3, b.trackVec3) && Same(a.trackVec4, b.trackVec4) && Same(a.skins, b.skins) && Same(a.joints, b.joints) &&
+           Same(a.invBindMatrices, b.invBindMatrices) && Same(a.images, b.images) && Same(a.imageData, b.imageData);
+}
+
+// two meshes: a skinned quad drawn by the node of a two joint skin, and an unskinned triangle. a second skin has four
+// joints, so a bone index that is only valid for the larger skin shows whether skins are checked one by one
+static ModelFile::Model MakeModel(const ModelFile::VertexLayout layout) {
+    ModelFile::Model model;
+    model.layout = layout;
+
+    const size_t vertexSize = ModelFile::GetVertexSize(layout);
+    model.vertices.resize(7 * vertexSize);
+    for (size_t i = 0; i < model.vertices.size(); ++i) {
+        model.vertices[i] = static_cast<uint8_t>(i * 7);
+    }
+    model.indices = { 0, 1, 2, 2, 1, 3, 0, 1, 2 };
+
+    model.skinVertices.resize(4);
+    for (uint8_t i = 0; i < 4; ++i) {
+        model.skinVertices[i] = { { 0, 1, 0, 0 }, { 0.75f, 0.25f, 0.0f, 0.0f } };
+    }
+
+    model.sections = { { 4, 6, 0, 0, 0, 0 }, { 3, 3, 4, 6, 1, ~0u } };
+    model.meshes = { { 0, 1 }, { 1, 1 } };
+
+    // root, skinned mesh, plain mesh, two joints
+    model.nodes.resize(5);
+    for (ModelFile::Node& node : model.nodes) {
+        node = { -1, -1, -1, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 1.0f }, { 1.0f, 1.0f, 1.0f }, { 0, 0 } };
+    }
+    model.children = { 1, 2, 3, 4, 0 };
+    model.nodes[0].children = { 0, 4 };
+    model.nodes[1].meshIdx = 0;
+    model.nodes[1].skinIdx = 0;
+    model.nodes[2].meshIdx = 1;
+    model.nodes[3].animTrackIdx = 0;
+    model.rootChildren = { 4, 1 };
+
+    model.timeline = { 0.0f, 0.5f, 1.0f };
+    model.tracks = { { 3, { 0, 3 }, { 0, 3 }, { 0, 0 } } };
+    model.trackVec3 = { 0, 0, 0, 0, 1, 0, 0, 2, 0 };
+    model.trackVec4 = { 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+    model.joints = { 3, 4, 3, 4, 0, 1 };
+    model.skins = { { { 0, 2 }, { 0, 2 } }, { { 2, 4 }, { 2, 4 } } };
+    for (int i = 0; i < 6; ++i) {
+        const float identity[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+        model.invBindMatrices.insert(model.invBindMatrices.end(), identity, identity + 16);
+    }
+
+    model.imageData = { 'P', 'N', 'G', 0, 1, 2, 3, 'D', 'D', 'S' };
+    model.images = { { 0, 7 }, { 7, 3 } };
+    return model;
+}
+
+int main() {
+    const fs::path directory = fs::temp_directory_path() / "ModelFileTest";
+    fs::remove_all(directory);
+    fs::create_directories(directory);
+
+    // the source is the size and write time of the glTF, both change when it is edited
+    const fs::path gltfPath = directory / "model.glb";
+    std::ofstream(gltfPath, std::ios::binary) << "glTF version one";
+    ModelFile::Source source, edited, resized;
+    CHECK(ModelFile::GetSource(gltfPath, source));
+    CHECK(source.size == 16);
+    fs::last_write_time(gltfPath, fs::last_write_time(gltfPath) + std::chrono::seconds(10));
+    CHECK(ModelFile::GetSource(gltfPath, edited));
+    CHECK(edited.size == source.size && edited.writeTime != source.writeTime);
+    std::ofstream(gltfPath, std::ios::binary | std::ios::app) << "!";
+    CHECK(ModelFile::GetSource(gltfPath, resized));
+    CHECK(resized.size == source.size + 1);
+    CHECK(!ModelFile::GetSource(directory / "missing.glb", resized));
+
+    for (const ModelFile::VertexLayout layout : { ModelFile::VertexLayout::PosNormalTexcoord, ModelFile::VertexLayout::PosNormalColorTexcoord }) {
+        const ModelFile::VertexLayout otherLayout = (layout == ModelFile::VertexLayout::PosNormalTexcoord) ? ModelFile::VertexLayout::PosNormalColorTexcoord : ModelFile::VertexLayout::PosNormalTexcoord;
+        const ModelFile::Model model = MakeModel(layout);
+        ModelFile::Model loaded;
+
+        // round trip in memory and through a file
+        std::vector<uint8_t> data;
+        CHECK(ModelFile::Write(model, source, data));
+        CHECK(ModelFile::Read(data.data(), data.size(), layout, source, loaded));
+        CHECK(Equal(model, loaded));
+
+        const fs::path binaryPath = directory / "model.sh2m";
+        CHECK(ModelFile::Save(binaryPath, model, source));
+        loaded = {};
+        CHECK(ModelFile::Load(binaryPath, layout, source, loaded));
+        CHECK(Equal(model, loaded));
+
+        // a file converted from another version of the glTF, or for the other layout, is left to the glTF path
+        CHECK(!ModelFile::Read(data.data(), data.size(), layout, edited, loaded));
+        CHECK(!ModelFile::Read(data.data(), data.size(), layout, resized, loaded));
+        CHECK(!ModelFile::Read(data.data(), data.size(), otherLayout, source, loaded));
+        CHECK(!ModelFile::Load(directory / "missing.sh2m", layout, source, loaded));
+
+        // bone 1 is fine for the two joint skin, bone 2 only exists in the four joint skin the mesh is not drawn with
+        ModelFile::Model skinned = MakeModel(layout);
+        CHECK(ModelFile::Write(skinned, source, data) && ModelFile::Read(data.data(), data.size(), layout, source, loaded));
+        skinned.skinVertices[3].bones[1] = 2;
+        CHECK(ModelFile::Write(skinned, source, data) && !ModelFile::Read(data.data(), data.size(), layout, source, loaded));
+        skinned.skinVertices[3].weights[1] = 0.0f;
+        CHECK(ModelFile::Write(skinned, source, data) && ModelFile::Read(data.data(), data.size(), layout, source, loaded));
+        skinned.nodes[1].skinIdx = 1;
+        skinned.skinVertices[3].weights[1] = 0.25f;
+        CHECK(ModelFile::Write(skinned, source, data) && ModelFile::Read(data.data(), data.size(), layout, source, loaded));
+
+        // a skinned node whose mesh has no skinning data would read influences that are not there
+        ModelFile::Model unskinned = MakeModel(layout);
+        unskinned.nodes[2].skinIdx = 0;
+        CHECK(ModelFile::Write(unskinned, source, data) && !ModelFile::Read(data.data(), data.size(), layout, source, loaded));
+
+        // truncated files are rejected, damaged ones are either rejected or pass every range check
+        CHECK(ModelFile::Write(model, source, data));
+        for (size_t size = 0; size < data.size(); ++size) {
+            CHECK(!ModelFile::Read(data.data(), size, layout, source, loaded));
+        }
+        std::mt19937 random(1);
+        size_t accepted = 0;
+        for (int i = 0; i < 20000; ++i) {
+            std::vector<uint8_t> damaged = data;
+            for (int k = 0; k < 4; ++k) {
+                damaged[random() % damaged.size()] ^= static_cast<uint8_t>(1u << (random() % 8));
+            }
+            accepted += ModelFile::Read(damaged.data(), damaged.size(), layout, source, loaded) ? 1 : 0;
+        }
+        std::printf("layout %u: %zu bytes, %zu of 20000 damaged copies still valid\n", static_cast<unsigned>(layout), data.size(), accepted);
+    }
+
+    fs::remove_all(directory);
+    std::printf("all ModelFile checks passed\n");
+    return 0;
+}
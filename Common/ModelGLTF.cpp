@@ -1,155 +1,11 @@
 #include "ModelGLTF.h"
 
-#define TINYGLTF_IMPLEMENTATION
-#define TINYGLTF_NOEXCEPTION
-#define TINYGLTF_NO_STB_IMAGE
-#define TINYGLTF_NO_STB_IMAGE_WRITE
-#define TINYGLTF_NO_INCLUDE_STB_IMAGE
-#define TINYGLTF_NO_INCLUDE_STB_IMAGE_WRITE
-#define TINYGLTF_USE_CPP14
-#include <tinygltf/tiny_gltf.h>
-
+#include "ModelFile.h"
 #include "GfxUtils.h"
+#include <algorithm>
+#include <cstring>
 #include <filesystem>
 
-static bool ExtensionEqual(const char* filePath, const char* extToCompare) {
-    const size_t len = strnlen_s(filePath, 1024);
-    return tolower(filePath[len - 3]) == tolower(extToCompare[0]) &&
-           tolower(filePath[len - 2]) == tolower(extToCompare[1]) &&
-           tolower(filePath[len - 1]) == tolower(extToCompare[2]);
-}
-
-template <typename K, typename T>
-static bool map_contains(const std::map<K, T>& m, const K& key) {
-    return m.find(key) != m.end();
-}
-
-static uint32_t EncodeVertexColor(const float r, const float g, const float b, const float a) {
-    const uint8_t rb = static_cast<uint8_t>(std::clamp(r * 255.0f, 0.0f, 255.0f));
-    const uint8_t gb = static_cast<uint8_t>(std::clamp(g * 255.0f, 0.0f, 255.0f));
-    const uint8_t bb = static_cast<uint8_t>(std::clamp(b * 255.0f, 0.0f, 255.0f));
-    const uint8_t ab = static_cast<uint8_t>(std::clamp(a * 255.0f, 0.0f, 255.0f));
-
-    return D3DCOLOR_ARGB(ab, rb, gb, bb);
-}
-
-static void DecodeGLTFVertexColor(ModelGLTF::Vertex_PNCT& v, const tinygltf::Accessor* colorAcc, const tinygltf::BufferView* colorView, const tinygltf::Buffer* colorBuff, const size_t idx) {
-    const uint8_t* colorPtrRaw = colorBuff->data.data() + colorAcc->byteOffset + colorView->byteOffset;
-
-    switch (colorAcc->componentType) {
-        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE: {
-            const uint8_t* colorPtr = colorPtrRaw + (idx * 4);
-            v.color = EncodeVertexColor(colorPtr[0] / 255.0f, colorPtr[1] / 255.0f, colorPtr[2] / 255.0f, colorPtr[3] / 255.0f);
-        } break;
-        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: {
-            const uint16_t* colorPtr = reinterpret_cast<const uint16_t*>(colorPtrRaw) + (idx * 4);
-            v.color = EncodeVertexColor(colorPtr[0] / 65535.0f, colorPtr[1] / 65535.0f, colorPtr[2] / 65535.0f, colorPtr[3] / 65535.0f);
-        } break;
-        case TINYGLTF_COMPONENT_TYPE_FLOAT: {
-            const float* colorPtr = reinterpret_cast<const float*>(colorPtrRaw) + (idx * 4);
-            v.color = EncodeVertexColor(colorPtr[0], colorPtr[1], colorPtr[2], colorPtr[3]);
-        } break;
-    }
-}
-
-//TINYGLTF_COMPONENT_TYPE_FLOAT
-template <bool normalized>
-static size_t UnpackComponent(const void* srcData, float& dstData, const int componentType) {
-    switch (componentType) {
-        case TINYGLTF_COMPONENT_TYPE_BYTE: {
-            if constexpr (normalized) {
-                dstData = fmaxf(*reinterpret_cast<const int8_t*>(srcData) / 127.0f, -1.0f);
-            } else {
-                dstData = *reinterpret_cast<const int8_t*>(srcData);
-            }
-            return 1;
-        } break;
-        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE: {
-            if constexpr (normalized) {
-                dstData = *reinterpret_cast<const uint8_t*>(srcData) / 255.0f;
-            } else {
-                dstData = *reinterpret_cast<const uint8_t*>(srcData);
-            }
-            return 1;
-        } break;
-        case TINYGLTF_COMPONENT_TYPE_SHORT: {
-            if constexpr (normalized) {
-                dstData = fmaxf(*reinterpret_cast<const int16_t*>(srcData) / 32767.0f, -1.0f);
-            } else {
-                dstData = *reinterpret_cast<const int16_t*>(srcData);
-            }
-            return 2;
-        } break;
-        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: {
-            if constexpr (normalized) {
-                dstData = *reinterpret_cast<const uint16_t*>(srcData) / 65535.0f;
-            } else {
-                dstData = *reinterpret_cast<const uint16_t*>(srcData);
-            }
-            return 2;
-        } break;
-
-        default: {
-            dstData = *reinterpret_cast<const float*>(srcData);
-            return 4;
-        }
-    }
-}
-
-template <size_t vecSize, bool normalized>
-static size_t UnpackVec(const void* srcData, float* dstData, const int componentType) {
-    size_t offset = UnpackComponent<normalized>(srcData, dstData[0], componentType);
-    offset += UnpackComponent<normalized>(reinterpret_cast<const uint8_t*>(srcData) + offset, dstData[1], componentType);
-    if constexpr (vecSize > 2) {
-        offset += UnpackComponent<normalized>(reinterpret_cast<const uint8_t*>(srcData) + offset, dstData[2], componentType);
-        if constexpr (vecSize > 3) {
-            offset += UnpackComponent<normalized>(reinterpret_cast<const uint8_t*>(srcData) + offset, dstData[3], componentType);
-        }
-    }
-
-    return offset;
-}
-
-
-static void ReadGLTFTransformation(const tinygltf::Node& srcNode, ModelGLTF::SceneNode& dstNode) {
-    if (srcNode.matrix.size() == 16) {
-        D3DXMATRIX result = {};
-        for (size_t y = 0; y < 4; ++y) {
-            for (size_t x = 0; x < 4; ++x) {
-                // transpose on read (from OpenGL -> Direct3D)
-                reinterpret_cast<float*>(&result)[x + y * 4] = static_cast<float>(srcNode.matrix[y + x * 4]);
-            }
-        }
-        assert(false && "Implement matrix decompose !!!");
-        //D3DXMatrixDecompose()
-    } else {
-        if (srcNode.translation.size() == 3) {
-            dstNode.position.x = static_cast<float>(srcNode.translation[0]);
-            dstNode.position.y = static_cast<float>(srcNode.translation[1]);
-            dstNode.position.z = static_cast<float>(srcNode.translation[2]);
-        } else {
-            dstNode.position = { 0.0f, 0.0f, 0.0f };
-        }
-
-        if (srcNode.rotation.size() == 4) {
-            dstNode.rotation.x = static_cast<float>(srcNode.rotation[0]);
-            dstNode.rotation.y = static_cast<float>(srcNode.rotation[1]);
-            dstNode.rotation.z = static_cast<float>(srcNode.rotation[2]);
-            dstNode.rotation.w = static_cast<float>(srcNode.rotation[3]);
-        } else {
-            D3DXQuaternionIdentity(&dstNode.rotation);
-        }
-
-        if (srcNode.scale.size() == 3) {
-            dstNode.scale.x = static_cast<float>(srcNode.scale[0]);
-            dstNode.scale.y = static_cast<float>(srcNode.scale[1]);
-            dstNode.scale.z = static_cast<float>(srcNode.scale[2]);
-        } else {
-            dstNode.scale = { 1.0f, 1.0f, 1.0f };
-        }
-    }
-}
-
 static void MakeNodeXForm(const D3DXVECTOR3& position, const D3DXQUATERNION& rotation, const D3DXVECTOR3& scale, D3DXMATRIX& xform) {
     D3DXMATRIX S, R, T;
     D3DXMatrixScaling(&S, scale.x, scale.y, scale.z);
@@ -164,6 +20,7 @@ ModelGLTF::ModelGLTF(const VertexType vtype, const bool uploadToGPU)
     : mVertexType(vtype)
     , mUploadToGPU(uploadToGPU)
     , mAnimTime(0.0f)
+    , mPoseSampleRate(0.0f)
 {
 }
 ModelGLTF::~ModelGLTF() {
@@ -175,171 +32,38 @@ bool ModelGLTF::LoadFromFile(const std::string& filePath, IDirect3DDevice8* devi
         return false;
     }
 
-    const bool isBinary = ExtensionEqual(filePath.c_str(), "glb");
-
-    tinygltf::Model model;
-    tinygltf::TinyGLTF loader;
-    std::string errors, warnings;
-
-    loader.SetImageLoader([](tinygltf::Image* image, const int /*image_idx*/, std::string* /*err*/,
-        std::string* /*warn*/, int /*req_width*/, int /*req_height*/,
-        const unsigned char* bytes, int size, void* /*user_data*/)->bool {
-            // just read image as is for now
-            image->width = image->height = image->component = -1;
-            image->bits = image->pixel_type = -1;
-            image->image.resize(static_cast<size_t>(size));
-            std::copy(bytes, bytes + size, image->image.begin());
-            return true;
-        }, nullptr);
-
-    bool loaded = false;
-    if (isBinary) {
-        loaded = loader.LoadBinaryFromFile(&model, &errors, &warnings, filePath);
-    } else {
-        loaded = loader.LoadASCIIFromFile(&model, &errors, &warnings, filePath);
-    }
+    const ModelFile::VertexLayout layout = (mVertexType == VertexType::PosNormalTexcoord) ? ModelFile::VertexLayout::PosNormalTexcoord : ModelFile::VertexLayout::PosNormalColorTexcoord;
 
-    if (!loaded) {
+    // a model converted by ModelConvert next to the glTF loads with a single read, fall back to parsing the glTF when
+    // there is none or it was converted from a different version of the file
+    std::filesystem::path binaryPath = std::filesystem::u8path(filePath);
+    binaryPath.replace_extension(ModelFile::kExtension);
+    ModelFile::Source source;
+
+    ModelFile::Model model;
+    if (!(ModelFile::GetSource(std::filesystem::u8path(filePath), source) && ModelFile::Load(binaryPath, layout, source, model)) &&
+        !ModelFile::ImportGLTF(filePath, layout, model)) {
         return false;
     }
 
-    // now collect our meshes
-    mMeshes.resize(model.meshes.size());
+    static_assert(sizeof(Vertex_PNT) == sizeof(ModelFile::VertexPNT) && sizeof(Vertex_PNCT) == sizeof(ModelFile::VertexPNCT));
+    static_assert(sizeof(Vertex_Skin) == sizeof(ModelFile::VertexSkin));
 
-    mVertices.clear();
-    mIndices.clear();
+    mVertices = std::move(model.vertices);
+    mIndices = std::move(model.indices);
 
-    const size_t vertexSize = (mVertexType == VertexType::PosNormalTexcoord) ? sizeof(Vertex_PNT) : sizeof(Vertex_PNCT);
-
-    for (size_t meshIdx = 0, numMeshes = model.meshes.size(); meshIdx < numMeshes; ++meshIdx) {
-        const tinygltf::Mesh& srcMesh = model.meshes[meshIdx];
-        Mesh& dstMesh = mMeshes[meshIdx];
-        dstMesh.sections.resize(srcMesh.primitives.size());
-
-        for (size_t i = 0, n = srcMesh.primitives.size(); i < n; ++i) {
-            const tinygltf::Primitive& prim = srcMesh.primitives[i];
-            assert(prim.mode == TINYGLTF_MODE_TRIANGLES);
-
-            Section& section = dstMesh.sections[i];
-            section.skinningOffset = ~0u;
-
-            const int posIdx = map_contains(prim.attributes, std::string("POSITION")) ? prim.attributes.at("POSITION") : -1;
-            const int normIdx = map_contains(prim.attributes, std::string("NORMAL")) ? prim.attributes.at("NORMAL") : -1;
-            const int colorIdx = map_contains(prim.attributes, std::string("COLOR_0")) ? prim.attributes.at("COLOR_0") : -1;
-            const int uvIdx = map_contains(prim.attributes, std::string("TEXCOORD_0")) ? prim.attributes.at("TEXCOORD_0") : -1;
+    mSkinVertices.resize(model.skinVertices.size());
+    std::memcpy(mSkinVertices.data(), model.skinVertices.data(), model.skinVertices.size() * sizeof(Vertex_Skin));
 
-            // skinning
-            const int bonesIdx = map_contains(prim.attributes, std::string("JOINTS_0")) ? prim.attributes.at("JOINTS_0") : -1;
-            const int weightsIdx = map_contains(prim.attributes, std::string("WEIGHTS_0")) ? prim.attributes.at("WEIGHTS_0") : -1;
-
-            const tinygltf::Accessor& posAcc = model.accessors[posIdx];
-            const tinygltf::Accessor& normAcc = model.accessors[normIdx];
-            const tinygltf::Accessor* colorAcc = (colorIdx != -1) ? &model.accessors[colorIdx] : nullptr;
-            const tinygltf::Accessor& uvAcc = model.accessors[uvIdx];
-
-            const tinygltf::Accessor* bonesAcc = (bonesIdx != -1) ? &model.accessors[bonesIdx] : nullptr;
-            const tinygltf::Accessor* weightsAcc = (weightsIdx != -1) ? &model.accessors[weightsIdx] : nullptr;
-
-            assert(posAcc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT && posAcc.type == TINYGLTF_TYPE_VEC3);
-            assert(normAcc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT && normAcc.type == TINYGLTF_TYPE_VEC3);
-            if (colorAcc) {
-                assert((colorAcc->componentType == TINYGLTF_COMPONENT_TYPE_FLOAT || colorAcc->componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT || colorAcc->componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE) && colorAcc->type == TINYGLTF_TYPE_VEC4);
-            }
-            assert(uvAcc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT && uvAcc.type == TINYGLTF_TYPE_VEC2);
-
-            assert(posAcc.count == normAcc.count && posAcc.count == uvAcc.count);
-
-            if (bonesAcc && weightsAcc) {
-                assert((bonesAcc->componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE || bonesAcc->componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT) && bonesAcc->type == TINYGLTF_TYPE_VEC4);
-                assert(weightsAcc->type == TINYGLTF_TYPE_VEC4);
-
-                assert(posAcc.count == bonesAcc->count && posAcc.count == weightsAcc->count);
-            }
-
-            const tinygltf::BufferView& posView = model.bufferViews[posAcc.bufferView];
-            const tinygltf::BufferView& normView = model.bufferViews[normAcc.bufferView];
-            const tinygltf::BufferView* colorView = colorAcc ? &model.bufferViews[colorAcc->bufferView] : nullptr;
-            const tinygltf::BufferView& uvView = model.bufferViews[uvAcc.bufferView];
-
-            const tinygltf::BufferView* bonesView = bonesAcc ? &model.bufferViews[bonesAcc->bufferView] : nullptr;
-            const tinygltf::BufferView* weightsView = weightsAcc ? &model.bufferViews[weightsAcc->bufferView] : nullptr;
-
-            const tinygltf::Buffer& posBuff = model.buffers[posView.buffer];
-            const tinygltf::Buffer& normBuff = model.buffers[normView.buffer];
-            const tinygltf::Buffer* colorBuff = colorView ? &model.buffers[colorView->buffer] : nullptr;
-            const tinygltf::Buffer& uvBuff = model.buffers[uvView.buffer];
-
-            const tinygltf::Buffer* bonesBuff = bonesView ? &model.buffers[bonesView->buffer] : nullptr;
-            const tinygltf::Buffer* weightsBuff = weightsView ? &model.buffers[weightsView->buffer] : nullptr;
-
-            const size_t vertsOffset = mVertices.size() / vertexSize;
-            mVertices.resize(mVertices.size() + (posAcc.count * vertexSize));
-            for (size_t j = 0; j < posAcc.count; ++j) {
-                const float* posPtr = reinterpret_cast<const float*>(posBuff.data.data() + posAcc.byteOffset + posView.byteOffset) + (j * 3);
-                const float* normPtr = reinterpret_cast<const float*>(normBuff.data.data() + normAcc.byteOffset + normView.byteOffset) + (j * 3);
-                const float* uvPtr = reinterpret_cast<const float*>(uvBuff.data.data() + uvAcc.byteOffset + uvView.byteOffset) + (j * 2);
-
-                if (mVertexType == VertexType::PosNormalTexcoord) {
-                    Vertex_PNT& v = reinterpret_cast<Vertex_PNT*>(mVertices.data())[vertsOffset + j];
-                    v.pos.x     = posPtr[0];  v.pos.y    = posPtr[1];  v.pos.z    = posPtr[2];
-                    v.normal.x  = normPtr[0]; v.normal.y = normPtr[1]; v.normal.z = normPtr[2];
-                    v.uv.x      = uvPtr[0];   v.uv.y     = uvPtr[1];
-                } else {
-                    Vertex_PNCT& v = reinterpret_cast<Vertex_PNCT*>(mVertices.data())[vertsOffset + j];
-                    v.pos.x     = posPtr[0];  v.pos.y    = posPtr[1];  v.pos.z    = posPtr[2];
-                    v.normal.x  = normPtr[0]; v.normal.y = normPtr[1]; v.normal.z = normPtr[2];
-                    if (colorAcc) {
-                        DecodeGLTFVertexColor(v, colorAcc, colorView, colorBuff, j);
-                    } else {
-                        v.color = ~0u;
-                    }
-                    v.uv.x      = uvPtr[0];   v.uv.y     = uvPtr[1];
-                }
-            }
-
-            if (bonesBuff && weightsBuff) {
-                const size_t skinVertsOffset = mSkinVertices.size();
-                mSkinVertices.resize(mSkinVertices.size() + posAcc.count);
-                const bool bonesAreU8 = bonesAcc->componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE;
-                const uint8_t* weightsPtr = weightsBuff->data.data() + weightsAcc->byteOffset + weightsView->byteOffset;
-                for (size_t j = 0, weightsOff = 0; j < posAcc.count; ++j) {
-                    const uint16_t* bonesPtrU16 = reinterpret_cast<const uint16_t*>(bonesBuff->data.data() + bonesAcc->byteOffset + bonesView->byteOffset) + (j * 4);
-                    const uint8_t* bonesPtrU8 = bonesBuff->data.data() + bonesAcc->byteOffset + bonesView->byteOffset + (j * 4);
-
-                    Vertex_Skin& vs = mSkinVertices[skinVertsOffset + j];
-                    vs.bones[0] = bonesAreU8 ? bonesPtrU8[0] : static_cast<uint8_t>(bonesPtrU16[0]);
-                    vs.bones[1] = bonesAreU8 ? bonesPtrU8[1] : static_cast<uint8_t>(bonesPtrU16[1]);
-                    vs.bones[2] = bonesAreU8 ? bonesPtrU8[2] : static_cast<uint8_t>(bonesPtrU16[2]);
-                    vs.bones[3] = bonesAreU8 ? bonesPtrU8[3] : static_cast<uint8_t>(bonesPtrU16[3]);
-                    weightsOff += UnpackVec<4, true>(weightsPtr + weightsOff, vs.weights, weightsAcc->componentType);
-                }
-
-                section.skinningOffset = static_cast<uint32_t>(skinVertsOffset);
-            }
-
-            const tinygltf::Accessor& idxAcc = model.accessors[prim.indices];
-            assert((idxAcc.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT || idxAcc.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT) && idxAcc.type == TINYGLTF_TYPE_SCALAR);
-
-            const tinygltf::BufferView& idxView = model.bufferViews[idxAcc.bufferView];
-            const tinygltf::Buffer& idxBuff = model.buffers[idxView.buffer];
-
-            const size_t indicesOffset = mIndices.size();
-            mIndices.resize(mIndices.size() + idxAcc.count);
-            if (idxAcc.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT) {
-                std::memcpy(mIndices.data() + indicesOffset, idxBuff.data.data() + idxAcc.byteOffset + idxView.byteOffset, idxAcc.count * sizeof(uint16_t));
-            } else {
-                const uint32_t* srcIndices = reinterpret_cast<const uint32_t*>(idxBuff.data.data() + idxAcc.byteOffset + idxView.byteOffset);
-                for (size_t j = 0; j < idxAcc.count; ++j) {
-                    mIndices[indicesOffset + j] = static_cast<uint16_t>(srcIndices[j]);
-                }
-            }
-
-            section.numVertices = static_cast<uint32_t>(posAcc.count);
-            section.numIndices = static_cast<uint32_t>(idxAcc.count);
-            section.vbOffset = static_cast<uint32_t>(vertsOffset);
-            section.ibOffset = static_cast<uint32_t>(indicesOffset);
-            const int albedoIdx = model.materials[prim.material].pbrMetallicRoughness.baseColorTexture.index;
-            section.textureIdx = static_cast<uint32_t>(model.textures[albedoIdx].source);
+    mMeshes.resize(model.meshes.size());
+    for (size_t i = 0, end = model.meshes.size(); i < end; ++i) {
+        const ModelFile::Range& srcMesh = model.meshes[i];
+        std::vector<Section>& sections = mMeshes[i].sections;
+
+        sections.resize(srcMesh.count);
+        for (uint32_t j = 0; j < srcMesh.count; ++j) {
+            const ModelFile::Section& srcSection = model.sections[srcMesh.first + j];
+            sections[j] = { srcSection.numVertices, srcSection.numIndices, srcSection.vbOffset, srcSection.ibOffset, srcSection.textureIdx, srcSection.skinningOffset };
         }
     }
 
@@ -376,43 +100,74 @@ bool ModelGLTF::LoadFromFile(const std::string& filePath, IDirect3DDevice8* devi
     // now collect textures
     mTextures.resize(model.images.size());
     for (size_t i = 0, n = model.images.size(); i < n; ++i) {
-        const tinygltf::Image& img = model.images[i];
+        const ModelFile::Range& img = model.images[i];
         IUnknownPtr<IDirect3DTexture8>& texture = mTextures[i];
 
-        HRESULT hr = GfxCreateTextureFromFileInMem(device, (void*)img.image.data(), img.image.size(), texture.ReleaseAndGetAddressOf());
+        HRESULT hr = GfxCreateTextureFromFileInMem(device, (void*)(model.imageData.data() + img.first), img.count, texture.ReleaseAndGetAddressOf());
         if (FAILED(hr)) {
             return false;
         }
     }
 
+    auto indicesOf = [](const std::vector<int32_t>& table, const ModelFile::Range& range)->std::vector<int> {
+        return std::vector<int>(table.begin() + range.first, table.begin() + range.first + range.count);
+    };
+
     mSceneNodes.resize(model.nodes.size());
     for (size_t i = 0, end = model.nodes.size(); i < end; ++i) {
-        const tinygltf::Node& srcNode = model.nodes[i];
+        const ModelFile::Node& srcNode = model.nodes[i];
         SceneNode& dstNode = mSceneNodes[i];
 
-        dstNode.meshIdx = srcNode.mesh;
-        dstNode.skinIdx = srcNode.skin;
-        ReadGLTFTransformation(srcNode, dstNode);
-        dstNode.children = srcNode.children;
+        dstNode.meshIdx = srcNode.meshIdx;
+        dstNode.animTrackIdx = srcNode.animTrackIdx;
+        dstNode.skinIdx = srcNode.skinIdx;
+        dstNode.position = D3DXVECTOR3(srcNode.position);
+        dstNode.rotation = D3DXQUATERNION(srcNode.rotation);
+        dstNode.scale = D3DXVECTOR3(srcNode.scale);
+        dstNode.children = indicesOf(model.children, srcNode.children);
 
         MakeNodeXForm(dstNode.position, dstNode.rotation, dstNode.scale, dstNode.xform);
     }
 
-    assert(!model.scenes.empty());
-    const tinygltf::Scene& scene = *model.scenes.begin();
     mRootNode.position = { 0.0f, 0.0f, 0.0f };
     D3DXQuaternionIdentity(&mRootNode.rotation);
     mRootNode.scale = { 1.0f, 1.0f, 1.0f };
-    mRootNode.children = scene.nodes;
+    mRootNode.children = indicesOf(model.children, model.rootChildren);
 
     mAnimatedNodesXForms.resize(model.nodes.size());
 
-    if (!model.animations.empty()) {
-        this->CollectAnimation(&model);
+    // an all zero source never matches a real transform, so every inverse is computed on first use
+    D3DXMATRIX zeroXForm;
+    std::memset(&zeroXForm, 0, sizeof(zeroXForm));
+    mNodeXFormsI.resize(model.nodes.size(), zeroXForm);
+    mNodeXFormsISource.resize(model.nodes.size(), zeroXForm);
+
+    // animation
+    mAnimTimeline = std::move(model.timeline);
+    mAnimTracks.resize(model.tracks.size());
+    for (size_t i = 0, end = model.tracks.size(); i < end; ++i) {
+        const ModelFile::AnimTrack& srcTrack = model.tracks[i];
+        AnimTrack& dstTrack = mAnimTracks[i];
+
+        const D3DXVECTOR3* vec3 = reinterpret_cast<const D3DXVECTOR3*>(model.trackVec3.data());
+        const D3DXQUATERNION* vec4 = reinterpret_cast<const D3DXQUATERNION*>(model.trackVec4.data());
+
+        dstTrack.target = srcTrack.target;
+        dstTrack.offsets.assign(vec3 + srcTrack.offsets.first, vec3 + srcTrack.offsets.first + srcTrack.offsets.count);
+        dstTrack.rotations.assign(vec4 + srcTrack.rotations.first, vec4 + srcTrack.rotations.first + srcTrack.rotations.count);
+        dstTrack.scales.assign(vec3 + srcTrack.scales.first, vec3 + srcTrack.scales.first + srcTrack.scales.count);
     }
 
-    if (!model.skins.empty()) {
-        this->CollectSkinning(&model);
+    // skinning
+    mSkins.resize(model.skins.size());
+    for (size_t i = 0, end = model.skins.size(); i < end; ++i) {
+        const ModelFile::Skin& srcSkin = model.skins[i];
+        Skin& dstSkin = mSkins[i];
+
+        const D3DXMATRIX* invBindMatrices = reinterpret_cast<const D3DXMATRIX*>(model.invBindMatrices.data());
+
+        dstSkin.joints = indicesOf(model.joints, srcSkin.joints);
+        dstSkin.invBindMatrices.assign(invBindMatrices + srcSkin.invBindMatrices.first, invBindMatrices + srcSkin.invBindMatrices.first + srcSkin.invBindMatrices.count);
     }
 
     mAnimTime = 0.0f;
@@ -426,6 +181,7 @@ bool ModelGLTF::LoadFromFile(const std::string& filePath, IDirect3DDevice8* devi
 }
 
 void ModelGLTF::Update(const float deltaInSeconds, const D3DXMATRIX& globalXForm, float* customTimer) {
+    float time = 0.0f;
     if (!mAnimTimeline.empty()) {
         float& timer = (customTimer == nullptr) ? mAnimTime : *customTimer;
 
@@ -433,12 +189,29 @@ void ModelGLTF::Update(const float deltaInSeconds, const D3DXMATRIX& globalXForm
         while (timer > mAnimTimeline.back()) {
             timer -= mAnimTimeline.back();
         }
+        time = timer;
+    }
+
+    if (!mPoseVertices.empty()) {
+        this->UpdateFromPoseCache(time, globalXForm);
+        return;
+    }
+
+    this->AnimateNodes(time);
+
+    if (!mUploadToGPU) {
+        this->XFormAllVertices(globalXForm, mXFormedVertices.data());
+    }
+}
 
-        auto it = std::upper_bound(mAnimTimeline.begin(), mAnimTimeline.end(), timer);
-        const size_t idxB = std::distance(mAnimTimeline.begin(), it);
+void ModelGLTF::AnimateNodes(const float time) {
+    if (!mAnimTimeline.empty()) {
+        // a time exactly at the end of the timeline (as a pose sample can be) uses the last key
+        auto it = std::upper_bound(mAnimTimeline.begin(), mAnimTimeline.end(), time);
+        const size_t idxB = (std::min)(static_cast<size_t>(std::distance(mAnimTimeline.begin(), it)), mAnimTimeline.size() - 1);
         const size_t idxA = idxB > 0 ? idxB - 1 : 0;
 
-        const float t = (timer - mAnimTimeline[idxA]) / (mAnimTimeline[idxB] - mAnimTimeline[idxA]);
+        const float t = (idxA != idxB) ? (time - mAnimTimeline[idxA]) / (mAnimTimeline[idxB] - mAnimTimeline[idxA]) : 0.0f;
 
         for (AnimTrack& track : mAnimTracks) {
             D3DXVECTOR3 offset;
@@ -472,12 +245,35 @@ void ModelGLTF::Update(const float deltaInSeconds, const D3DXMATRIX& globalXForm
     for (const int idx : mRootNode.children) {
         this->RecursiveBuildChildrenXForm(idx, rootXForm);
     }
+}
 
-    if (!mUploadToGPU) {
-        if (mVertexType == VertexType::PosNormalTexcoord) {
-            this->XFormVertices<Vertex_PNT>(globalXForm, reinterpret_cast<Vertex_PNT*>(mXFormedVertices.data()));
-        } else {
-            this->XFormVertices<Vertex_PNCT>(globalXForm, reinterpret_cast<Vertex_PNCT*>(mXFormedVertices.data()));
+void ModelGLTF::UpdateFromPoseCache(const float time, const D3DXMATRIX& globalXForm) {
+    const size_t poseIdx = (std::min)(static_cast<size_t>(time * mPoseSampleRate + 0.5f), mPoseVertices.size() - 1);
+    std::vector<uint8_t>& pose = mPoseVertices[poseIdx];
+    if (pose.empty()) {
+        this->AnimateNodes((std::min)(static_cast<float>(poseIdx) / mPoseSampleRate, mAnimTimeline.back()));
+
+        D3DXMATRIX identity;
+        D3DXMatrixIdentity(&identity);
+        pose = mVertices;
+        this->XFormAllVertices(identity, pose.data());
+    }
+
+    // skinning already went through the node transforms, so every mesh vertex only needs the instance transform:
+    // (v * skin * node) * global == v * skin * (node * global), and the same holds for the normal inverse transposes
+    Skinning::Matrix4x3 posXForm, normalXForm;
+    Skinning::FromMatrix44(globalXForm, posXForm);
+    Skinning::InverseTranspose3x3(posXForm, normalXForm);
+
+    const size_t vertexSize = (mVertexType == VertexType::PosNormalTexcoord) ? sizeof(Vertex_PNT) : sizeof(Vertex_PNCT);
+    for (const ModelGLTF::SceneNode& node : mSceneNodes) {
+        if (node.meshIdx < 0) {
+            continue;
+        }
+
+        for (const ModelGLTF::Section& section : mMeshes[node.meshIdx].sections) {
+            const size_t offset = section.vbOffset * vertexSize;
+            Skinning::XFormVertices(posXForm, normalXForm, pose.data() + offset, mXFormedVertices.data() + offset, vertexSize, section.numVertices);
         }
     }
 }
@@ -515,6 +311,31 @@ HRESULT ModelGLTF::Draw(IDirect3DDevice8* device) {
     return hr;
 }
 
+void ModelGLTF::EnablePoseCache(const uint32_t samplesPerSecond) {
+    mPoseVertices.clear();
+    mPoseSampleRate = 0.0f;
+
+    // GPU models are never transformed on the CPU, and without an animation there is only one pose anyway
+    if (!samplesPerSecond || mUploadToGPU || mAnimTimeline.empty()) {
+        return;
+    }
+
+    mPoseSampleRate = static_cast<float>(samplesPerSecond);
+    mPoseVertices.resize(static_cast<size_t>(mAnimTimeline.back() * mPoseSampleRate) + 1);
+}
+
+size_t ModelGLTF::GetNumPoseSamples() const {
+    return mPoseVertices.size();
+}
+
+size_t ModelGLTF::GetPoseCacheBytes() const {
+    size_t result = 0;
+    for (const std::vector<uint8_t>& pose : mPoseVertices) {
+        result += pose.size();
+    }
+    return result;
+}
+
 size_t ModelGLTF::GetNumMeshes() const {
     return mMeshes.size();
 }
@@ -523,9 +344,12 @@ const ModelGLTF::Mesh& ModelGLTF::GetMesh(const size_t idx) const {
     return mMeshes[idx];
 }
 
+size_t ModelGLTF::GetVertexSize() const {
+    return (mVertexType == VertexType::PosNormalTexcoord) ? sizeof(Vertex_PNT) : sizeof(Vertex_PNCT);
+}
+
 const size_t ModelGLTF::GetNumCPUVertices() const {
-    const size_t vertexSize = (mVertexType == VertexType::PosNormalTexcoord) ? sizeof(Vertex_PNT) : sizeof(Vertex_PNCT);
-    return mVertices.size() / vertexSize;
+    return mVertices.size() / GetVertexSize();
 }
 
 const size_t ModelGLTF::GetNumCPUIndices() const {
@@ -577,100 +401,6 @@ const D3DXMATRIX& ModelGLTF::GetAnimatedSceneNodeXForm(const size_t idx) const {
 }
 
 
-void ModelGLTF::CollectAnimation(const void* gltfModel) {
-    const tinygltf::Model* model = reinterpret_cast<const tinygltf::Model*>(gltfModel);
-
-    const tinygltf::Animation& anim = model->animations.front();
-    // iOrange: I assume only one input sampler for simplicity
-    const int timelineSampler = anim.samplers[0].input;
-
-    const tinygltf::Accessor& timelineAcc = model->accessors[timelineSampler];
-    const tinygltf::BufferView& timelineView = model->bufferViews[timelineAcc.bufferView];
-    const tinygltf::Buffer& timelineBuff = model->buffers[timelineView.buffer];
-
-    assert(timelineAcc.type == TINYGLTF_TYPE_SCALAR && timelineAcc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT);
-    const float* timelinePtr = reinterpret_cast<const float*>(timelineBuff.data.data() + timelineAcc.byteOffset + timelineView.byteOffset);
-    mAnimTimeline.resize(timelineAcc.count);
-    std::memcpy(mAnimTimeline.data(), timelinePtr, timelineAcc.count * sizeof(float));
-
-    for (const tinygltf::AnimationChannel& channel : anim.channels) {
-        const tinygltf::AnimationSampler& sampler = anim.samplers[channel.sampler];
-        assert(sampler.input == timelineSampler);
-        const int targetNode = channel.target_node;
-
-        auto it = std::find_if(mAnimTracks.begin(), mAnimTracks.end(), [targetNode](const AnimTrack& track)->bool {
-            return track.target == targetNode;
-        });
-
-        AnimTrack* track;
-        if (it == mAnimTracks.end()) {
-            mSceneNodes[targetNode].animTrackIdx = static_cast<int>(mAnimTracks.size());
-
-            mAnimTracks.push_back({});
-            track = &mAnimTracks.back();
-            track->target = targetNode;
-        } else {
-            track = &(*it);
-        }
-
-        const tinygltf::Accessor& channelAcc = model->accessors[sampler.output];
-        const tinygltf::BufferView& channelView = model->bufferViews[channelAcc.bufferView];
-        const tinygltf::Buffer& channelBuff = model->buffers[channelView.buffer];
-
-        assert(channelAcc.count == timelineAcc.count);
-
-        if (channel.target_path == "rotation") {
-            assert(channelAcc.type == TINYGLTF_TYPE_VEC4);
-            assert(track->rotations.empty());
-
-            track->rotations.resize(channelAcc.count);
-            const uint8_t* srcData = channelBuff.data.data() + channelAcc.byteOffset + channelView.byteOffset;
-            for (size_t i = 0, offset = 0; i < channelAcc.count; ++i) {
-                offset += UnpackVec<4, true>(srcData + offset, track->rotations[i], channelAcc.componentType);
-            }
-        } else if (channel.target_path == "translation") {
-            assert(channelAcc.type == TINYGLTF_TYPE_VEC3 && channelAcc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT);
-            assert(track->offsets.empty());
-
-            const D3DXVECTOR3* offsetsPtr = reinterpret_cast<const D3DXVECTOR3*>(channelBuff.data.data() + channelAcc.byteOffset + channelView.byteOffset);
-            track->offsets.resize(channelAcc.count);
-            std::memcpy(track->offsets.data(), offsetsPtr, channelAcc.count * sizeof(D3DXVECTOR3));
-        } else if (channel.target_path == "scale") {
-            assert(channelAcc.type == TINYGLTF_TYPE_VEC3 && channelAcc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT);
-            assert(track->scales.empty());
-
-            const D3DXVECTOR3* scalesPtr = reinterpret_cast<const D3DXVECTOR3*>(channelBuff.data.data() + channelAcc.byteOffset + channelView.byteOffset);
-            track->scales.resize(channelAcc.count);
-            std::memcpy(track->scales.data(), scalesPtr, channelAcc.count * sizeof(D3DXVECTOR3));
-        }
-    }
-}
-
-void ModelGLTF::CollectSkinning(const void* gltfModel) {
-    const tinygltf::Model* model = reinterpret_cast<const tinygltf::Model*>(gltfModel);
-
-    const size_t numSkins = model->skins.size();
-    mSkins.resize(numSkins);
-
-    for (size_t skinIdx = 0; skinIdx < numSkins; ++skinIdx) {
-        const tinygltf::Skin& srcSkin = model->skins.front();
-        Skin& dstSkin = mSkins[skinIdx];
-
-        dstSkin.joints = srcSkin.joints;
-
-        const tinygltf::Accessor& invBindMatsAcc = model->accessors[srcSkin.inverseBindMatrices];
-        const tinygltf::BufferView& invBindMatsView = model->bufferViews[invBindMatsAcc.bufferView];
-        const tinygltf::Buffer& invBindMatsBuff = model->buffers[invBindMatsView.buffer];
-
-        assert(invBindMatsAcc.type == TINYGLTF_TYPE_MAT4 && invBindMatsAcc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT);
-
-        dstSkin.invBindMatrices.resize(invBindMatsAcc.count);
-
-        const float* invBindMatsPtr = reinterpret_cast<const float*>(invBindMatsBuff.data.data() + invBindMatsAcc.byteOffset + invBindMatsView.byteOffset);
-        std::memcpy(dstSkin.invBindMatrices.data(), invBindMatsPtr, invBindMatsAcc.count * sizeof(D3DXMATRIX));
-    }
-}
-
 void ModelGLTF::RecursiveBuildChildrenXForm(const int nodeIdx, const D3DXMATRIX& parentXForm) {
     const SceneNode& node = mSceneNodes[nodeIdx];
     if (node.animTrackIdx < 0) {
@@ -682,13 +412,31 @@ void ModelGLTF::RecursiveBuildChildrenXForm(const int nodeIdx, const D3DXMATRIX&
     }
 }
 
+const D3DXMATRIX& ModelGLTF::GetNodeXFormInverse(const size_t idx) {
+    const D3DXMATRIX& nodeXForm = mAnimatedNodesXForms[idx];
+    if (std::memcmp(&nodeXForm, &mNodeXFormsISource[idx], sizeof(D3DXMATRIX)) != 0) {
+        D3DXMatrixInverse(&mNodeXFormsI[idx], nullptr, &nodeXForm);
+        mNodeXFormsISource[idx] = nodeXForm;
+    }
+    return mNodeXFormsI[idx];
+}
+
+void ModelGLTF::XFormAllVertices(const D3DXMATRIX& globalXForm, uint8_t* dstVertices) {
+    if (mVertexType == VertexType::PosNormalTexcoord) {
+        this->XFormVertices<Vertex_PNT>(globalXForm, reinterpret_cast<Vertex_PNT*>(dstVertices));
+    } else {
+        this->XFormVertices<Vertex_PNCT>(globalXForm, reinterpret_cast<Vertex_PNCT*>(dstVertices));
+    }
+}
+
 template <typename T>
 void ModelGLTF::XFormVertices(const D3DXMATRIX& globalXForm, T* dstVertices) {
-    const T* srcVertices = reinterpret_cast<const T*>(mVertices.data());
+    static_assert(offsetof(T, pos) == 0 && offsetof(T, normal) == 12, "Skinning kernels expect the position and normal first");
+    static_assert(sizeof(Vertex_Skin) == sizeof(Skinning::Influence));
 
-    std::vector<D3DXMATRIX> jointXForms;
-    const D3DXVECTOR3* vpos, * vnorm;
-    D3DXVECTOR3 skinnedPos, skinnedNorm;
+    const uint8_t* srcVertices = mVertices.data();
+    uint8_t* dst = reinterpret_cast<uint8_t*>(dstVertices);
+    const Skinning::Influence* influences = reinterpret_cast<const Skinning::Influence*>(mSkinVertices.data());
 
     for (size_t i = 0, numNodes = mSceneNodes.size(); i < numNodes; ++i) {
         const ModelGLTF::SceneNode& node = mSceneNodes[i];
@@ -698,62 +446,42 @@ void ModelGLTF::XFormVertices(const D3DXMATRIX& globalXForm, T* dstVertices) {
 
         const D3DXMATRIX& nodeXForm = mAnimatedNodesXForms[i];
 
-        D3DXMATRIX fullXForm = nodeXForm * globalXForm;
-        D3DXMATRIX fullXFormI, fullXFormTI;
-        D3DXMatrixInverse(&fullXFormI, nullptr, &fullXForm);
-        D3DXMatrixTranspose(&fullXFormTI, &fullXFormI);
+        // normals go through the inverse transpose, only the 3x3 part is needed so no full 4x4 inverse here
+        const D3DXMATRIX fullXForm = nodeXForm * globalXForm;
+        Skinning::Matrix4x3 posXForm, normalXForm;
+        Skinning::FromMatrix44(fullXForm, posXForm);
+        Skinning::InverseTranspose3x3(posXForm, normalXForm);
 
         const ModelGLTF::Mesh& mesh = mMeshes[node.meshIdx];
         const Skin* skin = (node.skinIdx >= 0) ? &mSkins[node.skinIdx] : nullptr;
 
         if (skin) {
             const size_t numJoints = skin->invBindMatrices.size();
-            jointXForms.resize((std::max)(jointXForms.size(), numJoints));
+            mJointPosXForms.resize((std::max)(mJointPosXForms.size(), numJoints));
+            mJointNormalXForms.resize((std::max)(mJointNormalXForms.size(), numJoints));
 
-            D3DXMATRIX nodeXFormI;
-            D3DXMatrixInverse(&nodeXFormI, nullptr, &nodeXForm);
+            const D3DXMATRIX& nodeXFormI = this->GetNodeXFormInverse(i);
+
+            // fold the node transform into each joint, the translation is added once per vertex after blending
+            Skinning::Matrix4x3 linearXForm = posXForm;
+            std::memset(linearXForm.r[3], 0, sizeof(linearXForm.r[3]));
 
             for (size_t j = 0; j < numJoints; ++j) {
-                jointXForms[j] = skin->invBindMatrices[j] * mAnimatedNodesXForms[skin->joints[j]] * nodeXFormI;
+                const D3DXMATRIX jointXForm = skin->invBindMatrices[j] * mAnimatedNodesXForms[skin->joints[j]] * nodeXFormI;
+
+                Skinning::Matrix4x3 joint;
+                Skinning::FromMatrix44(jointXForm, joint);
+                Skinning::Multiply(joint, linearXForm, mJointPosXForms[j]);
+                Skinning::Multiply(joint, normalXForm, mJointNormalXForms[j]);
             }
-        }
 
-        for (const ModelGLTF::Section& section : mesh.sections) {
-            for (size_t j = 0; j < section.numVertices; ++j) {
-                if (skin) {
-                    D3DXMATRIX skinMat;
-                    std::memset(&skinMat, 0, sizeof(skinMat));
-                    const Vertex_Skin& skinVert = mSkinVertices[section.skinningOffset + j];
-                    for (size_t k = 0; k < 4; ++k) {
-                        if (skinVert.weights[k] > 0.0f) {
-                            skinMat += (jointXForms[skinVert.bones[k]] * skinVert.weights[k]);
-                        }
-                    }
-
-                    D3DXVECTOR4 temp;
-                    D3DXVec3Transform(&temp, &srcVertices[section.vbOffset + j].pos, &skinMat);
-                    D3DXVec3TransformNormal(&skinnedNorm, &srcVertices[section.vbOffset + j].normal, &skinMat);
-
-                    skinnedPos.x = temp.x;
-                    skinnedPos.y = temp.y;
-                    skinnedPos.z = temp.z;
-
-                    vpos = &skinnedPos;
-                    vnorm = &skinnedNorm;
-                } else {
-                    vpos = &srcVertices[section.vbOffset + j].pos;
-                    vnorm = &srcVertices[section.vbOffset + j].normal;
-                }
-
-                D3DXVECTOR4 xformedV;
-                D3DXVECTOR3 xformedN;
-                D3DXVec3Transform(&xformedV, vpos, &fullXForm);
-                D3DXVec3TransformNormal(&xformedN, vnorm, &fullXFormTI);
-
-                dstVertices[section.vbOffset + j].pos.x = xformedV.x;
-                dstVertices[section.vbOffset + j].pos.y = xformedV.y;
-                dstVertices[section.vbOffset + j].pos.z = xformedV.z;
-                dstVertices[section.vbOffset + j].normal = xformedN;
+            for (const ModelGLTF::Section& section : mesh.sections) {
+                Skinning::SkinVertices(mJointPosXForms.data(), mJointNormalXForms.data(), posXForm.r[3], influences + section.skinningOffset,
+                                       srcVertices + section.vbOffset * sizeof(T), dst + section.vbOffset * sizeof(T), sizeof(T), section.numVertices);
+            }
+        } else {
+            for (const ModelGLTF::Section& section : mesh.sections) {
+                Skinning::XFormVertices(posXForm, normalXForm, srcVertices + section.vbOffset * sizeof(T), dst + section.vbOffset * sizeof(T), sizeof(T), section.numVertices);
             }
         }
     }
@@ -2,6 +2,7 @@
 #include <string>
 #include "Wrappers\d3d8\d3d8wrapper.h"
 #include "IUnknownPtr.h"
+#include "Skinning.h"
 
 class ModelGLTF {
 public:
@@ -76,9 +77,17 @@ public:
     void                                Update(const float deltaInSeconds, const D3DXMATRIX& globalXForm, float* customTimer = nullptr);
     HRESULT                             Draw(IDirect3DDevice8* device);
 
+    // instances sharing this model at the same animation time share one skinned pose: the animation is sampled at
+    // samplesPerSecond and every sample is skinned once in model space, Update then only applies the instance
+    // transform. Higher rates are closer to the exact animation but cache more poses, 0 disables the cache
+    void                                EnablePoseCache(const uint32_t samplesPerSecond);
+    size_t                              GetNumPoseSamples() const;
+    size_t                              GetPoseCacheBytes() const;  // poses skinned so far
+
     size_t                              GetNumMeshes() const;
     const Mesh&                         GetMesh(const size_t idx) const;
 
+    size_t                              GetVertexSize() const;      // stride of the vertex type the model was created with
     const size_t                        GetNumCPUVertices() const;
     const size_t                        GetNumCPUIndices() const;
     const uint8_t*                      GetCPUVertices() const;
@@ -98,10 +107,14 @@ public:
     const D3DXMATRIX&                   GetAnimatedSceneNodeXForm(const size_t idx) const;
 
 private:
-    void                                CollectAnimation(const void* gltfModel);
-    void                                CollectSkinning(const void* gltfModel);
     void                                RecursiveBuildChildrenXForm(const int nodeIdx, const D3DXMATRIX& parentXForm);
 
+    void                                AnimateNodes(const float time);
+    void                                UpdateFromPoseCache(const float time, const D3DXMATRIX& globalXForm);
+    const D3DXMATRIX&                   GetNodeXFormInverse(const size_t idx);
+
+    void                                XFormAllVertices(const D3DXMATRIX& globalXForm, uint8_t* dstVertices);
+
     template <typename T>
     void                                XFormVertices(const D3DXMATRIX& globalXForm, T* dstVertices);
 
@@ -135,4 +148,12 @@ private:
     // skinning
     std::vector<Vertex_Skin>            mSkinVertices;
     std::vector<Skin>                   mSkins;
+    std::vector<D3DXMATRIX>             mNodeXFormsI;       // inverses of mAnimatedNodesXForms, recomputed only when
+    std::vector<D3DXMATRIX>             mNodeXFormsISource; // the node transform differs from the one they were built from
+    std::vector<Skinning::Matrix4x3>    mJointPosXForms;
+    std::vector<Skinning::Matrix4x3>    mJointNormalXForms;
+
+    // pose cache
+    float                               mPoseSampleRate;
+    std::vector<std::vector<uint8_t>>   mPoseVertices;      // model space vertices per time sample, skinned on first use
 };
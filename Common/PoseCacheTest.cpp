@@ -0,0 +1,331 @@
+// checks what the ModelGLTF pose cache relies on, with the real Skinning kernels on a synthetic skeleton: a pose skinned
+// once in model space and moved by an instance transform with XFormVertices gives the same vertices as skinning that
+// instance directly (v * skin * node * global == (v * skin * node) * global), the error between samples halves when the
+// sample rate doubles, and sharing poses beats skinning every instance. ModelGLTF itself needs D3D, so the cache lookup
+// (nearest sample, skinned on first use) is restated here. it builds and runs on Linux.
+//
+// usage: run from the repository root
+//   g++ -std=c++17 -O2 -I. -o PoseCacheTest Common/PoseCacheTest.cpp Common/Skinning.cpp
+//   ./PoseCacheTest
+
+#include "Common/Skinning.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#define CHECK(condition) \
+    do { if (!(condition)) { std::printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); return 1; } } while (0)
+
+namespace {
+    struct Matrix44 {
+        float m[16];
+    };
+
+    struct Quaternion {
+        float x, y, z, w;
+    };
+
+    // same layout as ModelGLTF::Vertex_PNT
+    struct Vertex {
+        float pos[3];
+        float normal[3];
+        float uv[2];
+    };
+
+    constexpr int kNumJoints = 24;
+    constexpr int kNumKeys = 49;
+    constexpr int kNumVertices = 1200;
+    constexpr float kDuration = 2.0f;
+
+    std::mt19937 gRandom(7);
+    std::uniform_real_distribution<float> gUnit(-1.0f, 1.0f);
+
+    Matrix44 Identity() {
+        Matrix44 result = {};
+        result.m[0] = result.m[5] = result.m[10] = result.m[15] = 1.0f;
+        return result;
+    }
+
+    Matrix44 Multiply(const Matrix44& a, const Matrix44& b) {
+        Matrix44 result;
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                float sum = 0.0f;
+                for (int k = 0; k < 4; ++k) {
+                    sum += a.m[i * 4 + k] * b.m[k * 4 + j];
+                }
+                result.m[i * 4 + j] = sum;
+            }
+        }
+        return result;
+    }
+
+    // rigid transforms only, so the inverse is the transposed rotation and the rotated negative translation
+    Matrix44 InverseRigid(const Matrix44& a) {
+        Matrix44 result = Identity();
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                result.m[i * 4 + j] = a.m[j * 4 + i];
+            }
+        }
+        for (int j = 0; j < 3; ++j) {
+            result.m[12 + j] = -(a.m[12] * result.m[j] + a.m[13] * result.m[4 + j] + a.m[14] * result.m[8 + j]);
+        }
+        return result;
+    }
+
+    Quaternion Slerp(const Quaternion& a, Quaternion b, float t) {
+        float d = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+        if (d < 0.0f) {
+            b = { -b.x, -b.y, -b.z, -b.w };
+            d = -d;
+        }
+        float k0 = 1.0f - t, k1 = t;
+        if (d < 0.9995f) {
+            const float theta = std::acos(d), s = std::sin(theta);
+            k0 = std::sin((1.0f - t) * theta) / s;
+            k1 = std::sin(t * theta) / s;
+        }
+        return { a.x * k0 + b.x * k1, a.y * k0 + b.y * k1, a.z * k0 + b.z * k1, a.w * k0 + b.w * k1 };
+    }
+
+    Matrix44 RotationTranslation(const Quaternion& q, const float* t) {
+        const float x = q.x, y = q.y, z = q.z, w = q.w;
+        const float r[9] = { 1 - 2 * (y * y + z * z), 2 * (x * y + z * w), 2 * (x * z - y * w),
+                             2 * (x * y - z * w), 1 - 2 * (x * x + z * z), 2 * (y * z + x * w),
+                             2 * (x * z + y * w), 2 * (y * z - x * w), 1 - 2 * (x * x + y * y) };
+        Matrix44 result = Identity();
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                result.m[i * 4 + j] = r[i * 3 + j];
+            }
+            result.m[12 + i] = t[i];
+        }
+        return result;
+    }
+
+    // a skeleton with a looping animation and a skinned mesh, node kNumJoints is the mesh node
+    struct Model {
+        std::vector<float>                              timeline;
+        std::vector<std::vector<std::array<float, 3>>>  positions;
+        std::vector<std::vector<Quaternion>>            rotations;
+        std::vector<int>                                parents;
+        std::vector<Matrix44>                           invBind;
+        std::vector<Matrix44>                           nodes;
+        std::vector<Vertex>                             vertices;
+        std::vector<Skinning::Influence>                influences;
+        std::vector<Skinning::Matrix4x3>                jointPos, jointNormal;
+    };
+
+    void Animate(Model& model, float time) {
+        const std::vector<float>& timeline = model.timeline;
+        const size_t b = std::min<size_t>(std::upper_bound(timeline.begin(), timeline.end(), time) - timeline.begin(), timeline.size() - 1);
+        const size_t a = b ? b - 1 : 0;
+        const float t = (a != b) ? (time - timeline[a]) / (timeline[b] - timeline[a]) : 0.0f;
+        for (int j = 0; j < kNumJoints; ++j) {
+            float pos[3];
+            for (int c = 0; c < 3; ++c) {
+                pos[c] = model.positions[j][a][c] * (1.0f - t) + model.positions[j][b][c] * t;
+            }
+            const Matrix44 local = RotationTranslation(Slerp(model.rotations[j][a], model.rotations[j][b], t), pos);
+            model.nodes[j] = (model.parents[j] < 0) ? local : Multiply(local, model.nodes[model.parents[j]]);
+        }
+        model.nodes[kNumJoints] = Identity();
+    }
+
+    // the exact path of ModelGLTF::XFormAllVertices for the current node transforms
+    void Skin(Model& model, const Matrix44& global, Vertex* dst) {
+        const Matrix44 full = Multiply(model.nodes[kNumJoints], global);
+        Skinning::Matrix4x3 posXForm, normalXForm, linear, joint;
+        Skinning::FromMatrix44(full.m, posXForm);
+        Skinning::InverseTranspose3x3(posXForm, normalXForm);
+        linear = posXForm;
+        std::memset(linear.r[3], 0, sizeof(linear.r[3]));
+
+        const Matrix44 nodeInverse = InverseRigid(model.nodes[kNumJoints]);
+        for (int j = 0; j < kNumJoints; ++j) {
+            const Matrix44 m = Multiply(Multiply(model.invBind[j], model.nodes[j]), nodeInverse);
+            Skinning::FromMatrix44(m.m, joint);
+            Skinning::Multiply(joint, linear, model.jointPos[j]);
+            Skinning::Multiply(joint, normalXForm, model.jointNormal[j]);
+        }
+        Skinning::SkinVertices(model.jointPos.data(), model.jointNormal.data(), posXForm.r[3], model.influences.data(),
+                               reinterpret_cast<const uint8_t*>(model.vertices.data()), reinterpret_cast<uint8_t*>(dst), sizeof(Vertex), model.vertices.size());
+    }
+
+    // ModelGLTF::UpdateFromPoseCache: nearest sample, skinned with an identity global the first time it is used
+    struct PoseCache {
+        float                               rate;
+        std::vector<std::vector<Vertex>>    poses;
+    };
+
+    void UpdateFromPoseCache(Model& model, PoseCache& cache, float time, const Matrix44& global, Vertex* dst) {
+        const size_t poseIdx = std::min(static_cast<size_t>(time * cache.rate + 0.5f), cache.poses.size() - 1);
+        std::vector<Vertex>& pose = cache.poses[poseIdx];
+        if (pose.empty()) {
+            Animate(model, std::min(static_cast<float>(poseIdx) / cache.rate, model.timeline.back()));
+            pose = model.vertices;
+            Skin(model, Identity(), pose.data());
+        }
+
+        Skinning::Matrix4x3 posXForm, normalXForm;
+        Skinning::FromMatrix44(global.m, posXForm);
+        Skinning::InverseTranspose3x3(posXForm, normalXForm);
+        Skinning::XFormVertices(posXForm, normalXForm, reinterpret_cast<const uint8_t*>(pose.data()), reinterpret_cast<uint8_t*>(dst), sizeof(Vertex), pose.size());
+    }
+
+    Model MakeModel() {
+        Model model;
+        model.positions.resize(kNumJoints);
+        model.rotations.resize(kNumJoints);
+        model.parents.resize(kNumJoints);
+        model.invBind.resize(kNumJoints);
+        model.nodes.resize(kNumJoints + 1);
+        model.jointPos.resize(kNumJoints);
+        model.jointNormal.resize(kNumJoints);
+
+        // a chain of joints swinging around random axes, fast enough that sampling errors show
+        for (int k = 0; k < kNumKeys; ++k) {
+            model.timeline.push_back(kDuration * k / (kNumKeys - 1));
+        }
+        for (int j = 0; j < kNumJoints; ++j) {
+            model.parents[j] = j ? static_cast<int>(gRandom() % j) : -1;
+            float axis[3] = { gUnit(gRandom), gUnit(gRandom), gUnit(gRandom) };
+            const float length = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+            for (int k = 0; k < kNumKeys; ++k) {
+                const float phase = 6.2831853f * k / (kNumKeys - 1);
+                const float angle = 0.4f * std::sin(2.0f * phase + j);
+                model.positions[j].push_back({ j ? 0.5f : 0.0f, 0.05f * std::sin(phase + j), 0.0f });
+                model.rotations[j].push_back({ axis[0] / length * std::sin(angle / 2), axis[1] / length * std::sin(angle / 2),
+                                               axis[2] / length * std::sin(angle / 2), std::cos(angle / 2) });
+            }
+        }
+        Animate(model, 0.0f);
+        for (int j = 0; j < kNumJoints; ++j) {
+            model.invBind[j] = InverseRigid(model.nodes[j]);
+        }
+
+        for (int i = 0; i < kNumVertices; ++i) {
+            Vertex vertex = {};
+            for (int c = 0; c < 3; ++c) {
+                vertex.pos[c] = gUnit(gRandom) * 3.0f;
+                vertex.normal[c] = gUnit(gRandom);
+            }
+            model.vertices.push_back(vertex);
+
+            Skinning::Influence influence;
+            float weights[4], sum = 0.0f;
+            for (int k = 0; k < 4; ++k) {
+                influence.bones[k] = static_cast<uint8_t>(gRandom() % kNumJoints);
+                weights[k] = (k < 3) ? std::fabs(gUnit(gRandom)) : 0.0f;
+                sum += weights[k];
+            }
+            for (int k = 0; k < 4; ++k) {
+                influence.weights[k] = weights[k] / sum;
+            }
+            model.influences.push_back(influence);
+        }
+        return model;
+    }
+
+    double MaxDistance(const std::vector<Vertex>& a, const std::vector<Vertex>& b) {
+        double result = 0.0;
+        for (size_t i = 0; i < a.size(); ++i) {
+            double d = 0.0;
+            for (int k = 0; k < 3; ++k) {
+                d += (a[i].pos[k] - b[i].pos[k]) * (a[i].pos[k] - b[i].pos[k]);
+            }
+            result = std::max(result, std::sqrt(d));
+        }
+        return result;
+    }
+}
+
+int main() {
+    Model model = MakeModel();
+    const float placement[3] = { 5000.0f, 30.0f, -2000.0f };
+    const Matrix44 global = RotationTranslation({ 0.0f, 0.3826834f, 0.0f, 0.9238795f }, placement);
+    std::vector<Vertex> exact(model.vertices), cached(model.vertices);
+
+    // at the sample times the cached pose is the exact one, far from the origin too
+    double radius = 0.0;
+    for (const uint32_t rate : { 15u, 30u, 60u }) {
+        PoseCache cache{ static_cast<float>(rate), std::vector<std::vector<Vertex>>(static_cast<size_t>(kDuration * rate) + 1) };
+        for (size_t i = 0; i < cache.poses.size(); ++i) {
+            const float time = std::min(static_cast<float>(i) / rate, kDuration);
+            Animate(model, time);
+            Skin(model, global, exact.data());
+            UpdateFromPoseCache(model, cache, time, global, cached.data());
+            for (const Vertex& vertex : exact) {
+                radius = std::max(radius, std::hypot<double>(vertex.pos[0] - placement[0], vertex.pos[1] - placement[1], vertex.pos[2] - placement[2]));
+            }
+            CHECK(MaxDistance(exact, cached) < 1e-5 * 5000.0);
+        }
+    }
+
+    // in between, the error is that of the nearest sample and halves with each doubling of the rate
+    double previousError = 0.0;
+    for (const uint32_t rate : { 15u, 30u, 60u }) {
+        PoseCache cache{ static_cast<float>(rate), std::vector<std::vector<Vertex>>(static_cast<size_t>(kDuration * rate) + 1) };
+        double maxError = 0.0;
+        for (int frame = 0; frame < 600; ++frame) {
+            const float time = std::fmod(frame * 0.37f / 60.0f, kDuration);
+            Animate(model, time);
+            Skin(model, global, exact.data());
+            UpdateFromPoseCache(model, cache, time, global, cached.data());
+            maxError = std::max(maxError, MaxDistance(exact, cached));
+        }
+        size_t bytes = 0;
+        for (const std::vector<Vertex>& pose : cache.poses) {
+            bytes += pose.size() * sizeof(Vertex);
+        }
+        std::printf("%2u fps: %zu samples, %zu KB, max position error %.3f (%.1f%% of the model radius)\n", rate, cache.poses.size(), bytes / 1024,
+                    maxError, 100.0 * maxError / radius);
+        CHECK(previousError == 0.0 || maxError < previousError * 0.75);
+        previousError = maxError;
+    }
+
+    // instances on their own timers, one Update per instance and frame like CockroachesReplacement
+    for (const int instances : { 10, 50, 200 }) {
+        std::vector<float> timers(instances);
+        std::vector<Matrix44> placements(instances);
+        for (int n = 0; n < instances; ++n) {
+            timers[n] = std::fabs(gUnit(gRandom)) * kDuration;
+            const float position[3] = { gUnit(gRandom) * 100.0f, 0.0f, gUnit(gRandom) * 100.0f };
+            placements[n] = RotationTranslation({ 0.0f, 0.0f, 0.0f, 1.0f }, position);
+        }
+
+        double milliseconds[2];
+        PoseCache cache{ 30.0f, std::vector<std::vector<Vertex>>(static_cast<size_t>(kDuration * 30) + 1) };
+        for (int mode = 0; mode < 2; ++mode) {
+            const auto run = [&](int frames) {
+                for (int frame = 0; frame < frames; ++frame) {
+                    for (int n = 0; n < instances; ++n) {
+                        timers[n] = std::fmod(timers[n] + 1.0f / 60.0f, kDuration);
+                        if (mode == 0) {
+                            Animate(model, timers[n]);
+                            Skin(model, placements[n], exact.data());
+                        } else {
+                            UpdateFromPoseCache(model, cache, timers[n], placements[n], cached.data());
+                        }
+                    }
+                }
+            };
+            // the first two seconds skin every sample once
+            run(120);
+            const auto start = std::chrono::steady_clock::now();
+            run(200);
+            milliseconds[mode] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / 200;
+        }
+        std::printf("%3d instances: skinned each %.3f ms, pose cache %.3f ms per frame\n", instances, milliseconds[0], milliseconds[1]);
+    }
+
+    std::printf("all pose cache checks passed\n");
+    return 0;
+}
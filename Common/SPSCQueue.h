@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <utility>
+
+// Bounded single producer / single consumer queue
+//
+// Push and TryPop never block and never allocate, the indices are lock-free. The mutex is only
+// used so an idle consumer can sleep in Pop until the producer signals new data or Close is called.
+template <typename T, size_t Capacity>
+class SPSCQueue
+{
+	static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+	// Producer: returns false if the queue is full or closed, the item is left untouched
+	bool Push(T&& Item)
+	{
+		const size_t CurrentTail = Tail.load(std::memory_order_relaxed);
+		if (Closed.load(std::memory_order_relaxed) || CurrentTail - Head.load(std::memory_order_acquire) >= Capacity)
+		{
+			return false;
+		}
+
+		Items[CurrentTail & (Capacity - 1)] = std::move(Item);
+		Tail.store(CurrentTail + 1, std::memory_order_release);
+
+		Notify();
+		return true;
+	}
+
+	// Consumer: returns false if the queue is empty
+	bool TryPop(T& Item)
+	{
+		const size_t CurrentHead = Head.load(std::memory_order_relaxed);
+		if (CurrentHead == Tail.load(std::memory_order_acquire))
+		{
+			return false;
+		}
+
+		Item = std::move(Items[CurrentHead & (Capacity - 1)]);
+		Items[CurrentHead & (Capacity - 1)] = T();
+		Head.store(CurrentHead + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Consumer: waits up to Timeout for an item, returns false on timeout or once closed and drained
+	template <typename Rep, typename Period>
+	bool Pop(T& Item, std::chrono::duration<Rep, Period> Timeout)
+	{
+		if (TryPop(Item))
+		{
+			return true;
+		}
+
+		{
+			std::unique_lock<std::mutex> Lock(WaitMutex);
+			WaitCond.wait_for(Lock, Timeout, [this]() { return !IsEmpty() || IsClosed(); });
+		}
+
+		return TryPop(Item);
+	}
+
+	// Wakes the consumer and rejects any further pushes
+	void Close()
+	{
+		Closed.store(true, std::memory_order_relaxed);
+		Notify();
+	}
+
+	bool IsClosed() const { return Closed.load(std::memory_order_relaxed); }
+	bool IsEmpty() const { return Head.load(std::memory_order_acquire) == Tail.load(std::memory_order_acquire); }
+	size_t Size() const { return Tail.load(std::memory_order_acquire) - Head.load(std::memory_order_acquire); }
+
+private:
+	void Notify()
+	{
+		// Taking the lock orders the notify after a consumer that is about to wait, so no wake-up is lost
+		{
+			std::lock_guard<std::mutex> Lock(WaitMutex);
+		}
+		WaitCond.notify_one();
+	}
+
+	alignas(64) std::atomic<size_t> Head { 0 };
+	alignas(64) std::atomic<size_t> Tail { 0 };
+	std::atomic<bool> Closed { false };
+	T Items[Capacity];
+
+	std::mutex WaitMutex;
+	std::condition_variable WaitCond;
+};
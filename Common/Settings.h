@@ -34,15 +34,19 @@
 	visit(DisableScreenSaver, true) \
 	visit(DisplayModeOption, true) \
 	visit(DynamicResolution, true) \
+	visit(EnableCallRecorder, false) \
 	visit(EnableDebugOverlay, true) \
 	visit(EnableEnhancedMouse, true) \
+	visit(EnableFrameTimeRecorder, false) \
 	visit(EnableHoldToStomp, true) \
 	visit(EnableInfoOverlay, true) \
 	visit(EnableLangPath, true) \
 	visit(EnableMasterVolume, true) \
+	visit(EnableMipCache, false) \
 	visit(EnableMouseWheelSwap, true) \
 	visit(EnableScreenshots, true) \
 	visit(EnableSFXAddrHack, true) \
+	visit(EnableShaderCache, true) \
 	visit(EnableSMAA, false) \
 	visit(EnableSoftShadows, true) \
 	visit(EnableTexAddrHack, true) \
@@ -158,6 +162,7 @@
 	visit(AnisotropicFiltering, 0) \
 	visit(AntiAliasing, 0) \
 	visit(AudioFadeOutDelayMS, 10) \
+	visit(CockroachesPoseFPS, 30) \
 	visit(CRTShader, 0) \
 	visit(CustomFontCharHeight, 32) \
 	visit(CustomFontCharWidth, 20) \
@@ -185,11 +190,17 @@
 	visit(ResY, 0) \
 	visit(ScaleWindowedResolution, 0)\
 	visit(ScreenMode, 0xFFFF) /* Overloading the old 'EnableWndMode' and 'FullscreenWndMode' options */ \
+	visit(ScreenshotBurstInterval, 1) \
+	visit(ScreenshotBurstLength, 300) \
+	visit(ScreenshotCompression, 8) /* 3 to 9 use the stb writer at that level, 0 to 2 the faster ImageEncoder levels */ \
+	visit(ScreenshotFormat, 0) \
+	visit(ShaderCacheSizeMB, 16) \
 	visit(SingleCoreAffinityLegacy, 0) \
 	visit(SmallFontHeight, 24) \
 	visit(SmallFontWidth, 16) \
 	visit(SpaceSize, 7) \
-	visit(SpeedrunMode, 0)
+	visit(SpeedrunMode, 0) \
+	visit(TextureCacheSizeMB, 64)
 
 #define VISIT_FLOAT_SETTINGS(visit) \
 	visit(fog_layer1_x1, 0.250f) \
@@ -227,6 +238,7 @@
 	visit(AntiAliasing) \
 	visit(AudioFadeOutDelayMS) \
 	visit(ChainsawSoundFix) \
+	visit(CockroachesPoseFPS) \
 	visit(CommandWindowMouseFix) \
 	visit(CustomFontCharHeight) \
 	visit(CustomFontCharWidth) \
@@ -238,9 +250,13 @@
 	visit(DisableLoadingPressReturnMessages) \
 	visit(DisableLogging) \
 	visit(DisableRedCross) \
+	visit(EnableCallRecorder) \
 	visit(EnableDebugOverlay) \
+	visit(EnableFrameTimeRecorder) \
 	visit(EnableInfoOverlay) \
+	visit(EnableMipCache) \
 	visit(EnableScreenshots) \
+	visit(EnableShaderCache) \
 	visit(EnableWndMode) \
 	visit(FixFMVResetIssue) \
 	visit(FixElevatorCursorColor) \
@@ -274,11 +290,17 @@
 	visit(ResY) \
 	visit(ScaleWindowedResolution)\
 	visit(ScreenMode) \
+	visit(ScreenshotBurstInterval) \
+	visit(ScreenshotBurstLength) \
+	visit(ScreenshotCompression) \
+	visit(ScreenshotFormat) \
 	visit(SetSwapEffectUpgradeShim) \
+	visit(ShaderCacheSizeMB) \
 	visit(ShowerRoomFlashlightFix) \
 	visit(SmallFontHeight) \
 	visit(SmallFontWidth) \
 	visit(SpaceSize) \
+	visit(TextureCacheSizeMB) \
 	visit(water_spec_mult_apt_staircase) \
 	visit(water_spec_mult_strange_area) \
 	visit(water_spec_mult_labyrinth) \
@@ -305,6 +327,11 @@ typedef enum _FRONTBUFFERCONTROL {
 	BUFFER_FROM_DIRECTX = 2,
 } FRONTBUFFERCONTROL;
 
+typedef enum _SCREENSHOTFORMAT {
+	SCREENSHOT_PNG = 0,
+	SCREENSHOT_QOI = 1,
+} SCREENSHOTFORMAT;
+
 typedef enum _CRTSHADER {
 	CRT_SHADER_DISABLED = 0,
 	CRT_SHADER_ENABLED = 1,
@@ -0,0 +1,225 @@
+#include "ShaderCache.h"
+#include "Hash.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace {
+    constexpr uint32_t kEntryMagic   = 0x53324853;  // 'SH2S'
+    constexpr uint32_t kEntryVersion = 1;
+    constexpr wchar_t  kEntryExt[]   = L".cso";
+
+    struct EntryHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t key;
+        uint64_t checksum;      // Hash64 of the bytecode
+        uint32_t size;          // of the bytecode
+        uint32_t reserved;
+    };
+    static_assert(sizeof(EntryHeader) == 32);
+
+    bool ParseKey(const std::filesystem::path& file, uint64_t& key) {
+        const std::string stem = file.stem().string();
+        if (stem.size() != 16 || file.extension() != kEntryExt) {
+            return false;
+        }
+        char* end = nullptr;
+        key = std::strtoull(stem.c_str(), &end, 16);
+        return end == stem.c_str() + stem.size();
+    }
+}
+
+uint64_t ShaderCache::MakeKey(const void* source, size_t sourceSize, const char* entryPoint, const char* profile, uint32_t flags) {
+    uint64_t key = Hash64(source, sourceSize);
+    key = Hash64(entryPoint, std::strlen(entryPoint), key);
+    key = Hash64(profile, std::strlen(profile), key);
+    return Hash64(&flags, sizeof(flags), key);
+}
+
+bool ShaderCache::Load(uint64_t key, std::vector<uint8_t>& bytecode) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    ScanDirectory();
+
+    auto it = mLookup.find(key);
+    if (it == mLookup.end()) {
+        ++mStats.misses;
+        return false;
+    }
+
+    const std::filesystem::path path = GetEntryPath(key);
+    bool valid = false;
+    {
+        std::ifstream file(path, std::ios::binary);
+        EntryHeader header{};
+        if (file.read(reinterpret_cast<char*>(&header), sizeof(header)) &&
+            header.magic == kEntryMagic && header.version == kEntryVersion && header.key == key &&
+            sizeof(header) + header.size == it->second->size) {
+            bytecode.resize(header.size);
+            valid = file.read(reinterpret_cast<char*>(bytecode.data()), bytecode.size()) &&
+                    Hash64(bytecode.data(), bytecode.size()) == header.checksum;
+        }
+    }
+
+    // truncated, overwritten or written by another version, drop it so it gets compiled and stored again
+    if (!valid) {
+        bytecode.clear();
+        Remove(key);
+        ++mStats.corrupted;
+        ++mStats.misses;
+        return false;
+    }
+
+    // the write time is the recency used to order entries when the directory is scanned on the next run
+    std::error_code ec;
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+
+    mEntries.splice(mEntries.begin(), mEntries, it->second);
+    ++mStats.hits;
+    return true;
+}
+
+bool ShaderCache::Store(uint64_t key, const std::vector<uint8_t>& bytecode) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    ScanDirectory();
+
+    const size_t fileSize = sizeof(EntryHeader) + bytecode.size();
+    if (bytecode.empty() || bytecode.size() > UINT32_MAX || fileSize > mBudget) {
+        return false;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(mDirectory, ec);
+
+    // write to a temporary name first so a crash never leaves a truncated entry behind
+    const std::filesystem::path path = GetEntryPath(key);
+    std::filesystem::path tempFile = path;
+    tempFile += L".tmp";
+    {
+        std::ofstream file(tempFile, std::ios::binary | std::ios::trunc);
+        const EntryHeader header{ kEntryMagic, kEntryVersion, key, Hash64(bytecode.data(), bytecode.size()), static_cast<uint32_t>(bytecode.size()), 0 };
+        if (!file.write(reinterpret_cast<const char*>(&header), sizeof(header)) ||
+            !file.write(reinterpret_cast<const char*>(bytecode.data()), bytecode.size())) {
+            file.close();
+            std::filesystem::remove(tempFile, ec);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempFile, path, ec);
+    if (ec) {
+        std::filesystem::remove(tempFile, ec);
+        return false;
+    }
+
+    auto it = mLookup.find(key);
+    if (it != mLookup.end()) {
+        mStats.bytesOnDisk -= it->second->size;
+        mEntries.erase(it->second);
+    }
+    mEntries.push_front(Entry{ key, fileSize });
+    mLookup[key] = mEntries.begin();
+    mStats.bytesOnDisk += fileSize;
+    ++mStats.stores;
+    EvictToBudget();
+
+    return true;
+}
+
+void ShaderCache::SetBudget(size_t budgetBytes) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mBudget = budgetBytes;
+    if (mScanned) {
+        EvictToBudget();
+    }
+}
+
+void ShaderCache::Clear() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    ScanDirectory();
+
+    while (!mEntries.empty()) {
+        Remove(mEntries.back().key);
+    }
+}
+
+ShaderCache::Stats ShaderCache::GetStats() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mStats;
+}
+
+std::filesystem::path ShaderCache::GetEntryPath(uint64_t key) const {
+    char name[24];
+    std::snprintf(name, sizeof(name), "%016" PRIx64, key);
+    std::filesystem::path path = mDirectory / name;
+    path += kEntryExt;
+    return path;
+}
+
+// builds the index from the files left by previous runs, most recently used first
+void ShaderCache::ScanDirectory() {
+    if (mScanned) {
+        return;
+    }
+    mScanned = true;
+
+    struct Found {
+        std::filesystem::file_time_type time;
+        Entry                           entry;
+    };
+    std::vector<Found> found;
+
+    std::error_code ec;
+    for (std::filesystem::directory_iterator it(mDirectory, ec), end; !ec && it != end; it.increment(ec)) {
+        const std::filesystem::path& path = it->path();
+        uint64_t key = 0;
+        if (path.extension() == L".tmp") {
+            std::error_code removeEc;
+            std::filesystem::remove(path, removeEc);
+        } else if (ParseKey(path, key)) {
+            std::error_code sizeEc, timeEc;
+            const uintmax_t size = it->file_size(sizeEc);
+            const auto time = it->last_write_time(timeEc);
+            if (!sizeEc && !timeEc) {
+                found.push_back(Found{ time, Entry{ key, static_cast<size_t>(size) } });
+            }
+        }
+    }
+
+    std::sort(found.begin(), found.end(), [](const Found& a, const Found& b) {
+        return a.time > b.time;
+    });
+    for (const Found& f : found) {
+        mEntries.push_back(f.entry);
+        mLookup[f.entry.key] = std::prev(mEntries.end());
+        mStats.bytesOnDisk += f.entry.size;
+    }
+
+    EvictToBudget();
+}
+
+void ShaderCache::Remove(uint64_t key) {
+    auto it = mLookup.find(key);
+    if (it == mLookup.end()) {
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(GetEntryPath(key), ec);
+
+    mStats.bytesOnDisk -= it->second->size;
+    mEntries.erase(it->second);
+    mLookup.erase(it);
+    mStats.entries = mEntries.size();
+}
+
+void ShaderCache::EvictToBudget() {
+    while (mStats.bytesOnDisk > mBudget && !mEntries.empty()) {
+        Remove(mEntries.back().key);
+        ++mStats.evictions;
+    }
+    mStats.entries = mEntries.size();
+}
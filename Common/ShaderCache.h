@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// keeps compiled shader bytecode on disk so effects load without running the HLSL compiler again after a restart,
+// device reset or resolution change. entries are keyed by a hash of everything that goes into the compile, carry a
+// checksum of the bytecode and are evicted least recently used first once the files grow over the size budget
+class ShaderCache {
+public:
+    struct Stats {
+        uint64_t                hits = 0;
+        uint64_t                misses = 0;
+        uint64_t                stores = 0;
+        uint64_t                evictions = 0;
+        uint64_t                corrupted = 0;  // entries that failed the checksum and were deleted
+        size_t                  bytesOnDisk = 0;
+        size_t                  entries = 0;
+    };
+
+    // hash of the source, entry point, target profile and compiler flags
+    static uint64_t     MakeKey(const void* source, size_t sourceSize, const char* entryPoint, const char* profile, uint32_t flags);
+
+    ShaderCache(const std::filesystem::path& directory, size_t budgetBytes) : mDirectory(directory), mBudget(budgetBytes) {}
+
+    // fills bytecode from the cache, calling compile(std::vector<uint8_t>&) -> bool and storing the result on a miss
+    template <typename CompileFn>
+    bool Get(uint64_t key, std::vector<uint8_t>& bytecode, CompileFn&& compile) {
+        if (Load(key, bytecode)) {
+            return true;
+        }
+
+        bytecode.clear();
+        if (!compile(bytecode)) {
+            return false;
+        }
+        Store(key, bytecode);
+        return true;
+    }
+
+    bool                Load(uint64_t key, std::vector<uint8_t>& bytecode);
+    bool                Store(uint64_t key, const std::vector<uint8_t>& bytecode);
+
+    void                SetBudget(size_t budgetBytes);
+    // deletes every entry from disk
+    void                Clear();
+    Stats               GetStats() const;
+
+private:
+    struct Entry {
+        uint64_t        key;
+        size_t          size;           // whole file, header included
+    };
+    using EntryList = std::list<Entry>;
+
+    std::filesystem::path   GetEntryPath(uint64_t key) const;
+    void                    ScanDirectory();
+    void                    Remove(uint64_t key);
+    void                    EvictToBudget();
+
+    mutable std::mutex                                  mMutex;
+    std::filesystem::path                               mDirectory;
+    size_t                                              mBudget;
+    bool                                                mScanned = false;
+    EntryList                                           mEntries;   // most recently used first
+    std::unordered_map<uint64_t, EntryList::iterator>   mLookup;
+    Stats                                               mStats;
+};
@@ -0,0 +1,177 @@
+// checks ShaderCache against a stand-in compiler: key derivation, hits across restarts, failed compiles, corrupted
+// and leftover files and the least recently used eviction. nothing here touches D3D, so it builds and runs on Linux.
+//
+// usage: run from the repository root
+//   g++ -std=c++17 -O2 -I. -o ShaderCacheTest Common/ShaderCacheTest.cpp Common/ShaderCache.cpp
+//   ./ShaderCacheTest
+
+#include "Common/ShaderCache.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#define CHECK(condition) \
+    do { if (!(condition)) { std::printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); return 1; } } while (0)
+
+namespace fs = std::filesystem;
+
+// stands in for D3DCompile, the "bytecode" is the source and entry point padded with 200 bytes
+struct StandInCompiler {
+    int calls = 0;
+
+    bool Compile(const std::string& source, const char* entryPoint, std::vector<uint8_t>& code) {
+        ++calls;
+        code.assign(source.begin(), source.end());
+        code.insert(code.end(), entryPoint, entryPoint + std::strlen(entryPoint));
+        code.resize(code.size() + 200, 0xAB);
+        return true;
+    }
+};
+
+static const size_t kHeaderSize = 32;
+
+static uint64_t MakeKey(const std::string& source, const char* entryPoint, const char* profile, uint32_t flags) {
+    return ShaderCache::MakeKey(source.data(), source.size(), entryPoint, profile, flags);
+}
+
+int main() {
+    const fs::path directory = fs::temp_directory_path() / "ShaderCacheTest";
+    fs::remove_all(directory);
+
+    StandInCompiler compiler;
+    const std::string source = "float4 main() : COLOR { return 1; }";
+    const auto compile = [&](std::vector<uint8_t>& code) { return compiler.Compile(source, "PS", code); };
+
+    // the key covers every input of the compile
+    const uint64_t key = MakeKey(source, "PS", "ps_3_0", 1);
+    CHECK(key == MakeKey(source, "PS", "ps_3_0", 1));
+    CHECK(key != MakeKey(source + " ", "PS", "ps_3_0", 1));
+    CHECK(key != MakeKey(source, "VS", "ps_3_0", 1));
+    CHECK(key != MakeKey(source, "PS", "vs_3_0", 1));
+    CHECK(key != MakeKey(source, "PS", "ps_3_0", 2));
+    CHECK(MakeKey("ab", "c", "d", 0) != MakeKey("a", "bc", "d", 0));
+
+    std::vector<uint8_t> code, reference;
+
+    // the second request is a hit
+    {
+        ShaderCache cache(directory, 1 << 20);
+        CHECK(cache.Get(key, reference, compile));
+        CHECK(compiler.calls == 1);
+        CHECK(cache.Get(key, code, compile));
+        CHECK(compiler.calls == 1 && code == reference);
+        CHECK(cache.GetStats().hits == 1 && cache.GetStats().stores == 1);
+    }
+
+    // and so is the first one after a restart
+    {
+        ShaderCache cache(directory, 1 << 20);
+        code.clear();
+        CHECK(cache.Get(key, code, compile));
+        CHECK(compiler.calls == 1 && code == reference);
+        CHECK(cache.GetStats().entries == 1 && cache.GetStats().bytesOnDisk == reference.size() + kHeaderSize);
+    }
+
+    // failed compiles are not stored
+    {
+        ShaderCache cache(directory, 1 << 20);
+        CHECK(!cache.Get(key + 1, code, [&](std::vector<uint8_t>&) { ++compiler.calls; return false; }));
+        CHECK(cache.GetStats().entries == 1);
+    }
+
+    // a flipped bytecode byte, a truncated file and a wrong key in the header all compile again
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.cso", static_cast<unsigned long long>(key));
+    const fs::path file = directory / name;
+    for (int corruption = 0; corruption < 3; ++corruption) {
+        std::vector<char> bytes;
+        {
+            std::ifstream stream(file, std::ios::binary);
+            bytes.assign(std::istreambuf_iterator<char>(stream), {});
+        }
+        CHECK(bytes.size() == reference.size() + kHeaderSize);
+        switch (corruption) {
+            case 0: bytes[kHeaderSize + 8] ^= 1; break;
+            case 1: bytes.resize(bytes.size() - 7); break;
+            case 2: bytes[8] ^= 1; break;
+        }
+        {
+            std::ofstream stream(file, std::ios::binary | std::ios::trunc);
+            stream.write(bytes.data(), bytes.size());
+        }
+
+        ShaderCache cache(directory, 1 << 20);
+        const int calls = compiler.calls;
+        code.clear();
+        CHECK(cache.Get(key, code, compile));
+        CHECK(compiler.calls == calls + 1 && code == reference);
+        if (corruption != 1) {
+            CHECK(cache.GetStats().corrupted == 1);
+        }
+        CHECK(cache.GetStats().entries == 1);
+    }
+
+    // leftovers of an interrupted store are deleted, unrelated files are left alone
+    std::ofstream(directory / "0123456789abcdef.cso.tmp") << "x";
+    std::ofstream(directory / "readme.txt") << "x";
+    std::ofstream(directory / "zz.cso") << "x";
+    {
+        ShaderCache cache(directory, 1 << 20);
+        code.clear();
+        CHECK(cache.Load(key, code) && code == reference);
+        CHECK(!fs::exists(directory / "0123456789abcdef.cso.tmp") && fs::exists(directory / "readme.txt"));
+        CHECK(cache.GetStats().entries == 1);
+    }
+
+    // a budget with room for three entries evicts the least recently used one
+    fs::remove_all(directory);
+    const size_t entrySize = kHeaderSize + 300 + 2 + 200;
+    std::vector<uint64_t> keys;
+    {
+        ShaderCache cache(directory, entrySize * 3 + 10);
+        for (int i = 0; i < 4; ++i) {
+            const std::string entrySource(300, char('a' + i));
+            keys.push_back(MakeKey(entrySource, "PS", "ps_3_0", 0));
+            if (i == 3) {
+                // touch the first entry so the second one is the oldest
+                CHECK(cache.Load(keys[0], code));
+            }
+            CHECK(cache.Get(keys[i], code, [&](std::vector<uint8_t>& out) { return compiler.Compile(entrySource, "PS", out); }));
+            CHECK(code.size() + kHeaderSize == entrySize);
+            // file times are the recency across restarts, keep them apart
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+
+        const ShaderCache::Stats stats = cache.GetStats();
+        CHECK(stats.entries == 3 && stats.evictions == 1 && stats.bytesOnDisk == entrySize * 3);
+        CHECK(cache.Load(keys[0], code) && !cache.Load(keys[1], code) && cache.Load(keys[2], code) && cache.Load(keys[3], code));
+    }
+
+    // the recency survives a restart, after the loads above the first entry is the oldest
+    {
+        ShaderCache cache(directory, entrySize * 2 + 10);
+        CHECK(!cache.Load(keys[0], code));
+        CHECK(cache.Load(keys[2], code) && cache.Load(keys[3], code));
+        CHECK(cache.GetStats().evictions == 1);
+
+        // a smaller budget evicts right away and entries larger than the whole budget are never stored
+        cache.SetBudget(entrySize + 10);
+        CHECK(cache.GetStats().entries == 1 && cache.Load(keys[3], code));
+        cache.SetBudget(10);
+        CHECK(cache.GetStats().entries == 0 && !cache.Store(keys[3], code));
+        cache.SetBudget(1 << 20);
+        CHECK(cache.Store(keys[3], code));
+
+        cache.Clear();
+        CHECK(cache.GetStats().entries == 0 && fs::is_empty(directory));
+    }
+
+    fs::remove_all(directory);
+
+    std::printf("passed, %d compiles\n", compiler.calls);
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include "Skinning.h"
+
+#include <xmmintrin.h>
+#include <cstring>
+
+namespace {
+    // two loads straight into registers, going through a float[4] on the stack stalls on store forwarding
+    inline __m128 LoadVec3(const uint8_t* p) {
+        const __m128 xy = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(p));
+        const __m128 z = _mm_load_ss(reinterpret_cast<const float*>(p + 8));
+        return _mm_movelh_ps(xy, z);
+    }
+
+    inline void StoreVec3(uint8_t* p, __m128 v) {
+        _mm_storel_pi(reinterpret_cast<__m64*>(p), v);
+        _mm_store_ss(reinterpret_cast<float*>(p + 8), _mm_movehl_ps(v, v));
+    }
+
+    inline __m128 Transform(__m128 r0, __m128 r1, __m128 r2, __m128 v) {
+        const __m128 x = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+        const __m128 y = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+        const __m128 z = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+        return _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, r0), _mm_mul_ps(y, r1)), _mm_mul_ps(z, r2));
+    }
+}
+
+void Skinning::FromMatrix44(const float* m, Matrix4x3& out) {
+    for (int i = 0; i < 4; ++i) {
+        out.r[i][0] = m[i * 4 + 0];
+        out.r[i][1] = m[i * 4 + 1];
+        out.r[i][2] = m[i * 4 + 2];
+        out.r[i][3] = 0.0f;
+    }
+}
+
+void Skinning::Multiply(const Matrix4x3& a, const Matrix4x3& b, Matrix4x3& out) {
+    const __m128 b0 = _mm_load_ps(b.r[0]);
+    const __m128 b1 = _mm_load_ps(b.r[1]);
+    const __m128 b2 = _mm_load_ps(b.r[2]);
+
+    for (int i = 0; i < 3; ++i) {
+        _mm_store_ps(out.r[i], Transform(b0, b1, b2, _mm_load_ps(a.r[i])));
+    }
+    _mm_store_ps(out.r[3], _mm_add_ps(Transform(b0, b1, b2, _mm_load_ps(a.r[3])), _mm_load_ps(b.r[3])));
+}
+
+void Skinning::InverseTranspose3x3(const Matrix4x3& m, Matrix4x3& out) {
+    const float (*r)[4] = m.r;
+
+    // the inverse transpose is the cofactor matrix divided by the determinant
+    const float c00 = r[1][1] * r[2][2] - r[1][2] * r[2][1];
+    const float c01 = r[1][2] * r[2][0] - r[1][0] * r[2][2];
+    const float c02 = r[1][0] * r[2][1] - r[1][1] * r[2][0];
+    const float det = r[0][0] * c00 + r[0][1] * c01 + r[0][2] * c02;
+    const float invDet = (det != 0.0f) ? 1.0f / det : 0.0f;
+
+    out.r[0][0] = c00 * invDet;
+    out.r[0][1] = c01 * invDet;
+    out.r[0][2] = c02 * invDet;
+    out.r[1][0] = (r[0][2] * r[2][1] - r[0][1] * r[2][2]) * invDet;
+    out.r[1][1] = (r[0][0] * r[2][2] - r[0][2] * r[2][0]) * invDet;
+    out.r[1][2] = (r[0][1] * r[2][0] - r[0][0] * r[2][1]) * invDet;
+    out.r[2][0] = (r[0][1] * r[1][2] - r[0][2] * r[1][1]) * invDet;
+    out.r[2][1] = (r[0][2] * r[1][0] - r[0][0] * r[1][2]) * invDet;
+    out.r[2][2] = (r[0][0] * r[1][1] - r[0][1] * r[1][0]) * invDet;
+    out.r[0][3] = out.r[1][3] = out.r[2][3] = 0.0f;
+    std::memset(out.r[3], 0, sizeof(out.r[3]));
+}
+
+void Skinning::XFormVertices(const Matrix4x3& posXForm, const Matrix4x3& normalXForm, const uint8_t* src, uint8_t* dst, size_t stride, size_t count) {
+    const __m128 p0 = _mm_load_ps(posXForm.r[0]), p1 = _mm_load_ps(posXForm.r[1]), p2 = _mm_load_ps(posXForm.r[2]), p3 = _mm_load_ps(posXForm.r[3]);
+    const __m128 n0 = _mm_load_ps(normalXForm.r[0]), n1 = _mm_load_ps(normalXForm.r[1]), n2 = _mm_load_ps(normalXForm.r[2]);
+
+    for (size_t i = 0; i < count; ++i, src += stride, dst += stride) {
+        const __m128 pos = _mm_add_ps(Transform(p0, p1, p2, LoadVec3(src)), p3);
+        const __m128 normal = Transform(n0, n1, n2, LoadVec3(src + 12));
+        StoreVec3(dst, pos);
+        StoreVec3(dst + 12, normal);
+    }
+}
+
+void Skinning::SkinVertices(const Matrix4x3* jointPosXForms, const Matrix4x3* jointNormalXForms, const float* translation, const Influence* influences,
+                            const uint8_t* src, uint8_t* dst, size_t stride, size_t count) {
+    const __m128 t = _mm_load_ps(translation);
+
+    for (size_t i = 0; i < count; ++i, src += stride, dst += stride) {
+        const Influence& influence = influences[i];
+
+        // blend the weighted joint transforms, positions and normals have their own set
+        __m128 p0 = _mm_setzero_ps(), p1 = p0, p2 = p0, p3 = p0;
+        __m128 n0 = p0, n1 = p0, n2 = p0;
+        for (int k = 0; k < 4; ++k) {
+            if (influence.weights[k] > 0.0f) {
+                const __m128 w = _mm_set1_ps(influence.weights[k]);
+                const Matrix4x3& pm = jointPosXForms[influence.bones[k]];
+                const Matrix4x3& nm = jointNormalXForms[influence.bones[k]];
+                p0 = _mm_add_ps(p0, _mm_mul_ps(w, _mm_load_ps(pm.r[0])));
+                p1 = _mm_add_ps(p1, _mm_mul_ps(w, _mm_load_ps(pm.r[1])));
+                p2 = _mm_add_ps(p2, _mm_mul_ps(w, _mm_load_ps(pm.r[2])));
+                p3 = _mm_add_ps(p3, _mm_mul_ps(w, _mm_load_ps(pm.r[3])));
+                n0 = _mm_add_ps(n0, _mm_mul_ps(w, _mm_load_ps(nm.r[0])));
+                n1 = _mm_add_ps(n1, _mm_mul_ps(w, _mm_load_ps(nm.r[1])));
+                n2 = _mm_add_ps(n2, _mm_mul_ps(w, _mm_load_ps(nm.r[2])));
+            }
+        }
+
+        const __m128 pos = _mm_add_ps(_mm_add_ps(Transform(p0, p1, p2, LoadVec3(src)), p3), t);
+        const __m128 normal = Transform(n0, n1, n2, LoadVec3(src + 12));
+        StoreVec3(dst, pos);
+        StoreVec3(dst + 12, normal);
+    }
+}
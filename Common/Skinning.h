@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// CPU vertex transform and skinning kernels for ModelGLTF, vertices are interleaved with the position at offset 0
+// and the normal at offset 12 of each vertex
+namespace Skinning {
+    // affine transform for row vectors (v' = v * M) like D3DXMATRIX, rows 0-2 hold the 3x3 part and row 3 the
+    // translation, the fourth lane of every row is padding
+    struct alignas(16) Matrix4x3 {
+        float r[4][4];
+    };
+
+    // same layout as ModelGLTF::Vertex_Skin
+    struct Influence {
+        uint8_t bones[4];
+        float   weights[4];
+    };
+
+    // from the 16 floats of a D3DXMATRIX, the last column is assumed to be (0, 0, 0, 1)
+    void        FromMatrix44(const float* m, Matrix4x3& out);
+    // a then b, out may not alias either
+    void        Multiply(const Matrix4x3& a, const Matrix4x3& b, Matrix4x3& out);
+    // inverse transpose of the 3x3 part with a zero translation, for transforming normals
+    void        InverseTranspose3x3(const Matrix4x3& m, Matrix4x3& out);
+
+    // pos * posXForm and normal * normalXForm for every vertex
+    void        XFormVertices(const Matrix4x3& posXForm, const Matrix4x3& normalXForm, const uint8_t* src, uint8_t* dst, size_t stride, size_t count);
+
+    // blends up to four joint transforms per vertex, influences with a zero weight are skipped, translation (16 byte
+    // aligned) is added once after blending so weights that don't sum to exactly one can't scale it
+    void        SkinVertices(const Matrix4x3* jointPosXForms, const Matrix4x3* jointNormalXForms, const float* translation, const Influence* influences,
+                             const uint8_t* src, uint8_t* dst, size_t stride, size_t count);
+}
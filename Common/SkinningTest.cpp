@@ -0,0 +1,265 @@
+// checks the SSE kernels in Common/Skinning against a plain scalar version of the path ModelGLTF used before them:
+// blend the full 4x4 joint matrices per vertex, transform position and normal by the blend, then by node * global and
+// its 4x4 inverse transpose. random skeletons with translations around 5000 and weights quantized to 1/255 like the
+// glTF ones must stay within 1e-4 relative error, and the bytes after the normal (uv, color) must be left alone.
+// also prints the time of both per frame. nothing here touches D3D, so it builds and runs on Linux.
+//
+// usage: run from the repository root
+//   g++ -std=c++17 -O2 -I. -o SkinningTest Common/SkinningTest.cpp Common/Skinning.cpp
+//   ./SkinningTest
+
+#include "Common/Skinning.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#define CHECK(condition) \
+    do { if (!(condition)) { std::printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); return 1; } } while (0)
+
+namespace {
+    // row major like D3DXMATRIX, for row vectors
+    struct Matrix44 {
+        float m[16];
+    };
+
+    // same layout as ModelGLTF::Vertex_PNT
+    struct Vertex {
+        float pos[3];
+        float normal[3];
+        float uv[2];
+    };
+
+    constexpr int kNumJoints = 24;
+    constexpr int kNumVertices = 1200;
+
+    std::mt19937 gRandom(3);
+    std::uniform_real_distribution<float> gUnit(-1.0f, 1.0f);
+
+    Matrix44 Multiply(const Matrix44& a, const Matrix44& b) {
+        Matrix44 result;
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                float sum = 0.0f;
+                for (int k = 0; k < 4; ++k) {
+                    sum += a.m[i * 4 + k] * b.m[k * 4 + j];
+                }
+                result.m[i * 4 + j] = sum;
+            }
+        }
+        return result;
+    }
+
+    // gauss-jordan in double, stands in for D3DXMatrixInverse
+    Matrix44 Inverse(const Matrix44& a) {
+        double t[4][8];
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                t[i][j] = a.m[i * 4 + j];
+                t[i][j + 4] = (i == j) ? 1.0 : 0.0;
+            }
+        }
+        for (int c = 0; c < 4; ++c) {
+            int pivot = c;
+            for (int r = c + 1; r < 4; ++r) {
+                if (std::fabs(t[r][c]) > std::fabs(t[pivot][c])) {
+                    pivot = r;
+                }
+            }
+            std::swap(t[c], t[pivot]);
+            const double d = t[c][c];
+            for (int j = 0; j < 8; ++j) {
+                t[c][j] /= d;
+            }
+            for (int r = 0; r < 4; ++r) {
+                if (r != c) {
+                    const double f = t[r][c];
+                    for (int j = 0; j < 8; ++j) {
+                        t[r][j] -= f * t[c][j];
+                    }
+                }
+            }
+        }
+        Matrix44 result;
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                result.m[i * 4 + j] = static_cast<float>(t[i][j + 4]);
+            }
+        }
+        return result;
+    }
+
+    Matrix44 Transpose(const Matrix44& a) {
+        Matrix44 result;
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                result.m[i * 4 + j] = a.m[j * 4 + i];
+            }
+        }
+        return result;
+    }
+
+    void Transform(const float* v, const Matrix44& m, bool translate, float* out) {
+        for (int j = 0; j < 3; ++j) {
+            out[j] = v[0] * m.m[j] + v[1] * m.m[4 + j] + v[2] * m.m[8 + j] + (translate ? m.m[12 + j] : 0.0f);
+        }
+    }
+
+    // rotation and uniform scale, translation in [-translationScale, translationScale]
+    Matrix44 RandomAffine(float translationScale) {
+        const float ax = gUnit(gRandom) * 3.0f, ay = gUnit(gRandom) * 3.0f, s = 1.0f + 0.3f * gUnit(gRandom);
+        const float cx = std::cos(ax), sx = std::sin(ax), cy = std::cos(ay), sy = std::sin(ay);
+        const float r[9] = { cy, 0.0f, -sy, sx * sy, cx, sx * cy, cx * sy, -sx, cx * cy };
+        Matrix44 result = {};
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                result.m[i * 4 + j] = r[i * 3 + j] * s;
+            }
+        }
+        for (int j = 0; j < 3; ++j) {
+            result.m[12 + j] = gUnit(gRandom) * translationScale;
+        }
+        result.m[15] = 1.0f;
+        return result;
+    }
+
+    // the path the kernels replaced, joints are invBind * anim * inverse(node)
+    void ReferenceSkin(const Matrix44* joints, const Matrix44& full, const Skinning::Influence* influences, const Vertex* src, Vertex* dst) {
+        const Matrix44 fullInvTranspose = Transpose(Inverse(full));
+        for (int i = 0; i < kNumVertices; ++i) {
+            Matrix44 skin = {};
+            for (int k = 0; k < 4; ++k) {
+                if (influences[i].weights[k] > 0.0f) {
+                    for (int e = 0; e < 16; ++e) {
+                        skin.m[e] += joints[influences[i].bones[k]].m[e] * influences[i].weights[k];
+                    }
+                }
+            }
+            float pos[3], normal[3];
+            Transform(src[i].pos, skin, true, pos);
+            Transform(src[i].normal, skin, false, normal);
+            Transform(pos, full, true, dst[i].pos);
+            Transform(normal, fullInvTranspose, false, dst[i].normal);
+        }
+    }
+
+    // what ModelGLTF::Update does now: fold node * global into each joint, then one blend and transform per vertex
+    void KernelSkin(const Matrix44* joints, const Matrix44& full, const Skinning::Influence* influences, const Vertex* src, Vertex* dst,
+                    std::vector<Skinning::Matrix4x3>& jointPos, std::vector<Skinning::Matrix4x3>& jointNormal) {
+        Skinning::Matrix4x3 posXForm, normalXForm, linear, joint;
+        Skinning::FromMatrix44(full.m, posXForm);
+        Skinning::InverseTranspose3x3(posXForm, normalXForm);
+        linear = posXForm;
+        std::memset(linear.r[3], 0, sizeof(linear.r[3]));
+
+        for (int j = 0; j < kNumJoints; ++j) {
+            Skinning::FromMatrix44(joints[j].m, joint);
+            Skinning::Multiply(joint, linear, jointPos[j]);
+            Skinning::Multiply(joint, normalXForm, jointNormal[j]);
+        }
+        Skinning::SkinVertices(jointPos.data(), jointNormal.data(), posXForm.r[3], influences,
+                               reinterpret_cast<const uint8_t*>(src), reinterpret_cast<uint8_t*>(dst), sizeof(Vertex), kNumVertices);
+    }
+
+    double RelativeError(const float* a, const float* b) {
+        double result = 0.0;
+        for (int k = 0; k < 3; ++k) {
+            result = std::max(result, std::fabs(a[k] - b[k]) / std::max(1.0, static_cast<double>(std::fabs(a[k]))));
+        }
+        return result;
+    }
+}
+
+int main() {
+    std::vector<Matrix44> invBind(kNumJoints), anim(kNumJoints), joints(kNumJoints);
+    for (Matrix44& m : invBind) {
+        m = RandomAffine(2.0f);
+    }
+    const Matrix44 node = RandomAffine(1.0f);
+    const Matrix44 nodeInverse = Inverse(node);
+
+    // one to four influences, every other vertex with weights quantized to 1/255 so they don't sum to exactly one
+    std::vector<Vertex> src(kNumVertices);
+    std::vector<Skinning::Influence> influences(kNumVertices);
+    for (int i = 0; i < kNumVertices; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            src[i].pos[k] = gUnit(gRandom) * 3.0f;
+            src[i].normal[k] = gUnit(gRandom);
+        }
+        src[i].uv[0] = gUnit(gRandom);
+        src[i].uv[1] = gUnit(gRandom);
+
+        float weights[4], sum = 0.0f;
+        for (int k = 0; k < 4; ++k) {
+            weights[k] = (k <= i % 4) ? std::fabs(gUnit(gRandom)) + 0.05f : 0.0f;
+            sum += weights[k];
+        }
+        for (int k = 0; k < 4; ++k) {
+            influences[i].bones[k] = static_cast<uint8_t>(gRandom() % kNumJoints);
+            influences[i].weights[k] = (i % 2) ? std::round(weights[k] / sum * 255.0f) / 255.0f : weights[k] / sum;
+        }
+    }
+
+    std::vector<Vertex> expected(src), actual(src);
+    std::vector<Skinning::Matrix4x3> jointPos(kNumJoints), jointNormal(kNumJoints);
+    double maxPosError = 0.0, maxNormalError = 0.0;
+    for (int frame = 0; frame < 50; ++frame) {
+        for (int j = 0; j < kNumJoints; ++j) {
+            anim[j] = RandomAffine(3.0f);
+            joints[j] = Multiply(Multiply(invBind[j], anim[j]), nodeInverse);
+        }
+        const Matrix44 full = Multiply(node, RandomAffine(5000.0f));
+
+        ReferenceSkin(joints.data(), full, influences.data(), src.data(), expected.data());
+        KernelSkin(joints.data(), full, influences.data(), src.data(), actual.data(), jointPos, jointNormal);
+        for (int i = 0; i < kNumVertices; ++i) {
+            maxPosError = std::max(maxPosError, RelativeError(expected[i].pos, actual[i].pos));
+            maxNormalError = std::max(maxNormalError, RelativeError(expected[i].normal, actual[i].normal));
+            CHECK(!std::memcmp(actual[i].uv, src[i].uv, sizeof(src[i].uv)));
+        }
+
+        // unskinned meshes only go through node * global
+        Skinning::Matrix4x3 posXForm, normalXForm;
+        Skinning::FromMatrix44(full.m, posXForm);
+        Skinning::InverseTranspose3x3(posXForm, normalXForm);
+        Skinning::XFormVertices(posXForm, normalXForm, reinterpret_cast<const uint8_t*>(src.data()), reinterpret_cast<uint8_t*>(actual.data()), sizeof(Vertex), kNumVertices);
+        const Matrix44 fullInvTranspose = Transpose(Inverse(full));
+        for (int i = 0; i < kNumVertices; ++i) {
+            float pos[3], normal[3];
+            Transform(src[i].pos, full, true, pos);
+            Transform(src[i].normal, fullInvTranspose, false, normal);
+            maxPosError = std::max(maxPosError, RelativeError(pos, actual[i].pos));
+            maxNormalError = std::max(maxNormalError, RelativeError(normal, actual[i].normal));
+            CHECK(!std::memcmp(actual[i].uv, src[i].uv, sizeof(src[i].uv)));
+        }
+    }
+    std::printf("max relative error: position %.2e, normal %.2e\n", maxPosError, maxNormalError);
+    CHECK(maxPosError < 1e-4 && maxNormalError < 1e-4);
+
+    // one Update per instance, like CockroachesReplacement
+    const Matrix44 full = Multiply(node, RandomAffine(5000.0f));
+    for (const int instances : { 1, 8, 16, 32 }) {
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int run = 0; run < 20; ++run) {
+            for (int n = 0; n < instances; ++n) {
+                ReferenceSkin(joints.data(), full, influences.data(), src.data(), expected.data());
+            }
+        }
+        const auto t1 = std::chrono::steady_clock::now();
+        for (int run = 0; run < 20; ++run) {
+            for (int n = 0; n < instances; ++n) {
+                KernelSkin(joints.data(), full, influences.data(), src.data(), actual.data(), jointPos, jointNormal);
+            }
+        }
+        const auto t2 = std::chrono::steady_clock::now();
+        std::printf("%2d instances x %d vertices: scalar %.3f ms, sse %.3f ms per frame\n", instances, kNumVertices,
+                    std::chrono::duration<double, std::milli>(t1 - t0).count() / 20, std::chrono::duration<double, std::milli>(t2 - t1).count() / 20);
+    }
+
+    std::printf("all Skinning checks passed\n");
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include "TextureCache.h"
+
+void TextureCache::SetBudget(size_t budgetBytes) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mBudget = budgetBytes;
+    EvictToBudget();
+}
+
+void TextureCache::Clear() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mEntries.clear();
+    mLookup.clear();
+    mStats.bytesResident = 0;
+    mStats.entries = 0;
+}
+
+TextureCache::Stats TextureCache::GetStats() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mStats;
+}
+
+TextureCache::ImagePtr TextureCache::Find(const std::wstring& path, uint64_t timestamp) {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto it = mLookup.find(path);
+    if (it == mLookup.end()) {
+        ++mStats.misses;
+        return nullptr;
+    }
+
+    // the file changed on disk, drop the stale copy
+    if (it->second->timestamp != timestamp) {
+        mStats.bytesResident -= it->second->image->data.size();
+        mEntries.erase(it->second);
+        mLookup.erase(it);
+        mStats.entries = mEntries.size();
+        ++mStats.misses;
+        return nullptr;
+    }
+
+    mEntries.splice(mEntries.begin(), mEntries, it->second);
+    ++mStats.hits;
+    mStats.bytesSaved += it->second->image->data.size();
+    return it->second->image;
+}
+
+TextureCache::ImagePtr TextureCache::Insert(const std::wstring& path, uint64_t timestamp, ImagePtr image) {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    // images bigger than the whole budget are handed out but never kept
+    if (image->data.size() > mBudget) {
+        return image;
+    }
+
+    // another thread may have loaded the same file in the meantime
+    auto it = mLookup.find(path);
+    if (it != mLookup.end()) {
+        mStats.bytesResident -= it->second->image->data.size();
+        mEntries.erase(it->second);
+        mLookup.erase(it);
+    }
+
+    mEntries.push_front(Entry{ path, timestamp, image });
+    mLookup[path] = mEntries.begin();
+    mStats.bytesResident += image->data.size();
+    EvictToBudget();
+    mStats.entries = mEntries.size();
+
+    return image;
+}
+
+void TextureCache::EvictToBudget() {
+    while (mStats.bytesResident > mBudget && !mEntries.empty()) {
+        const Entry& last = mEntries.back();
+        mStats.bytesResident -= last.image->data.size();
+        mLookup.erase(last.path);
+        mEntries.pop_back();
+        ++mStats.evictions;
+    }
+    mStats.entries = mEntries.size();
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// keeps decoded textures in system memory so recreating them after a device reset or room change doesn't touch the disk,
+// entries are keyed by path and file timestamp and evicted least recently used first once over the memory budget
+class TextureCache {
+public:
+    struct Image {
+        uint32_t                width = 0;
+        uint32_t                height = 0;
+        uint32_t                numMips = 0;
+        uint32_t                format = 0;     // D3DFORMAT
+        std::vector<uint8_t>    data;
+    };
+
+    struct Stats {
+        uint64_t                hits = 0;
+        uint64_t                misses = 0;
+        uint64_t                evictions = 0;
+        uint64_t                bytesSaved = 0; // decoded bytes served from memory instead of being loaded again
+        size_t                  bytesResident = 0;
+        size_t                  entries = 0;
+    };
+
+    using ImagePtr = std::shared_ptr<const Image>;
+
+    explicit TextureCache(size_t budgetBytes) : mBudget(budgetBytes) {}
+
+    // returns the cached image for path, calling load(Image&) -> bool to fill it on a miss
+    template <typename LoadFn>
+    ImagePtr Get(const std::wstring& path, uint64_t timestamp, LoadFn&& load) {
+        if (ImagePtr image = Find(path, timestamp)) {
+            return image;
+        }
+
+        auto image = std::make_shared<Image>();
+        if (!load(*image)) {
+            return nullptr;
+        }
+        return Insert(path, timestamp, std::move(image));
+    }
+
+    void                SetBudget(size_t budgetBytes);
+    void                Clear();
+    Stats               GetStats() const;
+
+private:
+    struct Entry {
+        std::wstring    path;
+        uint64_t        timestamp;
+        ImagePtr        image;
+    };
+    using EntryList = std::list<Entry>;
+
+    ImagePtr            Find(const std::wstring& path, uint64_t timestamp);
+    ImagePtr            Insert(const std::wstring& path, uint64_t timestamp, ImagePtr image);
+    void                EvictToBudget();
+
+    mutable std::mutex                                      mMutex;
+    size_t                                                  mBudget;
+    EntryList                                               mEntries;   // most recently used first
+    std::unordered_map<std::wstring, EntryList::iterator>   mLookup;
+    Stats                                                   mStats;
+};
@@ -0,0 +1,135 @@
+// checks TextureCache the way GfxUtils uses it across device resets: a texture recreated with the same timestamp is
+// served from memory, a newer timestamp loads it again, the least recently used entries go first once over the budget,
+// images bigger than the budget and failed loads are never kept, and concurrent Get calls keep the stats consistent.
+// nothing here touches D3D, so it builds and runs on Linux.
+//
+// usage: run from the repository root
+//   g++ -std=c++17 -O2 -pthread -I. -o TextureCacheTest Common/TextureCacheTest.cpp Common/TextureCache.cpp
+//   ./TextureCacheTest
+
+#include "Common/TextureCache.h"
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define CHECK(condition) \
+    do { if (!(condition)) { std::printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); return 1; } } while (0)
+
+static int gLoads = 0;
+
+// stands in for the decode in GfxUtils, the size of the image is all the cache looks at
+static TextureCache::ImagePtr Load(TextureCache& cache, const std::wstring& path, uint64_t timestamp, size_t size) {
+    return cache.Get(path, timestamp, [&](TextureCache::Image& image) {
+        ++gLoads;
+        image.width = static_cast<uint32_t>(size / 4);
+        image.height = 1;
+        image.numMips = 1;
+        image.data.assign(size, static_cast<uint8_t>(timestamp));
+        return true;
+    });
+}
+
+int main() {
+    // a reset recreates every texture with the same file timestamps, only the first round loads anything
+    {
+        TextureCache cache(1000);
+        for (int round = 0; round < 4; ++round) {
+            CHECK(Load(cache, L"a.png", 1, 100) && Load(cache, L"b.png", 1, 200) && Load(cache, L"c.dds", 1, 300));
+        }
+        const TextureCache::Stats stats = cache.GetStats();
+        CHECK(gLoads == 3);
+        CHECK(stats.misses == 3 && stats.hits == 9 && stats.evictions == 0);
+        CHECK(stats.bytesSaved == 3 * 600 && stats.bytesResident == 600 && stats.entries == 3);
+
+        // a replaced file is loaded again and its old copy dropped
+        const TextureCache::ImagePtr replaced = Load(cache, L"b.png", 2, 250);
+        CHECK(gLoads == 4 && replaced->data.size() == 250 && replaced->data[0] == 2);
+        CHECK(cache.GetStats().bytesResident == 650 && cache.GetStats().entries == 3);
+        CHECK(Load(cache, L"b.png", 2, 250) == replaced && gLoads == 4);
+
+        cache.Clear();
+        CHECK(cache.GetStats().bytesResident == 0 && cache.GetStats().entries == 0);
+        Load(cache, L"a.png", 1, 100);
+        CHECK(gLoads == 5);
+    }
+
+    // least recently used first: touching a keeps it, b is the one to go when d does not fit
+    {
+        gLoads = 0;
+        TextureCache cache(300);
+        Load(cache, L"a", 1, 100);
+        Load(cache, L"b", 1, 100);
+        Load(cache, L"c", 1, 100);
+        Load(cache, L"a", 1, 100);
+        Load(cache, L"d", 1, 100);
+        CHECK(gLoads == 4 && cache.GetStats().evictions == 1 && cache.GetStats().bytesResident == 300);
+        Load(cache, L"a", 1, 100);
+        Load(cache, L"c", 1, 100);
+        Load(cache, L"d", 1, 100);
+        CHECK(gLoads == 4);
+        Load(cache, L"b", 1, 100);
+        CHECK(gLoads == 5 && cache.GetStats().evictions == 2);
+
+        // shrinking the budget evicts right away
+        cache.SetBudget(150);
+        CHECK(cache.GetStats().entries == 1 && cache.GetStats().bytesResident == 100);
+        cache.SetBudget(0);
+        CHECK(cache.GetStats().entries == 0 && cache.GetStats().bytesResident == 0);
+    }
+
+    // an image bigger than the budget is handed out but never kept, a failed load is not cached either
+    {
+        gLoads = 0;
+        TextureCache cache(100);
+        Load(cache, L"a", 1, 60);
+        const TextureCache::ImagePtr big = Load(cache, L"big", 1, 500);
+        CHECK(big && big->data.size() == 500);
+        CHECK(cache.GetStats().entries == 1 && cache.GetStats().bytesResident == 60 && cache.GetStats().evictions == 0);
+        Load(cache, L"big", 1, 500);
+        CHECK(gLoads == 3);
+
+        int failedLoads = 0;
+        for (int i = 0; i < 2; ++i) {
+            CHECK(!cache.Get(L"missing", 1, [&](TextureCache::Image&) { ++failedLoads; return false; }));
+        }
+        CHECK(failedLoads == 2 && cache.GetStats().entries == 1);
+    }
+
+    // loader threads and the render thread share one cache, more files than fit keep it evicting while every Get is a
+    // hit or a miss and the budget holds
+    {
+        TextureCache cache(64 * 100);
+        std::atomic<int> failures{ 0 };
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 8; ++t) {
+            threads.emplace_back([&cache, &failures, t]() {
+                for (int i = 0; i < 20000; ++i) {
+                    const int file = (i * 7 + t * 13) % 96;
+                    const TextureCache::ImagePtr image = cache.Get(std::to_wstring(file), 1 + file % 3, [file](TextureCache::Image& decoded) {
+                        decoded.data.assign(100, static_cast<uint8_t>(file));
+                        return true;
+                    });
+                    if (!image || image->data.size() != 100 || image->data[0] != static_cast<uint8_t>(file)) {
+                        ++failures;
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        const TextureCache::Stats stats = cache.GetStats();
+        CHECK(failures == 0);
+        CHECK(stats.hits + stats.misses == 8 * 20000);
+        CHECK(stats.bytesResident <= 64 * 100 && stats.bytesResident == stats.entries * 100);
+        std::printf("threads: %llu hits, %llu misses, %llu evictions\n", static_cast<unsigned long long>(stats.hits),
+                    static_cast<unsigned long long>(stats.misses), static_cast<unsigned long long>(stats.evictions));
+    }
+
+    std::printf("all TextureCache checks passed\n");
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include "TextureLoader.h"
+
+#include <algorithm>
+
+TextureLoader::TextureLoader(uint32_t numWorkers) {
+    for (uint32_t i = 0; i < (std::max)(numWorkers, 1u); ++i) {
+        mWorkers.emplace_back(&TextureLoader::WorkerThread, this);
+    }
+}
+
+TextureLoader::~TextureLoader() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+        mQueued.clear();
+    }
+    mWake.notify_all();
+
+    for (std::thread& worker : mWorkers) {
+        worker.join();
+    }
+}
+
+bool TextureLoader::HigherPriority(const Job& a, const Job& b) {
+    return a.priority != b.priority ? a.priority > b.priority : a.id < b.id;
+}
+
+TextureLoader::JobId TextureLoader::Enqueue(DecodeFn decode, UploadFn upload, int priority, uint32_t group) {
+    JobId id;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        id = mNextId++;
+        mQueued.push_back(Job{ id, priority, group, std::move(decode), std::move(upload), nullptr, false });
+    }
+    mWake.notify_one();
+    return id;
+}
+
+bool TextureLoader::Cancel(JobId id) {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    const auto byId = [id](const Job& job) { return job.id == id; };
+    if (auto it = std::find_if(mQueued.begin(), mQueued.end(), byId); it != mQueued.end()) {
+        mQueued.erase(it);
+        return true;
+    }
+    if (auto it = std::find_if(mFinished.begin(), mFinished.end(), byId); it != mFinished.end()) {
+        mFinished.erase(it);
+        return true;
+    }
+    // a worker is decoding it, the result is thrown away when it finishes
+    for (Job* job : mInFlight) {
+        if (job->id == id && !job->cancelled) {
+            job->cancelled = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t TextureLoader::CancelGroup(uint32_t group) {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    const auto inGroup = [group](const Job& job) { return job.group == group; };
+    size_t result = mQueued.size() + mFinished.size();
+    mQueued.erase(std::remove_if(mQueued.begin(), mQueued.end(), inGroup), mQueued.end());
+    mFinished.erase(std::remove_if(mFinished.begin(), mFinished.end(), inGroup), mFinished.end());
+    result -= mQueued.size() + mFinished.size();
+
+    for (Job* job : mInFlight) {
+        if (job->group == group && !job->cancelled) {
+            job->cancelled = true;
+            ++result;
+        }
+    }
+    return result;
+}
+
+size_t TextureLoader::Pump(size_t maxUploads) {
+    std::vector<Job> ready;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mFinished.empty()) {
+            return 0;
+        }
+
+        std::sort(mFinished.begin(), mFinished.end(), HigherPriority);
+        const size_t count = (std::min)(maxUploads, mFinished.size());
+        ready.assign(std::make_move_iterator(mFinished.begin()), std::make_move_iterator(mFinished.begin() + count));
+        mFinished.erase(mFinished.begin(), mFinished.begin() + count);
+    }
+
+    // callbacks may enqueue or cancel jobs, so run them without holding the lock
+    for (Job& job : ready) {
+        job.upload(job.image);
+    }
+    return ready.size();
+}
+
+size_t TextureLoader::GetPendingCount() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mQueued.size() + mInFlight.size() + mFinished.size();
+}
+
+void TextureLoader::WorkerThread() {
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true) {
+        mWake.wait(lock, [this] { return mStop || !mQueued.empty(); });
+        if (mStop) {
+            return;
+        }
+
+        auto next = std::min_element(mQueued.begin(), mQueued.end(), HigherPriority);
+        Job job = std::move(*next);
+        mQueued.erase(next);
+        mInFlight.push_back(&job);
+
+        lock.unlock();
+        job.image = job.decode();
+        lock.lock();
+
+        mInFlight.erase(std::find(mInFlight.begin(), mInFlight.end(), &job));
+        if (!job.cancelled && !mStop) {
+            mFinished.push_back(std::move(job));
+        }
+    }
+}
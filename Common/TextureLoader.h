@@ -0,0 +1,58 @@
+#pragma once
+
+#include "TextureCache.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// reads and decodes images on worker threads, finished jobs are handed back to the render thread through Pump,
+// which runs their upload callbacks so the device is only ever touched from that thread
+class TextureLoader {
+public:
+    using JobId = uint64_t;
+    using DecodeFn = std::function<TextureCache::ImagePtr()>;               // worker thread, nullptr on failure
+    using UploadFn = std::function<void(const TextureCache::ImagePtr&)>;    // render thread, not called for cancelled jobs
+
+    explicit TextureLoader(uint32_t numWorkers);
+    ~TextureLoader();
+
+    TextureLoader(const TextureLoader&) = delete;
+    TextureLoader& operator=(const TextureLoader&) = delete;
+
+    // higher priorities are decoded and uploaded first, jobs of the same priority in submission order
+    JobId           Enqueue(DecodeFn decode, UploadFn upload, int priority = 0, uint32_t group = 0);
+    bool            Cancel(JobId id);
+    // drops every job of the group whether it is queued, decoding or waiting for upload
+    size_t          CancelGroup(uint32_t group);
+
+    // render thread: runs up to maxUploads upload callbacks of finished jobs
+    size_t          Pump(size_t maxUploads = SIZE_MAX);
+    size_t          GetPendingCount() const;
+
+private:
+    struct Job {
+        JobId                   id;
+        int                     priority;
+        uint32_t                group;
+        DecodeFn                decode;
+        UploadFn                upload;
+        TextureCache::ImagePtr  image;
+        bool                    cancelled;
+    };
+
+    void            WorkerThread();
+    static bool     HigherPriority(const Job& a, const Job& b);
+
+    mutable std::mutex          mMutex;
+    std::condition_variable     mWake;
+    bool                        mStop = false;
+    JobId                       mNextId = 1;
+    std::vector<Job>            mQueued;
+    std::vector<Job*>           mInFlight;
+    std::vector<Job>            mFinished;
+    std::vector<std::thread>    mWorkers;
+};
@@ -0,0 +1,185 @@
+// checks TextureLoader the way GfxUtils drives it: uploads run only from Pump and in priority order, a cancelled job
+// never reaches its upload callback whether it was queued, decoding or finished, room groups are dropped together,
+// and a stress run with several workers uploads every job that was not cancelled exactly once.
+// nothing here touches D3D, so it builds and runs on Linux.
+//
+// usage: run from the repository root
+//   g++ -std=c++17 -O2 -pthread -I. -o TextureLoaderTest Common/TextureLoaderTest.cpp Common/TextureLoader.cpp Common/TextureCache.cpp
+//   ./TextureLoaderTest
+
+#include "Common/TextureLoader.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <random>
+#include <thread>
+#include <vector>
+
+#define CHECK(condition) \
+    do { if (!(condition)) { std::printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); return 1; } } while (0)
+
+static TextureCache::ImagePtr MakeImage(uint32_t tag) {
+    auto image = std::make_shared<TextureCache::Image>();
+    image->width = tag;
+    return image;
+}
+
+// the worker only hands a job over to Pump once its decode has returned, give it time for that
+static void WaitForDecodes(const std::atomic<int>& decodes, int count) {
+    while (decodes < count) {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+}
+
+// the render thread side: pumps until nothing is pending any more
+static void PumpAll(TextureLoader& loader) {
+    while (loader.GetPendingCount() != 0) {
+        loader.Pump();
+        std::this_thread::yield();
+    }
+    loader.Pump();
+}
+
+int main() {
+    // with the only worker held on a first job, the rest queue up and are decoded and uploaded by priority
+    {
+        TextureLoader loader(1);
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+        std::promise<void> started;
+        std::vector<uint32_t> decoded, uploaded;
+
+        loader.Enqueue([&]() { started.set_value(); released.wait(); return MakeImage(100); },
+                       [&](const TextureCache::ImagePtr& image) { uploaded.push_back(image->width); }, 0);
+        started.get_future().wait();
+
+        const int priorities[] = { 0, 2, 1, 2, 0 };
+        for (uint32_t i = 0; i < 5; ++i) {
+            loader.Enqueue([&decoded, i]() { decoded.push_back(i); return MakeImage(i); },
+                           [&uploaded](const TextureCache::ImagePtr& image) { uploaded.push_back(image->width); }, priorities[i]);
+        }
+        CHECK(loader.GetPendingCount() == 6);
+        CHECK(loader.Pump() == 0 && uploaded.empty());
+
+        release.set_value();
+        PumpAll(loader);
+        CHECK((decoded == std::vector<uint32_t>{ 1, 3, 2, 0, 4 }));
+        CHECK(uploaded.size() == 6);
+    }
+
+    // finished jobs wait for Pump, which uploads the highest priority first and at most maxUploads per call
+    {
+        TextureLoader loader(2);
+        std::atomic<int> decodes{ 0 };
+        std::vector<uint32_t> uploaded;
+        for (uint32_t i = 0; i < 6; ++i) {
+            loader.Enqueue([&decodes, i]() { ++decodes; return MakeImage(i); },
+                           [&uploaded](const TextureCache::ImagePtr& image) { uploaded.push_back(image->width); }, i % 3);
+        }
+        WaitForDecodes(decodes, 6);
+        CHECK(loader.GetPendingCount() == 6);
+        CHECK(loader.Pump(4) == 4);
+        CHECK((uploaded == std::vector<uint32_t>{ 2, 5, 1, 4 }));
+        CHECK(loader.Pump(4) == 2);
+        CHECK((uploaded == std::vector<uint32_t>{ 2, 5, 1, 4, 0, 3 }));
+        CHECK(loader.GetPendingCount() == 0);
+    }
+
+    // a failed decode still reaches its callback, with no image
+    {
+        TextureLoader loader(1);
+        int failures = 0;
+        loader.Enqueue([]() { return TextureCache::ImagePtr(); }, [&](const TextureCache::ImagePtr& image) { failures += image ? 0 : 1; });
+        PumpAll(loader);
+        CHECK(failures == 1);
+    }
+
+    // cancelled while queued, while decoding and once finished: none of them is uploaded
+    {
+        TextureLoader loader(1);
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+        std::promise<void> started;
+        int uploads = 0;
+        const auto upload = [&uploads](const TextureCache::ImagePtr&) { ++uploads; };
+
+        const TextureLoader::JobId decoding = loader.Enqueue([&]() { started.set_value(); released.wait(); return MakeImage(0); }, upload);
+        started.get_future().wait();
+        const TextureLoader::JobId queued = loader.Enqueue([]() { return MakeImage(1); }, upload);
+        CHECK(loader.Cancel(queued));
+        CHECK(!loader.Cancel(queued));
+        CHECK(loader.Cancel(decoding));
+        CHECK(!loader.Cancel(decoding));
+        release.set_value();
+        PumpAll(loader);
+        CHECK(uploads == 0);
+
+        std::atomic<int> decodes{ 0 };
+        const TextureLoader::JobId finished = loader.Enqueue([&decodes]() { ++decodes; return MakeImage(2); }, upload);
+        WaitForDecodes(decodes, 1);
+        CHECK(loader.Cancel(finished));
+        CHECK(loader.GetPendingCount() == 0);
+        CHECK(loader.Pump() == 0 && uploads == 0);
+        CHECK(!loader.Cancel(12345));
+    }
+
+    // leaving a room drops its loads in every state, other groups go on
+    {
+        TextureLoader loader(1);
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+        std::promise<void> started;
+        std::vector<uint32_t> uploaded;
+        const auto upload = [&uploaded](const TextureCache::ImagePtr& image) { uploaded.push_back(image->width); };
+
+        std::atomic<int> decodes{ 0 };
+        loader.Enqueue([&decodes]() { ++decodes; return MakeImage(10); }, upload, 5, 7);
+        WaitForDecodes(decodes, 1);
+        loader.Enqueue([&]() { started.set_value(); released.wait(); return MakeImage(11); }, upload, 5, 7);
+        started.get_future().wait();
+        loader.Enqueue([]() { return MakeImage(12); }, upload, 0, 7);
+        loader.Enqueue([]() { return MakeImage(20); }, upload, 0, 8);
+
+        CHECK(loader.CancelGroup(7) == 3);
+        CHECK(loader.CancelGroup(7) == 0);
+        release.set_value();
+        PumpAll(loader);
+        CHECK((uploaded == std::vector<uint32_t>{ 20 }));
+    }
+
+    // stress: four workers, random priorities and groups, cancels from the render thread while it pumps
+    {
+        TextureLoader loader(4);
+        const uint32_t numJobs = 5000;
+        std::vector<int> uploads(numJobs, 0);
+        std::vector<bool> cancelled(numJobs, false);
+        std::vector<TextureLoader::JobId> ids(numJobs);
+        std::mt19937 random(1);
+
+        for (uint32_t i = 0; i < numJobs; ++i) {
+            ids[i] = loader.Enqueue([i]() { return MakeImage(i); }, [&uploads](const TextureCache::ImagePtr& image) { ++uploads[image->width]; },
+                                    static_cast<int>(random() % 4), i % 8);
+            if (random() % 4 == 0) {
+                const uint32_t victim = random() % (i + 1);
+                cancelled[victim] = loader.Cancel(ids[victim]) || cancelled[victim];
+            }
+            if (i % 64 == 0) {
+                loader.Pump(4);
+            }
+        }
+        PumpAll(loader);
+
+        size_t uploaded = 0;
+        for (uint32_t i = 0; i < numJobs; ++i) {
+            CHECK(uploads[i] == (cancelled[i] ? 0 : 1));
+            uploaded += uploads[i];
+        }
+        std::printf("stress: %zu of %u jobs uploaded, the rest cancelled\n", uploaded, numJobs);
+    }
+
+    std::printf("all TextureLoader checks passed\n");
+    return 0;
+}
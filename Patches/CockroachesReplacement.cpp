@@ -79,6 +79,11 @@ static ModelGLTF* GetOrCreateModel(IDirect3DDevice8* device) {
         if (!gCocroachesModel->LoadFromFile(gModelPath.u8string(), device)) {
             delete gCocroachesModel;
             gCocroachesModel = nullptr;
+        } else {
+            // every bug draws the same model, so bugs landing on the same animation sample share its skinning
+            gCocroachesModel->EnablePoseCache(CockroachesPoseFPS);
+            Logging::LogDebug() << __FUNCTION__ << " Cockroach pose cache: " << gCocroachesModel->GetNumPoseSamples() << " samples at " << CockroachesPoseFPS << " fps, up to " <<
+                (gCocroachesModel->GetNumPoseSamples() * gCocroachesModel->GetNumCPUVertices() * gCocroachesModel->GetVertexSize()) / 1024 << " KB";
         }
     }
 
@@ -63,6 +63,11 @@ int ChangeMasterVolume = 0;
 // Control options
 ButtonIcons ButtonIconsRef;
 bool ControlOptionsInitFlag = false;
+bool ControlOptionsTextHidden = false;
+BYTE* FunctionDrawControllerValues = nullptr;
+BYTE* FunctionDrawDashes = nullptr;
+BYTE DrawControllerValuesBytes[5] = {};
+BYTE DrawDashesBytes[5] = {};
 
 const float ControlOptionRedGreen = 0.502f;
 const float ControlOptionSelectedBlue = 0.8785f;
@@ -597,6 +602,51 @@ bool IsInControlOptionsMenu()
     return IsInOptionsMenu() && GetOptionsPage() == 0x04;
 }
 
+// Skips the game's text for the bound buttons while the icons are drawn in its place, and brings it back otherwise
+void HideControllerValuesText(bool Hide)
+{
+    if (Hide == ControlOptionsTextHidden)
+    {
+        return;
+    }
+
+    if (!ControlOptionsInitFlag)
+    {
+        FunctionDrawControllerValues =  (BYTE*)(GameVersion == SH2V_10 ? 0x00467985 :
+                                                GameVersion == SH2V_11 ? 0x00467C2D :
+                                                GameVersion == SH2V_DC ? 0x00467E3D : NULL);
+        FunctionDrawDashes =    (BYTE*)(GameVersion == SH2V_10 ? 0x00467606 :
+                                        GameVersion == SH2V_11 ? 0x004678A6 :
+                                        GameVersion == SH2V_DC ? 0x00467AB6 : NULL);
+
+        if (!FunctionDrawControllerValues || !FunctionDrawDashes || *FunctionDrawControllerValues != 0xE8 || *FunctionDrawDashes != 0xE8)
+        {
+            // Icons would be drawn over the text, so keep the text only
+            ReplaceButtonText = BUTTON_ICONS_DISABLED;
+            Logging::Log() << __FUNCTION__ " Error: failed to find memory address!";
+            return;
+        }
+
+        memcpy(DrawControllerValuesBytes, FunctionDrawControllerValues, sizeof(DrawControllerValuesBytes));
+        memcpy(DrawDashesBytes, FunctionDrawDashes, sizeof(DrawDashesBytes));
+
+        ControlOptionsInitFlag = true;
+    }
+
+    if (Hide)
+    {
+        UpdateMemoryAddress(FunctionDrawControllerValues, "\x90\x90\x90\x90\x90", 0x05);
+        UpdateMemoryAddress(FunctionDrawDashes, "\x90\x90\x90\x90\x90", 0x05);
+    }
+    else
+    {
+        UpdateMemoryAddress(FunctionDrawControllerValues, DrawControllerValuesBytes, sizeof(DrawControllerValuesBytes));
+        UpdateMemoryAddress(FunctionDrawDashes, DrawDashesBytes, sizeof(DrawDashesBytes));
+    }
+
+    ControlOptionsTextHidden = Hide;
+}
+
 void ButtonIcons::DrawIcons(LPDIRECT3DDEVICE8 ProxyInterface)
 {
     if (!IsInControlOptionsMenu() || !ProxyInterface || ReplaceButtonText == BUTTON_ICONS_DISABLED)
@@ -611,7 +661,14 @@ void ButtonIcons::DrawIcons(LPDIRECT3DDEVICE8 ProxyInterface)
 
     if (ButtonIconsTexture == NULL)
     {
+        // Still loading in the background
+        if (ButtonIconsLoadId)
+        {
+            return;
+        }
+
         ReplaceButtonText = BUTTON_ICONS_DISABLED;
+        HideControllerValuesText(false);
         Logging::Log() << __FUNCTION__ << " ERROR: Couldn't load button icons texture.";
         return;
     }
@@ -757,6 +814,15 @@ void ButtonIcons::HandleControllerIcons(LPDIRECT3DDEVICE8 ProxyInterface)
             ButtonIconsTexture = NULL;
         }
 
+        // The texture is loaded again next time, show the game's text until it is ready
+        HideControllerValuesText(false);
+
+        if (ButtonIconsLoadId)
+        {
+            GfxCancelTextureLoad(ButtonIconsLoadId);
+            ButtonIconsLoadId = 0;
+        }
+
         return;
     }
 
@@ -783,7 +849,7 @@ void ButtonIcons::Init(LPDIRECT3DDEVICE8 ProxyInterface)
         }
     }
 
-    if (ButtonIconsTexture == NULL)
+    if (ButtonIconsTexture == NULL && !ButtonIconsLoadId)
     {
         char TexturePath[MAX_PATH];
         strcpy_s(TexturePath, MAX_PATH, "data\\pic\\etc\\");
@@ -795,35 +861,30 @@ void ButtonIcons::Init(LPDIRECT3DDEVICE8 ProxyInterface)
         wchar_t FinalPath[MAX_PATH];
         mbstowcs(FinalPath, FinalPathChars, strlen(FinalPathChars) + 1);
 
-        HRESULT hr = GfxCreateTextureFromFileW(ProxyInterface, (LPCWSTR)FinalPath, &ButtonIconsTexture, 0);
+        // Decode on a loader thread, the icons are drawn once the texture has been uploaded
+        ButtonIconsLoadId = GfxLoadTextureFromFileAsync(ProxyInterface, (LPCWSTR)FinalPath, 0, 1, false, [this](HRESULT hr, LPDIRECT3DTEXTURE8 Texture)
+            {
+                ButtonIconsLoadId = 0;
 
-        if (FAILED(hr))
-        {
-            ReplaceButtonText = BUTTON_ICONS_DISABLED;
-            Logging::Log() << __FUNCTION__ << " ERROR: Couldn't create texture: " << Logging::hex(hr);
-            return;
-        }
-    }
+                if (FAILED(hr))
+                {
+                    ReplaceButtonText = BUTTON_ICONS_DISABLED;
+                    Logging::Log() << "ButtonIcons::Init ERROR: Couldn't create texture: " << Logging::hex(hr);
+                    return;
+                }
 
-    if (!ControlOptionsInitFlag)
-    {
-        DWORD FunctionDrawControllerValues =    GameVersion == SH2V_10 ? 0x00467985 :
-                                                GameVersion == SH2V_11 ? 0x00467C2D :
-                                                GameVersion == SH2V_DC ? 0x00467E3D : NULL;
-        DWORD FunctionDrawDashes =  GameVersion == SH2V_10 ? 0x00467606 :
-                                    GameVersion == SH2V_11 ? 0x004678A6 :
-                                    GameVersion == SH2V_DC ? 0x00467AB6 : NULL;
+                ButtonIconsTexture = Texture;
 
-        if (*(BYTE*)FunctionDrawControllerValues != 0xE8 || *(BYTE*)FunctionDrawDashes != 0xE8)
+                // The game's text stays until now, so the menu is never left without either
+                HideControllerValuesText(true);
+            });
+
+        if (!ButtonIconsLoadId)
         {
-            Logging::Log() << __FUNCTION__ " Error: failed to find memory address!";
+            ReplaceButtonText = BUTTON_ICONS_DISABLED;
+            Logging::Log() << __FUNCTION__ << " ERROR: Couldn't queue texture load!";
             return;
         }
-
-        UpdateMemoryAddress((BYTE*)FunctionDrawControllerValues, "\x90\x90\x90\x90\x90", 0x05);
-        UpdateMemoryAddress((BYTE*)FunctionDrawDashes, "\x90\x90\x90\x90\x90", 0x05);
-
-        ControlOptionsInitFlag = true;
     }
 
     this->LastBufferHeight = BufferHeight;
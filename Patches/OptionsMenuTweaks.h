@@ -281,6 +281,7 @@ private:
 	int BindsNum = BUTTONS_NUM;
 
 	LPDIRECT3DTEXTURE8  ButtonIconsTexture = NULL;
+	uint64_t ButtonIconsLoadId = 0;
 	DWORD ModulationPixelShader = NULL;
 
 	float GetUStartingValue()
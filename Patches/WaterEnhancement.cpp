@@ -243,14 +243,14 @@ void WaterEnhancedReleaseScreenCopy() {
 
 static void LoadWaterUtilityTextures(LPDIRECT3DDEVICE8 Device) {
     if (!g_DuDvTexture) {
-        HRESULT hr = GfxCreateTextureFromFileInMem(Device, DuDv_128x128_data, sizeof(DuDv_128x128_data), &g_DuDvTexture);
+        HRESULT hr = GfxCreateTextureFromRaw(Device, DuDv_128x128, &g_DuDvTexture);
         if (FAILED(hr)) {
             g_DuDvTexture = nullptr;
         }
     }
 
     if (!g_CausticsTexture) {
-        HRESULT hr = GfxCreateTextureFromFileInMem(Device, Caustics_128x128_data, sizeof(Caustics_128x128_data), &g_CausticsTexture);
+        HRESULT hr = GfxCreateTextureFromRaw(Device, Caustics_128x128, &g_CausticsTexture);
         if (FAILED(hr)) {
             g_CausticsTexture = nullptr;
         }
@@ -1,1613 +1,2738 @@
-/* caustics128.png (8/16/2024 5:14:38 PM)
-   StartOffset(h): 00000000, EndOffset(h): 00004B5E, Length(h): 00004B5F */
+/* caustics128.png, baked by Resources/Textures/BakeTexture.py, do not edit
+   128x128 A8R8G8B8, 8 mips */
 
-unsigned char Caustics_128x128_data[19295] = {
-	0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D,
-	0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
-	0x08, 0x02, 0x00, 0x00, 0x00, 0x4C, 0x5C, 0xF6, 0x9C, 0x00, 0x00, 0x20,
-	0x00, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0x8D, 0xBD, 0x57, 0x73, 0x9C,
-	0xE9, 0x75, 0x2D, 0xDC, 0xE1, 0x7D, 0x3B, 0xE7, 0xDC, 0x0D, 0xA0, 0x91,
-	0x41, 0x00, 0x24, 0xC0, 0x30, 0xE4, 0x0C, 0x29, 0x92, 0x25, 0x52, 0xC1,
-	0xD6, 0xCC, 0xA8, 0x64, 0xCB, 0x17, 0xB6, 0xCB, 0xE1, 0xA8, 0xA4, 0x2A,
-	0x97, 0xAB, 0x2C, 0xFB, 0x07, 0xF8, 0x27, 0xF8, 0xC6, 0xF7, 0xDF, 0xF1,
-	0xBD, 0xCB, 0x65, 0x5D, 0xB8, 0x74, 0x3E, 0xA5, 0x91, 0x2C, 0x59, 0x13,
-	0xA8, 0x19, 0x92, 0x43, 0x72, 0x86, 0x09, 0x24, 0x32, 0xD0, 0x68, 0x74,
-	0xCE, 0x39, 0x9F, 0x8B, 0xD5, 0xB3, 0xB8, 0xF5, 0x36, 0x47, 0x75, 0xFA,
-	0x82, 0x85, 0xC1, 0x34, 0xDE, 0xF0, 0x3C, 0xFB, 0xD9, 0x61, 0xED, 0xB5,
-	0xF7, 0xD6, 0x6F, 0x6E, 0x6E, 0xD6, 0x6A, 0xB5, 0x4E, 0xA7, 0xD3, 0xEF,
-	0xF7, 0x47, 0xA3, 0x91, 0x4E, 0xA7, 0x1B, 0x0E, 0x87, 0x3A, 0x9D, 0xCE,
-	0x60, 0x30, 0x28, 0x8A, 0xA2, 0xAA, 0xAA, 0xC5, 0x62, 0xB1, 0xDB, 0xED,
-	0x76, 0xBB, 0x3D, 0x1C, 0x0E, 0x4F, 0x4F, 0x4F, 0xDB, 0xED, 0xF6, 0x7E,
-	0xBF, 0xDF, 0x6E, 0xB7, 0x3B, 0x9D, 0xCE, 0x70, 0x38, 0x54, 0x14, 0xC5,
-	0x62, 0xB1, 0xB8, 0x5C, 0xAE, 0x76, 0xBB, 0x9D, 0xCB, 0xE5, 0x4A, 0xA5,
-	0x52, 0xB5, 0x5A, 0xED, 0x74, 0x3A, 0xBD, 0x5E, 0xCF, 0x60, 0x30, 0x98,
-	0xCD, 0x66, 0xAF, 0xC7, 0x3B, 0x13, 0x9F, 0x59, 0x5C, 0x5C, 0xD4, 0xE9,
-	0x74, 0xE5, 0x72, 0xB9, 0x5E, 0xAF, 0x67, 0xB3, 0xD9, 0x64, 0x32, 0x59,
-	0x2E, 0x97, 0xDB, 0xED, 0x76, 0xB7, 0xDB, 0xED, 0x76, 0xBB, 0xBD, 0x5E,
-	0x8F, 0x77, 0x37, 0x18, 0x0C, 0x26, 0x93, 0xC9, 0x6C, 0x36, 0xDB, 0xED,
-	0x76, 0xBF, 0xDF, 0xBF, 0x30, 0xBF, 0x70, 0xF5, 0xDA, 0xD5, 0xEF, 0x7C,
-	0xE7, 0x3B, 0x81, 0x40, 0xA0, 0xDF, 0xEF, 0xE7, 0x72, 0xB9, 0x7A, 0xBD,
-	0xEE, 0xF1, 0x78, 0x7C, 0x5E, 0x9F, 0x5E, 0xAF, 0x1F, 0x0C, 0x07, 0x0F,
-	0x1F, 0x3E, 0xFC, 0xDD, 0xEF, 0x7E, 0xB7, 0xB5, 0xB5, 0x75, 0x7A, 0x7A,
-	0x5A, 0x28, 0x14, 0x9A, 0xCD, 0x66, 0xAF, 0xD7, 0xD3, 0xEB, 0xF5, 0x46,
-	0xA3, 0xD1, 0x62, 0xB1, 0x78, 0xBD, 0xDE, 0xE9, 0xE9, 0xE9, 0x6B, 0xD7,
-	0xAE, 0x5D, 0xBF, 0x7E, 0xBD, 0x56, 0xAB, 0xBD, 0x78, 0xF1, 0x62, 0x7F,
-	0x7F, 0x3F, 0x99, 0x4C, 0x66, 0x32, 0x99, 0x6A, 0xB5, 0x5A, 0xAF, 0xD7,
-	0x87, 0xC3, 0xA1, 0x5E, 0xAF, 0x57, 0x55, 0xD5, 0x6E, 0xB7, 0x07, 0x83,
-	0xC1, 0xA9, 0xA9, 0xA9, 0xE5, 0xE5, 0xE5, 0xD5, 0xD5, 0xD5, 0xB9, 0xB9,
-	0x39, 0xBF, 0xDF, 0x6F, 0x34, 0x1A, 0x93, 0x27, 0xC9, 0x44, 0x32, 0x91,
-	0x49, 0x67, 0x8E, 0x8E, 0x8E, 0xB6, 0xB6, 0xB6, 0x8E, 0x8E, 0x8E, 0xB2,
-	0xD9, 0x6C, 0xBD, 0x5E, 0xC7, 0x8D, 0xF8, 0xCC, 0x3A, 0x9D, 0x0E, 0xAF,
-	0xA3, 0xD7, 0xEB, 0x75, 0xAF, 0xFB, 0x28, 0x8A, 0xE2, 0x74, 0x3A, 0x03,
-	0x81, 0xC0, 0xC6, 0xC6, 0xC6, 0x5F, 0xFF, 0xF5, 0x5F, 0xCF, 0xCE, 0xCE,
-	0xFE, 0xF4, 0xA7, 0x3F, 0xFD, 0xE0, 0x83, 0x0F, 0x94, 0x42, 0xA1, 0xD0,
-	0xED, 0x76, 0xFB, 0xFD, 0x3E, 0x96, 0x00, 0x7F, 0xAF, 0xD7, 0xEB, 0x4D,
-	0x26, 0xD3, 0x70, 0x38, 0xC4, 0x6B, 0xD8, 0xED, 0xF6, 0xD9, 0xD9, 0xD9,
-	0x48, 0x24, 0xD2, 0xED, 0x76, 0x8F, 0x8E, 0x8E, 0x5A, 0xAD, 0xD6, 0x70,
-	0x38, 0x1C, 0x8D, 0x46, 0xD8, 0x24, 0xB3, 0xD9, 0x5C, 0x2A, 0x95, 0x5A,
-	0xAD, 0x56, 0xBD, 0x5E, 0x6F, 0x34, 0x1A, 0x9D, 0x4E, 0xA7, 0xDB, 0xED,
-	0xE2, 0x6F, 0x0D, 0x06, 0x43, 0xBB, 0xD3, 0x6E, 0xB7, 0xDB, 0x5E, 0xAF,
-	0xF7, 0xDB, 0xDF, 0xFE, 0xB6, 0xD1, 0x68, 0x7C, 0xFF, 0xFD, 0xF7, 0xDF,
-	0x7F, 0xFF, 0xFD, 0x46, 0xA3, 0xA1, 0xD7, 0xEB, 0x9B, 0xCD, 0x66, 0xA7,
-	0xD3, 0xC1, 0xDE, 0xF7, 0xFB, 0x7D, 0x6C, 0xBC, 0xA2, 0x28, 0xD8, 0x03,
-	0xEC, 0xBA, 0x6A, 0x52, 0x75, 0x3A, 0x5D, 0x2E, 0x97, 0xCB, 0xE5, 0x72,
-	0xE5, 0x72, 0xB9, 0xD1, 0x68, 0x34, 0x9B, 0xCD, 0x7E, 0xBF, 0x8F, 0x97,
-	0x1F, 0x8D, 0x46, 0xC3, 0xE1, 0x50, 0x55, 0xD5, 0x70, 0x38, 0xAC, 0xD3,
-	0xE9, 0xCC, 0x66, 0x73, 0xA3, 0xD1, 0xC0, 0x2A, 0x58, 0x2C, 0x16, 0xA7,
-	0xD3, 0x39, 0x3D, 0x33, 0x7D, 0x66, 0xE5, 0xCC, 0xE6, 0xF9, 0xCD, 0xA9,
-	0xA9, 0xA9, 0x4E, 0xA7, 0x73, 0x74, 0x74, 0xD4, 0xEB, 0xF5, 0x5A, 0xAD,
-	0x56, 0xBB, 0xDD, 0x6E, 0xB5, 0x5A, 0xDD, 0x6E, 0x97, 0xAF, 0xDC, 0xE9,
-	0x74, 0x6A, 0xB5, 0x5A, 0x3E, 0x9F, 0xF7, 0x7A, 0xBD, 0xED, 0x76, 0xDB,
-	0xE3, 0xF1, 0x38, 0x9D, 0xCE, 0x7A, 0xBD, 0xAE, 0x37, 0xE8, 0x3B, 0xED,
-	0x4E, 0x32, 0x99, 0xDC, 0xDD, 0xDD, 0xCD, 0xE5, 0x72, 0x58, 0xF7, 0xC1,
-	0x60, 0x80, 0xA7, 0xC5, 0x07, 0x4B, 0xA1, 0xFB, 0xF2, 0xCF, 0x68, 0x34,
-	0x32, 0x1A, 0x8D, 0x36, 0x9B, 0xCD, 0xE3, 0xF1, 0xBC, 0xF9, 0xE6, 0x9B,
-	0x4B, 0x4B, 0x4B, 0x9F, 0x7C, 0xF2, 0xC9, 0x9D, 0x3B, 0x77, 0x4E, 0x4E,
-	0x4E, 0x94, 0x56, 0xAB, 0x85, 0x2B, 0x62, 0x33, 0x75, 0x3A, 0x1D, 0x16,
-	0x0E, 0x42, 0xA4, 0x28, 0x8A, 0xDD, 0x61, 0x9F, 0x9B, 0x9B, 0xF3, 0xF9,
-	0x7D, 0xE9, 0x74, 0xBA, 0x50, 0x28, 0xB4, 0xDB, 0xED, 0xC1, 0x60, 0xA0,
-	0xD7, 0xEB, 0x0D, 0x06, 0x83, 0xAA, 0xAA, 0x26, 0x93, 0xA9, 0xDD, 0x6E,
-	0x0F, 0x87, 0x43, 0xBC, 0x4F, 0xBB, 0xDD, 0xE6, 0xD2, 0xE8, 0x74, 0xBA,
-	0xC1, 0x17, 0x9F, 0x54, 0x2A, 0x75, 0xF7, 0xEE, 0xDD, 0x78, 0x3C, 0x3E,
-	0x35, 0x35, 0xB5, 0xBA, 0xBA, 0xAA, 0xD3, 0xE9, 0x72, 0xD9, 0x5C, 0xBD,
-	0x51, 0xC7, 0x09, 0xE0, 0x1E, 0x60, 0x39, 0xB0, 0xFD, 0x4E, 0xA7, 0xD3,
-	0xE9, 0x74, 0xDA, 0xED, 0x76, 0xBD, 0x5E, 0x7F, 0xEF, 0xDE, 0xBD, 0x4C,
-	0x26, 0x53, 0xA9, 0x54, 0xEA, 0xF5, 0x3A, 0x6E, 0x81, 0x67, 0xD6, 0x8D,
-	0x74, 0x7A, 0x83, 0x1E, 0x0F, 0xA3, 0xD7, 0xE9, 0x6D, 0x36, 0x9B, 0xC5,
-	0x62, 0xC1, 0xB9, 0x34, 0x9B, 0xCD, 0x16, 0x8B, 0xC5, 0xA8, 0x37, 0x1E,
-	0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xFF, 0xCA, 0xF2, 0x2B, 0x8F, 0xC7, 0x53,
-	0x2A, 0x95, 0xB2, 0xD9, 0x6C, 0xA3, 0xD1, 0xC0, 0x7E, 0xF3, 0xC4, 0x0F,
-	0x87, 0xC3, 0x7E, 0xBF, 0xDF, 0x6A, 0xB5, 0x9A, 0xCD, 0x66, 0x36, 0x9B,
-	0xDD, 0xDA, 0xDA, 0xC2, 0xB1, 0xC8, 0x64, 0x32, 0xF9, 0x7C, 0x3E, 0x97,
-	0xCB, 0xE1, 0xDD, 0xB9, 0x56, 0xC3, 0xE1, 0xD0, 0x60, 0x30, 0x60, 0x0F,
-	0xB8, 0x6E, 0x06, 0x83, 0xC1, 0x68, 0x34, 0xCA, 0x8D, 0xE1, 0xEA, 0xAB,
-	0xAA, 0x6A, 0x36, 0x9B, 0xCD, 0x66, 0x73, 0x34, 0x1A, 0x7D, 0xF3, 0xCD,
-	0x37, 0xBB, 0xDD, 0xEE, 0xFD, 0xFB, 0xF7, 0xD3, 0xE9, 0x74, 0xBD, 0x5E,
-	0x57, 0xE4, 0xF1, 0xE7, 0xF1, 0xC1, 0x42, 0x40, 0x88, 0xA2, 0xE1, 0xA8,
-	0xD3, 0xE5, 0x4C, 0x24, 0x12, 0xF9, 0x5C, 0x1E, 0xD2, 0x87, 0x87, 0x53,
-	0x14, 0x65, 0x38, 0x1C, 0x42, 0x81, 0x0C, 0x06, 0x03, 0xAC, 0x20, 0x36,
-	0x12, 0xE7, 0xDA, 0x60, 0x30, 0xE0, 0xE7, 0x42, 0xA1, 0xF0, 0xE9, 0xA7,
-	0x9F, 0x3E, 0x7E, 0xFC, 0xD8, 0xE1, 0x70, 0xC4, 0xE3, 0xF1, 0x58, 0x2C,
-	0xB6, 0xB9, 0xB9, 0x59, 0x2A, 0x95, 0xF2, 0xF9, 0x3C, 0x24, 0xB1, 0xD3,
-	0xE9, 0xE0, 0xFC, 0x52, 0x14, 0x4C, 0x26, 0x93, 0xC5, 0x62, 0x71, 0xBB,
-	0xDD, 0x4E, 0xA7, 0xB3, 0xD9, 0x6A, 0xA6, 0x4E, 0x53, 0x85, 0x42, 0x01,
-	0x4A, 0x03, 0x1B, 0xD0, 0xED, 0x76, 0x07, 0xFD, 0xC1, 0x60, 0x38, 0xC0,
-	0xD3, 0xE2, 0x81, 0x8D, 0x46, 0xA3, 0xAA, 0xAA, 0x46, 0xA3, 0xD1, 0x68,
-	0x34, 0xE2, 0x01, 0xB0, 0x4C, 0xF8, 0x4F, 0xB3, 0xD9, 0xEC, 0xF5, 0x7A,
-	0x07, 0x83, 0x01, 0x75, 0x82, 0xA2, 0x28, 0x78, 0x42, 0xBC, 0xFE, 0x68,
-	0x34, 0xEA, 0x74, 0x3A, 0x95, 0x4A, 0x25, 0x9B, 0xCD, 0x76, 0xBB, 0xDD,
-	0xC1, 0x60, 0xD0, 0x6C, 0x36, 0x71, 0xE6, 0xA8, 0x57, 0x29, 0x7C, 0xF8,
-	0x17, 0xCB, 0x0D, 0xA1, 0xC1, 0x06, 0x50, 0xF8, 0xF8, 0x81, 0xA4, 0x5A,
-	0xAD, 0x56, 0x97, 0xCB, 0xB5, 0xB2, 0xB2, 0x72, 0xFE, 0xFC, 0xF9, 0x5F,
-	0xFF, 0xFA, 0xD7, 0x89, 0x44, 0x02, 0x2F, 0xAE, 0xE0, 0x4B, 0x5C, 0x7A,
-	0x5C, 0x0B, 0xA2, 0x6D, 0xB5, 0x5A, 0x83, 0xC1, 0x60, 0x30, 0x14, 0xCC,
-	0x66, 0xB3, 0xD9, 0x4C, 0xB6, 0xD9, 0x6C, 0xE2, 0xB1, 0x14, 0x45, 0xD1,
-	0xEB, 0xF5, 0xD0, 0x33, 0xDC, 0x30, 0x2A, 0x04, 0xAC, 0x05, 0x5E, 0x5E,
-	0xA7, 0xD3, 0xD5, 0xEB, 0xF5, 0x52, 0xA9, 0xA4, 0xD7, 0xEB, 0x15, 0x45,
-	0xB1, 0xDB, 0xED, 0xE9, 0x74, 0xDA, 0xEF, 0xF7, 0xCF, 0xCF, 0xCF, 0xAF,
-	0xAD, 0xAD, 0x5D, 0xBD, 0x7A, 0x75, 0x30, 0x18, 0xE4, 0xF3, 0xF9, 0x64,
-	0x32, 0x99, 0x4E, 0xA7, 0x1B, 0x8D, 0x06, 0xAE, 0x00, 0x1D, 0x02, 0xEB,
-	0x62, 0xB1, 0x58, 0x3A, 0xED, 0x4E, 0xA5, 0x52, 0x29, 0x97, 0xCB, 0xB5,
-	0x6A, 0xAD, 0xDE, 0xA8, 0xC3, 0xFC, 0x40, 0x6D, 0xCA, 0x83, 0x8B, 0x27,
-	0xC7, 0xF1, 0xC5, 0x47, 0x2F, 0x3E, 0x78, 0x98, 0x5C, 0x2E, 0x67, 0xB3,
-	0xD9, 0x70, 0x38, 0xF0, 0x27, 0xD0, 0x42, 0xF8, 0xF2, 0x68, 0x34, 0xEA,
-	0xF7, 0xFB, 0xDD, 0x6E, 0xB7, 0x56, 0xAB, 0xB5, 0xDB, 0x6D, 0x5C, 0xBF,
-	0xDB, 0xEB, 0x76, 0x3B, 0x5D, 0x88, 0x14, 0x36, 0xD8, 0x6C, 0x36, 0xE3,
-	0x1D, 0xF1, 0x85, 0x7E, 0xBF, 0x0F, 0x51, 0xC3, 0xEA, 0xE3, 0x48, 0x71,
-	0x1B, 0xB0, 0x2B, 0x16, 0x8B, 0xC5, 0x66, 0xB3, 0x79, 0xBD, 0xDE, 0x8B,
-	0x17, 0x2F, 0x5A, 0xAD, 0xD6, 0x9D, 0x9D, 0x9D, 0x7A, 0xBD, 0x8E, 0x53,
-	0xA8, 0xE0, 0x39, 0xE4, 0xB7, 0x71, 0x0F, 0xBB, 0xDD, 0xEE, 0xF3, 0xF9,
-	0x66, 0x67, 0x67, 0x7B, 0xBD, 0x5E, 0xB1, 0x50, 0x84, 0xDE, 0xEC, 0xF7,
-	0xFB, 0x46, 0xA3, 0x71, 0x30, 0x18, 0xF0, 0xDC, 0xC8, 0x97, 0xE4, 0xD1,
-	0xC1, 0x45, 0x14, 0x45, 0x19, 0x0C, 0x06, 0x50, 0x2F, 0xF8, 0x25, 0xB4,
-	0x0D, 0xA4, 0xBE, 0xD7, 0xEB, 0x85, 0xC3, 0xE1, 0x1B, 0x37, 0x6E, 0xF4,
-	0xFB, 0xFD, 0xDF, 0xFE, 0xF6, 0xB7, 0x95, 0x4A, 0x05, 0xD7, 0x77, 0x38,
-	0x1C, 0x36, 0x9B, 0x6D, 0x34, 0x1A, 0xC1, 0x8C, 0x63, 0x71, 0xA1, 0x22,
-	0x3A, 0xDD, 0x0E, 0xFE, 0x1C, 0xC7, 0x05, 0x67, 0x8E, 0x4A, 0x00, 0x0F,
-	0xC0, 0xA5, 0xE7, 0x0F, 0x52, 0x18, 0x71, 0x38, 0x2C, 0x16, 0x8B, 0xD9,
-	0x6C, 0x56, 0x55, 0x55, 0x55, 0x55, 0x48, 0x31, 0xBE, 0x0F, 0xF3, 0x33,
-	0xE8, 0x0F, 0x5A, 0xAD, 0x16, 0xAE, 0x8C, 0x83, 0xA2, 0x1B, 0xE9, 0x46,
-	0xA3, 0x11, 0x74, 0x29, 0xBE, 0x8C, 0xDB, 0xE1, 0x05, 0xA5, 0x36, 0xC3,
-	0xEB, 0xE3, 0x3B, 0xDC, 0x33, 0x93, 0xC9, 0x64, 0xB3, 0xD9, 0xDC, 0x6E,
-	0xF7, 0xEC, 0xEC, 0xEC, 0xE5, 0x37, 0x2E, 0xE7, 0xF3, 0xF9, 0xD3, 0xD3,
-	0x53, 0x8A, 0x8E, 0x62, 0xB1, 0x58, 0x68, 0xCD, 0x4D, 0x26, 0x13, 0xFF,
-	0xC0, 0xE3, 0xF1, 0xCC, 0xCD, 0xCD, 0x45, 0x22, 0x91, 0x9D, 0x9D, 0x1D,
-	0xDC, 0x18, 0x8A, 0x0F, 0xE7, 0x14, 0x9B, 0x4F, 0x59, 0xA3, 0xDC, 0xE1,
-	0x07, 0xB3, 0xD9, 0x6C, 0x32, 0x99, 0x4C, 0x26, 0x13, 0x54, 0xBC, 0x3C,
-	0x1C, 0x58, 0x14, 0x55, 0x55, 0x53, 0xA9, 0xD4, 0xD6, 0xD6, 0x56, 0x2C,
-	0x16, 0x0B, 0x87, 0xC3, 0x3E, 0x9F, 0xCF, 0x6C, 0x36, 0xC3, 0x90, 0x74,
-	0x3A, 0x1D, 0xA3, 0xD1, 0x18, 0x08, 0x04, 0xB0, 0xD6, 0xFD, 0x7E, 0xDF,
-	0x64, 0x32, 0x41, 0x7D, 0xE3, 0xCD, 0xF1, 0x24, 0xD8, 0x5A, 0x8D, 0x31,
-	0xE4, 0x12, 0xF3, 0x40, 0x70, 0x51, 0xB8, 0x13, 0x06, 0x83, 0xA1, 0xD5,
-	0x6A, 0xE1, 0x69, 0x71, 0xD0, 0xF1, 0x2F, 0x9E, 0xDC, 0x68, 0x34, 0xEA,
-	0xF4, 0xBA, 0xC1, 0x60, 0x80, 0xE7, 0x57, 0x14, 0x05, 0x57, 0x18, 0x0E,
-	0x87, 0x70, 0x0A, 0xEA, 0xF5, 0x7A, 0xBD, 0x5E, 0xB7, 0x58, 0x2C, 0x94,
-	0x48, 0x1C, 0x1A, 0x6C, 0x18, 0x44, 0x99, 0x02, 0x01, 0x63, 0x06, 0xE5,
-	0x33, 0x35, 0x35, 0x75, 0xF5, 0xEA, 0xD5, 0x85, 0xC5, 0x85, 0x0F, 0x3E,
-	0xF8, 0xA0, 0x5A, 0xAD, 0x62, 0x29, 0x54, 0x55, 0x55, 0x70, 0x6F, 0x3C,
-	0x1F, 0x7E, 0xC6, 0xEA, 0x87, 0xC3, 0xE1, 0x8D, 0x8D, 0x0D, 0x87, 0xC3,
-	0xB1, 0xBF, 0xBF, 0xAF, 0x28, 0x0A, 0x36, 0x86, 0x0E, 0x28, 0x36, 0x90,
-	0x52, 0x83, 0xFB, 0x41, 0xF0, 0xB1, 0x7F, 0xF0, 0x9D, 0xAA, 0xD5, 0x6A,
-	0x7F, 0xD0, 0x97, 0x47, 0x92, 0xCB, 0x37, 0x1C, 0x0E, 0x8B, 0xC5, 0xE2,
-	0x2F, 0x7E, 0xF1, 0x0B, 0xAF, 0xD7, 0xEB, 0xF3, 0xF9, 0x46, 0xA3, 0x51,
-	0xB3, 0xD9, 0xAC, 0xD7, 0xEB, 0x83, 0xC1, 0x00, 0x5E, 0x16, 0xF4, 0x35,
-	0x84, 0xD1, 0xED, 0x76, 0x07, 0x83, 0xC1, 0x66, 0xB3, 0xD9, 0x6E, 0xB7,
-	0xB1, 0x52, 0x7C, 0x43, 0x8D, 0xC2, 0xA5, 0x90, 0x52, 0x4E, 0x29, 0x9B,
-	0x72, 0x27, 0xE4, 0x31, 0x85, 0xAE, 0xB3, 0xD9, 0x6C, 0x14, 0x0E, 0x2C,
-	0x08, 0xFE, 0x16, 0xDB, 0x69, 0x30, 0x18, 0x2C, 0x16, 0x8B, 0xC1, 0x60,
-	0x50, 0x8C, 0x0A, 0xBC, 0x73, 0x7C, 0x0D, 0x7B, 0x49, 0x83, 0xA7, 0xD1,
-	0x87, 0xF8, 0x2B, 0x97, 0xCB, 0x15, 0x08, 0x04, 0xDE, 0x7A, 0xEB, 0xAD,
-	0x77, 0xDF, 0x7D, 0xB7, 0xDF, 0xEF, 0xBF, 0x78, 0xF1, 0xA2, 0xDD, 0x6E,
-	0xE3, 0x46, 0xAA, 0xAA, 0x2A, 0x36, 0x9B, 0x0D, 0x7F, 0x83, 0xFF, 0x36,
-	0x9B, 0xCD, 0x4E, 0xA7, 0x33, 0x14, 0x0A, 0xAD, 0xAD, 0xAD, 0xFD, 0xD1,
-	0x1F, 0xFD, 0x51, 0xB5, 0x5A, 0xDD, 0xDE, 0xD9, 0x86, 0x09, 0x82, 0xF3,
-	0xD7, 0xEB, 0xF5, 0x78, 0x0C, 0xA9, 0x67, 0xB1, 0xEE, 0xB0, 0x9C, 0x36,
-	0x9B, 0xCD, 0xE9, 0x74, 0x7A, 0xBD, 0x5E, 0x8F, 0xC7, 0x93, 0xCF, 0xE7,
-	0x8D, 0x46, 0x63, 0xBD, 0x5E, 0xC7, 0x9E, 0x31, 0xB0, 0xB0, 0x5A, 0xAC,
-	0x06, 0x83, 0xE1, 0xE8, 0xE8, 0xC8, 0x68, 0x34, 0x22, 0xC2, 0xA8, 0x54,
-	0x2A, 0xB5, 0x5A, 0xAD, 0x5A, 0xAD, 0x42, 0xF3, 0x74, 0x3A, 0x9D, 0x99,
-	0x99, 0x19, 0x83, 0xC1, 0x50, 0xAF, 0xD7, 0x2B, 0x95, 0x8A, 0xD5, 0x6A,
-	0xF5, 0xF9, 0x7C, 0x74, 0x57, 0xF0, 0x24, 0x38, 0xFB, 0x50, 0x89, 0xAF,
-	0x75, 0xFE, 0x78, 0x02, 0xF0, 0x05, 0x1A, 0x4C, 0x9E, 0x95, 0x7E, 0xBF,
-	0x0F, 0x7F, 0x09, 0xC2, 0x88, 0xAF, 0xC1, 0x48, 0x70, 0x1B, 0x20, 0xFE,
-	0xD0, 0x3F, 0xDD, 0x6E, 0xB7, 0xD7, 0xEF, 0x8D, 0x46, 0x23, 0xBD, 0x4E,
-	0x0F, 0x5F, 0x19, 0x5A, 0x01, 0x3F, 0xCB, 0x53, 0x08, 0x05, 0x65, 0x32,
-	0x99, 0xDC, 0x6E, 0x77, 0x34, 0x1A, 0xDD, 0xDC, 0xDC, 0xFC, 0xB3, 0x3F,
-	0xFB, 0xB3, 0x58, 0x2C, 0xF6, 0xC9, 0x27, 0x9F, 0x24, 0x12, 0x89, 0x5E,
-	0xAF, 0x87, 0xFB, 0xEA, 0xF5, 0x7A, 0xC5, 0xED, 0x76, 0xF3, 0x6C, 0xC2,
-	0x95, 0xC6, 0x91, 0x89, 0xCF, 0xC4, 0x57, 0xCF, 0xAC, 0xE6, 0xF2, 0xB9,
-	0x70, 0x38, 0x7C, 0x72, 0x72, 0xA2, 0xD7, 0xEB, 0xF1, 0xCE, 0x7C, 0x5B,
-	0xDC, 0x18, 0x17, 0xB2, 0x5A, 0xAD, 0x36, 0x9B, 0xCD, 0x6A, 0xB5, 0x7A,
-	0x3C, 0x1E, 0x9F, 0xCF, 0x17, 0x8F, 0xC7, 0x97, 0x96, 0x96, 0xE6, 0xE6,
-	0xE6, 0x0E, 0x0F, 0x0F, 0xEF, 0xDE, 0xBD, 0x7B, 0x72, 0x72, 0x02, 0x9B,
-	0x83, 0xF7, 0xB4, 0xDB, 0xED, 0x16, 0xAB, 0x05, 0x26, 0xDD, 0x64, 0x32,
-	0x75, 0x3A, 0x1D, 0x83, 0xC1, 0x50, 0x2E, 0x97, 0x0B, 0x85, 0x42, 0xAD,
-	0x56, 0xC3, 0xD9, 0xAA, 0xD5, 0x6A, 0xED, 0x56, 0xDB, 0xEB, 0xF3, 0xC2,
-	0xD4, 0x57, 0xAB, 0x55, 0x87, 0xC3, 0xE1, 0xF3, 0xF9, 0xA4, 0x55, 0x80,
-	0xC4, 0xE1, 0xEC, 0x53, 0x11, 0x69, 0x6C, 0x92, 0xF4, 0x05, 0xE5, 0x07,
-	0x7F, 0x22, 0xCF, 0x2E, 0xCC, 0x9B, 0xCD, 0x66, 0xB3, 0xDB, 0xED, 0x16,
-	0x8B, 0x85, 0xE7, 0x0C, 0x5B, 0x8E, 0xAB, 0x41, 0xBF, 0xA9, 0xAA, 0xDA,
-	0x37, 0xF7, 0x87, 0xA3, 0x21, 0xCD, 0x00, 0xD6, 0x04, 0xBE, 0x09, 0x84,
-	0x58, 0x51, 0x14, 0xE8, 0xFD, 0x58, 0x2C, 0x76, 0xEE, 0xDC, 0xB9, 0xDB,
-	0xB7, 0x6F, 0x7B, 0xBD, 0xDE, 0xCF, 0x3E, 0xFB, 0xEC, 0xC3, 0x0F, 0x3F,
-	0xCC, 0x66, 0xB3, 0xB8, 0x17, 0xEE, 0xA2, 0xB8, 0xDD, 0xEE, 0x66, 0xB3,
-	0x89, 0x98, 0x08, 0x41, 0x0D, 0x54, 0x9B, 0xAA, 0xAA, 0xE1, 0x48, 0xB8,
-	0xD7, 0xEB, 0x25, 0x8E, 0x13, 0xB5, 0x6A, 0x0D, 0xEE, 0x3F, 0x1E, 0x82,
-	0x96, 0x16, 0x87, 0xD7, 0x6E, 0xB7, 0xDB, 0x6C, 0x36, 0x18, 0x34, 0xA8,
-	0xE6, 0x6E, 0xB7, 0x6B, 0xB7, 0xDB, 0xCF, 0x9E, 0x3D, 0x7B, 0xE5, 0xCA,
-	0x95, 0xB3, 0x67, 0xCF, 0x7E, 0xFC, 0xF1, 0xC7, 0x07, 0x07, 0x07, 0x95,
-	0x4A, 0x05, 0x1B, 0xDC, 0xEF, 0xF7, 0x21, 0xE9, 0xB4, 0x60, 0x8D, 0x46,
-	0x23, 0x9D, 0x4E, 0x97, 0xCB, 0xE5, 0x5A, 0xAD, 0x06, 0xDB, 0x6E, 0x32,
-	0x99, 0x5A, 0xAD, 0x56, 0xBB, 0xD3, 0x56, 0x14, 0xA5, 0xD7, 0xEF, 0x19,
-	0xF4, 0x06, 0xC4, 0x19, 0xA1, 0x50, 0x68, 0x79, 0x79, 0x19, 0x0B, 0x51,
-	0x2E, 0x97, 0x71, 0x56, 0xF0, 0x60, 0xD4, 0xBC, 0x0C, 0x8B, 0x20, 0xFB,
-	0x52, 0x53, 0xD1, 0x5A, 0x42, 0x59, 0xF1, 0x37, 0x52, 0x60, 0x03, 0x81,
-	0x00, 0xF5, 0x2A, 0x64, 0x9F, 0x06, 0x1F, 0x02, 0x87, 0xBD, 0x51, 0x8C,
-	0x8A, 0xC5, 0x62, 0xE1, 0x76, 0x2A, 0x8A, 0x02, 0x29, 0x84, 0x1A, 0x57,
-	0x55, 0x15, 0x1B, 0x10, 0x0E, 0x87, 0x23, 0x91, 0x48, 0xA5, 0x5C, 0x79,
-	0xF0, 0xE0, 0xC1, 0xEF, 0x7E, 0xF7, 0xBB, 0x44, 0x22, 0x51, 0x2E, 0x97,
-	0xA1, 0x0C, 0x6C, 0x36, 0x9B, 0x5E, 0xAF, 0x57, 0xDA, 0xED, 0x36, 0xBC,
-	0x2E, 0xB8, 0x98, 0x46, 0xA3, 0x11, 0x1B, 0x30, 0x1A, 0x8D, 0xFE, 0xFB,
-	0xBF, 0xFF, 0xDB, 0xE1, 0x70, 0xC0, 0x5B, 0xC7, 0xED, 0xA1, 0x10, 0xA1,
-	0x19, 0xA1, 0x4C, 0x20, 0xF8, 0x8D, 0x46, 0x03, 0xD7, 0x85, 0x2E, 0x4A,
-	0xA7, 0xD3, 0x27, 0x27, 0x27, 0x89, 0x44, 0xE2, 0xFA, 0xF5, 0xEB, 0x1E,
-	0x8F, 0xE7, 0x9D, 0x77, 0xDE, 0x69, 0x34, 0x1A, 0xD9, 0x6C, 0xB6, 0xDD,
-	0x6E, 0x27, 0x12, 0x89, 0xED, 0xED, 0x6D, 0x78, 0x41, 0x3A, 0x9D, 0xCE,
-	0x62, 0xB1, 0x28, 0x8A, 0x92, 0xC9, 0x64, 0xD2, 0xE9, 0x74, 0xA5, 0x52,
-	0x81, 0xC6, 0x47, 0xE4, 0x82, 0xF8, 0xCE, 0x6A, 0xB5, 0x62, 0x41, 0xF1,
-	0x7D, 0x9D, 0x4E, 0x07, 0xB4, 0x00, 0x4F, 0x82, 0x55, 0x83, 0xE8, 0x60,
-	0xF5, 0xB1, 0x70, 0xF8, 0x17, 0xDE, 0x1A, 0xB6, 0x19, 0x8E, 0x86, 0xB4,
-	0x19, 0xD2, 0x2F, 0x18, 0x87, 0x9C, 0x76, 0x3B, 0xD6, 0x0B, 0xAA, 0x75,
-	0x38, 0x1C, 0xE2, 0xD0, 0x23, 0xF2, 0xA0, 0xEA, 0x83, 0xDB, 0x32, 0x8E,
-	0x04, 0xBF, 0x78, 0x06, 0x87, 0xC3, 0x11, 0x08, 0x04, 0x42, 0xA1, 0x10,
-	0xE4, 0xA9, 0xD3, 0xE9, 0xE0, 0x7F, 0x75, 0xBB, 0xDD, 0x44, 0x22, 0xF1,
-	0xF0, 0xE1, 0xC3, 0xDD, 0xDD, 0xDD, 0x62, 0xB1, 0x58, 0xAF, 0xD7, 0x5B,
-	0xED, 0xD6, 0x68, 0x38, 0x82, 0x79, 0x18, 0x8D, 0x46, 0x0A, 0x04, 0x16,
-	0x1B, 0x80, 0x87, 0xC3, 0xA9, 0xC7, 0x2A, 0xF8, 0xFD, 0xFE, 0x5A, 0xAD,
-	0x06, 0xBD, 0x4C, 0xAB, 0x45, 0xCD, 0xE3, 0x72, 0xB9, 0x74, 0x3A, 0x1D,
-	0xD4, 0x37, 0xFE, 0x0A, 0x02, 0x82, 0x23, 0x55, 0xA9, 0x54, 0x0E, 0x0F,
-	0x0F, 0xA7, 0xA7, 0xA7, 0x63, 0xB1, 0xD8, 0x95, 0x2B, 0x57, 0x6E, 0xDC,
-	0xB8, 0xA1, 0xD3, 0xE9, 0x3E, 0xFB, 0xEC, 0xB3, 0x76, 0xBB, 0x8D, 0xBF,
-	0xC2, 0x8A, 0x14, 0x0A, 0x85, 0xE3, 0xE3, 0xE3, 0x62, 0xB1, 0x08, 0x19,
-	0xC7, 0x5B, 0x41, 0x4B, 0x42, 0xFA, 0xA0, 0x8E, 0xE9, 0x28, 0x97, 0x4A,
-	0xA5, 0xA9, 0xA9, 0x29, 0xFC, 0xB2, 0x58, 0x2C, 0x36, 0x1A, 0x0D, 0x9E,
-	0x4E, 0x2A, 0x46, 0x98, 0x62, 0x38, 0x33, 0x88, 0xDA, 0xE0, 0xF2, 0x4B,
-	0xF5, 0x45, 0x3F, 0x95, 0x02, 0x1B, 0x08, 0x04, 0x16, 0x16, 0x16, 0xC2,
-	0xE1, 0x30, 0x02, 0xB4, 0x76, 0xBB, 0x5D, 0xAF, 0xD7, 0x6B, 0xB5, 0x9A,
-	0x04, 0xC7, 0xAC, 0x56, 0x2B, 0xFD, 0x4E, 0x9C, 0x1B, 0x68, 0xEC, 0x58,
-	0x2C, 0xB6, 0xB4, 0xB4, 0x14, 0x8B, 0xC5, 0xBA, 0xDD, 0x2E, 0xC0, 0x2E,
-	0x60, 0x27, 0xC5, 0x62, 0xF1, 0xC9, 0x93, 0x27, 0x99, 0x4C, 0xA6, 0x56,
-	0xAB, 0xB5, 0x5A, 0x2D, 0xEC, 0x3A, 0xF5, 0x76, 0xBD, 0x5E, 0x57, 0xFA,
-	0x5F, 0x7C, 0xA4, 0x6B, 0x8F, 0x7B, 0xE0, 0x07, 0x06, 0x5C, 0x58, 0x7A,
-	0x1C, 0x40, 0x9B, 0xCD, 0xE6, 0x72, 0xB9, 0x54, 0x45, 0xCD, 0xE6, 0xB2,
-	0x50, 0x5F, 0x74, 0xC8, 0x8C, 0x46, 0x23, 0x04, 0x04, 0x2F, 0x90, 0x4A,
-	0xA5, 0x22, 0x91, 0xC8, 0xE9, 0xE9, 0xE9, 0xF4, 0xF4, 0xB4, 0xD5, 0x6A,
-	0x1D, 0x0C, 0x06, 0x70, 0x0C, 0x7A, 0xBD, 0x5E, 0xB1, 0x58, 0x4C, 0xA7,
-	0xD3, 0xA9, 0x54, 0xAA, 0x5A, 0xAD, 0x02, 0x63, 0xA1, 0x8D, 0xC1, 0xEA,
-	0xE3, 0xB5, 0x3B, 0x9D, 0x8E, 0xAA, 0xAA, 0x38, 0x76, 0xDD, 0x4E, 0x17,
-	0xBB, 0x1B, 0x8F, 0xC7, 0x21, 0x22, 0xB0, 0x16, 0xFD, 0x41, 0x1F, 0xAA,
-	0xA6, 0xDF, 0xEF, 0xD7, 0xEB, 0x75, 0x46, 0xD4, 0x10, 0x4F, 0x93, 0xC9,
-	0xD4, 0x68, 0x34, 0x20, 0x5B, 0x12, 0xEF, 0x82, 0x53, 0x80, 0xA0, 0x27,
-	0x10, 0x08, 0xAC, 0xAD, 0xAD, 0x9D, 0x3F, 0x7F, 0xDE, 0xEB, 0xF5, 0x36,
-	0x9B, 0xCD, 0x93, 0x93, 0x13, 0x00, 0x50, 0x38, 0x97, 0x10, 0x1A, 0xB8,
-	0x4C, 0xB8, 0x20, 0xA2, 0x39, 0x87, 0xC3, 0xE1, 0x74, 0x3A, 0xFD, 0x7E,
-	0xFF, 0xCC, 0xCC, 0x4C, 0x28, 0x14, 0x82, 0x36, 0x06, 0xD4, 0x01, 0xC1,
-	0x3A, 0x3D, 0x3D, 0xCD, 0xE7, 0xF3, 0x8D, 0x46, 0x03, 0x6F, 0x07, 0x2B,
-	0x68, 0x34, 0x1A, 0xA1, 0xAF, 0xCA, 0xE5, 0xB2, 0x02, 0xBF, 0x9E, 0x10,
-	0x07, 0x0C, 0x0E, 0x4F, 0x34, 0x76, 0x18, 0x6F, 0x82, 0x25, 0xC0, 0xED,
-	0x1D, 0x0E, 0x87, 0xC7, 0xE3, 0x81, 0xDA, 0x91, 0x1E, 0x1E, 0xAC, 0x22,
-	0x1D, 0xFF, 0x5E, 0xAF, 0x57, 0xAB, 0xD5, 0x72, 0xB9, 0xDC, 0xFE, 0xFE,
-	0x3E, 0xFC, 0x04, 0xFE, 0xBE, 0xFA, 0xC5, 0x07, 0x0B, 0xCA, 0x25, 0x93,
-	0x4E, 0x34, 0xBE, 0x09, 0xA7, 0x62, 0xAC, 0x4C, 0x06, 0x7D, 0x5C, 0xC1,
-	0x6A, 0xB5, 0x2E, 0x2D, 0x2D, 0x8D, 0x46, 0xA3, 0x62, 0xB1, 0xD8, 0x6A,
-	0xB6, 0xFA, 0x83, 0x3E, 0x1C, 0xFC, 0x7C, 0x3E, 0x4F, 0x61, 0x82, 0x16,
-	0x82, 0x27, 0x6E, 0x34, 0x1A, 0x6B, 0xB5, 0x1A, 0x82, 0x41, 0xE9, 0x43,
-	0x9B, 0xCD, 0x66, 0x28, 0xEB, 0xB9, 0xB9, 0xB9, 0xEB, 0xD7, 0xAF, 0xAF,
-	0xAF, 0xAF, 0xA7, 0xD3, 0xE9, 0xCF, 0x3F, 0xFF, 0x7C, 0x6F, 0x6F, 0x2F,
-	0x97, 0xCB, 0x55, 0xAB, 0x55, 0xE8, 0x1F, 0x48, 0x03, 0x16, 0x04, 0x7B,
-	0x00, 0x74, 0xC1, 0x6A, 0xB5, 0x5A, 0x2C, 0x96, 0x54, 0x2A, 0x75, 0x78,
-	0x78, 0xE8, 0xF1, 0x78, 0x96, 0x96, 0x96, 0xDC, 0x2E, 0xF7, 0x93, 0xA7,
-	0x4F, 0x76, 0x77, 0x77, 0x13, 0x89, 0x44, 0x26, 0x93, 0x29, 0x95, 0x4A,
-	0x38, 0xA3, 0x50, 0xA1, 0x74, 0x70, 0x1D, 0x0E, 0x87, 0xD5, 0x6A, 0xD5,
-	0xE9, 0x74, 0xE3, 0x48, 0x98, 0xEE, 0x1D, 0xAC, 0x16, 0x9D, 0x0A, 0x8B,
-	0xC5, 0x22, 0x1D, 0x00, 0x3C, 0x2E, 0x82, 0x64, 0x55, 0x55, 0xEB, 0xF5,
-	0x3A, 0x3D, 0x36, 0x89, 0x4C, 0x11, 0x11, 0x82, 0x02, 0x6D, 0xB5, 0x5A,
-	0x74, 0xE9, 0xA0, 0x97, 0xF1, 0x41, 0x60, 0x8C, 0x9F, 0xB9, 0x6D, 0x90,
-	0x7A, 0x3A, 0x39, 0xB8, 0x2C, 0x6D, 0x0F, 0xE3, 0x17, 0xC8, 0x5A, 0xB5,
-	0x5A, 0x85, 0xD1, 0x22, 0x9C, 0xA9, 0x39, 0xCD, 0xBC, 0x94, 0xD5, 0x6A,
-	0xC5, 0x0E, 0x41, 0x2F, 0xCB, 0xEB, 0xC0, 0x53, 0xBC, 0x7E, 0xFD, 0xFA,
-	0xE5, 0xCB, 0x97, 0xB3, 0xD9, 0xEC, 0x7B, 0xEF, 0xBD, 0xF7, 0xEC, 0xD9,
-	0xB3, 0x42, 0xA1, 0x00, 0xEF, 0x19, 0x57, 0xA3, 0xCF, 0x8D, 0x75, 0x50,
-	0x14, 0x45, 0x31, 0x2A, 0xAA, 0x69, 0x1C, 0x4B, 0x03, 0x32, 0xB1, 0x5A,
-	0xAD, 0xD9, 0x6C, 0x76, 0x75, 0x75, 0xB5, 0x5A, 0xAD, 0x16, 0x8B, 0x45,
-	0xC8, 0x56, 0xA3, 0xD1, 0xA8, 0x37, 0xEA, 0xFD, 0xDE, 0x78, 0x61, 0xA1,
-	0x00, 0x15, 0x45, 0xC1, 0x06, 0x28, 0x50, 0xD9, 0xF4, 0xD8, 0xE0, 0x68,
-	0x33, 0x8C, 0xEE, 0x76, 0xBB, 0x8D, 0x46, 0x03, 0x9B, 0x0C, 0x93, 0xEB,
-	0x70, 0x38, 0xE0, 0x27, 0x00, 0xFE, 0x45, 0xA0, 0x0B, 0xE9, 0x40, 0x10,
-	0x4B, 0x28, 0x94, 0x9E, 0x49, 0xAF, 0xD7, 0xEB, 0x74, 0x3A, 0xB8, 0x05,
-	0x3C, 0x36, 0x82, 0xCF, 0xF4, 0xE5, 0x65, 0x40, 0x0B, 0xC5, 0x42, 0x40,
-	0x49, 0x83, 0xB5, 0xC1, 0xEC, 0xFB, 0x7C, 0xBE, 0x70, 0x38, 0xDC, 0x6E,
-	0xB7, 0xE1, 0x83, 0xC1, 0xA1, 0x3E, 0x3C, 0x3C, 0x6C, 0x34, 0x1A, 0x78,
-	0x0C, 0xE0, 0x7A, 0x58, 0x35, 0x06, 0xFD, 0x0E, 0x87, 0xC3, 0x62, 0xB1,
-	0x40, 0x41, 0xC1, 0x07, 0x35, 0x9B, 0xCD, 0xF0, 0x14, 0xAF, 0x5C, 0xB9,
-	0x72, 0xF3, 0xE6, 0xCD, 0x56, 0xAB, 0xF5, 0xDE, 0x7B, 0xEF, 0x3D, 0x7A,
-	0xF4, 0x28, 0x93, 0xC9, 0xD4, 0xEB, 0x75, 0x69, 0x93, 0xE8, 0xE3, 0xD2,
-	0x13, 0x25, 0x1E, 0x8C, 0xFD, 0x40, 0xF4, 0x30, 0x1A, 0x8D, 0x7C, 0x3E,
-	0x9F, 0xCD, 0x66, 0x43, 0x74, 0x32, 0x16, 0xCA, 0xE1, 0x08, 0x0B, 0x8B,
-	0xA5, 0xC6, 0xAE, 0xCF, 0xCC, 0xCC, 0x28, 0x8A, 0xB2, 0xBB, 0xB3, 0x3B,
-	0x8E, 0x84, 0x25, 0xAC, 0x4A, 0x2F, 0x0D, 0x08, 0x6D, 0xAB, 0xD5, 0x82,
-	0x77, 0x85, 0x08, 0x39, 0x18, 0x0C, 0x4E, 0x4F, 0x4F, 0xC7, 0xE3, 0x71,
-	0xBC, 0xB9, 0xFA, 0xC5, 0xA7, 0x56, 0xAB, 0xC1, 0x18, 0x70, 0x59, 0xB1,
-	0x0D, 0x5C, 0x5F, 0x1C, 0x08, 0xFE, 0x2B, 0x51, 0x94, 0xD7, 0x26, 0x31,
-	0x64, 0xC4, 0x0B, 0xE3, 0x6F, 0xB1, 0x58, 0x3C, 0x1E, 0xCF, 0xD4, 0xD4,
-	0xD4, 0xEA, 0xDA, 0xAA, 0xC3, 0xE1, 0x38, 0x3D, 0x3D, 0x6D, 0x36, 0x9B,
-	0xF0, 0xDC, 0x00, 0xF9, 0x61, 0xC9, 0x70, 0xB6, 0xB8, 0x01, 0x78, 0x3B,
-	0xFC, 0xEC, 0x70, 0x38, 0xFC, 0x7E, 0x3F, 0xDC, 0x4A, 0x6C, 0x67, 0x28,
-	0x14, 0x5A, 0x59, 0x59, 0xD9, 0xD8, 0xD8, 0xB0, 0x5A, 0xAD, 0xF7, 0xEE,
-	0xDD, 0x7B, 0xF8, 0xF0, 0xE1, 0xE9, 0xE9, 0x69, 0xB1, 0x58, 0xA4, 0xE7,
-	0x43, 0xE5, 0x43, 0xAB, 0x0B, 0xDD, 0x05, 0x4D, 0xA2, 0x7C, 0xF1, 0xE9,
-	0x76, 0xBA, 0x16, 0xAB, 0x45, 0x55, 0xD5, 0x6A, 0xB5, 0x7A, 0xF6, 0xEC,
-	0x59, 0xBF, 0xDF, 0x9F, 0xCD, 0x66, 0xF1, 0x35, 0xA9, 0x57, 0x21, 0xFB,
-	0xC1, 0x60, 0x70, 0x73, 0x73, 0xB3, 0xD3, 0xE9, 0x7C, 0xF6, 0xD9, 0x67,
-	0x8A, 0xCD, 0x66, 0xE3, 0xE5, 0xE4, 0xFB, 0x13, 0x33, 0xC0, 0x81, 0x55,
-	0x55, 0x15, 0xD6, 0x66, 0x7A, 0x7A, 0x7A, 0x6E, 0x6E, 0x6E, 0x71, 0x71,
-	0x31, 0x16, 0x8B, 0xCD, 0xCD, 0xCD, 0xC5, 0x62, 0xB1, 0x67, 0xCF, 0x9E,
-	0x51, 0x63, 0xC2, 0x1D, 0x82, 0xE0, 0xE0, 0x0A, 0xD4, 0x24, 0x78, 0x19,
-	0xAC, 0x3B, 0xFE, 0xD5, 0xA0, 0x34, 0x1A, 0x38, 0x16, 0x38, 0x0C, 0x76,
-	0x02, 0x76, 0xD2, 0xEB, 0xF5, 0x86, 0x42, 0xA1, 0xCD, 0xCD, 0xCD, 0x48,
-	0x38, 0xB2, 0xB5, 0xB5, 0x75, 0x7C, 0x7C, 0x5C, 0x2E, 0x97, 0x11, 0xCD,
-	0xE5, 0x72, 0x39, 0xA8, 0x5A, 0x99, 0xE1, 0xE1, 0xBA, 0xCB, 0x6D, 0xC6,
-	0xD9, 0x07, 0x5A, 0x65, 0xB5, 0x5A, 0xA3, 0xD1, 0x68, 0x24, 0x12, 0x01,
-	0xF4, 0xFF, 0xF0, 0xE1, 0xC3, 0x6C, 0x36, 0x0B, 0x77, 0x05, 0x4E, 0xB0,
-	0xDC, 0x00, 0xEA, 0x6A, 0x83, 0xC1, 0x00, 0x4B, 0x09, 0xE7, 0x18, 0x1B,
-	0x30, 0x18, 0x0C, 0x74, 0x7A, 0x1D, 0xB6, 0x6D, 0x76, 0x76, 0x76, 0x30,
-	0x18, 0x14, 0x8B, 0xC5, 0x5C, 0x2E, 0xC7, 0x1C, 0x09, 0x0F, 0xB4, 0xC5,
-	0x62, 0x89, 0xC7, 0xE3, 0x57, 0xAE, 0x5C, 0xC9, 0xE7, 0xF3, 0x81, 0x40,
-	0x40, 0xC1, 0xEB, 0x01, 0x38, 0xD3, 0xC8, 0xA0, 0x34, 0xCB, 0x0E, 0x87,
-	0xC3, 0xE5, 0x72, 0x05, 0x83, 0xC1, 0xC5, 0xC5, 0xC5, 0x95, 0x95, 0x95,
-	0x99, 0x99, 0x19, 0x84, 0x2D, 0x73, 0x73, 0x73, 0x97, 0x2E, 0x5D, 0x7A,
-	0xF2, 0xE4, 0xC9, 0x93, 0x27, 0x4F, 0xF6, 0xF7, 0xF7, 0xF1, 0x02, 0x38,
-	0x0A, 0x32, 0x55, 0x00, 0x9D, 0x4B, 0x6D, 0x80, 0x1F, 0xBE, 0x2C, 0x7B,
-	0x87, 0xA3, 0x0D, 0x9D, 0x3B, 0xB6, 0x93, 0x76, 0x1B, 0x3C, 0x8D, 0x2B,
-	0x57, 0xAE, 0x44, 0x22, 0x91, 0x07, 0x0F, 0x1E, 0x6C, 0x6F, 0x6F, 0x97,
-	0x4A, 0xA5, 0x76, 0xBB, 0x8D, 0x2F, 0x53, 0x65, 0x13, 0xA9, 0x26, 0x3A,
-	0x46, 0x68, 0x48, 0x13, 0x21, 0x43, 0xFD, 0x8E, 0x46, 0x23, 0x88, 0xCB,
-	0xDE, 0xDE, 0x1E, 0x20, 0x71, 0xBA, 0x24, 0xFC, 0x68, 0xD6, 0x04, 0xA7,
-	0x8A, 0x60, 0x0C, 0xBE, 0x03, 0x0F, 0x05, 0x01, 0x53, 0x28, 0x14, 0x52,
-	0x55, 0xF5, 0x67, 0x3F, 0xFB, 0x19, 0x52, 0xB0, 0xF8, 0x25, 0x63, 0xEF,
-	0x5A, 0xAD, 0x56, 0xA9, 0x54, 0x9A, 0xCD, 0x66, 0xB1, 0x58, 0x1C, 0x0C,
-	0x06, 0x4A, 0xB3, 0xD9, 0x04, 0x68, 0x47, 0x0F, 0x7A, 0x32, 0x82, 0x1F,
-	0x0C, 0x06, 0x40, 0x63, 0x66, 0x66, 0x66, 0xE6, 0xE6, 0xE6, 0xFA, 0xFD,
-	0xFE, 0xF3, 0xE7, 0xCF, 0xC7, 0x67, 0xC2, 0xE7, 0x47, 0xFA, 0xF4, 0xCC,
-	0x99, 0x33, 0x87, 0x87, 0x87, 0x7B, 0x7B, 0x7B, 0xFB, 0xFB, 0xFB, 0xE9,
-	0x74, 0xBA, 0x54, 0x2A, 0xE1, 0xDE, 0x84, 0xA0, 0xE1, 0x8C, 0xE3, 0x34,
-	0xC0, 0x68, 0x4F, 0xEE, 0x01, 0x5E, 0x83, 0x1F, 0xF8, 0x88, 0x0E, 0x87,
-	0xC3, 0xE3, 0xF6, 0x44, 0xA3, 0xD1, 0x4B, 0x97, 0x2E, 0x85, 0xC3, 0xE1,
-	0xFB, 0xF7, 0xEF, 0x3F, 0x7F, 0xFE, 0x1C, 0x2B, 0xDE, 0xEB, 0xF5, 0xA0,
-	0x85, 0x6B, 0xB5, 0x1A, 0x9D, 0x0D, 0xB9, 0x70, 0x32, 0x1F, 0x40, 0xFB,
-	0x0C, 0x9B, 0xA4, 0xAA, 0xAA, 0x4C, 0x04, 0x15, 0x8B, 0x45, 0xFC, 0x9E,
-	0xB0, 0xAE, 0x4C, 0x2B, 0xC9, 0x27, 0x64, 0x46, 0x0C, 0xBB, 0x2B, 0x1D,
-	0x07, 0x83, 0xC1, 0x50, 0xAD, 0x56, 0x3F, 0xFF, 0xFC, 0x73, 0x9D, 0x4E,
-	0x07, 0xEF, 0x13, 0x5A, 0x11, 0x42, 0x0C, 0x67, 0xB2, 0x5E, 0xAF, 0x67,
-	0x32, 0x99, 0x47, 0x8F, 0x1E, 0xED, 0xED, 0xED, 0x9D, 0x9C, 0x9C, 0x28,
-	0xCC, 0x62, 0x23, 0x66, 0xD1, 0xA4, 0x38, 0x78, 0x4B, 0x93, 0xC9, 0x14,
-	0x0E, 0x87, 0x97, 0x97, 0x97, 0x5D, 0x2E, 0xD7, 0xA3, 0x47, 0x8F, 0xF2,
-	0xF9, 0x7C, 0xAB, 0xD5, 0x52, 0x55, 0xD5, 0xE3, 0xF6, 0xC4, 0xA6, 0x62,
-	0x48, 0xCA, 0xDB, 0xED, 0xF6, 0x73, 0xE7, 0xCE, 0xC1, 0x0D, 0xC8, 0x66,
-	0xB3, 0xC7, 0xC7, 0xC7, 0xA9, 0x54, 0x0A, 0x7E, 0x18, 0x8E, 0x05, 0xB2,
-	0x4B, 0xD8, 0xF2, 0x49, 0x24, 0x99, 0xE2, 0x8F, 0x43, 0x2D, 0x03, 0xFA,
-	0x60, 0x30, 0x78, 0xFE, 0xFC, 0x79, 0xAC, 0xFE, 0x8B, 0x17, 0x2F, 0x90,
-	0x9A, 0x47, 0x5C, 0x03, 0x5F, 0x5E, 0x9A, 0x1F, 0x98, 0x16, 0x19, 0x1B,
-	0x13, 0x4D, 0x63, 0x54, 0x0C, 0x64, 0x57, 0xA3, 0x15, 0xA1, 0x0C, 0xCC,
-	0x66, 0x33, 0x16, 0x04, 0xBE, 0x2F, 0x96, 0x98, 0xF8, 0xA3, 0xC4, 0xFD,
-	0xE9, 0xD7, 0xD1, 0x42, 0x40, 0xE7, 0x94, 0xCB, 0xE5, 0xF9, 0xF9, 0x79,
-	0xE6, 0x2D, 0xE4, 0x31, 0x82, 0x38, 0xD6, 0xEB, 0xF5, 0xED, 0xED, 0xED,
-	0xC3, 0xC3, 0xC3, 0x6A, 0xB5, 0xAA, 0x20, 0x7A, 0x82, 0x96, 0x57, 0x55,
-	0x55, 0xC2, 0x6D, 0x1A, 0x63, 0x10, 0x8B, 0xC5, 0xCE, 0x9C, 0x39, 0x53,
-	0x2C, 0x16, 0xA1, 0xDD, 0x80, 0xAF, 0xE9, 0xF5, 0xFA, 0xAD, 0x17, 0x5B,
-	0x5E, 0xAF, 0xD7, 0xED, 0x76, 0x03, 0x08, 0x32, 0x1A, 0x8D, 0x7E, 0xBF,
-	0xFF, 0xE2, 0xC5, 0x8B, 0xDF, 0xFE, 0xF6, 0xB7, 0x91, 0xC4, 0xFF, 0xF4,
-	0xD3, 0x4F, 0x9F, 0x3D, 0x7D, 0x96, 0x4E, 0xA7, 0x4B, 0xE5, 0x52, 0xBD,
-	0x5E, 0x47, 0x1A, 0x59, 0x51, 0x14, 0x7A, 0x4D, 0x9A, 0xD5, 0x27, 0x9C,
-	0x62, 0xB5, 0x5A, 0xDD, 0x6E, 0x37, 0xF4, 0x7E, 0x34, 0x1A, 0x7D, 0xF4,
-	0xE8, 0xD1, 0x8B, 0x17, 0x2F, 0x32, 0x99, 0x4C, 0xB9, 0x5C, 0x26, 0x98,
-	0x81, 0xEF, 0x23, 0x17, 0x8F, 0xF5, 0xE2, 0x32, 0xE1, 0xA8, 0xF1, 0x1C,
-	0x4F, 0x62, 0xA5, 0xD2, 0x9C, 0xC2, 0x3E, 0x37, 0x9B, 0x4D, 0x40, 0x9B,
-	0x74, 0xEA, 0x34, 0x8A, 0x88, 0x6E, 0x3A, 0xDD, 0x39, 0x99, 0x97, 0xAF,
-	0x56, 0xAB, 0xA5, 0x52, 0x09, 0xC0, 0x22, 0xB4, 0x19, 0xD6, 0x13, 0x8F,
-	0x3A, 0x8E, 0x25, 0xBB, 0xDD, 0x7A, 0xBD, 0x7E, 0x72, 0x72, 0x92, 0xC9,
-	0x64, 0x9A, 0xCD, 0xA6, 0x42, 0x6B, 0x09, 0x51, 0xE2, 0x9E, 0x4B, 0x04,
-	0x11, 0xF1, 0xD4, 0x68, 0x34, 0x72, 0x38, 0x1C, 0xBD, 0x5E, 0x0F, 0x11,
-	0x04, 0xC0, 0x7A, 0xAC, 0x60, 0x2E, 0x97, 0x63, 0x9E, 0xAF, 0xD7, 0xEB,
-	0x1D, 0x1D, 0x1D, 0xED, 0xEE, 0xEE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE,
-	0xAE, 0xAE, 0xAE, 0x1A, 0x8D, 0xC6, 0x4A, 0xB9, 0x52, 0x2C, 0x15, 0xA9,
-	0x37, 0x55, 0x55, 0x75, 0x38, 0x1C, 0xAA, 0xAA, 0x92, 0x96, 0x22, 0xF3,
-	0xB4, 0x10, 0x05, 0xAC, 0xBE, 0xDF, 0xEF, 0x5F, 0x5C, 0x5C, 0x9C, 0x9B,
-	0x9B, 0xDB, 0xDD, 0xDD, 0x7D, 0xF1, 0xE2, 0x45, 0x36, 0x9B, 0x05, 0x68,
-	0xCA, 0xB5, 0x86, 0xAE, 0xE0, 0x47, 0x03, 0xCA, 0x6B, 0xA0, 0x69, 0xA9,
-	0x91, 0x64, 0x18, 0xEC, 0xF3, 0xF9, 0xE0, 0x4A, 0x29, 0x8A, 0x52, 0x2C,
-	0x16, 0xA1, 0xA3, 0x61, 0x8A, 0x01, 0x04, 0xD0, 0x1F, 0xA1, 0x6D, 0xE3,
-	0xE2, 0x52, 0x67, 0xE8, 0xF5, 0x7A, 0xE6, 0xFB, 0xDA, 0xED, 0x36, 0xF0,
-	0x6D, 0x89, 0x1A, 0x21, 0x50, 0x07, 0x7D, 0x04, 0xD8, 0x57, 0xBB, 0xDD,
-	0x56, 0x88, 0x52, 0x21, 0x25, 0xC0, 0x34, 0x1B, 0x1F, 0x1A, 0x0E, 0x7B,
-	0xBB, 0xDD, 0x3E, 0x3A, 0x3A, 0xAA, 0xD5, 0x6A, 0x4E, 0xA7, 0x33, 0x1E,
-	0x8F, 0xE3, 0xD0, 0xD0, 0x9D, 0x6F, 0xB5, 0x5A, 0x88, 0xF5, 0xF1, 0xA0,
-	0xB8, 0xE0, 0xB3, 0x67, 0xCF, 0xF4, 0x7A, 0xBD, 0xC3, 0xEE, 0xF0, 0x07,
-	0xFC, 0x46, 0xC5, 0xE8, 0x76, 0xBB, 0x0B, 0x85, 0x82, 0x8C, 0xF8, 0x0C,
-	0x06, 0x03, 0x82, 0x11, 0xBA, 0xDB, 0x84, 0x9B, 0xA0, 0xFA, 0x81, 0x26,
-	0x2E, 0x2C, 0x2C, 0xD4, 0xEB, 0xF5, 0xBD, 0xBD, 0xBD, 0x7C, 0x3E, 0x5F,
-	0x2A, 0x95, 0xE0, 0xA5, 0x70, 0x03, 0xA0, 0xAC, 0xF8, 0xA1, 0xCE, 0x91,
-	0x49, 0x9B, 0x31, 0x7E, 0xA9, 0x28, 0x80, 0x10, 0x10, 0xD9, 0x20, 0x8E,
-	0x45, 0x20, 0xE6, 0xF7, 0xFB, 0xA3, 0xD1, 0x68, 0x20, 0x10, 0x48, 0xA7,
-	0xD3, 0xA7, 0xA7, 0xA7, 0x38, 0x64, 0x0C, 0x83, 0x6B, 0xB5, 0x5A, 0xB9,
-	0x5C, 0xC6, 0x7A, 0x75, 0x3A, 0x1D, 0x1E, 0x0E, 0x7A, 0xD5, 0x8C, 0x5A,
-	0xB0, 0x74, 0xF8, 0xBF, 0x2E, 0x97, 0x0B, 0xBA, 0x8B, 0x92, 0x01, 0xC5,
-	0x8B, 0x9C, 0x33, 0x53, 0xB0, 0x0A, 0xF3, 0xD1, 0x78, 0x19, 0x68, 0x21,
-	0xEA, 0x50, 0x2C, 0x28, 0x1E, 0xE2, 0xF0, 0xF0, 0xF0, 0xC9, 0x93, 0x27,
-	0x1E, 0x8F, 0x27, 0x9D, 0x4E, 0x5B, 0x2C, 0x96, 0xD9, 0xD9, 0x59, 0xBF,
-	0xDF, 0x5F, 0x28, 0x14, 0x70, 0xDC, 0xDA, 0xED, 0x36, 0xF4, 0x3B, 0x59,
-	0x0E, 0x78, 0x32, 0xAC, 0x05, 0xF8, 0x0D, 0x26, 0x93, 0x89, 0x7A, 0x53,
-	0x3E, 0x37, 0xF2, 0x91, 0xD2, 0xE5, 0xB7, 0xDB, 0xED, 0x4E, 0xA7, 0xD3,
-	0xE7, 0xF3, 0xC5, 0x62, 0x31, 0xBF, 0xDF, 0xBF, 0xB3, 0xB3, 0x53, 0xA9,
-	0x54, 0xAA, 0xD5, 0x2A, 0xCE, 0x35, 0x2E, 0xCE, 0x98, 0x11, 0x9C, 0x27,
-	0xC0, 0xA2, 0xE0, 0x6A, 0xC8, 0xB0, 0x0E, 0x81, 0x12, 0x96, 0x1E, 0x2F,
-	0x68, 0xB5, 0x5A, 0xB1, 0xBB, 0xC1, 0x60, 0x30, 0x12, 0x89, 0x2C, 0x2D,
-	0x2D, 0x45, 0xA3, 0x51, 0xB3, 0xD9, 0x3C, 0x3D, 0x3D, 0x1D, 0x89, 0x44,
-	0x56, 0x57, 0x57, 0x3B, 0x9D, 0x0E, 0x60, 0x92, 0x54, 0x2A, 0xF5, 0xEC,
-	0xD9, 0xB3, 0xAD, 0xAD, 0x2D, 0x1E, 0x08, 0x9E, 0x00, 0x3A, 0xD3, 0x12,
-	0xE2, 0x26, 0x11, 0x04, 0xBB, 0x4E, 0xFB, 0xF1, 0x2A, 0x03, 0xAC, 0x28,
-	0x50, 0x41, 0xC8, 0x4A, 0x8E, 0x46, 0x23, 0x85, 0x02, 0x22, 0xA3, 0x35,
-	0x7C, 0x20, 0xA4, 0x10, 0xF0, 0x6A, 0xB5, 0x7A, 0x7A, 0x7A, 0xFA, 0xC9,
-	0x27, 0x9F, 0x04, 0x83, 0xC1, 0xE3, 0xE3, 0x63, 0x64, 0xCF, 0xE3, 0xF1,
-	0xF8, 0xFC, 0xFC, 0x7C, 0xA9, 0x54, 0x82, 0x03, 0x3A, 0x1A, 0x8D, 0x60,
-	0xF4, 0x1B, 0x8D, 0x06, 0xB6, 0x84, 0x5A, 0x32, 0x9B, 0xCD, 0xC2, 0x6B,
-	0x82, 0x8F, 0x21, 0xC9, 0x20, 0xC4, 0x23, 0xE9, 0x7E, 0x60, 0xB1, 0x90,
-	0x59, 0x73, 0x3A, 0x9D, 0x90, 0x09, 0xA2, 0x17, 0x8C, 0x33, 0xF0, 0x78,
-	0xC0, 0xB2, 0x80, 0x4D, 0xE9, 0xF5, 0xFA, 0x5A, 0xAD, 0x26, 0xB3, 0x60,
-	0xDC, 0x51, 0x44, 0xD7, 0x70, 0xB5, 0x91, 0x86, 0xB3, 0x59, 0x6D, 0x91,
-	0x48, 0x64, 0x6D, 0x6D, 0xED, 0xDC, 0xD9, 0x73, 0x66, 0xB3, 0x19, 0x16,
-	0xB2, 0x52, 0xA9, 0x98, 0xCD, 0x66, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xA1,
-	0x5A, 0x79, 0xE6, 0xC8, 0x25, 0xA0, 0xE6, 0xA1, 0x1F, 0x21, 0x13, 0x9F,
-	0x78, 0x2A, 0x60, 0x30, 0x78, 0x35, 0xEA, 0x40, 0x88, 0x3F, 0xD0, 0xE2,
-	0x4A, 0xA5, 0xE2, 0xF1, 0x78, 0x14, 0x1C, 0x76, 0x79, 0x52, 0x78, 0x8A,
-	0x65, 0xFE, 0x68, 0x30, 0x18, 0xB4, 0xDB, 0xED, 0x42, 0xA1, 0xB0, 0xB5,
-	0xB5, 0x55, 0x2E, 0x97, 0xC1, 0x2A, 0x34, 0x1A, 0x8D, 0xA5, 0x52, 0x69,
-	0x73, 0x73, 0xF3, 0xAB, 0x5F, 0xFD, 0xEA, 0x85, 0x0B, 0x17, 0xEE, 0xDE,
-	0xBD, 0xBB, 0xB5, 0xB5, 0x05, 0xD9, 0x81, 0x61, 0xC7, 0xE3, 0x52, 0xC5,
-	0x19, 0x0C, 0x86, 0x66, 0xB3, 0x09, 0xA2, 0x15, 0xCD, 0x3B, 0xF3, 0x27,
-	0x44, 0xC7, 0x98, 0xF1, 0x00, 0xEA, 0x07, 0x78, 0x5D, 0x42, 0x49, 0x7C,
-	0x54, 0xEA, 0x3A, 0x6C, 0x4C, 0x30, 0x18, 0x24, 0xD9, 0x84, 0xE0, 0x33,
-	0xD3, 0xA5, 0xB0, 0x64, 0x84, 0xD9, 0xEB, 0xF5, 0x7A, 0xA5, 0x5A, 0xE9,
-	0x76, 0xBB, 0x4E, 0xA7, 0xD3, 0xE1, 0x74, 0x60, 0xF5, 0x53, 0xA9, 0x54,
-	0xA5, 0x52, 0x41, 0x5E, 0xCC, 0x62, 0xB1, 0x80, 0x09, 0x59, 0xAD, 0x56,
-	0x69, 0x0C, 0xC8, 0x1E, 0xD3, 0xE4, 0x99, 0x65, 0x08, 0x49, 0xA9, 0x47,
-	0x76, 0x8B, 0xF4, 0x1C, 0xDA, 0x70, 0x08, 0x74, 0xAD, 0x56, 0x83, 0x0E,
-	0x54, 0x3C, 0x1E, 0x0F, 0x92, 0xDD, 0x58, 0x29, 0x40, 0xFF, 0x9A, 0x2D,
-	0x85, 0xE9, 0x28, 0x97, 0xCB, 0x27, 0x27, 0x27, 0x8C, 0x36, 0xE1, 0x7D,
-	0xF7, 0x7A, 0x3D, 0xBB, 0xDD, 0xFE, 0xF6, 0xDB, 0x6F, 0x4F, 0x4D, 0x4D,
-	0xFD, 0xFC, 0xE7, 0x3F, 0x87, 0x16, 0xAA, 0xD7, 0xEB, 0x12, 0xE0, 0xA3,
-	0x98, 0x30, 0xA1, 0x21, 0x83, 0x0C, 0x86, 0x97, 0xE4, 0x36, 0x11, 0xB2,
-	0xEF, 0xF5, 0x7A, 0xF9, 0x7C, 0x1E, 0xF9, 0x16, 0x44, 0xEC, 0x93, 0x5E,
-	0x39, 0x1D, 0x1E, 0xBD, 0x5E, 0xBF, 0xBC, 0xBC, 0x6C, 0x36, 0x9B, 0x53,
-	0xA9, 0x14, 0x34, 0x15, 0x91, 0x6D, 0x3C, 0x89, 0x06, 0x65, 0xE9, 0xF7,
-	0xFB, 0x40, 0x32, 0x90, 0x79, 0x26, 0x78, 0xD9, 0x6C, 0x36, 0x69, 0xFF,
-	0x10, 0x9A, 0xD1, 0xE4, 0x68, 0x12, 0x9F, 0x84, 0xAA, 0x08, 0xD5, 0x69,
-	0xF0, 0x22, 0x80, 0xA6, 0xF8, 0x4F, 0xBA, 0x4F, 0xF0, 0x71, 0x71, 0x08,
-	0x22, 0x91, 0x88, 0xE2, 0x76, 0xBB, 0xAD, 0x56, 0x2B, 0x92, 0x62, 0xFC,
-	0xDF, 0xF2, 0x58, 0x8D, 0x39, 0x39, 0x9D, 0x4E, 0xBD, 0x5E, 0x87, 0x46,
-	0xC2, 0x59, 0x06, 0xD7, 0xAC, 0xDF, 0xEF, 0xDF, 0xB9, 0x73, 0x47, 0xA7,
-	0xD3, 0xDD, 0xB8, 0x71, 0xE3, 0xD6, 0xAD, 0x5B, 0xE5, 0x72, 0x19, 0x97,
-	0xAE, 0xD5, 0x6A, 0x72, 0xE7, 0x79, 0x98, 0xE4, 0xA3, 0x6B, 0xFE, 0x97,
-	0x34, 0xFB, 0x38, 0xC2, 0x88, 0x21, 0x74, 0x3A, 0x1D, 0x16, 0x8B, 0x94,
-	0x05, 0x0D, 0xC6, 0xC0, 0x55, 0x58, 0x5C, 0x5C, 0x3C, 0x77, 0xEE, 0xDC,
-	0x47, 0x1F, 0x7D, 0x94, 0x4E, 0xA7, 0x21, 0x1C, 0x38, 0xF5, 0x80, 0x4B,
-	0xA5, 0x7B, 0x4A, 0x9C, 0x55, 0xAF, 0xD7, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E,
-	0x1E, 0x56, 0x2A, 0x95, 0x4E, 0xBB, 0x93, 0x2F, 0xBC, 0xC2, 0xEE, 0x81,
-	0x83, 0x31, 0x36, 0x96, 0xC0, 0x1C, 0xC9, 0x71, 0xD2, 0x00, 0xF0, 0x97,
-	0xD0, 0x2B, 0xA0, 0xB7, 0xF2, 0x0F, 0x35, 0x4C, 0x48, 0xF8, 0x35, 0xCD,
-	0x66, 0x53, 0x31, 0x1A, 0x8D, 0x73, 0x73, 0x73, 0x08, 0xDB, 0xF0, 0x81,
-	0xFF, 0x24, 0x63, 0x19, 0x72, 0x02, 0x28, 0x1D, 0x38, 0xE0, 0x70, 0x5B,
-	0xFB, 0xFD, 0x7E, 0x21, 0x5F, 0xD8, 0xD9, 0xD9, 0xF9, 0x93, 0x3F, 0xF9,
-	0x93, 0x77, 0xDF, 0x7D, 0x77, 0x38, 0x1C, 0xB6, 0xDB, 0x6D, 0xC6, 0xA5,
-	0x70, 0x96, 0x64, 0x6C, 0xA1, 0x49, 0x8E, 0xCB, 0x45, 0x27, 0x57, 0x10,
-	0xFB, 0x0D, 0x25, 0x03, 0xA5, 0xCF, 0xB4, 0x01, 0x44, 0x44, 0xF2, 0xEF,
-	0x98, 0x53, 0xB4, 0xD9, 0x6C, 0x7F, 0xF3, 0x37, 0x7F, 0xB3, 0xB8, 0xB8,
-	0xF8, 0x93, 0x9F, 0xFC, 0xE4, 0xF0, 0xF0, 0xB0, 0x58, 0x2C, 0xC2, 0x7B,
-	0xE6, 0x5D, 0xA4, 0xBF, 0x04, 0xE3, 0x5F, 0xAD, 0x56, 0xEF, 0xDF, 0xBF,
-	0x9F, 0xCB, 0xE5, 0x46, 0xA3, 0x91, 0xD9, 0x6C, 0xC6, 0x8D, 0xA0, 0x70,
-	0xC0, 0x35, 0x06, 0x23, 0x84, 0xD1, 0x2F, 0x31, 0x7D, 0xA9, 0x85, 0x34,
-	0x81, 0x05, 0x56, 0xDF, 0xE5, 0x72, 0x79, 0x3C, 0x9E, 0xD1, 0x68, 0x84,
-	0x18, 0x45, 0x51, 0x14, 0xC9, 0x00, 0xA7, 0x3A, 0x52, 0x46, 0xA3, 0xD1,
-	0xC2, 0xC2, 0x42, 0x34, 0x1A, 0x45, 0x22, 0x37, 0x93, 0xC9, 0x40, 0x0B,
-	0x4B, 0x10, 0x0A, 0x8B, 0x88, 0x73, 0x80, 0x4B, 0x60, 0x4D, 0x61, 0xD3,
-	0xDB, 0xAD, 0x76, 0xB9, 0x5C, 0x2E, 0x96, 0x8A, 0xE5, 0x72, 0xF9, 0xAF,
-	0xFE, 0xEA, 0xAF, 0xFE, 0xF2, 0x2F, 0xFF, 0xD2, 0x64, 0x32, 0xD5, 0xEB,
-	0x75, 0x28, 0x4D, 0xEC, 0x99, 0x26, 0xFC, 0xD1, 0x84, 0x94, 0x74, 0xB7,
-	0x10, 0x8E, 0x22, 0xA0, 0xC3, 0xD9, 0x07, 0x53, 0x11, 0x06, 0x10, 0x19,
-	0x63, 0x06, 0x0D, 0x92, 0x47, 0x0C, 0x76, 0xF8, 0xCE, 0xCE, 0xCE, 0xB3,
-	0x67, 0xCF, 0xE6, 0xE7, 0xE7, 0x7D, 0x3E, 0x5F, 0x32, 0x99, 0x94, 0x2C,
-	0x39, 0xC6, 0x65, 0x84, 0x6F, 0xC1, 0xBB, 0x3A, 0x38, 0x38, 0x28, 0x16,
-	0x8B, 0xC0, 0xD4, 0xBC, 0x5E, 0x2F, 0x5F, 0x16, 0x77, 0x24, 0xBE, 0x4D,
-	0x7B, 0xC3, 0x5C, 0xB4, 0x0C, 0x8C, 0x25, 0x58, 0x8D, 0xD8, 0x02, 0x98,
-	0x39, 0x52, 0xA7, 0xC8, 0x52, 0xF0, 0x65, 0xB9, 0x8B, 0x63, 0x5A, 0x89,
-	0xC7, 0xE3, 0xD9, 0xD8, 0xD8, 0x98, 0x9F, 0x9F, 0xFF, 0xE5, 0x2F, 0x7F,
-	0x09, 0xFA, 0x09, 0xD9, 0x3E, 0x52, 0xAF, 0x61, 0xD1, 0x49, 0xE4, 0x63,
-	0x06, 0x1F, 0xAB, 0xD3, 0x6C, 0x8D, 0x1D, 0xD0, 0xC1, 0x60, 0xF0, 0x83,
-	0x1F, 0xFC, 0xE0, 0xCF, 0xFF, 0xFC, 0xCF, 0x3B, 0x9D, 0xCE, 0xCF, 0x7F,
-	0xFE, 0x73, 0x83, 0xC1, 0x00, 0x42, 0x35, 0x56, 0x0D, 0x8F, 0x08, 0x63,
-	0xA0, 0xE1, 0x89, 0xD0, 0xC6, 0x42, 0x57, 0xF6, 0x7A, 0x3D, 0x50, 0x45,
-	0x19, 0xFE, 0xC0, 0xFF, 0xC3, 0xA6, 0x72, 0xDB, 0x10, 0xD3, 0x51, 0xD5,
-	0x00, 0xE1, 0xFA, 0xCA, 0x57, 0xBE, 0x62, 0xB5, 0x5A, 0xE1, 0x4A, 0x31,
-	0x08, 0xA2, 0x55, 0x34, 0x7D, 0xF1, 0x41, 0xEE, 0x10, 0x3C, 0x5C, 0x24,
-	0x59, 0xDD, 0x6E, 0x37, 0x5C, 0x55, 0x0A, 0x04, 0x76, 0x9D, 0x54, 0x28,
-	0x79, 0x8C, 0x24, 0x23, 0x8D, 0x0F, 0xC3, 0xE0, 0x0E, 0x0E, 0xF4, 0xA5,
-	0x4B, 0x97, 0x52, 0xA9, 0x54, 0xAD, 0x56, 0xD3, 0xEB, 0xF5, 0xE5, 0x72,
-	0x99, 0x69, 0x2B, 0x20, 0xE1, 0x88, 0x42, 0x94, 0xD5, 0xD5, 0xD5, 0xB3,
-	0x67, 0xCF, 0xFA, 0x7C, 0x3E, 0x28, 0x3B, 0xE9, 0x36, 0x69, 0x42, 0x4A,
-	0x3C, 0x13, 0xD3, 0x2C, 0x38, 0x41, 0x60, 0xD4, 0xD0, 0xD8, 0x3E, 0x7D,
-	0xFA, 0xF4, 0xDF, 0xFF, 0xFD, 0xDF, 0xBF, 0xF6, 0xB5, 0xAF, 0x5D, 0xBD,
-	0x7A, 0xB5, 0xDB, 0xED, 0xDE, 0xB9, 0x73, 0x07, 0x88, 0x07, 0x8E, 0x0E,
-	0xFC, 0x33, 0xC4, 0x90, 0x93, 0x64, 0x6C, 0xE8, 0x3A, 0xFC, 0x2F, 0x90,
-	0xCE, 0xB8, 0x01, 0x5C, 0x7A, 0x8D, 0x36, 0x93, 0xF1, 0x0A, 0x41, 0x88,
-	0x7E, 0xBF, 0x3F, 0x3F, 0x3F, 0xEF, 0x72, 0xB9, 0x98, 0x1C, 0x26, 0x28,
-	0xCF, 0xA5, 0x77, 0x38, 0x1C, 0xA3, 0xD1, 0x28, 0x99, 0x4C, 0x22, 0xA2,
-	0xB4, 0x58, 0x2C, 0xF8, 0x5F, 0x76, 0xBB, 0xBD, 0x56, 0xAB, 0x41, 0xC0,
-	0xC9, 0x17, 0x61, 0x18, 0x45, 0x32, 0x0E, 0x20, 0x23, 0x66, 0xC8, 0xF1,
-	0xC0, 0x54, 0x53, 0x20, 0xA8, 0x05, 0x83, 0xC1, 0x4B, 0x97, 0x2E, 0x85,
-	0x42, 0xA1, 0xC1, 0x60, 0xF0, 0xBB, 0x3B, 0xBF, 0x4B, 0x67, 0xD2, 0xE5,
-	0x72, 0x19, 0xAB, 0x84, 0x1B, 0x79, 0xBD, 0xDE, 0xD9, 0xD9, 0x59, 0xE3,
-	0x8D, 0x1B, 0x37, 0xCC, 0x66, 0x73, 0x22, 0x91, 0xF8, 0xF8, 0xE3, 0x8F,
-	0x91, 0x09, 0x22, 0xC9, 0x80, 0xE7, 0x80, 0x07, 0x59, 0xEE, 0x04, 0x7D,
-	0x41, 0x09, 0x13, 0x82, 0xF3, 0xB3, 0xBB, 0xBB, 0x7B, 0x72, 0x72, 0x82,
-	0xD4, 0x31, 0x83, 0x4F, 0x20, 0x3C, 0xD0, 0x21, 0x74, 0x27, 0x34, 0x5C,
-	0xDA, 0x49, 0x9F, 0x5A, 0x26, 0x70, 0x88, 0x8D, 0x4F, 0x62, 0xCB, 0xB0,
-	0x87, 0xF8, 0x80, 0xE6, 0x6F, 0xB7, 0xDB, 0x21, 0xCB, 0x8C, 0x81, 0x21,
-	0x71, 0x48, 0xA9, 0x2A, 0x8A, 0x52, 0xAB, 0xD5, 0xEA, 0xF5, 0x71, 0xB2,
-	0xD0, 0x68, 0x34, 0xBA, 0x5C, 0xAE, 0xC5, 0xC5, 0x45, 0xBF, 0xDF, 0x0F,
-	0x03, 0x50, 0x28, 0x14, 0x4E, 0x4F, 0x4F, 0x19, 0x0C, 0xE3, 0x79, 0xB0,
-	0xF4, 0x76, 0xBB, 0xDD, 0xE5, 0x72, 0x41, 0xC5, 0x7B, 0x3C, 0x1E, 0x97,
-	0xCB, 0xE5, 0x72, 0xBA, 0x46, 0xBA, 0x11, 0xFC, 0x43, 0xFE, 0x0B, 0x8B,
-	0x75, 0xEE, 0xDC, 0x39, 0x30, 0x4B, 0xC6, 0x9C, 0x7B, 0xAB, 0x05, 0xDB,
-	0x8F, 0x6C, 0xBE, 0xDB, 0xED, 0x56, 0xF6, 0xF6, 0xF6, 0xE0, 0xDB, 0xA4,
-	0xD3, 0x69, 0xD0, 0xFF, 0x25, 0x51, 0x4E, 0x3A, 0x0F, 0x58, 0x11, 0x9A,
-	0x72, 0x2E, 0x3D, 0x2C, 0x2D, 0xC5, 0x64, 0x38, 0x1C, 0x96, 0xCB, 0xE5,
-	0x44, 0x22, 0x01, 0x31, 0x91, 0xA0, 0x2E, 0x13, 0xD3, 0xE4, 0xCF, 0x6A,
-	0xCC, 0x03, 0x8F, 0x3F, 0xBC, 0x75, 0xA9, 0x64, 0x29, 0x80, 0xD2, 0xF1,
-	0x90, 0x7C, 0x58, 0xC8, 0x7E, 0xB3, 0xD9, 0x84, 0xDD, 0xAE, 0x56, 0xAB,
-	0x5E, 0x8F, 0x17, 0x8C, 0x31, 0x48, 0x06, 0xFD, 0x74, 0xEC, 0xD0, 0x70,
-	0x38, 0xD4, 0x1B, 0xF4, 0xAA, 0xA2, 0x9A, 0xCD, 0x66, 0xA3, 0xD1, 0xE8,
-	0x70, 0x38, 0x16, 0x16, 0x16, 0x5C, 0x2E, 0x57, 0xAD, 0x56, 0xDB, 0xDF,
-	0xDF, 0x07, 0x91, 0x44, 0xD6, 0x04, 0x40, 0xF6, 0x11, 0x45, 0x63, 0xE9,
-	0xDD, 0x6E, 0xB7, 0xC3, 0xE1, 0x18, 0x0E, 0x87, 0x27, 0x27, 0x27, 0x92,
-	0xB6, 0xCD, 0x04, 0x6D, 0xAD, 0x56, 0x2B, 0x16, 0x8B, 0x8B, 0x8B, 0x8B,
-	0xA0, 0x09, 0xE9, 0xF5, 0x7A, 0xBD, 0x4E, 0x8F, 0x15, 0x7B, 0x15, 0x1B,
-	0x37, 0x9B, 0xCD, 0x64, 0x32, 0x09, 0x44, 0x41, 0xD6, 0x3D, 0x4D, 0x66,
-	0xA9, 0xC8, 0x69, 0xD0, 0xFC, 0x9E, 0x4C, 0x08, 0xAA, 0x05, 0x04, 0x1A,
-	0x48, 0x9C, 0x32, 0x03, 0x03, 0x41, 0x86, 0xEF, 0x81, 0xA3, 0xA0, 0x49,
-	0xB7, 0xD2, 0xD2, 0x00, 0x5D, 0xA0, 0x0B, 0x2F, 0x9D, 0x0D, 0x19, 0x8E,
-	0x49, 0x43, 0xC5, 0xD8, 0x05, 0x06, 0x1C, 0x56, 0x0A, 0xA4, 0x52, 0xC9,
-	0xDA, 0x94, 0x0E, 0xE8, 0xD8, 0x7D, 0x32, 0x18, 0x11, 0x18, 0xCF, 0xCC,
-	0xCC, 0xAC, 0xAD, 0xAD, 0x21, 0xF2, 0x38, 0x3C, 0x3C, 0x04, 0xDC, 0x0B,
-	0xFD, 0x23, 0xD3, 0xB9, 0xA0, 0xF9, 0x87, 0xC3, 0xE1, 0x68, 0x34, 0x3A,
-	0x35, 0x35, 0xA5, 0x28, 0xCA, 0x8B, 0x17, 0x2F, 0xC0, 0x43, 0x21, 0x31,
-	0x87, 0x41, 0x4C, 0xA7, 0xD3, 0xF9, 0xE8, 0xA3, 0x8F, 0x92, 0xC9, 0xA4,
-	0xCD, 0x66, 0x23, 0x80, 0x4A, 0xF2, 0x07, 0x3C, 0x54, 0xA5, 0xD7, 0xEB,
-	0x25, 0x93, 0xC9, 0x4A, 0xA5, 0x02, 0xFF, 0x97, 0xA4, 0x25, 0xAA, 0x66,
-	0x4D, 0xE2, 0x50, 0xE2, 0x1E, 0xF2, 0x97, 0x74, 0x6F, 0x99, 0x7C, 0x47,
-	0x2C, 0x4E, 0x93, 0x4E, 0xD3, 0x0F, 0x51, 0x22, 0x72, 0xC9, 0x3A, 0x16,
-	0x28, 0x7A, 0xFA, 0x09, 0x78, 0x61, 0xC2, 0x6D, 0x34, 0x00, 0x8C, 0xEC,
-	0xA4, 0xEF, 0x21, 0xE1, 0x13, 0xA0, 0x92, 0x64, 0x5D, 0x30, 0xB4, 0xA6,
-	0xE3, 0xA1, 0x21, 0xB6, 0x3A, 0x9D, 0xCE, 0xA9, 0xA9, 0xA9, 0x2B, 0x57,
-	0xAE, 0xD8, 0xED, 0xF6, 0x0F, 0x3E, 0xF8, 0x00, 0x49, 0x79, 0x19, 0x7F,
-	0xF1, 0x15, 0xA0, 0xC7, 0xBC, 0x5E, 0x6F, 0x2C, 0x16, 0x5B, 0x5D, 0x5D,
-	0x9D, 0x9F, 0x9F, 0x7F, 0xF9, 0xF2, 0x65, 0xAD, 0x56, 0x1B, 0xF4, 0x07,
-	0x52, 0x27, 0x63, 0x89, 0x61, 0x23, 0xE1, 0x4F, 0x07, 0x02, 0x01, 0x98,
-	0x19, 0x04, 0x95, 0xBC, 0xA6, 0x4E, 0xA7, 0x53, 0x10, 0x6A, 0x93, 0xC8,
-	0x2F, 0xD9, 0x9F, 0x1A, 0x2C, 0xF7, 0xB5, 0xB5, 0x67, 0x9A, 0xA3, 0x00,
-	0x7D, 0x2A, 0xA1, 0x18, 0x0D, 0x1E, 0xC9, 0x0D, 0x20, 0x22, 0x84, 0x4A,
-	0x20, 0x78, 0x9C, 0xA4, 0x7E, 0x20, 0xCA, 0x43, 0xF2, 0x16, 0xC7, 0x82,
-	0x25, 0x31, 0x93, 0x41, 0xA9, 0x74, 0x97, 0xA5, 0x40, 0xD0, 0xDD, 0x82,
-	0xFF, 0xC3, 0xC7, 0x60, 0x19, 0x84, 0xD9, 0x6C, 0xF6, 0x78, 0x3C, 0xB3,
-	0xB3, 0xB3, 0x67, 0xCF, 0x9E, 0x8D, 0x46, 0xA3, 0xC7, 0xC7, 0xC7, 0xBF,
-	0xFD, 0xED, 0x6F, 0x4F, 0x4E, 0x4E, 0xC0, 0x21, 0xA4, 0xB3, 0xC0, 0x0D,
-	0xC6, 0x5F, 0xB9, 0xDD, 0xEE, 0xA9, 0xA9, 0xA9, 0xF3, 0xE7, 0xCF, 0x9B,
-	0x4C, 0xA6, 0xBB, 0x77, 0xEF, 0x0E, 0x87, 0x43, 0x9D, 0x5E, 0xA7, 0x51,
-	0x89, 0x78, 0x7D, 0x42, 0x32, 0x8D, 0x46, 0x03, 0x1C, 0x4E, 0x40, 0x52,
-	0xB4, 0x4C, 0x83, 0xC1, 0x40, 0x29, 0x95, 0x4A, 0x93, 0x0C, 0x1C, 0x8A,
-	0x92, 0xA6, 0x16, 0x50, 0xA2, 0xEA, 0x5F, 0x56, 0x11, 0x48, 0xA5, 0x21,
-	0xC9, 0xF8, 0xF0, 0x17, 0xC1, 0x6D, 0x41, 0xB4, 0x85, 0x23, 0x42, 0x16,
-	0x09, 0xF3, 0xC6, 0xA4, 0x1A, 0x80, 0x05, 0x03, 0xCA, 0x0D, 0xC0, 0x9C,
-	0x7E, 0xAF, 0xDF, 0x1F, 0x83, 0x08, 0x7D, 0xFA, 0x4B, 0x54, 0xA6, 0x08,
-	0x09, 0xA9, 0x01, 0x5E, 0x1B, 0x9A, 0x92, 0xD1, 0x06, 0x6E, 0x08, 0xB2,
-	0xFC, 0x20, 0x74, 0xEE, 0xEE, 0xEE, 0x6E, 0x6D, 0x6D, 0xBD, 0x78, 0xF1,
-	0x02, 0xC5, 0x68, 0x92, 0xAB, 0xC9, 0x65, 0xC1, 0x71, 0xB4, 0xD9, 0x6C,
-	0xA1, 0x50, 0x28, 0x16, 0x8B, 0xA5, 0x52, 0xA9, 0x71, 0x52, 0xC8, 0x38,
-	0xE6, 0x46, 0xD0, 0x9B, 0xE0, 0x31, 0xC5, 0x73, 0x02, 0xA0, 0x24, 0xA3,
-	0x0B, 0x3B, 0x0A, 0x0D, 0xA1, 0x20, 0x9E, 0x62, 0x55, 0xA9, 0xA2, 0x28,
-	0x24, 0xD1, 0xE1, 0xE0, 0xBF, 0x36, 0x71, 0xA8, 0x49, 0x96, 0x4A, 0x3D,
-	0xA3, 0x61, 0x70, 0x90, 0xFD, 0x0A, 0x79, 0xAC, 0x56, 0xAB, 0xCC, 0x0B,
-	0x6A, 0x16, 0x8B, 0xF5, 0x43, 0x38, 0xE9, 0x70, 0x5A, 0x70, 0x08, 0x80,
-	0x6A, 0xD1, 0xD1, 0xA2, 0x7A, 0x91, 0x04, 0x08, 0x60, 0xDD, 0x50, 0x65,
-	0x44, 0x89, 0x89, 0xC9, 0x90, 0xC5, 0xED, 0x74, 0x3A, 0x61, 0x45, 0x83,
-	0xC1, 0x20, 0xB2, 0xB0, 0xA8, 0x7E, 0x45, 0x2E, 0x37, 0x9B, 0xCD, 0x02,
-	0x4C, 0x94, 0xD9, 0x2E, 0xA6, 0xC0, 0xA8, 0x5E, 0xB0, 0x9D, 0x80, 0xCD,
-	0x6D, 0x36, 0x9B, 0xD9, 0x02, 0x87, 0xC3, 0x4C, 0x5B, 0x28, 0xB1, 0x07,
-	0x5C, 0x8A, 0x45, 0x5A, 0xA4, 0x1C, 0x8C, 0xD5, 0x20, 0x29, 0xD7, 0xB4,
-	0x81, 0x2C, 0xEC, 0x62, 0x45, 0x98, 0x06, 0xFF, 0xD3, 0x58, 0x05, 0x29,
-	0xE6, 0x44, 0x48, 0x48, 0x14, 0xC0, 0x35, 0x11, 0x4C, 0xD2, 0xA1, 0x94,
-	0xD4, 0x70, 0x6A, 0x24, 0x18, 0x43, 0xA7, 0xD3, 0xE9, 0x72, 0xB9, 0x50,
-	0x36, 0xE3, 0x76, 0xBB, 0xED, 0x36, 0xBB, 0x51, 0x31, 0x22, 0xC8, 0x22,
-	0x2C, 0x0C, 0xC8, 0x04, 0xCE, 0x0C, 0xA9, 0xAB, 0xAC, 0x2E, 0x76, 0xB9,
-	0x5C, 0x20, 0x30, 0x43, 0xA7, 0xE1, 0x0C, 0x81, 0xBD, 0x1C, 0x0C, 0x06,
-	0xA3, 0xD1, 0x68, 0x2C, 0x16, 0x73, 0xBB, 0xDC, 0x95, 0x6A, 0xE5, 0xE8,
-	0xE8, 0x08, 0x31, 0x8A, 0xC1, 0x60, 0x38, 0x3E, 0x3E, 0xDE, 0xDF, 0xDF,
-	0x2F, 0x97, 0xCB, 0x44, 0xFC, 0x25, 0x91, 0x5D, 0xD6, 0x86, 0x40, 0xA5,
-	0xF4, 0x7A, 0x3D, 0xB7, 0xDB, 0x0D, 0x47, 0xC8, 0xE1, 0x74, 0x90, 0xF1,
-	0x28, 0x65, 0x94, 0x67, 0x88, 0x3A, 0x86, 0x84, 0x04, 0x80, 0xE4, 0x46,
-	0xA3, 0x51, 0x41, 0x51, 0x1C, 0xB0, 0x46, 0x2C, 0x16, 0x4C, 0x07, 0x3C,
-	0x59, 0x99, 0xE9, 0xD6, 0xE8, 0x7D, 0xBE, 0xB6, 0x0C, 0xB2, 0x65, 0x5D,
-	0x03, 0xF5, 0xB5, 0x74, 0xE7, 0x71, 0x0B, 0xA9, 0x22, 0x70, 0xAE, 0x91,
-	0x02, 0xF3, 0xFB, 0xFD, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x91, 0x48,
-	0x04, 0x28, 0xA1, 0xAA, 0xA8, 0xC3, 0xD1, 0x10, 0x2E, 0x5D, 0xA1, 0x50,
-	0x00, 0x93, 0x17, 0x5E, 0x16, 0x89, 0x40, 0x7C, 0x24, 0x64, 0x9B, 0x3B,
-	0x9D, 0x8E, 0xDF, 0xEF, 0x47, 0x89, 0x0E, 0xFC, 0x74, 0xAF, 0xD7, 0x1B,
-	0x89, 0x44, 0xE6, 0xE6, 0xE6, 0xA6, 0xA6, 0xA6, 0x7C, 0x3E, 0x9F, 0xC9,
-	0x64, 0x4A, 0x24, 0x12, 0xA7, 0xA9, 0x53, 0xD4, 0xBD, 0xB6, 0x5A, 0xAD,
-	0x5E, 0xBF, 0x97, 0xCD, 0x64, 0xC1, 0xC3, 0xA5, 0xEA, 0x9F, 0x24, 0x43,
-	0x10, 0x49, 0x4E, 0xA7, 0xD3, 0xE9, 0x74, 0x7A, 0x6E, 0x6E, 0x6E, 0x7E,
-	0x7E, 0x1E, 0x81, 0xAE, 0xD9, 0x64, 0x46, 0x70, 0x8B, 0x4C, 0x0E, 0xD4,
-	0x8B, 0x86, 0x0E, 0x4C, 0xD9, 0x65, 0x85, 0x9A, 0xC5, 0x62, 0x51, 0xA6,
-	0xA6, 0xA6, 0xBC, 0x5E, 0xEF, 0x68, 0x34, 0xC2, 0xD3, 0xE0, 0x0F, 0x14,
-	0x65, 0x8C, 0x92, 0x52, 0xCA, 0x20, 0x11, 0x72, 0x93, 0x35, 0xA5, 0xC5,
-	0x1A, 0xA7, 0x48, 0x56, 0xF6, 0x90, 0x1F, 0xA7, 0xC1, 0xF8, 0xE0, 0xE7,
-	0x90, 0x02, 0x1C, 0x0A, 0x85, 0x66, 0x66, 0x66, 0x1C, 0x0E, 0x47, 0xB7,
-	0xDB, 0x3D, 0x3C, 0x3C, 0xA4, 0x26, 0x94, 0x91, 0x1A, 0xF9, 0x45, 0x63,
-	0x08, 0xA4, 0xD9, 0xA4, 0x94, 0x41, 0xC5, 0xD1, 0x6C, 0x12, 0xD6, 0x9F,
-	0x9F, 0x9F, 0xBF, 0x78, 0xF1, 0xE2, 0xFA, 0xFA, 0x3A, 0x9E, 0xAD, 0xD3,
-	0xE9, 0x80, 0xF6, 0x0C, 0x74, 0x0F, 0x0C, 0xCE, 0x76, 0xBB, 0x0D, 0x36,
-	0x9C, 0x74, 0x13, 0x27, 0xB1, 0x42, 0xDC, 0xB4, 0x5A, 0xAD, 0xA6, 0xD3,
-	0xE9, 0xFD, 0xFD, 0xFD, 0xE9, 0xE9, 0xE9, 0x33, 0x67, 0xCE, 0x74, 0xBB,
-	0x5D, 0x50, 0xF6, 0x72, 0xB9, 0x5C, 0xB1, 0x58, 0x84, 0x28, 0x63, 0x57,
-	0x48, 0xDE, 0x62, 0xE4, 0xCF, 0x32, 0x34, 0x70, 0x2C, 0x1D, 0x0E, 0x87,
-	0x12, 0x8F, 0xC7, 0x2B, 0x95, 0x0A, 0x0A, 0x54, 0xA0, 0x28, 0x64, 0x0E,
-	0xCF, 0xEB, 0xF5, 0xDA, 0xED, 0xF6, 0x7A, 0xA3, 0xDE, 0x6A, 0xB6, 0xA4,
-	0x5E, 0x93, 0xDA, 0x7F, 0xD2, 0xFC, 0x12, 0x99, 0x90, 0xA4, 0x0F, 0x0D,
-	0x07, 0x94, 0xEE, 0x16, 0x5C, 0x0B, 0x9F, 0xCF, 0xE7, 0xF5, 0x7A, 0xAB,
-	0x95, 0xEA, 0xE9, 0xE9, 0x29, 0x1D, 0x1E, 0x4D, 0x94, 0xC0, 0x74, 0x0D,
-	0x57, 0x84, 0xC9, 0x29, 0xA6, 0x03, 0xE1, 0x83, 0x42, 0x6E, 0x6A, 0xD5,
-	0x1A, 0x84, 0xBA, 0xD7, 0xEB, 0x25, 0x12, 0x09, 0xA4, 0x94, 0x01, 0x91,
-	0x8E, 0xBF, 0x50, 0xAB, 0x35, 0x1A, 0x0D, 0xF2, 0x97, 0x68, 0xBA, 0x64,
-	0x58, 0x23, 0x7F, 0x80, 0xE3, 0x00, 0xD2, 0xCD, 0xC1, 0xC1, 0xC1, 0xCC,
-	0xCC, 0xCC, 0xF2, 0xF2, 0xF2, 0xF9, 0xF3, 0xE7, 0xA3, 0xD1, 0x68, 0x2E,
-	0x97, 0xCB, 0x66, 0xB3, 0xA7, 0xA7, 0xA7, 0xC9, 0x64, 0xD2, 0xE1, 0x70,
-	0x64, 0xB3, 0x59, 0x93, 0xC9, 0x54, 0xAB, 0xD5, 0x00, 0xCB, 0xCB, 0xFA,
-	0x06, 0x78, 0x01, 0x08, 0x83, 0x23, 0x91, 0x88, 0x52, 0x2C, 0x16, 0x13,
-	0x89, 0x04, 0xA0, 0x57, 0x99, 0x5B, 0x60, 0xC5, 0xBA, 0xCF, 0xE7, 0x03,
-	0xC4, 0xAF, 0x39, 0x9B, 0x12, 0x44, 0xE3, 0x06, 0x30, 0xC6, 0xE3, 0x6E,
-	0x69, 0x02, 0x10, 0xC9, 0x64, 0x62, 0x79, 0x1B, 0x94, 0x29, 0xB8, 0x5C,
-	0xCC, 0x38, 0x4A, 0xD4, 0x53, 0x62, 0x0F, 0xD8, 0x06, 0x9A, 0x99, 0x57,
-	0x1C, 0xD8, 0x2F, 0xA2, 0x0A, 0x3A, 0x1E, 0xDD, 0x5E, 0x17, 0xB5, 0x98,
-	0xEF, 0xBF, 0xFF, 0xBE, 0xAC, 0x2A, 0x95, 0x88, 0xBC, 0x04, 0x9C, 0x59,
-	0xA8, 0x84, 0x9F, 0xF9, 0x0A, 0xD2, 0xB6, 0x41, 0x0B, 0x55, 0x2A, 0x95,
-	0x54, 0x2A, 0xB5, 0xB7, 0xB7, 0x17, 0x08, 0x04, 0x00, 0xE9, 0xCC, 0xCC,
-	0xCC, 0x00, 0xC0, 0x38, 0x3A, 0x3E, 0x7A, 0xB1, 0xF5, 0x62, 0x67, 0x67,
-	0xE7, 0xF8, 0xF8, 0x18, 0x35, 0x8A, 0x0C, 0xB0, 0xA0, 0x6C, 0xB1, 0xFA,
-	0x5E, 0xAF, 0x77, 0x61, 0x61, 0xC1, 0xE7, 0xF3, 0x29, 0x08, 0x80, 0x81,
-	0x5B, 0xB1, 0x5A, 0x18, 0x58, 0x3F, 0xF4, 0x32, 0xBC, 0x05, 0x94, 0x2A,
-	0xE0, 0x9D, 0x81, 0xD6, 0x32, 0xEB, 0xC4, 0xBF, 0x82, 0xBB, 0x82, 0xE8,
-	0x91, 0x96, 0x40, 0xA6, 0x0F, 0x25, 0x83, 0x83, 0x5A, 0xC5, 0x6A, 0xB5,
-	0x06, 0x02, 0x01, 0xDD, 0x48, 0x07, 0x55, 0xC0, 0x32, 0x58, 0x4D, 0xBE,
-	0x5B, 0x6E, 0x80, 0x2C, 0xD5, 0x23, 0xA3, 0x5B, 0xAA, 0x5A, 0x82, 0x16,
-	0xB9, 0x5C, 0xAE, 0x50, 0x28, 0x40, 0xE1, 0xD2, 0x4A, 0x51, 0x15, 0x30,
-	0xF9, 0x0E, 0x4B, 0x0E, 0x4C, 0x14, 0x17, 0x91, 0x1C, 0x2F, 0x59, 0xF3,
-	0x0D, 0x0F, 0x05, 0xB5, 0x9B, 0xB9, 0x6C, 0x2E, 0x9F, 0xCF, 0x7B, 0x3C,
-	0x1E, 0xD6, 0xB1, 0x4E, 0x4D, 0x4D, 0xC5, 0xA6, 0x62, 0x73, 0xB3, 0x73,
-	0xC1, 0x60, 0x10, 0xDC, 0x0B, 0x93, 0xC9, 0xC4, 0x0D, 0xC6, 0xAA, 0xC2,
-	0xD4, 0xCD, 0xCF, 0xCF, 0x2F, 0x2C, 0x2C, 0x6C, 0x6F, 0x6F, 0x2B, 0x74,
-	0xC3, 0x69, 0x54, 0xA1, 0xA1, 0x9C, 0x4E, 0x67, 0x38, 0x1C, 0x9E, 0x99,
-	0x99, 0x99, 0x9E, 0x9E, 0x8E, 0x46, 0xA3, 0xE5, 0x72, 0x19, 0xB4, 0x14,
-	0x40, 0xBE, 0xD9, 0x6C, 0x56, 0x37, 0xD2, 0xD1, 0xEF, 0x26, 0xEF, 0x13,
-	0xA1, 0x3F, 0xCB, 0x0A, 0x35, 0x74, 0x1D, 0x59, 0x01, 0x40, 0xF7, 0xDC,
-	0x6E, 0xB7, 0x7B, 0x3C, 0x1E, 0xC0, 0x55, 0x92, 0xDD, 0x4F, 0xC5, 0x25,
-	0x1D, 0x5F, 0x78, 0xC6, 0x1A, 0xB0, 0x56, 0xE3, 0x05, 0x60, 0xAD, 0x21,
-	0x77, 0x85, 0x42, 0x81, 0x8D, 0x3B, 0xE0, 0x8C, 0xE2, 0x07, 0x6C, 0x03,
-	0xB4, 0x10, 0x30, 0x1F, 0xF8, 0x27, 0x78, 0x1E, 0xE4, 0x33, 0x90, 0x24,
-	0x20, 0xC6, 0x45, 0xDA, 0x0B, 0xB6, 0xA1, 0xDB, 0xED, 0x36, 0x9A, 0x8D,
-	0x6A, 0xB5, 0xDA, 0xEF, 0xF5, 0x19, 0x5E, 0x01, 0xED, 0x89, 0xC5, 0x62,
-	0x60, 0x81, 0x3C, 0x7E, 0xF2, 0xF8, 0xF0, 0xE0, 0x30, 0x9B, 0x1D, 0x77,
-	0x79, 0xD0, 0xEB, 0xF5, 0xC8, 0x13, 0x2C, 0x2D, 0x2E, 0x7D, 0xE5, 0xFA,
-	0x57, 0x0E, 0x0F, 0x0F, 0xCB, 0xE5, 0xB2, 0x42, 0x74, 0x9B, 0xB4, 0x1C,
-	0x38, 0xE0, 0x60, 0x85, 0xCC, 0xCE, 0xCE, 0xBE, 0xF9, 0xE6, 0x9B, 0x2B,
-	0x2B, 0x2B, 0xA3, 0xD1, 0x28, 0x9F, 0xCF, 0x17, 0x8B, 0xC5, 0x83, 0x83,
-	0x83, 0xBB, 0x77, 0xEF, 0xE2, 0xFC, 0xE2, 0x8C, 0x13, 0xA3, 0x86, 0xEA,
-	0xE4, 0x53, 0xBE, 0xD6, 0x55, 0xD5, 0x84, 0x48, 0xD0, 0x3F, 0x7E, 0xBF,
-	0x1F, 0xC8, 0x36, 0x33, 0x62, 0x74, 0x9C, 0x64, 0x94, 0x4B, 0x61, 0x97,
-	0x56, 0x41, 0xDA, 0x00, 0x1C, 0x0E, 0x90, 0x68, 0xC6, 0xEE, 0xB5, 0x62,
-	0xB4, 0x98, 0x2D, 0xF0, 0xD0, 0x01, 0xCD, 0x22, 0x92, 0x42, 0x79, 0x10,
-	0x6C, 0x80, 0x4C, 0x20, 0xAB, 0xAA, 0x0A, 0xA4, 0xD3, 0x66, 0xB3, 0x31,
-	0x15, 0xC3, 0xF7, 0x02, 0xDC, 0x8F, 0x15, 0x1B, 0x43, 0xE5, 0xBD, 0xEE,
-	0x68, 0x34, 0xD2, 0xE9, 0x75, 0xBA, 0xD1, 0x2B, 0x39, 0x40, 0xA1, 0xCE,
-	0x70, 0x38, 0xB4, 0x59, 0x6D, 0x6E, 0xB7, 0x1B, 0x4C, 0x48, 0x24, 0xC3,
-	0x3D, 0xE7, 0x5E, 0x2E, 0xF4, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44, 0x41,
-	0x54, 0x5E, 0xCF, 0xF2, 0xD2, 0xF2, 0x37, 0xBE, 0xF1, 0x8D, 0x85, 0x85,
-	0x85, 0x5C, 0x2E, 0x67, 0x32, 0x99, 0x94, 0x49, 0x99, 0x85, 0xAE, 0xA4,
-	0x7E, 0x2C, 0xE4, 0x0B, 0x47, 0x47, 0x47, 0xAB, 0xAB, 0xAB, 0xA8, 0xCB,
-	0x40, 0x33, 0xA3, 0x5F, 0xFD, 0xEA, 0x57, 0x8F, 0x1E, 0x3D, 0x4A, 0xA7,
-	0xD3, 0x70, 0xB9, 0xD8, 0xF6, 0x88, 0x20, 0x9A, 0x4C, 0x56, 0xC8, 0x94,
-	0x85, 0x34, 0x00, 0xD8, 0x6F, 0xB7, 0xDB, 0x1D, 0x8F, 0xC7, 0x99, 0x84,
-	0x41, 0x78, 0x4C, 0xF0, 0x52, 0xC3, 0x3C, 0x90, 0x90, 0x1C, 0x01, 0x54,
-	0xC9, 0xC4, 0x42, 0xCE, 0x52, 0x32, 0x5C, 0x0C, 0x7A, 0x03, 0x0F, 0xA8,
-	0xAA, 0xA8, 0x0E, 0x87, 0x23, 0x14, 0x0A, 0x29, 0x8A, 0x92, 0x4C, 0x26,
-	0x71, 0xA0, 0xE9, 0x7A, 0x42, 0x29, 0xE1, 0x08, 0x86, 0xC3, 0xE1, 0x58,
-	0x2C, 0x86, 0xFF, 0x2B, 0x13, 0x32, 0x38, 0x46, 0xE3, 0xBA, 0xC1, 0xE1,
-	0x68, 0x38, 0x1C, 0x76, 0xBA, 0x1D, 0x93, 0xD9, 0xC4, 0xD5, 0x2B, 0x14,
-	0x0A, 0x27, 0x27, 0x27, 0x47, 0x47, 0x47, 0xC7, 0xC7, 0xC7, 0xC9, 0x64,
-	0xB2, 0x58, 0x2C, 0x96, 0xCB, 0xE5, 0x76, 0xAB, 0x3D, 0xD2, 0x8D, 0x50,
-	0x16, 0x89, 0x0C, 0x15, 0xF0, 0x3B, 0xB3, 0xD9, 0xAC, 0xE0, 0x74, 0x48,
-	0xBE, 0x11, 0x1E, 0x1D, 0x75, 0xEB, 0xC5, 0x62, 0x31, 0x79, 0x92, 0x7C,
-	0xF6, 0xFC, 0x19, 0xE2, 0x97, 0x58, 0x2C, 0x16, 0x0A, 0x85, 0x7C, 0x3E,
-	0xDF, 0x8D, 0x1B, 0x37, 0x02, 0x81, 0xC0, 0xFD, 0xFB, 0xF7, 0x8F, 0x8F,
-	0x8F, 0x01, 0x9B, 0x40, 0x7C, 0xE0, 0xB9, 0x6A, 0x00, 0x4E, 0x2C, 0x0D,
-	0xAE, 0x3C, 0x59, 0x62, 0x6F, 0xB3, 0xD9, 0x2E, 0x5F, 0xBE, 0x1C, 0x89,
-	0x44, 0xB2, 0xD9, 0x2C, 0x91, 0x89, 0xF1, 0x7A, 0x7D, 0x11, 0x00, 0xFF,
-	0x81, 0x22, 0x6C, 0xFE, 0x46, 0xF2, 0x9F, 0x28, 0xA4, 0xD2, 0x68, 0x2B,
-	0x8A, 0xE2, 0x70, 0x3A, 0x50, 0x0A, 0x09, 0x5E, 0x66, 0x57, 0x7C, 0x24,
-	0x1D, 0x84, 0xBB, 0x1B, 0x89, 0x44, 0xE0, 0x53, 0x32, 0xB1, 0x8A, 0x03,
-	0x84, 0x23, 0xA2, 0x28, 0x4A, 0x2E, 0x9B, 0xBB, 0x77, 0xEF, 0x5E, 0x38,
-	0x1C, 0x8E, 0xC7, 0xE3, 0xA8, 0x3C, 0x4C, 0xA7, 0xD3, 0xE8, 0x50, 0x74,
-	0x7A, 0x7A, 0x9A, 0xCD, 0x66, 0xE1, 0x74, 0x41, 0xC9, 0xA3, 0x9F, 0xD4,
-	0x60, 0x30, 0xB8, 0x73, 0xE7, 0x0E, 0x5A, 0x65, 0x14, 0x0A, 0x85, 0xF1,
-	0xD5, 0xF1, 0x34, 0xF4, 0x55, 0x40, 0x75, 0x07, 0x9F, 0xB9, 0x5A, 0xAD,
-	0xE6, 0x0B, 0xF9, 0x44, 0x22, 0x81, 0x18, 0x15, 0x81, 0x1B, 0xB8, 0x7C,
-	0x37, 0x6E, 0xDC, 0x48, 0x26, 0x93, 0x87, 0x87, 0x87, 0xA5, 0x52, 0x69,
-	0x30, 0x18, 0x98, 0xCD, 0x66, 0xC8, 0xAF, 0x06, 0x86, 0xA3, 0x7F, 0x22,
-	0x43, 0x68, 0x46, 0xE0, 0x66, 0xB3, 0x79, 0x6D, 0x6D, 0x0D, 0xC5, 0x43,
-	0x38, 0xF2, 0x3C, 0xF5, 0x32, 0x62, 0xE4, 0xD5, 0x34, 0xE4, 0x06, 0xEE,
-	0x90, 0x2C, 0xD7, 0x96, 0xA4, 0x07, 0x9C, 0x7D, 0x2C, 0x9C, 0xCF, 0xE7,
-	0x43, 0x47, 0xB2, 0x64, 0x32, 0x49, 0xAE, 0x15, 0x20, 0x0D, 0x2A, 0x37,
-	0xEE, 0x22, 0x1E, 0x3B, 0x1E, 0x8F, 0xCF, 0xCD, 0xCF, 0x8D, 0x86, 0xE3,
-	0x4E, 0x36, 0x40, 0x09, 0xA1, 0xCD, 0xD2, 0x99, 0xF4, 0x49, 0xF2, 0x04,
-	0xC9, 0xE4, 0xD9, 0xD9, 0xD9, 0xF5, 0xF5, 0xF5, 0x68, 0x34, 0xDA, 0x6A,
-	0xB5, 0x40, 0x5E, 0x2E, 0x14, 0x0A, 0xE0, 0x50, 0xC1, 0xB5, 0x83, 0x67,
-	0x85, 0x10, 0xFD, 0xDE, 0xBD, 0x7B, 0xAD, 0x56, 0x0B, 0xED, 0xDD, 0x14,
-	0x59, 0xB7, 0xA5, 0xA1, 0xF1, 0x28, 0x8A, 0x02, 0x1A, 0xB3, 0xC5, 0x62,
-	0x29, 0x97, 0xCB, 0xC0, 0x67, 0x00, 0x52, 0x02, 0x4E, 0x99, 0x9B, 0x9B,
-	0xDB, 0xD8, 0xD8, 0xB8, 0x7C, 0xF9, 0x72, 0x26, 0x93, 0xC1, 0x5D, 0x77,
-	0x77, 0x77, 0xC9, 0xAF, 0x82, 0xDC, 0x49, 0xCF, 0x44, 0x46, 0x61, 0x5C,
-	0x53, 0x9D, 0x4E, 0x57, 0x28, 0x14, 0x06, 0xC3, 0x01, 0x2C, 0x98, 0x74,
-	0x6A, 0xF9, 0x33, 0x9E, 0x81, 0x88, 0x98, 0xA4, 0xF7, 0x30, 0x6E, 0x82,
-	0xFF, 0x2E, 0xC1, 0x51, 0x69, 0xBA, 0x2D, 0x16, 0x0B, 0x7C, 0x8F, 0x2B,
-	0x57, 0xAE, 0x78, 0x3C, 0x1E, 0x02, 0xAB, 0x7C, 0x6B, 0x99, 0x74, 0xE2,
-	0xDF, 0x66, 0xB3, 0x59, 0x44, 0xB3, 0x91, 0x48, 0xC4, 0xE3, 0xF5, 0xE8,
-	0x75, 0xE3, 0x58, 0x0F, 0xBD, 0xBB, 0xBA, 0xDD, 0xEE, 0x60, 0x38, 0x80,
-	0x5A, 0xCB, 0x64, 0x32, 0xA9, 0x54, 0x6A, 0x75, 0x75, 0xD5, 0x66, 0xB3,
-	0x41, 0x97, 0xD6, 0x6B, 0x75, 0x7E, 0x88, 0x7A, 0x91, 0x10, 0x8E, 0x03,
-	0x34, 0x1C, 0x0E, 0x15, 0x92, 0xE0, 0x64, 0xC4, 0x84, 0x65, 0xA2, 0x61,
-	0xEC, 0x74, 0x3A, 0x60, 0x6C, 0x03, 0x84, 0x32, 0x9B, 0xCD, 0xC8, 0xE7,
-	0x75, 0xBB, 0x5D, 0xB3, 0xD9, 0xFC, 0xDD, 0xEF, 0x7E, 0xF7, 0xFA, 0xF5,
-	0xEB, 0x89, 0x44, 0xE2, 0xBF, 0xFE, 0xEB, 0xBF, 0x24, 0x5B, 0x56, 0x55,
-	0x55, 0x59, 0x9D, 0xC2, 0xC6, 0x46, 0x92, 0x1D, 0x84, 0xDC, 0xEF, 0x7B,
-	0xEF, 0xBD, 0x37, 0xBF, 0x30, 0xEF, 0x76, 0xBB, 0x89, 0xEB, 0x92, 0x77,
-	0x2F, 0x55, 0x0D, 0x1A, 0xC6, 0xE0, 0x48, 0x8D, 0xB3, 0x19, 0x8A, 0x82,
-	0xE0, 0x88, 0x91, 0x9D, 0x4C, 0x33, 0x10, 0x85, 0x45, 0x16, 0xC5, 0x62,
-	0xB1, 0x18, 0x0D, 0x46, 0xBF, 0xDF, 0x0F, 0x37, 0x49, 0x3A, 0x5A, 0x92,
-	0x5D, 0x02, 0xE3, 0x0F, 0x3C, 0x06, 0x72, 0x3A, 0x18, 0x0C, 0x1A, 0x8D,
-	0x06, 0x9C, 0x6C, 0xDC, 0x0E, 0x59, 0x5B, 0xFC, 0x95, 0xD1, 0x68, 0x44,
-	0x6D, 0x16, 0x7C, 0xAA, 0xD9, 0xD9, 0x59, 0x93, 0xC9, 0x34, 0x1C, 0x0D,
-	0xA1, 0x42, 0x64, 0x7B, 0x29, 0x02, 0x73, 0xB0, 0x46, 0x73, 0x73, 0x73,
-	0x66, 0x93, 0x59, 0x41, 0x1A, 0x1A, 0x18, 0x0E, 0x77, 0x42, 0xA6, 0x1B,
-	0xB1, 0x9A, 0x00, 0xD4, 0xB0, 0xFA, 0x80, 0x5C, 0x70, 0xB4, 0x93, 0xC9,
-	0xE4, 0xC7, 0x1F, 0x7F, 0x8C, 0x82, 0x34, 0xE4, 0xFF, 0xC6, 0x55, 0x9C,
-	0x5F, 0x88, 0x3F, 0x5D, 0x55, 0x1E, 0x6D, 0xC9, 0xBA, 0x18, 0x0C, 0x06,
-	0xE5, 0x72, 0xF9, 0xD9, 0xB3, 0x67, 0x3A, 0x9D, 0xCE, 0xEF, 0xF7, 0xDB,
-	0x6C, 0x36, 0x38, 0x85, 0x94, 0x62, 0x99, 0x73, 0xC6, 0x9F, 0xFB, 0x7C,
-	0x3E, 0x24, 0x02, 0xD9, 0xF3, 0x0F, 0x8E, 0xC7, 0x64, 0x15, 0x11, 0xE1,
-	0x55, 0xB7, 0xDB, 0x0D, 0x55, 0x9E, 0xC9, 0x66, 0x4A, 0xA5, 0x12, 0x24,
-	0x43, 0x1E, 0x7A, 0x4D, 0x12, 0x90, 0xC1, 0x23, 0xD0, 0x7C, 0xEC, 0x37,
-	0x12, 0x79, 0x3C, 0x37, 0x72, 0x03, 0x48, 0xBF, 0x00, 0x68, 0xE8, 0xF3,
-	0xF9, 0x00, 0x61, 0xE1, 0xCB, 0x30, 0xB1, 0xEC, 0x00, 0x40, 0x75, 0x67,
-	0x54, 0x8C, 0xA1, 0x50, 0x48, 0x09, 0x85, 0x42, 0xC4, 0x3E, 0x65, 0x41,
-	0x88, 0xC4, 0x02, 0x71, 0x63, 0x9C, 0x71, 0x46, 0xFF, 0xE8, 0x32, 0x80,
-	0x84, 0x9A, 0xD3, 0xE9, 0x44, 0x45, 0x31, 0x6A, 0x86, 0xE0, 0x75, 0x91,
-	0x52, 0x27, 0xEB, 0x3D, 0x89, 0x4E, 0x53, 0x0C, 0xD1, 0x67, 0x22, 0x95,
-	0x4A, 0xF9, 0x7C, 0x3E, 0x8F, 0xC7, 0x03, 0xAC, 0x8D, 0x28, 0xAC, 0xDC,
-	0x03, 0x96, 0xFA, 0x0F, 0x06, 0x83, 0x60, 0x30, 0xE8, 0xF1, 0x78, 0x58,
-	0x7B, 0x03, 0x45, 0xC1, 0x96, 0x1A, 0xBC, 0x85, 0xD5, 0x6A, 0x75, 0x3A,
-	0x9D, 0x26, 0xB3, 0xA9, 0xDD, 0x6A, 0xE3, 0x7C, 0xEC, 0xEF, 0xEF, 0x9F,
-	0x9C, 0x9C, 0xC8, 0x12, 0xF3, 0x2F, 0x4B, 0x34, 0xB1, 0xB6, 0x10, 0xAB,
-	0x86, 0x7D, 0xA5, 0x24, 0x4D, 0x76, 0xF9, 0x84, 0xE4, 0x01, 0xE8, 0x97,
-	0x3C, 0x01, 0x0D, 0x64, 0xA2, 0x81, 0x25, 0x14, 0xA3, 0xD1, 0x88, 0xBE,
-	0x64, 0xFC, 0x4C, 0x3E, 0x10, 0xF5, 0x92, 0x4C, 0xA6, 0xE3, 0x21, 0xAA,
-	0xD5, 0x2A, 0xEC, 0x24, 0x79, 0x7A, 0x6C, 0xEA, 0x44, 0x3C, 0x95, 0x31,
-	0xED, 0x6B, 0xB3, 0x9B, 0x10, 0x93, 0x46, 0xA3, 0x81, 0x66, 0x17, 0xE9,
-	0x74, 0x1A, 0x6E, 0xB1, 0x2C, 0x58, 0xE3, 0x0F, 0xED, 0x76, 0x9B, 0x9D,
-	0xDD, 0x42, 0xA1, 0x90, 0xCB, 0xE5, 0xB2, 0xDB, 0xED, 0xE5, 0x72, 0x19,
-	0x51, 0x15, 0x09, 0x68, 0x58, 0x0E, 0xA0, 0x5D, 0x1E, 0x8F, 0xC7, 0xA0,
-	0x1F, 0xD3, 0x99, 0x4C, 0x66, 0x13, 0xAA, 0xE0, 0xD1, 0x31, 0xF4, 0x0F,
-	0x37, 0x1A, 0xD2, 0x9C, 0x09, 0xD6, 0x79, 0x49, 0xEE, 0xBB, 0xFC, 0x02,
-	0x84, 0x1D, 0x67, 0x11, 0x61, 0xB0, 0x4C, 0xCF, 0x49, 0xCF, 0x02, 0xAD,
-	0xF4, 0x8C, 0x46, 0x63, 0x26, 0x93, 0x51, 0x50, 0xDC, 0x6D, 0x36, 0x9B,
-	0x9F, 0x3E, 0x7D, 0xAA, 0x01, 0x70, 0x34, 0x42, 0xC1, 0x14, 0x0F, 0xAF,
-	0x85, 0x43, 0x27, 0x3B, 0xDE, 0xC9, 0x2A, 0x54, 0x06, 0xD8, 0xF2, 0x8C,
-	0x6B, 0x18, 0xF4, 0xCC, 0xF3, 0x19, 0x8D, 0x46, 0x8F, 0xC7, 0x13, 0x8D,
-	0x46, 0xB1, 0x3A, 0x60, 0x28, 0x4D, 0x76, 0x97, 0x91, 0x2A, 0xA2, 0xD3,
-	0xE9, 0xA0, 0x6A, 0x1C, 0xFA, 0x1D, 0x50, 0x12, 0xD3, 0x00, 0x4C, 0x5D,
-	0x39, 0x9D, 0xCE, 0x5E, 0xBF, 0xA7, 0x18, 0x15, 0x9F, 0xCF, 0xD7, 0xEB,
-	0xF6, 0xB6, 0x5F, 0x6E, 0x67, 0xB3, 0x59, 0x62, 0x56, 0x93, 0xE9, 0x26,
-	0x59, 0x0E, 0x4F, 0x02, 0x1D, 0x61, 0x76, 0x99, 0x16, 0x94, 0xFD, 0x3D,
-	0xA1, 0x88, 0x98, 0xED, 0x82, 0xCA, 0x62, 0x84, 0xAC, 0xC9, 0x82, 0xE0,
-	0x46, 0x40, 0xD8, 0x14, 0xE0, 0xB1, 0x97, 0x2E, 0x5D, 0xB2, 0x58, 0x2C,
-	0x0F, 0x1E, 0x3C, 0xE0, 0x12, 0x6B, 0xD8, 0x1F, 0xDC, 0x70, 0x30, 0x38,
-	0x29, 0xD1, 0x52, 0x51, 0x48, 0xE2, 0xBC, 0xA6, 0xA3, 0x9E, 0xA6, 0xEA,
-	0x8F, 0x07, 0x16, 0x8F, 0x6B, 0xB3, 0xD9, 0x82, 0xC1, 0xE0, 0xEC, 0xEC,
-	0x6C, 0xB7, 0xDB, 0x7D, 0xFA, 0xF4, 0x69, 0xA5, 0x52, 0x21, 0xA1, 0x55,
-	0xC3, 0x6A, 0xD6, 0x64, 0x7D, 0x01, 0x8D, 0xF9, 0x7C, 0x3E, 0xD4, 0xCE,
-	0x9B, 0xCD, 0x66, 0x06, 0x71, 0xAA, 0xAA, 0x62, 0x47, 0xAD, 0x56, 0x6B,
-	0xB7, 0xDB, 0x75, 0xB9, 0x5C, 0x3E, 0x9F, 0xEF, 0xE0, 0xE0, 0x00, 0xDD,
-	0xA3, 0x10, 0xC9, 0x33, 0x81, 0x21, 0xCB, 0x66, 0xD9, 0x39, 0x0C, 0x15,
-	0xC5, 0x76, 0xBB, 0x1D, 0xBF, 0x99, 0x24, 0xB6, 0x22, 0xEA, 0x66, 0x69,
-	0xA6, 0xAA, 0xAA, 0x81, 0x40, 0xC0, 0xEB, 0xF1, 0x1A, 0x8C, 0x06, 0x74,
-	0xB3, 0x00, 0x79, 0x4B, 0x63, 0xCC, 0xB0, 0x86, 0x00, 0xC6, 0x9B, 0xCD,
-	0xA6, 0x02, 0x16, 0xA6, 0xC7, 0xE3, 0xF9, 0xDB, 0xBF, 0xFD, 0xDB, 0xC1,
-	0x60, 0xF0, 0xF0, 0xE1, 0x43, 0x2A, 0x9C, 0x49, 0x75, 0x24, 0xBD, 0x7B,
-	0x99, 0x7D, 0x96, 0xB0, 0xF3, 0x6B, 0xCB, 0x6B, 0x35, 0xBD, 0xC2, 0x98,
-	0xA4, 0x25, 0x5B, 0x2F, 0x16, 0x8B, 0x5D, 0xBE, 0x7C, 0x59, 0xA7, 0xD3,
-	0x79, 0x3C, 0x9E, 0x71, 0xF5, 0xDA, 0x17, 0xB5, 0x2E, 0x52, 0x48, 0x09,
-	0xB8, 0x4A, 0x7C, 0x09, 0xEB, 0xE2, 0xF3, 0xF9, 0xA6, 0xA7, 0xA7, 0xC7,
-	0x8C, 0xD2, 0xD1, 0xD0, 0x6A, 0xB6, 0xFA, 0x03, 0xFE, 0xA5, 0xA5, 0x25,
-	0x8F, 0xC7, 0x83, 0x78, 0xF8, 0xF9, 0xD6, 0x73, 0x70, 0x9F, 0x68, 0x93,
-	0x28, 0xBF, 0x7C, 0x11, 0x72, 0x0B, 0xD1, 0xCD, 0x04, 0x41, 0xAF, 0xC9,
-	0x64, 0x32, 0x99, 0x4D, 0x76, 0x9B, 0xFD, 0x55, 0x9D, 0x9E, 0x4E, 0x6F,
-	0x54, 0x8C, 0xA5, 0x52, 0x09, 0x6C, 0x12, 0x38, 0xC1, 0x83, 0xC1, 0xC0,
-	0x66, 0xB3, 0xCD, 0xCC, 0xCC, 0x04, 0x02, 0x01, 0x74, 0xA4, 0x42, 0x87,
-	0x01, 0x59, 0x27, 0x2B, 0x0B, 0x4F, 0xC1, 0x41, 0x56, 0xD0, 0xAA, 0xF4,
-	0xF0, 0xF0, 0xF0, 0xF6, 0xED, 0xDB, 0xFF, 0xF4, 0x4F, 0xFF, 0xF4, 0xAF,
-	0xFF, 0xFA, 0xAF, 0xA4, 0x4E, 0xC8, 0x1E, 0x3B, 0x92, 0x3B, 0x45, 0x8A,
-	0xAB, 0x4C, 0x78, 0x69, 0x72, 0x96, 0xAF, 0xB5, 0x6C, 0xDC, 0x3C, 0x96,
-	0x68, 0xE1, 0xF5, 0xA0, 0xCA, 0xDC, 0x6E, 0xF7, 0x6C, 0x7C, 0x36, 0x10,
-	0x08, 0x24, 0x12, 0x09, 0x3A, 0x66, 0x6C, 0x8E, 0xAA, 0x49, 0x4E, 0x69,
-	0xDA, 0x32, 0x37, 0x9B, 0x4D, 0x10, 0x46, 0x22, 0x91, 0x08, 0x0E, 0x01,
-	0xB0, 0xC9, 0x5B, 0xB7, 0x6E, 0x9D, 0x3B, 0x77, 0xAE, 0x50, 0x28, 0xFC,
-	0x9F, 0xFF, 0xFF, 0xFF, 0xA4, 0xD3, 0x69, 0x96, 0x19, 0x31, 0x4F, 0x8B,
-	0x1A, 0x10, 0xEA, 0x13, 0xE8, 0x43, 0x90, 0x01, 0x98, 0xF9, 0xC1, 0x1B,
-	0x39, 0x1D, 0xCE, 0xE9, 0xA9, 0x69, 0x83, 0xD1, 0x00, 0xE8, 0x17, 0xD0,
-	0x24, 0x12, 0x6A, 0x44, 0x5F, 0x4A, 0xA5, 0x52, 0x2E, 0x97, 0xBB, 0x70,
-	0xE1, 0x02, 0xFC, 0x54, 0xF8, 0x26, 0xE3, 0x5E, 0x06, 0x13, 0x75, 0xF0,
-	0xE3, 0xDA, 0xC8, 0x52, 0xA9, 0x04, 0x42, 0x59, 0xA7, 0xD3, 0xF9, 0xC7,
-	0x7F, 0xFC, 0xC7, 0xEF, 0x7F, 0xFF, 0xFB, 0xF5, 0x7A, 0xFD, 0xF1, 0xE3,
-	0xC7, 0x6C, 0xBB, 0x41, 0x0D, 0x4E, 0x28, 0x8A, 0x3D, 0xA2, 0x00, 0x1C,
-	0xB1, 0x02, 0x1B, 0x3E, 0xD9, 0x6B, 0x93, 0xF8, 0x12, 0x25, 0x06, 0x9C,
-	0x82, 0xCC, 0x2D, 0x02, 0x4B, 0x55, 0x51, 0x07, 0x83, 0x41, 0x3A, 0x9D,
-	0x4E, 0x67, 0xD2, 0x1E, 0x8F, 0x07, 0xA7, 0x1E, 0x8A, 0x95, 0x86, 0x67,
-	0x52, 0x1F, 0xCA, 0x44, 0x2B, 0x84, 0x00, 0x0E, 0x45, 0x24, 0x12, 0xA9,
-	0xD5, 0x6A, 0x0E, 0x87, 0x63, 0x6E, 0x6E, 0xEE, 0xCC, 0x99, 0x33, 0xB8,
-	0x32, 0xDC, 0x1E, 0x0D, 0xE5, 0x72, 0x38, 0x1C, 0xA2, 0xD1, 0x07, 0xE1,
-	0x36, 0xD6, 0x91, 0x69, 0xD8, 0x66, 0xC8, 0xA7, 0xDB, 0xEC, 0xB6, 0x37,
-	0xDF, 0x7C, 0xD3, 0x6A, 0xB5, 0x3E, 0x7C, 0xF8, 0x90, 0xCC, 0x2D, 0x59,
-	0x0A, 0x87, 0x6C, 0x65, 0xB3, 0xD9, 0xBC, 0x7E, 0xFD, 0x3A, 0x3A, 0x37,
-	0x41, 0x11, 0xC1, 0xA4, 0x51, 0xA3, 0xC8, 0xEA, 0x47, 0x05, 0xFC, 0x53,
-	0xAC, 0xA3, 0xCD, 0x66, 0xFB, 0xE3, 0x3F, 0xFE, 0xE3, 0x1B, 0x37, 0x6E,
-	0xE0, 0x04, 0x69, 0x0A, 0xA0, 0xB0, 0x28, 0x50, 0x1D, 0x68, 0x4C, 0xEE,
-	0x70, 0x38, 0xD8, 0x94, 0x85, 0xA8, 0xD6, 0xA4, 0xDE, 0x98, 0xAC, 0xC3,
-	0x46, 0x7B, 0x3F, 0x54, 0x47, 0x99, 0xCD, 0x66, 0xAB, 0xCD, 0x6A, 0xB7,
-	0xDB, 0x1F, 0x3E, 0x7C, 0x88, 0x12, 0x70, 0xA0, 0xC7, 0xE0, 0x49, 0xCA,
-	0x1A, 0x85, 0x2F, 0x3B, 0x5B, 0xF8, 0x02, 0xF2, 0x82, 0xEB, 0xEB, 0xEB,
-	0x37, 0x6E, 0xDC, 0x68, 0x34, 0x1A, 0x48, 0x4E, 0xFD, 0xE8, 0x47, 0x3F,
-	0xCA, 0xE7, 0xF3, 0x28, 0x18, 0x41, 0x7E, 0x89, 0x05, 0x26, 0xEC, 0xE6,
-	0x21, 0xC1, 0x64, 0x66, 0x1A, 0xA4, 0x7D, 0xA6, 0x83, 0xA7, 0xD7, 0xEB,
-	0xDF, 0x7A, 0xEB, 0x2D, 0xBD, 0x5E, 0xFF, 0xF3, 0x9F, 0xFF, 0x9C, 0x05,
-	0x20, 0x64, 0x7A, 0xC3, 0xE7, 0xAE, 0x56, 0xAB, 0x7B, 0x7B, 0x7B, 0xEF,
-	0xBC, 0xF3, 0xCE, 0xD5, 0xAB, 0x57, 0x8F, 0x8F, 0x8F, 0xD1, 0x55, 0x09,
-	0x9C, 0x14, 0x76, 0xA1, 0xA2, 0x0F, 0xD9, 0x6C, 0x36, 0x15, 0xD2, 0x19,
-	0xD3, 0xE9, 0xF4, 0x6F, 0x7F, 0xFB, 0x5B, 0xC0, 0x4C, 0x6B, 0x6B, 0x6B,
-	0x95, 0x4A, 0x85, 0x5C, 0x1D, 0x89, 0x6A, 0xB1, 0xAF, 0xB9, 0xDB, 0xED,
-	0x46, 0xE1, 0x7C, 0x3A, 0x9D, 0x4E, 0x24, 0x12, 0xC8, 0xD8, 0x60, 0x27,
-	0xC8, 0x26, 0xD7, 0xB4, 0xF0, 0x64, 0x4E, 0xD1, 0x6A, 0xB5, 0x22, 0x22,
-	0x6D, 0xB7, 0xDB, 0xE0, 0xA6, 0xF5, 0x7A, 0xBD, 0x47, 0x8F, 0x1E, 0xED,
-	0xEF, 0xEF, 0xA3, 0x47, 0xB6, 0x24, 0xB2, 0x69, 0x92, 0xCF, 0x1A, 0x8C,
-	0x81, 0x80, 0x92, 0xC3, 0xE1, 0x08, 0x87, 0xC3, 0x48, 0x1F, 0xED, 0xEF,
-	0xEF, 0xFF, 0xE6, 0x37, 0xBF, 0xD9, 0xDE, 0xDE, 0x66, 0xEE, 0x97, 0xE5,
-	0xBE, 0xA4, 0x3F, 0xC1, 0x0D, 0xD7, 0xD4, 0x76, 0x4F, 0xF6, 0x34, 0x93,
-	0x2D, 0x90, 0x51, 0x54, 0x8B, 0x52, 0x32, 0xF6, 0x79, 0xA3, 0xAA, 0x60,
-	0x9F, 0xB0, 0x74, 0x3A, 0x7D, 0x78, 0x78, 0x78, 0xF1, 0xE2, 0xC5, 0x33,
-	0x67, 0xCE, 0x6C, 0x6F, 0x6F, 0x43, 0x0B, 0xB1, 0x50, 0x49, 0xBA, 0x33,
-	0xFD, 0x7E, 0xDF, 0xA8, 0xB1, 0xEC, 0x16, 0x8B, 0xC5, 0xE7, 0xF3, 0xE1,
-	0x44, 0xB3, 0xBD, 0x3E, 0x1B, 0x65, 0x61, 0xB1, 0x50, 0xBD, 0x1E, 0x8F,
-	0xC7, 0xD7, 0xD6, 0xD6, 0xDE, 0x79, 0xE7, 0x9D, 0x77, 0xDE, 0x79, 0xE7,
-	0xC2, 0x85, 0x0B, 0xD1, 0x68, 0x14, 0x7A, 0x50, 0xC2, 0x6D, 0x1A, 0x8E,
-	0x3B, 0x07, 0x03, 0xF8, 0x7C, 0xBE, 0xB9, 0xB9, 0x39, 0xBC, 0x0F, 0x30,
-	0xB2, 0x52, 0xA9, 0x84, 0x96, 0x2B, 0xF0, 0x26, 0xA5, 0x8F, 0x28, 0x5B,
-	0xF1, 0xBD, 0xA2, 0xD3, 0x7C, 0x21, 0x0D, 0xA4, 0x2B, 0xDB, 0xED, 0xF6,
-	0xE1, 0x70, 0x88, 0xA4, 0xC5, 0xE3, 0xC7, 0x8F, 0x1F, 0x3D, 0x7A, 0x84,
-	0x5E, 0xFF, 0x3C, 0x01, 0xE4, 0x00, 0x42, 0xFB, 0x83, 0x29, 0x64, 0xF9,
-	0xE2, 0xC3, 0x62, 0x4A, 0x99, 0xF8, 0x64, 0x40, 0x67, 0x32, 0x99, 0x7C,
-	0x5E, 0x5F, 0x7C, 0x36, 0x9E, 0xCD, 0x66, 0x77, 0x76, 0x76, 0x8E, 0x8F,
-	0x8E, 0x4F, 0x53, 0xA7, 0x28, 0x7D, 0x91, 0xF5, 0x0A, 0x78, 0x24, 0xF4,
-	0xF5, 0x39, 0x7F, 0xFE, 0xBC, 0xC1, 0x60, 0x40, 0xC3, 0x38, 0xC6, 0x43,
-	0x93, 0xBE, 0x89, 0x51, 0x16, 0x09, 0x63, 0x95, 0x17, 0x17, 0x17, 0x21,
-	0x77, 0x78, 0x5C, 0xD6, 0x1D, 0xB0, 0xBC, 0x16, 0xA4, 0x0F, 0xA0, 0x4E,
-	0x48, 0x09, 0x84, 0xC3, 0xE1, 0xEB, 0xD7, 0xAF, 0xDF, 0xBC, 0x79, 0x73,
-	0x69, 0x69, 0x09, 0x48, 0xEA, 0x64, 0xF2, 0x8B, 0x6D, 0x2E, 0x6D, 0x36,
-	0x5B, 0x24, 0x12, 0x99, 0x9D, 0x9D, 0x05, 0x24, 0x00, 0x4B, 0xC0, 0xF2,
-	0x68, 0xD6, 0x36, 0x91, 0x56, 0xCD, 0xD2, 0x1F, 0x82, 0x1C, 0xF4, 0xD0,
-	0x81, 0xF3, 0xA0, 0x72, 0xBF, 0xDD, 0x6E, 0xE3, 0x08, 0xD6, 0x6A, 0xB5,
-	0x52, 0xA9, 0x74, 0x74, 0x74, 0x54, 0x28, 0x14, 0x90, 0x94, 0x47, 0x76,
-	0x8C, 0x8B, 0xC5, 0x2E, 0x93, 0x5E, 0xAF, 0x17, 0x7E, 0x2A, 0x94, 0x1E,
-	0x1D, 0x79, 0xF8, 0xFE, 0x04, 0x62, 0xC7, 0x6B, 0xEA, 0xF5, 0x74, 0x3A,
-	0x1D, 0xCC, 0x7F, 0xA8, 0x54, 0x2A, 0x68, 0x90, 0x43, 0x77, 0x99, 0xA7,
-	0x84, 0x3D, 0x8F, 0xA7, 0xA6, 0xA6, 0x16, 0x17, 0x17, 0x77, 0x76, 0x76,
-	0x0E, 0x0E, 0x0E, 0xB0, 0xF7, 0x92, 0x97, 0xFF, 0xCA, 0x83, 0x90, 0x66,
-	0x01, 0xAC, 0xEE, 0x5E, 0xAF, 0xB7, 0xB2, 0xB2, 0xA2, 0xAA, 0x2A, 0x5A,
-	0x32, 0xD0, 0x7F, 0x22, 0x59, 0x13, 0xDC, 0x98, 0x9D, 0x9D, 0x1D, 0x1A,
-	0x2E, 0xAF, 0xD7, 0xBB, 0xB2, 0xB2, 0x72, 0xF1, 0xE2, 0xC5, 0xAB, 0x57,
-	0xAF, 0x7E, 0xE5, 0x2B, 0x5F, 0xF9, 0xE0, 0x83, 0x0F, 0x7E, 0xF4, 0xA3,
-	0x1F, 0x3D, 0x79, 0xF2, 0x84, 0x24, 0x4B, 0x66, 0x6C, 0x20, 0xB3, 0xB0,
-	0x75, 0x80, 0x16, 0x46, 0xA3, 0x51, 0xA5, 0x52, 0x01, 0x6E, 0xAE, 0x49,
-	0x8F, 0x8C, 0x9B, 0xFB, 0x2A, 0xCA, 0x64, 0x67, 0x21, 0x9C, 0x4B, 0x5C,
-	0x07, 0x21, 0x37, 0xAE, 0x0C, 0x29, 0x73, 0x3A, 0x9D, 0xE4, 0xCD, 0x91,
-	0x3B, 0xC4, 0xA6, 0xFF, 0xF8, 0x17, 0xE5, 0xDD, 0xAB, 0xAB, 0xAB, 0xE8,
-	0xB2, 0xC4, 0x9A, 0x24, 0x39, 0xA2, 0x80, 0x7F, 0xA5, 0xAA, 0x2A, 0x1E,
-	0x52, 0xF6, 0x7E, 0xD0, 0x38, 0x66, 0x70, 0x1A, 0x9B, 0xCD, 0x26, 0x4E,
-	0xF3, 0x87, 0x1F, 0x7E, 0x88, 0x66, 0xF5, 0x77, 0xEE, 0xDC, 0xC9, 0x64,
-	0x32, 0x8C, 0xDA, 0x34, 0x66, 0xCC, 0xC8, 0xF4, 0x05, 0x5E, 0xC0, 0xED,
-	0x76, 0x2F, 0x2E, 0x2E, 0x7E, 0xE7, 0x3B, 0xDF, 0x71, 0x3A, 0x9D, 0xFB,
-	0xFB, 0xFB, 0x28, 0x52, 0x64, 0x9E, 0x52, 0x51, 0x14, 0x40, 0x37, 0xA8,
-	0xE4, 0xAF, 0x56, 0xAB, 0xF8, 0x39, 0x97, 0xCB, 0x1D, 0x1D, 0x1D, 0x3D,
-	0x7A, 0xF4, 0xE8, 0xC1, 0x83, 0x07, 0xAD, 0x56, 0xEB, 0xD6, 0xAD, 0x5B,
-	0xD7, 0xAF, 0x5F, 0x07, 0x7B, 0x80, 0x00, 0x08, 0xF5, 0x18, 0xC2, 0x2E,
-	0x8B, 0xC5, 0x02, 0xA6, 0x05, 0x42, 0x12, 0x74, 0x68, 0x80, 0x9B, 0x28,
-	0x3D, 0x7D, 0xD9, 0x1B, 0x16, 0xCF, 0x80, 0xD2, 0x06, 0xFC, 0x06, 0x00,
-	0x2F, 0xDD, 0x4A, 0x9E, 0x71, 0xC0, 0x85, 0x94, 0x3B, 0xD9, 0x37, 0x94,
-	0xB5, 0xF9, 0x0E, 0x87, 0x23, 0x12, 0x89, 0xDC, 0xBC, 0x79, 0xF3, 0xDD,
-	0x77, 0xDF, 0x5D, 0x58, 0x58, 0x40, 0xEF, 0x68, 0xC9, 0x0E, 0xA6, 0x23,
-	0x84, 0x5A, 0x25, 0x98, 0x37, 0xB6, 0x82, 0xC0, 0x5A, 0x13, 0x3D, 0xE3,
-	0x89, 0x27, 0xCC, 0x3E, 0x18, 0x0E, 0xA2, 0xE1, 0xE8, 0x99, 0x33, 0x67,
-	0x9E, 0x3E, 0x7D, 0x0A, 0x0F, 0x58, 0x42, 0x11, 0xD2, 0x87, 0x56, 0xD8,
-	0xA6, 0x05, 0xD4, 0x49, 0xB7, 0xDB, 0x8D, 0xE6, 0xDD, 0x18, 0xE3, 0xC1,
-	0x16, 0xF9, 0x68, 0xD0, 0x0A, 0x64, 0x8A, 0xA4, 0x39, 0x16, 0x2F, 0xD4,
-	0x6A, 0x35, 0xBB, 0xDD, 0x8E, 0xB3, 0xFF, 0xF4, 0xE9, 0xD3, 0xEF, 0x7D,
-	0xEF, 0x7B, 0x7F, 0xF1, 0x17, 0x7F, 0xA1, 0xAA, 0xEA, 0xFB, 0xEF, 0xBF,
-	0x7F, 0x7A, 0x7A, 0xCA, 0x1C, 0x37, 0xDB, 0x24, 0x81, 0x02, 0x8E, 0xAE,
-	0x94, 0x80, 0x4D, 0x64, 0x17, 0x39, 0xC2, 0x15, 0x68, 0x88, 0x05, 0xDE,
-	0x0A, 0x12, 0x64, 0x20, 0x6D, 0xD4, 0xEB, 0x75, 0x40, 0x81, 0xB2, 0xEB,
-	0x01, 0x3C, 0x51, 0x98, 0x5C, 0x34, 0x6E, 0x9B, 0x9C, 0x2C, 0x22, 0x75,
-	0xA3, 0xD5, 0x6A, 0x8D, 0x44, 0x22, 0xA1, 0x50, 0xA8, 0xD5, 0x6A, 0x21,
-	0x93, 0x55, 0x2C, 0x16, 0xEB, 0xB5, 0x7A, 0xBB, 0xD3, 0x26, 0x8D, 0x45,
-	0x43, 0x26, 0x23, 0x2E, 0x24, 0x4B, 0xF5, 0x24, 0xE0, 0x83, 0x36, 0x1D,
-	0xE5, 0x72, 0xF9, 0xF8, 0xF0, 0xF8, 0x17, 0xEF, 0xFD, 0xE2, 0x87, 0x3F,
-	0xFC, 0xE1, 0xD5, 0xAB, 0x57, 0x9F, 0x3F, 0x7F, 0x2E, 0xB9, 0x11, 0xAC,
-	0x98, 0xD3, 0xE9, 0x74, 0x46, 0x48, 0x16, 0x1B, 0xC3, 0x2C, 0x2C, 0x2C,
-	0x04, 0x02, 0x81, 0x42, 0xA1, 0x50, 0x2A, 0x95, 0xD0, 0xED, 0xA7, 0xDF,
-	0xEB, 0x1B, 0x8D, 0x46, 0xB3, 0xC5, 0xEC, 0x74, 0x3A, 0x81, 0x7D, 0xB3,
-	0x0D, 0x13, 0x13, 0x38, 0x32, 0xBF, 0xD1, 0xE9, 0x74, 0x4A, 0xA5, 0x12,
-	0xD8, 0x2E, 0xE8, 0xEC, 0xCA, 0x86, 0xC4, 0x24, 0xC1, 0xE1, 0x3A, 0xD0,
-	0xA1, 0x84, 0xF5, 0x49, 0x3D, 0x92, 0x2D, 0x48, 0xC8, 0xD2, 0x58, 0x5A,
-	0x5A, 0xBA, 0x78, 0xF1, 0xE2, 0xB9, 0x73, 0xE7, 0x62, 0xB1, 0x18, 0x72,
-	0xA5, 0xAC, 0xE0, 0x95, 0x5D, 0x42, 0x99, 0x00, 0x70, 0xB9, 0x5C, 0xEC,
-	0xAA, 0x41, 0x3F, 0x87, 0x40, 0x29, 0x4E, 0xC0, 0xCC, 0xCC, 0x8C, 0xCB,
-	0xE5, 0x4A, 0x26, 0x93, 0xA7, 0xA7, 0xA7, 0x7B, 0x7B, 0x7B, 0x70, 0x6F,
-	0x38, 0x06, 0x87, 0xBD, 0x6A, 0x34, 0xFE, 0xA8, 0xAC, 0x47, 0xD3, 0x50,
-	0x42, 0x25, 0x4F, 0xD0, 0x60, 0x34, 0x0C, 0x06, 0x03, 0x10, 0xD9, 0x77,
-	0x76, 0x76, 0x8A, 0xC5, 0x22, 0x1B, 0xEA, 0x90, 0x23, 0xA4, 0xAA, 0xEA,
-	0xAB, 0x27, 0x46, 0xDF, 0xBF, 0x62, 0xB1, 0x78, 0xFF, 0xFE, 0xFD, 0x27,
-	0x4F, 0x9E, 0x38, 0x1C, 0x0E, 0x92, 0xD4, 0x51, 0x47, 0xA2, 0x28, 0x4A,
-	0x28, 0x14, 0x82, 0x96, 0xD4, 0x60, 0xA5, 0xD4, 0x83, 0x78, 0x5C, 0x55,
-	0x55, 0x9F, 0x3F, 0x7F, 0x7E, 0x7A, 0x7A, 0x0A, 0x0D, 0x8E, 0xB1, 0x38,
-	0xEC, 0x89, 0x39, 0x18, 0x0C, 0x72, 0xB9, 0x1C, 0x74, 0x02, 0x2C, 0x3F,
-	0xCD, 0x83, 0xDE, 0xA0, 0x7F, 0xAD, 0xB4, 0x42, 0x21, 0xDC, 0xBA, 0x75,
-	0xEB, 0xFC, 0xF9, 0xF3, 0xFF, 0xF9, 0x9F, 0xFF, 0xD9, 0x6A, 0xB6, 0x24,
-	0x9A, 0xFF, 0x5A, 0xF8, 0x16, 0x1A, 0x06, 0x4A, 0x63, 0xF2, 0x3B, 0xC3,
-	0xE1, 0x70, 0x38, 0x18, 0x36, 0x1A, 0x8D, 0x7B, 0xF7, 0xEE, 0xE1, 0xCB,
-	0x94, 0x68, 0xE9, 0xC8, 0xBD, 0xB6, 0xED, 0x0D, 0x89, 0x6B, 0xD0, 0xA8,
-	0x2C, 0xC4, 0x94, 0xC9, 0x1C, 0xF4, 0xA4, 0xC9, 0xE5, 0x72, 0x0F, 0x1E,
-	0x3C, 0xB8, 0x7E, 0xFD, 0xFA, 0xED, 0xDB, 0xB7, 0xF7, 0xF6, 0xF6, 0x0A,
-	0x85, 0x02, 0xE0, 0x03, 0x50, 0xD0, 0xC7, 0x2A, 0x08, 0x07, 0xBF, 0xD7,
-	0xEB, 0x01, 0x55, 0x47, 0x43, 0x25, 0xC5, 0xA8, 0x28, 0xEA, 0xB8, 0xAF,
-	0x3B, 0xBF, 0xDA, 0xED, 0x76, 0x91, 0x86, 0x44, 0xEC, 0xC6, 0x0C, 0xBE,
-	0xA6, 0x47, 0x12, 0x70, 0x50, 0xF0, 0x00, 0x19, 0x46, 0x22, 0x4F, 0x80,
-	0xA5, 0xA9, 0x56, 0xAB, 0x84, 0x3A, 0x10, 0xA3, 0x1B, 0x8D, 0x46, 0x74,
-	0x7B, 0xAC, 0xD5, 0x6B, 0x9D, 0x76, 0x87, 0x51, 0xBB, 0xF4, 0x68, 0x51,
-	0xE5, 0x93, 0x4C, 0x26, 0x1B, 0x8D, 0x46, 0x7F, 0xD0, 0xD7, 0xCC, 0x09,
-	0xD0, 0xA0, 0x55, 0xF8, 0xFE, 0xEC, 0xEC, 0x2C, 0x4E, 0x95, 0x0C, 0x7F,
-	0xF8, 0x27, 0xDD, 0x5E, 0x97, 0xED, 0xC2, 0xC1, 0x97, 0xB2, 0xD9, 0x6C,
-	0x4C, 0xE6, 0xE0, 0x5F, 0x1C, 0xEB, 0x49, 0x17, 0x80, 0x40, 0x19, 0xA2,
-	0x5C, 0x99, 0x6E, 0x22, 0x44, 0x06, 0x68, 0x1A, 0x6D, 0x8E, 0x96, 0x96,
-	0x96, 0x5C, 0x2E, 0x97, 0x0C, 0xEF, 0xA9, 0x1B, 0x15, 0x1E, 0x25, 0xFC,
-	0x0F, 0xF4, 0x6A, 0xE6, 0x9D, 0x58, 0x8F, 0x89, 0xB4, 0x4C, 0xAD, 0x56,
-	0x43, 0x93, 0x64, 0xD6, 0xF3, 0xC3, 0x11, 0xE2, 0x68, 0x1B, 0xF8, 0x8B,
-	0x68, 0x68, 0x2B, 0xB9, 0xEC, 0x12, 0x46, 0x96, 0x27, 0x1A, 0x88, 0x1B,
-	0x1C, 0x15, 0x74, 0x30, 0xE9, 0xB4, 0x3B, 0xDC, 0x57, 0x59, 0x48, 0x64,
-	0x36, 0x9B, 0x7F, 0xF1, 0x8B, 0x5F, 0xA0, 0xA7, 0x12, 0x07, 0x5E, 0x68,
-	0xEA, 0x38, 0x65, 0x21, 0xBC, 0xA2, 0x28, 0xF1, 0x78, 0x3C, 0x9F, 0xCF,
-	0xB3, 0x27, 0x1B, 0x7C, 0x21, 0x59, 0x93, 0x8C, 0xD6, 0x2A, 0x60, 0xE1,
-	0x03, 0x91, 0xF4, 0xFB, 0xFD, 0x3E, 0x9F, 0x0F, 0x29, 0x46, 0x52, 0x19,
-	0x65, 0x2C, 0x49, 0xFA, 0x05, 0x6C, 0x21, 0xFB, 0xE7, 0x33, 0xEA, 0xE4,
-	0xCA, 0x22, 0xD7, 0x94, 0x48, 0x24, 0x7E, 0xFC, 0xE3, 0x1F, 0xDF, 0xBC,
-	0x79, 0xD3, 0xE5, 0x72, 0x11, 0xD9, 0xC6, 0x1D, 0xC7, 0x0E, 0xB1, 0x6C,
-	0xD2, 0x0E, 0xF9, 0x95, 0x6D, 0xBE, 0xF8, 0xF2, 0xD8, 0x00, 0x78, 0x17,
-	0xEB, 0xEB, 0xEB, 0x9C, 0x07, 0x00, 0x3D, 0x4E, 0xF5, 0x8A, 0xA5, 0x21,
-	0x42, 0xA2, 0xE9, 0x6A, 0x2C, 0x89, 0xBD, 0x64, 0x09, 0x62, 0xD7, 0x5B,
-	0xAD, 0x16, 0x90, 0x7D, 0x88, 0x3F, 0x69, 0xC2, 0x50, 0xD6, 0x0E, 0x87,
-	0x03, 0x16, 0xB2, 0xDF, 0xEF, 0x23, 0x1C, 0x61, 0x41, 0x04, 0x53, 0xC7,
-	0x64, 0x76, 0x72, 0x38, 0x4C, 0x2C, 0x16, 0xDB, 0xD8, 0xD8, 0x28, 0x97,
-	0xCA, 0xF0, 0xB5, 0x60, 0xFD, 0x58, 0x57, 0x8C, 0xD6, 0xD6, 0x9C, 0xDB,
-	0xC0, 0xB6, 0xF9, 0xCB, 0xCB, 0xCB, 0xEB, 0xEB, 0xEB, 0xF9, 0x7C, 0x1E,
-	0x6D, 0xE3, 0xD9, 0xE5, 0x0D, 0x32, 0x0A, 0x63, 0x09, 0xCF, 0x15, 0x8D,
-	0x83, 0x65, 0x51, 0x06, 0x36, 0x00, 0xCF, 0x80, 0xB7, 0x28, 0x95, 0x4A,
-	0x0F, 0x1F, 0x3E, 0x64, 0xFD, 0xCB, 0x24, 0xB3, 0xC6, 0x88, 0x7E, 0x89,
-	0x92, 0xE9, 0x2F, 0x49, 0x12, 0xEC, 0x00, 0xCF, 0x48, 0x4F, 0x51, 0x94,
-	0x68, 0x34, 0xBA, 0xB8, 0xB8, 0x58, 0x2A, 0x95, 0x20, 0x59, 0x8C, 0x48,
-	0x01, 0x6C, 0xC9, 0x56, 0x84, 0x92, 0x76, 0x20, 0xF3, 0xA8, 0x92, 0x1B,
-	0xF1, 0x2A, 0xD0, 0xB3, 0x58, 0x5D, 0x2E, 0x17, 0xEE, 0x4E, 0xC8, 0x1A,
-	0x05, 0xEC, 0xE8, 0x25, 0x83, 0x7E, 0xC0, 0x58, 0x0B, 0x74, 0xB4, 0x26,
-	0x23, 0x91, 0xB3, 0x39, 0xE0, 0xC8, 0x79, 0x3C, 0x1E, 0xF0, 0x7F, 0xA6,
-	0xA7, 0xA7, 0x53, 0xA9, 0x14, 0x9D, 0xD1, 0x49, 0x52, 0x37, 0x36, 0x80,
-	0x58, 0x34, 0xEE, 0xF8, 0xD6, 0x5B, 0x6F, 0x5D, 0xBF, 0x7E, 0x3D, 0x1A,
-	0x8D, 0xDA, 0x6C, 0xB6, 0x6E, 0xB7, 0x8B, 0xE0, 0x1C, 0x90, 0x17, 0x78,
-	0x08, 0x80, 0xF9, 0x22, 0x91, 0x88, 0xC5, 0x62, 0x91, 0x53, 0x8A, 0xF0,
-	0x0C, 0xC4, 0x1E, 0xA8, 0x93, 0x2B, 0x95, 0xCA, 0x70, 0x38, 0x64, 0xCA,
-	0x88, 0xE9, 0x07, 0xBD, 0x5E, 0x3F, 0xDE, 0x00, 0x99, 0xF1, 0x91, 0xC8,
-	0xBE, 0x24, 0x77, 0x12, 0x47, 0x73, 0x3A, 0x9D, 0x97, 0x2F, 0x5F, 0x8E,
-	0xC5, 0x62, 0xE8, 0xAE, 0x03, 0x30, 0x80, 0x04, 0x05, 0x99, 0x08, 0xA3,
-	0x7D, 0x96, 0xBA, 0x88, 0xEE, 0x10, 0xA3, 0xFC, 0x71, 0x68, 0x66, 0x1C,
-	0x33, 0x87, 0xC9, 0xBD, 0x00, 0x2C, 0xDC, 0x6A, 0xB5, 0xC0, 0xB1, 0x61,
-	0x3B, 0x52, 0xEC, 0x90, 0xD3, 0xE9, 0x24, 0x9D, 0x52, 0x35, 0xA9, 0x80,
-	0xEF, 0x11, 0xCD, 0xDA, 0xED, 0x76, 0xF8, 0x97, 0xAB, 0xAB, 0xAB, 0xB5,
-	0x5A, 0x2D, 0x95, 0x4A, 0xD1, 0x69, 0xD6, 0x54, 0xFB, 0xC8, 0xA6, 0xD0,
-	0x80, 0xB9, 0xFC, 0x7E, 0xFF, 0xCA, 0xCA, 0xCA, 0xFA, 0xFA, 0x7A, 0x38,
-	0x1C, 0xDE, 0x3F, 0xD8, 0x3F, 0x3A, 0x3C, 0x42, 0x8B, 0x4C, 0xB4, 0x2D,
-	0x40, 0xB5, 0x57, 0xB3, 0xD9, 0xF4, 0xFB, 0xFD, 0xB7, 0x6E, 0xDD, 0xBA,
-	0x70, 0xE1, 0x82, 0xC5, 0x62, 0xE1, 0xA8, 0x03, 0x24, 0x41, 0xD9, 0xF4,
-	0x94, 0xC1, 0x04, 0x9E, 0x9C, 0x0C, 0x09, 0x59, 0x2A, 0x6B, 0x64, 0xD6,
-	0x86, 0x5A, 0x82, 0x5E, 0x20, 0xB3, 0xF3, 0xB2, 0x0E, 0x1B, 0xA0, 0xE3,
-	0xF2, 0xF2, 0xF2, 0x37, 0xBF, 0xF9, 0xCD, 0x40, 0x20, 0x40, 0x42, 0x20,
-	0x48, 0x96, 0xA4, 0xD7, 0x71, 0xDB, 0x34, 0xE5, 0x92, 0xB2, 0xDC, 0x90,
-	0x25, 0x73, 0x90, 0x5C, 0xD5, 0xA4, 0x92, 0x68, 0x8D, 0xED, 0x41, 0x7B,
-	0x35, 0x34, 0xAD, 0x91, 0x33, 0x04, 0x71, 0x65, 0x04, 0x07, 0x08, 0xD1,
-	0x2D, 0x66, 0x0B, 0xAC, 0x34, 0xDE, 0x10, 0xA3, 0x60, 0xD0, 0xDB, 0xD7,
-	0xE3, 0xF1, 0x1C, 0x1C, 0x1C, 0x54, 0xCA, 0x95, 0x6E, 0x67, 0x4C, 0x58,
-	0x97, 0x1F, 0x52, 0x42, 0x55, 0x93, 0x4A, 0xBE, 0x13, 0x89, 0x20, 0x4F,
-	0x9F, 0x3E, 0x4D, 0x24, 0x12, 0xD8, 0x00, 0x3C, 0x00, 0xFC, 0x66, 0x78,
-	0x38, 0xB5, 0x5A, 0xED, 0xDC, 0xB9, 0x73, 0xDF, 0xFC, 0xE6, 0x37, 0xD7,
-	0xD7, 0xD7, 0x3D, 0x6E, 0x8F, 0xD3, 0xE5, 0x74, 0xB9, 0x5C, 0x70, 0xB2,
-	0x65, 0x0D, 0x28, 0x5C, 0x73, 0x59, 0x4B, 0xFC, 0x7B, 0x85, 0xCA, 0x20,
-	0x64, 0x4B, 0x6A, 0x10, 0x1D, 0x7C, 0x59, 0x2B, 0x22, 0x89, 0x02, 0x78,
-	0x7F, 0x58, 0xE3, 0x64, 0x32, 0x09, 0xD4, 0x05, 0x90, 0x03, 0xA7, 0xFC,
-	0x4C, 0x4E, 0x93, 0x93, 0xC0, 0x96, 0x8C, 0xFB, 0x10, 0xFA, 0x8D, 0x3B,
-	0x28, 0x1B, 0xF4, 0x98, 0x10, 0xD0, 0x68, 0x34, 0x2A, 0x95, 0x0A, 0x40,
-	0x34, 0x76, 0x84, 0x96, 0x61, 0x11, 0xD6, 0x3D, 0x1A, 0x8B, 0xBA, 0x5D,
-	0x6E, 0xBB, 0xCD, 0x0E, 0xDD, 0xC5, 0x39, 0x12, 0x90, 0x15, 0x34, 0xE6,
-	0x9E, 0x9E, 0x9E, 0xCE, 0xE5, 0x72, 0xE8, 0xE2, 0xD4, 0xED, 0x75, 0xE5,
-	0x2E, 0xFE, 0x5E, 0xFD, 0xC8, 0x68, 0x4C, 0xA2, 0x01, 0xFD, 0x1B, 0x2E,
-	0x5C, 0x3A, 0x95, 0xC6, 0xDC, 0x51, 0x59, 0xCD, 0xC9, 0x56, 0xB4, 0x99,
-	0x4C, 0xE6, 0xD9, 0xB3, 0x67, 0xCD, 0x66, 0x73, 0x6D, 0x6D, 0xED, 0xD6,
-	0xED, 0x5B, 0x57, 0xAE, 0x5C, 0x41, 0x7B, 0x14, 0x59, 0x1D, 0xC4, 0x3D,
-	0x63, 0x64, 0x27, 0xBB, 0x90, 0xEA, 0x74, 0xBA, 0x31, 0x7D, 0x8A, 0xF1,
-	0x3A, 0x01, 0x10, 0x56, 0xD0, 0x49, 0x46, 0xBF, 0x84, 0x8C, 0xD2, 0xE9,
-	0x74, 0xA7, 0xD3, 0x39, 0x3E, 0x3E, 0x3E, 0x38, 0x38, 0x80, 0x7E, 0x40,
-	0x1A, 0x48, 0xF2, 0xFA, 0xE9, 0x99, 0x10, 0x3A, 0x66, 0x9A, 0x9B, 0x95,
-	0x8B, 0x1E, 0x8F, 0x07, 0x6D, 0x47, 0x2D, 0x16, 0xCB, 0x70, 0x30, 0x36,
-	0xC8, 0xC4, 0x85, 0x08, 0xCB, 0xD0, 0xAA, 0x73, 0x2C, 0x0C, 0x1A, 0x94,
-	0x2E, 0x2F, 0x2F, 0xBB, 0x3D, 0x6E, 0xA7, 0xCB, 0x29, 0x47, 0xD0, 0xB0,
-	0x33, 0x66, 0x20, 0x10, 0x00, 0xB8, 0xBB, 0xBD, 0xBD, 0x0D, 0x64, 0x42,
-	0x36, 0x3C, 0xA4, 0x9A, 0x95, 0x0D, 0xDD, 0x89, 0x57, 0x9B, 0x4C, 0xA6,
-	0x42, 0xB1, 0x80, 0xFE, 0x19, 0x24, 0x92, 0xCA, 0x41, 0x0B, 0x48, 0x26,
-	0xEE, 0xEE, 0xEE, 0x3E, 0x7E, 0xFC, 0xF8, 0xE0, 0xE0, 0xA0, 0xDD, 0x6E,
-	0x53, 0x0D, 0x42, 0x2B, 0xC8, 0x36, 0x23, 0x52, 0x86, 0x64, 0x6A, 0x5E,
-	0x41, 0x46, 0x6D, 0xB2, 0x01, 0x01, 0x15, 0x99, 0x4C, 0x25, 0x23, 0x5C,
-	0x30, 0x18, 0x0C, 0xB9, 0x5C, 0xEE, 0xC9, 0x93, 0x27, 0x88, 0x2C, 0xA8,
-	0xF7, 0xA5, 0xB0, 0xCB, 0x79, 0x3A, 0x0C, 0x50, 0x81, 0x22, 0x48, 0xEE,
-	0xA2, 0xC1, 0x60, 0x18, 0x0D, 0x47, 0x1C, 0x1E, 0x89, 0x16, 0xFF, 0xAC,
-	0x45, 0x95, 0xF5, 0x36, 0xD2, 0xD1, 0x86, 0x64, 0x35, 0x9B, 0xCD, 0x7C,
-	0x3E, 0x8F, 0xDE, 0x81, 0xE8, 0x4E, 0xC1, 0xC6, 0xB3, 0x90, 0x21, 0x54,
-	0x7E, 0x25, 0x12, 0x09, 0x58, 0x72, 0x39, 0x6A, 0x90, 0xDF, 0x91, 0x2D,
-	0x79, 0x98, 0x3B, 0xE4, 0xAE, 0x03, 0xD6, 0x9D, 0x2C, 0xC2, 0xA6, 0x68,
-	0x03, 0x07, 0x2C, 0x95, 0x4A, 0xDB, 0xDB, 0xDB, 0x2C, 0xAA, 0x65, 0x53,
-	0x1F, 0x9B, 0xCD, 0x06, 0x31, 0x92, 0x7C, 0x11, 0x59, 0xCE, 0x35, 0x0E,
-	0xC4, 0xFE, 0x40, 0xFD, 0xFB, 0x24, 0xE6, 0x87, 0x3A, 0x4D, 0x64, 0x24,
-	0xEA, 0xF5, 0xBA, 0xC3, 0xE1, 0x60, 0x8E, 0x5B, 0x52, 0xC6, 0xE9, 0x14,
-	0xCB, 0xC9, 0x33, 0x84, 0xA6, 0x2D, 0xE2, 0xA3, 0x9A, 0xD4, 0xE1, 0x68,
-	0xD8, 0x6A, 0xB5, 0xF0, 0xC4, 0xC0, 0x85, 0x58, 0xAC, 0x21, 0x8F, 0xA3,
-	0x64, 0x0F, 0xC2, 0x6F, 0xAE, 0x56, 0xAB, 0x99, 0x4C, 0xE6, 0x1B, 0xDF,
-	0xF8, 0x46, 0xB3, 0xD9, 0x7C, 0xFE, 0xFC, 0x79, 0x2E, 0x9B, 0xE3, 0x98,
-	0x10, 0x08, 0x50, 0xAB, 0xD5, 0x3A, 0x39, 0x39, 0x81, 0x31, 0x97, 0xAB,
-	0x2F, 0xAF, 0x29, 0xC7, 0xCE, 0x90, 0xFE, 0x04, 0x5F, 0x40, 0xBE, 0x94,
-	0x26, 0x3B, 0xC6, 0x00, 0x16, 0xF6, 0x8F, 0xF9, 0x09, 0x84, 0xD3, 0x6C,
-	0x3D, 0x2D, 0xBD, 0x1B, 0x39, 0x5E, 0xE4, 0x55, 0x0A, 0x61, 0x12, 0x20,
-	0x25, 0x71, 0x81, 0x43, 0xE4, 0xE8, 0x83, 0xB2, 0x5A, 0x13, 0xED, 0xEE,
-	0x90, 0x81, 0x93, 0xD3, 0xDD, 0x34, 0x93, 0x96, 0x64, 0x57, 0x55, 0x39,
-	0xB3, 0x05, 0xE8, 0x13, 0x60, 0x28, 0x08, 0x3E, 0xE8, 0x85, 0xE3, 0xE9,
-	0x7E, 0x5F, 0xB4, 0x13, 0x96, 0x75, 0x00, 0x9A, 0xFE, 0x42, 0x2C, 0x99,
-	0x4B, 0xA5, 0x52, 0x83, 0xC1, 0x60, 0x63, 0x63, 0xE3, 0x93, 0x4F, 0x3E,
-	0x49, 0xA5, 0x52, 0xA8, 0x69, 0x35, 0x5B, 0xCC, 0x80, 0x4E, 0xC1, 0x8D,
-	0x45, 0x15, 0xD1, 0x70, 0x34, 0x94, 0x5D, 0x15, 0x34, 0xC3, 0xFD, 0xF8,
-	0xF0, 0xE8, 0x5F, 0x30, 0x3D, 0x3D, 0x8D, 0x43, 0x43, 0xEF, 0x56, 0x6A,
-	0x0F, 0x19, 0x4F, 0xD0, 0x07, 0xA5, 0xB2, 0xA5, 0xB4, 0xE1, 0x45, 0x38,
-	0x45, 0x40, 0x53, 0xA1, 0x35, 0x3E, 0x01, 0xAF, 0xED, 0x8D, 0xC2, 0x46,
-	0x9E, 0xB2, 0xDB, 0x9A, 0xEC, 0x0D, 0x03, 0x9D, 0x23, 0x7B, 0x94, 0x30,
-	0xD1, 0xA1, 0x29, 0x5C, 0x65, 0xB0, 0xCA, 0x94, 0x0E, 0xDB, 0xBD, 0x70,
-	0xF8, 0x05, 0x7B, 0xBD, 0x00, 0xEC, 0x95, 0x7C, 0xF4, 0x49, 0x92, 0x9A,
-	0xF4, 0x0B, 0xFA, 0xFD, 0x7E, 0xA5, 0x5A, 0x41, 0xFE, 0x6F, 0x6D, 0x6D,
-	0x6D, 0x77, 0x77, 0x77, 0x38, 0x1C, 0x76, 0x3B, 0x5D, 0x93, 0xD9, 0xE4,
-	0xF1, 0x78, 0x6C, 0x36, 0x1B, 0x1C, 0x70, 0x5C, 0xDF, 0xA0, 0x37, 0x68,
-	0x96, 0x7E, 0x52, 0xE6, 0x6C, 0x36, 0x9B, 0xCF, 0xEB, 0x8B, 0xC7, 0xE3,
-	0x6F, 0xBE, 0xF9, 0x66, 0xB9, 0x5C, 0x06, 0x30, 0x2C, 0x2B, 0xA5, 0xA1,
-	0x21, 0x35, 0x2D, 0xA2, 0xD8, 0xC4, 0x94, 0x58, 0x2F, 0xBB, 0x04, 0xE0,
-	0xB8, 0xA3, 0x8D, 0xE4, 0x6B, 0xFB, 0x3B, 0x28, 0x93, 0xBF, 0x42, 0xA7,
-	0x00, 0x64, 0xCC, 0x27, 0xB9, 0x40, 0x6C, 0x19, 0x40, 0x1F, 0x89, 0x46,
-	0x49, 0x7A, 0xFD, 0xDC, 0x03, 0x60, 0x6D, 0x18, 0xD0, 0x8C, 0xDE, 0x0C,
-	0xB3, 0xB3, 0xB3, 0xE1, 0x70, 0x98, 0x29, 0x4F, 0xF0, 0x99, 0x30, 0xEB,
-	0x07, 0x11, 0x13, 0xB8, 0x95, 0x44, 0x14, 0x18, 0x61, 0xCA, 0x8E, 0xF7,
-	0x5C, 0xCA, 0x4E, 0xBB, 0x73, 0x7C, 0x7C, 0xDC, 0xE9, 0x74, 0xD6, 0xD7,
-	0xD7, 0x9F, 0x3F, 0x7F, 0x8E, 0xD4, 0x98, 0xCD, 0x66, 0x8B, 0x46, 0xA3,
-	0x83, 0xC1, 0x00, 0xD1, 0xA2, 0xD5, 0x6A, 0x25, 0x83, 0x5A, 0x36, 0xAA,
-	0x25, 0x87, 0x17, 0x32, 0x8E, 0x01, 0x09, 0x0B, 0x8B, 0x0B, 0x5F, 0xFB,
-	0xDA, 0xD7, 0xCE, 0x9E, 0x3D, 0xFB, 0xF2, 0xE5, 0x4B, 0xB7, 0xDB, 0x8D,
-	0xDC, 0x38, 0xD4, 0x0B, 0xDA, 0x8E, 0x41, 0xB3, 0x21, 0xD0, 0xA5, 0x43,
-	0x39, 0xD9, 0x16, 0x12, 0x87, 0x09, 0x41, 0x19, 0x10, 0x84, 0xD7, 0x4E,
-	0xDD, 0x56, 0x26, 0x05, 0x01, 0x39, 0x13, 0x6A, 0x12, 0x4D, 0xCF, 0x0D,
-	0x29, 0x83, 0x58, 0x7A, 0xF2, 0x70, 0xE5, 0x44, 0x25, 0xCA, 0x14, 0x0C,
-	0x2C, 0x92, 0x30, 0x2B, 0x2B, 0x2B, 0x17, 0x2E, 0x5C, 0x30, 0x99, 0x4C,
-	0x87, 0x87, 0x87, 0x20, 0xFF, 0xC0, 0x9B, 0x9C, 0x99, 0x99, 0x89, 0xC5,
-	0x62, 0xFD, 0x7E, 0xBF, 0x5C, 0x2E, 0x03, 0x63, 0x91, 0xBE, 0x8A, 0x1C,
-	0x43, 0x22, 0x31, 0x0C, 0x52, 0x65, 0x91, 0xAB, 0x8A, 0xC5, 0x62, 0x6B,
-	0x6B, 0x6B, 0xE0, 0x02, 0xE3, 0xA8, 0x71, 0x20, 0x03, 0x5A, 0xB1, 0x4C,
-	0x56, 0xF4, 0x33, 0x8C, 0x47, 0x56, 0x19, 0x7D, 0xAA, 0x37, 0x36, 0x36,
-	0x36, 0x37, 0x37, 0x2B, 0x95, 0xCA, 0x67, 0x9F, 0x7D, 0xB6, 0xB3, 0xB3,
-	0x93, 0xC9, 0x64, 0xD0, 0xCB, 0x00, 0x59, 0x58, 0x54, 0xFD, 0x81, 0x8A,
-	0x2A, 0x9B, 0xC1, 0x4E, 0x46, 0x39, 0xA8, 0xB3, 0xF3, 0x78, 0x3C, 0xC5,
-	0x62, 0x31, 0x9F, 0xCF, 0x6B, 0xFA, 0x81, 0x7D, 0xE9, 0x06, 0x40, 0x51,
-	0x70, 0xC2, 0xA7, 0x04, 0x60, 0xE5, 0xA2, 0xD3, 0x13, 0xA0, 0x27, 0x27,
-	0x1F, 0x45, 0xD3, 0xA9, 0xC4, 0x6A, 0xB5, 0x86, 0x43, 0xE1, 0xCB, 0x97,
-	0x2F, 0x5F, 0xBE, 0x7C, 0xB9, 0x52, 0xA9, 0x7C, 0xFE, 0xF9, 0xE7, 0x27,
-	0x27, 0x27, 0xF0, 0xD9, 0xC7, 0x09, 0x58, 0x55, 0x41, 0x0B, 0xA4, 0x74,
-	0x3A, 0x2D, 0x3B, 0x8C, 0xC8, 0xA8, 0x9D, 0xA7, 0x9B, 0xEA, 0x95, 0xB6,
-	0x1D, 0xDE, 0x4E, 0x34, 0x1A, 0x3D, 0x77, 0xEE, 0x1C, 0x72, 0xC2, 0xAA,
-	0xA2, 0x66, 0xB2, 0x19, 0x56, 0x40, 0xA2, 0xDA, 0x89, 0xA1, 0x9F, 0x44,
-	0xF0, 0x39, 0x3B, 0x33, 0x12, 0x89, 0x78, 0xBD, 0x5E, 0x14, 0x43, 0x24,
-	0x93, 0xC9, 0xE7, 0xCF, 0x9F, 0x63, 0xF0, 0x26, 0xC0, 0x03, 0x98, 0xE5,
-	0x40, 0x20, 0x00, 0x16, 0x08, 0x8C, 0x2D, 0x7B, 0x08, 0xC8, 0x49, 0x6F,
-	0x88, 0xC3, 0xED, 0x76, 0xBB, 0xD7, 0xE3, 0x8D, 0xC6, 0xA2, 0x5E, 0xAF,
-	0x17, 0x4D, 0xE8, 0xA4, 0x72, 0xFE, 0xD2, 0x0D, 0x00, 0x18, 0xE2, 0xF1,
-	0x78, 0x40, 0xBA, 0x92, 0x6C, 0x4E, 0x92, 0x20, 0x25, 0x15, 0x4E, 0x92,
-	0xA2, 0x24, 0x9F, 0x57, 0x26, 0xD3, 0x41, 0xB3, 0xB8, 0xF4, 0xC6, 0xA5,
-	0x73, 0xE7, 0xCE, 0x1D, 0x1D, 0x1D, 0xBD, 0x7C, 0xF9, 0x12, 0x04, 0x16,
-	0xCE, 0x57, 0x1D, 0x0C, 0x06, 0xF5, 0x5A, 0xBD, 0x56, 0xAB, 0xCD, 0xCF,
-	0xCF, 0x33, 0x09, 0x41, 0xAE, 0xB9, 0x94, 0x2F, 0xD6, 0xFE, 0x11, 0xF0,
-	0x62, 0xBB, 0x77, 0x80, 0xAF, 0x53, 0x53, 0x53, 0x97, 0x2E, 0x5D, 0x3A,
-	0x39, 0x39, 0x39, 0x39, 0x39, 0x21, 0x13, 0x02, 0x38, 0x01, 0x36, 0x00,
-	0x9D, 0x54, 0x65, 0x8B, 0x6C, 0xA4, 0xE6, 0x31, 0xD0, 0x18, 0x56, 0xBD,
-	0xD9, 0x6C, 0x7E, 0xFE, 0xF9, 0xE7, 0xF7, 0xEF, 0xDF, 0x4F, 0x9E, 0x24,
-	0xD1, 0x48, 0x17, 0xD6, 0x0E, 0x45, 0x64, 0xB3, 0xB3, 0xB3, 0x67, 0xCE,
-	0x9C, 0x39, 0x39, 0x39, 0x41, 0x96, 0x58, 0xF6, 0x96, 0xC0, 0x53, 0x81,
-	0xF2, 0x14, 0x08, 0x04, 0xA6, 0xA6, 0xA6, 0xDE, 0x78, 0xE3, 0x8D, 0x64,
-	0x32, 0x49, 0xD3, 0xF8, 0xDA, 0xF9, 0xBB, 0x8A, 0x46, 0xFB, 0xA3, 0x98,
-	0x04, 0xD3, 0x18, 0x10, 0x8E, 0x23, 0xEB, 0x0B, 0x5F, 0x93, 0xEB, 0x4E,
-	0xC6, 0x8E, 0xEC, 0xA8, 0x47, 0xD4, 0x81, 0x94, 0x1E, 0x8C, 0x3B, 0x5C,
-	0x5A, 0x5A, 0x0A, 0x06, 0x83, 0x4F, 0x9E, 0x3E, 0x49, 0x9E, 0x24, 0x11,
-	0x2E, 0xD1, 0x73, 0x25, 0x6A, 0x88, 0x5E, 0xCA, 0x5E, 0xAF, 0x97, 0x57,
-	0xD6, 0x58, 0x4B, 0x39, 0x72, 0x1A, 0x57, 0x86, 0xDF, 0x0D, 0x25, 0x0B,
-	0x5F, 0x5B, 0x55, 0xD5, 0x68, 0x34, 0x9A, 0xCD, 0x66, 0xC1, 0xDA, 0x24,
-	0x15, 0x05, 0xEF, 0x02, 0x9D, 0x40, 0x77, 0x0E, 0x3B, 0x0A, 0x6B, 0x01,
-	0x42, 0x3C, 0x79, 0x92, 0x98, 0x10, 0x84, 0xD5, 0x27, 0xA3, 0x00, 0x23,
-	0x5F, 0xCD, 0x66, 0x33, 0x90, 0x22, 0xF6, 0x48, 0x06, 0x44, 0xC1, 0x5A,
-	0x6D, 0x8C, 0x35, 0x5C, 0x5C, 0x5C, 0xFC, 0xDA, 0xD7, 0xBE, 0x66, 0xB3,
-	0xD9, 0xB6, 0xB6, 0xB6, 0x24, 0xBD, 0x43, 0x16, 0x94, 0xFF, 0xDE, 0x06,
-	0x70, 0x16, 0x88, 0xD3, 0xE9, 0x8C, 0xC5, 0x62, 0x68, 0x61, 0xDA, 0x6C,
-	0x36, 0xF7, 0xF6, 0xF6, 0xB2, 0xD9, 0x2C, 0x6A, 0xFB, 0x64, 0xAA, 0x96,
-	0x42, 0xF4, 0x65, 0x7C, 0x50, 0xB2, 0x16, 0x50, 0x33, 0xFE, 0xF4, 0xE9,
-	0x53, 0xE4, 0x20, 0x51, 0x9A, 0x2B, 0x8B, 0xB9, 0xE8, 0x4A, 0x8F, 0x46,
-	0xA3, 0x50, 0x28, 0xC4, 0x16, 0x6F, 0x32, 0x9C, 0x96, 0x4A, 0x96, 0xF3,
-	0x7E, 0xA1, 0xE8, 0x41, 0x2E, 0x82, 0xCA, 0x42, 0x20, 0x86, 0x01, 0xF4,
-	0x28, 0xE3, 0x02, 0x88, 0x86, 0xDB, 0xB5, 0xDB, 0x6D, 0x38, 0x02, 0x3E,
-	0x9F, 0x0F, 0x88, 0x98, 0xD5, 0x6A, 0xC5, 0x3C, 0x6F, 0xD0, 0xDC, 0x20,
-	0x7C, 0xE8, 0x23, 0x5D, 0xAB, 0xD5, 0xDA, 0x9D, 0x57, 0x93, 0xAC, 0xD8,
-	0x21, 0x15, 0xE4, 0xC3, 0x95, 0x95, 0x95, 0xCD, 0xCD, 0x4D, 0x8B, 0xC5,
-	0x82, 0xC5, 0x81, 0x96, 0x83, 0xA3, 0x11, 0x0C, 0x06, 0xCF, 0x9D, 0x3B,
-	0xF7, 0xAD, 0x6F, 0x7D, 0x2B, 0x16, 0x8B, 0xFD, 0xE4, 0x27, 0x3F, 0xC9,
-	0x65, 0x73, 0x5C, 0xBA, 0xD7, 0x3A, 0x42, 0x8A, 0x74, 0x57, 0x50, 0xCD,
-	0x83, 0xC9, 0x17, 0x47, 0x47, 0x47, 0xEF, 0xBF, 0xFF, 0x3E, 0x78, 0x6A,
-	0x1A, 0x2C, 0x97, 0xD5, 0x8A, 0x9A, 0xB1, 0x2A, 0x9A, 0xB9, 0xE2, 0xE0,
-	0x7D, 0x58, 0x2C, 0x96, 0xE3, 0xE3, 0x63, 0xAC, 0x42, 0xB3, 0xD9, 0x04,
-	0xF3, 0x87, 0x34, 0x24, 0xA0, 0xCA, 0xEC, 0x9E, 0x85, 0x24, 0x2D, 0xC1,
-	0x38, 0x52, 0xC9, 0x24, 0x92, 0x01, 0x77, 0x85, 0xC3, 0xA3, 0xB1, 0x1F,
-	0x00, 0x06, 0xEC, 0x76, 0x3B, 0x18, 0x0C, 0xD0, 0xFE, 0x68, 0x80, 0xC1,
-	0x56, 0x90, 0x10, 0xE7, 0xC1, 0x60, 0x10, 0x8D, 0x46, 0x17, 0x16, 0x16,
-	0xBC, 0x5E, 0x2F, 0xC6, 0x73, 0xF4, 0xFB, 0xFD, 0xFD, 0xFD, 0x7D, 0x70,
-	0x03, 0x46, 0xA3, 0x11, 0x58, 0xB7, 0xD2, 0xD7, 0x94, 0x95, 0xE2, 0x84,
-	0x61, 0x16, 0x17, 0x17, 0x37, 0x37, 0x37, 0x81, 0x83, 0xA1, 0x39, 0x8D,
-	0xCD, 0x66, 0x0B, 0x86, 0x82, 0x17, 0xCE, 0x5F, 0xF8, 0xEA, 0x57, 0xBF,
-	0x6A, 0x36, 0x9B, 0xEF, 0xDC, 0xB9, 0x03, 0xAA, 0x7D, 0xA7, 0xDD, 0xA1,
-	0x30, 0x71, 0xDE, 0xC7, 0xAB, 0x0D, 0xC0, 0xCE, 0x40, 0x9F, 0xA2, 0xFE,
-	0xF4, 0xE6, 0xCD, 0x9B, 0xE7, 0xCF, 0x9F, 0xFF, 0x97, 0x7F, 0xF9, 0x17,
-	0x74, 0x2E, 0x97, 0x4D, 0x36, 0x34, 0x1E, 0xD1, 0x64, 0xBD, 0xEE, 0xE4,
-	0x98, 0x6D, 0xA6, 0x7F, 0xD1, 0x45, 0x19, 0xDA, 0x1F, 0xB6, 0x14, 0x9E,
-	0x2E, 0x67, 0x76, 0xE4, 0xF3, 0xF9, 0x85, 0x85, 0x85, 0xC5, 0xC5, 0xC5,
-	0xA3, 0xA3, 0x23, 0x28, 0x77, 0x06, 0xAB, 0x32, 0x3D, 0x00, 0x84, 0x87,
-	0x87, 0x00, 0xED, 0x6E, 0x41, 0x23, 0xC3, 0x63, 0xA0, 0x0C, 0x1A, 0x8C,
-	0x44, 0xB0, 0xD5, 0x99, 0xBF, 0x24, 0x54, 0xAE, 0x28, 0xCA, 0xF4, 0xF4,
-	0xF4, 0xF5, 0xEB, 0xD7, 0x2F, 0x5C, 0xB8, 0xD0, 0xE9, 0x74, 0x9E, 0x3D,
-	0x7B, 0x86, 0xCA, 0x5E, 0x54, 0x6F, 0xD3, 0xFB, 0x62, 0xDB, 0x46, 0x89,
-	0x2D, 0x83, 0x44, 0xA3, 0xAA, 0xEA, 0xCC, 0xCC, 0xCC, 0xD2, 0xD2, 0x52,
-	0x28, 0x14, 0x42, 0x1E, 0x17, 0xDB, 0x19, 0x8F, 0xC7, 0x93, 0xC9, 0xE4,
-	0xCB, 0x97, 0x2F, 0xB7, 0xB6, 0xB6, 0x12, 0x89, 0x44, 0xA9, 0x5C, 0x6A,
-	0xB5, 0x5B, 0x34, 0x12, 0x9C, 0xCF, 0xF4, 0x2A, 0x12, 0x26, 0x63, 0x07,
-	0x92, 0xB5, 0xB8, 0xB8, 0xB8, 0xBC, 0xBC, 0x7C, 0x7A, 0x7A, 0x7A, 0x7A,
-	0x7A, 0xAA, 0xA9, 0x5E, 0x93, 0x1E, 0x2E, 0x84, 0x91, 0x1E, 0xBA, 0xEC,
-	0x50, 0x20, 0xAB, 0xD4, 0xA1, 0xBB, 0x78, 0x56, 0xB0, 0x2E, 0x9C, 0xA5,
-	0x49, 0xA3, 0x8D, 0x62, 0x0A, 0xD8, 0x86, 0x37, 0xDE, 0x78, 0xE3, 0xF9,
-	0xF3, 0xE7, 0x80, 0x3A, 0xE4, 0x99, 0xA3, 0xBB, 0x82, 0x3A, 0x00, 0x48,
-	0x3D, 0x84, 0x06, 0x7A, 0x0C, 0x8E, 0x10, 0xD3, 0x12, 0xEC, 0xFB, 0x41,
-	0xF2, 0x1A, 0x6B, 0xAD, 0xA8, 0xE2, 0xE8, 0xD1, 0x1E, 0x1E, 0x1E, 0xA2,
-	0xB9, 0x49, 0xBD, 0x5E, 0x67, 0x1E, 0x90, 0xB8, 0x1E, 0x49, 0x28, 0x6C,
-	0xBC, 0x06, 0xBF, 0x4B, 0xAF, 0xD7, 0xFB, 0x7C, 0x3E, 0xE4, 0x30, 0xD0,
-	0x0F, 0xB6, 0x5E, 0xAF, 0xDF, 0xBD, 0x7B, 0x17, 0xD9, 0xB4, 0x54, 0x2A,
-	0x95, 0xCF, 0xE5, 0x25, 0x2F, 0x4D, 0x36, 0xF8, 0x7E, 0x35, 0x09, 0x1A,
-	0xB4, 0x48, 0x18, 0xC0, 0x99, 0x99, 0x19, 0x9F, 0xCF, 0xF7, 0xEB, 0x5F,
-	0xFF, 0x5A, 0xB6, 0x8B, 0x95, 0x1D, 0xE2, 0x24, 0x29, 0x93, 0xBF, 0x61,
-	0x42, 0x4E, 0xB6, 0x27, 0x80, 0xEC, 0x20, 0x02, 0xE4, 0x59, 0x91, 0x34,
-	0x1E, 0xF2, 0xFA, 0x49, 0x1B, 0x45, 0x65, 0xC0, 0xD2, 0xD2, 0xD2, 0x8D,
-	0x1B, 0x37, 0x48, 0x4B, 0x95, 0x9D, 0xC7, 0xD0, 0xBE, 0x22, 0x1A, 0x8D,
-	0x2E, 0x2F, 0x2F, 0xB3, 0x1D, 0x07, 0x6E, 0xD7, 0x6C, 0x36, 0xB3, 0xD9,
-	0x6C, 0x30, 0x18, 0xF4, 0xFB, 0xFD, 0x32, 0x2B, 0x47, 0x30, 0x92, 0x1B,
-	0xA0, 0xA9, 0x75, 0x80, 0xF1, 0x27, 0x85, 0x0B, 0x22, 0x65, 0x32, 0x99,
-	0x86, 0x83, 0x21, 0x77, 0x48, 0x13, 0x8E, 0x90, 0xFA, 0x80, 0x18, 0x8D,
-	0x8D, 0xB2, 0x70, 0x3E, 0x30, 0x6D, 0xA4, 0x5C, 0x29, 0x57, 0x4A, 0x95,
-	0x46, 0xB3, 0xC1, 0xCE, 0xEB, 0xC4, 0x24, 0xB8, 0x38, 0xE3, 0xC3, 0x8D,
-	0xF8, 0xC2, 0xED, 0x76, 0xFB, 0x7C, 0x3E, 0xAB, 0xD5, 0x0A, 0xF8, 0x10,
-	0x53, 0x66, 0x70, 0x03, 0xDE, 0x1B, 0xAA, 0x19, 0x50, 0x3E, 0x21, 0x33,
-	0x4D, 0x67, 0x29, 0x79, 0x44, 0x64, 0x93, 0x6E, 0xD9, 0xEB, 0x65, 0xB2,
-	0x0D, 0x0A, 0x3B, 0x3C, 0x42, 0xAD, 0xFB, 0xFD, 0xFE, 0x71, 0xFB, 0x0A,
-	0x9D, 0xDE, 0xA8, 0x18, 0x61, 0x2A, 0x5C, 0x2E, 0x97, 0xDF, 0xEF, 0x8F,
-	0xC7, 0xE3, 0x17, 0x2F, 0x5E, 0xBC, 0x7C, 0xF9, 0x32, 0x98, 0x16, 0x84,
-	0xCF, 0xE8, 0x1F, 0xBB, 0xDD, 0xEE, 0xD3, 0xD3, 0xD3, 0xC7, 0x8F, 0x1F,
-	0xA3, 0xF5, 0xAD, 0x64, 0xC5, 0x6A, 0xC4, 0x1F, 0xBE, 0x35, 0xBE, 0x00,
-	0x3B, 0xF1, 0x7B, 0xE9, 0x6B, 0xDD, 0x78, 0xA4, 0x9C, 0xA2, 0x2A, 0x9A,
-	0x81, 0x0C, 0x44, 0xD4, 0x21, 0x7C, 0xD8, 0x63, 0xE4, 0xA3, 0x60, 0x78,
-	0xC6, 0x3D, 0x40, 0x9A, 0x0D, 0x59, 0x27, 0xCC, 0xBB, 0xCB, 0x29, 0xD2,
-	0x16, 0x8B, 0x65, 0x9C, 0x94, 0x87, 0x5E, 0xAB, 0xD5, 0x6A, 0x38, 0xE9,
-	0xD0, 0x83, 0xFC, 0x12, 0xD9, 0x0F, 0xE4, 0x28, 0x70, 0x20, 0x1E, 0x87,
-	0x03, 0xC9, 0xE4, 0x38, 0x8E, 0xAA, 0x06, 0x4A, 0x94, 0xB9, 0x7E, 0x59,
-	0x7F, 0xCA, 0x8C, 0x79, 0x26, 0x93, 0xF9, 0xEC, 0xB3, 0xCF, 0x14, 0x45,
-	0x81, 0x28, 0xAC, 0xAE, 0xAE, 0x7A, 0xBD, 0x5E, 0x4C, 0x94, 0x02, 0x8B,
-	0x2D, 0x1A, 0x8D, 0x6E, 0x6E, 0x6E, 0xDE, 0xBE, 0x7D, 0x3B, 0x14, 0x0C,
-	0x7D, 0xAE, 0xFF, 0x1C, 0xDC, 0x05, 0xA8, 0x35, 0x16, 0xC6, 0x42, 0x05,
-	0xB1, 0x66, 0x51, 0x16, 0xD5, 0xB2, 0xCD, 0x0C, 0xE7, 0xA9, 0x60, 0x98,
-	0x20, 0xA0, 0x0B, 0x38, 0xB8, 0x88, 0xC3, 0x59, 0xCD, 0xCB, 0x51, 0xE7,
-	0xBA, 0x91, 0x6E, 0x30, 0x1C, 0x48, 0xF5, 0xCB, 0xD7, 0x81, 0x65, 0xA6,
-	0x0C, 0x71, 0x94, 0x28, 0xE7, 0x4D, 0x32, 0x2F, 0x46, 0xC8, 0x52, 0xCE,
-	0x43, 0x54, 0x50, 0x8D, 0xD5, 0x6E, 0xB7, 0x65, 0x11, 0x76, 0xBF, 0xDF,
-	0x47, 0xD5, 0x35, 0x1A, 0x04, 0xD0, 0x82, 0x03, 0xCB, 0x84, 0xC5, 0x93,
-	0xD3, 0x0F, 0x65, 0x1A, 0x59, 0x46, 0xCE, 0xD2, 0x81, 0x01, 0x85, 0x46,
-	0x0E, 0x4C, 0xD4, 0x28, 0x04, 0x74, 0x30, 0xD5, 0xE9, 0x74, 0x67, 0xCE,
-	0x9C, 0x19, 0x8D, 0x46, 0xA0, 0x7F, 0x41, 0xED, 0x00, 0xBF, 0x5B, 0x5A,
-	0x5A, 0xBA, 0x79, 0xF3, 0x66, 0x34, 0x1A, 0x85, 0x68, 0x57, 0x2A, 0x95,
-	0x7C, 0x3E, 0x0F, 0x27, 0x04, 0xF9, 0x48, 0xD8, 0x5B, 0x12, 0x08, 0xA5,
-	0xEF, 0x20, 0x2B, 0xBF, 0xD9, 0x63, 0x18, 0x18, 0x38, 0xEE, 0xC5, 0x39,
-	0x33, 0x12, 0x7A, 0x83, 0x73, 0x88, 0x39, 0x9A, 0x76, 0xB3, 0x5D, 0x12,
-	0x00, 0xE8, 0xAA, 0xC9, 0x62, 0x45, 0xE9, 0x16, 0x6A, 0x86, 0x45, 0xB0,
-	0xC4, 0x55, 0x4E, 0xB5, 0xEA, 0xF5, 0x7A, 0xE3, 0x86, 0x4D, 0x74, 0xA5,
-	0x69, 0x7C, 0x38, 0xFB, 0x06, 0xDA, 0x46, 0x31, 0x2A, 0x66, 0x8B, 0x19,
-	0x71, 0x4A, 0xB3, 0xD9, 0x64, 0x65, 0x0F, 0x01, 0x09, 0x76, 0x17, 0x66,
-	0xE7, 0x63, 0x4D, 0x3D, 0x1E, 0x08, 0x04, 0x6C, 0xA5, 0x2D, 0x33, 0xC6,
-	0xA4, 0x29, 0xE0, 0xE1, 0x3A, 0x9D, 0x4E, 0x2C, 0x16, 0xC3, 0x8D, 0xC8,
-	0x5F, 0x87, 0xC3, 0x6A, 0x30, 0x18, 0xD2, 0xE9, 0xF4, 0xA7, 0x9F, 0x7E,
-	0xBA, 0xBD, 0xBD, 0x8D, 0x96, 0xD7, 0x88, 0x2A, 0x18, 0x4C, 0xF4, 0xFB,
-	0x7D, 0x44, 0x91, 0x93, 0x3D, 0xB7, 0x34, 0x55, 0xAE, 0xE0, 0x8A, 0x41,
-	0x7B, 0x00, 0x14, 0x91, 0x43, 0x82, 0xC8, 0x29, 0xE6, 0x45, 0x7C, 0x3E,
-	0x9F, 0xCB, 0xE5, 0x82, 0x06, 0x66, 0xFF, 0x71, 0xFE, 0x09, 0xC1, 0x63,
-	0x66, 0x4D, 0x68, 0x78, 0x49, 0x74, 0xA4, 0x04, 0x48, 0x4D, 0xA8, 0xC8,
-	0x0C, 0x99, 0x2C, 0x88, 0x80, 0x5B, 0x0D, 0x31, 0x67, 0xD4, 0x83, 0x16,
-	0x6C, 0x38, 0x9B, 0xD8, 0x0C, 0x0E, 0x8B, 0xC3, 0x5C, 0x25, 0x68, 0x00,
-	0x96, 0x51, 0xE0, 0xC4, 0xA0, 0xAC, 0x03, 0xBC, 0x33, 0x84, 0x3C, 0xCC,
-	0x19, 0xF1, 0x1C, 0xD0, 0x55, 0xC5, 0x89, 0x6E, 0x34, 0x1A, 0xE1, 0x70,
-	0x58, 0x56, 0x20, 0x23, 0xAC, 0xDB, 0xDD, 0xDD, 0x3D, 0x3A, 0x3A, 0x3A,
-	0x3A, 0x3A, 0x42, 0xAB, 0x11, 0xE6, 0x9B, 0x46, 0xA3, 0x11, 0xCE, 0x01,
-	0xA4, 0x98, 0xC8, 0xE0, 0x64, 0xE0, 0xA3, 0x71, 0xA0, 0xB1, 0xD6, 0xF2,
-	0x70, 0x68, 0x94, 0x27, 0x99, 0x4B, 0xE0, 0x84, 0x21, 0xE5, 0x4B, 0x62,
-	0x16, 0x3B, 0x00, 0x70, 0x38, 0x1C, 0xAB, 0xCC, 0x60, 0x1B, 0x08, 0xAE,
-	0x30, 0x6B, 0xA2, 0x81, 0xD6, 0x15, 0xD9, 0xEA, 0x90, 0x75, 0x33, 0xF8,
-	0xB0, 0x9E, 0x02, 0x9D, 0xE3, 0x2C, 0x16, 0x0B, 0x5A, 0x1A, 0xE2, 0xB8,
-	0x30, 0x3E, 0x80, 0xD2, 0x24, 0x6B, 0x83, 0x87, 0x00, 0xAE, 0x2D, 0x9B,
-	0x92, 0xB9, 0xDD, 0x6E, 0x76, 0x87, 0xD4, 0x8C, 0x5B, 0xA3, 0x46, 0x92,
-	0x5C, 0x8A, 0x66, 0xB3, 0x09, 0xF0, 0x8B, 0x25, 0xBB, 0xF9, 0x7C, 0xFE,
-	0xE8, 0xE8, 0x08, 0x56, 0x0E, 0x5E, 0x26, 0xA7, 0xEA, 0xC1, 0xA7, 0x62,
-	0x87, 0xAD, 0xD7, 0xF6, 0x80, 0xD7, 0x54, 0xDA, 0xD2, 0x5D, 0x96, 0xED,
-	0xF4, 0x89, 0xF7, 0xC9, 0x11, 0x29, 0x4C, 0xB1, 0xD1, 0x07, 0xA5, 0xC3,
-	0xD3, 0xE9, 0x74, 0x7A, 0xDD, 0x5E, 0x7F, 0x30, 0xB6, 0x97, 0x40, 0x71,
-	0xC0, 0x10, 0xE0, 0x52, 0x60, 0x58, 0x84, 0x9C, 0x1F, 0xF8, 0x7B, 0x81,
-	0x18, 0x65, 0x81, 0x7D, 0x72, 0xE9, 0xB1, 0xA1, 0x65, 0x62, 0x30, 0x18,
-	0x9C, 0x9B, 0x9B, 0x5B, 0x5A, 0x5A, 0xC2, 0xCB, 0xE3, 0x70, 0xB0, 0xBF,
-	0x7F, 0xBB, 0xDD, 0xAE, 0x94, 0x2B, 0x95, 0x6A, 0x85, 0xC9, 0x3C, 0xCA,
-	0x32, 0x4C, 0x08, 0xC8, 0x7E, 0xC1, 0x40, 0x30, 0x14, 0x0E, 0xD5, 0x6A,
-	0xB5, 0x4C, 0x26, 0x03, 0x1B, 0xA3, 0xA9, 0xA7, 0x64, 0x82, 0x41, 0x12,
-	0xFF, 0x9A, 0xCD, 0xA6, 0xC7, 0xE3, 0xF1, 0xF9, 0x7C, 0xFD, 0x5E, 0xBF,
-	0xD3, 0xE9, 0xA0, 0x25, 0x08, 0xD1, 0x37, 0xB6, 0xF8, 0xC7, 0x75, 0xD8,
-	0x6A, 0x1D, 0xB3, 0x78, 0x34, 0x99, 0x03, 0x39, 0xA9, 0x18, 0x5E, 0x1C,
-	0x47, 0xB5, 0x63, 0xED, 0x34, 0x2A, 0x85, 0x1D, 0x65, 0x49, 0x7C, 0x42,
-	0x2A, 0x09, 0x0A, 0x19, 0x8B, 0xCB, 0xCE, 0x85, 0x3C, 0x07, 0xF9, 0x7C,
-	0x1E, 0xC0, 0x7B, 0x30, 0x18, 0xF4, 0xF9, 0x7C, 0xD8, 0x33, 0xD0, 0xEB,
-	0x35, 0x83, 0xA9, 0x5E, 0xE5, 0x84, 0x35, 0x29, 0x5F, 0x59, 0x26, 0x68,
-	0x30, 0x18, 0x42, 0xA1, 0xD0, 0x85, 0x0B, 0x17, 0x6E, 0xDE, 0xBC, 0x69,
-	0xB7, 0xDB, 0xA1, 0x6A, 0xD9, 0xFD, 0x86, 0x63, 0xA6, 0xEA, 0x8D, 0x71,
-	0xBB, 0x57, 0xBA, 0x49, 0x2C, 0x1A, 0x05, 0x7C, 0x36, 0x3D, 0x3D, 0xBD,
-	0xBC, 0xBC, 0x1C, 0x0E, 0x87, 0x13, 0x89, 0x04, 0x02, 0x7D, 0x76, 0x74,
-	0xD0, 0x1C, 0xC9, 0xD7, 0xF2, 0x91, 0xE0, 0xA8, 0x74, 0x3A, 0x1D, 0x7F,
-	0xC0, 0xEF, 0xF5, 0x7A, 0x8D, 0x46, 0x63, 0xB9, 0x54, 0xCE, 0x66, 0xB3,
-	0x6C, 0xB9, 0x4F, 0x13, 0x82, 0x53, 0x8F, 0x13, 0x29, 0x7D, 0x62, 0x5A,
-	0x02, 0xAA, 0x44, 0x68, 0x57, 0x59, 0x8B, 0x0A, 0x54, 0x83, 0x47, 0x81,
-	0xF6, 0x16, 0x70, 0x3A, 0x9A, 0xF0, 0x59, 0xAD, 0x56, 0xC4, 0x65, 0x38,
-	0x79, 0xDC, 0x03, 0x1C, 0x05, 0xC6, 0x49, 0xE9, 0x74, 0x1A, 0x53, 0x30,
-	0x31, 0x7D, 0x1C, 0x0C, 0x75, 0xAB, 0xD5, 0xFA, 0xE1, 0x87, 0x1F, 0x72,
-	0xF4, 0x0B, 0x09, 0xC8, 0x8A, 0xC4, 0xA2, 0x25, 0x85, 0x04, 0xB1, 0xBE,
-	0xC7, 0xE3, 0xB9, 0x78, 0xF1, 0x62, 0x34, 0x1A, 0xCD, 0x64, 0x32, 0x78,
-	0x3D, 0x54, 0x9E, 0x10, 0xEA, 0xE2, 0xD0, 0x27, 0x88, 0x3C, 0xFE, 0x1C,
-	0x36, 0x07, 0x76, 0x02, 0x3B, 0xB1, 0xBA, 0xBA, 0x3A, 0x33, 0x33, 0xF3,
-	0xE9, 0xA7, 0x9F, 0xA2, 0xD7, 0x14, 0xF2, 0x8E, 0x93, 0xD5, 0xAC, 0x34,
-	0xCB, 0x80, 0x7F, 0xE9, 0x2F, 0xAB, 0xAA, 0xDA, 0xEE, 0xB4, 0xB1, 0x9D,
-	0x99, 0x4C, 0x26, 0x71, 0x92, 0x00, 0xCD, 0x8F, 0x8D, 0x6D, 0x70, 0x17,
-	0x6C, 0x3C, 0x9E, 0x93, 0xEE, 0x8A, 0xA6, 0x9F, 0x38, 0x0C, 0x12, 0xC0,
-	0x67, 0x52, 0x2B, 0x59, 0xC3, 0x8C, 0x62, 0x3F, 0x32, 0xEC, 0xE0, 0x94,
-	0x23, 0x48, 0x42, 0x0E, 0x15, 0xE3, 0xF5, 0x4E, 0x4E, 0x4E, 0x10, 0x42,
-	0x62, 0x0F, 0x48, 0x38, 0x64, 0x32, 0xBC, 0x5C, 0x2E, 0x67, 0x32, 0x99,
-	0x83, 0x83, 0x83, 0xC3, 0xC3, 0xC3, 0x37, 0xDE, 0x78, 0xE3, 0xED, 0xB7,
-	0xDF, 0xFE, 0xBB, 0xBF, 0xFB, 0xBB, 0x4E, 0xA7, 0xF3, 0xC1, 0x07, 0x1F,
-	0x50, 0xC7, 0x60, 0x0F, 0x14, 0xE9, 0x33, 0x71, 0x94, 0x2C, 0xA7, 0x39,
-	0x62, 0x52, 0xCA, 0xDE, 0xDE, 0xDE, 0xCF, 0x7E, 0xF6, 0xB3, 0xDD, 0xDD,
-	0x5D, 0xF0, 0x55, 0x79, 0xE8, 0x48, 0x86, 0x20, 0xA0, 0x84, 0xD3, 0x4D,
-	0x0F, 0x0F, 0xAF, 0xD1, 0xEB, 0xF5, 0x30, 0x24, 0x21, 0x1C, 0x0E, 0xE3,
-	0xF5, 0x38, 0xC2, 0x0E, 0xC7, 0xE5, 0xCB, 0x1C, 0x15, 0xB6, 0xB0, 0x04,
-	0x3C, 0xE0, 0x70, 0x38, 0x30, 0xCD, 0x0F, 0xC1, 0x81, 0x1C, 0x06, 0x24,
-	0xFB, 0x4B, 0x32, 0xD3, 0x00, 0xCA, 0x13, 0xB3, 0x69, 0x90, 0x2A, 0xAC,
-	0x3E, 0xE3, 0x5E, 0x1C, 0x02, 0x98, 0x56, 0x69, 0x0C, 0x28, 0x8E, 0x88,
-	0xC0, 0xD9, 0xE9, 0x13, 0xDD, 0xFE, 0xEE, 0xDD, 0xBB, 0x57, 0xAD, 0x56,
-	0x39, 0x93, 0x88, 0x65, 0x52, 0x44, 0x8B, 0xF1, 0x6A, 0x18, 0x2F, 0x9C,
-	0x4A, 0xA5, 0xF2, 0xF9, 0xFC, 0x0F, 0x7F, 0xF8, 0xC3, 0x7F, 0xF8, 0x87,
-	0x7F, 0x68, 0x34, 0x1A, 0xF7, 0xEF, 0xDF, 0x97, 0xDD, 0xC0, 0xC7, 0x32,
-	0x42, 0x1F, 0x1F, 0xFE, 0x22, 0xEA, 0xB0, 0x02, 0x81, 0x40, 0x3C, 0x1E,
-	0x2F, 0x14, 0x0A, 0x3F, 0xFD, 0xE9, 0x4F, 0x1F, 0x3E, 0x7C, 0x58, 0x2C,
-	0x16, 0x99, 0x7F, 0xA0, 0x4B, 0x4B, 0x4F, 0x1F, 0x52, 0x03, 0x97, 0x19,
-	0x3E, 0x03, 0xE0, 0x7E, 0x30, 0x4D, 0xA0, 0x55, 0xBD, 0x5E, 0x2F, 0x9A,
-	0x34, 0x22, 0x6E, 0x22, 0x74, 0x31, 0xD9, 0x32, 0x49, 0x12, 0x78, 0xF1,
-	0x3E, 0x6E, 0xB7, 0xBB, 0xDF, 0xEF, 0x1F, 0x1D, 0x1D, 0xC9, 0xC7, 0x98,
-	0x44, 0xBF, 0x51, 0xE2, 0xC0, 0x6C, 0x38, 0x8E, 0x20, 0x1D, 0x62, 0x90,
-	0xF4, 0x91, 0x8C, 0x93, 0xE9, 0xB6, 0x49, 0xB8, 0x18, 0xB3, 0x8E, 0xF0,
-	0x87, 0x70, 0xFF, 0xB0, 0x37, 0x16, 0x8B, 0x05, 0x55, 0xA4, 0xE9, 0x74,
-	0x3A, 0x99, 0x4C, 0xD2, 0x49, 0x93, 0x15, 0x35, 0x4C, 0x05, 0xC2, 0x37,
-	0x01, 0xD0, 0x3B, 0x1C, 0x0E, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x7B, 0xFF,
-	0xEB, 0x7B, 0x72, 0xAE, 0x57, 0xA7, 0xD3, 0x51, 0x70, 0x1B, 0x82, 0x97,
-	0x4C, 0x4F, 0xFB, 0xFD, 0x7E, 0xB4, 0x6C, 0xBD, 0x7B, 0xF7, 0x2E, 0x1A,
-	0xEB, 0x73, 0x04, 0x2E, 0x07, 0x43, 0xB1, 0xDF, 0x0C, 0x27, 0x53, 0x00,
-	0xAA, 0x84, 0x8B, 0xDD, 0xEF, 0xF7, 0x75, 0x23, 0x1D, 0x18, 0x28, 0x26,
-	0xD5, 0xA4, 0xD3, 0xE9, 0x48, 0x5D, 0x42, 0x1C, 0x4F, 0xBF, 0x05, 0xA2,
-	0xAA, 0xA9, 0xA1, 0x90, 0xEE, 0x0A, 0xB2, 0x2E, 0xC9, 0xE4, 0x38, 0x45,
-	0xA5, 0x69, 0x10, 0x40, 0xD6, 0x05, 0x92, 0x01, 0xEC, 0xB8, 0x48, 0x6E,
-	0x19, 0x7A, 0x07, 0x59, 0xAD, 0xD6, 0x7E, 0xBF, 0x0F, 0x80, 0x1D, 0x1A,
-	0x9C, 0x02, 0x34, 0x39, 0x5F, 0x9D, 0xD3, 0x40, 0x4C, 0x26, 0x53, 0xB7,
-	0xDB, 0x45, 0x63, 0xEE, 0xCF, 0x3E, 0xFB, 0x2C, 0x1E, 0x8F, 0x5F, 0xBA,
-	0x78, 0x69, 0x7E, 0x7E, 0x7E, 0x63, 0x63, 0x63, 0x6B, 0x6B, 0x4B, 0x12,
-	0x40, 0x65, 0xC2, 0x8A, 0x3C, 0x36, 0x9C, 0x2D, 0xBD, 0x5E, 0xFF, 0xC9,
-	0x27, 0x9F, 0xFC, 0xC7, 0x7F, 0xFC, 0xC7, 0x0F, 0x7E, 0xF0, 0x83, 0x6F,
-	0x7D, 0xEB, 0x5B, 0x85, 0x7C, 0x81, 0xB3, 0x46, 0x15, 0x98, 0x75, 0x3A,
-	0xFB, 0xA8, 0xA2, 0x0E, 0x06, 0x83, 0xD3, 0xD3, 0xD3, 0x6B, 0xEB, 0x6B,
-	0xD5, 0x6A, 0xF5, 0xC1, 0x83, 0x07, 0x18, 0x2A, 0x0A, 0x8B, 0x4F, 0x88,
-	0x9C, 0x9A, 0x77, 0xEC, 0x30, 0xA8, 0x0A, 0x12, 0x1A, 0xD1, 0x68, 0x14,
-	0xDB, 0x0B, 0xC3, 0xE0, 0x72, 0xB9, 0xDC, 0x6E, 0xB7, 0xDD, 0x61, 0x97,
-	0x33, 0xB3, 0x39, 0x46, 0x86, 0x3E, 0xA8, 0x66, 0x38, 0x20, 0x77, 0x68,
-	0x0C, 0x82, 0x3A, 0x5D, 0xC5, 0x62, 0x91, 0x24, 0x59, 0x8E, 0x18, 0xE3,
-	0xF6, 0x03, 0xF8, 0x03, 0x68, 0xC1, 0x6A, 0x69, 0xD2, 0x4F, 0x91, 0x68,
-	0xCB, 0xE7, 0xF3, 0x89, 0x44, 0x02, 0x75, 0xC8, 0x72, 0x1A, 0x03, 0x01,
-	0x03, 0x4D, 0x4F, 0x1D, 0x3C, 0x46, 0xA3, 0xD1, 0x38, 0x38, 0x38, 0x80,
-	0x6D, 0x87, 0x53, 0x97, 0xCB, 0xE5, 0xDE, 0x79, 0xE7, 0x9D, 0xF3, 0xE7,
-	0xCF, 0x7F, 0xF4, 0xD1, 0x47, 0xBB, 0xBB, 0xBB, 0x2C, 0x1C, 0xD3, 0x50,
-	0xB8, 0x24, 0xB7, 0x0C, 0x5C, 0xC2, 0xFF, 0xF9, 0x9F, 0xFF, 0x59, 0x58,
-	0x58, 0xB8, 0x76, 0xED, 0xDA, 0xE3, 0xC7, 0x8F, 0xEB, 0x8D, 0xFA, 0x18,
-	0x66, 0xC7, 0xF9, 0x22, 0xDA, 0x0E, 0xCD, 0x13, 0x8D, 0x46, 0xD7, 0xD6,
-	0xD6, 0x62, 0xD1, 0xD8, 0xAF, 0x7F, 0xFD, 0xEB, 0xD3, 0xD3, 0x53, 0x98,
-	0x5C, 0x8E, 0x51, 0xA6, 0xC9, 0x62, 0x86, 0xD6, 0x68, 0x34, 0xAA, 0xCA,
-	0x18, 0x9D, 0x0F, 0x87, 0xC3, 0x04, 0xA4, 0xF4, 0x7A, 0xBD, 0xC5, 0x3C,
-	0x6E, 0x8C, 0x42, 0xA6, 0x18, 0x43, 0x79, 0x39, 0xDA, 0x4F, 0xD3, 0x46,
-	0x8B, 0x79, 0x47, 0xA8, 0xB5, 0x56, 0xBB, 0x45, 0x86, 0x3E, 0x8E, 0x33,
-	0xA9, 0xAB, 0x52, 0xF4, 0xA0, 0x48, 0xB9, 0xF4, 0x50, 0xA1, 0x7E, 0xBF,
-	0xBF, 0xD1, 0x68, 0x20, 0x73, 0x22, 0xF9, 0xDB, 0xB2, 0xBE, 0x0C, 0xFD,
-	0x66, 0xD1, 0x52, 0x83, 0xC8, 0x01, 0x22, 0x00, 0xE4, 0xD4, 0x78, 0xAA,
-	0x30, 0xCA, 0xD7, 0xEF, 0xF7, 0x7F, 0xF5, 0xAB, 0x5F, 0x2F, 0x26, 0x53,
-	0x42, 0x00, 0x00, 0x0B, 0x0E, 0x49, 0x44, 0x41, 0x54, 0x5D, 0x5B, 0x5B,
-	0x7B, 0xF8, 0xF0, 0xA1, 0x9C, 0x96, 0xF8, 0xDA, 0x16, 0x25, 0x50, 0x44,
-	0x26, 0x93, 0x29, 0x9B, 0xCD, 0xFE, 0xF2, 0x97, 0xBF, 0xBC, 0x7C, 0xF9,
-	0xF2, 0x85, 0x0B, 0x17, 0x4E, 0x4E, 0x4E, 0xC6, 0x29, 0x07, 0x97, 0xCB,
-	0x85, 0x98, 0xCB, 0x6A, 0xB5, 0x3A, 0x1D, 0x4E, 0x9F, 0xDF, 0x17, 0x8D,
-	0x46, 0x97, 0x96, 0x96, 0x36, 0x36, 0x36, 0x12, 0x89, 0xC4, 0xD6, 0xD6,
-	0x16, 0x53, 0xCF, 0x92, 0xF6, 0xAC, 0x61, 0x61, 0xB0, 0x29, 0x78, 0x24,
-	0x12, 0xF1, 0xF9, 0x7C, 0x95, 0x4A, 0xE5, 0xD5, 0x50, 0x62, 0xDD, 0x08,
-	0xE1, 0x02, 0x5A, 0x89, 0xC3, 0xFB, 0xA6, 0xAB, 0x4E, 0x38, 0x4F, 0x9E,
-	0x00, 0x32, 0x3B, 0x20, 0xFE, 0x08, 0x8C, 0xE1, 0x6B, 0x71, 0xAE, 0x14,
-	0xC4, 0x8A, 0xFC, 0x40, 0x39, 0x00, 0x07, 0x0E, 0xAE, 0xC5, 0x62, 0x99,
-	0x9E, 0x9E, 0x0E, 0x87, 0xC3, 0x85, 0x42, 0x21, 0x91, 0x48, 0x00, 0x6A,
-	0x24, 0x8D, 0x95, 0xE0, 0x28, 0x81, 0x23, 0xC6, 0xAB, 0x4C, 0x10, 0x21,
-	0xA5, 0xC3, 0x17, 0xC7, 0x53, 0xC1, 0x7A, 0x7F, 0xFC, 0xF1, 0xC7, 0x17,
-	0x2E, 0x5C, 0x78, 0xE3, 0x8D, 0x37, 0x7E, 0xF5, 0xAB, 0x5F, 0x25, 0x12,
-	0x09, 0xD9, 0x4F, 0xFC, 0xB5, 0x5D, 0x92, 0xA0, 0x97, 0x1A, 0x8D, 0xC6,
-	0xF6, 0xF6, 0x76, 0xA9, 0x54, 0x5A, 0x59, 0x59, 0x59, 0x5C, 0x5C, 0xAC,
-	0xD5, 0x6A, 0xC3, 0xE1, 0x50, 0x71, 0x3A, 0x9D, 0x70, 0x03, 0x30, 0xD4,
-	0x26, 0x18, 0x0C, 0xC6, 0xE3, 0xF1, 0x8D, 0x8D, 0x8D, 0x5E, 0xAF, 0x77,
-	0xF7, 0xEE, 0x5D, 0x34, 0xBB, 0xA0, 0x79, 0x21, 0x99, 0x52, 0xCE, 0x2C,
-	0x81, 0x05, 0xB6, 0xDB, 0xED, 0xA1, 0x50, 0x68, 0x6A, 0x6A, 0x0A, 0x2C,
-	0x1D, 0x08, 0x0E, 0x0C, 0x03, 0x66, 0x11, 0x43, 0xEE, 0x64, 0xFD, 0x85,
-	0xE4, 0x1A, 0xD1, 0x9C, 0x50, 0xB7, 0x60, 0x3F, 0xE0, 0x68, 0xC3, 0xB9,
-	0x94, 0xC1, 0x1A, 0x67, 0x23, 0xC8, 0x0D, 0x90, 0x93, 0x5B, 0xA1, 0xF4,
-	0x4F, 0x4E, 0x4E, 0xF2, 0xF9, 0x3C, 0x27, 0xC2, 0x4B, 0xAC, 0x4D, 0xCE,
-	0xC3, 0xA6, 0xB8, 0x10, 0x08, 0x92, 0xC3, 0x13, 0x09, 0xEC, 0xC0, 0x5F,
-	0xD0, 0xE9, 0x74, 0x2F, 0x5F, 0xBE, 0x7C, 0xF0, 0xE0, 0x01, 0x5A, 0x33,
-	0xBC, 0x7C, 0xF1, 0x12, 0x35, 0x1A, 0xB2, 0xF6, 0x51, 0xD3, 0x68, 0x99,
-	0x74, 0xAE, 0x74, 0x3A, 0x5D, 0xAE, 0x94, 0x4B, 0xA5, 0xD2, 0xCC, 0xCC,
-	0x4C, 0x38, 0x1C, 0xEE, 0xF5, 0x7A, 0x0A, 0x4A, 0xB1, 0xCD, 0x66, 0xB3,
-	0xD3, 0xE1, 0xF4, 0x07, 0xFC, 0xB1, 0x58, 0x6C, 0x79, 0x79, 0xD9, 0x62,
-	0xB1, 0x7C, 0xF8, 0xE1, 0x87, 0x07, 0x07, 0x07, 0x10, 0x7F, 0xD9, 0x36,
-	0x46, 0x33, 0xD2, 0x82, 0x79, 0x5A, 0xBF, 0xDF, 0x1F, 0x89, 0x44, 0xF2,
-	0xF9, 0xFC, 0xC1, 0xC1, 0x01, 0xFA, 0x28, 0xB0, 0xF1, 0x5E, 0x3E, 0x9F,
-	0xCF, 0x66, 0xB3, 0xC0, 0x91, 0x40, 0xF6, 0xC3, 0x90, 0xEC, 0xB1, 0x23,
-	0xFC, 0x85, 0xEF, 0xCB, 0x81, 0x1D, 0xC0, 0x8B, 0x88, 0x76, 0xC8, 0x21,
-	0x7E, 0xB2, 0xD6, 0x57, 0x33, 0x69, 0x41, 0xD3, 0x98, 0xC8, 0x6C, 0x36,
-	0x43, 0x14, 0x00, 0x19, 0xC9, 0x0A, 0x99, 0x49, 0xEA, 0xB1, 0x66, 0x2A,
-	0x2D, 0x0A, 0xF0, 0x79, 0x50, 0x24, 0xF3, 0x07, 0x3B, 0x91, 0x4A, 0xA5,
-	0xEE, 0xDD, 0xBB, 0x77, 0xED, 0xDA, 0xB5, 0x6B, 0xD7, 0xAE, 0xDD, 0xBF,
-	0x7F, 0xBF, 0x52, 0xAD, 0xC0, 0xB1, 0xD6, 0xA0, 0x20, 0x72, 0x28, 0x14,
-	0xDB, 0xBD, 0x9A, 0xCD, 0xE6, 0x5A, 0xB5, 0x86, 0x06, 0x1B, 0x3E, 0x9F,
-	0x4F, 0x01, 0xAE, 0x69, 0x31, 0x5B, 0x9C, 0x2E, 0x27, 0xE6, 0xDC, 0x9B,
-	0x54, 0xD3, 0xA3, 0x47, 0x8F, 0x76, 0x76, 0x76, 0xC0, 0xFA, 0xA7, 0x86,
-	0xD5, 0x8C, 0x44, 0x62, 0x8D, 0x11, 0x9C, 0x6B, 0x30, 0x96, 0xD0, 0x70,
-	0x83, 0x21, 0x12, 0x74, 0xB4, 0xCD, 0x66, 0x43, 0x57, 0x4A, 0x5C, 0xD0,
-	0xE3, 0xF1, 0x40, 0xAB, 0x20, 0x58, 0x83, 0x85, 0x00, 0x8B, 0x1F, 0x1D,
-	0xFB, 0x28, 0x80, 0x9A, 0xDE, 0xAD, 0xF2, 0x5C, 0x03, 0xBE, 0x67, 0xCB,
-	0x40, 0x0D, 0x81, 0x19, 0x8B, 0x48, 0xD1, 0x81, 0xD8, 0xBE, 0x16, 0x19,
-	0x9D, 0xE4, 0xFD, 0xC9, 0x81, 0x7E, 0x9A, 0x0E, 0x08, 0xD4, 0xBA, 0xC5,
-	0x62, 0xF1, 0xC5, 0x8B, 0x17, 0x4F, 0x9F, 0x3E, 0xBD, 0x72, 0xE5, 0xCA,
-	0xF9, 0xF3, 0xE7, 0xC1, 0x8D, 0x20, 0xFC, 0xAE, 0x69, 0x5B, 0x00, 0x1F,
-	0x81, 0x63, 0xED, 0xE8, 0xB3, 0xB6, 0x5A, 0xAD, 0x60, 0x30, 0xA8, 0x34,
-	0x1A, 0x0D, 0xB7, 0xDB, 0x6D, 0xB1, 0x5A, 0x40, 0x88, 0x1B, 0x0C, 0x06,
-	0x5B, 0x2F, 0xB6, 0x30, 0xCC, 0x0C, 0xD3, 0x6D, 0x34, 0x8C, 0x2B, 0xC9,
-	0x7B, 0x60, 0x32, 0x59, 0x51, 0x14, 0x34, 0xE3, 0x94, 0x90, 0x1C, 0x3C,
-	0x2B, 0x08, 0x7E, 0x22, 0x91, 0x00, 0x26, 0x05, 0x6F, 0x0A, 0x5D, 0xE2,
-	0xD1, 0x29, 0x11, 0x54, 0xA7, 0x40, 0x20, 0xF0, 0x9B, 0xDF, 0xFC, 0x26,
-	0x91, 0x48, 0x68, 0xFA, 0xFF, 0x69, 0x68, 0x93, 0x4C, 0xF7, 0x03, 0x68,
-	0x62, 0x71, 0xA7, 0x46, 0xE1, 0x42, 0xBD, 0xD8, 0xED, 0x76, 0xD8, 0x55,
-	0xD9, 0x69, 0x85, 0x64, 0x0B, 0xCD, 0x1C, 0x75, 0x39, 0x44, 0x4B, 0x0E,
-	0xE9, 0xD2, 0xFC, 0x8B, 0x67, 0x6B, 0x34, 0x1A, 0xA9, 0x54, 0xEA, 0xFD,
-	0xF7, 0xDF, 0x5F, 0x5F, 0x5F, 0xBF, 0x72, 0xE5, 0xCA, 0xD1, 0xD1, 0x11,
-	0x1C, 0x19, 0x39, 0x8D, 0x90, 0x05, 0xAD, 0xB2, 0x38, 0x17, 0x2A, 0x81,
-	0x64, 0xCE, 0x5E, 0xAF, 0x67, 0x84, 0x8B, 0x06, 0xA5, 0x0C, 0xA3, 0x5F,
-	0x28, 0x14, 0x2A, 0xE5, 0x4A, 0xBD, 0x56, 0x47, 0xCD, 0xB4, 0xEC, 0xC8,
-	0x22, 0x87, 0x00, 0x12, 0xAE, 0x40, 0xF3, 0x67, 0xB4, 0x05, 0x03, 0x1D,
-	0x4A, 0xF6, 0x65, 0x1B, 0x0E, 0x87, 0x68, 0x20, 0xEF, 0xF7, 0xFB, 0x47,
-	0xA3, 0x11, 0x3C, 0x5A, 0xA8, 0x85, 0x41, 0x7F, 0xA0, 0xAA, 0xAA, 0xDF,
-	0xEF, 0xFF, 0xFA, 0xD7, 0xBF, 0xBE, 0xBE, 0xBE, 0x9E, 0xC9, 0x64, 0xF6,
-	0xF7, 0xF7, 0x27, 0x6D, 0xBE, 0xD4, 0x3C, 0x64, 0x73, 0xA2, 0x56, 0x90,
-	0xCE, 0xAE, 0x64, 0xC5, 0xB2, 0xE7, 0xE1, 0xF2, 0xF2, 0x72, 0x20, 0x10,
-	0x80, 0x1F, 0x30, 0x18, 0x0E, 0xE4, 0xFC, 0x12, 0xCD, 0x40, 0x23, 0x0E,
-	0xEA, 0x44, 0x98, 0xC2, 0x66, 0x1D, 0xB2, 0x87, 0xAD, 0x46, 0x4D, 0x21,
-	0xC4, 0x23, 0x44, 0x2F, 0x0D, 0xB5, 0x9C, 0xE5, 0x35, 0xD9, 0x1A, 0x59,
-	0x72, 0xAB, 0x74, 0x3A, 0x9D, 0x91, 0x35, 0x69, 0x0C, 0xD9, 0x07, 0x83,
-	0x41, 0x7F, 0xD0, 0xEF, 0xF6, 0xBA, 0x52, 0x0C, 0x35, 0xE9, 0x46, 0x76,
-	0x95, 0x45, 0x97, 0x1E, 0xD9, 0xB8, 0x8C, 0xBC, 0xDA, 0x57, 0xC5, 0x98,
-	0x86, 0x57, 0x1C, 0x45, 0x74, 0x45, 0x81, 0x85, 0xE8, 0x76, 0xBB, 0x9D,
-	0x76, 0x07, 0x6D, 0xBB, 0xB7, 0xB6, 0xB6, 0x4E, 0x4F, 0x4F, 0x9B, 0xCD,
-	0x26, 0x9A, 0x4C, 0xC8, 0x61, 0x6C, 0xF4, 0x8B, 0x58, 0x61, 0xC0, 0xA6,
-	0x48, 0x6C, 0x79, 0x25, 0xC5, 0x99, 0xB4, 0x01, 0xBF, 0xDF, 0x7F, 0xE3,
-	0xC6, 0x8D, 0xF5, 0xF5, 0x75, 0x1C, 0x44, 0x99, 0x8D, 0x92, 0xF3, 0x74,
-	0x39, 0x15, 0x00, 0x61, 0x10, 0x78, 0x2E, 0xB2, 0x40, 0x68, 0x72, 0x74,
-	0xA5, 0x1C, 0xA5, 0x61, 0x30, 0x18, 0xE0, 0xE3, 0xC2, 0x5B, 0xD1, 0x4C,
-	0x00, 0x79, 0x6D, 0x9D, 0x9D, 0x1C, 0x43, 0x6A, 0x44, 0xB1, 0x2B, 0xDE,
-	0xCA, 0xE5, 0x72, 0x81, 0x4A, 0xA5, 0xE9, 0xC5, 0x2A, 0xA7, 0xA9, 0x12,
-	0x2B, 0x26, 0xA9, 0x9F, 0xB3, 0xAE, 0x25, 0x4D, 0x5A, 0xA2, 0x14, 0xD0,
-	0x54, 0x7A, 0xBD, 0x1E, 0xED, 0x3E, 0xF0, 0xAC, 0xD8, 0x27, 0x83, 0xDE,
-	0x60, 0xB3, 0xDA, 0xD2, 0xE9, 0xF4, 0xFD, 0xFB, 0xF7, 0xF7, 0xF7, 0xF7,
-	0xE1, 0xA8, 0x70, 0x8E, 0xA3, 0xC6, 0xEB, 0x95, 0x65, 0x7E, 0x38, 0x01,
-	0x6E, 0x97, 0x1B, 0x82, 0xA2, 0xA1, 0x90, 0x62, 0x4D, 0x91, 0xA3, 0xBF,
-	0x7D, 0xFB, 0xF6, 0xB5, 0x6B, 0xD7, 0x66, 0x66, 0x66, 0x90, 0x07, 0x26,
-	0x97, 0x52, 0xCA, 0x3E, 0x2E, 0x08, 0x08, 0x00, 0xF3, 0x9C, 0x90, 0x71,
-	0xD4, 0x78, 0x93, 0xB4, 0x7C, 0x64, 0x48, 0xC0, 0x8F, 0x28, 0x97, 0xCB,
-	0xF9, 0x7C, 0x9E, 0xAD, 0xA6, 0x24, 0x5B, 0x40, 0xB3, 0xD3, 0x54, 0xA4,
-	0xD4, 0x22, 0xC6, 0x50, 0x28, 0xC4, 0xFF, 0x6D, 0x36, 0x9B, 0x03, 0x81,
-	0xC0, 0xF2, 0xF2, 0x72, 0x34, 0x16, 0x45, 0x4F, 0x49, 0x16, 0x6C, 0xCA,
-	0xEA, 0x40, 0x96, 0x9F, 0xC9, 0x4A, 0x2E, 0x39, 0x32, 0x4C, 0x92, 0x59,
-	0x24, 0xC6, 0x87, 0x33, 0x8B, 0xFA, 0x7A, 0x20, 0x91, 0x08, 0x08, 0xF6,
-	0x0F, 0xF6, 0xD1, 0x70, 0xBF, 0x54, 0x2A, 0xC1, 0xB9, 0x94, 0xAE, 0x97,
-	0x4C, 0x63, 0x51, 0x95, 0x23, 0x9E, 0x70, 0xBA, 0x9C, 0xF0, 0xCD, 0x99,
-	0xD7, 0xD3, 0x94, 0xA2, 0xD7, 0xEB, 0xF5, 0x4C, 0x26, 0x63, 0x32, 0x99,
-	0xCE, 0x9C, 0x39, 0x73, 0xF5, 0xEA, 0xD5, 0x70, 0x38, 0x8C, 0x40, 0x9A,
-	0xAE, 0x04, 0x01, 0x44, 0xB0, 0x02, 0x41, 0xAA, 0xC5, 0x7C, 0x23, 0xD8,
-	0x36, 0x96, 0xBB, 0x70, 0xC3, 0xF8, 0xB7, 0x32, 0x11, 0x5F, 0x2A, 0x95,
-	0x64, 0x90, 0xA1, 0xC1, 0xB2, 0x98, 0xD8, 0xE1, 0x01, 0x62, 0xA9, 0xA8,
-	0xD1, 0xE5, 0x72, 0x11, 0x08, 0x04, 0x98, 0x13, 0x8F, 0xC7, 0x6F, 0xDD,
-	0xBA, 0xB5, 0xB6, 0xBA, 0x06, 0x7A, 0x44, 0xB9, 0x54, 0x86, 0x9B, 0x05,
-	0x79, 0x27, 0xB7, 0x47, 0x26, 0xB0, 0xA4, 0xB2, 0x96, 0x8A, 0x95, 0xF8,
-	0x12, 0x4E, 0x34, 0xD2, 0x67, 0xF2, 0x68, 0x37, 0x9B, 0x4D, 0x2C, 0x3D,
-	0x07, 0xAA, 0xC1, 0xB3, 0xFC, 0xB2, 0xB8, 0x8F, 0x1B, 0x00, 0x2F, 0x08,
-	0xFC, 0x72, 0x66, 0x48, 0xA4, 0xDF, 0xCD, 0x6A, 0xCE, 0x83, 0x83, 0x83,
-	0x47, 0x8F, 0x1E, 0x6D, 0x6F, 0x6F, 0x1B, 0x8D, 0xC6, 0x37, 0xDF, 0x7C,
-	0xF3, 0xD2, 0xA5, 0x4B, 0xE8, 0x0C, 0xC1, 0x11, 0x66, 0x80, 0xBF, 0xB0,
-	0xFA, 0xA8, 0xBD, 0xBD, 0x71, 0xE3, 0x06, 0x86, 0x7A, 0x38, 0x9D, 0x4E,
-	0x93, 0x6A, 0x32, 0x2A, 0x46, 0xB2, 0xE1, 0x5F, 0xD5, 0x16, 0x7E, 0x81,
-	0x02, 0x31, 0x31, 0x40, 0x84, 0x55, 0xCE, 0x18, 0x94, 0x85, 0x2D, 0x54,
-	0x8F, 0x80, 0xB6, 0xC6, 0x07, 0xC2, 0x6E, 0xB7, 0xCB, 0x41, 0x9A, 0xE8,
-	0x3D, 0xB8, 0xB2, 0xB2, 0x12, 0x0C, 0x06, 0x6B, 0xB5, 0xDA, 0xE3, 0xC7,
-	0x8F, 0xD3, 0xA9, 0x34, 0xE1, 0x5F, 0xC9, 0xEA, 0xD1, 0xD4, 0xCE, 0x69,
-	0xA6, 0x83, 0x11, 0x5B, 0xA5, 0x7C, 0x99, 0x54, 0xD3, 0x60, 0x38, 0x68,
-	0xB7, 0xDB, 0xE5, 0x52, 0xB9, 0x56, 0xAF, 0xC1, 0x14, 0xB3, 0xF9, 0x2C,
-	0x0F, 0x16, 0x9B, 0xDE, 0x4F, 0xA6, 0x15, 0xA5, 0x24, 0x4A, 0x01, 0xA4,
-	0x41, 0x92, 0xE5, 0xD7, 0x20, 0x9A, 0xF3, 0x2E, 0xC9, 0x64, 0x72, 0x7B,
-	0x7B, 0xFB, 0x34, 0x79, 0x6A, 0xB6, 0x9A, 0x37, 0x37, 0x36, 0xE7, 0xE6,
-	0xE6, 0xF0, 0x7D, 0x84, 0x90, 0x4E, 0xA7, 0x33, 0x18, 0x08, 0xC6, 0x67,
-	0xE3, 0x97, 0x2E, 0x5D, 0xFA, 0xFA, 0xD7, 0xBF, 0x7E, 0xFE, 0xFC, 0xF9,
-	0x70, 0x38, 0xBC, 0xB8, 0xB8, 0x18, 0x0A, 0x85, 0x50, 0xBB, 0xC1, 0x2E,
-	0xBA, 0xAC, 0x01, 0x65, 0x9D, 0x1E, 0xC1, 0x4E, 0x4D, 0x64, 0x47, 0x8B,
-	0xC5, 0x76, 0x80, 0x2C, 0x68, 0x90, 0xF6, 0x59, 0x21, 0x98, 0x87, 0x8B,
-	0x02, 0xAD, 0xFD, 0xF1, 0x8F, 0x7F, 0x1C, 0x0C, 0x06, 0xC7, 0x34, 0x8D,
-	0x7E, 0x4F, 0x4E, 0x52, 0x96, 0xE1, 0xA2, 0x9C, 0x43, 0x2E, 0x53, 0xAC,
-	0x10, 0x2B, 0xE9, 0xA2, 0xC0, 0x6C, 0x22, 0xBE, 0x47, 0xB4, 0xC5, 0x56,
-	0xA3, 0x2C, 0x3B, 0xA0, 0xAA, 0x65, 0xA3, 0x4C, 0x0D, 0xE7, 0x97, 0xAD,
-	0xD6, 0xD1, 0x0F, 0x84, 0xD7, 0x1F, 0x8F, 0x6D, 0xEB, 0x76, 0x61, 0x9C,
-	0xA4, 0xF5, 0x06, 0xD4, 0x0A, 0x92, 0x64, 0xBD, 0x5E, 0x2F, 0x16, 0x8B,
-	0x87, 0x47, 0x87, 0x9B, 0x9B, 0x9B, 0x97, 0x2E, 0x5D, 0xFA, 0xFE, 0xF7,
-	0xBF, 0x8F, 0xF9, 0xB5, 0xA8, 0x71, 0x0C, 0x85, 0x42, 0x67, 0xCF, 0x9E,
-	0x5D, 0x5B, 0x5B, 0x33, 0x18, 0x0C, 0x3B, 0x3B, 0x3B, 0xD0, 0xEC, 0x89,
-	0x44, 0x02, 0x93, 0x6D, 0x6C, 0x36, 0x5B, 0x3C, 0x1E, 0x8F, 0x44, 0x22,
-	0x99, 0x4C, 0x26, 0x93, 0xC9, 0xC0, 0x99, 0x66, 0x45, 0x2D, 0x92, 0x1F,
-	0x8C, 0x3F, 0xC8, 0xB0, 0x97, 0x38, 0x84, 0xB4, 0xC9, 0x04, 0x4E, 0x86,
-	0xC3, 0xA1, 0x22, 0xE7, 0x0B, 0xDB, 0x6C, 0xB6, 0x4E, 0xA7, 0xF3, 0xF0,
-	0xE1, 0x43, 0x80, 0x47, 0xE1, 0x70, 0xB8, 0xDD, 0x6E, 0xF7, 0xBA, 0xBF,
-	0xC7, 0x27, 0x94, 0xCB, 0x44, 0xB5, 0x40, 0x7D, 0x4A, 0xEE, 0x18, 0x79,
-	0x48, 0x24, 0x48, 0xF5, 0xFB, 0x7D, 0xA4, 0x0A, 0xB0, 0xF4, 0x78, 0x01,
-	0xAE, 0xBE, 0xEC, 0x0A, 0x83, 0xF0, 0x6A, 0x32, 0xBE, 0x95, 0x13, 0x7A,
-	0x65, 0x80, 0x06, 0x31, 0xA4, 0x0A, 0x96, 0xD5, 0x6A, 0x3C, 0x4C, 0x0C,
-	0xA9, 0xC0, 0x86, 0x6B, 0xB7, 0xDB, 0xB7, 0x6F, 0xDF, 0xFE, 0xCE, 0x77,
-	0xBE, 0xF3, 0xCD, 0x6F, 0x7E, 0x13, 0xA9, 0x15, 0xB4, 0x98, 0x7E, 0xF9,
-	0xF2, 0xE5, 0x8B, 0x17, 0x2F, 0x50, 0x96, 0x84, 0xEE, 0x78, 0x1C, 0x66,
-	0x85, 0x81, 0x73, 0xB1, 0x58, 0x6C, 0x77, 0x77, 0xF7, 0xE0, 0xE0, 0x80,
-	0xA9, 0x37, 0xA6, 0x8C, 0xE4, 0x30, 0x72, 0xC9, 0x4D, 0x92, 0x6C, 0x17,
-	0x8A, 0xD7, 0xAB, 0x7E, 0x41, 0xD4, 0xAA, 0xB0, 0x39, 0x89, 0x44, 0x02,
-	0x03, 0x75, 0x4D, 0xAA, 0xA9, 0x5C, 0x2E, 0xAB, 0xAA, 0x8A, 0x13, 0x30,
-	0xB9, 0xFA, 0x92, 0x65, 0xC7, 0xB0, 0x00, 0x48, 0x24, 0xF5, 0x09, 0xC4,
-	0x93, 0xBC, 0x41, 0xB4, 0x72, 0x83, 0xC6, 0xA4, 0xB7, 0x20, 0x9B, 0x7D,
-	0x93, 0x42, 0xCA, 0x9E, 0xD7, 0x9A, 0x91, 0x64, 0x2C, 0xCA, 0x94, 0xD3,
-	0xEA, 0x39, 0x43, 0x58, 0xD3, 0xEE, 0x4C, 0x4E, 0x37, 0x93, 0x4A, 0x92,
-	0x2C, 0xF3, 0x54, 0x2A, 0x75, 0xF6, 0xEC, 0x59, 0x97, 0xCB, 0xA5, 0x28,
-	0x4A, 0xA5, 0x52, 0x49, 0x26, 0x93, 0xA0, 0xBD, 0x00, 0x01, 0x93, 0xF2,
-	0xC1, 0x41, 0x50, 0x2B, 0x2B, 0x2B, 0x91, 0x48, 0x04, 0x89, 0x30, 0x6C,
-	0xE4, 0x64, 0x3F, 0xF1, 0x49, 0xCA, 0xBE, 0xAC, 0x87, 0x90, 0xF0, 0xD7,
-	0x78, 0xF1, 0xE1, 0x53, 0xA3, 0x36, 0x21, 0x97, 0xCB, 0xE1, 0x14, 0x1B,
-	0x0C, 0x86, 0x56, 0xBB, 0x05, 0x3A, 0x9B, 0xCC, 0x3B, 0xCA, 0x1D, 0xA6,
-	0x55, 0x41, 0x5C, 0x0A, 0xEA, 0x00, 0xBB, 0x52, 0x90, 0x72, 0x23, 0x19,
-	0x4B, 0xD0, 0xEC, 0xD8, 0x15, 0x39, 0x61, 0x58, 0x4E, 0xF9, 0x41, 0x1E,
-	0x43, 0x26, 0xD3, 0x25, 0xDE, 0x2B, 0xBB, 0xB6, 0x4B, 0xCC, 0x60, 0xB2,
-	0x46, 0x53, 0xD3, 0x26, 0x9B, 0x93, 0x22, 0x20, 0xAD, 0xB0, 0xCF, 0xD1,
-	0x68, 0x14, 0xB2, 0xCF, 0x01, 0x85, 0xA8, 0x6A, 0xA2, 0x77, 0xC7, 0xD2,
-	0x17, 0xBD, 0x5E, 0xEF, 0x70, 0x38, 0xE6, 0xE7, 0xE7, 0x23, 0x91, 0x08,
-	0x4C, 0x17, 0x10, 0x72, 0x8D, 0x92, 0xD1, 0xCC, 0xD7, 0xD4, 0x6C, 0x86,
-	0xDC, 0x86, 0xF1, 0x06, 0x00, 0x04, 0x8D, 0xC7, 0xE3, 0x8A, 0xA2, 0x20,
-	0x5B, 0xA6, 0x19, 0xD7, 0x01, 0x2B, 0xCF, 0xE5, 0xD6, 0xE4, 0x03, 0xC8,
-	0xD5, 0x45, 0x71, 0x08, 0x34, 0x8C, 0x66, 0xEC, 0xB0, 0x26, 0x02, 0x42,
-	0x9F, 0x55, 0x0D, 0xB1, 0x57, 0x12, 0x46, 0xF1, 0x4D, 0xF6, 0x35, 0xD0,
-	0x74, 0xAA, 0xD0, 0x50, 0x1F, 0x71, 0x0B, 0x92, 0x5C, 0xC8, 0x58, 0xE5,
-	0x73, 0xD2, 0x6E, 0xE3, 0xA6, 0xCC, 0xE3, 0x63, 0x96, 0x76, 0x2A, 0x95,
-	0xE2, 0x7C, 0x26, 0x09, 0x6E, 0xCB, 0x3F, 0xE7, 0xCC, 0x5D, 0x7C, 0xD3,
-	0x61, 0x77, 0xE0, 0x07, 0x52, 0x74, 0x35, 0x53, 0xCC, 0x26, 0x8B, 0x85,
-	0x5E, 0xDB, 0x74, 0x19, 0xF8, 0xA3, 0x12, 0x89, 0x44, 0xD6, 0xD7, 0xD7,
-	0x7D, 0x3E, 0xDF, 0xE1, 0xE1, 0xA1, 0xB4, 0x1B, 0xD8, 0x03, 0xF6, 0xB7,
-	0x61, 0x04, 0xC1, 0x9F, 0x39, 0xA3, 0x11, 0xC4, 0x4D, 0x8C, 0x60, 0x3E,
-	0x3E, 0x3E, 0x46, 0xCA, 0x97, 0xBD, 0x52, 0x35, 0xDA, 0x60, 0xB2, 0xAC,
-	0x63, 0x12, 0xBF, 0xC5, 0xCB, 0xC0, 0xA2, 0x4C, 0x4E, 0x81, 0x80, 0xBA,
-	0xD3, 0x44, 0xA7, 0xB8, 0x2C, 0xF1, 0x57, 0x0D, 0x59, 0x58, 0xEE, 0x19,
-	0x16, 0x0B, 0x49, 0x31, 0xA8, 0x91, 0xC9, 0x86, 0x3D, 0x34, 0xA1, 0xD4,
-	0x12, 0x30, 0xFB, 0xC9, 0x64, 0xF2, 0xC9, 0x93, 0x27, 0xD9, 0x6C, 0xF6,
-	0xF1, 0xE3, 0xC7, 0xD9, 0x6C, 0x16, 0x6D, 0xC3, 0x88, 0x3D, 0xE8, 0xFE,
-	0xDF, 0x3E, 0x0C, 0xFD, 0xE0, 0x5F, 0x29, 0x6F, 0xBF, 0xFD, 0xF6, 0xD2,
-	0xD2, 0xD2, 0xD6, 0xD6, 0x16, 0xDB, 0x04, 0x60, 0xC3, 0xC9, 0x30, 0x20,
-	0x1A, 0x4E, 0xB8, 0x82, 0xD8, 0x11, 0x72, 0xF7, 0x3E, 0x9F, 0x2F, 0x1E,
-	0x8F, 0x5F, 0xBA, 0x74, 0x09, 0x74, 0x41, 0xCE, 0x2D, 0x63, 0x7F, 0x17,
-	0x8D, 0x3F, 0xC0, 0xE9, 0x58, 0x9A, 0x86, 0x63, 0x72, 0xFC, 0x14, 0x7E,
-	0x60, 0x1E, 0x4D, 0xEE, 0x01, 0x83, 0x20, 0xCD, 0x86, 0x49, 0x82, 0x82,
-	0x44, 0x2F, 0x64, 0xC3, 0x05, 0x1E, 0x23, 0xDC, 0x97, 0x88, 0x18, 0xE3,
-	0x52, 0xD9, 0x87, 0x6E, 0x8C, 0xF5, 0x9A, 0xC6, 0xD3, 0xAB, 0xC0, 0x34,
-	0x48, 0x26, 0x93, 0x7B, 0x7B, 0x7B, 0x07, 0x07, 0x07, 0xE8, 0x9B, 0xC9,
-	0x41, 0x10, 0x7F, 0xA0, 0xB3, 0xFB, 0xE4, 0xEA, 0xA3, 0x96, 0x0F, 0x09,
-	0x3B, 0xE5, 0xEF, 0xFF, 0xFE, 0xEF, 0x9F, 0x3F, 0x7F, 0xBE, 0xBB, 0xBB,
-	0x0B, 0x6F, 0x1D, 0xEF, 0xAC, 0x49, 0x4A, 0xC8, 0xB9, 0x6B, 0x8C, 0xAD,
-	0x30, 0x96, 0x75, 0x7A, 0x7A, 0x7A, 0x75, 0x75, 0xF5, 0xAD, 0xB7, 0xDE,
-	0x42, 0xA7, 0x00, 0x8C, 0xBA, 0x52, 0x55, 0x15, 0x29, 0x01, 0x36, 0x57,
-	0x94, 0xDD, 0x23, 0x88, 0x92, 0x6A, 0x32, 0xC3, 0xFC, 0x0D, 0xD7, 0x97,
-	0x2D, 0xB9, 0x27, 0xE7, 0xA0, 0x68, 0x7A, 0x8E, 0x0C, 0x87, 0xC3, 0x5A,
-	0xAD, 0x86, 0xB4, 0x8F, 0xA6, 0x59, 0x05, 0xA7, 0xB5, 0x6B, 0x8A, 0xD9,
-	0x65, 0x0B, 0x56, 0xC6, 0xB7, 0x52, 0x0A, 0x01, 0x95, 0xDB, 0xED, 0x76,
-	0x9C, 0x5D, 0xA4, 0xCC, 0x4A, 0xA5, 0x12, 0x5A, 0xC5, 0x83, 0x9B, 0xC5,
-	0xCD, 0x7E, 0x6D, 0x5B, 0xE2, 0xC9, 0x0F, 0x8C, 0x25, 0x1A, 0x19, 0x6D,
-	0x6C, 0x6C, 0x7C, 0xF7, 0xBB, 0xDF, 0x55, 0x3E, 0xFA, 0xE8, 0xA3, 0x8F,
-	0x3E, 0xFA, 0x08, 0x5B, 0xCA, 0xA4, 0x1D, 0x05, 0x7F, 0xB2, 0xE6, 0x0B,
-	0x4B, 0xEF, 0xF5, 0x7A, 0xA7, 0x62, 0x53, 0x33, 0xF1, 0x99, 0x68, 0x34,
-	0x3A, 0x3B, 0x3B, 0x3B, 0x37, 0x37, 0x87, 0xB4, 0x38, 0x9B, 0x5D, 0x20,
-	0x01, 0xC4, 0xF8, 0xB0, 0xD7, 0xEB, 0x0D, 0x47, 0x43, 0xBD, 0x4E, 0x2F,
-	0xFB, 0x6E, 0x22, 0xF9, 0x47, 0xC8, 0x45, 0x43, 0xD9, 0xC4, 0xCF, 0xB1,
-	0x58, 0xCC, 0xEF, 0xF7, 0x6B, 0x0A, 0xB5, 0xE4, 0x10, 0x67, 0x5C, 0x2A,
-	0x9B, 0xCD, 0x82, 0x7A, 0x8D, 0xAD, 0x25, 0xB1, 0x10, 0xB1, 0x3D, 0x00,
-	0x47, 0x99, 0x0D, 0x9E, 0x9C, 0xAC, 0x4E, 0x40, 0x8C, 0x1D, 0xBC, 0x20,
-	0xA7, 0xA8, 0x81, 0xE5, 0x10, 0xC3, 0x52, 0xA9, 0x74, 0x7C, 0x7C, 0x0C,
-	0x43, 0xCD, 0x8E, 0xA4, 0x12, 0xA3, 0xFC, 0xC3, 0xE2, 0x0F, 0x9A, 0x62,
-	0x34, 0x1A, 0xBD, 0x76, 0xED, 0xDA, 0xF7, 0xBF, 0xFF, 0xFD, 0x99, 0xF8,
-	0x8C, 0xF2, 0x6F, 0xFF, 0xF6, 0x6F, 0xE9, 0x74, 0x1A, 0x19, 0x44, 0x4E,
-	0x5C, 0xD3, 0x94, 0x50, 0xB1, 0xE7, 0x33, 0x18, 0x06, 0x68, 0xC7, 0x66,
-	0x36, 0x9B, 0xD1, 0xC8, 0xB3, 0x50, 0x28, 0x64, 0x32, 0x19, 0x83, 0xC1,
-	0xF0, 0xF4, 0xE9, 0xD3, 0xC4, 0x71, 0xA2, 0x50, 0x1C, 0xE7, 0xBE, 0xD1,
-	0xB3, 0x2A, 0x12, 0x89, 0x80, 0xBA, 0xDC, 0xEF, 0xF5, 0x07, 0xC3, 0x01,
-	0x09, 0xE8, 0x44, 0x65, 0x99, 0x86, 0x65, 0xA2, 0x11, 0x5E, 0x07, 0x88,
-	0xD9, 0x8A, 0xA2, 0x6C, 0x6E, 0x6E, 0xCE, 0xCF, 0xCF, 0x83, 0xCB, 0x56,
-	0xAD, 0x56, 0x31, 0xAA, 0x05, 0x79, 0xA4, 0xD1, 0x68, 0x04, 0x8D, 0x5C,
-	0xA9, 0x54, 0xD8, 0xBC, 0x9B, 0xFA, 0x13, 0x6E, 0xB1, 0xDF, 0xEF, 0x9F,
-	0x99, 0x99, 0x41, 0xC5, 0x3A, 0xEA, 0x26, 0x41, 0x30, 0x90, 0x14, 0x68,
-	0x96, 0xFF, 0x81, 0xD7, 0x84, 0x91, 0x99, 0xA8, 0xB7, 0xAE, 0xD5, 0x6A,
-	0x40, 0x0F, 0xE1, 0xBC, 0xEE, 0xED, 0xED, 0x15, 0x8B, 0x45, 0xCD, 0x40,
-	0x02, 0xCD, 0x8C, 0xC5, 0x3F, 0x20, 0xFE, 0x48, 0x3D, 0x5D, 0xB8, 0x70,
-	0xE1, 0x4F, 0xFF, 0xF4, 0x4F, 0xED, 0x76, 0xFB, 0xFF, 0xFE, 0xFF, 0xFE,
-	0xF7, 0xFF, 0x05, 0xBF, 0x51, 0x54, 0x10, 0xD9, 0x21, 0x17, 0x32, 0x00,
-	0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
+const uint32_t Caustics_128x128_pixels[21845] = {
+	0xFF2E2E2E, 0xFF212121, 0xFF1A1A1A, 0xFF161616, 0xFF151515, 0xFF151515, 0xFF131313, 0xFF131313,
+	0xFF151515, 0xFF191919, 0xFF1E1E1E, 0xFF262626, 0xFF313131, 0xFF3C3C3C, 0xFF535353, 0xFF6F6F6F,
+	0xFF7A7A7A, 0xFF767676, 0xFF6E6E6E, 0xFF676767, 0xFF656565, 0xFF696969, 0xFF717171, 0xFF7F7F7F,
+	0xFF777777, 0xFF626262, 0xFF515151, 0xFF434343, 0xFF3C3C3C, 0xFF373737, 0xFF393939, 0xFF404040,
+	0xFF515051, 0xFF6E6E6E, 0xFF919191, 0xFF919191, 0xFF818181, 0xFF757575, 0xFF5F5F5F, 0xFF444444,
+	0xFF343434, 0xFF2C2C2C, 0xFF262626, 0xFF202020, 0xFF1B1B1B, 0xFF171717, 0xFF161616, 0xFF161616,
+	0xFF181818, 0xFF1E1E1E, 0xFF252525, 0xFF303030, 0xFF434343, 0xFF656465, 0xFF9D9D9D, 0xFFEBEBEB,
+	0xFFFFFFFF, 0xFFFBFBFB, 0xFFE6E6E6, 0xFFDADADA, 0xFFEAEAEA, 0xFFFCFBFC, 0xFFFDFCFD, 0xFFFAFAFA,
+	0xFFC8C8C8, 0xFF8E8E8E, 0xFF656565, 0xFF4B4B4B, 0xFF383838, 0xFF2E2E2E, 0xFF292929, 0xFF2A2A2A,
+	0xFF2D2D2D, 0xFF353535, 0xFF464646, 0xFF626262, 0xFF9B9B9B, 0xFFD6D6D6, 0xFFC9C9C9, 0xFFA1A1A1,
+	0xFF7F7F7F, 0xFF646464, 0xFF4D4D4D, 0xFF3F3F3F, 0xFF333333, 0xFF313131, 0xFF323232, 0xFF373737,
+	0xFF424242, 0xFF575757, 0xFF727272, 0xFF979797, 0xFFBFBFBF, 0xFFDFDFDF, 0xFFF2F2F2, 0xFFF5F5F5,
+	0xFFDAD9DA, 0xFFBDBEBD, 0xFFA6A6A6, 0xFF878787, 0xFF5E5E5E, 0xFF3F3F3F, 0xFF292929, 0xFF1D1D1D,
+	0xFF131313, 0xFF0E0E0E, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF0F0F0F, 0xFF0F0F0F, 0xFF070707, 0xFF010101,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF060606, 0xFF131313, 0xFF272727, 0xFF545454, 0xFFAFAFAF, 0xFFCECECE, 0xFF838383, 0xFF454545,
+	0xFF1B1B1B, 0xFF151515, 0xFF111111, 0xFF0D0D0D, 0xFF0C0C0C, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF0E0E0E,
+	0xFF141414, 0xFF171717, 0xFF212121, 0xFF2E2E2E, 0xFF3C3C3C, 0xFF5B5B5B, 0xFF737373, 0xFF6D6D6D,
+	0xFF5B5B5B, 0xFF525252, 0xFF505050, 0xFF4F4F4F, 0xFF515151, 0xFF555555, 0xFF5C5C5C, 0xFF606060,
+	0xFF575757, 0xFF4B4B4B, 0xFF404040, 0xFF393939, 0xFF333333, 0xFF313131, 0xFF343434, 0xFF3B3B3B,
+	0xFF494949, 0xFF666666, 0xFFA2A2A2, 0xFFEEEEEE, 0xFFF1F1F1, 0xFFB2B2B2, 0xFF737373, 0xFF545454,
+	0xFF454545, 0xFF3B3B3B, 0xFF343434, 0xFF2D2D2D, 0xFF292929, 0xFF252525, 0xFF232323, 0xFF232323,
+	0xFF272727, 0xFF292929, 0xFF2F2F2F, 0xFF3B3B3B, 0xFF4E4E4E, 0xFF6A6A6A, 0xFF9D9D9D, 0xFFD6D6D6,
+	0xFFD6D6D6, 0xFFC6C6C6, 0xFFBBBBBB, 0xFFB1B1B1, 0xFFADADAD, 0xFFA8A8A8, 0xFFA7A7A7, 0xFFA6A6A6,
+	0xFFA4A4A4, 0xFF939393, 0xFF7C7C7C, 0xFF656565, 0xFF525252, 0xFF474747, 0xFF414141, 0xFF424242,
+	0xFF4A4A4A, 0xFF575757, 0xFF737473, 0xFF9A9A9A, 0xFFC9CAC9, 0xFFF1F1F1, 0xFFEAEAEA, 0xFFAAAAAA,
+	0xFF7A7A7A, 0xFF5B5B5B, 0xFF454545, 0xFF363636, 0xFF2D2D2D, 0xFF2C2C2C, 0xFF2D2D2D, 0xFF323232,
+	0xFF3B3B3B, 0xFF4A4A4A, 0xFF5E5E5E, 0xFF838383, 0xFFB7B7B7, 0xFFEFEFEF, 0xFFFFFFFF, 0xFFF3F3F3,
+	0xFFDBDBDB, 0xFFB6B6B6, 0xFF8B8B8B, 0xFF636363, 0xFF494949, 0xFF353535, 0xFF242424, 0xFF1A1A1A,
+	0xFF111111, 0xFF0E0E0E, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF0E0E0E, 0xFF101010, 0xFF070707, 0xFF010101,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF010101,
+	0xFF090909, 0xFF1D1D1D, 0xFF373737, 0xFF8A8A8A, 0xFFD3D3D3, 0xFF9B9B9B, 0xFF484848, 0xFF292929,
+	0xFF121212, 0xFF0D0D0D, 0xFF0A0A0A, 0xFF090909, 0xFF090909, 0xFF090909, 0xFF0C0C0C, 0xFF0F0F0F,
+	0xFF151515, 0xFF1A1A1A, 0xFF252525, 0xFF393A39, 0xFF5C5C5C, 0xFF6E6F6E, 0xFF5B5B5B, 0xFF484848,
+	0xFF404040, 0xFF3D3D3D, 0xFF3E3E3E, 0xFF404040, 0xFF454545, 0xFF4B4B4B, 0xFF4D4D4D, 0xFF4B4B4B,
+	0xFF424242, 0xFF3C3C3C, 0xFF343434, 0xFF2F2F2F, 0xFF2E2E2E, 0xFF2D2D2D, 0xFF313131, 0xFF383838,
+	0xFF464646, 0xFF636363, 0xFF898989, 0xFFB7B7B7, 0xFFD5D5D5, 0xFFCDCDCD, 0xFF9B9B9B, 0xFF737373,
+	0xFF5E5D5E, 0xFF525252, 0xFF4C4C4C, 0xFF464646, 0xFF3F3F3F, 0xFF3B3B3B, 0xFF373737, 0xFF363636,
+	0xFF373737, 0xFF383838, 0xFF3E3E3E, 0xFF4B4B4B, 0xFF5B5B5B, 0xFF757575, 0xFF9E9E9E, 0xFFA0A0A0,
+	0xFF898989, 0xFF7A7A7A, 0xFF6E6E6E, 0xFF666666, 0xFF616161, 0xFF5C5C5C, 0xFF595959, 0xFF595859,
+	0xFF5A5A5A, 0xFF5B5B5B, 0xFF5D5D5D, 0xFF5E5D5E, 0xFF5C5C5C, 0xFF5A5A5A, 0xFF585858, 0xFF5C5C5C,
+	0xFF636363, 0xFF6B6B6B, 0xFF767576, 0xFF7C7C7C, 0xFF7C7C7C, 0xFF848484, 0xFF949494, 0xFF838383,
+	0xFF646464, 0xFF505050, 0xFF414141, 0xFF343434, 0xFF2C2C2C, 0xFF2C2C2C, 0xFF2B2B2B, 0xFF303030,
+	0xFF373737, 0xFF414141, 0xFF545454, 0xFF6D6D6D, 0xFF8E8E8E, 0xFFB8B8B8, 0xFFBDBDBD, 0xFFA6A6A6,
+	0xFF929292, 0xFF7D7D7D, 0xFF656565, 0xFF505050, 0xFF404040, 0xFF303030, 0xFF212121, 0xFF181818,
+	0xFF131313, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF0D0D0D, 0xFF0E0E0E, 0xFF101010, 0xFF090909, 0xFF040404,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF010101, 0xFF060606,
+	0xFF101010, 0xFF242424, 0xFF505050, 0xFFC0C0C0, 0xFFCDCDCD, 0xFF666666, 0xFF303030, 0xFF1D1D1D,
+	0xFF0D0D0D, 0xFF090909, 0xFF080808, 0xFF080808, 0xFF090909, 0xFF090909, 0xFF0C0C0C, 0xFF0E0E0E,
+	0xFF161616, 0xFF222222, 0xFF323232, 0xFF525152, 0xFF696A69, 0xFF515251, 0xFF3D3D3D, 0xFF333333,
+	0xFF2F2F2F, 0xFF303030, 0xFF353535, 0xFF393939, 0xFF3E3E3E, 0xFF3F3F3F, 0xFF3A3A3A, 0xFF373737,
+	0xFF333333, 0xFF2F2F2F, 0xFF2C2C2C, 0xFF2B2B2B, 0xFF292929, 0xFF2A2A2A, 0xFF2F2F2F, 0xFF373737,
+	0xFF444444, 0xFF505050, 0xFF555555, 0xFF5B5B5B, 0xFF676767, 0xFF858585, 0xFF9F9F9F, 0xFFA1A1A1,
+	0xFF909090, 0xFF7C7C7C, 0xFF747474, 0xFF6B6B6B, 0xFF646464, 0xFF5C5C5C, 0xFF565656, 0xFF515151,
+	0xFF4E4E4E, 0xFF4D4D4D, 0xFF535353, 0xFF5B5B5B, 0xFF6A6A6A, 0xFF828282, 0xFF949594, 0xFF7B7B7B,
+	0xFF686868, 0xFF5A5A5A, 0xFF4E4E4E, 0xFF464646, 0xFF414141, 0xFF3B3B3B, 0xFF383738, 0xFF353535,
+	0xFF353535, 0xFF343434, 0xFF333333, 0xFF343434, 0xFF373737, 0xFF3C3C3C, 0xFF3F3F3F, 0xFF424242,
+	0xFF434343, 0xFF454545, 0xFF474747, 0xFF454545, 0xFF484848, 0xFF494949, 0xFF505050, 0xFF616161,
+	0xFF5E5E5E, 0xFF505050, 0xFF414141, 0xFF383838, 0xFF303030, 0xFF2F2F2F, 0xFF2D2D2D, 0xFF2F2F2F,
+	0xFF373737, 0xFF404040, 0xFF4D4D4D, 0xFF5E5E5E, 0xFF787878, 0xFF888888, 0xFF858585, 0xFF7B7B7B,
+	0xFF707070, 0xFF666666, 0xFF575757, 0xFF494949, 0xFF3B3B3B, 0xFF2D2D2D, 0xFF222222, 0xFF1A1A1A,
+	0xFF141414, 0xFF111111, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF0F0F0F, 0xFF111111, 0xFF0B0B0B, 0xFF070707,
+	0xFF030303, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF0B0B0B,
+	0xFF191919, 0xFF323232, 0xFF767676, 0xFFEFEFEF, 0xFFACACAC, 0xFF494949, 0xFF272727, 0xFF161616,
+	0xFF0D0D0D, 0xFF090909, 0xFF090909, 0xFF090909, 0xFF090909, 0xFF0A0A0A, 0xFF0D0D0D, 0xFF131313,
+	0xFF1C1C1C, 0xFF2B2B2B, 0xFF474747, 0xFF676767, 0xFF535453, 0xFF3B3B3B, 0xFF313131, 0xFF2B2B2B,
+	0xFF282828, 0xFF2C2C2C, 0xFF313131, 0xFF2F2F2F, 0xFF2D2D2D, 0xFF2D2D2D, 0xFF2D2D2D, 0xFF2C2C2C,
+	0xFF2B2B2B, 0xFF2A2A2A, 0xFF282828, 0xFF272727, 0xFF282828, 0xFF2B2B2B, 0xFF313131, 0xFF373737,
+	0xFF383838, 0xFF333333, 0xFF343434, 0xFF383838, 0xFF434343, 0xFF4F4F4F, 0xFF626262, 0xFF838383,
+	0xFFACACAC, 0xFFC8C8C8, 0xFFC5C5C5, 0xFFB1B1B1, 0xFF969696, 0xFF7E7E7E, 0xFF737373, 0xFF727272,
+	0xFF707070, 0xFF6A6A6A, 0xFF6B6B6B, 0xFF6F6F6F, 0xFF777777, 0xFF8A8A8A, 0xFF8D8D8D, 0xFF6C6C6C,
+	0xFF585858, 0xFF4B4A4B, 0xFF3F3F3F, 0xFF373737, 0xFF303030, 0xFF2A2A2A, 0xFF262626, 0xFF232323,
+	0xFF222222, 0xFF222222, 0xFF222222, 0xFF232323, 0xFF242424, 0xFF272727, 0xFF292929, 0xFF2B2B2B,
+	0xFF2D2D2D, 0xFF2E2E2E, 0xFF2F2F2F, 0xFF303030, 0xFF313131, 0xFF333333, 0xFF333333, 0xFF3B3B3B,
+	0xFF454545, 0xFF4C4C4C, 0xFF494949, 0xFF414141, 0xFF393939, 0xFF333333, 0xFF323232, 0xFF343434,
+	0xFF383838, 0xFF3F3F3F, 0xFF494949, 0xFF585858, 0xFF6B6B6B, 0xFF707070, 0xFF6C6C6C, 0xFF696969,
+	0xFF636463, 0xFF5D5D5D, 0xFF555555, 0xFF4A4A4A, 0xFF3E3E3E, 0xFF323232, 0xFF292929, 0xFF212121,
+	0xFF1B1B1B, 0xFF171717, 0xFF141414, 0xFF101010, 0xFF121212, 0xFF111111, 0xFF0E0E0E, 0xFF0A0A0A,
+	0xFF070707, 0xFF050505, 0xFF040404, 0xFF030303, 0xFF030303, 0xFF050505, 0xFF080808, 0xFF131313,
+	0xFF232323, 0xFF434343, 0xFFA7A7A7, 0xFFF8F8F8, 0xFF878787, 0xFF3D3D3D, 0xFF232323, 0xFF141414,
+	0xFF0D0D0D, 0xFF0A0A0A, 0xFF090909, 0xFF090909, 0xFF0B0B0B, 0xFF0E0E0E, 0xFF131313, 0xFF1A1A1A,
+	0xFF272727, 0xFF3D3D3D, 0xFF666666, 0xFF626262, 0xFF414141, 0xFF323232, 0xFF292929, 0xFF252525,
+	0xFF282828, 0xFF292929, 0xFF272727, 0xFF232323, 0xFF222222, 0xFF232323, 0xFF242424, 0xFF252525,
+	0xFF262626, 0xFF262626, 0xFF252525, 0xFF262626, 0xFF2A2A2A, 0xFF303030, 0xFF353535, 0xFF343434,
+	0xFF2D2D2D, 0xFF292929, 0xFF2A2A2A, 0xFF2D2D2D, 0xFF323232, 0xFF3C3C3C, 0xFF474747, 0xFF595959,
+	0xFF7E7E7E, 0xFFC3C3C3, 0xFFFFFFFF, 0xFFFBFBFB, 0xFFBBBBBB, 0xFF878787, 0xFF767676, 0xFF727272,
+	0xFF7C7C7C, 0xFF868686, 0xFF858585, 0xFF808080, 0xFF828282, 0xFF8A8A8A, 0xFF8D8D8D, 0xFF6A6A6A,
+	0xFF545454, 0xFF444444, 0xFF383838, 0xFF2F2F2F, 0xFF272727, 0xFF212121, 0xFF1D1D1D, 0xFF191919,
+	0xFF191919, 0xFF181818, 0xFF181818, 0xFF191919, 0xFF191919, 0xFF1B1B1B, 0xFF1D1D1D, 0xFF1E1E1E,
+	0xFF202020, 0xFF222222, 0xFF232323, 0xFF232323, 0xFF232323, 0xFF232323, 0xFF232323, 0xFF262626,
+	0xFF292929, 0xFF313131, 0xFF383838, 0xFF3D3D3D, 0xFF3E3E3E, 0xFF3B3B3B, 0xFF393939, 0xFF3A3A3A,
+	0xFF3C3C3C, 0xFF434343, 0xFF4B4B4B, 0xFF555455, 0xFF626262, 0xFF676767, 0xFF676767, 0xFF676767,
+	0xFF676867, 0xFF636363, 0xFF5C5C5C, 0xFF525252, 0xFF474747, 0xFF3C3C3C, 0xFF333333, 0xFF292929,
+	0xFF222222, 0xFF1F1F1F, 0xFF1C1C1C, 0xFF181818, 0xFF161616, 0xFF151515, 0xFF111111, 0xFF0D0D0D,
+	0xFF0B0B0B, 0xFF090909, 0xFF0A0A0A, 0xFF080808, 0xFF090909, 0xFF0C0C0C, 0xFF121212, 0xFF1D1D1D,
+	0xFF323232, 0xFF626262, 0xFFDBDADB, 0xFFE4E4E4, 0xFF6D6D6D, 0xFF3A3A3A, 0xFF222222, 0xFF141414,
+	0xFF151515, 0xFF101010, 0xFF0F0F0F, 0xFF0F0F0F, 0xFF151515, 0xFF181818, 0xFF1E1E1E, 0xFF282828,
+	0xFF383838, 0xFF5D5D5D, 0xFF7E7E7E, 0xFF595959, 0xFF3E3E3E, 0xFF303030, 0xFF272727, 0xFF272727,
+	0xFF272727, 0xFF212121, 0xFF1D1D1D, 0xFF1A1A1A, 0xFF1C1C1C, 0xFF1E1E1E, 0xFF202020, 0xFF232323,
+	0xFF252525, 0xFF272727, 0xFF292929, 0xFF2B2B2B, 0xFF323232, 0xFF383838, 0xFF3E3E3E, 0xFF383838,
+	0xFF2E2E2E, 0xFF282828, 0xFF282828, 0xFF282828, 0xFF2C2C2C, 0xFF343434, 0xFF3D3D3D, 0xFF4C4C4C,
+	0xFF656565, 0xFF9A9A9A, 0xFFDDDDDD, 0xFFF4F4F4, 0xFFCDCDCD, 0xFF8E8E8E, 0xFF747474, 0xFF696969,
+	0xFF6B6B6B, 0xFF7F7F7F, 0xFF939393, 0xFF8C8C8C, 0xFF848484, 0xFF868686, 0xFF909090, 0xFF7A7A7A,
+	0xFF595959, 0xFF454545, 0xFF383838, 0xFF2D2D2D, 0xFF252525, 0xFF1E1E1E, 0xFF161616, 0xFF131313,
+	0xFF111111, 0xFF111111, 0xFF111111, 0xFF111111, 0xFF111111, 0xFF141414, 0xFF171717, 0xFF171717,
+	0xFF181818, 0xFF191919, 0xFF191919, 0xFF181818, 0xFF191919, 0xFF1A1A1A, 0xFF1A1A1A, 0xFF1A1A1A,
+	0xFF1C1C1C, 0xFF202020, 0xFF222222, 0xFF242424, 0xFF292929, 0xFF2F2F2F, 0xFF343434, 0xFF3A3A3A,
+	0xFF3F3F3F, 0xFF454545, 0xFF4E4E4E, 0xFF555555, 0xFF5F5F5F, 0xFF686868, 0xFF6E6E6E, 0xFF727272,
+	0xFF727272, 0xFF717171, 0xFF6F6F6F, 0xFF676767, 0xFF5D5D5D, 0xFF515151, 0xFF454545, 0xFF3B3B3B,
+	0xFF323232, 0xFF2A2A2A, 0xFF262626, 0xFF222222, 0xFF1C1C1C, 0xFF181818, 0xFF151515, 0xFF121212,
+	0xFF111111, 0xFF101010, 0xFF101010, 0xFF111111, 0xFF121212, 0xFF181818, 0xFF212121, 0xFF2F2F2F,
+	0xFF4D4D4D, 0xFF9A9A9A, 0xFFFDFDFD, 0xFFBFBFBF, 0xFF5F5F5F, 0xFF393939, 0xFF242424, 0xFF191919,
+	0xFF1B1B1B, 0xFF181818, 0xFF191919, 0xFF191919, 0xFF1F1F1F, 0xFF222222, 0xFF2C2C2C, 0xFF3C3C3C,
+	0xFF535353, 0xFF8A8A8A, 0xFF969696, 0xFF5C5C5C, 0xFF424242, 0xFF333333, 0xFF2D2D2D, 0xFF292929,
+	0xFF212121, 0xFF1A1A1A, 0xFF171717, 0xFF161616, 0xFF181818, 0xFF1C1C1C, 0xFF202020, 0xFF232323,
+	0xFF262626, 0xFF2A2A2A, 0xFF2F2F2F, 0xFF353535, 0xFF3F3F3F, 0xFF474747, 0xFF525252, 0xFF444444,
+	0xFF343534, 0xFF2C2C2C, 0xFF2B2B2B, 0xFF2A2A2A, 0xFF2C2C2C, 0xFF323232, 0xFF3B3B3B, 0xFF494949,
+	0xFF636363, 0xFF888888, 0xFF959595, 0xFFA6A6A6, 0xFFB8B8B8, 0xFF8D8D8D, 0xFF6A6A6A, 0xFF5D5D5D,
+	0xFF5A5A5A, 0xFF626262, 0xFF7D7D7D, 0xFF8E8E8E, 0xFF818181, 0xFF7B7B7B, 0xFF828282, 0xFF898989,
+	0xFF6E6E6E, 0xFF4F4F4F, 0xFF3D3D3D, 0xFF303030, 0xFF272727, 0xFF1E1E1E, 0xFF171717, 0xFF141414,
+	0xFF101010, 0xFF101010, 0xFF101010, 0xFF101010, 0xFF101010, 0xFF111111, 0xFF121212, 0xFF131313,
+	0xFF141414, 0xFF141414, 0xFF151515, 0xFF141414, 0xFF141414, 0xFF131313, 0xFF121212, 0xFF131313,
+	0xFF141414, 0xFF141414, 0xFF151515, 0xFF181818, 0xFF1D1D1D, 0xFF212121, 0xFF252525, 0xFF2D2D2D,
+	0xFF373737, 0xFF414141, 0xFF4F4F4F, 0xFF5A5A5A, 0xFF626262, 0xFF696969, 0xFF6F6F6F, 0xFF717171,
+	0xFF747474, 0xFF747474, 0xFF737373, 0xFF6F6F6F, 0xFF696969, 0xFF616061, 0xFF555555, 0xFF4A4A4A,
+	0xFF404040, 0xFF353535, 0xFF2C2C2C, 0xFF282828, 0xFF232323, 0xFF1E1E1E, 0xFF1D1D1D, 0xFF1C1C1C,
+	0xFF1C1C1C, 0xFF1C1C1C, 0xFF1D1D1D, 0xFF1E1E1E, 0xFF202020, 0xFF282828, 0xFF363636, 0xFF4A4A4A,
+	0xFF848484, 0xFFE5E5E5, 0xFFF9F9F9, 0xFF979797, 0xFF575757, 0xFF3A3A3A, 0xFF292929, 0xFF1E1E1E,
+	0xFF252525, 0xFF252525, 0xFF252525, 0xFF2A2A2A, 0xFF2F2F2F, 0xFF363636, 0xFF434343, 0xFF595959,
+	0xFF828282, 0xFFD0D0D0, 0xFFC2C2C2, 0xFF707170, 0xFF4E4E4E, 0xFF3B3B3B, 0xFF2F2F2F, 0xFF242424,
+	0xFF1C1C1C, 0xFF181818, 0xFF181818, 0xFF171717, 0xFF1A1A1A, 0xFF1D1D1D, 0xFF212121, 0xFF282828,
+	0xFF2E2E2E, 0xFF343434, 0xFF3C3C3C, 0xFF464646, 0xFF535353, 0xFF646464, 0xFF747474, 0xFF606060,
+	0xFF474747, 0xFF3B3B3B, 0xFF343434, 0xFF313131, 0xFF353535, 0xFF3A3A3A, 0xFF434343, 0xFF525152,
+	0xFF656565, 0xFF696969, 0xFF6C6C6C, 0xFF777777, 0xFF8E8E8E, 0xFF7E7E7E, 0xFF5D5D5D, 0xFF4F4F4F,
+	0xFF4A4A4A, 0xFF4C4C4C, 0xFF5B5B5B, 0xFF787878, 0xFF7A7A7A, 0xFF6E6E6E, 0xFF6C6C6C, 0xFF757575,
+	0xFF808080, 0xFF6C6C6C, 0xFF4D4D4D, 0xFF393939, 0xFF2C2C2C, 0xFF222222, 0xFF1A1A1A, 0xFF151515,
+	0xFF131313, 0xFF101010, 0xFF101010, 0xFF101010, 0xFF101010, 0xFF111111, 0xFF121212, 0xFF131313,
+	0xFF141414, 0xFF151515, 0xFF151515, 0xFF131313, 0xFF101010, 0xFF101010, 0xFF0E0E0E, 0xFF0E0E0E,
+	0xFF0F0F0F, 0xFF0F0F0F, 0xFF0F0F0F, 0xFF121212, 0xFF141414, 0xFF181818, 0xFF1F1F1F, 0xFF272727,
+	0xFF323232, 0xFF3E3E3E, 0xFF4F4F4F, 0xFF646464, 0xFF6B6B6B, 0xFF707070, 0xFF737373, 0xFF747474,
+	0xFF737373, 0xFF717171, 0xFF6E6E6E, 0xFF6B6B6B, 0xFF636363, 0xFF5C5C5C, 0xFF545454, 0xFF4B4A4B,
+	0xFF424242, 0xFF3B3B3B, 0xFF333333, 0xFF2E2E2E, 0xFF2A2A2A, 0xFF292929, 0xFF292929, 0xFF292929,
+	0xFF292929, 0xFF2C2C2C, 0xFF2D2D2D, 0xFF313131, 0xFF373737, 0xFF464646, 0xFF5F5F5F, 0xFF8D8D8D,
+	0xFFDFDFDF, 0xFFFFFFFF, 0xFFC7C7C7, 0xFF7A7A7A, 0xFF525252, 0xFF3E3E3E, 0xFF303030, 0xFF2A2A2A,
+	0xFF343434, 0xFF343434, 0xFF343434, 0xFF363636, 0xFF363636, 0xFF3D3D3D, 0xFF4C4C4C, 0xFF676767,
+	0xFFA09FA0, 0xFFF8F7F8, 0xFFE3E3E3, 0xFF878887, 0xFF545554, 0xFF3C3C3C, 0xFF2A2A2A, 0xFF202020,
+	0xFF191919, 0xFF181818, 0xFF181818, 0xFF191919, 0xFF1C1C1C, 0xFF212121, 0xFF282828, 0xFF313131,
+	0xFF3B3B3B, 0xFF444444, 0xFF545454, 0xFF666666, 0xFF848484, 0xFFA8A8A8, 0xFFC8C8C8, 0xFFA8A8A8,
+	0xFF717171, 0xFF555555, 0xFF494949, 0xFF454545, 0xFF474747, 0xFF4C4C4C, 0xFF575757, 0xFF5F605F,
+	0xFF5B5B5B, 0xFF555555, 0xFF5B5B5B, 0xFF656565, 0xFF797979, 0xFF696969, 0xFF4A4A4A, 0xFF3D3D3D,
+	0xFF3A3A3A, 0xFF393939, 0xFF3F3F3F, 0xFF535253, 0xFF646464, 0xFF5E5E5E, 0xFF5C5C5C, 0xFF5E5E5E,
+	0xFF6A6A6A, 0xFF7C7C7C, 0xFF6E6E6E, 0xFF4D4D4D, 0xFF393939, 0xFF2A2A2A, 0xFF212121, 0xFF191919,
+	0xFF151515, 0xFF131313, 0xFF111111, 0xFF111111, 0xFF111111, 0xFF121212, 0xFF131313, 0xFF141414,
+	0xFF151515, 0xFF151515, 0xFF151515, 0xFF131313, 0xFF101010, 0xFF0F0F0F, 0xFF0D0D0D, 0xFF0C0C0C,
+	0xFF0B0B0B, 0xFF0A0A0A, 0xFF0A0A0A, 0xFF0D0D0D, 0xFF0F0F0F, 0xFF141414, 0xFF191919, 0xFF222222,
+	0xFF2E2E2E, 0xFF414141, 0xFF595959, 0xFF6F6F6F, 0xFF777777, 0xFF7A7A7A, 0xFF7C7C7C, 0xFF7C7C7C,
+	0xFF7A7A7A, 0xFF767676, 0xFF727272, 0xFF6E6E6E, 0xFF666666, 0xFF5F5F5F, 0xFF595959, 0xFF505150,
+	0xFF494949, 0xFF434343, 0xFF3F3F3F, 0xFF3C3C3C, 0xFF393939, 0xFF393939, 0xFF3D3D3D, 0xFF3E3E3E,
+	0xFF434343, 0xFF4A4A4A, 0xFF4E4E4E, 0xFF585858, 0xFF676767, 0xFF818181, 0xFFADADAD, 0xFFEEEEEE,
+	0xFFFFFFFF, 0xFFCFCFCF, 0xFF8A8A8A, 0xFF646464, 0xFF4E4E4E, 0xFF414141, 0xFF383838, 0xFF333333,
+	0xFF434343, 0xFF393939, 0xFF2F2F2F, 0xFF282828, 0xFF262626, 0xFF2B2B2B, 0xFF353535, 0xFF484848,
+	0xFF6C6C6C, 0xFFB7B7B7, 0xFFB2B2B2, 0xFF6A6A6A, 0xFF474747, 0xFF343434, 0xFF272727, 0xFF202020,
+	0xFF1C1C1C, 0xFF1B1B1B, 0xFF1C1C1C, 0xFF1F1F1F, 0xFF232323, 0xFF2B2B2B, 0xFF363636, 0xFF404040,
+	0xFF454545, 0xFF474747, 0xFF515151, 0xFF5F5F5F, 0xFF7E7E7E, 0xFFB3B3B3, 0xFFF3F3F3, 0xFFFDFDFD,
+	0xFFD3D3D3, 0xFF9A9A9A, 0xFF797979, 0xFF6A6A6A, 0xFF6A6A6A, 0xFF717171, 0xFF6D6D6D, 0xFF5F5F5F,
+	0xFF565656, 0xFF525252, 0xFF575757, 0xFF636363, 0xFF6E6E6E, 0xFF515151, 0xFF3A3A3A, 0xFF2D2D2D,
+	0xFF292929, 0xFF282828, 0xFF2E2E2E, 0xFF363636, 0xFF4B4B4B, 0xFF4F4F4F, 0xFF4A4B4A, 0xFF4C4C4C,
+	0xFF555555, 0xFF646464, 0xFF7A7A7A, 0xFF727272, 0xFF505050, 0xFF3C3C3C, 0xFF2C2C2C, 0xFF232323,
+	0xFF1C1C1C, 0xFF191919, 0xFF191919, 0xFF181818, 0xFF181818, 0xFF191919, 0xFF181818, 0xFF1A1A1A,
+	0xFF1A1A1A, 0xFF191919, 0xFF161616, 0xFF141414, 0xFF111111, 0xFF0F0F0F, 0xFF0D0D0D, 0xFF0A0A0A,
+	0xFF090909, 0xFF090909, 0xFF090909, 0xFF0A0A0A, 0xFF0D0D0D, 0xFF121212, 0xFF181818, 0xFF232323,
+	0xFF323232, 0xFF474747, 0xFF686868, 0xFF838383, 0xFF878787, 0xFF898989, 0xFF898989, 0xFF878787,
+	0xFF848484, 0xFF7E7E7E, 0xFF7A7A7A, 0xFF767676, 0xFF707070, 0xFF6A6A6A, 0xFF626262, 0xFF5B5B5B,
+	0xFF545454, 0xFF515151, 0xFF505050, 0xFF4F4F4F, 0xFF4F4F4F, 0xFF535353, 0xFF5C5C5C, 0xFF666666,
+	0xFF6C6C6C, 0xFF6F6F6F, 0xFF747474, 0xFF7E7E7E, 0xFF8D8D8D, 0xFFA4A4A4, 0xFFC5C5C5, 0xFFDFDEDF,
+	0xFFBBBBBB, 0xFF818181, 0xFF646464, 0xFF545454, 0xFF4B4B4B, 0xFF454545, 0xFF424242, 0xFF434343,
+	0xFF3B3B3B, 0xFF2C2C2C, 0xFF242424, 0xFF1E1E1E, 0xFF1B1B1B, 0xFF1E1E1E, 0xFF232323, 0xFF313131,
+	0xFF474747, 0xFF737373, 0xFF7F7F7F, 0xFF565656, 0xFF3F3F3F, 0xFF303030, 0xFF292929, 0xFF232323,
+	0xFF202020, 0xFF1F1F1F, 0xFF222222, 0xFF272727, 0xFF2F2F2F, 0xFF393939, 0xFF424242, 0xFF373737,
+	0xFF303030, 0xFF2D2D2D, 0xFF323232, 0xFF383838, 0xFF474747, 0xFF626262, 0xFF969696, 0xFFD1D1D1,
+	0xFFE1E1E1, 0xFFE4E4E4, 0xFFD9D9D9, 0xFFC3C3C3, 0xFFBBBBBB, 0xFF9E9E9E, 0xFF787878, 0xFF646464,
+	0xFF5A5A5A, 0xFF565656, 0xFF5F5F5F, 0xFF676767, 0xFF575757, 0xFF393939, 0xFF2A2A2A, 0xFF212121,
+	0xFF1D1D1D, 0xFF1C1C1C, 0xFF212121, 0xFF262626, 0xFF343434, 0xFF3D3D3D, 0xFF3C3C3C, 0xFF3E3E3E,
+	0xFF474747, 0xFF555555, 0xFF646464, 0xFF7F7F7F, 0xFF757575, 0xFF535353, 0xFF3C3C3C, 0xFF303030,
+	0xFF292929, 0xFF222222, 0xFF202020, 0xFF202020, 0xFF212121, 0xFF232323, 0xFF232323, 0xFF252525,
+	0xFF252525, 0xFF222222, 0xFF1D1D1D, 0xFF1A1A1A, 0xFF161616, 0xFF111111, 0xFF0E0E0E, 0xFF0B0B0B,
+	0xFF090909, 0xFF090909, 0xFF090909, 0xFF090909, 0xFF0B0B0B, 0xFF111111, 0xFF1A1A1A, 0xFF262626,
+	0xFF363636, 0xFF525252, 0xFF7F7F7F, 0xFF9B9B9B, 0xFF9D9D9D, 0xFF9E9E9E, 0xFF9C9C9C, 0xFF979797,
+	0xFF939393, 0xFF8B8B8B, 0xFF868686, 0xFF828282, 0xFF7E7E7E, 0xFF797979, 0xFF727272, 0xFF6D6D6D,
+	0xFF686868, 0xFF656565, 0xFF656565, 0xFF696969, 0xFF6F6F6F, 0xFF7B7B7B, 0xFF8F8F8F, 0xFFA5A5A5,
+	0xFFA3A3A3, 0xFF989898, 0xFF919191, 0xFF919191, 0xFF959595, 0xFF9E9E9E, 0xFFA8A8A8, 0xFF939393,
+	0xFF6F6F6F, 0xFF5D5D5D, 0xFF515151, 0xFF484948, 0xFF474747, 0xFF474747, 0xFF4D4D4D, 0xFF4C4C4C,
+	0xFF343434, 0xFF262626, 0xFF1C1C1C, 0xFF161616, 0xFF151515, 0xFF151515, 0xFF181818, 0xFF212121,
+	0xFF303030, 0xFF4C4C4C, 0xFF5F5F5F, 0xFF494949, 0xFF3A3A3A, 0xFF323232, 0xFF2C2C2C, 0xFF282828,
+	0xFF272727, 0xFF292929, 0xFF2D2D2D, 0xFF343434, 0xFF424242, 0xFF424242, 0xFF333333, 0xFF262626,
+	0xFF202020, 0xFF1E1E1E, 0xFF222222, 0xFF252525, 0xFF2E2E2E, 0xFF3D3D3D, 0xFF535353, 0xFF767676,
+	0xFF929292, 0xFFACACAC, 0xFFE1E1E1, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFCFCFCF, 0xFF969696, 0xFF787878,
+	0xFF696969, 0xFF686868, 0xFF696969, 0xFF565656, 0xFF383838, 0xFF262626, 0xFF1D1D1D, 0xFF171717,
+	0xFF141414, 0xFF141414, 0xFF171717, 0xFF1B1B1B, 0xFF232323, 0xFF2E2E2E, 0xFF333333, 0xFF363636,
+	0xFF3D3D3D, 0xFF474747, 0xFF575757, 0xFF6E6E6E, 0xFF898989, 0xFF7A7A7A, 0xFF565656, 0xFF444444,
+	0xFF393939, 0xFF313131, 0xFF2E2E2E, 0xFF2E2E2E, 0xFF2E2E2E, 0xFF303030, 0xFF323232, 0xFF2F2F2F,
+	0xFF2D2D2D, 0xFF2A2A2A, 0xFF282828, 0xFF232323, 0xFF1D1D1D, 0xFF171717, 0xFF111111, 0xFF0E0E0E,
+	0xFF0B0B0B, 0xFF090909, 0xFF080808, 0xFF0A0A0A, 0xFF0D0D0D, 0xFF121212, 0xFF1D1D1D, 0xFF2B2B2B,
+	0xFF404040, 0xFF666666, 0xFFA1A1A1, 0xFFB8B8B8, 0xFFBCBCBC, 0xFFBBBBBB, 0xFFB3B3B3, 0xFFA7A7A7,
+	0xFF9A9A9A, 0xFF919191, 0xFF8B8B8B, 0xFF888888, 0xFF868686, 0xFF878787, 0xFF838383, 0xFF818181,
+	0xFF808080, 0xFF818181, 0xFF858585, 0xFF8E8E8E, 0xFF9C9C9C, 0xFFB6B6B6, 0xFFDADADA, 0xFFF4F4F4,
+	0xFFEEEEEE, 0xFFD8D8D8, 0xFFBDBDBD, 0xFFA8A8A8, 0xFF989898, 0xFF8C8C8C, 0xFF717171, 0xFF5A5A5A,
+	0xFF4D4D4D, 0xFF444444, 0xFF434343, 0xFF414141, 0xFF454545, 0xFF4C4C4C, 0xFF565656, 0xFF4A4A4A,
+	0xFF303030, 0xFF222222, 0xFF181818, 0xFF111111, 0xFF0D0D0D, 0xFF0C0C0C, 0xFF0D0D0D, 0xFF141414,
+	0xFF1F1F1F, 0xFF313131, 0xFF484848, 0xFF424242, 0xFF383838, 0xFF323232, 0xFF303030, 0xFF2E2E2E,
+	0xFF313131, 0xFF333333, 0xFF3D3D3D, 0xFF4B4B4B, 0xFF504F50, 0xFF3A3A3A, 0xFF292929, 0xFF1F1F1F,
+	0xFF1B1B1B, 0xFF171717, 0xFF181818, 0xFF1B1B1B, 0xFF202020, 0xFF292929, 0xFF353535, 0xFF474747,
+	0xFF5D5D5D, 0xFF757575, 0xFF929292, 0xFFAEAEAE, 0xFFB7B7B7, 0xFFB4B4B4, 0xFF9E9E9E, 0xFF868686,
+	0xFF737373, 0xFF616161, 0xFF494949, 0xFF303030, 0xFF222222, 0xFF181818, 0xFF131313, 0xFF0F0F0F,
+	0xFF0C0C0C, 0xFF0C0C0C, 0xFF101010, 0xFF141414, 0xFF1B1B1B, 0xFF252525, 0xFF272727, 0xFF2C2C2C,
+	0xFF353535, 0xFF404040, 0xFF515051, 0xFF646464, 0xFF7F7F7F, 0xFF989898, 0xFF797979, 0xFF5B5B5B,
+	0xFF4E4E4E, 0xFF464546, 0xFF424242, 0xFF434343, 0xFF444444, 0xFF404040, 0xFF343434, 0xFF2D2D2D,
+	0xFF2A2A2A, 0xFF292929, 0xFF2C2C2C, 0xFF2E2E2E, 0xFF292929, 0xFF1E1E1E, 0xFF171717, 0xFF111111,
+	0xFF0D0D0D, 0xFF0C0C0C, 0xFF0C0C0C, 0xFF0D0D0D, 0xFF111111, 0xFF171717, 0xFF242424, 0xFF363636,
+	0xFF545454, 0xFF8F8F8F, 0xFFD0D0D0, 0xFFE1E1E1, 0xFFD7D7D7, 0xFFBBBBBB, 0xFF9E9E9E, 0xFF898989,
+	0xFF7A7A7A, 0xFF717171, 0xFF696969, 0xFF696969, 0xFF6D6D6D, 0xFF717171, 0xFF777777, 0xFF7D7D7D,
+	0xFF848484, 0xFF8C8C8C, 0xFF989898, 0xFFA5A5A5, 0xFFB8B8B8, 0xFFD5D5D5, 0xFFF0F0F0, 0xFFFFFFFF,
+	0xFFFEFEFE, 0xFFE3E3E3, 0xFFB9B9B9, 0xFF959595, 0xFF777777, 0xFF5D5D5D, 0xFF494949, 0xFF3E3E3E,
+	0xFF393939, 0xFF353535, 0xFF373737, 0xFF3C3C3C, 0xFF444444, 0xFF555555, 0xFF606060, 0xFF464646,
+	0xFF2F2F2F, 0xFF1B1B1B, 0xFF131313, 0xFF0E0E0E, 0xFF0B0B0B, 0xFF070707, 0xFF080808, 0xFF0B0B0B,
+	0xFF141414, 0xFF202020, 0xFF353535, 0xFF3E3E3E, 0xFF373737, 0xFF363636, 0xFF353535, 0xFF383838,
+	0xFF3E3E3E, 0xFF444444, 0xFF505050, 0xFF606060, 0xFF505050, 0xFF373737, 0xFF282828, 0xFF1E1E1E,
+	0xFF1C1C1C, 0xFF181818, 0xFF171717, 0xFF171717, 0xFF1A1A1A, 0xFF1F1F1F, 0xFF272727, 0xFF303030,
+	0xFF3A3A3A, 0xFF484848, 0xFF535353, 0xFF595959, 0xFF595959, 0xFF585858, 0xFF565656, 0xFF515151,
+	0xFF434343, 0xFF353535, 0xFF272727, 0xFF1D1D1D, 0xFF131313, 0xFF0E0E0E, 0xFF0B0B0B, 0xFF0A0A0A,
+	0xFF090909, 0xFF090909, 0xFF0D0D0D, 0xFF111111, 0xFF191919, 0xFF202020, 0xFF232323, 0xFF282828,
+	0xFF303030, 0xFF3D3D3D, 0xFF4D4D4D, 0xFF636363, 0xFF7D7D7D, 0xFFA1A1A1, 0xFF9D9D9D, 0xFF787878,
+	0xFF666666, 0xFF5D5C5D, 0xFF595959, 0xFF5B5B5B, 0xFF525252, 0xFF3E3E3E, 0xFF303030, 0xFF282828,
+	0xFF242424, 0xFF242424, 0xFF262626, 0xFF2C2C2C, 0xFF323232, 0xFF2C2C2C, 0xFF1F1F1F, 0xFF1A1A1A,
+	0xFF141414, 0xFF111111, 0xFF101010, 0xFF121212, 0xFF161616, 0xFF1E1E1E, 0xFF2E2E2E, 0xFF454545,
+	0xFF747474, 0xFFCACACA, 0xFFFAFAFA, 0xFFE2E2E2, 0xFFA8A8A8, 0xFF858585, 0xFF707070, 0xFF626262,
+	0xFF5A5A5A, 0xFF555555, 0xFF525252, 0xFF525252, 0xFF535353, 0xFF575757, 0xFF5B5B5B, 0xFF616161,
+	0xFF666666, 0xFF6F6F6F, 0xFF787878, 0xFF808080, 0xFF8C8C8C, 0xFF989898, 0xFFA8A8A8, 0xFFCCCCCC,
+	0xFFDBDADB, 0xFFAEAEAE, 0xFF8A8A8A, 0xFF6D6D6D, 0xFF565656, 0xFF454545, 0xFF3A3A3A, 0xFF323232,
+	0xFF2D2D2D, 0xFF2D2D2D, 0xFF303030, 0xFF383838, 0xFF454545, 0xFF616161, 0xFF6A6A6A, 0xFF464646,
+	0xFF2F2F2F, 0xFF1C1C1C, 0xFF111111, 0xFF0A0A0A, 0xFF060606, 0xFF030303, 0xFF040404, 0xFF060606,
+	0xFF0B0B0B, 0xFF141414, 0xFF282828, 0xFF363636, 0xFF363636, 0xFF393939, 0xFF3C3C3C, 0xFF434343,
+	0xFF4D4D4D, 0xFF585858, 0xFF6A6A6A, 0xFF6F6F6F, 0xFF545454, 0xFF3E3E3E, 0xFF2D2D2D, 0xFF212121,
+	0xFF1C1C1C, 0xFF181818, 0xFF161616, 0xFF161616, 0xFF171717, 0xFF191919, 0xFF1D1D1D, 0xFF232323,
+	0xFF282828, 0xFF313131, 0xFF343434, 0xFF353535, 0xFF343434, 0xFF313131, 0xFF2C2C2C, 0xFF272727,
+	0xFF222222, 0xFF1C1C1C, 0xFF151515, 0xFF101010, 0xFF0B0B0B, 0xFF070707, 0xFF060606, 0xFF050505,
+	0xFF050505, 0xFF070707, 0xFF0B0B0B, 0xFF101010, 0xFF181818, 0xFF1E1E1E, 0xFF202020, 0xFF262626,
+	0xFF303030, 0xFF3C3C3C, 0xFF4C4C4C, 0xFF656565, 0xFF828282, 0xFFACACAC, 0xFFB6B6B6, 0xFF8F8F8F,
+	0xFF7B7B7B, 0xFF737373, 0xFF737373, 0xFF6C6C6C, 0xFF4E4E4E, 0xFF3A3A3A, 0xFF2C2C2C, 0xFF232323,
+	0xFF1F1F1F, 0xFF1E1E1E, 0xFF202020, 0xFF242424, 0xFF2B2B2B, 0xFF343434, 0xFF2E2E2E, 0xFF252525,
+	0xFF1E1E1E, 0xFF181818, 0xFF171717, 0xFF191919, 0xFF1E1E1E, 0xFF292929, 0xFF3D3D3D, 0xFF5E5E5E,
+	0xFFAFAFAF, 0xFFFEFEFE, 0xFFE8E8E8, 0xFF9B9B9B, 0xFF707070, 0xFF5D5D5D, 0xFF515151, 0xFF4A4A4A,
+	0xFF464646, 0xFF414141, 0xFF414141, 0xFF434343, 0xFF444444, 0xFF474747, 0xFF4A4A4A, 0xFF4E4E4E,
+	0xFF525152, 0xFF575757, 0xFF5C5C5C, 0xFF5E5E5E, 0xFF666666, 0xFF6E6E6E, 0xFF777777, 0xFF929292,
+	0xFFBABABA, 0xFFA0A0A0, 0xFF787878, 0xFF5F5F5F, 0xFF4C4C4C, 0xFF3A3A3A, 0xFF2E2F2E, 0xFF2A2A2A,
+	0xFF272727, 0xFF282828, 0xFF2D2D2D, 0xFF363636, 0xFF494949, 0xFF6D6D6D, 0xFF767676, 0xFF4A4A4A,
+	0xFF323232, 0xFF1D1D1D, 0xFF111111, 0xFF0A0A0A, 0xFF040404, 0xFF010101, 0xFF020202, 0xFF020202,
+	0xFF070707, 0xFF0E0E0E, 0xFF1D1D1D, 0xFF313131, 0xFF393939, 0xFF3E3E3E, 0xFF464646, 0xFF525252,
+	0xFF616161, 0xFF757575, 0xFF8C8C8C, 0xFF8C8C8C, 0xFF696969, 0xFF4E4E4E, 0xFF3B3B3B, 0xFF2D2D2D,
+	0xFF242424, 0xFF1D1D1D, 0xFF181818, 0xFF171717, 0xFF161616, 0xFF161616, 0xFF191919, 0xFF1C1C1C,
+	0xFF1E1E1E, 0xFF212121, 0xFF222222, 0xFF222222, 0xFF1F1F1F, 0xFF1C1C1C, 0xFF181818, 0xFF141414,
+	0xFF121212, 0xFF0D0D0D, 0xFF090909, 0xFF070707, 0xFF040404, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF010101, 0xFF060606, 0xFF0A0A0A, 0xFF111111, 0xFF1A1A1A, 0xFF1E1E1E, 0xFF1F1F1F, 0xFF252525,
+	0xFF313131, 0xFF3F3F3F, 0xFF545454, 0xFF6F6F6F, 0xFF949494, 0xFFC3C3C3, 0xFFBBBBBB, 0xFF979797,
+	0xFF868686, 0xFF828282, 0xFF838383, 0xFF636363, 0xFF434343, 0xFF313131, 0xFF252525, 0xFF1D1D1D,
+	0xFF181818, 0xFF181818, 0xFF1A1A1A, 0xFF1D1D1D, 0xFF232323, 0xFF2B2B2B, 0xFF373737, 0xFF363636,
+	0xFF2A2A2A, 0xFF252525, 0xFF232323, 0xFF252525, 0xFF2C2C2C, 0xFF3B3B3B, 0xFF575757, 0xFF939393,
+	0xFFECECEC, 0xFFF5F5F5, 0xFFA1A1A1, 0xFF6A6A6A, 0xFF535353, 0xFF474747, 0xFF3E3E3E, 0xFF383838,
+	0xFF353535, 0xFF353535, 0xFF353535, 0xFF353535, 0xFF363636, 0xFF393939, 0xFF3C3C3C, 0xFF414141,
+	0xFF424242, 0xFF444444, 0xFF494949, 0xFF4C4C4C, 0xFF505050, 0xFF5A5A5A, 0xFF616161, 0xFF767676,
+	0xFFA4A4A4, 0xFFAAAAAA, 0xFF7B7B7B, 0xFF5C5C5C, 0xFF4A4A4A, 0xFF3A3A3A, 0xFF2D2D2D, 0xFF282828,
+	0xFF252525, 0xFF282828, 0xFF2E2E2E, 0xFF3B3B3B, 0xFF545454, 0xFF8A8A8A, 0xFF8E8E8E, 0xFF525152,
+	0xFF383838, 0xFF202020, 0xFF111111, 0xFF090909, 0xFF040404, 0xFF010101, 0xFF020202, 0xFF020202,
+	0xFF040404, 0xFF0A0A0A, 0xFF141414, 0xFF282828, 0xFF3B3B3B, 0xFF444444, 0xFF505050, 0xFF626262,
+	0xFF777777, 0xFF939393, 0xFFB1B1B1, 0xFFBCBCBC, 0xFF939393, 0xFF6E6E6E, 0xFF535353, 0xFF404040,
+	0xFF333333, 0xFF292929, 0xFF222222, 0xFF1D1D1D, 0xFF191919, 0xFF171717, 0xFF181818, 0xFF191919,
+	0xFF1A1A1A, 0xFF1B1B1B, 0xFF191919, 0xFF171717, 0xFF131313, 0xFF111111, 0xFF0D0D0D, 0xFF0B0B0B,
+	0xFF080808, 0xFF040404, 0xFF020202, 0xFF010101, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF010101, 0xFF060606, 0xFF0A0A0A, 0xFF141414, 0xFF1C1C1C, 0xFF1E1E1E, 0xFF202020, 0xFF2A2A2A,
+	0xFF353535, 0xFF474747, 0xFF646464, 0xFF8A8A8A, 0xFFBCBDBC, 0xFFCFCFCF, 0xFFA9A9A9, 0xFF8D8D8D,
+	0xFF838383, 0xFF858585, 0xFF797979, 0xFF525252, 0xFF3A3A3A, 0xFF2B2B2B, 0xFF202020, 0xFF171717,
+	0xFF121212, 0xFF121212, 0xFF141414, 0xFF171717, 0xFF1D1D1D, 0xFF232323, 0xFF2D2D2D, 0xFF393939,
+	0xFF3D3D3D, 0xFF373737, 0xFF333333, 0xFF363636, 0xFF3E3E3E, 0xFF545454, 0xFF7D7D7D, 0xFFC0C0C0,
+	0xFFF5F5F5, 0xFFBFBFBF, 0xFF6F6F6F, 0xFF505050, 0xFF3E3E3E, 0xFF363636, 0xFF313131, 0xFF2D2D2D,
+	0xFF2A2A2A, 0xFF2A2A2A, 0xFF2B2B2B, 0xFF2A2A2A, 0xFF2B2B2B, 0xFF2F2F2F, 0xFF313131, 0xFF353535,
+	0xFF363636, 0xFF373737, 0xFF3B3B3B, 0xFF3F3F3F, 0xFF434343, 0xFF4A494A, 0xFF525252, 0xFF666666,
+	0xFF969696, 0xFFC1C1C1, 0xFF8E8E8E, 0xFF656565, 0xFF4E4E4E, 0xFF3B3B3B, 0xFF2C2C2C, 0xFF272727,
+	0xFF252525, 0xFF292929, 0xFF323232, 0xFF474747, 0xFF696969, 0xFFB8B8B8, 0xFFB1B1B1, 0xFF5E5E5E,
+	0xFF424242, 0xFF242424, 0xFF121212, 0xFF0A0A0A, 0xFF040404, 0xFF010101, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF080808, 0xFF111111, 0xFF222222, 0xFF3A3A3A, 0xFF494949, 0xFF5D5D5D, 0xFF757575,
+	0xFF939393, 0xFFB3B3B3, 0xFFD6D6D6, 0xFFF0F0F0, 0xFFDCDCDC, 0xFFADADAD, 0xFF828282, 0xFF5F5F5F,
+	0xFF4A4A4A, 0xFF3C3C3C, 0xFF2F2F2F, 0xFF292929, 0xFF232323, 0xFF202020, 0xFF1E1E1E, 0xFF1C1C1C,
+	0xFF1B1B1B, 0xFF1A1A1A, 0xFF171717, 0xFF131313, 0xFF101010, 0xFF0D0D0D, 0xFF090909, 0xFF060606,
+	0xFF020202, 0xFF010101, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF070707, 0xFF0F0F0F, 0xFF181818, 0xFF1C1C1C, 0xFF1E1E1E, 0xFF232323, 0xFF313131,
+	0xFF404040, 0xFF585858, 0xFF7A7A7A, 0xFFB8B8B8, 0xFFD4D4D4, 0xFFABABAB, 0xFF8B8B8B, 0xFF7B7B7B,
+	0xFF757575, 0xFF7B7B7B, 0xFF646464, 0xFF474747, 0xFF323232, 0xFF242424, 0xFF191919, 0xFF131313,
+	0xFF0E0E0E, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF101010, 0xFF151515, 0xFF1C1C1C, 0xFF242424, 0xFF2D2D2D,
+	0xFF393939, 0xFF404040, 0xFF474747, 0xFF4D4D4D, 0xFF565656, 0xFF6F6F6F, 0xFF959595, 0xFFC5C5C5,
+	0xFFDEDEDE, 0xFF8D8D8D, 0xFF595959, 0xFF434343, 0xFF353535, 0xFF2D2D2D, 0xFF2B2B2B, 0xFF272727,
+	0xFF242424, 0xFF242424, 0xFF252525, 0xFF252525, 0xFF262626, 0xFF292929, 0xFF2B2B2B, 0xFF2D2D2D,
+	0xFF2E2E2E, 0xFF303030, 0xFF323232, 0xFF363636, 0xFF3A3A3A, 0xFF404040, 0xFF4A4A4A, 0xFF5E5E5E,
+	0xFF919191, 0xFFE0E0E0, 0xFFBEBEBE, 0xFF7C7C7C, 0xFF505050, 0xFF353535, 0xFF242424, 0xFF1F1F1F,
+	0xFF202020, 0xFF272727, 0xFF323232, 0xFF4F4F4F, 0xFF878787, 0xFFEDEDED, 0xFFD9D9D9, 0xFF727272,
+	0xFF454545, 0xFF2B2B2B, 0xFF181818, 0xFF0C0C0C, 0xFF040404, 0xFF010101, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF050505, 0xFF0F0F0F, 0xFF1E1E1E, 0xFF3B3B3B, 0xFF555555, 0xFF6B6B6B, 0xFF8A8A8A,
+	0xFFB6B6B6, 0xFFDCDCDC, 0xFFF9F9F9, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFCFCFC, 0xFFDFDFDF, 0xFFB2B2B2,
+	0xFF858585, 0xFF636363, 0xFF4D4D4D, 0xFF404040, 0xFF363636, 0xFF2F2F2F, 0xFF292929, 0xFF242424,
+	0xFF212121, 0xFF1D1D1D, 0xFF191919, 0xFF151515, 0xFF101010, 0xFF0C0C0C, 0xFF090909, 0xFF030303,
+	0xFF010101, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF090909, 0xFF141414, 0xFF1A1A1A, 0xFF1D1D1D, 0xFF222222, 0xFF2A2A2A, 0xFF3B3C3B,
+	0xFF535353, 0xFF757575, 0xFFAFAFAF, 0xFFD0D0D0, 0xFFA1A1A1, 0xFF7B7B7B, 0xFF6A6A6A, 0xFF626262,
+	0xFF646464, 0xFF696969, 0xFF515151, 0xFF3B3B3B, 0xFF2B2B2B, 0xFF1D1D1D, 0xFF131313, 0xFF0F0F0F,
+	0xFF0A0A0A, 0xFF0A0A0A, 0xFF0B0B0B, 0xFF0C0C0C, 0xFF111111, 0xFF161616, 0xFF1D1D1D, 0xFF252525,
+	0xFF2E2E2E, 0xFF393939, 0xFF404040, 0xFF4B4B4B, 0xFF595959, 0xFF6E6E6E, 0xFF8F8F8F, 0xFFC2C2C2,
+	0xFFBBBBBB, 0xFF757575, 0xFF4E4E4E, 0xFF3C3C3C, 0xFF303030, 0xFF2A2A2A, 0xFF272727, 0xFF242424,
+	0xFF212121, 0xFF212121, 0xFF212121, 0xFF212121, 0xFF212121, 0xFF232323, 0xFF252525, 0xFF282828,
+	0xFF292929, 0xFF292929, 0xFF2B2B2B, 0xFF2F2F2F, 0xFF333333, 0xFF393939, 0xFF434343, 0xFF565656,
+	0xFF8D8D8D, 0xFFF6F6F6, 0xFFE5E5E5, 0xFF747474, 0xFF404040, 0xFF292929, 0xFF1C1C1C, 0xFF181818,
+	0xFF181818, 0xFF1E1E1E, 0xFF292929, 0xFF424242, 0xFF787878, 0xFFE3E3E3, 0xFFC7C7C7, 0xFF6F6F6F,
+	0xFF3B3B3B, 0xFF2C2C2C, 0xFF1E1E1E, 0xFF0E0E0E, 0xFF060606, 0xFF010101, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF050505, 0xFF0E0E0E, 0xFF1D1D1D, 0xFF383838, 0xFF5E5E5E, 0xFF7D7D7D, 0xFFA7A7A7,
+	0xFFD6D6D6, 0xFFD8D8D8, 0xFFCFCFCF, 0xFFD4D4D4, 0xFFE1E1E1, 0xFFF4F3F4, 0xFFFFFFFF, 0xFFF2F2F2,
+	0xFFD9D9D9, 0xFFB9B9B9, 0xFF969696, 0xFF747474, 0xFF5C5C5C, 0xFF4B4B4B, 0xFF3F3F3F, 0xFF373737,
+	0xFF313131, 0xFF2A2A2A, 0xFF222222, 0xFF1C1C1C, 0xFF161616, 0xFF0F0F0F, 0xFF0A0A0A, 0xFF060606,
+	0xFF010101, 0xFF010101, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF010101,
+	0xFF040404, 0xFF0C0C0C, 0xFF171717, 0xFF1D1D1D, 0xFF222222, 0xFF292929, 0xFF363636, 0xFF4B4B4B,
+	0xFF6C6C6C, 0xFFA7A7A7, 0xFFC6C6C6, 0xFF9B9B9B, 0xFF717171, 0xFF5E5E5E, 0xFF525252, 0xFF4D4D4D,
+	0xFF525252, 0xFF555555, 0xFF444444, 0xFF303030, 0xFF232323, 0xFF181818, 0xFF101010, 0xFF0C0C0C,
+	0xFF070707, 0xFF070707, 0xFF080808, 0xFF090909, 0xFF0D0D0D, 0xFF131313, 0xFF191919, 0xFF212121,
+	0xFF292929, 0xFF323232, 0xFF3A3A3A, 0xFF454545, 0xFF525252, 0xFF666666, 0xFF898989, 0xFFBDBDBD,
+	0xFFA9A9A9, 0xFF6E6E6E, 0xFF4F4F4F, 0xFF3E3E3E, 0xFF323232, 0xFF2D2D2D, 0xFF282828, 0xFF252525,
+	0xFF232323, 0xFF222222, 0xFF222222, 0xFF222222, 0xFF222222, 0xFF222222, 0xFF222222, 0xFF232323,
+	0xFF252525, 0xFF262626, 0xFF272727, 0xFF2A2A2A, 0xFF2F2F2F, 0xFF353535, 0xFF414141, 0xFF585858,
+	0xFF7F7F7F, 0xFFC7C7C7, 0xFFC7C7C7, 0xFF606060, 0xFF353535, 0xFF202020, 0xFF161616, 0xFF121212,
+	0xFF131313, 0xFF171717, 0xFF222222, 0xFF363636, 0xFF616161, 0xFFB2B2B2, 0xFF8F8F8F, 0xFF535353,
+	0xFF313131, 0xFF272727, 0xFF1F1F1F, 0xFF141414, 0xFF090909, 0xFF030303, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF060606, 0xFF0E0E0E, 0xFF1C1C1C, 0xFF353535, 0xFF646464, 0xFF949494, 0xFFCCCCCC,
+	0xFFE4E4E4, 0xFFB3B3B3, 0xFF9F9F9F, 0xFF969696, 0xFF9B9B9B, 0xFFABAAAB, 0xFFC5C5C5, 0xFFD3D3D3,
+	0xFFCBCBCB, 0xFFC4C4C4, 0xFFC2C2C2, 0xFFBEBEBE, 0xFFB0B0B0, 0xFF9A9A9A, 0xFF7C7C7C, 0xFF636363,
+	0xFF525252, 0xFF474747, 0xFF3A3A3A, 0xFF303030, 0xFF252525, 0xFF1B1B1B, 0xFF111111, 0xFF0B0B0B,
+	0xFF030303, 0xFF010101, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF010101,
+	0xFF060606, 0xFF101010, 0xFF1B1B1B, 0xFF202020, 0xFF272727, 0xFF333333, 0xFF454545, 0xFF606060,
+	0xFF9B9B9B, 0xFFBEBEBE, 0xFF919191, 0xFF696969, 0xFF545454, 0xFF484848, 0xFF3F3F3F, 0xFF3E3E3E,
+	0xFF424242, 0xFF474747, 0xFF3A3A3A, 0xFF292929, 0xFF1E1E1E, 0xFF141414, 0xFF0C0C0C, 0xFF0A0A0A,
+	0xFF050505, 0xFF050505, 0xFF060606, 0xFF080808, 0xFF0B0B0B, 0xFF101010, 0xFF161616, 0xFF1E1E1E,
+	0xFF252525, 0xFF2D2D2D, 0xFF383838, 0xFF414141, 0xFF4E4E4E, 0xFF636363, 0xFF868686, 0xFFB9B9B9,
+	0xFFA6A6A6, 0xFF717171, 0xFF565656, 0xFF454545, 0xFF393939, 0xFF333333, 0xFF2E2E2E, 0xFF292929,
+	0xFF272727, 0xFF262626, 0xFF242424, 0xFF252525, 0xFF252525, 0xFF242424, 0xFF242424, 0xFF232323,
+	0xFF262626, 0xFF272727, 0xFF262626, 0xFF272727, 0xFF2B2B2B, 0xFF2E2E2E, 0xFF363636, 0xFF434343,
+	0xFF525252, 0xFF6F6F6F, 0xFF909090, 0xFF585858, 0xFF2D2D2D, 0xFF1A1A1A, 0xFF131313, 0xFF0F0F0F,
+	0xFF0F0F0F, 0xFF131313, 0xFF1C1C1C, 0xFF2F2F2F, 0xFF555555, 0xFF8C8C8C, 0xFF6C6C6C, 0xFF454545,
+	0xFF2D2D2D, 0xFF212121, 0xFF1E1E1E, 0xFF191919, 0xFF0E0E0E, 0xFF050505, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF060606, 0xFF0E0E0E, 0xFF1A1A1A, 0xFF333333, 0xFF616161, 0xFFAEAEAE, 0xFFF3F3F3,
+	0xFFE1E1E1, 0xFFA1A1A1, 0xFF8A8A8A, 0xFF7E7E7E, 0xFF7A7A7A, 0xFF7B7B7B, 0xFF828282, 0xFF939393,
+	0xFFA2A2A2, 0xFF9F9F9F, 0xFF989898, 0xFF9B9B9B, 0xFFAEAEAE, 0xFFCBCBCB, 0xFFE6E6E6, 0xFFE0E0E0,
+	0xFFC1C1C1, 0xFF8D8D8D, 0xFF626162, 0xFF4A494A, 0xFF393939, 0xFF2D2D2D, 0xFF212121, 0xFF191919,
+	0xFF0F0F0F, 0xFF080808, 0xFF030303, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303,
+	0xFF0A0A0A, 0xFF161616, 0xFF1E1E1E, 0xFF252525, 0xFF303030, 0xFF424242, 0xFF5B5B5B, 0xFF8E8E8E,
+	0xFFB4B4B4, 0xFF8D8D8D, 0xFF656565, 0xFF4E4E4E, 0xFF3E3E3E, 0xFF353535, 0xFF303030, 0xFF303030,
+	0xFF343434, 0xFF3A3A3A, 0xFF2F2F2F, 0xFF232323, 0xFF191919, 0xFF121212, 0xFF0C0C0C, 0xFF090909,
+	0xFF050505, 0xFF030303, 0xFF060606, 0xFF080808, 0xFF0A0A0A, 0xFF0F0F0F, 0xFF161616, 0xFF1E1E1E,
+	0xFF252525, 0xFF2D2D2D, 0xFF383838, 0xFF424242, 0xFF505050, 0xFF676767, 0xFF878787, 0xFFBABABA,
+	0xFFB2B2B2, 0xFF848484, 0xFF676767, 0xFF585858, 0xFF4B4B4B, 0xFF424242, 0xFF3B3B3B, 0xFF363636,
+	0xFF333333, 0xFF303030, 0xFF2D2D2D, 0xFF2D2D2D, 0xFF2D2D2D, 0xFF2A2A2A, 0xFF2B2B2B, 0xFF292929,
+	0xFF262626, 0xFF232323, 0xFF1F1F1F, 0xFF1F1F1F, 0xFF1F1F1F, 0xFF1E1E1E, 0xFF202020, 0xFF282828,
+	0xFF323232, 0xFF424242, 0xFF5C5C5C, 0xFF4D4D4D, 0xFF262626, 0xFF161616, 0xFF101010, 0xFF0A0A0A,
+	0xFF0A0A0A, 0xFF0E0E0E, 0xFF161616, 0xFF292929, 0xFF494949, 0xFF707070, 0xFF555555, 0xFF3B3B3B,
+	0xFF2A2A2A, 0xFF1F1F1F, 0xFF1C1C1C, 0xFF1D1D1D, 0xFF131313, 0xFF090909, 0xFF030303, 0xFF020202,
+	0xFF020202, 0xFF050505, 0xFF0D0D0D, 0xFF191919, 0xFF2E2E2E, 0xFF545454, 0xFFADADAD, 0xFFFFFFFF,
+	0xFFEEEEEE, 0xFFAAAAAA, 0xFF8A8A8A, 0xFF7B7B7B, 0xFF717171, 0xFF6C6C6C, 0xFF6B6B6B, 0xFF6D6D6D,
+	0xFF747474, 0xFF7C7C7C, 0xFF7C7C7C, 0xFF777777, 0xFF7C7C7C, 0xFF8A8A8A, 0xFFB4B4B4, 0xFFDCDCDC,
+	0xFFE9E9E9, 0xFFC4C4C4, 0xFF7E7D7E, 0xFF505050, 0xFF3A3A3A, 0xFF2D2D2D, 0xFF232323, 0xFF1E1E1E,
+	0xFF1B1B1B, 0xFF141414, 0xFF0E0E0E, 0xFF080808, 0xFF030303, 0xFF030303, 0xFF030303, 0xFF070707,
+	0xFF0E0E0E, 0xFF1B1B1B, 0xFF232323, 0xFF2E2E2E, 0xFF3F3F3F, 0xFF555555, 0xFF7E7E7E, 0xFFAEAEAE,
+	0xFF909090, 0xFF656565, 0xFF4F4F4F, 0xFF3B3B3B, 0xFF2E2E2E, 0xFF292929, 0xFF272727, 0xFF272727,
+	0xFF2A2A2A, 0xFF323232, 0xFF2D2D2D, 0xFF212121, 0xFF171717, 0xFF111111, 0xFF0B0B0B, 0xFF090909,
+	0xFF050505, 0xFF040404, 0xFF060606, 0xFF080808, 0xFF0A0A0A, 0xFF101010, 0xFF161616, 0xFF1F1F1F,
+	0xFF262626, 0xFF2E2E2E, 0xFF3A3A3A, 0xFF464646, 0xFF555555, 0xFF6E6E6E, 0xFF929292, 0xFFCCCCCC,
+	0xFFCFCFCF, 0xFFA6A6A6, 0xFF888888, 0xFF767676, 0xFF676767, 0xFF5D5D5D, 0xFF545454, 0xFF4C4C4C,
+	0xFF464646, 0xFF444444, 0xFF424242, 0xFF3F3F3F, 0xFF393939, 0xFF323232, 0xFF2C2C2C, 0xFF242424,
+	0xFF1D1D1D, 0xFF191919, 0xFF161616, 0xFF131313, 0xFF121212, 0xFF121212, 0xFF131313, 0xFF191919,
+	0xFF202020, 0xFF292929, 0xFF3A3A3A, 0xFF3F3F3F, 0xFF232323, 0xFF111111, 0xFF0B0B0B, 0xFF070707,
+	0xFF070707, 0xFF0B0B0B, 0xFF121212, 0xFF202020, 0xFF3D3D3D, 0xFF585858, 0xFF464646, 0xFF333333,
+	0xFF252525, 0xFF1E1E1E, 0xFF1D1D1D, 0xFF1D1D1D, 0xFF181818, 0xFF0D0D0D, 0xFF060606, 0xFF020202,
+	0xFF020202, 0xFF060606, 0xFF0D0D0D, 0xFF171717, 0xFF292929, 0xFF4C4C4C, 0xFF8E8E8E, 0xFFF2F2F2,
+	0xFFFBFBFB, 0xFFC8C8C8, 0xFFA4A4A4, 0xFF898989, 0xFF777777, 0xFF6F6F6F, 0xFF6A6A6A, 0xFF646464,
+	0xFF626262, 0xFF626262, 0xFF606060, 0xFF5D5D5D, 0xFF5C5C5C, 0xFF5D5D5D, 0xFF5F5F5F, 0xFF606060,
+	0xFF6C6B6C, 0xFF7F7F7F, 0xFF818181, 0xFF5F5F5F, 0xFF3D3D3D, 0xFF2B2B2B, 0xFF1F1F1F, 0xFF1A1A1A,
+	0xFF171717, 0xFF161616, 0xFF171717, 0xFF121212, 0xFF0C0C0C, 0xFF090909, 0xFF090909, 0xFF0C0C0C,
+	0xFF131313, 0xFF1F1F1F, 0xFF2A2A2A, 0xFF3A3A3A, 0xFF4E4E4E, 0xFF6C6C6C, 0xFFA0A0A0, 0xFFA2A2A2,
+	0xFF6D6D6D, 0xFF515151, 0xFF3E3E3E, 0xFF2E2E2E, 0xFF252525, 0xFF202020, 0xFF1E1E1E, 0xFF1E1E1E,
+	0xFF222222, 0xFF2D2D2D, 0xFF303030, 0xFF242424, 0xFF1A1A1A, 0xFF121212, 0xFF0D0D0D, 0xFF090909,
+	0xFF070707, 0xFF070707, 0xFF080808, 0xFF090909, 0xFF0D0D0D, 0xFF121212, 0xFF1A1A1A, 0xFF252525,
+	0xFF2D2D2D, 0xFF373737, 0xFF424242, 0xFF4F4F4F, 0xFF5E5E5E, 0xFF797979, 0xFFA1A1A1, 0xFFDFDFDF,
+	0xFFF8F8F8, 0xFFE3E3E3, 0xFFCBCBCB, 0xFFB1B1B1, 0xFF9A9A9A, 0xFF8A8A8A, 0xFF7C7C7C, 0xFF747474,
+	0xFF6F6F6F, 0xFF626262, 0xFF525252, 0xFF434343, 0xFF373737, 0xFF2B2B2B, 0xFF222222, 0xFF1B1B1B,
+	0xFF161616, 0xFF121212, 0xFF101010, 0xFF0C0C0C, 0xFF0B0B0B, 0xFF0C0C0C, 0xFF0E0E0E, 0xFF101010,
+	0xFF151515, 0xFF191919, 0xFF242424, 0xFF323232, 0xFF222222, 0xFF0F0F0F, 0xFF090909, 0xFF050505,
+	0xFF040404, 0xFF080808, 0xFF0F0F0F, 0xFF1A1A1A, 0xFF303030, 0xFF494949, 0xFF3E3E3E, 0xFF2F2F2F,
+	0xFF272727, 0xFF1F1F1F, 0xFF1D1D1D, 0xFF1D1D1D, 0xFF1C1C1C, 0xFF121212, 0xFF090909, 0xFF040404,
+	0xFF020202, 0xFF060606, 0xFF0B0B0B, 0xFF141414, 0xFF242424, 0xFF3F3F3F, 0xFF6E6E6E, 0xFFC5C5C5,
+	0xFFD5D5D5, 0xFFB0B0B0, 0xFFACACAC, 0xFFA8A8A8, 0xFF9C9C9C, 0xFF898989, 0xFF767676, 0xFF6B6B6B,
+	0xFF636363, 0xFF595959, 0xFF4F4F4F, 0xFF464646, 0xFF3F3F3F, 0xFF373737, 0xFF333333, 0xFF323232,
+	0xFF303030, 0xFF323232, 0xFF414141, 0xFF4E4E4E, 0xFF434343, 0xFF2C2C2C, 0xFF1E1E1E, 0xFF171717,
+	0xFF131313, 0xFF121212, 0xFF131313, 0xFF141414, 0xFF131313, 0xFF111111, 0xFF111111, 0xFF121212,
+	0xFF181818, 0xFF232323, 0xFF353535, 0xFF474747, 0xFF606060, 0xFF868686, 0xFFB3B3B3, 0xFF8E8E8E,
+	0xFF5E5E5E, 0xFF434343, 0xFF333333, 0xFF272727, 0xFF1D1D1D, 0xFF191919, 0xFF171717, 0xFF181818,
+	0xFF1C1C1C, 0xFF262626, 0xFF333333, 0xFF2A2A2A, 0xFF1D1D1D, 0xFF161616, 0xFF101010, 0xFF0B0B0B,
+	0xFF090909, 0xFF090909, 0xFF080808, 0xFF0C0C0C, 0xFF111111, 0xFF181818, 0xFF212121, 0xFF292929,
+	0xFF323232, 0xFF404040, 0xFF4E4E4E, 0xFF5E5E5E, 0xFF737373, 0xFF919191, 0xFFC5C5C5, 0xFFF8F8F8,
+	0xFFFFFFFF, 0xFFFFFFFF, 0xFFFBFBFB, 0xFFF3F3F3, 0xFFECECEC, 0xFFDEDEDE, 0xFFD0D0D0, 0xFFB7B7B7,
+	0xFF8C8C8C, 0xFF636363, 0xFF484848, 0xFF3A3A3A, 0xFF2F2F2F, 0xFF242424, 0xFF1C1C1C, 0xFF161616,
+	0xFF121212, 0xFF0F0F0F, 0xFF0B0B0B, 0xFF090909, 0xFF080808, 0xFF080808, 0xFF080808, 0xFF0A0A0A,
+	0xFF0F0F0F, 0xFF131313, 0xFF1A1A1A, 0xFF272727, 0xFF202020, 0xFF0E0E0E, 0xFF070707, 0xFF020202,
+	0xFF010101, 0xFF040404, 0xFF0C0C0C, 0xFF141414, 0xFF242424, 0xFF3B3B3B, 0xFF3A3A3A, 0xFF2E2E2E,
+	0xFF282828, 0xFF222222, 0xFF212121, 0xFF1F1F1F, 0xFF1D1D1D, 0xFF151515, 0xFF0A0A0A, 0xFF050505,
+	0xFF030303, 0xFF030303, 0xFF080808, 0xFF0F0F0F, 0xFF1B1B1B, 0xFF313131, 0xFF545454, 0xFF8D8D8D,
+	0xFFA2A2A2, 0xFF848484, 0xFF808080, 0xFF8C8C8C, 0xFFAAAAAA, 0xFFBDBDBD, 0xFFACACAC, 0xFF8A8A8A,
+	0xFF747474, 0xFF626262, 0xFF505050, 0xFF404040, 0xFF343434, 0xFF292929, 0xFF212121, 0xFF1D1D1D,
+	0xFF191919, 0xFF191919, 0xFF1C1C1C, 0xFF212121, 0xFF2E2E2E, 0xFF2E2E2E, 0xFF202020, 0xFF161616,
+	0xFF111111, 0xFF101010, 0xFF101010, 0xFF111111, 0xFF141414, 0xFF161616, 0xFF181818, 0xFF1A1A1A,
+	0xFF1D1D1D, 0xFF292929, 0xFF3C3C3C, 0xFF515151, 0xFF6D6D6D, 0xFF939393, 0xFFB8B8B8, 0xFF8A8A8A,
+	0xFF595959, 0xFF3E3E3E, 0xFF2D2D2D, 0xFF212121, 0xFF171717, 0xFF141414, 0xFF111111, 0xFF131313,
+	0xFF171717, 0xFF1F1F1F, 0xFF323232, 0xFF3A3A3A, 0xFF2B2B2B, 0xFF1E1E1E, 0xFF161616, 0xFF0F0F0F,
+	0xFF0C0C0C, 0xFF0C0C0C, 0xFF0D0D0D, 0xFF121212, 0xFF161616, 0xFF1D1D1D, 0xFF202020, 0xFF232323,
+	0xFF292929, 0xFF353535, 0xFF4B4B4B, 0xFF686768, 0xFF8B8B8B, 0xFFBABABA, 0xFFF1F0F1, 0xFFFFFFFF,
+	0xFFFFFFFF, 0xFFF9F9F9, 0xFFEAEAEA, 0xFFF1F1F1, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFEFEFE, 0xFFBBBBBB,
+	0xFF7B7B7B, 0xFF565656, 0xFF3F3F3F, 0xFF323232, 0xFF262626, 0xFF1F1F1F, 0xFF181818, 0xFF131313,
+	0xFF0F0F0F, 0xFF0C0C0C, 0xFF090909, 0xFF090909, 0xFF090909, 0xFF080808, 0xFF080808, 0xFF090909,
+	0xFF0C0C0C, 0xFF111111, 0xFF161616, 0xFF1F1F1F, 0xFF202020, 0xFF111111, 0xFF070707, 0xFF020202,
+	0xFF020202, 0xFF010101, 0xFF060606, 0xFF0F0F0F, 0xFF1A1A1A, 0xFF2C2C2C, 0xFF3C3C3C, 0xFF323232,
+	0xFF2F2F2F, 0xFF272727, 0xFF252525, 0xFF232323, 0xFF212121, 0xFF181818, 0xFF0B0B0B, 0xFF070707,
+	0xFF040404, 0xFF030303, 0xFF070707, 0xFF0E0E0E, 0xFF181818, 0xFF292929, 0xFF414141, 0xFF646464,
+	0xFF7D7D7D, 0xFF6D6D6D, 0xFF656565, 0xFF686868, 0xFF7B7B7B, 0xFFA9A9A9, 0xFFE8E8E8, 0xFFDCDCDC,
+	0xFFA5A5A5, 0xFF7C7C7C, 0xFF5B5B5B, 0xFF424242, 0xFF303030, 0xFF232323, 0xFF181818, 0xFF131313,
+	0xFF0E0E0E, 0xFF0D0D0D, 0xFF0E0E0E, 0xFF101010, 0xFF171717, 0xFF222222, 0xFF212121, 0xFF161616,
+	0xFF111111, 0xFF0E0E0E, 0xFF0F0F0F, 0xFF0F0F0F, 0xFF131313, 0xFF151515, 0xFF1A1A1A, 0xFF1E1E1E,
+	0xFF222222, 0xFF2C2C2C, 0xFF3E3E3E, 0xFF575757, 0xFF737373, 0xFF919191, 0xFFADADAD, 0xFF8D8D8D,
+	0xFF5A5A5A, 0xFF3D3D3D, 0xFF2A2A2A, 0xFF1F1F1F, 0xFF151515, 0xFF121212, 0xFF0E0E0E, 0xFF101010,
+	0xFF141414, 0xFF1A1A1A, 0xFF2C2C2C, 0xFF474747, 0xFF424242, 0xFF2B2B2B, 0xFF1F1F1F, 0xFF171717,
+	0xFF111111, 0xFF111111, 0xFF121212, 0xFF171717, 0xFF1D1D1D, 0xFF1C1C1C, 0xFF1B1B1B, 0xFF1E1E1E,
+	0xFF222222, 0xFF2E2E2E, 0xFF3F3F3F, 0xFF595959, 0xFF858585, 0xFFC7C7C7, 0xFFFDFDFD, 0xFFFFFFFF,
+	0xFFF9F9F9, 0xFFE0E0E0, 0xFFD1D1D1, 0xFFD4D4D4, 0xFFDEDEDE, 0xFFE6E6E6, 0xFFE2E2E2, 0xFFA6A6A6,
+	0xFF6D6D6D, 0xFF4D4D4D, 0xFF373737, 0xFF2C2C2C, 0xFF222222, 0xFF1B1B1B, 0xFF171717, 0xFF121212,
+	0xFF0F0F0F, 0xFF0B0B0B, 0xFF080808, 0xFF090909, 0xFF090909, 0xFF080808, 0xFF090909, 0xFF0A0A0A,
+	0xFF0A0A0A, 0xFF101010, 0xFF141414, 0xFF1D1D1D, 0xFF222222, 0xFF131313, 0xFF090909, 0xFF020202,
+	0xFF020202, 0xFF010101, 0xFF030303, 0xFF0A0A0A, 0xFF111111, 0xFF1F1F1F, 0xFF353535, 0xFF3B3B3B,
+	0xFF3F3F3F, 0xFF353535, 0xFF2D2D2D, 0xFF282828, 0xFF272727, 0xFF1C1C1C, 0xFF0D0D0D, 0xFF080808,
+	0xFF030303, 0xFF030303, 0xFF060606, 0xFF0B0B0B, 0xFF141414, 0xFF202020, 0xFF313131, 0xFF484848,
+	0xFF5C5C5C, 0xFF555555, 0xFF4E4E4E, 0xFF515151, 0xFF5B5B5B, 0xFF767676, 0xFFB4B4B4, 0xFFFDFDFD,
+	0xFFF7F7F7, 0xFFAEAEAE, 0xFF727272, 0xFF515151, 0xFF363636, 0xFF242424, 0xFF161616, 0xFF0F0F0F,
+	0xFF0A0A0A, 0xFF080808, 0xFF080808, 0xFF090909, 0xFF0C0C0C, 0xFF121212, 0xFF1A1A1A, 0xFF161616,
+	0xFF111111, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF0E0E0E, 0xFF111111, 0xFF151515, 0xFF1B1B1B, 0xFF202020,
+	0xFF252525, 0xFF2C2C2C, 0xFF3C3C3C, 0xFF565656, 0xFF6E6E6E, 0xFF7D7D7D, 0xFF8A8A8A, 0xFF888888,
+	0xFF646464, 0xFF414141, 0xFF2C2C2C, 0xFF1E1E1E, 0xFF151515, 0xFF121212, 0xFF0E0E0E, 0xFF0F0F0F,
+	0xFF131313, 0xFF1A1A1A, 0xFF2A2A2A, 0xFF484848, 0xFF676767, 0xFF494949, 0xFF303030, 0xFF252525,
+	0xFF1E1E1E, 0xFF1B1B1B, 0xFF1B1B1B, 0xFF1F1F1F, 0xFF1D1D1D, 0xFF181818, 0xFF181818, 0xFF1B1B1B,
+	0xFF1E1E1E, 0xFF2B2B2B, 0xFF3B3B3B, 0xFF555555, 0xFF7B7B7B, 0xFFC4C4C4, 0xFFFFFFFF, 0xFFF3F3F3,
+	0xFFD6D6D6, 0xFFBFBFBF, 0xFFAEAEAE, 0xFFA4A4A4, 0xFFA4A4A4, 0xFFA5A5A5, 0xFFA5A5A5, 0xFF8D8D8D,
+	0xFF626262, 0xFF444444, 0xFF323232, 0xFF2A2A2A, 0xFF202020, 0xFF1B1B1B, 0xFF171717, 0xFF131313,
+	0xFF101010, 0xFF0D0D0D, 0xFF0B0B0B, 0xFF0A0A0A, 0xFF0A0A0A, 0xFF0B0B0B, 0xFF0C0C0C, 0xFF0C0C0C,
+	0xFF0D0D0D, 0xFF131313, 0xFF171717, 0xFF222222, 0xFF282828, 0xFF181818, 0xFF0C0C0C, 0xFF050505,
+	0xFF020202, 0xFF020202, 0xFF010101, 0xFF050505, 0xFF0B0B0B, 0xFF151515, 0xFF262626, 0xFF3E3E3E,
+	0xFF4E4E4E, 0xFF484848, 0xFF3B3B3B, 0xFF333333, 0xFF313131, 0xFF222222, 0xFF0E0E0E, 0xFF080808,
+	0xFF040404, 0xFF030303, 0xFF060606, 0xFF090909, 0xFF101010, 0xFF191919, 0xFF252525, 0xFF333333,
+	0xFF434343, 0xFF424242, 0xFF3C3C3C, 0xFF3D3D3D, 0xFF444444, 0xFF575757, 0xFF797979, 0xFFB4B4B4,
+	0xFFF0F0F0, 0xFFEEEEEE, 0xFF9E9E9E, 0xFF686868, 0xFF424242, 0xFF292929, 0xFF181818, 0xFF0F0F0F,
+	0xFF0A0A0A, 0xFF080808, 0xFF070707, 0xFF070707, 0xFF080808, 0xFF0D0D0D, 0xFF131313, 0xFF151515,
+	0xFF111111, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF101010, 0xFF141414, 0xFF1B1B1B, 0xFF212121,
+	0xFF252525, 0xFF2A2A2A, 0xFF383838, 0xFF4E4E4E, 0xFF5D5D5D, 0xFF636363, 0xFF636363, 0xFF5F5F5F,
+	0xFF555555, 0xFF424242, 0xFF313131, 0xFF212121, 0xFF151515, 0xFF121212, 0xFF101010, 0xFF0E0E0E,
+	0xFF121212, 0xFF1A1A1A, 0xFF292929, 0xFF484848, 0xFF8A8A8A, 0xFF939393, 0xFF575757, 0xFF3F3F3F,
+	0xFF323232, 0xFF2D2D2D, 0xFF2A2A2A, 0xFF242424, 0xFF1C1C1C, 0xFF181818, 0xFF181818, 0xFF1A1A1A,
+	0xFF1E1E1E, 0xFF292929, 0xFF3A3A3A, 0xFF535353, 0xFF7B7B7B, 0xFFC5C5C5, 0xFFE1E1E1, 0xFFC1C1C1,
+	0xFFB2B2B2, 0xFFABAAAB, 0xFF979797, 0xFF8C8C8C, 0xFF878787, 0xFF838383, 0xFF7A7A7A, 0xFF717171,
+	0xFF575757, 0xFF3D3D3D, 0xFF2D2D2D, 0xFF242424, 0xFF1D1D1D, 0xFF1B1B1B, 0xFF171717, 0xFF141414,
+	0xFF121212, 0xFF111111, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF0F0F0F, 0xFF111111,
+	0xFF121212, 0xFF171717, 0xFF1E1E1E, 0xFF282828, 0xFF333333, 0xFF232323, 0xFF121212, 0xFF090909,
+	0xFF030303, 0xFF020202, 0xFF010101, 0xFF030303, 0xFF090909, 0xFF101010, 0xFF1E1E1E, 0xFF343434,
+	0xFF515151, 0xFF686868, 0xFF545454, 0xFF494949, 0xFF3E3E3E, 0xFF262626, 0xFF131313, 0xFF0B0B0B,
+	0xFF060606, 0xFF040404, 0xFF060606, 0xFF0A0A0A, 0xFF0D0D0D, 0xFF161616, 0xFF1F1F1F, 0xFF292929,
+	0xFF333333, 0xFF343434, 0xFF2E2E2E, 0xFF2E2E2E, 0xFF333333, 0xFF3F3F3F, 0xFF535353, 0xFF666566,
+	0xFF8F8F8F, 0xFFDEDEDE, 0xFFE9E9E9, 0xFF9C9C9C, 0xFF606060, 0xFF373737, 0xFF212121, 0xFF131313,
+	0xFF0E0E0E, 0xFF0A0A0A, 0xFF070707, 0xFF070707, 0xFF080808, 0xFF0D0D0D, 0xFF121212, 0xFF141414,
+	0xFF101010, 0xFF0C0C0C, 0xFF0C0C0C, 0xFF0D0D0D, 0xFF101010, 0xFF121212, 0xFF171717, 0xFF1F1F1F,
+	0xFF242424, 0xFF282828, 0xFF313131, 0xFF424242, 0xFF4B4B4B, 0xFF4A4A4A, 0xFF444444, 0xFF3E3E3E,
+	0xFF343434, 0xFF2A2A2A, 0xFF252525, 0xFF1C1C1C, 0xFF161616, 0xFF111111, 0xFF111111, 0xFF101010,
+	0xFF141414, 0xFF1C1C1C, 0xFF2C2C2C, 0xFF4C4C4C, 0xFF949494, 0xFFF0F0F0, 0xFFB6B6B6, 0xFF6A6A6A,
+	0xFF4A4A4A, 0xFF383838, 0xFF2B2B2B, 0xFF232323, 0xFF1C1C1C, 0xFF191919, 0xFF191919, 0xFF1D1D1D,
+	0xFF212121, 0xFF2C2C2C, 0xFF3D3D3D, 0xFF555555, 0xFF828282, 0xFFB7B7B7, 0xFFACACAC, 0xFF979797,
+	0xFF969696, 0xFF9D9D9D, 0xFF919191, 0xFF828282, 0xFF7A7A7A, 0xFF747474, 0xFF686868, 0xFF5D5D5D,
+	0xFF494949, 0xFF363636, 0xFF2A2A2A, 0xFF222222, 0xFF1F1F1F, 0xFF1D1D1D, 0xFF1A1A1A, 0xFF181818,
+	0xFF171717, 0xFF171717, 0xFF161616, 0xFF151515, 0xFF151515, 0xFF151515, 0xFF161616, 0xFF181818,
+	0xFF1C1C1C, 0xFF232323, 0xFF292929, 0xFF373737, 0xFF474747, 0xFF323232, 0xFF181818, 0xFF0C0C0C,
+	0xFF070707, 0xFF030303, 0xFF010101, 0xFF030303, 0xFF0B0B0B, 0xFF101010, 0xFF1B1B1B, 0xFF2F2F2F,
+	0xFF505050, 0xFF8A8A8A, 0xFF818181, 0xFF696969, 0xFF4D4D4D, 0xFF272727, 0xFF171717, 0xFF0E0E0E,
+	0xFF080808, 0xFF060606, 0xFF070707, 0xFF0A0A0A, 0xFF0C0C0C, 0xFF121212, 0xFF1B1B1B, 0xFF222222,
+	0xFF282828, 0xFF282828, 0xFF242424, 0xFF212121, 0xFF252525, 0xFF2D2D2D, 0xFF373637, 0xFF434343,
+	0xFF545454, 0xFF7F7F7F, 0xFFD9D9D9, 0xFFF4F4F4, 0xFFA2A2A2, 0xFF545454, 0xFF313131, 0xFF1D1D1D,
+	0xFF131313, 0xFF0E0E0E, 0xFF0A0A0A, 0xFF0A0A0A, 0xFF0A0A0A, 0xFF0E0E0E, 0xFF141414, 0xFF141414,
+	0xFF0F0F0F, 0xFF0C0C0C, 0xFF0B0B0B, 0xFF0D0D0D, 0xFF101010, 0xFF101010, 0xFF141414, 0xFF1C1C1C,
+	0xFF222222, 0xFF252525, 0xFF2A2A2A, 0xFF373737, 0xFF393939, 0xFF373737, 0xFF313131, 0xFF292929,
+	0xFF202020, 0xFF171717, 0xFF131313, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF111111,
+	0xFF161616, 0xFF1D1D1D, 0xFF2C2C2C, 0xFF444444, 0xFF6F6F6F, 0xFFC5C5C5, 0xFFD7D7D7, 0xFF7C7C7C,
+	0xFF4F4F4F, 0xFF3A3A3A, 0xFF2D2D2D, 0xFF242424, 0xFF1E1E1E, 0xFF1C1C1C, 0xFF1A1A1A, 0xFF202020,
+	0xFF262626, 0xFF313131, 0xFF424242, 0xFF5B5B5B, 0xFF868686, 0xFF969696, 0xFF848484, 0xFF7F7F7F,
+	0xFF838383, 0xFF949494, 0xFF919191, 0xFF818181, 0xFF767676, 0xFF6C6C6C, 0xFF5F5F5F, 0xFF525252,
+	0xFF404040, 0xFF2F2F2F, 0xFF272727, 0xFF212121, 0xFF202020, 0xFF202020, 0xFF1D1D1D, 0xFF1E1E1E,
+	0xFF1F1F1F, 0xFF1F1F1F, 0xFF1E1E1E, 0xFF1E1E1E, 0xFF1E1E1E, 0xFF1E1E1E, 0xFF1F1F1F, 0xFF222222,
+	0xFF272727, 0xFF2E2E2E, 0xFF383838, 0xFF4A4A4A, 0xFF656565, 0xFF4C4C4C, 0xFF252525, 0xFF141414,
+	0xFF0C0C0C, 0xFF060606, 0xFF040404, 0xFF060606, 0xFF0B0B0B, 0xFF131313, 0xFF1D1D1D, 0xFF313131,
+	0xFF606060, 0xFFB7B7B7, 0xFFD8D8D8, 0xFF929292, 0xFF4D4D4D, 0xFF282828, 0xFF191919, 0xFF0F0F0F,
+	0xFF090909, 0xFF080808, 0xFF090909, 0xFF0A0A0A, 0xFF0D0D0D, 0xFF121212, 0xFF171717, 0xFF1D1D1D,
+	0xFF202020, 0xFF212121, 0xFF1B1B1B, 0xFF181818, 0xFF1B1B1B, 0xFF1F1F1F, 0xFF252525, 0xFF2D2D2D,
+	0xFF393939, 0xFF4B4B4B, 0xFF7C7C7C, 0xFFDEDEDE, 0xFFF8F8F8, 0xFF9B9B9B, 0xFF525252, 0xFF333333,
+	0xFF202020, 0xFF181818, 0xFF131313, 0xFF131313, 0xFF141414, 0xFF171717, 0xFF181818, 0xFF141414,
+	0xFF0E0E0E, 0xFF0B0B0B, 0xFF0A0A0A, 0xFF0C0C0C, 0xFF0F0F0F, 0xFF101010, 0xFF131313, 0xFF191919,
+	0xFF1F1F1F, 0xFF232323, 0xFF252525, 0xFF2C2C2C, 0xFF2B2B2B, 0xFF282828, 0xFF222222, 0xFF1B1B1B,
+	0xFF141414, 0xFF0E0E0E, 0xFF080808, 0xFF040404, 0xFF030303, 0xFF040404, 0xFF040404, 0xFF060606,
+	0xFF0B0B0B, 0xFF111111, 0xFF1A1A1A, 0xFF262626, 0xFF3A3A3A, 0xFF5D5D5D, 0xFF979797, 0xFF858585,
+	0xFF555555, 0xFF414141, 0xFF353535, 0xFF2A2A2A, 0xFF242424, 0xFF222222, 0xFF202020, 0xFF252525,
+	0xFF2C2C2C, 0xFF373737, 0xFF484848, 0xFF656565, 0xFF7B7B7B, 0xFF707070, 0xFF6A6A6A, 0xFF6C6C6C,
+	0xFF767676, 0xFF929292, 0xFF989898, 0xFF858585, 0xFF767676, 0xFF6A6A6A, 0xFF5C5C5C, 0xFF494949,
+	0xFF373737, 0xFF2A2A2A, 0xFF252525, 0xFF222222, 0xFF222222, 0xFF222222, 0xFF232323, 0xFF262626,
+	0xFF2A2A2A, 0xFF2C2C2C, 0xFF2C2C2C, 0xFF2D2D2D, 0xFF2E2E2E, 0xFF2E2E2E, 0xFF303030, 0xFF343434,
+	0xFF393939, 0xFF404040, 0xFF525252, 0xFF6C6C6C, 0xFF9E9E9E, 0xFF858585, 0xFF3F3F3F, 0xFF262626,
+	0xFF161616, 0xFF0F0F0F, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF101010, 0xFF1B1B1B, 0xFF262626, 0xFF3C3C3C,
+	0xFF888888, 0xFFE2E2E2, 0xFFF4F4F4, 0xFF878787, 0xFF464646, 0xFF2B2B2B, 0xFF191919, 0xFF0F0F0F,
+	0xFF0A0A0A, 0xFF080808, 0xFF090909, 0xFF0A0A0A, 0xFF0E0E0E, 0xFF121212, 0xFF151515, 0xFF1A1A1A,
+	0xFF1D1D1D, 0xFF1C1C1C, 0xFF161616, 0xFF131313, 0xFF131313, 0xFF161616, 0xFF1B1B1B, 0xFF212121,
+	0xFF292929, 0xFF373737, 0xFF505050, 0xFF848484, 0xFFC6C6C6, 0xFFD3D3D3, 0xFF959595, 0xFF5A5A5A,
+	0xFF3A3A3A, 0xFF2C2C2C, 0xFF252525, 0xFF242424, 0xFF262626, 0xFF222222, 0xFF1B1B1B, 0xFF141414,
+	0xFF0E0E0E, 0xFF0C0C0C, 0xFF0B0B0B, 0xFF0C0C0C, 0xFF0E0E0E, 0xFF101010, 0xFF141414, 0xFF161616,
+	0xFF1B1B1B, 0xFF1F1F1F, 0xFF222222, 0xFF232323, 0xFF222222, 0xFF1F1F1F, 0xFF191919, 0xFF131313,
+	0xFF0D0D0D, 0xFF090909, 0xFF040404, 0xFF010101, 0xFF010101, 0xFF010101, 0xFF010101, 0xFF020202,
+	0xFF040404, 0xFF0B0B0B, 0xFF0F0F0F, 0xFF181818, 0xFF262626, 0xFF393939, 0xFF595959, 0xFF7A7A7A,
+	0xFF636363, 0xFF494949, 0xFF3C3C3C, 0xFF323232, 0xFF2B2B2B, 0xFF2A2A2A, 0xFF292929, 0xFF2F2F2F,
+	0xFF353535, 0xFF414141, 0xFF545454, 0xFF646464, 0xFF606060, 0xFF5A5A5A, 0xFF595959, 0xFF616161,
+	0xFF727272, 0xFF989898, 0xFFA3A3A3, 0xFF8B8B8B, 0xFF7A7A7A, 0xFF6B6B6B, 0xFF545454, 0xFF3C3C3C,
+	0xFF2F2F2F, 0xFF282828, 0xFF242424, 0xFF232323, 0xFF242424, 0xFF272727, 0xFF2B2B2B, 0xFF323232,
+	0xFF393939, 0xFF3B3B3B, 0xFF3E3E3E, 0xFF404040, 0xFF404040, 0xFF434343, 0xFF404040, 0xFF3E3E3E,
+	0xFF404040, 0xFF464646, 0xFF5A5A5A, 0xFF818181, 0xFFD0D0D0, 0xFFE6E6E6, 0xFF828282, 0xFF484748,
+	0xFF303030, 0xFF202020, 0xFF1C1C1C, 0xFF1A1A1A, 0xFF202020, 0xFF2B2B2B, 0xFF3C3C3C, 0xFF5B5B5B,
+	0xFF808080, 0xFFB8B8B8, 0xFFB9B9B9, 0xFF676767, 0xFF3F3F3F, 0xFF292929, 0xFF191919, 0xFF111111,
+	0xFF0D0D0D, 0xFF0B0B0B, 0xFF0B0B0B, 0xFF0C0C0C, 0xFF0F0F0F, 0xFF111111, 0xFF151515, 0xFF181818,
+	0xFF1A1A1A, 0xFF191919, 0xFF141414, 0xFF111111, 0xFF101010, 0xFF101010, 0xFF151515, 0xFF1B1B1B,
+	0xFF212121, 0xFF292929, 0xFF383838, 0xFF505050, 0xFF676767, 0xFF818181, 0xFF919191, 0xFF818181,
+	0xFF636363, 0xFF4E4E4E, 0xFF424242, 0xFF393939, 0xFF323232, 0xFF262626, 0xFF1B1B1B, 0xFF151515,
+	0xFF111111, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF0F0F0F, 0xFF0F0F0F, 0xFF111111, 0xFF141414, 0xFF151515,
+	0xFF191919, 0xFF1B1B1B, 0xFF1E1E1E, 0xFF1F1F1F, 0xFF1D1D1D, 0xFF1C1C1C, 0xFF161616, 0xFF121212,
+	0xFF0C0C0C, 0xFF080808, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303,
+	0xFF030303, 0xFF070707, 0xFF0C0C0C, 0xFF101010, 0xFF191919, 0xFF272727, 0xFF373737, 0xFF4E4E4E,
+	0xFF636363, 0xFF5A5A5A, 0xFF4B4B4B, 0xFF404040, 0xFF393939, 0xFF373737, 0xFF393939, 0xFF3F3F3F,
+	0xFF444444, 0xFF4D4D4D, 0xFF545454, 0xFF4F4F4F, 0xFF4B4B4B, 0xFF4E4D4E, 0xFF505050, 0xFF5B5B5B,
+	0xFF747474, 0xFFA9A9A9, 0xFFB9B9B9, 0xFF9A9A9A, 0xFF848484, 0xFF646464, 0xFF424242, 0xFF313131,
+	0xFF282828, 0xFF232323, 0xFF232323, 0xFF222222, 0xFF272727, 0xFF2E2E2E, 0xFF373737, 0xFF424242,
+	0xFF4B4B4B, 0xFF535353, 0xFF585858, 0xFF5A5A5A, 0xFF5B5A5B, 0xFF4E4E4E, 0xFF3F3F3F, 0xFF373737,
+	0xFF333333, 0xFF353535, 0xFF3F3F3F, 0xFF565656, 0xFF8E8E8E, 0xFFE6E6E6, 0xFFC7C7C7, 0xFF7A7A7A,
+	0xFF545454, 0xFF404040, 0xFF363736, 0xFF323232, 0xFF353535, 0xFF3C3C3C, 0xFF494949, 0xFF616161,
+	0xFF5D5D5D, 0xFF828282, 0xFF7D7D7D, 0xFF4F4F4F, 0xFF353535, 0xFF252525, 0xFF191919, 0xFF111111,
+	0xFF0F0F0F, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF0E0E0E, 0xFF111111, 0xFF141414, 0xFF151515,
+	0xFF171717, 0xFF171717, 0xFF121212, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF101010, 0xFF141414,
+	0xFF191919, 0xFF202020, 0xFF2A2A2A, 0xFF363636, 0xFF404040, 0xFF4A4A4A, 0xFF515151, 0xFF585858,
+	0xFF565656, 0xFF4F4F4F, 0xFF444444, 0xFF383838, 0xFF2D2D2D, 0xFF262626, 0xFF1E1E1E, 0xFF181818,
+	0xFF151515, 0xFF121212, 0xFF121212, 0xFF121212, 0xFF121212, 0xFF121212, 0xFF151515, 0xFF191919,
+	0xFF191919, 0xFF191919, 0xFF1A1A1A, 0xFF1F1F1F, 0xFF1D1D1D, 0xFF1B1B1B, 0xFF161616, 0xFF121212,
+	0xFF0D0D0D, 0xFF090909, 0xFF050505, 0xFF030303, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303,
+	0xFF040404, 0xFF060606, 0xFF0B0B0B, 0xFF0F0F0F, 0xFF151515, 0xFF1D1D1D, 0xFF262626, 0xFF313131,
+	0xFF404040, 0xFF515051, 0xFF555555, 0xFF505050, 0xFF4D4D4D, 0xFF494949, 0xFF4A4A4A, 0xFF4B4B4B,
+	0xFF494949, 0xFF444444, 0xFF434343, 0xFF414141, 0xFF424342, 0xFF474747, 0xFF4E4E4E, 0xFF5E5E5E,
+	0xFF808080, 0xFFCBCBCB, 0xFFD9D9D9, 0xFFACACAC, 0xFF787878, 0xFF4D4D4D, 0xFF353535, 0xFF2A2A2A,
+	0xFF232323, 0xFF202020, 0xFF212121, 0xFF242424, 0xFF2B2B2B, 0xFF373737, 0xFF434343, 0xFF535353,
+	0xFF636363, 0xFF727272, 0xFF7E7E7E, 0xFF7C7C7C, 0xFF606060, 0xFF474747, 0xFF373737, 0xFF2F2F2F,
+	0xFF292929, 0xFF292929, 0xFF2C2C2C, 0xFF383838, 0xFF494949, 0xFF7C7C7C, 0xFF9F9F9F, 0xFF737373,
+	0xFF545454, 0xFF414141, 0xFF373737, 0xFF323232, 0xFF303030, 0xFF323232, 0xFF3B3B3B, 0xFF494949,
+	0xFF535353, 0xFF676767, 0xFF545454, 0xFF3C3C3C, 0xFF2B2B2B, 0xFF202020, 0xFF181818, 0xFF111111,
+	0xFF0F0F0F, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF0F0F0F, 0xFF121212, 0xFF141414, 0xFF141414,
+	0xFF151515, 0xFF151515, 0xFF121212, 0xFF0E0E0E, 0xFF0F0F0F, 0xFF101010, 0xFF0F0F0F, 0xFF101010,
+	0xFF131313, 0xFF191919, 0xFF202020, 0xFF282828, 0xFF2D2D2D, 0xFF333333, 0xFF383838, 0xFF393939,
+	0xFF383838, 0xFF383838, 0xFF353535, 0xFF313131, 0xFF2B2B2B, 0xFF282828, 0xFF252525, 0xFF212121,
+	0xFF1D1D1D, 0xFF1A1A1A, 0xFF1A1A1A, 0xFF1A1A1A, 0xFF1A1A1A, 0xFF1B1B1B, 0xFF1C1C1C, 0xFF1C1C1C,
+	0xFF181818, 0xFF161616, 0xFF1A1A1A, 0xFF1F1F1F, 0xFF212121, 0xFF1F1F1F, 0xFF1B1B1B, 0xFF151515,
+	0xFF111111, 0xFF0D0D0D, 0xFF0A0A0A, 0xFF090909, 0xFF060606, 0xFF040404, 0xFF050505, 0xFF060606,
+	0xFF080808, 0xFF090909, 0xFF0D0D0D, 0xFF101010, 0xFF141414, 0xFF1A1A1A, 0xFF1F1F1F, 0xFF272727,
+	0xFF2B2B2B, 0xFF313131, 0xFF3A3A3A, 0xFF404040, 0xFF404040, 0xFF404040, 0xFF404040, 0xFF3E3E3E,
+	0xFF3D3D3D, 0xFF3B3B3B, 0xFF3B3B3B, 0xFF3D3D3D, 0xFF3F3F3F, 0xFF454545, 0xFF515151, 0xFF696969,
+	0xFF9D9D9D, 0xFFF4F4F4, 0xFFEFEFEF, 0xFF989898, 0xFF585858, 0xFF383838, 0xFF292929, 0xFF212121,
+	0xFF1F1F1F, 0xFF1D1D1D, 0xFF202020, 0xFF252525, 0xFF303030, 0xFF414141, 0xFF545454, 0xFF6B6B6B,
+	0xFF848484, 0xFF9F9F9F, 0xFFA3A3A3, 0xFF7B7B7B, 0xFF555555, 0xFF434343, 0xFF333333, 0xFF2B2B2B,
+	0xFF232323, 0xFF212121, 0xFF202020, 0xFF272727, 0xFF313131, 0xFF404040, 0xFF616161, 0xFF6B6B6B,
+	0xFF525252, 0xFF3E3E3E, 0xFF333333, 0xFF2F2F2F, 0xFF2E2E2E, 0xFF2F2F2F, 0xFF363636, 0xFF434343,
+	0xFF4E4E4E, 0xFF4C4C4C, 0xFF3D3D3D, 0xFF313131, 0xFF262626, 0xFF1E1E1E, 0xFF171717, 0xFF131313,
+	0xFF111111, 0xFF0E0E0E, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF101010, 0xFF131313, 0xFF141414, 0xFF141414,
+	0xFF141414, 0xFF141414, 0xFF121212, 0xFF101010, 0xFF111111, 0xFF111111, 0xFF101010, 0xFF0F0F0F,
+	0xFF111111, 0xFF171717, 0xFF1B1B1B, 0xFF202020, 0xFF252525, 0xFF2A2A2A, 0xFF2B2B2B, 0xFF2C2C2C,
+	0xFF2E2E2E, 0xFF2F2F2F, 0xFF303030, 0xFF303030, 0xFF2E2E2E, 0xFF2D2D2D, 0xFF2B2B2B, 0xFF292929,
+	0xFF272727, 0xFF262626, 0xFF252525, 0xFF272727, 0xFF292929, 0xFF272727, 0xFF212121, 0xFF1B1B1B,
+	0xFF191919, 0xFF181818, 0xFF1A1A1A, 0xFF202020, 0xFF262626, 0xFF262626, 0xFF232323, 0xFF1E1E1E,
+	0xFF1A1A1A, 0xFF161616, 0xFF131313, 0xFF0F0F0F, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF0D0D0D,
+	0xFF0E0E0E, 0xFF111111, 0xFF121212, 0xFF131313, 0xFF151515, 0xFF171717, 0xFF1B1B1B, 0xFF202020,
+	0xFF222222, 0xFF252525, 0xFF2A2A2A, 0xFF2E2E2E, 0xFF313131, 0xFF333333, 0xFF363636, 0xFF383838,
+	0xFF3A3A3A, 0xFF3A3A3A, 0xFF3C3C3C, 0xFF3F3F3F, 0xFF434343, 0xFF4C4C4C, 0xFF5E5E5E, 0xFF848484,
+	0xFFD2D2D2, 0xFFFFFFFF, 0xFFC1C1C1, 0xFF676767, 0xFF414141, 0xFF2D2D2D, 0xFF202020, 0xFF1B1B1B,
+	0xFF191919, 0xFF1B1B1B, 0xFF1E1E1E, 0xFF262626, 0xFF363636, 0xFF4A4A4A, 0xFF656565, 0xFF858585,
+	0xFFADADAD, 0xFFCECECE, 0xFFA7A7A7, 0xFF6E6E6E, 0xFF525152, 0xFF404040, 0xFF313131, 0xFF292929,
+	0xFF202020, 0xFF1D1D1D, 0xFF1C1C1C, 0xFF1D1D1D, 0xFF222222, 0xFF2A2A2A, 0xFF343434, 0xFF484848,
+	0xFF505050, 0xFF444444, 0xFF373737, 0xFF313131, 0xFF2F2F2F, 0xFF313131, 0xFF373737, 0xFF434343,
+	0xFF404040, 0xFF373737, 0xFF313131, 0xFF2B2B2B, 0xFF252525, 0xFF1E1E1E, 0xFF1A1A1A, 0xFF161616,
+	0xFF141414, 0xFF111111, 0xFF111111, 0xFF111111, 0xFF121212, 0xFF131313, 0xFF141414, 0xFF141414,
+	0xFF141414, 0xFF141414, 0xFF121212, 0xFF101010, 0xFF101010, 0xFF101010, 0xFF101010, 0xFF101010,
+	0xFF121212, 0xFF161616, 0xFF181818, 0xFF1E1E1E, 0xFF242424, 0xFF272727, 0xFF272727, 0xFF282828,
+	0xFF292929, 0xFF2A2A2A, 0xFF2D2D2D, 0xFF2F2F2F, 0xFF323232, 0xFF343434, 0xFF373737, 0xFF3B3B3B,
+	0xFF3D3D3D, 0xFF3C3C3C, 0xFF3A3A3A, 0xFF373737, 0xFF2D2D2D, 0xFF242424, 0xFF1F1F1F, 0xFF1D1D1D,
+	0xFF1C1C1C, 0xFF1F1F1F, 0xFF202020, 0xFF272727, 0xFF303030, 0xFF373737, 0xFF373737, 0xFF333333,
+	0xFF2D2D2D, 0xFF292929, 0xFF262626, 0xFF212121, 0xFF1F1F1F, 0xFF1D1D1D, 0xFF1D1D1D, 0xFF1D1D1D,
+	0xFF1E1E1E, 0xFF1E1E1E, 0xFF1F1F1F, 0xFF1F1F1F, 0xFF1E1E1E, 0xFF1E1E1E, 0xFF1E1E1E, 0xFF1F1F1F,
+	0xFF202020, 0xFF232323, 0xFF262626, 0xFF292929, 0xFF2C2C2C, 0xFF313131, 0xFF343434, 0xFF393939,
+	0xFF3C3C3C, 0xFF424242, 0xFF454545, 0xFF4B4B4B, 0xFF525252, 0xFF626262, 0xFF818181, 0xFFAFAFAF,
+	0xFFEBEBEB, 0xFFE1E1E1, 0xFF818181, 0xFF4B4B4B, 0xFF2F2F2F, 0xFF212121, 0xFF191919, 0xFF151515,
+	0xFF151515, 0xFF181818, 0xFF1C1C1C, 0xFF272727, 0xFF393939, 0xFF505050, 0xFF747474, 0xFFA0A0A0,
+	0xFFDCDCDC, 0xFFE2E2E2, 0xFF979797, 0xFF6C6C6C, 0xFF525252, 0xFF404040, 0xFF313131, 0xFF292929,
+	0xFF212121, 0xFF1C1C1C, 0xFF191919, 0xFF191919, 0xFF191919, 0xFF1C1C1C, 0xFF212121, 0xFF292929,
+	0xFF333333, 0xFF3C3C3C, 0xFF3C3C3C, 0xFF363636, 0xFF363636, 0xFF383838, 0xFF3C3C3C, 0xFF404040,
+	0xFF2F2F2F, 0xFF2E2E2E, 0xFF2D2D2D, 0xFF292929, 0xFF252525, 0xFF212121, 0xFF1E1E1E, 0xFF1B1B1B,
+	0xFF181818, 0xFF151515, 0xFF131313, 0xFF131313, 0xFF131313, 0xFF131313, 0xFF131313, 0xFF141414,
+	0xFF141414, 0xFF151515, 0xFF131313, 0xFF101010, 0xFF101010, 0xFF101010, 0xFF101010, 0xFF101010,
+	0xFF121212, 0xFF161616, 0xFF181818, 0xFF1C1C1C, 0xFF242424, 0xFF262626, 0xFF272727, 0xFF292929,
+	0xFF292929, 0xFF2B2B2B, 0xFF2F2F2F, 0xFF343434, 0xFF393939, 0xFF414141, 0xFF454545, 0xFF444444,
+	0xFF414141, 0xFF393939, 0xFF303030, 0xFF292929, 0xFF232323, 0xFF1F1F1F, 0xFF1E1E1E, 0xFF1F1F1F,
+	0xFF202020, 0xFF242424, 0xFF282828, 0xFF303030, 0xFF3C3C3C, 0xFF444444, 0xFF4C4C4C, 0xFF525252,
+	0xFF515151, 0xFF4D4C4D, 0xFF494949, 0xFF454545, 0xFF414141, 0xFF3E3E3E, 0xFF3A3A3A, 0xFF3A3A3A,
+	0xFF373737, 0xFF363636, 0xFF363636, 0xFF313131, 0xFF2D2D2D, 0xFF272727, 0xFF252525, 0xFF242424,
+	0xFF242424, 0xFF252525, 0xFF282828, 0xFF2A2A2A, 0xFF303030, 0xFF383838, 0xFF3E3E3E, 0xFF444444,
+	0xFF4B4B4B, 0xFF535353, 0xFF585858, 0xFF636363, 0xFF747474, 0xFF8A8A8A, 0xFFA0A0A0, 0xFFADADAD,
+	0xFFC7C7C7, 0xFF9E9E9E, 0xFF595959, 0xFF383838, 0xFF212121, 0xFF191919, 0xFF131313, 0xFF121212,
+	0xFF121212, 0xFF151515, 0xFF1B1B1B, 0xFF272727, 0xFF393939, 0xFF545454, 0xFF7E7E7E, 0xFFB6B6B6,
+	0xFFF6F6F6, 0xFFDDDDDD, 0xFF929292, 0xFF6C6C6C, 0xFF565556, 0xFF444444, 0xFF353535, 0xFF2A2A2A,
+	0xFF232323, 0xFF1E1E1E, 0xFF181818, 0xFF161616, 0xFF161616, 0xFF161616, 0xFF181818, 0xFF1B1B1B,
+	0xFF1E1E1E, 0xFF222222, 0xFF282828, 0xFF2D2D2D, 0xFF303030, 0xFF313131, 0xFF303030, 0xFF313131,
+	0xFF2C2C2C, 0xFF303030, 0xFF2E2E2E, 0xFF2C2C2C, 0xFF2B2B2B, 0xFF292929, 0xFF242424, 0xFF202020,
+	0xFF1D1D1D, 0xFF1B1B1B, 0xFF171717, 0xFF151515, 0xFF151515, 0xFF151515, 0xFF151515, 0xFF151515,
+	0xFF151515, 0xFF151515, 0xFF141414, 0xFF121212, 0xFF111111, 0xFF111111, 0xFF111111, 0xFF131313,
+	0xFF141414, 0xFF171717, 0xFF181818, 0xFF1D1D1D, 0xFF232323, 0xFF272727, 0xFF2B2B2B, 0xFF2D2D2D,
+	0xFF2C2C2C, 0xFF2E2E2E, 0xFF323232, 0xFF353535, 0xFF353535, 0xFF333333, 0xFF303030, 0xFF2C2C2C,
+	0xFF272727, 0xFF212121, 0xFF1F1F1F, 0xFF1E1E1E, 0xFF1E1E1E, 0xFF1F1F1F, 0xFF212121, 0xFF242424,
+	0xFF2C2C2C, 0xFF323232, 0xFF3B3B3B, 0xFF444444, 0xFF4F4F4F, 0xFF585858, 0xFF5F5F5F, 0xFF646464,
+	0xFF666666, 0xFF656565, 0xFF626262, 0xFF5E5E5E, 0xFF595959, 0xFF535353, 0xFF4C4C4C, 0xFF454545,
+	0xFF414141, 0xFF3D3D3D, 0xFF3D3D3D, 0xFF3C3C3C, 0xFF3D3D3D, 0xFF3B3B3B, 0xFF353535, 0xFF313131,
+	0xFF2F2F2F, 0xFF2E2E2E, 0xFF313131, 0xFF363636, 0xFF3C3C3C, 0xFF444444, 0xFF4F4F4F, 0xFF595959,
+	0xFF666666, 0xFF727272, 0xFF828282, 0xFF979797, 0xFF9D9D9D, 0xFF989898, 0xFF909090, 0xFF959595,
+	0xFF9F9F9F, 0xFF6F6F6F, 0xFF434343, 0xFF2A2A2A, 0xFF1D1D1D, 0xFF151515, 0xFF0F0F0F, 0xFF0F0F0F,
+	0xFF0F0F0F, 0xFF131313, 0xFF191919, 0xFF242424, 0xFF363636, 0xFF515151, 0xFF7D7D7D, 0xFFBDBDBD,
+	0xFFFCFCFC, 0xFFE1E1E1, 0xFF9D9D9D, 0xFF767676, 0xFF5D5D5D, 0xFF4B4B4B, 0xFF3C3C3C, 0xFF313131,
+	0xFF292929, 0xFF232323, 0xFF1B1B1B, 0xFF161616, 0xFF151515, 0xFF151515, 0xFF141414, 0xFF141414,
+	0xFF151515, 0xFF181818, 0xFF1C1C1C, 0xFF1E1E1E, 0xFF232323, 0xFF252525, 0xFF272727, 0xFF292929,
+	0xFF2E2E2E, 0xFF343434, 0xFF373737, 0xFF383838, 0xFF383838, 0xFF343434, 0xFF313131, 0xFF2A2A2A,
+	0xFF262626, 0xFF222222, 0xFF1E1E1E, 0xFF1B1B1B, 0xFF1A1A1A, 0xFF191919, 0xFF191919, 0xFF181818,
+	0xFF171717, 0xFF161616, 0xFF161616, 0xFF151515, 0xFF151515, 0xFF151515, 0xFF161616, 0xFF161616,
+	0xFF171717, 0xFF191919, 0xFF1B1B1B, 0xFF1E1E1E, 0xFF212121, 0xFF242424, 0xFF262626, 0xFF292929,
+	0xFF292929, 0xFF282828, 0xFF272727, 0xFF242424, 0xFF202020, 0xFF1E1E1E, 0xFF1B1B1B, 0xFF181818,
+	0xFF181818, 0xFF161616, 0xFF151515, 0xFF181818, 0xFF1C1C1C, 0xFF1E1E1E, 0xFF242424, 0xFF2F2F2F,
+	0xFF3C3C3C, 0xFF4A4A4A, 0xFF5B5B5B, 0xFF6D6D6D, 0xFF7C7C7C, 0xFF878687, 0xFF8A8A8A, 0xFF848484,
+	0xFF7A7A7A, 0xFF6D6D6D, 0xFF646464, 0xFF565656, 0xFF4B4B4B, 0xFF404040, 0xFF373737, 0xFF2D2D2D,
+	0xFF272727, 0xFF252525, 0xFF252525, 0xFF272727, 0xFF2D2D2D, 0xFF383838, 0xFF434343, 0xFF4B4B4B,
+	0xFF464646, 0xFF444444, 0xFF464646, 0xFF4E4E4E, 0xFF565656, 0xFF626262, 0xFF767676, 0xFF8B8B8B,
+	0xFFA4A4A4, 0xFFBEBEBE, 0xFFCDCCCD, 0xFFBEBEBE, 0xFF9F9F9F, 0xFF8A8A8A, 0xFF838383, 0xFF858585,
+	0xFF777777, 0xFF4D4D4D, 0xFF333333, 0xFF232323, 0xFF171717, 0xFF101010, 0xFF0E0E0E, 0xFF0E0E0E,
+	0xFF0E0E0E, 0xFF101010, 0xFF171717, 0xFF222222, 0xFF323232, 0xFF4D4D4D, 0xFF747474, 0xFFB2B2B2,
+	0xFFF7F7F7, 0xFFF0F0F0, 0xFFACACAC, 0xFF828282, 0xFF696A69, 0xFF575757, 0xFF484848, 0xFF3B3B3B,
+	0xFF313131, 0xFF292929, 0xFF232323, 0xFF1C1C1C, 0xFF161616, 0xFF151515, 0xFF141414, 0xFF131313,
+	0xFF131313, 0xFF131313, 0xFF161616, 0xFF191919, 0xFF1C1C1C, 0xFF212121, 0xFF252525, 0xFF2A2A2A,
+	0xFF3A3A3A, 0xFF444444, 0xFF4E4E4E, 0xFF525252, 0xFF525252, 0xFF4E4E4E, 0xFF494949, 0xFF424242,
+	0xFF3A3A3A, 0xFF303030, 0xFF292929, 0xFF242424, 0xFF202020, 0xFF1C1C1C, 0xFF1C1C1C, 0xFF1C1C1C,
+	0xFF1B1B1B, 0xFF1B1B1B, 0xFF1B1B1B, 0xFF191919, 0xFF191919, 0xFF1B1B1B, 0xFF1B1B1B, 0xFF1A1A1A,
+	0xFF1B1B1B, 0xFF1D1D1D, 0xFF202020, 0xFF222222, 0xFF222222, 0xFF222222, 0xFF212121, 0xFF212121,
+	0xFF1F1F1F, 0xFF1C1C1C, 0xFF1A1A1A, 0xFF161616, 0xFF141414, 0xFF141414, 0xFF101010, 0xFF0F0F0F,
+	0xFF0F0F0F, 0xFF101010, 0xFF121212, 0xFF151515, 0xFF1C1C1C, 0xFF252525, 0xFF313131, 0xFF444444,
+	0xFF5F5F5F, 0xFF7A7A7A, 0xFF929292, 0xFFA1A1A1, 0xFFAAAAAA, 0xFFAFAEAF, 0xFFADADAD, 0xFFA6A6A6,
+	0xFF999999, 0xFF868686, 0xFF6D6D6D, 0xFF565656, 0xFF424242, 0xFF333333, 0xFF282828, 0xFF202020,
+	0xFF191919, 0xFF181818, 0xFF181818, 0xFF181818, 0xFF1E1E1E, 0xFF252525, 0xFF313131, 0xFF444444,
+	0xFF555555, 0xFF656565, 0xFF757575, 0xFF838383, 0xFF949494, 0xFFACACAC, 0xFFCCCCCC, 0xFFE7E7E7,
+	0xFFF9F9F9, 0xFFFFFFFF, 0xFFE2E2E2, 0xFFB3B3B3, 0xFF919191, 0xFF7E7E7E, 0xFF757575, 0xFF707170,
+	0xFF5A5A5A, 0xFF3E3E3E, 0xFF2A2A2A, 0xFF1C1C1C, 0xFF131313, 0xFF101010, 0xFF0D0D0D, 0xFF0D0D0D,
+	0xFF0D0D0D, 0xFF101010, 0xFF161616, 0xFF1F1F1F, 0xFF2D2D2D, 0xFF444444, 0xFF676767, 0xFF9A9A9A,
+	0xFFDFDFDF, 0xFFFFFFFF, 0xFFCDCDCD, 0xFF9F9F9F, 0xFF838383, 0xFF707070, 0xFF5F5F5F, 0xFF515151,
+	0xFF434343, 0xFF353535, 0xFF2D2D2D, 0xFF242424, 0xFF1C1C1C, 0xFF161616, 0xFF141414, 0xFF141414,
+	0xFF141414, 0xFF131313, 0xFF151515, 0xFF1A1A1A, 0xFF1E1E1E, 0xFF232323, 0xFF2A2A2A, 0xFF323232,
+	0xFF555555, 0xFF666666, 0xFF656565, 0xFF575757, 0xFF4B4B4B, 0xFF454545, 0xFF444444, 0xFF464646,
+	0xFF494949, 0xFF434343, 0xFF3A3A3A, 0xFF303030, 0xFF2A2A2A, 0xFF252525, 0xFF242424, 0xFF212121,
+	0xFF202020, 0xFF202020, 0xFF202020, 0xFF1F1F1F, 0xFF1F1F1F, 0xFF202020, 0xFF202020, 0xFF202020,
+	0xFF222222, 0xFF232323, 0xFF232323, 0xFF232323, 0xFF222222, 0xFF212121, 0xFF1F1F1F, 0xFF1C1C1C,
+	0xFF191919, 0xFF161616, 0xFF141414, 0xFF111111, 0xFF0E0E0E, 0xFF0C0C0C, 0xFF0A0A0A, 0xFF0A0A0A,
+	0xFF0B0B0B, 0xFF0C0C0C, 0xFF111111, 0xFF161616, 0xFF202020, 0xFF2E2E2E, 0xFF474747, 0xFF646464,
+	0xFF707070, 0xFF747474, 0xFF727272, 0xFF6D6D6D, 0xFF696969, 0xFF6B6B6B, 0xFF6D6D6D, 0xFF6E6E6E,
+	0xFF707070, 0xFF727272, 0xFF6C6C6C, 0xFF585858, 0xFF3F3F3F, 0xFF2D2D2D, 0xFF202020, 0xFF161616,
+	0xFF101010, 0xFF0F0F0F, 0xFF0F0F0F, 0xFF101010, 0xFF141414, 0xFF1A1A1A, 0xFF252525, 0xFF343434,
+	0xFF474747, 0xFF5F5F5F, 0xFF7D7D7D, 0xFFA4A4A4, 0xFFD5D5D5, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+	0xFFF8F8F8, 0xFFEAEAEA, 0xFFCDCDCD, 0xFFA9A9A9, 0xFF878787, 0xFF707070, 0xFF666666, 0xFF5E5E5E,
+	0xFF484848, 0xFF363636, 0xFF262626, 0xFF191919, 0xFF121212, 0xFF0F0F0F, 0xFF0C0C0C, 0xFF0C0C0C,
+	0xFF0D0D0D, 0xFF101010, 0xFF141414, 0xFF1B1B1B, 0xFF272727, 0xFF3C3C3C, 0xFF595959, 0xFF828282,
+	0xFFBDBDBD, 0xFFFBFBFB, 0xFFF4F4F4, 0xFFC7C7C7, 0xFFA7A7A7, 0xFF939393, 0xFF7E7E7E, 0xFF6C6C6C,
+	0xFF5B5B5B, 0xFF474747, 0xFF3A3A3A, 0xFF2E2E2E, 0xFF252525, 0xFF1E1E1E, 0xFF191919, 0xFF151515,
+	0xFF151515, 0xFF151515, 0xFF171717, 0xFF1B1B1B, 0xFF232323, 0xFF2B2B2B, 0xFF353535, 0xFF414141,
+	0xFF737373, 0xFF646464, 0xFF4C4C4C, 0xFF3C3C3C, 0xFF353535, 0xFF323232, 0xFF353535, 0xFF393939,
+	0xFF3F3F3F, 0xFF464646, 0xFF4B4B4B, 0xFF454545, 0xFF393A39, 0xFF303030, 0xFF2D2D2D, 0xFF2B2B2B,
+	0xFF2A2A2A, 0xFF2A2A2A, 0xFF292929, 0xFF292929, 0xFF292929, 0xFF2B2B2B, 0xFF2B2B2B, 0xFF2B2B2B,
+	0xFF2B2B2B, 0xFF292929, 0xFF292929, 0xFF282828, 0xFF242424, 0xFF202020, 0xFF1D1D1D, 0xFF191919,
+	0xFF161616, 0xFF121212, 0xFF0F0F0F, 0xFF0D0D0D, 0xFF0A0A0A, 0xFF080808, 0xFF080808, 0xFF080808,
+	0xFF080808, 0xFF0B0B0B, 0xFF101010, 0xFF191919, 0xFF262626, 0xFF404040, 0xFF585858, 0xFF565556,
+	0xFF4A4A4A, 0xFF444444, 0xFF404040, 0xFF3D3D3D, 0xFF3D3D3D, 0xFF3D3D3D, 0xFF3D3D3D, 0xFF3E3E3E,
+	0xFF3F3F3F, 0xFF434343, 0xFF474747, 0xFF4A4A4A, 0xFF3F3F3F, 0xFF2B2B2B, 0xFF1C1C1C, 0xFF121212,
+	0xFF0D0D0D, 0xFF0A0A0A, 0xFF0A0A0A, 0xFF0C0C0C, 0xFF0F0F0F, 0xFF151515, 0xFF1E1E1E, 0xFF2B2B2B,
+	0xFF3D3D3D, 0xFF525152, 0xFF6E6E6E, 0xFF9B9B9B, 0xFFD0D0D0, 0xFFE2E2E2, 0xFFCECECE, 0xFFBDBDBD,
+	0xFFABABAB, 0xFF9E9E9E, 0xFF959595, 0xFF8B8B8B, 0xFF7A7A7A, 0xFF656565, 0xFF595959, 0xFF515151,
+	0xFF424242, 0xFF353535, 0xFF272727, 0xFF1D1D1D, 0xFF151515, 0xFF111111, 0xFF0F0F0F, 0xFF0F0F0F,
+	0xFF0E0E0E, 0xFF101010, 0xFF141414, 0xFF1A1A1A, 0xFF242424, 0xFF343434, 0xFF4B4B4B, 0xFF6C6C6C,
+	0xFF9C9C9C, 0xFFDADADA, 0xFFFFFFFF, 0xFFF6F6F6, 0xFFE0E0E0, 0xFFCBCBCB, 0xFFB5B5B5, 0xFF9B9B9B,
+	0xFF808080, 0xFF676767, 0xFF515151, 0xFF404040, 0xFF333333, 0xFF262626, 0xFF202020, 0xFF1C1C1C,
+	0xFF1B1B1B, 0xFF1B1B1B, 0xFF1D1D1D, 0xFF242424, 0xFF2C2C2C, 0xFF393939, 0xFF484848, 0xFF606060,
+	0xFF616161, 0xFF444444, 0xFF383838, 0xFF2D2D2D, 0xFF2C2C2C, 0xFF2C2C2C, 0xFF2E2E2E, 0xFF363636,
+	0xFF3C3C3C, 0xFF454545, 0xFF515151, 0xFF5D5D5D, 0xFF535353, 0xFF444444, 0xFF3D3D3D, 0xFF393939,
+	0xFF393939, 0xFF383838, 0xFF383838, 0xFF373737, 0xFF363636, 0xFF373737, 0xFF363636, 0xFF363636,
+	0xFF363636, 0xFF343434, 0xFF2F2F2F, 0xFF2C2C2C, 0xFF272727, 0xFF212121, 0xFF1B1B1B, 0xFF181818,
+	0xFF141414, 0xFF0F0F0F, 0xFF0B0B0B, 0xFF080808, 0xFF070707, 0xFF050505, 0xFF040404, 0xFF040404,
+	0xFF060606, 0xFF0A0A0A, 0xFF121212, 0xFF1F1F1F, 0xFF353535, 0xFF4F4F4F, 0xFF474747, 0xFF3B3B3B,
+	0xFF353535, 0xFF2F2F2F, 0xFF2C2C2C, 0xFF272727, 0xFF272727, 0xFF272727, 0xFF272727, 0xFF282828,
+	0xFF292929, 0xFF2A2A2A, 0xFF2B2B2B, 0xFF2F2F2F, 0xFF333333, 0xFF292929, 0xFF191919, 0xFF111111,
+	0xFF0A0A0A, 0xFF080808, 0xFF080808, 0xFF090909, 0xFF0B0B0B, 0xFF111111, 0xFF1B1B1B, 0xFF272727,
+	0xFF373737, 0xFF4C4C4C, 0xFF6C6C6C, 0xFF898989, 0xFF919191, 0xFF888888, 0xFF808080, 0xFF7C7C7C,
+	0xFF787878, 0xFF767676, 0xFF747474, 0xFF6F6F6F, 0xFF676767, 0xFF5A5A5A, 0xFF4B4B4B, 0xFF444444,
+	0xFF3F3F3F, 0xFF363636, 0xFF2B2B2B, 0xFF232323, 0xFF1A1A1A, 0xFF161616, 0xFF131313, 0xFF111111,
+	0xFF101010, 0xFF121212, 0xFF161616, 0xFF1B1B1B, 0xFF222222, 0xFF2F2F2F, 0xFF424242, 0xFF5D5D5D,
+	0xFF838383, 0xFFB7B7B7, 0xFFEEEEEE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFDFDFD, 0xFFF7F7F7, 0xFFE4E4E4,
+	0xFFC5C6C5, 0xFF9D9D9D, 0xFF787878, 0xFF5A5A5A, 0xFF464646, 0xFF363636, 0xFF2B2B2B, 0xFF262626,
+	0xFF242424, 0xFF242424, 0xFF282828, 0xFF303030, 0xFF3D3D3D, 0xFF4E4E4E, 0xFF707070, 0xFF828282,
+	0xFF4E4E4E, 0xFF3A3A3A, 0xFF2C2C2C, 0xFF272727, 0xFF262626, 0xFF262626, 0xFF2C2C2C, 0xFF363636,
+	0xFF414141, 0xFF4C4C4C, 0xFF5D5D5D, 0xFF727272, 0xFF787878, 0xFF636363, 0xFF545454, 0xFF515151,
+	0xFF505050, 0xFF4C4C4C, 0xFF444444, 0xFF393939, 0xFF323232, 0xFF2F2F2F, 0xFF2E2E2E, 0xFF2E2E2E,
+	0xFF343434, 0xFF3B3B3B, 0xFF393939, 0xFF313131, 0xFF2A2A2A, 0xFF232323, 0xFF1B1B1B, 0xFF161616,
+	0xFF121212, 0xFF0D0D0D, 0xFF080808, 0xFF070707, 0xFF040404, 0xFF030303, 0xFF030303, 0xFF040404,
+	0xFF070707, 0xFF0C0C0C, 0xFF141414, 0xFF282828, 0xFF494949, 0xFF4F4E4F, 0xFF3D3D3D, 0xFF333333,
+	0xFF2B2B2B, 0xFF242424, 0xFF212121, 0xFF1D1D1D, 0xFF1B1B1B, 0xFF1A1A1A, 0xFF1A1A1A, 0xFF1A1A1A,
+	0xFF1B1B1B, 0xFF1C1C1C, 0xFF1D1D1D, 0xFF212121, 0xFF232323, 0xFF232323, 0xFF191919, 0xFF0F0F0F,
+	0xFF080808, 0xFF060606, 0xFF070707, 0xFF070707, 0xFF0A0A0A, 0xFF111111, 0xFF1A1A1A, 0xFF282828,
+	0xFF3A3A3A, 0xFF4A4A4A, 0xFF575757, 0xFF595959, 0xFF5B5B5B, 0xFF606060, 0xFF616161, 0xFF636363,
+	0xFF666666, 0xFF676767, 0xFF696969, 0xFF6A6A6A, 0xFF606060, 0xFF4C4C4C, 0xFF3D3D3D, 0xFF373737,
+	0xFF353535, 0xFF373737, 0xFF353535, 0xFF2C2C2C, 0xFF232323, 0xFF1E1E1E, 0xFF1A1A1A, 0xFF161616,
+	0xFF141414, 0xFF161616, 0xFF181818, 0xFF1C1C1C, 0xFF222222, 0xFF2C2C2C, 0xFF3B3B3B, 0xFF515151,
+	0xFF747474, 0xFFA2A1A2, 0xFFDADADA, 0xFFFEFEFE, 0xFFFEFEFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+	0xFFFEFFFE, 0xFFE5E5E5, 0xFFB2B2B2, 0xFF818181, 0xFF626262, 0xFF4C4C4C, 0xFF3E3E3E, 0xFF373737,
+	0xFF343434, 0xFF343434, 0xFF393939, 0xFF454545, 0xFF585858, 0xFF797979, 0xFF9B9B9B, 0xFF757575,
+	0xFF474747, 0xFF343434, 0xFF282828, 0xFF252525, 0xFF252525, 0xFF272727, 0xFF313131, 0xFF3E3E3E,
+	0xFF4E4E4E, 0xFF656565, 0xFF828282, 0xFF9E9E9E, 0xFFB7B7B7, 0xFFA7A7A7, 0xFF888888, 0xFF7B7B7B,
+	0xFF717171, 0xFF5F5F5F, 0xFF494949, 0xFF393839, 0xFF2E2E2E, 0xFF282828, 0xFF262626, 0xFF282828,
+	0xFF2B2B2B, 0xFF333333, 0xFF3C3C3C, 0xFF373737, 0xFF2D2D2D, 0xFF242424, 0xFF1B1B1B, 0xFF141414,
+	0xFF101010, 0xFF0B0B0B, 0xFF070707, 0xFF060606, 0xFF030303, 0xFF020202, 0xFF020202, 0xFF050505,
+	0xFF080808, 0xFF101010, 0xFF1B1B1B, 0xFF333333, 0xFF595959, 0xFF4C4C4C, 0xFF3C3C3C, 0xFF2F2F2F,
+	0xFF272727, 0xFF1F1F1F, 0xFF1B1B1B, 0xFF171717, 0xFF141414, 0xFF121212, 0xFF121212, 0xFF121212,
+	0xFF131313, 0xFF151515, 0xFF181818, 0xFF191919, 0xFF191919, 0xFF1A1A1A, 0xFF181818, 0xFF0F0F0F,
+	0xFF080808, 0xFF060606, 0xFF060606, 0xFF070707, 0xFF0C0C0C, 0xFF141414, 0xFF1F1F1F, 0xFF292929,
+	0xFF2F2F2F, 0xFF353535, 0xFF373737, 0xFF3B3B3B, 0xFF424242, 0xFF4A4A4A, 0xFF505050, 0xFF585858,
+	0xFF606060, 0xFF666666, 0xFF6C6C6C, 0xFF6D6D6D, 0xFF565656, 0xFF3F3F3F, 0xFF303030, 0xFF292929,
+	0xFF272727, 0xFF2A2A2A, 0xFF313131, 0xFF373737, 0xFF323232, 0xFF262626, 0xFF212121, 0xFF1E1E1E,
+	0xFF1C1C1C, 0xFF1B1B1B, 0xFF1C1C1C, 0xFF1F1F1F, 0xFF252525, 0xFF2D2D2D, 0xFF3B3B3B, 0xFF4E4E4E,
+	0xFF6E6E6E, 0xFF979797, 0xFFCCCCCC, 0xFFFAF9FA, 0xFFFFFEFF, 0xFFFEFEFE, 0xFFFEFEFE, 0xFFFFFFFF,
+	0xFFFFFFFF, 0xFFFFFFFF, 0xFFF4F4F4, 0xFFBFBFBF, 0xFF919291, 0xFF717171, 0xFF5B5B5B, 0xFF515151,
+	0xFF4B4B4B, 0xFF4C4C4C, 0xFF565656, 0xFF686868, 0xFF8C8B8C, 0xFFC6C6C6, 0xFFA6A6A6, 0xFF656565,
+	0xFF4A4A4A, 0xFF373737, 0xFF2C2C2C, 0xFF282828, 0xFF2B2B2B, 0xFF303030, 0xFF3A3A3A, 0xFF494949,
+	0xFF5B5B5B, 0xFF777777, 0xFFA1A1A1, 0xFFD7D7D7, 0xFFFDFDFD, 0xFFFCFCFC, 0xFFE8E8E8, 0xFFD6D6D6,
+	0xFFB5B5B5, 0xFF7E7E7E, 0xFF5A5A5A, 0xFF414141, 0xFF333333, 0xFF2C2C2C, 0xFF292929, 0xFF292929,
+	0xFF2A2A2A, 0xFF2F2F2F, 0xFF3B3B3B, 0xFF3A3A3A, 0xFF2E2E2E, 0xFF242424, 0xFF1C1C1C, 0xFF151515,
+	0xFF101010, 0xFF0B0B0B, 0xFF080808, 0xFF070707, 0xFF040404, 0xFF020202, 0xFF020202, 0xFF060606,
+	0xFF0A0A0A, 0xFF111111, 0xFF212121, 0xFF424242, 0xFF6C6C6C, 0xFF545454, 0xFF3F3F3F, 0xFF333333,
+	0xFF262626, 0xFF1D1D1D, 0xFF181818, 0xFF151515, 0xFF101010, 0xFF101010, 0xFF111111, 0xFF111111,
+	0xFF111111, 0xFF111111, 0xFF131313, 0xFF141414, 0xFF141414, 0xFF151515, 0xFF161616, 0xFF131313,
+	0xFF0C0C0C, 0xFF090909, 0xFF090909, 0xFF0B0B0B, 0xFF101010, 0xFF161616, 0xFF1A1A1A, 0xFF1C1C1C,
+	0xFF1E1E1E, 0xFF222222, 0xFF252625, 0xFF2D2D2D, 0xFF343434, 0xFF3E3E3E, 0xFF4A4A4A, 0xFF565656,
+	0xFF646464, 0xFF707070, 0xFF7A7A7A, 0xFF6A6A6A, 0xFF494949, 0xFF343434, 0xFF252525, 0xFF1E1E1E,
+	0xFF1B1B1B, 0xFF1B1B1B, 0xFF202020, 0xFF2E2E2E, 0xFF3C3C3C, 0xFF3C3C3C, 0xFF333333, 0xFF2C2C2C,
+	0xFF292929, 0xFF252525, 0xFF242424, 0xFF272727, 0xFF2B2B2B, 0xFF323232, 0xFF3E3E3E, 0xFF515151,
+	0xFF6D6D6D, 0xFF949494, 0xFFC6C7C6, 0xFFF9F8F9, 0xFFFFFFFF, 0xFFFEFEFE, 0xFFFEFEFE, 0xFFFEFEFE,
+	0xFFFFFFFF, 0xFFF6F6F6, 0xFFE0E0E0, 0xFFBDBDBD, 0xFF9B9B9B, 0xFF808080, 0xFF6C6C6C, 0xFF616161,
+	0xFF5C5C5C, 0xFF646464, 0xFF747574, 0xFF999999, 0xFFDDDDDD, 0xFFFFFFFF, 0xFFB1B1B1, 0xFF6B6B6B,
+	0xFF535353, 0xFF3D3D3D, 0xFF333333, 0xFF2D2D2D, 0xFF2D2D2D, 0xFF2E2E2E, 0xFF323232, 0xFF363636,
+	0xFF414141, 0xFF505050, 0xFF696969, 0xFF8E8D8E, 0xFFB8B8B8, 0xFFE0E0E0, 0xFFF4F4F4, 0xFFFFFFFF,
+	0xFFFEFEFE, 0xFFD5D5D5, 0xFF909090, 0xFF5F5F5F, 0xFF474747, 0xFF393939, 0xFF313131, 0xFF2F2F2F,
+	0xFF303030, 0xFF353535, 0xFF3F3F3F, 0xFF3F3F3F, 0xFF323232, 0xFF262626, 0xFF1C1C1C, 0xFF161616,
+	0xFF111111, 0xFF0C0C0C, 0xFF090909, 0xFF080808, 0xFF060606, 0xFF030303, 0xFF030303, 0xFF080808,
+	0xFF0C0C0C, 0xFF141414, 0xFF262626, 0xFF515151, 0xFF8A8A8A, 0xFF6D6D6D, 0xFF4F4F4F, 0xFF343434,
+	0xFF1E1E1E, 0xFF141414, 0xFF101010, 0xFF111111, 0xFF111111, 0xFF101010, 0xFF101010, 0xFF111111,
+	0xFF111111, 0xFF111111, 0xFF121212, 0xFF131313, 0xFF141414, 0xFF141414, 0xFF151515, 0xFF141414,
+	0xFF101010, 0xFF0E0E0E, 0xFF0C0C0C, 0xFF0E0E0E, 0xFF101010, 0xFF111111, 0xFF111111, 0xFF131313,
+	0xFF151515, 0xFF181818, 0xFF1E1E1E, 0xFF272727, 0xFF2F2F2F, 0xFF3B3B3B, 0xFF494949, 0xFF5B5A5B,
+	0xFF707070, 0xFF868686, 0xFF8A8A8A, 0xFF5F5F5F, 0xFF3C3C3C, 0xFF2A2A2A, 0xFF1C1C1C, 0xFF151515,
+	0xFF111111, 0xFF121212, 0xFF141414, 0xFF1C1C1C, 0xFF292929, 0xFF404040, 0xFF4D4D4D, 0xFF434343,
+	0xFF3A3A3A, 0xFF353535, 0xFF333333, 0xFF343434, 0xFF353535, 0xFF3B3B3B, 0xFF464646, 0xFF565656,
+	0xFF707070, 0xFF939293, 0xFFC4C5C4, 0xFFF2F2F2, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFDFDFD,
+	0xFFEBEBEB, 0xFFCFCFCF, 0xFFB0B0B0, 0xFF929292, 0xFF777777, 0xFF656565, 0xFF555555, 0xFF4D4C4D,
+	0xFF4C4C4C, 0xFF545454, 0xFF636363, 0xFF868686, 0xFFD5D5D5, 0xFFF4F4F4, 0xFFADADAD, 0xFF727272,
+	0xFF494949, 0xFF373737, 0xFF2C2C2C, 0xFF262626, 0xFF212121, 0xFF1D1D1D, 0xFF1F1F1F, 0xFF222222,
+	0xFF292929, 0xFF333333, 0xFF3E3E3E, 0xFF4E4D4E, 0xFF636363, 0xFF7C7C7C, 0xFF969696, 0xFFB0B0B0,
+	0xFFC6C6C6, 0xFFD8D8D8, 0xFFCCCCCC, 0xFFA4A4A4, 0xFF6F6F6F, 0xFF515151, 0xFF454545, 0xFF3E3E3E,
+	0xFF3E3E3E, 0xFF434343, 0xFF4C4C4C, 0xFF434343, 0xFF323232, 0xFF262626, 0xFF1D1D1D, 0xFF171717,
+	0xFF111111, 0xFF0E0E0E, 0xFF0C0C0C, 0xFF080808, 0xFF080808, 0xFF070707, 0xFF070707, 0xFF0A0A0A,
+	0xFF0D0D0D, 0xFF151515, 0xFF2B2B2B, 0xFF5B5B5B, 0xFFBEBEBE, 0xFFA2A2A2, 0xFF575757, 0xFF2B2B2B,
+	0xFF171717, 0xFF0E0E0E, 0xFF0B0B0B, 0xFF0A0A0A, 0xFF0F0F0F, 0xFF111111, 0xFF101010, 0xFF111111,
+	0xFF111111, 0xFF121212, 0xFF131313, 0xFF141414, 0xFF151515, 0xFF151515, 0xFF151515, 0xFF141414,
+	0xFF111111, 0xFF0F0F0F, 0xFF0D0D0D, 0xFF0C0C0C, 0xFF0B0B0B, 0xFF0A0A0A, 0xFF0A0A0A, 0xFF0D0D0D,
+	0xFF101010, 0xFF141414, 0xFF191919, 0xFF222222, 0xFF2B2B2B, 0xFF393939, 0xFF4D4D4D, 0xFF676767,
+	0xFF848484, 0xFFA8A8A8, 0xFF919191, 0xFF555555, 0xFF363636, 0xFF242424, 0xFF161616, 0xFF0F0F0F,
+	0xFF0A0A0A, 0xFF0C0C0C, 0xFF0D0D0D, 0xFF131313, 0xFF1B1B1B, 0xFF292929, 0xFF414141, 0xFF595959,
+	0xFF5D5D5D, 0xFF505050, 0xFF464646, 0xFF464646, 0xFF464646, 0xFF4A4A4A, 0xFF545454, 0xFF646464,
+	0xFF7A7A7A, 0xFF979697, 0xFFAFAFAF, 0xFFBCBCBC, 0xFFD3D3D3, 0xFFF1F1F1, 0xFFFFFFFF, 0xFFF8F8F8,
+	0xFFD3D3D3, 0xFFB1B1B1, 0xFF929292, 0xFF787878, 0xFF616161, 0xFF4F4F4F, 0xFF424242, 0xFF3C3C3C,
+	0xFF383838, 0xFF3F3F3F, 0xFF494949, 0xFF606060, 0xFF9A9A9A, 0xFFBCBCBC, 0xFF848484, 0xFF5F5F5F,
+	0xFF3C3C3C, 0xFF2D2D2D, 0xFF222222, 0xFF1C1C1C, 0xFF181818, 0xFF151515, 0xFF141414, 0xFF171717,
+	0xFF1A1A1A, 0xFF1F1F1F, 0xFF282828, 0xFF303030, 0xFF3A3A3A, 0xFF464646, 0xFF535353, 0xFF616161,
+	0xFF6D6D6D, 0xFF777777, 0xFF8A8A8A, 0xFFA3A3A3, 0xFFABABAB, 0xFF909090, 0xFF707070, 0xFF5F5F5F,
+	0xFF5C5C5C, 0xFF636363, 0xFF5B5B5B, 0xFF434343, 0xFF323232, 0xFF272727, 0xFF1E1E1E, 0xFF181818,
+	0xFF141414, 0xFF101010, 0xFF0D0D0D, 0xFF0A0A0A, 0xFF090909, 0xFF090909, 0xFF0A0A0A, 0xFF0A0A0A,
+	0xFF0F0F0F, 0xFF191919, 0xFF2E2E2E, 0xFF626262, 0xFFE7E7E7, 0xFFC6C6C6, 0xFF4B4B4B, 0xFF242424,
+	0xFF141414, 0xFF0B0B0B, 0xFF070707, 0xFF060606, 0xFF080808, 0xFF0D0D0D, 0xFF111111, 0xFF141414,
+	0xFF151515, 0xFF161616, 0xFF191919, 0xFF191919, 0xFF181818, 0xFF181818, 0xFF161616, 0xFF141414,
+	0xFF131313, 0xFF101010, 0xFF0D0D0D, 0xFF090909, 0xFF090909, 0xFF080808, 0xFF080808, 0xFF090909,
+	0xFF0B0B0B, 0xFF101010, 0xFF151515, 0xFF1D1D1D, 0xFF2A2A2A, 0xFF3D3D3D, 0xFF575757, 0xFF797979,
+	0xFFA9A9A9, 0xFFD1D1D1, 0xFF8D8D8D, 0xFF4C4C4C, 0xFF2E2E2E, 0xFF1B1B1B, 0xFF0F0F0F, 0xFF080808,
+	0xFF060606, 0xFF070707, 0xFF070707, 0xFF0A0A0A, 0xFF121212, 0xFF1B1B1B, 0xFF282828, 0xFF404040,
+	0xFF5E5E5E, 0xFF707170, 0xFF6F6F6F, 0xFF6B6B6B, 0xFF656565, 0xFF666666, 0xFF6D6D6D, 0xFF797979,
+	0xFF808080, 0xFF7F7F7F, 0xFF7B7B7B, 0xFF7F7F7F, 0xFF909090, 0xFFAFAFAF, 0xFFD9D9D9, 0xFFF2F2F2,
+	0xFFCACACA, 0xFF9F9F9F, 0xFF7D7D7D, 0xFF656565, 0xFF515151, 0xFF3F3F3F, 0xFF333333, 0xFF2D2D2D,
+	0xFF2A2A2A, 0xFF2B2B2B, 0xFF333333, 0xFF444444, 0xFF646464, 0xFF919191, 0xFF737373, 0xFF515151,
+	0xFF393939, 0xFF2A2A2A, 0xFF1E1E1E, 0xFF181818, 0xFF141414, 0xFF101010, 0xFF0E0E0E, 0xFF0E0E0E,
+	0xFF0F0F0F, 0xFF131313, 0xFF171717, 0xFF1B1B1B, 0xFF232323, 0xFF2A2A2A, 0xFF333333, 0xFF3C3C3C,
+	0xFF434343, 0xFF4C4C4C, 0xFF585858, 0xFF686868, 0xFF888888, 0xFFB5B5B5, 0xFFC4C4C4, 0xFFADADAD,
+	0xFF9B9B9B, 0xFF868686, 0xFF626262, 0xFF454545, 0xFF363636, 0xFF2B2B2B, 0xFF222222, 0xFF1C1C1C,
+	0xFF191919, 0xFF141414, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF0C0C0C, 0xFF0A0A0A, 0xFF0A0A0A, 0xFF0B0B0B,
+	0xFF121212, 0xFF1A1A1A, 0xFF2F2F2F, 0xFF626262, 0xFFD4D4D4, 0xFFC3C4C3, 0xFF4C4C4C, 0xFF252425,
+	0xFF131313, 0xFF0B0B0B, 0xFF070707, 0xFF040404, 0xFF050505, 0xFF080808, 0xFF0D0D0D, 0xFF151515,
+	0xFF1D1D1D, 0xFF202020, 0xFF202020, 0xFF202020, 0xFF202020, 0xFF202020, 0xFF1D1D1D, 0xFF191919,
+	0xFF161616, 0xFF121212, 0xFF0F0F0F, 0xFF0D0D0D, 0xFF090909, 0xFF090909, 0xFF090909, 0xFF0A0A0A,
+	0xFF0B0B0B, 0xFF101010, 0xFF161616, 0xFF1F1F1F, 0xFF2D2D2D, 0xFF454545, 0xFF6A6A6A, 0xFF9A9A9A,
+	0xFFDEDEDE, 0xFFEEEEEE, 0xFF898989, 0xFF494949, 0xFF292929, 0xFF171717, 0xFF0B0B0B, 0xFF040404,
+	0xFF030303, 0xFF030303, 0xFF020202, 0xFF040404, 0xFF0A0A0A, 0xFF121212, 0xFF1C1C1C, 0xFF2A2A2A,
+	0xFF404040, 0xFF585858, 0xFF707070, 0xFF7B7C7B, 0xFF7C7C7C, 0xFF787878, 0xFF747474, 0xFF6A6A6A,
+	0xFF5E5E5E, 0xFF585858, 0xFF555655, 0xFF5A5A5A, 0xFF666666, 0xFF797979, 0xFF969696, 0xFFBEBEBE,
+	0xFFC8C8C8, 0xFF9A9A9A, 0xFF727272, 0xFF595859, 0xFF454545, 0xFF333333, 0xFF272727, 0xFF212121,
+	0xFF1F1F1F, 0xFF1E1E1E, 0xFF242424, 0xFF2E2E2E, 0xFF434343, 0xFF6E6E6E, 0xFF727272, 0xFF4F4F4F,
+	0xFF3B3B3B, 0xFF292929, 0xFF1D1D1D, 0xFF151515, 0xFF101010, 0xFF0D0D0D, 0xFF0B0B0B, 0xFF090909,
+	0xFF090909, 0xFF0A0A0A, 0xFF0D0D0D, 0xFF111111, 0xFF141414, 0xFF1A1A1A, 0xFF212121, 0xFF282828,
+	0xFF2E2E2E, 0xFF353535, 0xFF3F3F3F, 0xFF4C4C4C, 0xFF626262, 0xFF8F8F8F, 0xFFE0E0E0, 0xFFFFFFFF,
+	0xFFE2E2E2, 0xFF919191, 0xFF626262, 0xFF494949, 0xFF393939, 0xFF2E2E2E, 0xFF272727, 0xFF202020,
+	0xFF1D1D1D, 0xFF1A1A1A, 0xFF151515, 0xFF111111, 0xFF101010, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF0F0F0F,
+	0xFF131313, 0xFF1C1C1C, 0xFF323232, 0xFF595959, 0xFF8D8D8D, 0xFFAEAFAE, 0xFF5B5B5B, 0xFF252525,
+	0xFF131313, 0xFF0B0B0B, 0xFF060606, 0xFF010101, 0xFF020202, 0xFF050505, 0xFF080808, 0xFF0D0D0D,
+	0xFF161616, 0xFF212121, 0xFF2C2C2C, 0xFF2F2F2F, 0xFF2E2E2E, 0xFF292929, 0xFF232323, 0xFF212121,
+	0xFF1E1E1E, 0xFF161616, 0xFF121212, 0xFF0F0F0F, 0xFF0C0C0C, 0xFF0A0A0A, 0xFF090909, 0xFF090909,
+	0xFF0C0C0C, 0xFF111111, 0xFF181818, 0xFF242424, 0xFF373737, 0xFF565656, 0xFF727272, 0xFF9D9C9D,
+	0xFFF1F1F1, 0xFFF6F6F6, 0xFF8A8A8A, 0xFF454545, 0xFF252525, 0xFF141414, 0xFF090909, 0xFF030303,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF060606, 0xFF0D0D0D, 0xFF151515, 0xFF212121,
+	0xFF2F2F2F, 0xFF3D3D3D, 0xFF4D4D4D, 0xFF545454, 0xFF595959, 0xFF565656, 0xFF4E4E4E, 0xFF464646,
+	0xFF434343, 0xFF424242, 0xFF414141, 0xFF444444, 0xFF4C4C4C, 0xFF595959, 0xFF6F6F6F, 0xFF898989,
+	0xFFA8A8A8, 0xFFA0A0A0, 0xFF707170, 0xFF515051, 0xFF3B3B3B, 0xFF2B2B2B, 0xFF202020, 0xFF1A1A1A,
+	0xFF161616, 0xFF161616, 0xFF1A1A1A, 0xFF202020, 0xFF2D2D2D, 0xFF484748, 0xFF686768, 0xFF565556,
+	0xFF464646, 0xFF2E2E2E, 0xFF202020, 0xFF171717, 0xFF0F0F0F, 0xFF0C0C0C, 0xFF080808, 0xFF050505,
+	0xFF050505, 0xFF050505, 0xFF050505, 0xFF080808, 0xFF0B0B0B, 0xFF101010, 0xFF131313, 0xFF191919,
+	0xFF202020, 0xFF262626, 0xFF2D2D2D, 0xFF3A3A3A, 0xFF545454, 0xFF747474, 0xFFA7A7A7, 0xFFCACACA,
+	0xFFCECECE, 0xFF9B9B9B, 0xFF676767, 0xFF4C4C4C, 0xFF3D3D3D, 0xFF323232, 0xFF2C2C2C, 0xFF282828,
+	0xFF242424, 0xFF1E1E1E, 0xFF181818, 0xFF121212, 0xFF101010, 0xFF0F0F0F, 0xFF101010, 0xFF111111,
+	0xFF141414, 0xFF1E1E1E, 0xFF2F2F2F, 0xFF494949, 0xFF626262, 0xFF8D8D8D, 0xFF6E6E6E, 0xFF2F2F2F,
+	0xFF181818, 0xFF0C0C0C, 0xFF060606, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF050505, 0xFF080808,
+	0xFF0C0C0C, 0xFF151515, 0xFF212121, 0xFF333333, 0xFF3F3F3F, 0xFF3D3D3D, 0xFF333333, 0xFF2C2C2C,
+	0xFF252525, 0xFF1F1F1F, 0xFF161616, 0xFF121212, 0xFF0F0F0F, 0xFF0C0C0C, 0xFF090909, 0xFF0B0B0B,
+	0xFF0F0F0F, 0xFF141414, 0xFF1B1B1B, 0xFF2C2C2C, 0xFF464646, 0xFF5A5A5A, 0xFF656565, 0xFF868686,
+	0xFFE0E0E0, 0xFFE5E5E5, 0xFF888888, 0xFF414141, 0xFF212121, 0xFF101010, 0xFF050505, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF040404, 0xFF0A0A0A, 0xFF111111, 0xFF1B1B1B,
+	0xFF262626, 0xFF2E2E2E, 0xFF383838, 0xFF3F3F3F, 0xFF424242, 0xFF3F3F3F, 0xFF3A3A3A, 0xFF363636,
+	0xFF333333, 0xFF323232, 0xFF313131, 0xFF343434, 0xFF3B3B3B, 0xFF474747, 0xFF565656, 0xFF696969,
+	0xFF7F7F7F, 0xFF919191, 0xFF757575, 0xFF4F4F4F, 0xFF383838, 0xFF262626, 0xFF1A1A1A, 0xFF131313,
+	0xFF101010, 0xFF101010, 0xFF111111, 0xFF131313, 0xFF1E1E1E, 0xFF2E2E2E, 0xFF4B4B4B, 0xFF616161,
+	0xFF5C5C5C, 0xFF3F3F3F, 0xFF2A2A2A, 0xFF1C1C1C, 0xFF121212, 0xFF0D0D0D, 0xFF070707, 0xFF030303,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF050505, 0xFF080808, 0xFF0C0C0C, 0xFF0F0F0F,
+	0xFF151515, 0xFF1D1D1D, 0xFF232323, 0xFF2E2E2E, 0xFF414141, 0xFF4F4F4F, 0xFF595959, 0xFF666666,
+	0xFF6E6E6E, 0xFF6F6F6F, 0xFF626262, 0xFF515151, 0xFF434343, 0xFF383838, 0xFF303030, 0xFF282828,
+	0xFF1D1D1D, 0xFF141414, 0xFF0E0E0E, 0xFF0B0B0B, 0xFF0B0B0B, 0xFF0A0A0A, 0xFF0C0C0C, 0xFF0F0F0F,
+	0xFF161616, 0xFF1F1F1F, 0xFF2B2B2B, 0xFF3E3E3E, 0xFF525252, 0xFF747474, 0xFF808080, 0xFF3F3F3F,
+	0xFF212121, 0xFF0F0F0F, 0xFF090909, 0xFF030303, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF050505,
+	0xFF080808, 0xFF0C0C0C, 0xFF141414, 0xFF1F1F1F, 0xFF303030, 0xFF454545, 0xFF4D4D4D, 0xFF424242,
+	0xFF353535, 0xFF2B2B2B, 0xFF1F1F1F, 0xFF191919, 0xFF151515, 0xFF111111, 0xFF0E0E0E, 0xFF101010,
+	0xFF131313, 0xFF191919, 0xFF242424, 0xFF393939, 0xFF4C4D4C, 0xFF525152, 0xFF5D5D5D, 0xFF848484,
+	0xFFBEBEBE, 0xFFA2A2A2, 0xFF787878, 0xFF3E3E3E, 0xFF202020, 0xFF0F0F0F, 0xFF050505, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF0A0A0A, 0xFF101010, 0xFF191919,
+	0xFF222222, 0xFF292929, 0xFF313131, 0xFF353535, 0xFF373737, 0xFF353535, 0xFF323232, 0xFF313131,
+	0xFF2D2D2D, 0xFF2C2C2C, 0xFF2C2C2C, 0xFF2F2F2F, 0xFF343434, 0xFF3D3D3D, 0xFF4A4A4A, 0xFF5A5A5A,
+	0xFF6A6A6A, 0xFF777777, 0xFF757575, 0xFF505050, 0xFF363636, 0xFF242424, 0xFF161616, 0xFF0F0F0F,
+	0xFF0C0C0C, 0xFF090909, 0xFF090909, 0xFF0C0C0C, 0xFF121212, 0xFF1E1E1E, 0xFF303030, 0xFF525252,
+	0xFF5F5F5F, 0xFF5E5E5E, 0xFF3A3A3A, 0xFF252525, 0xFF171717, 0xFF0D0D0D, 0xFF070707, 0xFF030303,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF060606, 0xFF090909,
+	0xFF0F0F0F, 0xFF161616, 0xFF1D1D1D, 0xFF222222, 0xFF2A2A2A, 0xFF333333, 0xFF383838, 0xFF3C3C3C,
+	0xFF3D3D3D, 0xFF3B3B3B, 0xFF3A3A3A, 0xFF363636, 0xFF2E2E2E, 0xFF272727, 0xFF1F1F1F, 0xFF151515,
+	0xFF0E0E0E, 0xFF0A0A0A, 0xFF080808, 0xFF070707, 0xFF060606, 0xFF070707, 0xFF0B0B0B, 0xFF0F0F0F,
+	0xFF161616, 0xFF1E1E1E, 0xFF2B2B2B, 0xFF3B3B3B, 0xFF4D4D4D, 0xFF696969, 0xFF888888, 0xFF555555,
+	0xFF272727, 0xFF151515, 0xFF0B0B0B, 0xFF050505, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF050505, 0xFF080808, 0xFF0C0C0C, 0xFF131313, 0xFF1B1B1B, 0xFF2A2A2A, 0xFF404040, 0xFF4E4E4E,
+	0xFF4D4D4D, 0xFF3D3D3D, 0xFF2C2C2C, 0xFF222222, 0xFF1C1C1C, 0xFF191919, 0xFF151515, 0xFF171717,
+	0xFF1A1A1A, 0xFF242424, 0xFF303030, 0xFF494949, 0xFF4E4E4E, 0xFF504F50, 0xFF5E5E5E, 0xFF8A8B8A,
+	0xFF8F8F8F, 0xFF6C6C6C, 0xFF606060, 0xFF3C3C3C, 0xFF1D1D1D, 0xFF0F0F0F, 0xFF050505, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF040404, 0xFF0A0A0A, 0xFF101010, 0xFF191919,
+	0xFF222222, 0xFF292929, 0xFF2F2F2F, 0xFF313131, 0xFF323232, 0xFF313131, 0xFF2F2F2F, 0xFF2F2F2F,
+	0xFF2D2D2D, 0xFF2B2B2B, 0xFF2B2B2B, 0xFF2F2F2F, 0xFF343434, 0xFF3B3B3B, 0xFF454545, 0xFF545454,
+	0xFF616161, 0xFF6A6A6A, 0xFF737373, 0xFF585858, 0xFF363636, 0xFF242424, 0xFF151515, 0xFF0D0D0D,
+	0xFF090909, 0xFF050505, 0xFF040404, 0xFF070707, 0xFF0C0C0C, 0xFF121212, 0xFF212121, 0xFF3B3B3B,
+	0xFF494949, 0xFF717171, 0xFF656565, 0xFF393939, 0xFF222222, 0xFF151515, 0xFF0C0C0C, 0xFF050505,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF040404, 0xFF060606,
+	0xFF0C0C0C, 0xFF131313, 0xFF191919, 0xFF1C1C1C, 0xFF1F1F1F, 0xFF242424, 0xFF262626, 0xFF272727,
+	0xFF262626, 0xFF222222, 0xFF1F1F1F, 0xFF1B1B1B, 0xFF181818, 0xFF141414, 0xFF0E0E0E, 0xFF0A0A0A,
+	0xFF080808, 0xFF040404, 0xFF030303, 0xFF030303, 0xFF030303, 0xFF050505, 0xFF0A0A0A, 0xFF0D0D0D,
+	0xFF171717, 0xFF212121, 0xFF2C2C2C, 0xFF3E3E3E, 0xFF535353, 0xFF6C6C6C, 0xFF989898, 0xFF6E6E6E,
+	0xFF323232, 0xFF1B1B1B, 0xFF0E0E0E, 0xFF080808, 0xFF030303, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF050505, 0xFF080808, 0xFF0C0C0C, 0xFF111111, 0xFF181818, 0xFF232323, 0xFF323232,
+	0xFF464646, 0xFF4E4E4E, 0xFF454545, 0xFF343434, 0xFF282828, 0xFF232323, 0xFF212121, 0xFF232323,
+	0xFF272727, 0xFF313131, 0xFF474747, 0xFF565656, 0xFF515251, 0xFF555555, 0xFF707070, 0xFF858585,
+	0xFF646464, 0xFF4E4E4E, 0xFF494949, 0xFF393939, 0xFF1C1C1C, 0xFF0D0D0D, 0xFF050505, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF070707, 0xFF0D0D0D, 0xFF141414, 0xFF1E1E1E,
+	0xFF282828, 0xFF2D2D2D, 0xFF323232, 0xFF343434, 0xFF343434, 0xFF333333, 0xFF323232, 0xFF323232,
+	0xFF303030, 0xFF303030, 0xFF323232, 0xFF333333, 0xFF373737, 0xFF3E3E3E, 0xFF4C4C4C, 0xFF595959,
+	0xFF646464, 0xFF6B6B6B, 0xFF6E6E6E, 0xFF5F5F5F, 0xFF3B3B3B, 0xFF232323, 0xFF151515, 0xFF0B0B0B,
+	0xFF060606, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF070707, 0xFF0C0C0C, 0xFF171717, 0xFF2C2C2C,
+	0xFF3B3B3B, 0xFF676767, 0xFF979797, 0xFF6D6D6D, 0xFF3A3A3A, 0xFF222222, 0xFF121212, 0xFF090909,
+	0xFF030303, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF060606,
+	0xFF080808, 0xFF101010, 0xFF171717, 0xFF181818, 0xFF1B1B1B, 0xFF1C1C1C, 0xFF1B1B1B, 0xFF1B1B1B,
+	0xFF181818, 0xFF141414, 0xFF111111, 0xFF0E0E0E, 0xFF0B0B0B, 0xFF070707, 0xFF030303, 0xFF030303,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF050505, 0xFF090909, 0xFF0F0F0F,
+	0xFF1A1A1A, 0xFF252525, 0xFF2F2F2F, 0xFF3F3F3F, 0xFF5D5D5D, 0xFF818181, 0xFFB7B7B7, 0xFF929292,
+	0xFF424242, 0xFF232323, 0xFF151515, 0xFF0B0B0B, 0xFF060606, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF040404, 0xFF080808, 0xFF0C0C0C, 0xFF101010, 0xFF161616, 0xFF1E1E1E,
+	0xFF292929, 0xFF3B3B3B, 0xFF4D4D4D, 0xFF4B4B4B, 0xFF3B3B3B, 0xFF323232, 0xFF2E2E2E, 0xFF2F2F2F,
+	0xFF343434, 0xFF444444, 0xFF606060, 0xFF696969, 0xFF636363, 0xFF717171, 0xFF838383, 0xFF646464,
+	0xFF484848, 0xFF3C3C3C, 0xFF373737, 0xFF2F2F2F, 0xFF1E1E1E, 0xFF101010, 0xFF070707, 0xFF020202,
+	0xFF010101, 0xFF020202, 0xFF020202, 0xFF080808, 0xFF0D0D0D, 0xFF141414, 0xFF202020, 0xFF292929,
+	0xFF343434, 0xFF393939, 0xFF3E3E3E, 0xFF3E3E3E, 0xFF3E3E3E, 0xFF3D3D3D, 0xFF3C3C3C, 0xFF3B3B3B,
+	0xFF3A3A3A, 0xFF3C3C3C, 0xFF373737, 0xFF2F2F2F, 0xFF2E2E2E, 0xFF343434, 0xFF434343, 0xFF606060,
+	0xFF757475, 0xFF777777, 0xFF757575, 0xFF686868, 0xFF424242, 0xFF252525, 0xFF161616, 0xFF0B0B0B,
+	0xFF030303, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF070707, 0xFF101010, 0xFF222222,
+	0xFF343434, 0xFF5C5C5C, 0xFFA7A7A7, 0xFFCACACA, 0xFF6A6A6A, 0xFF383838, 0xFF1F1F1F, 0xFF101010,
+	0xFF070707, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF070707,
+	0xFF090909, 0xFF111111, 0xFF1A1A1A, 0xFF1B1B1B, 0xFF1A1A1A, 0xFF181818, 0xFF181818, 0xFF151515,
+	0xFF121212, 0xFF0E0E0E, 0xFF0B0B0B, 0xFF080808, 0xFF050505, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF030303, 0xFF050505, 0xFF0C0C0C, 0xFF131313,
+	0xFF212121, 0xFF2B2B2B, 0xFF323232, 0xFF3D3D3D, 0xFF5D5D5D, 0xFF9B9B9B, 0xFFEBEBEB, 0xFFB7B7B7,
+	0xFF525252, 0xFF2B2B2B, 0xFF191919, 0xFF0F0F0F, 0xFF090909, 0xFF040404, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF050505, 0xFF0A0A0A, 0xFF0F0F0F, 0xFF151515,
+	0xFF1D1D1D, 0xFF292929, 0xFF3A3A3A, 0xFF4C4C4C, 0xFF575757, 0xFF4C4C4C, 0xFF434343, 0xFF414241,
+	0xFF4A494A, 0xFF5D5D5D, 0xFF848484, 0xFF949494, 0xFF9A9A9A, 0xFF9C9B9C, 0xFF727272, 0xFF4C4C4C,
+	0xFF3E3E3E, 0xFF333333, 0xFF2D2D2D, 0xFF2A2A2A, 0xFF202020, 0xFF111111, 0xFF0A0A0A, 0xFF060606,
+	0xFF030303, 0xFF030303, 0xFF070707, 0xFF0D0D0D, 0xFF141414, 0xFF1D1D1D, 0xFF2A2A2A, 0xFF323232,
+	0xFF393939, 0xFF3F3F3F, 0xFF454645, 0xFF505050, 0xFF505050, 0xFF505050, 0xFF4D4D4D, 0xFF4E4D4E,
+	0xFF515151, 0xFF404040, 0xFF2D2D2D, 0xFF222222, 0xFF212121, 0xFF252525, 0xFF313131, 0xFF4D4D4D,
+	0xFF7D7D7D, 0xFF919191, 0xFF838383, 0xFF707070, 0xFF4C4C4C, 0xFF2B2B2B, 0xFF171717, 0xFF0C0C0C,
+	0xFF050505, 0xFF010101, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF040404, 0xFF0E0E0E, 0xFF1B1B1B,
+	0xFF2D2D2D, 0xFF4D4D4D, 0xFF878787, 0xFFE8E8E8, 0xFFD7D7D7, 0xFF656565, 0xFF313131, 0xFF1D1D1D,
+	0xFF0E0E0E, 0xFF080808, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF080808,
+	0xFF0D0D0D, 0xFF141414, 0xFF1F1F1F, 0xFF242424, 0xFF1F1F1F, 0xFF1D1D1D, 0xFF1A1A1A, 0xFF161616,
+	0xFF111111, 0xFF0E0E0E, 0xFF0A0A0A, 0xFF070707, 0xFF040404, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF060606, 0xFF0F0F0F, 0xFF1B1B1B,
+	0xFF2A2A2A, 0xFF343434, 0xFF393939, 0xFF434343, 0xFF5A5A5A, 0xFF959595, 0xFFFAFAFA, 0xFFD6D5D6,
+	0xFF666666, 0xFF353535, 0xFF1E1E1E, 0xFF121212, 0xFF0B0B0B, 0xFF060606, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF050505, 0xFF0A0A0A, 0xFF0F0F0F,
+	0xFF151515, 0xFF212121, 0xFF303030, 0xFF434343, 0xFF5D5D5D, 0xFF6F6F6F, 0xFF666666, 0xFF626262,
+	0xFF6A6A6A, 0xFF858585, 0xFFC5C5C5, 0xFFF1F1F1, 0xFFDEDEDE, 0xFF909190, 0xFF5A5A5A, 0xFF434343,
+	0xFF363636, 0xFF2C2C2C, 0xFF282828, 0xFF242424, 0xFF212121, 0xFF171717, 0xFF0F0F0F, 0xFF0B0B0B,
+	0xFF090909, 0xFF0B0B0B, 0xFF0E0E0E, 0xFF141414, 0xFF202020, 0xFF282828, 0xFF2C2C2C, 0xFF2F2F2F,
+	0xFF333333, 0xFF383838, 0xFF3E3E3E, 0xFF525252, 0xFF6E6D6E, 0xFF707070, 0xFF707070, 0xFF767676,
+	0xFF575757, 0xFF333333, 0xFF212121, 0xFF181818, 0xFF181818, 0xFF1C1C1C, 0xFF272727, 0xFF3C3C3C,
+	0xFF686868, 0xFFADADAD, 0xFFA5A5A5, 0xFF808080, 0xFF595959, 0xFF333333, 0xFF1B1B1B, 0xFF101010,
+	0xFF060606, 0xFF010101, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF040404, 0xFF0C0C0C, 0xFF191919,
+	0xFF1C1C1C, 0xFF292929, 0xFF434343, 0xFF808080, 0xFFECECEC, 0xFFC6C6C6, 0xFF595959, 0xFF2B2B2B,
+	0xFF181818, 0xFF0D0D0D, 0xFF070707, 0xFF030303, 0xFF020202, 0xFF020202, 0xFF070707, 0xFF0D0D0D,
+	0xFF101010, 0xFF181818, 0xFF252525, 0xFF313131, 0xFF2F2F2F, 0xFF272727, 0xFF212121, 0xFF1B1B1B,
+	0xFF151515, 0xFF101010, 0xFF0D0D0D, 0xFF080808, 0xFF040404, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF010101, 0xFF030303, 0xFF090909, 0xFF151515, 0xFF232323,
+	0xFF383838, 0xFF404040, 0xFF414141, 0xFF4A4A4A, 0xFF5F5E5F, 0xFF929292, 0xFFE2E2E2, 0xFFBEBEBE,
+	0xFF767676, 0xFF404040, 0xFF232323, 0xFF151515, 0xFF0E0E0E, 0xFF090909, 0xFF060606, 0xFF030303,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF040404, 0xFF090909, 0xFF0E0E0E,
+	0xFF131313, 0xFF1F1F1F, 0xFF2D2D2D, 0xFF414141, 0xFF606060, 0xFF8E8E8E, 0xFFA6A6A6, 0xFF999999,
+	0xFFA5A5A5, 0xFFC5C5C5, 0xFFECECEC, 0xFFEEEEEE, 0xFFC6C6C6, 0xFF808180, 0xFF575757, 0xFF404040,
+	0xFF363636, 0xFF2D2D2D, 0xFF292929, 0xFF262626, 0xFF222222, 0xFF1E1E1E, 0xFF181818, 0xFF141414,
+	0xFF131313, 0xFF161616, 0xFF1D1D1D, 0xFF212121, 0xFF262626, 0xFF272727, 0xFF282828, 0xFF2B2B2B,
+	0xFF2F2F2F, 0xFF333333, 0xFF3B3B3B, 0xFF4C4C4C, 0xFF787878, 0xFFAEAEAE, 0xFFB7B7B7, 0xFF858585,
+	0xFF424242, 0xFF272727, 0xFF191919, 0xFF141414, 0xFF131313, 0xFF161616, 0xFF1E1E1E, 0xFF2F2F2F,
+	0xFF505050, 0xFFA3A3A3, 0xFFDEDEDE, 0xFF9F9F9F, 0xFF6A6A6A, 0xFF3C3C3C, 0xFF222222, 0xFF141414,
+	0xFF090909, 0xFF010101, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF040404, 0xFF0A0A0A, 0xFF141414,
+	0xFF0F0F0F, 0xFF141414, 0xFF212121, 0xFF3D3D3D, 0xFF8A8A8A, 0xFFD1D1D1, 0xFF959595, 0xFF4B4B4B,
+	0xFF262626, 0xFF161616, 0xFF0D0D0D, 0xFF080808, 0xFF070707, 0xFF070707, 0xFF0C0C0C, 0xFF101010,
+	0xFF171717, 0xFF1E1E1E, 0xFF2D2D2D, 0xFF424242, 0xFF4E4E4E, 0xFF404040, 0xFF363636, 0xFF2B2B2B,
+	0xFF212121, 0xFF181818, 0xFF111111, 0xFF0B0B0B, 0xFF060606, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF010101, 0xFF030303, 0xFF0B0B0B, 0xFF191919, 0xFF2C2C2C,
+	0xFF484848, 0xFF4F4F4F, 0xFF4E4E4E, 0xFF555555, 0xFF686868, 0xFF9D9D9D, 0xFFB0B0B0, 0xFF7F7F7F,
+	0xFF626262, 0xFF474747, 0xFF2B2B2B, 0xFF191919, 0xFF111111, 0xFF0C0C0C, 0xFF090909, 0xFF070707,
+	0xFF040404, 0xFF030303, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF040404, 0xFF090909, 0xFF0E0E0E,
+	0xFF131313, 0xFF1F1F1F, 0xFF2E2E2E, 0xFF494949, 0xFF707070, 0xFFB8B8B8, 0xFFF4F4F4, 0xFFE9E9E9,
+	0xFFCFCFCF, 0xFFB4B4B4, 0xFF979797, 0xFF838383, 0xFF747474, 0xFF676767, 0xFF565656, 0xFF464646,
+	0xFF3B3B3B, 0xFF353535, 0xFF2F2F2F, 0xFF2A2A2A, 0xFF262626, 0xFF242424, 0xFF232323, 0xFF222222,
+	0xFF222222, 0xFF232323, 0xFF252525, 0xFF252525, 0xFF262626, 0xFF262626, 0xFF252525, 0xFF282828,
+	0xFF2B2B2B, 0xFF303030, 0xFF393939, 0xFF4B4B4B, 0xFF797979, 0xFFE5E5E5, 0xFFE6E6E6, 0xFF6E6E6E,
+	0xFF353535, 0xFF222222, 0xFF161616, 0xFF101010, 0xFF0F0F0F, 0xFF121212, 0xFF1A1A1A, 0xFF282828,
+	0xFF424242, 0xFF808080, 0xFFEDEDED, 0xFFD7D7D7, 0xFF818181, 0xFF4C4C4C, 0xFF2C2C2C, 0xFF171717,
+	0xFF0D0D0D, 0xFF050505, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF030303, 0xFF060606, 0xFF0A0A0A,
+	0xFF070707, 0xFF090909, 0xFF141414, 0xFF252525, 0xFF4A4A4A, 0xFF989898, 0xFF9F9F9F, 0xFF747474,
+	0xFF3C3C3C, 0xFF222222, 0xFF151515, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF0F0F0F, 0xFF131313, 0xFF171717,
+	0xFF1D1D1D, 0xFF292929, 0xFF383838, 0xFF515151, 0xFF767676, 0xFF848484, 0xFF6C6C6C, 0xFF4F4F4F,
+	0xFF3A3A3A, 0xFF2B2B2B, 0xFF202020, 0xFF161616, 0xFF0F0F0F, 0xFF080808, 0xFF020202, 0xFF000000,
+	0xFF010101, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF070707, 0xFF0F0F0F, 0xFF1C1C1C, 0xFF353535,
+	0xFF5B5B5B, 0xFF606060, 0xFF585858, 0xFF5F5F5F, 0xFF757575, 0xFF989898, 0xFF7F7F7F, 0xFF5D5D5D,
+	0xFF4A4A4A, 0xFF3E3E3E, 0xFF2D2D2D, 0xFF1C1C1C, 0xFF131313, 0xFF0E0E0E, 0xFF0B0B0B, 0xFF090909,
+	0xFF080808, 0xFF080808, 0xFF080808, 0xFF080808, 0xFF080808, 0xFF090909, 0xFF0B0B0B, 0xFF111111,
+	0xFF171717, 0xFF222222, 0xFF353535, 0xFF555555, 0xFF878787, 0xFFCDCDCD, 0xFFFAFAFA, 0xFFD2D2D2,
+	0xFF8D8D8D, 0xFF676767, 0xFF525252, 0xFF484848, 0xFF3E3E3E, 0xFF383838, 0xFF363636, 0xFF343434,
+	0xFF323232, 0xFF323232, 0xFF323232, 0xFF313131, 0xFF313131, 0xFF2C2C2C, 0xFF2A2A2A, 0xFF2A2A2A,
+	0xFF292929, 0xFF292929, 0xFF292929, 0xFF292929, 0xFF272727, 0xFF262626, 0xFF272727, 0xFF2A2A2A,
+	0xFF2D2D2D, 0xFF313131, 0xFF3A3A3A, 0xFF4C4C4C, 0xFF828282, 0xFFE9E9E9, 0xFFD0D0D0, 0xFF5F5F5F,
+	0xFF2F2F2F, 0xFF1A1A1A, 0xFF101010, 0xFF0B0B0B, 0xFF0A0A0A, 0xFF0E0E0E, 0xFF151515, 0xFF232323,
+	0xFF3A3A3A, 0xFF686868, 0xFFCDCDCD, 0xFFFEFEFE, 0xFFA8A8A8, 0xFF5B5B5B, 0xFF343434, 0xFF1B1B1B,
+	0xFF101010, 0xFF080808, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF030303, 0xFF050505, 0xFF0B0B0B, 0xFF171717, 0xFF2F2F2F, 0xFF6B6B6B, 0xFF979797, 0xFF828282,
+	0xFF5D5D5D, 0xFF333333, 0xFF222222, 0xFF191919, 0xFF161616, 0xFF181818, 0xFF1B1B1B, 0xFF202020,
+	0xFF2B2B2B, 0xFF393939, 0xFF4E4E4E, 0xFF6D6D6D, 0xFF9A9A9A, 0xFFD9D9D9, 0xFFECECEC, 0xFFCDCDCD,
+	0xFF9C9C9C, 0xFF676767, 0xFF454545, 0xFF2E2E2E, 0xFF1F1F1F, 0xFF131313, 0xFF0C0C0C, 0xFF070707,
+	0xFF030303, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF0B0B0B, 0xFF141414, 0xFF232323, 0xFF3E3E3E,
+	0xFF6C6C6C, 0xFF6F6F6F, 0xFF676767, 0xFF6D6D6D, 0xFF838383, 0xFF7C7C7C, 0xFF5A5A5A, 0xFF464646,
+	0xFF373737, 0xFF2E2E2E, 0xFF2A2A2A, 0xFF222222, 0xFF181818, 0xFF131313, 0xFF101010, 0xFF0E0E0E,
+	0xFF0B0B0B, 0xFF0B0B0B, 0xFF0B0B0B, 0xFF0B0B0B, 0xFF0B0B0B, 0xFF0E0E0E, 0xFF101010, 0xFF161616,
+	0xFF1D1D1D, 0xFF2A2A2A, 0xFF3D3D3D, 0xFF545454, 0xFF6B6B6B, 0xFF888888, 0xFFAFAFAF, 0xFF929292,
+	0xFF5E5E5E, 0xFF434343, 0xFF343434, 0xFF2A2A2A, 0xFF252525, 0xFF212121, 0xFF1D1D1D, 0xFF1F1F1F,
+	0xFF222222, 0xFF262626, 0xFF2D2D2D, 0xFF373737, 0xFF3F3F3F, 0xFF3D3D3D, 0xFF3B3B3B, 0xFF3A3A3A,
+	0xFF363636, 0xFF333333, 0xFF333333, 0xFF2F2F2F, 0xFF2C2C2C, 0xFF2D2D2D, 0xFF2E2E2E, 0xFF2E2E2E,
+	0xFF303030, 0xFF353535, 0xFF3D3D3D, 0xFF565556, 0xFF8A8A8A, 0xFFA3A3A3, 0xFF949494, 0xFF5B5A5B,
+	0xFF2B2B2B, 0xFF171717, 0xFF0D0D0D, 0xFF080808, 0xFF080808, 0xFF0C0C0C, 0xFF101010, 0xFF1D1D1D,
+	0xFF313131, 0xFF565656, 0xFFA1A1A1, 0xFFFEFEFE, 0xFFD5D5D5, 0xFF6B6B6B, 0xFF383838, 0xFF1F1F1F,
+	0xFF101010, 0xFF080808, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF060606, 0xFF121212, 0xFF262626, 0xFF4E4E4E, 0xFF959595, 0xFF8D8D8D,
+	0xFF747474, 0xFF4A4A4A, 0xFF303030, 0xFF262626, 0xFF222222, 0xFF222222, 0xFF272727, 0xFF2F2F2F,
+	0xFF3C3C3C, 0xFF4D4D4D, 0xFF5E5E5E, 0xFF6F6F6F, 0xFF7F7F7F, 0xFF949494, 0xFFB2B2B2, 0xFFD6D6D6,
+	0xFFF4F4F4, 0xFFEAEAEA, 0xFFBBBBBB, 0xFF777777, 0xFF434343, 0xFF2A2A2A, 0xFF1A1A1A, 0xFF101010,
+	0xFF0B0B0B, 0xFF070707, 0xFF080808, 0xFF080808, 0xFF0D0D0D, 0xFF181818, 0xFF272727, 0xFF4A4A4A,
+	0xFF7A7A7A, 0xFF797979, 0xFF6E6E6E, 0xFF757575, 0xFF7D7D7D, 0xFF626262, 0xFF474747, 0xFF363636,
+	0xFF2B2B2B, 0xFF242424, 0xFF222222, 0xFF202020, 0xFF1D1D1D, 0xFF1A1A1A, 0xFF161616, 0xFF141414,
+	0xFF131313, 0xFF121212, 0xFF121212, 0xFF121212, 0xFF121212, 0xFF151515, 0xFF181818, 0xFF1C1C1C,
+	0xFF262626, 0xFF313131, 0xFF373737, 0xFF3D3D3D, 0xFF454545, 0xFF5B5B5B, 0xFF787878, 0xFF747474,
+	0xFF4A4A4A, 0xFF333333, 0xFF242424, 0xFF1E1E1E, 0xFF161616, 0xFF161616, 0xFF131313, 0xFF151515,
+	0xFF1A1A1A, 0xFF202020, 0xFF2A2A2A, 0xFF393939, 0xFF4D4D4D, 0xFF5E5E5E, 0xFF555555, 0xFF4E4E4E,
+	0xFF4A4A4A, 0xFF454545, 0xFF414141, 0xFF3B3B3B, 0xFF393939, 0xFF373737, 0xFF373737, 0xFF363636,
+	0xFF363636, 0xFF3B3B3B, 0xFF464646, 0xFF5E5E5E, 0xFF6D6D6D, 0xFF666666, 0xFF626262, 0xFF4F4F4F,
+	0xFF282828, 0xFF141414, 0xFF0A0A0A, 0xFF060606, 0xFF050505, 0xFF090909, 0xFF0D0D0D, 0xFF161616,
+	0xFF292929, 0xFF454545, 0xFF777777, 0xFFD5D5D5, 0xFFF8F8F8, 0xFF8C8C8C, 0xFF414141, 0xFF222222,
+	0xFF101010, 0xFF070707, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF070707, 0xFF121212, 0xFF202020, 0xFF404040, 0xFF909090, 0xFFB3B3B3,
+	0xFF929292, 0xFF646464, 0xFF414141, 0xFF323232, 0xFF2E2E2E, 0xFF2F2F2F, 0xFF363636, 0xFF3F3F3F,
+	0xFF464646, 0xFF444444, 0xFF404040, 0xFF393939, 0xFF383838, 0xFF3B3B3B, 0xFF424242, 0xFF535353,
+	0xFF797979, 0xFFAAAAAA, 0xFFE2E2E2, 0xFFF5F5F5, 0xFFB7B7B7, 0xFF626262, 0xFF353535, 0xFF232323,
+	0xFF171717, 0xFF101010, 0xFF0E0E0E, 0xFF0F0F0F, 0xFF141414, 0xFF1E1E1E, 0xFF2E2E2E, 0xFF515151,
+	0xFF7E7E7E, 0xFF757575, 0xFF6D6D6D, 0xFF747474, 0xFF6E6E6E, 0xFF505050, 0xFF3A3A3A, 0xFF2C2C2C,
+	0xFF222222, 0xFF1B1B1B, 0xFF171717, 0xFF181818, 0xFF1D1D1D, 0xFF1F1F1F, 0xFF1E1E1E, 0xFF1D1D1D,
+	0xFF1E1E1E, 0xFF1F1F1F, 0xFF1F1F1F, 0xFF1F1F1F, 0xFF1F1F1F, 0xFF202020, 0xFF232323, 0xFF2A2A2A,
+	0xFF2E2E2E, 0xFF292929, 0xFF272727, 0xFF2D2D2D, 0xFF343434, 0xFF414141, 0xFF585858, 0xFF656565,
+	0xFF434343, 0xFF2C2C2C, 0xFF202020, 0xFF161616, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF0C0C0C, 0xFF0E0E0E,
+	0xFF131313, 0xFF1C1C1C, 0xFF282828, 0xFF3D3D3D, 0xFF5A5A5A, 0xFF868686, 0xFF8B8B8B, 0xFF7D7D7D,
+	0xFF757575, 0xFF6C6C6C, 0xFF616161, 0xFF555555, 0xFF4D4D4D, 0xFF484848, 0xFF434343, 0xFF424242,
+	0xFF404040, 0xFF424242, 0xFF4B4B4B, 0xFF4F4F4F, 0xFF4C4C4C, 0xFF484848, 0xFF454545, 0xFF404040,
+	0xFF282828, 0xFF141414, 0xFF0A0A0A, 0xFF060606, 0xFF040404, 0xFF060606, 0xFF0A0A0A, 0xFF101010,
+	0xFF1F1F1F, 0xFF343434, 0xFF545454, 0xFF989898, 0xFFFBFBFB, 0xFFBBBBBB, 0xFF515151, 0xFF2A2A2A,
+	0xFF131313, 0xFF090909, 0xFF030303, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF010101, 0xFF040404, 0xFF080808, 0xFF131313, 0xFF202020, 0xFF3F3F3F, 0xFF8A8A8A, 0xFFECECEC,
+	0xFFCCCCCC, 0xFF767676, 0xFF505050, 0xFF414141, 0xFF3C3C3C, 0xFF3E3E3E, 0xFF454545, 0xFF464646,
+	0xFF3B3B3B, 0xFF2F2F2F, 0xFF272727, 0xFF222222, 0xFF1F1F1F, 0xFF1D1D1D, 0xFF1F1F1F, 0xFF242424,
+	0xFF2F2F2F, 0xFF3B3B3B, 0xFF5B5B5B, 0xFF9F9F9F, 0xFFEBEBEB, 0xFFE1E1E1, 0xFF828282, 0xFF434343,
+	0xFF2A2A2A, 0xFF1D1D1D, 0xFF181818, 0xFF161616, 0xFF1B1B1B, 0xFF222222, 0xFF323232, 0xFF565656,
+	0xFF727272, 0xFF646464, 0xFF616161, 0xFF6A6A6A, 0xFF656565, 0xFF484848, 0xFF323232, 0xFF262626,
+	0xFF1C1C1C, 0xFF161616, 0xFF131313, 0xFF131313, 0xFF171717, 0xFF1F1F1F, 0xFF262626, 0xFF2C2C2C,
+	0xFF2F2F2F, 0xFF303030, 0xFF323232, 0xFF343434, 0xFF363636, 0xFF363636, 0xFF363636, 0xFF2F2F2F,
+	0xFF272727, 0xFF212121, 0xFF202020, 0xFF222222, 0xFF272727, 0xFF313131, 0xFF444444, 0xFF5A5A5A,
+	0xFF464646, 0xFF2B2B2B, 0xFF1C1C1C, 0xFF141414, 0xFF0D0D0D, 0xFF080808, 0xFF090909, 0xFF0C0C0C,
+	0xFF101010, 0xFF181818, 0xFF272727, 0xFF3E3E3E, 0xFF646464, 0xFFB2B2B2, 0xFFE9E9E9, 0xFFD5D5D5,
+	0xFFAFAFAF, 0xFF8F8F8F, 0xFF7A7A7A, 0xFF686868, 0xFF5D5D5D, 0xFF535353, 0xFF4A4A4A, 0xFF424242,
+	0xFF404040, 0xFF3E3E3E, 0xFF3B3B3B, 0xFF3A3A3A, 0xFF393939, 0xFF383838, 0xFF353535, 0xFF323232,
+	0xFF272727, 0xFF131313, 0xFF090909, 0xFF050505, 0xFF030303, 0xFF030303, 0xFF050505, 0xFF0A0A0A,
+	0xFF171717, 0xFF262626, 0xFF3E3E3E, 0xFF686968, 0xFFCAC9CA, 0xFFE9E9E9, 0xFF717171, 0xFF353535,
+	0xFF1B1B1B, 0xFF0E0E0E, 0xFF070707, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF050505, 0xFF080808, 0xFF0F0F0F, 0xFF1A1A1A, 0xFF2A2A2A, 0xFF4C4C4C, 0xFF999999, 0xFFFCFCFC,
+	0xFFE3E3E3, 0xFF868686, 0xFF5D5D5D, 0xFF4D4D4D, 0xFF494949, 0xFF4B4B4B, 0xFF545454, 0xFF494949,
+	0xFF363636, 0xFF282828, 0xFF1D1D1D, 0xFF161616, 0xFF111111, 0xFF0E0E0E, 0xFF0F0F0F, 0xFF121212,
+	0xFF171717, 0xFF222222, 0xFF2A2A2A, 0xFF3C3C3C, 0xFF737373, 0xFFD2D2D2, 0xFFD9D9D9, 0xFF878787,
+	0xFF484848, 0xFF2E2E2E, 0xFF222222, 0xFF1D1D1D, 0xFF212121, 0xFF262626, 0xFF353535, 0xFF555555,
+	0xFF5B5B5B, 0xFF505050, 0xFF525252, 0xFF5A5A5A, 0xFF626262, 0xFF484848, 0xFF303030, 0xFF212121,
+	0xFF181818, 0xFF141414, 0xFF121212, 0xFF101010, 0xFF141414, 0xFF191919, 0xFF252525, 0xFF3B3B3B,
+	0xFF4A4A4A, 0xFF4F4F4F, 0xFF515151, 0xFF575757, 0xFF575757, 0xFF4B4B4B, 0xFF383838, 0xFF2A2A2A,
+	0xFF242424, 0xFF1D1D1D, 0xFF1C1C1C, 0xFF1D1D1D, 0xFF202020, 0xFF2A2A2A, 0xFF3A3A3A, 0xFF545454,
+	0xFF505050, 0xFF2E2E2E, 0xFF1E1E1E, 0xFF141414, 0xFF0D0D0D, 0xFF080808, 0xFF090909, 0xFF0C0C0C,
+	0xFF0F0F0F, 0xFF171717, 0xFF272727, 0xFF404040, 0xFF6D6D6D, 0xFFCACACA, 0xFFFFFFFF, 0xFFE0E0E0,
+	0xFF979797, 0xFF717171, 0xFF5F5F5F, 0xFF535253, 0xFF4B4B4B, 0xFF424242, 0xFF3A3A3A, 0xFF363636,
+	0xFF333333, 0xFF313131, 0xFF2F2F2F, 0xFF2F2F2F, 0xFF303030, 0xFF303030, 0xFF2E2E2E, 0xFF2A2A2A,
+	0xFF272727, 0xFF171717, 0xFF0A0A0A, 0xFF050505, 0xFF030303, 0xFF020202, 0xFF030303, 0xFF070707,
+	0xFF0F0F0F, 0xFF1C1C1C, 0xFF2E2E2E, 0xFF4A494A, 0xFF828282, 0xFFEDEDED, 0xFFA9A9A9, 0xFF474747,
+	0xFF272727, 0xFF141414, 0xFF0B0B0B, 0xFF070707, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF030303,
+	0xFF0C0C0C, 0xFF131313, 0xFF1A1A1A, 0xFF292929, 0xFF3F3F3F, 0xFF676767, 0xFF949494, 0xFFB5B5B5,
+	0xFFBBBBBB, 0xFF878787, 0xFF616161, 0xFF535253, 0xFF515051, 0xFF555555, 0xFF616161, 0xFF585858,
+	0xFF393939, 0xFF282828, 0xFF1C1C1C, 0xFF121212, 0xFF0D0D0D, 0xFF090909, 0xFF0A0A0A, 0xFF0A0A0A,
+	0xFF0D0D0D, 0xFF121212, 0xFF1A1A1A, 0xFF242424, 0xFF3A3A3A, 0xFF737373, 0xFF9C9C9C, 0xFF9F9F9F,
+	0xFF737373, 0xFF434343, 0xFF2E2E2E, 0xFF242424, 0xFF232323, 0xFF282828, 0xFF373737, 0xFF494949,
+	0xFF444444, 0xFF3F3F3F, 0xFF424242, 0xFF484848, 0xFF595959, 0xFF4D4D4D, 0xFF2F2F2F, 0xFF212121,
+	0xFF181818, 0xFF131313, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF111111, 0xFF171717, 0xFF232323, 0xFF373737,
+	0xFF646464, 0xFF8A8A8A, 0xFF999999, 0xFF929292, 0xFF666666, 0xFF464646, 0xFF343434, 0xFF282828,
+	0xFF212121, 0xFF1A1A1A, 0xFF181818, 0xFF191919, 0xFF202020, 0xFF272727, 0xFF353535, 0xFF4E4E4E,
+	0xFF5D5D5D, 0xFF3C3C3C, 0xFF262626, 0xFF181818, 0xFF101010, 0xFF0C0C0C, 0xFF090909, 0xFF0C0C0C,
+	0xFF0F0F0F, 0xFF161616, 0xFF252525, 0xFF3E3E3E, 0xFF727272, 0xFFACACAC, 0xFFBABABA, 0xFFB3B3B3,
+	0xFF828282, 0xFF606060, 0xFF505050, 0xFF464646, 0xFF414141, 0xFF3B3B3B, 0xFF353535, 0xFF323232,
+	0xFF2F2F2F, 0xFF2E2E2E, 0xFF2E2E2E, 0xFF2E2E2E, 0xFF303030, 0xFF2E2E2E, 0xFF2C2C2C, 0xFF292929,
+	0xFF282828, 0xFF1E1E1E, 0xFF0E0E0E, 0xFF060606, 0xFF030303, 0xFF020202, 0xFF020202, 0xFF050505,
+	0xFF0A0A0A, 0xFF131313, 0xFF222222, 0xFF383838, 0xFF5A5A5A, 0xFFBEBEBE, 0xFFE2E2E2, 0xFF6F6F6F,
+	0xFF393939, 0xFF202020, 0xFF101010, 0xFF090909, 0xFF030303, 0xFF020202, 0xFF060606, 0xFF090909,
+	0xFF0E0E0E, 0xFF181818, 0xFF242424, 0xFF333333, 0xFF464646, 0xFF555555, 0xFF5F5F5F, 0xFF676767,
+	0xFF737373, 0xFF747474, 0xFF5E5E5E, 0xFF545354, 0xFF535353, 0xFF585858, 0xFF656565, 0xFF6E6E6E,
+	0xFF4D4D4D, 0xFF2D2D2D, 0xFF1C1C1C, 0xFF121212, 0xFF0D0D0D, 0xFF090909, 0xFF070707, 0xFF070707,
+	0xFF090909, 0xFF0A0A0A, 0xFF0F0F0F, 0xFF181818, 0xFF292929, 0xFF494949, 0xFF595959, 0xFF5E5E5E,
+	0xFF626262, 0xFF545454, 0xFF3B3B3B, 0xFF2A2A2A, 0xFF272727, 0xFF292929, 0xFF343434, 0xFF343434,
+	0xFF2F2F2F, 0xFF2E2E2E, 0xFF323232, 0xFF383838, 0xFF494949, 0xFF4E4E4E, 0xFF353535, 0xFF222322,
+	0xFF181818, 0xFF131313, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF101010, 0xFF161616, 0xFF232323, 0xFF383838,
+	0xFF636363, 0xFFCACACA, 0xFFF9F9F9, 0xFFA3A3A3, 0xFF5D5C5D, 0xFF424242, 0xFF303030, 0xFF242424,
+	0xFF1D1D1D, 0xFF1A1A1A, 0xFF181818, 0xFF191919, 0xFF202020, 0xFF272727, 0xFF353535, 0xFF4B4B4B,
+	0xFF696969, 0xFF545454, 0xFF323232, 0xFF1E1E1E, 0xFF141414, 0xFF101010, 0xFF0C0C0C, 0xFF0C0C0C,
+	0xFF0F0F0F, 0xFF161616, 0xFF232323, 0xFF3C3B3C, 0xFF676767, 0xFF767676, 0xFF737373, 0xFF7F7F7F,
+	0xFF7F7F7F, 0xFF646464, 0xFF515151, 0xFF484848, 0xFF424242, 0xFF3C3C3C, 0xFF353535, 0xFF323232,
+	0xFF2F2F2F, 0xFF2F2F2F, 0xFF2F2F2F, 0xFF2F2F2F, 0xFF303030, 0xFF2F2F2F, 0xFF2E2E2E, 0xFF2D2D2D,
+	0xFF2A2A2A, 0xFF242424, 0xFF141414, 0xFF090909, 0xFF030303, 0xFF020202, 0xFF020202, 0xFF030303,
+	0xFF060606, 0xFF0E0E0E, 0xFF191919, 0xFF2C2C2C, 0xFF454545, 0xFF8B8B8B, 0xFFF9F9F9, 0xFFB0B0B0,
+	0xFF4C4C4C, 0xFF262626, 0xFF151515, 0xFF0B0B0B, 0xFF070707, 0xFF020202, 0xFF060606, 0xFF090909,
+	0xFF0C0C0C, 0xFF131313, 0xFF1F1F1F, 0xFF292929, 0xFF333333, 0xFF3A3A3A, 0xFF404040, 0xFF444344,
+	0xFF484848, 0xFF4F4F4F, 0xFF515151, 0xFF4C4C4C, 0xFF4C4C4C, 0xFF535353, 0xFF5F5F5F, 0xFF757575,
+	0xFF6D6D6D, 0xFF404040, 0xFF252525, 0xFF171717, 0xFF0E0E0E, 0xFF0B0B0B, 0xFF070707, 0xFF070707,
+	0xFF080808, 0xFF090909, 0xFF0D0D0D, 0xFF141414, 0xFF232323, 0xFF353535, 0xFF383838, 0xFF383838,
+	0xFF383838, 0xFF3B3B3B, 0xFF363636, 0xFF2F2F2F, 0xFF2A2A2A, 0xFF272727, 0xFF262626, 0xFF242424,
+	0xFF222222, 0xFF232323, 0xFF272727, 0xFF2C2C2C, 0xFF3B3B3B, 0xFF4D4D4D, 0xFF3F3F3F, 0xFF282928,
+	0xFF1B1B1B, 0xFF121212, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF111111, 0xFF171717, 0xFF232323, 0xFF3A3A3A,
+	0xFF6D6D6D, 0xFFC8C8C8, 0xFFDEDEDE, 0xFF989898, 0xFF595959, 0xFF3F3F3F, 0xFF2E2E2E, 0xFF252525,
+	0xFF1E1E1E, 0xFF1A1A1A, 0xFF181818, 0xFF191919, 0xFF202020, 0xFF282828, 0xFF363636, 0xFF4D4D4D,
+	0xFF737373, 0xFF737373, 0xFF454545, 0xFF2B2B2B, 0xFF1B1B1B, 0xFF141414, 0xFF101010, 0xFF0F0F0F,
+	0xFF101010, 0xFF171717, 0xFF232323, 0xFF363636, 0xFF575757, 0xFF5A5A5A, 0xFF565656, 0xFF5B5B5B,
+	0xFF676767, 0xFF6E6E6E, 0xFF616161, 0xFF535353, 0xFF4B4B4B, 0xFF444444, 0xFF3F3F3F, 0xFF3C3C3C,
+	0xFF373737, 0xFF363636, 0xFF373737, 0xFF383838, 0xFF383838, 0xFF383838, 0xFF383838, 0xFF363636,
+	0xFF313131, 0xFF2A2A2A, 0xFF1B1B1B, 0xFF0D0D0D, 0xFF070707, 0xFF040404, 0xFF030303, 0xFF030303,
+	0xFF070707, 0xFF0D0D0D, 0xFF161616, 0xFF262626, 0xFF3C3C3C, 0xFF676767, 0xFFD1D1D1, 0xFFD4D4D4,
+	0xFF5A5A5A, 0xFF2B2B2B, 0xFF181818, 0xFF0E0E0E, 0xFF090909, 0xFF040404, 0xFF060606, 0xFF090909,
+	0xFF0C0C0C, 0xFF121212, 0xFF191919, 0xFF222222, 0xFF272727, 0xFF2D2D2D, 0xFF323232, 0xFF323232,
+	0xFF323232, 0xFF323232, 0xFF393939, 0xFF404040, 0xFF424242, 0xFF494949, 0xFF565656, 0xFF686868,
+	0xFF828282, 0xFF646464, 0xFF353535, 0xFF202020, 0xFF131313, 0xFF0D0D0D, 0xFF0A0A0A, 0xFF070707,
+	0xFF090909, 0xFF0B0B0B, 0xFF0F0F0F, 0xFF181818, 0xFF222222, 0xFF232323, 0xFF222222, 0xFF212121,
+	0xFF202020, 0xFF212121, 0xFF212121, 0xFF212121, 0xFF1F1F1F, 0xFF1C1C1C, 0xFF1A1A1A, 0xFF1A1A1A,
+	0xFF1A1A1A, 0xFF1B1B1B, 0xFF1F1F1F, 0xFF252525, 0xFF333333, 0xFF464646, 0xFF4A4A4A, 0xFF323232,
+	0xFF212121, 0xFF171717, 0xFF141414, 0xFF121212, 0xFF141414, 0xFF191919, 0xFF272727, 0xFF414141,
+	0xFF747474, 0xFF808080, 0xFF747474, 0xFF787878, 0xFF5F5F5F, 0xFF424242, 0xFF303030, 0xFF262626,
+	0xFF1F1F1F, 0xFF1C1C1C, 0xFF1C1C1C, 0xFF1D1D1D, 0xFF232323, 0xFF2B2B2B, 0xFF393939, 0xFF505050,
+	0xFF777777, 0xFF959595, 0xFF5F5F5F, 0xFF3B3B3B, 0xFF262626, 0xFF1C1C1C, 0xFF151515, 0xFF141414,
+	0xFF131313, 0xFF181818, 0xFF222222, 0xFF333333, 0xFF4A4A4A, 0xFF4A4A4A, 0xFF464646, 0xFF494949,
+	0xFF505050, 0xFF606060, 0xFF737373, 0xFF737373, 0xFF656565, 0xFF585858, 0xFF505050, 0xFF4C4C4C,
+	0xFF484848, 0xFF494949, 0xFF4A4A4A, 0xFF4A4A4A, 0xFF4B4B4B, 0xFF4C4C4C, 0xFF4A4A4A, 0xFF474747,
+	0xFF424242, 0xFF3B3B3B, 0xFF292929, 0xFF171717, 0xFF0D0D0D, 0xFF070707, 0xFF050505, 0xFF060606,
+	0xFF090909, 0xFF0D0D0D, 0xFF161616, 0xFF222222, 0xFF313131, 0xFF4A4A4A, 0xFF828282, 0xFFBFBFBF,
+	0xFF686868, 0xFF313131, 0xFF1C1C1C, 0xFF111111, 0xFF0A0A0A, 0xFF070707, 0xFF060606, 0xFF090909,
+	0xFF0C0C0C, 0xFF101010, 0xFF161616, 0xFF1C1C1C, 0xFF202020, 0xFF232323, 0xFF262626, 0xFF262626,
+	0xFF252525, 0xFF242424, 0xFF282828, 0xFF2F2F2F, 0xFF363636, 0xFF3F3F3F, 0xFF4C4C4C, 0xFF5C5C5C,
+	0xFF7A7A7A, 0xFF8E8E8E, 0xFF585858, 0xFF313131, 0xFF222222, 0xFF171717, 0xFF111111, 0xFF101010,
+	0xFF121212, 0xFF141414, 0xFF1A1A1A, 0xFF1D1D1D, 0xFF1A1A1A, 0xFF161616, 0xFF151515, 0xFF141414,
+	0xFF131313, 0xFF141414, 0xFF151515, 0xFF141414, 0xFF131313, 0xFF131313, 0xFF121212, 0xFF121212,
+	0xFF141414, 0xFF171717, 0xFF1C1C1C, 0xFF232323, 0xFF2D2D2D, 0xFF3D3D3D, 0xFF515151, 0xFF434343,
+	0xFF2C2C2C, 0xFF212121, 0xFF1A1A1A, 0xFF171717, 0xFF1A1A1A, 0xFF212121, 0xFF333333, 0xFF4D4D4D,
+	0xFF565656, 0xFF444444, 0xFF404040, 0xFF494949, 0xFF555555, 0xFF494949, 0xFF373737, 0xFF2C2C2C,
+	0xFF232323, 0xFF202020, 0xFF202020, 0xFF212121, 0xFF272727, 0xFF313131, 0xFF3E3E3E, 0xFF555555,
+	0xFF797979, 0xFFAFAFAF, 0xFF8C8C8C, 0xFF4F4E4F, 0xFF343434, 0xFF262626, 0xFF1C1C1C, 0xFF171717,
+	0xFF151515, 0xFF181818, 0xFF202020, 0xFF2B2B2B, 0xFF3E3E3E, 0xFF434343, 0xFF404040, 0xFF404040,
+	0xFF454545, 0xFF4F4F4F, 0xFF666666, 0xFF8B8B8B, 0xFF9D9D9D, 0xFF898989, 0xFF757575, 0xFF6D6D6D,
+	0xFF676767, 0xFF606060, 0xFF545454, 0xFF4E4E4E, 0xFF515151, 0xFF5A5A5A, 0xFF696969, 0xFF6E6E6E,
+	0xFF606060, 0xFF545454, 0xFF424242, 0xFF252525, 0xFF161616, 0xFF0D0D0D, 0xFF0A0A0A, 0xFF0B0B0B,
+	0xFF0D0D0D, 0xFF131313, 0xFF1B1B1B, 0xFF222222, 0xFF2A2A2A, 0xFF393939, 0xFF505050, 0xFF808080,
+	0xFF6B6B6B, 0xFF333333, 0xFF1D1D1D, 0xFF121212, 0xFF0B0B0B, 0xFF080808, 0xFF070707, 0xFF090909,
+	0xFF0C0C0C, 0xFF101010, 0xFF131313, 0xFF191919, 0xFF1C1C1C, 0xFF1E1E1E, 0xFF1F1F1F, 0xFF1E1E1E,
+	0xFF1D1D1D, 0xFF1C1C1C, 0xFF1F1F1F, 0xFF222222, 0xFF292929, 0xFF353535, 0xFF404040, 0xFF525252,
+	0xFF6A6A6A, 0xFF959595, 0xFF999999, 0xFF545454, 0xFF363636, 0xFF272727, 0xFF202020, 0xFF1E1E1E,
+	0xFF1F1F1F, 0xFF202020, 0xFF1E1E1E, 0xFF161616, 0xFF101010, 0xFF0D0D0D, 0xFF0C0C0C, 0xFF0B0B0B,
+	0xFF0B0B0B, 0xFF0B0B0B, 0xFF0C0C0C, 0xFF0C0C0C, 0xFF0C0C0C, 0xFF0E0E0E, 0xFF0F0F0F, 0xFF0E0E0E,
+	0xFF111111, 0xFF151515, 0xFF1B1B1B, 0xFF212121, 0xFF2B2B2B, 0xFF393939, 0xFF4E4D4E, 0xFF565656,
+	0xFF3E3E3E, 0xFF2B2B2B, 0xFF252525, 0xFF222222, 0xFF252525, 0xFF2D2D2D, 0xFF3F3F3F, 0xFF404040,
+	0xFF323232, 0xFF292929, 0xFF262626, 0xFF2B2B2B, 0xFF3A3A3A, 0xFF4A4A4A, 0xFF3F3F3F, 0xFF343434,
+	0xFF2C2C2C, 0xFF282828, 0xFF282828, 0xFF292929, 0xFF303030, 0xFF3A3A3A, 0xFF494949, 0xFF5F5F5F,
+	0xFF808080, 0xFFB9B9B9, 0xFFBEBEBE, 0xFF6D6D6D, 0xFF474747, 0xFF313131, 0xFF222222, 0xFF1B1B1B,
+	0xFF181818, 0xFF181818, 0xFF1E1E1E, 0xFF242424, 0xFF313131, 0xFF3F3F3F, 0xFF3C3C3C, 0xFF3B3B3B,
+	0xFF404040, 0xFF4B4B4B, 0xFF5F5F5F, 0xFF7F7F7F, 0xFFC5C5C5, 0xFFE2E2E2, 0xFFC4C4C4, 0xFFA2A2A2,
+	0xFF7E7E7E, 0xFF5E5E5E, 0xFF4D4D4D, 0xFF434343, 0xFF3F3F3F, 0xFF464646, 0xFF5E5E5E, 0xFF868686,
+	0xFF9A9A9A, 0xFF8F8F8F, 0xFF707070, 0xFF434343, 0xFF282828, 0xFF1B1B1B, 0xFF151515, 0xFF151515,
+	0xFF191919, 0xFF1E1E1E, 0xFF202020, 0xFF242424, 0xFF272727, 0xFF2E2E2E, 0xFF3B3B3B, 0xFF4E4E4E,
+	0xFF5A5A5A, 0xFF353535, 0xFF1D1D1D, 0xFF121212, 0xFF0B0B0B, 0xFF080808, 0xFF080808, 0xFF090909,
+	0xFF0C0C0C, 0xFF101010, 0xFF141414, 0xFF181818, 0xFF1A1A1A, 0xFF1B1B1B, 0xFF1A1A1A, 0xFF181818,
+	0xFF171717, 0xFF161616, 0xFF181818, 0xFF1B1B1B, 0xFF202020, 0xFF292929, 0xFF363636, 0xFF484848,
+	0xFF626262, 0xFF888888, 0xFFC4C4C4, 0xFFA6A6A6, 0xFF5F5F5F, 0xFF464646, 0xFF3A3A3A, 0xFF373737,
+	0xFF2F2F2F, 0xFF242424, 0xFF191919, 0xFF111111, 0xFF0C0C0C, 0xFF0A0A0A, 0xFF070707, 0xFF060606,
+	0xFF080808, 0xFF080808, 0xFF090909, 0xFF090909, 0xFF0B0B0B, 0xFF0C0C0C, 0xFF0C0C0C, 0xFF0E0E0E,
+	0xFF131313, 0xFF171717, 0xFF1E1E1E, 0xFF252525, 0xFF2F2F2F, 0xFF3B3B3B, 0xFF484748, 0xFF575657,
+	0xFF575757, 0xFF484848, 0xFF3C3C3C, 0xFF363636, 0xFF393939, 0xFF3B3B3B, 0xFF343434, 0xFF272727,
+	0xFF1C1C1C, 0xFF181818, 0xFF181818, 0xFF1B1B1B, 0xFF262626, 0xFF3B3B3B, 0xFF4A4A4A, 0xFF3F3F3F,
+	0xFF383838, 0xFF353535, 0xFF333433, 0xFF383838, 0xFF3C3C3C, 0xFF424242, 0xFF4A4A4A, 0xFF5F5F5F,
+	0xFF878787, 0xFFB6B6B6, 0xFFE2E2E2, 0xFF9A9A9A, 0xFF575757, 0xFF3D3D3D, 0xFF2A2A2A, 0xFF1F1F1F,
+	0xFF1A1A1A, 0xFF181818, 0xFF1B1B1B, 0xFF1E1E1E, 0xFF262626, 0xFF323232, 0xFF393939, 0xFF3B3B3B,
+	0xFF404040, 0xFF4B4B4B, 0xFF606060, 0xFF828282, 0xFFC9C9C9, 0xFFFFFFFF, 0xFFF8F8F8, 0xFFABACAB,
+	0xFF757575, 0xFF565656, 0xFF454545, 0xFF3B3B3B, 0xFF343434, 0xFF373737, 0xFF3F3F3F, 0xFF585858,
+	0xFF8C8C8C, 0xFFCDCDCD, 0xFFCECECE, 0xFF909090, 0xFF545454, 0xFF353535, 0xFF2E2E2E, 0xFF2B2B2B,
+	0xFF2E2E2E, 0xFF2B2B2B, 0xFF272727, 0xFF262626, 0xFF272727, 0xFF292929, 0xFF2E2E2E, 0xFF343434,
+	0xFF404040, 0xFF323232, 0xFF202020, 0xFF131313, 0xFF0E0E0E, 0xFF090909, 0xFF080808, 0xFF0A0A0A,
+	0xFF0D0D0D, 0xFF101010, 0xFF131313, 0xFF161616, 0xFF171717, 0xFF181818, 0xFF161616, 0xFF141414,
+	0xFF141414, 0xFF141414, 0xFF141414, 0xFF161616, 0xFF1A1A1A, 0xFF1F1F1F, 0xFF292929, 0xFF393939,
+	0xFF555555, 0xFF7E7E7E, 0xFFC6C6C6, 0xFFFBFBFB, 0xFFC1C1C1, 0xFF858585, 0xFF5F5F5F, 0xFF464646,
+	0xFF2F2F2F, 0xFF1E1E1E, 0xFF151515, 0xFF0E0E0E, 0xFF090909, 0xFF070707, 0xFF050505, 0xFF040404,
+	0xFF030303, 0xFF050505, 0xFF080808, 0xFF090909, 0xFF0B0B0B, 0xFF0C0C0C, 0xFF0D0D0D, 0xFF101010,
+	0xFF171717, 0xFF1D1D1D, 0xFF242424, 0xFF2C2C2C, 0xFF353535, 0xFF424242, 0xFF4A4A4A, 0xFF4F4F4F,
+	0xFF535353, 0xFF535353, 0xFF4B4B4B, 0xFF434343, 0xFF383838, 0xFF2C2C2C, 0xFF1F1F1F, 0xFF181818,
+	0xFF101010, 0xFF0F0F0F, 0xFF101010, 0xFF131313, 0xFF1A1A1A, 0xFF292929, 0xFF484848, 0xFF525252,
+	0xFF464646, 0xFF444444, 0xFF434343, 0xFF474747, 0xFF3F3F3F, 0xFF393939, 0xFF3B3B3B, 0xFF4D4D4D,
+	0xFF747474, 0xFFAFAFAF, 0xFFE8E8E8, 0xFFD1D1D1, 0xFF737373, 0xFF494849, 0xFF333233, 0xFF232323,
+	0xFF1C1C1C, 0xFF181818, 0xFF171717, 0xFF181818, 0xFF1D1D1D, 0xFF242424, 0xFF2E2E2E, 0xFF393939,
+	0xFF414241, 0xFF4F4F4F, 0xFF636363, 0xFF828282, 0xFFA8A8A8, 0xFFD6D6D6, 0xFFE3E3E3, 0xFF9B9B9B,
+	0xFF6B6B6B, 0xFF4D4D4D, 0xFF3D3D3D, 0xFF323232, 0xFF2E2E2E, 0xFF2C2C2C, 0xFF2F2F2F, 0xFF373737,
+	0xFF4C4C4C, 0xFF7F7F7F, 0xFFD2D2D2, 0xFFF6F6F6, 0xFFCFCFCF, 0xFF929192, 0xFF6D6D6D, 0xFF5A5A5A,
+	0xFF4D4D4D, 0xFF3F3F3F, 0xFF353535, 0xFF2C2C2C, 0xFF272727, 0xFF252525, 0xFF252525, 0xFF252525,
+	0xFF272727, 0xFF282828, 0xFF202020, 0xFF151515, 0xFF0F0F0F, 0xFF0C0C0C, 0xFF0C0C0C, 0xFF0D0D0D,
+	0xFF101010, 0xFF111111, 0xFF111111, 0xFF121212, 0xFF111111, 0xFF101010, 0xFF0C0C0C, 0xFF0C0C0C,
+	0xFF0C0C0C, 0xFF0D0D0D, 0xFF0F0F0F, 0xFF111111, 0xFF141414, 0xFF181818, 0xFF202020, 0xFF2B2B2B,
+	0xFF3E3E3E, 0xFF5C5C5C, 0xFF909090, 0xFFDFDFDF, 0xFFF4F4F4, 0xFFA1A1A1, 0xFF616161, 0xFF404040,
+	0xFF2B2B2B, 0xFF1D1D1D, 0xFF141414, 0xFF0C0C0C, 0xFF080808, 0xFF060606, 0xFF050505, 0xFF040404,
+	0xFF030303, 0xFF040404, 0xFF080808, 0xFF0A0A0A, 0xFF0D0D0D, 0xFF111111, 0xFF151515, 0xFF191919,
+	0xFF1F1F1F, 0xFF282828, 0xFF333333, 0xFF3C3C3C, 0xFF474747, 0xFF4E4E4E, 0xFF505050, 0xFF505150,
+	0xFF4B4B4B, 0xFF454545, 0xFF3D3D3D, 0xFF313131, 0xFF252525, 0xFF1B1B1B, 0xFF141414, 0xFF101010,
+	0xFF0B0B0B, 0xFF090909, 0xFF090909, 0xFF0C0C0C, 0xFF111111, 0xFF1E1E1E, 0xFF3A3A3A, 0xFF5F605F,
+	0xFF616161, 0xFF5D5C5D, 0xFF5E5D5E, 0xFF4F4F4F, 0xFF3A3A3A, 0xFF333333, 0xFF353535, 0xFF404040,
+	0xFF5B5B5B, 0xFF949494, 0xFFD8D8D8, 0xFFF0F0F0, 0xFF9C9C9C, 0xFF595959, 0xFF3B3A3B, 0xFF292929,
+	0xFF1D1D1D, 0xFF171717, 0xFF151515, 0xFF141414, 0xFF151515, 0xFF191919, 0xFF1F1F1F, 0xFF292929,
+	0xFF333433, 0xFF424242, 0xFF4E4E4E, 0xFF5E5E5E, 0xFF717171, 0xFF929292, 0xFFBABABA, 0xFF929192,
+	0xFF636363, 0xFF484848, 0xFF393939, 0xFF2E2E2E, 0xFF282828, 0xFF262626, 0xFF242424, 0xFF262626,
+	0xFF313131, 0xFF414141, 0xFF5E5E5E, 0xFFA0A0A0, 0xFFE0E0E0, 0xFFF9F9F9, 0xFFE8E8E8, 0xFFBCBCBC,
+	0xFF898989, 0xFF636363, 0xFF4A4A4A, 0xFF383838, 0xFF2C2C2C, 0xFF232323, 0xFF1E1E1E, 0xFF1B1B1B,
+	0xFF181818, 0xFF181818, 0xFF181818, 0xFF151515, 0xFF101010, 0xFF0F0F0F, 0xFF0D0D0D, 0xFF0D0D0D,
+	0xFF0D0D0D, 0xFF0D0D0D, 0xFF0A0A0A, 0xFF0A0A0A, 0xFF080808, 0xFF070707, 0xFF080808, 0xFF080808,
+	0xFF080808, 0xFF090909, 0xFF0F0F0F, 0xFF0F0F0F, 0xFF111111, 0xFF151515, 0xFF1B1B1B, 0xFF242424,
+	0xFF313131, 0xFF404040, 0xFF5A5A5A, 0xFF848484, 0xFFB5B5B5, 0xFF8D8D8D, 0xFF565656, 0xFF3B3B3B,
+	0xFF292929, 0xFF1B1B1B, 0xFF141414, 0xFF0C0C0C, 0xFF080808, 0xFF060606, 0xFF050505, 0xFF050505,
+	0xFF070707, 0xFF080808, 0xFF0A0A0A, 0xFF0D0D0D, 0xFF111111, 0xFF161616, 0xFF1B1B1B, 0xFF1E1E1E,
+	0xFF242424, 0xFF2E2E2E, 0xFF3B3B3B, 0xFF4B4B4B, 0xFF5A5A5A, 0xFF636363, 0xFF616161, 0xFF565656,
+	0xFF4A4A4A, 0xFF3E3E3E, 0xFF303030, 0xFF262626, 0xFF1C1C1C, 0xFF131313, 0xFF0E0E0E, 0xFF0A0A0A,
+	0xFF060606, 0xFF060606, 0xFF060606, 0xFF060606, 0xFF0C0C0C, 0xFF161616, 0xFF2B2B2B, 0xFF585858,
+	0xFF818181, 0xFF7E7E7E, 0xFF7B7B7B, 0xFF555555, 0xFF3A3A3A, 0xFF323232, 0xFF323232, 0xFF3B3B3B,
+	0xFF505050, 0xFF7E7E7E, 0xFFBFBFBF, 0xFFE9E9E9, 0xFFBFBFBF, 0xFF666666, 0xFF424242, 0xFF2C2C2C,
+	0xFF1D1D1D, 0xFF151515, 0xFF111111, 0xFF101010, 0xFF0F0F0F, 0xFF111111, 0xFF161616, 0xFF1B1B1B,
+	0xFF232323, 0xFF303030, 0xFF3A3A3A, 0xFF4A4A4A, 0xFF5D5D5D, 0xFF7A7A7A, 0xFFA0A0A0, 0xFF868686,
+	0xFF5D5D5D, 0xFF464646, 0xFF353535, 0xFF2B2B2B, 0xFF232323, 0xFF1F1F1F, 0xFF1E1E1E, 0xFF202020,
+	0xFF242424, 0xFF2B2B2B, 0xFF353535, 0xFF464646, 0xFF656565, 0xFF8E8E8E, 0xFFB3B3B3, 0xFFC1C1C1,
+	0xFFADADAD, 0xFF8F8F8F, 0xFF6C6C6C, 0xFF4D4D4D, 0xFF363636, 0xFF262626, 0xFF1C1C1C, 0xFF171717,
+	0xFF111111, 0xFF0F0F0F, 0xFF0F0F0F, 0xFF0F0F0F, 0xFF0F0F0F, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF0D0D0D,
+	0xFF040404, 0xFF040404, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF040404,
+	0xFF090909, 0xFF0B0B0B, 0xFF101010, 0xFF101010, 0xFF111111, 0xFF151515, 0xFF171717, 0xFF1F1F1F,
+	0xFF272727, 0xFF333333, 0xFF454545, 0xFF575757, 0xFF717171, 0xFF767676, 0xFF4E4E4E, 0xFF353535,
+	0xFF252525, 0xFF1B1B1B, 0xFF141414, 0xFF0E0E0E, 0xFF0A0A0A, 0xFF080808, 0xFF090909, 0xFF080808,
+	0xFF0A0A0A, 0xFF0E0E0E, 0xFF101010, 0xFF151515, 0xFF1B1B1B, 0xFF1B1B1B, 0xFF1D1D1D, 0xFF222222,
+	0xFF282828, 0xFF323232, 0xFF3D3D3D, 0xFF4A494A, 0xFF595959, 0xFF696969, 0xFF717171, 0xFF636363,
+	0xFF4D4D4D, 0xFF3B3B3B, 0xFF2C2C2C, 0xFF212121, 0xFF171717, 0xFF101010, 0xFF0D0D0D, 0xFF070707,
+	0xFF030303, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF090909, 0xFF111111, 0xFF212121, 0xFF444444,
+	0xFF8D8D8D, 0xFFABABAB, 0xFF9B9B9B, 0xFF5E5E5E, 0xFF3F3F3F, 0xFF363636, 0xFF333333, 0xFF3A3A3A,
+	0xFF4E4E4E, 0xFF767676, 0xFFADADAD, 0xFFCCCCCC, 0xFFC9C9C9, 0xFF757575, 0xFF454545, 0xFF2B2B2B,
+	0xFF1D1D1D, 0xFF131313, 0xFF0E0E0E, 0xFF0D0D0D, 0xFF0B0B0B, 0xFF0D0D0D, 0xFF121212, 0xFF161616,
+	0xFF1C1C1C, 0xFF272727, 0xFF343434, 0xFF444444, 0xFF555555, 0xFF757575, 0xFF9B9B9B, 0xFF7E7E7E,
+	0xFF5C5C5C, 0xFF464646, 0xFF353535, 0xFF2B2B2B, 0xFF242424, 0xFF1E1E1E, 0xFF1B1B1B, 0xFF1B1B1B,
+	0xFF1B1B1B, 0xFF1E1E1E, 0xFF232323, 0xFF2B2B2B, 0xFF353535, 0xFF3F3F3F, 0xFF4A4A4A, 0xFF535353,
+	0xFF5A5A5A, 0xFF5C5C5C, 0xFF5A5A5A, 0xFF4E4E4E, 0xFF404040, 0xFF2C2C2C, 0xFF1D1D1D, 0xFF131313,
+	0xFF0E0E0E, 0xFF0A0A0A, 0xFF070707, 0xFF070707, 0xFF070707, 0xFF050505, 0xFF050505, 0xFF050505,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303,
+	0xFF090909, 0xFF0C0C0C, 0xFF101010, 0xFF101010, 0xFF111111, 0xFF151515, 0xFF161616, 0xFF1C1C1C,
+	0xFF232323, 0xFF2A2A2A, 0xFF363636, 0xFF3F3F3F, 0xFF4B4B4B, 0xFF575757, 0xFF454545, 0xFF2F2F2F,
+	0xFF222222, 0xFF1A1A1A, 0xFF141414, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF0C0C0C, 0xFF0D0D0D, 0xFF0F0F0F,
+	0xFF121212, 0xFF171717, 0xFF1B1B1B, 0xFF1D1D1D, 0xFF1F1F1F, 0xFF202020, 0xFF242424, 0xFF2C2C2C,
+	0xFF343434, 0xFF3C3C3C, 0xFF454545, 0xFF4F4F4F, 0xFF575857, 0xFF606060, 0xFF6A6A6A, 0xFF6D6D6D,
+	0xFF555555, 0xFF3B3B3B, 0xFF2B2B2B, 0xFF1D1D1D, 0xFF131313, 0xFF0F0F0F, 0xFF0B0B0B, 0xFF050505,
+	0xFF020202, 0xFF010101, 0xFF010101, 0xFF020202, 0xFF070707, 0xFF0E0E0E, 0xFF1B1B1B, 0xFF363636,
+	0xFF767676, 0xFFD1D1D1, 0xFFC7C7C7, 0xFF717171, 0xFF494849, 0xFF3B3B3B, 0xFF383838, 0xFF3F3F3F,
+	0xFF535353, 0xFF787878, 0xFFA4A4A4, 0xFFB0B0B0, 0xFFBCBCBC, 0xFF7D7D7D, 0xFF444444, 0xFF2B2B2B,
+	0xFF1B1B1B, 0xFF101010, 0xFF0C0C0C, 0xFF0A0A0A, 0xFF090909, 0xFF0A0A0A, 0xFF0F0F0F, 0xFF141414,
+	0xFF191919, 0xFF252525, 0xFF323232, 0xFF424242, 0xFF585858, 0xFF828282, 0xFFA2A2A2, 0xFF7B7B7B,
+	0xFF5B5B5B, 0xFF464646, 0xFF363636, 0xFF2B2B2B, 0xFF242424, 0xFF1F1F1F, 0xFF191919, 0xFF181818,
+	0xFF161616, 0xFF161616, 0xFF191919, 0xFF1E1E1E, 0xFF202020, 0xFF242424, 0xFF282828, 0xFF2E2E2E,
+	0xFF323232, 0xFF333333, 0xFF363636, 0xFF343434, 0xFF353535, 0xFF2F2F2F, 0xFF1F1F1F, 0xFF131313,
+	0xFF0D0D0D, 0xFF090909, 0xFF030303, 0xFF020202, 0xFF010101, 0xFF000000, 0xFF010101, 0xFF010101,
+	0xFF030303, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF060606,
+	0xFF0D0D0D, 0xFF101010, 0xFF101010, 0xFF121212, 0xFF131313, 0xFF151515, 0xFF1A1A1A, 0xFF1B1B1B,
+	0xFF202020, 0xFF252525, 0xFF2C2C2C, 0xFF333333, 0xFF383838, 0xFF3D3D3D, 0xFF383838, 0xFF2A2A2A,
+	0xFF202020, 0xFF1B1B1B, 0xFF161616, 0xFF121212, 0xFF121212, 0xFF111111, 0xFF141414, 0xFF181818,
+	0xFF1B1B1B, 0xFF1E1E1E, 0xFF212121, 0xFF222222, 0xFF262626, 0xFF2B2B2B, 0xFF323232, 0xFF3B3B3B,
+	0xFF444444, 0xFF4E4E4E, 0xFF575757, 0xFF5F5F5F, 0xFF616161, 0xFF626262, 0xFF616161, 0xFF636363,
+	0xFF5A5A5A, 0xFF3F3F3F, 0xFF2C2C2C, 0xFF1E1E1E, 0xFF141414, 0xFF0E0E0E, 0xFF0B0B0B, 0xFF060606,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF060606, 0xFF0D0D0D, 0xFF181818, 0xFF2E2E2E,
+	0xFF5D5D5D, 0xFFCECECE, 0xFFF4F4F4, 0xFF8F8F8F, 0xFF585858, 0xFF474747, 0xFF404040, 0xFF474847,
+	0xFF5C5C5C, 0xFF838383, 0xFF989898, 0xFF989898, 0xFFA8A8A8, 0xFF7D7D7D, 0xFF424342, 0xFF2B2B2B,
+	0xFF1C1C1C, 0xFF111111, 0xFF0B0B0B, 0xFF090909, 0xFF080808, 0xFF090909, 0xFF0D0D0D, 0xFF121212,
+	0xFF1A1A1A, 0xFF272727, 0xFF353535, 0xFF494949, 0xFF686868, 0xFF9E9E9E, 0xFFB1B1B1, 0xFF7E7E7E,
+	0xFF606060, 0xFF4E4E4E, 0xFF404040, 0xFF323232, 0xFF282828, 0xFF242424, 0xFF1D1D1D, 0xFF181818,
+	0xFF141414, 0xFF141414, 0xFF141414, 0xFF151515, 0xFF161616, 0xFF191919, 0xFF1C1C1C, 0xFF1F1F1F,
+	0xFF212121, 0xFF252525, 0xFF272727, 0xFF292929, 0xFF2D2D2D, 0xFF2E2E2E, 0xFF232323, 0xFF141414,
+	0xFF0C0C0C, 0xFF060606, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF090909,
+	0xFF121212, 0xFF141414, 0xFF141414, 0xFF151515, 0xFF151515, 0xFF181818, 0xFF1A1A1A, 0xFF1C1C1C,
+	0xFF1F1F1F, 0xFF242424, 0xFF262626, 0xFF282828, 0xFF2A2A2A, 0xFF2B2B2B, 0xFF2A2A2A, 0xFF272727,
+	0xFF1F1F1F, 0xFF1B1B1B, 0xFF1A1A1A, 0xFF171717, 0xFF171717, 0xFF171717, 0xFF191919, 0xFF1A1A1A,
+	0xFF1C1C1C, 0xFF1F1F1F, 0xFF232323, 0xFF282828, 0xFF313131, 0xFF3D3D3D, 0xFF494949, 0xFF595959,
+	0xFF696969, 0xFF747474, 0xFF7B7B7B, 0xFF7C7C7C, 0xFF757575, 0xFF6D6D6D, 0xFF656565, 0xFF5D5D5D,
+	0xFF515151, 0xFF434343, 0xFF2F2F2F, 0xFF1F1F1F, 0xFF151515, 0xFF0F0F0F, 0xFF0B0B0B, 0xFF060606,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF010101, 0xFF050505, 0xFF0C0C0C, 0xFF171717, 0xFF2A2A2A,
+	0xFF4E4F4E, 0xFFAEAEAE, 0xFFFFFFFF, 0xFFB8B8B8, 0xFF6B6B6B, 0xFF565656, 0xFF504F50, 0xFF565656,
+	0xFF6C6C6C, 0xFF8D8D8D, 0xFF898989, 0xFF878787, 0xFF919191, 0xFF757575, 0xFF444444, 0xFF2C2C2C,
+	0xFF1B1B1B, 0xFF101010, 0xFF0A0A0A, 0xFF090909, 0xFF080808, 0xFF090909, 0xFF0D0D0D, 0xFF121212,
+	0xFF1D1D1D, 0xFF2B2B2B, 0xFF3F3F3F, 0xFF5B5A5B, 0xFF868686, 0xFFD4D4D4, 0xFFC4C4C4, 0xFF8D8D8D,
+	0xFF707070, 0xFF5B5B5B, 0xFF4A4A4A, 0xFF3C3C3C, 0xFF323232, 0xFF292929, 0xFF212121, 0xFF1D1D1D,
+	0xFF161616, 0xFF141414, 0xFF141414, 0xFF141414, 0xFF121212, 0xFF131313, 0xFF151515, 0xFF191919,
+	0xFF1C1C1C, 0xFF202020, 0xFF242424, 0xFF292929, 0xFF2C2C2C, 0xFF313131, 0xFF2B2B2B, 0xFF171717,
+	0xFF0D0D0D, 0xFF070707, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF090909, 0xFF121212,
+	0xFF191919, 0xFF181818, 0xFF181818, 0xFF191919, 0xFF1A1A1A, 0xFF1B1B1B, 0xFF1E1E1E, 0xFF1F1F1F,
+	0xFF212121, 0xFF232323, 0xFF232323, 0xFF232323, 0xFF222222, 0xFF212121, 0xFF1E1E1E, 0xFF1C1C1C,
+	0xFF181818, 0xFF151515, 0xFF151515, 0xFF141414, 0xFF131313, 0xFF131313, 0xFF131313, 0xFF151515,
+	0xFF1B1B1B, 0xFF202020, 0xFF292929, 0xFF363636, 0xFF474747, 0xFF5D5D5D, 0xFF7C7C7C, 0xFF939393,
+	0xFF919191, 0xFF858585, 0xFF838383, 0xFF888888, 0xFF909090, 0xFF838383, 0xFF6E6E6E, 0xFF5C5C5C,
+	0xFF4C4C4C, 0xFF3B3B3B, 0xFF2F2F2F, 0xFF222222, 0xFF181818, 0xFF131313, 0xFF0C0C0C, 0xFF070707,
+	0xFF040404, 0xFF020202, 0xFF010101, 0xFF020202, 0xFF050505, 0xFF0D0D0D, 0xFF161616, 0xFF292929,
+	0xFF474747, 0xFF909090, 0xFFF8F8F8, 0xFFE2E2E2, 0xFF8E8E8E, 0xFF6B6B6B, 0xFF636363, 0xFF6D6D6D,
+	0xFF868686, 0xFF8A8A8A, 0xFF787878, 0xFF737373, 0xFF7C7C7C, 0xFF6D6D6D, 0xFF444444, 0xFF2C2C2C,
+	0xFF1C1C1C, 0xFF131313, 0xFF0C0C0C, 0xFF0A0A0A, 0xFF0B0B0B, 0xFF0E0E0E, 0xFF111111, 0xFF1A1A1A,
+	0xFF272727, 0xFF393939, 0xFF545454, 0xFF7D7D7D, 0xFFC8C8C8, 0xFFFFFFFF, 0xFFD8D8D8, 0xFF9C9C9C,
+	0xFF7E7E7E, 0xFF6C6C6C, 0xFF5F5F5F, 0xFF505050, 0xFF404040, 0xFF353535, 0xFF2B2B2B, 0xFF222222,
+	0xFF1D1D1D, 0xFF161616, 0xFF141414, 0xFF141414, 0xFF141414, 0xFF131313, 0xFF141414, 0xFF181818,
+	0xFF1D1D1D, 0xFF212121, 0xFF262626, 0xFF2C2C2C, 0xFF333333, 0xFF3B3B3B, 0xFF353535, 0xFF1D1D1D,
+	0xFF0F0F0F, 0xFF090909, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF050505, 0xFF0F0F0F, 0xFF1C1C1C,
+	0xFF1F1F1F, 0xFF1F1F1F, 0xFF1E1E1E, 0xFF1F1F1F, 0xFF202020, 0xFF202020, 0xFF212121, 0xFF232323,
+	0xFF232323, 0xFF222222, 0xFF212121, 0xFF202020, 0xFF1D1D1D, 0xFF1B1B1B, 0xFF161616, 0xFF141414,
+	0xFF101010, 0xFF0D0D0D, 0xFF0C0C0C, 0xFF0B0B0B, 0xFF0C0C0C, 0xFF0C0C0C, 0xFF0F0F0F, 0xFF131313,
+	0xFF1A1A1A, 0xFF262626, 0xFF333333, 0xFF4B4B4B, 0xFF717171, 0xFFA1A1A1, 0xFFA7A7A7, 0xFF878787,
+	0xFF6A6A6A, 0xFF5D5D5D, 0xFF5E5E5E, 0xFF656565, 0xFF828282, 0xFF9C9C9C, 0xFF7F7F7F, 0xFF5E5E5E,
+	0xFF474747, 0xFF343434, 0xFF282828, 0xFF1D1D1D, 0xFF141414, 0xFF111111, 0xFF0E0E0E, 0xFF0A0A0A,
+	0xFF070707, 0xFF040404, 0xFF040404, 0xFF060606, 0xFF090909, 0xFF0E0E0E, 0xFF181818, 0xFF272727,
+	0xFF444444, 0xFF818181, 0xFFE6E6E6, 0xFFFCFCFC, 0xFFB7B7B7, 0xFF878787, 0xFF7E7E7E, 0xFF878787,
+	0xFF939393, 0xFF7B7B7B, 0xFF6D6D6D, 0xFF666666, 0xFF6A6A6A, 0xFF686868, 0xFF444444, 0xFF2B2B2B,
+	0xFF1D1D1D, 0xFF151515, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF0F0F0F, 0xFF131313, 0xFF191919, 0xFF252525,
+	0xFF353535, 0xFF505050, 0xFF767676, 0xFFAAAAAA, 0xFFF6F6F6, 0xFFF0F0F0, 0xFFA8A8A8, 0xFF777777,
+	0xFF606060, 0xFF595959, 0xFF5B5B5B, 0xFF616161, 0xFF5A5A5A, 0xFF474747, 0xFF393939, 0xFF2C2C2C,
+	0xFF222222, 0xFF1C1C1C, 0xFF171717, 0xFF151515, 0xFF141414, 0xFF141414, 0xFF151515, 0xFF191919,
+	0xFF1E1E1E, 0xFF242424, 0xFF2C2C2C, 0xFF373737, 0xFF444444, 0xFF545454, 0xFF424242, 0xFF212121,
+	0xFF111111, 0xFF090909, 0xFF030303, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF0A0A0A, 0xFF181818, 0xFF262626,
+	0xFF262626, 0xFF262626, 0xFF262626, 0xFF272727, 0xFF292929, 0xFF2A2A2A, 0xFF292929, 0xFF282828,
+	0xFF252525, 0xFF232323, 0xFF1F1F1F, 0xFF1C1C1C, 0xFF171717, 0xFF141414, 0xFF111111, 0xFF0F0F0F,
+	0xFF0A0A0A, 0xFF080808, 0xFF070707, 0xFF080808, 0xFF080808, 0xFF090909, 0xFF0E0E0E, 0xFF141414,
+	0xFF1E1E1E, 0xFF2F2F2F, 0xFF4A494A, 0xFF7F7F7F, 0xFFB3B3B3, 0xFFA4A4A4, 0xFF787878, 0xFF5C5C5C,
+	0xFF4F4F4F, 0xFF494949, 0xFF4C4C4C, 0xFF525252, 0xFF696A69, 0xFF999999, 0xFF989898, 0xFF676767,
+	0xFF474747, 0xFF313131, 0xFF242424, 0xFF171717, 0xFF0F0F0F, 0xFF0C0C0C, 0xFF0B0B0B, 0xFF0B0B0B,
+	0xFF0B0B0B, 0xFF0A0A0A, 0xFF090909, 0xFF0B0B0B, 0xFF0D0D0D, 0xFF121212, 0xFF1D1D1D, 0xFF2B2B2B,
+	0xFF464646, 0xFF797979, 0xFFD4D4D4, 0xFFFFFFFF, 0xFFE3E3E3, 0xFFACACAC, 0xFF9F9F9F, 0xFFA4A3A4,
+	0xFF8D8D8D, 0xFF6E6E6E, 0xFF606060, 0xFF595959, 0xFF585858, 0xFF5D5D5D, 0xFF4A4A4A, 0xFF313131,
+	0xFF242424, 0xFF1A1A1A, 0xFF141414, 0xFF141414, 0xFF141414, 0xFF1B1B1B, 0xFF242424, 0xFF333333,
+	0xFF4D4D4D, 0xFF616161, 0xFF7A7A7A, 0xFFA3A3A3, 0xFFDBDBDB, 0xFFB1B1B1, 0xFF707070, 0xFF535353,
+	0xFF474747, 0xFF424242, 0xFF454545, 0xFF525252, 0xFF666666, 0xFF686868, 0xFF505050, 0xFF3F3F3F,
+	0xFF303030, 0xFF262626, 0xFF202020, 0xFF1B1B1B, 0xFF191919, 0xFF191919, 0xFF1B1B1B, 0xFF1F1F1F,
+	0xFF242424, 0xFF2F2F2F, 0xFF3A3A3A, 0xFF4B4A4B, 0xFF646464, 0xFF757575, 0xFF474747, 0xFF252525,
+	0xFF151515, 0xFF0A0A0A, 0xFF030303, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF060606, 0xFF111111, 0xFF282828, 0xFF343434,
+	0xFF323232, 0xFF323232, 0xFF333333, 0xFF333333, 0xFF323232, 0xFF2D2D2D, 0xFF252525, 0xFF202020,
+	0xFF1E1E1E, 0xFF1B1B1B, 0xFF191919, 0xFF181818, 0xFF151515, 0xFF121212, 0xFF0E0E0E, 0xFF0C0C0C,
+	0xFF080808, 0xFF050505, 0xFF050505, 0xFF050505, 0xFF060606, 0xFF080808, 0xFF0F0F0F, 0xFF161616,
+	0xFF262626, 0xFF414141, 0xFF7C7C7C, 0xFFABABAB, 0xFF949494, 0xFF6D6D6D, 0xFF585858, 0xFF494949,
+	0xFF424242, 0xFF3F3F3F, 0xFF434343, 0xFF494949, 0xFF5D5D5D, 0xFF8C8C8C, 0xFFADADAD, 0xFF737373,
+	0xFF484848, 0xFF2E2E2E, 0xFF1E1E1E, 0xFF131313, 0xFF0B0B0B, 0xFF090909, 0xFF080808, 0xFF090909,
+	0xFF0A0A0A, 0xFF0E0E0E, 0xFF101010, 0xFF101010, 0xFF121212, 0xFF181818, 0xFF222222, 0xFF303030,
+	0xFF4A4A4A, 0xFF767676, 0xFFC2C2C2, 0xFFFEFEFE, 0xFFFEFEFE, 0xFFDEDEDE, 0xFFC2C2C2, 0xFFA6A6A6,
+	0xFF7E7E7E, 0xFF616161, 0xFF525252, 0xFF4A4A4A, 0xFF484848, 0xFF4D4D4D, 0xFF505050, 0xFF3C3C3C,
+	0xFF2C2C2C, 0xFF222222, 0xFF1D1D1D, 0xFF1E1E1E, 0xFF1F1F1F, 0xFF282828, 0xFF393939, 0xFF4B4B4B,
+	0xFF545454, 0xFF5E5E5E, 0xFF727272, 0xFF999999, 0xFFACACAC, 0xFF777777, 0xFF555455, 0xFF424242,
+	0xFF383838, 0xFF343434, 0xFF363636, 0xFF404040, 0xFF545454, 0xFF737373, 0xFF777777, 0xFF5B5B5B,
+	0xFF444444, 0xFF353535, 0xFF2C2C2C, 0xFF252525, 0xFF212121, 0xFF212121, 0xFF232323, 0xFF292929,
+	0xFF323232, 0xFF424242, 0xFF565656, 0xFF717171, 0xFFA4A4A4, 0xFF898989, 0xFF474747, 0xFF292929,
+	0xFF161616, 0xFF0B0B0B, 0xFF040404, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF0C0C0C, 0xFF1B1B1B, 0xFF393939, 0xFF484848,
+	0xFF454545, 0xFF484848, 0xFF444444, 0xFF343434, 0xFF232323, 0xFF1A1A1A, 0xFF141414, 0xFF121212,
+	0xFF111111, 0xFF0F0F0F, 0xFF111111, 0xFF131313, 0xFF121212, 0xFF0E0E0E, 0xFF0C0C0C, 0xFF090909,
+	0xFF060606, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF060606, 0xFF0A0A0A, 0xFF111111, 0xFF1D1D1D,
+	0xFF343434, 0xFF656565, 0xFF919191, 0xFF7E7F7E, 0xFF636363, 0xFF535353, 0xFF464646, 0xFF3D3D3D,
+	0xFF373737, 0xFF343434, 0xFF393939, 0xFF434343, 0xFF565656, 0xFF7F7F7F, 0xFFB6B6B6, 0xFF848484,
+	0xFF4A4A4A, 0xFF303030, 0xFF1D1D1D, 0xFF121212, 0xFF0A0A0A, 0xFF080808, 0xFF080808, 0xFF090909,
+	0xFF090909, 0xFF0E0E0E, 0xFF161616, 0xFF191919, 0xFF1B1B1B, 0xFF222222, 0xFF2D2D2D, 0xFF393939,
+	0xFF525252, 0xFF7A7A7A, 0xFFB9B9B9, 0xFFFAFAFA, 0xFFFFFFFF, 0xFFF7F7F7, 0xFFC8C8C8, 0xFF959595,
+	0xFF6F6F6F, 0xFF545454, 0xFF444444, 0xFF3B3B3B, 0xFF383838, 0xFF3B3B3B, 0xFF464646, 0xFF494949,
+	0xFF3C3C3C, 0xFF303030, 0xFF2F2F2F, 0xFF303030, 0xFF343434, 0xFF3E3E3E, 0xFF575757, 0xFF5D5D5D,
+	0xFF595959, 0xFF636363, 0xFF787878, 0xFF969696, 0xFF838383, 0xFF595959, 0xFF444344, 0xFF383838,
+	0xFF313131, 0xFF2F2F2F, 0xFF303030, 0xFF383838, 0xFF444444, 0xFF5B5B5B, 0xFF818181, 0xFF858585,
+	0xFF626262, 0xFF494949, 0xFF3E3E3E, 0xFF343434, 0xFF2F2F2F, 0xFF2F2F2F, 0xFF313131, 0xFF393939,
+	0xFF474747, 0xFF616161, 0xFF848484, 0xFFC6C6C6, 0xFFD0D0D0, 0xFF7B7B7B, 0xFF454545, 0xFF2A2A2A,
+	0xFF181818, 0xFF0C0C0C, 0xFF050505, 0xFF010101, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF010101, 0xFF050505, 0xFF111111, 0xFF282828, 0xFF535353, 0xFF646464,
+	0xFF646464, 0xFF5A5A5A, 0xFF373737, 0xFF1E1E1E, 0xFF131313, 0xFF101010, 0xFF0E0E0E, 0xFF0D0D0D,
+	0xFF0B0B0B, 0xFF0C0C0C, 0xFF0D0D0D, 0xFF101010, 0xFF111111, 0xFF0E0E0E, 0xFF0B0B0B, 0xFF080808,
+	0xFF050505, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF060606, 0xFF0B0B0B, 0xFF141414, 0xFF242424,
+	0xFF494949, 0xFF6E6E6E, 0xFF656565, 0xFF575757, 0xFF4C4C4C, 0xFF3F3F3F, 0xFF343434, 0xFF303030,
+	0xFF313131, 0xFF313131, 0xFF353535, 0xFF3E3E3E, 0xFF515151, 0xFF747474, 0xFFB5B5B5, 0xFF9A9A9A,
+	0xFF505050, 0xFF303030, 0xFF1D1D1D, 0xFF101010, 0xFF090909, 0xFF080808, 0xFF090909, 0xFF080808,
+	0xFF090909, 0xFF0F0F0F, 0xFF171717, 0xFF232323, 0xFF2A2A2A, 0xFF2F2F2F, 0xFF383838, 0xFF454545,
+	0xFF5B5B5B, 0xFF7E7E7E, 0xFFB5B5B5, 0xFFF4F4F4, 0xFFFFFFFF, 0xFFF3F3F3, 0xFFB9B9B9, 0xFF858585,
+	0xFF606060, 0xFF484848, 0xFF383838, 0xFF2F2F2F, 0xFF2B2B2B, 0xFF2C2C2C, 0xFF333333, 0xFF404040,
+	0xFF4D4D4D, 0xFF4E4E4E, 0xFF484848, 0xFF474747, 0xFF505050, 0xFF676767, 0xFF797979, 0xFF6C6C6C,
+	0xFF676767, 0xFF717171, 0xFF898989, 0xFF8A8A8A, 0xFF666666, 0xFF4C4C4C, 0xFF3C3C3C, 0xFF333333,
+	0xFF2D2D2D, 0xFF2A2A2A, 0xFF2D2D2D, 0xFF323232, 0xFF3C3C3C, 0xFF4E4E4E, 0xFF696969, 0xFF8F8F8F,
+	0xFF909090, 0xFF6A6A6A, 0xFF545454, 0xFF494949, 0xFF424242, 0xFF414141, 0xFF474747, 0xFF545454,
+	0xFF696969, 0xFF959595, 0xFFDDDDDD, 0xFFF7F7F7, 0xFFABABAB, 0xFF666566, 0xFF424242, 0xFF282828,
+	0xFF171717, 0xFF0D0D0D, 0xFF060606, 0xFF010101, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF030303, 0xFF0B0B0B, 0xFF191919, 0xFF373737, 0xFF7D7D7D, 0xFFA5A5A5,
+	0xFF868686, 0xFF474747, 0xFF242424, 0xFF151515, 0xFF0E0E0E, 0xFF0A0A0A, 0xFF090909, 0xFF090909,
+	0xFF090909, 0xFF0A0A0A, 0xFF0D0D0D, 0xFF101010, 0xFF121212, 0xFF0E0E0E, 0xFF0A0A0A, 0xFF080808,
+	0xFF040404, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF090909, 0xFF0E0E0E, 0xFF181818, 0xFF313131,
+	0xFF515151, 0xFF505050, 0xFF474747, 0xFF434343, 0xFF393939, 0xFF292929, 0xFF1E1E1E, 0xFF1E1E1E,
+	0xFF222222, 0xFF282828, 0xFF313131, 0xFF3D3D3D, 0xFF4E4E4E, 0xFF6C6C6C, 0xFFACACAC, 0xFFB7B7B7,
+	0xFF5E5E5E, 0xFF363636, 0xFF212121, 0xFF131313, 0xFF0C0C0C, 0xFF090909, 0xFF090909, 0xFF0A0A0A,
+	0xFF0D0D0D, 0xFF131313, 0xFF1C1C1C, 0xFF2D2D2D, 0xFF3B3B3B, 0xFF414141, 0xFF494949, 0xFF535353,
+	0xFF656565, 0xFF858585, 0xFFB1B1B1, 0xFFEDEDED, 0xFFFFFFFF, 0xFFF0F0F0, 0xFFB0B0B0, 0xFF787878,
+	0xFF535353, 0xFF3C3C3C, 0xFF2D2D2D, 0xFF232323, 0xFF1F1F1F, 0xFF1F1F1F, 0xFF222222, 0xFF2C2C2C,
+	0xFF3D3D3D, 0xFF565656, 0xFF707070, 0xFF818181, 0xFF949494, 0xFFB7B7B7, 0xFFB3B3B3, 0xFF919191,
+	0xFF8A8A8A, 0xFF929292, 0xFF919191, 0xFF727272, 0xFF595959, 0xFF494949, 0xFF3C3C3C, 0xFF313131,
+	0xFF2B2B2B, 0xFF2B2B2B, 0xFF2D2D2D, 0xFF313131, 0xFF3A3A3A, 0xFF484848, 0xFF5B5B5B, 0xFF777777,
+	0xFF9A9A9A, 0xFF989898, 0xFF797979, 0xFF666666, 0xFF5E5E5E, 0xFF5F5F5F, 0xFF696969, 0xFF7E7F7E,
+	0xFFAEAEAE, 0xFFEDEDED, 0xFFF4F4F4, 0xFFBCBCBC, 0xFF7F7F7F, 0xFF575657, 0xFF3B3A3B, 0xFF262626,
+	0xFF161616, 0xFF0D0D0D, 0xFF090909, 0xFF040404, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF010101, 0xFF020202, 0xFF080808, 0xFF101010, 0xFF232323, 0xFF4A4A4A, 0xFFBABABA, 0xFFE9E9E9,
+	0xFF727272, 0xFF333333, 0xFF1D1D1D, 0xFF121212, 0xFF0D0D0D, 0xFF080808, 0xFF070707, 0xFF080808,
+	0xFF090909, 0xFF0A0A0A, 0xFF0E0E0E, 0xFF121212, 0xFF131313, 0xFF0E0E0E, 0xFF0A0A0A, 0xFF080808,
+	0xFF050505, 0xFF030303, 0xFF030303, 0xFF050505, 0xFF0A0A0A, 0xFF0F0F0F, 0xFF1D1D1D, 0xFF373737,
+	0xFF3C3C3C, 0xFF373737, 0xFF363636, 0xFF353535, 0xFF2A2A2A, 0xFF1A1A1A, 0xFF131313, 0xFF121212,
+	0xFF141414, 0xFF1B1B1B, 0xFF272727, 0xFF353535, 0xFF4B4B4B, 0xFF686868, 0xFF989898, 0xFFCECECE,
+	0xFF818181, 0xFF3F3F3F, 0xFF262626, 0xFF171717, 0xFF111111, 0xFF0B0B0B, 0xFF0A0A0A, 0xFF0D0D0D,
+	0xFF111111, 0xFF1A1A1A, 0xFF262626, 0xFF393939, 0xFF4F4F4F, 0xFF565656, 0xFF5B5B5B, 0xFF646464,
+	0xFF747474, 0xFF8C8C8C, 0xFFB0B0B0, 0xFFE4E4E4, 0xFFFFFFFF, 0xFFF1F1F1, 0xFFA8A8A8, 0xFF6D6D6D,
+	0xFF494949, 0xFF323232, 0xFF222222, 0xFF191919, 0xFF161616, 0xFF141414, 0xFF151515, 0xFF1C1C1C,
+	0xFF282828, 0xFF3B3B3B, 0xFF5A5A5A, 0xFF8C8C8C, 0xFFCFCFCF, 0xFFFFFFFF, 0xFFF8F8F8, 0xFFCDCDCD,
+	0xFFAFAFAF, 0xFF959595, 0xFF7A7A7A, 0xFF656565, 0xFF555555, 0xFF474747, 0xFF3E3E3E, 0xFF353535,
+	0xFF2F2F2F, 0xFF2F2F2F, 0xFF303030, 0xFF323232, 0xFF393939, 0xFF444444, 0xFF545454, 0xFF656565,
+	0xFF7C7C7C, 0xFF999999, 0xFF9D9D9D, 0xFF8F8F8F, 0xFF838383, 0xFF898989, 0xFF9C9C9C, 0xFFBFBFBF,
+	0xFFDDDDDD, 0xFFD2D2D2, 0xFFABABAB, 0xFF828282, 0xFF626262, 0xFF464646, 0xFF323232, 0xFF222222,
+	0xFF161616, 0xFF0F0F0F, 0xFF0B0B0B, 0xFF070707, 0xFF020202, 0xFF010101, 0xFF020202, 0xFF020202,
+	0xFF040404, 0xFF070707, 0xFF0E0E0E, 0xFF1A1A1A, 0xFF313131, 0xFF6D6D6D, 0xFFDFDFDF, 0xFFCFCFCF,
+	0xFF585858, 0xFF2F2F2F, 0xFF1C1C1C, 0xFF121212, 0xFF0D0D0D, 0xFF080808, 0xFF080808, 0xFF090909,
+	0xFF0B0B0B, 0xFF0E0E0E, 0xFF121212, 0xFF171717, 0xFF141414, 0xFF0F0F0F, 0xFF0C0C0C, 0xFF090909,
+	0xFF080808, 0xFF060606, 0xFF060606, 0xFF080808, 0xFF0C0C0C, 0xFF121212, 0xFF232323, 0xFF2C2C2C,
+	0xFF292929, 0xFF292929, 0xFF2A2A2A, 0xFF2A2A2A, 0xFF1F1F1F, 0xFF101010, 0xFF0D0D0D, 0xFF0C0C0C,
+	0xFF0E0E0E, 0xFF111111, 0xFF1B1B1B, 0xFF272727, 0xFF3A3A3A, 0xFF5B5B5B, 0xFF8B8B8B, 0xFFC5C5C5,
+	0xFFB4B4B4, 0xFF575757, 0xFF303030, 0xFF202020, 0xFF161616, 0xFF111111, 0xFF111111, 0xFF121212,
+	0xFF191919, 0xFF232323, 0xFF343434, 0xFF4B4B4B, 0xFF6B6B6B, 0xFF727272, 0xFF6E6E6E, 0xFF737373,
+	0xFF7E7E7E, 0xFF8D8D8D, 0xFFABABAB, 0xFFD2D2D2, 0xFFFDFDFD, 0xFFF5F5F5, 0xFFA5A5A5, 0xFF656565,
+	0xFF414141, 0xFF2A2A2A, 0xFF1B1B1B, 0xFF131313, 0xFF101010, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF121212,
+	0xFF1A1A1A, 0xFF282828, 0xFF3B3B3B, 0xFF585858, 0xFF8E8E8E, 0xFFD2D2D2, 0xFFD3D3D3, 0xFFADADAD,
+	0xFF8F8F8F, 0xFF7B7B7B, 0xFF6E6E6E, 0xFF646464, 0xFF595959, 0xFF4E4E4E, 0xFF434343, 0xFF3D3D3D,
+	0xFF373737, 0xFF333333, 0xFF333333, 0xFF373737, 0xFF3C3C3C, 0xFF454545, 0xFF505050, 0xFF5D5D5D,
+	0xFF6A6A6A, 0xFF7D7D7D, 0xFF8F8F8F, 0xFF979797, 0xFF9C9C9C, 0xFFA6A6A6, 0xFFB1B1B1, 0xFFB3B3B3,
+	0xFFA6A6A6, 0xFF929292, 0xFF7E7E7E, 0xFF656565, 0xFF4E4D4E, 0xFF3A3A3A, 0xFF2B2B2B, 0xFF202020,
+	0xFF171717, 0xFF0F0F0F, 0xFF0C0C0C, 0xFF090909, 0xFF060606, 0xFF050505, 0xFF040404, 0xFF040404,
+	0xFF0C0C0C, 0xFF111111, 0xFF1A1A1A, 0xFF2B2B2B, 0xFF4E4E4E, 0xFF7F7F7F, 0xFF9C9C9C, 0xFF949494,
+	0xFF535353, 0xFF2F2F2F, 0xFF1B1B1B, 0xFF121212, 0xFF0E0E0E, 0xFF0A0A0A, 0xFF090909, 0xFF0B0B0B,
+	0xFF0F0F0F, 0xFF131313, 0xFF191919, 0xFF1B1B1B, 0xFF161616, 0xFF111111, 0xFF0E0E0E, 0xFF0C0C0C,
+	0xFF090909, 0xFF080808, 0xFF080808, 0xFF090909, 0xFF0D0D0D, 0xFF161616, 0xFF212121, 0xFF202020,
+	0xFF212121, 0xFF232323, 0xFF242424, 0xFF242424, 0xFF1A1A1A, 0xFF0D0D0D, 0xFF090909, 0xFF080808,
+	0xFF080808, 0xFF0C0C0C, 0xFF111111, 0xFF1B1B1B, 0xFF282828, 0xFF404040, 0xFF6F6F6F, 0xFFA8A8A8,
+	0xFFCCCCCC, 0xFF939393, 0xFF4B4B4B, 0xFF2E2E2E, 0xFF212121, 0xFF1C1C1C, 0xFF1A1A1A, 0xFF1C1C1C,
+	0xFF242424, 0xFF313131, 0xFF464646, 0xFF646464, 0xFF909090, 0xFF919191, 0xFF868686, 0xFF818181,
+	0xFF828282, 0xFF8E8E8E, 0xFFA1A1A1, 0xFFBCBCBC, 0xFFE7E7E7, 0xFFFAFAFA, 0xFFA6A6A6, 0xFF5E5E5E,
+	0xFF393939, 0xFF242424, 0xFF151515, 0xFF0D0D0D, 0xFF090909, 0xFF070707, 0xFF070707, 0xFF0B0B0B,
+	0xFF121212, 0xFF1A1A1A, 0xFF282828, 0xFF3C3C3C, 0xFF5C5C5C, 0xFF818181, 0xFF8A8A8A, 0xFF7C7C7C,
+	0xFF737373, 0xFF6E6E6E, 0xFF6B6B6B, 0xFF656565, 0xFF5F5F5F, 0xFF575657, 0xFF4C4C4C, 0xFF454545,
+	0xFF404040, 0xFF3C3C3C, 0xFF3A3A3A, 0xFF3C3C3C, 0xFF3F3F3F, 0xFF454545, 0xFF4E4E4E, 0xFF595959,
+	0xFF656565, 0xFF6E6E6E, 0xFF797979, 0xFF818181, 0xFF8A8A8A, 0xFF8E8E8E, 0xFF8D8D8D, 0xFF898989,
+	0xFF808080, 0xFF727272, 0xFF626362, 0xFF535253, 0xFF434343, 0xFF333333, 0xFF282828, 0xFF1E1E1E,
+	0xFF181818, 0xFF131313, 0xFF101010, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF0B0B0B, 0xFF0A0A0A, 0xFF090909,
+	0xFF171717, 0xFF1E1E1E, 0xFF2B2B2B, 0xFF3D3D3D, 0xFF4E4E4E, 0xFF545454, 0xFF5B5B5B, 0xFF6A6A6A,
+	0xFF4F4F4F, 0xFF303030, 0xFF212121, 0xFF171717, 0xFF141414, 0xFF121212, 0xFF131313, 0xFF131313,
+	0xFF181818, 0xFF1C1C1C, 0xFF222222, 0xFF1E1E1E, 0xFF191919, 0xFF141414, 0xFF101010, 0xFF0E0E0E,
+	0xFF0C0C0C, 0xFF0A0A0A, 0xFF0A0A0A, 0xFF0B0B0B, 0xFF0F0F0F, 0xFF161616, 0xFF1C1C1C, 0xFF1A1A1A,
+	0xFF1C1C1C, 0xFF1E1E1E, 0xFF222222, 0xFF232323, 0xFF1B1B1B, 0xFF0D0D0D, 0xFF070707, 0xFF040404,
+	0xFF040404, 0xFF080808, 0xFF0C0C0C, 0xFF141414, 0xFF1E1E1E, 0xFF2B2B2B, 0xFF474747, 0xFF7F7F7F,
+	0xFFAFAFAF, 0xFFB4B4B4, 0xFF858585, 0xFF555555, 0xFF3C3B3C, 0xFF2F2F2F, 0xFF2A2A2A, 0xFF2C2C2C,
+	0xFF363636, 0xFF464646, 0xFF646464, 0xFF959595, 0xFFC6C6C6, 0xFFAEAEAE, 0xFF959595, 0xFF898989,
+	0xFF838383, 0xFF868686, 0xFF8E8E8E, 0xFFA3A3A3, 0xFFC2C2C2, 0xFFEDEDED, 0xFFAFAFAF, 0xFF585858,
+	0xFF313131, 0xFF1D1D1D, 0xFF0F0F0F, 0xFF070707, 0xFF040404, 0xFF020202, 0xFF010101, 0xFF040404,
+	0xFF0B0B0B, 0xFF121212, 0xFF1B1B1B, 0xFF2A2A2A, 0xFF3E3E3E, 0xFF555555, 0xFF686868, 0xFF686868,
+	0xFF696969, 0xFF6A6A6A, 0xFF6B6B6B, 0xFF696969, 0xFF636363, 0xFF5C5C5C, 0xFF575757, 0xFF515151,
+	0xFF4C4D4C, 0xFF474747, 0xFF434343, 0xFF444444, 0xFF474747, 0xFF4B4B4B, 0xFF515151, 0xFF5B5B5B,
+	0xFF646464, 0xFF6B6B6B, 0xFF717171, 0xFF737373, 0xFF787878, 0xFF787878, 0xFF777777, 0xFF737373,
+	0xFF6D6D6D, 0xFF626262, 0xFF575757, 0xFF4A4A4A, 0xFF3C3C3C, 0xFF2F2F2F, 0xFF242424, 0xFF1B1B1B,
+	0xFF161616, 0xFF121212, 0xFF111111, 0xFF111111, 0xFF101010, 0xFF101010, 0xFF121212, 0xFF151515,
+	0xFF171717, 0xFF1C1C1C, 0xFF242424, 0xFF2B2B2B, 0xFF303030, 0xFF373737, 0xFF404040, 0xFF4E4E4E,
+	0xFF4A4A4A, 0xFF333333, 0xFF262626, 0xFF1F1F1F, 0xFF1B1B1B, 0xFF1A1A1A, 0xFF1D1D1D, 0xFF1F1F1F,
+	0xFF232323, 0xFF2A2A2A, 0xFF292929, 0xFF202020, 0xFF1C1C1C, 0xFF181818, 0xFF151515, 0xFF121212,
+	0xFF0F0F0F, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF0E0E0E, 0xFF121212, 0xFF171717, 0xFF191919, 0xFF181818,
+	0xFF1A1A1A, 0xFF1D1D1D, 0xFF222222, 0xFF262626, 0xFF1B1B1B, 0xFF0C0C0C, 0xFF060606, 0xFF030303,
+	0xFF030303, 0xFF050505, 0xFF080808, 0xFF0D0D0D, 0xFF141414, 0xFF1E1E1E, 0xFF303030, 0xFF4F4F4F,
+	0xFF838383, 0xFF959595, 0xFF8E8E8E, 0xFF7D7D7D, 0xFF666666, 0xFF575757, 0xFF4D4D4D, 0xFF4F4F4F,
+	0xFF585858, 0xFF717171, 0xFF9F9F9F, 0xFFE0E0E0, 0xFFF6F5F6, 0xFFC7C7C7, 0xFFA0A0A0, 0xFF888888,
+	0xFF787878, 0xFF6E6E6E, 0xFF747474, 0xFF898989, 0xFFA1A1A1, 0xFFC6C6C6, 0xFFACACAC, 0xFF565656,
+	0xFF2C2C2C, 0xFF171717, 0xFF0B0B0B, 0xFF040404, 0xFF010101, 0xFF020202, 0xFF010101, 0xFF010101,
+	0xFF050505, 0xFF0C0C0C, 0xFF141414, 0xFF202020, 0xFF2C2C2C, 0xFF3B3B3B, 0xFF4D4D4D, 0xFF575757,
+	0xFF5D5D5D, 0xFF606060, 0xFF5B5B5B, 0xFF545454, 0xFF4F4F4F, 0xFF484848, 0xFF464646, 0xFF494949,
+	0xFF4D4D4D, 0xFF525252, 0xFF525152, 0xFF4F4F4F, 0xFF515151, 0xFF545454, 0xFF585858, 0xFF606060,
+	0xFF676767, 0xFF6B6B6B, 0xFF707070, 0xFF717171, 0xFF727272, 0xFF727272, 0xFF6E6E6E, 0xFF686868,
+	0xFF636363, 0xFF5C5C5C, 0xFF525252, 0xFF464646, 0xFF3D3D3D, 0xFF313131, 0xFF222222, 0xFF181818,
+	0xFF121212, 0xFF0D0D0D, 0xFF0B0B0B, 0xFF0C0C0C, 0xFF090909, 0xFF0B0B0B, 0xFF0E0E0E, 0xFF131313,
+	0xFF0D0D0D, 0xFF111111, 0xFF141414, 0xFF1A1A1A, 0xFF212121, 0xFF272727, 0xFF2F2F2F, 0xFF3C3C3C,
+	0xFF464646, 0xFF383838, 0xFF2E2E2E, 0xFF292929, 0xFF282828, 0xFF282828, 0xFF2B2B2B, 0xFF303030,
+	0xFF373737, 0xFF363636, 0xFF2D2D2D, 0xFF262626, 0xFF222222, 0xFF1E1E1E, 0xFF1B1B1B, 0xFF181818,
+	0xFF141414, 0xFF111111, 0xFF0E0E0E, 0xFF0F0F0F, 0xFF141414, 0xFF181818, 0xFF181818, 0xFF181818,
+	0xFF1C1C1C, 0xFF202020, 0xFF262626, 0xFF2D2D2D, 0xFF1F1F1F, 0xFF0E0E0E, 0xFF080808, 0xFF030303,
+	0xFF030303, 0xFF020202, 0xFF050505, 0xFF080808, 0xFF0D0D0D, 0xFF151515, 0xFF1F1F1F, 0xFF2F2F2F,
+	0xFF4F4F4F, 0xFF767676, 0xFF757575, 0xFF696969, 0xFF666666, 0xFF646464, 0xFF696969, 0xFF757575,
+	0xFF858585, 0xFFA9A9A9, 0xFFE6E6E6, 0xFFFFFFFF, 0xFFF2F2F2, 0xFFBDBDBD, 0xFF919191, 0xFF747474,
+	0xFF616161, 0xFF595959, 0xFF636363, 0xFF727272, 0xFF808080, 0xFF9E9E9E, 0xFF9F9F9F, 0xFF565656,
+	0xFF2A2A2A, 0xFF161616, 0xFF090909, 0xFF030303, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF080808, 0xFF101010, 0xFF1A1A1A, 0xFF232323, 0xFF2D2D2D, 0xFF3A3A3A, 0xFF414141,
+	0xFF474747, 0xFF464646, 0xFF414141, 0xFF3C3C3C, 0xFF383838, 0xFF343434, 0xFF343434, 0xFF363636,
+	0xFF3C3C3C, 0xFF484848, 0xFF565656, 0xFF5D5D5D, 0xFF5E5E5E, 0xFF606060, 0xFF646464, 0xFF696969,
+	0xFF6F6F6F, 0xFF737373, 0xFF767676, 0xFF757575, 0xFF747474, 0xFF717171, 0xFF6D6D6D, 0xFF696969,
+	0xFF636363, 0xFF5B5B5B, 0xFF525252, 0xFF494949, 0xFF404040, 0xFF343434, 0xFF252525, 0xFF1A1A1A,
+	0xFF131313, 0xFF0C0C0C, 0xFF090909, 0xFF070707, 0xFF050505, 0xFF040404, 0xFF050505, 0xFF090909,
+	0xFF060606, 0xFF070707, 0xFF0B0B0B, 0xFF101010, 0xFF141414, 0xFF1B1B1B, 0xFF232323, 0xFF2E2E2E,
+	0xFF414141, 0xFF3E3E3E, 0xFF373737, 0xFF363636, 0xFF363636, 0xFF3A393A, 0xFF414141, 0xFF474747,
+	0xFF444444, 0xFF3A3A3A, 0xFF343434, 0xFF2E2E2E, 0xFF2A2A2A, 0xFF272727, 0xFF222222, 0xFF1F1F1F,
+	0xFF1B1B1B, 0xFF171717, 0xFF131313, 0xFF121212, 0xFF161616, 0xFF181818, 0xFF181818, 0xFF1B1B1B,
+	0xFF202020, 0xFF272727, 0xFF2D2D2D, 0xFF353535, 0xFF262626, 0xFF131313, 0xFF0B0B0B, 0xFF040404,
+	0xFF020202, 0xFF010101, 0xFF020202, 0xFF050505, 0xFF080808, 0xFF0F0F0F, 0xFF151515, 0xFF1D1D1D,
+	0xFF2D2D2D, 0xFF484848, 0xFF626262, 0xFF5F5F5F, 0xFF555555, 0xFF535353, 0xFF5B5B5B, 0xFF6A6A6A,
+	0xFF7E7E7E, 0xFFA8A8A8, 0xFFE8E8E8, 0xFFE7E7E7, 0xFFB3B3B3, 0xFF8D8D8D, 0xFF727272, 0xFF5F5F5F,
+	0xFF545454, 0xFF505050, 0xFF545454, 0xFF5E5E5E, 0xFF676767, 0xFF7C7C7C, 0xFF8B8B8B, 0xFF535353,
+	0xFF272727, 0xFF121212, 0xFF070707, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF060606, 0xFF0D0D0D, 0xFF151515, 0xFF1F1F1F, 0xFF272727, 0xFF2F2F2F, 0xFF343434,
+	0xFF373737, 0xFF363636, 0xFF333333, 0xFF313131, 0xFF2F2F2F, 0xFF2C2C2C, 0xFF2C2C2C, 0xFF2F2F2F,
+	0xFF323232, 0xFF3A3A3A, 0xFF474747, 0xFF595959, 0xFF676767, 0xFF6E6E6E, 0xFF757575, 0xFF787878,
+	0xFF7B7B7B, 0xFF7B7B7B, 0xFF7A7A7A, 0xFF777777, 0xFF757575, 0xFF767676, 0xFF737373, 0xFF6D6D6D,
+	0xFF686868, 0xFF606060, 0xFF575757, 0xFF505050, 0xFF4A4A4A, 0xFF404040, 0xFF2D2D2D, 0xFF1F1F1F,
+	0xFF151515, 0xFF0D0D0D, 0xFF090909, 0xFF040404, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303,
+	0xFF030303, 0xFF030303, 0xFF050505, 0xFF0B0B0B, 0xFF0E0E0E, 0xFF141414, 0xFF1C1C1C, 0xFF252525,
+	0xFF3A3A3A, 0xFF454545, 0xFF444444, 0xFF464646, 0xFF4B4B4B, 0xFF545454, 0xFF606060, 0xFF5E5E5E,
+	0xFF4C4C4C, 0xFF424242, 0xFF3D3D3D, 0xFF3A3A3A, 0xFF373737, 0xFF343434, 0xFF2F2F2F, 0xFF2A2A2A,
+	0xFF222222, 0xFF1E1E1E, 0xFF1B1B1B, 0xFF181818, 0xFF1A1A1A, 0xFF1C1C1C, 0xFF1E1E1E, 0xFF232323,
+	0xFF2A2A2A, 0xFF313131, 0xFF3E3E3E, 0xFF484848, 0xFF323232, 0xFF191919, 0xFF0E0E0E, 0xFF060606,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF050505, 0xFF0A0A0A, 0xFF0E0E0E, 0xFF141414,
+	0xFF1B1B1B, 0xFF272727, 0xFF3D3D3D, 0xFF545454, 0xFF565656, 0xFF545454, 0xFF5A5A5A, 0xFF666666,
+	0xFF818181, 0xFFAFAFAF, 0xFFC4C4C4, 0xFFA5A5A5, 0xFF868686, 0xFF757575, 0xFF646464, 0xFF555555,
+	0xFF4B4B4B, 0xFF474747, 0xFF464646, 0xFF4C4C4C, 0xFF565656, 0xFF666666, 0xFF777777, 0xFF4F4F4F,
+	0xFF242424, 0xFF111111, 0xFF080808, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF030303, 0xFF080808, 0xFF0E0E0E, 0xFF151515, 0xFF1F1F1F, 0xFF252525, 0xFF2C2C2C, 0xFF303030,
+	0xFF343434, 0xFF313131, 0xFF2D2D2D, 0xFF2E2E2E, 0xFF2B2B2B, 0xFF2A2A2A, 0xFF2A2A2A, 0xFF2D2D2D,
+	0xFF303030, 0xFF383838, 0xFF414141, 0xFF4D4D4D, 0xFF5D5D5D, 0xFF6C6C6C, 0xFF747474, 0xFF757575,
+	0xFF737373, 0xFF6C6C6C, 0xFF666666, 0xFF636363, 0xFF636363, 0xFF6C6C6C, 0xFF747474, 0xFF767676,
+	0xFF747474, 0xFF6C6C6C, 0xFF656565, 0xFF5F5F5F, 0xFF595959, 0xFF565656, 0xFF414141, 0xFF2A2A2A,
+	0xFF1A1A1A, 0xFF101010, 0xFF0B0B0B, 0xFF040404, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF010101, 0xFF010101, 0xFF020202, 0xFF070707, 0xFF0B0B0B, 0xFF101010, 0xFF181818, 0xFF212121,
+	0xFF363636, 0xFF494949, 0xFF515151, 0xFF5B5B5B, 0xFF676767, 0xFF7C7C7C, 0xFF848484, 0xFF6A6A6A,
+	0xFF585858, 0xFF505050, 0xFF4C4C4C, 0xFF494949, 0xFF484848, 0xFF464646, 0xFF3F3F3F, 0xFF3A3A3A,
+	0xFF313131, 0xFF282828, 0xFF222222, 0xFF1E1E1E, 0xFF1D1D1D, 0xFF1F1F1F, 0xFF252525, 0xFF2F2F2F,
+	0xFF363636, 0xFF414141, 0xFF515151, 0xFF606060, 0xFF404040, 0xFF202020, 0xFF111111, 0xFF0A0A0A,
+	0xFF040404, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF050505, 0xFF070707, 0xFF0C0C0C,
+	0xFF121212, 0xFF1A1A1A, 0xFF242424, 0xFF333333, 0xFF474747, 0xFF555555, 0xFF616161, 0xFF727272,
+	0xFF8A8A8A, 0xFF9B9B9B, 0xFF909090, 0xFF848484, 0xFF777777, 0xFF6D6D6D, 0xFF5C5C5C, 0xFF484848,
+	0xFF3F3F3F, 0xFF3A3A3A, 0xFF3A3A3A, 0xFF3E3E3E, 0xFF484848, 0xFF565656, 0xFF676767, 0xFF4A4A4A,
+	0xFF232323, 0xFF111111, 0xFF080808, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF040404, 0xFF090909, 0xFF0F0F0F, 0xFF171717, 0xFF212121, 0xFF282828, 0xFF2F2F2F, 0xFF333333,
+	0xFF343434, 0xFF323232, 0xFF303030, 0xFF2F2F2F, 0xFF2D2D2D, 0xFF2D2D2D, 0xFF2D2D2D, 0xFF303030,
+	0xFF323232, 0xFF3A3A3A, 0xFF464646, 0xFF525252, 0xFF5E5E5E, 0xFF686868, 0xFF6C6C6C, 0xFF6B6B6B,
+	0xFF676767, 0xFF5E5E5E, 0xFF575757, 0xFF525152, 0xFF4E4E4E, 0xFF515151, 0xFF565656, 0xFF676767,
+	0xFF767676, 0xFF7A7A7A, 0xFF777777, 0xFF717171, 0xFF6D6D6D, 0xFF6C6C6C, 0xFF626262, 0xFF404040,
+	0xFF262626, 0xFF161616, 0xFF0D0D0D, 0xFF060606, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF0A0A0A, 0xFF0D0D0D, 0xFF161616, 0xFF212121,
+	0xFF333333, 0xFF4F4F4F, 0xFF636363, 0xFF787878, 0xFF989898, 0xFFBCBCBC, 0xFF9D9D9D, 0xFF787878,
+	0xFF6C6C6C, 0xFF656565, 0xFF646464, 0xFF696969, 0xFF696969, 0xFF616161, 0xFF525152, 0xFF434343,
+	0xFF383838, 0xFF2F2F2F, 0xFF2B2B2B, 0xFF262626, 0xFF252525, 0xFF242424, 0xFF2A2A2A, 0xFF373737,
+	0xFF4A4A4A, 0xFF5C5C5C, 0xFF717071, 0xFF878787, 0xFF535353, 0xFF292929, 0xFF181818, 0xFF0D0D0D,
+	0xFF070707, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF060606,
+	0xFF0A0A0A, 0xFF0F0F0F, 0xFF151515, 0xFF1D1D1D, 0xFF292929, 0xFF393939, 0xFF4B4B4B, 0xFF5D5C5D,
+	0xFF6B6B6B, 0xFF747474, 0xFF787878, 0xFF7C7C7C, 0xFF747474, 0xFF5B5B5B, 0xFF444444, 0xFF373737,
+	0xFF303030, 0xFF2E2E2E, 0xFF2E2E2E, 0xFF333333, 0xFF3E3E3E, 0xFF4C4C4C, 0xFF5D5D5D, 0xFF444444,
+	0xFF222222, 0xFF121212, 0xFF080808, 0xFF030303, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF040404,
+	0xFF090909, 0xFF101010, 0xFF181818, 0xFF212121, 0xFF292929, 0xFF2E2E2E, 0xFF323232, 0xFF383838,
+	0xFF3B3B3B, 0xFF3B3B3B, 0xFF3A3A3A, 0xFF373737, 0xFF353535, 0xFF373737, 0xFF373737, 0xFF3B3B3B,
+	0xFF3E3E3E, 0xFF454545, 0xFF515151, 0xFF5E5E5E, 0xFF6A6A6A, 0xFF727272, 0xFF727272, 0xFF6C6C6C,
+	0xFF636363, 0xFF565656, 0xFF4B4B4B, 0xFF444444, 0xFF3E3E3E, 0xFF3B3B3B, 0xFF3B3B3B, 0xFF424242,
+	0xFF4C4C4C, 0xFF616161, 0xFF767676, 0xFF838383, 0xFF888888, 0xFF898989, 0xFF8F8F8F, 0xFF717171,
+	0xFF404040, 0xFF272727, 0xFF151515, 0xFF0D0D0D, 0xFF040404, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF070707, 0xFF0C0C0C, 0xFF161616, 0xFF212121,
+	0xFF323232, 0xFF515151, 0xFF797979, 0xFFA9A9A9, 0xFFE6E6E6, 0xFFF1F1F1, 0xFFB8B8B8, 0xFF989898,
+	0xFF8C8C8C, 0xFF868686, 0xFF848484, 0xFF7C7C7C, 0xFF6B6B6B, 0xFF565656, 0xFF464646, 0xFF3D3D3D,
+	0xFF373737, 0xFF323232, 0xFF313131, 0xFF2F2F2F, 0xFF2C2C2C, 0xFF2A2A2A, 0xFF2D2D2D, 0xFF373737,
+	0xFF505050, 0xFF787878, 0xFF9D9D9D, 0xFFB4B4B4, 0xFF6A6A6A, 0xFF343434, 0xFF1C1C1C, 0xFF111111,
+	0xFF090909, 0xFF040404, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303,
+	0xFF050505, 0xFF090909, 0xFF0D0D0D, 0xFF141414, 0xFF1C1C1C, 0xFF272727, 0xFF363636, 0xFF434343,
+	0xFF565556, 0xFF696969, 0xFF7A7A7A, 0xFF7F7F7F, 0xFF646364, 0xFF454545, 0xFF353535, 0xFF2A2A2A,
+	0xFF252525, 0xFF252525, 0xFF272727, 0xFF2E2E2E, 0xFF383838, 0xFF464646, 0xFF565656, 0xFF3F3F3F,
+	0xFF222222, 0xFF131313, 0xFF0A0A0A, 0xFF060606, 0xFF040404, 0xFF030303, 0xFF030303, 0xFF090909,
+	0xFF101010, 0xFF171717, 0xFF232323, 0xFF292929, 0xFF282828, 0xFF2A2A2A, 0xFF2D2D2D, 0xFF323232,
+	0xFF3C3C3C, 0xFF464646, 0xFF494949, 0xFF494949, 0xFF4A4A4A, 0xFF4B4B4B, 0xFF4D4D4D, 0xFF515151,
+	0xFF555555, 0xFF5E5E5E, 0xFF6D6D6D, 0xFF7A7A7A, 0xFF838383, 0xFF858585, 0xFF818181, 0xFF747474,
+	0xFF636363, 0xFF525252, 0xFF434343, 0xFF383838, 0xFF2F2F2F, 0xFF282828, 0xFF272727, 0xFF292929,
+	0xFF2D2D2D, 0xFF343434, 0xFF434343, 0xFF5A5A5A, 0xFF767676, 0xFF969696, 0xFFB1B1B1, 0xFFBEBEBE,
+	0xFF7A7A7A, 0xFF3D3D3D, 0xFF222222, 0xFF121212, 0xFF080808, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF060606, 0xFF0A0A0A, 0xFF0F0F0F, 0xFF181818, 0xFF242424,
+	0xFF393939, 0xFF565656, 0xFF898989, 0xFFDADADA, 0xFFFFFFFF, 0xFFE8E8E8, 0xFFB2B2B2, 0xFF929292,
+	0xFF848484, 0xFF767676, 0xFF676767, 0xFF5B5B5B, 0xFF4F4F4F, 0xFF454545, 0xFF3D3D3D, 0xFF373737,
+	0xFF363636, 0xFF373737, 0xFF3A3A3A, 0xFF3C3C3C, 0xFF363636, 0xFF313131, 0xFF343434, 0xFF3D3D3D,
+	0xFF4E4E4E, 0xFF7B7B7B, 0xFFC5C5C5, 0xFFE2E2E2, 0xFF808080, 0xFF404040, 0xFF222222, 0xFF131313,
+	0xFF0D0D0D, 0xFF070707, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF050505, 0xFF0B0B0B, 0xFF0F0F0F, 0xFF151515, 0xFF1F1F1F, 0xFF2C2C2C, 0xFF3B3B3B,
+	0xFF4E4E4E, 0xFF696969, 0xFF808080, 0xFF696969, 0xFF474747, 0xFF343434, 0xFF282828, 0xFF212121,
+	0xFF212121, 0xFF222222, 0xFF232323, 0xFF2A2A2A, 0xFF353535, 0xFF444444, 0xFF505050, 0xFF393939,
+	0xFF242424, 0xFF171717, 0xFF0F0F0F, 0xFF0A0A0A, 0xFF0B0B0B, 0xFF0A0A0A, 0xFF0B0B0B, 0xFF0F0F0F,
+	0xFF171717, 0xFF242424, 0xFF2B2B2B, 0xFF282828, 0xFF232323, 0xFF242424, 0xFF282828, 0xFF2C2C2C,
+	0xFF333333, 0xFF3F3F3F, 0xFF4D4D4D, 0xFF585858, 0xFF606060, 0xFF676767, 0xFF6C6C6C, 0xFF737373,
+	0xFF7C7C7C, 0xFF8B8B8B, 0xFF9D9D9D, 0xFFADADAD, 0xFFB8B8B8, 0xFFB4B4B4, 0xFF9F9F9F, 0xFF838383,
+	0xFF6A6A6A, 0xFF525252, 0xFF3F3F3F, 0xFF303030, 0xFF232323, 0xFF1E1E1E, 0xFF1B1B1B, 0xFF1B1B1B,
+	0xFF1A1A1A, 0xFF1D1D1D, 0xFF242424, 0xFF2C2C2C, 0xFF393939, 0xFF565656, 0xFF898989, 0xFFD2D2D2,
+	0xFFDFDFDF, 0xFF737373, 0xFF353535, 0xFF1F1F1F, 0xFF101010, 0xFF080808, 0xFF020202, 0xFF020202,
+	0xFF010101, 0xFF010101, 0xFF040404, 0xFF090909, 0xFF0E0E0E, 0xFF141414, 0xFF1D1D1D, 0xFF2A2A2A,
+	0xFF404040, 0xFF606060, 0xFF979797, 0xFFEAEAEA, 0xFFDCDCDC, 0xFF929292, 0xFF6E6E6E, 0xFF5A5A5A,
+	0xFF525252, 0xFF4B4B4B, 0xFF454545, 0xFF424242, 0xFF3C3C3C, 0xFF393939, 0xFF383838, 0xFF363636,
+	0xFF373737, 0xFF3C3C3C, 0xFF434343, 0xFF4B4B4B, 0xFF454545, 0xFF3C3C3C, 0xFF3D3D3D, 0xFF444444,
+	0xFF535353, 0xFF767676, 0xFFD2D2D2, 0xFFFDFDFD, 0xFF979797, 0xFF4B4B4B, 0xFF2A2A2A, 0xFF181818,
+	0xFF101010, 0xFF090909, 0xFF060606, 0xFF030303, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF050505, 0xFF090909, 0xFF0C0C0C, 0xFF111111, 0xFF1A1A1A, 0xFF282828, 0xFF3A3A3A,
+	0xFF525252, 0xFF757575, 0xFF707070, 0xFF4D4D4D, 0xFF383838, 0xFF2A2A2A, 0xFF212121, 0xFF1D1D1D,
+	0xFF1D1D1D, 0xFF1E1E1E, 0xFF222222, 0xFF282828, 0xFF343434, 0xFF454545, 0xFF494949, 0xFF363636,
+	0xFF282828, 0xFF1C1C1C, 0xFF151515, 0xFF121212, 0xFF121212, 0xFF121212, 0xFF151515, 0xFF1C1C1C,
+	0xFF292929, 0xFF303030, 0xFF272727, 0xFF222222, 0xFF1F1F1F, 0xFF1E1E1E, 0xFF202020, 0xFF252525,
+	0xFF2B2B2B, 0xFF363636, 0xFF424242, 0xFF4D4D4D, 0xFF595959, 0xFF646464, 0xFF6A6A6A, 0xFF767676,
+	0xFF848484, 0xFF989898, 0xFFB0B0B0, 0xFFD1D1D1, 0xFFF3F3F3, 0xFFF7F7F7, 0xFFDCDCDC, 0xFFA6A6A6,
+	0xFF757575, 0xFF545454, 0xFF3B3B3B, 0xFF292929, 0xFF1C1C1C, 0xFF151515, 0xFF111111, 0xFF101010,
+	0xFF0E0E0E, 0xFF0F0F0F, 0xFF111111, 0xFF151515, 0xFF1E1E1E, 0xFF282828, 0xFF3D3D3D, 0xFF757575,
+	0xFFE0E0E0, 0xFFDDDDDD, 0xFF686868, 0xFF333333, 0xFF1C1C1C, 0xFF0E0E0E, 0xFF060606, 0xFF020202,
+	0xFF060606, 0xFF060606, 0xFF090909, 0xFF0E0E0E, 0xFF151515, 0xFF1B1B1B, 0xFF252525, 0xFF363636,
+	0xFF4D4D4D, 0xFF747474, 0xFFB5B5B5, 0xFFD7D7D7, 0xFF8C8C8C, 0xFF5A5A5A, 0xFF484848, 0xFF3F3F3F,
+	0xFF383838, 0xFF343434, 0xFF333333, 0xFF313131, 0xFF2F2F2F, 0xFF2F2F2F, 0xFF313131, 0xFF343434,
+	0xFF3C3C3C, 0xFF434343, 0xFF4F4F4F, 0xFF5D5D5D, 0xFF575757, 0xFF4B4B4B, 0xFF484848, 0xFF4D4D4D,
+	0xFF5D5D5D, 0xFF7E7E7E, 0xFFD0D0D0, 0xFFFFFFFF, 0xFFA8A8A8, 0xFF545454, 0xFF303030, 0xFF1E1E1E,
+	0xFF131313, 0xFF0B0B0B, 0xFF090909, 0xFF070707, 0xFF030303, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF050505, 0xFF080808, 0xFF0A0A0A, 0xFF111111, 0xFF1B1B1B, 0xFF292929, 0xFF3C3C3C,
+	0xFF616161, 0xFF717171, 0xFF515151, 0xFF3B3B3B, 0xFF2F2F2F, 0xFF232323, 0xFF1D1D1D, 0xFF1D1D1D,
+	0xFF1D1D1D, 0xFF1E1E1E, 0xFF232323, 0xFF2B2B2B, 0xFF3B3B3B, 0xFF454545, 0xFF3D3D3D, 0xFF353535,
+	0xFF2C2C2C, 0xFF242424, 0xFF222222, 0xFF202020, 0xFF202020, 0xFF232323, 0xFF272727, 0xFF353535,
+	0xFF3A3A3A, 0xFF2D2D2D, 0xFF212121, 0xFF1C1C1C, 0xFF191919, 0xFF181818, 0xFF191919, 0xFF1E1E1E,
+	0xFF242424, 0xFF2C2C2C, 0xFF373737, 0xFF424242, 0xFF4D4D4D, 0xFF575757, 0xFF5D5D5D, 0xFF6A6A6A,
+	0xFF797979, 0xFF909090, 0xFFAEAEAE, 0xFFD4D4D4, 0xFFF3F3F3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFDEDEDE,
+	0xFF8E8E8E, 0xFF5A5A5A, 0xFF3C3C3C, 0xFF282828, 0xFF181818, 0xFF0F0F0F, 0xFF0A0A0A, 0xFF070707,
+	0xFF040404, 0xFF060606, 0xFF070707, 0xFF0B0B0B, 0xFF101010, 0xFF151515, 0xFF202020, 0xFF343434,
+	0xFF737373, 0xFFECECEC, 0xFFC7C6C7, 0xFF555555, 0xFF2B2B2B, 0xFF171717, 0xFF0E0E0E, 0xFF070707,
+	0xFF0C0C0C, 0xFF0C0C0C, 0xFF0D0D0D, 0xFF131313, 0xFF1B1B1B, 0xFF232323, 0xFF2F2F2F, 0xFF444444,
+	0xFF606060, 0xFF909090, 0xFFCECECE, 0xFFA0A0A0, 0xFF5D5D5D, 0xFF444444, 0xFF353535, 0xFF2D2D2D,
+	0xFF292929, 0xFF262626, 0xFF272727, 0xFF262626, 0xFF292929, 0xFF2A2A2A, 0xFF2D2D2D, 0xFF343434,
+	0xFF3E3E3E, 0xFF494949, 0xFF5B5B5B, 0xFF717171, 0xFF6C6C6C, 0xFF5C5C5C, 0xFF585858, 0xFF585758,
+	0xFF666666, 0xFF878787, 0xFFD6D5D6, 0xFFFFFFFF, 0xFFB3B3B3, 0xFF5D5D5D, 0xFF373737, 0xFF222222,
+	0xFF151515, 0xFF0F0F0F, 0xFF0B0B0B, 0xFF090909, 0xFF080808, 0xFF060606, 0xFF060606, 0xFF060606,
+	0xFF050505, 0xFF060606, 0xFF090909, 0xFF0B0B0B, 0xFF121212, 0xFF1C1C1C, 0xFF2B2B2B, 0xFF444444,
+	0xFF656565, 0xFF565656, 0xFF404040, 0xFF313131, 0xFF272727, 0xFF1F1F1F, 0xFF1C1C1C, 0xFF1A1A1A,
+	0xFF1C1C1C, 0xFF1E1E1E, 0xFF252525, 0xFF303030, 0xFF373737, 0xFF363636, 0xFF333333, 0xFF323232,
+	0xFF313131, 0xFF313131, 0xFF333333, 0xFF343434, 0xFF373737, 0xFF414141, 0xFF4A4A4A, 0xFF464646,
+	0xFF333333, 0xFF242424, 0xFF181818, 0xFF141414, 0xFF121212, 0xFF121212, 0xFF141414, 0xFF161616,
+	0xFF1C1C1C, 0xFF242424, 0xFF2C2C2C, 0xFF373737, 0xFF424242, 0xFF4C4C4C, 0xFF545454, 0xFF606060,
+	0xFF707070, 0xFF8A8A8A, 0xFF999999, 0xFF9C9C9C, 0xFFA4A4A4, 0xFFC2C2C2, 0xFFF4F3F4, 0xFFFFFFFF,
+	0xFFBBBBBB, 0xFF656565, 0xFF3B3B3B, 0xFF262626, 0xFF151515, 0xFF0B0B0B, 0xFF040404, 0xFF020202,
+	0xFF010101, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF060606, 0xFF0B0B0B, 0xFF141414, 0xFF212121,
+	0xFF3B3B3B, 0xFF949494, 0xFFF6F6F6, 0xFF9D9D9D, 0xFF424142, 0xFF252525, 0xFF171717, 0xFF0F0F0F,
+	0xFF141414, 0xFF141414, 0xFF161616, 0xFF1B1B1B, 0xFF242424, 0xFF2F2F2F, 0xFF414141, 0xFF595959,
+	0xFF7C7C7C, 0xFFB9BAB9, 0xFFC0C0C0, 0xFF6D6D6D, 0xFF484848, 0xFF363636, 0xFF2A2A2A, 0xFF232323,
+	0xFF212121, 0xFF1F1F1F, 0xFF202020, 0xFF212121, 0xFF242424, 0xFF272727, 0xFF2C2C2C, 0xFF343434,
+	0xFF424342, 0xFF535353, 0xFF6C6C6C, 0xFF8A8A8A, 0xFF858585, 0xFF6C6C6C, 0xFF666666, 0xFF656565,
+	0xFF747474, 0xFF969696, 0xFFE1E1E1, 0xFFFFFFFF, 0xFFB3B3B3, 0xFF616161, 0xFF3B3B3B, 0xFF252525,
+	0xFF191919, 0xFF131313, 0xFF0F0F0F, 0xFF0C0C0C, 0xFF0C0C0C, 0xFF0D0D0D, 0xFF0C0C0C, 0xFF0C0C0C,
+	0xFF0B0B0B, 0xFF0A0A0A, 0xFF0E0E0E, 0xFF101010, 0xFF161616, 0xFF232323, 0xFF343434, 0xFF525152,
+	0xFF535353, 0xFF404040, 0xFF343434, 0xFF272727, 0xFF1E1E1E, 0xFF1D1D1D, 0xFF191919, 0xFF1A1A1A,
+	0xFF1F1F1F, 0xFF222222, 0xFF232323, 0xFF242424, 0xFF262626, 0xFF282828, 0xFF2C2C2C, 0xFF323232,
+	0xFF3B3B3B, 0xFF424242, 0xFF4C4C4C, 0xFF595959, 0xFF6A6A6A, 0xFF6C6C6C, 0xFF585858, 0xFF3B3B3B,
+	0xFF282828, 0xFF1C1C1C, 0xFF151515, 0xFF111111, 0xFF0E0E0E, 0xFF0D0D0D, 0xFF0E0E0E, 0xFF101010,
+	0xFF141414, 0xFF1C1C1C, 0xFF242424, 0xFF2D2D2D, 0xFF373737, 0xFF414141, 0xFF4B4B4B, 0xFF585858,
+	0xFF656565, 0xFF696969, 0xFF636363, 0xFF5C5C5C, 0xFF646464, 0xFF777777, 0xFFADADAD, 0xFFF7F7F7,
+	0xFFEAEAEA, 0xFF7F7F7F, 0xFF414141, 0xFF272727, 0xFF131313, 0xFF090909, 0xFF030303, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF0A0A0A, 0xFF161616,
+	0xFF262626, 0xFF535353, 0xFFB6B6B6, 0xFFD6D6D6, 0xFF6F6F6F, 0xFF363636, 0xFF242424, 0xFF1A1A1A,
+	0xFF202020, 0xFF1E1E1E, 0xFF222222, 0xFF292929, 0xFF333333, 0xFF404040, 0xFF555555, 0xFF727272,
+	0xFFA5A5A5, 0xFFD3D3D3, 0xFF909090, 0xFF535353, 0xFF393939, 0xFF2A2A2A, 0xFF222222, 0xFF1E1E1E,
+	0xFF1C1C1C, 0xFF1B1B1B, 0xFF1C1C1C, 0xFF1F1F1F, 0xFF232323, 0xFF272727, 0xFF2E2E2E, 0xFF373737,
+	0xFF474747, 0xFF5C5C5C, 0xFF7B7B7B, 0xFFA1A1A1, 0xFF959595, 0xFF787878, 0xFF6D6D6D, 0xFF6E6E6E,
+	0xFF7C7B7C, 0xFF9F9F9F, 0xFFEAEAEA, 0xFFFDFDFD, 0xFFB4B4B4, 0xFF646464, 0xFF3F3F3F, 0xFF2A2A2A,
+	0xFF1F1F1F, 0xFF181818, 0xFF141414, 0xFF111111, 0xFF111111, 0xFF121212, 0xFF121212, 0xFF121212,
+	0xFF111111, 0xFF111111, 0xFF141414, 0xFF161616, 0xFF1D1D1D, 0xFF2A2A2A, 0xFF404040, 0xFF494949,
+	0xFF3D3D3D, 0xFF333333, 0xFF282828, 0xFF1E1E1E, 0xFF1C1C1C, 0xFF1A1A1A, 0xFF181818, 0xFF1C1C1C,
+	0xFF1B1B1B, 0xFF191919, 0xFF171717, 0xFF161616, 0xFF191919, 0xFF1E1E1E, 0xFF282828, 0xFF333333,
+	0xFF454545, 0xFF595959, 0xFF777777, 0xFF8A8A8A, 0xFF7F7F7F, 0xFF606060, 0xFF454545, 0xFF303030,
+	0xFF222222, 0xFF171717, 0xFF111111, 0xFF0D0D0D, 0xFF090909, 0xFF090909, 0xFF090909, 0xFF0D0D0D,
+	0xFF101010, 0xFF151515, 0xFF1F1F1F, 0xFF272727, 0xFF2F2F2F, 0xFF383838, 0xFF434343, 0xFF4D4D4D,
+	0xFF4C4C4C, 0xFF434343, 0xFF404040, 0xFF3F3F3F, 0xFF444444, 0xFF545454, 0xFF6F6F6F, 0xFFC0C0C0,
+	0xFFFFFFFF, 0xFFA8A8A8, 0xFF4D4D4D, 0xFF292929, 0xFF141414, 0xFF0B0B0B, 0xFF030303, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF010101, 0xFF050505, 0xFF0D0D0D,
+	0xFF1C1C1C, 0xFF3D3D3D, 0xFF707070, 0xFFA4A4A4, 0xFF9F9F9F, 0xFF535353, 0xFF343434, 0xFF262626,
+	0xFF2E2E2E, 0xFF2A2A2A, 0xFF2E2E2E, 0xFF373737, 0xFF444344, 0xFF565656, 0xFF6F6F6F, 0xFF969696,
+	0xFFD2D2D2, 0xFFB6B6B6, 0xFF676767, 0xFF444444, 0xFF303030, 0xFF232323, 0xFF1D1D1D, 0xFF1B1B1B,
+	0xFF1A1A1A, 0xFF1A1A1A, 0xFF1C1C1C, 0xFF202020, 0xFF242424, 0xFF282828, 0xFF313131, 0xFF3B3B3B,
+	0xFF4F4F4F, 0xFF696969, 0xFF939393, 0xFFB3B3B3, 0xFF929292, 0xFF797979, 0xFF6F6F6F, 0xFF6E6E6E,
+	0xFF7B7B7B, 0xFF9F9F9F, 0xFFE2E2E2, 0xFFE9E9E9, 0xFFB7B7B7, 0xFF6D6D6D, 0xFF474747, 0xFF313131,
+	0xFF242424, 0xFF1E1E1E, 0xFF1B1B1B, 0xFF1A1A1A, 0xFF1B1B1B, 0xFF1C1C1C, 0xFF1B1B1B, 0xFF1B1B1B,
+	0xFF1A1A1A, 0xFF1B1B1B, 0xFF1E1E1E, 0xFF242424, 0xFF2B2B2B, 0xFF343434, 0xFF3A3A3A, 0xFF353535,
+	0xFF2D2D2D, 0xFF272727, 0xFF1F1F1F, 0xFF1C1C1C, 0xFF1A1A1A, 0xFF191919, 0xFF1A1A1A, 0xFF1A1A1A,
+	0xFF151515, 0xFF101010, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF111111, 0xFF191919, 0xFF242424, 0xFF353535,
+	0xFF4D4D4D, 0xFF757575, 0xFF8E8E8E, 0xFF7B7B7B, 0xFF5E5E5E, 0xFF4C4C4C, 0xFF383838, 0xFF282828,
+	0xFF1C1C1C, 0xFF131313, 0xFF0E0E0E, 0xFF0A0A0A, 0xFF070707, 0xFF080808, 0xFF080808, 0xFF0B0B0B,
+	0xFF0E0E0E, 0xFF121212, 0xFF1A1A1A, 0xFF232323, 0xFF2C2C2C, 0xFF343434, 0xFF393939, 0xFF393939,
+	0xFF323232, 0xFF2D2D2D, 0xFF2B2B2B, 0xFF2C2C2C, 0xFF2F2F2F, 0xFF3B3B3B, 0xFF4F4F4F, 0xFF878787,
+	0xFFF0F0F0, 0xFFDBDBDB, 0xFF636363, 0xFF303030, 0xFF181818, 0xFF0D0D0D, 0xFF030303, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF050505, 0xFF0C0C0C,
+	0xFF1A1A1A, 0xFF323232, 0xFF4A4A4A, 0xFF5F5F5F, 0xFF858585, 0xFF767676, 0xFF464646, 0xFF323232,
+	0xFF3B3B3B, 0xFF373737, 0xFF3C3C3C, 0xFF474747, 0xFF585858, 0xFF6D6D6D, 0xFF8D8D8D, 0xFFC3C3C3,
+	0xFFCDCDCD, 0xFF7F7F7F, 0xFF525252, 0xFF3A3A3A, 0xFF2B2B2B, 0xFF202020, 0xFF1A1A1A, 0xFF191919,
+	0xFF181818, 0xFF1A1A1A, 0xFF1C1C1C, 0xFF212121, 0xFF262626, 0xFF2A2A2A, 0xFF343434, 0xFF434343,
+	0xFF5A5A5A, 0xFF7F7F7F, 0xFFAEAEAE, 0xFFA4A4A4, 0xFF808080, 0xFF6D6D6D, 0xFF646464, 0xFF666666,
+	0xFF747474, 0xFF969696, 0xFFD2D2D2, 0xFFCDCDCD, 0xFFB3B3B3, 0xFF7A7A7A, 0xFF4E4E4E, 0xFF373737,
+	0xFF2B2B2B, 0xFF242424, 0xFF252525, 0xFF272727, 0xFF272727, 0xFF2A2A2A, 0xFF2B2B2B, 0xFF2E2E2E,
+	0xFF2D2D2D, 0xFF2A2A2A, 0xFF2B2B2B, 0xFF2A2A2A, 0xFF2B2B2B, 0xFF2C2C2C, 0xFF292929, 0xFF272727,
+	0xFF212121, 0xFF1E1E1E, 0xFF1B1B1B, 0xFF1A1A1A, 0xFF181818, 0xFF191919, 0xFF1C1C1C, 0xFF171717,
+	0xFF101010, 0xFF0B0B0B, 0xFF090909, 0xFF090909, 0xFF0D0D0D, 0xFF151515, 0xFF212121, 0xFF353535,
+	0xFF575757, 0xFF7E7E7E, 0xFF727272, 0xFF5E5E5E, 0xFF4E4E4E, 0xFF3D3D3D, 0xFF303030, 0xFF232323,
+	0xFF171717, 0xFF0F0F0F, 0xFF0A0A0A, 0xFF070707, 0xFF050505, 0xFF050505, 0xFF060606, 0xFF090909,
+	0xFF0D0D0D, 0xFF111111, 0xFF181818, 0xFF212121, 0xFF292929, 0xFF2E2E2E, 0xFF2E2E2E, 0xFF2A2A2A,
+	0xFF262626, 0xFF222222, 0xFF202020, 0xFF212121, 0xFF222222, 0xFF2B2B2B, 0xFF3B3B3B, 0xFF606060,
+	0xFFBDBDBD, 0xFFFAFAFA, 0xFF878787, 0xFF3C3B3C, 0xFF202020, 0xFF101010, 0xFF070707, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF010101, 0xFF010101, 0xFF060606, 0xFF0F0F0F,
+	0xFF1C1C1C, 0xFF292929, 0xFF323232, 0xFF3A3B3A, 0xFF4E4E4E, 0xFF6B6B6B, 0xFF5D5D5D, 0xFF414141,
+	0xFF484848, 0xFF454545, 0xFF4C4C4C, 0xFF595859, 0xFF6C6C6C, 0xFF878787, 0xFFB2B2B2, 0xFFCBCBCB,
+	0xFF909090, 0xFF5E5E5E, 0xFF434343, 0xFF313131, 0xFF272727, 0xFF1E1E1E, 0xFF1A1A1A, 0xFF1A1A1A,
+	0xFF1B1B1B, 0xFF1D1D1D, 0xFF1E1E1E, 0xFF232323, 0xFF282828, 0xFF2E2E2E, 0xFF393939, 0xFF4D4D4D,
+	0xFF6D6D6D, 0xFF979797, 0xFF9A9A9A, 0xFF797979, 0xFF646464, 0xFF595959, 0xFF555555, 0xFF575757,
+	0xFF636363, 0xFF828282, 0xFFBCBCBC, 0xFFBABABA, 0xFFA1A1A1, 0xFF898989, 0xFF5E5E5E, 0xFF434343,
+	0xFF3A3A3A, 0xFF343434, 0xFF343434, 0xFF383838, 0xFF3D3D3D, 0xFF424242, 0xFF4B4B4B, 0xFF424242,
+	0xFF383838, 0xFF2B2B2B, 0xFF262626, 0xFF222222, 0xFF1F1F1F, 0xFF1E1E1E, 0xFF1E1E1E, 0xFF1D1D1D,
+	0xFF1A1A1A, 0xFF191919, 0xFF181818, 0xFF1A1A1A, 0xFF1A1A1A, 0xFF1D1D1D, 0xFF212121, 0xFF181818,
+	0xFF0F0F0F, 0xFF0B0B0B, 0xFF090909, 0xFF090909, 0xFF0D0D0D, 0xFF151515, 0xFF202020, 0xFF363636,
+	0xFF5E5E5E, 0xFF6F6F6F, 0xFF5D5D5D, 0xFF4F4F4F, 0xFF444444, 0xFF363636, 0xFF2B2B2B, 0xFF202020,
+	0xFF161616, 0xFF0F0F0F, 0xFF0A0A0A, 0xFF080808, 0xFF050505, 0xFF050505, 0xFF060606, 0xFF080808,
+	0xFF0C0C0C, 0xFF111111, 0xFF181818, 0xFF222222, 0xFF282828, 0xFF272727, 0xFF232323, 0xFF202020,
+	0xFF1D1D1D, 0xFF181818, 0xFF161616, 0xFF161616, 0xFF181818, 0xFF202020, 0xFF2C2C2C, 0xFF474747,
+	0xFF878787, 0xFFF6F6F6, 0xFFC0C0C0, 0xFF525252, 0xFF2D2D2D, 0xFF161616, 0xFF0D0D0D, 0xFF080808,
+	0xFF030303, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF040404, 0xFF0A0A0A, 0xFF131313,
+	0xFF181818, 0xFF1A1A1A, 0xFF1D1D1D, 0xFF242424, 0xFF2D2D2D, 0xFF404040, 0xFF575757, 0xFF535353,
+	0xFF4F4F4F, 0xFF505050, 0xFF585758, 0xFF666666, 0xFF7B7B7B, 0xFF9C9C9C, 0xFFB8B7B8, 0xFF9A9A9A,
+	0xFF6B6B6B, 0xFF4E4E4E, 0xFF393939, 0xFF2B2B2B, 0xFF252525, 0xFF1D1D1D, 0xFF1C1C1C, 0xFF1B1B1B,
+	0xFF1D1D1D, 0xFF202020, 0xFF212121, 0xFF272727, 0xFF2B2B2B, 0xFF333333, 0xFF404040, 0xFF5A5A5A,
+	0xFF7B7B7B, 0xFF7F7F7F, 0xFF686868, 0xFF585858, 0xFF4C4C4C, 0xFF454545, 0xFF454545, 0xFF484848,
+	0xFF535353, 0xFF6D6D6D, 0xFFA3A3A3, 0xFFB5B5B5, 0xFF919191, 0xFF7F7F7F, 0xFF6E6E6E, 0xFF585858,
+	0xFF4D4D4D, 0xFF484848, 0xFF4B4B4B, 0xFF545454, 0xFF5D5D5D, 0xFF6F6F6F, 0xFF6C6C6C, 0xFF494949,
+	0xFF363636, 0xFF282828, 0xFF202020, 0xFF1A1A1A, 0xFF171717, 0xFF181818, 0xFF181818, 0xFF181818,
+	0xFF181818, 0xFF181818, 0xFF181818, 0xFF1A1A1A, 0xFF1B1B1B, 0xFF232323, 0xFF262626, 0xFF1B1B1B,
+	0xFF111111, 0xFF0C0C0C, 0xFF090909, 0xFF0A0A0A, 0xFF0D0D0D, 0xFF151515, 0xFF212121, 0xFF373737,
+	0xFF5D5D5D, 0xFF666666, 0xFF595959, 0xFF4D4D4D, 0xFF404040, 0xFF363636, 0xFF292929, 0xFF1F1F1F,
+	0xFF161616, 0xFF0F0F0F, 0xFF0A0A0A, 0xFF080808, 0xFF050505, 0xFF060606, 0xFF070707, 0xFF080808,
+	0xFF0D0D0D, 0xFF131313, 0xFF181818, 0xFF232323, 0xFF282828, 0xFF232323, 0xFF212121, 0xFF1C1C1C,
+	0xFF181818, 0xFF141414, 0xFF111111, 0xFF111111, 0xFF121212, 0xFF191919, 0xFF212121, 0xFF353535,
+	0xFF5F5F5F, 0xFFCACACA, 0xFFF5F5F5, 0xFF818181, 0xFF3C3C3C, 0xFF222222, 0xFF151515, 0xFF0D0D0D,
+	0xFF0A0A0A, 0xFF090909, 0xFF080808, 0xFF080808, 0xFF0B0B0B, 0xFF0C0C0C, 0xFF0F0F0F, 0xFF111111,
+	0xFF101010, 0xFF111111, 0xFF131313, 0xFF191919, 0xFF1E1E1E, 0xFF282828, 0xFF373737, 0xFF4C4C4C,
+	0xFF444444, 0xFF535353, 0xFF606060, 0xFF6F6F6F, 0xFF858585, 0xFF999999, 0xFF8F8F8F, 0xFF737373,
+	0xFF595959, 0xFF454545, 0xFF343534, 0xFF292929, 0xFF222222, 0xFF1D1D1D, 0xFF1C1C1C, 0xFF1C1C1C,
+	0xFF1D1D1D, 0xFF202020, 0xFF242424, 0xFF2A2A2A, 0xFF2E2E2E, 0xFF393939, 0xFF4A4A4A, 0xFF5E5E5E,
+	0xFF5F5F5F, 0xFF4F4F4F, 0xFF464646, 0xFF3D3D3D, 0xFF373737, 0xFF333333, 0xFF353535, 0xFF3A3A3A,
+	0xFF464646, 0xFF5B5B5B, 0xFF868686, 0xFFAFAFAF, 0xFF909090, 0xFF717171, 0xFF636363, 0xFF5D5D5D,
+	0xFF5B5B5B, 0xFF5E5E5E, 0xFF6E6E6E, 0xFF8D8D8D, 0xFFB4B4B4, 0xFFC8C8C8, 0xFF868686, 0xFF4F4F4F,
+	0xFF363636, 0xFF252525, 0xFF1C1C1C, 0xFF171717, 0xFF141414, 0xFF141414, 0xFF141414, 0xFF141414,
+	0xFF141414, 0xFF171717, 0xFF181818, 0xFF1B1B1B, 0xFF202020, 0xFF282828, 0xFF303030, 0xFF232323,
+	0xFF151515, 0xFF0F0F0F, 0xFF0C0C0C, 0xFF0C0C0C, 0xFF0E0E0E, 0xFF151515, 0xFF202020, 0xFF343434,
+	0xFF5B5B5B, 0xFF717171, 0xFF5F5F5F, 0xFF505050, 0xFF444444, 0xFF393939, 0xFF2D2D2D, 0xFF232323,
+	0xFF191919, 0xFF121212, 0xFF0C0C0C, 0xFF080808, 0xFF070707, 0xFF080808, 0xFF0A0A0A, 0xFF0D0D0D,
+	0xFF101010, 0xFF161616, 0xFF202020, 0xFF292929, 0xFF2A2A2A, 0xFF252525, 0xFF222222, 0xFF1C1C1C,
+	0xFF171717, 0xFF141414, 0xFF101010, 0xFF101010, 0xFF101010, 0xFF161616, 0xFF1D1D1D, 0xFF2A2A2A,
+	0xFF464646, 0xFF8B8B8B, 0xFFF4F4F4, 0xFFB6B6B6, 0xFF626262, 0xFF3A3A3A, 0xFF262626, 0xFF1B1B1B,
+	0xFF161616, 0xFF141414, 0xFF131313, 0xFF141414, 0xFF121212, 0xFF0F0F0F, 0xFF0D0D0D, 0xFF0C0C0C,
+	0xFF0A0A0A, 0xFF0A0A0A, 0xFF0C0C0C, 0xFF101010, 0xFF141414, 0xFF1C1C1C, 0xFF242424, 0xFF323232,
+	0xFF333333, 0xFF454545, 0xFF585858, 0xFF6A6A6A, 0xFF797979, 0xFF7D7D7D, 0xFF737373, 0xFF646364,
+	0xFF525152, 0xFF444344, 0xFF363636, 0xFF292929, 0xFF222222, 0xFF1D1D1D, 0xFF1D1D1D, 0xFF1C1C1C,
+	0xFF1E1E1E, 0xFF212121, 0xFF262626, 0xFF2B2B2B, 0xFF333333, 0xFF3B3B3B, 0xFF424242, 0xFF3D3D3D,
+	0xFF363636, 0xFF323232, 0xFF2D2D2D, 0xFF282828, 0xFF272727, 0xFF262626, 0xFF292929, 0xFF2D2D2D,
+	0xFF373737, 0xFF4B4A4B, 0xFF6A6A6A, 0xFF9F9F9F, 0xFF969696, 0xFF6E6E6E, 0xFF5A5A5A, 0xFF4D4D4D,
+	0xFF4A4A4A, 0xFF515051, 0xFF646464, 0xFF8B8B8B, 0xFFE2E2E2, 0xFFFFFFFF, 0xFFABABAB, 0xFF5B5B5B,
+	0xFF393939, 0xFF262626, 0xFF1A1A1A, 0xFF131313, 0xFF111111, 0xFF111111, 0xFF111111, 0xFF111111,
+	0xFF141414, 0xFF171717, 0xFF181818, 0xFF1D1D1D, 0xFF242424, 0xFF2F2F2F, 0xFF3C3C3C, 0xFF2F2F2F,
+	0xFF1C1C1C, 0xFF141414, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF0F0F0F, 0xFF141414, 0xFF1F1F1F, 0xFF303030,
+	0xFF515151, 0xFF868686, 0xFF868686, 0xFF6A6A6A, 0xFF575657, 0xFF454545, 0xFF353535, 0xFF282828,
+	0xFF1E1E1E, 0xFF161616, 0xFF101010, 0xFF0B0B0B, 0xFF0A0A0A, 0xFF0B0B0B, 0xFF0C0C0C, 0xFF0F0F0F,
+	0xFF131313, 0xFF1D1D1D, 0xFF272727, 0xFF2F2F2F, 0xFF2F2F2F, 0xFF2B2B2B, 0xFF252525, 0xFF1F1F1F,
+	0xFF191919, 0xFF151515, 0xFF121212, 0xFF101010, 0xFF0F0F0F, 0xFF121212, 0xFF171717, 0xFF212121,
+	0xFF393939, 0xFF606060, 0xFFB6B6B6, 0xFFB4B4B4, 0xFF797979, 0xFF545454, 0xFF3B3B3B, 0xFF2C2C2C,
+	0xFF242424, 0xFF1E1E1E, 0xFF191919, 0xFF141414, 0xFF101010, 0xFF0C0C0C, 0xFF0A0A0A, 0xFF0A0A0A,
+	0xFF090909, 0xFF090909, 0xFF0A0A0A, 0xFF0C0C0C, 0xFF0E0E0E, 0xFF161616, 0xFF1B1B1B, 0xFF262626,
+	0xFF292929, 0xFF3A3A3A, 0xFF4C4C4C, 0xFF5E5E5E, 0xFF6B6B6B, 0xFF747474, 0xFF707070, 0xFF666666,
+	0xFF565656, 0xFF494849, 0xFF3C3C3C, 0xFF2F2F2F, 0xFF282828, 0xFF232323, 0xFF202020, 0xFF1F1F1F,
+	0xFF212121, 0xFF222222, 0xFF232323, 0xFF252525, 0xFF282828, 0xFF292929, 0xFF262626, 0xFF232323,
+	0xFF222222, 0xFF1F1F1F, 0xFF1C1C1C, 0xFF1B1B1B, 0xFF1C1C1C, 0xFF1D1D1D, 0xFF202020, 0xFF252525,
+	0xFF2F2F2F, 0xFF3E3E3E, 0xFF565656, 0xFF828282, 0xFF9E9E9E, 0xFF747474, 0xFF585858, 0xFF474747,
+	0xFF444444, 0xFF444444, 0xFF4D4C4D, 0xFF696969, 0xFFA6A6A6, 0xFFA9A9A9, 0xFF909090, 0xFF6B6B6B,
+	0xFF3F3F3F, 0xFF282828, 0xFF1B1B1B, 0xFF131313, 0xFF101010, 0xFF0F0F0F, 0xFF0F0F0F, 0xFF111111,
+	0xFF151515, 0xFF171717, 0xFF1B1B1B, 0xFF212121, 0xFF282828, 0xFF353535, 0xFF484848, 0xFF424242,
+	0xFF2A2A2A, 0xFF1D1D1D, 0xFF141414, 0xFF131313, 0xFF121212, 0xFF151515, 0xFF1E1E1E, 0xFF2B2B2B,
+	0xFF444444, 0xFF787878, 0xFFBBBBBB, 0xFFBCBCBC, 0xFF8E8E8E, 0xFF676767, 0xFF4C4C4C, 0xFF383838,
+	0xFF292929, 0xFF1E1E1E, 0xFF151515, 0xFF101010, 0xFF0D0D0D, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF141414,
+	0xFF1B1B1B, 0xFF252525, 0xFF313131, 0xFF3F3F3F, 0xFF3E3E3E, 0xFF393939, 0xFF313131, 0xFF292929,
+	0xFF212121, 0xFF191919, 0xFF151515, 0xFF121212, 0xFF101010, 0xFF121212, 0xFF171717, 0xFF1F1F1F,
+	0xFF2D2D2D, 0xFF464646, 0xFF7B7B7B, 0xFF999999, 0xFF6A6A6A, 0xFF4C4C4C, 0xFF393939, 0xFF2D2D2D,
+	0xFF242424, 0xFF1C1C1C, 0xFF161616, 0xFF111111, 0xFF0D0D0D, 0xFF090909, 0xFF080808, 0xFF080808,
+	0xFF070707, 0xFF070707, 0xFF080808, 0xFF090909, 0xFF0C0C0C, 0xFF121212, 0xFF181818, 0xFF202020,
+	0xFF2C2C2C, 0xFF3B3B3B, 0xFF484848, 0xFF595959, 0xFF707070, 0xFF7F7F7F, 0xFF7F7F7F, 0xFF747474,
+	0xFF666666, 0xFF565656, 0xFF454545, 0xFF373737, 0xFF303030, 0xFF2A2A2A, 0xFF252525, 0xFF212121,
+	0xFF1E1E1E, 0xFF1B1B1B, 0xFF181818, 0xFF171717, 0xFF171717, 0xFF181818, 0xFF181818, 0xFF171717,
+	0xFF161616, 0xFF151515, 0xFF161616, 0xFF141414, 0xFF151515, 0xFF171717, 0xFF1B1B1B, 0xFF222222,
+	0xFF2B2B2B, 0xFF373737, 0xFF4C4C4C, 0xFF686868, 0xFF909090, 0xFF858585, 0xFF5B5B5B, 0xFF474747,
+	0xFF3E3E3E, 0xFF3C3C3C, 0xFF464546, 0xFF616061, 0xFF6B6B6B, 0xFF555555, 0xFF505050, 0xFF555555,
+	0xFF454545, 0xFF2A2A2A, 0xFF1B1B1B, 0xFF131313, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF101010,
+	0xFF131313, 0xFF171717, 0xFF1C1C1C, 0xFF232323, 0xFF2B2B2B, 0xFF393939, 0xFF4D4D4D, 0xFF565556,
+	0xFF3A3A3A, 0xFF272727, 0xFF1B1B1B, 0xFF161616, 0xFF151515, 0xFF161616, 0xFF1E1E1E, 0xFF252525,
+	0xFF3A3A3A, 0xFF565656, 0xFF979797, 0xFFEAEAEA, 0xFFF5F5F5, 0xFFCBCBCB, 0xFF8D8D8D, 0xFF585858,
+	0xFF3C3C3C, 0xFF2B2B2B, 0xFF1D1D1D, 0xFF181818, 0xFF141414, 0xFF141414, 0xFF151515, 0xFF1A1A1A,
+	0xFF232323, 0xFF2E2E2E, 0xFF3D3D3D, 0xFF505050, 0xFF585858, 0xFF4E4E4E, 0xFF434343, 0xFF363636,
+	0xFF2B2B2B, 0xFF222222, 0xFF1C1C1C, 0xFF171717, 0xFF141414, 0xFF171717, 0xFF1A1A1A, 0xFF1E1E1E,
+	0xFF282828, 0xFF373737, 0xFF535353, 0xFF767676, 0xFF606060, 0xFF424242, 0xFF323232, 0xFF272727,
+	0xFF202020, 0xFF191919, 0xFF151515, 0xFF111111, 0xFF0D0D0D, 0xFF090909, 0xFF080808, 0xFF080808,
+	0xFF090909, 0xFF090909, 0xFF080808, 0xFF0B0B0B, 0xFF0C0C0C, 0xFF111111, 0xFF181818, 0xFF1F1F1F,
+	0xFF2C2C2C, 0xFF333333, 0xFF3F3F3F, 0xFF4D4D4D, 0xFF656565, 0xFF868686, 0xFFA7A7A7, 0xFFA6A7A6,
+	0xFF8F8F8F, 0xFF777777, 0xFF616161, 0xFF4F4F4F, 0xFF3B3B3B, 0xFF2E2E2E, 0xFF232323, 0xFF1B1B1B,
+	0xFF141414, 0xFF121212, 0xFF0F0F0F, 0xFF0D0D0D, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF0F0F0F,
+	0xFF0F0F0F, 0xFF0F0F0F, 0xFF0F0F0F, 0xFF0F0F0F, 0xFF111111, 0xFF141414, 0xFF181818, 0xFF1F1F1F,
+	0xFF282828, 0xFF333333, 0xFF444444, 0xFF5B5B5B, 0xFF737373, 0xFF888888, 0xFF737373, 0xFF525252,
+	0xFF434343, 0xFF404040, 0xFF4A494A, 0xFF4F4E4F, 0xFF3B3B3B, 0xFF333333, 0xFF2E2E2E, 0xFF303030,
+	0xFF3C3C3C, 0xFF2E2E2E, 0xFF1B1B1B, 0xFF131313, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF101010,
+	0xFF131313, 0xFF161616, 0xFF1C1C1C, 0xFF232323, 0xFF2B2B2B, 0xFF3B3B3B, 0xFF4C4C4C, 0xFF5E5E5E,
+	0xFF4F4F4F, 0xFF323232, 0xFF232323, 0xFF1C1C1C, 0xFF161616, 0xFF171717, 0xFF1B1B1B, 0xFF212121,
+	0xFF2E2E2E, 0xFF424242, 0xFF606060, 0xFF8E8E8E, 0xFFC7C7C7, 0xFFF0F0F0, 0xFFF6F6F6, 0xFFBEBEBE,
+	0xFF737373, 0xFF464646, 0xFF333333, 0xFF282828, 0xFF1F1F1F, 0xFF1E1E1E, 0xFF202020, 0xFF252525,
+	0xFF2C2C2C, 0xFF3C3C3C, 0xFF505050, 0xFF6B6B6B, 0xFF838383, 0xFF7A7A7A, 0xFF686868, 0xFF535353,
+	0xFF434343, 0xFF343434, 0xFF2A2A2A, 0xFF222222, 0xFF1D1D1D, 0xFF1D1D1D, 0xFF1D1D1D, 0xFF202020,
+	0xFF252525, 0xFF2E2E2E, 0xFF3C3C3C, 0xFF535353, 0xFF545454, 0xFF3A3A3A, 0xFF2E2E2E, 0xFF242424,
+	0xFF1E1E1E, 0xFF181818, 0xFF151515, 0xFF111111, 0xFF0F0F0F, 0xFF0D0D0D, 0xFF0B0B0B, 0xFF0C0C0C,
+	0xFF0C0C0C, 0xFF0C0C0C, 0xFF0B0B0B, 0xFF0E0E0E, 0xFF101010, 0xFF161616, 0xFF1E1E1E, 0xFF252525,
+	0xFF242424, 0xFF2A2A2A, 0xFF373737, 0xFF454545, 0xFF5B5B5B, 0xFF7C7C7C, 0xFFAFAFAF, 0xFFEAEBEA,
+	0xFFE5E5E5, 0xFFB7B7B7, 0xFF7F7F7F, 0xFF575657, 0xFF3A3A3A, 0xFF2A2A2A, 0xFF1E1E1E, 0xFF141414,
+	0xFF0F0F0F, 0xFF0D0D0D, 0xFF0A0A0A, 0xFF080808, 0xFF090909, 0xFF090909, 0xFF0A0A0A, 0xFF0A0A0A,
+	0xFF0B0B0B, 0xFF0C0C0C, 0xFF0C0C0C, 0xFF0E0E0E, 0xFF111111, 0xFF141414, 0xFF191919, 0xFF212121,
+	0xFF2A2A2A, 0xFF363636, 0xFF424242, 0xFF505050, 0xFF5F5F5F, 0xFF6C6C6C, 0xFF717171, 0xFF626262,
+	0xFF525252, 0xFF474747, 0xFF3E3E3E, 0xFF313131, 0xFF232323, 0xFF1D1D1D, 0xFF1B1B1B, 0xFF1D1D1D,
+	0xFF282828, 0xFF2A2A2A, 0xFF1B1B1B, 0xFF121212, 0xFF0E0E0E, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF0F0F0F,
+	0xFF121212, 0xFF151515, 0xFF1B1B1B, 0xFF232323, 0xFF2B2B2B, 0xFF393939, 0xFF454545, 0xFF515151,
+	0xFF575757, 0xFF444444, 0xFF2D2D2D, 0xFF202020, 0xFF1A1A1A, 0xFF181818, 0xFF1A1A1A, 0xFF202020,
+	0xFF272727, 0xFF2E2E2E, 0xFF393939, 0xFF424242, 0xFF535353, 0xFF7B7B7B, 0xFFBBBBBB, 0xFFF2F2F2,
+	0xFFE4E4E4, 0xFF989898, 0xFF5A5A5A, 0xFF404040, 0xFF323232, 0xFF2E2E2E, 0xFF2F2F2F, 0xFF343434,
+	0xFF3F3F3F, 0xFF515151, 0xFF6A6A6A, 0xFF8E8E8E, 0xFFC4C4C4, 0xFFD3D3D3, 0xFFB5B5B5, 0xFF919191,
+	0xFF706F70, 0xFF555555, 0xFF434343, 0xFF373737, 0xFF2E2E2E, 0xFF292929, 0xFF272727, 0xFF252525,
+	0xFF242424, 0xFF272727, 0xFF2E2E2E, 0xFF373737, 0xFF414141, 0xFF353535, 0xFF282828, 0xFF212121,
+	0xFF1C1C1C, 0xFF181818, 0xFF161616, 0xFF151515, 0xFF121212, 0xFF101010, 0xFF101010, 0xFF0F0F0F,
+	0xFF0F0F0F, 0xFF0F0F0F, 0xFF111111, 0xFF131313, 0xFF191919, 0xFF1B1B1B, 0xFF1D1D1D, 0xFF212121,
+	0xFF1D1D1D, 0xFF242424, 0xFF303030, 0xFF3D3D3D, 0xFF545454, 0xFF747474, 0xFFA8A8A8, 0xFFEFEFEF,
+	0xFFFFFFFF, 0xFFCECECE, 0xFF787878, 0xFF4F4E4F, 0xFF353535, 0xFF252525, 0xFF1A1A1A, 0xFF101010,
+	0xFF0B0B0B, 0xFF090909, 0xFF070707, 0xFF050505, 0xFF050505, 0xFF060606, 0xFF070707, 0xFF080808,
+	0xFF080808, 0xFF0A0A0A, 0xFF0D0D0D, 0xFF0F0F0F, 0xFF121212, 0xFF181818, 0xFF1F1F1F, 0xFF262626,
+	0xFF2F2F2F, 0xFF3A3A3A, 0xFF464646, 0xFF515051, 0xFF555555, 0xFF585858, 0xFF545354, 0xFF4E4E4E,
+	0xFF424242, 0xFF363636, 0xFF292929, 0xFF1E1E1E, 0xFF151515, 0xFF111111, 0xFF111111, 0xFF111111,
+	0xFF1A1A1A, 0xFF232323, 0xFF1B1B1B, 0xFF111111, 0xFF0E0E0E, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF0E0E0E,
+	0xFF101010, 0xFF141414, 0xFF191919, 0xFF202020, 0xFF272727, 0xFF313131, 0xFF3B3B3B, 0xFF424242,
+	0xFF464646, 0xFF444444, 0xFF363636, 0xFF272727, 0xFF1E1E1E, 0xFF191919, 0xFF171717, 0xFF181818,
+	0xFF171717, 0xFF181818, 0xFF1A1A1A, 0xFF202020, 0xFF282828, 0xFF363636, 0xFF525252, 0xFF888788,
+	0xFFBDBEBD, 0xFFD8D8D8, 0xFFB9B9B9, 0xFF787878, 0xFF535353, 0xFF484848, 0xFF464646, 0xFF4A4A4A,
+	0xFF595859, 0xFF737373, 0xFFA0A0A0, 0xFFDADADA, 0xFFFEFEFE, 0xFFFFFFFF, 0xFFFDFDFD, 0xFFDDDDDD,
+	0xFFB1B1B1, 0xFF919191, 0xFF747474, 0xFF5D5D5D, 0xFF4A4A4A, 0xFF3B3B3B, 0xFF333333, 0xFF2C2C2C,
+	0xFF272727, 0xFF252525, 0xFF242424, 0xFF252525, 0xFF2A2A2A, 0xFF2D2D2D, 0xFF272727, 0xFF222222,
+	0xFF1F1F1F, 0xFF1C1C1C, 0xFF1A1A1A, 0xFF181818, 0xFF191919, 0xFF191919, 0xFF191919, 0xFF181818,
+	0xFF181818, 0xFF181818, 0xFF181818, 0xFF171717, 0xFF161616, 0xFF151515, 0xFF161616, 0xFF191919,
+	0xFF1B1B1B, 0xFF212121, 0xFF2C2C2C, 0xFF3D3D3D, 0xFF535353, 0xFF797979, 0xFF9B9B9B, 0xFFA0A0A0,
+	0xFFB5B5B5, 0xFFB4B4B4, 0xFF737373, 0xFF4A4A4A, 0xFF313131, 0xFF222222, 0xFF161616, 0xFF0E0E0E,
+	0xFF0A0A0A, 0xFF070707, 0xFF050505, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF070707, 0xFF080808,
+	0xFF0A0A0A, 0xFF0C0C0C, 0xFF101010, 0xFF131313, 0xFF191919, 0xFF212121, 0xFF212121, 0xFF202020,
+	0xFF252525, 0xFF2E2E2E, 0xFF404040, 0xFF505050, 0xFF515151, 0xFF4B4B4B, 0xFF424242, 0xFF383838,
+	0xFF2D2D2D, 0xFF232323, 0xFF1A1A1A, 0xFF121212, 0xFF0D0D0D, 0xFF0B0B0B, 0xFF0B0B0B, 0xFF0C0C0C,
+	0xFF111111, 0xFF1C1C1C, 0xFF1A1A1A, 0xFF121212, 0xFF0E0E0E, 0xFF0C0C0C, 0xFF0C0C0C, 0xFF0D0D0D,
+	0xFF101010, 0xFF141414, 0xFF161616, 0xFF1B1B1B, 0xFF232323, 0xFF292929, 0xFF313131, 0xFF353535,
+	0xFF343434, 0xFF303030, 0xFF2A2A2A, 0xFF212121, 0xFF191919, 0xFF121212, 0xFF0E0E0E, 0xFF0C0C0C,
+	0xFF0B0B0B, 0xFF0A0A0A, 0xFF0A0A0A, 0xFF0F0F0F, 0xFF151515, 0xFF1D1D1D, 0xFF2A2A2A, 0xFF404040,
+	0xFF686868, 0xFF969696, 0xFFC8C8C8, 0xFFD9D9D9, 0xFFB0B0B0, 0xFF888888, 0xFF7D7D7D, 0xFF818181,
+	0xFF979797, 0xFFC2C2C2, 0xFFEBEBEB, 0xFFEDEDED, 0xFFD9D9D9, 0xFFD9D9D9, 0xFFC9C9C9, 0xFFACACAC,
+	0xFF969696, 0xFF888888, 0xFF7E7E7E, 0xFF7B7B7B, 0xFF757575, 0xFF5E5E5E, 0xFF474747, 0xFF393939,
+	0xFF2E2E2E, 0xFF252525, 0xFF212121, 0xFF1D1D1D, 0xFF1C1C1C, 0xFF1D1D1D, 0xFF1E1E1E, 0xFF1F1F1F,
+	0xFF1E1E1E, 0xFF1E1E1E, 0xFF1E1E1E, 0xFF1D1D1D, 0xFF1E1E1E, 0xFF1E1E1E, 0xFF1D1D1D, 0xFF1B1B1B,
+	0xFF171717, 0xFF141414, 0xFF111111, 0xFF101010, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF111111, 0xFF141414,
+	0xFF1A1A1A, 0xFF212121, 0xFF2E2E2E, 0xFF414141, 0xFF5D5D5D, 0xFF727272, 0xFF696969, 0xFF606060,
+	0xFF666666, 0xFF7D7D7D, 0xFF6B6B6B, 0xFF454445, 0xFF2E2E2E, 0xFF1E1E1E, 0xFF151515, 0xFF0E0E0E,
+	0xFF0A0A0A, 0xFF080808, 0xFF050505, 0xFF040404, 0xFF050505, 0xFF060606, 0xFF0A0A0A, 0xFF0D0D0D,
+	0xFF0E0E0E, 0xFF131313, 0xFF191919, 0xFF1E1E1E, 0xFF232323, 0xFF1F1F1F, 0xFF1A1A1A, 0xFF181818,
+	0xFF1B1B1B, 0xFF1F1F1F, 0xFF2A2A2A, 0xFF3C3C3C, 0xFF4A4A4A, 0xFF444444, 0xFF373737, 0xFF2D2D2D,
+	0xFF222222, 0xFF191919, 0xFF111111, 0xFF0C0C0C, 0xFF0A0A0A, 0xFF060606, 0xFF070707, 0xFF080808,
+	0xFF0C0C0C, 0xFF161616, 0xFF181818, 0xFF121212, 0xFF0E0E0E, 0xFF0C0C0C, 0xFF0C0C0C, 0xFF0D0D0D,
+	0xFF0F0F0F, 0xFF121212, 0xFF141414, 0xFF181818, 0xFF1F1F1F, 0xFF242424, 0xFF292929, 0xFF292929,
+	0xFF292929, 0xFF242424, 0xFF1C1C1C, 0xFF141414, 0xFF0E0E0E, 0xFF0A0A0A, 0xFF060606, 0xFF030303,
+	0xFF030303, 0xFF020202, 0xFF030303, 0xFF060606, 0xFF0A0A0A, 0xFF111111, 0xFF191919, 0xFF262626,
+	0xFF3B3B3B, 0xFF5E5E5E, 0xFF8E8E8E, 0xFFCFCFCF, 0xFFFEFEFE, 0xFFF5F5F5, 0xFFE7E7E7, 0xFFE9E9E9,
+	0xFFF9F9F9, 0xFFFFFFFF, 0xFFD8D8D8, 0xFFB0B0B0, 0xFF999999, 0xFF929292, 0xFF878787, 0xFF777777,
+	0xFF6E6E6E, 0xFF676767, 0xFF646464, 0xFF6D6D6D, 0xFF818181, 0xFF8F8F8F, 0xFF6B6B6B, 0xFF4A4A4A,
+	0xFF373737, 0xFF282828, 0xFF1F1F1F, 0xFF181818, 0xFF141414, 0xFF131313, 0xFF111111, 0xFF101010,
+	0xFF121212, 0xFF121212, 0xFF131313, 0xFF131313, 0xFF111111, 0xFF101010, 0xFF0F0F0F, 0xFF0C0C0C,
+	0xFF0A0A0A, 0xFF080808, 0xFF080808, 0xFF0A0A0A, 0xFF090909, 0xFF0B0B0B, 0xFF0E0E0E, 0xFF111111,
+	0xFF1D1D1D, 0xFF252525, 0xFF323232, 0xFF4B4B4B, 0xFF616161, 0xFF555555, 0xFF474747, 0xFF434343,
+	0xFF494849, 0xFF565656, 0xFF5B5B5B, 0xFF404040, 0xFF2A2A2A, 0xFF1D1D1D, 0xFF151515, 0xFF0E0E0E,
+	0xFF0B0B0B, 0xFF080808, 0xFF070707, 0xFF070707, 0xFF090909, 0xFF0A0A0A, 0xFF0D0D0D, 0xFF111111,
+	0xFF141414, 0xFF1B1B1B, 0xFF252525, 0xFF2C2C2C, 0xFF242424, 0xFF1A1A1A, 0xFF141414, 0xFF131313,
+	0xFF141414, 0xFF161616, 0xFF1D1D1D, 0xFF272727, 0xFF363636, 0xFF404040, 0xFF333333, 0xFF252525,
+	0xFF1D1D1D, 0xFF141414, 0xFF0F0F0F, 0xFF090909, 0xFF060606, 0xFF030303, 0xFF030303, 0xFF040404,
+	0xFF080808, 0xFF111111, 0xFF171717, 0xFF131313, 0xFF0F0F0F, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF0E0E0E,
+	0xFF101010, 0xFF121212, 0xFF151515, 0xFF171717, 0xFF1C1C1C, 0xFF202020, 0xFF232323, 0xFF232323,
+	0xFF202020, 0xFF1E1E1E, 0xFF161616, 0xFF101010, 0xFF0A0A0A, 0xFF070707, 0xFF030303, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF050505, 0xFF0A0A0A, 0xFF101010, 0xFF191919,
+	0xFF282828, 0xFF393939, 0xFF585858, 0xFF808080, 0xFFB6B6B6, 0xFFE1E1E1, 0xFFEFEFEF, 0xFFF3F3F3,
+	0xFFEAEAEA, 0xFFCFCFCF, 0xFFABABAB, 0xFF8C8C8C, 0xFF777777, 0xFF6D6D6D, 0xFF646464, 0xFF5C5C5C,
+	0xFF575757, 0xFF555555, 0xFF575757, 0xFF646464, 0xFF7D7D7D, 0xFFB5B5B5, 0xFFA7A7A7, 0xFF676767,
+	0xFF434343, 0xFF2D2D2D, 0xFF202020, 0xFF161616, 0xFF0F0F0F, 0xFF0C0C0C, 0xFF0A0A0A, 0xFF090909,
+	0xFF080808, 0xFF080808, 0xFF070707, 0xFF070707, 0xFF060606, 0xFF060606, 0xFF060606, 0xFF020202,
+	0xFF030303, 0xFF030303, 0xFF040404, 0xFF050505, 0xFF070707, 0xFF090909, 0xFF0E0E0E, 0xFF141414,
+	0xFF212121, 0xFF2F2F2F, 0xFF424242, 0xFF5C5C5C, 0xFF555555, 0xFF404040, 0xFF393939, 0xFF353535,
+	0xFF373737, 0xFF404040, 0xFF474747, 0xFF393939, 0xFF272727, 0xFF1C1C1C, 0xFF141414, 0xFF0F0F0F,
+	0xFF0D0D0D, 0xFF0B0B0B, 0xFF0C0C0C, 0xFF0C0C0C, 0xFF0E0E0E, 0xFF121212, 0xFF161616, 0xFF1B1B1B,
+	0xFF232323, 0xFF2E2E2E, 0xFF3A3A3A, 0xFF2F2F2F, 0xFF202020, 0xFF161616, 0xFF121212, 0xFF0F0F0F,
+	0xFF101010, 0xFF121212, 0xFF161616, 0xFF1C1C1C, 0xFF242424, 0xFF313131, 0xFF303030, 0xFF212121,
+	0xFF181818, 0xFF111111, 0xFF0B0B0B, 0xFF070707, 0xFF030303, 0xFF020202, 0xFF030303, 0xFF020202,
+	0xFF060606, 0xFF0C0C0C, 0xFF161616, 0xFF161616, 0xFF111111, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF0F0F0F,
+	0xFF121212, 0xFF121212, 0xFF151515, 0xFF181818, 0xFF1B1B1B, 0xFF1D1D1D, 0xFF202020, 0xFF202020,
+	0xFF1C1C1C, 0xFF1A1A1A, 0xFF121212, 0xFF0D0D0D, 0xFF0A0A0A, 0xFF060606, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF080808, 0xFF0D0D0D, 0xFF141414,
+	0xFF1D1D1D, 0xFF272727, 0xFF373737, 0xFF4A4A4A, 0xFF5F5F5F, 0xFF787878, 0xFF888888, 0xFF8E8E8E,
+	0xFF878787, 0xFF7B7B7B, 0xFF6C6C6C, 0xFF5E5E5E, 0xFF565656, 0xFF515151, 0xFF4C4C4C, 0xFF494949,
+	0xFF494949, 0xFF4B4B4B, 0xFF535353, 0xFF656565, 0xFF898989, 0xFFD6D6D6, 0xFFEEEEEE, 0xFF969696,
+	0xFF585858, 0xFF373737, 0xFF232323, 0xFF161616, 0xFF0E0E0E, 0xFF0A0A0A, 0xFF060606, 0xFF030303,
+	0xFF020202, 0xFF030303, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF010101, 0xFF010101,
+	0xFF010101, 0xFF010101, 0xFF020202, 0xFF020202, 0xFF060606, 0xFF0A0A0A, 0xFF111111, 0xFF171717,
+	0xFF2C2C2C, 0xFF404040, 0xFF606060, 0xFF646464, 0xFF494949, 0xFF383838, 0xFF313131, 0xFF2E2E2E,
+	0xFF303030, 0xFF353535, 0xFF3D3D3D, 0xFF303030, 0xFF232323, 0xFF1C1C1C, 0xFF161616, 0xFF131313,
+	0xFF111111, 0xFF101010, 0xFF111111, 0xFF141414, 0xFF161616, 0xFF1D1D1D, 0xFF242424, 0xFF2C2C2C,
+	0xFF393939, 0xFF4E4E4E, 0xFF484848, 0xFF2F2F2F, 0xFF202020, 0xFF151515, 0xFF121212, 0xFF0F0F0F,
+	0xFF0E0E0E, 0xFF0E0E0E, 0xFF101010, 0xFF141414, 0xFF1B1B1B, 0xFF222222, 0xFF2B2B2B, 0xFF212121,
+	0xFF171717, 0xFF101010, 0xFF0A0A0A, 0xFF070707, 0xFF040404, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF030303, 0xFF0A0A0A, 0xFF151515, 0xFF1B1B1B, 0xFF161616, 0xFF131313, 0xFF131313, 0xFF141414,
+	0xFF151515, 0xFF161616, 0xFF161616, 0xFF191919, 0xFF1D1D1D, 0xFF1E1E1E, 0xFF1F1F1F, 0xFF1F1F1F,
+	0xFF1C1C1C, 0xFF181818, 0xFF151515, 0xFF101010, 0xFF0D0D0D, 0xFF080808, 0xFF050505, 0xFF040404,
+	0xFF020202, 0xFF010101, 0xFF020202, 0xFF040404, 0xFF060606, 0xFF0A0A0A, 0xFF0D0D0D, 0xFF131313,
+	0xFF161616, 0xFF1D1D1D, 0xFF282828, 0xFF323232, 0xFF3A3A3A, 0xFF464646, 0xFF4E4E4E, 0xFF515151,
+	0xFF515151, 0xFF4F4F4F, 0xFF4A4A4A, 0xFF454545, 0xFF434343, 0xFF414141, 0xFF404040, 0xFF414141,
+	0xFF434343, 0xFF484848, 0xFF545454, 0xFF696969, 0xFF919191, 0xFFD9D9D9, 0xFFFAF9FA, 0xFF9E9E9E,
+	0xFF5B5B5B, 0xFF3D3D3D, 0xFF272727, 0xFF181818, 0xFF0F0F0F, 0xFF080808, 0xFF030303, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF080808, 0xFF0D0D0D, 0xFF161616, 0xFF202020,
+	0xFF444444, 0xFF6E6E6E, 0xFF808080, 0xFF606060, 0xFF484848, 0xFF393939, 0xFF313131, 0xFF2D2D2D,
+	0xFF2D2D2D, 0xFF323232, 0xFF363636, 0xFF2A2A2A, 0xFF222222, 0xFF1C1C1C, 0xFF191919, 0xFF171717,
+	0xFF161616, 0xFF161616, 0xFF191919, 0xFF1D1D1D, 0xFF242424, 0xFF2C2C2C, 0xFF383838, 0xFF484848,
+	0xFF606060, 0xFF6F6F6F, 0xFF515151, 0xFF353535, 0xFF262626, 0xFF191919, 0xFF141414, 0xFF101010,
+	0xFF0E0E0E, 0xFF0E0E0E, 0xFF101010, 0xFF131313, 0xFF171717, 0xFF1D1D1D, 0xFF232323, 0xFF212121,
+	0xFF171717, 0xFF101010, 0xFF0B0B0B, 0xFF070707, 0xFF040404, 0xFF020202, 0xFF020202, 0xFF010101,
+	0xFF020202, 0xFF080808, 0xFF121212, 0xFF202020, 0xFF212121, 0xFF1D1D1D, 0xFF1D1D1D, 0xFF1C1C1C,
+	0xFF1C1C1C, 0xFF1C1C1C, 0xFF1C1C1C, 0xFF202020, 0xFF232323, 0xFF212121, 0xFF212121, 0xFF212121,
+	0xFF1F1F1F, 0xFF1D1D1D, 0xFF1A1A1A, 0xFF161616, 0xFF121212, 0xFF0F0F0F, 0xFF0C0C0C, 0xFF090909,
+	0xFF060606, 0xFF070707, 0xFF070707, 0xFF080808, 0xFF090909, 0xFF0C0C0C, 0xFF0E0E0E, 0xFF121212,
+	0xFF171717, 0xFF1B1B1B, 0xFF202020, 0xFF252525, 0xFF2B2B2B, 0xFF303030, 0xFF373737, 0xFF393939,
+	0xFF3A3A3A, 0xFF3B3B3B, 0xFF3A3A3A, 0xFF393939, 0xFF3B3B3B, 0xFF3A3A3A, 0xFF3B3B3B, 0xFF3E3E3E,
+	0xFF444444, 0xFF4C4C4C, 0xFF575757, 0xFF616161, 0xFF767676, 0xFFACACAC, 0xFFC3C3C3, 0xFF707070,
+	0xFF454545, 0xFF313131, 0xFF232323, 0xFF1B1B1B, 0xFF111111, 0xFF090909, 0xFF030303, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF060606, 0xFF0C0C0C, 0xFF131313, 0xFF212121, 0xFF2F2F2F,
+	0xFF8D8D8D, 0xFFB1B1B1, 0xFF888888, 0xFF626262, 0xFF4D4D4D, 0xFF3D3D3D, 0xFF363636, 0xFF323232,
+	0xFF313131, 0xFF333333, 0xFF2F2F2F, 0xFF262626, 0xFF202020, 0xFF1D1D1D, 0xFF1C1C1C, 0xFF1C1C1C,
+	0xFF1C1C1C, 0xFF1E1E1E, 0xFF242424, 0xFF2B2B2B, 0xFF373737, 0xFF444444, 0xFF565656, 0xFF747474,
+	0xFFA6A6A6, 0xFF959595, 0xFF616161, 0xFF454545, 0xFF2F2F2F, 0xFF232323, 0xFF1C1C1C, 0xFF161616,
+	0xFF121212, 0xFF111111, 0xFF121212, 0xFF131313, 0xFF161616, 0xFF1B1B1B, 0xFF1E1E1E, 0xFF212121,
+	0xFF1B1B1B, 0xFF131313, 0xFF0D0D0D, 0xFF080808, 0xFF040404, 0xFF030303, 0xFF020202, 0xFF000000,
+	0xFF030303, 0xFF090909, 0xFF111111, 0xFF222222, 0xFF2B2B2B, 0xFF292929, 0xFF2A2A2A, 0xFF2A2A2A,
+	0xFF292929, 0xFF292929, 0xFF292929, 0xFF2C2C2C, 0xFF2D2D2D, 0xFF2D2D2D, 0xFF2D2D2D, 0xFF2C2C2C,
+	0xFF2C2C2C, 0xFF2A2A2A, 0xFF272727, 0xFF232323, 0xFF1C1C1C, 0xFF151515, 0xFF0E0E0E, 0xFF0B0B0B,
+	0xFF0A0A0A, 0xFF0D0D0D, 0xFF0E0E0E, 0xFF111111, 0xFF111111, 0xFF131313, 0xFF141414, 0xFF151515,
+	0xFF181818, 0xFF1B1B1B, 0xFF1D1D1D, 0xFF212121, 0xFF232323, 0xFF272727, 0xFF2B2B2B, 0xFF2D2D2D,
+	0xFF313131, 0xFF343434, 0xFF363636, 0xFF373737, 0xFF3A3A3A, 0xFF3C3C3C, 0xFF3F3F3F, 0xFF444444,
+	0xFF4B4A4B, 0xFF515151, 0xFF545454, 0xFF5B5B5B, 0xFF6A6A6A, 0xFF919191, 0xFF898989, 0xFF4F4F4F,
+	0xFF333333, 0xFF262626, 0xFF1D1D1D, 0xFF181818, 0xFF131313, 0xFF080808, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF050505, 0xFF0A0A0A, 0xFF141414, 0xFF222222, 0xFF363636, 0xFF545454,
+	0xFFF4F4F4, 0xFFCACACA, 0xFF8D8D8D, 0xFF6A6A6A, 0xFF555555, 0xFF464646, 0xFF3B3B3B, 0xFF343434,
+	0xFF313131, 0xFF2D2D2D, 0xFF272727, 0xFF222222, 0xFF212121, 0xFF202020, 0xFF212121, 0xFF222222,
+	0xFF272727, 0xFF2D2D2D, 0xFF353535, 0xFF414141, 0xFF545454, 0xFF707070, 0xFF989898, 0xFFCFCFCF,
+	0xFFF8F8F8, 0xFFD4D4D4, 0xFF8E8E8E, 0xFF676767, 0xFF4A4A4A, 0xFF353535, 0xFF2A2A2A, 0xFF222222,
+	0xFF1D1D1D, 0xFF191919, 0xFF191919, 0xFF181818, 0xFF1B1B1B, 0xFF1F1F1F, 0xFF212121, 0xFF262626,
+	0xFF1F1F1F, 0xFF161616, 0xFF111111, 0xFF0B0B0B, 0xFF080808, 0xFF050505, 0xFF030303, 0xFF030303,
+	0xFF070707, 0xFF0A0A0A, 0xFF111111, 0xFF222222, 0xFF393939, 0xFF444444, 0xFF424242, 0xFF414141,
+	0xFF414141, 0xFF414141, 0xFF414141, 0xFF424242, 0xFF424242, 0xFF424242, 0xFF424242, 0xFF404040,
+	0xFF404040, 0xFF404040, 0xFF3E3E3E, 0xFF313131, 0xFF212121, 0xFF171717, 0xFF111111, 0xFF0E0E0E,
+	0xFF0D0D0D, 0xFF101010, 0xFF141414, 0xFF1E1E1E, 0xFF222222, 0xFF222222, 0xFF212121, 0xFF202020,
+	0xFF1F1F1F, 0xFF202020, 0xFF212121, 0xFF212121, 0xFF212121, 0xFF232323, 0xFF272727, 0xFF2A2A2A,
+	0xFF2F2F2F, 0xFF343434, 0xFF383838, 0xFF3D3D3D, 0xFF414141, 0xFF464646, 0xFF494949, 0xFF525252,
+	0xFF5D5D5D, 0xFF5C5C5C, 0xFF585858, 0xFF5C5C5C, 0xFF676767, 0xFF808080, 0xFF636363, 0xFF3A3A3A,
+	0xFF262626, 0xFF1D1D1D, 0xFF161616, 0xFF151515, 0xFF141414, 0xFF0A0A0A, 0xFF030303, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF0A0A0A, 0xFF121212, 0xFF232323, 0xFF3D3D3D, 0xFF6A6A6A, 0xFFBBBBBB,
+	0xFFB8B8B8, 0xFF7C7C7C, 0xFF5B5B5B, 0xFF494949, 0xFF3C3C3C, 0xFF343434, 0xFF2E2E2E, 0xFF272727,
+	0xFF232323, 0xFF212121, 0xFF212121, 0xFF232323, 0xFF232323, 0xFF242424, 0xFF292929, 0xFF2F2F2F,
+	0xFF373737, 0xFF434343, 0xFF545454, 0xFF6F6E6F, 0xFF8C8C8C, 0xFFA5A5A5, 0xFFC4C4C4, 0xFFEFEFEF,
+	0xFFF6F6F6, 0xFFC8C8C8, 0xFF919191, 0xFF6E6E6E, 0xFF5A5A5A, 0xFF4C4C4C, 0xFF434343, 0xFF3B3B3B,
+	0xFF323232, 0xFF2D2D2D, 0xFF282828, 0xFF262726, 0xFF272727, 0xFF282828, 0xFF2A2A2A, 0xFF2B2B2B,
+	0xFF232323, 0xFF1A1A1A, 0xFF131313, 0xFF0F0F0F, 0xFF0B0B0B, 0xFF080808, 0xFF060606, 0xFF070707,
+	0xFF090909, 0xFF0C0C0C, 0xFF141414, 0xFF232323, 0xFF3B3B3B, 0xFF5E5E5E, 0xFF717171, 0xFF6F6F6F,
+	0xFF6F6F6F, 0xFF707070, 0xFF717171, 0xFF707070, 0xFF6D6D6D, 0xFF6B6B6B, 0xFF6B6B6B, 0xFF6A6A6A,
+	0xFF6B6B6B, 0xFF686868, 0xFF525252, 0xFF373737, 0xFF262626, 0xFF1C1C1C, 0xFF151515, 0xFF131313,
+	0xFF131313, 0xFF171717, 0xFF1D1D1D, 0xFF2A2A2A, 0xFF3A3A3A, 0xFF3D3D3D, 0xFF373737, 0xFF323232,
+	0xFF2E2E2E, 0xFF2A2A2A, 0xFF282828, 0xFF262626, 0xFF262626, 0xFF272727, 0xFF282828, 0xFF2F2F2F,
+	0xFF373737, 0xFF3C3C3C, 0xFF424242, 0xFF4A4A4A, 0xFF525252, 0xFF5C5C5C, 0xFF646464, 0xFF727272,
+	0xFF767676, 0xFF6D6D6D, 0xFF676767, 0xFF686868, 0xFF6F6F6F, 0xFF6F6F6F, 0xFF454545, 0xFF2C2C2C,
+	0xFF1E1E1E, 0xFF151515, 0xFF111111, 0xFF111111, 0xFF121212, 0xFF0D0D0D, 0xFF040404, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF050505, 0xFF101010, 0xFF212121, 0xFF3C3C3C, 0xFF767676, 0xFFD7D7D7, 0xFFF4F5F4,
+	0xFF535353, 0xFF3B3B3B, 0xFF2F2F2F, 0xFF262626, 0xFF202020, 0xFF1E1E1E, 0xFF1B1B1B, 0xFF1B1B1B,
+	0xFF191919, 0xFF1B1B1B, 0xFF1E1E1E, 0xFF222222, 0xFF282828, 0xFF2E2E2E, 0xFF383838, 0xFF454545,
+	0xFF565656, 0xFF6E6E6E, 0xFF848484, 0xFF8B8B8B, 0xFF8A8A8A, 0xFF8A8A8A, 0xFF929292, 0xFFADADAD,
+	0xFFAFAFAF, 0xFF838383, 0xFF666566, 0xFF535353, 0xFF484848, 0xFF424242, 0xFF434343, 0xFF4A4A4A,
+	0xFF535353, 0xFF525252, 0xFF4A4A4A, 0xFF464546, 0xFF434343, 0xFF414141, 0xFF3F3F3F, 0xFF383838,
+	0xFF2A2A2A, 0xFF212121, 0xFF1B1B1B, 0xFF161616, 0xFF131313, 0xFF101010, 0xFF0E0E0E, 0xFF0F0F0F,
+	0xFF111111, 0xFF131313, 0xFF1C1C1C, 0xFF292929, 0xFF3D3D3D, 0xFF626262, 0xFF9F9F9F, 0xFFC0C0C0,
+	0xFFC7C7C7, 0xFFC4C4C4, 0xFFB6B6B6, 0xFFB3B3B3, 0xFFBDBDBD, 0xFFC4C4C4, 0xFFC5C5C5, 0xFFC4C4C4,
+	0xFFAEAEAE, 0xFF808080, 0xFF595959, 0xFF3D3D3D, 0xFF2D2D2D, 0xFF222222, 0xFF1D1D1D, 0xFF1C1C1C,
+	0xFF1D1D1D, 0xFF242424, 0xFF2E2E2E, 0xFF414141, 0xFF5E5E5E, 0xFF6F6F6F, 0xFF626262, 0xFF565656,
+	0xFF4B4B4B, 0xFF3F3F3F, 0xFF373737, 0xFF343434, 0xFF333333, 0xFF333333, 0xFF343434, 0xFF3B3B3B,
+	0xFF454545, 0xFF515151, 0xFF5D5D5D, 0xFF6B6B6B, 0xFF797979, 0xFF858585, 0xFF959595, 0xFFA9A9A9,
+	0xFF9C9C9C, 0xFF898989, 0xFF7F7F7F, 0xFF7D7D7D, 0xFF777777, 0xFF545454, 0xFF333333, 0xFF222222,
+	0xFF181818, 0xFF131313, 0xFF0F0F0F, 0xFF0D0D0D, 0xFF101010, 0xFF0D0D0D, 0xFF040404, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF0A0A0A, 0xFF191919, 0xFF333333, 0xFF6C6C6C, 0xFFC6C6C6, 0xFFE2E2E2, 0xFF8E8E8E,
+	0xFF202020, 0xFF141414, 0xFF111111, 0xFF101010, 0xFF161616, 0xFF252525, 0xFF414141, 0xFF696969,
+	0xFF676767, 0xFF5D5D5D, 0xFF5D5D5D, 0xFF6B6B6B, 0xFF5F5F5F, 0xFF434343, 0xFF363636, 0xFF3A3A3A,
+	0xFF5C5B5C, 0xFFADADAD, 0xFFA6A6A6, 0xFF5B5B5B, 0xFF383838, 0xFF2A2A2A, 0xFF202020, 0xFF1D1D1D,
+	0xFF222222, 0xFF303030, 0xFF585858, 0xFFBFBFBF, 0xFFE6E6E6, 0xFFCBCBCB, 0xFFCFCFCF, 0xFFD1D1D1,
+	0xFFA3A3A3, 0xFF646464, 0xFF404040, 0xFF363636, 0xFF414141, 0xFF6D6E6D, 0xFFCBCBCB, 0xFFC0C0C0,
+	0xFF6E6E6E, 0xFF424242, 0xFF2F2F2F, 0xFF323232, 0xFF484848, 0xFF7B7B7B, 0xFFD1D1D1, 0xFFF6F6F6,
+	0xFFCACACA, 0xFF878787, 0xFF474747, 0xFF212121, 0xFF101010, 0xFF0D0D0D, 0xFF0F0F0F, 0xFF040404,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF101010, 0xFF4F4F4F, 0xFFBBBBBB, 0xFF4E4E4E,
+	0xFF0D0D0D, 0xFF090909, 0xFF090909, 0xFF0D0D0D, 0xFF1A1A1A, 0xFF393939, 0xFF616261, 0xFF454545,
+	0xFF373737, 0xFF3B3B3B, 0xFF434343, 0xFF424242, 0xFF383838, 0xFF2F2F2F, 0xFF2C2C2C, 0xFF343434,
+	0xFF4F4F4F, 0xFF7C7C7C, 0xFFA4A4A4, 0xFF949494, 0xFF6F6F6F, 0xFF5C5C5C, 0xFF4F4F4F, 0xFF454545,
+	0xFF434343, 0xFF4E4E4E, 0xFF6F6F6F, 0xFF939493, 0xFF717171, 0xFF5A5A5A, 0xFF4E4E4E, 0xFF484748,
+	0xFF484848, 0xFF494849, 0xFF4A4A4A, 0xFF4D4D4D, 0xFF565656, 0xFF605F60, 0xFF646464, 0xFF727272,
+	0xFF595959, 0xFF3C3C3C, 0xFF2E2E2E, 0xFF2E2E2E, 0xFF3C3C3C, 0xFF5B5B5B, 0xFF929292, 0xFF999999,
+	0xFF797979, 0xFF555555, 0xFF363636, 0xFF1D1D1D, 0xFF121212, 0xFF0E0E0E, 0xFF101010, 0xFF080808,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF050505, 0xFF202020, 0xFF9D9D9D, 0xFF8A8A8A, 0xFF232323,
+	0xFF0B0B0B, 0xFF090909, 0xFF0B0B0B, 0xFF131313, 0xFF2B2B2B, 0xFF5E5E5E, 0xFF404140, 0xFF2B2B2B,
+	0xFF292929, 0xFF2B2B2B, 0xFF282828, 0xFF292929, 0xFF282828, 0xFF272727, 0xFF2B2B2B, 0xFF343434,
+	0xFF303030, 0xFF313131, 0xFF404040, 0xFF616161, 0xFFADADAD, 0xFFDCDCDC, 0xFF969696, 0xFF737373,
+	0xFF777777, 0xFF787878, 0xFF838383, 0xFF7C7C7C, 0xFF4F4F4F, 0xFF373737, 0xFF292929, 0xFF202020,
+	0xFF1D1D1D, 0xFF1E1E1E, 0xFF202020, 0xFF242424, 0xFF272727, 0xFF292929, 0xFF2B2B2B, 0xFF2E2E2E,
+	0xFF3B3B3B, 0xFF404040, 0xFF393939, 0xFF363636, 0xFF3E3E3E, 0xFF505050, 0xFF696969, 0xFF696969,
+	0xFF636363, 0xFF535353, 0xFF3D3D3D, 0xFF2A2A2A, 0xFF1D1D1D, 0xFF161616, 0xFF141414, 0xFF0E0E0E,
+	0xFF080808, 0xFF060606, 0xFF070707, 0xFF131313, 0xFF3F3F3F, 0xFFD8D7D8, 0xFF5B5B5B, 0xFF1B1B1B,
+	0xFF161616, 0xFF141414, 0xFF1C1C1C, 0xFF2C2C2C, 0xFF5D5D5D, 0xFF727272, 0xFF393939, 0xFF292929,
+	0xFF212121, 0xFF191919, 0xFF1C1C1C, 0xFF222222, 0xFF272727, 0xFF2E2E2E, 0xFF3C3C3C, 0xFF434343,
+	0xFF2E2E2E, 0xFF292929, 0xFF303030, 0xFF434343, 0xFF7B7B7B, 0xFFC3C3C3, 0xFFA8A8A8, 0xFF696969,
+	0xFF6A6A6A, 0xFF8B8B8B, 0xFF828282, 0xFF858585, 0xFF575757, 0xFF353535, 0xFF222222, 0xFF151515,
+	0xFF111111, 0xFF111111, 0xFF121212, 0xFF151515, 0xFF161616, 0xFF171717, 0xFF171717, 0xFF161616,
+	0xFF191919, 0xFF1D1D1D, 0xFF262626, 0xFF303030, 0xFF3F3F3F, 0xFF535353, 0xFF656565, 0xFF707070,
+	0xFF737373, 0xFF6E6E6E, 0xFF5E5E5E, 0xFF484848, 0xFF343434, 0xFF272727, 0xFF1D1D1D, 0xFF181818,
+	0xFF161616, 0xFF171717, 0xFF1D1D1D, 0xFF343434, 0xFF949494, 0xFFD3D3D3, 0xFF4A4A4A, 0xFF212121,
+	0xFF2D2D2D, 0xFF2E2E2E, 0xFF363636, 0xFF545454, 0xFFBBBABB, 0xFFA7A8A7, 0xFF464746, 0xFF272727,
+	0xFF191919, 0xFF181818, 0xFF1D1D1D, 0xFF292929, 0xFF383838, 0xFF4F4F4F, 0xFF797979, 0xFF919191,
+	0xFF525252, 0xFF3D3D3D, 0xFF414141, 0xFF535353, 0xFF606060, 0xFF696969, 0xFF7C7C7C, 0xFF4D4D4D,
+	0xFF424242, 0xFF595959, 0xFF6B6B6B, 0xFF676767, 0xFF757575, 0xFF505050, 0xFF2C2C2C, 0xFF1A1A1A,
+	0xFF131313, 0xFF111111, 0xFF111111, 0xFF131313, 0xFF151515, 0xFF141414, 0xFF101010, 0xFF0D0D0D,
+	0xFF0D0D0D, 0xFF0E0E0E, 0xFF141414, 0xFF202020, 0xFF383838, 0xFF5F5F5F, 0xFF737373, 0xFF787878,
+	0xFF757575, 0xFF6E6E6E, 0xFF616161, 0xFF525252, 0xFF424242, 0xFF373737, 0xFF313131, 0xFF333333,
+	0xFF393939, 0xFF414141, 0xFF595959, 0xFFA2A2A2, 0xFFEBEBEB, 0xFF8C8C8C, 0xFF484848, 0xFF313131,
+	0xFF393939, 0xFF262626, 0xFF232323, 0xFF343434, 0xFF777777, 0xFF7C7C7C, 0xFF3B3B3B, 0xFF252525,
+	0xFF1E1E1E, 0xFF212121, 0xFF2E2E2E, 0xFF3C3C3C, 0xFF3A3A3A, 0xFF474747, 0xFF777777, 0xFFD6D6D6,
+	0xFFCDCDCD, 0xFFA0A0A0, 0xFF8D8D8D, 0xFF6A6A6A, 0xFF565656, 0xFF606060, 0xFF545454, 0xFF2D2D2D,
+	0xFF232323, 0xFF2B2B2B, 0xFF434343, 0xFF444444, 0xFF555555, 0xFF747474, 0xFF555555, 0xFF2F2F2F,
+	0xFF202020, 0xFF1C1C1C, 0xFF1D1D1D, 0xFF1F1F1F, 0xFF1F1F1F, 0xFF181818, 0xFF121212, 0xFF0C0C0C,
+	0xFF090909, 0xFF090909, 0xFF0F0F0F, 0xFF1F1F1F, 0xFF404040, 0xFF818181, 0xFF939393, 0xFF919191,
+	0xFF888888, 0xFF7E7E7E, 0xFF747474, 0xFF676767, 0xFF5D5D5D, 0xFF5B5B5B, 0xFF636363, 0xFF7E7E7E,
+	0xFF868686, 0xFF858585, 0xFF999999, 0xFFB8B8B8, 0xFF828282, 0xFF545554, 0xFF484848, 0xFF484848,
+	0xFF2B2B2B, 0xFF171717, 0xFF111111, 0xFF171717, 0xFF333333, 0xFF4D4D4D, 0xFF363636, 0xFF2D2D2D,
+	0xFF2D2D2D, 0xFF3A3A3A, 0xFF444344, 0xFF282828, 0xFF1C1C1C, 0xFF1F1F1F, 0xFF2D2D2D, 0xFF515151,
+	0xFF848484, 0xFFC8C8C8, 0xFFCECECE, 0xFF8D8D8D, 0xFF696969, 0xFF4E4E4E, 0xFF262626, 0xFF161616,
+	0xFF101010, 0xFF161616, 0xFF242424, 0xFF2F2F2F, 0xFF3E3E3E, 0xFF5F5E5F, 0xFF878787, 0xFF5C5C5C,
+	0xFF403F40, 0xFF383838, 0xFF393939, 0xFF313131, 0xFF2B2B2B, 0xFF292929, 0xFF1F1F1F, 0xFF121212,
+	0xFF0B0B0B, 0xFF0B0B0B, 0xFF121212, 0xFF292929, 0xFF626262, 0xFFC3C3C3, 0xFFC2C2C2, 0xFFA0A0A0,
+	0xFF868686, 0xFF797979, 0xFF7B7B7B, 0xFF7E7E7E, 0xFF848484, 0xFF949494, 0xFFB8B8B8, 0xFFEFEFEF,
+	0xFFEAEAEA, 0xFFADADAD, 0xFF7E7E7E, 0xFF555555, 0xFF404040, 0xFF3E3E3E, 0xFF4B4B4B, 0xFF525252,
+	0xFF252525, 0xFF0F0F0F, 0xFF070707, 0xFF070707, 0xFF151515, 0xFF343434, 0xFF373737, 0xFF3B3B3B,
+	0xFF4A4A4A, 0xFF626262, 0xFF464646, 0xFF252525, 0xFF1A1A1A, 0xFF171717, 0xFF1A1A1A, 0xFF262626,
+	0xFF373737, 0xFF454545, 0xFF464646, 0xFF3F3F3F, 0xFF2E2E2E, 0xFF1A1A1A, 0xFF0D0D0D, 0xFF080808,
+	0xFF080808, 0xFF0E0E0E, 0xFF1C1C1C, 0xFF242424, 0xFF363636, 0xFF585858, 0xFF939393, 0xFF979797,
+	0xFF6C6C6C, 0xFF656565, 0xFF464646, 0xFF2A2A2A, 0xFF212121, 0xFF262626, 0xFF2F2F2F, 0xFF232323,
+	0xFF171717, 0xFF151515, 0xFF1F1F1F, 0xFF444444, 0xFFBBBBBB, 0xFFD8D8D8, 0xFF7F7F7F, 0xFF5B5B5B,
+	0xFF4E4E4E, 0xFF4A4A4A, 0xFF4D4D4D, 0xFF555555, 0xFF605F60, 0xFF6D6D6D, 0xFF7E7E7E, 0xFF9F9F9F,
+	0xFFB9B9B9, 0xFF747474, 0xFF484848, 0xFF313131, 0xFF2A2A2A, 0xFF333333, 0xFF575757, 0xFF5C5C5C,
+	0xFF2A2A2A, 0xFF0D0D0D, 0xFF030303, 0xFF020202, 0xFF090909, 0xFF232323, 0xFF3E3E3E, 0xFF535353,
+	0xFF787878, 0xFFA1A1A1, 0xFF6E6E6E, 0xFF3F3F3F, 0xFF272727, 0xFF1C1C1C, 0xFF171717, 0xFF1A1A1A,
+	0xFF1D1D1D, 0xFF1D1D1D, 0xFF181818, 0xFF111111, 0xFF0B0B0B, 0xFF050505, 0xFF030303, 0xFF020202,
+	0xFF040404, 0xFF0E0E0E, 0xFF1D1D1D, 0xFF242424, 0xFF3B3B3B, 0xFF6C6C6C, 0xFFB9B9B9, 0xFFA2A2A2,
+	0xFF848484, 0xFF6C6C6C, 0xFF363636, 0xFF1E1E1E, 0xFF151515, 0xFF191919, 0xFF242424, 0xFF353535,
+	0xFF313131, 0xFF2C2C2C, 0xFF3E3E3E, 0xFF8A8A8A, 0xFFE5E5E5, 0xFF737373, 0xFF444444, 0xFF353535,
+	0xFF303030, 0xFF303030, 0xFF323232, 0xFF393939, 0xFF3D3D3D, 0xFF444444, 0xFF4E4E4E, 0xFF646464,
+	0xFFA9A9A9, 0xFF737373, 0xFF434343, 0xFF2A2A2A, 0xFF272727, 0xFF393939, 0xFF808080, 0xFF7C7C7C,
+	0xFF363636, 0xFF101010, 0xFF030303, 0xFF020202, 0xFF040404, 0xFF181818, 0xFF454545, 0xFF727272,
+	0xFFB6B6B6, 0xFFF0F0F0, 0xFFE1E1E1, 0xFF9D9D9D, 0xFF5C5C5C, 0xFF393939, 0xFF2A2A2A, 0xFF222222,
+	0xFF1D1D1D, 0xFF161616, 0xFF0E0E0E, 0xFF070707, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF050505, 0xFF151515, 0xFF1E1E1E, 0xFF2E2F2E, 0xFF585858, 0xFFACACAC, 0xFFA7A7A7, 0xFF757575,
+	0xFF6F6F6F, 0xFF4E4E4E, 0xFF282828, 0xFF141414, 0xFF0C0C0C, 0xFF0D0D0D, 0xFF161616, 0xFF252525,
+	0xFF383838, 0xFF484848, 0xFF636363, 0xFFABABAB, 0xFFA7A7A7, 0xFF4A4A4A, 0xFF2F2F2F, 0xFF272727,
+	0xFF232323, 0xFF232323, 0xFF252525, 0xFF292929, 0xFF2C2C2C, 0xFF313131, 0xFF3A3A3A, 0xFF505050,
+	0xFFBDBDBD, 0xFFA5A5A5, 0xFF3C3C3C, 0xFF1E1E1E, 0xFF1F1F1F, 0xFF3B3B3B, 0xFFB4B4B4, 0xFFA0A0A0,
+	0xFF303030, 0xFF181818, 0xFF050505, 0xFF020202, 0xFF040404, 0xFF151515, 0xFF4C4C4C, 0xFFA1A1A1,
+	0xFFD1D1D1, 0xFFB6B6B6, 0xFFC7C6C7, 0xFFE2E2E2, 0xFFC8C8C8, 0xFFA3A3A3, 0xFF7C7C7C, 0xFF555555,
+	0xFF3D3D3D, 0xFF2A2A2A, 0xFF191919, 0xFF0B0B0B, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF0A0A0A, 0xFF1C1C1C, 0xFF292929, 0xFF4A4A4A, 0xFF9B9B9B, 0xFF979797, 0xFF5B5B5B, 0xFF474747,
+	0xFF4C4C4C, 0xFF363636, 0xFF1B1B1B, 0xFF0D0D0D, 0xFF060606, 0xFF080808, 0xFF0F0F0F, 0xFF1C1C1C,
+	0xFF2B2B2B, 0xFF3E3E3E, 0xFF5A5A5A, 0xFFA1A1A1, 0xFF8C8C8C, 0xFF4A4A4A, 0xFF333333, 0xFF292929,
+	0xFF252525, 0xFF232323, 0xFF232323, 0xFF232323, 0xFF262626, 0xFF282828, 0xFF2F2F2F, 0xFF454545,
+	0xFF828282, 0xFF848484, 0xFF272727, 0xFF131313, 0xFF131313, 0xFF292929, 0xFF7D7D7D, 0xFF656565,
+	0xFF262626, 0xFF1C1C1C, 0xFF0C0C0C, 0xFF020202, 0xFF040404, 0xFF141414, 0xFF464646, 0xFFD3D3D3,
+	0xFFC7C7C7, 0xFF838383, 0xFF757575, 0xFF7B7B7B, 0xFF8C8C8C, 0xFF8A8A8A, 0xFFA0A0A0, 0xFFD6D6D6,
+	0xFFBFBFBF, 0xFF5F5E5F, 0xFF333333, 0xFF1F1F1F, 0xFF121212, 0xFF070707, 0xFF030303, 0xFF040404,
+	0xFF121212, 0xFF252525, 0xFF424242, 0xFF858585, 0xFF8E8E8E, 0xFF4F4F4F, 0xFF333333, 0xFF2C2C2C,
+	0xFF333333, 0xFF282828, 0xFF151515, 0xFF0A0A0A, 0xFF040404, 0xFF070707, 0xFF0D0D0D, 0xFF1A1A1A,
+	0xFF2A2A2A, 0xFF3F3F3F, 0xFF5F5F5F, 0xFFA8A8A8, 0xFFABABAB, 0xFF6F6F6F, 0xFF545454, 0xFF444444,
+	0xFF3B3B3B, 0xFF373737, 0xFF313131, 0xFF292929, 0xFF202020, 0xFF1A1A1A, 0xFF181818, 0xFF1D1D1D,
+	0xFF2F2F2F, 0xFF494949, 0xFF1C1C1C, 0xFF0B0B0B, 0xFF0B0B0B, 0xFF1C1C1C, 0xFF545454, 0xFF424242,
+	0xFF222222, 0xFF1D1D1D, 0xFF151515, 0xFF050505, 0xFF040404, 0xFF111111, 0xFF363636, 0xFFADADAD,
+	0xFFD2D2D2, 0xFFA0A0A0, 0xFF838383, 0xFF6C6C6C, 0xFF606060, 0xFF555555, 0xFF4C4C4C, 0xFF494949,
+	0xFF535353, 0xFF5C5C5C, 0xFF363636, 0xFF1C1C1C, 0xFF151515, 0xFF141414, 0xFF0E0E0E, 0xFF0E0E0E,
+	0xFF1B1B1B, 0xFF383838, 0xFF686868, 0xFFA1A1A1, 0xFF585858, 0xFF323232, 0xFF1F1F1F, 0xFF1B1B1B,
+	0xFF242424, 0xFF2C2C2C, 0xFF181818, 0xFF0C0C0C, 0xFF080808, 0xFF090909, 0xFF121212, 0xFF222222,
+	0xFF363636, 0xFF4F4F4F, 0xFF777777, 0xFFCFCFCF, 0xFFF6F6F6, 0xFFDBDBDB, 0xFFBCBCBC, 0xFF9E9E9E,
+	0xFF707070, 0xFF464646, 0xFF2D2D2D, 0xFF1C1C1C, 0xFF121212, 0xFF0C0C0C, 0xFF0A0A0A, 0xFF0C0C0C,
+	0xFF141414, 0xFF262626, 0xFF181818, 0xFF060606, 0xFF040404, 0xFF121212, 0xFF363636, 0xFF353535,
+	0xFF282828, 0xFF222222, 0xFF1B1B1B, 0xFF080808, 0xFF030303, 0xFF0B0B0B, 0xFF232323, 0xFF626262,
+	0xFF848484, 0xFF767676, 0xFFA3A3A3, 0xFFBFBFBF, 0xFF7E7E7E, 0xFF4B4B4B, 0xFF2C2C2C, 0xFF1A1A1A,
+	0xFF131313, 0xFF171717, 0xFF252525, 0xFF1B1B1B, 0xFF101010, 0xFF101010, 0xFF151515, 0xFF1B1B1B,
+	0xFF252525, 0xFF494949, 0xFF818181, 0xFF9F9F9F, 0xFF4C4C4C, 0xFF262626, 0xFF151515, 0xFF111111,
+	0xFF191919, 0xFF383838, 0xFF2E2E2E, 0xFF171717, 0xFF0F0F0F, 0xFF121212, 0xFF1B1B1B, 0xFF1F1F1F,
+	0xFF2C2C2C, 0xFF535353, 0xFFA4A4A4, 0xFFFBFBFB, 0xFFF4F4F4, 0xFFE0E0E0, 0xFFF1F1F1, 0xFFD0D0D0,
+	0xFF636363, 0xFF353535, 0xFF212121, 0xFF151515, 0xFF0D0D0D, 0xFF090909, 0xFF090909, 0xFF090909,
+	0xFF0E0E0E, 0xFF1A1A1A, 0xFF1A1A1A, 0xFF050505, 0xFF020202, 0xFF090909, 0xFF1E1E1E, 0xFF383838,
+	0xFF434343, 0xFF313131, 0xFF262626, 0xFF0B0B0B, 0xFF030303, 0xFF080808, 0xFF171717, 0xFF343434,
+	0xFF4E4E4E, 0xFF464646, 0xFF5B5B5B, 0xFFB8B8B8, 0xFFE1E1E1, 0xFF727272, 0xFF313131, 0xFF131313,
+	0xFF090909, 0xFF080808, 0xFF0D0D0D, 0xFF161616, 0xFF0F0F0F, 0xFF0D0D0D, 0xFF131313, 0xFF1E1E1E,
+	0xFF282828, 0xFF464646, 0xFF6B6B6B, 0xFF757575, 0xFF4F4F4F, 0xFF272727, 0xFF141414, 0xFF0F0F0F,
+	0xFF161616, 0xFF393939, 0xFF737373, 0xFF3B3B3B, 0xFF262626, 0xFF222222, 0xFF1A1A1A, 0xFF191919,
+	0xFF242424, 0xFF474747, 0xFFA0A0A0, 0xFFE5E5E5, 0xFFBDBCBD, 0xFF9D9D9D, 0xFF959595, 0xFF878787,
+	0xFF4F4F4F, 0xFF2B2B2B, 0xFF1D1D1D, 0xFF151515, 0xFF101010, 0xFF0D0D0D, 0xFF0C0C0C, 0xFF0E0E0E,
+	0xFF121212, 0xFF202020, 0xFF262626, 0xFF0B0B0B, 0xFF020202, 0xFF030303, 0xFF0E0E0E, 0xFF2E2E2E,
+	0xFF656565, 0xFF626262, 0xFF363636, 0xFF111111, 0xFF060606, 0xFF080808, 0xFF101010, 0xFF212121,
+	0xFF2E2E2E, 0xFF282828, 0xFF313131, 0xFF4D4C4D, 0xFF909090, 0xFFD5D5D5, 0xFF636363, 0xFF212121,
+	0xFF0E0E0E, 0xFF090909, 0xFF0B0B0B, 0xFF141414, 0xFF0E0E0E, 0xFF0C0C0C, 0xFF111111, 0xFF1A1A1A,
+	0xFF252525, 0xFF353535, 0xFF414141, 0xFF373737, 0xFF252525, 0xFF191919, 0xFF111111, 0xFF101010,
+	0xFF191919, 0xFF3A3A3A, 0xFFAEAEAE, 0xFF9D9D9D, 0xFF434343, 0xFF282828, 0xFF1C1C1C, 0xFF1C1C1C,
+	0xFF292929, 0xFF4C4C4C, 0xFF959595, 0xFF929292, 0xFF939393, 0xFF898989, 0xFF747474, 0xFF5E5E5E,
+	0xFF3C3C3C, 0xFF252525, 0xFF1F1F1F, 0xFF1B1B1B, 0xFF1B1B1B, 0xFF1A1A1A, 0xFF1A1A1A, 0xFF1C1C1C,
+	0xFF252525, 0xFF393939, 0xFF4B4B4B, 0xFF171717, 0xFF070707, 0xFF040404, 0xFF0E0E0E, 0xFF262626,
+	0xFFA0A0A0, 0xFFB9B9B9, 0xFF3A3A3A, 0xFF141414, 0xFF090909, 0xFF0A0A0A, 0xFF101010, 0xFF191919,
+	0xFF1F1F1F, 0xFF171717, 0xFF191919, 0xFF242424, 0xFF393939, 0xFF8C8C8C, 0xFFCBCBCB, 0xFF5D5D5D,
+	0xFF282828, 0xFF1C1C1C, 0xFF1D1D1D, 0xFF171717, 0xFF0D0D0D, 0xFF0B0B0B, 0xFF0F0F0F, 0xFF161616,
+	0xFF1F1F1F, 0xFF262626, 0xFF252525, 0xFF1A1A1A, 0xFF0E0E0E, 0xFF040404, 0xFF020202, 0xFF030303,
+	0xFF0B0B0B, 0xFF1A1A1A, 0xFF3E3E3E, 0xFF7C7C7C, 0xFF515151, 0xFF333333, 0xFF272727, 0xFF272727,
+	0xFF363636, 0xFF595959, 0xFF696969, 0xFF646464, 0xFF858585, 0xFF939393, 0xFF717171, 0xFF4D4D4D,
+	0xFF2E2E2E, 0xFF242424, 0xFF242424, 0xFF2A2A2A, 0xFF333333, 0xFF363636, 0xFF383838, 0xFF393939,
+	0xFF404040, 0xFF666666, 0xFFB6B6B6, 0xFF4C4C4C, 0xFF1D1D1D, 0xFF141414, 0xFF1E1E1E, 0xFF3E3E3E,
+	0xFF868686, 0xFF7B7B7B, 0xFF313131, 0xFF151515, 0xFF0D0D0D, 0xFF0C0C0C, 0xFF101010, 0xFF161616,
+	0xFF181818, 0xFF111111, 0xFF0F0F0F, 0xFF151515, 0xFF212121, 0xFF3A3A3A, 0xFF5D5D5D, 0xFF6F6F6F,
+	0xFF565656, 0xFF3E3E3E, 0xFF2B2B2B, 0xFF1A1A1A, 0xFF121212, 0xFF101010, 0xFF111111, 0xFF161616,
+	0xFF1A1A1A, 0xFF1E1E1E, 0xFF1C1C1C, 0xFF141414, 0xFF0B0B0B, 0xFF030303, 0xFF020202, 0xFF030303,
+	0xFF050505, 0xFF0E0E0E, 0xFF1D1D1D, 0xFF373737, 0xFF545354, 0xFF4C4C4C, 0xFF424242, 0xFF434343,
+	0xFF484848, 0xFF4A4A4A, 0xFF494949, 0xFF565656, 0xFF9A9A9A, 0xFFB6B6B6, 0xFF6B6B6B, 0xFF353535,
+	0xFF242424, 0xFF232323, 0xFF2E2E2E, 0xFF444444, 0xFF5D5D5D, 0xFF6B6B6B, 0xFF545454, 0xFF373737,
+	0xFF2F2F2F, 0xFF3E3E3E, 0xFF8E8E8E, 0xFF959595, 0xFF4A4A4A, 0xFF343534, 0xFF353535, 0xFF4C4C4C,
+	0xFF555555, 0xFF404040, 0xFF242424, 0xFF151515, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF111111, 0xFF141414,
+	0xFF151515, 0xFF111111, 0xFF101010, 0xFF101010, 0xFF151515, 0xFF212121, 0xFF2C2C2C, 0xFF323232,
+	0xFF333333, 0xFF323232, 0xFF2C2C2C, 0xFF272727, 0xFF212121, 0xFF202020, 0xFF212121, 0xFF1D1D1D,
+	0xFF181818, 0xFF1D1D1D, 0xFF232323, 0xFF1C1C1C, 0xFF141414, 0xFF0D0D0D, 0xFF090909, 0xFF090909,
+	0xFF0C0C0C, 0xFF111111, 0xFF171717, 0xFF202020, 0xFF292929, 0xFF353535, 0xFF393939, 0xFF3B3B3B,
+	0xFF3B3B3B, 0xFF3D3D3D, 0xFF454545, 0xFF676767, 0xFFD9D9D9, 0xFFACACAC, 0xFF404040, 0xFF212121,
+	0xFF1C1C1C, 0xFF222222, 0xFF3C3C3C, 0xFF6A6A6A, 0xFFA8A8A8, 0xFF8D8D8D, 0xFF4B4A4B, 0xFF2E2E2E,
+	0xFF202020, 0xFF202020, 0xFF2F2F2F, 0xFF525252, 0xFF494949, 0xFF333333, 0xFF2F2F2F, 0xFF3D3D3D,
+	0xFF353535, 0xFF2D2D2D, 0xFF222222, 0xFF1A1A1A, 0xFF151515, 0xFF121212, 0xFF131313, 0xFF141414,
+	0xFF141414, 0xFF111111, 0xFF101010, 0xFF101010, 0xFF141414, 0xFF1B1B1B, 0xFF252525, 0xFF282828,
+	0xFF2A2A2A, 0xFF303030, 0xFF383838, 0xFF3F3F3F, 0xFF3D3D3D, 0xFF333333, 0xFF252525, 0xFF1E1E1E,
+	0xFF202020, 0xFF282828, 0xFF3A3A3A, 0xFF424242, 0xFF3D3D3D, 0xFF353535, 0xFF2F2F2F, 0xFF2C2C2C,
+	0xFF2A2A2A, 0xFF292929, 0xFF242424, 0xFF222222, 0xFF232323, 0xFF282828, 0xFF313131, 0xFF3C3C3C,
+	0xFF474747, 0xFF535353, 0xFF6D6D6D, 0xFF9F9F9F, 0xFFCCCCCC, 0xFF575757, 0xFF232323, 0xFF151515,
+	0xFF151515, 0xFF212121, 0xFF464646, 0xFF929292, 0xFFE4E4E4, 0xFF808080, 0xFF4B4B4B, 0xFF2E2E2E,
+	0xFF202020, 0xFF181818, 0xFF181818, 0xFF1F1F1F, 0xFF2C2C2C, 0xFF323232, 0xFF343434, 0xFF373737,
+	0xFF303030, 0xFF323232, 0xFF303030, 0xFF282828, 0xFF202020, 0xFF191919, 0xFF171717, 0xFF171717,
+	0xFF161616, 0xFF141414, 0xFF131313, 0xFF141414, 0xFF171717, 0xFF1C1C1C, 0xFF242424, 0xFF2A2A2A,
+	0xFF2B2B2B, 0xFF2D2D2D, 0xFF2A2A2A, 0xFF242424, 0xFF1E1E1E, 0xFF1B1B1B, 0xFF1E1E1E, 0xFF262626,
+	0xFF393939, 0xFF525252, 0xFF6B6A6B, 0xFF747474, 0xFF6D6D6D, 0xFF5F5F5F, 0xFF4E4E4E, 0xFF3D3D3D,
+	0xFF333333, 0xFF313131, 0xFF373737, 0xFF3D3D3D, 0xFF3A3A3A, 0xFF3F3F3F, 0xFF4E4E4E, 0xFF6A6A6A,
+	0xFF8F8F8F, 0xFFA9A9A9, 0xFF989898, 0xFF8B8B8B, 0xFF757575, 0xFF313131, 0xFF161616, 0xFF0F0F0F,
+	0xFF101010, 0xFF1E1E1E, 0xFF424242, 0xFF989898, 0xFFF1F1F1, 0xFF909090, 0xFF5A5A5A, 0xFF3C3C3C,
+	0xFF2A2A2A, 0xFF1C1C1C, 0xFF151515, 0xFF141414, 0xFF151515, 0xFF1A1A1A, 0xFF212121, 0xFF282828,
+	0xFF4E4E4E, 0xFF575757, 0xFF4C4C4C, 0xFF454545, 0xFF3E3E3E, 0xFF2E2E2E, 0xFF232323, 0xFF1F1F1F,
+	0xFF1E1E1E, 0xFF1D1D1D, 0xFF1D1D1D, 0xFF1D1D1D, 0xFF1F1F1F, 0xFF222222, 0xFF222222, 0xFF1F1F1F,
+	0xFF1B1B1B, 0xFF151515, 0xFF111111, 0xFF0D0D0D, 0xFF0E0E0E, 0xFF141414, 0xFF242424, 0xFF484848,
+	0xFF6F6F6F, 0xFF858585, 0xFF8B8B8B, 0xFF8C8C8C, 0xFF808080, 0xFF626262, 0xFF383838, 0xFF202020,
+	0xFF141414, 0xFF141414, 0xFF1C1C1C, 0xFF343434, 0xFF585858, 0xFF868686, 0xFFC5C5C5, 0xFFECECEC,
+	0xFFF7F7F7, 0xFFC3C3C3, 0xFF828282, 0xFF6A6B6A, 0xFF464646, 0xFF212121, 0xFF111111, 0xFF0D0D0D,
+	0xFF0F0F0F, 0xFF191919, 0xFF353535, 0xFF777777, 0xFFE6E6E6, 0xFFCACACA, 0xFF8B8B8B, 0xFF676767,
+	0xFF474747, 0xFF2E2E2E, 0xFF1D1D1D, 0xFF161616, 0xFF141414, 0xFF181818, 0xFF242424, 0xFF353535,
+	0xFF5F5F5F, 0xFF3B3B3B, 0xFF303030, 0xFF353535, 0xFF424242, 0xFF505050, 0xFF404040, 0xFF343434,
+	0xFF313131, 0xFF303030, 0xFF303030, 0xFF313131, 0xFF303030, 0xFF2B2B2B, 0xFF232323, 0xFF1A1A1A,
+	0xFF131313, 0xFF0C0C0C, 0xFF080808, 0xFF060606, 0xFF090909, 0xFF171717, 0xFF3B3B3B, 0xFF4C4C4C,
+	0xFF3D3D3D, 0xFF343434, 0xFF323232, 0xFF333333, 0xFF353535, 0xFF3B3B3B, 0xFF323232, 0xFF161616,
+	0xFF0A0A0A, 0xFF0A0A0A, 0xFF101010, 0xFF232323, 0xFF454445, 0xFF808080, 0xFFB3B3B3, 0xFFA2A2A2,
+	0xFF8E8E8E, 0xFF818181, 0xFF686868, 0xFF4E4E4E, 0xFF3B3B3B, 0xFF252525, 0xFF161616, 0xFF111111,
+	0xFF101010, 0xFF181818, 0xFF2A2A2A, 0xFF565656, 0xFFACACAC, 0xFFF9F9F9, 0xFFEAEAEA, 0xFFCBCBCB,
+	0xFF929392, 0xFF595959, 0xFF353535, 0xFF232323, 0xFF202020, 0xFF262626, 0xFF3C3C3C, 0xFF676767,
+	0xFF414141, 0xFF282828, 0xFF262626, 0xFF343434, 0xFF505050, 0xFF7C7C7C, 0xFF8E8E8E, 0xFF6A6A6A,
+	0xFF5B5B5B, 0xFF404040, 0xFF2E2E2E, 0xFF2B2B2B, 0xFF333333, 0xFF373737, 0xFF282828, 0xFF181818,
+	0xFF0F0F0F, 0xFF070707, 0xFF030303, 0xFF040404, 0xFF0B0B0B, 0xFF232323, 0xFF4F4F4F, 0xFF373737,
+	0xFF252525, 0xFF1C1C1C, 0xFF171717, 0xFF161616, 0xFF181818, 0xFF1C1C1C, 0xFF1E1E1E, 0xFF141414,
+	0xFF070707, 0xFF070707, 0xFF0F0F0F, 0xFF232323, 0xFF3A3A3A, 0xFF494949, 0xFF525252, 0xFF5B5B5B,
+	0xFF656565, 0xFF6B6B6B, 0xFF505050, 0xFF333333, 0xFF2F2F2F, 0xFF323232, 0xFF262626, 0xFF1C1C1C,
+	0xFF181818, 0xFF1C1C1C, 0xFF282828, 0xFF454545, 0xFF878787, 0xFFE8E7E8, 0xFFFFFEFF, 0xFFFFFFFF,
+	0xFFF8F9F8, 0xFFBABABA, 0xFF6C6C6C, 0xFF484848, 0xFF404040, 0xFF4F4F4F, 0xFF898989, 0xFF878787,
+	0xFF444444, 0xFF2D2D2D, 0xFF2E2E2E, 0xFF3B3B3B, 0xFF595959, 0xFF9C9C9C, 0xFFE4E4E4, 0xFFECECEC,
+	0xFFC2C2C2, 0xFF636363, 0xFF383838, 0xFF2D2D2D, 0xFF303030, 0xFF3D3D3D, 0xFF2B2B2B, 0xFF191919,
+	0xFF0E0E0E, 0xFF080808, 0xFF040404, 0xFF050505, 0xFF0F0F0F, 0xFF373737, 0xFF6E6E6E, 0xFF3D3D3D,
+	0xFF1D1D1D, 0xFF141414, 0xFF101010, 0xFF111111, 0xFF111111, 0xFF131313, 0xFF141414, 0xFF151515,
+	0xFF0D0D0D, 0xFF0C0C0C, 0xFF121212, 0xFF171717, 0xFF1B1B1B, 0xFF262626, 0xFF373737, 0xFF515151,
+	0xFF737373, 0xFF737373, 0xFF393939, 0xFF1D1D1D, 0xFF161616, 0xFF202020, 0xFF383838, 0xFF3C3C3C,
+	0xFF2F2F2F, 0xFF2D2D2D, 0xFF333333, 0xFF4B4B4B, 0xFF818181, 0xFFDDDEDD, 0xFFFFFFFF, 0xFFFEFEFE,
+	0xFFECECEC, 0xFFB8B8B8, 0xFF7E7E7E, 0xFF5C5C5C, 0xFF585858, 0xFF7E7E7E, 0xFFE9E9E9, 0xFF8F8F8F,
+	0xFF3A3A3A, 0xFF242424, 0xFF1B1B1B, 0xFF1B1B1B, 0xFF252525, 0xFF393939, 0xFF585858, 0xFF7F7F7F,
+	0xFFA1A1A1, 0xFFA7A7A7, 0xFF7F7F7F, 0xFF555555, 0xFF505050, 0xFF4B4B4B, 0xFF2C2C2C, 0xFF1B1B1B,
+	0xFF111111, 0xFF0B0B0B, 0xFF080808, 0xFF090909, 0xFF131313, 0xFF464646, 0xFFC3C3C3, 0xFF3C3C3C,
+	0xFF111111, 0xFF090909, 0xFF0D0D0D, 0xFF121212, 0xFF141414, 0xFF161616, 0xFF171717, 0xFF151515,
+	0xFF111111, 0xFF0C0C0C, 0xFF0A0A0A, 0xFF0A0A0A, 0xFF101010, 0xFF1B1B1B, 0xFF333333, 0xFF616161,
+	0xFFAAAAAA, 0xFF707070, 0xFF292929, 0xFF0F0F0F, 0xFF090909, 0xFF0C0C0C, 0xFF1C1C1C, 0xFF414141,
+	0xFF5F5F5F, 0xFF5A5A5A, 0xFF575757, 0xFF686868, 0xFF848484, 0xFF999999, 0xFFC1C1C1, 0xFFF1F1F1,
+	0xFFBBBBBB, 0xFF7B7B7B, 0xFF505050, 0xFF383838, 0xFF333333, 0xFF484848, 0xFF939393, 0xFF6A6A6A,
+	0xFF323232, 0xFF1A1A1A, 0xFF101010, 0xFF0C0C0C, 0xFF0D0D0D, 0xFF141414, 0xFF1F1F1F, 0xFF2E2E2E,
+	0xFF3D3D3D, 0xFF535353, 0xFF8C8C8C, 0xFFD4D4D4, 0xFFA5A5A5, 0xFF555555, 0xFF323232, 0xFF212121,
+	0xFF191919, 0xFF111111, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF171717, 0xFF474747, 0xFFB5B5B5, 0xFF3C3C3C,
+	0xFF0F0F0F, 0xFF050505, 0xFF050505, 0xFF0E0E0E, 0xFF1D1D1D, 0xFF272727, 0xFF262626, 0xFF1F1F1F,
+	0xFF171717, 0xFF0F0F0F, 0xFF0A0A0A, 0xFF090909, 0xFF0E0E0E, 0xFF1C1C1C, 0xFF404040, 0xFF858585,
+	0xFFEDEDED, 0xFF686868, 0xFF1E1E1E, 0xFF070707, 0xFF030303, 0xFF030303, 0xFF0C0C0C, 0xFF1F1F1F,
+	0xFF414141, 0xFF636363, 0xFF696969, 0xFF5D5D5D, 0xFF4F4F4F, 0xFF4D4D4D, 0xFF616161, 0xFF939393,
+	0xFFABABAB, 0xFF636363, 0xFF383838, 0xFF212121, 0xFF1A1A1A, 0xFF232323, 0xFF4A494A, 0xFF605F60,
+	0xFF444444, 0xFF1F1F1F, 0xFF0F0F0F, 0xFF060606, 0xFF040404, 0xFF040404, 0xFF0A0A0A, 0xFF121212,
+	0xFF1E1E1E, 0xFF2E2E2E, 0xFF565656, 0xFF8C8C8C, 0xFF929292, 0xFF5A5A5A, 0xFF3B3B3B, 0xFF2B2B2B,
+	0xFF1D1D1D, 0xFF111111, 0xFF0D0D0D, 0xFF0F0F0F, 0xFF1A1A1A, 0xFF383838, 0xFF6D6D6D, 0xFF575757,
+	0xFF151515, 0xFF050505, 0xFF020202, 0xFF050505, 0xFF0D0D0D, 0xFF222222, 0xFF3C3C3C, 0xFF3C3C3C,
+	0xFF292929, 0xFF181818, 0xFF101010, 0xFF0D0D0D, 0xFF141414, 0xFF292929, 0xFF505050, 0xFF737373,
+	0xFFC9C9C9, 0xFF606060, 0xFF181818, 0xFF040404, 0xFF020202, 0xFF020202, 0xFF070707, 0xFF151515,
+	0xFF282828, 0xFF373737, 0xFF3B3B3B, 0xFF353535, 0xFF303030, 0xFF303030, 0xFF3D3D3D, 0xFF595959,
+	0xFF7C7C7C, 0xFF626262, 0xFF2E2E2E, 0xFF151515, 0xFF0D0D0D, 0xFF0E0E0E, 0xFF1F1F1F, 0xFF4C4C4C,
+	0xFF5E5E5E, 0xFF3F3F3F, 0xFF171717, 0xFF070707, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF060606,
+	0xFF111111, 0xFF1D1D1D, 0xFF282828, 0xFF303030, 0xFF303030, 0xFF2B2B2B, 0xFF202020, 0xFF131313,
+	0xFF090909, 0xFF050505, 0xFF050505, 0xFF0C0C0C, 0xFF1B1B1B, 0xFF343434, 0xFF5D5D5D, 0xFF797979,
+	0xFF222222, 0xFF0A0A0A, 0xFF020202, 0xFF020202, 0xFF050505, 0xFF0D0D0D, 0xFF1C1C1C, 0xFF393939,
+	0xFF484848, 0xFF323232, 0xFF202020, 0xFF1C1C1C, 0xFF262626, 0xFF464646, 0xFF515151, 0xFF777877,
+	0xFF6B6B6B, 0xFF484848, 0xFF151515, 0xFF040404, 0xFF020202, 0xFF020202, 0xFF090909, 0xFF171717,
+	0xFF282828, 0xFF323232, 0xFF333333, 0xFF313131, 0xFF2E2E2E, 0xFF303030, 0xFF393939, 0xFF505050,
+	0xFF676767, 0xFF666666, 0xFF2E2E2E, 0xFF111111, 0xFF060606, 0xFF040404, 0xFF0C0C0C, 0xFF282828,
+	0xFF4D4D4D, 0xFF9D9D9D, 0xFF404040, 0xFF131313, 0xFF040404, 0xFF020202, 0xFF020202, 0xFF050505,
+	0xFF0D0D0D, 0xFF191919, 0xFF1A1A1A, 0xFF191919, 0xFF131313, 0xFF0D0D0D, 0xFF060606, 0xFF030303,
+	0xFF020202, 0xFF020202, 0xFF040404, 0xFF0E0E0E, 0xFF232323, 0xFF373737, 0xFF767676, 0xFFBBBBBB,
+	0xFF393939, 0xFF121212, 0xFF050505, 0xFF020202, 0xFF020202, 0xFF040404, 0xFF0B0B0B, 0xFF161616,
+	0xFF2B2B2B, 0xFF484848, 0xFF444444, 0xFF383938, 0xFF484848, 0xFF787878, 0xFF838283, 0xFF696969,
+	0xFF3D3D3D, 0xFF2F2F2F, 0xFF181818, 0xFF060606, 0xFF020202, 0xFF080808, 0xFF151515, 0xFF292929,
+	0xFF393939, 0xFF444544, 0xFF474747, 0xFF454445, 0xFF424242, 0xFF2D2D2D, 0xFF2A2A2A, 0xFF484848,
+	0xFF7F7E7F, 0xFF747474, 0xFF383838, 0xFF111111, 0xFF030303, 0xFF020202, 0xFF040404, 0xFF171717,
+	0xFF303030, 0xFF8D8D8D, 0xFFBCBCBC, 0xFF353535, 0xFF0F0F0F, 0xFF040404, 0xFF020202, 0xFF080808,
+	0xFF121212, 0xFF262626, 0xFF252525, 0xFF1B1B1B, 0xFF111111, 0xFF0A0A0A, 0xFF030303, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF050505, 0xFF191919, 0xFF363636, 0xFF424242, 0xFF787878, 0xFFDCDCDC,
+	0xFF545454, 0xFF1A1A1A, 0xFF0A0A0A, 0xFF030303, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF0C0C0C,
+	0xFF1A1A1A, 0xFF383838, 0xFF6F6F6F, 0xFF828282, 0xFF969696, 0xFFE4E4E4, 0xFFADAEAD, 0xFF4D4D4D,
+	0xFF313131, 0xFF272727, 0xFF1E1E1E, 0xFF121212, 0xFF0F0F0F, 0xFF181818, 0xFF252525, 0xFF2C2C2C,
+	0xFF333333, 0xFF464646, 0xFF818181, 0xFF898989, 0xFF3D3D3D, 0xFF1A1A1A, 0xFF171717, 0xFF2C2C2C,
+	0xFF828282, 0xFFA9A9A9, 0xFF4D4D4D, 0xFF181818, 0xFF040404, 0xFF020202, 0xFF030303, 0xFF111111,
+	0xFF0D0D0D, 0xFF262626, 0xFF8F8F8F, 0xFF7D7D7D, 0xFF272727, 0xFF0E0E0E, 0xFF0B0B0B, 0xFF121212,
+	0xFF1F1F1F, 0xFF3E3E3E, 0xFF626262, 0xFF474747, 0xFF282828, 0xFF151515, 0xFF080808, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF090909, 0xFF262626, 0xFF555555, 0xFF575757, 0xFF858585, 0xFF838383,
+	0xFF4C4C4C, 0xFF232323, 0xFF101010, 0xFF090909, 0xFF060606, 0xFF050505, 0xFF060606, 0xFF0D0D0D,
+	0xFF1B1B1B, 0xFF404040, 0xFF9F9F9F, 0xFFEAEAEA, 0xFF9E9E9E, 0xFF6D6D6D, 0xFF545454, 0xFF424242,
+	0xFF353535, 0xFF2F2F2F, 0xFF2A2A2A, 0xFF262626, 0xFF262626, 0xFF272727, 0xFF262626, 0xFF282828,
+	0xFF2E2E2E, 0xFF434343, 0xFFB2B2B2, 0xFFA1A1A1, 0xFF282828, 0xFF101010, 0xFF0E0E0E, 0xFF1F1F1F,
+	0xFF595959, 0xFFE4E4E4, 0xFF747474, 0xFF252525, 0xFF0B0B0B, 0xFF020202, 0xFF030303, 0xFF050505,
+	0xFF030303, 0xFF0F0F0F, 0xFF444444, 0xFF8F8F8F, 0xFF545454, 0xFF242424, 0xFF1D1D1D, 0xFF242424,
+	0xFF3B3B3B, 0xFF626262, 0xFFA2A2A2, 0xFFD0D0D0, 0xFFB8B8B8, 0xFF696969, 0xFF282828, 0xFF0F0F0F,
+	0xFF060606, 0xFF050505, 0xFF111111, 0xFF353535, 0xFF747474, 0xFF6E6E6E, 0xFF787878, 0xFF474747,
+	0xFF2D2D2D, 0xFF242424, 0xFF191919, 0xFF121212, 0xFF0F0F0F, 0xFF0F0F0F, 0xFF101010, 0xFF171717,
+	0xFF282828, 0xFF414141, 0xFF656565, 0xFF8B8B8B, 0xFF484848, 0xFF282828, 0xFF1D1D1D, 0xFF191919,
+	0xFF212121, 0xFF323232, 0xFF4A4A4A, 0xFF464646, 0xFF3E3E3E, 0xFF383838, 0xFF323232, 0xFF323232,
+	0xFF363636, 0xFF4E4E4E, 0xFF808080, 0xFF686868, 0xFF202020, 0xFF090909, 0xFF090909, 0xFF141414,
+	0xFF3D3D3D, 0xFFBBBBBB, 0xFFB1B1B1, 0xFF2F2F2F, 0xFF0C0C0C, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF0D0D0D, 0xFF303030, 0xFFAEAEAE, 0xFF8E8E8E, 0xFF414141, 0xFF363636, 0xFF404040,
+	0xFF3D3D3D, 0xFF313131, 0xFF2C2C2C, 0xFF363636, 0xFF636363, 0xFFB4B4B4, 0xFFB9B9B9, 0xFF474747,
+	0xFF1C1C1C, 0xFF131313, 0xFF1C1C1C, 0xFF424242, 0xFF727272, 0xFF6B6B6B, 0xFF5B5B5B, 0xFF303030,
+	0xFF1C1C1C, 0xFF151515, 0xFF1D1D1D, 0xFF232323, 0xFF272727, 0xFF292929, 0xFF2B2B2B, 0xFF2D2D2D,
+	0xFF282828, 0xFF262626, 0xFF333333, 0xFF575757, 0xFF383838, 0xFF1A1A1A, 0xFF0D0D0D, 0xFF0C0C0C,
+	0xFF161616, 0xFF333333, 0xFF7E7E7E, 0xFFB2B2B2, 0xFF888888, 0xFF666666, 0xFF515151, 0xFF444444,
+	0xFF404040, 0xFF444444, 0xFF414141, 0xFF3B3B3B, 0xFF1E1E1E, 0xFF080808, 0xFF040404, 0xFF0A0A0A,
+	0xFF242424, 0xFF656565, 0xFFDADADA, 0xFF484848, 0xFF111111, 0xFF040404, 0xFF020202, 0xFF020202,
+	0xFF0B0B0B, 0xFF1B1B1B, 0xFF474747, 0xFFB8B8B8, 0xFFABABAB, 0xFF585758, 0xFF4F4E4F, 0xFF565656,
+	0xFF303030, 0xFF181818, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF161616, 0xFF292929, 0xFF7D7D7D, 0xFFA7A7A7,
+	0xFF4B4B4B, 0xFF242424, 0xFF252525, 0xFF434343, 0xFF4C4C4C, 0xFF4E4E4E, 0xFF545454, 0xFF282828,
+	0xFF161616, 0xFF101010, 0xFF151515, 0xFF2F2F2F, 0xFF626262, 0xFF757575, 0xFF545454, 0xFF303030,
+	0xFF1F1F1F, 0xFF1B1B1B, 0xFF242424, 0xFF444444, 0xFF464646, 0xFF1C1C1C, 0xFF0C0C0C, 0xFF0B0B0B,
+	0xFF131313, 0xFF333333, 0xFF959595, 0xFFD3D3D3, 0xFF7B7B7B, 0xFF525252, 0xFF424242, 0xFF363636,
+	0xFF303030, 0xFF2F2F2F, 0xFF303030, 0xFF2B2B2B, 0xFF212121, 0xFF090909, 0xFF030303, 0xFF040404,
+	0xFF121212, 0xFF353435, 0xFFA2A2A2, 0xFF909090, 0xFF252525, 0xFF0B0B0B, 0xFF020202, 0xFF050505,
+	0xFF111111, 0xFF282828, 0xFF424242, 0xFF535253, 0xFF606060, 0xFF545454, 0xFF535353, 0xFF6A6A6A,
+	0xFF4A4A4A, 0xFF1B1B1B, 0xFF0C0C0C, 0xFF070707, 0xFF090909, 0xFF121212, 0xFF333333, 0xFF4A4A4A,
+	0xFF4A4A4A, 0xFF333333, 0xFF282828, 0xFF2D2D2D, 0xFF292929, 0xFF2F2F2F, 0xFF484848, 0xFF303030,
+	0xFF161616, 0xFF0F0F0F, 0xFF141414, 0xFF2E2E2E, 0xFF999999, 0xFFC5C5C5, 0xFF4E4E4E, 0xFF2A2A2A,
+	0xFF1C1C1C, 0xFF191919, 0xFF242424, 0xFF414141, 0xFF696969, 0xFF303030, 0xFF151515, 0xFF0E0E0E,
+	0xFF131313, 0xFF2E2E2E, 0xFF646464, 0xFF696969, 0xFF6E6E6E, 0xFF535353, 0xFF434343, 0xFF393939,
+	0xFF333333, 0xFF333333, 0xFF343434, 0xFF323232, 0xFF2A2A2A, 0xFF111111, 0xFF040404, 0xFF030303,
+	0xFF0A0A0A, 0xFF202020, 0xFF5D5D5D, 0xFFD4D4D4, 0xFF3E3E3E, 0xFF121212, 0xFF060606, 0xFF080808,
+	0xFF0F0F0F, 0xFF1B1B1B, 0xFF262626, 0xFF2C2C2C, 0xFF2B2B2B, 0xFF343434, 0xFF404040, 0xFF5A5A5A,
+	0xFF7C7C7C, 0xFF383838, 0xFF161616, 0xFF0D0D0D, 0xFF0F0F0F, 0xFF181818, 0xFF1D1D1D, 0xFF1B1B1B,
+	0xFF1A1A1A, 0xFF1B1B1B, 0xFF181818, 0xFF161616, 0xFF181818, 0xFF212121, 0xFF393939, 0xFF444444,
+	0xFF212121, 0xFF161616, 0xFF1A1A1A, 0xFF3A3A3A, 0xFF646464, 0xFF5D5D5D, 0xFF505050, 0xFF2E2E2E,
+	0xFF202020, 0xFF1F1F1F, 0xFF2A2A2A, 0xFF474747, 0xFF8D8D8D, 0xFF5D5D5D, 0xFF272727, 0xFF171717,
+	0xFF161616, 0xFF282828, 0xFF454545, 0xFF444444, 0xFF515151, 0xFF767676, 0xFF797979, 0xFF606060,
+	0xFF565656, 0xFF4E4E4E, 0xFF515151, 0xFF5A5A5A, 0xFF4C4C4C, 0xFF2A2A2A, 0xFF0E0E0E, 0xFF080808,
+	0xFF0E0E0E, 0xFF1D1D1D, 0xFF383838, 0xFF848484, 0xFF4E4E4E, 0xFF171717, 0xFF090909, 0xFF080808,
+	0xFF0E0E0E, 0xFF161616, 0xFF1C1C1C, 0xFF1C1C1C, 0xFF1A1A1A, 0xFF1D1D1D, 0xFF2A2A2A, 0xFF444444,
+	0xFF7A7A7A, 0xFF969696, 0xFF414141, 0xFF2C2C2C, 0xFF252525, 0xFF181818, 0xFF0D0D0D, 0xFF090909,
+	0xFF0A0A0A, 0xFF0B0B0B, 0xFF0C0C0C, 0xFF0E0E0E, 0xFF141414, 0xFF202020, 0xFF343434, 0xFF515051,
+	0xFF424242, 0xFF2E2E2E, 0xFF323232, 0xFF373737, 0xFF242424, 0xFF212121, 0xFF393939, 0xFF3F3F3F,
+	0xFF303030, 0xFF2F2F2F, 0xFF3A3A3A, 0xFF545454, 0xFF9E9E9E, 0xFFAAAAAA, 0xFF434343, 0xFF222222,
+	0xFF191919, 0xFF1F1F1F, 0xFF323232, 0xFF3B3B3B, 0xFF464646, 0xFF707070, 0xFFDCDCDC, 0xFFC2C3C2,
+	0xFF6A6A6A, 0xFF444444, 0xFF3C3C3C, 0xFF5F5F5F, 0xFFA1A1A1, 0xFF848484, 0xFF333333, 0xFF212121,
+	0xFF242424, 0xFF242424, 0xFF292929, 0xFF3B3B3B, 0xFF404040, 0xFF191919, 0xFF0B0B0B, 0xFF090909,
+	0xFF101010, 0xFF131313, 0xFF141414, 0xFF111111, 0xFF101010, 0xFF131313, 0xFF191919, 0xFF2B2B2B,
+	0xFF5B5B5B, 0xFFCCCCCC, 0xFFB7B7B7, 0xFF525252, 0xFF252525, 0xFF111111, 0xFF080808, 0xFF050505,
+	0xFF040404, 0xFF090909, 0xFF0D0D0D, 0xFF131313, 0xFF1F1F1F, 0xFF303030, 0xFF434343, 0xFF4E4F4E,
+	0xFF4E4E4E, 0xFF3F3F3F, 0xFF292929, 0xFF171717, 0xFF0D0D0D, 0xFF0E0E0E, 0xFF1D1D1D, 0xFF4D4D4D,
+	0xFF525252, 0xFF4E4E4E, 0xFF393939, 0xFF3F3F3F, 0xFF858585, 0xFFE0E0E0, 0xFF6C6C6C, 0xFF2F2E2F,
+	0xFF1A1A1A, 0xFF161616, 0xFF1C1C1C, 0xFF2C2C2C, 0xFF414241, 0xFF646464, 0xFFA0A0A0, 0xFFB3B2B3,
+	0xFF595959, 0xFF363636, 0xFF2A2A2A, 0xFF2C2C2C, 0xFF4F4F4F, 0xFFB2B2B2, 0xFFCFCECF, 0xFF9B9B9B,
+	0xFF5E5E5E, 0xFF393939, 0xFF272727, 0xFF212121, 0xFF202020, 0xFF191919, 0xFF0F0F0F, 0xFF0D0D0D,
+	0xFF090909, 0xFF060606, 0xFF050505, 0xFF060606, 0xFF090909, 0xFF101010, 0xFF131313, 0xFF1D1D1D,
+	0xFF333333, 0xFF5F5F5F, 0xFF8A8A8A, 0xFF454545, 0xFF212121, 0xFF111111, 0xFF080808, 0xFF070707,
+	0xFF0A0A0A, 0xFF0F0F0F, 0xFF171717, 0xFF1E1E1E, 0xFF2B2B2B, 0xFF434343, 0xFF606060, 0xFF636363,
+	0xFF444444, 0xFF292929, 0xFF161616, 0xFF0B0B0B, 0xFF040404, 0xFF040404, 0xFF0F0F0F, 0xFF3A3A3A,
+	0xFF8E8E8E, 0xFF727272, 0xFF383838, 0xFF373737, 0xFF656565, 0xFFC8C8C8, 0xFF999999, 0xFF383838,
+	0xFF191919, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF161616, 0xFF262626, 0xFF3F3F3F, 0xFF686868, 0xFF909090,
+	0xFF515151, 0xFF303030, 0xFF212121, 0xFF1D1D1D, 0xFF222222, 0xFF323232, 0xFF5A5A5A, 0xFF848484,
+	0xFF7D7D7D, 0xFF585858, 0xFF323232, 0xFF191919, 0xFF0E0E0E, 0xFF0B0B0B, 0xFF0A0A0A, 0xFF090909,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF0D0D0D, 0xFF111111, 0xFF141414, 0xFF1A1A1A,
+	0xFF252525, 0xFF353535, 0xFF464646, 0xFF363636, 0xFF1E1E1E, 0xFF131313, 0xFF0F0F0F, 0xFF121212,
+	0xFF191919, 0xFF1F1F1F, 0xFF242424, 0xFF2F2F2F, 0xFF414141, 0xFF535353, 0xFF5F5F5F, 0xFF676767,
+	0xFF4A4A4A, 0xFF252525, 0xFF111111, 0xFF080808, 0xFF020202, 0xFF020202, 0xFF0A0A0A, 0xFF262626,
+	0xFF9D9D9D, 0xFFAFAFAF, 0xFF494949, 0xFF404040, 0xFF6B6B6B, 0xFFA1A1A1, 0xFF989898, 0xFF373737,
+	0xFF161616, 0xFF0B0B0B, 0xFF090909, 0xFF111111, 0xFF202020, 0xFF3D3D3D, 0xFF787878, 0xFF939393,
+	0xFF545454, 0xFF353535, 0xFF242424, 0xFF1A1A1A, 0xFF151515, 0xFF181818, 0xFF1D1D1D, 0xFF242424,
+	0xFF2B2B2B, 0xFF2F2F2F, 0xFF303030, 0xFF1A1A1A, 0xFF0A0A0A, 0xFF020202, 0xFF010101, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF0A0A0A, 0xFF161616, 0xFF171717, 0xFF191919, 0xFF1D1D1D,
+	0xFF222222, 0xFF252525, 0xFF262626, 0xFF232323, 0xFF1A1A1A, 0xFF171717, 0xFF151515, 0xFF171717,
+	0xFF1E1E1E, 0xFF2B2B2B, 0xFF454545, 0xFF6C6C6C, 0xFF7D7D7D, 0xFF818181, 0xFF7D7D7D, 0xFF636363,
+	0xFF474747, 0xFF282828, 0xFF141414, 0xFF090909, 0xFF030303, 0xFF020202, 0xFF090909, 0xFF202020,
+	0xFF757575, 0xFFE4E4E4, 0xFF6F6F6F, 0xFF5E5D5E, 0xFF828282, 0xFF7F7F7F, 0xFF7C7C7C, 0xFF383838,
+	0xFF171717, 0xFF0A0A0A, 0xFF0B0B0B, 0xFF131313, 0xFF2A2A2A, 0xFF5B5B5B, 0xFFC8C8C8, 0xFFB1B1B1,
+	0xFF6D6D6D, 0xFF4D4D4D, 0xFF343434, 0xFF232323, 0xFF171717, 0xFF141414, 0xFF131313, 0xFF171717,
+	0xFF1F1F1F, 0xFF282828, 0xFF333333, 0xFF252525, 0xFF0B0B0B, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF050505, 0xFF1A1A1A, 0xFF232323, 0xFF232323, 0xFF252525, 0xFF252525,
+	0xFF232323, 0xFF1F1F1F, 0xFF191919, 0xFF131313, 0xFF0C0C0C, 0xFF0A0A0A, 0xFF0A0A0A, 0xFF111111,
+	0xFF232323, 0xFF525252, 0xFF9A9A9A, 0xFF818181, 0xFF585858, 0xFF585858, 0xFF888888, 0xFF777777,
+	0xFF3D3D3D, 0xFF202020, 0xFF101010, 0xFF0C0C0C, 0xFF080808, 0xFF080808, 0xFF0E0E0E, 0xFF222222,
+	0xFF616161, 0xFFEDEDED, 0xFFB3B3B3, 0xFF929292, 0xFF828282, 0xFF636363, 0xFF626262, 0xFF3B3B3B,
+	0xFF1C1C1C, 0xFF111111, 0xFF141414, 0xFF252525, 0xFF4D4D4D, 0xFF8F8F8F, 0xFFDDDDDD, 0xFF797979,
+	0xFF515151, 0xFF555555, 0xFF5C5C5C, 0xFF3D3D3D, 0xFF252525, 0xFF1A1A1A, 0xFF171717, 0xFF1A1A1A,
+	0xFF252525, 0xFF3A3A3A, 0xFF5C5C5C, 0xFF343434, 0xFF0E0E0E, 0xFF030303, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF101010, 0xFF373737, 0xFF3C3C3C, 0xFF383838, 0xFF272727, 0xFF1B1B1B,
+	0xFF161616, 0xFF151515, 0xFF121212, 0xFF0C0C0C, 0xFF050505, 0xFF040404, 0xFF080808, 0xFF151515,
+	0xFF404040, 0xFF8E8E8E, 0xFF6E6E6E, 0xFF494949, 0xFF3B3B3B, 0xFF424242, 0xFF707070, 0xFF979797,
+	0xFF3C3C3C, 0xFF181818, 0xFF0A0A0A, 0xFF090909, 0xFF0C0C0C, 0xFF141414, 0xFF1A1A1A, 0xFF2E2E2E,
+	0xFF636363, 0xFFDDDDDD, 0xFFF5F5F5, 0xFFB1B1B1, 0xFF696969, 0xFF474747, 0xFF424242, 0xFF474747,
+	0xFF2F2F2F, 0xFF272727, 0xFF2E2E2E, 0xFF4E4E4E, 0xFF5C5C5C, 0xFF868686, 0xFF808080, 0xFF454445,
+	0xFF333333, 0xFF383838, 0xFF5A5A5A, 0xFF767676, 0xFF494949, 0xFF313131, 0xFF282828, 0xFF2E2E2E,
+	0xFF474747, 0xFF848484, 0xFF9E9E9E, 0xFF383838, 0xFF111111, 0xFF030303, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF050505, 0xFF222222, 0xFF767676, 0xFF636363, 0xFF242424, 0xFF0F0F0F, 0xFF0B0B0B,
+	0xFF0B0B0B, 0xFF0F0F0F, 0xFF101010, 0xFF090909, 0xFF030303, 0xFF030303, 0xFF0A0A0A, 0xFF202020,
+	0xFF565656, 0xFF525252, 0xFF3B3B3B, 0xFF282828, 0xFF2B2B2B, 0xFF383838, 0xFF606060, 0xFFADADAD,
+	0xFF454545, 0xFF181818, 0xFF0A0A0A, 0xFF090909, 0xFF0E0E0E, 0xFF212121, 0xFF353535, 0xFF464646,
+	0xFF717171, 0xFFD2D2D2, 0xFFF8F8F8, 0xFF9A9A9A, 0xFF4E4E4E, 0xFF2E2E2E, 0xFF252525, 0xFF303030,
+	0xFF4C4C4C, 0xFF606060, 0xFF818181, 0xFF8A8A8A, 0xFF7D7D7D, 0xFF868686, 0xFF555555, 0xFF373737,
+	0xFF2B2B2B, 0xFF2F2F2F, 0xFF434343, 0xFF737373, 0xFF8B8B8B, 0xFF5F5F5F, 0xFF505050, 0xFF616161,
+	0xFFA6A6A6, 0xFFE1E1E1, 0xFF7A797A, 0xFF333333, 0xFF121212, 0xFF050505, 0xFF020202, 0xFF020202,
+	0xFF040404, 0xFF101010, 0xFF434343, 0xFFD4D4D4, 0xFF4B4B4B, 0xFF171717, 0xFF0B0B0B, 0xFF080808,
+	0xFF0B0B0B, 0xFF121212, 0xFF111111, 0xFF0A0A0A, 0xFF060606, 0xFF060606, 0xFF0E0E0E, 0xFF292929,
+	0xFF313131, 0xFF303030, 0xFF1D1D1D, 0xFF101010, 0xFF141414, 0xFF282828, 0xFF525252, 0xFFAEAEAE,
+	0xFF737373, 0xFF232323, 0xFF111111, 0xFF0F0F0F, 0xFF1A1A1A, 0xFF383838, 0xFF616161, 0xFF686868,
+	0xFF838383, 0xFFC4C4C4, 0xFFF9F9F9, 0xFF888888, 0xFF3A3A3A, 0xFF1A1A1A, 0xFF121212, 0xFF141414,
+	0xFF292929, 0xFF5E5E5E, 0xFFCCCCCC, 0xFFD1D1D1, 0xFF949494, 0xFF6C6C6C, 0xFF515151, 0xFF3D3D3D,
+	0xFF323232, 0xFF333333, 0xFF404040, 0xFF5A5A5A, 0xFF7F7F7F, 0xFF959595, 0xFF949494, 0xFFB0B0B0,
+	0xFFBABABA, 0xFF848484, 0xFF4C4C4C, 0xFF282828, 0xFF131313, 0xFF0A0A0A, 0xFF040404, 0xFF030303,
+	0xFF151515, 0xFF2B2B2B, 0xFF5C5C5C, 0xFF7D7D7D, 0xFF404040, 0xFF191919, 0xFF101010, 0xFF0F0F0F,
+	0xFF161616, 0xFF1D1D1D, 0xFF151515, 0xFF0E0E0E, 0xFF0A0A0A, 0xFF0A0A0A, 0xFF121212, 0xFF1E1E1E,
+	0xFF202020, 0xFF232323, 0xFF141414, 0xFF070707, 0xFF080808, 0xFF131313, 0xFF2C2C2C, 0xFF777777,
+	0xFFB1B1B1, 0xFF555555, 0xFF2A2A2A, 0xFF232323, 0xFF343434, 0xFF696969, 0xFFA5A5A5, 0xFF898989,
+	0xFF868686, 0xFFA4A4A4, 0xFFE4E4E4, 0xFF838383, 0xFF2B2B2B, 0xFF0E0E0E, 0xFF060606, 0xFF060606,
+	0xFF121212, 0xFF2A2A2A, 0xFF5C5C5C, 0xFF767676, 0xFF6D6D6D, 0xFF696969, 0xFF5D5D5D, 0xFF4E4E4E,
+	0xFF444444, 0xFF3F3F3F, 0xFF464646, 0xFF555555, 0xFF696969, 0xFF787878, 0xFF828282, 0xFF808080,
+	0xFF707070, 0xFF565656, 0xFF383838, 0xFF212121, 0xFF151515, 0xFF101010, 0xFF0E0E0E, 0xFF0F0F0F,
+	0xFF141414, 0xFF1F1F1F, 0xFF2C2C2C, 0xFF3E3E3E, 0xFF3F3F3F, 0xFF272727, 0xFF212121, 0xFF262626,
+	0xFF2F2F2F, 0xFF272727, 0xFF1D1D1D, 0xFF171717, 0xFF101010, 0xFF0E0E0E, 0xFF151515, 0xFF181818,
+	0xFF1D1D1D, 0xFF272727, 0xFF151515, 0xFF050505, 0xFF030303, 0xFF090909, 0xFF151515, 0xFF333333,
+	0xFF777777, 0xFF7A7A7A, 0xFF626262, 0xFF5F5F5F, 0xFF7E7E7E, 0xFFD9D9D9, 0xFFDBDBDB, 0xFF8B8B8B,
+	0xFF686868, 0xFF757575, 0xFFA1A1A1, 0xFF7E7E7E, 0xFF212121, 0xFF070707, 0xFF020202, 0xFF020202,
+	0xFF070707, 0xFF181818, 0xFF2E2E2E, 0xFF484848, 0xFF535353, 0xFF4B4B4B, 0xFF414141, 0xFF3E3E3E,
+	0xFF494949, 0xFF555555, 0xFF595959, 0xFF616161, 0xFF6D6D6D, 0xFF737373, 0xFF727272, 0xFF6B6B6B,
+	0xFF5F5F5F, 0xFF4D4D4D, 0xFF393939, 0xFF1E1E1E, 0xFF101010, 0xFF0A0A0A, 0xFF070707, 0xFF0C0C0C,
+	0xFF050505, 0xFF0B0B0B, 0xFF141414, 0xFF252525, 0xFF404040, 0xFF3E3E3E, 0xFF444444, 0xFF525252,
+	0xFF434343, 0xFF363636, 0xFF2F2F2F, 0xFF272727, 0xFF1D1D1D, 0xFF161616, 0xFF191919, 0xFF1D1D1D,
+	0xFF292929, 0xFF3A3A3A, 0xFF212121, 0xFF090909, 0xFF020202, 0xFF030303, 0xFF0A0A0A, 0xFF151515,
+	0xFF2E2E2E, 0xFF555555, 0xFF555555, 0xFF616161, 0xFF969696, 0xFFCECECE, 0xFF8F8F8F, 0xFF636363,
+	0xFF4E4E4E, 0xFF515151, 0xFF686868, 0xFF696969, 0xFF1C1C1C, 0xFF050505, 0xFF020202, 0xFF020202,
+	0xFF050505, 0xFF111111, 0xFF232323, 0xFF303030, 0xFF353535, 0xFF303030, 0xFF2C2C2C, 0xFF2D2D2D,
+	0xFF353535, 0xFF4C4C4C, 0xFF686868, 0xFF767676, 0xFF757575, 0xFF6F6F6F, 0xFF6F6F6F, 0xFF737373,
+	0xFF6A6A6A, 0xFF5B5B5B, 0xFF4E4E4E, 0xFF2E2E2E, 0xFF131313, 0xFF070707, 0xFF020202, 0xFF020202,
+	0xFF020202, 0xFF040404, 0xFF0D0D0D, 0xFF1C1C1C, 0xFF404040, 0xFF626262, 0xFF8E8E8E, 0xFF818181,
+	0xFF5E5E5E, 0xFF595959, 0xFF565656, 0xFF444344, 0xFF303030, 0xFF242424, 0xFF212121, 0xFF2D2D2D,
+	0xFF474747, 0xFF6A6A6A, 0xFF373737, 0xFF101010, 0xFF040404, 0xFF020202, 0xFF030303, 0xFF070707,
+	0xFF111111, 0xFF222222, 0xFF404040, 0xFF5F5F5F, 0xFF818181, 0xFF828282, 0xFF6D6D6D, 0xFF484848,
+	0xFF363636, 0xFF363636, 0xFF4A4A4A, 0xFF555555, 0xFF1A1A1A, 0xFF050505, 0xFF020202, 0xFF030303,
+	0xFF0A0A0A, 0xFF181818, 0xFF282828, 0xFF333333, 0xFF373737, 0xFF343434, 0xFF323232, 0xFF343434,
+	0xFF3C3C3C, 0xFF525252, 0xFF696969, 0xFF6D6D6D, 0xFF606060, 0xFF4E4E4E, 0xFF464646, 0xFF4F4F4F,
+	0xFF676767, 0xFF787878, 0xFF7B7B7B, 0xFF696969, 0xFF292929, 0xFF0D0D0D, 0xFF030303, 0xFF020202,
+	0xFF020202, 0xFF030303, 0xFF0B0B0B, 0xFF1D1D1D, 0xFF454545, 0xFFA1A1A1, 0xFFF0F0F0, 0xFFA5A5A5,
+	0xFF838383, 0xFF717171, 0xFF555555, 0xFF3E3E3E, 0xFF363636, 0xFF363636, 0xFF2F2F2F, 0xFF353535,
+	0xFF646464, 0xFFBEBEBE, 0xFF585858, 0xFF191919, 0xFF080808, 0xFF020202, 0xFF020202, 0xFF020202,
+	0xFF050505, 0xFF0F0F0F, 0xFF1E1E1E, 0xFF383838, 0xFF5E5D5E, 0xFF797979, 0xFF494949, 0xFF2A2A2A,
+	0xFF232323, 0xFF292929, 0xFF3E3E3E, 0xFF484848, 0xFF1C1C1C, 0xFF0A0A0A, 0xFF070707, 0xFF0A0A0A,
+	0xFF191919, 0xFF282828, 0xFF262626, 0xFF2D2D2D, 0xFF3D3D3D, 0xFF4E4E4E, 0xFF575757, 0xFF5F5F5F,
+	0xFF6F6F6F, 0xFF8C8C8C, 0xFF9D9D9D, 0xFF868686, 0xFF5C5C5C, 0xFF3B3B3B, 0xFF262626, 0xFF222222,
+	0xFF262626, 0xFF3B3B3B, 0xFF676767, 0xFFB3B3B3, 0xFF828282, 0xFF222222, 0xFF090909, 0xFF020202,
+	0xFF040404, 0xFF090909, 0xFF151515, 0xFF292929, 0xFF585858, 0xFFC3C3C3, 0xFF959595, 0xFF545454,
+	0xFF424242, 0xFF3B3B3B, 0xFF353535, 0xFF353535, 0xFF3D3D3D, 0xFF4F4F4F, 0xFF494949, 0xFF464646,
+	0xFF696969, 0xFFE8E8E8, 0xFF787878, 0xFF242424, 0xFF0E0E0E, 0xFF060606, 0xFF020202, 0xFF020202,
+	0xFF040404, 0xFF0A0A0A, 0xFF161616, 0xFF323232, 0xFF666666, 0xFF525252, 0xFF2D2D2D, 0xFF1E1E1E,
+	0xFF1E1E1E, 0xFF262626, 0xFF3E3E3E, 0xFF3C3C3C, 0xFF252525, 0xFF1A1A1A, 0xFF1A1A1A, 0xFF232323,
+	0xFF303030, 0xFF222222, 0xFF1C1C1C, 0xFF1F1F1F, 0xFF2C2C2C, 0xFF424242, 0xFF585858, 0xFF6A6A6A,
+	0xFF898989, 0xFFC1C1C1, 0xFFF7F7F7, 0xFFD8D8D8, 0xFF6C6C6C, 0xFF323232, 0xFF161616, 0xFF0D0D0D,
+	0xFF0A0A0A, 0xFF0E0E0E, 0xFF1B1B1B, 0xFF424242, 0xFFC7C7C7, 0xFF6E6E6E, 0xFF1B1B1B, 0xFF070707,
+	0xFF101010, 0xFF141414, 0xFF242424, 0xFF434343, 0xFF898A89, 0xFFA7A7A7, 0xFF484848, 0xFF2C2C2C,
+	0xFF242424, 0xFF242424, 0xFF282828, 0xFF303030, 0xFF474747, 0xFF717171, 0xFF6E6E6E, 0xFF5F5F5F,
+	0xFF7E7E7E, 0xFFEDEDED, 0xFF898989, 0xFF2E2E2E, 0xFF141414, 0xFF0C0C0C, 0xFF0A0A0A, 0xFF090909,
+	0xFF080808, 0xFF0D0D0D, 0xFF1A1A1A, 0xFF3D3D3D, 0xFF545454, 0xFF333333, 0xFF202020, 0xFF1A1A1A,
+	0xFF1F1F1F, 0xFF272727, 0xFF2F2F2F, 0xFF313131, 0xFF383838, 0xFF434343, 0xFF545454, 0xFF494949,
+	0xFF272727, 0xFF151515, 0xFF101010, 0xFF121212, 0xFF1C1C1C, 0xFF2D2D2D, 0xFF424242, 0xFF565656,
+	0xFF727272, 0xFF7D7D7D, 0xFF909090, 0xFFE6E6E6, 0xFFA2A2A2, 0xFF323232, 0xFF0F0F0F, 0xFF030303,
+	0xFF020202, 0xFF020202, 0xFF050505, 0xFF151515, 0xFF525252, 0xFFC8C8C8, 0xFF434343, 0xFF191919,
+	0xFF262626, 0xFF2C2C2C, 0xFF434343, 0xFF737373, 0xFFC0C0C0, 0xFF646464, 0xFF2E2E2E, 0xFF1E1E1E,
+	0xFF1B1B1B, 0xFF1E1E1E, 0xFF262626, 0xFF343434, 0xFF575757, 0xFF999999, 0xFF868686, 0xFF6E6E6E,
+	0xFF8D8D8D, 0xFFEDEDED, 0xFF8F8F8F, 0xFF383838, 0xFF1E1E1E, 0xFF171717, 0xFF171717, 0xFF171717,
+	0xFF161616, 0xFF1B1B1B, 0xFF2A2A2A, 0xFF3E3E3E, 0xFF313131, 0xFF202020, 0xFF1A1A1A, 0xFF1A1A1A,
+	0xFF161616, 0xFF121212, 0xFF181818, 0xFF2D2D2D, 0xFF585858, 0xFF838383, 0xFF626262, 0xFF353535,
+	0xFF1A1A1A, 0xFF0E0E0E, 0xFF080808, 0xFF0A0A0A, 0xFF111111, 0xFF212121, 0xFF323232, 0xFF414141,
+	0xFF3C3C3C, 0xFF363636, 0xFF414141, 0xFF818181, 0xFFDDDDDD, 0xFF424242, 0xFF111111, 0xFF030303,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF090909, 0xFF292929, 0xFF6F6F6F, 0xFF7B7B7B, 0xFF353535,
+	0xFF404040, 0xFF4A4A4A, 0xFF6E6E6E, 0xFFB3B3B3, 0xFF8F8F8F, 0xFF404040, 0xFF242424, 0xFF1A1A1A,
+	0xFF1B1B1B, 0xFF202020, 0xFF2A2A2A, 0xFF3F3F3F, 0xFF777777, 0xFF999999, 0xFF6B6B6B, 0xFF5E5E5E,
+	0xFF7C7C7C, 0xFFC5C5C5, 0xFF969696, 0xFF4A4A4A, 0xFF2F2F2F, 0xFF2E2E2E, 0xFF343434, 0xFF3A3A3A,
+	0xFF2F2F2F, 0xFF272727, 0xFF252525, 0xFF232323, 0xFF1D1D1D, 0xFF1A1A1A, 0xFF1A1A1A, 0xFF1B1B1B,
+	0xFF0D0D0D, 0xFF090909, 0xFF111111, 0xFF2B2B2B, 0xFF696969, 0xFF5F5F5F, 0xFF414141, 0xFF282828,
+	0xFF131313, 0xFF090909, 0xFF050505, 0xFF070707, 0xFF0F0F0F, 0xFF1D1D1D, 0xFF2A2A2A, 0xFF272727,
+	0xFF1F1F1F, 0xFF1B1B1B, 0xFF212121, 0xFF444444, 0xFFCDCDCD, 0xFF757575, 0xFF1D1D1D, 0xFF080808,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF0D0D0D, 0xFF1E1E1E, 0xFF2B2C2B, 0xFF4A4A4A, 0xFF525252,
+	0xFF4E4E4E, 0xFF636363, 0xFF8D8D8D, 0xFF959595, 0xFF565656, 0xFF303130, 0xFF202020, 0xFF1C1C1C,
+	0xFF1F1F1F, 0xFF262626, 0xFF313131, 0xFF515151, 0xFF6A6A6A, 0xFF515151, 0xFF3F3F3F, 0xFF3F3F3F,
+	0xFF585858, 0xFFA3A3A3, 0xFF848484, 0xFF626262, 0xFF545454, 0xFF676767, 0xFF929292, 0xFF636363,
+	0xFF2E2E2E, 0xFF1B1B1B, 0xFF161616, 0xFF161616, 0xFF171717, 0xFF191919, 0xFF222222, 0xFF252525,
+	0xFF101010, 0xFF0B0B0B, 0xFF111111, 0xFF2B2B2B, 0xFF646464, 0xFF555555, 0xFF3D3D3D, 0xFF262626,
+	0xFF141414, 0xFF0A0A0A, 0xFF070707, 0xFF0A0A0A, 0xFF121212, 0xFF212121, 0xFF272727, 0xFF1F1F1F,
+	0xFF161616, 0xFF111111, 0xFF141414, 0xFF272727, 0xFF7F7F7F, 0xFFC8C8C8, 0xFF3F3F3F, 0xFF191919,
+	0xFF0F0F0F, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF0D0D0D, 0xFF121212, 0xFF1E1E1E, 0xFF363636,
+	0xFF373737, 0xFF5B5B5B, 0xFF757575, 0xFF6B6B6B, 0xFF4D4D4D, 0xFF333333, 0xFF232323, 0xFF1E1E1E,
+	0xFF212121, 0xFF262626, 0xFF303030, 0xFF323232, 0xFF2A2A2A, 0xFF232323, 0xFF222222, 0xFF272727,
+	0xFF3C3C3C, 0xFF787878, 0xFF868686, 0xFF525252, 0xFF494949, 0xFF696969, 0xFFCCCCCC, 0xFF808080,
+	0xFF323232, 0xFF171717, 0xFF101010, 0xFF111111, 0xFF161616, 0xFF1C1C1C, 0xFF2C2C2C, 0xFF3D3D3D,
+	0xFF1E1E1E, 0xFF111111, 0xFF131313, 0xFF262626, 0xFF656565, 0xFF9A9A9A, 0xFF646464, 0xFF383838,
+	0xFF1F1F1F, 0xFF101010, 0xFF0C0C0C, 0xFF0F0F0F, 0xFF1C1C1C, 0xFF323232, 0xFF343434, 0xFF282828,
+	0xFF1A1A1A, 0xFF121212, 0xFF111111, 0xFF1C1C1C, 0xFF434343, 0xFFA0A0A0, 0xFF616161, 0xFF333333,
+	0xFF212121, 0xFF151515, 0xFF0D0D0D, 0xFF090909, 0xFF080808, 0xFF0A0A0A, 0xFF111111, 0xFF1E1E1E,
+	0xFF323232, 0xFF4B4B4B, 0xFF777777, 0xFF909090, 0xFF717171, 0xFF4B4B4B, 0xFF313131, 0xFF212121,
+	0xFF181818, 0xFF131313, 0xFF131313, 0xFF131313, 0xFF121212, 0xFF121212, 0xFF141414, 0xFF1D1D1D,
+	0xFF2F2F2F, 0xFF555555, 0xFF848484, 0xFF5A5A5A, 0xFF3F3F3F, 0xFF504F50, 0xFF4C4C4C, 0xFF414141,
+	0xFF363636, 0xFF171717, 0xFF0F0F0F, 0xFF0F0F0F, 0xFF151515, 0xFF202020, 0xFF333333, 0xFF535353,
+	0xFF393939, 0xFF1C1C1C, 0xFF161616, 0xFF202020, 0xFF404040, 0xFF9C9C9C, 0xFFDEDEDE, 0xFFA6A6A6,
+	0xFF484848, 0xFF242424, 0xFF191919, 0xFF1D1D1D, 0xFF2E2E2E, 0xFF525252, 0xFF696969, 0xFF4D4D4D,
+	0xFF313131, 0xFF202020, 0xFF191919, 0xFF1D1D1D, 0xFF2D2D2D, 0xFF565656, 0xFF4C4C4C, 0xFF2B2B2B,
+	0xFF1C1C1C, 0xFF131313, 0xFF0D0D0D, 0xFF0A0A0A, 0xFF0B0B0B, 0xFF0B0B0B, 0xFF111111, 0xFF1F1F1F,
+	0xFF242424, 0xFF3A3A3A, 0xFF686868, 0xFFCCCCCC, 0xFFDADADA, 0xFF676767, 0xFF303030, 0xFF171717,
+	0xFF0C0C0C, 0xFF080808, 0xFF070707, 0xFF090909, 0xFF0A0A0A, 0xFF0E0E0E, 0xFF141414, 0xFF202020,
+	0xFF323232, 0xFF4A4A4A, 0xFF5E5E5E, 0xFF5D5D5D, 0xFF444444, 0xFF2E2E2E, 0xFF1A1A1A, 0xFF171717,
+	0xFF242424, 0xFF161616, 0xFF0E0E0E, 0xFF0E0E0E, 0xFF131313, 0xFF1E1E1E, 0xFF2F2F2F, 0xFF454545,
+	0xFF494949, 0xFF2B2B2B, 0xFF1A1A1A, 0xFF1A1A1A, 0xFF212121, 0xFF2D2D2D, 0xFF4B4B4B, 0xFFA2A2A2,
+	0xFFC4C5C4, 0xFF737373, 0xFF3F3F3F, 0xFF3D3D3D, 0xFF575757, 0xFF9D9D9D, 0xFFE5E5E5, 0xFFC8C8C8,
+	0xFF828282, 0xFF535353, 0xFF373737, 0xFF2B2B2B, 0xFF262626, 0xFF2C2C2C, 0xFF333333, 0xFF252525,
+	0xFF1C1C1C, 0xFF171717, 0xFF151515, 0xFF141414, 0xFF141414, 0xFF151515, 0xFF181818, 0xFF1B1B1B,
+	0xFF1E1E1E, 0xFF363636, 0xFF676767, 0xFF818181, 0xFF939393, 0xFF5B5B5B, 0xFF282828, 0xFF121212,
+	0xFF090909, 0xFF040404, 0xFF040404, 0xFF0A0A0A, 0xFF0E0E0E, 0xFF171717, 0xFF1F1F1F, 0xFF1D1D1D,
+	0xFF232323, 0xFF3E3E3E, 0xFF4B4B4B, 0xFF383838, 0xFF232323, 0xFF121212, 0xFF0A0A0A, 0xFF0A0A0A,
+	0xFF141414, 0xFF161616, 0xFF0D0D0D, 0xFF0D0D0D, 0xFF111111, 0xFF171717, 0xFF242424, 0xFF2E2E2E,
+	0xFF2C2C2C, 0xFF1F1F1F, 0xFF111111, 0xFF090909, 0xFF070707, 0xFF090909, 0xFF131313, 0xFF2A2A2A,
+	0xFF666666, 0xFFC0C0C0, 0xFFCBCBCB, 0xFFB4B4B4, 0xFFD4D4D4, 0xFFD8D8D8, 0xFFB7B7B7, 0xFF9D9D9D,
+	0xFF7D7D7D, 0xFF737373, 0xFF797979, 0xFF4D4D4D, 0xFF2D2D2D, 0xFF1D1D1D, 0xFF181818, 0xFF181818,
+	0xFF181818, 0xFF181818, 0xFF171717, 0xFF151515, 0xFF0F0F0F, 0xFF0D0D0D, 0xFF0C0C0C, 0xFF111111,
+	0xFF252525, 0xFF474747, 0xFF535353, 0xFF3E3E3E, 0xFF464546, 0xFF474747, 0xFF232323, 0xFF121212,
+	0xFF0B0B0B, 0xFF0A0A0A, 0xFF0D0D0D, 0xFF141414, 0xFF202020, 0xFF2F2F2F, 0xFF1D1D1D, 0xFF121212,
+	0xFF131313, 0xFF1E1E1E, 0xFF333333, 0xFF2A2A2A, 0xFF171717, 0xFF0B0B0B, 0xFF040404, 0xFF030303,
+	0xFF0B0B0B, 0xFF161616, 0xFF0F0F0F, 0xFF0E0E0E, 0xFF121212, 0xFF161616, 0xFF1D1D1D, 0xFF222222,
+	0xFF1D1D1D, 0xFF111111, 0xFF080808, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF070707, 0xFF131313,
+	0xFF292929, 0xFF565656, 0xFF9C9C9C, 0xFFBEBEBE, 0xFFAFAFAF, 0xFF808080, 0xFF636363, 0xFF555555,
+	0xFF505050, 0xFF5D5D5D, 0xFFA4A4A4, 0xFFA5A5A5, 0xFF404040, 0xFF1C1C1C, 0xFF0D0D0D, 0xFF070707,
+	0xFF050505, 0xFF050505, 0xFF040404, 0xFF030303, 0xFF020202, 0xFF030303, 0xFF080808, 0xFF131313,
+	0xFF484848, 0xFF696969, 0xFF414141, 0xFF2F2F2F, 0xFF313131, 0xFF333333, 0xFF1F1F1F, 0xFF161616,
+	0xFF131313, 0xFF171717, 0xFF212121, 0xFF343434, 0xFF565656, 0xFF3F3F3F, 0xFF1D1D1D, 0xFF111111,
+	0xFF0E0E0E, 0xFF121212, 0xFF1C1C1C, 0xFF242424, 0xFF141414, 0xFF090909, 0xFF030303, 0xFF020202,
+	0xFF060606, 0xFF191919, 0xFF1A1A1A, 0xFF181818, 0xFF191919, 0xFF1B1B1B, 0xFF202020, 0xFF202020,
+	0xFF1C1C1C, 0xFF151515, 0xFF0E0E0E, 0xFF080808, 0xFF040404, 0xFF050505, 0xFF090909, 0xFF101010,
+	0xFF191919, 0xFF282828, 0xFF373737, 0xFF444444, 0xFF454545, 0xFF414141, 0xFF3E3E3E, 0xFF3F3F3F,
+	0xFF474747, 0xFF5D5D5D, 0xFFA3A3A3, 0xFFB3B3B3, 0xFF444444, 0xFF1F1F1F, 0xFF0C0C0C, 0xFF030303,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF030303, 0xFF0D0D0D, 0xFF222222,
+	0xFFBFBFBF, 0xFF787878, 0xFF494949, 0xFF363636, 0xFF313131, 0xFF282828, 0xFF202020, 0xFF1F1F1F,
+	0xFF242424, 0xFF313131, 0xFF505050, 0xFF8C8C8C, 0xFFC2C2C2, 0xFF676767, 0xFF343434, 0xFF202020,
+	0xFF161616, 0xFF161616, 0xFF1B1B1B, 0xFF222222, 0xFF191919, 0xFF0C0C0C, 0xFF050505, 0xFF020202,
+	0xFF070707, 0xFF1A1A1A, 0xFF343434, 0xFF363636, 0xFF353535, 0xFF363636, 0xFF383838, 0xFF373737,
+	0xFF363636, 0xFF2E2E2E, 0xFF1A1A1A, 0xFF0E0E0E, 0xFF0D0D0D, 0xFF141414, 0xFF1A1A1A, 0xFF1B1B1B,
+	0xFF1D1D1D, 0xFF202020, 0xFF242424, 0xFF2A2A2A, 0xFF323232, 0xFF393939, 0xFF3F3F3F, 0xFF484848,
+	0xFF555555, 0xFF595959, 0xFF797979, 0xFF5D5D5D, 0xFF272727, 0xFF181818, 0xFF0E0E0E, 0xFF020202,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF0B0B0B, 0xFF262626, 0xFF6C6C6C,
+	0xFF717171, 0xFF3E3E3E, 0xFF2C2C2C, 0xFF232323, 0xFF1E1E1E, 0xFF212121, 0xFF272727, 0xFF353535,
+	0xFF505050, 0xFF757475, 0xFF919191, 0xFFBDBDBD, 0xFFBCBCBC, 0xFF6E6E6E, 0xFF4C4C4C, 0xFF434343,
+	0xFF414141, 0xFF383838, 0xFF353535, 0xFF333333, 0xFF222222, 0xFF151515, 0xFF0E0E0E, 0xFF0B0B0B,
+	0xFF0E0E0E, 0xFF1F1F1F, 0xFF4E4E4E, 0xFF909090, 0xFF9B9B9B, 0xFF939393, 0xFF969696, 0xFF989898,
+	0xFF808080, 0xFF484848, 0xFF242424, 0xFF181818, 0xFF1B1B1B, 0xFF2E2E2E, 0xFF515151, 0xFF484848,
+	0xFF393939, 0xFF2E2E2E, 0xFF2D2D2D, 0xFF323232, 0xFF424242, 0xFF555555, 0xFF6B6B6B, 0xFF858585,
+	0xFF828282, 0xFF737373, 0xFF6A6A6A, 0xFF323232, 0xFF181818, 0xFF101010, 0xFF0F0F0F, 0xFF030303,
+	0xFF020202, 0xFF020202, 0xFF020202, 0xFF020202, 0xFF050505, 0xFF1F1F1F, 0xFF797979, 0xFFCFCFCF,
+	0xFF131313, 0xFF0E0E0E, 0xFF242424, 0xFF545454, 0xFF4E4E4E, 0xFF535353, 0xFF424242, 0xFF343434,
+	0xFF757575, 0xFF8E8E8E, 0xFF4B4B4B, 0xFF343434, 0xFF393939, 0xFF868786, 0xFF9F9F9F, 0xFF8E8D8E,
+	0xFF666666, 0xFF434343, 0xFF595959, 0xFF989898, 0xFF515151, 0xFF2F2F2F, 0xFF575757, 0xFFBDBDBD,
+	0xFF888888, 0xFF2F2F2F, 0xFF0F0F0F, 0xFF0B0B0B, 0xFF020202, 0xFF030303, 0xFF474747, 0xFF6E6E6E,
+	0xFF101010, 0xFF1A1A1A, 0xFF565656, 0xFF333433, 0xFF242424, 0xFF242424, 0xFF292929, 0xFF383838,
+	0xFF2E2E2E, 0xFF454545, 0xFFB2B2B2, 0xFF878787, 0xFF797979, 0xFF828282, 0xFF454545, 0xFF202020,
+	0xFF171717, 0xFF1B1B1B, 0xFF1F1F1F, 0xFF222222, 0xFF2C2C2C, 0xFF313131, 0xFF484848, 0xFF6A6A6A,
+	0xFF666666, 0xFF434343, 0xFF242424, 0xFF161616, 0xFF0F0F0F, 0xFF1B1B1B, 0xFFA09FA0, 0xFF383838,
+	0xFF2F2F2F, 0xFF383838, 0xFF959595, 0xFF333433, 0xFF1C1C1C, 0xFF2C2C2C, 0xFF424242, 0xFF969696,
+	0xFF7F7F7F, 0xFF636363, 0xFF606060, 0xFF535353, 0xFF3A3A3A, 0xFF565656, 0xFF646464, 0xFF333333,
+	0xFF181818, 0xFF181818, 0xFF181818, 0xFF0F0F0F, 0xFF0B0B0B, 0xFF191919, 0xFF565656, 0xFF848484,
+	0xFF7A7A7A, 0xFF646464, 0xFF4C4C4C, 0xFF515151, 0xFF616161, 0xFF939393, 0xFF939493, 0xFF424242,
+	0xFF1E1E1E, 0xFF0E0E0E, 0xFF323232, 0xFF353535, 0xFF454545, 0xFF363636, 0xFF1B1B1B, 0xFF303030,
+	0xFF727272, 0xFF787878, 0xFF404040, 0xFF141414, 0xFF0F0F0F, 0xFF252525, 0xFF4B4B4B, 0xFF838383,
+	0xFF525252, 0xFF373737, 0xFF272727, 0xFF212121, 0xFF111111, 0xFF282828, 0xFFAEAEAE, 0xFF8F8F8F,
+	0xFF666666, 0xFF676767, 0xFF797979, 0xFFB1B1B1, 0xFFB1B1B1, 0xFF535353, 0xFF373737, 0xFF545454,
+	0xFF1F1F1F, 0xFF030303, 0xFF121212, 0xFF525252, 0xFFB0B0B0, 0xFF8B8B8B, 0xFF363636, 0xFF1F1F1F,
+	0xFF1B1B1B, 0xFF101010, 0xFF050505, 0xFF020202, 0xFF0B0B0B, 0xFF232423, 0xFF6B6B6B, 0xFF9E9E9E,
+	0xFF6B6B6B, 0xFF242424, 0xFF121212, 0xFF252525, 0xFF373737, 0xFF767676, 0xFF929292, 0xFF343434,
+	0xFF2A2A2A, 0xFF2E2E2E, 0xFF383838, 0xFF4F4F4F, 0xFFA0A0A0, 0xFF323232, 0xFF2F2F2F, 0xFF949494,
+	0xFF232323, 0xFF050505, 0xFF0C0C0C, 0xFF828282, 0xFFB4B4B4, 0xFFA6A6A6, 0xFFA0A0A0, 0xFF929292,
+	0xFF616161, 0xFF1E1E1E, 0xFF070707, 0xFF030303, 0xFF171717, 0xFF4F4F4F, 0xFF848484, 0xFF404040,
+	0xFF373737, 0xFF121212, 0xFF060606, 0xFF151515, 0xFF353535, 0xFF818181, 0xFF7C7C7C, 0xFF3D3D3D,
+	0xFF2F2F2F, 0xFF282828, 0xFF222222, 0xFF2A2A2A, 0xFF606060, 0xFF181818, 0xFF191919, 0xFF5E5E5E,
+	0xFF222222, 0xFF0F0F0F, 0xFF090909, 0xFF5A5A5A, 0xFF9B9B9B, 0xFF949494, 0xFF606060, 0xFF373737,
+	0xFF363636, 0xFF252525, 0xFF121212, 0xFF131313, 0xFF303030, 0xFF8A8A8A, 0xFF3F3F3F, 0xFF181818,
+	0xFF282828, 0xFF1A1A1A, 0xFF0D0D0D, 0xFF1C1C1C, 0xFF414141, 0xFFB9B9B9, 0xFFE9E9E9, 0xFFC7C7C7,
+	0xFF545454, 0xFF202020, 0xFF0D0D0D, 0xFF0A0A0A, 0xFF191919, 0xFF0F0F0F, 0xFF080808, 0xFF303030,
+	0xFF4F4F4F, 0xFF1E1E1E, 0xFF060606, 0xFF1F1F1F, 0xFF3B3B3B, 0xFF646464, 0xFFAEAEAE, 0xFF323232,
+	0xFF0A0A0A, 0xFF111111, 0xFF0E0E0E, 0xFF171717, 0xFF323232, 0xFF565656, 0xFF2D2D2D, 0xFF111111,
+	0xFF292929, 0xFF7E7E7E, 0xFF2D2D2D, 0xFF1B1B1B, 0xFF383838, 0xFFABABAB, 0xFF9E9D9E, 0xFF7C7C7C,
+	0xFF373737, 0xFF1B1B1B, 0xFF151515, 0xFF141414, 0xFF242424, 0xFF252525, 0xFF040404, 0xFF1C1C1C,
+	0xFF979797, 0xFF252525, 0xFF0B0B0B, 0xFF141414, 0xFF181818, 0xFF181818, 0xFF484848, 0xFF7D7D7D,
+	0xFF363636, 0xFF1E1E1E, 0xFF0F0F0F, 0xFF131313, 0xFF1F1F1F, 0xFF1C1C1C, 0xFF080808, 0xFF030303,
+	0xFF0E0E0E, 0xFF444444, 0xFF494949, 0xFF353535, 0xFF484848, 0xFF5B5B5B, 0xFF9A9A9A, 0xFF585858,
+	0xFF262626, 0xFF303030, 0xFF4C4C4C, 0xFF3F3F3F, 0xFF454545, 0xFF898989, 0xFF2C2C2C, 0xFF373737,
+	0xFF3E3E3E, 0xFF1D1D1D, 0xFF111111, 0xFF131313, 0xFF131313, 0xFF101010, 0xFF191919, 0xFF2B2B2B,
+	0xFF303030, 0xFF333333, 0xFF2C2C2C, 0xFF202020, 0xFF1F1F1F, 0xFF2F2F2F, 0xFF252525, 0xFF1B1B1B,
+	0xFF1C1C1C, 0xFF1F1F1F, 0xFF2A2A2A, 0xFF383838, 0xFF454545, 0xFF6E6E6E, 0xFFAAAAAA, 0xFF262626,
+	0xFF1D1D1D, 0xFF606060, 0xFFA6A6A6, 0xFF3D3C3D, 0xFF1E1E1E, 0xFF2E2E2E, 0xFF373737, 0xFF363636,
+	0xFF424242, 0xFF3A3A3A, 0xFF292929, 0xFF1C1C1C, 0xFF191919, 0xFF181818, 0xFF1D1D1D, 0xFF242424,
+	0xFF222222, 0xFF1B1B1B, 0xFF171717, 0xFF2C2C2C, 0xFF606060, 0xFF7E7D7E, 0xFF6C6C6C, 0xFF393939,
+	0xFF232323, 0xFF313131, 0xFF565656, 0xFF9A9A9A, 0xFFBDBDBD, 0xFF848484, 0xFF434343, 0xFF111111,
+	0xFF161616, 0xFF626262, 0xFFCCCCCC, 0xFF626262, 0xFF2F2F2F, 0xFF171717, 0xFF171717, 0xFF292929,
+	0xFF414141, 0xFF303030, 0xFF585858, 0xFF5B5B5B, 0xFF3F3F3F, 0xFF2F2F2F, 0xFF313131, 0xFF1F1F1F,
+	0xFF0D0D0D, 0xFF050505, 0xFF141414, 0xFF434343, 0xFF2D2D2D, 0xFF252525, 0xFF292929, 0xFF1F1F1F,
+	0xFF090909, 0xFF191919, 0xFF525252, 0xFF818181, 0xFF787878, 0xFF4E4E4E, 0xFF303030, 0xFF1A1A1A,
+	0xFF171717, 0xFF3B3B3B, 0xFFC5C5C5, 0xFFEDEDED, 0xFFA7A8A7, 0xFF434343, 0xFF353535, 0xFF6D6D6D,
+	0xFF343434, 0xFF282828, 0xFF555555, 0xFFAAAAAA, 0xFF9B9B9B, 0xFF4E4E4E, 0xFF424242, 0xFF232323,
+	0xFF0D0D0D, 0xFF070707, 0xFF282828, 0xFF6B6B6B, 0xFF131313, 0xFF101010, 0xFF141414, 0xFF151515,
+	0xFF0E0E0E, 0xFF0F0F0F, 0xFF1B1B1B, 0xFF474747, 0xFF808080, 0xFF242424, 0xFF131313, 0xFF343434,
+	0xFF454545, 0xFF4F4F4F, 0xFF9F9F9F, 0xFFECECEC, 0xFFB7B7B7, 0xFF595959, 0xFF545454, 0xFF9D9D9D,
+	0xFF2C2C2C, 0xFF0C0C0C, 0xFF0A0A0A, 0xFF1A1A1A, 0xFF373737, 0xFF919191, 0xFF7A7A7A, 0xFF2E2E2E,
+	0xFF161616, 0xFF0E0E0E, 0xFF2C2C2C, 0xFF6D6D6D, 0xFF0C0C0C, 0xFF070707, 0xFF1D1D1D, 0xFF2F2F2F,
+	0xFF1A1A1A, 0xFF0C0C0C, 0xFF1A1A1A, 0xFF626262, 0xFFA0A0A0, 0xFF101010, 0xFF030303, 0xFF121212,
+	0xFF414141, 0xFF4E4E4E, 0xFF3F3F3F, 0xFF636363, 0xFF7B7B7B, 0xFF272727, 0xFF161616, 0xFF454545,
+	0xFF626262, 0xFF1C1C1C, 0xFF030303, 0xFF040404, 0xFF151515, 0xFF232323, 0xFF1F1F1F, 0xFF0F0F0F,
+	0xFF050505, 0xFF090909, 0xFF2A2A2A, 0xFF828282, 0xFF1E1E1E, 0xFF030303, 0xFF060606, 0xFF1E1E1E,
+	0xFF3B3B3B, 0xFF2E2E2E, 0xFF4B4B4B, 0xFF6D6D6D, 0xFF484848, 0xFF0E0E0E, 0xFF040404, 0xFF181818,
+	0xFF363636, 0xFF3C3C3C, 0xFF333333, 0xFF3F3F3F, 0xFF707070, 0xFF222222, 0xFF040404, 0xFF141414,
+	0xFF3C3C3C, 0xFF7F7F7F, 0xFF121212, 0xFF0A0A0A, 0xFF252525, 0xFF3A3A3A, 0xFF161616, 0xFF040404,
+	0xFF020202, 0xFF131313, 0xFF494949, 0xFF979797, 0xFF373737, 0xFF0A0A0A, 0xFF040404, 0xFF090909,
+	0xFF2B2B2B, 0xFF9F9F9F, 0xFFA1A1A1, 0xFF646464, 0xFF2F2F2F, 0xFF202020, 0xFF1D1D1D, 0xFF282828,
+	0xFF3B3B3B, 0xFF979797, 0xFF242424, 0xFF1C1C1C, 0xFF9A9A9A, 0xFF404040, 0xFF050505, 0xFF070707,
+	0xFF080808, 0xFF6C6C6C, 0xFF525252, 0xFF2E2E2E, 0xFF434343, 0xFF757575, 0xFF8E8E8E, 0xFF4E4E4E,
+	0xFF0F0F0F, 0xFF292929, 0xFF707070, 0xFF535353, 0xFF212121, 0xFF1B1B1B, 0xFF1C1C1C, 0xFF202020,
+	0xFF2E2E2E, 0xFF5F5F5F, 0xFF313131, 0xFF141414, 0xFF272727, 0xFF707070, 0xFF595959, 0xFF3E3E3E,
+	0xFF424242, 0xFF595959, 0xFF141414, 0xFF0B0B0B, 0xFF606060, 0xFF818181, 0xFF090909, 0xFF020202,
+	0xFF181818, 0xFF656565, 0xFF6E6E6E, 0xFF595859, 0xFF2B2B2B, 0xFF0B0B0B, 0xFF171717, 0xFF686868,
+	0xFF3B3B3B, 0xFF2F2F2F, 0xFF3D3D3D, 0xFF3D3D3D, 0xFF131313, 0xFF222222, 0xFF8D8D8D, 0xFF3F3F3F,
+	0xFF1C1C1C, 0xFF333333, 0xFF3F3F3F, 0xFF0F0F0F, 0xFF222222, 0xFF8D8D8D, 0xFF646464, 0xFF3D3D3D,
+	0xFF313131, 0xFF303030, 0xFF191919, 0xFF040404, 0xFF1C1C1C, 0xFF999999, 0xFF202020, 0xFF050505,
+	0xFF141414, 0xFF232323, 0xFF262626, 0xFF424242, 0xFF717171, 0xFF242424, 0xFF191919, 0xFF141414,
+	0xFF131313, 0xFF121212, 0xFF1B1B1B, 0xFF414041, 0xFF2A2A2A, 0xFF2F2F2F, 0xFF424242, 0xFF3E3E3E,
+	0xFF282828, 0xFF404040, 0xFF8D8D8D, 0xFF292929, 0xFF1E1E1E, 0xFF3E3E3E, 0xFF5F5F5F, 0xFF9E9E9E,
+	0xFF555555, 0xFF525252, 0xFF676767, 0xFF1B1B1B, 0xFF1D1D1D, 0xFF484848, 0xFF303030, 0xFF090909,
+	0xFF0D0D0D, 0xFF0C0C0C, 0xFF0F0F0F, 0xFF1D1D1D, 0xFF6E6E6E, 0xFF767676, 0xFF1A1A1A, 0xFF070707,
+	0xFF0A0A0A, 0xFF151515, 0xFF2F2F2F, 0xFF555555, 0xFF3F3F3F, 0xFF181818, 0xFF090909, 0xFF2D2D2D,
+	0xFF686868, 0xFF3A3A3A, 0xFFA5A5A5, 0xFF5B5B5B, 0xFF161616, 0xFF1B1B1B, 0xFF434343, 0xFF939393,
+	0xFF444444, 0xFF252525, 0xFF555555, 0xFF929292, 0xFF5B5B5B, 0xFF252525, 0xFF151515, 0xFF0C0C0C,
+	0xFF020202, 0xFF040404, 0xFF131313, 0xFF191919, 0xFF282828, 0xFF313131, 0xFF191919, 0xFF131313,
+	0xFF202020, 0xFF414141, 0xFF656565, 0xFF6A6A6A, 0xFF383838, 0xFF0E0E0E, 0xFF020202, 0xFF161616,
+	0xFFA9A9A9, 0xFF565556, 0xFF838383, 0xFF616161, 0xFF111111, 0xFF0E0E0E, 0xFF393939, 0xFFA1A1A1,
+	0xFF515151, 0xFF252525, 0xFF161616, 0xFF1B1B1B, 0xFF282828, 0xFF292929, 0xFF060606, 0xFF020202,
+	0xFF020202, 0xFF1A1A1A, 0xFF2F2F2F, 0xFF232323, 0xFF1B1B1B, 0xFF131313, 0xFF080808, 0xFF0E0E0E,
+	0xFF515151, 0xFF757575, 0xFF4B4B4B, 0xFF828282, 0xFF2C2C2C, 0xFF0C0C0C, 0xFF0C0C0C, 0xFF1E1E1E,
+	0xFFA4A4A4, 0xFFBBBBBB, 0xFF656565, 0xFF4A4A4A, 0xFF212121, 0xFF2D2D2D, 0xFF707070, 0xFF878787,
+	0xFF444444, 0xFF5A5A5A, 0xFF2E2E2E, 0xFF222222, 0xFF4B4B4B, 0xFF5A5A5A, 0xFF090909, 0xFF020202,
+	0xFF070707, 0xFF6C6C6C, 0xFF3A3A3A, 0xFF0B0B0B, 0xFF0E0E0E, 0xFF0D0D0D, 0xFF050505, 0xFF181818,
+	0xFF424242, 0xFF242424, 0xFF282828, 0xFF838383, 0xFF3D3D3D, 0xFF0D0D0D, 0xFF202020, 0xFF515151,
+	0xFFA3A3A3, 0xFFC5C5C5, 0xFF343434, 0xFF1F1F1F, 0xFF4D4D4D, 0xFFAAAAAA, 0xFF818181, 0xFF474747,
+	0xFF303030, 0xFF545454, 0xFF808080, 0xFF7D7D7D, 0xFFB1B1B1, 0xFF484848, 0xFF0D0D0D, 0xFF030303,
+	0xFF1D1D1D, 0xFF515151, 0xFF303030, 0xFF1A1A1A, 0xFF222222, 0xFF161616, 0xFF0D0D0D, 0xFF171717,
+	0xFF222222, 0xFF0D0D0D, 0xFF0A0A0A, 0xFF3B3B3B, 0xFF7E7E7E, 0xFF444444, 0xFF7D7D7D, 0xFFA5A5A5,
+	0xFF828282, 0xFFA2A2A2, 0xFF181818, 0xFF040404, 0xFF171717, 0xFF525252, 0xFF5D5D5D, 0xFF4B4B4B,
+	0xFF484848, 0xFF555555, 0xFF707070, 0xFF787878, 0xFF5D5D5D, 0xFF2C2C2C, 0xFF101010, 0xFF0C0C0C,
+	0xFF060606, 0xFF191919, 0xFF484848, 0xFF696969, 0xFF4C4C4C, 0xFF3C3C3C, 0xFF222222, 0xFF212121,
+	0xFF454545, 0xFF1C1C1C, 0xFF030303, 0xFF0A0A0A, 0xFF2E2E2E, 0xFF555555, 0xFF9A9A9A, 0xFF6A6A6A,
+	0xFF434343, 0xFF5C5C5C, 0xFF101010, 0xFF020202, 0xFF0E0E0E, 0xFF2C2C2C, 0xFF343434, 0xFF303030,
+	0xFF444444, 0xFF6D6D6D, 0xFF656565, 0xFF5E5E5E, 0xFF696969, 0xFF585858, 0xFF141414, 0xFF020202,
+	0xFF050505, 0xFF1A1A1A, 0xFF808080, 0xFFA0A0A0, 0xFF5C5C5C, 0xFF3F3F3F, 0xFF3E3E3E, 0xFF3D3D3D,
+	0xFF9D9D9D, 0xFF434343, 0xFF080808, 0xFF020202, 0xFF090909, 0xFF282828, 0xFF646464, 0xFF303030,
+	0xFF242424, 0xFF404040, 0xFF191919, 0xFF141414, 0xFF252525, 0xFF242424, 0xFF3E3E3E, 0xFF5E5E5E,
+	0xFF919191, 0xFFBDBDBD, 0xFF4D4D4D, 0xFF1B1B1B, 0xFF1E1E1E, 0xFF5E5E5E, 0xFF767676, 0xFF0B0B0B,
+	0xFF1E1E1E, 0xFF474747, 0xFF959595, 0xFF303030, 0xFF202020, 0xFF2D2D2D, 0xFF6A6A6A, 0xFF707070,
+	0xFFB9B9B9, 0xFF606060, 0xFF151515, 0xFF101010, 0xFF121212, 0xFF303030, 0xFF363636, 0xFF1C1C1C,
+	0xFF1C1C1C, 0xFF292929, 0xFF565656, 0xFF4D4D4D, 0xFF191919, 0xFF0D0D0D, 0xFF1F1F1F, 0xFF434343,
+	0xFF585858, 0xFF8E8E8E, 0xFF7D7D7D, 0xFF0A0A0A, 0xFF020202, 0xFF090909, 0xFF6D6D6D, 0xFF434343,
+	0xFF4F4F4F, 0xFF919191, 0xFF555655, 0xFF1F1F1F, 0xFF202020, 0xFF3B3B3B, 0xFF737373, 0xFF525252,
+	0xFF8F8F8F, 0xFF727272, 0xFF464646, 0xFF595959, 0xFF282828, 0xFF1D1D1D, 0xFF1A1A1A, 0xFF1F1F1F,
+	0xFF0C0C0C, 0xFF1E1E1E, 0xFF606060, 0xFF333333, 0xFF0F0F0F, 0xFF070707, 0xFF181818, 0xFF262626,
+	0xFF181818, 0xFF282828, 0xFFA2A2A2, 0xFF1F1F1F, 0xFF080808, 0xFF0B0B0B, 0xFF1A1A1A, 0xFF3C3C3C,
+	0xFF444444, 0xFF7A7A7A, 0xFF4F4F4F, 0xFF252525, 0xFF1D1D1D, 0xFF222222, 0xFF1C1C1C, 0xFF1F1F1F,
+	0xFF4E4E4E, 0xFF6E6E6E, 0xFF505050, 0xFF767676, 0xFF262626, 0xFF101010, 0xFF1A1A1A, 0xFF3C3C3C,
+	0xFF212121, 0xFF1C1C1C, 0xFF777777, 0xFF888888, 0xFF272727, 0xFF141414, 0xFF343434, 0xFF454545,
+	0xFF1F1F1F, 0xFF191919, 0xFF5A5A5A, 0xFF434343, 0xFF191919, 0xFF0B0B0B, 0xFF0A0A0A, 0xFF181818,
+	0xFF2D2D2D, 0xFF878787, 0xFF8C8C8C, 0xFF202020, 0xFF080808, 0xFF080808, 0xFF0F0F0F, 0xFF1C1C1C,
+	0xFF373737, 0xFF505050, 0xFF2A2A2A, 0xFF111111, 0xFF191919, 0xFF0E0E0E, 0xFF161616, 0xFF323232,
+	0xFF303030, 0xFF141414, 0xFF181818, 0xFF4B4B4B, 0xFF979897, 0xFF7F7F7F, 0xFFA8A8A8, 0xFFC0C0C0,
+	0xFF717171, 0xFF4A4A4A, 0xFF272727, 0xFF222222, 0xFF191919, 0xFF151515, 0xFF111111, 0xFF141414,
+	0xFF474747, 0xFF404040, 0xFF3C3C3C, 0xFF1B1B1B, 0xFF101010, 0xFF1E1E1E, 0xFF393939, 0xFF171717,
+	0xFF141414, 0xFF272727, 0xFF101010, 0xFF030303, 0xFF101010, 0xFF141414, 0xFF171717, 0xFF202020,
+	0xFF181818, 0xFF080808, 0xFF030303, 0xFF0D0D0D, 0xFF303030, 0xFF757575, 0xFF6D6D6D, 0xFF4D4D4D,
+	0xFF545454, 0xFFA8A8A8, 0xFF303030, 0xFF090909, 0xFF040404, 0xFF030303, 0xFF030303, 0xFF131313,
+	0xFF7A7A7A, 0xFF343434, 0xFF262626, 0xFF272727, 0xFF474647, 0xFF8B8B8B, 0xFF959595, 0xFF393939,
+	0xFF292929, 0xFF292929, 0xFF171717, 0xFF080808, 0xFF141414, 0xFF525252, 0xFF666666, 0xFF676767,
+	0xFF4B4B4B, 0xFF191919, 0xFF1B1B1B, 0xFF343434, 0xFF292929, 0xFF2B2B2B, 0xFF414141, 0xFF5E5E5E,
+	0xFF696969, 0xFF5D5D5D, 0xFF1A1A1A, 0xFF090909, 0xFF020202, 0xFF020202, 0xFF0C0C0C, 0xFF777777,
+	0xFF131313, 0xFF404140, 0xFF3A3A3A, 0xFF363636, 0xFF5E5E5E, 0xFF6E6E6E, 0xFF6F6F6F, 0xFF656465,
+	0xFF373737, 0xFF4D4D4D, 0xFF373737, 0xFF727272, 0xFF585858, 0xFF151515, 0xFF0C0C0C, 0xFF636363,
+	0xFF252525, 0xFF4C4C4C, 0xFF313131, 0xFF494949, 0xFF737373, 0xFF424242, 0xFF313131, 0xFF595959,
+	0xFF2E2E2E, 0xFF1C1C1C, 0xFF171717, 0xFF868686, 0xFF6B6B6B, 0xFF727272, 0xFF7E7E7E, 0xFF585858,
+	0xFF131313, 0xFF3D3D3D, 0xFFA5A5A5, 0xFF626262, 0xFF2B2B2B, 0xFF040404, 0xFF252525, 0xFF737373,
+	0xFF363636, 0xFF151515, 0xFF595959, 0xFF606060, 0xFF2C2C2C, 0xFF353535, 0xFF535353, 0xFF4F4F4F,
+	0xFF282828, 0xFF222222, 0xFF747474, 0xFF5E5E5E, 0xFF1E1E1E, 0xFF131313, 0xFF515151, 0xFF252525,
+	0xFF3A3A3A, 0xFF1C1C1C, 0xFF777777, 0xFFB3B2B3, 0xFF323232, 0xFF101010, 0xFF1C1C1C, 0xFF161616,
+	0xFF464646, 0xFF111111, 0xFF151515, 0xFF424242, 0xFF2E2E2E, 0xFF1C1C1C, 0xFF222222, 0xFF131313,
+	0xFF232323, 0xFF383838, 0xFF565656, 0xFF717171, 0xFF353535, 0xFF5C5B5C, 0xFF474747, 0xFF343434,
+	0xFF3B3B3B, 0xFF3E3E3E, 0xFF282828, 0xFF242424, 0xFF141414, 0xFF272727, 0xFF4C4C4C, 0xFF3B3B3B,
+	0xFF1E1E1E, 0xFF717171, 0xFF828282, 0xFF282828, 0xFF333333, 0xFFB8B8B8, 0xFF4C4C4C, 0xFF393939,
+	0xFF252525, 0xFF494949, 0xFF6C6C6C, 0xFF434343, 0xFF0E0E0E, 0xFF4B4B4B, 0xFF0E0E0E, 0xFF1D1D1D,
+	0xFF111111, 0xFF383838, 0xFF555555, 0xFF171717, 0xFF494949, 0xFF8B8B8B, 0xFF6D6D6D, 0xFF535353,
+	0xFF4E4E4E, 0xFF090909, 0xFF262626, 0xFF121212, 0xFF090909, 0xFF636363, 0xFF191919, 0xFF0C0C0C,
+	0xFF4D4D4D, 0xFF6F6F6F, 0xFF292929, 0xFF181818, 0xFF515151, 0xFF2D2D2D, 0xFF5B5B5B, 0xFF090909,
+	0xFF3C3C3C, 0xFF525252, 0xFF3C3C3C, 0xFF575757, 0xFF292929, 0xFF4F4F4F, 0xFF1C1C1C, 0xFF424242,
+	0xFF373737, 0xFF252525, 0xFF525252, 0xFF4E4E4E, 0xFF3F3F3F, 0xFF0F0F0F, 0xFF666666, 0xFF0C0C0C,
+	0xFF141414, 0xFF252525, 0xFF5E5E5E, 0xFF141414, 0xFF111111, 0xFF383838, 0xFF2C2C2C, 0xFF2E2E2E,
+	0xFF434343, 0xFF6E6E6E, 0xFF232323, 0xFF757575, 0xFF444444, 0xFF5A5A5A, 0xFF393939, 0xFF171717,
+	0xFF090909, 0xFF202020, 0xFF222222, 0xFF111111, 0xFF4A4A4A, 0xFF676767, 0xFF202020, 0xFF111111,
+	0xFF989798, 0xFF656565, 0xFF1B1B1B, 0xFF747474, 0xFF454545, 0xFF202020, 0xFF3E3E3E, 0xFF050505,
+	0xFF383838, 0xFF242424, 0xFF151515, 0xFF101010, 0xFF252525, 0xFF3C3C3C, 0xFF434343, 0xFF656565,
+	0xFFA3A3A3, 0xFF1C1C1C, 0xFF585858, 0xFF5C5C5C, 0xFF484848, 0xFF797979, 0xFF616161, 0xFF0B0B0B,
+	0xFF101010, 0xFF747474, 0xFF494949, 0xFF303030, 0xFF505050, 0xFF060606, 0xFF2D2D2D, 0xFF666666,
+	0xFF414141, 0xFF101010, 0xFF212121, 0xFF404040, 0xFF808080, 0xFF4B4B4B, 0xFF4F4F4F, 0xFF262626,
+	0xFF515151, 0xFF4E4F4E, 0xFF2A2A2A, 0xFF686868, 0xFF878787, 0xFF313131, 0xFF222222, 0xFF232323,
+	0xFF1C1C1C, 0xFF4E4E4E, 0xFF0F0F0F, 0xFF282828, 0xFF4A4A4A, 0xFF525252, 0xFF080808, 0xFF424242,
+	0xFF5D5D5D, 0xFF484848, 0xFF141414, 0xFF1A1A1A, 0xFF515151, 0xFF404040, 0xFF171717, 0xFF282828,
+	0xFF202020, 0xFF595959, 0xFF545554, 0xFF787878, 0xFF3D3D3D, 0xFF3A3A3A, 0xFF151515, 0xFF121212,
+	0xFF4D4D4D, 0xFF292929, 0xFF404040, 0xFF484848, 0xFF232323, 0xFF0D0D0D, 0xFF232323, 0xFF414141,
+	0xFF212121, 0xFF181818, 0xFF3E3E3E, 0xFF565656, 0xFF717171, 0xFF171717, 0xFF030303, 0xFF262626,
+	0xFF313131, 0xFF3B3B3B, 0xFF606060, 0xFF585758, 0xFF343434, 0xFF525252, 0xFF535353, 0xFF515151,
+	0xFF272727, 0xFF767676, 0xFF181818, 0xFF444444, 0xFF282828, 0xFF797979, 0xFF292929, 0xFF353535,
+	0xFF343434, 0xFF292929, 0xFF212121, 0xFF2F2F2F, 0xFF3B3B3B, 0xFF5C5C5C, 0xFF5F5F5F, 0xFF404040,
+	0xFF313131, 0xFF3A3A3A, 0xFF313131, 0xFF141414, 0xFF414141, 0xFF2B2B2B, 0xFF555555, 0xFF494949,
+	0xFF323232, 0xFF414141, 0xFF303030, 0xFF2E2E2E, 0xFF434343, 0xFF4E4E4E, 0xFF3B3B3B, 0xFF313131,
+	0xFF212121, 0xFF161616, 0xFF454545, 0xFF363636, 0xFF6F6F6F, 0xFF515151, 0xFF4A4A4A, 0xFF2C2C2C,
+	0xFF494949, 0xFF434343, 0xFF444444, 0xFF363636, 0xFF2F2F2F, 0xFF262626, 0xFF5A5A5A, 0xFF303030,
+	0xFF474747, 0xFF2E2E2E, 0xFF303030, 0xFF292929, 0xFF2D2D2D, 0xFF585858, 0xFF404040, 0xFF141414,
+	0xFF424242, 0xFF454545, 0xFF4A4A4A, 0xFF414141, 0xFF323232, 0xFF252525, 0xFF414141, 0xFF4F4F4F,
+	0xFF2B2B2B, 0xFF363636, 0xFF545454, 0xFF393939, 0xFF404040, 0xFF353535, 0xFF373737, 0xFF383838,
+	0xFF383838, 0xFF474747, 0xFF363636, 0xFF3F3F3F, 0xFF3D3D3D
 };
+
+const GfxRawTexture Caustics_128x128 = { 128, 128, 8, Caustics_128x128_pixels };
@@ -1,3270 +1,2738 @@
-/* dudv128.png (8/8/2024 12:41:42 AM)
-   StartOffset(h): 00000000, EndOffset(h): 00009905, Length(h): 00009906 */
+/* dudv128.png, baked by Resources/Textures/BakeTexture.py, do not edit
+   128x128 A8R8G8B8, 8 mips */
 
-unsigned char DuDv_128x128_data[39174] = {
-	0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D,
-	0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
-	0x08, 0x06, 0x00, 0x00, 0x00, 0xC3, 0x3E, 0x61, 0xCB, 0x00, 0x00, 0x20,
-	0x00, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0x2C, 0xBB, 0xD7, 0xAE, 0x25,
-	0x49, 0x96, 0xA6, 0xF7, 0x2D, 0x33, 0x97, 0x5B, 0xAB, 0xA3, 0x4F, 0xA8,
-	0xD4, 0xD5, 0x5D, 0xC5, 0xC6, 0x88, 0x26, 0xC0, 0x9B, 0x06, 0x79, 0xC3,
-	0x57, 0xE1, 0x13, 0xF2, 0x96, 0x00, 0x31, 0x1C, 0x10, 0x14, 0x03, 0x4C,
-	0x73, 0xAA, 0xBA, 0xAB, 0x32, 0x33, 0x32, 0x23, 0x4E, 0xC4, 0x91, 0x5B,
-	0x6F, 0xDF, 0xEE, 0xDB, 0x85, 0x99, 0x2D, 0x5E, 0x9C, 0x7E, 0x03, 0x87,
-	0x3B, 0x7C, 0xD9, 0xBF, 0xBE, 0xFF, 0x33, 0xF9, 0xA7, 0xFF, 0xC5, 0xE8,
-	0xE7, 0xA1, 0x72, 0x91, 0x09, 0xFF, 0xA3, 0x8D, 0x78, 0x3F, 0x0E, 0xD4,
-	0x67, 0x8E, 0xF5, 0x08, 0x42, 0x1D, 0x73, 0x78, 0x54, 0xCA, 0xAF, 0x8A,
-	0x2D, 0x84, 0xBC, 0x09, 0x9C, 0x08, 0x6C, 0x22, 0x43, 0x37, 0xB6, 0xCC,
-	0xCE, 0x3A, 0x16, 0x8B, 0x84, 0x3C, 0x55, 0xF6, 0xBF, 0x7B, 0x76, 0x7F,
-	0x0D, 0x5C, 0x2F, 0xE1, 0xFB, 0xF7, 0x29, 0xC9, 0x3F, 0x74, 0x7C, 0xBE,
-	0x08, 0xD4, 0x1B, 0x21, 0xFF, 0x1B, 0xF4, 0x57, 0x16, 0x99, 0x3B, 0xDC,
-	0x15, 0x6C, 0x9D, 0xF0, 0x74, 0xAF, 0xEC, 0xEF, 0x62, 0xF2, 0x17, 0x4F,
-	0x54, 0x05, 0xBA, 0x9E, 0x70, 0x7E, 0x61, 0x58, 0x0C, 0x2D, 0x9F, 0xF6,
-	0xCA, 0xFF, 0xF9, 0xD4, 0x71, 0x2C, 0x62, 0x16, 0xC1, 0x30, 0x93, 0x86,
-	0x60, 0x60, 0xD4, 0x83, 0xFF, 0x61, 0x96, 0x73, 0x7B, 0xD1, 0xF1, 0xE5,
-	0xC2, 0xF1, 0x9F, 0x2E, 0x60, 0x3B, 0x8C, 0xF9, 0x83, 0x04, 0xFE, 0x69,
-	0x2F, 0x0C, 0x4B, 0xE5, 0x6F, 0xAD, 0xE7, 0x9F, 0x3D, 0xB8, 0x5E, 0xC4,
-	0x3F, 0x8E, 0xE1, 0xDF, 0x35, 0x8E, 0xED, 0x93, 0xF0, 0x9F, 0x0B, 0xC3,
-	0x66, 0xE1, 0x79, 0xFB, 0xA3, 0x70, 0x7D, 0xA3, 0x2C, 0x93, 0x98, 0xFC,
-	0xFF, 0xCD, 0xA8, 0xFF, 0xD7, 0x8A, 0xE5, 0xD1, 0xF3, 0x9D, 0x18, 0xC6,
-	0x23, 0xC3, 0xEF, 0x1F, 0x84, 0xFF, 0xF2, 0x63, 0xC7, 0xFD, 0x40, 0x18,
-	0x7D, 0x8D, 0x78, 0xF7, 0xB1, 0xE3, 0xEF, 0x1E, 0x61, 0xB1, 0x82, 0xDD,
-	0xC1, 0xF2, 0x60, 0x03, 0xF5, 0x4C, 0x89, 0xBF, 0x87, 0xB3, 0x3F, 0x1A,
-	0x86, 0xD7, 0x31, 0xD5, 0xD8, 0xB1, 0x6E, 0x03, 0xCB, 0x27, 0x58, 0xDD,
-	0x41, 0x73, 0x2F, 0x4C, 0x57, 0x86, 0x7F, 0x2A, 0x3C, 0xFF, 0x93, 0x51,
-	0x06, 0x0B, 0xF8, 0xCB, 0xDF, 0x09, 0xFF, 0xC7, 0x65, 0xCE, 0xFF, 0xAE,
-	0x8E, 0xF0, 0xB5, 0xE5, 0xFB, 0x3B, 0xE1, 0xF2, 0x90, 0x72, 0x32, 0x1E,
-	0x49, 0x3B, 0xCE, 0x62, 0x21, 0xCD, 0x0C, 0x0F, 0x13, 0xE5, 0x71, 0x90,
-	0xD0, 0xD4, 0x1D, 0xDF, 0xEE, 0xE1, 0x1F, 0x14, 0xD2, 0x21, 0xFC, 0x7F,
-	0x03, 0xE5, 0x97, 0x54, 0xF1, 0x91, 0x65, 0x86, 0x67, 0x6F, 0x95, 0x95,
-	0x01, 0x0C, 0x10, 0x1B, 0xC6, 0x1E, 0xDE, 0xAD, 0x95, 0x9F, 0xBE, 0x28,
-	0xDF, 0x3E, 0xC0, 0xDA, 0xC0, 0x7F, 0xBE, 0x82, 0x7F, 0xFD, 0x20, 0x3C,
-	0xFE, 0x3B, 0x8B, 0xFB, 0x41, 0xF9, 0x87, 0xD8, 0xF3, 0x3F, 0xAF, 0xE0,
-	0x8F, 0xBF, 0x5A, 0x8E, 0x3F, 0x7B, 0xFE, 0xB7, 0x07, 0x88, 0xDA, 0xDF,
-	0x02, 0x72, 0x21, 0x24, 0x93, 0x40, 0x9A, 0x75, 0x5C, 0x66, 0x82, 0x36,
-	0x86, 0xFA, 0x68, 0xF9, 0x97, 0x83, 0xE7, 0xFE, 0x3E, 0x60, 0x96, 0x70,
-	0x01, 0x4C, 0x87, 0x42, 0x6F, 0x2C, 0x0C, 0x67, 0xA0, 0x73, 0x07, 0x56,
-	0x68, 0x5C, 0xC7, 0xCB, 0xCE, 0xF0, 0x50, 0x09, 0x9D, 0x11, 0xE6, 0x31,
-	0x8C, 0x0B, 0x43, 0x74, 0x6F, 0x68, 0x4B, 0xE5, 0xD3, 0x0B, 0x64, 0xBF,
-	0x2B, 0xFF, 0xDD, 0xCE, 0xF1, 0xDD, 0x16, 0x9A, 0x2F, 0x29, 0xFF, 0x57,
-	0x50, 0x1E, 0xAB, 0x16, 0xE7, 0x3A, 0x86, 0x39, 0x0C, 0x04, 0x8C, 0x51,
-	0xB2, 0xD6, 0x53, 0x6C, 0x95, 0xE5, 0x3A, 0x70, 0xD8, 0x43, 0x55, 0x07,
-	0x9C, 0x74, 0xB8, 0x1C, 0xFA, 0xD7, 0x30, 0xFB, 0xC1, 0xD0, 0x9E, 0x05,
-	0xBA, 0xB5, 0x20, 0x0F, 0x60, 0x4E, 0x30, 0xFA, 0xA9, 0x23, 0x7D, 0x1F,
-	0x71, 0x3A, 0x0F, 0x9C, 0x96, 0x81, 0xF5, 0x93, 0x41, 0x77, 0x81, 0xF1,
-	0xD1, 0x33, 0x34, 0xC2, 0x1E, 0xE1, 0xA5, 0x55, 0x54, 0x94, 0x51, 0xDF,
-	0x70, 0x96, 0x19, 0x74, 0xA3, 0x84, 0x5F, 0x3D, 0xDD, 0x7F, 0x2A, 0x18,
-	0x15, 0xD0, 0xCD, 0x0C, 0x65, 0xA9, 0x68, 0xE3, 0x88, 0x0F, 0x30, 0x29,
-	0x85, 0x87, 0x1E, 0x3C, 0xF7, 0x02, 0xD9, 0x4C, 0x98, 0x75, 0xB0, 0x95,
-	0x88, 0xBD, 0x0D, 0x8C, 0x3B, 0xE5, 0xDB, 0x08, 0x46, 0xA9, 0x65, 0x94,
-	0x79, 0x8E, 0x49, 0xC7, 0xFF, 0x5D, 0x09, 0x7F, 0x79, 0x34, 0x3C, 0x3D,
-	0x78, 0x36, 0x07, 0x48, 0xAC, 0xF0, 0xA7, 0x85, 0x43, 0x52, 0x48, 0x4B,
-	0xCB, 0x20, 0x31, 0x0C, 0x83, 0x87, 0xC7, 0x13, 0xFE, 0x49, 0xD9, 0xAF,
-	0x85, 0x7B, 0xA7, 0x74, 0xD3, 0x9A, 0xFE, 0x04, 0x6E, 0xAC, 0x70, 0xE3,
-	0x0C, 0xD6, 0x08, 0x27, 0x51, 0x9E, 0xB7, 0x9E, 0x7A, 0xAD, 0x1C, 0x5E,
-	0x02, 0xCD, 0x09, 0xA6, 0x01, 0x66, 0x19, 0x24, 0x57, 0x70, 0xFA, 0xE0,
-	0x28, 0xCF, 0xE1, 0xD4, 0xB7, 0x38, 0xC0, 0x56, 0x81, 0xD8, 0xC3, 0x0E,
-	0x85, 0x33, 0x18, 0x8D, 0x60, 0x7E, 0x05, 0xF3, 0xAD, 0xE1, 0x1F, 0x7B,
-	0x70, 0x7E, 0x05, 0x9F, 0xCF, 0x03, 0x9F, 0x46, 0x96, 0xC2, 0x7A, 0xEE,
-	0x5E, 0x0C, 0xC9, 0xB3, 0xD0, 0xFC, 0x8B, 0xF0, 0xF8, 0x22, 0x44, 0xD4,
-	0x70, 0xD9, 0x29, 0x0B, 0x0F, 0xB9, 0x81, 0x59, 0x0B, 0xDC, 0x0B, 0xA6,
-	0x09, 0xAC, 0x0E, 0x81, 0xA2, 0x32, 0x5C, 0xA5, 0x81, 0xAB, 0x99, 0xB0,
-	0xB8, 0x88, 0xB0, 0x23, 0xA5, 0x1E, 0x28, 0x95, 0x09, 0xAC, 0x1E, 0x2C,
-	0x5F, 0x7E, 0x35, 0x3C, 0xBC, 0x78, 0xF6, 0x21, 0x30, 0xB0, 0x86, 0xD5,
-	0x48, 0x39, 0x86, 0x13, 0xE7, 0xBF, 0x1B, 0xC4, 0x58, 0xB6, 0xA5, 0xA3,
-	0xDF, 0x82, 0xCE, 0x2D, 0x69, 0x6C, 0xA8, 0x9F, 0xA1, 0xDD, 0x78, 0x34,
-	0x87, 0xFE, 0x3B, 0xA1, 0x7F, 0x63, 0xC9, 0x6A, 0x03, 0xC7, 0x8E, 0xB6,
-	0x55, 0x0E, 0x65, 0xE0, 0x65, 0x08, 0xBE, 0x03, 0x8D, 0x3D, 0xAD, 0x82,
-	0xED, 0xC3, 0xD5, 0x07, 0xC3, 0xE4, 0xEF, 0x60, 0xAF, 0x0D, 0xE1, 0x2B,
-	0x9C, 0xBE, 0xC2, 0xF4, 0x08, 0xBD, 0x1B, 0xF8, 0xE0, 0x84, 0xBC, 0x6F,
-	0x78, 0x09, 0x96, 0xE3, 0xCA, 0x61, 0x03, 0xF4, 0x23, 0x25, 0x8A, 0x0D,
-	0x65, 0x14, 0xF3, 0x32, 0xEA, 0x38, 0x6D, 0x03, 0xFD, 0x9D, 0x50, 0xFD,
-	0x39, 0xA6, 0x3E, 0x39, 0xEE, 0xEF, 0x3B, 0x06, 0x7B, 0x88, 0x22, 0xA1,
-	0xED, 0x09, 0xA7, 0x91, 0xE2, 0x23, 0xE8, 0xF7, 0x84, 0xEB, 0x5A, 0x78,
-	0x3A, 0x04, 0x9A, 0xC6, 0xD3, 0x1A, 0xD8, 0x8C, 0x23, 0xA2, 0x18, 0xAA,
-	0x33, 0x65, 0xD0, 0xB3, 0x9C, 0x8D, 0x2D, 0xDF, 0xF5, 0x94, 0xAE, 0xF3,
-	0xFC, 0xF3, 0xE7, 0xC0, 0xFD, 0xCE, 0xF0, 0xCB, 0x4E, 0xD8, 0x75, 0x10,
-	0xC5, 0x60, 0x6F, 0x02, 0xD5, 0xC8, 0xB0, 0xAF, 0x02, 0x9B, 0x12, 0xD2,
-	0xC4, 0x52, 0xA5, 0x81, 0xC3, 0x5A, 0x71, 0x5B, 0x48, 0x5A, 0x88, 0xCE,
-	0x22, 0xA2, 0x33, 0x4F, 0x32, 0x82, 0xA4, 0xB3, 0x64, 0x2B, 0xA5, 0x59,
-	0x7B, 0xB6, 0xA5, 0xF2, 0xB5, 0x0B, 0x1C, 0xD5, 0x70, 0x0D, 0x4C, 0xBD,
-	0x70, 0x7E, 0x80, 0xFD, 0x49, 0x59, 0x4C, 0x85, 0x26, 0x82, 0x28, 0xB3,
-	0x84, 0xC8, 0xB2, 0x3D, 0x28, 0xF5, 0xA7, 0xC0, 0x7C, 0x13, 0xC8, 0x7A,
-	0x60, 0xDE, 0x41, 0x75, 0x6E, 0xD8, 0x2D, 0x94, 0xCB, 0x03, 0xFC, 0x63,
-	0x1B, 0x71, 0x15, 0x19, 0x64, 0x1D, 0xF8, 0x5C, 0xB5, 0xDC, 0x75, 0x90,
-	0x3D, 0x82, 0x7C, 0x11, 0x74, 0x2B, 0x6C, 0x5B, 0x25, 0xE2, 0xEF, 0x0D,
-	0x17, 0x59, 0xE0, 0x2C, 0xB7, 0xC4, 0x46, 0x71, 0x1B, 0x68, 0x0E, 0x9E,
-	0x53, 0x03, 0xB1, 0x18, 0xC6, 0x53, 0xE5, 0x72, 0x6A, 0x98, 0xF4, 0x62,
-	0xD4, 0x75, 0xF8, 0x9D, 0xA1, 0x3D, 0x08, 0xEB, 0x3D, 0x7C, 0xF9, 0xCD,
-	0xF3, 0xF9, 0x67, 0xCF, 0x7E, 0x03, 0x49, 0xDF, 0x60, 0x7F, 0x08, 0xD4,
-	0xB7, 0x50, 0x02, 0x55, 0xA1, 0xC8, 0x8B, 0x43, 0x6A, 0x20, 0x85, 0x30,
-	0x8A, 0xD8, 0xF8, 0xC0, 0x17, 0x1A, 0x9E, 0x5A, 0x88, 0x33, 0x38, 0x1B,
-	0x1A, 0xFA, 0x97, 0x4A, 0xDB, 0x53, 0xCC, 0x49, 0xA0, 0x52, 0x8A, 0x0A,
-	0xCA, 0x56, 0xB0, 0x3B, 0x43, 0x5A, 0x79, 0xAE, 0xBC, 0xF0, 0xA7, 0xB3,
-	0x88, 0xCB, 0xF7, 0x9E, 0xA6, 0x6F, 0x79, 0x7E, 0x84, 0xD5, 0x09, 0x46,
-	0x59, 0xE0, 0x6D, 0x66, 0x98, 0x6E, 0x95, 0xF3, 0xDF, 0x1C, 0x49, 0xCF,
-	0x42, 0x25, 0xB8, 0x06, 0xD2, 0x54, 0x98, 0xA4, 0x86, 0x32, 0x31, 0x7C,
-	0xE9, 0x94, 0x9F, 0x3B, 0x43, 0x53, 0x07, 0xF2, 0xAD, 0x52, 0xF9, 0x13,
-	0x6D, 0x03, 0x41, 0x85, 0xF6, 0xAD, 0x52, 0x8A, 0xD2, 0x45, 0x9E, 0x7A,
-	0x06, 0xE9, 0xDC, 0x92, 0x67, 0x90, 0x79, 0xCF, 0xAC, 0x85, 0xBA, 0x83,
-	0x2C, 0x82, 0x3C, 0x77, 0x30, 0x04, 0x2E, 0x21, 0x9E, 0x1B, 0x7C, 0xE4,
-	0xD0, 0x1D, 0xB8, 0x4F, 0xC2, 0xF2, 0x4E, 0xD9, 0xEE, 0x94, 0x4E, 0x14,
-	0x3B, 0x14, 0xF2, 0x4B, 0xE1, 0x7C, 0x62, 0x99, 0x2D, 0x3C, 0x2E, 0x37,
-	0x2C, 0x9D, 0xE2, 0x0F, 0x35, 0x4F, 0x4B, 0xC3, 0x73, 0x0B, 0xED, 0x40,
-	0x18, 0x5D, 0x29, 0xB3, 0xA1, 0x92, 0x61, 0x08, 0x6B, 0x4F, 0xD5, 0x38,
-	0x76, 0x47, 0x28, 0x2A, 0xF8, 0xE4, 0xE1, 0x65, 0x00, 0xD9, 0x22, 0xD0,
-	0x1B, 0x0A, 0x71, 0x01, 0x66, 0xA5, 0x9C, 0x1B, 0xF8, 0xE1, 0x52, 0xD9,
-	0xE7, 0x31, 0x55, 0x69, 0x59, 0x3D, 0x7A, 0xAA, 0x27, 0x47, 0xF3, 0xA0,
-	0x5C, 0x54, 0xC2, 0xBB, 0x33, 0xC5, 0x4E, 0x0C, 0xAD, 0x8D, 0x38, 0x46,
-	0x1E, 0xDB, 0x04, 0x86, 0xC1, 0x31, 0xB8, 0x17, 0x9A, 0x5F, 0x22, 0xAA,
-	0x7D, 0x4C, 0x17, 0x3A, 0x6A, 0xA0, 0x54, 0x47, 0xF7, 0x46, 0x69, 0x0D,
-	0x44, 0xF9, 0x0F, 0x06, 0xD7, 0x08, 0xBE, 0x14, 0x8E, 0x6D, 0xE0, 0xB9,
-	0x55, 0x7A, 0x02, 0x83, 0x29, 0x5C, 0x4D, 0x52, 0x8E, 0x7D, 0xC5, 0xFA,
-	0x9A, 0xDD, 0xAA, 0xC5, 0xEC, 0x15, 0x7C, 0xA0, 0xA9, 0x0D, 0x9B, 0xAD,
-	0xE5, 0xE1, 0xD1, 0xB3, 0xDF, 0x82, 0x05, 0xA6, 0xD3, 0xC0, 0x9B, 0x09,
-	0xBC, 0x79, 0x27, 0x68, 0x2F, 0xE2, 0x61, 0x0B, 0xCF, 0x22, 0xB4, 0x4F,
-	0x2D, 0x03, 0x11, 0x9A, 0x6D, 0xCB, 0xD2, 0x29, 0x0F, 0x02, 0xC5, 0x14,
-	0xD2, 0x81, 0xD0, 0x0B, 0x9E, 0x64, 0x03, 0x2E, 0xF2, 0xD8, 0xB9, 0xC1,
-	0xBF, 0x85, 0x56, 0xC1, 0x7B, 0x43, 0xD2, 0xC2, 0x4D, 0x21, 0xFC, 0x31,
-	0x18, 0x3E, 0x8C, 0x3C, 0xC6, 0x28, 0x1F, 0xF7, 0x9E, 0x97, 0x43, 0x60,
-	0x34, 0xB6, 0x5C, 0x4E, 0x85, 0x45, 0x62, 0x48, 0x9C, 0xC7, 0x7D, 0x54,
-	0x68, 0x3D, 0xA1, 0x16, 0x6C, 0x5F, 0x88, 0x47, 0x01, 0x3D, 0xC1, 0x4B,
-	0xE9, 0xF9, 0xBD, 0x08, 0x3C, 0x36, 0x96, 0xA1, 0x13, 0x62, 0xAB, 0xF4,
-	0x0C, 0x98, 0xC4, 0x10, 0x0F, 0xC1, 0x9F, 0x41, 0xD1, 0x80, 0xD9, 0x2A,
-	0x93, 0x54, 0xE8, 0xCD, 0x85, 0x90, 0x39, 0x5C, 0x05, 0x69, 0x1D, 0x31,
-	0x8C, 0xC1, 0xF6, 0x15, 0xC5, 0xD3, 0xEF, 0x09, 0x32, 0x8B, 0xA8, 0x53,
-	0xC7, 0xEE, 0xA0, 0x2C, 0x37, 0x86, 0xD3, 0x17, 0x61, 0xFD, 0xAB, 0xD2,
-	0x94, 0x4A, 0x94, 0x1B, 0x72, 0x94, 0xE9, 0x48, 0xF8, 0xAE, 0x0E, 0xBC,
-	0x49, 0x60, 0x7C, 0x16, 0x53, 0x06, 0x65, 0x53, 0x76, 0xFC, 0xF2, 0x12,
-	0x08, 0xCF, 0x70, 0x39, 0xB6, 0x44, 0x0B, 0x83, 0x21, 0x50, 0x6F, 0x3D,
-	0x72, 0x84, 0x45, 0x04, 0xD1, 0x54, 0x38, 0x9D, 0x2B, 0xEB, 0x81, 0x70,
-	0x9A, 0x29, 0x93, 0xB3, 0x88, 0x90, 0xC1, 0xF3, 0xC1, 0xB3, 0x58, 0x59,
-	0x26, 0x0A, 0x17, 0x69, 0xA0, 0x68, 0x1C, 0xEB, 0xE7, 0xC0, 0xF6, 0x45,
-	0x09, 0x9D, 0xD2, 0x9B, 0xC0, 0xE4, 0x1C, 0x2E, 0x7B, 0x06, 0xF5, 0xCA,
-	0xA7, 0xC7, 0x8E, 0x97, 0xB5, 0x61, 0xE3, 0x94, 0x5E, 0xAE, 0xDC, 0xD7,
-	0xC2, 0xD7, 0xC7, 0x06, 0xB7, 0x8F, 0x99, 0x4E, 0xE0, 0xC3, 0x05, 0xBC,
-	0x3D, 0x83, 0xF5, 0x2D, 0x4C, 0xC7, 0x11, 0xD1, 0x60, 0x1F, 0xD8, 0x87,
-	0x40, 0x16, 0x60, 0x61, 0xA1, 0x1A, 0x1A, 0x86, 0xF3, 0x88, 0xB3, 0xB9,
-	0x63, 0x9D, 0x75, 0x94, 0x45, 0x60, 0xF7, 0x2C, 0xD4, 0x6B, 0xA5, 0x57,
-	0x80, 0x2D, 0xA0, 0x2C, 0x02, 0xD5, 0xD1, 0x90, 0x74, 0xAF, 0x67, 0x4E,
-	0x36, 0x14, 0xDE, 0xBF, 0x11, 0xFE, 0x70, 0xA6, 0x9C, 0xF7, 0x12, 0x8A,
-	0x58, 0xB8, 0xD7, 0x8E, 0x5F, 0x62, 0x58, 0xF5, 0x60, 0x5A, 0x2A, 0x51,
-	0x0B, 0x51, 0x2C, 0x44, 0x17, 0xCA, 0x64, 0x10, 0x61, 0x7A, 0x8E, 0x26,
-	0x40, 0xBA, 0x12, 0x46, 0x47, 0x25, 0x7B, 0xA3, 0x14, 0x73, 0x43, 0x32,
-	0x06, 0x8B, 0x21, 0xEB, 0x3A, 0xDE, 0xED, 0xE0, 0x9B, 0x0A, 0x86, 0x3E,
-	0xF0, 0x79, 0x23, 0x7C, 0x79, 0x52, 0x4A, 0x0C, 0x8B, 0xF7, 0x81, 0xD1,
-	0xC0, 0x62, 0x4A, 0xCB, 0xEA, 0x39, 0x10, 0x36, 0x4A, 0x7F, 0x05, 0x47,
-	0x07, 0x51, 0x5F, 0xB1, 0x67, 0x42, 0x27, 0xCA, 0xBE, 0x08, 0x1C, 0x1C,
-	0x44, 0x53, 0xCF, 0xF8, 0x8D, 0x61, 0xDE, 0xB3, 0x0C, 0x1A, 0x47, 0x53,
-	0x09, 0x2E, 0x02, 0x1F, 0x2B, 0x46, 0x0D, 0x83, 0x1E, 0x5C, 0xDB, 0x18,
-	0x5B, 0xB7, 0xEC, 0x3A, 0x38, 0x35, 0x86, 0x20, 0x10, 0xA7, 0x50, 0x67,
-	0xF0, 0xD4, 0x33, 0x5C, 0x46, 0x31, 0x49, 0x09, 0xDD, 0x67, 0x61, 0xFB,
-	0xAC, 0xA4, 0xAB, 0x40, 0x58, 0x83, 0x13, 0x18, 0xF4, 0x2D, 0x17, 0xBD,
-	0x80, 0xA4, 0xCA, 0x75, 0xF0, 0xBC, 0xAB, 0xE0, 0xCD, 0xD1, 0x72, 0xB9,
-	0x81, 0x5D, 0xAB, 0xFC, 0xB7, 0x0D, 0xAC, 0x4F, 0x70, 0x66, 0xE0, 0x22,
-	0x82, 0x43, 0x13, 0x38, 0x7A, 0x8F, 0xF5, 0x70, 0x39, 0x36, 0xDC, 0xCE,
-	0x2C, 0xC3, 0xAB, 0x40, 0x3A, 0x0F, 0x64, 0x17, 0x42, 0x34, 0x89, 0x28,
-	0x4D, 0xC2, 0xDD, 0xA1, 0x66, 0xFA, 0xA4, 0x4C, 0x10, 0xE6, 0x9D, 0xC5,
-	0xB5, 0x8E, 0xA5, 0x7A, 0xEE, 0xAD, 0xA7, 0x9E, 0x42, 0x9C, 0xC3, 0xA8,
-	0x67, 0xC9, 0x23, 0xC1, 0x7B, 0x43, 0x55, 0x39, 0x9A, 0x43, 0x60, 0xBF,
-	0x0E, 0xAC, 0x0A, 0x21, 0x4A, 0xE1, 0x17, 0xA3, 0xBC, 0x28, 0xF4, 0x46,
-	0x1D, 0xDF, 0x8C, 0xE1, 0x8F, 0x83, 0xC0, 0xFB, 0x08, 0x46, 0x21, 0xA2,
-	0xA8, 0x21, 0x1A, 0xFF, 0x1A, 0x70, 0x0B, 0x90, 0x33, 0xA1, 0x89, 0xA1,
-	0x2C, 0x03, 0x10, 0x90, 0x46, 0x68, 0x57, 0x8E, 0xC3, 0x13, 0xC4, 0x07,
-	0x43, 0x6E, 0xC1, 0x5A, 0xA5, 0xF5, 0x96, 0x6D, 0xE2, 0x29, 0xAE, 0x02,
-	0x83, 0x0C, 0x26, 0x19, 0x8C, 0x86, 0x09, 0x1F, 0x46, 0x11, 0xD7, 0xDA,
-	0xA2, 0xF7, 0x1D, 0x2F, 0x85, 0xF0, 0x71, 0xAD, 0x3C, 0x37, 0x81, 0x26,
-	0x01, 0xCD, 0x21, 0x8F, 0x85, 0xEB, 0x01, 0x24, 0x73, 0xE8, 0x0D, 0x2C,
-	0x5F, 0xAC, 0xE5, 0x65, 0xA3, 0x9C, 0x1E, 0x3B, 0xDE, 0x6C, 0xE0, 0xD2,
-	0x45, 0x5C, 0x44, 0x11, 0xD5, 0x85, 0xE3, 0xAE, 0xE7, 0xE8, 0x0A, 0x21,
-	0xD9, 0x28, 0xE9, 0xD6, 0xD3, 0xAE, 0x0C, 0xF7, 0xA5, 0x50, 0x77, 0xCA,
-	0x78, 0x01, 0x17, 0x13, 0x25, 0x9B, 0x78, 0x0E, 0x91, 0xF2, 0x7C, 0x54,
-	0x5A, 0x0B, 0x59, 0xA7, 0x74, 0x5D, 0x87, 0xC6, 0x90, 0xD4, 0x60, 0x33,
-	0xF0, 0x03, 0xC1, 0x24, 0xC2, 0xF8, 0x5A, 0xB9, 0xBA, 0x16, 0x22, 0x11,
-	0xB6, 0x07, 0xC3, 0xAA, 0xF3, 0x98, 0x12, 0x32, 0x85, 0x6C, 0xEC, 0x19,
-	0x8C, 0x63, 0x26, 0xAA, 0xB8, 0x13, 0x7C, 0x29, 0x85, 0x6D, 0xA1, 0x04,
-	0x1C, 0x51, 0x06, 0x61, 0x24, 0x9C, 0xE6, 0xC2, 0x5A, 0xA0, 0xF7, 0xD4,
-	0x92, 0x3F, 0x2A, 0xCD, 0x06, 0xE2, 0xA3, 0xD0, 0xF6, 0x95, 0xF4, 0x0C,
-	0x2E, 0xAD, 0x32, 0x4E, 0x20, 0x32, 0x96, 0x61, 0x02, 0xE0, 0x71, 0x4B,
-	0xCF, 0x69, 0x15, 0xB8, 0xAF, 0x95, 0xBB, 0x06, 0xE4, 0x5C, 0x18, 0x7F,
-	0x80, 0x81, 0x11, 0xEA, 0x4A, 0x39, 0x0A, 0x24, 0xE7, 0x96, 0x49, 0xDF,
-	0x73, 0x3B, 0x54, 0xFA, 0x53, 0xCB, 0xE1, 0x0C, 0x2E, 0xDF, 0x2A, 0x4F,
-	0x3D, 0x43, 0xF9, 0xEC, 0xF9, 0x6D, 0x13, 0x48, 0x5F, 0x60, 0xB2, 0x72,
-	0xC4, 0x3B, 0x45, 0xEA, 0xD7, 0x8C, 0x21, 0x23, 0xC8, 0x16, 0xA0, 0x56,
-	0xA0, 0x13, 0x0A, 0xE7, 0x59, 0xC7, 0x8A, 0x1B, 0x19, 0xDA, 0x58, 0xA9,
-	0x12, 0x85, 0x67, 0xCB, 0xC9, 0x05, 0xAA, 0x04, 0x06, 0x7D, 0xA1, 0x37,
-	0x84, 0x91, 0x18, 0x54, 0x15, 0xAD, 0x03, 0xA3, 0xDF, 0x94, 0x45, 0x08,
-	0x44, 0x8B, 0x93, 0x90, 0x4A, 0xC4, 0x2E, 0x53, 0xBE, 0x24, 0x9E, 0x6C,
-	0x0B, 0x37, 0x5F, 0x3C, 0xA1, 0x8C, 0x28, 0x37, 0x01, 0x57, 0x29, 0xE7,
-	0xC3, 0xC0, 0x78, 0x01, 0x45, 0x2E, 0xAC, 0xAF, 0x3C, 0xD5, 0x48, 0x48,
-	0x6F, 0x2D, 0x49, 0x1C, 0x31, 0x38, 0x04, 0x2E, 0xD7, 0x81, 0xAB, 0x4D,
-	0x47, 0xBA, 0x75, 0xBC, 0x38, 0x65, 0x5F, 0xC0, 0x29, 0x81, 0x7C, 0x0C,
-	0xE3, 0x2B, 0x48, 0xAF, 0xC0, 0x0E, 0x84, 0x71, 0x66, 0x88, 0x5B, 0xCF,
-	0xE1, 0xD4, 0xF1, 0x4B, 0x6B, 0xF8, 0x98, 0xBD, 0x1E, 0x05, 0xE9, 0x1E,
-	0x7E, 0xB8, 0xF3, 0x4C, 0x37, 0x81, 0xD9, 0xC2, 0x92, 0x0F, 0xA1, 0x46,
-	0x39, 0x6D, 0x60, 0xF3, 0x62, 0xF0, 0x0F, 0x42, 0x68, 0x3D, 0xD3, 0xA1,
-	0xE1, 0x2A, 0x55, 0xDE, 0x14, 0x90, 0x19, 0xE5, 0x33, 0x81, 0xC7, 0x44,
-	0xD1, 0x21, 0xD8, 0x5B, 0x88, 0x0C, 0x5C, 0xF4, 0x85, 0x8B, 0x91, 0x41,
-	0x52, 0xA5, 0xC9, 0xA1, 0x1E, 0x80, 0x1F, 0x29, 0x2D, 0xCA, 0x4B, 0xE1,
-	0xD8, 0x14, 0x50, 0x79, 0xB8, 0x4C, 0x0D, 0xE7, 0xE7, 0x06, 0x79, 0xEF,
-	0xC9, 0x32, 0x0F, 0x2B, 0xC7, 0xE6, 0x17, 0xE1, 0xE5, 0x73, 0xC4, 0xE3,
-	0xB6, 0xC3, 0x9C, 0x84, 0x09, 0xC2, 0xC5, 0x79, 0x20, 0x2C, 0x14, 0x97,
-	0x76, 0x1C, 0x9C, 0xD2, 0x45, 0x70, 0x31, 0xB7, 0xF4, 0xC7, 0x86, 0x38,
-	0xEE, 0xE8, 0x0F, 0x84, 0xD2, 0x28, 0xA9, 0x01, 0xBC, 0xA5, 0x0D, 0x11,
-	0x2B, 0xA9, 0xA9, 0x77, 0x81, 0xF5, 0x51, 0xA9, 0x80, 0xEC, 0x1C, 0xA2,
-	0x4B, 0x90, 0x19, 0x14, 0x1A, 0x28, 0x76, 0x8A, 0xEF, 0xC0, 0xE7, 0x81,
-	0xDA, 0xC0, 0xDE, 0x2A, 0xBD, 0x32, 0x70, 0xF5, 0x02, 0x97, 0xAD, 0x21,
-	0x31, 0x81, 0x4F, 0x1B, 0x4F, 0x7C, 0xAF, 0x4C, 0x5F, 0x84, 0xCD, 0xDA,
-	0xE0, 0x5F, 0x3C, 0xB3, 0x12, 0xFE, 0x30, 0x16, 0xF4, 0x06, 0x3E, 0xA2,
-	0x34, 0xAA, 0xB8, 0xD6, 0x61, 0x23, 0x88, 0x27, 0x9E, 0x6E, 0x0C, 0x6D,
-	0x2E, 0xF4, 0x3C, 0x74, 0x07, 0x43, 0x5B, 0x18, 0xD2, 0xB2, 0x23, 0x09,
-	0xB0, 0x13, 0xE1, 0xA9, 0x12, 0xD2, 0x1A, 0xA2, 0x46, 0xC8, 0x5B, 0x4F,
-	0x5E, 0x43, 0x74, 0x75, 0x26, 0x24, 0x11, 0x3C, 0xF9, 0xC0, 0xA6, 0x51,
-	0x22, 0xA0, 0x5F, 0x5A, 0xF4, 0x6F, 0xCA, 0xA6, 0x80, 0x61, 0x24, 0x5C,
-	0x0B, 0xF4, 0x33, 0xA5, 0x19, 0x2A, 0xF9, 0x0C, 0xF2, 0xEF, 0x0D, 0xEE,
-	0x9D, 0x52, 0x36, 0x50, 0xFE, 0x2D, 0xE0, 0xF7, 0x8E, 0x6C, 0x0D, 0xA9,
-	0x81, 0x78, 0x00, 0x97, 0x23, 0x88, 0x16, 0x70, 0xB8, 0x35, 0xC8, 0x8D,
-	0x90, 0xCE, 0xE0, 0x25, 0x81, 0x8B, 0x83, 0x21, 0x5E, 0x79, 0xCA, 0x65,
-	0x60, 0xEF, 0x02, 0x3B, 0x05, 0x6D, 0x84, 0x47, 0x81, 0xE7, 0x32, 0x90,
-	0x3E, 0x42, 0xF6, 0x45, 0x39, 0x3B, 0x53, 0x4E, 0x73, 0x28, 0x5B, 0xF8,
-	0xBD, 0x06, 0xA9, 0x14, 0x0E, 0x70, 0x51, 0x07, 0xDE, 0x4D, 0x60, 0x9E,
-	0x5A, 0xF6, 0x7D, 0x38, 0x64, 0x81, 0x83, 0x87, 0x72, 0x0A, 0xF9, 0xA5,
-	0x70, 0x9B, 0x0B, 0xB3, 0x7E, 0xCA, 0x38, 0xF1, 0xB4, 0xC6, 0x31, 0x4E,
-	0xA1, 0x8A, 0x03, 0x4D, 0x25, 0x34, 0x4B, 0x38, 0x9C, 0x94, 0xB6, 0x03,
-	0xCE, 0x60, 0x38, 0x84, 0x8B, 0x8B, 0x40, 0x33, 0x55, 0x8A, 0x46, 0x78,
-	0xA8, 0xE1, 0xD3, 0x06, 0x3E, 0x3F, 0x2B, 0xDB, 0x1D, 0x4C, 0x11, 0xC6,
-	0x19, 0x9C, 0x9F, 0x60, 0x77, 0x84, 0x55, 0x50, 0x8A, 0x0C, 0xBA, 0x91,
-	0x50, 0x0C, 0x0C, 0x6B, 0x27, 0x24, 0x55, 0x4C, 0xD4, 0x75, 0xA0, 0x10,
-	0x77, 0xE0, 0x6C, 0xCB, 0x29, 0xF3, 0x1C, 0x0D, 0xAC, 0x3A, 0x98, 0x2B,
-	0x0C, 0x12, 0xB8, 0xEC, 0x41, 0x88, 0x2D, 0xC7, 0x5A, 0x28, 0xBA, 0x8E,
-	0xD2, 0x43, 0x1C, 0x81, 0x11, 0x65, 0x2B, 0x31, 0x9F, 0x4A, 0xC3, 0xE0,
-	0x10, 0xA0, 0x75, 0x10, 0x02, 0x36, 0x28, 0x1A, 0x2B, 0x21, 0x85, 0x7D,
-	0xCF, 0xB2, 0x3C, 0x5A, 0x0E, 0xC1, 0x73, 0x76, 0x80, 0xF7, 0xB5, 0x10,
-	0xE2, 0xC0, 0x29, 0x40, 0x97, 0x43, 0x94, 0xC3, 0xF9, 0x14, 0xFA, 0x3D,
-	0x43, 0xA7, 0x81, 0x7E, 0xA3, 0xCC, 0x26, 0x82, 0xFB, 0xCE, 0x53, 0x94,
-	0x09, 0xBB, 0x7F, 0x85, 0xE5, 0x5F, 0x3B, 0x8E, 0x4B, 0x05, 0x55, 0xDA,
-	0x89, 0xD2, 0x5E, 0x18, 0x34, 0xCD, 0x71, 0x45, 0x43, 0x94, 0x5F, 0x0A,
-	0x13, 0xE7, 0x90, 0xA0, 0x2C, 0x53, 0xA8, 0xA7, 0x42, 0x3B, 0x71, 0x44,
-	0x43, 0x08, 0xC1, 0xF0, 0x3E, 0x55, 0x16, 0x56, 0xE1, 0x20, 0x0C, 0x50,
-	0x7A, 0x03, 0x21, 0x3A, 0x19, 0xD6, 0x8F, 0xF0, 0xD8, 0x38, 0xF6, 0xA5,
-	0x67, 0x6C, 0x80, 0x73, 0x18, 0xCD, 0x84, 0x6C, 0xA6, 0x5C, 0xE7, 0x50,
-	0x4F, 0x84, 0x87, 0x73, 0xF8, 0x79, 0x02, 0xAB, 0xC6, 0xD0, 0xAC, 0x94,
-	0xF8, 0xC5, 0x71, 0xF9, 0xA8, 0xB8, 0x52, 0x88, 0x5A, 0x43, 0x1C, 0x0C,
-	0x1B, 0x55, 0x96, 0xB5, 0xF2, 0x54, 0x7B, 0xF2, 0x23, 0x44, 0x4D, 0xE0,
-	0x62, 0x02, 0x8D, 0x35, 0x1C, 0x17, 0xF0, 0xD0, 0x0B, 0xC4, 0xC0, 0xEC,
-	0xC1, 0x32, 0xAB, 0x3D, 0xF3, 0xFB, 0x88, 0xAC, 0x14, 0x9E, 0xFA, 0x8E,
-	0xD3, 0x54, 0xA9, 0xC7, 0xE0, 0xA7, 0x82, 0xCC, 0x5F, 0x03, 0x9B, 0x4F,
-	0x3B, 0x1A, 0xF5, 0xD8, 0x20, 0x44, 0xE1, 0x35, 0xB3, 0x84, 0xB5, 0x92,
-	0x14, 0xD0, 0xB3, 0x90, 0x4C, 0xC1, 0x9E, 0x43, 0x1A, 0x29, 0xA7, 0x52,
-	0x38, 0x3E, 0x19, 0x1E, 0x76, 0xCA, 0xFA, 0x05, 0x5E, 0x56, 0xC2, 0x46,
-	0x3D, 0xD1, 0x4C, 0x38, 0x9F, 0x04, 0x6E, 0x67, 0x70, 0x31, 0xB0, 0x04,
-	0x23, 0xDC, 0x7B, 0xC7, 0x5E, 0xC0, 0xC5, 0xD0, 0x8F, 0x3D, 0x89, 0x89,
-	0x89, 0xAA, 0xC0, 0xF1, 0x20, 0xD8, 0x5A, 0x19, 0x64, 0xA0, 0x53, 0x43,
-	0x37, 0x86, 0xC7, 0x54, 0x29, 0x62, 0xA1, 0x45, 0x79, 0xEB, 0xE1, 0xBA,
-	0x10, 0x76, 0x07, 0x58, 0x9D, 0x02, 0xED, 0x41, 0xB0, 0x0A, 0xC3, 0xA1,
-	0xC2, 0x00, 0xF6, 0xB9, 0xB2, 0x0D, 0xC2, 0x7A, 0xAF, 0x9C, 0x36, 0x4A,
-	0xB9, 0x81, 0x44, 0x94, 0xAB, 0x0F, 0xD0, 0x7C, 0x0F, 0xCD, 0x20, 0xF0,
-	0x31, 0x52, 0xC6, 0x07, 0x18, 0x1C, 0xE1, 0x3C, 0x0F, 0x5C, 0xF7, 0xA1,
-	0x18, 0x81, 0x99, 0x18, 0xBA, 0x81, 0x92, 0xC7, 0x50, 0x9D, 0x2C, 0xC5,
-	0x3A, 0x30, 0xE8, 0x84, 0xDB, 0xEB, 0x88, 0xD1, 0xCC, 0x73, 0xEF, 0x3B,
-	0xEE, 0x37, 0x96, 0xF5, 0x27, 0x43, 0xBE, 0x17, 0x6E, 0xE6, 0x9E, 0xF7,
-	0x63, 0xE8, 0xBF, 0x15, 0x96, 0xB9, 0xA7, 0x3C, 0x29, 0x51, 0x9C, 0x43,
-	0xDF, 0x0B, 0x51, 0xA4, 0x38, 0x35, 0x3C, 0xAA, 0xA1, 0xEA, 0x3B, 0xE6,
-	0x6F, 0xE1, 0xDB, 0xA3, 0xD2, 0x03, 0xEC, 0xE9, 0x75, 0x2D, 0x9B, 0x04,
-	0x8F, 0xCD, 0x15, 0xF9, 0xE8, 0x39, 0x7A, 0x21, 0xC2, 0x63, 0x87, 0x20,
-	0xDF, 0x19, 0x9A, 0x2B, 0x83, 0x3B, 0x87, 0x5E, 0x5F, 0x59, 0x74, 0x4A,
-	0x63, 0x84, 0xD2, 0x18, 0x7C, 0xD5, 0xF1, 0xB8, 0xF6, 0x9C, 0xBE, 0xC0,
-	0xF9, 0x56, 0x18, 0xBB, 0x88, 0x24, 0x0E, 0x0C, 0x02, 0x24, 0xAD, 0x22,
-	0x65, 0xA0, 0x3E, 0x28, 0x9B, 0x16, 0x2E, 0x05, 0x86, 0x09, 0x5C, 0x1B,
-	0x83, 0x10, 0xF1, 0x35, 0xF6, 0x3C, 0x5F, 0x40, 0x17, 0xC3, 0x38, 0x52,
-	0xCC, 0x1A, 0x70, 0x81, 0x7D, 0x05, 0xFB, 0xF0, 0x7A, 0x8E, 0x96, 0x06,
-	0x92, 0x91, 0x32, 0x0E, 0xD0, 0xEF, 0xA0, 0x76, 0x8E, 0xC2, 0x43, 0xDF,
-	0x29, 0xBE, 0x14, 0x4E, 0x07, 0xC3, 0xA9, 0x0D, 0x4C, 0x2D, 0x4C, 0x27,
-	0x31, 0xFB, 0x99, 0x52, 0x7A, 0xCF, 0x6E, 0x09, 0xCD, 0x57, 0x28, 0x56,
-	0xC2, 0x73, 0xF7, 0x3A, 0x8D, 0x24, 0xF1, 0x5C, 0x7D, 0x63, 0x99, 0x2C,
-	0x84, 0x77, 0x63, 0xB8, 0x18, 0x78, 0x12, 0x89, 0x88, 0xD6, 0x42, 0xFB,
-	0xE2, 0xD8, 0x15, 0xE0, 0x2A, 0x61, 0xDD, 0x06, 0xB2, 0xA4, 0x43, 0x34,
-	0xE0, 0x22, 0xB8, 0x34, 0xC2, 0x42, 0x80, 0x58, 0x29, 0x07, 0x16, 0x7A,
-	0x4A, 0x61, 0x95, 0xD8, 0xC3, 0x9B, 0x25, 0x9C, 0x9E, 0x94, 0xED, 0xD6,
-	0xB1, 0xDB, 0x19, 0x38, 0x0A, 0xD7, 0x22, 0x64, 0xFD, 0xC0, 0x69, 0xAA,
-	0xC8, 0xD0, 0xE1, 0x6D, 0xE0, 0xB9, 0x86, 0x6A, 0x07, 0x75, 0x01, 0xF3,
-	0x05, 0x8C, 0x06, 0xB0, 0x9D, 0x0B, 0x55, 0xA6, 0xEC, 0x8E, 0xCA, 0xF3,
-	0x5C, 0xD8, 0xF7, 0x94, 0xC5, 0x4C, 0xC8, 0x16, 0x96, 0x59, 0xE6, 0xD9,
-	0x8A, 0x61, 0x7D, 0x34, 0x6C, 0x4B, 0xCF, 0xA9, 0x72, 0x94, 0x25, 0xDC,
-	0x9A, 0x88, 0xB3, 0x07, 0x47, 0x7A, 0x14, 0x9E, 0x5A, 0xE5, 0xD3, 0x7D,
-	0x4B, 0x07, 0xBC, 0xFD, 0x20, 0xFC, 0xC7, 0x77, 0xC2, 0x4F, 0x0B, 0xCB,
-	0xA6, 0x54, 0xBE, 0x1E, 0x1B, 0x9A, 0x54, 0x88, 0xF0, 0x16, 0x35, 0x82,
-	0x1E, 0x5B, 0x5C, 0xA1, 0x1C, 0x6B, 0x4F, 0xA3, 0xD0, 0x9B, 0x58, 0x42,
-	0x1E, 0x71, 0x3C, 0x3A, 0x9E, 0x1B, 0xCF, 0xBC, 0xEF, 0xB9, 0xEE, 0x83,
-	0xB5, 0x11, 0x87, 0xA3, 0x12, 0x55, 0x9E, 0xF3, 0x3E, 0x5C, 0x7D, 0x80,
-	0xE9, 0x1F, 0x61, 0x7D, 0x13, 0x90, 0x5C, 0x19, 0xA9, 0x61, 0xD6, 0x18,
-	0xD8, 0x7A, 0x4E, 0x85, 0x42, 0x01, 0x61, 0x09, 0x3C, 0x83, 0xD9, 0x0B,
-	0x3A, 0x10, 0x48, 0x0D, 0x5E, 0x3C, 0xBE, 0x51, 0x46, 0x7B, 0x18, 0x54,
-	0xE0, 0x52, 0xE1, 0x84, 0x90, 0x67, 0x81, 0x51, 0xA5, 0x9C, 0xF6, 0x8E,
-	0x53, 0x0E, 0xDD, 0x00, 0xB6, 0xE7, 0x86, 0x63, 0x14, 0x28, 0x67, 0xB0,
-	0x6F, 0xE1, 0xD4, 0xC1, 0x93, 0x03, 0xA7, 0x30, 0xEC, 0x84, 0x61, 0xB0,
-	0x9C, 0x87, 0xC0, 0xB0, 0x0D, 0x34, 0x4E, 0xA8, 0x3B, 0x30, 0x0E, 0x8E,
-	0x87, 0x88, 0x62, 0xE9, 0x68, 0x3B, 0xE8, 0xE5, 0xCA, 0x2C, 0x15, 0x9C,
-	0x1A, 0x8A, 0xD2, 0x71, 0x78, 0x06, 0xBF, 0x54, 0xBC, 0x83, 0xAC, 0x2F,
-	0xDC, 0x4E, 0x94, 0xFE, 0xD8, 0x92, 0xCE, 0x0C, 0x66, 0xE8, 0x18, 0xC5,
-	0x96, 0x04, 0xA8, 0x36, 0x8E, 0xF5, 0x32, 0xB0, 0xBD, 0x87, 0xBA, 0x15,
-	0x7A, 0x5E, 0xC9, 0x33, 0x70, 0x71, 0xA0, 0xC9, 0xC1, 0x58, 0x68, 0x12,
-	0x08, 0x27, 0xC3, 0x7C, 0xEB, 0x39, 0xE1, 0x78, 0x99, 0x29, 0x6D, 0x4F,
-	0x30, 0xE7, 0x86, 0x4D, 0xA4, 0x1C, 0x9E, 0x95, 0x72, 0x0B, 0x76, 0x1F,
-	0xE8, 0x97, 0x30, 0x4B, 0x0D, 0x99, 0x81, 0x9D, 0x05, 0xAD, 0xC1, 0xD6,
-	0x81, 0x50, 0x47, 0xD8, 0xD6, 0x32, 0x4A, 0x1C, 0x69, 0xA6, 0x84, 0x81,
-	0xD0, 0xEF, 0xC1, 0x5D, 0xAE, 0xEC, 0xA7, 0xE0, 0x5A, 0x30, 0x02, 0x61,
-	0x06, 0xCB, 0x24, 0xF0, 0xE5, 0x59, 0xD8, 0xDE, 0x2B, 0xC7, 0x5D, 0x47,
-	0x87, 0x12, 0xFA, 0x90, 0x66, 0x82, 0xB5, 0x8E, 0xB2, 0x80, 0xE2, 0x23,
-	0x2C, 0x7D, 0xA0, 0x1A, 0x40, 0xF2, 0x1F, 0xE1, 0xED, 0xB7, 0x86, 0x37,
-	0x23, 0x98, 0x3F, 0x78, 0xF6, 0x7F, 0x56, 0xA2, 0x3D, 0x0C, 0xCE, 0x62,
-	0x22, 0xBB, 0xF6, 0x74, 0x09, 0x34, 0x1B, 0xE5, 0xF8, 0x04, 0x65, 0x07,
-	0xD9, 0x18, 0x24, 0x01, 0x51, 0x4F, 0x3D, 0x7C, 0x1D, 0xB3, 0xE3, 0x14,
-	0xE6, 0x13, 0x08, 0x79, 0x60, 0x7F, 0xB2, 0x0C, 0x1A, 0xE5, 0x0F, 0x8B,
-	0xC0, 0xFC, 0x5B, 0x43, 0xF1, 0x56, 0xF8, 0x9A, 0x1B, 0xF6, 0x4D, 0xE0,
-	0xA6, 0xF2, 0x34, 0x47, 0xF0, 0x2B, 0x38, 0x2E, 0xC1, 0x1C, 0x2D, 0xC3,
-	0xC6, 0xBF, 0x4E, 0x92, 0x38, 0x70, 0x6C, 0x95, 0xC7, 0x95, 0xE5, 0xF1,
-	0xC0, 0xEB, 0x43, 0xB4, 0x30, 0x4E, 0x20, 0x19, 0xC1, 0x4E, 0x0D, 0x6D,
-	0x19, 0xE8, 0x15, 0x4A, 0x86, 0x72, 0x33, 0x16, 0xE2, 0x16, 0xDA, 0xD8,
-	0x60, 0x87, 0x10, 0x0F, 0xC1, 0xC5, 0x42, 0x51, 0x41, 0xF3, 0x22, 0xE4,
-	0x4E, 0x39, 0x3B, 0x17, 0xCE, 0x2F, 0x21, 0x9F, 0x41, 0x53, 0x45, 0xF8,
-	0xBD, 0x47, 0x5B, 0xA5, 0xF3, 0x31, 0x9B, 0x4E, 0xD8, 0xD7, 0x8A, 0x29,
-	0x41, 0x4B, 0x88, 0x5D, 0x47, 0x34, 0x10, 0xD4, 0x82, 0x26, 0xA0, 0x17,
-	0x31, 0x36, 0x55, 0xCE, 0x52, 0xE1, 0x22, 0x8B, 0x59, 0xC4, 0x9E, 0x52,
-	0x5A, 0x1E, 0x55, 0xD1, 0x10, 0x28, 0x5B, 0xC3, 0xF3, 0x36, 0xB0, 0x5C,
-	0x2A, 0x6D, 0x29, 0xF4, 0xA7, 0xCA, 0xC5, 0x85, 0x30, 0x1C, 0x5A, 0x88,
-	0x02, 0xDE, 0xC5, 0x38, 0xE7, 0x59, 0xB9, 0x40, 0x5C, 0x18, 0x7A, 0x07,
-	0xCF, 0x87, 0x7B, 0xC5, 0xDE, 0xC0, 0xE5, 0xB5, 0xB0, 0x5A, 0x08, 0xEE,
-	0x0D, 0x94, 0xA3, 0x84, 0xA3, 0x40, 0x2F, 0x34, 0xBC, 0x3F, 0xC2, 0x9B,
-	0x7E, 0xC0, 0x4F, 0x2D, 0x55, 0xA6, 0x6C, 0xF6, 0x01, 0x29, 0x61, 0x78,
-	0x80, 0x99, 0x37, 0xF4, 0xD4, 0xA0, 0x3B, 0x8F, 0xDF, 0xC2, 0xB0, 0x34,
-	0xBC, 0xE4, 0x9E, 0xB2, 0x6F, 0x61, 0xA0, 0xB8, 0x3A, 0xB0, 0x3F, 0x28,
-	0xFF, 0x52, 0x2A, 0xBF, 0x7C, 0x85, 0xB0, 0xB2, 0x4C, 0x52, 0xE8, 0x4F,
-	0x05, 0x37, 0x30, 0x54, 0xB1, 0x52, 0x16, 0x81, 0xC7, 0x0D, 0x0C, 0x0A,
-	0x65, 0x38, 0x82, 0xDB, 0xF7, 0x16, 0xFD, 0xA3, 0x90, 0x5E, 0x28, 0x55,
-	0x61, 0x58, 0x15, 0x9E, 0xDD, 0x23, 0xB4, 0x5B, 0x43, 0xE2, 0x3D, 0x51,
-	0xBF, 0xF0, 0x34, 0x09, 0xC4, 0x6B, 0xC1, 0x3E, 0x0B, 0x71, 0xAB, 0x0C,
-	0xBD, 0x32, 0xBC, 0xF4, 0x4C, 0xA7, 0x30, 0xBD, 0x12, 0xF2, 0x33, 0xCB,
-	0x7C, 0x00, 0x6A, 0x3C, 0x75, 0x13, 0x28, 0x4E, 0x90, 0xE4, 0x81, 0xEF,
-	0xE6, 0x30, 0xBB, 0x52, 0x7E, 0x4B, 0x12, 0x3E, 0x6D, 0x2C, 0x87, 0x55,
-	0x4D, 0x7F, 0x63, 0x39, 0xAD, 0x3D, 0xD5, 0x12, 0x4E, 0x5B, 0xE8, 0x37,
-	0xC2, 0xFB, 0x41, 0x84, 0xC9, 0x3D, 0xCD, 0x19, 0x2C, 0x0F, 0xCA, 0xFD,
-	0xB3, 0x63, 0xBD, 0x01, 0xEA, 0x88, 0x99, 0x28, 0x37, 0x7D, 0xA5, 0x3F,
-	0x0B, 0x1C, 0x86, 0x81, 0x87, 0x22, 0x22, 0xDD, 0x3A, 0x7E, 0x42, 0xB8,
-	0x70, 0x60, 0x37, 0x70, 0x30, 0x1E, 0x1D, 0x2A, 0xF1, 0x99, 0xA5, 0x8C,
-	0x85, 0x95, 0x09, 0x54, 0x5E, 0x39, 0x4F, 0x22, 0xDE, 0x5D, 0x38, 0x46,
-	0x8B, 0xC0, 0x73, 0x24, 0xEC, 0xF6, 0x40, 0x01, 0xB6, 0x06, 0x55, 0x4F,
-	0xEB, 0x05, 0x67, 0xA0, 0x9F, 0x09, 0x69, 0x6C, 0xB0, 0x26, 0x90, 0x65,
-	0x81, 0xF1, 0x14, 0xB6, 0x13, 0x28, 0x3A, 0xC5, 0xAC, 0x60, 0xBE, 0x0A,
-	0x8C, 0xD6, 0x1D, 0xE3, 0xD8, 0x23, 0x3D, 0x65, 0x3E, 0x05, 0x1D, 0x05,
-	0x9E, 0x15, 0xEE, 0x14, 0xCA, 0x0C, 0xCE, 0x2E, 0x94, 0xFC, 0x9D, 0x30,
-	0xBC, 0x15, 0xDA, 0x36, 0x70, 0x58, 0xC6, 0x14, 0xCF, 0x20, 0x9B, 0x80,
-	0x6F, 0x95, 0x6D, 0x70, 0xB4, 0x22, 0x64, 0x46, 0x79, 0x7F, 0x30, 0xCC,
-	0x02, 0x3C, 0xD7, 0xCA, 0x66, 0xAE, 0xFC, 0x1E, 0x41, 0x77, 0x0D, 0x59,
-	0x06, 0x6F, 0x1A, 0x78, 0x3F, 0x80, 0xC3, 0xB9, 0xB0, 0x4A, 0x94, 0xC7,
-	0x7B, 0xF0, 0x02, 0xDE, 0x39, 0x66, 0x07, 0x4F, 0xE3, 0x0D, 0x14, 0x90,
-	0x7E, 0x52, 0x06, 0x3D, 0x65, 0xD9, 0x42, 0x97, 0x58, 0xBC, 0x37, 0x94,
-	0xAB, 0x1A, 0xB7, 0x82, 0xBB, 0x13, 0x6C, 0x3B, 0xB8, 0x18, 0x07, 0xE6,
-	0x63, 0x43, 0xE8, 0x07, 0xD6, 0xAD, 0x52, 0xEC, 0x02, 0xE1, 0x08, 0x13,
-	0x0B, 0xF9, 0x0D, 0xFC, 0x34, 0x4B, 0x18, 0x5F, 0x59, 0xEE, 0xE3, 0x86,
-	0x2F, 0x7B, 0xE8, 0xBF, 0x78, 0xDE, 0x6E, 0x84, 0xA5, 0x17, 0x36, 0x36,
-	0x70, 0xD5, 0x08, 0x51, 0x5B, 0xBC, 0x06, 0x1B, 0x09, 0x30, 0x4F, 0x95,
-	0xF3, 0xDC, 0x72, 0x7B, 0xE9, 0xF9, 0xFE, 0x7B, 0xE5, 0xDD, 0x7B, 0xC3,
-	0x74, 0x61, 0x89, 0x73, 0xC1, 0xC4, 0x81, 0x65, 0x99, 0xB1, 0x7D, 0xEA,
-	0x08, 0xE2, 0x79, 0x27, 0x96, 0x6F, 0x55, 0x69, 0x6B, 0x83, 0xDF, 0x7B,
-	0xDC, 0x43, 0x43, 0xF5, 0xA8, 0x14, 0x77, 0x31, 0xF5, 0x32, 0xF0, 0x58,
-	0x2A, 0x52, 0x2B, 0x17, 0x1A, 0x38, 0xAF, 0x85, 0x70, 0x1D, 0x51, 0xF7,
-	0x03, 0xBB, 0x58, 0x38, 0x75, 0x01, 0xEF, 0x03, 0xD6, 0x3A, 0x72, 0x31,
-	0x8C, 0x86, 0x10, 0x25, 0xF0, 0x9C, 0x0B, 0xCB, 0x31, 0x0C, 0x3E, 0xC0,
-	0xA9, 0x15, 0x4E, 0x3B, 0xC5, 0x6D, 0x84, 0x34, 0x28, 0x31, 0xAF, 0x60,
-	0xA3, 0xE1, 0x35, 0xBC, 0x60, 0x60, 0xD1, 0x0F, 0x2C, 0x8C, 0xA5, 0xDB,
-	0x04, 0xB6, 0x8D, 0xF2, 0x65, 0xE5, 0xA0, 0x80, 0x4B, 0x85, 0xA9, 0x03,
-	0x4D, 0x3C, 0x83, 0xB3, 0xD7, 0xC0, 0x15, 0xE5, 0xD0, 0xB7, 0x42, 0x9A,
-	0x0B, 0x5D, 0x16, 0xF1, 0x68, 0x03, 0x5F, 0x2A, 0x87, 0xDE, 0xC3, 0x4F,
-	0x4F, 0xF0, 0x56, 0x3D, 0x61, 0xF0, 0xDA, 0x87, 0x5C, 0xB6, 0xC2, 0xA6,
-	0x13, 0x9E, 0x45, 0xD9, 0x26, 0x8A, 0xBD, 0x82, 0xDB, 0x44, 0x38, 0x5F,
-	0xC4, 0x6C, 0x4C, 0xC7, 0x9F, 0x83, 0xB2, 0xDF, 0x79, 0x4E, 0x5F, 0x5F,
-	0xD7, 0xE6, 0x71, 0x0C, 0xB3, 0x6B, 0x43, 0x76, 0x65, 0xF0, 0xB9, 0xD0,
-	0xEC, 0x02, 0xC7, 0x95, 0x23, 0xBA, 0x13, 0xE2, 0x21, 0x44, 0x93, 0x86,
-	0xE1, 0x14, 0x86, 0x0B, 0x98, 0xE6, 0xC2, 0x79, 0x2E, 0xC4, 0xC3, 0x40,
-	0x2F, 0x06, 0x23, 0x82, 0x75, 0x40, 0x66, 0xA8, 0x37, 0x01, 0x29, 0x3C,
-	0x79, 0x03, 0x93, 0x8D, 0x10, 0xFF, 0x22, 0x4C, 0x2A, 0x48, 0x47, 0x8E,
-	0xA3, 0x0A, 0xAB, 0x0D, 0x44, 0x6B, 0x28, 0xBD, 0xD0, 0x1B, 0x29, 0xD3,
-	0x89, 0x21, 0xCF, 0x0C, 0x0F, 0x8D, 0xE7, 0xA5, 0x50, 0x50, 0x98, 0x8E,
-	0x5E, 0xE1, 0xD2, 0x2C, 0x11, 0xA2, 0x36, 0x10, 0x2F, 0x3B, 0xD6, 0xB5,
-	0xF2, 0x5B, 0x04, 0xCD, 0x11, 0xF6, 0x9D, 0xD0, 0x0E, 0x84, 0xCE, 0x80,
-	0x8B, 0x0C, 0xD1, 0x61, 0x0B, 0x2F, 0x56, 0x08, 0x29, 0x7C, 0xF3, 0xAD,
-	0x72, 0xF9, 0x26, 0x70, 0xF3, 0xAD, 0x72, 0xF1, 0x16, 0x06, 0x33, 0xC5,
-	0x5A, 0x4F, 0xD7, 0x28, 0xFB, 0x3D, 0x3C, 0x6F, 0xA0, 0x7C, 0x09, 0x9C,
-	0xAF, 0x61, 0x88, 0x25, 0x4A, 0x02, 0x92, 0x01, 0x75, 0xA0, 0xDD, 0x29,
-	0x7E, 0x0F, 0xBB, 0x7D, 0x47, 0xD6, 0xC0, 0xC1, 0x08, 0x3E, 0x16, 0xFA,
-	0xAA, 0x5C, 0x1E, 0x02, 0x03, 0xA3, 0x34, 0x71, 0xA0, 0x5E, 0x08, 0xCD,
-	0x1B, 0x21, 0xEB, 0x45, 0xE4, 0x07, 0x4F, 0x92, 0x08, 0x92, 0x2B, 0xC1,
-	0x09, 0xDA, 0x04, 0xF2, 0x5C, 0x19, 0xCE, 0xA0, 0x22, 0xA2, 0x12, 0xC7,
-	0xEE, 0x14, 0x38, 0x39, 0x38, 0x37, 0x30, 0xD8, 0xBE, 0x72, 0x09, 0x1C,
-	0xA4, 0x29, 0x44, 0x9D, 0xA1, 0x5A, 0x47, 0xEC, 0xCA, 0x96, 0x97, 0x93,
-	0xB2, 0x73, 0x16, 0x97, 0x06, 0xA2, 0x5C, 0x49, 0xC7, 0x81, 0xC9, 0x10,
-	0xF2, 0x05, 0xD8, 0x21, 0xB4, 0x06, 0x42, 0x27, 0xD8, 0x22, 0xB0, 0xDF,
-	0x04, 0xEE, 0x56, 0x96, 0x4F, 0xEB, 0x40, 0x7A, 0x0C, 0xBC, 0x9D, 0x80,
-	0xC9, 0x85, 0xBC, 0x67, 0xE8, 0xE5, 0x86, 0xDA, 0x1B, 0x76, 0xEB, 0x80,
-	0x0B, 0x8A, 0x4F, 0x3D, 0xC3, 0x33, 0x18, 0x1B, 0x83, 0x34, 0x81, 0xEE,
-	0x19, 0xCA, 0x02, 0x76, 0x6B, 0x8F, 0x6D, 0x21, 0x9B, 0xC0, 0x9B, 0xB9,
-	0xE5, 0x8F, 0x6F, 0x95, 0xE4, 0x1A, 0xEE, 0x44, 0xF8, 0xCD, 0x05, 0xF6,
-	0x5F, 0x60, 0xFE, 0x59, 0xC9, 0x14, 0xE6, 0x37, 0x86, 0xF3, 0x6F, 0x03,
-	0xE7, 0x3D, 0x21, 0xED, 0x47, 0xE0, 0x95, 0xE4, 0xC9, 0x13, 0x23, 0xD8,
-	0x44, 0x69, 0x6F, 0x12, 0x76, 0x43, 0x4B, 0xBE, 0xAC, 0x19, 0xAC, 0xC1,
-	0x76, 0x50, 0x47, 0x8A, 0xC5, 0xA3, 0xF7, 0xE0, 0x97, 0xAF, 0x40, 0xED,
-	0x53, 0x2B, 0x88, 0x87, 0xB6, 0x35, 0x8C, 0x4E, 0x9E, 0xA4, 0x54, 0x0E,
-	0xAD, 0xB2, 0x53, 0x30, 0x3D, 0xB8, 0xBE, 0x84, 0x1F, 0x26, 0xC2, 0x44,
-	0x94, 0xD3, 0xDA, 0xD2, 0x7F, 0x76, 0x8C, 0x6A, 0x65, 0x3A, 0x00, 0xD3,
-	0x33, 0x7C, 0x8E, 0x03, 0x85, 0x28, 0xFD, 0xD4, 0x73, 0xD3, 0x40, 0x1B,
-	0x94, 0xE8, 0xD8, 0x33, 0xFC, 0x9A, 0x2B, 0xED, 0xC2, 0xF0, 0xE6, 0x5B,
-	0xCF, 0x8F, 0x7F, 0x32, 0x9C, 0xDD, 0x28, 0x6A, 0x85, 0xAA, 0x0D, 0xB4,
-	0x41, 0xA8, 0x6A, 0xCB, 0x6A, 0x1B, 0x78, 0x7C, 0x70, 0xC8, 0x17, 0xE8,
-	0xAF, 0xE0, 0xA5, 0xE8, 0x48, 0x6A, 0x45, 0x5A, 0xE1, 0x58, 0x0B, 0x9C,
-	0x5E, 0x29, 0x95, 0x19, 0x5A, 0xBA, 0x71, 0x44, 0x3B, 0x69, 0x29, 0xFA,
-	0x42, 0xAF, 0x55, 0xBE, 0x7B, 0x80, 0xB3, 0x75, 0xA0, 0xCE, 0x85, 0x4D,
-	0x0F, 0xE2, 0x2C, 0x90, 0x0E, 0x84, 0x79, 0x5F, 0x39, 0x1F, 0x42, 0x82,
-	0xE1, 0xB0, 0xF2, 0xC8, 0x16, 0xAE, 0x0A, 0x98, 0x17, 0x10, 0x0F, 0x1D,
-	0x4F, 0xA2, 0x7C, 0xBD, 0xB4, 0x24, 0x3D, 0xE5, 0x4A, 0x05, 0xB7, 0x55,
-	0xDA, 0xB5, 0x12, 0x9F, 0x0C, 0x36, 0x12, 0x8A, 0xD2, 0x53, 0x36, 0x81,
-	0x6D, 0x17, 0x28, 0x2D, 0xC8, 0x40, 0x89, 0x46, 0x42, 0x98, 0x58, 0xCC,
-	0x3C, 0x70, 0x35, 0x14, 0x5C, 0x2E, 0x3C, 0xD6, 0xF0, 0xB4, 0x57, 0x74,
-	0x1F, 0x60, 0xA9, 0xDC, 0x2D, 0x1D, 0xE5, 0xC6, 0x93, 0x66, 0x96, 0xF9,
-	0xAD, 0x30, 0x78, 0xEB, 0xC9, 0x33, 0xCB, 0xA0, 0xB2, 0xE8, 0xCE, 0xD3,
-	0xAE, 0x1D, 0x52, 0x06, 0xF2, 0x5E, 0x4C, 0x7C, 0x69, 0x60, 0xD4, 0x52,
-	0x77, 0x9E, 0xE2, 0x09, 0x1E, 0x9F, 0xC1, 0xB7, 0xD0, 0x17, 0x98, 0xBD,
-	0x81, 0x77, 0x0B, 0xE1, 0x9B, 0xA9, 0x30, 0xCF, 0x02, 0xDB, 0x5A, 0xF9,
-	0x6D, 0xD3, 0xF2, 0xFF, 0x1C, 0x94, 0xE0, 0xE1, 0xFB, 0x1E, 0xBC, 0x4B,
-	0x85, 0x6F, 0x26, 0x42, 0x6F, 0x0C, 0x36, 0xB7, 0x48, 0x2B, 0x14, 0xCB,
-	0x8E, 0xEA, 0x45, 0xE8, 0x5A, 0x85, 0x29, 0x1C, 0x17, 0x8E, 0xC7, 0x24,
-	0xD0, 0xCD, 0x5F, 0x73, 0xCF, 0x20, 0x87, 0x5A, 0x2C, 0x2F, 0x9B, 0x40,
-	0xFD, 0x35, 0x10, 0x36, 0xB0, 0x8F, 0xC1, 0x05, 0x90, 0x12, 0x12, 0xF5,
-	0x4C, 0x03, 0x98, 0x00, 0x87, 0x71, 0xC0, 0xCC, 0xE0, 0xF6, 0xC6, 0xF0,
-	0xE3, 0x8D, 0xB0, 0x18, 0x0A, 0x45, 0xE9, 0xD8, 0x96, 0x1D, 0xD5, 0x5C,
-	0x48, 0x2B, 0xA1, 0x5F, 0x42, 0x56, 0x0A, 0xA5, 0x11, 0xF2, 0xA3, 0xB0,
-	0x08, 0x81, 0x51, 0x4F, 0xC8, 0x51, 0xA2, 0xEA, 0x3B, 0x43, 0x31, 0x76,
-	0x44, 0xEF, 0x94, 0xD9, 0x4F, 0x11, 0xE9, 0x9B, 0xC0, 0xD1, 0x19, 0x8A,
-	0x2F, 0xD0, 0x1E, 0x21, 0xEE, 0x94, 0x62, 0x1B, 0x78, 0x7E, 0x34, 0x3C,
-	0x7D, 0x09, 0x8C, 0x97, 0xD0, 0x1E, 0x0D, 0xCB, 0xF6, 0x95, 0x73, 0xB3,
-	0x52, 0x8E, 0x2B, 0xA5, 0x5F, 0x41, 0x34, 0x7E, 0x1D, 0xB3, 0xDD, 0x08,
-	0x64, 0xA2, 0x70, 0xEE, 0x39, 0x28, 0xEC, 0x13, 0x90, 0x67, 0x43, 0x72,
-	0x52, 0xA2, 0x67, 0x43, 0xD4, 0xF7, 0x64, 0x63, 0xCF, 0x7C, 0x0C, 0xE7,
-	0x43, 0x21, 0x2A, 0x03, 0xAB, 0xA5, 0x72, 0x3A, 0xC2, 0x45, 0x6D, 0x78,
-	0xBF, 0x33, 0xB4, 0xC3, 0xC0, 0xCB, 0x54, 0x90, 0xB3, 0x80, 0x99, 0x0B,
-	0xA5, 0x46, 0xB8, 0xB6, 0xA3, 0x16, 0xE8, 0xD7, 0x8A, 0xC4, 0xB0, 0x8F,
-	0x95, 0x26, 0x55, 0x5C, 0x1F, 0x52, 0x2B, 0xF4, 0x7B, 0x8A, 0x0E, 0x0D,
-	0xFD, 0xA1, 0x21, 0x4B, 0x85, 0xD0, 0x2A, 0x6E, 0x0D, 0xC5, 0x32, 0xF0,
-	0xB4, 0x85, 0x8F, 0x9D, 0x62, 0x5B, 0x18, 0x14, 0xF0, 0x8D, 0x55, 0xAA,
-	0x39, 0x0C, 0xDE, 0x47, 0x2C, 0x6E, 0x03, 0xD6, 0x78, 0xAA, 0x67, 0x4F,
-	0xF7, 0xAC, 0x54, 0x7B, 0xB0, 0x47, 0x18, 0xFB, 0x40, 0x39, 0x35, 0xB4,
-	0x8D, 0xF0, 0xE4, 0x95, 0xA6, 0x83, 0x4D, 0x06, 0x7E, 0x0C, 0x67, 0xB1,
-	0xE5, 0x7D, 0x4F, 0xF9, 0xA6, 0x6F, 0x38, 0x13, 0xA5, 0xDA, 0xC1, 0xE3,
-	0x4B, 0x60, 0xBD, 0x51, 0x0E, 0x01, 0xBA, 0x39, 0x94, 0x37, 0x86, 0x78,
-	0xAC, 0x7C, 0xE8, 0x7B, 0xEC, 0x18, 0xB6, 0x69, 0x40, 0x5A, 0x4F, 0xDB,
-	0xC2, 0xE1, 0x60, 0xD8, 0x6D, 0x3C, 0xE5, 0x23, 0x94, 0xE7, 0x60, 0xCE,
-	0x1D, 0x93, 0x09, 0xC4, 0xD7, 0x86, 0x38, 0x83, 0xB2, 0x8C, 0xF8, 0xD2,
-	0x3A, 0x5E, 0x46, 0x01, 0x71, 0xE0, 0x4B, 0x38, 0x9D, 0x94, 0xF8, 0x64,
-	0x11, 0xFB, 0x8A, 0x9B, 0x73, 0x0B, 0x59, 0x0C, 0xFD, 0x21, 0x4C, 0x6B,
-	0xB8, 0x3A, 0xBC, 0x02, 0xA6, 0x4D, 0xCF, 0xE2, 0xDF, 0x28, 0xED, 0x79,
-	0x4C, 0xBD, 0xF1, 0x1C, 0xFF, 0xC5, 0x91, 0x3C, 0x7A, 0xDE, 0x07, 0x18,
-	0xF7, 0x95, 0x6F, 0xC7, 0x70, 0x33, 0x34, 0x88, 0x40, 0x14, 0xBF, 0x71,
-	0x2C, 0x2E, 0x0D, 0xF9, 0xB7, 0x11, 0xB3, 0xB7, 0x86, 0x4E, 0x1B, 0xBE,
-	0xFE, 0x0E, 0xCB, 0xBF, 0xC0, 0x7C, 0x03, 0xB7, 0x4E, 0x89, 0x3A, 0xA5,
-	0x3C, 0x06, 0xF6, 0x7B, 0x58, 0xD4, 0x30, 0xCD, 0x94, 0xE6, 0xD2, 0xF0,
-	0x39, 0x18, 0x8A, 0x7E, 0x20, 0x51, 0x61, 0x68, 0x95, 0x9B, 0x54, 0x48,
-	0x82, 0x63, 0xDD, 0x38, 0xE6, 0xA5, 0x60, 0xBD, 0x62, 0x26, 0x96, 0x32,
-	0xF1, 0x6C, 0x7B, 0x82, 0x5D, 0x09, 0x75, 0xE9, 0xE9, 0xC7, 0x30, 0xCC,
-	0x84, 0xF1, 0xF0, 0x95, 0x86, 0xED, 0x0A, 0xD8, 0x9D, 0xC0, 0xE4, 0x90,
-	0x65, 0xCA, 0x24, 0x38, 0x42, 0x23, 0x9C, 0x6D, 0x84, 0x83, 0x2A, 0x9D,
-	0x83, 0x97, 0xC4, 0xC1, 0x29, 0x90, 0x02, 0xB3, 0x44, 0x49, 0x73, 0xA5,
-	0xED, 0x1B, 0x42, 0x2A, 0x78, 0x09, 0x58, 0x85, 0x4C, 0x84, 0xD0, 0x06,
-	0xA2, 0x43, 0xC0, 0x1F, 0xE0, 0xE5, 0x04, 0xBB, 0xBD, 0xE1, 0xA9, 0x0C,
-	0x2C, 0x03, 0xB8, 0xCC, 0x12, 0x4F, 0x02, 0x17, 0x33, 0xC3, 0x3B, 0x2B,
-	0x74, 0x73, 0x4F, 0x98, 0x05, 0xF2, 0x04, 0xBC, 0x57, 0xAA, 0x1C, 0x18,
-	0x42, 0xDC, 0x87, 0xB4, 0x83, 0xC5, 0xD1, 0x73, 0xB8, 0x83, 0xFB, 0xC2,
-	0x52, 0xE0, 0x51, 0x07, 0xC9, 0x50, 0x98, 0xCC, 0x03, 0xB3, 0x08, 0x16,
-	0xB5, 0xA5, 0x77, 0x74, 0x54, 0xAD, 0xC1, 0xEF, 0x85, 0xA6, 0x0A, 0xF4,
-	0x7A, 0x70, 0x95, 0x40, 0x73, 0x0E, 0xC9, 0xF5, 0x2B, 0xA9, 0xE3, 0x64,
-	0x89, 0x6A, 0x4F, 0x44, 0xA0, 0xE9, 0xC1, 0x76, 0x28, 0x7C, 0x8E, 0x3C,
-	0x5F, 0xF6, 0x42, 0x59, 0x09, 0x83, 0x93, 0x32, 0x35, 0x96, 0x8B, 0xA1,
-	0x32, 0xB0, 0x4A, 0x7D, 0x54, 0x9E, 0x57, 0x35, 0xBB, 0x02, 0x4C, 0x0A,
-	0xD9, 0x99, 0x10, 0x7B, 0x43, 0x54, 0x7A, 0x7C, 0x04, 0x21, 0x55, 0x24,
-	0x13, 0x46, 0x41, 0xE8, 0x1D, 0x03, 0xBB, 0x0C, 0x6C, 0x1E, 0x20, 0x82,
-	0x34, 0x32, 0xCC, 0x62, 0x4B, 0x3C, 0xF5, 0xB4, 0x55, 0xC7, 0xD3, 0x8B,
-	0xF2, 0x78, 0x10, 0xE2, 0xBD, 0xF0, 0x87, 0xBE, 0x32, 0x9F, 0x09, 0xF3,
-	0x1B, 0x65, 0x94, 0x79, 0x24, 0x40, 0x94, 0x08, 0x7C, 0xD3, 0xC2, 0xF0,
-	0x24, 0x0C, 0x96, 0x8E, 0xC7, 0x7B, 0xE1, 0x97, 0xFF, 0xA2, 0xEC, 0x3E,
-	0x2A, 0xC9, 0x11, 0xD2, 0x9E, 0x61, 0x32, 0x32, 0x24, 0x91, 0x63, 0x30,
-	0x35, 0x2C, 0x72, 0x61, 0xE1, 0x03, 0xA7, 0xBE, 0xF2, 0x7B, 0xAC, 0xDC,
-	0x0B, 0x24, 0xB9, 0xE1, 0x47, 0x1F, 0xB8, 0x76, 0x86, 0xD0, 0x28, 0x5B,
-	0x09, 0xC4, 0x4F, 0x42, 0xA4, 0x4A, 0x70, 0x86, 0x63, 0x1F, 0x5E, 0xB2,
-	0x40, 0x1C, 0x43, 0x08, 0xD0, 0x4F, 0x84, 0x5C, 0x2C, 0xD9, 0x29, 0xB0,
-	0x2B, 0x02, 0x2F, 0xCF, 0x50, 0x39, 0x43, 0xEF, 0x42, 0x89, 0xC6, 0x42,
-	0xD7, 0x01, 0x4B, 0xA5, 0xBF, 0x55, 0xE6, 0x2F, 0x86, 0x75, 0x25, 0x6C,
-	0x72, 0x4F, 0xA5, 0x30, 0x18, 0x40, 0x96, 0x40, 0x06, 0x18, 0x05, 0x6D,
-	0xA1, 0xF3, 0xAF, 0x35, 0xB2, 0x46, 0x4A, 0xEC, 0x14, 0xAD, 0xE1, 0xD8,
-	0x09, 0xBE, 0x83, 0xC2, 0x78, 0xC2, 0x14, 0xA2, 0x3E, 0xEC, 0x27, 0x4A,
-	0x9E, 0x1B, 0x1A, 0x81, 0xDC, 0xC3, 0x99, 0x55, 0x3A, 0x40, 0x14, 0x9A,
-	0xBE, 0x10, 0x1B, 0x41, 0x6A, 0x30, 0xB5, 0x25, 0xAE, 0x3D, 0x72, 0x50,
-	0xCA, 0x17, 0xCF, 0x5A, 0x94, 0x24, 0x86, 0x69, 0x4F, 0x18, 0xDE, 0x46,
-	0x74, 0xC3, 0x40, 0x63, 0x5F, 0x3F, 0xF8, 0xA9, 0x50, 0x8C, 0x78, 0xE2,
-	0x09, 0xCC, 0xDF, 0x0A, 0x71, 0xA2, 0x24, 0x29, 0x14, 0xA9, 0x25, 0x1D,
-	0x2B, 0xAB, 0x4C, 0xF8, 0x7C, 0x30, 0xBC, 0xB1, 0x81, 0x2E, 0x81, 0x7B,
-	0x67, 0xB8, 0xF7, 0x81, 0xDF, 0x1D, 0x3C, 0xC7, 0x86, 0xB8, 0x07, 0x57,
-	0x02, 0x3F, 0x14, 0xF0, 0xFE, 0x51, 0x89, 0x8B, 0x88, 0xE7, 0x93, 0x63,
-	0x5F, 0x40, 0x8C, 0x61, 0xDC, 0x7B, 0x5D, 0x39, 0xDD, 0x48, 0xC8, 0x44,
-	0x68, 0x8C, 0xA7, 0xED, 0x01, 0x40, 0x77, 0xF4, 0xF4, 0x8E, 0x40, 0x0D,
-	0xC6, 0x08, 0xDD, 0x54, 0x70, 0x43, 0x61, 0xD8, 0x04, 0x9A, 0xAD, 0xB2,
-	0x7A, 0x52, 0x1E, 0x3F, 0xC2, 0x76, 0x2B, 0x9C, 0xF7, 0xE0, 0xFD, 0x45,
-	0xCA, 0xD9, 0x45, 0x60, 0x3F, 0x6F, 0x39, 0x59, 0x30, 0x0D, 0x44, 0xCD,
-	0xCE, 0x30, 0x7A, 0x08, 0x7C, 0xF8, 0xDC, 0x71, 0xCA, 0xE0, 0x2F, 0x2B,
-	0xE5, 0xF1, 0xAB, 0x60, 0x2B, 0x65, 0xD8, 0x87, 0x7C, 0xF1, 0x4A, 0x9E,
-	0x2E, 0xFB, 0x0E, 0xF5, 0x96, 0xDE, 0x4E, 0xC9, 0xBF, 0x42, 0xFE, 0x55,
-	0x89, 0x62, 0x45, 0x33, 0x21, 0xBF, 0x09, 0x0C, 0xE6, 0x4A, 0xEE, 0x61,
-	0x7B, 0x10, 0xF6, 0x77, 0x86, 0xED, 0x32, 0x50, 0x9F, 0x20, 0x2E, 0x03,
-	0xA7, 0x33, 0x61, 0xEF, 0x94, 0x41, 0x07, 0x26, 0x86, 0x41, 0x10, 0xEC,
-	0x51, 0x39, 0xED, 0x95, 0x6A, 0xAF, 0xB8, 0x1A, 0xFC, 0x10, 0xC2, 0xA5,
-	0xC5, 0xCC, 0x23, 0x4E, 0xAD, 0x50, 0xDB, 0x06, 0x27, 0x81, 0xC1, 0xC9,
-	0x50, 0x98, 0x40, 0x22, 0xD0, 0x64, 0x40, 0x06, 0xA1, 0x82, 0xE6, 0x00,
-	0x6D, 0x15, 0x38, 0x09, 0x34, 0x2A, 0x10, 0x5B, 0xF2, 0x3C, 0xD0, 0xEF,
-	0x2B, 0x21, 0x81, 0xBA, 0x81, 0xA8, 0x8C, 0x99, 0x19, 0x4F, 0x6F, 0xEE,
-	0xE9, 0xCD, 0x85, 0xE3, 0x4C, 0xE9, 0x4C, 0xA0, 0x6A, 0xE0, 0x54, 0xC1,
-	0xA4, 0x79, 0x05, 0x49, 0xA9, 0x17, 0x3A, 0x85, 0x4D, 0x2D, 0x1C, 0x0B,
-	0xB0, 0x7B, 0xC8, 0x36, 0xC2, 0xCB, 0x26, 0xB0, 0xDA, 0x43, 0xA1, 0x70,
-	0xD1, 0x87, 0x1F, 0x9D, 0x32, 0x7F, 0x72, 0xBC, 0xA8, 0xE5, 0xD3, 0xC0,
-	0x51, 0x36, 0x4A, 0x15, 0x43, 0x36, 0x85, 0xE1, 0x99, 0xBC, 0x96, 0x3E,
-	0xA9, 0xA5, 0x89, 0x85, 0x7E, 0x08, 0xD4, 0x75, 0xA0, 0x0D, 0x50, 0x25,
-	0xCA, 0x2E, 0x52, 0xEA, 0x36, 0x62, 0xB5, 0x0C, 0xFC, 0xBE, 0x56, 0xBE,
-	0x78, 0x38, 0xCD, 0x3C, 0x53, 0x01, 0xF5, 0x30, 0x38, 0x41, 0xEF, 0x0E,
-	0xF6, 0xA6, 0x63, 0xA5, 0xAF, 0x3F, 0xC1, 0xC4, 0x2A, 0xAE, 0x17, 0xB0,
-	0xA9, 0x72, 0xC8, 0x03, 0xBD, 0x5B, 0x65, 0x30, 0x80, 0xBA, 0x07, 0xA1,
-	0x83, 0xE7, 0x67, 0xCB, 0xA8, 0x0D, 0x8C, 0x54, 0x89, 0x7A, 0x31, 0xB2,
-	0x30, 0x14, 0x71, 0xCD, 0xF6, 0x53, 0xC4, 0xE7, 0xBF, 0x59, 0xEE, 0x3E,
-	0x7B, 0x1E, 0x4E, 0x8A, 0x9F, 0x28, 0x3F, 0x9C, 0x19, 0x2E, 0x87, 0x1E,
-	0xDB, 0x73, 0x9C, 0x52, 0x38, 0xA6, 0x10, 0x44, 0x88, 0xF6, 0x1B, 0xA1,
-	0xFF, 0x1B, 0xC4, 0x05, 0xB4, 0x39, 0xA4, 0xA9, 0xF2, 0x36, 0x56, 0xFA,
-	0xD7, 0x96, 0xF9, 0xBB, 0x04, 0x5D, 0xD4, 0xF8, 0xA4, 0x25, 0xF5, 0x31,
-	0xF6, 0x68, 0xA9, 0xEA, 0x96, 0xA2, 0x50, 0x06, 0x4F, 0xC2, 0x0C, 0x61,
-	0x71, 0xA1, 0xCC, 0x07, 0x42, 0x3F, 0xB7, 0x2C, 0x73, 0xCB, 0x93, 0x38,
-	0x9E, 0x07, 0xB0, 0x5D, 0xC6, 0x24, 0x6B, 0x47, 0x52, 0x06, 0xC2, 0x01,
-	0x5C, 0x3F, 0x02, 0x6B, 0xB0, 0x69, 0x07, 0x25, 0x34, 0xA5, 0xA2, 0x41,
-	0x21, 0x86, 0x78, 0x28, 0xB4, 0x17, 0x8A, 0xCE, 0x3C, 0xBB, 0x81, 0x27,
-	0xF7, 0x86, 0xDA, 0x28, 0xFB, 0x9E, 0xD0, 0x15, 0x9E, 0x5E, 0xAB, 0x44,
-	0x4E, 0xE8, 0x19, 0x50, 0xA3, 0x24, 0xA9, 0xA0, 0x09, 0xB8, 0x4E, 0xC1,
-	0x42, 0xBF, 0xA7, 0x8C, 0xA6, 0x8E, 0xC1, 0xD9, 0x2B, 0x29, 0xDB, 0xC4,
-	0xD0, 0xEC, 0x94, 0xE4, 0x8B, 0x67, 0x70, 0x14, 0xCE, 0x9B, 0x57, 0x67,
-	0x6E, 0x95, 0x08, 0x2F, 0xB9, 0xB0, 0x17, 0xCB, 0xAA, 0x14, 0xCE, 0x37,
-	0x1D, 0xB3, 0xA5, 0xD2, 0x5B, 0x1B, 0x9E, 0xBC, 0xF0, 0xEB, 0xDA, 0xB1,
-	0xBC, 0x17, 0xD2, 0x27, 0x18, 0xEC, 0x94, 0x7D, 0x6B, 0x58, 0x45, 0x8A,
-	0xF6, 0x95, 0xF9, 0x85, 0xE1, 0x76, 0x64, 0x18, 0xE3, 0xA9, 0xDB, 0x8E,
-	0x61, 0x07, 0x61, 0x61, 0x68, 0x67, 0x50, 0x8D, 0x02, 0xBD, 0x41, 0x44,
-	0xDF, 0x2A, 0xB1, 0x08, 0x51, 0x6C, 0xC9, 0xC4, 0xE1, 0x9D, 0x92, 0x96,
-	0x4A, 0xAF, 0x54, 0x4E, 0x9D, 0x65, 0x5F, 0x28, 0xD5, 0x1A, 0x5C, 0x05,
-	0x71, 0x02, 0x51, 0x6C, 0xE9, 0x03, 0x34, 0x9E, 0xF5, 0xC9, 0x92, 0x55,
-	0x81, 0xC6, 0x2B, 0xA5, 0x31, 0x04, 0xF5, 0x9C, 0x75, 0xD0, 0xDB, 0xC1,
-	0x28, 0x83, 0xE5, 0x1B, 0xA5, 0x5B, 0xBC, 0x36, 0xAB, 0xF9, 0xD0, 0x52,
-	0x17, 0xB0, 0xAD, 0x03, 0x5F, 0x96, 0xCA, 0x1F, 0x05, 0x72, 0xF5, 0x1C,
-	0x1A, 0xCF, 0xDD, 0xCA, 0xF2, 0xB7, 0xBF, 0x06, 0x3E, 0xFD, 0x6B, 0x60,
-	0xB7, 0x12, 0xC2, 0x3C, 0xE6, 0xE2, 0x1B, 0xC1, 0x7C, 0xDF, 0x42, 0xE6,
-	0x99, 0x76, 0x50, 0x4E, 0xE0, 0xD7, 0x01, 0xBC, 0x3C, 0x41, 0x74, 0xBF,
-	0xF1, 0x64, 0x3B, 0xC1, 0xB4, 0x86, 0x45, 0x1E, 0xF8, 0x6E, 0x02, 0xB3,
-	0xDB, 0x88, 0xEE, 0xD6, 0x90, 0x0C, 0x5B, 0x5E, 0x2A, 0xE1, 0xF4, 0x39,
-	0x50, 0x15, 0x81, 0xA8, 0x71, 0x84, 0x5A, 0xF0, 0x19, 0xD8, 0xB7, 0xCA,
-	0xDC, 0x41, 0xE3, 0x85, 0xDE, 0x16, 0x24, 0x82, 0xE7, 0xDC, 0xF1, 0xB4,
-	0x87, 0x7D, 0xAB, 0xD4, 0x49, 0xC0, 0x24, 0xCA, 0x20, 0xC0, 0x79, 0x25,
-	0xF4, 0x33, 0x43, 0x94, 0x05, 0x24, 0x40, 0x19, 0x02, 0x27, 0x85, 0x7E,
-	0x06, 0xBD, 0xB9, 0xC5, 0x8D, 0x0C, 0xF9, 0xC0, 0x91, 0x58, 0xA5, 0x8E,
-	0x0D, 0x1B, 0x94, 0x13, 0xCA, 0x1A, 0x21, 0x78, 0x18, 0x94, 0xAF, 0x7D,
-	0xFF, 0x38, 0x87, 0xBC, 0x67, 0xB0, 0x3D, 0xE1, 0x94, 0x05, 0xF6, 0xAD,
-	0x81, 0x10, 0x18, 0xF5, 0x23, 0xDE, 0x8F, 0x85, 0xC9, 0x58, 0x79, 0x99,
-	0x0B, 0x2F, 0xA9, 0x67, 0x4F, 0xA0, 0xD9, 0x06, 0xFA, 0xB5, 0xB0, 0x70,
-	0x90, 0x38, 0x98, 0xB7, 0x29, 0x4D, 0x03, 0x6E, 0xE7, 0x78, 0x7A, 0x72,
-	0x9C, 0x7F, 0x85, 0xCB, 0xB5, 0xE2, 0xC4, 0xF1, 0xB9, 0x31, 0xDC, 0x1D,
-	0x61, 0x53, 0x28, 0x83, 0xFA, 0x55, 0x2E, 0x59, 0x65, 0x4A, 0x7D, 0x26,
-	0x5C, 0x7F, 0x50, 0xDE, 0x7D, 0x07, 0xA3, 0xB1, 0x25, 0x3E, 0xC1, 0xA0,
-	0x76, 0x9C, 0x67, 0x70, 0xBC, 0x34, 0xF8, 0xA1, 0x61, 0xAF, 0x2D, 0x52,
-	0x39, 0xFC, 0x36, 0x45, 0x9D, 0x27, 0x89, 0x1B, 0x6C, 0x0A, 0x21, 0x82,
-	0x6E, 0x0F, 0xD5, 0xBD, 0x21, 0xEC, 0xA1, 0x6A, 0x3D, 0x2E, 0x15, 0x7A,
-	0x43, 0xC3, 0xC8, 0x5A, 0xA4, 0x80, 0x49, 0x17, 0xC8, 0x14, 0xCA, 0x34,
-	0x70, 0xAF, 0x42, 0x68, 0x85, 0xC6, 0x28, 0x6D, 0x0F, 0x4E, 0xB5, 0xF0,
-	0x66, 0x2D, 0xDC, 0xEE, 0x61, 0x36, 0x80, 0x75, 0x0D, 0xD6, 0x27, 0xA8,
-	0x8F, 0xF9, 0xDA, 0xD5, 0xAC, 0x9D, 0x92, 0x0E, 0xC0, 0x46, 0xC2, 0xE8,
-	0xE4, 0x79, 0xFE, 0x2B, 0x7C, 0x7C, 0xC8, 0xF8, 0xF3, 0xAF, 0x35, 0xFB,
-	0x25, 0xF4, 0x73, 0x65, 0xF1, 0xDE, 0x73, 0xFD, 0x93, 0x30, 0xFF, 0xBB,
-	0x84, 0x2C, 0xF6, 0x5C, 0xEE, 0x02, 0xB1, 0x46, 0xDC, 0x39, 0xCF, 0xF3,
-	0x26, 0x10, 0x1D, 0x0B, 0x48, 0x2F, 0x94, 0xE1, 0x99, 0x63, 0x71, 0x25,
-	0x44, 0x13, 0x78, 0x19, 0x7B, 0x7E, 0x93, 0xC0, 0xC3, 0x57, 0xD8, 0xFF,
-	0x2C, 0xC4, 0x2B, 0x18, 0x47, 0x9E, 0xD1, 0x08, 0x7A, 0x57, 0xCA, 0xF4,
-	0x7B, 0x4B, 0x9A, 0x1A, 0x38, 0x3A, 0xF4, 0x23, 0xA4, 0xF7, 0x4A, 0xF6,
-	0xE4, 0x39, 0xC6, 0x50, 0xA6, 0x42, 0xDD, 0x82, 0xC4, 0x9E, 0xFE, 0x05,
-	0x2C, 0x52, 0xB8, 0x1E, 0x2A, 0xA3, 0xB1, 0x23, 0xCA, 0x03, 0x6D, 0x0C,
-	0x2E, 0x02, 0x0D, 0xD0, 0x8B, 0x21, 0x4D, 0x02, 0x65, 0xAE, 0x4C, 0x8C,
-	0x25, 0x6A, 0x3D, 0xF1, 0x3E, 0xE2, 0xB0, 0xF7, 0x7C, 0x79, 0x10, 0xB6,
-	0x6B, 0x21, 0x3D, 0xBE, 0xF2, 0xFA, 0xF7, 0x19, 0x5C, 0xF5, 0x84, 0xF9,
-	0x40, 0xB0, 0x99, 0xF0, 0x39, 0x52, 0x36, 0x27, 0xE8, 0x4A, 0x70, 0x5E,
-	0x49, 0x8E, 0xCA, 0x48, 0x95, 0x60, 0x22, 0x56, 0x03, 0xE1, 0x49, 0x60,
-	0x3D, 0x87, 0x8B, 0x28, 0xA0, 0x02, 0xD6, 0x1A, 0x7A, 0x4F, 0x8E, 0xF4,
-	0x21, 0x10, 0x56, 0x81, 0xAE, 0x80, 0xAE, 0x82, 0xCA, 0x41, 0xD5, 0xC0,
-	0xD7, 0xAD, 0xB2, 0x2D, 0x15, 0x27, 0xBC, 0x96, 0x4C, 0x63, 0xA8, 0x2E,
-	0x85, 0xC5, 0x87, 0xC0, 0xFB, 0xBF, 0x87, 0xD9, 0x4D, 0x40, 0xB2, 0x06,
-	0x29, 0x2D, 0x63, 0x85, 0x64, 0x00, 0xCB, 0xB1, 0xE3, 0x4E, 0x0C, 0xDB,
-	0x1D, 0xAC, 0x36, 0xCA, 0xC5, 0x5D, 0xC3, 0x68, 0x29, 0x0C, 0x83, 0x10,
-	0xA5, 0x96, 0x68, 0x18, 0x58, 0x3B, 0xCF, 0xA6, 0x08, 0x58, 0xF7, 0xFA,
-	0x93, 0xC4, 0x39, 0xA4, 0xD6, 0xD0, 0x3B, 0x80, 0x29, 0x3A, 0x86, 0x0E,
-	0xC6, 0x11, 0x68, 0xA2, 0x3C, 0x0F, 0xA1, 0x15, 0xC5, 0xF7, 0x05, 0x73,
-	0x06, 0xA5, 0x0B, 0x94, 0x4F, 0x81, 0xD9, 0x13, 0x7C, 0xBB, 0x11, 0xDE,
-	0xFC, 0x45, 0x69, 0xCA, 0xC0, 0xAA, 0xD7, 0xF0, 0x50, 0x7B, 0x1A, 0x07,
-	0xF6, 0x46, 0x88, 0x07, 0x42, 0x5B, 0x43, 0xF5, 0xB3, 0xE1, 0xE1, 0x73,
-	0x4D, 0xB1, 0x7F, 0x0D, 0xD8, 0xEF, 0x7F, 0x54, 0x6E, 0xFE, 0x7D, 0x60,
-	0xF1, 0x77, 0x70, 0x71, 0x69, 0xC9, 0x4F, 0xCA, 0x69, 0x17, 0xD3, 0x7D,
-	0x81, 0xF2, 0x51, 0x39, 0x7D, 0x8A, 0x88, 0x2E, 0xE7, 0x96, 0xEB, 0xEF,
-	0x41, 0xCE, 0x2C, 0xC1, 0x04, 0xA2, 0xCA, 0x93, 0xDC, 0x29, 0xDD, 0x52,
-	0xF9, 0xF8, 0x12, 0x71, 0x3A, 0x04, 0xBE, 0x8B, 0xE0, 0xDD, 0x04, 0xA6,
-	0x6F, 0x0D, 0x83, 0x1B, 0x8B, 0x9C, 0x09, 0xEB, 0x3A, 0x62, 0xD9, 0x38,
-	0x76, 0xB1, 0x32, 0xB0, 0x90, 0x74, 0x10, 0xB5, 0x42, 0x08, 0x10, 0xC7,
-	0x30, 0x99, 0x1A, 0x6E, 0xCF, 0x2D, 0xD3, 0xB3, 0x8E, 0x64, 0x06, 0x59,
-	0xAE, 0x0C, 0x12, 0x43, 0x88, 0x2C, 0x41, 0x0C, 0x5D, 0xD3, 0x50, 0x17,
-	0x42, 0x59, 0x58, 0xDC, 0xCA, 0x31, 0xF2, 0x8A, 0x15, 0xE1, 0xD4, 0x3A,
-	0x7E, 0xDF, 0x04, 0xEE, 0xD7, 0x10, 0x17, 0x86, 0x18, 0x25, 0x1B, 0xC2,
-	0x24, 0x81, 0xD9, 0x48, 0x98, 0x4E, 0x2D, 0x6A, 0x3C, 0xD9, 0x11, 0xB4,
-	0x50, 0x8E, 0x2D, 0x48, 0xF0, 0x94, 0x2D, 0xE8, 0x41, 0xE8, 0x3F, 0x77,
-	0x4C, 0x73, 0xB8, 0xFC, 0xB7, 0xCA, 0xB4, 0x9E, 0x18, 0x96, 0xA5, 0x50,
-	0x6C, 0x2C, 0x4F, 0xF7, 0x1D, 0xC5, 0x93, 0x32, 0x2E, 0xE1, 0xC6, 0x08,
-	0x37, 0x67, 0x16, 0x06, 0xC2, 0xD3, 0x31, 0xF0, 0xE0, 0x02, 0x4D, 0x29,
-	0xE4, 0x91, 0x90, 0x2C, 0x02, 0xBC, 0x81, 0xFE, 0x07, 0x78, 0xF3, 0xC1,
-	0xF2, 0xF6, 0x4A, 0xB9, 0x48, 0x04, 0x04, 0xAA, 0x5E, 0x60, 0x14, 0x84,
-	0x89, 0x31, 0x98, 0x3A, 0xF0, 0xB5, 0x51, 0x76, 0x5B, 0xA1, 0x5A, 0xBF,
-	0xBE, 0xB3, 0xF1, 0x8B, 0x72, 0x5D, 0x0A, 0x17, 0xDE, 0xD3, 0xEB, 0x43,
-	0x31, 0x03, 0x9D, 0xBF, 0x4E, 0x2E, 0x97, 0x08, 0xC6, 0x04, 0xAA, 0x95,
-	0xA3, 0xDE, 0xC2, 0x65, 0x05, 0x17, 0x06, 0x7A, 0xB1, 0x50, 0x8A, 0x20,
-	0x11, 0x44, 0x43, 0x21, 0xB9, 0x54, 0xC2, 0xA5, 0xB0, 0xCD, 0x62, 0x7E,
-	0xBD, 0x56, 0x92, 0x9F, 0x3B, 0x6E, 0xEE, 0x95, 0xAB, 0x02, 0xCA, 0x8F,
-	0x8E, 0x65, 0x02, 0xC4, 0x90, 0x7D, 0xFB, 0xEA, 0x66, 0x1C, 0x92, 0x88,
-	0xF2, 0x6F, 0xCA, 0xC3, 0xAA, 0xA3, 0xD8, 0xC2, 0x68, 0x08, 0xEF, 0x7F,
-	0x14, 0xFE, 0xC3, 0x7F, 0x10, 0xBE, 0xFF, 0x51, 0x90, 0xB1, 0x65, 0x7F,
-	0xF4, 0x3C, 0x7F, 0x82, 0xFB, 0xDF, 0x1C, 0x2F, 0x7F, 0x0E, 0x3C, 0x7E,
-	0x81, 0x2C, 0x36, 0x44, 0x6F, 0xBE, 0x8D, 0xE8, 0x5D, 0x05, 0x9E, 0x3B,
-	0xE5, 0xFE, 0x13, 0x1C, 0xBF, 0x0A, 0x87, 0xE7, 0x88, 0xED, 0xCE, 0xE3,
-	0x63, 0x47, 0xFF, 0x16, 0x2E, 0xDE, 0x5A, 0x2E, 0x2F, 0x23, 0x6E, 0x72,
-	0x47, 0x12, 0x1C, 0xF7, 0x5F, 0x23, 0x3E, 0xEE, 0x5A, 0x3E, 0x2E, 0x15,
-	0xF5, 0xA0, 0x37, 0xD0, 0xDD, 0x1A, 0xCA, 0x93, 0x21, 0x34, 0x8E, 0x61,
-	0x1F, 0x2E, 0x2F, 0xE1, 0xFA, 0x56, 0x19, 0x5D, 0x08, 0xF1, 0x50, 0xE9,
-	0x7A, 0x82, 0x8F, 0x23, 0xA4, 0x09, 0xF8, 0xBD, 0xA7, 0x3B, 0x0A, 0x4F,
-	0x5B, 0x61, 0xFB, 0x6C, 0x18, 0x3F, 0xC3, 0x55, 0xA7, 0x88, 0x51, 0xB6,
-	0xA5, 0x61, 0x5D, 0x18, 0xAC, 0x51, 0xA6, 0x79, 0x60, 0x31, 0x51, 0xA6,
-	0x13, 0x88, 0xE6, 0xA0, 0x17, 0x42, 0x35, 0x50, 0x8A, 0xB5, 0xA7, 0xBE,
-	0x83, 0x41, 0x25, 0xD0, 0x53, 0xC2, 0x48, 0xD8, 0xA9, 0xE5, 0x79, 0x25,
-	0xF4, 0x56, 0x81, 0x45, 0xE5, 0x91, 0x1C, 0x3E, 0x5D, 0x43, 0x35, 0x14,
-	0x7E, 0x2E, 0x02, 0xC7, 0xB5, 0x67, 0x55, 0x43, 0x35, 0x84, 0xF3, 0x33,
-	0xE1, 0xBC, 0x6F, 0x19, 0x8F, 0x2C, 0xB5, 0x1A, 0x76, 0xEA, 0x28, 0x06,
-	0x9E, 0xE4, 0x1C, 0xDE, 0x8C, 0x85, 0xF1, 0x0F, 0x42, 0xFB, 0xAD, 0xD2,
-	0xBC, 0x51, 0x86, 0x23, 0xE5, 0x42, 0xE1, 0xBC, 0xB1, 0x1C, 0xEB, 0x40,
-	0x77, 0x54, 0xE4, 0x28, 0x0C, 0x6B, 0xCB, 0xB1, 0x83, 0x7E, 0xA9, 0x8C,
-	0x4A, 0xA5, 0xF2, 0xF0, 0x2C, 0x11, 0xCB, 0xB9, 0xE7, 0x38, 0x50, 0xFC,
-	0x41, 0x19, 0x9E, 0x5E, 0xD5, 0xF5, 0xE8, 0xD2, 0xA2, 0xE7, 0x3D, 0x96,
-	0xC1, 0x51, 0x3C, 0xD5, 0x2C, 0x57, 0x10, 0xB7, 0xC2, 0x30, 0x13, 0xA6,
-	0xBD, 0xD7, 0x1C, 0x54, 0x49, 0x60, 0x98, 0xC2, 0x74, 0x14, 0x21, 0xB9,
-	0x72, 0x6F, 0x02, 0x5F, 0x72, 0xCF, 0xF6, 0x4A, 0x99, 0x5A, 0x61, 0x70,
-	0x05, 0x52, 0x08, 0xF5, 0x32, 0x40, 0x21, 0x0C, 0xFB, 0x8A, 0x5E, 0x82,
-	0xCE, 0xE0, 0xEB, 0x52, 0x69, 0x1F, 0x1D, 0x77, 0x85, 0xD0, 0x0E, 0x0C,
-	0xC3, 0x9F, 0x3C, 0xDF, 0xFE, 0xA3, 0xE1, 0xDF, 0xBF, 0x53, 0xAE, 0x62,
-	0x78, 0xF9, 0x12, 0xF1, 0xE5, 0x31, 0xF0, 0xB7, 0xBF, 0x78, 0x56, 0xBF,
-	0x42, 0x78, 0x06, 0x1B, 0x0B, 0x8B, 0x37, 0x9E, 0x28, 0x1E, 0x1A, 0x7E,
-	0x5D, 0x05, 0x78, 0x70, 0xD8, 0x67, 0x85, 0x2D, 0x1C, 0xF6, 0xCA, 0xD1,
-	0x29, 0x57, 0x23, 0x61, 0x34, 0x37, 0x44, 0x6F, 0x61, 0x9D, 0x40, 0xBA,
-	0xB6, 0xE4, 0x2F, 0x9E, 0x4F, 0xF7, 0x1D, 0x3F, 0xB7, 0xB0, 0xEC, 0xC1,
-	0xED, 0xB9, 0x30, 0x38, 0x13, 0xDA, 0x3E, 0x94, 0xA7, 0x40, 0x7C, 0x80,
-	0xB3, 0xD8, 0x70, 0xB1, 0x80, 0x45, 0xDF, 0x31, 0x4A, 0x62, 0x74, 0x14,
-	0x68, 0xFA, 0xF0, 0x5C, 0x09, 0xCD, 0xC6, 0x71, 0xFA, 0x05, 0xCA, 0x7B,
-	0xD8, 0x1E, 0x60, 0xBF, 0x71, 0x48, 0x05, 0xA3, 0x56, 0xC8, 0x1B, 0xC1,
-	0xD5, 0x4A, 0x66, 0x94, 0xF9, 0xCC, 0x30, 0xBF, 0xB6, 0xA4, 0x73, 0x47,
-	0xD6, 0x57, 0x7A, 0x67, 0x06, 0x9D, 0x18, 0x56, 0xB5, 0xE3, 0xEB, 0xD2,
-	0xE2, 0x96, 0x9E, 0x8B, 0x5A, 0xF9, 0x20, 0x11, 0x9B, 0xA1, 0x70, 0x9F,
-	0x38, 0x76, 0xC6, 0x70, 0xB9, 0x09, 0x9C, 0x3D, 0x43, 0x94, 0x81, 0xD9,
-	0x2B, 0x55, 0x3F, 0xE0, 0x3B, 0xC5, 0x2A, 0x4C, 0x6F, 0x21, 0xFF, 0xDE,
-	0xD2, 0xEB, 0x47, 0x1C, 0xCA, 0x8E, 0xFB, 0xB5, 0xA3, 0xDA, 0x1B, 0x56,
-	0xA7, 0x57, 0xA4, 0x3B, 0xB9, 0x85, 0xBF, 0xBF, 0x8C, 0x38, 0xFF, 0x1E,
-	0xF6, 0x57, 0x9E, 0x87, 0x41, 0x20, 0x0E, 0x82, 0x2D, 0x2D, 0x75, 0x07,
-	0x87, 0x3D, 0x6C, 0xEE, 0x60, 0xFD, 0x59, 0x99, 0x2D, 0x3B, 0xDA, 0x4A,
-	0x48, 0x9B, 0xC0, 0x22, 0x86, 0xFD, 0x1C, 0x96, 0x17, 0xCA, 0xCB, 0xBB,
-	0x84, 0x6A, 0xF4, 0xDE, 0xD5, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44, 0x41,
-	0x54, 0x72, 0xE8, 0x88, 0x56, 0x9E, 0x0F, 0xBF, 0x08, 0xB7, 0x1B, 0x65,
-	0xF0, 0x28, 0x3C, 0x4B, 0xC7, 0xB1, 0xF3, 0xBC, 0x2C, 0x95, 0x32, 0xC0,
-	0x9B, 0x2B, 0xCB, 0x55, 0x1E, 0x31, 0xA1, 0x65, 0xE5, 0x84, 0x60, 0x3C,
-	0xF3, 0x21, 0xDC, 0xF4, 0x3C, 0xC7, 0xCE, 0xF0, 0xDB, 0x52, 0x39, 0x1E,
-	0x3C, 0x6E, 0x02, 0xC5, 0xB9, 0x61, 0x7B, 0x13, 0x71, 0x38, 0x41, 0xF1,
-	0xE4, 0xE9, 0x8A, 0x7F, 0xD3, 0xF8, 0xB3, 0xC0, 0xFA, 0x0E, 0x5E, 0x7E,
-	0xED, 0xC8, 0xEE, 0x94, 0x2E, 0x15, 0x06, 0x1F, 0x0C, 0x93, 0x3F, 0x19,
-	0x46, 0x73, 0x21, 0x3B, 0x29, 0xDD, 0x93, 0x67, 0xF3, 0x7B, 0xC5, 0xDF,
-	0x7E, 0x87, 0xBF, 0x7C, 0x81, 0x53, 0xFD, 0x6A, 0x10, 0xFD, 0xF8, 0x63,
-	0xCE, 0xE8, 0xC7, 0x8E, 0xE8, 0x79, 0xED, 0x58, 0x2F, 0x3B, 0x66, 0x25,
-	0xDC, 0x26, 0x20, 0x57, 0x60, 0x86, 0x4A, 0x74, 0x14, 0xE6, 0x26, 0x22,
-	0x2F, 0x94, 0xCD, 0xAF, 0xCA, 0x47, 0x75, 0x5C, 0x6C, 0x94, 0xD9, 0x12,
-	0xEE, 0x4F, 0x86, 0xF5, 0x48, 0xE9, 0xFA, 0x42, 0x74, 0xA6, 0xC8, 0x85,
-	0xE2, 0xB2, 0x57, 0x2C, 0x9C, 0xCD, 0xA0, 0x1F, 0x60, 0xD4, 0x5A, 0x7A,
-	0xEB, 0xC0, 0xA4, 0xF5, 0xC4, 0x01, 0x56, 0x31, 0x7C, 0x3E, 0x76, 0x2C,
-	0x7F, 0xB1, 0xC8, 0x5F, 0x3D, 0xC9, 0x0B, 0x2C, 0x02, 0x84, 0x48, 0xA9,
-	0x7A, 0xC2, 0x31, 0xB1, 0x18, 0x1B, 0xC8, 0x12, 0xE5, 0xA2, 0x2F, 0x0C,
-	0x2E, 0x02, 0xC3, 0x0B, 0x85, 0xA9, 0x32, 0x1C, 0xC2, 0x64, 0x1E, 0x50,
-	0x13, 0x78, 0x7C, 0x11, 0x7E, 0xDE, 0x06, 0xD2, 0x03, 0xDC, 0x6C, 0xE1,
-	0xB6, 0x10, 0xF2, 0x42, 0xD8, 0xF5, 0x94, 0x07, 0x17, 0xD0, 0x58, 0x31,
-	0x19, 0x28, 0xE0, 0xDC, 0xEB, 0xA6, 0x30, 0xB4, 0xC2, 0xE5, 0xF8, 0xD5,
-	0x1B, 0x7C, 0x98, 0x05, 0x56, 0x1A, 0xF8, 0xAF, 0x1B, 0xE1, 0xEB, 0x1E,
-	0x66, 0x35, 0x70, 0x16, 0xB8, 0xBC, 0x80, 0xEB, 0x6B, 0xE1, 0xCD, 0xA0,
-	0xE5, 0xDA, 0xC4, 0x7C, 0x2E, 0x84, 0xFB, 0x9D, 0xA2, 0x0A, 0xA7, 0x63,
-	0xA0, 0x6B, 0xE1, 0xEE, 0x29, 0xF0, 0xE5, 0x4E, 0x68, 0xBF, 0x2A, 0x67,
-	0x4F, 0xC2, 0xC5, 0x46, 0x99, 0x28, 0xF4, 0x46, 0x70, 0xE6, 0x41, 0x67,
-	0x9E, 0x53, 0x0E, 0xA7, 0xB7, 0x81, 0xC7, 0x19, 0x64, 0x8D, 0x32, 0x3D,
-	0xC2, 0xF0, 0xAB, 0x23, 0xBA, 0x77, 0x78, 0x85, 0x6E, 0x08, 0x93, 0x6F,
-	0x84, 0x8B, 0x0F, 0x8E, 0x69, 0x2A, 0xC4, 0x4B, 0xC1, 0x1D, 0x02, 0x26,
-	0x13, 0x7A, 0x33, 0x88, 0xBD, 0x52, 0xED, 0x03, 0xAB, 0x12, 0xEA, 0x14,
-	0xE6, 0x01, 0x72, 0x02, 0x21, 0xEB, 0x68, 0x3B, 0xC3, 0x66, 0x28, 0xC8,
-	0xD8, 0x30, 0x35, 0x20, 0x5B, 0xE1, 0xF8, 0x8B, 0x7F, 0xBD, 0x24, 0x93,
-	0x08, 0x8B, 0x3F, 0x08, 0x8F, 0x3F, 0x41, 0x35, 0x8D, 0x78, 0x39, 0x75,
-	0xFC, 0xEB, 0x2A, 0x66, 0xF8, 0x5B, 0xC7, 0x2F, 0x7F, 0x85, 0xCF, 0x3B,
-	0x43, 0xA5, 0x9E, 0xF3, 0x5B, 0xF8, 0xFB, 0xBF, 0x8F, 0xB8, 0x7C, 0xAF,
-	0xEC, 0x2D, 0x44, 0x2F, 0x0F, 0x1D, 0x36, 0x82, 0xD1, 0xF7, 0x11, 0xA3,
-	0x09, 0x54, 0x8D, 0xD2, 0x3C, 0x04, 0xE2, 0xCF, 0x90, 0x3C, 0x29, 0xFA,
-	0xE2, 0xD8, 0x01, 0x9F, 0x53, 0xA8, 0x62, 0xA8, 0x7B, 0xC2, 0xE9, 0x4A,
-	0x89, 0xA6, 0xC2, 0xE8, 0x02, 0xF2, 0x33, 0x0B, 0x03, 0x0F, 0x11, 0x98,
-	0xC8, 0x10, 0x79, 0x43, 0x53, 0x7B, 0x0E, 0x5B, 0x8F, 0xDD, 0xC0, 0x60,
-	0x15, 0x30, 0xCF, 0xC2, 0xC9, 0x28, 0xAB, 0x93, 0xF0, 0x78, 0x17, 0x91,
-	0x6C, 0x02, 0xEF, 0x4F, 0xCA, 0x05, 0x70, 0x4C, 0xC0, 0xCD, 0x14, 0x77,
-	0x16, 0x68, 0x13, 0x65, 0x52, 0x1B, 0xB2, 0x4E, 0xB1, 0x03, 0x90, 0x91,
-	0xC1, 0x4C, 0x94, 0xD9, 0x24, 0x90, 0x47, 0x86, 0xD5, 0x13, 0x3C, 0x7F,
-	0x11, 0x9E, 0x36, 0x9E, 0x91, 0x83, 0x9D, 0xC0, 0xF0, 0xD0, 0x91, 0x95,
-	0xF0, 0xDE, 0x80, 0x0C, 0x95, 0x26, 0x15, 0xAA, 0x39, 0xB4, 0x28, 0x55,
-	0xDF, 0x12, 0xF7, 0x2C, 0x6F, 0x53, 0xE5, 0xA7, 0xC8, 0x13, 0xAF, 0x0D,
-	0xA6, 0xF1, 0x3C, 0xD0, 0x71, 0x2C, 0x41, 0xFA, 0xD0, 0xBF, 0x55, 0x86,
-	0x6F, 0x20, 0xBE, 0x35, 0x30, 0x8A, 0xD9, 0xD6, 0x2D, 0xFA, 0xB9, 0x63,
-	0xFF, 0xB3, 0x50, 0x2F, 0xA1, 0x75, 0x9E, 0x43, 0x30, 0xD8, 0x06, 0x8A,
-	0x32, 0xB0, 0x75, 0x96, 0x53, 0x2F, 0xD0, 0xDC, 0xBC, 0x7E, 0xCC, 0x6F,
-	0x0A, 0x98, 0x58, 0xE1, 0x60, 0x61, 0x76, 0x50, 0xDC, 0xBD, 0x67, 0x35,
-	0x86, 0x3A, 0xB2, 0x3C, 0xA5, 0x9E, 0xF1, 0x00, 0xD8, 0x81, 0x1C, 0x20,
-	0x8D, 0xE0, 0x66, 0x0A, 0xD1, 0x45, 0xC4, 0xF9, 0xB5, 0x43, 0x9C, 0x72,
-	0xAA, 0x0C, 0x5A, 0x7B, 0xB2, 0x5C, 0xD0, 0x44, 0x58, 0x56, 0xCA, 0xD7,
-	0x5A, 0x39, 0x79, 0xC8, 0xFB, 0x30, 0xCE, 0x5F, 0x81, 0x8D, 0x2E, 0x95,
-	0xEA, 0x00, 0xAD, 0xF5, 0x64, 0x99, 0xD0, 0x75, 0xCA, 0xEE, 0x09, 0xEA,
-	0x2F, 0xC2, 0xB5, 0x51, 0x7E, 0xFA, 0x0E, 0xA6, 0x7F, 0x14, 0x7A, 0x23,
-	0xCF, 0x7F, 0x3D, 0x7A, 0xEE, 0x3E, 0x29, 0xC7, 0x5F, 0x3B, 0x16, 0x9F,
-	0x94, 0x53, 0x69, 0x30, 0xD3, 0xC0, 0xF4, 0x03, 0x7C, 0xF7, 0xBD, 0xE1,
-	0xED, 0xB9, 0xE5, 0x58, 0xB7, 0x3C, 0x7F, 0xF6, 0x44, 0xF9, 0xC1, 0x70,
-	0xFB, 0x87, 0xC0, 0xE5, 0x77, 0x29, 0xA7, 0xB1, 0xE3, 0x6E, 0xE7, 0xB9,
-	0x3B, 0x41, 0xB4, 0x7C, 0xBD, 0xAB, 0xD7, 0xBB, 0xB7, 0xA4, 0xEE, 0x95,
-	0xDB, 0xC7, 0xDF, 0x42, 0xF4, 0xBD, 0x61, 0x7C, 0xA6, 0xDC, 0x0C, 0x03,
-	0x66, 0x01, 0x17, 0x63, 0x21, 0x45, 0x39, 0x54, 0x70, 0xAA, 0x02, 0xA7,
-	0xDA, 0x52, 0x17, 0x4A, 0xB9, 0x53, 0xCA, 0x3D, 0x44, 0x25, 0xE4, 0x2A,
-	0x94, 0x4E, 0xF0, 0x5E, 0x71, 0xBE, 0x25, 0xE5, 0x55, 0xC8, 0x40, 0x95,
-	0x5E, 0x1F, 0xEC, 0x19, 0x4C, 0x7F, 0x54, 0x26, 0x73, 0x21, 0xA9, 0x84,
-	0x74, 0xF3, 0xAA, 0x40, 0x7B, 0xA3, 0xF4, 0x11, 0x06, 0x27, 0x4B, 0xB3,
-	0xCC, 0x78, 0xFA, 0x6B, 0xCD, 0xD7, 0xFB, 0xD7, 0x7E, 0x41, 0xE7, 0x96,
-	0xBF, 0xDC, 0x7A, 0x9E, 0x1B, 0x78, 0x5B, 0x45, 0x58, 0xA7, 0x5C, 0x06,
-	0xF0, 0x0D, 0xEC, 0x35, 0x50, 0x8B, 0xA0, 0x0A, 0xBD, 0x26, 0x30, 0x71,
-	0x70, 0x56, 0x59, 0x7C, 0x05, 0x49, 0x02, 0xFD, 0x31, 0x4C, 0xAE, 0x85,
-	0xCB, 0x2B, 0x48, 0xAF, 0x94, 0x66, 0x06, 0x5B, 0x7D, 0x0D, 0x8B, 0x8F,
-	0x07, 0x43, 0xF2, 0xAC, 0x54, 0x0F, 0x50, 0x7E, 0x7D, 0x85, 0x45, 0x25,
-	0x90, 0x85, 0x40, 0x2F, 0x11, 0xCE, 0x66, 0x9E, 0xD5, 0xDC, 0x50, 0x65,
-	0xB0, 0x6E, 0x85, 0xF3, 0xC2, 0x72, 0x76, 0xB4, 0x6C, 0xDA, 0x16, 0x4A,
-	0x48, 0x7E, 0x33, 0xCC, 0xF7, 0xAF, 0x02, 0x6D, 0x13, 0x0C, 0x0F, 0x23,
-	0x90, 0x5B, 0xE8, 0x1F, 0x95, 0x89, 0x2A, 0x93, 0x85, 0x70, 0x4A, 0x02,
-	0x4D, 0x0D, 0xDB, 0xCA, 0x93, 0xD6, 0x4A, 0x9A, 0x82, 0x64, 0x4A, 0x5D,
-	0x19, 0x76, 0x4F, 0xC2, 0x66, 0xA7, 0x4C, 0x86, 0x30, 0x1C, 0x18, 0x2E,
-	0xCE, 0x22, 0xA8, 0x84, 0xE7, 0xBB, 0x96, 0xE5, 0x9D, 0x27, 0x3E, 0x82,
-	0xA2, 0x54, 0x41, 0x38, 0x78, 0x4B, 0x3E, 0x70, 0x7C, 0xFB, 0x26, 0xE2,
-	0x87, 0x9B, 0x80, 0xF7, 0x90, 0x3D, 0x45, 0xB4, 0xCF, 0x1D, 0xEB, 0xDF,
-	0xA0, 0xFD, 0xAA, 0x68, 0x2D, 0x0C, 0xAF, 0x95, 0xCB, 0x3F, 0x29, 0xE1,
-	0x4F, 0x90, 0xE4, 0x11, 0x9B, 0x87, 0x98, 0xFD, 0x5F, 0x3B, 0xEA, 0x07,
-	0x88, 0xFE, 0x7B, 0x89, 0x98, 0x59, 0x4F, 0x71, 0x70, 0x7C, 0xEC, 0x3A,
-	0xFE, 0x1B, 0x81, 0xD5, 0x08, 0x86, 0xB7, 0x96, 0x34, 0xBC, 0x62, 0xCA,
-	0xB3, 0xBD, 0x30, 0x9B, 0x28, 0xDC, 0x1A, 0xA6, 0x6F, 0x23, 0xCC, 0x85,
-	0x63, 0xDA, 0x33, 0x64, 0xFD, 0x98, 0x24, 0x76, 0x9C, 0x0A, 0xC3, 0x66,
-	0xA9, 0xEC, 0x9F, 0x95, 0xE6, 0xD8, 0x92, 0x75, 0xD0, 0x05, 0x5E, 0x47,
-	0x9E, 0x08, 0xA3, 0x52, 0xD0, 0x5A, 0x89, 0x2D, 0x9C, 0xF7, 0x20, 0x1A,
-	0x40, 0x6B, 0x04, 0xA3, 0xF2, 0xBA, 0x1D, 0xE4, 0xF0, 0x2E, 0x44, 0x0C,
-	0x9D, 0x72, 0x34, 0x8E, 0x2E, 0x18, 0xF4, 0x20, 0x64, 0x65, 0x60, 0x90,
-	0x58, 0x4E, 0xDE, 0xB0, 0xF9, 0xEC, 0xF8, 0xF5, 0x63, 0xE0, 0xD0, 0x01,
-	0xEF, 0xC1, 0x7D, 0xA7, 0x1C, 0xDE, 0xC6, 0x54, 0x89, 0xB0, 0xA9, 0x3C,
-	0x8B, 0x55, 0x60, 0xF6, 0x35, 0xA6, 0xFF, 0xD9, 0x23, 0x07, 0xD8, 0x39,
-	0x70, 0xAD, 0x67, 0x92, 0xBF, 0xFA, 0xFF, 0x76, 0x2F, 0xB4, 0x07, 0xC1,
-	0x47, 0xCA, 0xD4, 0x08, 0x53, 0x49, 0xB8, 0xF0, 0x8E, 0xED, 0x93, 0xE7,
-	0xD7, 0xCF, 0xC2, 0xA1, 0xF3, 0xB4, 0x7D, 0x47, 0x88, 0x21, 0x3E, 0x09,
-	0xA1, 0xAF, 0xE4, 0xB7, 0x11, 0x7D, 0x3C, 0x71, 0x13, 0x48, 0x2A, 0x88,
-	0x45, 0x99, 0xE6, 0x20, 0x89, 0xB2, 0x4B, 0x95, 0x68, 0x66, 0xD8, 0xBF,
-	0x4F, 0x78, 0xDC, 0x3B, 0xD6, 0x8F, 0xCA, 0xEE, 0x2B, 0xAF, 0x2D, 0xDF,
-	0x03, 0x34, 0x3D, 0xA5, 0xBF, 0x80, 0xE4, 0x1C, 0xC2, 0x7B, 0xA8, 0x50,
-	0xFA, 0x2A, 0x64, 0x09, 0x78, 0x17, 0xD8, 0x2E, 0x95, 0xB2, 0x83, 0x41,
-	0x80, 0xC9, 0x4C, 0x88, 0x53, 0xCB, 0x7E, 0x15, 0xD8, 0x14, 0x4A, 0x77,
-	0x80, 0x85, 0x81, 0x0F, 0x8D, 0xA5, 0x1F, 0x84, 0x87, 0x20, 0x7C, 0x3A,
-	0x41, 0xB5, 0x82, 0xFE, 0x1A, 0x22, 0x01, 0xDF, 0x07, 0x73, 0xEE, 0xB9,
-	0xBE, 0x15, 0x26, 0x67, 0x9E, 0xA6, 0x15, 0xCA, 0x5F, 0x33, 0xAA, 0x8D,
-	0xA3, 0x01, 0x42, 0x0A, 0xE1, 0x52, 0xC8, 0x83, 0x61, 0x71, 0x1B, 0x18,
-	0x7D, 0x03, 0xAB, 0xA1, 0xE5, 0xB7, 0x83, 0x12, 0x3E, 0x55, 0xD8, 0x87,
-	0xC0, 0xAD, 0x33, 0x44, 0x57, 0x37, 0x2D, 0x67, 0x2B, 0xCB, 0xC7, 0xA7,
-	0x8E, 0xC7, 0x7E, 0x60, 0x33, 0x81, 0xF5, 0x48, 0xD8, 0x7C, 0x17, 0xE0,
-	0x5A, 0xD1, 0x5B, 0xF8, 0xE6, 0x0E, 0xDE, 0x2B, 0x8C, 0x87, 0x06, 0xB5,
-	0x96, 0x52, 0x3D, 0x49, 0xA7, 0x98, 0xAD, 0xA7, 0x39, 0x08, 0xCF, 0xF7,
-	0xCA, 0xDD, 0xEF, 0xCA, 0xFE, 0x20, 0x4C, 0x63, 0x65, 0xD1, 0xB3, 0x74,
-	0x13, 0xD8, 0xA5, 0x81, 0xFB, 0x14, 0x96, 0xA9, 0x27, 0x06, 0x06, 0x0A,
-	0x17, 0x3D, 0x21, 0x19, 0x45, 0x34, 0xB1, 0x70, 0x70, 0x8E, 0xA6, 0x11,
-	0x06, 0xA5, 0xD2, 0xFF, 0x0C, 0xF9, 0x4B, 0x40, 0x3A, 0x78, 0x29, 0x94,
-	0x7A, 0x05, 0x52, 0x40, 0xAD, 0x1E, 0xD7, 0x79, 0xBE, 0xBC, 0xC0, 0x66,
-	0xF3, 0x0A, 0x8F, 0x46, 0x39, 0x8C, 0xCE, 0x80, 0x5B, 0x65, 0x97, 0x05,
-	0x7E, 0x6B, 0x3D, 0x2F, 0x7D, 0x61, 0xE1, 0x3C, 0x93, 0x17, 0x0F, 0xAB,
-	0x57, 0xCB, 0x66, 0x30, 0x84, 0xF9, 0x5C, 0x58, 0x58, 0x10, 0xAB, 0x54,
-	0xAA, 0x34, 0xF6, 0xF5, 0x9A, 0xDF, 0xF9, 0x21, 0x30, 0xF3, 0xCA, 0x76,
-	0x69, 0x38, 0x2E, 0x03, 0x95, 0x83, 0x6E, 0x04, 0x5C, 0x5A, 0xDA, 0x33,
-	0x25, 0xBB, 0x51, 0xC6, 0x23, 0x47, 0xBF, 0x0F, 0x52, 0x1A, 0x8A, 0x3B,
-	0x83, 0x7B, 0x74, 0xF4, 0x6B, 0x21, 0xAC, 0x5F, 0x71, 0xB3, 0x9D, 0x28,
-	0xA7, 0x79, 0xCD, 0xE7, 0x9E, 0x72, 0x1A, 0x0B, 0xC7, 0x1D, 0x6C, 0x8E,
-	0x81, 0xB2, 0x54, 0x86, 0x0D, 0xDC, 0x64, 0x70, 0x7B, 0x16, 0xD3, 0x8B,
-	0x94, 0x6D, 0x2F, 0x70, 0xB4, 0x96, 0x53, 0xF0, 0x14, 0x28, 0x6D, 0x05,
-	0x41, 0x5F, 0xCB, 0x25, 0x9D, 0x46, 0xA8, 0x15, 0x9A, 0x83, 0xA7, 0x8E,
-	0x20, 0xC9, 0x0C, 0x97, 0xD6, 0x72, 0xD6, 0x58, 0x9A, 0x7B, 0x65, 0xFD,
-	0xD2, 0xF2, 0xF4, 0x45, 0xD1, 0x02, 0xCA, 0x1C, 0x92, 0x61, 0x44, 0xBA,
-	0xF0, 0x5C, 0xCD, 0x94, 0x51, 0x1F, 0xAA, 0x0A, 0xBE, 0xAE, 0xE1, 0xF4,
-	0x52, 0x53, 0xE1, 0x89, 0x6E, 0xA0, 0x3B, 0x07, 0x97, 0x26, 0xC4, 0x0A,
-	0xE7, 0xDA, 0xB2, 0x2D, 0xE0, 0xE7, 0x27, 0xF8, 0xB5, 0x74, 0x14, 0x85,
-	0xF2, 0xFD, 0x99, 0x61, 0x3E, 0x0D, 0x44, 0xCB, 0x3F, 0x41, 0xFE, 0x57,
-	0xC5, 0x3F, 0x28, 0x49, 0x09, 0xA9, 0xFB, 0x37, 0x67, 0xBD, 0x27, 0x1C,
-	0xE7, 0x11, 0x2B, 0xF1, 0x8C, 0x7C, 0xE0, 0xFD, 0x93, 0x70, 0x76, 0x74,
-	0x9C, 0x1E, 0x1C, 0x8F, 0x7B, 0xCB, 0xA6, 0x53, 0xFC, 0xC1, 0x51, 0xAE,
-	0xE1, 0x61, 0x0F, 0xBB, 0x1A, 0xFC, 0x50, 0xE8, 0x8F, 0x2C, 0x93, 0xA1,
-	0x50, 0x0F, 0x85, 0x22, 0x28, 0x45, 0x1C, 0xA8, 0xFA, 0xC2, 0x28, 0x81,
-	0x51, 0xAC, 0x64, 0x46, 0x18, 0x19, 0xE1, 0xA0, 0xF0, 0x08, 0x54, 0x01,
-	0x7A, 0xA5, 0xB2, 0x29, 0x3A, 0xBA, 0x57, 0xB7, 0x84, 0x4D, 0xA3, 0xD4,
-	0xE5, 0x6B, 0xC9, 0x31, 0x3C, 0x19, 0xBA, 0x56, 0x29, 0x3B, 0x25, 0x44,
-	0xAF, 0x8C, 0xE1, 0x7D, 0x0B, 0xEF, 0x5E, 0x84, 0xCE, 0x7A, 0xFE, 0xB9,
-	0xA7, 0x7C, 0x35, 0xB0, 0xAE, 0x95, 0x63, 0xEB, 0x99, 0x02, 0xB3, 0x11,
-	0x5C, 0x4E, 0x22, 0x6E, 0xBF, 0x7D, 0x75, 0xF3, 0x06, 0x4E, 0x79, 0x9A,
-	0x1A, 0xBE, 0xDC, 0x05, 0xEA, 0x4D, 0x20, 0x89, 0x02, 0xA3, 0x08, 0x12,
-	0x52, 0x2A, 0xDF, 0x10, 0x0E, 0x90, 0xEE, 0x61, 0xBC, 0x35, 0x8C, 0x4E,
-	0x82, 0xF5, 0x81, 0x69, 0x0A, 0xE7, 0x99, 0x30, 0x9C, 0xA6, 0x6C, 0x7B,
-	0x81, 0xC7, 0x3A, 0xD0, 0xAF, 0x61, 0x7A, 0x80, 0xE8, 0x24, 0xF4, 0xD7,
-	0xD0, 0xAD, 0x21, 0xFA, 0x1A, 0x90, 0x3E, 0x6C, 0xAD, 0xD0, 0xC6, 0x42,
-	0x3B, 0x50, 0x82, 0xC2, 0x20, 0x86, 0xCB, 0x99, 0xE5, 0xD2, 0x28, 0xDD,
-	0x09, 0x0A, 0xE0, 0x25, 0xF7, 0x78, 0xFF, 0xCA, 0xF1, 0x55, 0x85, 0x2C,
-	0x55, 0xFE, 0x7F, 0x96, 0xDE, 0xA3, 0xC9, 0x95, 0x24, 0xCB, 0xD2, 0xFC,
-	0xAE, 0xAA, 0x11, 0xC0, 0x0C, 0x1C, 0x0E, 0xA7, 0x8F, 0xC5, 0x0B, 0x92,
-	0xA4, 0xAB, 0x9A, 0xCC, 0x88, 0x0C, 0xD9, 0xCD, 0x4F, 0x9F, 0xD5, 0x48,
-	0x2F, 0x7A, 0xA6, 0xBA, 0xAB, 0xB2, 0xB3, 0x32, 0x23, 0xF2, 0x51, 0xE7,
-	0x0E, 0x07, 0x35, 0x00, 0xC6, 0x54, 0xF5, 0xCE, 0xC2, 0x62, 0xEF, 0x10,
-	0x71, 0x01, 0x8C, 0x5C, 0x3D, 0xF7, 0x9C, 0xEF, 0x8C, 0x7B, 0x96, 0x54,
-	0x03, 0x75, 0xE5, 0x39, 0x45, 0xC0, 0xDC, 0x30, 0x1B, 0x1A, 0x66, 0x31,
-	0xA8, 0x53, 0xEE, 0x5E, 0x1D, 0xB7, 0xDF, 0x02, 0xC7, 0x15, 0xCC, 0x53,
-	0x61, 0xBC, 0x30, 0xE8, 0xA5, 0x12, 0x8F, 0x0D, 0xFD, 0xA8, 0x33, 0xAD,
-	0xBC, 0x78, 0x08, 0x80, 0xF1, 0x1E, 0x63, 0x85, 0x49, 0x10, 0x56, 0x69,
-	0xA0, 0xBC, 0x6E, 0xD8, 0x3B, 0xA1, 0xBA, 0x87, 0xE6, 0x8B, 0xB0, 0x7F,
-	0xF1, 0x1C, 0x02, 0x1C, 0x3F, 0x08, 0xF5, 0x1F, 0x95, 0xF2, 0x2C, 0x26,
-	0xFA, 0xFE, 0x43, 0xA7, 0xCA, 0xD5, 0x3D, 0x65, 0xB6, 0x83, 0x99, 0x40,
-	0xB9, 0x57, 0x7A, 0xA5, 0xC1, 0xC6, 0x9D, 0x4A, 0xB6, 0x2B, 0xA0, 0xDC,
-	0x29, 0xF2, 0x0A, 0xFE, 0xBB, 0x65, 0x67, 0x2C, 0x5F, 0x5D, 0xB7, 0xC4,
-	0xC1, 0x1A, 0xC2, 0xD8, 0xB3, 0xB8, 0x02, 0x39, 0x33, 0x98, 0x21, 0xD4,
-	0xD2, 0x62, 0x4F, 0x11, 0x49, 0xAB, 0xDD, 0xC5, 0x94, 0x1A, 0xA2, 0x9E,
-	0xE0, 0xA2, 0xCE, 0x5D, 0x54, 0x97, 0x2D, 0xD2, 0x2A, 0x7D, 0x11, 0x42,
-	0x10, 0x0E, 0x91, 0x70, 0xAF, 0x42, 0xD6, 0x76, 0x89, 0xA0, 0x57, 0x23,
-	0xB8, 0x34, 0xA0, 0x0A, 0x89, 0x2A, 0xCE, 0x42, 0x1D, 0xC0, 0x89, 0x21,
-	0x8B, 0x84, 0xEB, 0xBD, 0xE7, 0xCF, 0x7F, 0xB7, 0x34, 0x0F, 0x4A, 0xD1,
-	0x57, 0x9E, 0x86, 0xC2, 0x8B, 0x51, 0x9A, 0x42, 0x88, 0x7A, 0xCA, 0x3C,
-	0x13, 0x3E, 0xBE, 0x57, 0xDE, 0xBD, 0x0B, 0xA4, 0x63, 0xC3, 0xF7, 0x42,
-	0xF9, 0xBA, 0x32, 0x3C, 0x9B, 0x6E, 0x6B, 0x76, 0x2E, 0xC2, 0xA4, 0x17,
-	0x38, 0xCE, 0x1C, 0x15, 0x01, 0x7F, 0xEC, 0x18, 0x05, 0x1F, 0x83, 0x90,
-	0x9D, 0x04, 0xF7, 0xA2, 0x9C, 0x0B, 0x5C, 0x1E, 0x41, 0xEF, 0xE1, 0x29,
-	0xF2, 0x6C, 0x6D, 0x60, 0x7F, 0xD5, 0x0D, 0xAC, 0xD9, 0x56, 0x68, 0x6F,
-	0x0D, 0xD1, 0x43, 0x60, 0xB0, 0x17, 0x62, 0x2B, 0xB4, 0x63, 0xE5, 0x90,
-	0x09, 0x51, 0x1C, 0xC8, 0xAE, 0xE1, 0x7C, 0x6A, 0xB9, 0x98, 0x44, 0xF4,
-	0x7D, 0x4D, 0xE5, 0x41, 0x5B, 0x68, 0x0D, 0xEC, 0x02, 0x48, 0x0B, 0x63,
-	0xE9, 0xB6, 0xA2, 0xE3, 0x4D, 0x4C, 0x52, 0xB4, 0x1C, 0x15, 0x5C, 0x0D,
-	0x39, 0xC2, 0xCC, 0x1A, 0xA2, 0xE0, 0x79, 0xAE, 0x5B, 0x3E, 0x35, 0xB0,
-	0xED, 0xC3, 0x70, 0x01, 0x37, 0x3D, 0xC3, 0x64, 0x12, 0x73, 0x18, 0x3A,
-	0x6A, 0x51, 0xA0, 0x73, 0x24, 0x37, 0xB1, 0x70, 0x88, 0x20, 0x94, 0xC2,
-	0x70, 0x69, 0x99, 0xDC, 0x0A, 0xD7, 0x1E, 0x4C, 0x13, 0xC8, 0x13, 0xC3,
-	0x76, 0x03, 0xA7, 0xC7, 0x40, 0x52, 0x40, 0xBE, 0x80, 0xFC, 0x4A, 0x89,
-	0x7E, 0x84, 0x6F, 0xE7, 0x10, 0x6D, 0x13, 0xCB, 0xE0, 0x3A, 0xD0, 0x33,
-	0x86, 0xE4, 0x36, 0xC5, 0x3C, 0x3A, 0x26, 0xAB, 0x96, 0x5E, 0xF0, 0x44,
-	0xE2, 0xF1, 0x69, 0x77, 0xC5, 0x1E, 0x80, 0xFD, 0x46, 0x28, 0x8E, 0xCA,
-	0xA1, 0x69, 0xD9, 0x44, 0x4A, 0x36, 0x85, 0xF9, 0x9B, 0x88, 0xF4, 0xBD,
-	0xC0, 0xD8, 0x71, 0xA8, 0xA0, 0xAA, 0xA0, 0x38, 0x0A, 0xE9, 0x56, 0x41,
-	0x0C, 0xF1, 0x50, 0x11, 0xE3, 0xB1, 0xA5, 0xD0, 0x7A, 0xA8, 0x6A, 0xED,
-	0xD4, 0x42, 0x35, 0x4C, 0x63, 0x88, 0x10, 0xB6, 0xDE, 0xB2, 0x31, 0x70,
-	0xEC, 0x29, 0xA2, 0x8E, 0x63, 0xA5, 0x94, 0x01, 0x6C, 0x0C, 0x03, 0x27,
-	0x38, 0x94, 0x63, 0x5F, 0xF0, 0xFD, 0x40, 0x1E, 0x0B, 0xBD, 0x3E, 0xA4,
-	0xDE, 0xD3, 0x5B, 0x2B, 0x57, 0x16, 0x6E, 0x8E, 0x31, 0x4D, 0x16, 0x30,
-	0x89, 0xE3, 0xF2, 0x0D, 0xFC, 0x32, 0x84, 0x77, 0xEF, 0x03, 0xE9, 0xCC,
-	0xF0, 0x58, 0x04, 0xBE, 0x3C, 0xC0, 0xE3, 0xD7, 0x86, 0xFC, 0xA1, 0xD3,
-	0x1B, 0x86, 0x0E, 0x92, 0x95, 0xA7, 0xB0, 0x9E, 0x2A, 0x06, 0x2E, 0x0C,
-	0xE3, 0x01, 0xDC, 0xF8, 0x40, 0xD2, 0x2A, 0x65, 0x30, 0x64, 0x4F, 0x42,
-	0xF2, 0x1D, 0x8E, 0xBE, 0xA2, 0x1D, 0x83, 0xBD, 0xB1, 0x1C, 0xAF, 0x03,
-	0xCB, 0xA1, 0x10, 0xB5, 0x01, 0x97, 0x7B, 0xA6, 0xB9, 0x65, 0x52, 0x06,
-	0xFA, 0x07, 0x43, 0xEE, 0x3C, 0xA9, 0xF3, 0xCC, 0x16, 0xD0, 0xBF, 0x80,
-	0xF9, 0x0D, 0x98, 0xAC, 0xE5, 0xE4, 0x2D, 0xA1, 0x56, 0x1A, 0x1F, 0x40,
-	0x05, 0x82, 0x21, 0xF4, 0x41, 0x09, 0xC4, 0x8D, 0xD2, 0x1E, 0x6B, 0x4C,
-	0x03, 0x51, 0x25, 0x24, 0xB5, 0x41, 0x50, 0x24, 0x6A, 0xA8, 0x34, 0xA2,
-	0xF4, 0x86, 0x2A, 0x0A, 0x94, 0xE7, 0x30, 0x4E, 0x84, 0x33, 0x13, 0x18,
-	0x98, 0x9A, 0xCA, 0x41, 0xD5, 0x28, 0x36, 0x8E, 0xC8, 0x8C, 0x52, 0x3B,
-	0xCF, 0xAA, 0x84, 0x9D, 0x33, 0x5C, 0x34, 0x8E, 0x9F, 0x2A, 0x78, 0xFB,
-	0x62, 0xA8, 0x1A, 0x68, 0x53, 0xCF, 0xBE, 0xB4, 0x1C, 0x9C, 0x30, 0x37,
-	0xCA, 0x60, 0x6E, 0x69, 0xDE, 0x40, 0x75, 0xE1, 0x59, 0x65, 0x2D, 0x91,
-	0xAB, 0x3C, 0x65, 0x05, 0x7E, 0x23, 0xAC, 0x9E, 0xA1, 0xBD, 0x87, 0xEB,
-	0x0D, 0x4C, 0x81, 0x78, 0x04, 0xBB, 0x8F, 0x50, 0xCF, 0x61, 0xDD, 0x8F,
-	0x79, 0x70, 0xC2, 0xAB, 0x34, 0x3C, 0x05, 0xE8, 0x0D, 0xE1, 0xCD, 0xDB,
-	0x88, 0xEB, 0x9F, 0x3C, 0xE1, 0xCC, 0xF3, 0x7A, 0x00, 0xFF, 0x1C, 0x08,
-	0x6B, 0x03, 0x27, 0xC1, 0x3A, 0x4F, 0x2F, 0x02, 0x6F, 0x40, 0x2D, 0xF4,
-	0x6B, 0xC5, 0x9A, 0xEE, 0x2E, 0x70, 0x31, 0xF4, 0x02, 0x64, 0xAD, 0xE2,
-	0x5A, 0x58, 0x9F, 0x5A, 0x2A, 0x03, 0x92, 0x41, 0x96, 0x76, 0xA8, 0x94,
-	0xA3, 0x09, 0x34, 0x28, 0x55, 0x2D, 0x34, 0x12, 0x70, 0x79, 0x07, 0x8A,
-	0x88, 0xFA, 0x8A, 0x37, 0xE0, 0x8F, 0x06, 0x29, 0x85, 0xA8, 0x76, 0xA4,
-	0x38, 0x7A, 0x1E, 0x46, 0xE7, 0x86, 0xB7, 0xEF, 0x03, 0x6F, 0xAF, 0x94,
-	0xDE, 0x4C, 0x58, 0xBA, 0x98, 0xDF, 0x9E, 0x5A, 0xBE, 0xBF, 0x7A, 0xF4,
-	0x08, 0xE7, 0x6A, 0x99, 0xB5, 0x90, 0xAC, 0x3D, 0xD4, 0xC2, 0xE0, 0x04,
-	0xD9, 0x39, 0x98, 0x49, 0x84, 0x9D, 0x79, 0xA4, 0x09, 0x34, 0x27, 0xA5,
-	0x3E, 0x82, 0x2F, 0x2C, 0xC7, 0x8D, 0x52, 0xAC, 0x61, 0x62, 0x20, 0x79,
-	0x15, 0xD6, 0x6B, 0xE1, 0x79, 0xA6, 0xEC, 0x13, 0x48, 0xE6, 0xC2, 0x70,
-	0x1A, 0xA8, 0x0E, 0x8A, 0x3E, 0x39, 0xDC, 0x0B, 0x4C, 0x80, 0xF3, 0x14,
-	0xA6, 0x53, 0x43, 0x3E, 0x52, 0xCA, 0x71, 0xE0, 0x60, 0x04, 0x2B, 0x60,
-	0x6B, 0xB0, 0x27, 0xE8, 0x35, 0x1E, 0x00, 0xD3, 0x0A, 0x75, 0x0D, 0xD5,
-	0x3A, 0xC0, 0x1A, 0xE2, 0x03, 0xE4, 0xDA, 0xBD, 0xE3, 0xDB, 0x04, 0x5C,
-	0x08, 0xDD, 0x29, 0x29, 0xED, 0x4C, 0xA7, 0xE9, 0x08, 0xB2, 0x4C, 0x31,
-	0x02, 0x6D, 0x01, 0xB2, 0x83, 0x50, 0x78, 0x64, 0x6D, 0x69, 0x5A, 0x58,
-	0xEF, 0xA1, 0x2C, 0x2D, 0xEF, 0x46, 0xC2, 0xFB, 0x39, 0x8C, 0x7B, 0x81,
-	0xA7, 0x46, 0x78, 0x5E, 0x09, 0xED, 0x4E, 0xA9, 0x54, 0x19, 0x67, 0x96,
-	0x5F, 0x12, 0x8B, 0xCB, 0x1C, 0x5F, 0x0C, 0xBC, 0xD6, 0x10, 0xB5, 0x4F,
-	0x86, 0xC7, 0x47, 0xC1, 0xFF, 0x2D, 0xF0, 0xFA, 0x58, 0x72, 0xB3, 0x13,
-	0x7E, 0xD9, 0xC3, 0x28, 0x13, 0xDA, 0x9E, 0xF2, 0x98, 0xC2, 0xF3, 0xC0,
-	0xB0, 0x8F, 0x94, 0x7B, 0xF5, 0x94, 0xD3, 0x2E, 0x33, 0xB0, 0x58, 0x08,
-	0xEF, 0xE6, 0x81, 0x51, 0xA6, 0x2C, 0xF7, 0x42, 0xF9, 0x22, 0xB4, 0xBB,
-	0x00, 0x12, 0x08, 0x03, 0xC1, 0x79, 0x8B, 0x09, 0x81, 0x34, 0x56, 0x7A,
-	0x40, 0x2E, 0xDD, 0x96, 0xAB, 0x12, 0x70, 0x8D, 0xC5, 0x97, 0x9E, 0xB4,
-	0x00, 0x69, 0x3B, 0x0D, 0xDC, 0x0E, 0x20, 0x4B, 0x60, 0xD4, 0x37, 0x18,
-	0xAB, 0xB4, 0x08, 0x6E, 0x6D, 0x38, 0x1E, 0x94, 0x91, 0x87, 0xEB, 0x1C,
-	0xCA, 0x59, 0x4C, 0x8A, 0xE0, 0x77, 0x81, 0xCD, 0x29, 0xE0, 0xAA, 0xCE,
-	0x36, 0x5D, 0x69, 0x20, 0x1A, 0x40, 0x6F, 0x6C, 0xC9, 0x27, 0x09, 0xBD,
-	0xDC, 0xE3, 0x2B, 0xCF, 0xED, 0xA6, 0xE1, 0xEB, 0x06, 0x76, 0x29, 0x9C,
-	0x5F, 0x1B, 0xB2, 0x81, 0xE0, 0x5F, 0xBB, 0xF5, 0x74, 0x9B, 0x2B, 0xD9,
-	0xD8, 0x72, 0x71, 0x06, 0x77, 0xFD, 0x96, 0xEA, 0x00, 0x2F, 0x1B, 0x61,
-	0xB8, 0x53, 0xAC, 0x83, 0xD6, 0x7B, 0x4A, 0x6F, 0x69, 0x5A, 0xCB, 0x64,
-	0xEF, 0x19, 0xEF, 0x3C, 0xD5, 0x5A, 0x90, 0xF7, 0x8A, 0xF9, 0x08, 0xA3,
-	0x1F, 0x60, 0x30, 0x56, 0x9A, 0x56, 0x38, 0x7C, 0x13, 0xEC, 0xA7, 0xC0,
-	0x55, 0x0D, 0xF3, 0xA9, 0x21, 0x19, 0x40, 0x1D, 0x77, 0x43, 0x5F, 0x93,
-	0x06, 0x4E, 0x56, 0x39, 0x61, 0x90, 0xC2, 0xD0, 0x6B, 0x1D, 0x3D, 0x07,
-	0x6D, 0x0D, 0x2F, 0x07, 0x4B, 0xB3, 0x0D, 0x5C, 0xBD, 0x2A, 0xB6, 0x05,
-	0x93, 0x05, 0x42, 0x0C, 0x47, 0x6B, 0x08, 0xAD, 0xE2, 0x6A, 0x48, 0x1A,
-	0x61, 0x91, 0x2A, 0x33, 0xAB, 0x64, 0xE7, 0xD0, 0xE6, 0x50, 0x3E, 0x0B,
-	0xE5, 0x01, 0xF2, 0x07, 0x65, 0xBD, 0x55, 0xEA, 0x06, 0xF2, 0x08, 0x86,
-	0x37, 0x9E, 0x77, 0x3F, 0x25, 0x0C, 0xAE, 0x3C, 0x75, 0xA3, 0xEC, 0x6F,
-	0xA1, 0x58, 0x2B, 0x91, 0xED, 0xA2, 0x6B, 0xF9, 0xD4, 0x73, 0x3E, 0x12,
-	0x06, 0x27, 0xA1, 0x7D, 0x12, 0x2A, 0xA3, 0x44, 0xBB, 0x7F, 0xB5, 0x94,
-	0x5F, 0x3C, 0xDB, 0x75, 0x0C, 0x49, 0xC3, 0xD5, 0x50, 0x99, 0xA7, 0xC2,
-	0x65, 0x22, 0x1C, 0xFB, 0xCA, 0xD1, 0x1B, 0x8A, 0x13, 0x38, 0x1C, 0xC5,
-	0x0C, 0xEC, 0x04, 0xA6, 0xA3, 0x98, 0x59, 0xAE, 0xF4, 0x8C, 0x63, 0x75,
-	0x30, 0x7C, 0x5F, 0x29, 0xDB, 0xCA, 0x60, 0xC7, 0xD0, 0x4B, 0x84, 0x20,
-	0xB0, 0xAF, 0x85, 0xC6, 0x09, 0xFD, 0x9E, 0x32, 0xB5, 0x10, 0xDB, 0x88,
-	0x32, 0x78, 0xB6, 0xA5, 0x52, 0x1E, 0x94, 0x49, 0x01, 0xD9, 0x11, 0xB2,
-	0xA4, 0xC3, 0xCF, 0x94, 0x97, 0x96, 0xAC, 0xEF, 0xC9, 0xBC, 0xC7, 0x3A,
-	0x38, 0x60, 0x59, 0x0F, 0x04, 0x37, 0x0C, 0x9C, 0x05, 0xA1, 0x67, 0x84,
-	0xA7, 0xC6, 0x53, 0x39, 0xA1, 0x3C, 0x28, 0xCB, 0x2A, 0xD0, 0x34, 0x9D,
-	0xDF, 0x30, 0x2C, 0x22, 0x06, 0x1F, 0x03, 0xFA, 0xD6, 0xB3, 0xB1, 0x86,
-	0xF2, 0x93, 0x25, 0x7A, 0x80, 0xD3, 0x0E, 0x76, 0xB5, 0x61, 0x3B, 0x0F,
-	0xE4, 0x1F, 0xA0, 0xAC, 0x02, 0x6E, 0x11, 0x18, 0x36, 0x30, 0x3B, 0xB3,
-	0xC4, 0x57, 0x42, 0x3E, 0x72, 0xE8, 0x0E, 0x5E, 0xEF, 0x63, 0xF2, 0x3B,
-	0xC7, 0xFC, 0x15, 0x46, 0x5E, 0x70, 0x7D, 0xE5, 0x44, 0x17, 0xEF, 0x1A,
-	0x39, 0xC0, 0xC1, 0xB4, 0x00, 0xBF, 0x07, 0x1B, 0x12, 0x2E, 0xB3, 0x40,
-	0x3B, 0x76, 0xDC, 0xD6, 0x70, 0x98, 0xC2, 0xF9, 0x8F, 0x70, 0xD5, 0x46,
-	0x5C, 0x4C, 0x0C, 0xE5, 0xA8, 0xA1, 0xF4, 0x20, 0x07, 0xA1, 0x6A, 0x2C,
-	0x3B, 0xF7, 0x3B, 0x48, 0x63, 0xA9, 0x4C, 0x8A, 0x2E, 0xD0, 0xE2, 0x80,
-	0xE6, 0x24, 0xAC, 0x55, 0x99, 0x8C, 0x85, 0xCC, 0x28, 0x21, 0x53, 0x6A,
-	0x03, 0xEB, 0xA6, 0x9B, 0x19, 0x46, 0x25, 0xF4, 0xA2, 0x2E, 0x6D, 0xF5,
-	0x21, 0x85, 0xE9, 0x22, 0x70, 0x37, 0x32, 0x1C, 0x4A, 0xE1, 0xB1, 0x0C,
-	0xB4, 0x2B, 0x38, 0x3F, 0x7A, 0xFA, 0xA3, 0x88, 0x1F, 0x3F, 0x78, 0x26,
-	0x7F, 0x0C, 0x7C, 0xFC, 0x63, 0xC3, 0x29, 0x81, 0x87, 0x3B, 0xB8, 0x8B,
-	0x02, 0xCC, 0x61, 0xB1, 0x80, 0x49, 0xDF, 0x30, 0x18, 0x2B, 0xBD, 0xC4,
-	0x93, 0xFE, 0xC3, 0x30, 0xFC, 0xBB, 0x25, 0x4E, 0x1C, 0xD1, 0xC3, 0x7F,
-	0xED, 0x40, 0x0A, 0x9B, 0xCC, 0x31, 0x98, 0xC0, 0xF2, 0x1C, 0xF6, 0x7D,
-	0x61, 0xE1, 0x21, 0x89, 0x63, 0x92, 0x4C, 0xD1, 0xD8, 0xE1, 0x8D, 0x25,
-	0x34, 0x81, 0xB8, 0x55, 0xC6, 0xAD, 0x72, 0xB3, 0x11, 0x4E, 0x41, 0xF8,
-	0x7A, 0x0A, 0x3C, 0x79, 0x70, 0x3D, 0x65, 0x6A, 0x52, 0xB0, 0x1E, 0x35,
-	0x8E, 0xC6, 0x78, 0x1A, 0x94, 0x5E, 0xD4, 0x9D, 0x5B, 0xC5, 0x04, 0x1C,
-	0xCA, 0x5E, 0xA1, 0xF2, 0x81, 0x01, 0x90, 0xE5, 0x70, 0xDD, 0x17, 0xE4,
-	0x4C, 0xD8, 0x0D, 0x95, 0x7D, 0xB0, 0xD4, 0x47, 0x4F, 0xBB, 0x51, 0x4C,
-	0xEB, 0x89, 0xF2, 0xCE, 0x68, 0x9A, 0x88, 0x25, 0xDB, 0x1A, 0x6C, 0xD5,
-	0xE2, 0xCD, 0xEF, 0x83, 0xCF, 0x18, 0x50, 0x38, 0x9F, 0x18, 0xF2, 0x8F,
-	0x96, 0xDD, 0x5B, 0xCB, 0xD2, 0x38, 0x9E, 0x6F, 0x5B, 0xBE, 0xFC, 0x8B,
-	0x70, 0xF6, 0x57, 0x0B, 0xDE, 0x91, 0xCF, 0x03, 0x65, 0x06, 0x61, 0x1E,
-	0xD8, 0x4C, 0x85, 0xC9, 0xC4, 0xD2, 0x4F, 0x94, 0x69, 0xBF, 0x43, 0xD3,
-	0x70, 0x14, 0x8E, 0x6B, 0xE1, 0x53, 0xE5, 0x89, 0x9D, 0xF2, 0x53, 0x0B,
-	0x73, 0xA7, 0xB8, 0x58, 0xB8, 0x4D, 0x94, 0x30, 0x55, 0x34, 0x87, 0x2C,
-	0xC0, 0x0F, 0xA9, 0x72, 0x23, 0x90, 0xB4, 0x2D, 0xD3, 0x5D, 0xC2, 0xAF,
-	0x5E, 0x78, 0x09, 0x2D, 0xBB, 0x44, 0x99, 0x5F, 0x0B, 0xA1, 0x67, 0x30,
-	0x41, 0xD0, 0xCA, 0x52, 0x1F, 0x3C, 0xC1, 0x39, 0x9A, 0x46, 0x78, 0x6D,
-	0x2C, 0xAF, 0x85, 0x27, 0xDD, 0x07, 0xA2, 0x0A, 0xC6, 0x01, 0xD2, 0x44,
-	0xE9, 0xC5, 0x8E, 0xDE, 0x4D, 0x44, 0x7C, 0x26, 0x50, 0x3B, 0xF6, 0x5B,
-	0x78, 0x5E, 0xC2, 0x66, 0xA3, 0xA4, 0xB5, 0xD0, 0x13, 0xB8, 0xEE, 0x77,
-	0xDF, 0xD1, 0x1B, 0xED, 0xFC, 0x03, 0x9F, 0xCB, 0x96, 0xE5, 0xAB, 0xB2,
-	0x69, 0x95, 0x78, 0x26, 0xCC, 0x6E, 0x0C, 0x67, 0x17, 0xC2, 0xE2, 0x47,
-	0xB8, 0xFE, 0xA3, 0xC5, 0xCE, 0x3C, 0x9F, 0x0F, 0x70, 0x9F, 0xC0, 0x6E,
-	0x02, 0x57, 0x43, 0x21, 0x4F, 0x0D, 0x62, 0x80, 0x53, 0xCC, 0xEE, 0xB9,
-	0xA5, 0xF8, 0xD2, 0x19, 0x53, 0x8A, 0x3E, 0x44, 0xAC, 0x1D, 0xC7, 0x31,
-	0xD4, 0xD3, 0x40, 0x7F, 0x0E, 0xD5, 0x47, 0x43, 0x3B, 0x8B, 0xA8, 0xAC,
-	0x22, 0x21, 0x42, 0xDB, 0x9A, 0x00, 0x54, 0x55, 0x4C, 0xBD, 0xAC, 0x99,
-	0xED, 0xE1, 0xAA, 0x74, 0xE4, 0x3E, 0x62, 0xA7, 0x5D, 0xBA, 0x65, 0xD7,
-	0x87, 0xC4, 0x2B, 0xA7, 0x53, 0x4B, 0x62, 0x02, 0xBD, 0x21, 0x0C, 0x73,
-	0xA5, 0x14, 0x30, 0xAD, 0x21, 0x42, 0x48, 0x12, 0x4F, 0xAF, 0x0F, 0x66,
-	0x01, 0xC6, 0x43, 0xDA, 0x74, 0x73, 0xC0, 0x30, 0x28, 0x71, 0x25, 0x84,
-	0x17, 0xA5, 0x38, 0x42, 0xB1, 0x15, 0xEA, 0xA3, 0x90, 0x68, 0x60, 0x74,
-	0x16, 0x91, 0x0C, 0x94, 0xDA, 0x2B, 0xA1, 0x70, 0xF4, 0x1A, 0x18, 0x5C,
-	0x42, 0xF6, 0x07, 0x90, 0x0B, 0x88, 0x2D, 0x4C, 0xD3, 0x40, 0x32, 0x6C,
-	0xF8, 0x6B, 0x22, 0xFC, 0x7A, 0x6F, 0x79, 0xFA, 0x4B, 0xA0, 0xFF, 0x49,
-	0xC9, 0xF7, 0x8E, 0x1F, 0x12, 0xC8, 0x13, 0xE5, 0x39, 0x87, 0x22, 0x33,
-	0x18, 0xB1, 0xC4, 0x0A, 0xA7, 0xD6, 0xB3, 0x5E, 0x5B, 0x74, 0x17, 0xD8,
-	0xEC, 0x95, 0xD3, 0xD1, 0x50, 0xE0, 0x78, 0x5E, 0x08, 0xFB, 0x4C, 0x89,
-	0x2C, 0xC4, 0x99, 0xA2, 0x3D, 0xD8, 0x19, 0x30, 0x0D, 0x84, 0xB2, 0x33,
-	0x8A, 0x2C, 0x7A, 0x70, 0x66, 0x94, 0xFA, 0xE8, 0x30, 0x0A, 0xCE, 0x40,
-	0x13, 0xC3, 0x3E, 0x51, 0x1E, 0xAC, 0xA3, 0x2D, 0x22, 0x0E, 0xAF, 0x4A,
-	0xB5, 0xEF, 0x3E, 0xD7, 0x1E, 0x15, 0xA7, 0x8E, 0x13, 0xBF, 0x9F, 0x04,
-	0x22, 0xA1, 0x17, 0x43, 0xDA, 0x57, 0xB2, 0xB9, 0x61, 0xFE, 0x46, 0xC9,
-	0xC6, 0x9E, 0x6F, 0x07, 0xC3, 0x57, 0xA7, 0xDC, 0x7F, 0x13, 0x64, 0xE9,
-	0x19, 0xA2, 0x8C, 0xA7, 0x86, 0xCB, 0xCC, 0x72, 0x46, 0x20, 0x7B, 0x74,
-	0xD4, 0x0F, 0x29, 0x52, 0xB6, 0x9C, 0x88, 0xA1, 0xEF, 0xD0, 0xFF, 0x12,
-	0xD0, 0x73, 0x4F, 0x34, 0x0C, 0x9C, 0x8D, 0xE1, 0x22, 0x57, 0x5A, 0x62,
-	0x0E, 0x91, 0xE7, 0x79, 0x16, 0xF0, 0x71, 0x42, 0xB3, 0x37, 0x1C, 0x2A,
-	0x4F, 0xBB, 0xF2, 0x54, 0xDF, 0x5B, 0xEC, 0xAD, 0xC0, 0x3D, 0x14, 0xB5,
-	0x27, 0xEA, 0x43, 0xF4, 0xF1, 0x9F, 0x2D, 0xA7, 0x4B, 0x88, 0xC6, 0x9D,
-	0xE6, 0x7E, 0xBE, 0x88, 0x48, 0xE3, 0x88, 0x63, 0xED, 0xB0, 0xA7, 0x9A,
-	0xFA, 0x14, 0xA8, 0x05, 0xB6, 0xC7, 0x1A, 0x53, 0x29, 0xBD, 0xCE, 0x7E,
-	0x47, 0x54, 0x05, 0xEA, 0x4A, 0x69, 0x33, 0x70, 0x56, 0xB0, 0xC6, 0x74,
-	0x56, 0xE5, 0xBE, 0x30, 0x9F, 0x2B, 0x3E, 0x33, 0xBC, 0x94, 0x16, 0xDF,
-	0x2A, 0xEA, 0x02, 0x73, 0x23, 0x88, 0x31, 0x1C, 0xF3, 0xC0, 0x4B, 0x5F,
-	0x49, 0xAA, 0x2E, 0x37, 0x58, 0xAD, 0xA1, 0x78, 0x0C, 0x6C, 0x9E, 0x95,
-	0x72, 0x03, 0xEA, 0xC0, 0xA5, 0xE0, 0x63, 0x90, 0x8D, 0xD2, 0x56, 0xC2,
-	0x6B, 0xE5, 0xE9, 0xF7, 0xE0, 0x7A, 0x06, 0x57, 0x7F, 0xB2, 0x24, 0xFF,
-	0x49, 0xD9, 0x8C, 0x95, 0xA6, 0x34, 0xB8, 0x63, 0x40, 0x5F, 0x85, 0x6A,
-	0x1D, 0xD8, 0x7D, 0x85, 0xE6, 0x09, 0x7C, 0x06, 0xC9, 0x9F, 0x22, 0xDE,
-	0x4F, 0xE0, 0xFA, 0x32, 0xF0, 0x78, 0x0E, 0xF7, 0xA9, 0xE5, 0xB1, 0x80,
-	0xE7, 0xA7, 0x96, 0x62, 0x05, 0xD5, 0x52, 0x58, 0x3C, 0x07, 0x22, 0x55,
-	0xC6, 0x7D, 0xC7, 0xF0, 0x2D, 0x14, 0x1F, 0x60, 0x99, 0x59, 0x54, 0x22,
-	0x16, 0xE2, 0x79, 0xCC, 0x1D, 0xF7, 0xA9, 0xE5, 0xD0, 0x04, 0xEA, 0x83,
-	0x72, 0x5D, 0x0A, 0x13, 0x93, 0x90, 0x1A, 0x43, 0x1D, 0x95, 0x88, 0x31,
-	0x04, 0x15, 0xCA, 0x93, 0xB2, 0xDA, 0xC1, 0x83, 0x0F, 0x14, 0xA5, 0xC3,
-	0x55, 0x01, 0x5B, 0x41, 0xD4, 0x76, 0xE7, 0xF3, 0x89, 0x85, 0x5A, 0xC1,
-	0x8E, 0x0C, 0xA3, 0x89, 0x25, 0x49, 0x1C, 0x79, 0x66, 0xC9, 0x07, 0x09,
-	0x93, 0xA4, 0x65, 0x7B, 0x32, 0xBC, 0x96, 0x81, 0x25, 0x42, 0x11, 0x2B,
-	0xB3, 0x1E, 0x8C, 0x02, 0x5C, 0x45, 0x81, 0x69, 0x2C, 0x48, 0xDD, 0x1D,
-	0xE3, 0x8E, 0x2F, 0x15, 0xB5, 0x87, 0xE1, 0x1B, 0x47, 0xF2, 0x51, 0x99,
-	0xDC, 0x58, 0xEC, 0x34, 0x70, 0xA0, 0x8B, 0xDC, 0xF7, 0x8A, 0x80, 0xC9,
-	0x2D, 0x51, 0x2F, 0xA2, 0xB6, 0x0D, 0xB5, 0x31, 0xBC, 0xEC, 0xE0, 0xF8,
-	0xAD, 0xC5, 0xBD, 0x40, 0xB5, 0x02, 0xB3, 0x35, 0xF8, 0x44, 0x48, 0x67,
-	0x86, 0xCB, 0x73, 0x25, 0x7A, 0xFB, 0x7F, 0x09, 0x2F, 0xB9, 0x92, 0x84,
-	0x88, 0xF7, 0xD2, 0xB0, 0x70, 0x2D, 0xFE, 0xD1, 0xF0, 0x7A, 0x2F, 0xC8,
-	0x6B, 0x20, 0xB8, 0xCE, 0xAE, 0xAD, 0x03, 0xA5, 0x9D, 0x1A, 0xE4, 0xC2,
-	0xA0, 0x65, 0xA0, 0x78, 0x36, 0xEC, 0x37, 0x0E, 0xEB, 0xA1, 0x6F, 0x84,
-	0xFE, 0x24, 0x70, 0x9E, 0xC3, 0xF9, 0x38, 0x22, 0xCF, 0x1D, 0xEB, 0x16,
-	0x4E, 0xBB, 0x80, 0x2B, 0x03, 0x55, 0xAD, 0xE4, 0x02, 0x83, 0x5A, 0x39,
-	0xBA, 0x6E, 0x90, 0xB1, 0x27, 0xE1, 0xF8, 0x6C, 0x08, 0x8F, 0xC2, 0xE9,
-	0x29, 0xB0, 0x29, 0xA0, 0x29, 0xC0, 0x04, 0x21, 0x4A, 0x14, 0x32, 0x68,
-	0x1B, 0xCF, 0x71, 0x24, 0x54, 0x67, 0x31, 0x1F, 0x16, 0x2D, 0x6F, 0x6E,
-	0xE0, 0xED, 0x1B, 0x83, 0x9B, 0x46, 0x1C, 0xDA, 0x86, 0xD5, 0x16, 0x9E,
-	0xBF, 0x5B, 0x4E, 0x5F, 0x03, 0x2F, 0x2B, 0xC8, 0x9A, 0xC0, 0xF5, 0xC4,
-	0xB0, 0xB8, 0x89, 0x49, 0x2F, 0x3C, 0x21, 0x51, 0xA4, 0x89, 0x18, 0x94,
-	0x01, 0xB3, 0xF2, 0x2C, 0x5F, 0x94, 0xBB, 0x3B, 0x61, 0x52, 0x28, 0x79,
-	0xE3, 0x99, 0x9F, 0xE0, 0x43, 0x80, 0x7D, 0x0C, 0x87, 0x1C, 0x5E, 0xDF,
-	0x2B, 0xDB, 0x4B, 0xC3, 0xD2, 0xC1, 0xF9, 0x2E, 0x70, 0xAD, 0xF0, 0x5B,
-	0x1E, 0xB8, 0x4F, 0x94, 0x54, 0x85, 0x33, 0x6F, 0x38, 0x35, 0x81, 0x97,
-	0x83, 0x52, 0x2D, 0x7B, 0xF8, 0x27, 0x47, 0xD4, 0x80, 0xE0, 0x30, 0xCE,
-	0xD0, 0xB3, 0x42, 0x9C, 0x29, 0x32, 0x4C, 0x28, 0x06, 0x8E, 0xB2, 0x09,
-	0x68, 0xD3, 0xC5, 0xD6, 0x7F, 0x88, 0x20, 0xEE, 0x29, 0xD3, 0x89, 0xC7,
-	0x0F, 0x95, 0x5A, 0x60, 0xBC, 0x6D, 0x69, 0xBE, 0x1B, 0xB6, 0xFB, 0x80,
-	0xD4, 0x5D, 0x1E, 0xB1, 0xFC, 0xC9, 0x10, 0x2E, 0x22, 0x46, 0x7B, 0xCF,
-	0xBB, 0x4A, 0x49, 0xA3, 0xC0, 0x41, 0x61, 0xD5, 0x0A, 0xC5, 0xEF, 0x83,
-	0xE1, 0xBB, 0x42, 0xD1, 0x23, 0xF4, 0xD7, 0x31, 0xB6, 0x51, 0xDA, 0xB6,
-	0xE6, 0x74, 0xEC, 0x86, 0x41, 0x22, 0x87, 0x4D, 0x05, 0x17, 0xC3, 0x6E,
-	0xD5, 0x10, 0x7D, 0x83, 0xDE, 0x0E, 0xFA, 0x0A, 0xC9, 0x02, 0x8A, 0x37,
-	0x81, 0xA4, 0x27, 0xDC, 0x5C, 0x28, 0x37, 0xD7, 0x10, 0x9D, 0x7A, 0xE0,
-	0x97, 0x9E, 0x71, 0x0B, 0xE7, 0x0A, 0x71, 0xA1, 0x3C, 0xDD, 0x56, 0xD4,
-	0x6B, 0x98, 0x94, 0xD0, 0x17, 0x21, 0x9D, 0x42, 0x3E, 0x11, 0xFC, 0x14,
-	0xD2, 0x71, 0xA0, 0x28, 0x0D, 0x4B, 0x55, 0xD6, 0x01, 0x7A, 0x2D, 0xCC,
-	0xC7, 0x30, 0xBA, 0x86, 0xE1, 0xD8, 0x92, 0xC6, 0x8E, 0xEA, 0xA0, 0x1C,
-	0x56, 0xCA, 0x71, 0x09, 0xBE, 0xA0, 0xB3, 0x88, 0x39, 0x18, 0x03, 0xB3,
-	0x2D, 0x2C, 0x63, 0x38, 0x1E, 0x60, 0xBD, 0x6C, 0x99, 0xBD, 0x76, 0x38,
-	0xB6, 0xAD, 0x81, 0xB2, 0x2F, 0xD8, 0x23, 0x0C, 0x1B, 0x18, 0xE5, 0x30,
-	0x1E, 0x43, 0xF9, 0x46, 0xE9, 0xFD, 0xEC, 0xB9, 0x78, 0x67, 0x49, 0xC7,
-	0x42, 0xE3, 0xA1, 0xFA, 0xEE, 0x28, 0x1F, 0x95, 0xE7, 0xB5, 0xF2, 0xB2,
-	0x54, 0x42, 0x01, 0x3D, 0x81, 0x3F, 0x5F, 0xC0, 0xF9, 0x35, 0x9C, 0x5D,
-	0x2B, 0x75, 0xE4, 0xB9, 0x7B, 0x30, 0xB4, 0x77, 0x81, 0xE3, 0xCE, 0x73,
-	0x7F, 0x10, 0x5E, 0x54, 0x29, 0xAD, 0x30, 0xB9, 0x86, 0xB8, 0x2F, 0x44,
-	0x55, 0xCC, 0xF8, 0xD5, 0xF3, 0x36, 0xF1, 0xBC, 0x4E, 0x0C, 0x12, 0x29,
-	0x07, 0xE7, 0xB8, 0x6B, 0x95, 0xF7, 0x07, 0xC8, 0x4A, 0xB8, 0x6A, 0x94,
-	0xFA, 0x02, 0xEC, 0x24, 0xE2, 0x14, 0x02, 0xB7, 0xCF, 0x2D, 0xFA, 0x62,
-	0x90, 0x5F, 0x63, 0x5E, 0x56, 0x9E, 0x51, 0x30, 0x44, 0x43, 0xB8, 0x5C,
-	0x18, 0xDE, 0xCE, 0x0C, 0x83, 0x51, 0x60, 0xE9, 0x3A, 0xE8, 0xC5, 0x12,
-	0xB0, 0x22, 0xF4, 0x62, 0x61, 0x12, 0x05, 0x26, 0xAA, 0x24, 0x6B, 0x28,
-	0xB7, 0xC2, 0xBA, 0xF2, 0x6C, 0x57, 0xC0, 0xAB, 0xA1, 0x2E, 0x02, 0xF4,
-	0x60, 0xF4, 0x33, 0x6C, 0xDF, 0x1B, 0xF8, 0xA3, 0x21, 0xAA, 0x04, 0xF7,
-	0x10, 0x48, 0xF6, 0x9E, 0xAD, 0x37, 0x2C, 0x2F, 0x20, 0x0C, 0xBA, 0xD4,
-	0x6F, 0x2C, 0x9D, 0x2B, 0xFA, 0x74, 0xD7, 0x52, 0x25, 0x90, 0x5B, 0x30,
-	0x09, 0x84, 0xCA, 0xD0, 0xEC, 0x02, 0x75, 0xAD, 0x50, 0x75, 0xFA, 0x4D,
-	0x92, 0xC2, 0xCD, 0x05, 0xBC, 0x9D, 0x46, 0xEC, 0x17, 0x86, 0x2F, 0x93,
-	0x96, 0x38, 0x15, 0xCE, 0xD2, 0x88, 0xD8, 0x7A, 0xA2, 0x87, 0xFF, 0xDB,
-	0xB3, 0xAF, 0x60, 0x9A, 0x79, 0xF2, 0xB4, 0xFB, 0xD1, 0x0F, 0x2D, 0x94,
-	0x03, 0x21, 0x1F, 0x5B, 0xA2, 0xD4, 0x33, 0x19, 0x18, 0x38, 0x13, 0x8E,
-	0x03, 0x4F, 0x89, 0xF2, 0x35, 0x52, 0x4E, 0xB9, 0x72, 0x9C, 0x75, 0x14,
-	0xCB, 0xB7, 0xC3, 0xC0, 0x28, 0xB6, 0xB4, 0x12, 0xB1, 0xDD, 0xD7, 0xEC,
-	0x9E, 0xE0, 0x74, 0x0F, 0xBA, 0xEF, 0xD4, 0xAD, 0x0A, 0xD8, 0x7A, 0xCB,
-	0x70, 0x6F, 0x99, 0xBE, 0x28, 0x43, 0xDB, 0xF2, 0xAA, 0x0A, 0x35, 0x4C,
-	0x5A, 0xC8, 0x14, 0x06, 0xC1, 0xB0, 0x4C, 0x02, 0x51, 0x1F, 0x16, 0x7D,
-	0xE1, 0xFA, 0x52, 0x18, 0xBD, 0x17, 0xDC, 0x8F, 0x1E, 0xB9, 0x0A, 0x0C,
-	0xD2, 0x0E, 0x4D, 0x77, 0xF7, 0x25, 0xD0, 0x7C, 0x71, 0x9C, 0x36, 0xE0,
-	0x81, 0x28, 0x35, 0x24, 0x67, 0xC2, 0x62, 0x60, 0xB8, 0x99, 0x78, 0xFA,
-	0x46, 0x29, 0x1F, 0x94, 0x87, 0x4D, 0xB7, 0xB7, 0xEF, 0x6D, 0x1D, 0xD2,
-	0x42, 0x14, 0x94, 0xF3, 0x33, 0x18, 0xFD, 0x49, 0xC9, 0x7E, 0x14, 0xAA,
-	0x38, 0xE6, 0xF9, 0x09, 0xCE, 0x3E, 0x2B, 0xB3, 0x1A, 0x3E, 0x7A, 0x65,
-	0xFD, 0x19, 0xEA, 0xA0, 0xA8, 0x80, 0x06, 0x4B, 0x22, 0x96, 0x1F, 0xEA,
-	0x86, 0x0C, 0xC3, 0xF1, 0x68, 0x79, 0x28, 0x0D, 0xCF, 0xDF, 0x3D, 0xA7,
-	0xBF, 0x05, 0xE4, 0xB1, 0x66, 0xE8, 0xE0, 0xBC, 0xEF, 0xB9, 0xCC, 0xBA,
-	0xEC, 0x62, 0x3F, 0x72, 0x48, 0x03, 0xB2, 0x85, 0xC3, 0x01, 0x8E, 0xA1,
-	0xD3, 0x35, 0x42, 0x64, 0x89, 0x0B, 0xC1, 0xEE, 0x15, 0xB7, 0x8A, 0xF0,
-	0x47, 0x87, 0x0B, 0xCA, 0x1A, 0xC0, 0x07, 0xB2, 0xC8, 0x12, 0x65, 0xCA,
-	0x75, 0x1D, 0x88, 0x4F, 0x9E, 0xFA, 0xC6, 0xE3, 0x16, 0x86, 0xEF, 0x03,
-	0x65, 0x70, 0x0F, 0xCF, 0x47, 0xE5, 0xB0, 0xE8, 0xC0, 0x97, 0x59, 0x6D,
-	0x48, 0x96, 0x1E, 0x57, 0x58, 0xDA, 0x7D, 0xC0, 0x58, 0x65, 0x32, 0x85,
-	0xC1, 0x48, 0x08, 0x1A, 0xB1, 0x3D, 0x7A, 0x5E, 0x96, 0x1E, 0x1A, 0xB8,
-	0x58, 0x04, 0x6E, 0xDE, 0xC3, 0x87, 0x4B, 0x61, 0xB1, 0x00, 0x33, 0xED,
-	0x58, 0x08, 0xAE, 0x51, 0x8E, 0xB7, 0xCA, 0xE6, 0x56, 0x88, 0xDC, 0x7F,
-	0x53, 0xD2, 0x39, 0x0C, 0xDF, 0x0B, 0xE9, 0x2C, 0x22, 0x1D, 0x06, 0x66,
-	0xE2, 0x09, 0xB1, 0x52, 0xDB, 0x40, 0x6E, 0x84, 0x89, 0x15, 0x7C, 0x16,
-	0x68, 0x83, 0x52, 0x02, 0x47, 0x07, 0x07, 0x27, 0xD0, 0x2A, 0x17, 0x2D,
-	0x9C, 0xA9, 0x30, 0x72, 0x86, 0x6F, 0x69, 0xC3, 0x6E, 0x0F, 0xA7, 0x47,
-	0xA1, 0xDE, 0x4B, 0xA7, 0x09, 0x08, 0x14, 0x56, 0x78, 0x0D, 0x86, 0xB4,
-	0xF1, 0x68, 0x0D, 0x03, 0x03, 0xF9, 0x04, 0xEA, 0x99, 0x70, 0x18, 0x28,
-	0xF3, 0x12, 0xB2, 0xA0, 0x64, 0x63, 0x18, 0x5C, 0xC3, 0x8F, 0x97, 0x11,
-	0x3F, 0x2D, 0x3C, 0xF1, 0xD4, 0x53, 0x66, 0x86, 0xDD, 0xC6, 0xB0, 0x5C,
-	0x39, 0x1E, 0xEF, 0x1B, 0x9A, 0x47, 0x18, 0x1D, 0x0D, 0x79, 0x8F, 0x2E,
-	0xB0, 0x32, 0xFA, 0xDD, 0x2A, 0xEE, 0x3D, 0xAC, 0x03, 0x6E, 0x2F, 0x3C,
-	0x6E, 0x3D, 0xDF, 0x1A, 0x25, 0x12, 0xF8, 0x30, 0x37, 0x2C, 0x44, 0x18,
-	0x88, 0x67, 0x38, 0x15, 0x9A, 0x2B, 0xC3, 0xE9, 0x46, 0xF8, 0x3E, 0x70,
-	0x3C, 0x8D, 0x02, 0xFF, 0x14, 0xC1, 0xF9, 0xCA, 0x22, 0x07, 0x0F, 0x5F,
-	0xA0, 0xBF, 0x87, 0x51, 0x6E, 0x09, 0x97, 0x8A, 0x8F, 0x1D, 0xC3, 0x3D,
-	0xF0, 0x1A, 0xF1, 0x9B, 0x57, 0xBE, 0x16, 0x0D, 0x77, 0x9B, 0xEE, 0xEE,
-	0x93, 0x31, 0x7C, 0x1C, 0xC0, 0x1F, 0x15, 0x7E, 0x71, 0x42, 0xF2, 0x1C,
-	0xD8, 0x17, 0x50, 0x36, 0xB0, 0x2B, 0xBB, 0x77, 0x3E, 0x91, 0xA0, 0x59,
-	0xC0, 0xD9, 0x40, 0x7B, 0x10, 0x8A, 0x02, 0x8E, 0x87, 0x96, 0xB8, 0x56,
-	0x52, 0x85, 0x61, 0x0C, 0xED, 0x40, 0x18, 0x4F, 0x41, 0xFA, 0x42, 0x1B,
-	0x09, 0xE3, 0x42, 0x89, 0x5F, 0xE8, 0x42, 0x25, 0x4E, 0x78, 0x31, 0x1D,
-	0xCE, 0x4E, 0x27, 0x16, 0x5D, 0x04, 0xAA, 0x10, 0xF0, 0xF3, 0x88, 0xD3,
-	0xD7, 0x18, 0x59, 0x55, 0x0C, 0x62, 0xB8, 0x98, 0x1B, 0xC6, 0xFD, 0x84,
-	0x65, 0xA1, 0xFC, 0x6B, 0xAB, 0x3C, 0xD6, 0xDD, 0xC6, 0x75, 0x71, 0x61,
-	0x58, 0x9C, 0x47, 0x24, 0xB9, 0x10, 0xA8, 0x41, 0x0C, 0xAD, 0x0A, 0xCB,
-	0x97, 0xC0, 0xE1, 0xDF, 0x1C, 0xD1, 0xBF, 0x41, 0xF4, 0x4F, 0x31, 0xEC,
-	0xC6, 0x42, 0x75, 0x29, 0xEC, 0x3E, 0x08, 0x49, 0x64, 0x48, 0xF6, 0x1E,
-	0x69, 0x0C, 0x55, 0x1B, 0x40, 0x2D, 0x91, 0xB5, 0x64, 0x0A, 0x65, 0x13,
-	0x38, 0x45, 0x50, 0xD7, 0x42, 0xB1, 0x03, 0xD6, 0x8A, 0x1E, 0x84, 0x79,
-	0x30, 0xCC, 0xE2, 0xC0, 0x2A, 0x51, 0x68, 0x04, 0x39, 0x24, 0x20, 0x1E,
-	0x93, 0x06, 0x9A, 0x04, 0x76, 0xB1, 0xE1, 0x21, 0x0D, 0x18, 0xF5, 0x8C,
-	0xCB, 0x2E, 0x0A, 0xDE, 0x9B, 0x83, 0x9B, 0x08, 0x95, 0x11, 0x8E, 0x4E,
-	0x01, 0xE5, 0xC7, 0x91, 0x70, 0xF5, 0x31, 0xE1, 0xE7, 0x73, 0x98, 0x60,
-	0xD8, 0x6F, 0x0C, 0xDB, 0xBF, 0x04, 0x5E, 0x1E, 0x1C, 0xF7, 0x7B, 0x28,
-	0x9A, 0x88, 0x34, 0x52, 0xF2, 0xB9, 0x67, 0x32, 0x32, 0xD4, 0x3D, 0x43,
-	0xE3, 0x1D, 0x45, 0x11, 0x48, 0xB6, 0x42, 0x7B, 0x82, 0xE0, 0x3A, 0xA9,
-	0x99, 0x09, 0x64, 0x0B, 0x43, 0x76, 0x66, 0xE8, 0x11, 0x21, 0x6B, 0x25,
-	0xAD, 0x95, 0x78, 0x6B, 0xD8, 0xBD, 0xC2, 0x73, 0x0E, 0xEB, 0x1B, 0x78,
-	0x1D, 0x09, 0xFE, 0xC1, 0xF0, 0xF8, 0xDF, 0x94, 0xF6, 0x7B, 0xE0, 0x6A,
-	0x69, 0x98, 0x8D, 0x2D, 0x51, 0xEB, 0xD1, 0x54, 0x28, 0x6B, 0xD8, 0x9C,
-	0x5A, 0xDA, 0x83, 0x32, 0x34, 0x86, 0xC1, 0xC0, 0xC2, 0x07, 0x4F, 0xF8,
-	0xD0, 0x89, 0x3C, 0xE6, 0xDE, 0x90, 0xFC, 0x1A, 0x68, 0x5F, 0x03, 0xDB,
-	0xD0, 0x51, 0x3F, 0xD6, 0x71, 0x27, 0xA2, 0x91, 0x0A, 0x59, 0x2D, 0x4C,
-	0x53, 0x25, 0x8D, 0x94, 0xC3, 0x02, 0xF6, 0x0B, 0x21, 0x77, 0x96, 0xFE,
-	0x51, 0x99, 0x35, 0x5D, 0xBC, 0x6D, 0x38, 0x56, 0x34, 0x05, 0x9B, 0x74,
-	0x8F, 0xF2, 0xF9, 0x2B, 0xF4, 0xD6, 0x86, 0xDD, 0x51, 0x39, 0xD4, 0x90,
-	0xA5, 0x86, 0xD1, 0xC8, 0x80, 0x85, 0x75, 0x1E, 0xD8, 0x0B, 0xD4, 0x75,
-	0x43, 0x1E, 0x29, 0x57, 0x22, 0xF4, 0xA2, 0x88, 0xE3, 0xC6, 0xF2, 0xE9,
-	0xB6, 0xE2, 0xAF, 0xCB, 0xC0, 0xCA, 0x0B, 0x83, 0x4C, 0xE9, 0xF5, 0x23,
-	0xF0, 0x96, 0x5D, 0xD1, 0xD0, 0x54, 0x50, 0x38, 0x43, 0x4D, 0xA0, 0x78,
-	0x00, 0x7D, 0x85, 0xF3, 0x00, 0xD1, 0x3F, 0xFF, 0x9F, 0x11, 0xFB, 0xC4,
-	0xF3, 0x8F, 0x9E, 0xB2, 0x29, 0x1D, 0xAB, 0x5E, 0xC7, 0x9E, 0xDB, 0xAC,
-	0x05, 0x5B, 0x0A, 0x4D, 0xA4, 0xCC, 0x06, 0x8E, 0x58, 0xBA, 0xF8, 0xD5,
-	0xBE, 0x16, 0xAA, 0x03, 0x6C, 0xCB, 0x40, 0x5A, 0x40, 0xF4, 0xDC, 0x0D,
-	0x54, 0x33, 0x81, 0x45, 0x92, 0x72, 0x67, 0x03, 0xFB, 0xC4, 0x01, 0x1D,
-	0xDC, 0xA9, 0x97, 0x0B, 0xC9, 0x34, 0x10, 0x52, 0x70, 0x3E, 0xA2, 0x74,
-	0xCA, 0x31, 0x82, 0x32, 0x0D, 0x54, 0xB3, 0x40, 0x34, 0xEF, 0x13, 0x12,
-	0xCF, 0x38, 0xB4, 0xCC, 0x25, 0xE1, 0x72, 0x64, 0xB1, 0xAE, 0xE2, 0xD3,
-	0x83, 0xE1, 0xEE, 0x5B, 0x60, 0xF3, 0x5D, 0x91, 0xC2, 0x13, 0x25, 0x1D,
-	0x65, 0xB3, 0x3F, 0x31, 0x98, 0xB4, 0x66, 0xAB, 0xC2, 0x7E, 0xEF, 0x58,
-	0xEF, 0x3A, 0x23, 0xC4, 0x1C, 0x61, 0x36, 0x56, 0xA2, 0xD4, 0x40, 0x22,
-	0xD8, 0x29, 0x44, 0x57, 0x9D, 0x21, 0x75, 0x53, 0xB7, 0x1C, 0x10, 0x46,
-	0x4F, 0x81, 0x9B, 0xAD, 0x63, 0xB0, 0x8C, 0x58, 0xF6, 0x23, 0xFE, 0x71,
-	0x11, 0xF8, 0x94, 0x1A, 0x4C, 0xAC, 0xAC, 0x4F, 0x01, 0x77, 0x30, 0x64,
-	0x07, 0xC3, 0x48, 0x5B, 0xCE, 0xC5, 0x70, 0x48, 0x60, 0xE3, 0x0C, 0x45,
-	0xED, 0x19, 0x78, 0xF8, 0x38, 0x86, 0xB3, 0xAB, 0x88, 0xF5, 0x3F, 0xC7,
-	0x2C, 0x2F, 0x04, 0x7F, 0xF4, 0xEC, 0x9E, 0x5B, 0x8E, 0xAE, 0x5B, 0x28,
-	0x6D, 0x4F, 0x70, 0x9F, 0xC2, 0x66, 0x24, 0xF0, 0x7B, 0xCE, 0x71, 0x3E,
-	0x80, 0x37, 0x23, 0x21, 0x1F, 0x1A, 0x6E, 0x53, 0x28, 0xD4, 0x53, 0xD7,
-	0x9E, 0xFE, 0xCA, 0x32, 0x3C, 0x42, 0x3F, 0x0A, 0x24, 0x01, 0x2A, 0x51,
-	0x92, 0x4C, 0x88, 0x32, 0x43, 0x5D, 0x0A, 0xC7, 0xE7, 0x40, 0xF5, 0x1C,
-	0x70, 0x02, 0xF1, 0x02, 0x06, 0xD6, 0x51, 0x1E, 0x84, 0x7A, 0x0C, 0x65,
-	0xCF, 0xA1, 0x63, 0x90, 0x14, 0xA2, 0xB2, 0x43, 0xFB, 0xDE, 0xDF, 0x06,
-	0xFE, 0xF5, 0xDE, 0x73, 0xBB, 0x01, 0x93, 0x2A, 0x93, 0x06, 0xD2, 0x4D,
-	0x0B, 0x34, 0x94, 0x43, 0xF0, 0x29, 0xB8, 0xAD, 0xE0, 0x1D, 0x1C, 0x6C,
-	0xB7, 0xAB, 0xF8, 0xE9, 0x26, 0x26, 0x8A, 0xFE, 0xB7, 0x3E, 0xE9, 0xFD,
-	0x81, 0xFE, 0x5A, 0x39, 0x9D, 0x94, 0x26, 0x33, 0x14, 0xC0, 0xC6, 0x7B,
-	0x7A, 0x74, 0x77, 0xD4, 0xB4, 0xB0, 0xA8, 0x57, 0x8A, 0x04, 0x12, 0xC0,
-	0x96, 0x8A, 0x73, 0xD0, 0x17, 0x88, 0x13, 0x41, 0x6A, 0x25, 0x3D, 0x40,
-	0x64, 0x5B, 0xAA, 0x54, 0x29, 0x52, 0x05, 0x01, 0x13, 0x09, 0xA3, 0x1C,
-	0xE6, 0x0B, 0xE5, 0xEC, 0xCC, 0xD0, 0x17, 0xCB, 0x8B, 0x77, 0xDC, 0x39,
-	0xCF, 0xCA, 0x83, 0x2C, 0x60, 0x70, 0x1E, 0x48, 0x52, 0x25, 0x76, 0xC0,
-	0xB1, 0xA5, 0x7D, 0x6C, 0x79, 0xB8, 0x0D, 0xFC, 0xFD, 0x25, 0xF0, 0xB0,
-	0x01, 0xEF, 0xE0, 0xCD, 0x58, 0xF8, 0x90, 0xC3, 0x30, 0xF7, 0x14, 0x38,
-	0x7E, 0xDB, 0xC3, 0xEA, 0x10, 0x68, 0x4F, 0x4A, 0xD4, 0x83, 0xF9, 0x35,
-	0xCC, 0xAE, 0x03, 0xB3, 0x5C, 0x70, 0x46, 0x28, 0x9A, 0xEE, 0x18, 0x15,
-	0x52, 0xCF, 0xC1, 0xC1, 0xAA, 0x55, 0x4E, 0xE3, 0xEE, 0xEE, 0xD2, 0x93,
-	0x21, 0x2B, 0x0C, 0xE9, 0xBF, 0xB7, 0xD4, 0x0F, 0xCA, 0x73, 0xAB, 0xB4,
-	0xDF, 0x41, 0xEE, 0x85, 0x45, 0x3F, 0x30, 0xBE, 0x09, 0xCC, 0x06, 0x30,
-	0xEF, 0x7B, 0x22, 0x81, 0x39, 0x86, 0x60, 0x15, 0x8D, 0xE1, 0x5C, 0x02,
-	0xD2, 0xF3, 0x3C, 0x34, 0x42, 0xBD, 0x56, 0x36, 0x45, 0x60, 0xEB, 0x02,
-	0x45, 0x2E, 0x94, 0x33, 0x61, 0x9D, 0x1B, 0x4E, 0x91, 0xA3, 0x9D, 0x06,
-	0xD2, 0x1B, 0xC8, 0xAE, 0xE1, 0xE2, 0x3C, 0x62, 0x1C, 0x07, 0x7C, 0x6D,
-	0x29, 0xD6, 0x11, 0x8F, 0xA7, 0x92, 0xB8, 0x51, 0x7A, 0x26, 0x60, 0xFA,
-	0x42, 0xEE, 0xBB, 0x57, 0xA9, 0xA9, 0x85, 0x5E, 0x2D, 0xF4, 0xAC, 0xF2,
-	0xE0, 0x94, 0xC2, 0x2B, 0xC3, 0x08, 0x16, 0x02, 0x43, 0x04, 0xFB, 0xAA,
-	0xB4, 0x75, 0x20, 0x8A, 0x61, 0xB6, 0x88, 0xF0, 0x57, 0x9E, 0x2A, 0x53,
-	0x9E, 0x83, 0x62, 0x1A, 0xCF, 0xB2, 0x81, 0xD7, 0x08, 0xDC, 0x5C, 0xE8,
-	0x59, 0x61, 0xD0, 0x04, 0x26, 0x3B, 0x65, 0x10, 0x43, 0x64, 0xC1, 0x15,
-	0xC2, 0x61, 0xE9, 0xA8, 0x5B, 0xC5, 0xBE, 0x35, 0xF0, 0x67, 0x48, 0xE7,
-	0x39, 0xD1, 0xE7, 0xB2, 0x66, 0x5B, 0x2A, 0x55, 0xD3, 0xAD, 0x27, 0x7D,
-	0xA4, 0x54, 0x39, 0xD8, 0x0C, 0xA4, 0x8A, 0x68, 0x4B, 0xA5, 0x59, 0x07,
-	0x86, 0x5B, 0x43, 0x2F, 0x13, 0x24, 0x12, 0xB4, 0x11, 0xD2, 0x10, 0x48,
-	0x26, 0xCA, 0x71, 0x0A, 0xCB, 0x95, 0x21, 0xFF, 0x1E, 0x38, 0xED, 0x03,
-	0x55, 0x04, 0x75, 0x04, 0xCD, 0x48, 0xC8, 0x66, 0x4A, 0x3E, 0x16, 0x16,
-	0x7D, 0xC3, 0x3C, 0x51, 0xC4, 0xB6, 0x6C, 0x9C, 0xF2, 0xC9, 0x43, 0x8D,
-	0xE5, 0xED, 0x29, 0xD0, 0xDB, 0xD6, 0x78, 0xE9, 0x64, 0xDB, 0xE6, 0xA5,
-	0x73, 0xD5, 0x1C, 0x36, 0x50, 0xF8, 0xEE, 0xAA, 0x8D, 0x26, 0x5D, 0xEA,
-	0x77, 0xE8, 0x95, 0x74, 0xE9, 0xF9, 0xDA, 0xC2, 0xBD, 0x28, 0xFB, 0x18,
-	0xAE, 0xCF, 0xE1, 0xEA, 0xAD, 0xF0, 0xE6, 0x27, 0xCB, 0xF9, 0x35, 0xD4,
-	0xB1, 0xB0, 0xDD, 0x28, 0xAF, 0x4B, 0x47, 0xB9, 0x01, 0xBE, 0xC1, 0xE9,
-	0x28, 0x14, 0x29, 0x0C, 0xCF, 0x2C, 0xF9, 0x59, 0x60, 0x73, 0x50, 0xEA,
-	0xBF, 0x28, 0xC5, 0xF7, 0xEE, 0x82, 0x2F, 0x2B, 0x0F, 0x55, 0xCC, 0x79,
-	0x0F, 0x7E, 0xFE, 0xE0, 0xF9, 0xE5, 0x2D, 0xE4, 0x0B, 0x83, 0x62, 0x19,
-	0x34, 0x81, 0x6B, 0x55, 0x6A, 0x60, 0xB7, 0x15, 0xEA, 0x3B, 0x85, 0x3B,
-	0x47, 0x78, 0x16, 0xD2, 0x1E, 0xF4, 0xB3, 0x40, 0x6C, 0x0C, 0xC5, 0xC8,
-	0x72, 0x48, 0x3C, 0xAD, 0x7A, 0xD2, 0xB1, 0x30, 0xBA, 0x16, 0xCC, 0x5B,
-	0xE8, 0x5D, 0x07, 0xDA, 0x9E, 0xF0, 0xBA, 0x4C, 0xD8, 0x7F, 0xAE, 0xF9,
-	0x72, 0xEF, 0x79, 0x29, 0x2D, 0xC3, 0xC8, 0x71, 0x40, 0xE9, 0xAB, 0xD2,
-	0x3A, 0x41, 0x6B, 0x18, 0xEF, 0x85, 0xD1, 0x5E, 0x78, 0x48, 0x02, 0xCF,
-	0x09, 0x78, 0x0B, 0xB3, 0x2B, 0xC3, 0xF9, 0xC0, 0x90, 0x45, 0x86, 0x62,
-	0xE5, 0x39, 0x16, 0x30, 0x7E, 0x85, 0x7C, 0xA3, 0x94, 0x0E, 0x96, 0x0B,
-	0x38, 0xA9, 0xB0, 0xC9, 0x95, 0xF6, 0xC6, 0x10, 0xCD, 0x2D, 0xB1, 0xED,
-	0x00, 0x90, 0xB3, 0x95, 0xE5, 0x46, 0x03, 0xBD, 0x13, 0xBC, 0x7A, 0x65,
-	0x7F, 0x14, 0xB6, 0x4F, 0x81, 0xDA, 0x43, 0x3F, 0x55, 0xD2, 0xB7, 0x96,
-	0xD7, 0x71, 0x43, 0xF4, 0xD7, 0xFF, 0xEA, 0x68, 0x5C, 0xE7, 0xF6, 0x39,
-	0x3F, 0x13, 0xEC, 0x39, 0xE8, 0x00, 0x7C, 0xE5, 0x69, 0x36, 0x81, 0x75,
-	0xD9, 0xDD, 0x25, 0xFD, 0xD2, 0x33, 0x6C, 0x3A, 0x6D, 0x3A, 0xF6, 0x42,
-	0x9E, 0x08, 0x32, 0x83, 0x6A, 0xA4, 0xDC, 0x4F, 0x85, 0xD6, 0x5A, 0x8A,
-	0xDB, 0x80, 0xB7, 0x8A, 0x5C, 0x40, 0x7A, 0x65, 0x89, 0xF2, 0x80, 0x37,
-	0x01, 0xAD, 0x0C, 0x83, 0x6D, 0x42, 0xE5, 0x3C, 0xFE, 0xE4, 0xF0, 0x25,
-	0xD8, 0x54, 0xE9, 0x1D, 0x21, 0x7D, 0x06, 0x57, 0xC1, 0x69, 0x6F, 0xF1,
-	0x2B, 0xC1, 0x15, 0x8E, 0x34, 0x86, 0x7C, 0x60, 0xA8, 0x07, 0x4A, 0x95,
-	0x40, 0x71, 0x0A, 0x1C, 0x8F, 0xDD, 0xDF, 0xED, 0x86, 0x10, 0xA6, 0xDD,
-	0xB1, 0xF3, 0x87, 0x1B, 0xF8, 0xE9, 0xC6, 0xD0, 0x1F, 0x43, 0x65, 0x61,
-	0xE3, 0x94, 0xA5, 0x8B, 0xB9, 0xDF, 0x05, 0x0E, 0x9F, 0x03, 0x72, 0x0F,
-	0xC9, 0x4E, 0xB9, 0xE9, 0x47, 0x5C, 0xBF, 0xEF, 0xE1, 0xDF, 0x57, 0x7C,
-	0x2E, 0x1C, 0xF7, 0x4F, 0x0D, 0xCF, 0x4F, 0xB0, 0x7B, 0x85, 0x10, 0x84,
-	0xD1, 0x99, 0xE7, 0xDD, 0x87, 0xC0, 0x7F, 0xFA, 0x33, 0xFC, 0xFC, 0x01,
-	0xDA, 0xA9, 0xF2, 0x28, 0x16, 0x5B, 0x1B, 0x36, 0xEB, 0x86, 0xC3, 0x7D,
-	0xCC, 0xFD, 0xC6, 0x71, 0x7A, 0x82, 0x68, 0xD7, 0xED, 0x08, 0x98, 0xC2,
-	0xD9, 0x5B, 0x61, 0x76, 0x06, 0xE5, 0xC0, 0x73, 0xF0, 0x81, 0x68, 0x20,
-	0x4C, 0xAE, 0x0D, 0xCD, 0x9B, 0xC0, 0xFA, 0xAC, 0x2B, 0x6D, 0x78, 0xDD,
-	0x2A, 0xE9, 0x73, 0x4B, 0xF5, 0x45, 0x79, 0x5A, 0x07, 0x0E, 0x43, 0x21,
-	0x1D, 0x75, 0x76, 0xB9, 0xD3, 0x09, 0xEA, 0x5A, 0x31, 0x1E, 0x86, 0x8D,
-	0x92, 0x95, 0x82, 0xB5, 0x96, 0xD0, 0xF3, 0x0C, 0x26, 0xF0, 0xE6, 0x2C,
-	0x65, 0x7E, 0x11, 0xA8, 0x83, 0xE7, 0xD1, 0x0B, 0xBB, 0x5A, 0xB9, 0xF2,
-	0x70, 0x76, 0xF4, 0x44, 0x5F, 0xC1, 0x15, 0x1D, 0xCD, 0x4D, 0x26, 0x50,
-	0x4E, 0x02, 0xD6, 0x83, 0x96, 0x8A, 0x39, 0x2A, 0x53, 0x8D, 0x99, 0xD5,
-	0x8A, 0xD3, 0x2E, 0x39, 0xD5, 0xF8, 0x40, 0x63, 0xC0, 0xB4, 0x30, 0xFC,
-	0xD6, 0xE1, 0x7B, 0x5E, 0x67, 0x15, 0xD1, 0xFA, 0xDF, 0x95, 0xE8, 0x12,
-	0xE6, 0xD3, 0x88, 0xCC, 0x7A, 0xA2, 0x36, 0x90, 0x1D, 0xA0, 0x5F, 0x1B,
-	0x76, 0x27, 0xA5, 0x70, 0xCA, 0x68, 0xD0, 0x11, 0xAD, 0xB5, 0xB2, 0xD0,
-	0x42, 0xE2, 0x3C, 0x67, 0x31, 0x24, 0xB1, 0x12, 0x0F, 0x0C, 0xFB, 0xC4,
-	0xE2, 0x4A, 0xC3, 0xE9, 0xD4, 0x50, 0x35, 0x60, 0x86, 0x30, 0xC8, 0x3A,
-	0x9F, 0x7A, 0xDD, 0xC0, 0xAE, 0xF0, 0x34, 0x5B, 0xD0, 0xD2, 0xD3, 0x3B,
-	0xC2, 0xDC, 0x40, 0xDB, 0x0F, 0x24, 0x46, 0x68, 0x6A, 0x03, 0x47, 0x43,
-	0xD3, 0xC2, 0xEE, 0xE8, 0x31, 0x41, 0x18, 0xC5, 0x4A, 0x0C, 0xE0, 0x85,
-	0x53, 0xAB, 0x1C, 0x12, 0x30, 0x17, 0xC2, 0xA4, 0x0F, 0x1F, 0xE6, 0xD0,
-	0x5E, 0x0B, 0xF6, 0xDC, 0x72, 0x31, 0x82, 0xB1, 0x15, 0x4E, 0x7B, 0xE1,
-	0x71, 0x57, 0x73, 0xBB, 0x87, 0xD7, 0x67, 0x78, 0xF9, 0x06, 0xED, 0xF7,
-	0x6E, 0x99, 0x72, 0x59, 0xC1, 0xA2, 0x0A, 0x4C, 0xDA, 0x92, 0xD5, 0x43,
-	0x60, 0xEB, 0xE1, 0xBE, 0x85, 0x97, 0xA9, 0xE5, 0x38, 0x57, 0xA2, 0x5E,
-	0xE0, 0xE2, 0x4A, 0xF9, 0xF8, 0xA3, 0x61, 0x7C, 0x26, 0xB4, 0x4E, 0x69,
-	0x5E, 0x02, 0x5B, 0xD3, 0x70, 0x2C, 0x2D, 0x2F, 0x4F, 0xF0, 0xF8, 0x9B,
-	0x67, 0xF9, 0xA4, 0x38, 0x15, 0xD2, 0x91, 0xD0, 0x1F, 0x04, 0xF2, 0xF7,
-	0x31, 0xFD, 0x77, 0x42, 0x1C, 0xB7, 0x94, 0x45, 0x77, 0xDC, 0x9D, 0x8D,
-	0xE0, 0xEA, 0x2C, 0x50, 0x64, 0x86, 0xCD, 0x41, 0x78, 0x3C, 0x39, 0xAA,
-	0x67, 0x47, 0xEF, 0x16, 0x86, 0xA5, 0x65, 0x3E, 0x02, 0xF7, 0x31, 0x20,
-	0xE7, 0xC2, 0xB1, 0x86, 0xB0, 0xB4, 0x44, 0xEB, 0x40, 0xAF, 0x86, 0x16,
-	0xA0, 0x8E, 0x90, 0x83, 0xC7, 0x34, 0x96, 0xFE, 0x3E, 0x30, 0x8F, 0x2B,
-	0xFA, 0x01, 0x5E, 0x12, 0x61, 0x5F, 0xC5, 0x1C, 0x7A, 0x0D, 0xF7, 0x57,
-	0x20, 0x07, 0x58, 0xEC, 0xE1, 0xF2, 0x19, 0x6C, 0x13, 0x68, 0x8D, 0xE1,
-	0x95, 0x40, 0x61, 0x03, 0xEA, 0x21, 0x0A, 0x42, 0xE8, 0x1B, 0x1A, 0x71,
-	0xA4, 0x46, 0x88, 0x72, 0xB0, 0x63, 0xC1, 0x8C, 0x85, 0x68, 0x1D, 0x48,
-	0x9E, 0x84, 0xF6, 0x57, 0xCF, 0x5A, 0x20, 0x9A, 0x4F, 0x15, 0x7B, 0x09,
-	0x36, 0x6B, 0x28, 0x0A, 0x4B, 0xB3, 0x81, 0xCA, 0x77, 0xBB, 0xFB, 0x1E,
-	0x42, 0x9D, 0x29, 0xCD, 0x19, 0xAC, 0x5A, 0xCB, 0x71, 0x6D, 0xD9, 0x3D,
-	0x05, 0x86, 0xAD, 0x30, 0x17, 0x25, 0x17, 0xA1, 0xF4, 0x70, 0x8C, 0x84,
-	0x5D, 0xDA, 0x65, 0xFC, 0x4A, 0x85, 0x61, 0x05, 0xB3, 0x4A, 0xD9, 0xA3,
-	0xEC, 0x05, 0x8A, 0x00, 0xCF, 0x65, 0xE0, 0x72, 0x6B, 0x98, 0x36, 0x81,
-	0x45, 0x12, 0x51, 0xA3, 0xD4, 0xE2, 0xD9, 0x9C, 0x20, 0x2B, 0x3D, 0x55,
-	0x03, 0xC5, 0xEF, 0x52, 0xB3, 0xC4, 0x60, 0x43, 0xE8, 0xF6, 0xE6, 0x23,
-	0xC8, 0xCF, 0xE1, 0x62, 0x1E, 0xF3, 0x26, 0x0B, 0xE4, 0xA9, 0xA7, 0x1E,
-	0xC3, 0xDA, 0x42, 0xB1, 0xED, 0xF1, 0xFC, 0xD0, 0x50, 0xDC, 0xB5, 0xDC,
-	0xBF, 0xC2, 0x97, 0x0D, 0x3C, 0x2E, 0x1D, 0x65, 0x21, 0xCC, 0x32, 0xCB,
-	0xF8, 0xC2, 0x33, 0xCA, 0xA1, 0xDA, 0x05, 0xB6, 0x77, 0x10, 0x7D, 0x85,
-	0xF1, 0x50, 0x58, 0xBC, 0x51, 0xDA, 0x77, 0x01, 0x3B, 0xEA, 0xDA, 0x4F,
-	0xDE, 0x9C, 0x1B, 0x86, 0xB1, 0xF0, 0xF2, 0x6C, 0x59, 0x7D, 0xF5, 0x9C,
-	0xAF, 0xA1, 0x0C, 0x81, 0xBF, 0xB4, 0x81, 0x07, 0x27, 0x38, 0x1F, 0xE8,
-	0xCD, 0x2D, 0xE3, 0x8F, 0x81, 0x7C, 0x66, 0xC8, 0xA6, 0x06, 0x33, 0x83,
-	0xE3, 0xC0, 0x71, 0x5F, 0x2B, 0x5B, 0x81, 0x59, 0x09, 0x17, 0x5E, 0xB8,
-	0xBA, 0x57, 0xDC, 0xB3, 0xD2, 0xAA, 0x50, 0x1B, 0x28, 0x6B, 0x18, 0xA6,
-	0x70, 0xFE, 0xCE, 0x73, 0x36, 0x32, 0x5C, 0x5D, 0xA7, 0xAC, 0x73, 0x65,
-	0x73, 0xF2, 0x14, 0x4E, 0x98, 0x18, 0x25, 0xB4, 0x86, 0x36, 0x28, 0xA7,
-	0x93, 0x67, 0xD3, 0x04, 0xE4, 0x60, 0xC8, 0x77, 0xDD, 0x69, 0xCC, 0x2C,
-	0xC1, 0xC4, 0x8A, 0x24, 0x0D, 0xA7, 0x29, 0xB4, 0xA3, 0x18, 0x9B, 0x42,
-	0x83, 0xE3, 0xE3, 0x93, 0x92, 0x3E, 0x76, 0x8C, 0x82, 0x66, 0x0C, 0x6E,
-	0x0C, 0x51, 0x26, 0xF4, 0x87, 0x3D, 0x8A, 0x59, 0xCB, 0xBA, 0x54, 0xCE,
-	0x82, 0x61, 0x60, 0x84, 0x9D, 0x11, 0xEC, 0xC4, 0xD2, 0x1B, 0xFE, 0xDE,
-	0x6D, 0x70, 0x2F, 0xC4, 0xC1, 0x10, 0xBD, 0xFB, 0xCF, 0x11, 0x8F, 0x03,
-	0x65, 0xB5, 0xF7, 0x14, 0x5F, 0x3C, 0xFE, 0x00, 0x53, 0x0B, 0x83, 0x91,
-	0x62, 0x17, 0x4A, 0x3D, 0x10, 0xE2, 0x61, 0xC4, 0xEA, 0x14, 0x38, 0xB8,
-	0x06, 0xAD, 0x85, 0xB9, 0xC0, 0xC7, 0x60, 0xC8, 0xB6, 0x11, 0x1B, 0xAF,
-	0xBC, 0x5A, 0xC7, 0xBE, 0x52, 0x8A, 0x0C, 0x48, 0x60, 0x6C, 0x61, 0xD8,
-	0x02, 0x22, 0x1C, 0x7A, 0x70, 0x14, 0x78, 0x0D, 0xDD, 0x46, 0x6D, 0xE4,
-	0x0D, 0x57, 0x2E, 0x70, 0xAF, 0xCA, 0x73, 0xE8, 0x1C, 0xB8, 0x75, 0xAD,
-	0x78, 0x0F, 0x22, 0xD0, 0xEB, 0x0B, 0xC9, 0x99, 0x21, 0x9E, 0x05, 0xB2,
-	0x91, 0x62, 0xC6, 0x86, 0xE1, 0x99, 0x65, 0x90, 0xC6, 0x44, 0xD4, 0x98,
-	0xBD, 0x22, 0x4B, 0x38, 0x55, 0x8E, 0xED, 0xFA, 0xC4, 0xFD, 0xAD, 0x12,
-	0x96, 0x81, 0xD5, 0x2B, 0x1C, 0x56, 0x50, 0x17, 0xD0, 0x4F, 0x61, 0xF1,
-	0x73, 0xE0, 0xDD, 0xDB, 0x88, 0xC1, 0xB9, 0xE5, 0x75, 0xEB, 0x58, 0xAB,
-	0xE7, 0x46, 0xE0, 0x2A, 0x55, 0xCA, 0x71, 0x44, 0xD5, 0xF3, 0xE4, 0x46,
-	0xB8, 0x4C, 0x53, 0xCE, 0xBC, 0x63, 0xBD, 0xF4, 0xEC, 0x3E, 0x05, 0xF2,
-	0xEF, 0x4A, 0x6F, 0x05, 0x75, 0x0D, 0xA7, 0x1E, 0xB4, 0x97, 0xCA, 0xF4,
-	0x0F, 0x70, 0xFE, 0x1E, 0xFA, 0x19, 0x58, 0x02, 0x89, 0x18, 0xBC, 0x28,
-	0x5B, 0x11, 0x3E, 0xA5, 0xBF, 0xF7, 0x1F, 0xC4, 0x82, 0x14, 0x70, 0x7C,
-	0x50, 0x0E, 0x85, 0x92, 0xA7, 0x81, 0x8F, 0x1F, 0x84, 0xE6, 0x2C, 0xA6,
-	0x77, 0x2E, 0x9C, 0x6B, 0xC3, 0x3B, 0x0F, 0xBB, 0xAA, 0x21, 0xAC, 0x84,
-	0xF5, 0xDE, 0x52, 0x1C, 0x5A, 0xA6, 0x07, 0x25, 0x13, 0x4F, 0x29, 0xC2,
-	0xC3, 0x01, 0x0E, 0x85, 0x20, 0x95, 0xC7, 0x0A, 0x78, 0x63, 0x51, 0x63,
-	0xC8, 0x35, 0x90, 0x85, 0x8E, 0x1E, 0xE6, 0xF6, 0x1D, 0x21, 0xB4, 0x4C,
-	0x84, 0x71, 0xA2, 0x44, 0x87, 0x2E, 0x81, 0x6C, 0x0F, 0x30, 0xAE, 0x21,
-	0xBF, 0xB6, 0x2C, 0xE6, 0x9E, 0x68, 0xEA, 0x29, 0xD4, 0xE2, 0x0F, 0x82,
-	0x7B, 0xEE, 0x60, 0x16, 0xC6, 0xC0, 0xB0, 0x17, 0xB1, 0xFF, 0xE0, 0x89,
-	0x26, 0x81, 0xB7, 0x56, 0x88, 0x92, 0x77, 0xB0, 0x7A, 0xB2, 0xAC, 0xBE,
-	0x28, 0xBD, 0x4F, 0xCA, 0x85, 0xB3, 0xE4, 0x43, 0xCF, 0x48, 0x0C, 0x0C,
-	0xE0, 0x50, 0x06, 0xD6, 0x91, 0xB2, 0xDB, 0x2A, 0x6D, 0x01, 0x53, 0xA3,
-	0x5C, 0x45, 0x90, 0xD7, 0x20, 0x8F, 0x8E, 0xE1, 0x23, 0x38, 0x1B, 0x38,
-	0x8C, 0xA0, 0x38, 0x33, 0xC4, 0x7D, 0x25, 0x72, 0x40, 0xA9, 0xA8, 0x17,
-	0x7C, 0x19, 0x71, 0xA8, 0x3D, 0xA1, 0x08, 0x64, 0x47, 0xE5, 0xDA, 0x75,
-	0xD8, 0xB7, 0x93, 0x74, 0xEF, 0x6D, 0x9F, 0x05, 0x06, 0x03, 0x18, 0x44,
-	0x90, 0x65, 0x86, 0xB3, 0x0B, 0xCB, 0xF4, 0xEC, 0x77, 0x2B, 0x5A, 0x10,
-	0x0E, 0x65, 0x4C, 0xFD, 0x2D, 0xF0, 0xBA, 0x6D, 0x69, 0x9B, 0xC0, 0x93,
-	0x83, 0x87, 0x4A, 0x3B, 0xEC, 0x6A, 0xE5, 0x71, 0x2A, 0x34, 0x91, 0xE0,
-	0x7A, 0xDD, 0x53, 0x6B, 0x04, 0xF4, 0x11, 0xE6, 0x01, 0x66, 0x27, 0x48,
-	0x8E, 0xB0, 0x9A, 0x58, 0x9A, 0x3F, 0x7B, 0xFC, 0x85, 0x30, 0x0F, 0x31,
-	0x0B, 0x1F, 0x58, 0x6F, 0x94, 0xF1, 0x2E, 0x70, 0xFD, 0x39, 0xB0, 0x48,
-	0x03, 0x4F, 0x15, 0xEC, 0x6B, 0xA5, 0x97, 0x49, 0x87, 0xE4, 0xAC, 0x03,
-	0x83, 0xA9, 0xD0, 0xFB, 0xA3, 0xE5, 0xE2, 0x3F, 0x43, 0x3C, 0x56, 0xD6,
-	0x2F, 0x60, 0x1E, 0x3A, 0x76, 0x80, 0x45, 0x90, 0x9E, 0x72, 0x18, 0x00,
-	0x39, 0xB4, 0x0B, 0xCB, 0x0B, 0xCA, 0xE3, 0x0A, 0x9A, 0x1D, 0xBC, 0xE9,
-	0xC1, 0x3F, 0xB5, 0x96, 0xDD, 0x50, 0xF8, 0x9A, 0x43, 0xB5, 0xEA, 0xB3,
-	0xBC, 0xAF, 0x69, 0xEF, 0x3C, 0xA7, 0x0D, 0x84, 0xC6, 0xCE, 0xAF, 0x71,
-	0xA6, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44, 0x41, 0x54, 0x13, 0x79, 0xC8,
-	0x83, 0x30, 0x8B, 0x2C, 0x6D, 0x64, 0xD8, 0x96, 0x2D, 0x6E, 0xD7, 0x61,
-	0x6F, 0xE7, 0x67, 0x60, 0xAE, 0x2C, 0x6D, 0xE6, 0xF1, 0x41, 0x49, 0x76,
-	0x86, 0xD1, 0x32, 0x70, 0x22, 0xC0, 0x20, 0x90, 0x9F, 0x09, 0xA7, 0x85,
-	0x65, 0x55, 0x06, 0x78, 0x54, 0x7A, 0x2F, 0x70, 0xBE, 0x84, 0x91, 0x04,
-	0xE6, 0xFD, 0x40, 0x33, 0x51, 0x1E, 0xC7, 0x1D, 0xEC, 0xD3, 0xA3, 0xC8,
-	0xAB, 0x90, 0xFB, 0x80, 0x9E, 0x2B, 0x7A, 0x65, 0xC8, 0x7F, 0x86, 0x33,
-	0xE3, 0x89, 0x9E, 0x76, 0x8E, 0x6F, 0xBF, 0xC1, 0xFE, 0x13, 0xBC, 0xAB,
-	0x0D, 0xB3, 0xCC, 0xB0, 0x88, 0x95, 0x33, 0x01, 0xB3, 0x85, 0x7B, 0xA7,
-	0xAC, 0x07, 0x8E, 0x46, 0x2C, 0xD1, 0x18, 0xC6, 0xF3, 0x98, 0x41, 0x15,
-	0xD8, 0xAC, 0x3D, 0xD5, 0x8B, 0xD2, 0x2B, 0x60, 0x36, 0x04, 0x93, 0x08,
-	0x36, 0x49, 0x38, 0xF5, 0x02, 0xC7, 0x3A, 0x70, 0x2C, 0x1C, 0xE5, 0x49,
-	0x09, 0x4E, 0xF1, 0xD2, 0x25, 0x5D, 0xEA, 0x14, 0x7C, 0x0F, 0x30, 0x86,
-	0xC4, 0x2A, 0xE9, 0x04, 0xC6, 0x63, 0xCB, 0xC7, 0x54, 0x59, 0x8C, 0x3C,
-	0xD3, 0x54, 0x48, 0x32, 0xC3, 0xC6, 0xC2, 0xD7, 0x5D, 0xCB, 0xF7, 0x07,
-	0xE1, 0xF4, 0xD0, 0x32, 0x5D, 0x05, 0x76, 0xC7, 0x0E, 0x05, 0xF3, 0x5B,
-	0x06, 0x9F, 0x22, 0xC1, 0xB6, 0x96, 0x0F, 0x71, 0x60, 0x34, 0x56, 0x76,
-	0x63, 0x78, 0x50, 0x21, 0x4B, 0x60, 0xB0, 0x54, 0x20, 0xD0, 0x16, 0xC2,
-	0xE9, 0x5F, 0x1C, 0xED, 0xA5, 0xC3, 0xFE, 0x09, 0xCC, 0x35, 0xB8, 0xB9,
-	0xC1, 0xAE, 0x2C, 0xBD, 0xFB, 0x6E, 0x10, 0xDD, 0xEE, 0x94, 0xE9, 0xCA,
-	0x71, 0x21, 0xCA, 0xF4, 0x1C, 0xF4, 0x03, 0x8C, 0x2E, 0xE9, 0xF2, 0x0A,
-	0x8D, 0x70, 0x95, 0x45, 0xF4, 0xDF, 0xC6, 0x64, 0xB9, 0xE1, 0x69, 0x5B,
-	0x71, 0x77, 0x0F, 0xD1, 0x53, 0x60, 0x58, 0xD1, 0xCD, 0x28, 0xC0, 0x0F,
-	0x03, 0x88, 0x7E, 0x34, 0xE4, 0x67, 0x9E, 0x97, 0x24, 0x66, 0xB7, 0x57,
-	0xC6, 0xCB, 0xC0, 0x8F, 0x27, 0xB8, 0x79, 0x70, 0x3C, 0x5A, 0xC7, 0x67,
-	0x2B, 0xFC, 0xF6, 0x90, 0xD0, 0xBF, 0x0B, 0x8C, 0xB6, 0x5D, 0xC9, 0x84,
-	0x19, 0x42, 0x96, 0x75, 0xDE, 0x80, 0x91, 0xB3, 0x1C, 0x43, 0x0B, 0x80,
-	0x1A, 0xE1, 0x52, 0x94, 0x37, 0x83, 0x98, 0x78, 0xA8, 0x14, 0xB1, 0x67,
-	0x5D, 0x18, 0xCA, 0x83, 0xA2, 0x3B, 0xC8, 0x23, 0x61, 0x98, 0x0B, 0xC3,
-	0x85, 0x92, 0xFF, 0x21, 0x42, 0x81, 0xE3, 0x5F, 0x5B, 0x9A, 0xFF, 0xA1,
-	0xA4, 0xAF, 0xCA, 0x2F, 0x2F, 0x42, 0x96, 0x04, 0xEE, 0x12, 0x58, 0x55,
-	0x9E, 0x53, 0xDB, 0x21, 0x70, 0x7A, 0xBF, 0x77, 0x1A, 0x0C, 0x33, 0xB8,
-	0x1C, 0x07, 0x92, 0x79, 0x4C, 0x55, 0x42, 0xF4, 0xEF, 0xFF, 0x1A, 0xF1,
-	0x74, 0xE7, 0x18, 0x1A, 0x58, 0xDC, 0x04, 0x26, 0x57, 0x0D, 0xB3, 0x61,
-	0xE7, 0x6F, 0xAB, 0x76, 0x10, 0xAF, 0x21, 0xDA, 0x83, 0x59, 0x04, 0x46,
-	0xE7, 0x16, 0x33, 0x12, 0xBE, 0x1E, 0x95, 0x87, 0xDA, 0x70, 0x90, 0xC0,
-	0xCF, 0x02, 0x6F, 0x02, 0x5C, 0xED, 0x94, 0xF8, 0xD6, 0xF1, 0x37, 0xAB,
-	0xDC, 0x86, 0x00, 0xB5, 0x90, 0x38, 0xC5, 0xF4, 0x95, 0x7C, 0x14, 0xE1,
-	0x73, 0xCF, 0x31, 0x55, 0x0E, 0xA2, 0xF4, 0x6A, 0xB8, 0x12, 0x21, 0x9E,
-	0xC3, 0x74, 0x2A, 0xDC, 0x88, 0xF2, 0xB6, 0x11, 0xF2, 0xC6, 0xB3, 0x3B,
-	0x08, 0x4F, 0x4F, 0x96, 0x7F, 0x5B, 0x09, 0xCF, 0x4B, 0xE5, 0xBC, 0x50,
-	0x26, 0x18, 0xE6, 0x49, 0xE0, 0x38, 0x16, 0x5E, 0x53, 0x58, 0xF5, 0x94,
-	0x9B, 0x51, 0xCB, 0x8F, 0x83, 0x2E, 0x3A, 0xF5, 0x4D, 0x85, 0xA7, 0x75,
-	0x44, 0xDC, 0x0F, 0x0C, 0x2E, 0x02, 0x41, 0x95, 0x62, 0xA7, 0x3C, 0xBD,
-	0x44, 0xBC, 0x5B, 0x3B, 0xE6, 0x46, 0x28, 0x31, 0x54, 0xB1, 0x50, 0x14,
-	0x0E, 0xE7, 0x0C, 0xC7, 0x38, 0xB0, 0xCA, 0xE1, 0xAC, 0x55, 0x6C, 0x2E,
-	0x7C, 0xF8, 0x59, 0xB9, 0xF8, 0x23, 0x6C, 0xCE, 0x94, 0xB2, 0x0D, 0x98,
-	0x3D, 0x4C, 0xEA, 0x40, 0x7E, 0xAA, 0x28, 0x7E, 0x15, 0x96, 0x3B, 0x4F,
-	0x79, 0xEA, 0x7E, 0xB4, 0x72, 0x60, 0xA9, 0x4F, 0x9E, 0xDE, 0x0E, 0x3E,
-	0xB6, 0x96, 0x91, 0x8B, 0x88, 0xBC, 0xE7, 0x6B, 0x04, 0xEB, 0x34, 0xA0,
-	0x29, 0x68, 0x21, 0x64, 0xDF, 0x80, 0x07, 0xA1, 0x0C, 0x81, 0xFD, 0xA9,
-	0x26, 0x55, 0x18, 0x9D, 0x09, 0x93, 0x73, 0xC1, 0xCC, 0xBA, 0x92, 0xAA,
-	0xFE, 0xD1, 0x10, 0x5E, 0x5B, 0xDA, 0xE7, 0x80, 0x2B, 0x85, 0xBE, 0x74,
-	0xB4, 0xF5, 0xF7, 0xDE, 0x70, 0x5A, 0xB7, 0x3C, 0x1B, 0xE1, 0xA1, 0x50,
-	0xB6, 0xB5, 0x62, 0x23, 0xB8, 0x49, 0x94, 0xCB, 0x44, 0x89, 0x06, 0x42,
-	0x3C, 0x52, 0x76, 0x7D, 0xE5, 0x5E, 0x94, 0x46, 0x85, 0x3F, 0x7C, 0x57,
-	0x16, 0x7B, 0x65, 0x58, 0x2A, 0xC5, 0x77, 0xD8, 0x3F, 0x43, 0x30, 0x70,
-	0x88, 0x84, 0xE4, 0x42, 0x31, 0x99, 0x30, 0xEB, 0xC5, 0x5C, 0x94, 0x9E,
-	0xCD, 0x57, 0xCF, 0xDF, 0x57, 0x86, 0xE8, 0xE1, 0xD6, 0x13, 0x0F, 0x2C,
-	0x67, 0x7F, 0x50, 0xDE, 0x5D, 0x06, 0xDE, 0xBC, 0x83, 0xDE, 0xC4, 0xB0,
-	0x2E, 0x60, 0x7B, 0x1B, 0xB3, 0xFA, 0x5B, 0x43, 0xBB, 0x54, 0x62, 0x94,
-	0xB4, 0xDF, 0x7D, 0x91, 0xB7, 0x25, 0x7C, 0x0A, 0x8A, 0x3B, 0xEF, 0xEC,
-	0x46, 0xA5, 0x85, 0x69, 0x09, 0xE3, 0x07, 0x47, 0x7B, 0x82, 0xA5, 0x85,
-	0xB8, 0x27, 0xFC, 0x92, 0x59, 0x66, 0x73, 0xA1, 0x9E, 0xC2, 0x76, 0x2E,
-	0x54, 0xB1, 0xB0, 0xAB, 0x61, 0xBA, 0x57, 0xE6, 0x95, 0xD0, 0x3F, 0x40,
-	0xA8, 0x1C, 0x45, 0xA9, 0x6C, 0x5E, 0xA0, 0xD9, 0xC3, 0xA3, 0x0B, 0xFC,
-	0x5A, 0x2B, 0xB7, 0x4E, 0xB1, 0x02, 0xEF, 0xC7, 0xC2, 0x0F, 0x67, 0x09,
-	0x79, 0x22, 0xAC, 0x82, 0xA7, 0xF6, 0x2D, 0xE3, 0xCC, 0xF0, 0xF1, 0x52,
-	0x79, 0x7F, 0x66, 0x88, 0x7C, 0xC4, 0x3F, 0x3E, 0x05, 0xFC, 0x77, 0x47,
-	0x56, 0x2A, 0x93, 0x33, 0xCB, 0x69, 0x04, 0x2F, 0x13, 0x8F, 0x8A, 0xE7,
-	0xED, 0x0A, 0xA6, 0x5F, 0xA0, 0x2A, 0x02, 0xAE, 0x07, 0x65, 0x10, 0x88,
-	0xA4, 0x03, 0x56, 0x9D, 0x19, 0x92, 0x1F, 0x84, 0xD9, 0x65, 0xE0, 0xEA,
-	0x43, 0xC4, 0xCB, 0x95, 0x65, 0x1B, 0x37, 0x6C, 0x0E, 0xE0, 0x1A, 0x65,
-	0x5A, 0x78, 0x9A, 0x83, 0xB0, 0x2F, 0x03, 0x87, 0x1A, 0xD2, 0xBE, 0x90,
-	0x4F, 0x53, 0xD6, 0x46, 0xA8, 0xCA, 0x86, 0x41, 0xE5, 0x79, 0xAF, 0x30,
-	0x7F, 0xF6, 0xAC, 0x2B, 0xD8, 0x14, 0x2D, 0x87, 0x17, 0x98, 0x04, 0xD0,
-	0xBC, 0xC3, 0xC5, 0x2D, 0xD5, 0x70, 0x50, 0x98, 0x4C, 0xE0, 0xE3, 0xCC,
-	0xF2, 0xFE, 0x32, 0x22, 0x0C, 0x1C, 0xD6, 0x18, 0x3E, 0x95, 0xC2, 0x7D,
-	0x1D, 0x60, 0xDB, 0xF5, 0x09, 0x45, 0xAD, 0xF2, 0x76, 0x04, 0xEF, 0x06,
-	0xC2, 0xDC, 0x07, 0xC2, 0x16, 0x36, 0xA2, 0x3C, 0xA5, 0x10, 0x16, 0x96,
-	0x51, 0x3F, 0xA0, 0x56, 0x19, 0x89, 0x30, 0x39, 0xC4, 0x1C, 0x96, 0x2D,
-	0xBB, 0x5C, 0x71, 0x18, 0xEA, 0x1F, 0x02, 0x66, 0x12, 0x71, 0xDC, 0x46,
-	0xC8, 0xAE, 0x25, 0xDE, 0x7A, 0x86, 0x4F, 0x10, 0x07, 0x61, 0x90, 0x19,
-	0xA2, 0x19, 0x44, 0xA9, 0xD2, 0x94, 0x0D, 0xAB, 0x6F, 0xC2, 0x97, 0x07,
-	0xF8, 0x6D, 0xEB, 0x88, 0x8C, 0x51, 0x2E, 0xFF, 0x14, 0xB8, 0xFA, 0x73,
-	0xD7, 0x31, 0x37, 0x1D, 0x43, 0x2D, 0xCA, 0xF7, 0x8D, 0xE5, 0xD7, 0xAD,
-	0xF2, 0x94, 0x40, 0xDE, 0x0A, 0x97, 0x8F, 0x16, 0x4A, 0xE5, 0xD4, 0x6B,
-	0xA9, 0x22, 0x85, 0x58, 0x99, 0x5D, 0x25, 0xE8, 0x5C, 0x79, 0x0D, 0x2D,
-	0xD1, 0xA3, 0x41, 0xBE, 0x08, 0xC3, 0xC6, 0x33, 0x30, 0x90, 0xA0, 0x2C,
-	0xAC, 0xF0, 0xE6, 0xD4, 0x0D, 0x20, 0x91, 0x1A, 0x1E, 0x63, 0x65, 0x5D,
-	0x06, 0xC2, 0x11, 0x7A, 0xA7, 0x80, 0x2F, 0x0D, 0xAF, 0x5B, 0xC3, 0xFD,
-	0xCA, 0xB3, 0x5E, 0x19, 0x2E, 0xBD, 0x65, 0x73, 0xD6, 0xA2, 0x1F, 0x20,
-	0xBD, 0x80, 0xF1, 0xC8, 0x32, 0x15, 0x83, 0x48, 0x60, 0x7D, 0x34, 0x3C,
-	0x1C, 0x5A, 0x24, 0x28, 0xEF, 0xBD, 0xF0, 0x81, 0x6E, 0x33, 0xF6, 0xB0,
-	0x52, 0x1E, 0xBF, 0x2A, 0xEE, 0x51, 0x39, 0xEF, 0x0B, 0x17, 0xB9, 0xF0,
-	0xF9, 0x9D, 0xE1, 0xD5, 0x7A, 0x8E, 0x13, 0x65, 0xF7, 0x8F, 0x98, 0xE1,
-	0x83, 0xC7, 0x7C, 0x0F, 0xB8, 0x04, 0x6C, 0x5F, 0xE9, 0x8D, 0x20, 0x9E,
-	0x42, 0x7E, 0x21, 0x44, 0x3F, 0x2B, 0xF1, 0x5B, 0x25, 0x1A, 0xD2, 0xF9,
-	0x00, 0x1B, 0xE5, 0xD5, 0x58, 0xB6, 0x91, 0xF0, 0x2C, 0x8E, 0x24, 0x44,
-	0xD4, 0xE2, 0x39, 0x24, 0x8A, 0x8F, 0x2D, 0x65, 0xA1, 0x14, 0xFB, 0x96,
-	0xC3, 0x6D, 0xE0, 0x6A, 0x0F, 0x89, 0x0D, 0x98, 0x83, 0xF2, 0x14, 0xC1,
-	0xAA, 0xB6, 0xF4, 0x0D, 0xBC, 0x9B, 0x79, 0xD2, 0x37, 0xC2, 0xB7, 0x2C,
-	0xE2, 0xF3, 0x31, 0x50, 0x9E, 0x84, 0xA1, 0x85, 0x79, 0x02, 0xB9, 0x06,
-	0xDA, 0x07, 0x43, 0xB3, 0xF7, 0xAC, 0x1A, 0xE5, 0xFE, 0xA8, 0xEC, 0xB6,
-	0xC2, 0x35, 0x86, 0x9F, 0x86, 0x81, 0xAB, 0xB9, 0x70, 0x95, 0x1A, 0x38,
-	0x75, 0xEF, 0xFE, 0xE1, 0x10, 0x06, 0x57, 0x50, 0xBE, 0xF5, 0x98, 0x09,
-	0x1C, 0x6A, 0x28, 0xF6, 0x86, 0x79, 0xA3, 0xCC, 0xEE, 0x3A, 0xD7, 0xD5,
-	0xD4, 0x41, 0xDB, 0x83, 0x4D, 0xA2, 0x3C, 0x8F, 0xE0, 0xE4, 0x05, 0x57,
-	0x82, 0xE9, 0x41, 0xB6, 0x83, 0xD9, 0x93, 0xC7, 0xAF, 0xE1, 0xB0, 0x80,
-	0xBB, 0x04, 0xDC, 0xA3, 0xF2, 0xE5, 0x1B, 0xBC, 0x34, 0x10, 0x5D, 0xCF,
-	0x85, 0xD1, 0x95, 0x61, 0x31, 0xF3, 0xC4, 0xB1, 0x61, 0xBF, 0x57, 0x96,
-	0x4B, 0xE5, 0xB7, 0x97, 0xC0, 0xFF, 0x7C, 0x74, 0xEC, 0x1C, 0x2C, 0x46,
-	0xC2, 0xD9, 0x1A, 0x78, 0x54, 0x4C, 0x12, 0x48, 0xA7, 0xF0, 0xE3, 0x95,
-	0x65, 0x31, 0x56, 0xE2, 0xB9, 0xE7, 0x49, 0x0C, 0x47, 0x89, 0x19, 0xEC,
-	0x60, 0x54, 0x78, 0x2E, 0x1B, 0x90, 0x12, 0xB2, 0xC6, 0x33, 0x3B, 0x29,
-	0xCD, 0x0E, 0x4E, 0x7D, 0x61, 0xD7, 0x57, 0x0E, 0xB6, 0xCB, 0x0D, 0xE6,
-	0xA5, 0xA1, 0x5E, 0x2B, 0xF7, 0xB7, 0x81, 0xF5, 0x0B, 0x6C, 0x9C, 0x65,
-	0x74, 0x16, 0x58, 0xFC, 0x00, 0xFC, 0x27, 0x43, 0x73, 0x19, 0xD3, 0xD4,
-	0x81, 0xEA, 0xD9, 0xB1, 0x79, 0x54, 0xCC, 0xBE, 0x4B, 0x27, 0xF7, 0xFB,
-	0x30, 0x8A, 0x14, 0x96, 0x86, 0x6F, 0x9F, 0x3D, 0xFF, 0x58, 0x05, 0x36,
-	0x7B, 0x61, 0x3C, 0x12, 0xDE, 0x5C, 0x29, 0x93, 0x37, 0x81, 0xC7, 0x39,
-	0x68, 0x6C, 0x28, 0x63, 0xE5, 0x29, 0xD3, 0xAE, 0x7E, 0x6D, 0xD9, 0x95,
-	0x6C, 0x66, 0xA9, 0xE0, 0xB3, 0x88, 0x74, 0xE4, 0xB0, 0x8B, 0x40, 0xB2,
-	0xE8, 0x48, 0xE4, 0xDE, 0x78, 0xDC, 0x0E, 0x4E, 0x5B, 0xC3, 0x7A, 0xE9,
-	0x79, 0x5C, 0x83, 0x16, 0x30, 0xF0, 0x1E, 0xDF, 0x2A, 0x55, 0x01, 0xB4,
-	0x4A, 0x5B, 0x38, 0x76, 0x2B, 0xCF, 0x70, 0xDF, 0x31, 0x08, 0x8E, 0xB9,
-	0x72, 0x3A, 0xC2, 0x9D, 0x05, 0x13, 0x05, 0xDE, 0x5D, 0x18, 0x7E, 0xFA,
-	0x21, 0x21, 0xBF, 0xB2, 0x7C, 0x06, 0x6E, 0xD7, 0x15, 0x47, 0xA3, 0x24,
-	0xB5, 0xF0, 0xBC, 0xF5, 0xB4, 0x6B, 0x4F, 0xBC, 0x8C, 0xA1, 0x85, 0x5E,
-	0xAA, 0xEC, 0x0D, 0x6C, 0xAE, 0xE1, 0xC7, 0x5C, 0xF9, 0x65, 0x08, 0x93,
-	0xA8, 0x8B, 0x8D, 0x55, 0x3B, 0x45, 0x54, 0x79, 0x37, 0x84, 0xE6, 0x9D,
-	0x65, 0xF7, 0x93, 0xA1, 0x1D, 0x2A, 0xB4, 0x81, 0xDD, 0xCA, 0x53, 0xBC,
-	0x7A, 0x46, 0xF7, 0x42, 0xFB, 0xA4, 0x9C, 0xF6, 0x81, 0x22, 0x16, 0x56,
-	0xB9, 0xE7, 0xD1, 0x78, 0x12, 0x0F, 0x51, 0x4F, 0x08, 0x67, 0x82, 0xA4,
-	0x01, 0xB6, 0xA0, 0x25, 0xF8, 0x2D, 0x9C, 0x52, 0x78, 0xB5, 0xB0, 0x9D,
-	0xC0, 0xC8, 0x43, 0xF4, 0xF1, 0xBD, 0x32, 0x74, 0x16, 0xF3, 0xE0, 0x79,
-	0x3D, 0x19, 0x5E, 0x9E, 0x23, 0xEE, 0x6F, 0x5B, 0xBE, 0xAC, 0x3D, 0x6B,
-	0xC0, 0xF5, 0x21, 0x64, 0x4A, 0x95, 0x38, 0xDA, 0x1A, 0x54, 0x61, 0x46,
-	0xD7, 0xAE, 0x79, 0xB6, 0x0A, 0xD4, 0x04, 0x3E, 0x4F, 0xE1, 0xD6, 0xB6,
-	0x8C, 0x23, 0x65, 0x68, 0x60, 0x12, 0x84, 0x26, 0x02, 0x8D, 0x04, 0x2B,
-	0xCA, 0x99, 0x83, 0x5A, 0x23, 0x36, 0xAE, 0x6B, 0xCB, 0xFA, 0xBD, 0x19,
-	0x85, 0x22, 0x0E, 0xAC, 0x47, 0x5D, 0x9F, 0xCD, 0xF9, 0xA8, 0x65, 0xF6,
-	0x13, 0x7C, 0xFC, 0x67, 0x18, 0xBE, 0x0D, 0xBC, 0x78, 0xC7, 0x97, 0xEF,
-	0x86, 0xD7, 0xBF, 0xC3, 0xBB, 0x6D, 0x17, 0x8B, 0xF2, 0x7D, 0xC1, 0xF7,
-	0x02, 0x87, 0x93, 0xF0, 0xB7, 0xB5, 0x41, 0x57, 0x9E, 0xA3, 0xC2, 0x68,
-	0xA1, 0xFC, 0xF8, 0xA3, 0xF0, 0xCB, 0x1B, 0xF0, 0x03, 0x43, 0xCF, 0x06,
-	0x70, 0x50, 0xCC, 0x85, 0x97, 0x09, 0x0C, 0xE6, 0x4A, 0xEF, 0x01, 0xA6,
-	0x6B, 0x48, 0x4F, 0x11, 0xA1, 0x17, 0x91, 0x0D, 0x1C, 0xE9, 0x48, 0x49,
-	0x54, 0x70, 0x47, 0x61, 0x5D, 0xC3, 0xCB, 0x52, 0x79, 0xFE, 0x87, 0xE1,
-	0xFE, 0x7B, 0x60, 0x5B, 0x43, 0x6E, 0x22, 0x9C, 0x75, 0xB8, 0x00, 0x87,
-	0xCA, 0x50, 0x55, 0x1E, 0xDF, 0x4A, 0x07, 0x65, 0x9E, 0x19, 0x3E, 0x4C,
-	0x0C, 0xF3, 0xB1, 0xE7, 0x5B, 0x0E, 0x7B, 0xA3, 0x9C, 0x29, 0xFC, 0x87,
-	0x33, 0xE5, 0xAA, 0x0F, 0xCB, 0x95, 0xE7, 0x6E, 0xD9, 0xB2, 0x7E, 0x55,
-	0x7C, 0x09, 0xFB, 0x46, 0xF9, 0x72, 0x02, 0x57, 0xC2, 0x4D, 0xBF, 0xE5,
-	0x6A, 0xD1, 0x55, 0xDD, 0x9C, 0xA6, 0xDD, 0xFF, 0x37, 0x1B, 0x1B, 0xF2,
-	0x48, 0xD0, 0xC2, 0xB3, 0x7A, 0xF5, 0x84, 0x85, 0x32, 0xF1, 0x70, 0x9E,
-	0x5A, 0xFC, 0xC8, 0xF0, 0x5C, 0xC3, 0x41, 0x85, 0x03, 0xDD, 0x2B, 0xD6,
-	0x78, 0x61, 0xB4, 0x32, 0x7C, 0xFF, 0x1C, 0x78, 0xDC, 0x43, 0x21, 0x90,
-	0xF5, 0xBB, 0x82, 0xAE, 0xE1, 0x08, 0xB2, 0xB9, 0x81, 0xDC, 0xB0, 0xBF,
-	0x11, 0xDA, 0x79, 0xA0, 0x3D, 0x59, 0x50, 0x4F, 0x5F, 0x60, 0xA8, 0x31,
-	0xA7, 0x1B, 0x87, 0x91, 0x40, 0x74, 0xD5, 0x37, 0xB0, 0xF3, 0x1C, 0x1E,
-	0xE0, 0x79, 0xED, 0xD9, 0xDE, 0x0B, 0x9B, 0xDF, 0x81, 0xC8, 0x71, 0x2C,
-	0xE4, 0x0B, 0x61, 0xFC, 0x43, 0xA0, 0xFF, 0x5E, 0x48, 0x8D, 0xE5, 0x74,
-	0xF0, 0xD4, 0x5B, 0xC5, 0x1E, 0x1D, 0xB3, 0x2D, 0xC8, 0x83, 0xE1, 0xE1,
-	0x42, 0xB9, 0x0B, 0x81, 0xA6, 0x86, 0xFE, 0x50, 0xC8, 0x46, 0x86, 0x7A,
-	0x1C, 0xA8, 0xB2, 0x80, 0xA6, 0x86, 0x5E, 0x0E, 0x3D, 0x09, 0x34, 0x85,
-	0xA5, 0x7A, 0xF5, 0xE4, 0xAF, 0x30, 0xB6, 0x11, 0x66, 0xE4, 0x29, 0xFE,
-	0xAC, 0x0C, 0x86, 0xF0, 0x1F, 0x27, 0xCA, 0xCF, 0x53, 0x18, 0x0D, 0x53,
-	0x1E, 0x5E, 0x94, 0xF2, 0x7B, 0xC3, 0xE6, 0x29, 0x90, 0xD6, 0x31, 0xFD,
-	0x45, 0xCB, 0xC5, 0x24, 0xC2, 0x19, 0xF8, 0xB5, 0x84, 0xF5, 0x2E, 0x90,
-	0xFB, 0x96, 0xF8, 0x1C, 0xF2, 0x5C, 0x78, 0x77, 0xA1, 0xFC, 0xF2, 0xC6,
-	0xB0, 0x48, 0x13, 0x8A, 0x7D, 0xC0, 0x54, 0x1E, 0x33, 0x56, 0xCC, 0x50,
-	0xA8, 0x13, 0xE9, 0xF4, 0x86, 0xB5, 0x20, 0x95, 0x52, 0x6E, 0x02, 0x63,
-	0x53, 0x71, 0x91, 0x75, 0x86, 0x94, 0x41, 0x23, 0xBC, 0x1C, 0x84, 0xCD,
-	0x53, 0xE0, 0xD3, 0x97, 0xC0, 0xF7, 0x4F, 0xC2, 0x66, 0xDB, 0x21, 0x58,
-	0xDF, 0x0C, 0x1D, 0xE3, 0x44, 0xD8, 0x8A, 0xD0, 0xC6, 0x4A, 0x34, 0x05,
-	0x3F, 0x50, 0xB2, 0x89, 0xE1, 0x6D, 0x4F, 0x78, 0xE3, 0x02, 0x93, 0xD6,
-	0xF0, 0xEC, 0x0D, 0x89, 0x6F, 0x49, 0x8D, 0x30, 0xDA, 0x19, 0x8E, 0x0F,
-	0x0D, 0xBF, 0xBE, 0xC2, 0xF2, 0x04, 0x7D, 0x31, 0x0C, 0xF2, 0x80, 0x4F,
-	0xA0, 0xCD, 0x40, 0x66, 0xC2, 0xCD, 0x34, 0x26, 0x1B, 0x09, 0x9B, 0x85,
-	0x23, 0xBD, 0x09, 0xE4, 0x33, 0xA5, 0x97, 0x0A, 0xB6, 0x48, 0x08, 0x71,
-	0x8B, 0xA4, 0x2D, 0xDA, 0x00, 0x45, 0x8C, 0x54, 0x86, 0xE4, 0xB1, 0xA5,
-	0xFF, 0x25, 0x70, 0xD2, 0x2E, 0x5B, 0xB1, 0x12, 0xD8, 0xDE, 0x2B, 0xF9,
-	0x6F, 0x9E, 0xDD, 0x2B, 0xB4, 0x5E, 0xE8, 0x8D, 0x2D, 0xC3, 0x2B, 0xCF,
-	0xC5, 0x54, 0x18, 0x18, 0x88, 0x9D, 0x27, 0x2B, 0x03, 0x92, 0x42, 0x73,
-	0xA9, 0xF8, 0xC8, 0x63, 0x9C, 0xC5, 0x1C, 0x85, 0xD1, 0xC9, 0xB0, 0x11,
-	0xC5, 0x24, 0x96, 0xC8, 0x05, 0xC5, 0xB5, 0x81, 0xC3, 0x06, 0x0E, 0x1B,
-	0xE5, 0xE4, 0x5A, 0x82, 0x85, 0xCC, 0x08, 0xD9, 0x49, 0x19, 0xAD, 0xE1,
-	0x66, 0x0E, 0x1F, 0x2E, 0x0C, 0x6E, 0x92, 0xF0, 0x64, 0x6B, 0x0A, 0x51,
-	0x96, 0x56, 0x79, 0xFB, 0xA8, 0x64, 0x7B, 0xE1, 0x7C, 0x2B, 0x54, 0x63,
-	0x4F, 0x3B, 0x80, 0xFE, 0x4C, 0x69, 0x67, 0x82, 0x1B, 0x41, 0x1B, 0x81,
-	0x51, 0x25, 0xE4, 0xCA, 0xCE, 0x45, 0x3C, 0x3E, 0x39, 0x56, 0xBB, 0x4E,
-	0xB0, 0x78, 0x2B, 0x0E, 0x7F, 0x6E, 0xC8, 0xDE, 0x0B, 0xF6, 0x4A, 0x79,
-	0xD3, 0x33, 0xE8, 0x56, 0xF8, 0xFC, 0x6B, 0xC4, 0x5F, 0xFE, 0x51, 0xB3,
-	0x5A, 0xFE, 0x5E, 0xD0, 0xF0, 0xA7, 0x86, 0xEC, 0x27, 0x43, 0xA5, 0x8E,
-	0xE7, 0xEF, 0x86, 0xED, 0xA9, 0x33, 0x57, 0xCE, 0x47, 0x4A, 0x3E, 0xE9,
-	0x9A, 0xC2, 0xFA, 0x01, 0xFA, 0x9F, 0xC0, 0x1C, 0x1D, 0xAE, 0xF6, 0xF4,
-	0x23, 0xE5, 0xF2, 0x27, 0xF8, 0x36, 0x89, 0x78, 0x6D, 0x85, 0xE3, 0x46,
-	0x19, 0x7E, 0x83, 0xFC, 0xB6, 0x4B, 0xD3, 0x0C, 0x86, 0xF0, 0x47, 0x6F,
-	0x58, 0x78, 0xD8, 0x6F, 0x3D, 0x7F, 0x7D, 0x50, 0x9E, 0x7F, 0x83, 0xDD,
-	0x4A, 0x69, 0x5B, 0x65, 0x3C, 0x32, 0xBC, 0x1D, 0x08, 0x3F, 0xCF, 0x20,
-	0x1E, 0x78, 0x72, 0x51, 0x46, 0x7D, 0x21, 0x5C, 0x1B, 0xF6, 0x97, 0x4A,
-	0xE8, 0x19, 0x74, 0x1F, 0xD8, 0x7D, 0x33, 0x44, 0x4F, 0x90, 0xAE, 0x94,
-	0xB1, 0x0A, 0x44, 0xCA, 0x5D, 0x19, 0xF0, 0x2B, 0xE1, 0xA1, 0x12, 0xCC,
-	0x38, 0xF0, 0xF3, 0x47, 0xE1, 0xE2, 0x5D, 0xCC, 0xEB, 0xBC, 0xE5, 0xAE,
-	0xD7, 0x89, 0x61, 0xE7, 0x07, 0x8F, 0x55, 0x21, 0x4E, 0x21, 0x32, 0x82,
-	0xAA, 0xE1, 0xB5, 0xB4, 0x64, 0xFB, 0x96, 0x49, 0xED, 0x49, 0x62, 0xF0,
-	0x85, 0xF0, 0xF2, 0x04, 0xF5, 0x3D, 0xB0, 0x04, 0xB3, 0x83, 0xD0, 0x2A,
-	0xD6, 0x76, 0xA4, 0xF4, 0x9D, 0x74, 0x69, 0xA0, 0xB8, 0x85, 0xE1, 0x40,
-	0x38, 0xFB, 0x49, 0xF9, 0xF8, 0xBF, 0x0A, 0xC3, 0x99, 0x61, 0xB3, 0xB4,
-	0x9C, 0xBE, 0x35, 0xA4, 0x1B, 0xE5, 0xCC, 0x09, 0x61, 0x22, 0x2C, 0x67,
-	0xDA, 0x19, 0x7C, 0x77, 0x70, 0x3C, 0x38, 0x08, 0x9D, 0x0C, 0x1E, 0x79,
-	0x14, 0xEF, 0x22, 0x54, 0x1C, 0xFD, 0x91, 0xE0, 0x27, 0x8A, 0x9C, 0xC1,
-	0x64, 0x09, 0xB2, 0xB4, 0x64, 0x95, 0xE7, 0xCD, 0x12, 0xDE, 0x59, 0x65,
-	0x3B, 0x6C, 0xF9, 0x92, 0x79, 0x8A, 0xBE, 0xA1, 0x9A, 0x1B, 0x26, 0xC6,
-	0x73, 0x7E, 0xE8, 0x20, 0x0E, 0x3F, 0xCF, 0x2D, 0x7A, 0x0E, 0xCD, 0x40,
-	0x79, 0x32, 0xDD, 0xA3, 0x32, 0xA9, 0x95, 0xCC, 0x75, 0x16, 0xAB, 0x62,
-	0xA0, 0xEC, 0x6E, 0xA0, 0x48, 0x84, 0x60, 0x60, 0xBE, 0x54, 0x7A, 0xAD,
-	0xA3, 0x39, 0xC2, 0x69, 0x19, 0xD1, 0x9C, 0x2C, 0x9F, 0x1F, 0x5B, 0x7E,
-	0x7B, 0x38, 0xF2, 0xED, 0x15, 0x92, 0x08, 0xAE, 0x66, 0xC2, 0xCF, 0x3F,
-	0x5A, 0xB2, 0x8F, 0x09, 0xDF, 0xCB, 0x9A, 0x4F, 0xA5, 0x27, 0x0E, 0xC2,
-	0x79, 0x12, 0x31, 0xCD, 0x14, 0x35, 0xC2, 0x7A, 0xD7, 0xB2, 0x5B, 0x83,
-	0x3C, 0x78, 0xE4, 0xC9, 0xD3, 0x3F, 0xC2, 0x0F, 0xE3, 0x6E, 0x11, 0x73,
-	0xB0, 0x81, 0xCF, 0x51, 0xE0, 0xE9, 0x55, 0xB9, 0xC2, 0x70, 0x3D, 0x54,
-	0xB2, 0x21, 0x5C, 0x2C, 0x04, 0xBD, 0x30, 0x38, 0x0C, 0x7F, 0x7B, 0x69,
-	0xF8, 0xED, 0x11, 0xAA, 0x32, 0x62, 0x3E, 0x73, 0xBC, 0x1F, 0x5A, 0xC2,
-	0x20, 0x62, 0x96, 0x37, 0xCC, 0xD2, 0x4E, 0x76, 0x35, 0x49, 0x60, 0xD6,
-	0x8B, 0xA9, 0x7B, 0xD0, 0x6F, 0x1D, 0xDF, 0x0A, 0xF8, 0xF5, 0xC1, 0x50,
-	0x7F, 0x85, 0x37, 0xAF, 0x8E, 0xDC, 0xC3, 0x0C, 0x61, 0xDB, 0x18, 0x9E,
-	0x0F, 0x01, 0x0D, 0x4A, 0x74, 0xAD, 0xFC, 0xF4, 0x4E, 0xF8, 0xF1, 0x8F,
-	0x90, 0x5C, 0x04, 0xC2, 0xC0, 0xB2, 0x1D, 0x28, 0xAD, 0x17, 0xF6, 0x8F,
-	0x01, 0xFB, 0xA8, 0x98, 0x5B, 0xE1, 0xE2, 0xC5, 0x50, 0x67, 0x86, 0x97,
-	0x3A, 0xE0, 0xEA, 0x96, 0xF7, 0x3D, 0x48, 0xC5, 0xF0, 0xF8, 0x45, 0x78,
-	0xFC, 0xD4, 0x12, 0x3F, 0x18, 0xF2, 0xAD, 0xD2, 0x9E, 0xA0, 0x39, 0x76,
-	0xA9, 0xE3, 0xC9, 0x8D, 0xE1, 0xF3, 0x7B, 0x65, 0x35, 0x31, 0x0C, 0x76,
-	0x96, 0xEB, 0x34, 0xF0, 0xF3, 0x3C, 0x70, 0xDD, 0x53, 0xCA, 0xC8, 0xF1,
-	0xEF, 0x79, 0x60, 0x9B, 0xC3, 0x3F, 0x15, 0x30, 0x8D, 0x04, 0x09, 0x31,
-	0xAF, 0x07, 0x65, 0xB3, 0x6E, 0x3A, 0x2B, 0x9D, 0xE3, 0xF7, 0x9D, 0x8E,
-	0x12, 0x95, 0x4F, 0x29, 0xEB, 0xDB, 0x96, 0x9B, 0x18, 0xC6, 0x33, 0xE5,
-	0xEE, 0x32, 0xE2, 0x4B, 0xAE, 0xEC, 0x4B, 0xCF, 0xE4, 0xB3, 0xD0, 0xBB,
-	0x8B, 0x18, 0x1C, 0x1C, 0xF9, 0xDF, 0x03, 0xB5, 0x09, 0xDD, 0x26, 0xEB,
-	0x4D, 0x80, 0x85, 0x61, 0x3D, 0x13, 0x86, 0xEF, 0x02, 0x8B, 0xA1, 0x81,
-	0xBE, 0x50, 0x98, 0x88, 0xCD, 0xAE, 0x65, 0x7F, 0x07, 0xCD, 0x5A, 0x98,
-	0x54, 0x9D, 0x5B, 0x28, 0x9E, 0xC3, 0xC5, 0x2F, 0x81, 0xF9, 0xDB, 0x94,
-	0xA2, 0x1F, 0x38, 0x69, 0x60, 0xD5, 0x78, 0x46, 0x2B, 0x41, 0xF6, 0x86,
-	0xD6, 0x06, 0xAA, 0x52, 0x39, 0x2A, 0xAC, 0x33, 0x08, 0x6F, 0x2C, 0x59,
-	0x1E, 0x78, 0x33, 0x82, 0x1F, 0x0A, 0x43, 0xF2, 0xE0, 0xD8, 0x4A, 0x67,
-	0x8E, 0xE8, 0x0F, 0x94, 0x54, 0x1D, 0xFB, 0x3A, 0x62, 0x53, 0x06, 0x36,
-	0x27, 0x48, 0x83, 0x20, 0xB9, 0x62, 0xFB, 0xF0, 0xCB, 0x16, 0x6E, 0x5E,
-	0x60, 0x1D, 0xC1, 0x43, 0xED, 0xB9, 0xBD, 0x10, 0x5E, 0x67, 0x86, 0xDE,
-	0xFF, 0x1E, 0x50, 0x11, 0xE2, 0xD0, 0x71, 0x77, 0xCA, 0xD6, 0xB3, 0x7E,
-	0x55, 0x3E, 0x1D, 0x85, 0xE7, 0x58, 0xC8, 0x3E, 0x08, 0x17, 0x99, 0x70,
-	0x95, 0x79, 0xCA, 0x49, 0x40, 0xFB, 0x4A, 0xE5, 0x02, 0x51, 0x23, 0x1C,
-	0x3D, 0x84, 0xAD, 0x60, 0x76, 0x8E, 0x76, 0xAB, 0x94, 0xA5, 0x67, 0xDB,
-	0x76, 0xC7, 0xD4, 0xFC, 0x1A, 0xF2, 0xDC, 0x32, 0xDC, 0x41, 0x71, 0xE7,
-	0x49, 0x14, 0x86, 0xD7, 0x10, 0xFE, 0x8B, 0x90, 0xBD, 0x11, 0x62, 0xEB,
-	0x49, 0x1F, 0x0D, 0xD3, 0x56, 0xB8, 0x39, 0x17, 0x74, 0x16, 0x73, 0x1F,
-	0x1C, 0x7A, 0x74, 0x9C, 0x3E, 0x43, 0xB2, 0x09, 0x94, 0xE2, 0x39, 0x06,
-	0x18, 0xF6, 0xA0, 0x5D, 0xC4, 0xEC, 0x5A, 0xE5, 0x7F, 0x7C, 0xF2, 0x3C,
-	0x3E, 0xC2, 0xE2, 0xA8, 0x9C, 0x7B, 0x43, 0xE4, 0x02, 0xEA, 0x3A, 0x7E,
-	0xD2, 0xD9, 0x0C, 0x92, 0x77, 0xCA, 0x5F, 0x2E, 0x02, 0x54, 0xC2, 0xE5,
-	0xD6, 0xF1, 0xA7, 0x20, 0x0C, 0xBE, 0x47, 0xFC, 0x63, 0x10, 0x78, 0x8C,
-	0x02, 0xF5, 0x48, 0x31, 0x7D, 0x18, 0x18, 0x25, 0xD4, 0x81, 0xD3, 0x6B,
-	0xA0, 0xD8, 0x43, 0x3C, 0x34, 0x5C, 0x7E, 0x0C, 0xB4, 0x93, 0x14, 0xB6,
-	0x4A, 0x14, 0x7F, 0x11, 0xE2, 0x65, 0xE0, 0x06, 0x98, 0x1D, 0x84, 0x43,
-	0x5F, 0x69, 0x2F, 0x85, 0x87, 0x1B, 0x4B, 0x15, 0x07, 0x32, 0x31, 0xEC,
-	0xEF, 0xE0, 0xF9, 0x09, 0xF6, 0x7B, 0x48, 0x5F, 0xE0, 0xE7, 0x3D, 0x24,
-	0x3F, 0x07, 0xCE, 0xFE, 0xA3, 0x61, 0xF2, 0xC1, 0x50, 0x8D, 0x03, 0xEB,
-	0x53, 0xE0, 0xFB, 0x93, 0xF2, 0x7A, 0x1B, 0x38, 0xDC, 0xC3, 0xC5, 0x32,
-	0x70, 0xB6, 0x83, 0x33, 0xE9, 0x76, 0xD2, 0x7F, 0xCC, 0x2D, 0x77, 0x41,
-	0xD9, 0x88, 0x63, 0xFF, 0x22, 0xFC, 0x75, 0x2F, 0x4C, 0xAA, 0x40, 0xA2,
-	0x81, 0x24, 0x56, 0xFA, 0x91, 0x21, 0xCA, 0x2C, 0x17, 0xE7, 0x1E, 0x9F,
-	0x45, 0xB8, 0xC6, 0xD1, 0x3E, 0x79, 0xEC, 0x7D, 0x43, 0x3D, 0x02, 0xCD,
-	0x85, 0xD8, 0x76, 0x8C, 0xA2, 0x8D, 0x51, 0x4E, 0xB4, 0xAC, 0x2C, 0xD4,
-	0x53, 0xA1, 0x67, 0x2D, 0xF8, 0x2E, 0xDB, 0x20, 0x23, 0xCF, 0x1F, 0x9E,
-	0xE1, 0x7D, 0x09, 0xDF, 0xD6, 0xB0, 0x3B, 0x57, 0x06, 0x3F, 0x18, 0xFC,
-	0x2F, 0x96, 0xD0, 0x0F, 0x94, 0x4B, 0xCB, 0xEE, 0xDF, 0x61, 0xFF, 0x37,
-	0xC7, 0xC3, 0x6D, 0xE0, 0x35, 0x8A, 0x28, 0xCE, 0x3C, 0xA3, 0xC4, 0x93,
-	0x45, 0x96, 0x73, 0xA3, 0xD4, 0x7D, 0xCF, 0x66, 0x24, 0xAC, 0xF7, 0x1D,
-	0x92, 0xEE, 0xF0, 0x08, 0xCD, 0xAE, 0x66, 0x5A, 0x75, 0x61, 0x8F, 0x49,
-	0x0A, 0xE9, 0xC4, 0x30, 0xB8, 0x51, 0x7A, 0x17, 0x11, 0x27, 0x63, 0xD9,
-	0x7E, 0x55, 0x8A, 0x67, 0xCF, 0xC8, 0xC0, 0xBB, 0x3C, 0x26, 0x1E, 0x1B,
-	0xBE, 0xE7, 0x8E, 0xAF, 0x8F, 0xC2, 0xE0, 0x5F, 0x02, 0x83, 0x0D, 0x7C,
-	0xB8, 0x00, 0xDE, 0x06, 0x96, 0x41, 0xB8, 0xFD, 0x02, 0xC5, 0x6D, 0xCC,
-	0xE0, 0x29, 0x30, 0x29, 0x5C, 0x97, 0x3E, 0xBA, 0x82, 0xCA, 0x3B, 0xEE,
-	0xF6, 0xF0, 0xF9, 0x49, 0xD9, 0xEF, 0xC0, 0xA8, 0x25, 0x8A, 0x3C, 0x21,
-	0x53, 0x26, 0x17, 0x11, 0x8B, 0x0B, 0xCB, 0xF5, 0xA2, 0x21, 0x44, 0xF0,
-	0x3D, 0x55, 0x76, 0x0B, 0x47, 0x75, 0x0D, 0xBC, 0x82, 0x2B, 0x1C, 0x87,
-	0x8D, 0x62, 0x02, 0x0C, 0xC6, 0x96, 0x78, 0x04, 0x5A, 0x79, 0x56, 0x0F,
-	0x2D, 0x9B, 0xBD, 0x21, 0x59, 0x18, 0xDE, 0xFC, 0x39, 0xE5, 0xE6, 0x5D,
-	0x4D, 0x61, 0x03, 0xCD, 0xCA, 0x10, 0x9D, 0x17, 0x35, 0xD1, 0x99, 0xA1,
-	0x28, 0x02, 0x54, 0x4A, 0x7F, 0xE9, 0x99, 0x2F, 0x84, 0x97, 0xD4, 0xB0,
-	0x49, 0x03, 0x4F, 0x13, 0x4B, 0xAF, 0x89, 0xD8, 0x89, 0xE7, 0xD4, 0x17,
-	0x46, 0x55, 0xE0, 0x97, 0x58, 0x98, 0xF6, 0x63, 0xFA, 0xFD, 0x86, 0x22,
-	0x12, 0xFE, 0xBF, 0x83, 0xF0, 0x3F, 0xEF, 0x2C, 0xB7, 0x0F, 0x9E, 0xE2,
-	0xD0, 0x91, 0x3C, 0x47, 0x8B, 0x80, 0x26, 0x5D, 0x55, 0x7A, 0x3F, 0x87,
-	0x7E, 0x1B, 0x88, 0xBE, 0x7B, 0xC2, 0x46, 0x79, 0xFC, 0xFD, 0x31, 0x64,
-	0xC7, 0x96, 0xD1, 0x24, 0x70, 0x69, 0xE1, 0x42, 0x23, 0x44, 0x94, 0x93,
-	0xC2, 0xE3, 0xA6, 0xE5, 0xF4, 0x02, 0xBB, 0x25, 0x34, 0x47, 0xC3, 0x59,
-	0xB0, 0x2C, 0x32, 0xCF, 0xC3, 0xB5, 0xE0, 0x7F, 0xE8, 0xE2, 0xD2, 0xED,
-	0x20, 0xEE, 0xA0, 0x08, 0xCE, 0x23, 0xAE, 0xAB, 0x90, 0x7B, 0x58, 0x28,
-	0xFD, 0x09, 0x9C, 0xBF, 0x31, 0x9C, 0xAF, 0x85, 0xFF, 0xA3, 0xA7, 0x9C,
-	0x5F, 0x04, 0xBE, 0x2D, 0x02, 0x9F, 0xF2, 0x98, 0x6D, 0x1C, 0xF8, 0xD2,
-	0x40, 0xFA, 0x20, 0x34, 0x7F, 0x11, 0x9E, 0x1E, 0x84, 0x6A, 0x18, 0x08,
-	0x2E, 0x60, 0xC6, 0xD0, 0x1B, 0xC1, 0x1B, 0x35, 0xC8, 0xC9, 0xF0, 0xEF,
-	0x26, 0xE2, 0xFF, 0xDD, 0x78, 0x9E, 0x1F, 0x85, 0xF8, 0x49, 0x99, 0x48,
-	0xD7, 0x90, 0x3E, 0xB8, 0x56, 0xF2, 0xB9, 0x21, 0xCC, 0x15, 0xDF, 0xB7,
-	0x1C, 0x1A, 0x78, 0xD8, 0xD4, 0x2C, 0x77, 0xD0, 0x1A, 0xC3, 0x3C, 0x55,
-	0xC6, 0x05, 0xE4, 0xFF, 0x30, 0x7C, 0x5B, 0x09, 0x5F, 0x97, 0x90, 0x3D,
-	0x18, 0xFE, 0xF9, 0x04, 0x3F, 0x96, 0x01, 0x7F, 0x27, 0xDC, 0x79, 0xE1,
-	0xE9, 0x04, 0xA2, 0x2D, 0xD3, 0x49, 0xF7, 0x58, 0xB7, 0x2A, 0xE4, 0x1E,
-	0xAA, 0x0D, 0xBC, 0xAE, 0x94, 0x6A, 0x03, 0xBE, 0x8A, 0x58, 0x9A, 0x80,
-	0x37, 0xCA, 0xE8, 0xAD, 0x30, 0xF9, 0x83, 0xA5, 0xBA, 0x0C, 0xE8, 0xC6,
-	0x62, 0xEE, 0x02, 0x51, 0x15, 0xE8, 0xFF, 0x01, 0xDA, 0x0F, 0x96, 0xF5,
-	0x42, 0x31, 0xAB, 0xC0, 0xFA, 0x49, 0xB0, 0x2B, 0x65, 0xBC, 0x0A, 0x0C,
-	0x7C, 0x77, 0xC2, 0x7A, 0x69, 0xC1, 0x59, 0x18, 0x4D, 0x0D, 0xD3, 0x38,
-	0xD0, 0xBC, 0x18, 0x4E, 0x7F, 0x6F, 0x71, 0xFF, 0x0F, 0x44, 0x8D, 0x2A,
-	0x75, 0xDF, 0xB2, 0x1C, 0x07, 0xDA, 0x08, 0xD2, 0x1C, 0x16, 0xAD, 0xF0,
-	0xB2, 0xF2, 0x3C, 0x55, 0xD0, 0x88, 0xA3, 0xCE, 0x6D, 0xE7, 0xF4, 0xB9,
-	0x0A, 0xE4, 0x29, 0x4C, 0x87, 0x96, 0x3F, 0x8F, 0x63, 0x6A, 0xE7, 0xF8,
-	0xEF, 0x5F, 0x03, 0xDF, 0x37, 0xC2, 0x5F, 0xB7, 0x9D, 0x5C, 0x99, 0x58,
-	0x18, 0x5F, 0x74, 0xFA, 0xFC, 0xEA, 0x64, 0x38, 0x1C, 0x0D, 0x26, 0xF3,
-	0xEC, 0xAD, 0xB2, 0x5E, 0x09, 0xE5, 0x16, 0x7A, 0x8D, 0xD2, 0x9B, 0x19,
-	0x7A, 0x0B, 0x21, 0x9A, 0x08, 0xA6, 0x15, 0xE2, 0x55, 0x4B, 0xB3, 0x51,
-	0xF6, 0x7B, 0x78, 0x75, 0xC2, 0x3E, 0x08, 0xE7, 0x16, 0x32, 0x11, 0x6E,
-	0x0A, 0xA5, 0xA9, 0x95, 0xE7, 0xA9, 0xD0, 0xB7, 0x1D, 0x9E, 0xBE, 0xB0,
-	0x86, 0xED, 0xCA, 0xD3, 0x3C, 0x28, 0xBD, 0x55, 0xA0, 0x97, 0x41, 0x78,
-	0x07, 0xFE, 0xDC, 0x70, 0x98, 0x2B, 0xD7, 0x33, 0xE5, 0x7F, 0x71, 0x11,
-	0x97, 0x51, 0x84, 0x7D, 0x82, 0xDB, 0x9D, 0xE3, 0xBE, 0x55, 0xFE, 0xF5,
-	0xC9, 0x13, 0xDF, 0x1A, 0x64, 0x03, 0x1B, 0x17, 0xB0, 0x01, 0x66, 0x6D,
-	0x27, 0xA6, 0x8C, 0x1B, 0x65, 0x58, 0x05, 0xCC, 0x03, 0xB4, 0x6D, 0xCB,
-	0xF3, 0x5E, 0x29, 0x0A, 0xC3, 0xDB, 0x54, 0x79, 0x33, 0x33, 0x9C, 0x9D,
-	0x81, 0x9C, 0x09, 0xC9, 0x40, 0x68, 0x5C, 0x60, 0xF5, 0xAC, 0x7C, 0xFF,
-	0xEA, 0xB9, 0xBB, 0xEF, 0x5A, 0x54, 0xFB, 0x3D, 0xC3, 0x66, 0x08, 0x75,
-	0xD3, 0x32, 0xFE, 0xDC, 0x62, 0x0D, 0x1C, 0x4F, 0xE0, 0x10, 0x64, 0x92,
-	0x30, 0x90, 0x96, 0xCD, 0x6B, 0xA0, 0x7A, 0x0D, 0x44, 0x3D, 0xC8, 0x7E,
-	0x80, 0xFC, 0xC6, 0xD0, 0x6F, 0x2D, 0x61, 0xD7, 0xD2, 0x34, 0xCA, 0xA9,
-	0x84, 0xC3, 0xB0, 0x0B, 0xA3, 0xFA, 0x22, 0x50, 0xAB, 0x92, 0x4E, 0xE1,
-	0xF2, 0x67, 0x18, 0xFE, 0x87, 0x9A, 0x83, 0xC2, 0xB7, 0x5B, 0xA1, 0xB8,
-	0xEB, 0x8A, 0x24, 0x27, 0x17, 0xC2, 0xBB, 0xD6, 0x92, 0xE6, 0xB0, 0xF4,
-	0x70, 0x7C, 0x6D, 0x89, 0x14, 0x86, 0x51, 0x37, 0x30, 0xEE, 0x6C, 0xCC,
-	0xF3, 0xC8, 0x73, 0xD8, 0x05, 0x86, 0xAF, 0xCA, 0xF1, 0x68, 0x68, 0x2A,
-	0x78, 0xFA, 0x06, 0x83, 0x15, 0x44, 0xC7, 0x37, 0x10, 0x62, 0x47, 0x35,
-	0x87, 0xDE, 0xDC, 0xD0, 0xEB, 0x05, 0xFA, 0xD2, 0x25, 0x68, 0x0F, 0x1E,
-	0xD2, 0x58, 0xC9, 0xFB, 0x0E, 0x9D, 0x82, 0x3B, 0x17, 0xEC, 0x4C, 0x91,
-	0xBE, 0xC7, 0xAF, 0x5B, 0xDC, 0x17, 0xE1, 0xE5, 0x3B, 0xFC, 0xFF, 0x3C,
-	0xBD, 0x57, 0x8F, 0x6C, 0x47, 0x92, 0x6E, 0xB9, 0xCC, 0x7D, 0xEB, 0xD0,
-	0x11, 0xA9, 0xC5, 0x11, 0xE4, 0x21, 0xAB, 0xAB, 0xEA, 0x36, 0x30, 0x40,
-	0xCF, 0xCC, 0xFF, 0x7F, 0xBF, 0xC0, 0x00, 0x8D, 0xBE, 0x75, 0x9B, 0x45,
-	0x16, 0x79, 0x54, 0xEA, 0xC8, 0x88, 0x0C, 0xB9, 0xA5, 0xBB, 0xDB, 0x3C,
-	0x6C, 0xCE, 0xBC, 0xE7, 0x5B, 0x62, 0x87, 0xBB, 0x9B, 0x7D, 0xDF, 0x5A,
-	0xCB, 0x8D, 0x52, 0x46, 0x8A, 0x19, 0x58, 0xF2, 0x93, 0xC0, 0xF9, 0x44,
-	0x39, 0xBF, 0x84, 0x2E, 0x8E, 0x78, 0xAB, 0xA1, 0xAB, 0x1D, 0xCF, 0xCF,
-	0xC2, 0x63, 0xA3, 0x1C, 0x86, 0xFA, 0x67, 0xD4, 0xC9, 0x92, 0x68, 0x87,
-	0x7F, 0x85, 0xA6, 0x16, 0x76, 0xA5, 0x61, 0x7F, 0x50, 0xBE, 0xB8, 0xC0,
-	0x53, 0x21, 0x24, 0xA7, 0x9E, 0xE1, 0xD4, 0x90, 0xEC, 0x15, 0x59, 0x7A,
-	0xE6, 0x16, 0x3E, 0x9D, 0x2B, 0xAF, 0x85, 0x50, 0x1D, 0x0B, 0x36, 0x8F,
-	0x8E, 0xC3, 0x9D, 0xA3, 0x7D, 0x84, 0x45, 0x03, 0x37, 0x0B, 0xC8, 0xA6,
-	0x42, 0x48, 0x63, 0x0E, 0xC1, 0x61, 0x6B, 0xCF, 0x58, 0x3C, 0xFB, 0x7B,
-	0xA1, 0xFB, 0xCD, 0x52, 0x6E, 0x62, 0x1A, 0xDF, 0x52, 0x1B, 0x38, 0xE0,
-	0x71, 0xB7, 0x50, 0x5B, 0x4B, 0x3C, 0x34, 0x9C, 0x14, 0xCA, 0x59, 0xEA,
-	0x49, 0x50, 0xBA, 0x35, 0x74, 0x07, 0xA5, 0xEE, 0x7A, 0xE1, 0x75, 0x34,
-	0x82, 0xCB, 0x99, 0x61, 0x96, 0xA6, 0x48, 0x68, 0x70, 0x9B, 0x1E, 0x73,
-	0xFF, 0xF6, 0x66, 0xF9, 0xFA, 0x87, 0xE7, 0xCB, 0xAF, 0xCA, 0x6A, 0x0D,
-	0xC9, 0x08, 0xC6, 0x7F, 0xF1, 0x94, 0x37, 0x3D, 0xBE, 0xCE, 0xEE, 0xA0,
-	0x7E, 0xEA, 0x0D, 0x66, 0x8C, 0x02, 0xF5, 0x50, 0x79, 0x69, 0xE1, 0x01,
-	0x65, 0x19, 0x20, 0x52, 0xE1, 0x6C, 0x18, 0x31, 0xBC, 0x52, 0xDA, 0x1C,
-	0xB4, 0x14, 0x28, 0x95, 0x55, 0x05, 0x9B, 0x0E, 0x64, 0x23, 0x64, 0x3B,
-	0xE5, 0x4A, 0x85, 0xBF, 0x9F, 0x45, 0x5C, 0xFC, 0xE4, 0xA8, 0x46, 0xB0,
-	0xBC, 0x13, 0x5E, 0xF6, 0x4A, 0x91, 0xC1, 0xBB, 0x34, 0x66, 0xF1, 0xE6,
-	0xB8, 0xFE, 0xDC, 0x91, 0xA6, 0x09, 0x9B, 0x3D, 0x74, 0xA5, 0x92, 0x65,
-	0xC2, 0x24, 0x11, 0xF6, 0x31, 0x6C, 0x5A, 0xF8, 0xCD, 0x19, 0x8E, 0x55,
-	0x20, 0x5F, 0x2B, 0x95, 0xEF, 0x70, 0x9D, 0xF6, 0x54, 0x98, 0xF7, 0x10,
-	0x1D, 0xDF, 0x19, 0xA2, 0x6D, 0xDF, 0x41, 0xCB, 0xE7, 0x8A, 0x16, 0x82,
-	0x94, 0x86, 0xB1, 0xF4, 0x92, 0xA7, 0x30, 0xB6, 0x94, 0xC1, 0x33, 0x19,
-	0xC0, 0x78, 0x12, 0x41, 0xEC, 0x79, 0xAD, 0x02, 0xE3, 0x95, 0xD2, 0x7E,
-	0x11, 0xD6, 0x7F, 0x18, 0xEA, 0x2A, 0x90, 0x15, 0x82, 0xCE, 0x03, 0x8B,
-	0x81, 0xF2, 0x63, 0x0D, 0x1F, 0xC4, 0x30, 0x3D, 0x83, 0x07, 0x55, 0xDC,
-	0x67, 0xC3, 0xAF, 0x2F, 0x0A, 0xCF, 0xCA, 0xF5, 0x04, 0xE2, 0x45, 0xBF,
-	0x71, 0x3D, 0xAE, 0x85, 0x78, 0xAF, 0x24, 0x51, 0xCF, 0x1D, 0x2C, 0xCF,
-	0x02, 0xAB, 0x02, 0xDA, 0x13, 0xCF, 0xF8, 0x54, 0x08, 0xA9, 0xF2, 0xB6,
-	0x83, 0xAB, 0x65, 0x44, 0x21, 0xCA, 0x3C, 0x0D, 0x1C, 0x5A, 0xE1, 0xE9,
-	0xB9, 0x63, 0xF5, 0xD4, 0xD7, 0xAE, 0xB2, 0x29, 0x4C, 0x0B, 0xC3, 0x4D,
-	0x66, 0x90, 0x46, 0xF8, 0xE3, 0x7B, 0xCB, 0xCB, 0x46, 0xD9, 0x35, 0xF0,
-	0x9A, 0x05, 0xBE, 0x36, 0xF0, 0xF9, 0xD9, 0x53, 0xBF, 0x45, 0xCC, 0xA7,
-	0xCA, 0xCF, 0x67, 0x96, 0x9B, 0xCB, 0xC0, 0xFA, 0x56, 0x19, 0x4F, 0x2C,
-	0x8D, 0x01, 0x5B, 0xF5, 0x03, 0x9A, 0x43, 0x0B, 0x2B, 0xAF, 0xE4, 0x01,
-	0xC6, 0x53, 0xB8, 0x38, 0x11, 0x9A, 0x2C, 0xC3, 0x74, 0x0D, 0xAB, 0xB7,
-	0x06, 0xB3, 0x0B, 0x24, 0x35, 0xB4, 0x8D, 0xE5, 0x75, 0x1B, 0xB8, 0x7B,
-	0x52, 0x96, 0x4B, 0xB0, 0x06, 0xE6, 0x27, 0x70, 0x3D, 0x84, 0x9B, 0x6B,
-	0x60, 0x18, 0xF1, 0xB4, 0xB1, 0xDC, 0x8B, 0xA7, 0xBA, 0x77, 0x4C, 0x1D,
-	0xE8, 0xBE, 0x65, 0xDD, 0xC2, 0xBD, 0x37, 0x54, 0x93, 0xD0, 0x33, 0x81,
-	0xC5, 0x91, 0xAE, 0xC1, 0x9D, 0x3A, 0xC2, 0x89, 0xE0, 0x87, 0xD0, 0x04,
-	0x21, 0x78, 0x4B, 0xDA, 0x78, 0x6E, 0xF7, 0xC2, 0x5F, 0x83, 0xE1, 0x5D,
-	0x61, 0x91, 0x24, 0xB0, 0x3C, 0x04, 0x1E, 0x0F, 0xCA, 0x60, 0x02, 0xE7,
-	0x27, 0xC2, 0x45, 0xA2, 0xC4, 0x9D, 0xD2, 0xFE, 0x0A, 0xBE, 0x6D, 0x08,
-	0x8D, 0x25, 0x1A, 0x80, 0x99, 0x28, 0xD4, 0x11, 0xAF, 0x7B, 0xE5, 0xF3,
-	0xC1, 0xF1, 0x50, 0x0B, 0xE3, 0xF0, 0xA7, 0x5E, 0x46, 0x94, 0x3A, 0x16,
-	0x18, 0x09, 0xCD, 0x22, 0x10, 0xD5, 0xB1, 0x50, 0xA4, 0xC2, 0xA5, 0x89,
-	0x88, 0x5B, 0xCF, 0x6B, 0x10, 0x8E, 0xA5, 0x21, 0x98, 0x8E, 0x24, 0x83,
-	0x7D, 0x11, 0x78, 0x2A, 0xC0, 0x98, 0x88, 0xFC, 0x08, 0xED, 0x67, 0xCB,
-	0xEB, 0x32, 0x90, 0x2E, 0x3B, 0xE4, 0x15, 0x1C, 0x30, 0x1A, 0x18, 0x2E,
-	0x73, 0x45, 0x52, 0x65, 0xA1, 0xC2, 0x69, 0x05, 0x1F, 0x76, 0xC2, 0x24,
-	0xE9, 0xAB, 0xE3, 0xBF, 0x6C, 0x85, 0xB7, 0x2A, 0xB0, 0x40, 0xB8, 0x88,
-	0x94, 0x6D, 0x13, 0xD8, 0xA0, 0x18, 0x55, 0x3E, 0x4C, 0xFA, 0x39, 0x43,
-	0x71, 0xAD, 0x14, 0x0B, 0x21, 0x3B, 0x51, 0x64, 0x6A, 0xD9, 0x5B, 0xC3,
-	0xB7, 0xBD, 0xE3, 0xFC, 0x11, 0x66, 0x62, 0x19, 0x3B, 0x8B, 0x6B, 0x1A,
-	0x9E, 0x9C, 0xE7, 0x2B, 0x0D, 0xF5, 0x14, 0xF2, 0x61, 0x8F, 0x8B, 0x29,
-	0x52, 0xC1, 0x75, 0x96, 0xF6, 0xE0, 0xA8, 0x5F, 0x94, 0xDD, 0x2B, 0xAC,
-	0x0F, 0x16, 0xB1, 0x81, 0x5F, 0xAD, 0xF2, 0xE4, 0x61, 0x30, 0x75, 0xFC,
-	0x30, 0x81, 0xBF, 0x17, 0x81, 0x77, 0x56, 0x59, 0xAA, 0x61, 0x5B, 0x29,
-	0x55, 0xE7, 0xD9, 0x7B, 0xC5, 0xA0, 0x9C, 0x19, 0x38, 0x8E, 0x85, 0xC1,
-	0xC2, 0x72, 0x32, 0x0D, 0xCC, 0x46, 0xCA, 0xF3, 0xB6, 0x66, 0xF5, 0xA8,
-	0xC4, 0x1B, 0x18, 0x1E, 0x04, 0xD6, 0xCA, 0x7E, 0xD7, 0x52, 0x96, 0x10,
-	0x3B, 0xC3, 0x74, 0x1A, 0x18, 0x8E, 0x85, 0x8F, 0xEF, 0x22, 0xFE, 0xED,
-	0x0C, 0xAE, 0x06, 0x42, 0x19, 0x0B, 0xDF, 0x08, 0xFC, 0x9E, 0x28, 0xDB,
-	0x02, 0xA6, 0x7B, 0x30, 0xA5, 0x62, 0xAD, 0x25, 0xB9, 0x14, 0x66, 0x13,
-	0xC1, 0x15, 0x9E, 0x3A, 0x08, 0xD5, 0xB3, 0x30, 0xDA, 0x29, 0xD9, 0x0F,
-	0x86, 0xED, 0x09, 0x0C, 0x86, 0x4A, 0xA6, 0x02, 0x5E, 0xB9, 0xDD, 0x0A,
-	0x3F, 0x96, 0x81, 0x51, 0xE7, 0xF8, 0xB2, 0x89, 0xB8, 0x5F, 0x76, 0xEC,
-	0x3D, 0xCC, 0x3E, 0x2A, 0xD3, 0x89, 0x85, 0xBD, 0x61, 0xF9, 0x14, 0xF1,
-	0xF2, 0xE6, 0xC8, 0x96, 0x70, 0x70, 0x4A, 0x3C, 0x80, 0xA8, 0x86, 0xD6,
-	0x04, 0xB6, 0x7B, 0xCF, 0xCE, 0x09, 0x76, 0x1A, 0x98, 0x5E, 0x1B, 0xE6,
-	0xA9, 0x30, 0x6C, 0x3D, 0x75, 0x09, 0xDE, 0x4A, 0x1F, 0xBA, 0xCD, 0x0B,
-	0xCF, 0x70, 0x66, 0x18, 0x89, 0x12, 0x6A, 0xD8, 0x6D, 0x3D, 0xAF, 0x3B,
-	0x4F, 0x6B, 0x40, 0xF3, 0x7E, 0xE5, 0xA8, 0x27, 0xB0, 0x01, 0xEA, 0xE7,
-	0x8E, 0xFC, 0x1B, 0x0C, 0x37, 0xFD, 0x4F, 0x9B, 0x1B, 0x1B, 0x06, 0xA7,
-	0xC2, 0x4D, 0x12, 0x58, 0xC4, 0x90, 0xC5, 0x42, 0x9C, 0x19, 0x0C, 0x3D,
-	0x68, 0xE9, 0xB0, 0x52, 0x5E, 0x3A, 0xCF, 0x83, 0x13, 0xE4, 0xDC, 0x30,
-	0x7E, 0xAF, 0x0C, 0xAC, 0xD0, 0xD4, 0xD0, 0xA8, 0x12, 0x9D, 0xC0, 0xA8,
-	0x30, 0x9C, 0x8E, 0x0C, 0x83, 0x89, 0xA1, 0x39, 0x0F, 0x5C, 0x5E, 0x0B,
-	0xDF, 0x72, 0xC3, 0xE6, 0xCD, 0xA3, 0x1B, 0x61, 0xB0, 0x0C, 0x8C, 0x56,
-	0x0D, 0x3F, 0x6D, 0x63, 0xA4, 0xEC, 0x23, 0xCE, 0x66, 0x04, 0xC9, 0xDC,
-	0x40, 0x6C, 0x10, 0xAF, 0x34, 0xDE, 0xF3, 0x9A, 0x78, 0xFC, 0xCC, 0x42,
-	0x64, 0x69, 0x0A, 0x4F, 0xB5, 0xEC, 0xF3, 0x8C, 0x55, 0x0C, 0x93, 0xC2,
-	0x30, 0x1A, 0xC3, 0xD8, 0x18, 0x34, 0xF4, 0xCB, 0x9B, 0xC9, 0x2B, 0x9C,
-	0xF8, 0xC0, 0x4B, 0xA2, 0xB4, 0xA7, 0x8A, 0x3F, 0x37, 0x94, 0x91, 0xB0,
-	0xA9, 0x3C, 0x27, 0x6A, 0x28, 0x9A, 0x08, 0xDD, 0xB4, 0x6C, 0x1E, 0x03,
-	0xE9, 0x4E, 0x28, 0x4C, 0x2F, 0xA3, 0x3E, 0xA0, 0x2C, 0x73, 0xD8, 0xCE,
-	0x60, 0x94, 0x05, 0x4E, 0x53, 0x18, 0x17, 0x96, 0x8F, 0x13, 0xCB, 0x7B,
-	0x3C, 0xED, 0xA3, 0xE7, 0x6E, 0x2F, 0xFC, 0x73, 0x19, 0x78, 0xEA, 0xFA,
-	0xE8, 0x77, 0x94, 0x1B, 0xE2, 0xD4, 0x73, 0x31, 0xE8, 0xA3, 0x65, 0x71,
-	0x11, 0xF3, 0x60, 0x61, 0xFD, 0x26, 0xD4, 0x95, 0xE7, 0xE6, 0x15, 0x3E,
-	0x7A, 0xC3, 0xA9, 0x37, 0x94, 0x97, 0x2D, 0xBF, 0xE7, 0x3D, 0xFD, 0x34,
-	0x5A, 0x29, 0x66, 0xAB, 0xD4, 0x1B, 0xE5, 0x69, 0xD3, 0x73, 0x81, 0x66,
-	0xA7, 0x96, 0xCB, 0x85, 0x92, 0x8D, 0x03, 0x3B, 0x0C, 0x2F, 0xC7, 0xDE,
-	0xA6, 0x9A, 0x06, 0xA5, 0xF3, 0x01, 0x5A, 0x88, 0xEB, 0x3E, 0xAC, 0xE2,
-	0x46, 0x06, 0x13, 0xC3, 0xE4, 0x52, 0x39, 0xBF, 0x86, 0xD4, 0x44, 0x6C,
-	0xB7, 0xB0, 0xEE, 0x3C, 0x51, 0xE5, 0x19, 0x18, 0x88, 0x16, 0x7F, 0x81,
-	0x41, 0x1E, 0x60, 0x23, 0x2C, 0x7F, 0xB7, 0xBC, 0x7C, 0x13, 0x9E, 0xD7,
-	0x1E, 0xDB, 0x58, 0x16, 0x36, 0x62, 0x3A, 0x6B, 0xF1, 0x0B, 0xA5, 0xCE,
-	0x3D, 0x3B, 0xDF, 0xF3, 0x6B, 0x2E, 0xCF, 0x0C, 0x85, 0x0F, 0xF8, 0x48,
-	0x28, 0x32, 0x61, 0x90, 0xF4, 0x25, 0x52, 0x55, 0xA1, 0x05, 0x36, 0x0A,
-	0xBF, 0x6D, 0x02, 0x49, 0xD3, 0x13, 0x2F, 0xB2, 0xB9, 0x62, 0xAE, 0xC0,
-	0xCE, 0xA0, 0xF6, 0xC2, 0x71, 0xAB, 0xB4, 0x01, 0x34, 0x33, 0xD4, 0xC6,
-	0x72, 0x34, 0x30, 0x28, 0x1D, 0x27, 0x77, 0xCA, 0xF9, 0x31, 0xA6, 0x48,
-	0xE0, 0x8F, 0x5D, 0xA0, 0xFC, 0x06, 0x93, 0x47, 0x61, 0xB9, 0x12, 0xDE,
-	0xBD, 0xF4, 0x3C, 0xE3, 0xBF, 0x8E, 0x41, 0xAF, 0x2D, 0xBF, 0x0B, 0xAC,
-	0x2B, 0x87, 0x73, 0x60, 0x22, 0xC8, 0xE6, 0x70, 0x98, 0x04, 0x9A, 0x5B,
-	0xC8, 0x5C, 0xFF, 0x7A, 0x68, 0x8E, 0x86, 0x64, 0xE7, 0x48, 0xBC, 0xB2,
-	0x35, 0x96, 0xE7, 0x12, 0x92, 0x46, 0xC8, 0x3A, 0x88, 0xDA, 0x40, 0x56,
-	0xD1, 0x4B, 0x1C, 0xD5, 0x72, 0x4C, 0x0D, 0x2F, 0x46, 0x49, 0xF7, 0x96,
-	0xAB, 0xEF, 0x01, 0x5D, 0x5B, 0xF6, 0xEB, 0x3E, 0xEC, 0x79, 0x35, 0x52,
-	0xC6, 0x73, 0xE1, 0x50, 0xC0, 0x6B, 0x01, 0xE5, 0x10, 0xB2, 0x5B, 0x21,
-	0x4D, 0x2C, 0xC3, 0x55, 0xE0, 0x7C, 0x15, 0xB8, 0x58, 0x75, 0xC4, 0x6F,
-	0x9E, 0x17, 0x0F, 0xDB, 0x63, 0x9F, 0x76, 0x2A, 0x66, 0xC2, 0xE8, 0x12,
-	0x92, 0x53, 0x4F, 0x3A, 0x33, 0x4C, 0x52, 0x43, 0xD6, 0x2A, 0xEB, 0xCA,
-	0xF1, 0xB5, 0x09, 0xFC, 0x91, 0x19, 0xEC, 0x58, 0x88, 0x77, 0xCA, 0x5F,
-	0xBF, 0x7A, 0xCE, 0x5E, 0x3D, 0xD3, 0xF3, 0x5E, 0x0A, 0xF9, 0xE6, 0xA1,
-	0x5C, 0x2B, 0xEB, 0xA5, 0xE0, 0x9E, 0xA1, 0x3E, 0x38, 0x66, 0x13, 0xB8,
-	0x2E, 0x94, 0xDB, 0x2D, 0xA4, 0xC0, 0x67, 0xF1, 0x3C, 0x26, 0x1E, 0x46,
-	0x60, 0xAF, 0xC1, 0x0A, 0x5C, 0xE4, 0xC2, 0xE9, 0xD8, 0xA0, 0x79, 0x7F,
-	0xB7, 0x68, 0x46, 0xE0, 0x46, 0x50, 0xAB, 0xF2, 0x78, 0x68, 0x79, 0x3B,
-	0x08, 0xA5, 0xC2, 0x79, 0x0A, 0x17, 0x27, 0x31, 0xD1, 0x60, 0x0E, 0x54,
-	0x09, 0x8F, 0x07, 0xE1, 0xF3, 0x6B, 0xC7, 0xB7, 0xA5, 0x61, 0xBB, 0x81,
-	0x79, 0x50, 0xE6, 0x99, 0x63, 0x91, 0x2B, 0xDB, 0xCA, 0xF2, 0x88, 0x72,
-	0xC8, 0x14, 0x7F, 0x2A, 0x1C, 0x06, 0x11, 0x47, 0xEF, 0x89, 0xCA, 0x80,
-	0xAB, 0xFA, 0xD8, 0x71, 0x44, 0x5F, 0x79, 0xAE, 0x62, 0x38, 0x1A, 0xE1,
-	0xC5, 0x2B, 0xB3, 0x06, 0x4E, 0x8C, 0xF0, 0x6E, 0x00, 0x65, 0x64, 0x39,
-	0x34, 0xB0, 0xF5, 0x9E, 0x12, 0x25, 0x89, 0x7A, 0x6C, 0xCC, 0x46, 0xE1,
-	0xA1, 0x6C, 0x19, 0x55, 0xE0, 0x77, 0x16, 0xAF, 0x1E, 0xB1, 0x86, 0x08,
-	0x03, 0x69, 0x60, 0x33, 0xB0, 0x2C, 0x0F, 0x96, 0x7D, 0xD7, 0x70, 0xBE,
-	0x86, 0x77, 0x95, 0xA5, 0x4B, 0xFA, 0x8B, 0x5C, 0x97, 0xF5, 0x1B, 0xB9,
-	0xD3, 0xA9, 0x61, 0x30, 0x34, 0xB4, 0xDE, 0x93, 0x34, 0xCA, 0x64, 0x61,
-	0x91, 0x9F, 0xA1, 0xDA, 0x47, 0xEC, 0x7E, 0x55, 0x56, 0xFF, 0xF4, 0x6C,
-	0x9F, 0x1D, 0x3E, 0x08, 0xED, 0x08, 0x8E, 0x67, 0x96, 0x28, 0x03, 0x8E,
-	0x9E, 0xB3, 0x0E, 0xA2, 0x54, 0xD8, 0x7A, 0xCF, 0x4B, 0x08, 0x98, 0x2E,
-	0xA2, 0xD8, 0x1B, 0xF4, 0x4B, 0xCD, 0x7E, 0xA5, 0xCC, 0x13, 0xB8, 0xB4,
-	0x42, 0x9E, 0x28, 0xCD, 0x10, 0x86, 0xA7, 0xC2, 0xE0, 0x93, 0xD0, 0xBD,
-	0x87, 0x63, 0x93, 0xB0, 0x3F, 0x76, 0x2C, 0xCA, 0x8E, 0x6C, 0x25, 0xC4,
-	0xD2, 0xFB, 0x8D, 0x2F, 0xC6, 0x90, 0x4C, 0x61, 0x7F, 0x6D, 0x90, 0x5B,
-	0x85, 0x53, 0x61, 0x1B, 0x1B, 0x36, 0x5B, 0x83, 0x5D, 0x3B, 0xDA, 0x95,
-	0x67, 0x53, 0xC2, 0x5A, 0x3D, 0x9D, 0x17, 0x4E, 0xA2, 0xFE, 0x59, 0x98,
-	0x3D, 0xC2, 0xF0, 0xB1, 0xC7, 0xD9, 0x97, 0xD3, 0x9E, 0x24, 0xFA, 0xA5,
-	0x11, 0x64, 0xDF, 0x6F, 0x43, 0x2F, 0x1D, 0x5C, 0xDF, 0x7B, 0x66, 0x22,
-	0x6C, 0x66, 0x86, 0x4D, 0xEE, 0xD9, 0x3A, 0x28, 0xA7, 0x30, 0x3C, 0x35,
-	0xDC, 0x64, 0x30, 0x1E, 0x47, 0x14, 0xB1, 0x47, 0xC4, 0xE0, 0x53, 0xE5,
-	0x98, 0x78, 0x9A, 0x52, 0xF0, 0x4B, 0xC3, 0xFA, 0xE8, 0x39, 0xA8, 0xA2,
-	0xA7, 0xC2, 0x78, 0x20, 0x3D, 0x1F, 0xA0, 0xFA, 0x67, 0xC2, 0x7A, 0x15,
-	0x78, 0x59, 0x05, 0x9E, 0x5E, 0x02, 0x5B, 0x02, 0x66, 0x66, 0xB8, 0x9C,
-	0x04, 0xDE, 0xCD, 0x60, 0x36, 0x8A, 0x90, 0x24, 0xE6, 0x6B, 0xD3, 0xB0,
-	0x15, 0xD8, 0x47, 0x50, 0x44, 0x8E, 0xC8, 0x44, 0x44, 0xAA, 0x6C, 0x8E,
-	0x01, 0x53, 0xC1, 0xB0, 0x80, 0xD1, 0xDC, 0x22, 0x63, 0x78, 0xCE, 0x3C,
-	0x6F, 0x07, 0xA1, 0x93, 0xFE, 0x69, 0x75, 0xB2, 0x17, 0x9A, 0x3D, 0xBC,
-	0x56, 0x81, 0xEA, 0x00, 0x99, 0x31, 0x64, 0x89, 0x42, 0xE1, 0xD9, 0x8C,
-	0x60, 0xED, 0x61, 0x5D, 0xC2, 0xF1, 0xD1, 0xB3, 0xDF, 0x40, 0x1C, 0x7B,
-	0xAE, 0xAE, 0xA1, 0xFD, 0x59, 0x70, 0x63, 0xCF, 0x57, 0xAB, 0x5C, 0xAC,
-	0x61, 0xBE, 0x83, 0xE9, 0x58, 0xB9, 0x2C, 0x02, 0xBB, 0x21, 0x44, 0x73,
-	0xA1, 0x1B, 0xF4, 0x4D, 0x98, 0x43, 0x19, 0xB3, 0x5D, 0xF5, 0x15, 0xAE,
-	0xDB, 0x36, 0x62, 0x34, 0x76, 0xDC, 0xFB, 0x96, 0xFB, 0x35, 0xBC, 0x7E,
-	0x31, 0xC4, 0xAF, 0x70, 0xB5, 0x08, 0x7C, 0xFA, 0x68, 0xC8, 0xDF, 0x1B,
-	0x1E, 0x73, 0xC7, 0xB1, 0x86, 0xC5, 0x4E, 0x39, 0x69, 0x1C, 0xBF, 0x78,
-	0xB8, 0x1F, 0x40, 0x33, 0x74, 0xD4, 0x05, 0xC4, 0x19, 0xD8, 0x42, 0xB8,
-	0xCE, 0x95, 0x39, 0x8A, 0xEE, 0x84, 0xA1, 0x28, 0x83, 0xA9, 0xC1, 0x56,
-	0x11, 0xAB, 0x07, 0xB8, 0xAF, 0x1D, 0xDB, 0xCA, 0x33, 0x8D, 0x84, 0xEE,
-	0x04, 0x46, 0x0B, 0xC3, 0xA7, 0xD3, 0x40, 0x9D, 0x42, 0x3B, 0x14, 0x9E,
-	0xCF, 0x02, 0xFF, 0x7B, 0x0E, 0x4B, 0x17, 0xC3, 0x6B, 0x40, 0x5E, 0x1C,
-	0x17, 0x2F, 0x4A, 0xB3, 0x37, 0x98, 0x5A, 0x89, 0x55, 0x38, 0x2A, 0x6C,
-	0x2B, 0xE5, 0xBE, 0x51, 0x8A, 0xBA, 0x27, 0xAD, 0x9C, 0x8E, 0x84, 0x26,
-	0xB2, 0xEC, 0xC7, 0xCA, 0x43, 0x1E, 0x48, 0x80, 0xC5, 0xBD, 0x65, 0x56,
-	0x7B, 0x16, 0x0F, 0x86, 0xA4, 0x12, 0xCA, 0x89, 0xE7, 0x30, 0x81, 0xE3,
-	0x08, 0xDC, 0x1C, 0x38, 0x51, 0xA2, 0x01, 0x68, 0xE6, 0x68, 0x34, 0x50,
-	0xB8, 0x98, 0x28, 0x80, 0xD9, 0x09, 0x7E, 0xAD, 0x44, 0x7B, 0xCF, 0x30,
-	0x02, 0x3B, 0xEF, 0x17, 0x52, 0xA9, 0x28, 0xE5, 0x31, 0x10, 0xBD, 0xFE,
-	0x4F, 0xE1, 0xAE, 0x71, 0x6C, 0x4D, 0x6F, 0xE4, 0x3A, 0xFF, 0x20, 0x8C,
-	0x27, 0xCA, 0xF5, 0x59, 0xCC, 0x74, 0xEC, 0xB1, 0x4E, 0xF1, 0xCB, 0x8E,
-	0x6E, 0x13, 0xA8, 0x6B, 0x43, 0x5D, 0x09, 0xC5, 0xCC, 0x13, 0xC5, 0x1E,
-	0xA3, 0x8A, 0x8D, 0xE1, 0xAC, 0x83, 0x53, 0x63, 0x90, 0x18, 0xAA, 0x51,
-	0x4C, 0x28, 0x84, 0xD2, 0x7A, 0xB6, 0x9D, 0x52, 0x76, 0xF0, 0xBA, 0x54,
-	0xD6, 0xAF, 0x8E, 0xDD, 0x56, 0x30, 0x1B, 0x65, 0x12, 0x59, 0x92, 0x51,
-	0xA0, 0x9C, 0x78, 0xE2, 0x11, 0x1C, 0x13, 0x78, 0xAC, 0xA0, 0x7D, 0xE9,
-	0xDB, 0xB5, 0x8B, 0x13, 0x98, 0x8F, 0x84, 0xCD, 0x99, 0x65, 0x3D, 0xF4,
-	0xBC, 0xD4, 0x9E, 0xC7, 0x13, 0xD8, 0x0E, 0x85, 0xC9, 0x89, 0x21, 0x3B,
-	0x4D, 0x39, 0x49, 0x2B, 0x76, 0x2A, 0xAC, 0x8F, 0x96, 0xF5, 0xC1, 0x51,
-	0xEE, 0x6B, 0x9A, 0x46, 0x39, 0x15, 0xE1, 0xEC, 0xBE, 0x21, 0xDE, 0xC1,
-	0x43, 0x0B, 0x9F, 0xBF, 0x41, 0x1B, 0x0C, 0x57, 0x1F, 0xE0, 0xFF, 0xFC,
-	0x20, 0xFC, 0xFD, 0xCC, 0xB0, 0xAA, 0x02, 0x9F, 0x9B, 0xBE, 0x74, 0x52,
-	0xA4, 0x06, 0x6F, 0xFA, 0xF9, 0x45, 0x70, 0x86, 0xEF, 0x12, 0xD8, 0x8C,
-	0x95, 0xC5, 0x8D, 0xF0, 0x61, 0x91, 0x90, 0xD0, 0x62, 0x8F, 0x10, 0xF6,
-	0x11, 0x23, 0xD3, 0x91, 0xBD, 0x05, 0xD4, 0x75, 0x94, 0xC1, 0x12, 0xAB,
-	0x23, 0x1D, 0x43, 0xF4, 0xD1, 0xD0, 0x5D, 0x09, 0xEE, 0x0C, 0xF2, 0xD8,
-	0x70, 0xD2, 0xF5, 0x5A, 0x9C, 0x2A, 0x52, 0xBA, 0x06, 0x56, 0x4F, 0x1D,
-	0xE5, 0x9D, 0x92, 0xBD, 0xC1, 0xC8, 0x45, 0x3D, 0xB0, 0x3A, 0xF5, 0xD8,
-	0x06, 0xC2, 0x1E, 0xCA, 0xAD, 0xB2, 0x6A, 0xE1, 0x9C, 0x3E, 0x91, 0x7D,
-	0x1B, 0x5B, 0x22, 0x31, 0x7C, 0x4F, 0x95, 0xBB, 0x51, 0xAF, 0x9B, 0x9B,
-	0x99, 0x80, 0xD9, 0x08, 0xCE, 0x0B, 0x6F, 0x8D, 0x67, 0xFF, 0x06, 0x55,
-	0x07, 0x4E, 0x21, 0x1A, 0xF7, 0xED, 0xEA, 0xD4, 0x41, 0xBB, 0xEF, 0xF3,
-	0x97, 0xEA, 0x3A, 0x9A, 0xD2, 0xD0, 0xEE, 0x85, 0xA6, 0x56, 0x66, 0xB1,
-	0x30, 0x9B, 0x19, 0x8E, 0x53, 0xE5, 0x18, 0x0C, 0xAF, 0x4B, 0xC7, 0xF1,
-	0x5E, 0x89, 0xF6, 0x87, 0x86, 0x78, 0x00, 0x97, 0x13, 0x18, 0x8E, 0x2D,
-	0xC9, 0x50, 0x89, 0xA7, 0x81, 0x71, 0x0E, 0x91, 0x2A, 0xD5, 0x2A, 0xB0,
-	0x7E, 0x85, 0xCD, 0x63, 0x7F, 0x7E, 0xC7, 0x93, 0x40, 0x96, 0xF7, 0x62,
-	0xE6, 0x63, 0x61, 0x88, 0x2D, 0x54, 0x11, 0x68, 0x63, 0x98, 0xAE, 0x3D,
-	0x27, 0x5D, 0xC7, 0xC5, 0x89, 0xE2, 0x0A, 0xE0, 0xD4, 0xB0, 0x4C, 0x95,
-	0x8D, 0x2A, 0xF5, 0x0A, 0xE2, 0x9D, 0x32, 0x3A, 0xC0, 0x34, 0xF6, 0x24,
-	0x16, 0x8C, 0xE9, 0x71, 0xB0, 0x04, 0xA1, 0xDD, 0x2B, 0x52, 0xC7, 0x8C,
-	0x87, 0x9E, 0x2C, 0x0B, 0x98, 0x91, 0x32, 0xC8, 0x3C, 0x3E, 0xED, 0x87,
-	0x4A, 0xE5, 0x35, 0xA8, 0x01, 0x5D, 0x28, 0x2F, 0x71, 0xC7, 0xB7, 0x25,
-	0xBC, 0xDD, 0x2B, 0xE5, 0xC6, 0xD1, 0xA8, 0xE2, 0xFF, 0x14, 0x4A, 0x45,
-	0xA6, 0xF7, 0x1C, 0x87, 0x3F, 0xFA, 0x5F, 0x96, 0x32, 0x87, 0xE4, 0x3F,
-	0x02, 0x1F, 0x3F, 0xC5, 0x7C, 0x18, 0x79, 0xE6, 0xF7, 0x8E, 0xED, 0xFF,
-	0x16, 0xA2, 0x1D, 0x0C, 0x4E, 0x2D, 0xE6, 0x5A, 0x69, 0x63, 0x7A, 0xC5,
-	0xFC, 0x0E, 0xAA, 0xDA, 0xD2, 0x99, 0xC0, 0x60, 0x11, 0x70, 0x8D, 0xA7,
-	0xDA, 0x47, 0xAC, 0xAA, 0x8E, 0x71, 0xDE, 0x71, 0x95, 0xF5, 0xDD, 0xC8,
-	0xED, 0x5E, 0x91, 0xD6, 0x71, 0x52, 0x08, 0x37, 0x0B, 0x65, 0xF1, 0xEF,
-	0x81, 0xCD, 0xAD, 0x60, 0x52, 0x18, 0x79, 0xCB, 0x69, 0x23, 0xB0, 0x75,
-	0x3D, 0x92, 0x7E, 0x67, 0xD1, 0x67, 0x8F, 0x79, 0x86, 0xE4, 0x28, 0x7D,
-	0xA1, 0x32, 0xE9, 0x81, 0x59, 0xA1, 0x56, 0x46, 0x5B, 0x18, 0x36, 0xE0,
-	0x32, 0x68, 0xAC, 0xA5, 0x35, 0x81, 0xE1, 0x3E, 0x30, 0xCE, 0x02, 0xF3,
-	0x4C, 0x69, 0x47, 0xC2, 0xFA, 0x1C, 0x0E, 0x56, 0x29, 0x37, 0xC2, 0x21,
-	0x18, 0xAA, 0x56, 0x78, 0xAE, 0x3C, 0x21, 0x28, 0xD3, 0x20, 0xE4, 0x58,
-	0x2E, 0x45, 0x19, 0x74, 0x1E, 0xDF, 0xDA, 0x1E, 0x10, 0x11, 0x84, 0xF2,
-	0x10, 0x71, 0x7C, 0x6E, 0xE9, 0x5A, 0x18, 0x0E, 0xE0, 0x24, 0xEB, 0xEF,
-	0x69, 0x9B, 0x83, 0xA7, 0x7E, 0x06, 0x96, 0x42, 0x94, 0xBC, 0x87, 0x61,
-	0x66, 0xB8, 0xCA, 0x2C, 0xD3, 0xC8, 0x53, 0x45, 0x81, 0x57, 0x11, 0x54,
-	0x03, 0xC7, 0x52, 0x58, 0xBE, 0xC1, 0x6A, 0xA5, 0xB4, 0xA5, 0x50, 0x2C,
-	0x3C, 0x27, 0x97, 0xC2, 0x64, 0x68, 0xB1, 0x36, 0x60, 0xBA, 0x98, 0xA3,
-	0x77, 0x3C, 0x05, 0x25, 0xDD, 0x18, 0x8A, 0xA3, 0xE3, 0x07, 0xEB, 0x49,
-	0x6F, 0xE0, 0xE2, 0x2A, 0x66, 0x39, 0x17, 0xC2, 0x85, 0xA3, 0x2A, 0x62,
-	0x8E, 0x36, 0x50, 0x88, 0xE3, 0x7A, 0x0F, 0x37, 0x05, 0xE8, 0xD8, 0x50,
-	0xA5, 0x81, 0x55, 0xA5, 0xC8, 0x57, 0x30, 0x6F, 0x30, 0xB4, 0x4A, 0x5C,
-	0x81, 0xBE, 0xF5, 0x83, 0x90, 0xC1, 0x3E, 0x62, 0x95, 0x06, 0xBA, 0xDC,
-	0x13, 0x4F, 0xFA, 0xA0, 0xE5, 0xDB, 0xC6, 0xF3, 0x4B, 0x05, 0xFF, 0xBA,
-	0x87, 0xE6, 0x55, 0x39, 0xB1, 0xC2, 0x7C, 0x26, 0x94, 0x63, 0x43, 0x13,
-	0x0B, 0xC7, 0xBD, 0xB2, 0x5C, 0x07, 0xB2, 0x8D, 0x32, 0x9A, 0xC0, 0xF5,
-	0x07, 0xC1, 0xFC, 0x1F, 0x86, 0xE4, 0xD4, 0x71, 0xDC, 0x0A, 0x9B, 0xBD,
-	0x65, 0xFB, 0x3D, 0xD0, 0xBE, 0x09, 0x03, 0x17, 0x48, 0x86, 0xB0, 0x2B,
-	0xA0, 0x7E, 0x80, 0xF2, 0xC1, 0xB3, 0x71, 0x86, 0x7C, 0xD2, 0x93, 0xC1,
-	0x32, 0xF1, 0xB8, 0x2C, 0x62, 0x73, 0xDD, 0x03, 0xAA, 0x4F, 0x67, 0xA0,
-	0x85, 0x61, 0x5D, 0x45, 0x24, 0x9D, 0xE7, 0xE7, 0x45, 0xE0, 0xF4, 0xA3,
-	0xA1, 0xBE, 0x15, 0x1E, 0x72, 0xCF, 0xA6, 0x86, 0xCB, 0xC6, 0x71, 0xDC,
-	0xF7, 0x1C, 0xE1, 0xCD, 0x5A, 0x90, 0x2D, 0xA4, 0xB5, 0x32, 0x8C, 0x7A,
-	0x32, 0xD8, 0xBE, 0xEB, 0x78, 0x7A, 0x35, 0xAC, 0xF6, 0x90, 0x6E, 0x85,
-	0x61, 0x0B, 0xE3, 0x54, 0xC9, 0x27, 0xB0, 0x57, 0xC1, 0x1D, 0x84, 0x74,
-	0x13, 0x88, 0x22, 0x38, 0x1F, 0x43, 0x5A, 0xF5, 0x12, 0x6E, 0x46, 0x82,
-	0x19, 0x19, 0x34, 0x0D, 0x1C, 0x4B, 0xA5, 0x79, 0x86, 0xDC, 0xC1, 0xE0,
-	0x4C, 0x38, 0x3D, 0x53, 0x06, 0x73, 0xA5, 0x2A, 0x2D, 0xED, 0xA1, 0xBF,
-	0xE0, 0x46, 0x1A, 0xB3, 0x6D, 0x03, 0xBB, 0x56, 0x91, 0x7D, 0x5F, 0xE8,
-	0xCD, 0x9D, 0xC3, 0x16, 0x82, 0x37, 0x7D, 0xC0, 0x54, 0x2E, 0x0C, 0x51,
-	0x37, 0x32, 0x14, 0x5B, 0x65, 0xFE, 0x2A, 0x2C, 0x2C, 0x6C, 0x86, 0x10,
-	0x5A, 0xA5, 0x1B, 0x7B, 0x96, 0x06, 0xEE, 0x10, 0x0E, 0x29, 0x9C, 0x9D,
-	0x2B, 0xE9, 0x6D, 0xEF, 0xA5, 0x47, 0x95, 0xF2, 0x25, 0x61, 0xF3, 0xA8,
-	0xF8, 0x4D, 0xC0, 0xB7, 0xCA, 0xC6, 0xB5, 0x34, 0x16, 0xB2, 0x08, 0x6E,
-	0xF7, 0x30, 0xFE, 0xEE, 0x99, 0x97, 0xC2, 0x76, 0x0E, 0xBF, 0x1B, 0xA5,
-	0x3C, 0xF5, 0x4C, 0x13, 0xB8, 0xA9, 0xE1, 0x87, 0x89, 0xB0, 0x5F, 0xC0,
-	0x2A, 0x56, 0xEE, 0x1F, 0xFA, 0xA0, 0x06, 0x1E, 0x16, 0xB5, 0xA3, 0xEA,
-	0x0C, 0xB2, 0x85, 0xF1, 0x67, 0x65, 0x92, 0x29, 0xEB, 0x46, 0xE8, 0xF2,
-	0x3E, 0x12, 0x7E, 0x5C, 0x0B, 0xF5, 0x4A, 0xF8, 0x5E, 0x2A, 0x5B, 0xD7,
-	0xAB, 0xD2, 0x4F, 0xC7, 0x16, 0xCD, 0x03, 0x7B, 0xA7, 0x6C, 0x36, 0x1E,
-	0x3D, 0xF4, 0xC8, 0x94, 0xC5, 0x35, 0xFC, 0xF5, 0x34, 0x65, 0x72, 0xAD,
-	0x3C, 0x44, 0x1D, 0xDF, 0x36, 0xCA, 0xF0, 0x05, 0xAA, 0xB7, 0x88, 0x27,
-	0x67, 0x79, 0x4B, 0x5A, 0xC6, 0x35, 0x0C, 0x5F, 0x85, 0x7D, 0x6E, 0x88,
-	0x56, 0x60, 0x5E, 0x02, 0xB1, 0xEB, 0x67, 0xE8, 0xB3, 0x01, 0x4C, 0x27,
-	0xCA, 0xE4, 0xA4, 0x23, 0x3B, 0x33, 0x14, 0xD3, 0x80, 0x8B, 0xC0, 0x35,
-	0x42, 0x79, 0x50, 0xA6, 0xB1, 0xF2, 0x97, 0x73, 0x88, 0x2F, 0xE1, 0xF7,
-	0x24, 0xA5, 0x7A, 0x6B, 0x39, 0xAC, 0x1C, 0x93, 0x97, 0x98, 0xF0, 0xEA,
-	0xD9, 0xAC, 0x95, 0xFD, 0x2B, 0x0C, 0x1C, 0xBC, 0x1B, 0x1A, 0xE2, 0x42,
-	0xA9, 0x66, 0x4A, 0xB7, 0x85, 0xFB, 0xB7, 0xC0, 0xFA, 0x0D, 0x28, 0x23,
-	0x66, 0xA2, 0x5C, 0x8F, 0x95, 0xD1, 0xDC, 0xF3, 0x56, 0x38, 0xEE, 0x4B,
-	0xC8, 0xA7, 0xF0, 0xD1, 0x0B, 0x67, 0x4E, 0x48, 0x97, 0x81, 0x5D, 0xA4,
-	0xF8, 0x89, 0x10, 0x9D, 0x08, 0x87, 0x04, 0x5E, 0xF0, 0x1C, 0xE7, 0x70,
-	0x9A, 0x5A, 0xDE, 0x9D, 0x79, 0x26, 0xA7, 0xB0, 0x8C, 0x84, 0xDD, 0xCE,
-	0xE0, 0x4B, 0x8F, 0xAD, 0xC1, 0x84, 0x8E, 0xA6, 0x83, 0x06, 0x18, 0xA4,
-	0x60, 0x2C, 0x08, 0x90, 0x67, 0xCA, 0x78, 0x0A, 0xC7, 0x89, 0xB0, 0xF3,
-	0x4A, 0xF4, 0xFB, 0x0B, 0x7C, 0x78, 0x86, 0xA6, 0x6B, 0x31, 0x05, 0x14,
-	0x11, 0x64, 0x0D, 0xAC, 0x5B, 0xE1, 0xB3, 0x15, 0x56, 0x71, 0xC0, 0x5E,
-	0xC2, 0x55, 0x26, 0x9C, 0xCC, 0x2C, 0x3B, 0xEB, 0xF9, 0xEF, 0x26, 0xB0,
-	0xDC, 0x78, 0x9A, 0xEF, 0x8E, 0xE1, 0x06, 0x46, 0x39, 0x4C, 0xCE, 0x85,
-	0xFC, 0xCA, 0xD2, 0xE5, 0x4A, 0xB3, 0x81, 0xC3, 0xB3, 0xC7, 0x7C, 0x35,
-	0xC8, 0x44, 0x89, 0x16, 0x1D, 0xA3, 0xA2, 0x17, 0x35, 0xCC, 0xAE, 0x23,
-	0x16, 0x39, 0x64, 0x23, 0xE5, 0xAB, 0xB5, 0x44, 0xEA, 0xF1, 0x2D, 0xE8,
-	0x20, 0xA2, 0xDD, 0x78, 0xA8, 0x03, 0x45, 0x09, 0xC3, 0x35, 0xE8, 0x1F,
-	0xC2, 0xE2, 0x18, 0xF8, 0x3C, 0x87, 0x37, 0xE0, 0x6E, 0xEB, 0x89, 0x97,
-	0x70, 0xF4, 0x86, 0x7C, 0xAA, 0x5C, 0x0D, 0x7B, 0x1B, 0xD9, 0xBD, 0x0B,
-	0x6C, 0x37, 0x82, 0xF1, 0x30, 0x9C, 0xF4, 0x3D, 0x85, 0x79, 0x12, 0x91,
-	0xBA, 0x40, 0xBC, 0xF4, 0xAC, 0x4A, 0xE5, 0x21, 0x81, 0xFF, 0x2A, 0x95,
-	0xB7, 0xCE, 0xD1, 0xCC, 0x0C, 0xDD, 0x11, 0x2A, 0xDB, 0x5F, 0x4E, 0xBB,
-	0xDA, 0xD3, 0x79, 0x28, 0x72, 0xC3, 0x2C, 0x82, 0xDB, 0x5B, 0xE5, 0xE7,
-	0x4F, 0xC2, 0xCD, 0x8D, 0x65, 0x76, 0x61, 0x48, 0x72, 0xC5, 0xC4, 0xF0,
-	0x7A, 0x88, 0xD8, 0x3F, 0x74, 0x10, 0x3C, 0x37, 0x51, 0xCC, 0xAD, 0xF6,
-	0xA8, 0xDB, 0xAF, 0xBB, 0x96, 0xF0, 0xCD, 0xD1, 0x3C, 0xC3, 0xFE, 0x6B,
-	0x44, 0xBB, 0x84, 0xEF, 0xA5, 0x43, 0x6B, 0x38, 0x17, 0xCF, 0x59, 0xAD,
-	0x98, 0x0B, 0x4B, 0x3D, 0x52, 0xDE, 0x12, 0x43, 0xE9, 0x95, 0x52, 0x3C,
-	0x36, 0x75, 0x64, 0x5E, 0x19, 0x0F, 0x85, 0x38, 0x16, 0xCA, 0x4C, 0x78,
-	0x99, 0xC1, 0xE8, 0x63, 0xE0, 0xA6, 0x36, 0xB8, 0x8D, 0xE2, 0x97, 0x86,
-	0x34, 0x04, 0xAC, 0x55, 0xE2, 0xDC, 0xD1, 0xEE, 0x0D, 0x65, 0x25, 0x98,
-	0x48, 0x39, 0x1B, 0xC2, 0xA9, 0xB5, 0x84, 0x8D, 0xB2, 0xAE, 0x03, 0xDF,
-	0x5F, 0x1D, 0x1C, 0xFA, 0xB8, 0x9D, 0x3A, 0xC1, 0xA5, 0x4A, 0x76, 0x6A,
-	0x28, 0x06, 0x8A, 0x1D, 0x1A, 0x0A, 0xE9, 0x07, 0x45, 0xC7, 0xCC, 0xB2,
-	0x26, 0xF0, 0xF9, 0xCD, 0x13, 0x3D, 0xEC, 0x02, 0xE7, 0x03, 0x90, 0x1C,
-	0xF2, 0x5C, 0x18, 0xA6, 0x86, 0xD6, 0x5B, 0xB6, 0x1B, 0xE8, 0x54, 0xF1,
-	0xB1, 0x32, 0x3E, 0x83, 0xB1, 0x89, 0xB0, 0xAD, 0xE2, 0x96, 0xFD, 0x5A,
-	0x78, 0xBD, 0xEC, 0xF9, 0xBC, 0xD9, 0x14, 0x6E, 0xCF, 0x2C, 0x7F, 0x7D,
-	0xA7, 0x64, 0x17, 0x81, 0x7B, 0x63, 0xF9, 0xEC, 0x3C, 0xEB, 0x2F, 0x70,
-	0xF2, 0x2D, 0x90, 0x0A, 0xCC, 0x6F, 0x2C, 0xA7, 0x1F, 0x84, 0xD3, 0x91,
-	0x21, 0xB3, 0x16, 0x71, 0x1D, 0xF6, 0x01, 0x12, 0x84, 0x28, 0x85, 0xF2,
-	0x3A, 0xE2, 0x2D, 0x4F, 0xB0, 0x6F, 0x15, 0xC3, 0x3D, 0xA4, 0x0D, 0xFD,
-	0x88, 0x36, 0x38, 0xF4, 0x01, 0xDC, 0x06, 0x34, 0x16, 0xBE, 0x7A, 0x21,
-	0x18, 0xA5, 0xEE, 0x22, 0xC6, 0x5D, 0x87, 0x1C, 0x61, 0xEB, 0x94, 0x0D,
-	0x60, 0x07, 0xCA, 0xF5, 0x19, 0x7C, 0x3C, 0x35, 0x4C, 0x51, 0xEA, 0xB5,
-	0xC1, 0xBE, 0x74, 0x8C, 0x6B, 0x65, 0x56, 0xC0, 0xD7, 0x61, 0xC4, 0x97,
-	0x38, 0xB0, 0x96, 0xC0, 0x28, 0x0B, 0x5C, 0xB5, 0x7D, 0xBE, 0x71, 0xBB,
-	0x17, 0x56, 0x28, 0x2E, 0x83, 0x9B, 0x1F, 0x94, 0x8F, 0xEF, 0x0D, 0xEF,
-	0xFF, 0xE2, 0x39, 0xB9, 0xB2, 0x0C, 0x67, 0x06, 0x6B, 0x1D, 0xAE, 0x55,
-	0xB6, 0x3B, 0xC3, 0xF2, 0x0D, 0xAA, 0x17, 0x38, 0x5B, 0x41, 0x61, 0x15,
-	0x9B, 0x2B, 0x58, 0x41, 0x8F, 0x81, 0x6E, 0x2B, 0x74, 0x5B, 0x58, 0xEE,
-	0x5B, 0x92, 0x2A, 0xF0, 0x16, 0xF5, 0x63, 0xF5, 0x22, 0xC0, 0x65, 0x09,
-	0x93, 0xE7, 0x40, 0x13, 0x2B, 0x87, 0x13, 0xA5, 0x7B, 0x6F, 0x88, 0x0B,
-	0x43, 0x71, 0x0C, 0x24, 0x16, 0x34, 0x55, 0x9C, 0x33, 0xD0, 0x0A, 0x83,
-	0x61, 0x60, 0x34, 0x15, 0x4A, 0x12, 0x4A, 0x5A, 0x76, 0x65, 0xBF, 0x97,
-	0x58, 0x08, 0x0C, 0x56, 0x8A, 0x3B, 0x06, 0xC4, 0x2B, 0x59, 0xDE, 0x6B,
-	0xFA, 0xAA, 0xD7, 0x88, 0xCD, 0xB1, 0xE3, 0xB9, 0x82, 0x8D, 0x8F, 0xE8,
-	0x12, 0x8F, 0x2D, 0x94, 0x78, 0xA2, 0x4C, 0x46, 0x90, 0x2F, 0x04, 0x33,
-	0xEA, 0xF9, 0x84, 0xAE, 0x05, 0xB3, 0x53, 0xF6, 0xEB, 0xC0, 0xF7, 0x17,
-	0xE1, 0xFB, 0xDA, 0x12, 0x8D, 0x16, 0xC2, 0xF8, 0x7D, 0x5F, 0x89, 0x4A,
-	0x4A, 0x8B, 0x59, 0x29, 0xE5, 0xCA, 0xD3, 0xD6, 0x01, 0x5B, 0x44, 0x64,
-	0xE7, 0x16, 0x3B, 0xF6, 0xD4, 0xCE, 0xB3, 0x7F, 0x0C, 0x3C, 0xBE, 0x40,
-	0xDB, 0xC2, 0x40, 0xE0, 0xF4, 0x1A, 0x3E, 0xCD, 0x84, 0x4F, 0x67, 0x30,
-	0x2A, 0x94, 0xA6, 0x8A, 0xF8, 0xFE, 0xE6, 0xF9, 0x9F, 0xEB, 0x40, 0xEB,
-	0xE1, 0xE7, 0x1C, 0x6E, 0x22, 0xE1, 0xE3, 0x00, 0x86, 0xE3, 0x80, 0x29,
-	0x22, 0x8C, 0x73, 0x1C, 0x36, 0x8E, 0xC3, 0xB3, 0xD0, 0xB6, 0x8A, 0x99,
-	0x80, 0x3B, 0xB5, 0x7C, 0x2F, 0x3C, 0x47, 0xAB, 0x7C, 0x98, 0x19, 0x66,
-	0x19, 0x04, 0x94, 0xE5, 0x5A, 0x59, 0x7F, 0x87, 0x66, 0x03, 0xA8, 0xF0,
-	0xA2, 0x16, 0xD7, 0x3A, 0x62, 0x21, 0x68, 0xA0, 0x12, 0x00, 0x00, 0x20,
-	0x00, 0x49, 0x44, 0x41, 0x54, 0xDF, 0x32, 0xF7, 0x20, 0x5D, 0x84, 0x1B,
-	0x42, 0x32, 0x51, 0xC6, 0x97, 0xCA, 0xBF, 0xBD, 0x33, 0x9C, 0x8C, 0x63,
-	0xF6, 0x87, 0x8E, 0xD7, 0x63, 0xCB, 0x61, 0x61, 0x48, 0x8F, 0x30, 0x2C,
-	0x61, 0xF8, 0x0C, 0xF7, 0x28, 0x71, 0x6B, 0x59, 0x78, 0xCF, 0x38, 0x85,
-	0xA1, 0x2A, 0xDB, 0x58, 0xF9, 0x3D, 0x87, 0x76, 0x01, 0x9F, 0x7E, 0x56,
-	0xFE, 0xC7, 0xBF, 0x27, 0x9C, 0xDE, 0x74, 0x38, 0x84, 0xD2, 0x39, 0x1A,
-	0x1F, 0x38, 0xD6, 0x86, 0xE5, 0xCA, 0xF3, 0x74, 0xE7, 0x89, 0xEE, 0x0D,
-	0xF9, 0x2B, 0xBC, 0x1E, 0x1D, 0x59, 0x05, 0xA1, 0x86, 0x43, 0x63, 0xD0,
-	0xA6, 0x97, 0x52, 0xE8, 0xC4, 0xF7, 0xC3, 0x97, 0x21, 0x1C, 0xC7, 0x86,
-	0xB4, 0x33, 0x7C, 0xBC, 0x73, 0xCC, 0xD6, 0x4A, 0x9D, 0xF7, 0xEF, 0xEF,
-	0x24, 0x0D, 0x8C, 0x53, 0xE1, 0x24, 0x83, 0xB3, 0xB9, 0x21, 0x46, 0x38,
-	0x3C, 0x07, 0xCC, 0x56, 0x39, 0x3F, 0xF6, 0xCF, 0xE6, 0x68, 0xD0, 0xF2,
-	0x60, 0x3C, 0x8F, 0x17, 0x86, 0x28, 0xFF, 0x13, 0x54, 0xB1, 0x51, 0xBA,
-	0xB5, 0x12, 0x97, 0x06, 0x5B, 0x1A, 0xDE, 0x6C, 0xA0, 0x0C, 0x2D, 0xAB,
-	0x26, 0x50, 0x5A, 0x30, 0x43, 0xC5, 0x8C, 0x14, 0x3F, 0x37, 0x24, 0x33,
-	0xE1, 0x66, 0x24, 0x74, 0x45, 0xE0, 0xB1, 0x86, 0x97, 0x6D, 0x80, 0xAD,
-	0x12, 0x9E, 0xE1, 0xEE, 0xB5, 0x37, 0xC1, 0x17, 0x85, 0x21, 0xFA, 0xF0,
-	0x31, 0xE5, 0xF4, 0x5D, 0x47, 0x64, 0x3C, 0xD5, 0xB3, 0x43, 0xFF, 0xBF,
-	0x40, 0xE8, 0x01, 0x66, 0x5E, 0xE9, 0x26, 0xD0, 0x56, 0xCA, 0xA3, 0x87,
-	0xD6, 0x47, 0xAC, 0x73, 0x47, 0x98, 0xC0, 0x79, 0x64, 0xF8, 0xB1, 0x30,
-	0xFC, 0x75, 0x60, 0x39, 0x8F, 0x7A, 0x6A, 0xD7, 0xD3, 0xA3, 0xE7, 0xE5,
-	0x35, 0xB0, 0x0F, 0x50, 0x9F, 0xC0, 0xE1, 0xC6, 0x30, 0x98, 0xC2, 0x87,
-	0xC2, 0x63, 0x06, 0xB0, 0x4D, 0x6A, 0x8C, 0x83, 0xB6, 0x81, 0xED, 0x56,
-	0x58, 0xAD, 0x94, 0xC3, 0x3D, 0x1C, 0xCE, 0x3C, 0xE1, 0x22, 0x30, 0x9D,
-	0x42, 0x72, 0x65, 0x88, 0x93, 0xC0, 0xB6, 0x34, 0x7C, 0xEE, 0x02, 0x2F,
-	0x53, 0x25, 0xAC, 0x81, 0x43, 0xA0, 0xA9, 0x02, 0xBE, 0x16, 0x4C, 0x24,
-	0x98, 0xD0, 0x33, 0xF4, 0xB2, 0xA8, 0xDF, 0xD8, 0x0D, 0xBD, 0x65, 0x71,
-	0x84, 0x22, 0x52, 0x56, 0x99, 0xE0, 0x6F, 0x85, 0xF6, 0x22, 0xA2, 0x79,
-	0x55, 0x8E, 0xBF, 0x74, 0x24, 0x77, 0x8E, 0x77, 0x01, 0xC6, 0x73, 0xCF,
-	0x8F, 0x63, 0x78, 0x9F, 0x0B, 0x89, 0x18, 0x3E, 0x67, 0xCA, 0x6E, 0x16,
-	0x48, 0xDE, 0xC3, 0xE2, 0xEF, 0x86, 0xF4, 0xAC, 0x65, 0xDF, 0x0A, 0xDB,
-	0x17, 0x43, 0xBD, 0x75, 0x24, 0x4E, 0x38, 0xEE, 0x94, 0xE5, 0x1D, 0x3C,
-	0x7D, 0x33, 0x4C, 0xFF, 0xCC, 0x28, 0x3C, 0x37, 0xB0, 0xAE, 0x3D, 0xBA,
-	0x82, 0xFD, 0x32, 0x90, 0x97, 0x20, 0x53, 0xC3, 0x30, 0x51, 0xDA, 0x91,
-	0xB2, 0x9C, 0x82, 0x5C, 0xF8, 0x1E, 0xAA, 0x15, 0x81, 0x7F, 0x85, 0xC8,
-	0x83, 0x7D, 0xB1, 0x24, 0xB9, 0x63, 0x30, 0x0A, 0x2C, 0x66, 0x70, 0x36,
-	0x33, 0x98, 0xA3, 0xF2, 0x26, 0x4A, 0x75, 0x80, 0xD3, 0x52, 0x78, 0xB7,
-	0x36, 0xB8, 0x31, 0x3C, 0xCF, 0x0D, 0x7A, 0x12, 0xB0, 0x27, 0x42, 0x19,
-	0x62, 0x9E, 0xDA, 0x8E, 0x06, 0x65, 0xD0, 0x28, 0xE2, 0x3C, 0xFB, 0xA1,
-	0xB2, 0x49, 0xA1, 0x29, 0x20, 0xB3, 0x42, 0x51, 0x28, 0x7E, 0x0C, 0xC3,
-	0x31, 0x64, 0xA9, 0x81, 0x56, 0x09, 0x6F, 0xC2, 0x61, 0x19, 0x78, 0x7A,
-	0x83, 0xDF, 0x3B, 0xC5, 0x36, 0x30, 0xDC, 0x5B, 0x3E, 0x44, 0x1E, 0xBF,
-	0x50, 0xA2, 0xDB, 0x99, 0x23, 0x8B, 0x02, 0xEA, 0xA0, 0xCE, 0xC0, 0x8F,
-	0xFB, 0x3C, 0xFC, 0xB8, 0x86, 0xAB, 0x6D, 0x60, 0x63, 0x84, 0xE5, 0xDE,
-	0x50, 0x1A, 0x45, 0x7D, 0x20, 0x19, 0xF6, 0xE5, 0xCD, 0x45, 0xA4, 0x2C,
-	0x6A, 0xC5, 0x1C, 0x7A, 0x1E, 0x6E, 0xBD, 0x87, 0xBA, 0x09, 0x64, 0x03,
-	0xB8, 0x2A, 0xE0, 0xB8, 0x80, 0xF4, 0x4A, 0x89, 0x27, 0x60, 0x0F, 0x86,
-	0xB8, 0xEC, 0xA7, 0x85, 0xC7, 0x0C, 0x56, 0x43, 0xF8, 0x6E, 0x03, 0x5F,
-	0x0E, 0xF0, 0x56, 0x0A, 0x59, 0xED, 0x38, 0x31, 0x70, 0x3D, 0x14, 0x0A,
-	0x3C, 0xC7, 0x63, 0x8F, 0x79, 0x5B, 0x1F, 0x7B, 0x1B, 0xF7, 0x6C, 0x12,
-	0x08, 0xA1, 0x37, 0x7E, 0x05, 0xAB, 0x90, 0xF6, 0x13, 0xC0, 0x89, 0x53,
-	0xD2, 0x43, 0x20, 0xC9, 0x20, 0xDA, 0x80, 0x58, 0x4F, 0x62, 0x3D, 0x27,
-	0x0B, 0x21, 0x1A, 0x0B, 0x4D, 0xD9, 0xF1, 0xD2, 0xC1, 0xC3, 0x9B, 0xA0,
-	0x47, 0xE1, 0x6F, 0x85, 0x72, 0x36, 0xB5, 0x4C, 0x2F, 0x3D, 0xE3, 0x42,
-	0x31, 0x04, 0x92, 0x01, 0x2C, 0xCE, 0x0D, 0x83, 0x4F, 0x31, 0xF3, 0x4B,
-	0xA1, 0x76, 0x35, 0x0F, 0x5F, 0x62, 0x9E, 0x7F, 0xF3, 0x4C, 0x5E, 0x95,
-	0x77, 0x5D, 0xFF, 0x8F, 0x3B, 0xEC, 0xE0, 0xB0, 0x0D, 0x5C, 0x55, 0x30,
-	0x8B, 0x85, 0xF6, 0xCC, 0xF2, 0x5D, 0x2D, 0xBB, 0x61, 0x1F, 0x03, 0x9B,
-	0xBF, 0xC2, 0x45, 0xAC, 0x58, 0xAF, 0x2C, 0x1B, 0x58, 0x1C, 0x0C, 0xB6,
-	0xEB, 0x19, 0xC5, 0xC7, 0x54, 0xD9, 0x0F, 0x0C, 0xE6, 0x15, 0xBA, 0xAA,
-	0x23, 0x33, 0x7F, 0x16, 0x5F, 0x66, 0x42, 0x14, 0x02, 0x9B, 0xAD, 0xB2,
-	0x39, 0x02, 0x29, 0x8C, 0x12, 0x38, 0x09, 0xBD, 0xA6, 0xEE, 0x6C, 0x6D,
-	0xD8, 0x07, 0xE8, 0xBC, 0x61, 0x95, 0x04, 0x42, 0x13, 0x48, 0x03, 0x2C,
-	0x22, 0x25, 0xCD, 0xA1, 0x1B, 0x5A, 0xCA, 0x54, 0x40, 0xFA, 0x90, 0x69,
-	0x6E, 0x84, 0xD0, 0x1A, 0xE2, 0x6D, 0xA0, 0x5D, 0x07, 0x1E, 0x1A, 0xD8,
-	0x1D, 0x2C, 0x4F, 0xC7, 0x7E, 0x21, 0x16, 0x52, 0x61, 0x30, 0x56, 0xAE,
-	0x66, 0xCA, 0x75, 0xDC, 0x97, 0x7A, 0xA2, 0xB3, 0xD0, 0xAF, 0x3F, 0xFD,
-	0xC0, 0xD0, 0x08, 0x84, 0xB9, 0xE0, 0xCB, 0x1E, 0x18, 0x19, 0x0E, 0xCA,
-	0xF1, 0x77, 0x78, 0x23, 0x90, 0x25, 0x30, 0x2B, 0x94, 0xF1, 0x4D, 0x4A,
-	0x33, 0x32, 0xD4, 0x78, 0xAA, 0x63, 0xE0, 0xB8, 0x57, 0x62, 0x05, 0x33,
-	0x81, 0xC9, 0x6D, 0xCF, 0x0C, 0x4A, 0x33, 0x65, 0x9B, 0x58, 0xB2, 0x49,
-	0xE0, 0x39, 0x53, 0x32, 0x11, 0xAE, 0x11, 0x5C, 0x02, 0xF7, 0x62, 0x78,
-	0x0A, 0xCA, 0x67, 0x17, 0xF8, 0x1A, 0x5B, 0xD2, 0xA2, 0xAF, 0x6D, 0xFF,
-	0xB4, 0x87, 0x8F, 0x8F, 0x10, 0x6F, 0x0C, 0x0F, 0x4D, 0x60, 0x73, 0x54,
-	0x62, 0x6B, 0x99, 0x67, 0x29, 0x69, 0xEA, 0xA8, 0x47, 0x1D, 0x89, 0x85,
-	0x16, 0x08, 0x05, 0x20, 0xE0, 0x77, 0x86, 0xD1, 0x3E, 0x60, 0x2B, 0xC5,
-	0x12, 0x08, 0x53, 0xA1, 0x1B, 0x28, 0xC3, 0x56, 0xA9, 0x57, 0x86, 0xD5,
-	0x63, 0xDF, 0x1A, 0x5A, 0xAF, 0x84, 0xD3, 0x01, 0xBC, 0x3F, 0x4F, 0x38,
-	0x3B, 0x51, 0x36, 0x0B, 0xC7, 0xD1, 0xF6, 0x45, 0x8F, 0x08, 0xF8, 0xB1,
-	0x89, 0x98, 0x56, 0x31, 0xD9, 0x73, 0xCD, 0xF3, 0xA3, 0xE1, 0x8F, 0xFF,
-	0x0C, 0xBC, 0xFC, 0xD3, 0xF3, 0xD3, 0x51, 0xC8, 0x86, 0x60, 0x46, 0x42,
-	0x16, 0x2B, 0xC3, 0xB9, 0x61, 0x91, 0xC1, 0x89, 0xF3, 0x94, 0x43, 0xCF,
-	0x97, 0x44, 0x78, 0x30, 0x90, 0xE6, 0x30, 0x6F, 0xE1, 0xC6, 0x09, 0x95,
-	0xEB, 0x09, 0xE0, 0xF1, 0x8B, 0x25, 0x36, 0x81, 0xA0, 0x50, 0x15, 0xB0,
-	0x49, 0x0C, 0x36, 0xEA, 0x81, 0x56, 0x45, 0x6A, 0x18, 0x44, 0x90, 0xD5,
-	0xCA, 0xE6, 0x4D, 0x59, 0x3E, 0xC3, 0xC1, 0x0B, 0xA3, 0x8B, 0x1E, 0xE4,
-	0xD0, 0xB5, 0x8A, 0x7F, 0x55, 0x06, 0x6B, 0xCF, 0xBC, 0x31, 0xBC, 0x1E,
-	0x95, 0x4D, 0xD1, 0x51, 0x2A, 0x0C, 0x46, 0x30, 0xC8, 0x85, 0x1C, 0x83,
-	0x04, 0x21, 0xB4, 0x8A, 0x0B, 0x4A, 0x1B, 0xFA, 0xAE, 0x61, 0xDA, 0xF5,
-	0x9A, 0xB9, 0x63, 0x03, 0xCE, 0x09, 0x87, 0xC8, 0xE3, 0x27, 0x42, 0x9C,
-	0x0B, 0xEB, 0x29, 0x48, 0xAA, 0x34, 0x26, 0x90, 0x05, 0x18, 0x1B, 0x4F,
-	0x74, 0xAE, 0x81, 0x41, 0x88, 0x68, 0x09, 0xBC, 0xB6, 0x81, 0xDD, 0x9B,
-	0xC5, 0x6C, 0x85, 0x6C, 0xD7, 0x71, 0xBF, 0xED, 0x79, 0xF4, 0xB5, 0xEF,
-	0x07, 0x09, 0xFF, 0xD6, 0xC2, 0x2C, 0xF6, 0x3C, 0x7A, 0xCB, 0xF7, 0x91,
-	0x50, 0xB5, 0x81, 0x3A, 0x71, 0xD4, 0x63, 0x98, 0x9D, 0x19, 0x46, 0xA7,
-	0xB0, 0xCF, 0x95, 0x36, 0x31, 0xE4, 0x0E, 0x9A, 0xBA, 0x7F, 0xBE, 0x6D,
-	0x93, 0xC0, 0x7C, 0x62, 0x70, 0x6D, 0xC4, 0xEB, 0xCA, 0xF1, 0xDB, 0x5A,
-	0xB8, 0x53, 0xC3, 0x61, 0xE2, 0x29, 0xD4, 0x90, 0x28, 0xE4, 0x75, 0x20,
-	0xFD, 0xA6, 0x94, 0xD6, 0xB3, 0xF6, 0xD0, 0x39, 0x98, 0xC4, 0x8A, 0x64,
-	0x1D, 0x71, 0x1A, 0x58, 0xE6, 0x4A, 0x72, 0xD9, 0x8B, 0x2A, 0x9A, 0xC2,
-	0xD0, 0x35, 0xCA, 0xD3, 0x8B, 0xA5, 0x70, 0xCA, 0x44, 0x94, 0xEC, 0x4F,
-	0xA2, 0xD2, 0x36, 0x6E, 0xD9, 0x7F, 0x4D, 0xF8, 0xF2, 0x4F, 0xE5, 0xFB,
-	0x97, 0xC0, 0xC3, 0x1E, 0xDC, 0x0C, 0x3E, 0x5D, 0xC0, 0xC9, 0xC8, 0x93,
-	0x8C, 0x3C, 0x6D, 0x0E, 0x87, 0x14, 0x9A, 0x23, 0xB4, 0xAF, 0xB0, 0x78,
-	0xEE, 0x78, 0xFF, 0xD5, 0xB3, 0x4F, 0x95, 0x7F, 0x6C, 0xE1, 0xDB, 0xF7,
-	0xFE, 0x08, 0x9C, 0x0E, 0xFB, 0xF8, 0x57, 0x7E, 0x1A, 0x71, 0x39, 0xEC,
-	0x10, 0x67, 0xC9, 0x57, 0x81, 0xFC, 0x0E, 0xF2, 0x7B, 0xB0, 0x71, 0xC0,
-	0x67, 0x90, 0xDE, 0x40, 0x36, 0x81, 0xD4, 0x5B, 0xCA, 0xAD, 0xE1, 0x78,
-	0x17, 0x78, 0x7B, 0xE9, 0x68, 0x6A, 0x88, 0x0F, 0xC2, 0x71, 0x21, 0x3C,
-	0xE3, 0x18, 0x75, 0x3D, 0x67, 0x79, 0x64, 0x0C, 0x7A, 0x54, 0x76, 0x9B,
-	0x40, 0xBD, 0xED, 0x8F, 0x44, 0x1D, 0x0A, 0xEE, 0xD2, 0xD0, 0x9D, 0xC2,
-	0xB6, 0xB1, 0xB4, 0x91, 0xC7, 0x89, 0x32, 0xA9, 0x23, 0x8E, 0x91, 0xA7,
-	0x32, 0x42, 0x93, 0xF6, 0x41, 0x4F, 0x5F, 0x0A, 0xED, 0x0E, 0xEA, 0xC6,
-	0x51, 0x29, 0xB4, 0x22, 0x90, 0xC0, 0xA0, 0x50, 0x06, 0x85, 0xD0, 0x45,
-	0xF4, 0x7F, 0x5B, 0x45, 0x8C, 0x2C, 0x8C, 0xC6, 0x1D, 0xC5, 0xDC, 0xB2,
-	0x3F, 0x0D, 0xB4, 0x16, 0xF6, 0x15, 0x94, 0x55, 0xCB, 0xBC, 0x11, 0xA2,
-	0xC9, 0x1D, 0x14, 0xAF, 0xB0, 0xF4, 0xC2, 0xBF, 0x76, 0xF0, 0xF4, 0xCD,
-	0x91, 0x3E, 0x0B, 0x27, 0x6B, 0x65, 0x5D, 0x09, 0x2B, 0x01, 0xA6, 0x86,
-	0xD3, 0x73, 0xE5, 0x76, 0x62, 0x19, 0xE1, 0x69, 0x3A, 0xC7, 0x9B, 0x83,
-	0x30, 0x33, 0xD4, 0x33, 0xA1, 0x9C, 0x69, 0x0F, 0x3F, 0x8E, 0x20, 0x16,
-	0x47, 0x14, 0x09, 0x59, 0x64, 0x08, 0x2E, 0x90, 0x1C, 0x20, 0xAF, 0xE1,
-	0x58, 0x19, 0x8E, 0x07, 0xA8, 0xD6, 0xD0, 0x1D, 0x2D, 0x12, 0x3B, 0xA6,
-	0x89, 0x65, 0xD8, 0x45, 0x68, 0xD3, 0xB1, 0x6A, 0x23, 0xD2, 0xD2, 0xE3,
-	0xBC, 0x52, 0x1A, 0x43, 0x40, 0x19, 0xEE, 0x02, 0x63, 0x0D, 0x0C, 0x73,
-	0x88, 0xDE, 0x43, 0x7B, 0x0A, 0xF9, 0x05, 0x74, 0xC3, 0xFE, 0xEB, 0xDF,
-	0x55, 0x2D, 0xF7, 0x29, 0x4C, 0xA5, 0xA7, 0x8E, 0xBF, 0x55, 0x9E, 0x3F,
-	0x56, 0x96, 0x5F, 0xFF, 0x3B, 0xF0, 0xF5, 0xBF, 0x1D, 0xFB, 0x57, 0x81,
-	0x59, 0xCC, 0xC9, 0x27, 0x88, 0xFE, 0xAD, 0xC3, 0xC4, 0x81, 0x49, 0xD7,
-	0xF3, 0xFD, 0x7F, 0x1B, 0xC1, 0xD3, 0x93, 0x10, 0xFF, 0x53, 0x99, 0xFC,
-	0x01, 0x76, 0x17, 0x88, 0x0A, 0x43, 0x3C, 0x08, 0x5C, 0x5B, 0x65, 0x7A,
-	0x25, 0x2C, 0xDE, 0x01, 0x67, 0x10, 0x12, 0x4F, 0xDC, 0x59, 0x38, 0x9A,
-	0x3E, 0x3F, 0x70, 0x80, 0xE1, 0x53, 0xDF, 0x90, 0x9A, 0x5F, 0xC0, 0xC9,
-	0x10, 0x8A, 0x22, 0x65, 0x99, 0x45, 0x3C, 0x49, 0xCB, 0xD3, 0x9B, 0xB2,
-	0x11, 0x4B, 0xBC, 0xF6, 0xC4, 0xC7, 0xDE, 0x23, 0xDC, 0x0C, 0x0D, 0x23,
-	0x63, 0xB0, 0x89, 0x47, 0x0F, 0x9E, 0xE6, 0x08, 0x84, 0x5E, 0xFD, 0x9E,
-	0x0C, 0xC0, 0x9D, 0x29, 0xE5, 0x42, 0xD9, 0x8C, 0x02, 0x45, 0xEE, 0x69,
-	0xE9, 0xB1, 0xFD, 0xBE, 0x72, 0xE4, 0x95, 0x72, 0xEA, 0x84, 0xDC, 0x80,
-	0x18, 0x48, 0x12, 0xA1, 0x35, 0x7D, 0x4A, 0x1A, 0xD3, 0x27, 0xA5, 0x67,
-	0x8B, 0xDE, 0x07, 0x14, 0xA6, 0xB0, 0x8A, 0x7A, 0xC9, 0x64, 0xFE, 0xCD,
-	0x31, 0x28, 0x23, 0x4E, 0x6A, 0x61, 0x68, 0x3C, 0x2F, 0x49, 0x9F, 0xA8,
-	0x7A, 0x43, 0xD8, 0xD6, 0x96, 0xEB, 0xAD, 0x21, 0xAA, 0xFF, 0xA1, 0xB8,
-	0xD0, 0x71, 0x57, 0x19, 0xBE, 0xED, 0x60, 0x55, 0x29, 0xF9, 0x51, 0x39,
-	0x36, 0x86, 0x55, 0x01, 0xCD, 0x19, 0x5C, 0xFD, 0xE8, 0x79, 0xF7, 0x31,
-	0xA2, 0x18, 0x59, 0xB2, 0x3A, 0x30, 0x6D, 0xE0, 0x22, 0x83, 0xE3, 0x65,
-	0x84, 0x1F, 0x29, 0x3B, 0xED, 0xE0, 0xD8, 0xE1, 0xDE, 0x22, 0xD4, 0x09,
-	0x71, 0xEC, 0x89, 0x07, 0x01, 0x8C, 0xD2, 0xBD, 0x41, 0xF9, 0x24, 0x94,
-	0x7B, 0x38, 0x34, 0x8E, 0x26, 0x56, 0x06, 0x43, 0xC7, 0xC4, 0x28, 0xD1,
-	0xD1, 0x32, 0xE9, 0x94, 0x28, 0x04, 0xCA, 0x4C, 0x79, 0xF8, 0x33, 0x93,
-	0x50, 0x5B, 0x25, 0xE4, 0xE0, 0x2B, 0x61, 0xBA, 0x85, 0x8B, 0xA3, 0x32,
-	0x5F, 0xC3, 0xF2, 0x08, 0x26, 0xC4, 0x84, 0x60, 0x78, 0x72, 0x2D, 0x6B,
-	0xD7, 0x6B, 0x64, 0x6C, 0x24, 0xC4, 0x95, 0x63, 0xFB, 0x0B, 0x7C, 0x7D,
-	0x4C, 0xF9, 0xE5, 0x73, 0xC3, 0xEB, 0x12, 0xB2, 0x0C, 0xCE, 0x7F, 0xF4,
-	0x5C, 0xFF, 0x0F, 0xE1, 0xF4, 0xC7, 0x98, 0x41, 0xEC, 0x39, 0x39, 0x82,
-	0x60, 0xB9, 0x6F, 0x3D, 0x6F, 0xEB, 0x40, 0xB7, 0x84, 0xD9, 0xCA, 0xF0,
-	0x17, 0x2C, 0x27, 0xC6, 0xF3, 0x69, 0x02, 0xF3, 0x9B, 0x08, 0xB9, 0x2E,
-	0x88, 0xF3, 0x96, 0xA7, 0xA6, 0xA3, 0x79, 0x0C, 0x54, 0x7B, 0x43, 0xDC,
-	0x34, 0xB4, 0xB5, 0xD0, 0x16, 0x82, 0xB9, 0x51, 0xE6, 0x1E, 0xAE, 0x83,
-	0x61, 0xB8, 0x06, 0x23, 0xC2, 0x73, 0xDE, 0xF0, 0x74, 0x70, 0xEC, 0x1C,
-	0x94, 0x89, 0x61, 0x14, 0x43, 0x21, 0x70, 0xD6, 0x0A, 0x33, 0xD7, 0xE7,
-	0xF6, 0x3A, 0x23, 0x04, 0xA7, 0x38, 0xD3, 0xEB, 0x60, 0xF2, 0xA9, 0x45,
-	0xC7, 0x86, 0x74, 0xDC, 0x91, 0x46, 0x01, 0x2F, 0x86, 0x2D, 0xBD, 0x67,
-	0xF0, 0x55, 0x15, 0x6D, 0x94, 0xC1, 0x01, 0xF2, 0x4E, 0x98, 0x14, 0x4A,
-	0x31, 0x10, 0xEC, 0xC0, 0x73, 0xCC, 0x84, 0xD2, 0x27, 0xE0, 0x5A, 0x46,
-	0x99, 0xE1, 0x76, 0x62, 0xFA, 0x00, 0xCB, 0xDC, 0xF2, 0x9C, 0x79, 0xB6,
-	0xD6, 0x53, 0xAF, 0x95, 0x69, 0xE9, 0x59, 0x38, 0x25, 0xE9, 0x84, 0xD3,
-	0x3A, 0xA3, 0xEC, 0x02, 0xCD, 0xCE, 0xF3, 0xF4, 0xE0, 0x39, 0xF9, 0xEA,
-	0x89, 0xCA, 0x12, 0xDA, 0xBA, 0x7F, 0x1A, 0xBC, 0xED, 0x84, 0xCE, 0x58,
-	0x54, 0x7D, 0xBF, 0x5B, 0xBF, 0x11, 0xCE, 0x7E, 0x50, 0xDE, 0xFF, 0x0D,
-	0xE6, 0x57, 0x1E, 0x13, 0x7B, 0xBA, 0xCE, 0x50, 0x04, 0x78, 0x97, 0xC1,
-	0x6A, 0xE6, 0xF8, 0x1A, 0xC1, 0xFA, 0x0D, 0x8A, 0x0D, 0x94, 0x77, 0x8E,
-	0xE1, 0x8B, 0x30, 0xF2, 0x86, 0x28, 0x03, 0x3B, 0x14, 0x56, 0x3E, 0xF0,
-	0x56, 0x2A, 0xB1, 0x73, 0x60, 0x21, 0xC9, 0x85, 0xD8, 0x28, 0xC3, 0x03,
-	0xD8, 0x9D, 0x63, 0xDC, 0x0A, 0xB3, 0x48, 0xF0, 0x89, 0xB2, 0x1C, 0xF5,
-	0x5F, 0x77, 0x18, 0x28, 0x7A, 0x06, 0x5B, 0x6F, 0xA9, 0x1F, 0x95, 0x93,
-	0x47, 0x65, 0xB1, 0x82, 0xF7, 0xFF, 0x80, 0x43, 0xA9, 0xBC, 0x0D, 0x60,
-	0x55, 0x41, 0xDD, 0x0A, 0xE6, 0x46, 0x48, 0x46, 0x7D, 0x1B, 0xB6, 0xFC,
-	0x0D, 0x9E, 0xBE, 0x34, 0x1C, 0xF6, 0x30, 0x19, 0x0A, 0xEF, 0xFE, 0xA2,
-	0xBC, 0xFF, 0xBF, 0x95, 0xB3, 0xBF, 0x09, 0x27, 0x73, 0x21, 0x6B, 0x7B,
-	0xEF, 0x81, 0xFF, 0x02, 0xCD, 0x83, 0xE7, 0xF0, 0x9B, 0xE0, 0x76, 0x4A,
-	0x7A, 0xA3, 0x4C, 0x2E, 0x3C, 0x93, 0xD3, 0x80, 0x4C, 0xE1, 0x65, 0xE6,
-	0xF9, 0x46, 0xC5, 0xE3, 0xBD, 0xB0, 0xF9, 0x5D, 0x48, 0x56, 0xCA, 0x48,
-	0x3C, 0xE3, 0x09, 0x14, 0x57, 0xCA, 0xE2, 0xA7, 0x88, 0x24, 0x12, 0x38,
-	0x7A, 0xE4, 0x77, 0x43, 0xFA, 0xE0, 0xC9, 0x1E, 0x6B, 0xCA, 0xA4, 0x57,
-	0xE1, 0x56, 0x2D, 0xD8, 0x24, 0x30, 0x3C, 0x37, 0x9C, 0x16, 0x81, 0x8B,
-	0xA1, 0x32, 0x1B, 0x79, 0xE2, 0x3C, 0x50, 0xC5, 0x3D, 0x02, 0xCE, 0x4B,
-	0xAF, 0xC0, 0xCB, 0xAC, 0x27, 0xCE, 0x94, 0x31, 0x86, 0xA4, 0x0A, 0xD8,
-	0xCE, 0xB0, 0xD9, 0xF6, 0x8E, 0xE4, 0xF5, 0x52, 0x48, 0xF6, 0x81, 0x13,
-	0x0F, 0xB3, 0x18, 0xAE, 0x0A, 0xC3, 0xC9, 0x40, 0x89, 0x72, 0xC3, 0xF7,
-	0x58, 0x79, 0x3B, 0x78, 0xAA, 0x1D, 0x04, 0x84, 0xAC, 0xEA, 0xB1, 0xF4,
-	0x5E, 0x94, 0xE5, 0x50, 0x79, 0x02, 0x36, 0x67, 0x06, 0x67, 0x7B, 0xFF,
-	0xB1, 0x58, 0x61, 0xF8, 0xEC, 0xC9, 0x9E, 0x3C, 0x7E, 0x1D, 0xA8, 0x36,
-	0xBD, 0x7B, 0x28, 0x92, 0x2B, 0xCB, 0x6B, 0x09, 0x0F, 0x75, 0xA0, 0xDD,
-	0x43, 0x1E, 0x19, 0xB2, 0x05, 0xE8, 0x07, 0x85, 0x8F, 0x81, 0x9B, 0xF7,
-	0xC2, 0xBB, 0xCB, 0x3E, 0x68, 0x60, 0x44, 0xA8, 0x24, 0x30, 0x0C, 0x86,
-	0x79, 0x22, 0xD8, 0xC6, 0xF3, 0x6D, 0x0F, 0x6F, 0x2B, 0x28, 0x57, 0xE0,
-	0x56, 0x30, 0x7A, 0x86, 0xCB, 0xA3, 0x72, 0xEE, 0x7B, 0x4A, 0xA8, 0xCC,
-	0x60, 0x70, 0x02, 0xF9, 0xDC, 0xD0, 0xA6, 0x86, 0xBD, 0x2A, 0xE5, 0xDA,
-	0xD3, 0xED, 0x60, 0x72, 0x08, 0x9C, 0x58, 0x28, 0x12, 0x61, 0xAF, 0x82,
-	0x31, 0x42, 0x32, 0x52, 0xCC, 0x85, 0x52, 0x5F, 0xC1, 0x2A, 0xB3, 0xFC,
-	0x7A, 0xAE, 0xD8, 0x3C, 0xF0, 0xEE, 0x01, 0x2E, 0x2A, 0x28, 0x3F, 0x3B,
-	0xB6, 0xD6, 0xE1, 0x13, 0xC1, 0x7E, 0x52, 0x8A, 0x1F, 0x84, 0x63, 0x1A,
-	0xD1, 0xFD, 0x2A, 0xBC, 0xBC, 0x34, 0xBC, 0x6D, 0x21, 0x2D, 0x84, 0x9F,
-	0xFE, 0x02, 0xFF, 0xF1, 0x1F, 0x86, 0x1F, 0x3F, 0x45, 0xE8, 0x08, 0x56,
-	0x5D, 0xC7, 0xFD, 0x57, 0xE1, 0xE9, 0x17, 0xCF, 0xEB, 0x7F, 0x39, 0xBE,
-	0x3D, 0x41, 0xF0, 0x70, 0xF9, 0x4E, 0x58, 0xFC, 0xCD, 0x10, 0x16, 0x96,
-	0x8E, 0x8E, 0xE4, 0xA8, 0x0C, 0xBE, 0x2B, 0xED, 0x4B, 0xC7, 0xBF, 0x9E,
-	0x0D, 0xD5, 0x5E, 0xF8, 0x29, 0x86, 0xF7, 0x73, 0x61, 0x7A, 0x2B, 0x8C,
-	0x6E, 0x2C, 0xF6, 0x44, 0x58, 0x56, 0x86, 0x55, 0xED, 0xA8, 0x22, 0x87,
-	0x0A, 0x3D, 0xE8, 0xB2, 0x15, 0x7C, 0xA1, 0x44, 0x31, 0x0C, 0x47, 0x86,
-	0xB3, 0x4B, 0xCB, 0xF4, 0x54, 0x19, 0xCC, 0x20, 0x1D, 0x41, 0x11, 0x5B,
-	0x06, 0x56, 0xF1, 0xC1, 0xD0, 0xB4, 0x9E, 0x7A, 0x0F, 0x87, 0x9D, 0xE2,
-	0x37, 0x9E, 0x85, 0x33, 0x58, 0x2C, 0x47, 0x07, 0x9F, 0x57, 0x81, 0xFB,
-	0x15, 0x44, 0x3B, 0xC3, 0xDC, 0x08, 0x71, 0xAE, 0x4C, 0x87, 0x81, 0xC5,
-	0xD4, 0x30, 0x9E, 0x18, 0x6C, 0x04, 0xF1, 0x21, 0x10, 0xF6, 0x9E, 0x26,
-	0xF4, 0x72, 0xCD, 0x7D, 0x03, 0x67, 0x9B, 0x9E, 0xB0, 0xB6, 0x48, 0x03,
-	0x97, 0x43, 0xD8, 0x0E, 0x95, 0xCD, 0x5C, 0x78, 0xAC, 0x2C, 0xFB, 0x15,
-	0x3C, 0x3D, 0x3A, 0xDC, 0x93, 0x92, 0x1F, 0x7B, 0xF1, 0xC5, 0xF9, 0x5C,
-	0x88, 0xFC, 0x49, 0xC2, 0xDB, 0x4B, 0xC7, 0x71, 0xA4, 0xBD, 0x2A, 0x76,
-	0xE8, 0x58, 0xFC, 0xC5, 0xD2, 0x7D, 0x12, 0xEA, 0x5B, 0x18, 0x8F, 0x03,
-	0x67, 0x0A, 0x8B, 0xDA, 0x72, 0xA8, 0x95, 0xEE, 0x20, 0x44, 0x3B, 0xC3,
-	0xB0, 0x35, 0x1C, 0x7C, 0xFF, 0x25, 0x8F, 0xF6, 0xCA, 0xA1, 0x53, 0x9E,
-	0xD4, 0xF2, 0x7C, 0x0A, 0x87, 0x61, 0x40, 0xF7, 0xCA, 0xB0, 0x56, 0x4E,
-	0x6A, 0xC8, 0x92, 0x18, 0x3D, 0xCB, 0x78, 0x0C, 0x1D, 0xDB, 0x87, 0x96,
-	0xB7, 0x95, 0x90, 0x54, 0x30, 0xC9, 0x0D, 0xF3, 0x81, 0x42, 0x1C, 0x28,
-	0xE9, 0x17, 0x2E, 0xF3, 0xB1, 0x21, 0xA4, 0x9E, 0xEF, 0x0A, 0x77, 0xA9,
-	0x63, 0x77, 0xD9, 0xD7, 0x9B, 0xC6, 0xB7, 0x16, 0x76, 0x4A, 0xBB, 0xF4,
-	0xB8, 0x4D, 0x7F, 0xE1, 0x99, 0x9E, 0xF7, 0x4C, 0xE0, 0xBB, 0x55, 0xA0,
-	0xBB, 0x0F, 0x7C, 0xDF, 0x0B, 0xDD, 0xD8, 0x32, 0xFA, 0xD9, 0xF1, 0xE1,
-	0x3F, 0x0C, 0xFF, 0xD7, 0x8F, 0xC2, 0x95, 0x7A, 0x9E, 0xFF, 0x48, 0xB9,
-	0x5F, 0x39, 0xFE, 0xF3, 0x1F, 0x81, 0xDD, 0x2F, 0x10, 0x9E, 0x2D, 0x2E,
-	0xF1, 0x5C, 0xFE, 0x0C, 0x1F, 0xFE, 0x1A, 0x53, 0x5C, 0x7A, 0x9E, 0x1A,
-	0xA5, 0xF9, 0x2A, 0x94, 0xDF, 0x95, 0xDD, 0xA3, 0xF0, 0xB6, 0x55, 0x42,
-	0x16, 0x18, 0x5C, 0xC3, 0xE9, 0x7B, 0xCB, 0xE5, 0x45, 0xCC, 0x65, 0xDA,
-	0x91, 0xAA, 0xE3, 0xF1, 0x31, 0xE2, 0xB7, 0x4D, 0xCB, 0xAF, 0xCF, 0x7D,
-	0x7E, 0xCF, 0xDC, 0x28, 0xCE, 0x18, 0x0E, 0xA5, 0x21, 0xB4, 0x8E, 0x51,
-	0x01, 0xE7, 0xE7, 0x81, 0xAB, 0x5B, 0x98, 0x5C, 0x40, 0x3C, 0x55, 0xDC,
-	0xD0, 0xE0, 0x4C, 0x44, 0xDC, 0x74, 0xB0, 0x55, 0xFC, 0x8B, 0x61, 0xB9,
-	0x15, 0x5E, 0x1F, 0x95, 0xC5, 0xCA, 0x33, 0xAA, 0x02, 0x88, 0xB2, 0x69,
-	0x2C, 0xEB, 0x9D, 0x45, 0x34, 0x30, 0x1F, 0x04, 0x66, 0x63, 0x58, 0x4C,
-	0x21, 0x3B, 0x87, 0x70, 0xA2, 0x94, 0x03, 0xA1, 0xDC, 0x78, 0x9A, 0x6F,
-	0x30, 0xAE, 0x04, 0x53, 0x28, 0x7E, 0xD4, 0xAB, 0xF7, 0x1E, 0x97, 0xCA,
-	0x64, 0x27, 0x9C, 0x1D, 0x03, 0x36, 0x83, 0xCF, 0x57, 0xCA, 0xA6, 0x80,
-	0x5F, 0xCA, 0x40, 0xF5, 0x1C, 0x58, 0xB5, 0x50, 0x8D, 0x61, 0x7E, 0x06,
-	0xE7, 0x63, 0xC3, 0x38, 0x53, 0xA2, 0xEF, 0xFB, 0x96, 0x65, 0xE3, 0x89,
-	0xC7, 0x3D, 0x6B, 0xFF, 0xAF, 0x37, 0x31, 0xE7, 0x3F, 0x39, 0xAA, 0x05,
-	0x3C, 0xE4, 0x09, 0x36, 0x6A, 0x48, 0x6A, 0xA1, 0x69, 0x13, 0xB6, 0x6B,
-	0xC7, 0xF6, 0xA1, 0x65, 0xF5, 0x35, 0x30, 0x7D, 0x81, 0xB6, 0x84, 0xB4,
-	0x86, 0xB3, 0x08, 0xD2, 0x33, 0x78, 0x3A, 0x0D, 0x2C, 0x3F, 0x1A, 0x0E,
-	0x63, 0x88, 0x5E, 0x0D, 0x1F, 0xFF, 0x25, 0xDC, 0xAC, 0x3D, 0xE3, 0x87,
-	0xC0, 0x8B, 0xB4, 0xEC, 0x1B, 0xC7, 0xF3, 0x3A, 0x50, 0x75, 0x70, 0x76,
-	0x12, 0x71, 0x3B, 0xEA, 0xF7, 0xDC, 0x2F, 0x8D, 0x10, 0xAC, 0xB2, 0x18,
-	0x2A, 0x17, 0x03, 0xCF, 0x3E, 0x24, 0xF8, 0x17, 0x47, 0xBD, 0x0F, 0xF8,
-	0x29, 0xEC, 0xCE, 0x0D, 0x9B, 0x1B, 0x61, 0x53, 0xC2, 0xEE, 0x39, 0xC2,
-	0xEF, 0x03, 0xE7, 0x99, 0x60, 0x8A, 0xC0, 0xE1, 0xC1, 0xF0, 0xFA, 0x4F,
-	0x87, 0xFD, 0xA6, 0x54, 0xB9, 0x30, 0x7C, 0xAF, 0x4C, 0xFE, 0x5D, 0x18,
-	0x9C, 0x1B, 0x6C, 0x1D, 0xD0, 0xBB, 0xC0, 0xDB, 0xBF, 0x5A, 0x7E, 0xFD,
-	0x06, 0xBF, 0xDC, 0x1B, 0xCA, 0x3A, 0x70, 0x3E, 0x17, 0x7E, 0xFA, 0x29,
-	0x65, 0xF4, 0x73, 0x20, 0xCA, 0x95, 0xAF, 0x0F, 0x82, 0x3C, 0x39, 0xEC,
-	0xB3, 0xA2, 0x6F, 0xC2, 0x7E, 0x27, 0x94, 0x5E, 0xB9, 0x4C, 0x85, 0xD1,
-	0x22, 0x26, 0xBA, 0x81, 0x65, 0xE6, 0x88, 0xD7, 0x81, 0xE2, 0x41, 0xF9,
-	0xF2, 0xDC, 0xF1, 0xAF, 0x06, 0x56, 0x05, 0x5C, 0x9D, 0x0B, 0xF6, 0xDC,
-	0x50, 0xA5, 0x4A, 0x55, 0x06, 0xE2, 0x1D, 0x9C, 0xC4, 0xC2, 0xC5, 0xA9,
-	0x70, 0x36, 0x0C, 0x8C, 0xE3, 0x18, 0x1D, 0x78, 0xEA, 0xA2, 0x9F, 0x79,
-	0xB4, 0x4B, 0xA1, 0xFC, 0xDD, 0x53, 0x7D, 0x13, 0x36, 0x3B, 0xE1, 0x70,
-	0x00, 0x8E, 0x50, 0x34, 0x90, 0xD7, 0x4A, 0x75, 0x74, 0x24, 0x56, 0x98,
-	0xCC, 0x61, 0x71, 0x6E, 0xC9, 0x4F, 0x03, 0x83, 0x91, 0x92, 0x9F, 0x08,
-	0x32, 0x35, 0xBC, 0x35, 0x9E, 0x6F, 0xCF, 0x06, 0xBF, 0x0C, 0x9C, 0x37,
-	0xCA, 0x7B, 0x8D, 0xD8, 0x8C, 0x2D, 0x77, 0x59, 0xC7, 0x36, 0x16, 0x2E,
-	0x57, 0xCA, 0xE9, 0x33, 0x98, 0xB8, 0xF7, 0x25, 0x77, 0x99, 0x12, 0x1C,
-	0x24, 0x2A, 0x4C, 0x6E, 0xC0, 0xFC, 0x64, 0xC8, 0x86, 0x16, 0xB7, 0x77,
-	0x3C, 0xAE, 0x95, 0xE8, 0xA9, 0x12, 0x38, 0x81, 0xCB, 0x73, 0xE1, 0xF2,
-	0xDA, 0x72, 0x3B, 0xEF, 0xB8, 0x46, 0x78, 0xA9, 0xE0, 0x71, 0xDB, 0xA2,
-	0x40, 0x59, 0x41, 0x55, 0x75, 0x7C, 0x7F, 0x0A, 0x7C, 0xFB, 0x06, 0xE1,
-	0x01, 0x4E, 0x1E, 0x0C, 0x67, 0xEB, 0xC0, 0x48, 0x85, 0x7C, 0x12, 0x71,
-	0x19, 0x39, 0xC2, 0x54, 0xA9, 0x32, 0x4F, 0x7D, 0x0B, 0x8F, 0x33, 0x25,
-	0xAB, 0x85, 0xD9, 0x01, 0x66, 0x0F, 0x1E, 0x73, 0xEF, 0xF1, 0x0A, 0x6E,
-	0x2E, 0xCC, 0x6E, 0x85, 0x8B, 0x1F, 0x02, 0xD3, 0x54, 0x89, 0x56, 0xE0,
-	0xB6, 0x0A, 0x49, 0x9F, 0xEB, 0x8B, 0x82, 0x50, 0xED, 0x94, 0xF5, 0xA1,
-	0x0F, 0x8F, 0x4E, 0x15, 0x52, 0x0D, 0xF8, 0x3C, 0xD0, 0x39, 0x58, 0x8F,
-	0x22, 0xA2, 0x99, 0x65, 0xA6, 0x10, 0xBD, 0xC1, 0xF6, 0x57, 0x47, 0xFD,
-	0x1D, 0x2E, 0x53, 0x38, 0xFD, 0xBB, 0x61, 0xF9, 0x93, 0x70, 0x9C, 0xC7,
-	0xAC, 0x1A, 0xCF, 0xFF, 0xFA, 0x6A, 0x99, 0xFF, 0xA6, 0x7C, 0xFE, 0xCD,
-	0xF3, 0x75, 0x63, 0x38, 0x6A, 0xE0, 0xF4, 0x06, 0xFE, 0xF6, 0x3F, 0x2C,
-	0xE7, 0x1F, 0x84, 0x63, 0x64, 0x78, 0x78, 0x68, 0xD9, 0xBC, 0x28, 0x8B,
-	0xBA, 0xBF, 0xD7, 0x98, 0x2B, 0xE5, 0x38, 0x54, 0xCC, 0x1E, 0x2E, 0x6C,
-	0x44, 0xB2, 0x35, 0x6C, 0x7E, 0x57, 0xBE, 0x58, 0xE5, 0xE4, 0x55, 0x59,
-	0x3C, 0x0B, 0x0F, 0xB5, 0x61, 0x99, 0x79, 0xDC, 0x5C, 0xB0, 0x67, 0x8A,
-	0x9E, 0x2A, 0x21, 0x51, 0x4C, 0x2B, 0x24, 0x73, 0x18, 0xAA, 0x30, 0x6E,
-	0x2D, 0xC3, 0x4D, 0x60, 0xDA, 0x3A, 0x22, 0x0F, 0xEB, 0x5C, 0xF8, 0xB6,
-	0xED, 0x78, 0xFD, 0xCD, 0xC0, 0x3F, 0x03, 0xF9, 0xA3, 0x72, 0x8A, 0xA1,
-	0x4D, 0x02, 0x65, 0x0E, 0x87, 0xC8, 0x60, 0x8D, 0x52, 0xC4, 0xCA, 0x79,
-	0xA1, 0x0C, 0x2F, 0x61, 0x78, 0x1A, 0x30, 0x33, 0x65, 0x30, 0x86, 0xF1,
-	0x5C, 0x11, 0xAB, 0xBC, 0xBC, 0x1A, 0xFE, 0xB5, 0x81, 0x64, 0x07, 0xEF,
-	0xB6, 0x70, 0x7B, 0xB0, 0x2C, 0x8F, 0xB0, 0x1D, 0x28, 0x77, 0xAD, 0xA2,
-	0x91, 0x62, 0x33, 0x70, 0x01, 0x9A, 0x4E, 0xE9, 0xE2, 0x5E, 0x3A, 0x79,
-	0x3D, 0xEA, 0x61, 0x4E, 0x77, 0x67, 0xCA, 0x2A, 0x08, 0xFF, 0xB9, 0x34,
-	0x8C, 0xB6, 0x81, 0xA8, 0xFD, 0xD9, 0x30, 0x7A, 0x17, 0x91, 0x5D, 0x3A,
-	0x64, 0xA4, 0x54, 0x35, 0x3C, 0x7F, 0x51, 0x96, 0xFF, 0x12, 0x76, 0xAF,
-	0x01, 0xE3, 0xFA, 0x60, 0x85, 0x75, 0x1D, 0xDB, 0x03, 0xBC, 0x75, 0x06,
-	0x57, 0xF4, 0xFC, 0xBC, 0x30, 0x82, 0x8B, 0x46, 0x99, 0xC5, 0x8E, 0xDA,
-	0x29, 0x8B, 0xAD, 0x10, 0x9E, 0x0D, 0xEB, 0x85, 0xA1, 0x36, 0xCA, 0x73,
-	0xE1, 0x98, 0xE7, 0x90, 0x6E, 0xFA, 0x85, 0x4E, 0x9E, 0xC0, 0xC7, 0x13,
-	0x25, 0xBE, 0x4C, 0x58, 0x5C, 0xB7, 0xB8, 0x56, 0x38, 0xEC, 0x23, 0x24,
-	0x69, 0xC9, 0x07, 0x02, 0x49, 0x9F, 0xD6, 0x79, 0xAC, 0x1D, 0xC7, 0xA0,
-	0xC4, 0x05, 0xCC, 0x0A, 0x21, 0xED, 0x40, 0x57, 0x4A, 0xBD, 0x13, 0x04,
-	0x47, 0x94, 0x09, 0x55, 0xB0, 0xAC, 0x1E, 0xFB, 0xFA, 0xF4, 0x75, 0x02,
-	0x7F, 0xFB, 0x29, 0x66, 0xFA, 0x37, 0xC3, 0x6F, 0x93, 0x96, 0xFF, 0xDC,
-	0x05, 0xEE, 0x3E, 0x2B, 0xC7, 0xDF, 0x02, 0xB3, 0x3B, 0xA5, 0xAD, 0x04,
-	0x3B, 0xF1, 0x8C, 0xDF, 0xC3, 0xC7, 0x4F, 0x86, 0x9B, 0xF3, 0x88, 0xD2,
-	0xB5, 0x7C, 0xFF, 0x1C, 0x58, 0xBE, 0x40, 0x56, 0x40, 0xFE, 0xB3, 0x61,
-	0x30, 0x55, 0x7C, 0x2D, 0xF8, 0x07, 0x85, 0xEF, 0x20, 0x2F, 0x4A, 0x78,
-	0xAE, 0xD9, 0x08, 0x7C, 0xCE, 0x0D, 0xC7, 0x04, 0x9A, 0x81, 0x72, 0x38,
-	0x0B, 0x14, 0x33, 0x21, 0xBD, 0x84, 0xC1, 0x5C, 0x88, 0xF3, 0x80, 0xC6,
-	0x82, 0x89, 0x52, 0xD2, 0xD4, 0xD3, 0xD4, 0x9E, 0xDD, 0x3A, 0x90, 0xEC,
-	0xA0, 0x10, 0x25, 0x7F, 0x34, 0x54, 0x91, 0x67, 0x59, 0x0A, 0xF7, 0x77,
-	0x90, 0x6D, 0x94, 0x1F, 0x5B, 0x38, 0xD7, 0x1E, 0xC0, 0x2D, 0x63, 0x90,
-	0x93, 0x08, 0xCD, 0x95, 0x59, 0xD3, 0xF5, 0xA1, 0xD5, 0x01, 0x30, 0x32,
-	0x44, 0x33, 0x58, 0x8C, 0x3D, 0x79, 0x9C, 0xB2, 0x7E, 0x86, 0xBB, 0xCF,
-	0x1D, 0x0F, 0xEB, 0xC0, 0xA4, 0x85, 0x55, 0x80, 0xD1, 0xAE, 0x21, 0xD9,
-	0xC1, 0xFB, 0x08, 0x74, 0x04, 0x4D, 0x0C, 0x87, 0x99, 0xD0, 0xA0, 0xD4,
-	0x43, 0x4B, 0x9C, 0x59, 0xAE, 0x12, 0xCF, 0x5F, 0x32, 0x25, 0xDD, 0x1A,
-	0xF4, 0xF7, 0xC0, 0x37, 0xDF, 0xD0, 0x1C, 0xFB, 0x28, 0x59, 0x54, 0x7C,
-	0x50, 0xDA, 0x49, 0xE0, 0xC5, 0x0A, 0x34, 0x9E, 0x6F, 0xFB, 0x98, 0xF8,
-	0x55, 0xA9, 0x1E, 0x3C, 0xD5, 0x5D, 0xDF, 0xBA, 0xE9, 0xA4, 0xF7, 0x0B,
-	0x0F, 0x62, 0xE1, 0xE2, 0x44, 0x59, 0x9D, 0x58, 0x8E, 0xD6, 0xF3, 0xEA,
-	0x0D, 0xE3, 0x0A, 0x16, 0x3B, 0xFA, 0x0A, 0xD8, 0xD1, 0x13, 0x7D, 0x86,
-	0xF1, 0x2E, 0x50, 0x0D, 0xA0, 0x54, 0xC3, 0xC3, 0x24, 0xF4, 0x00, 0xC8,
-	0x09, 0xCC, 0x10, 0xA6, 0x73, 0xA8, 0x13, 0x4F, 0x5D, 0xC3, 0xAE, 0x84,
-	0xA8, 0xF1, 0xC4, 0x31, 0xD8, 0x4C, 0xA9, 0x2B, 0x61, 0xFB, 0x24, 0xAC,
-	0x36, 0xCA, 0xA0, 0x80, 0xCB, 0x81, 0x70, 0xB6, 0x48, 0xD0, 0x52, 0x79,
-	0xFA, 0xDE, 0xF2, 0xFA, 0x45, 0xC9, 0xB7, 0xA0, 0xA2, 0xD4, 0xC6, 0xB1,
-	0x53, 0x28, 0x46, 0xF0, 0xC3, 0x95, 0xE5, 0xAF, 0x37, 0x11, 0x4D, 0xE8,
-	0x48, 0xEF, 0xA0, 0x7A, 0x0E, 0x6C, 0xFE, 0x00, 0xFF, 0xD8, 0x7B, 0x7A,
-	0x8B, 0x0B, 0xE5, 0xEC, 0xEF, 0x42, 0xF8, 0xBB, 0x52, 0x0C, 0x53, 0x36,
-	0x4F, 0x31, 0x6F, 0xFF, 0xA8, 0x39, 0x7E, 0x87, 0xC1, 0xD8, 0x72, 0xFB,
-	0x63, 0xE0, 0xEC, 0x27, 0xCB, 0x71, 0x12, 0x78, 0x5A, 0x0B, 0xDF, 0x6A,
-	0x4F, 0xF3, 0xAA, 0x64, 0x8D, 0x32, 0x7D, 0x88, 0x7B, 0x4D, 0xDC, 0x24,
-	0x10, 0xFD, 0x2C, 0xE8, 0x0F, 0x30, 0x3C, 0x53, 0xAE, 0xC6, 0xC0, 0x1C,
-	0x4E, 0xC7, 0x4A, 0xA2, 0xB0, 0xAB, 0x95, 0xBA, 0x76, 0x94, 0xA5, 0x70,
-	0xDC, 0x07, 0x8E, 0x9B, 0x1E, 0x7A, 0x6D, 0x2A, 0x43, 0x1E, 0x84, 0x7D,
-	0x03, 0x5D, 0x50, 0x3C, 0x1E, 0x23, 0xBD, 0xDE, 0xDD, 0x06, 0x65, 0x34,
-	0x54, 0x92, 0x33, 0x61, 0xFA, 0x93, 0x32, 0x3B, 0x15, 0xA2, 0x12, 0xB2,
-	0x0D, 0x84, 0x12, 0x82, 0x09, 0x0C, 0xD4, 0x32, 0x68, 0x2C, 0xFE, 0xC1,
-	0xF0, 0xF4, 0x4B, 0xC3, 0xD3, 0x7D, 0xE0, 0x18, 0x04, 0x37, 0x83, 0xFF,
-	0xBA, 0xE9, 0xBF, 0xE6, 0xAB, 0x9D, 0xC1, 0xB6, 0xCA, 0x39, 0xE0, 0x1B,
-	0x61, 0xAB, 0x81, 0xFA, 0xCF, 0x94, 0xF6, 0xB0, 0x53, 0xA6, 0x2E, 0xB0,
-	0x58, 0x81, 0xD6, 0xBD, 0xB1, 0x6C, 0x34, 0x86, 0xD9, 0x35, 0xDC, 0x9E,
-	0x47, 0x44, 0xD9, 0xB7, 0x8E, 0x6F, 0x2D, 0x3C, 0x58, 0xA1, 0x2E, 0xC0,
-	0xDA, 0x8E, 0xAC, 0x36, 0x74, 0x73, 0x25, 0xB7, 0x30, 0xF2, 0x42, 0x54,
-	0x47, 0xE4, 0x87, 0x0E, 0x67, 0x94, 0x79, 0x26, 0x48, 0xAC, 0xBC, 0x8E,
-	0x14, 0x97, 0x19, 0x9A, 0xA8, 0x60, 0xBB, 0x75, 0xBC, 0x2E, 0x3B, 0x56,
-	0xDF, 0xA0, 0x7C, 0xF2, 0xF8, 0xEF, 0x3D, 0x5A, 0x26, 0x39, 0x01, 0xAE,
-	0x85, 0xF2, 0x4C, 0x51, 0xDF, 0xAB, 0x51, 0xD3, 0xA4, 0x97, 0x41, 0x95,
-	0x2F, 0xBD, 0x11, 0x7C, 0x24, 0x30, 0x99, 0x0B, 0x49, 0x6E, 0x79, 0x7B,
-	0x09, 0xBC, 0x6C, 0x02, 0xF5, 0x06, 0xCE, 0x80, 0x0F, 0x0D, 0x0C, 0xBD,
-	0xF2, 0xE0, 0x85, 0x2F, 0x47, 0xA1, 0x5C, 0x2A, 0xC3, 0x35, 0xC4, 0xD2,
-	0x6F, 0xDB, 0xCC, 0x99, 0x70, 0x7E, 0x69, 0x99, 0x9E, 0x7A, 0xCA, 0xBA,
-	0xE1, 0xF8, 0x94, 0x70, 0x7C, 0x85, 0x2E, 0x38, 0xDA, 0x02, 0xDC, 0x95,
-	0x30, 0xF4, 0xC2, 0xC9, 0x4D, 0xA0, 0xFD, 0xD1, 0xF0, 0x3A, 0xB1, 0x7C,
-	0x3E, 0x38, 0xC2, 0xD7, 0x16, 0x7D, 0x80, 0xDB, 0xD6, 0xF0, 0x73, 0x14,
-	0xB3, 0x30, 0x9E, 0xFD, 0x41, 0xF9, 0x87, 0x0B, 0xFC, 0x3F, 0x41, 0x59,
-	0x8D, 0x85, 0xF1, 0x85, 0x61, 0xE4, 0x14, 0x2B, 0x9E, 0xF9, 0x1A, 0x16,
-	0x33, 0x08, 0x17, 0x96, 0xF1, 0xBB, 0x04, 0x7B, 0xD1, 0x52, 0x0D, 0x1C,
-	0x69, 0x6E, 0x18, 0xC4, 0x96, 0x72, 0xAF, 0xAC, 0x5F, 0x1C, 0xEB, 0x47,
-	0xD7, 0xDF, 0x8B, 0x1C, 0x54, 0x01, 0x96, 0x80, 0x93, 0xC0, 0xA4, 0x31,
-	0x84, 0x83, 0x90, 0x48, 0xBF, 0xC3, 0x8F, 0x0B, 0x43, 0xB5, 0x10, 0x50,
-	0x25, 0x4D, 0x61, 0x90, 0x2B, 0x97, 0x38, 0x26, 0xAA, 0x54, 0x11, 0x74,
-	0x1A, 0xD1, 0x1D, 0x0C, 0x71, 0xD9, 0x92, 0xC6, 0x8E, 0x0A, 0xC3, 0xF2,
-	0x4B, 0xC3, 0x1F, 0xBF, 0x07, 0x76, 0x1D, 0x84, 0x1B, 0x45, 0xFE, 0x22,
-	0x94, 0x1F, 0x62, 0xBE, 0x24, 0x86, 0x97, 0x43, 0xC7, 0xE9, 0xAB, 0x32,
-	0xBB, 0xB3, 0xA4, 0x5F, 0x03, 0x7E, 0xA3, 0x1C, 0x9D, 0xA0, 0x8D, 0x63,
-	0x38, 0xEE, 0x95, 0x3C, 0xF9, 0x1A, 0xEA, 0xAD, 0x47, 0x2C, 0x5C, 0xBC,
-	0x13, 0x72, 0x8D, 0xB8, 0xE8, 0x84, 0xA8, 0xFD, 0x2F, 0xCB, 0x6E, 0xE5,
-	0x69, 0x6A, 0x25, 0x8C, 0x2D, 0x72, 0x15, 0xA8, 0xCE, 0x02, 0xD9, 0xA9,
-	0xB0, 0xF8, 0x11, 0xD2, 0xA1, 0x10, 0x0E, 0x86, 0xC3, 0x97, 0x84, 0xF0,
-	0xD4, 0x91, 0xD7, 0x4A, 0xF7, 0xEA, 0x69, 0x4A, 0x30, 0x83, 0x40, 0x39,
-	0xAF, 0xF9, 0x56, 0xC0, 0x76, 0xE8, 0xD9, 0x16, 0xB0, 0xDD, 0xF6, 0x5A,
-	0xD4, 0xDC, 0xC1, 0xF9, 0x00, 0x6E, 0x34, 0xA1, 0x88, 0x03, 0xFB, 0x81,
-	0xE7, 0x60, 0x2D, 0x95, 0x7A, 0xF6, 0x28, 0x4D, 0xD9, 0x8B, 0x1F, 0xBB,
-	0x09, 0xE8, 0xDC, 0x10, 0x8C, 0xA5, 0x4D, 0x3D, 0x5D, 0xDA, 0xFF, 0x24,
-	0x5F, 0xA5, 0x86, 0x0B, 0x67, 0xA9, 0x1F, 0x84, 0xD5, 0x73, 0xC7, 0xD3,
-	0x9D, 0x22, 0xC7, 0x3F, 0x33, 0x7E, 0xE3, 0x88, 0x74, 0xE1, 0xB9, 0x9C,
-	0xF7, 0x5F, 0x50, 0x59, 0x0A, 0xDF, 0xD7, 0x81, 0x6A, 0xD9, 0x52, 0xFA,
-	0x40, 0x72, 0x09, 0xFE, 0x12, 0xEA, 0xC4, 0x62, 0x82, 0x30, 0x97, 0xC0,
-	0x7E, 0xA7, 0xFC, 0xEB, 0x59, 0xF8, 0xEF, 0x6D, 0xCB, 0x7E, 0x0B, 0x3F,
-	0x9F, 0x59, 0x16, 0x53, 0xCF, 0x4D, 0x5C, 0xB3, 0x78, 0xB1, 0xFC, 0xEB,
-	0x49, 0x79, 0x1A, 0x29, 0xAB, 0x11, 0xBC, 0x8E, 0x2D, 0xBB, 0x9F, 0x02,
-	0xF1, 0x2D, 0xE8, 0xBB, 0xC0, 0xBB, 0x2F, 0xF0, 0x5E, 0x0C, 0xA3, 0x11,
-	0x48, 0xD4, 0x50, 0x6A, 0xA0, 0xAC, 0x41, 0x1A, 0xE8, 0xF6, 0x11, 0x4F,
-	0xDF, 0x3D, 0x77, 0x5F, 0x60, 0xB3, 0xED, 0xDF, 0xE2, 0xA7, 0xA3, 0x98,
-	0x66, 0x14, 0xD8, 0x8D, 0x3C, 0x8F, 0x79, 0x5F, 0x51, 0xB3, 0x53, 0x18,
-	0x06, 0xB8, 0xCC, 0x2D, 0xD9, 0x24, 0x61, 0x97, 0x78, 0xF6, 0xCE, 0xD1,
-	0xD6, 0xC2, 0xE2, 0xA8, 0x0C, 0xEF, 0x7A, 0x44, 0xAD, 0x6D, 0xE0, 0x69,
-	0x1F, 0x38, 0xAE, 0xE9, 0xCD, 0xE4, 0xDE, 0x50, 0xB7, 0xCA, 0xD7, 0x95,
-	0xB0, 0x7C, 0x11, 0xD2, 0x44, 0xB9, 0x2D, 0x60, 0x7A, 0x61, 0xE0, 0x56,
-	0x78, 0x4B, 0x1D, 0x9F, 0xDB, 0xC0, 0xCB, 0x00, 0x4E, 0x5C, 0x60, 0xFC,
-	0x1A, 0x08, 0x2B, 0xF0, 0xF4, 0xE8, 0x9D, 0xB3, 0x33, 0x38, 0x55, 0x30,
-	0x08, 0xA5, 0x0A, 0x65, 0x08, 0x0C, 0x02, 0x9C, 0xEE, 0x84, 0x51, 0x70,
-	0x44, 0x75, 0x30, 0xB8, 0x8D, 0x67, 0xB8, 0x86, 0xE1, 0x26, 0x30, 0xE8,
-	0x94, 0xCE, 0xC1, 0xEC, 0xBD, 0x72, 0x73, 0x11, 0x33, 0x9C, 0xC2, 0x26,
-	0xEF, 0x78, 0x6E, 0x33, 0xF2, 0xD6, 0x33, 0xD9, 0x78, 0xA2, 0x0A, 0x26,
-	0x4F, 0x86, 0x56, 0x14, 0x79, 0xE8, 0x90, 0x1C, 0x5C, 0x62, 0xF0, 0xA9,
-	0xA1, 0x1D, 0x7A, 0x9C, 0xC0, 0x38, 0x85, 0xCB, 0xB9, 0xE1, 0x9D, 0xF6,
-	0xF3, 0x85, 0x7D, 0x01, 0xCB, 0xDC, 0xA3, 0xBE, 0xA7, 0x53, 0xE0, 0x0D,
-	0x69, 0xD6, 0xDB, 0xC0, 0x53, 0x0D, 0x74, 0x6D, 0x43, 0x15, 0x83, 0x39,
-	0x15, 0x66, 0x23, 0x61, 0x16, 0x47, 0x68, 0x17, 0xF3, 0xF0, 0xEC, 0x78,
-	0xBE, 0xEB, 0x43, 0xA5, 0xB3, 0x08, 0x26, 0x67, 0x06, 0xBD, 0x50, 0xA2,
-	0x69, 0x9F, 0x5E, 0x72, 0xEA, 0x79, 0x0A, 0x7D, 0x3A, 0x36, 0xFE, 0x53,
-	0x57, 0x3F, 0x51, 0x61, 0x97, 0x82, 0xBF, 0x54, 0x36, 0x6A, 0x68, 0xEE,
-	0x0C, 0xFE, 0x73, 0xE0, 0xB0, 0x6C, 0x28, 0x9D, 0x50, 0x7F, 0x84, 0xE6,
-	0xDF, 0x94, 0xF2, 0xC2, 0xB2, 0x6E, 0x03, 0xF9, 0xFF, 0x0A, 0xC8, 0xBD,
-	0x52, 0x94, 0x90, 0x06, 0x30, 0xB1, 0xC7, 0x16, 0x86, 0xED, 0x49, 0x44,
-	0x2E, 0x8E, 0x49, 0xE7, 0xB1, 0x2F, 0xC2, 0x79, 0xE9, 0xE9, 0x1E, 0x95,
-	0xE5, 0xB6, 0x4F, 0x4C, 0xB5, 0xBB, 0xC0, 0xDB, 0xA6, 0xE2, 0xF1, 0x0D,
-	0x36, 0x75, 0xFF, 0xAB, 0x34, 0x18, 0x0B, 0xD3, 0xB1, 0x52, 0x0E, 0x12,
-	0x8E, 0xC6, 0xB1, 0xF3, 0x1D, 0x21, 0x87, 0x71, 0x22, 0x98, 0x58, 0x49,
-	0x8D, 0x32, 0x12, 0x87, 0xC7, 0xB3, 0x14, 0xA5, 0x0C, 0x4A, 0x76, 0x80,
-	0xDD, 0xF1, 0x4F, 0x84, 0xBC, 0x83, 0x75, 0x1B, 0xA8, 0xCB, 0x80, 0x2D,
-	0x4D, 0x9F, 0xC4, 0x6E, 0x3D, 0xBB, 0x3A, 0xA0, 0xA6, 0xEF, 0xF7, 0x7D,
-	0x6C, 0xE1, 0xDD, 0x52, 0xA8, 0x6C, 0xC7, 0x3F, 0x72, 0xE5, 0x4E, 0x60,
-	0xD5, 0x40, 0xD5, 0x05, 0xE6, 0x2A, 0x8C, 0x07, 0xCA, 0xE9, 0xD8, 0x70,
-	0xFD, 0x09, 0x4E, 0x6E, 0x84, 0xDC, 0x2B, 0xF7, 0x93, 0x98, 0xBB, 0x54,
-	0x29, 0xB7, 0xAE, 0x1F, 0x52, 0xC5, 0x81, 0xC4, 0xC7, 0x44, 0xC7, 0x4B,
-	0xA1, 0xAD, 0x60, 0xAC, 0xF0, 0x5E, 0x94, 0xF1, 0xB1, 0xAF, 0x75, 0x9D,
-	0x78, 0xB8, 0x3A, 0x78, 0xBA, 0x91, 0xE1, 0x21, 0x0E, 0x2C, 0xA9, 0xB1,
-	0xE7, 0x01, 0x37, 0xEB, 0xCF, 0x28, 0xF7, 0x1D, 0x92, 0x47, 0x18, 0xED,
-	0x21, 0xB6, 0x42, 0x37, 0x0E, 0xEC, 0x0B, 0x4B, 0x92, 0x41, 0x3E, 0xEA,
-	0x87, 0x0C, 0x67, 0x53, 0x43, 0xAE, 0x8E, 0x56, 0x15, 0x6D, 0x7A, 0x91,
-	0xD2, 0x01, 0xB0, 0x0E, 0x46, 0x0A, 0x83, 0x60, 0x98, 0xAD, 0x2D, 0xD9,
-	0xC1, 0xB1, 0x32, 0x42, 0x68, 0x84, 0x42, 0x61, 0x16, 0xF5, 0x44, 0x8C,
-	0x97, 0x50, 0xF1, 0x25, 0x04, 0x56, 0x31, 0xE4, 0x33, 0xB8, 0xCE, 0x2D,
-	0xD3, 0x59, 0xC4, 0x7E, 0xD8, 0xF5, 0x0B, 0x10, 0x94, 0x26, 0xED, 0x05,
-	0x15, 0x3B, 0x7A, 0x56, 0xFE, 0x64, 0x29, 0x4C, 0xEE, 0x84, 0xCE, 0x1B,
-	0xA4, 0x0E, 0xE4, 0xA9, 0xB2, 0x79, 0x03, 0xFF, 0x2C, 0xD8, 0xAD, 0x32,
-	0x58, 0x28, 0xC3, 0x2B, 0x88, 0x3E, 0xC1, 0x97, 0xF3, 0x3E, 0xB0, 0xA9,
-	0x9D, 0x50, 0x16, 0xBD, 0x1B, 0x78, 0xEE, 0xE1, 0xB0, 0x57, 0x46, 0xA5,
-	0x12, 0x45, 0x50, 0xD5, 0xB0, 0xDF, 0x43, 0xB9, 0x09, 0xB0, 0x54, 0xDC,
-	0x77, 0xCB, 0x4A, 0xE1, 0x8F, 0x10, 0x70, 0xB5, 0xE0, 0xAC, 0x85, 0x89,
-	0xE7, 0xE4, 0x52, 0x61, 0x1E, 0x61, 0x47, 0x81, 0x4A, 0x1C, 0x49, 0x65,
-	0x49, 0x3B, 0xC5, 0x44, 0x10, 0xA7, 0x86, 0x28, 0xB3, 0x78, 0xE3, 0xE9,
-	0x3A, 0xA5, 0x69, 0x1D, 0x51, 0xA7, 0xE4, 0x40, 0x50, 0x38, 0x26, 0xC2,
-	0xB7, 0x60, 0x18, 0x38, 0xA1, 0x8D, 0x02, 0x2F, 0x4E, 0xE9, 0x62, 0x45,
-	0xB3, 0x5E, 0xBB, 0xE3, 0xAC, 0xD2, 0xA9, 0xE2, 0xC4, 0x32, 0x88, 0x94,
-	0xAB, 0x6D, 0xE0, 0xE7, 0x5F, 0x2C, 0xDD, 0x7D, 0xA0, 0xCA, 0x95, 0xC7,
-	0x42, 0x70, 0x56, 0x69, 0x0E, 0x82, 0xCD, 0x95, 0x93, 0x1B, 0xE1, 0xE7,
-	0x77, 0x86, 0xDB, 0x0F, 0x81, 0x30, 0x56, 0x1E, 0x8E, 0xFD, 0xAC, 0xE4,
-	0x29, 0xF2, 0x04, 0x2B, 0xDC, 0x8A, 0xB0, 0xC8, 0x94, 0xCD, 0xD8, 0x13,
-	0x05, 0x51, 0xA2, 0x39, 0x0C, 0xC6, 0x86, 0x13, 0x85, 0x51, 0xD9, 0x8B,
-	0x98, 0x8A, 0x57, 0x88, 0x1F, 0x85, 0x4A, 0x3D, 0xED, 0x10, 0xE2, 0xEB,
-	0x40, 0xFD, 0x0E, 0xEE, 0xC7, 0x42, 0xEA, 0x95, 0xA8, 0x08, 0x4C, 0x72,
-	0xCB, 0xB8, 0x0C, 0xE4, 0x47, 0x43, 0xEE, 0x02, 0xA9, 0xF7, 0x2C, 0xE6,
-	0x50, 0x5C, 0x0B, 0x17, 0xE7, 0x42, 0x54, 0x78, 0xB6, 0x62, 0x28, 0x6B,
-	0x8F, 0x76, 0x90, 0x60, 0xB0, 0x22, 0xA8, 0x2A, 0xA8, 0x92, 0x38, 0x60,
-	0xEB, 0xD1, 0x56, 0xB0, 0x9D, 0x62, 0x5B, 0x05, 0x0C, 0x6A, 0x1D, 0x75,
-	0x10, 0x8E, 0x0E, 0x36, 0x29, 0xEC, 0xAE, 0xE0, 0x26, 0x8A, 0x39, 0x8F,
-	0xA0, 0x90, 0x96, 0xC6, 0x0B, 0x75, 0xA3, 0x18, 0x1B, 0x31, 0x30, 0x3D,
-	0x55, 0xE3, 0xAD, 0xEE, 0xAB, 0xD0, 0x67, 0x95, 0xF2, 0xB3, 0x2A, 0xB7,
-	0x56, 0xA8, 0xBB, 0x40, 0x57, 0xF4, 0x9E, 0xC3, 0xBD, 0x13, 0x26, 0x56,
-	0xF9, 0xF7, 0x85, 0xC5, 0xDF, 0x08, 0xC7, 0x73, 0xC7, 0x3A, 0x57, 0xD6,
-	0x6D, 0xC2, 0xF0, 0x52, 0x09, 0xA9, 0xA3, 0xFB, 0x12, 0x93, 0x7E, 0x0B,
-	0x5C, 0xBE, 0x38, 0x62, 0x0D, 0x44, 0xB6, 0x25, 0xC4, 0xD0, 0x3A, 0x61,
-	0x17, 0x29, 0xDB, 0x35, 0x1C, 0xB6, 0xB0, 0x6B, 0x03, 0xAB, 0x58, 0x19,
-	0x4E, 0xE1, 0xFC, 0x3A, 0x22, 0xFD, 0x00, 0x6E, 0xEC, 0x38, 0x34, 0xD0,
-	0x74, 0x70, 0xDC, 0x41, 0xBA, 0x6B, 0x50, 0x03, 0x49, 0xD1, 0x83, 0x2F,
-	0xAC, 0x38, 0x3A, 0x0F, 0x75, 0x2D, 0x04, 0x85, 0x18, 0x65, 0x16, 0x43,
-	0x44, 0xEF, 0x25, 0xDA, 0x58, 0x4B, 0x19, 0x0B, 0x82, 0xE7, 0x80, 0x52,
-	0x05, 0x88, 0x15, 0x26, 0x3E, 0xE0, 0x11, 0x8E, 0x99, 0xE0, 0x13, 0x4F,
-	0x92, 0x42, 0x54, 0x40, 0x51, 0x77, 0x48, 0x15, 0xB8, 0x4A, 0x85, 0xDB,
-	0x61, 0x4A, 0x9B, 0x3B, 0x24, 0x76, 0xCC, 0xAF, 0xFA, 0x94, 0xD6, 0x8F,
-	0xB7, 0x4A, 0x32, 0x13, 0xBE, 0xEC, 0x03, 0xBF, 0xDF, 0xC3, 0xFA, 0x5B,
-	0x47, 0xF1, 0xD8, 0xEF, 0x14, 0xC6, 0x4E, 0xC9, 0x5F, 0x0D, 0x07, 0x1C,
-	0x51, 0x52, 0x77, 0xA4, 0x73, 0xA1, 0x88, 0x22, 0xE2, 0x26, 0xE0, 0x8E,
-	0xFD, 0xF9, 0x9E, 0x6F, 0x0C, 0x87, 0x0D, 0x54, 0x9B, 0x1E, 0x1C, 0x9D,
-	0x6D, 0x0C, 0xAB, 0x6D, 0xE0, 0x61, 0xA6, 0x3C, 0x67, 0xC2, 0xF8, 0x4C,
-	0x18, 0x4C, 0x03, 0x6D, 0xA9, 0x6C, 0x9F, 0x3D, 0x7E, 0x09, 0x13, 0xED,
-	0x97, 0x44, 0xE3, 0xA1, 0x32, 0x1C, 0x29, 0xCD, 0x1C, 0x0E, 0xB1, 0x47,
-	0x42, 0x7F, 0xB6, 0x45, 0xA5, 0x92, 0x75, 0x01, 0x10, 0xA2, 0xCE, 0xD0,
-	0xBC, 0x05, 0x36, 0x5B, 0xC8, 0xD6, 0x4A, 0xB2, 0x83, 0x91, 0x44, 0x6C,
-	0xF2, 0xFE, 0xED, 0x1A, 0x00, 0x75, 0x4A, 0x9A, 0xC1, 0xE4, 0x54, 0xC8,
-	0x26, 0x81, 0x34, 0x09, 0x60, 0x15, 0x57, 0x2A, 0xB2, 0x05, 0xDD, 0x05,
-	0xE4, 0x35, 0xA2, 0x6B, 0x85, 0xCD, 0x41, 0xD9, 0x97, 0x86, 0x77, 0x63,
-	0xE1, 0xFD, 0xA9, 0x61, 0x3E, 0x80, 0xBB, 0x12, 0x9E, 0x97, 0x1E, 0x77,
-	0x50, 0xEA, 0xA0, 0x8C, 0x72, 0xCB, 0xDF, 0x07, 0x31, 0x7E, 0xE0, 0xF8,
-	0xCD, 0xC0, 0x6B, 0x03, 0xAE, 0xF1, 0x94, 0x8D, 0xE2, 0x57, 0xB0, 0x7A,
-	0x06, 0xF7, 0x20, 0xDC, 0xAC, 0x61, 0x64, 0x21, 0x9E, 0xC2, 0xFA, 0x9D,
-	0xD2, 0x2C, 0x60, 0x5D, 0x18, 0xEE, 0x1D, 0x6C, 0xC4, 0xF3, 0xD4, 0x42,
-	0x3C, 0x84, 0xEB, 0xF7, 0x19, 0x3F, 0xFC, 0x18, 0x68, 0x67, 0x9E, 0xC7,
-	0x12, 0xDC, 0x8B, 0xC7, 0xBD, 0x09, 0x71, 0xD9, 0x9B, 0x39, 0xF2, 0xB8,
-	0x3F, 0x8B, 0x35, 0x0A, 0xE4, 0x5D, 0xAF, 0xB1, 0x6B, 0x45, 0x69, 0x4D,
-	0x0F, 0xBE, 0x28, 0x5A, 0x70, 0x1D, 0xAC, 0x4B, 0x4F, 0x2D, 0x1E, 0x53,
-	0x18, 0x8A, 0xCC, 0x90, 0x66, 0x42, 0x69, 0x3C, 0xF5, 0x41, 0xA9, 0x2A,
-	0xE8, 0x50, 0xDA, 0xA2, 0x5F, 0x7C, 0xC5, 0x03, 0xE8, 0x0C, 0xF8, 0xAD,
-	0x60, 0x6A, 0x8B, 0xA9, 0x3C, 0xA9, 0x76, 0xE4, 0x5E, 0x19, 0x2C, 0x84,
-	0x9B, 0x77, 0xCA, 0xCD, 0x6D, 0x20, 0x9E, 0x18, 0x5E, 0x5C, 0xCA, 0x6F,
-	0x4F, 0x0D, 0xDF, 0x57, 0x01, 0xBB, 0x87, 0x85, 0x37, 0xCC, 0x3B, 0x21,
-	0x79, 0xF3, 0x84, 0x4A, 0x19, 0x94, 0x86, 0x68, 0xB1, 0xB0, 0xBC, 0x14,
-	0x9E, 0xEA, 0xE0, 0xD8, 0xBD, 0xFE, 0x09, 0x64, 0x70, 0xE0, 0x82, 0xE2,
-	0x7C, 0x42, 0x57, 0x19, 0x66, 0xFB, 0x8E, 0xBC, 0x54, 0xF6, 0x1B, 0xC8,
-	0xCF, 0xC1, 0x7F, 0x52, 0x8A, 0x4F, 0x42, 0x31, 0x55, 0xEA, 0x4E, 0xD8,
-	0x7D, 0x01, 0xF9, 0x43, 0xB9, 0xA8, 0xE1, 0x6C, 0xD6, 0x9B, 0xBA, 0x7C,
-	0x21, 0x1C, 0x62, 0x4B, 0x97, 0x07, 0x8E, 0x26, 0xD0, 0x8A, 0xC1, 0xEF,
-	0x84, 0xB8, 0xF3, 0x24, 0x4E, 0x09, 0x55, 0xE0, 0xF5, 0x60, 0x18, 0xEC,
-	0x03, 0x27, 0x6B, 0xB0, 0xAD, 0x60, 0xF3, 0x08, 0x6C, 0x47, 0x65, 0x84,
-	0x55, 0x03, 0x6D, 0x05, 0x93, 0x16, 0x4C, 0xA2, 0x4C, 0xCE, 0x94, 0xEC,
-	0x4A, 0xF1, 0x03, 0x4B, 0xF3, 0x62, 0xA8, 0xDE, 0x3A, 0x76, 0x4F, 0x01,
-	0xB7, 0x6E, 0x69, 0x3A, 0xB0, 0x69, 0x2F, 0x8F, 0xFA, 0xF4, 0x83, 0x61,
-	0x76, 0xA5, 0x94, 0x2D, 0xEC, 0xBF, 0x41, 0xB9, 0x86, 0x2C, 0x28, 0xE3,
-	0x01, 0x0C, 0x27, 0x9E, 0xF3, 0x81, 0x61, 0xBC, 0x87, 0xF6, 0x5E, 0x70,
-	0x89, 0xF6, 0x56, 0xD1, 0xEF, 0x42, 0xFB, 0x2B, 0xAC, 0x1F, 0x5B, 0x4E,
-	0x76, 0xF0, 0x97, 0x12, 0xA6, 0x59, 0xBF, 0xA0, 0x1A, 0x64, 0xC2, 0x43,
-	0x01, 0x3B, 0x2B, 0x3C, 0xA2, 0x34, 0x33, 0xB0, 0x31, 0x5C, 0x2C, 0x0C,
-	0xB7, 0x0B, 0xC7, 0x60, 0xE0, 0x38, 0x1E, 0xA1, 0x7A, 0x31, 0xF8, 0x5D,
-	0xC0, 0xA0, 0x84, 0x81, 0xD0, 0x79, 0xC5, 0x00, 0x69, 0xDC, 0x77, 0x41,
-	0x0A, 0x85, 0xC6, 0x42, 0x6D, 0xC0, 0x75, 0x02, 0xA5, 0x90, 0xEE, 0xFB,
-	0x67, 0xAA, 0x44, 0x8A, 0x1D, 0x40, 0x9E, 0x06, 0xC6, 0x45, 0xF4, 0xFF,
-	0x9B, 0xD6, 0x7D, 0x24, 0xEC, 0x2A, 0xC3, 0xB0, 0xF5, 0x5C, 0xE6, 0x50,
-	0x2F, 0x62, 0x72, 0x14, 0xDD, 0x6A, 0x0F, 0xDE, 0xA8, 0x94, 0x17, 0x07,
-	0xA5, 0x7A, 0xEC, 0x00, 0x06, 0xB3, 0x88, 0xF1, 0x4C, 0x28, 0x72, 0x47,
-	0xD7, 0x04, 0xBE, 0x6C, 0x1A, 0xBE, 0xBE, 0xC1, 0x3E, 0x86, 0xF3, 0x6B,
-	0x43, 0x3E, 0x32, 0xB0, 0x0A, 0xE8, 0x06, 0xEA, 0xC2, 0x11, 0x4F, 0x21,
-	0x9A, 0xFE, 0x64, 0xF0, 0x3B, 0xCF, 0xF7, 0xA7, 0x80, 0x79, 0x56, 0xFE,
-	0xF6, 0x22, 0x4C, 0x82, 0xA2, 0xA9, 0xB2, 0x53, 0x47, 0x1C, 0x84, 0xB1,
-	0x87, 0xC9, 0x56, 0xA9, 0x6C, 0x9F, 0x7E, 0x31, 0x2E, 0xE6, 0x24, 0x57,
-	0xFC, 0x44, 0xF9, 0x56, 0x0B, 0x87, 0xB9, 0x70, 0x86, 0xE7, 0xDA, 0xA5,
-	0x5C, 0x8C, 0xA1, 0x9E, 0xB5, 0x34, 0x1E, 0xD8, 0x0B, 0xBB, 0x56, 0x78,
-	0x6B, 0x85, 0xC3, 0x5A, 0x31, 0x4B, 0x98, 0x54, 0xC2, 0x30, 0x28, 0xFB,
-	0x16, 0x9A, 0xB2, 0xBF, 0xF8, 0x4C, 0x26, 0x42, 0x6A, 0x94, 0x2E, 0x6A,
-	0x68, 0x0D, 0xAC, 0xBD, 0xA2, 0xCE, 0x30, 0xA9, 0x20, 0x8B, 0x95, 0xB1,
-	0xC2, 0x6D, 0x26, 0x4C, 0xCE, 0xE1, 0x71, 0x1C, 0xB1, 0x39, 0xC2, 0x4B,
-	0x03, 0xCD, 0xCE, 0x70, 0x5E, 0x06, 0xB2, 0x81, 0xE1, 0xC7, 0x8F, 0xCA,
-	0xEC, 0xAF, 0xF0, 0xE1, 0x93, 0xA3, 0xCA, 0xE1, 0xF3, 0x57, 0xE5, 0x3E,
-	0xE9, 0x6D, 0xE5, 0xD3, 0x33, 0x18, 0x0D, 0x2C, 0x83, 0x71, 0x20, 0x4D,
-	0x1C, 0xC9, 0xBF, 0x0C, 0x93, 0x7F, 0x5A, 0xA2, 0xDC, 0xF3, 0xDA, 0xC1,
-	0xD3, 0xEF, 0xF0, 0xB6, 0x16, 0x4C, 0xAA, 0xDC, 0x4C, 0x60, 0x96, 0xC2,
-	0x4D, 0x0C, 0x75, 0x01, 0x95, 0x17, 0xF6, 0xB5, 0xD0, 0x18, 0xCF, 0x7E,
-	0x0A, 0xC9, 0x54, 0x98, 0x0D, 0x2C, 0x8B, 0x21, 0x14, 0xD6, 0xF1, 0x7A,
-	0x80, 0xAF, 0xAF, 0xC2, 0x5B, 0xD5, 0x6F, 0x25, 0xB3, 0xAC, 0x37, 0x9A,
-	0xEE, 0x6B, 0xC1, 0x05, 0x25, 0x4F, 0x03, 0x53, 0x03, 0xB1, 0x8D, 0x29,
-	0xD5, 0xB1, 0x6D, 0x94, 0xEA, 0xA0, 0x4C, 0xB6, 0x4A, 0x5E, 0xC2, 0x20,
-	0x86, 0xCB, 0x05, 0xD4, 0xE7, 0x09, 0x79, 0xEE, 0xC9, 0x9D, 0xC7, 0x06,
-	0xA5, 0xC4, 0xF0, 0x3A, 0x34, 0x74, 0x23, 0xCF, 0xA9, 0x83, 0x81, 0x35,
-	0x3C, 0x75, 0x81, 0xAA, 0x53, 0x9A, 0x83, 0xF2, 0xD2, 0xF4, 0x97, 0xF5,
-	0x7D, 0x2A, 0xF8, 0x53, 0xCB, 0xF0, 0x87, 0x00, 0xEF, 0x1C, 0x1B, 0x1B,
-	0x53, 0xFE, 0x1A, 0x91, 0x3C, 0x2B, 0xE5, 0x4E, 0xD9, 0x55, 0x86, 0xB7,
-	0x45, 0x60, 0xF0, 0x01, 0xAA, 0x3A, 0xE0, 0xD7, 0x81, 0xBC, 0x86, 0x93,
-	0x73, 0x0B, 0x97, 0x10, 0xC5, 0xCE, 0x70, 0xD8, 0xC1, 0xF7, 0x12, 0x22,
-	0x27, 0xFC, 0xB5, 0x15, 0xCE, 0x9D, 0xA7, 0x14, 0xE1, 0x2E, 0xF5, 0xB8,
-	0xB3, 0x7E, 0x14, 0x39, 0x6A, 0xE0, 0x43, 0x02, 0x57, 0x09, 0xA4, 0xE2,
-	0x28, 0xF6, 0x09, 0xBF, 0x61, 0x58, 0x35, 0x2D, 0x1B, 0x81, 0xB3, 0x0B,
-	0x41, 0x0A, 0xFA, 0x8A, 0x78, 0x29, 0x54, 0xFF, 0x6F, 0x4B, 0x67, 0xB6,
-	0x25, 0xCB, 0x71, 0x64, 0xD7, 0x6D, 0xEE, 0x31, 0x64, 0xE4, 0x3C, 0xD5,
-	0x5C, 0x77, 0x26, 0x40, 0x12, 0xCD, 0x66, 0x6B, 0x2D, 0xBD, 0xE8, 0x45,
-	0xFF, 0xAC, 0xEF, 0xE8, 0xD5, 0x92, 0x5A, 0x62, 0xB7, 0x08, 0x12, 0x04,
-	0x2E, 0xEA, 0xD6, 0x98, 0xF3, 0x9C, 0x31, 0xB9, 0xBB, 0xE9, 0x21, 0xF0,
-	0x09, 0xB5, 0xAA, 0xB2, 0xD2, 0xDC, 0xEC, 0x9C, 0xBD, 0x4F, 0x0D, 0xF7,
-	0xCE, 0x95, 0xC2, 0xD6, 0x19, 0xE6, 0x87, 0x40, 0xB2, 0x0F, 0xB4, 0x2A,
-	0x21, 0x0D, 0x50, 0x59, 0x25, 0x8B, 0x3D, 0x9D, 0x8B, 0x84, 0xF6, 0xD4,
-	0x10, 0x5C, 0xC1, 0x61, 0x0D, 0xB3, 0x45, 0x73, 0x5E, 0x4E, 0x4B, 0xA5,
-	0x85, 0x32, 0xCA, 0xE0, 0x2A, 0x33, 0x7C, 0x54, 0xC1, 0x1C, 0x2C, 0x0F,
-	0xE7, 0x8A, 0xD9, 0x0A, 0xE6, 0xBE, 0x39, 0xB2, 0x4C, 0xAF, 0x85, 0xE9,
-	0x05, 0x5C, 0x7E, 0x86, 0xEB, 0xEF, 0x2C, 0xD9, 0x44, 0xF9, 0xF9, 0xE8,
-	0x79, 0x4E, 0x61, 0x37, 0x84, 0xEB, 0xAE, 0x90, 0x24, 0x4D, 0x73, 0x37,
-	0x29, 0x5A, 0xAC, 0x67, 0x15, 0x9B, 0x9F, 0x03, 0xFB, 0x95, 0x61, 0xD3,
-	0x11, 0x9E, 0xA4, 0x31, 0x7C, 0x6C, 0xDA, 0xD0, 0x1F, 0xC1, 0xE1, 0x42,
-	0x70, 0xA9, 0x20, 0xD6, 0x90, 0xC4, 0x06, 0x4D, 0x1C, 0x2E, 0x0D, 0xA8,
-	0x44, 0x50, 0x7A, 0x8C, 0x17, 0x06, 0x0E, 0xEE, 0xB6, 0xCA, 0x49, 0x85,
-	0xAF, 0x7B, 0x78, 0xF5, 0x8A, 0xCF, 0x3C, 0xA9, 0x8D, 0x9A, 0xFA, 0x9A,
-	0x38, 0xEA, 0x36, 0x54, 0x34, 0xAD, 0xE2, 0x04, 0x41, 0x4C, 0xC0, 0x07,
-	0x38, 0x60, 0xC9, 0x9D, 0xA7, 0x13, 0x84, 0x76, 0x07, 0xEE, 0x32, 0x03,
-	0x63, 0x65, 0xD7, 0x73, 0x1C, 0x14, 0xF2, 0xA3, 0x52, 0x6D, 0xC1, 0x78,
-	0xB0, 0x2D, 0x47, 0xAB, 0x23, 0x64, 0xDE, 0x90, 0x1D, 0x2C, 0x72, 0xAA,
-	0xF1, 0x16, 0xEA, 0xAC, 0x91, 0x6E, 0x12, 0x94, 0x8B, 0xA1, 0xA1, 0xFD,
-	0xD9, 0xB2, 0x7F, 0x67, 0x59, 0x44, 0x9E, 0xD9, 0xD7, 0x9A, 0x5F, 0xFF,
-	0xB7, 0x70, 0xF9, 0xF7, 0x08, 0x71, 0x8E, 0xF6, 0xC8, 0xD3, 0xEE, 0x80,
-	0xB7, 0x81, 0xF5, 0x08, 0xA6, 0x7D, 0x43, 0x37, 0x86, 0x51, 0xB7, 0xE1,
-	0x06, 0x47, 0x9B, 0x7F, 0x73, 0x9C, 0xF7, 0x70, 0x06, 0xB6, 0xA3, 0xC0,
-	0xB1, 0x25, 0x58, 0x2C, 0x59, 0x37, 0x40, 0x47, 0xD9, 0x08, 0x84, 0xBC,
-	0x91, 0x40, 0xF7, 0x2A, 0x98, 0xB4, 0x61, 0x2A, 0xCA, 0xE9, 0xE8, 0x30,
-	0x41, 0xF1, 0x02, 0xB5, 0x85, 0x5D, 0xA4, 0xBC, 0x4A, 0xCD, 0xE9, 0x60,
-	0x39, 0x2C, 0x15, 0xBF, 0x6F, 0x20, 0x12, 0xFE, 0xA4, 0xD4, 0xDE, 0x73,
-	0xB2, 0x0D, 0x19, 0xAC, 0x14, 0x48, 0x5A, 0xC2, 0xB8, 0xAB, 0xF4, 0x26,
-	0x96, 0xE9, 0x75, 0x20, 0x1B, 0x39, 0x7E, 0x39, 0x1B, 0x1E, 0x9C, 0xE1,
-	0xE9, 0x51, 0xD1, 0x85, 0xA7, 0x8F, 0x32, 0x1A, 0x5B, 0x6E, 0x3B, 0x86,
-	0xA9, 0x04, 0xB2, 0x57, 0x4F, 0xF9, 0x62, 0x90, 0x5C, 0x29, 0x42, 0x84,
-	0xB6, 0x3C, 0xEE, 0x4F, 0x4A, 0xB8, 0x82, 0xB8, 0xAF, 0x4C, 0xFB, 0x96,
-	0xDB, 0x3E, 0x04, 0x49, 0x38, 0x25, 0x8E, 0xB7, 0x71, 0x85, 0x8B, 0x0D,
-	0xD3, 0x73, 0xCC, 0xE9, 0xE8, 0x08, 0xF3, 0x40, 0xF9, 0x54, 0x11, 0x9E,
-	0x02, 0xFA, 0x2C, 0x14, 0x55, 0x20, 0x4E, 0x1B, 0x72, 0xF8, 0x6C, 0x00,
-	0xE5, 0x44, 0xA9, 0x2F, 0x21, 0xFF, 0x28, 0xB8, 0x71, 0xD4, 0xDC, 0xED,
-	0x9D, 0x01, 0xAF, 0x78, 0xA3, 0x9C, 0x8F, 0x42, 0x7D, 0x16, 0xCC, 0x3E,
-	0x70, 0x9D, 0x07, 0x5A, 0xB5, 0x61, 0x2B, 0x8D, 0xAB, 0x6F, 0xDF, 0x6A,
-	0x9E, 0x8F, 0xA7, 0xB3, 0x27, 0x35, 0x4A, 0xD6, 0x6F, 0x22, 0x74, 0x67,
-	0xA3, 0x50, 0x83, 0x78, 0x25, 0x8D, 0x3D, 0x59, 0xD6, 0xC0, 0x9B, 0x8D,
-	0x6F, 0x8E, 0x68, 0x69, 0x50, 0x7A, 0xA2, 0x44, 0x67, 0x4B, 0x98, 0x3B,
-	0x0E, 0x27, 0xD8, 0x6F, 0xA0, 0x3A, 0x09, 0x11, 0x4A, 0x7F, 0x1C, 0x93,
-	0x74, 0xA0, 0x56, 0xCF, 0xE9, 0xE8, 0x68, 0x17, 0xD0, 0xBB, 0x86, 0xFE,
-	0xF7, 0x02, 0x17, 0x8D, 0x44, 0x7A, 0x9C, 0x79, 0xD2, 0x7E, 0xE0, 0x3F,
-	0x13, 0xE1, 0xC7, 0x67, 0x83, 0xFB, 0x11, 0xDA, 0xBF, 0x28, 0xBD, 0x5D,
-	0xCD, 0xE7, 0x54, 0xE8, 0xA4, 0xF0, 0xD6, 0x56, 0x0E, 0x6D, 0x41, 0x6C,
-	0x4C, 0xE4, 0x95, 0x3A, 0x78, 0x56, 0x2F, 0x06, 0xBF, 0xAC, 0x89, 0xDC,
-	0xBF, 0x7A, 0x5A, 0x43, 0xE8, 0xDC, 0x41, 0xF5, 0x41, 0x58, 0x0F, 0x05,
-	0x57, 0x1B, 0xA6, 0x36, 0x61, 0xD6, 0xF5, 0xCC, 0x92, 0x8A, 0xA2, 0x6C,
-	0x28, 0x95, 0x52, 0x08, 0x13, 0x4D, 0xE8, 0x18, 0x43, 0x91, 0xE6, 0x44,
-	0xC6, 0xE2, 0x83, 0x70, 0xCE, 0x95, 0xD5, 0x01, 0x9E, 0x34, 0x90, 0x9D,
-	0x03, 0xAE, 0x6C, 0x30, 0x25, 0x89, 0x33, 0x78, 0x94, 0xBE, 0x28, 0x53,
-	0x03, 0xF1, 0xC0, 0x92, 0x75, 0x20, 0xCA, 0x02, 0xFD, 0x5E, 0x44, 0xD2,
-	0x8E, 0xE9, 0x65, 0x8E, 0x3C, 0x0F, 0xEC, 0x0E, 0xC2, 0xAB, 0x36, 0x3E,
-	0xC0, 0x51, 0xD2, 0x98, 0xC6, 0xEF, 0xE2, 0xC0, 0x24, 0x16, 0x6C, 0x01,
-	0xE5, 0xAB, 0x72, 0x9C, 0x7B, 0xBC, 0x13, 0x86, 0x77, 0x9E, 0xF8, 0x3B,
-	0xE8, 0xDF, 0xC7, 0xE8, 0x20, 0x70, 0x32, 0x1E, 0x9F, 0x07, 0xD2, 0x6F,
-	0x9E, 0x73, 0x0A, 0x3E, 0x35, 0xA8, 0x35, 0x54, 0x12, 0xF1, 0xBA, 0x71,
-	0xEC, 0x7F, 0xF5, 0xC8, 0xA3, 0x50, 0xED, 0x3D, 0xE1, 0x28, 0xB8, 0x4C,
-	0xC9, 0x26, 0x86, 0xBB, 0x29, 0xB4, 0xAF, 0x02, 0xC7, 0x4B, 0x25, 0xED,
-	0x47, 0x4C, 0x47, 0x4A, 0xFF, 0xC2, 0xA2, 0x89, 0xE5, 0x94, 0xD7, 0x48,
-	0x5E, 0x53, 0x17, 0xCD, 0xF7, 0xF6, 0xFA, 0xEC, 0x90, 0x52, 0x49, 0x80,
-	0x44, 0xC0, 0x56, 0x4A, 0xE5, 0xC0, 0x67, 0x8A, 0xB7, 0x82, 0x0B, 0x8D,
-	0x2B, 0xB9, 0xDB, 0x86, 0xE1, 0x08, 0xAA, 0x9E, 0xE0, 0x0B, 0x8B, 0xAF,
-	0x02, 0x04, 0x65, 0x52, 0x03, 0x1D, 0xCB, 0xB1, 0xE3, 0x99, 0x67, 0x90,
-	0x16, 0x82, 0x3D, 0x58, 0xCE, 0x1B, 0x4F, 0x3D, 0xAB, 0xD9, 0x3E, 0x0B,
-	0xD5, 0x16, 0x7C, 0x80, 0x2A, 0x56, 0x4C, 0x22, 0xC4, 0xBF, 0x99, 0xC0,
-	0x17, 0x95, 0xD2, 0x4A, 0x95, 0x9B, 0x01, 0xDC, 0xFD, 0x31, 0x22, 0xFA,
-	0xB3, 0x67, 0x37, 0x14, 0xCA, 0xDC, 0xE2, 0xF3, 0x40, 0xB1, 0x54, 0x4E,
-	0xF3, 0xC0, 0xE1, 0x09, 0xCA, 0x37, 0xC1, 0x75, 0x94, 0xE4, 0xCA, 0xF2,
-	0x71, 0x08, 0x17, 0xD3, 0xC0, 0xC5, 0xA5, 0xF0, 0xD2, 0xB2, 0xCC, 0x4E,
-	0x86, 0xC5, 0x6B, 0xC5, 0x7E, 0x19, 0x58, 0x2F, 0x94, 0xC9, 0x2B, 0x44,
-	0x9F, 0xCF, 0x96, 0x45, 0x47, 0xA9, 0xFA, 0xCA, 0xE1, 0x13, 0x2C, 0xAF,
-	0x61, 0xE5, 0x85, 0xCB, 0x7D, 0xE0, 0xC6, 0x07, 0x7E, 0x69, 0xC3, 0x6B,
-	0xAB, 0x41, 0xAD, 0x5F, 0x06, 0x4B, 0x5E, 0x04, 0xDE, 0xF6, 0x81, 0xE3,
-	0x22, 0xC5, 0xAD, 0x02, 0xA6, 0x14, 0xD4, 0x3B, 0x44, 0x0D, 0xB1, 0x81,
-	0xA4, 0x13, 0x30, 0x3D, 0xCB, 0x31, 0x0B, 0xAC, 0x6A, 0xA0, 0xB4, 0xB4,
-	0x6B, 0xCF, 0x97, 0x58, 0x49, 0xDB, 0x81, 0x4E, 0x17, 0x5C, 0x4F, 0x39,
-	0x1B, 0xA5, 0xBD, 0xAB, 0xC9, 0x1F, 0x85, 0xF5, 0x46, 0x30, 0xA5, 0x41,
-	0x87, 0x9E, 0xD3, 0x17, 0xC3, 0xF0, 0x22, 0xA2, 0xB7, 0xF7, 0xDC, 0x97,
-	0x4A, 0x62, 0x1B, 0xA8, 0xC1, 0xD6, 0x1B, 0x76, 0xB5, 0x52, 0x97, 0xCA,
-	0xFD, 0xBE, 0xC9, 0x04, 0xB6, 0x77, 0x29, 0xA6, 0x0A, 0x14, 0xF5, 0x99,
-	0xBC, 0x6C, 0x26, 0x66, 0xB5, 0x35, 0x51, 0x2A, 0xD4, 0x09, 0x1C, 0x36,
-	0x1E, 0xFD, 0xEA, 0x49, 0x37, 0x30, 0x08, 0x86, 0x74, 0x1A, 0x58, 0xDF,
-	0x37, 0xF5, 0xA8, 0xDB, 0x2B, 0xCF, 0xBB, 0x4B, 0x61, 0x39, 0x34, 0x3C,
-	0x76, 0x94, 0xC8, 0x5B, 0x3E, 0x68, 0xCD, 0x85, 0x77, 0x54, 0x0F, 0xC2,
-	0xF2, 0xD9, 0x60, 0x57, 0x0E, 0xF5, 0x06, 0xDB, 0x52, 0xE8, 0x29, 0x75,
-	0x5F, 0x1A, 0x4D, 0x78, 0x01, 0xE7, 0xB9, 0x61, 0xB7, 0x69, 0xCC, 0xE4,
-	0xED, 0x9E, 0x21, 0x1B, 0x06, 0xAE, 0xDA, 0x4D, 0xA1, 0xB3, 0xDB, 0x83,
-	0x6D, 0x2D, 0x3C, 0x6D, 0x95, 0xFA, 0xDC, 0x50, 0xC6, 0xDB, 0x46, 0xE9,
-	0x94, 0x9E, 0xDC, 0x29, 0xBE, 0x0B, 0xF6, 0x24, 0x14, 0x33, 0xC3, 0xEB,
-	0x1B, 0xE4, 0x6F, 0x9E, 0xFD, 0x56, 0x71, 0x27, 0x30, 0xDA, 0xB8, 0x95,
-	0x25, 0x53, 0xD4, 0x79, 0xF2, 0x1E, 0xE4, 0xE3, 0x88, 0x4F, 0x9F, 0x1D,
-	0x77, 0x37, 0xF0, 0xE1, 0xA3, 0x50, 0xF5, 0x13, 0x4E, 0xC1, 0xB1, 0xD8,
-	0x28, 0xB3, 0x47, 0x4B, 0xF1, 0x4D, 0x99, 0xCF, 0x1C, 0x99, 0x0F, 0xDC,
-	0x8D, 0x85, 0xAB, 0xDB, 0x98, 0xE4, 0x2A, 0x50, 0x5B, 0x25, 0xAA, 0x13,
-	0x7A, 0x85, 0x47, 0xD6, 0xCA, 0x7C, 0x59, 0xF1, 0xF2, 0x02, 0x83, 0x43,
-	0xC3, 0x81, 0x9E, 0x54, 0x42, 0x34, 0xBD, 0x0F, 0xFC, 0x90, 0xC2, 0xBE,
-	0x6F, 0x78, 0x88, 0xE1, 0x98, 0x2B, 0x8F, 0xEA, 0x78, 0x7F, 0x0C, 0x74,
-	0xCF, 0x70, 0x55, 0x41, 0x71, 0x0D, 0x51, 0xDF, 0x72, 0x56, 0xCF, 0x53,
-	0xAE, 0x84, 0x99, 0xA1, 0xFE, 0xC9, 0x32, 0x5B, 0x3B, 0xB2, 0x20, 0xBC,
-	0xEB, 0xC3, 0xED, 0x54, 0x78, 0x37, 0x32, 0x74, 0x07, 0x86, 0x85, 0xB3,
-	0x2C, 0xF3, 0x8A, 0x19, 0x81, 0x58, 0x02, 0x59, 0xCB, 0x32, 0x8A, 0x84,
-	0x9E, 0x0F, 0xC4, 0xBB, 0x86, 0xBD, 0xBF, 0x2D, 0x3D, 0xBB, 0x05, 0xF8,
-	0x15, 0xE4, 0x47, 0x70, 0xB1, 0x67, 0x9A, 0xC2, 0xEE, 0x7D, 0x80, 0x1F,
-	0xC0, 0x9E, 0x2D, 0xEE, 0x55, 0x48, 0x76, 0x35, 0x3B, 0x6F, 0x78, 0x4B,
-	0x0C, 0xBE, 0x1F, 0x48, 0x36, 0xCA, 0xB5, 0x01, 0x77, 0x08, 0xE4, 0x0F,
-	0x67, 0xF2, 0x14, 0x32, 0xD3, 0x80, 0x10, 0xB5, 0x8E, 0xF0, 0x7B, 0x4F,
-	0x75, 0x6A, 0x3E, 0x9D, 0x85, 0x87, 0xEB, 0xC8, 0xF0, 0xE9, 0x3A, 0x70,
-	0x3B, 0x82, 0xFD, 0x65, 0x82, 0x8E, 0x3C, 0x71, 0x02, 0xD7, 0x71, 0x44,
-	0x2B, 0x72, 0x1C, 0xBC, 0x27, 0xAC, 0x84, 0x6E, 0x5D, 0x33, 0x74, 0x81,
-	0xCE, 0x1E, 0x56, 0x4F, 0x25, 0xF9, 0x06, 0xC6, 0x05, 0x64, 0x12, 0x68,
-	0x8D, 0x1A, 0xDD, 0x9C, 0x1B, 0x43, 0x34, 0x30, 0x6C, 0x0B, 0xC3, 0x42,
-	0x1D, 0x1B, 0xA7, 0xA4, 0x25, 0x4C, 0x7A, 0x30, 0xBC, 0x83, 0x7E, 0xCF,
-	0xD0, 0x32, 0x8A, 0xCB, 0xE1, 0xF4, 0xA6, 0x14, 0xF3, 0x40, 0x71, 0x82,
-	0x63, 0x01, 0xD6, 0x0B, 0x63, 0x63, 0x59, 0x6F, 0x61, 0x1D, 0x7B, 0x8E,
-	0x07, 0xCF, 0x72, 0xE9, 0xE9, 0xAD, 0x0C, 0x85, 0x57, 0x76, 0xB6, 0xE1,
-	0x24, 0xC4, 0x79, 0xD3, 0xC9, 0x88, 0xDB, 0x10, 0xFA, 0x90, 0xDD, 0x43,
-	0xFA, 0xBB, 0xC0, 0xF5, 0x7B, 0x43, 0x7B, 0x68, 0x28, 0x1D, 0x14, 0x4F,
-	0x81, 0xFC, 0x0D, 0xE6, 0x4B, 0x65, 0xB1, 0x74, 0xE8, 0x59, 0x69, 0x25,
-	0xF0, 0xC7, 0x2E, 0xDC, 0xBE, 0x17, 0x46, 0x57, 0xCA, 0x99, 0xC0, 0xF3,
-	0x9B, 0x25, 0xCC, 0x95, 0xD3, 0xD6, 0xF3, 0xB6, 0x17, 0x5E, 0x7D, 0x60,
-	0x15, 0x0B, 0x9D, 0x9B, 0xC6, 0x7E, 0xD2, 0xCA, 0x85, 0xE8, 0xF0, 0x45,
-	0x99, 0x96, 0xF0, 0xD9, 0x05, 0xB6, 0x3F, 0x1B, 0x9C, 0x6B, 0xBE, 0xF3,
-	0x82, 0x36, 0xCF, 0x97, 0x4F, 0xA5, 0xA1, 0x8D, 0xE1, 0x7C, 0x82, 0x59,
-	0x61, 0x78, 0xFB, 0xD9, 0x73, 0xFE, 0x5B, 0x80, 0x59, 0x41, 0xC7, 0xC1,
-	0x55, 0x5B, 0xB9, 0xF6, 0x70, 0xAD, 0xD0, 0x8D, 0x02, 0x52, 0x2A, 0xEB,
-	0x83, 0xE7, 0x70, 0x52, 0x8E, 0x0E, 0xFA, 0xAD, 0x86, 0x48, 0xC5, 0x2E,
-	0x81, 0x4D, 0xC0, 0x6D, 0x2B, 0x42, 0xAE, 0x94, 0x1E, 0xD6, 0x00, 0x1E,
-	0xD2, 0x28, 0xC2, 0xB6, 0x95, 0xDB, 0xCA, 0x63, 0x0A, 0xC8, 0xDB, 0x81,
-	0x30, 0x82, 0x1C, 0x97, 0x24, 0x00, 0x00, 0x18, 0x9D, 0x49, 0x44, 0x41,
-	0x54, 0x15, 0x1E, 0xFB, 0xD0, 0x7E, 0x80, 0xD7, 0x73, 0x60, 0x9F, 0x06,
-	0x6C, 0x64, 0xE9, 0x14, 0x11, 0xE9, 0xDA, 0x21, 0x3B, 0x61, 0xB3, 0x09,
-	0x98, 0x18, 0xA6, 0x13, 0xE8, 0x8D, 0x2C, 0xE1, 0x14, 0xB1, 0x7A, 0x0A,
-	0x2C, 0x16, 0x8A, 0xF5, 0xC2, 0xC5, 0xD4, 0x73, 0xF7, 0x11, 0xDE, 0x5F,
-	0xC1, 0x64, 0x02, 0x76, 0x0A, 0xED, 0x2E, 0xD4, 0x65, 0xE0, 0xF4, 0xAB,
-	0x67, 0xF3, 0x08, 0x3F, 0xCD, 0x61, 0x56, 0x07, 0xEE, 0x32, 0x98, 0xC4,
-	0x30, 0x2E, 0xE1, 0x50, 0xC3, 0xB9, 0x2B, 0x74, 0x07, 0x11, 0x36, 0xA9,
-	0xE9, 0x77, 0xC1, 0x4C, 0x85, 0x53, 0x37, 0x50, 0xA2, 0xFC, 0x62, 0x02,
-	0x65, 0xE6, 0x39, 0x8D, 0x1A, 0x47, 0xF1, 0xBB, 0x9E, 0x67, 0x18, 0x5B,
-	0x2A, 0x69, 0x6A, 0x69, 0xDB, 0x99, 0x67, 0xF7, 0xD8, 0x68, 0xE6, 0x6B,
-	0x2F, 0x94, 0xE1, 0x37, 0x21, 0xC6, 0xDE, 0xD2, 0x9F, 0x7B, 0x32, 0xA3,
-	0xCC, 0x7E, 0x9B, 0xAD, 0xDA, 0x75, 0xA0, 0xD3, 0x1C, 0x62, 0x59, 0x64,
-	0xCD, 0x7E, 0xE1, 0xA2, 0x05, 0x37, 0xB7, 0x96, 0xEC, 0x43, 0x13, 0xCB,
-	0x8B, 0xEF, 0x03, 0x69, 0x24, 0xAC, 0xB6, 0x86, 0xE7, 0x6F, 0x4A, 0xFE,
-	0x93, 0xE3, 0xBC, 0x51, 0x1C, 0x60, 0x5B, 0x42, 0x3A, 0xB6, 0x4C, 0x7B,
-	0x81, 0xDB, 0xBE, 0x92, 0x89, 0x52, 0xBC, 0x08, 0xCF, 0x6B, 0x43, 0xF5,
-	0x14, 0x68, 0xED, 0x1C, 0xC6, 0x81, 0xF5, 0xCA, 0xF5, 0x85, 0xD0, 0xFE,
-	0xA3, 0xD2, 0xF9, 0x6C, 0xC8, 0x23, 0xCB, 0x72, 0xE6, 0x88, 0xDE, 0xFE,
-	0x24, 0x4C, 0xE7, 0x86, 0x78, 0xEB, 0x89, 0x7E, 0xF5, 0x70, 0x84, 0x6E,
-	0x47, 0x88, 0xA6, 0xCD, 0xFB, 0xB4, 0xBD, 0x57, 0x46, 0x73, 0xCB, 0x01,
-	0xC7, 0xC3, 0xD1, 0xF3, 0xCB, 0x02, 0xAA, 0x23, 0xC4, 0x7D, 0xF8, 0xDC,
-	0x85, 0x1F, 0x10, 0x7E, 0xEF, 0x2C, 0xD1, 0xB2, 0xF9, 0xA5, 0x97, 0x15,
-	0xEC, 0x6B, 0xC8, 0x05, 0xB0, 0x0D, 0xC0, 0x09, 0xEB, 0x28, 0x4E, 0xE0,
-	0x8E, 0x4A, 0x75, 0x0C, 0xA4, 0x25, 0xB4, 0xBC, 0x30, 0x88, 0xA1, 0xEE,
-	0x29, 0x83, 0xA9, 0x20, 0x59, 0x44, 0x2D, 0x4A, 0x7F, 0x1B, 0x18, 0xBF,
-	0x42, 0x3A, 0x11, 0xE6, 0xD5, 0x6F, 0x01, 0xCA, 0x18, 0xCC, 0xC0, 0x22,
-	0x17, 0x8A, 0xD7, 0xC0, 0x7E, 0x91, 0x70, 0x7A, 0x80, 0xB0, 0xA8, 0x18,
-	0x24, 0xC2, 0xE5, 0xC8, 0x32, 0xEC, 0x06, 0xE6, 0xE7, 0x8A, 0xBF, 0xB8,
-	0xC0, 0x3C, 0x40, 0xD2, 0x55, 0x2E, 0x6E, 0x0C, 0xD3, 0x8B, 0x88, 0x38,
-	0x53, 0x82, 0x69, 0xF4, 0x59, 0xB5, 0x83, 0xD5, 0x3C, 0x50, 0xFD, 0xBF,
-	0x80, 0xF9, 0x77, 0x90, 0xBD, 0xA1, 0x37, 0x55, 0xFA, 0x1F, 0x20, 0x1E,
-	0x59, 0xA2, 0xA1, 0x30, 0x54, 0x4F, 0x1D, 0x29, 0x2E, 0x51, 0xAC, 0x34,
-	0x1B, 0xC4, 0xD0, 0x0D, 0xD4, 0x1E, 0x6A, 0x1F, 0x58, 0x3B, 0xC3, 0xCE,
-	0x0B, 0x16, 0xE5, 0xA2, 0x82, 0xCB, 0xBD, 0x30, 0xF0, 0x96, 0x5F, 0xD2,
-	0x8A, 0xF9, 0x39, 0x70, 0x7E, 0x01, 0xB7, 0x31, 0x18, 0x09, 0x80, 0x92,
-	0x47, 0x86, 0xA5, 0x83, 0xA4, 0x2C, 0xA9, 0xAA, 0x26, 0x17, 0xD1, 0xE9,
-	0x41, 0x39, 0x81, 0xB3, 0x87, 0xEC, 0xDC, 0x20, 0xEF, 0x3B, 0x3D, 0x68,
-	0x5F, 0xC1, 0xA7, 0xBB, 0x98, 0xCF, 0x37, 0x4A, 0x3C, 0xF4, 0x94, 0xA9,
-	0x61, 0xB7, 0x32, 0x2C, 0x56, 0x8E, 0xB7, 0xE7, 0x8A, 0xEA, 0x0D, 0xBA,
-	0x47, 0x43, 0x27, 0x85, 0xF1, 0xC0, 0x92, 0xF4, 0x40, 0x2C, 0x24, 0x01,
-	0x64, 0xD3, 0x2C, 0x88, 0x5E, 0xB7, 0xCA, 0xB7, 0x2A, 0x20, 0xAA, 0x7C,
-	0x18, 0x35, 0x66, 0xF5, 0xAE, 0x55, 0xFA, 0x13, 0x4B, 0x79, 0x05, 0xF9,
-	0xB5, 0xF2, 0xDC, 0x75, 0x2C, 0x07, 0x4A, 0x34, 0xFB, 0x41, 0x39, 0xF5,
-	0x94, 0xB7, 0xFF, 0x65, 0x70, 0x8F, 0x30, 0x9C, 0x07, 0x46, 0x43, 0x48,
-	0x2B, 0x03, 0x51, 0xB3, 0x4E, 0xDD, 0x1E, 0x2A, 0xAA, 0x93, 0xD2, 0x96,
-	0x84, 0x5E, 0x3F, 0x70, 0xFC, 0xE8, 0x91, 0xF7, 0x86, 0x2A, 0x55, 0xCC,
-	0x73, 0x44, 0xFA, 0xB3, 0xA7, 0x5A, 0x2A, 0xEB, 0x1A, 0xB6, 0x56, 0x58,
-	0xC5, 0x09, 0x92, 0x06, 0x92, 0x96, 0x27, 0x8B, 0x03, 0x83, 0x04, 0xBA,
-	0xC6, 0x71, 0x9C, 0xC0, 0xE1, 0xB2, 0x79, 0x0D, 0x4C, 0x4E, 0x96, 0x71,
-	0x19, 0xA8, 0x3A, 0x4A, 0xB7, 0x1F, 0xF0, 0x29, 0x98, 0x48, 0x91, 0xB4,
-	0xA9, 0x59, 0x65, 0x1B, 0x38, 0xE4, 0x81, 0x43, 0x09, 0xED, 0x96, 0xA1,
-	0x17, 0x0C, 0x41, 0x3C, 0xAB, 0x36, 0x1C, 0x11, 0x0A, 0x57, 0xD3, 0x8E,
-	0xE1, 0x1E, 0x43, 0xCB, 0xC6, 0x9C, 0xB7, 0x81, 0x5F, 0x9E, 0x4B, 0x7E,
-	0x5C, 0xC1, 0xA2, 0x6E, 0xC8, 0xDB, 0xAD, 0x56, 0x44, 0xA8, 0x0D, 0xFB,
-	0x53, 0x85, 0xAB, 0xE1, 0xE0, 0x0D, 0x4E, 0x9A, 0x61, 0xC9, 0x2F, 0xE1,
-	0x46, 0x23, 0xFE, 0xDC, 0x82, 0xFD, 0x30, 0x50, 0xDD, 0xC0, 0xEE, 0xBD,
-	0x21, 0x4A, 0x84, 0xF8, 0xE0, 0xB1, 0xB5, 0x25, 0x77, 0x8E, 0x81, 0x13,
-	0x92, 0xC4, 0xD2, 0x51, 0x28, 0xEA, 0xE6, 0x3F, 0x40, 0x5D, 0x37, 0x55,
-	0x31, 0x59, 0x42, 0xD8, 0xC3, 0xD0, 0xC3, 0x45, 0xAA, 0xAC, 0x33, 0xE1,
-	0xC9, 0x09, 0xEC, 0x84, 0x58, 0x0D, 0x71, 0x1C, 0x38, 0xA6, 0xB0, 0x8F,
-	0x94, 0xB7, 0x24, 0x60, 0x68, 0x7C, 0x8B, 0x36, 0x6D, 0x18, 0x00, 0x6E,
-	0x60, 0x28, 0x53, 0xE5, 0x54, 0x29, 0xC1, 0xC3, 0x97, 0xA1, 0x70, 0xF5,
-	0x29, 0xE1, 0x77, 0x17, 0x8D, 0x79, 0xE5, 0xB0, 0xCD, 0xD8, 0xFD, 0x23,
-	0x30, 0x7F, 0x71, 0x3C, 0xEF, 0x60, 0x5F, 0x45, 0xA4, 0x91, 0xD2, 0x9D,
-	0x78, 0x86, 0x7D, 0x43, 0xD9, 0x32, 0x94, 0xCE, 0x71, 0x3C, 0x06, 0x92,
-	0xAD, 0x50, 0x9D, 0x20, 0xB8, 0x80, 0x0F, 0x01, 0x1D, 0x40, 0xEF, 0xD2,
-	0xD2, 0xBF, 0x50, 0x32, 0xB5, 0x44, 0xAB, 0x40, 0x52, 0x78, 0x5A, 0x9B,
-	0x88, 0xFD, 0x5A, 0x58, 0x75, 0x95, 0xD9, 0x25, 0x44, 0xCF, 0x51, 0x84,
-	0xB7, 0xCA, 0xF6, 0xA4, 0xD4, 0x5B, 0x61, 0xB0, 0x17, 0xA6, 0x46, 0xE9,
-	0xBF, 0x2A, 0xBB, 0x58, 0x38, 0xD4, 0x96, 0xA2, 0xA8, 0xE9, 0x7B, 0xF8,
-	0xD2, 0xF3, 0x5C, 0xDD, 0xC4, 0x2C, 0xFF, 0x29, 0xE2, 0xF5, 0xC6, 0x50,
-	0x1C, 0x03, 0x9B, 0x59, 0xC5, 0xAE, 0x08, 0x70, 0x84, 0x63, 0x0E, 0x8B,
-	0x08, 0xB6, 0xDD, 0x86, 0xE0, 0x15, 0xB7, 0x7F, 0xF3, 0xE9, 0xF6, 0x85,
-	0x4E, 0x66, 0x28, 0x13, 0x38, 0x48, 0xA0, 0x28, 0x95, 0x74, 0x1B, 0xE8,
-	0x1C, 0x94, 0x58, 0x0C, 0xA9, 0x53, 0xF2, 0xB8, 0xC6, 0x74, 0x85, 0x28,
-	0x8B, 0xA8, 0x4F, 0x70, 0x98, 0x07, 0xCE, 0x2F, 0x81, 0xDA, 0x82, 0xBD,
-	0x50, 0xB2, 0xC8, 0x51, 0x14, 0x10, 0x32, 0xA8, 0x5B, 0x15, 0xAE, 0xDB,
-	0x4C, 0xCA, 0xEC, 0x3D, 0xC5, 0xBE, 0x66, 0xB1, 0x88, 0xF9, 0xB7, 0x07,
-	0x78, 0xDA, 0x80, 0x49, 0x41, 0x0A, 0x48, 0xD6, 0x35, 0x86, 0xC6, 0xEB,
-	0xE3, 0x53, 0xF0, 0x1B, 0xA1, 0x72, 0xB0, 0x97, 0x06, 0xE9, 0xFE, 0xFE,
-	0x1E, 0x3E, 0x07, 0x38, 0x1A, 0xCB, 0x8F, 0xA9, 0x67, 0x59, 0x06, 0x16,
-	0x22, 0x44, 0x55, 0x43, 0xF7, 0x20, 0x37, 0xD4, 0x71, 0xA0, 0x1D, 0x1A,
-	0x4F, 0x60, 0x95, 0x28, 0x3B, 0x0C, 0xE5, 0x09, 0xCE, 0x45, 0x13, 0xCB,
-	0x4A, 0xDE, 0x1A, 0xF1, 0xF3, 0xC8, 0x3A, 0xA6, 0xAD, 0x98, 0x41, 0x10,
-	0x0A, 0xEB, 0xF1, 0x91, 0x27, 0x52, 0x48, 0x3B, 0x42, 0x34, 0x52, 0x42,
-	0x4B, 0xF1, 0x3E, 0x22, 0x04, 0x43, 0x2D, 0x90, 0x27, 0x9E, 0xF3, 0xC8,
-	0x63, 0xA6, 0x09, 0x92, 0x78, 0x46, 0x41, 0x19, 0x47, 0x71, 0x83, 0xDE,
-	0xAF, 0x73, 0xBE, 0x3D, 0x59, 0x1E, 0x9F, 0x1C, 0xDB, 0x07, 0x85, 0x9D,
-	0xC7, 0xA4, 0x70, 0x3D, 0xB0, 0x64, 0x43, 0x83, 0xA4, 0x05, 0x5B, 0x15,
-	0xF6, 0x7B, 0xC7, 0x7A, 0x17, 0x08, 0x1E, 0x46, 0x18, 0xC6, 0x83, 0x40,
-	0x94, 0x36, 0xF6, 0x56, 0x3B, 0x12, 0xA2, 0x1B, 0x25, 0xEE, 0x45, 0xEC,
-	0xCA, 0xC0, 0x51, 0x95, 0xFE, 0x9B, 0x72, 0x7F, 0x70, 0xB4, 0x96, 0x96,
-	0xEB, 0xB6, 0x65, 0x3F, 0x55, 0xA2, 0xB7, 0x7F, 0x55, 0x4E, 0x8F, 0x02,
-	0x4F, 0xCA, 0xA4, 0xE5, 0x99, 0xBC, 0x17, 0x2E, 0x06, 0x34, 0xCE, 0x7B,
-	0x02, 0x23, 0x31, 0x84, 0x08, 0x42, 0x04, 0x13, 0xF5, 0x44, 0xA9, 0xF0,
-	0x54, 0x0A, 0xA7, 0x55, 0x60, 0x7B, 0x0A, 0xEC, 0x7D, 0xE0, 0xD0, 0x16,
-	0x8A, 0x91, 0xB2, 0xEA, 0x0A, 0xDB, 0x48, 0x39, 0x0D, 0x1C, 0xAD, 0x2B,
-	0xE8, 0xBF, 0x37, 0x0C, 0x6F, 0x2D, 0x59, 0xAC, 0xD8, 0xA3, 0xE5, 0xB4,
-	0x8A, 0x98, 0x9F, 0x73, 0xA2, 0x0A, 0xB2, 0x10, 0x30, 0x89, 0xD0, 0xF3,
-	0x16, 0xAD, 0x1C, 0x91, 0x40, 0xBB, 0x10, 0x0A, 0x13, 0x78, 0x0D, 0x8D,
-	0xBD, 0xAB, 0x63, 0x60, 0x12, 0x41, 0xDF, 0x58, 0xCC, 0x32, 0x50, 0x3D,
-	0x05, 0x62, 0x0B, 0x83, 0x09, 0xD4, 0xB7, 0x86, 0xA2, 0xAB, 0x2C, 0x3C,
-	0xD8, 0x8D, 0x63, 0x7D, 0x72, 0x6C, 0x12, 0xA8, 0xC7, 0x42, 0x16, 0x09,
-	0xC3, 0x00, 0xA3, 0x7D, 0xA0, 0x9B, 0x34, 0x58, 0xDA, 0x6A, 0x2F, 0x1C,
-	0x56, 0x8E, 0xDC, 0x29, 0x72, 0x2F, 0xB4, 0x7F, 0x2F, 0xF4, 0xAF, 0x52,
-	0xA8, 0x6B, 0xDC, 0xCF, 0x4A, 0xBA, 0x0E, 0x24, 0xB5, 0x27, 0x6F, 0x35,
-	0xE4, 0xAE, 0x53, 0xED, 0x48, 0x7C, 0xC3, 0x25, 0x1A, 0xEC, 0x95, 0x50,
-	0x36, 0x75, 0xB2, 0x48, 0x14, 0xC9, 0x9B, 0xAB, 0x5E, 0x26, 0x90, 0xB6,
-	0x2C, 0x52, 0x05, 0x92, 0x9D, 0x62, 0x4F, 0x15, 0x65, 0x24, 0x1C, 0x63,
-	0xC5, 0x27, 0x40, 0x2C, 0xF4, 0x7B, 0xCA, 0xF8, 0x12, 0xC6, 0x13, 0xA1,
-	0x6D, 0x22, 0x56, 0x1A, 0x78, 0x28, 0x1C, 0x0B, 0x55, 0x98, 0x40, 0xF7,
-	0x32, 0x90, 0xB6, 0x84, 0xC8, 0x07, 0x38, 0xD7, 0xD4, 0x73, 0x61, 0xF7,
-	0x00, 0x3F, 0xBD, 0x7A, 0x5E, 0x0F, 0x1E, 0x1F, 0xE0, 0x76, 0x24, 0x7C,
-	0x6A, 0x0B, 0xBD, 0x76, 0x60, 0x8F, 0xE3, 0xE7, 0x83, 0x61, 0xB1, 0x0F,
-	0xD4, 0xB9, 0x12, 0xB5, 0x60, 0x7A, 0x07, 0x57, 0x57, 0x0D, 0x5D, 0xAC,
-	0x32, 0x70, 0xAC, 0x95, 0xBE, 0x57, 0x42, 0x02, 0x87, 0xDA, 0xB3, 0xAA,
-	0x3C, 0xA7, 0x21, 0xDC, 0xA7, 0x4D, 0xAD, 0x2C, 0x3B, 0x58, 0x92, 0xBF,
-	0x56, 0xD4, 0x5D, 0x88, 0x4E, 0xFF, 0xC3, 0x53, 0x1C, 0x13, 0x6E, 0x3A,
-	0xC2, 0xF7, 0x9F, 0x03, 0xDF, 0x7D, 0x80, 0x74, 0x1A, 0x23, 0xDE, 0x30,
-	0xAA, 0x03, 0xE0, 0x29, 0xB4, 0xA9, 0x73, 0x57, 0xCF, 0x4A, 0xF5, 0xEC,
-	0x1A, 0xEB, 0x75, 0xD6, 0x3C, 0xEB, 0x5A, 0x08, 0xF5, 0x24, 0x62, 0xDF,
-	0xAB, 0xC9, 0x5D, 0x63, 0x03, 0x1D, 0xDD, 0x0B, 0xC9, 0xA5, 0xA5, 0x75,
-	0xEF, 0xD1, 0xB6, 0x65, 0x37, 0x37, 0x1C, 0x5E, 0x2A, 0xBE, 0xBE, 0x7A,
-	0x5E, 0xCF, 0x86, 0xAE, 0xF5, 0x4C, 0x0C, 0x64, 0x46, 0x51, 0xDF, 0x4C,
-	0xB1, 0xA3, 0xAD, 0x30, 0xDD, 0x0B, 0xF3, 0x6E, 0xE0, 0xD5, 0x28, 0xB5,
-	0x81, 0xC1, 0x3B, 0xCB, 0xD5, 0x20, 0xD0, 0xB2, 0x81, 0xC3, 0xA2, 0x49,
-	0xD0, 0xA6, 0x27, 0x98, 0xEC, 0x0D, 0x75, 0x08, 0xCC, 0x2E, 0x84, 0xA3,
-	0x31, 0x2C, 0xFB, 0x81, 0x1A, 0xB0, 0x13, 0x8B, 0xF1, 0x86, 0xB4, 0x12,
-	0x26, 0x47, 0xB8, 0x73, 0x35, 0xD9, 0x41, 0x59, 0x38, 0xD8, 0xE6, 0xC2,
-	0x6E, 0x16, 0x70, 0x1E, 0xDA, 0xB1, 0x62, 0xEE, 0x85, 0xA5, 0x57, 0xB6,
-	0xA5, 0xB0, 0x75, 0x15, 0xBE, 0x86, 0x81, 0x81, 0xD4, 0x42, 0xDD, 0x81,
-	0x3C, 0x03, 0x29, 0x2D, 0x55, 0xAE, 0x94, 0x2B, 0x61, 0xB0, 0x31, 0xA4,
-	0x2D, 0xC5, 0x26, 0x0A, 0x0E, 0x52, 0x0F, 0x76, 0x08, 0xE7, 0x89, 0xB2,
-	0x5C, 0x08, 0x9D, 0x47, 0x25, 0x3F, 0x40, 0x11, 0x1B, 0x36, 0x5D, 0x41,
-	0xBB, 0x9E, 0xDE, 0x48, 0xC9, 0x46, 0x30, 0xED, 0x09, 0x97, 0x99, 0xA0,
-	0x52, 0x32, 0x73, 0xCA, 0x4F, 0x0E, 0x2A, 0x2F, 0xBC, 0xAF, 0xA1, 0xBD,
-	0x0F, 0xB8, 0x03, 0x14, 0x67, 0xA5, 0x9A, 0x29, 0xBB, 0x27, 0xE1, 0xB0,
-	0x6A, 0x80, 0xD1, 0x2E, 0x05, 0xD3, 0x81, 0x96, 0xB1, 0x0C, 0x2B, 0x48,
-	0xE6, 0x9E, 0x87, 0x5A, 0x79, 0x16, 0xD8, 0x27, 0xCA, 0xED, 0x45, 0x53,
-	0x5F, 0xBB, 0xFD, 0x9D, 0xE1, 0xEA, 0xC6, 0x50, 0x1A, 0x65, 0xBF, 0x0F,
-	0x6C, 0x56, 0xCA, 0x61, 0x03, 0x3C, 0x5A, 0x8A, 0x53, 0xF3, 0x35, 0x94,
-	0x5D, 0x18, 0x5A, 0x97, 0x81, 0xF5, 0x5E, 0xA9, 0xFF, 0x23, 0x90, 0xFF,
-	0x0A, 0x2E, 0x57, 0xA2, 0xFC, 0x51, 0x18, 0x4C, 0x6A, 0x3E, 0x7C, 0x86,
-	0x7F, 0xFE, 0x1E, 0x3E, 0x7D, 0x50, 0xFC, 0x65, 0x60, 0xAE, 0x09, 0x51,
-	0xE5, 0xD9, 0x6E, 0x3C, 0xC7, 0x6F, 0x31, 0xCF, 0x5B, 0xC7, 0xF9, 0x15,
-	0xEC, 0x06, 0xAA, 0xC4, 0x23, 0xA3, 0xE6, 0x2F, 0x6F, 0x38, 0x51, 0x8E,
-	0x52, 0xB3, 0x57, 0x88, 0xDB, 0xC2, 0xF8, 0x46, 0xA9, 0x3F, 0x28, 0x9B,
-	0x91, 0xB2, 0x30, 0x30, 0xDF, 0x43, 0x3A, 0xF3, 0xE4, 0xDF, 0x94, 0x97,
-	0xB5, 0x67, 0x9F, 0x19, 0x92, 0x41, 0xA3, 0x8D, 0x39, 0xE5, 0x4A, 0x59,
-	0x28, 0xA2, 0x0D, 0x4F, 0xB0, 0x95, 0x7B, 0xCC, 0xD1, 0x40, 0x4B, 0xE9,
-	0x0E, 0xE0, 0xA6, 0x1F, 0x31, 0xBD, 0xF5, 0x9C, 0x9D, 0x67, 0x56, 0x19,
-	0x36, 0x85, 0x70, 0x65, 0x94, 0x2C, 0x0F, 0x24, 0xBF, 0xC2, 0xE8, 0xA0,
-	0xA4, 0xE3, 0x18, 0xDF, 0xF7, 0xD4, 0xEF, 0x3C, 0xD6, 0x09, 0x36, 0x0F,
-	0x44, 0x27, 0xA5, 0x2F, 0x96, 0x41, 0xD1, 0x18, 0xBE, 0x9C, 0x87, 0x3A,
-	0x04, 0x2A, 0x01, 0x4A, 0x18, 0x3C, 0x58, 0xB4, 0x52, 0x1E, 0x7F, 0x3C,
-	0x53, 0xA8, 0xE0, 0x54, 0x18, 0x65, 0x86, 0xFB, 0x51, 0x60, 0x74, 0x61,
-	0xA1, 0xAB, 0x48, 0xE9, 0x29, 0x37, 0xCA, 0x3A, 0x87, 0xB9, 0xF3, 0x64,
-	0x27, 0xCF, 0xA0, 0x82, 0x76, 0x02, 0x71, 0x80, 0x2C, 0x12, 0xE4, 0x12,
-	0x4E, 0x83, 0xC0, 0xB7, 0x3E, 0xD4, 0x51, 0xC4, 0xE1, 0xC1, 0x53, 0x46,
-	0x01, 0xB9, 0xB2, 0xB4, 0xAE, 0x62, 0x6C, 0xBB, 0xC6, 0x1B, 0x45, 0x73,
-	0xE8, 0xD6, 0x11, 0x67, 0x1F, 0x38, 0x96, 0x8E, 0x53, 0x05, 0xAD, 0x04,
-	0x92, 0x23, 0x44, 0xCF, 0x8A, 0x2B, 0x68, 0x1A, 0x3E, 0xAB, 0x06, 0x34,
-	0x11, 0xD9, 0xE6, 0x08, 0x55, 0xF5, 0x21, 0x4F, 0x94, 0x43, 0xEE, 0x38,
-	0x1D, 0xC1, 0x97, 0xB0, 0xEF, 0x36, 0x96, 0xF0, 0xD1, 0x3B, 0xC3, 0xE7,
-	0x3B, 0xCB, 0xFB, 0x5B, 0x4F, 0x7B, 0xA4, 0xEC, 0x13, 0xE5, 0x5C, 0x28,
-	0xCB, 0x95, 0xF0, 0xB2, 0x16, 0xCE, 0x5F, 0x05, 0x7D, 0x86, 0xD6, 0x4E,
-	0xB9, 0x6B, 0x19, 0x2E, 0x3E, 0x26, 0x84, 0x8F, 0x8E, 0x9F, 0xB7, 0x8E,
-	0xD9, 0xBC, 0x66, 0x39, 0x17, 0x8E, 0x2B, 0x88, 0xC2, 0xBF, 0x28, 0x57,
-	0x77, 0xC2, 0x97, 0xEF, 0x0D, 0xC3, 0x71, 0x44, 0x08, 0x0E, 0x37, 0xF3,
-	0xAC, 0xCD, 0x89, 0x53, 0x2E, 0xCC, 0x5F, 0x60, 0xFE, 0x55, 0x79, 0x7D,
-	0x56, 0xEA, 0x20, 0xB4, 0x06, 0x42, 0x77, 0x18, 0x18, 0xBD, 0x8F, 0x49,
-	0xEF, 0x05, 0x49, 0x2B, 0xF6, 0x7B, 0xF0, 0x45, 0xB3, 0x04, 0xB9, 0xBA,
-	0xB0, 0xEC, 0x32, 0x65, 0x7D, 0xF4, 0xBC, 0x1C, 0x2D, 0xE7, 0x45, 0x4D,
-	0xFB, 0x09, 0x7A, 0x67, 0x61, 0xD2, 0x11, 0xF8, 0x14, 0x30, 0xD7, 0x96,
-	0xBC, 0x0C, 0xD4, 0x73, 0x21, 0xB6, 0x4A, 0xD6, 0x36, 0xE4, 0x23, 0xD0,
-	0xD2, 0x12, 0x1F, 0x94, 0xB4, 0xB6, 0x64, 0x67, 0xC7, 0x68, 0x55, 0x92,
-	0x6A, 0xCC, 0x2C, 0x89, 0xD8, 0xD6, 0x8E, 0x53, 0x47, 0x59, 0xB4, 0x21,
-	0x39, 0x0A, 0xA3, 0xBD, 0x72, 0x31, 0x87, 0xA4, 0x0E, 0x94, 0xDE, 0x72,
-	0x0E, 0xA1, 0x69, 0xE9, 0x04, 0x88, 0x0D, 0x84, 0xB6, 0xA1, 0x16, 0xA5,
-	0x65, 0x21, 0xEE, 0x2A, 0xA9, 0x17, 0x6C, 0x47, 0x48, 0xD6, 0x4A, 0xF4,
-	0x16, 0x70, 0x3F, 0x2A, 0x67, 0xA0, 0x6C, 0x2B, 0xF6, 0xDE, 0x62, 0x7B,
-	0x11, 0x59, 0x5C, 0x11, 0x7B, 0x4F, 0xFB, 0x04, 0xBB, 0x12, 0x56, 0x05,
-	0xEC, 0x3D, 0xF4, 0xBB, 0x30, 0xFD, 0x0D, 0x85, 0x47, 0x69, 0x88, 0x9D,
-	0xE3, 0xA2, 0xD3, 0x54, 0xBB, 0x42, 0x57, 0xD8, 0xA4, 0x11, 0xB6, 0x88,
-	0x38, 0xEE, 0x3D, 0x45, 0xAD, 0xB4, 0x33, 0x47, 0xAF, 0x27, 0x54, 0xB1,
-	0xE2, 0xAA, 0x26, 0x43, 0x70, 0x76, 0x0E, 0x5F, 0x06, 0xFA, 0x67, 0xB8,
-	0x10, 0x83, 0x6B, 0x37, 0x09, 0x9F, 0x73, 0xA9, 0x84, 0xB3, 0xE0, 0xB6,
-	0x11, 0xE7, 0x32, 0x60, 0x2C, 0x5C, 0xB5, 0x1A, 0x19, 0xD6, 0x26, 0x08,
-	0x65, 0xAD, 0x1C, 0x23, 0xD0, 0xEB, 0x66, 0xB0, 0xBD, 0x99, 0x1A, 0xF2,
-	0xFB, 0x88, 0xD6, 0x95, 0xE7, 0xA2, 0xE3, 0x18, 0x21, 0x94, 0x5B, 0xC3,
-	0xEA, 0xE0, 0x78, 0x3C, 0xC0, 0xD3, 0x8B, 0xB0, 0xFC, 0xA6, 0xC8, 0x37,
-	0xE8, 0x17, 0x4A, 0xE7, 0x0C, 0x17, 0x07, 0x98, 0x14, 0x35, 0x9B, 0x27,
-	0xD8, 0x05, 0x78, 0xAA, 0x60, 0x3B, 0x36, 0x9C, 0x46, 0x4A, 0x74, 0xFF,
-	0xDF, 0x1B, 0xC6, 0x4F, 0x37, 0xB1, 0x2C, 0x67, 0xC2, 0xF6, 0x9B, 0x61,
-	0x3C, 0xF7, 0x1C, 0x03, 0xFC, 0x87, 0x57, 0x5E, 0x6A, 0x08, 0xC1, 0xD1,
-	0xBA, 0x10, 0x06, 0xDF, 0x29, 0xAD, 0xA1, 0xA1, 0x3D, 0xB2, 0x98, 0x31,
-	0xE4, 0x7D, 0xCF, 0x6B, 0x2E, 0xEC, 0x04, 0xA6, 0x56, 0xB9, 0xF4, 0xCA,
-	0xCD, 0x8B, 0xA1, 0x98, 0x7B, 0x5C, 0x10, 0x6A, 0x63, 0xA8, 0xEB, 0x26,
-	0xF5, 0x7B, 0xF9, 0x5E, 0x99, 0xF6, 0x0D, 0x87, 0x5B, 0x58, 0x77, 0x3C,
-	0xDB, 0x73, 0x53, 0x24, 0x1D, 0xD8, 0x86, 0xF7, 0xEB, 0x80, 0xF3, 0xB1,
-	0xF1, 0xF5, 0xE9, 0xBA, 0xB1, 0x91, 0x65, 0x07, 0xB0, 0x8B, 0x80, 0x44,
-	0x01, 0x69, 0x29, 0xF9, 0x08, 0x7C, 0x37, 0xC2, 0xA6, 0x86, 0xDC, 0x38,
-	0x3E, 0xCF, 0x94, 0xF4, 0x35, 0x90, 0xEF, 0x94, 0xBA, 0x07, 0xD5, 0x10,
-	0x6C, 0x0F, 0x5A, 0x5D, 0xCB, 0xBE, 0xAF, 0xAC, 0xCF, 0xCA, 0x45, 0x68,
-	0xBA, 0xF8, 0x89, 0x34, 0xAB, 0xE8, 0xD6, 0x20, 0x50, 0x9B, 0x66, 0x35,
-	0x1C, 0x3B, 0xA5, 0x33, 0x81, 0xF8, 0xCA, 0x63, 0xDA, 0x81, 0xDD, 0xDE,
-	0x50, 0x6D, 0x02, 0x15, 0x8A, 0x08, 0x24, 0xA6, 0xA9, 0x7F, 0xBB, 0x09,
-	0xAC, 0x6A, 0xC3, 0x69, 0x6D, 0xD8, 0xBC, 0x42, 0xA7, 0x82, 0xCB, 0xAE,
-	0x92, 0x89, 0xE1, 0x8C, 0x25, 0x8F, 0x0D, 0xCF, 0x89, 0xE3, 0xD4, 0x56,
-	0xCE, 0x67, 0xE8, 0xE6, 0x30, 0x3C, 0x2A, 0x87, 0x0C, 0x0E, 0x0A, 0x07,
-	0xA7, 0xCC, 0x2B, 0xC3, 0xC5, 0x4E, 0xB8, 0x3A, 0x43, 0x95, 0x5A, 0x4E,
-	0x01, 0x82, 0x04, 0xCE, 0x55, 0xE3, 0x0A, 0x38, 0x57, 0xCA, 0xB1, 0x0A,
-	0xB4, 0x0C, 0x78, 0x03, 0x69, 0x0B, 0x8C, 0x06, 0x4C, 0x0F, 0xBA, 0x57,
-	0x70, 0x33, 0x8D, 0xB8, 0x6B, 0x43, 0xDA, 0x52, 0xFC, 0x20, 0xB0, 0x35,
-	0x81, 0xD3, 0x2E, 0x65, 0xF5, 0xEC, 0xD9, 0x3F, 0x06, 0x5E, 0x96, 0x86,
-	0xAF, 0xDB, 0xC0, 0xDB, 0x5A, 0x39, 0x6E, 0x85, 0x71, 0x6C, 0x19, 0xDD,
-	0x39, 0xFA, 0x5D, 0x28, 0xD6, 0x81, 0xE3, 0xB3, 0x10, 0x3D, 0x28, 0xA3,
-	0xA1, 0x30, 0xB9, 0x53, 0xFC, 0x3B, 0x4F, 0x3C, 0x88, 0x89, 0x7E, 0x1F,
-	0x25, 0x5C, 0x96, 0x81, 0xED, 0xCC, 0xB1, 0xFD, 0xEA, 0x69, 0x3F, 0x43,
-	0x34, 0x13, 0xAA, 0x0A, 0xCE, 0x2D, 0xC5, 0xDD, 0xC0, 0xE4, 0x07, 0xB8,
-	0x7C, 0x1F, 0x93, 0x24, 0x1E, 0x31, 0x81, 0x44, 0x04, 0xB5, 0xC2, 0x5A,
-	0x0D, 0x0F, 0x26, 0x90, 0x0F, 0x94, 0x56, 0x2C, 0xE8, 0x5E, 0xD9, 0x3F,
-	0xD6, 0x9C, 0x0E, 0xD0, 0xCD, 0xE0, 0xD3, 0x27, 0x47, 0x35, 0x4E, 0x1A,
-	0x69, 0x94, 0xD4, 0xDC, 0x3B, 0x65, 0x53, 0x1A, 0xEA, 0x8D, 0xB0, 0x3C,
-	0x44, 0x9C, 0x0F, 0x15, 0x93, 0x93, 0xD2, 0x0E, 0x4A, 0x1D, 0x60, 0x99,
-	0xC3, 0xEC, 0x08, 0x65, 0xD5, 0x00, 0x19, 0x95, 0x08, 0x2F, 0x4A, 0xA6,
-	0xD0, 0xAE, 0x85, 0x56, 0xA1, 0x38, 0xF5, 0x2C, 0xAD, 0x72, 0x4E, 0x94,
-	0x71, 0xAC, 0x24, 0x85, 0x52, 0xEE, 0x22, 0xC2, 0x09, 0xBA, 0x35, 0x74,
-	0xD2, 0x88, 0xC9, 0xD4, 0x62, 0xFA, 0x15, 0x7B, 0x11, 0xC2, 0xC1, 0xA0,
-	0x4B, 0x28, 0xCF, 0x1E, 0xC4, 0xD1, 0x6D, 0xC1, 0xEE, 0x23, 0x24, 0x7D,
-	0xE5, 0xD6, 0xC6, 0xC8, 0x07, 0xCF, 0xB2, 0x03, 0xCB, 0xA5, 0x70, 0x78,
-	0x50, 0xDC, 0xB1, 0x79, 0xF7, 0x0F, 0x27, 0xD0, 0xBA, 0x84, 0xBA, 0x67,
-	0x88, 0xBB, 0x11, 0x8B, 0xA3, 0xE3, 0x58, 0x3A, 0xC4, 0x09, 0x57, 0xD6,
-	0xF0, 0xCE, 0x29, 0xBD, 0x8D, 0xE5, 0x58, 0x0B, 0x8B, 0xA8, 0x66, 0x5E,
-	0x2B, 0xDB, 0x6E, 0x43, 0xF9, 0x18, 0x24, 0x86, 0x7E, 0xAD, 0x60, 0x94,
-	0x43, 0x2A, 0x1C, 0x2D, 0xAC, 0x5C, 0x20, 0xAB, 0xA1, 0xA3, 0xCA, 0x85,
-	0xF7, 0xB8, 0x5C, 0x99, 0x39, 0xC1, 0x94, 0xBF, 0x81, 0x22, 0x35, 0x60,
-	0x62, 0x21, 0x6D, 0x0B, 0xF1, 0x44, 0xC8, 0xFA, 0x81, 0xDE, 0x40, 0xF0,
-	0x23, 0x4B, 0x6B, 0xDA, 0xA0, 0xDE, 0x52, 0x22, 0xD2, 0x6D, 0x81, 0x7D,
-	0x83, 0x7D, 0x6E, 0x59, 0x6E, 0x3C, 0xFD, 0x67, 0x47, 0x3D, 0x53, 0x66,
-	0x2B, 0x61, 0xBB, 0x12, 0xDC, 0x41, 0xE9, 0x27, 0xCA, 0xCD, 0x17, 0xE5,
-	0xDD, 0x7D, 0x4A, 0xEB, 0xA6, 0x66, 0xBE, 0x0F, 0x6C, 0xB1, 0xDC, 0xA8,
-	0xE3, 0xAE, 0x03, 0xC5, 0xD0, 0x50, 0xB7, 0x02, 0xCE, 0x06, 0xA2, 0xCB,
-	0xFF, 0x29, 0x0C, 0xF1, 0xCC, 0x2B, 0x65, 0xE5, 0xC0, 0xA6, 0x42, 0x74,
-	0x65, 0xF1, 0xA5, 0xA7, 0x3B, 0x84, 0xEC, 0x4F, 0x86, 0xEB, 0x3F, 0x37,
-	0x20, 0xA6, 0xF5, 0x02, 0xC2, 0x93, 0xD2, 0xDB, 0x0A, 0xD6, 0x04, 0x34,
-	0xF6, 0xE4, 0x1D, 0x45, 0xBB, 0x50, 0x4D, 0x0C, 0x33, 0x0D, 0x3C, 0x2F,
-	0x1A, 0x55, 0xEC, 0x6D, 0x05, 0x7F, 0x2C, 0x84, 0x43, 0x5F, 0x78, 0x68,
-	0x0B, 0xC7, 0x79, 0xCA, 0xE2, 0xB5, 0xA6, 0x7E, 0x55, 0x4E, 0x9B, 0x40,
-	0x55, 0x14, 0x98, 0x00, 0x59, 0x10, 0x46, 0xD6, 0xE0, 0xAD, 0xB2, 0xA9,
-	0x02, 0xFE, 0x00, 0x03, 0x0F, 0x93, 0x31, 0x98, 0xBB, 0xDF, 0x9A, 0xC2,
-	0x1E, 0x5A, 0xDB, 0x88, 0xE1, 0xD2, 0x71, 0x50, 0x45, 0xBB, 0x9E, 0x6C,
-	0x0A, 0xA7, 0x7F, 0x32, 0x2C, 0xCF, 0x20, 0xAF, 0x81, 0x74, 0xA1, 0x4C,
-	0x97, 0xD0, 0x8F, 0x02, 0x17, 0x6D, 0x28, 0x47, 0xF0, 0xD6, 0x35, 0x98,
-	0x10, 0xF0, 0x73, 0x45, 0x16, 0x42, 0xDB, 0x05, 0xE4, 0x1A, 0xB8, 0x85,
-	0xEE, 0x17, 0xC3, 0x4D, 0x0A, 0xEB, 0xD8, 0xF0, 0xFA, 0x0D, 0x16, 0x0F,
-	0x4A, 0xFF, 0x31, 0x70, 0x95, 0x47, 0x74, 0xBB, 0xC2, 0xA0, 0xE5, 0x21,
-	0x87, 0xE3, 0x19, 0x96, 0xE2, 0x29, 0xB6, 0x8A, 0x3B, 0xC3, 0x48, 0x94,
-	0xDB, 0x54, 0xE9, 0xD5, 0x82, 0x79, 0x75, 0x74, 0x02, 0xF8, 0x58, 0xD9,
-	0x8F, 0x04, 0xB9, 0x30, 0x24, 0xA9, 0x92, 0x04, 0xD3, 0xB0, 0x0F, 0x5D,
-	0xC0, 0x87, 0x88, 0x53, 0x15, 0xF0, 0x7B, 0x4F, 0xA7, 0x68, 0x80, 0xCF,
-	0x71, 0x68, 0xBA, 0x90, 0xB9, 0x6D, 0x52, 0x3E, 0xBD, 0x9E, 0x32, 0x4A,
-	0x21, 0x6B, 0x5B, 0xFA, 0x53, 0x18, 0x5F, 0x36, 0xE1, 0xD6, 0x10, 0xE0,
-	0x54, 0xC4, 0x94, 0x8F, 0x15, 0x8B, 0xAD, 0xE2, 0x0A, 0xCF, 0x73, 0x49,
-	0x83, 0x7E, 0x39, 0x81, 0x9C, 0x6B, 0x8E, 0xBE, 0xC9, 0x44, 0xFA, 0x56,
-	0x83, 0xBB, 0xED, 0x02, 0x1D, 0x31, 0x4C, 0xC4, 0x30, 0x3C, 0x06, 0xE2,
-	0xB3, 0xB0, 0x1A, 0x40, 0xF9, 0x83, 0xE7, 0xFA, 0xDA, 0xD2, 0x77, 0x30,
-	0xD5, 0xC0, 0x66, 0x03, 0xD1, 0x37, 0x4F, 0x94, 0xFF, 0xE8, 0x68, 0xA9,
-	0xD2, 0xBD, 0x82, 0xDB, 0x4F, 0x30, 0xBC, 0x34, 0x08, 0x86, 0xB4, 0xF4,
-	0xDC, 0x74, 0x84, 0xF4, 0x63, 0x8B, 0x56, 0x5B, 0xD8, 0xAE, 0xCE, 0xBC,
-	0x3E, 0x2A, 0xF2, 0x06, 0x93, 0x22, 0x60, 0xA5, 0x81, 0x18, 0xDF, 0xF7,
-	0x20, 0xEA, 0x41, 0x36, 0xF5, 0xCC, 0xD3, 0x84, 0xFD, 0x2E, 0xD0, 0x5B,
-	0x78, 0xBE, 0xCB, 0xE1, 0x7E, 0x16, 0x78, 0x8A, 0x4A, 0x7E, 0xB6, 0xC2,
-	0xF3, 0x2C, 0xE1, 0xE5, 0x9B, 0x67, 0xB4, 0x6D, 0x10, 0xB1, 0x69, 0x1B,
-	0xE2, 0x0C, 0x86, 0x62, 0x19, 0xD5, 0x11, 0x47, 0x5F, 0xE2, 0xBD, 0xC1,
-	0xA8, 0xF0, 0x3E, 0x6A, 0x2C, 0xDA, 0x51, 0xCF, 0xB3, 0x4F, 0x94, 0xF5,
-	0xC1, 0x50, 0x9C, 0x02, 0x6E, 0xAD, 0xB4, 0x63, 0x18, 0x74, 0xA0, 0x7D,
-	0x25, 0x64, 0xDF, 0xA7, 0x58, 0x2F, 0x9C, 0xFE, 0xB3, 0xE0, 0xFC, 0x57,
-	0x68, 0x2D, 0xE1, 0xCB, 0xAB, 0xD2, 0x8B, 0x1C, 0xB3, 0x08, 0xF6, 0x63,
-	0xE5, 0xE8, 0x02, 0xAA, 0xD0, 0x8E, 0x9A, 0xCD, 0x63, 0xB7, 0x25, 0xA4,
-	0x03, 0x25, 0x9D, 0x28, 0xAE, 0xF6, 0xBC, 0x3D, 0x08, 0xDF, 0x7E, 0x12,
-	0xF6, 0xBF, 0x28, 0x69, 0x01, 0xBD, 0x8E, 0x67, 0x9A, 0xC1, 0x34, 0x18,
-	0xEC, 0x1A, 0x9E, 0x8B, 0x46, 0x33, 0x5F, 0x1B, 0x4B, 0x34, 0xF4, 0xF4,
-	0xC6, 0x11, 0x59, 0x01, 0xDB, 0x8D, 0xA3, 0x58, 0x43, 0xEB, 0x00, 0xDD,
-	0x2E, 0xBC, 0x4B, 0x05, 0xB9, 0x48, 0x38, 0xB7, 0x1C, 0x87, 0x2A, 0x70,
-	0xA8, 0x2C, 0xA7, 0x43, 0x20, 0x84, 0x1A, 0x6F, 0x1A, 0x6B, 0x79, 0x11,
-	0x2B, 0x21, 0x11, 0xD4, 0x80, 0xB5, 0x10, 0x0D, 0x61, 0x38, 0x12, 0x3E,
-	0xA5, 0xCA, 0x45, 0x57, 0x99, 0xB6, 0x0D, 0x51, 0x2B, 0x62, 0x41, 0xCD,
-	0xD7, 0xA3, 0xE7, 0xEB, 0x0B, 0x9C, 0xBE, 0xE5, 0x5C, 0x6C, 0x60, 0x53,
-	0x42, 0xE5, 0x02, 0x3F, 0xB7, 0xE0, 0xD7, 0x48, 0x08, 0xB5, 0xE1, 0x43,
-	0x12, 0x98, 0x8E, 0x94, 0x7D, 0xDF, 0x50, 0x79, 0xA1, 0x17, 0x29, 0xBE,
-	0x13, 0x08, 0xA2, 0x9C, 0x8F, 0x8E, 0xF3, 0x7F, 0x28, 0xE9, 0x4C, 0x48,
-	0xFE, 0x20, 0x1C, 0xDF, 0x29, 0xE7, 0x0B, 0x65, 0xBA, 0x10, 0xB2, 0x37,
-	0xF0, 0x67, 0x38, 0x6F, 0x0C, 0xD1, 0xB1, 0xEB, 0x89, 0xFB, 0x86, 0x2F,
-	0x7F, 0x54, 0x4E, 0xDF, 0x09, 0xA7, 0x31, 0x9C, 0x4B, 0x8F, 0x6C, 0x95,
-	0x91, 0x83, 0xD6, 0xA1, 0xE0, 0x7C, 0xB0, 0xCC, 0x56, 0xB0, 0x3F, 0x42,
-	0xA7, 0x2D, 0x1C, 0xBB, 0x16, 0x73, 0x72, 0xB4, 0xF6, 0xF0, 0xB9, 0x14,
-	0x7A, 0x2A, 0x44, 0x08, 0xBF, 0x5A, 0x61, 0x9D, 0x2A, 0x3E, 0x51, 0xF4,
-	0x24, 0xB4, 0x1F, 0x04, 0x79, 0x82, 0xB3, 0x57, 0xF6, 0x75, 0xC9, 0xC4,
-	0x09, 0xDD, 0x91, 0x32, 0xBC, 0x32, 0x70, 0x11, 0x70, 0x06, 0xE2, 0x93,
-	0xE2, 0x96, 0x15, 0xD5, 0x4C, 0x71, 0x85, 0xD0, 0x31, 0x81, 0xEB, 0x14,
-	0xDE, 0xD5, 0x42, 0xB1, 0x52, 0x7E, 0x14, 0xE1, 0xE5, 0xAC, 0x1C, 0xAA,
-	0x66, 0x4B, 0x78, 0x13, 0x37, 0x3D, 0x40, 0xBA, 0x42, 0x3C, 0x50, 0xCA,
-	0xD8, 0xF1, 0x22, 0xB0, 0x8F, 0x85, 0x2F, 0x0F, 0xCA, 0xC5, 0x46, 0x19,
-	0x15, 0x90, 0x7F, 0x85, 0xDD, 0x4B, 0x03, 0x5A, 0x3E, 0x25, 0x82, 0xBB,
-	0x0C, 0x90, 0xC2, 0xA4, 0x1D, 0x73, 0x9D, 0x2B, 0xDB, 0x87, 0x9A, 0xFF,
-	0xB3, 0x15, 0xFE, 0xF2, 0x8B, 0xE7, 0xED, 0x55, 0xE8, 0xD9, 0x66, 0x18,
-	0x1E, 0xDD, 0x29, 0xA3, 0xFE, 0x6F, 0xFE, 0xE3, 0xA3, 0x92, 0x6C, 0x05,
-	0xB3, 0x57, 0x64, 0xE2, 0x19, 0x5C, 0x19, 0xA2, 0x81, 0xE5, 0x31, 0x77,
-	0x3C, 0x55, 0x86, 0xA3, 0x04, 0xBE, 0x03, 0xEE, 0x42, 0x03, 0xD4, 0x8A,
-	0x1E, 0x6B, 0x7E, 0x8C, 0x94, 0x6F, 0x3E, 0x20, 0x85, 0x92, 0x38, 0xC5,
-	0xB4, 0x21, 0xEB, 0x58, 0x42, 0x27, 0x70, 0x6E, 0x09, 0x47, 0x51, 0xB2,
-	0x12, 0x6E, 0xB0, 0xC4, 0x13, 0xE8, 0x0F, 0xE0, 0x3E, 0x16, 0xEE, 0x0B,
-	0xA1, 0x7D, 0x0A, 0x1C, 0x76, 0x35, 0xCB, 0xB9, 0xE5, 0xDF, 0x67, 0x8E,
-	0xC5, 0x0A, 0x2E, 0xF7, 0xCD, 0xBD, 0x61, 0xD2, 0x31, 0x1C, 0x7B, 0xC2,
-	0x22, 0xF3, 0x2C, 0x5B, 0xCA, 0xB4, 0x5B, 0xF3, 0xB1, 0x0D, 0x57, 0x1D,
-	0xC3, 0x93, 0x0A, 0xAF, 0x0B, 0x21, 0xCA, 0xA0, 0x13, 0x09, 0x0E, 0x65,
-	0xBF, 0x85, 0xE7, 0x37, 0xCB, 0xE7, 0x79, 0x60, 0x82, 0xD2, 0x8A, 0x62,
-	0xAA, 0x14, 0x8E, 0x47, 0x8F, 0xAB, 0x84, 0x73, 0xA2, 0x6C, 0xDA, 0x42,
-	0xC4, 0xBF, 0x08, 0x9D, 0x7B, 0xB8, 0xFF, 0x1C, 0xF1, 0x3A, 0x85, 0xDC,
-	0x38, 0xF6, 0x27, 0x43, 0x59, 0x09, 0x83, 0xA5, 0xE2, 0xF6, 0x81, 0x7D,
-	0x11, 0xD8, 0x97, 0x90, 0x74, 0x84, 0xF6, 0x24, 0x65, 0x2E, 0x4A, 0x55,
-	0x0A, 0xFD, 0xDA, 0xF1, 0xFE, 0x60, 0x99, 0xBE, 0x08, 0xCB, 0x63, 0x60,
-	0x7B, 0x28, 0x39, 0x2E, 0x60, 0x64, 0x80, 0xAE, 0x72, 0x50, 0x61, 0xE9,
-	0x0D, 0x67, 0x3C, 0xBD, 0x14, 0x3E, 0x8D, 0x0D, 0x9F, 0xAF, 0x22, 0x42,
-	0xDF, 0xE1, 0xAD, 0xE1, 0xE7, 0x5C, 0x78, 0x29, 0x21, 0xDA, 0x07, 0xFC,
-	0x02, 0xE2, 0x3A, 0x30, 0x6E, 0xC3, 0x7D, 0x07, 0xC6, 0x5E, 0x58, 0xAE,
-	0x85, 0xB3, 0x81, 0x75, 0xAA, 0x9C, 0xC6, 0xC2, 0xB0, 0xD7, 0x30, 0x76,
-	0x46, 0xCE, 0x92, 0xED, 0xA0, 0x58, 0x96, 0x14, 0x2D, 0xA5, 0xA4, 0xC9,
-	0x32, 0x24, 0x3D, 0x4B, 0xBD, 0x31, 0x9C, 0x36, 0x0E, 0xDD, 0x6B, 0x63,
-	0xC5, 0xAA, 0x84, 0x4E, 0xC7, 0x20, 0xE3, 0x80, 0x49, 0xA1, 0x3A, 0xD5,
-	0xAC, 0x1F, 0x2C, 0xBF, 0xCE, 0x2C, 0xFF, 0x67, 0xE3, 0xF9, 0xAA, 0x60,
-	0x06, 0x86, 0xCB, 0xEF, 0x95, 0x8F, 0x77, 0x86, 0x0F, 0xEF, 0x94, 0xAC,
-	0x2F, 0xEC, 0x4F, 0x81, 0xF9, 0x57, 0xC3, 0xE2, 0xC7, 0x40, 0xBD, 0x6E,
-	0xE4, 0x94, 0xAD, 0x54, 0x28, 0x2C, 0x7C, 0xCB, 0x03, 0xFF, 0x08, 0xE0,
-	0x2E, 0xE1, 0x62, 0x2A, 0x14, 0x91, 0x32, 0xCE, 0x61, 0xF0, 0xE2, 0xA9,
-	0xCF, 0x8D, 0x9D, 0x3B, 0x69, 0x2B, 0xDF, 0x65, 0xC2, 0xB8, 0x23, 0xE4,
-	0x17, 0xB0, 0xEB, 0x1B, 0xAA, 0x58, 0x58, 0xD5, 0x9E, 0xD1, 0x56, 0x99,
-	0x9C, 0x85, 0x6C, 0x17, 0x08, 0xA7, 0xC0, 0xB1, 0x84, 0xC5, 0xC2, 0xD0,
-	0xDE, 0x07, 0x16, 0x1E, 0xFE, 0x5E, 0x7A, 0xDE, 0xCA, 0xE6, 0x25, 0x70,
-	0x37, 0x32, 0xDC, 0x8D, 0x0C, 0xDD, 0x56, 0x60, 0xE3, 0x23, 0x0A, 0x02,
-	0xED, 0x0C, 0xBE, 0xBB, 0x36, 0x7C, 0x99, 0x5A, 0xA2, 0x3A, 0xF0, 0xD3,
-	0xD7, 0x40, 0xF9, 0xE2, 0xE9, 0xE4, 0x30, 0x1E, 0x45, 0x1C, 0xFB, 0xCA,
-	0x6A, 0xE0, 0x99, 0xDB, 0xC0, 0xFD, 0x42, 0x19, 0x3F, 0x40, 0x59, 0x37,
-	0xA8, 0x5B, 0x5F, 0x19, 0xC4, 0x38, 0x4C, 0x0B, 0xFC, 0x55, 0x20, 0x92,
-	0xFF, 0xA2, 0x98, 0x5B, 0x45, 0x86, 0x82, 0x6B, 0x35, 0x5A, 0x92, 0x55,
-	0x0E, 0x2B, 0x23, 0xB4, 0x8C, 0x92, 0x1A, 0x4B, 0x21, 0x81, 0xDC, 0x28,
-	0x46, 0x2C, 0xA7, 0x83, 0x67, 0xBF, 0x77, 0x9C, 0x1F, 0x84, 0xAB, 0xAD,
-	0xF2, 0xFB, 0x58, 0x91, 0x63, 0xE0, 0xD5, 0x04, 0x96, 0x95, 0xA1, 0x13,
-	0x0B, 0xEF, 0xC7, 0x9E, 0xE4, 0x46, 0xF8, 0xDA, 0xB1, 0xFC, 0x72, 0x56,
-	0xCA, 0x5C, 0xE8, 0x19, 0x61, 0x9A, 0x40, 0xDB, 0x07, 0xAA, 0x17, 0x83,
-	0x3B, 0x78, 0x36, 0x75, 0x60, 0x7E, 0x80, 0xE3, 0x56, 0xB8, 0x0E, 0xC2,
-	0xEF, 0xBA, 0x81, 0xCB, 0xA9, 0xE1, 0x36, 0x11, 0xE2, 0x52, 0x50, 0xEF,
-	0xC9, 0x32, 0xA5, 0x75, 0x0D, 0xF5, 0x07, 0x25, 0x9A, 0x34, 0xA7, 0xD5,
-	0xFD, 0x46, 0xE8, 0x39, 0xCF, 0xE8, 0x51, 0xA9, 0x80, 0x61, 0x2D, 0x9C,
-	0x5B, 0xCA, 0x3E, 0x85, 0xD7, 0x8E, 0x32, 0xA8, 0x7E, 0xD3, 0xA3, 0x56,
-	0x42, 0x27, 0x17, 0xC6, 0xB3, 0x06, 0x48, 0x71, 0x3C, 0xC2, 0x33, 0xE0,
-	0x5E, 0x1C, 0xBF, 0xBC, 0xC2, 0xEB, 0x19, 0xE2, 0x0F, 0x30, 0xF9, 0x83,
-	0xE7, 0xF6, 0x0F, 0x11, 0xD3, 0x4B, 0x65, 0x30, 0x6C, 0xA8, 0x9A, 0xBF,
-	0x6E, 0xE0, 0xAF, 0x2B, 0x65, 0xD1, 0xB1, 0x74, 0x66, 0x70, 0xF5, 0xAA,
-	0xF8, 0x73, 0xE0, 0xD8, 0xA9, 0x39, 0x0A, 0x90, 0x29, 0xE3, 0xDB, 0x18,
-	0x1D, 0x59, 0x96, 0xA1, 0x22, 0x7A, 0x03, 0xF9, 0xAA, 0xF4, 0x2A, 0xA5,
-	0x6B, 0x21, 0x15, 0x98, 0x8A, 0xF0, 0xEE, 0x64, 0x38, 0x1D, 0x02, 0x51,
-	0x65, 0x99, 0x47, 0x81, 0x4D, 0xDD, 0x60, 0xF8, 0xB2, 0x63, 0xC0, 0x9F,
-	0x95, 0xF5, 0x41, 0x78, 0x5D, 0x2B, 0xD3, 0x15, 0x5C, 0xF8, 0x88, 0xC3,
-	0xA5, 0x23, 0xBC, 0x57, 0x3A, 0x1F, 0xA0, 0xD7, 0x8B, 0xB8, 0x88, 0x13,
-	0x62, 0x6A, 0xD6, 0x07, 0xE5, 0xF5, 0xD0, 0xE0, 0x4D, 0x3F, 0xA5, 0x11,
-	0x9F, 0x30, 0x64, 0x05, 0xBC, 0x2E, 0x9B, 0x22, 0xAC, 0x7F, 0x6B, 0xAE,
-	0x88, 0xB7, 0x3D, 0xF8, 0xE9, 0x9D, 0x61, 0x1E, 0x79, 0xCE, 0x23, 0x38,
-	0x7D, 0xB5, 0x0C, 0x1E, 0x3D, 0xFA, 0x8B, 0x27, 0xC4, 0x20, 0x49, 0x03,
-	0xAB, 0x88, 0xBB, 0xD0, 0xBF, 0x31, 0x44, 0x9D, 0xB1, 0xA1, 0x35, 0xB0,
-	0x04, 0xEB, 0xF1, 0x47, 0xC3, 0x6E, 0x13, 0x31, 0x9B, 0x3B, 0x66, 0x9B,
-	0xA6, 0xB7, 0xDE, 0x72, 0x1E, 0x5F, 0x42, 0x7D, 0x14, 0xCC, 0x46, 0xC9,
-	0x8F, 0x81, 0xC3, 0x52, 0xE9, 0x6E, 0x94, 0x24, 0x86, 0x7C, 0x1C, 0x28,
-	0x0B, 0x78, 0x16, 0x10, 0x13, 0xF8, 0x70, 0x61, 0xF8, 0xF2, 0x29, 0xA5,
-	0x73, 0x6D, 0xF8, 0x07, 0xF0, 0x6D, 0x5F, 0xB2, 0x5B, 0x2B, 0x49, 0x2E,
-	0xCC, 0x57, 0x81, 0x72, 0xEB, 0x89, 0x96, 0x71, 0xF3, 0xC9, 0x4C, 0x02,
-	0x33, 0x0B, 0xAB, 0x5B, 0xF8, 0xDC, 0x16, 0xBE, 0x1F, 0x58, 0x86, 0x51,
-	0xA3, 0x3A, 0xDF, 0x1F, 0x3C, 0x38, 0xE5, 0xBA, 0x0F, 0xF9, 0x77, 0x11,
-	0xC7, 0x4F, 0x50, 0xB6, 0x85, 0xBA, 0x16, 0xD6, 0xA3, 0x9A, 0xC1, 0x52,
-	0xE8, 0x3F, 0x59, 0xCA, 0xB9, 0x6B, 0xC2, 0x8F, 0xC6, 0x30, 0xEF, 0x78,
-	0x86, 0x0A, 0x99, 0x02, 0x1D, 0x21, 0x4C, 0x05, 0x93, 0x28, 0xAC, 0x9A,
-	0x1A, 0x17, 0xEB, 0x66, 0x9D, 0xBB, 0xC9, 0x0C, 0xFB, 0x81, 0x32, 0x89,
-	0x95, 0xFE, 0x18, 0x7A, 0x97, 0x86, 0xE9, 0xC0, 0x20, 0x71, 0xCD, 0xE1,
-	0x00, 0xAB, 0xA5, 0xF2, 0x1F, 0x33, 0xF8, 0xEB, 0x3C, 0x90, 0x97, 0x30,
-	0x6D, 0x2B, 0xC3, 0x9D, 0x92, 0x2D, 0x40, 0x36, 0x4A, 0x7B, 0x08, 0x5F,
-	0xFA, 0xA6, 0x29, 0x86, 0x4E, 0x02, 0x33, 0x89, 0x38, 0x19, 0xE8, 0xEE,
-	0x02, 0xBD, 0xBD, 0xE3, 0xA6, 0x06, 0xCE, 0x0D, 0xF9, 0x6C, 0x92, 0x2B,
-	0x9D, 0x9D, 0x52, 0xB4, 0x03, 0xC7, 0x54, 0x38, 0x9A, 0x88, 0x55, 0x70,
-	0x64, 0x65, 0xA0, 0xDC, 0x08, 0xB3, 0x27, 0x65, 0xB7, 0x10, 0x56, 0xB5,
-	0xA5, 0x33, 0xF6, 0x4C, 0xEF, 0x2C, 0xFE, 0x9F, 0x0D, 0xA7, 0x7B, 0x47,
-	0xED, 0x02, 0xC5, 0x63, 0xCE, 0xF1, 0x55, 0x39, 0x1D, 0x1A, 0xE0, 0x64,
-	0x2F, 0x83, 0xA1, 0x78, 0xFC, 0xC2, 0xF3, 0xEB, 0x2F, 0xCA, 0xCF, 0x4B,
-	0xD8, 0xEC, 0xA0, 0xDF, 0x31, 0xDC, 0xDF, 0x06, 0x26, 0xF7, 0xCA, 0xEB,
-	0x65, 0xE3, 0x53, 0xCA, 0x33, 0x65, 0xD5, 0x86, 0x6E, 0x2A, 0xC8, 0xA2,
-	0x19, 0x2C, 0x5B, 0x09, 0xB8, 0x8E, 0x21, 0x1E, 0x2A, 0xE1, 0xC6, 0x10,
-	0xA5, 0x02, 0x5A, 0xC0, 0xB6, 0x12, 0x16, 0x0B, 0x78, 0xF9, 0x9B, 0xF0,
-	0xF8, 0x0D, 0x0E, 0x1E, 0xDA, 0x58, 0x12, 0x11, 0x9C, 0x0B, 0x6C, 0x73,
-	0xA8, 0xBC, 0xE2, 0x0B, 0xC5, 0x06, 0x98, 0x4E, 0x2D, 0x9F, 0xFA, 0x96,
-	0xD1, 0xD8, 0xF3, 0xD0, 0xF6, 0x9C, 0x62, 0xB8, 0x54, 0xE1, 0x4F, 0x63,
-	0xE1, 0xBA, 0xA5, 0x2C, 0x56, 0x8E, 0x97, 0xA5, 0x67, 0xB9, 0x09, 0x54,
-	0x47, 0xD8, 0xE7, 0x81, 0x87, 0xBC, 0x09, 0x98, 0xBC, 0xEB, 0xD4, 0xDC,
-	0x5F, 0x34, 0x82, 0xC4, 0xC3, 0x18, 0xFA, 0x97, 0x70, 0x31, 0x68, 0x28,
-	0x63, 0x61, 0xE7, 0xD9, 0x6C, 0x3C, 0xD5, 0x21, 0xD0, 0x77, 0xF0, 0xAE,
-	0x0B, 0x71, 0x47, 0x79, 0xAC, 0x84, 0xBD, 0x0A, 0x05, 0x81, 0x55, 0xA4,
-	0x58, 0x1F, 0xD1, 0x5D, 0xC1, 0xE3, 0x57, 0xCB, 0xCB, 0xAE, 0x59, 0xEA,
-	0x9C, 0x52, 0x90, 0x76, 0x93, 0xC8, 0x49, 0x62, 0x81, 0xAE, 0xE1, 0x78,
-	0xA3, 0xD4, 0xE3, 0x80, 0x3F, 0x59, 0x82, 0x06, 0x34, 0x0E, 0x08, 0x96,
-	0xF4, 0xDA, 0xD3, 0x0E, 0xCA, 0x7D, 0x1F, 0xC6, 0x75, 0x44, 0xF9, 0xEC,
-	0x58, 0xE5, 0xC2, 0x6A, 0x91, 0xF2, 0xF6, 0x54, 0xF1, 0x6D, 0xE9, 0x59,
-	0x8B, 0x41, 0xB2, 0x80, 0x76, 0x1A, 0xEF, 0x8E, 0xE6, 0x20, 0xA1, 0x39,
-	0x96, 0x0D, 0xCE, 0x86, 0xC9, 0x2A, 0x50, 0xAA, 0xE7, 0x97, 0x91, 0xF0,
-	0xCD, 0x6A, 0x33, 0x64, 0x1A, 0x18, 0x86, 0x88, 0xC2, 0x2A, 0x6A, 0x03,
-	0x16, 0xC3, 0xD4, 0x29, 0x67, 0x0D, 0xEC, 0xBC, 0xE1, 0x5C, 0x07, 0xEA,
-	0xA0, 0xB8, 0x20, 0x9C, 0x12, 0x65, 0xDD, 0x6B, 0x4C, 0xE0, 0x83, 0x61,
-	0xCD, 0xE8, 0xB3, 0xF0, 0xFB, 0x1F, 0x84, 0xE1, 0x27, 0x65, 0x16, 0x1A,
-	0xD9, 0xC5, 0xEA, 0xEF, 0xCA, 0xC7, 0x0D, 0x5C, 0x66, 0x09, 0x3A, 0x0E,
-	0xBC, 0xB6, 0x1C, 0xC7, 0xB3, 0xE1, 0xA7, 0x9D, 0x21, 0xAC, 0x6A, 0x72,
-	0x85, 0xE1, 0x14, 0x3E, 0x7F, 0x81, 0x2F, 0xD7, 0x42, 0xE8, 0x42, 0x1C,
-	0xD5, 0x44, 0x18, 0x0E, 0x53, 0xE5, 0xAD, 0x17, 0xC8, 0xC6, 0x82, 0x79,
-	0x52, 0x26, 0x1B, 0x48, 0x0A, 0x8B, 0xCD, 0x22, 0xDA, 0xBD, 0x8A, 0xA8,
-	0x5B, 0x13, 0x75, 0xCE, 0xF0, 0x7A, 0xAE, 0xD9, 0xBC, 0x59, 0xBE, 0xFE,
-	0x12, 0xF8, 0xFA, 0x0F, 0x65, 0xBB, 0x83, 0x2C, 0xFD, 0x2D, 0xE8, 0x60,
-	0x2D, 0x5B, 0x11, 0x5C, 0x16, 0x28, 0x3B, 0xDA, 0xF4, 0xDF, 0x06, 0x11,
-	0xB7, 0x99, 0xF0, 0xCE, 0x07, 0x46, 0xB5, 0xF2, 0xEA, 0x85, 0x98, 0x06,
-	0x08, 0xD9, 0xDD, 0x08, 0xC5, 0x6B, 0xCD, 0x3F, 0x16, 0xCA, 0xEC, 0x08,
-	0x99, 0x35, 0x5C, 0x75, 0x02, 0x12, 0x81, 0xEB, 0x0A, 0x26, 0x53, 0x6E,
-	0x46, 0xC2, 0xA0, 0x9B, 0xB2, 0x9A, 0x7A, 0x92, 0x77, 0x8E, 0xCE, 0x85,
-	0xD2, 0xB6, 0x81, 0x70, 0x10, 0x34, 0xB2, 0x90, 0x79, 0xA4, 0x10, 0xA2,
-	0x43, 0x82, 0xE6, 0x8E, 0xF8, 0xD9, 0xD3, 0xFD, 0x25, 0x22, 0xD7, 0x9A,
-	0x43, 0xA4, 0x2C, 0x15, 0xB6, 0x2F, 0x9E, 0xEC, 0x6F, 0xCA, 0x7A, 0x09,
-	0x65, 0x80, 0xDE, 0x40, 0x18, 0xDF, 0xC0, 0xE4, 0xC2, 0x92, 0x5A, 0xC8,
-	0x4A, 0x4F, 0x75, 0x0A, 0xD8, 0xC4, 0x52, 0xDF, 0x08, 0x45, 0x04, 0x52,
-	0x45, 0x64, 0x45, 0x8D, 0x3D, 0x07, 0x4E, 0x1D, 0x25, 0x4E, 0x84, 0xB1,
-	0x24, 0x44, 0x07, 0xCF, 0x79, 0x16, 0x78, 0x9B, 0x0B, 0xDB, 0x37, 0xC7,
-	0xF6, 0xAD, 0xA1, 0x9B, 0xC5, 0x1D, 0xA5, 0x75, 0x25, 0x74, 0xDE, 0x29,
-	0x9D, 0x5B, 0x43, 0xCB, 0x18, 0x8E, 0xA5, 0xA3, 0xDA, 0x18, 0x92, 0x83,
-	0xE7, 0x72, 0x03, 0x55, 0x0F, 0xBE, 0x5D, 0x05, 0x0E, 0xAE, 0x29, 0xC5,
-	0xB6, 0x7A, 0x42, 0x7B, 0x08, 0xC5, 0xE0, 0x37, 0x21, 0x64, 0x2C, 0xB4,
-	0xBA, 0x4A, 0x66, 0x84, 0xF2, 0x20, 0x1C, 0x97, 0x9E, 0xCE, 0x52, 0x18,
-	0x5A, 0x48, 0x07, 0x90, 0xFF, 0x60, 0xE9, 0x74, 0x95, 0x1F, 0x2E, 0x2C,
-	0xBF, 0x1B, 0x43, 0xBF, 0xA5, 0xBC, 0xCE, 0x15, 0xF7, 0x00, 0xFB, 0x57,
-	0x25, 0x2B, 0x9A, 0x1D, 0xFE, 0xE5, 0xB0, 0x01, 0x79, 0x6E, 0x0B, 0x61,
-	0x7B, 0xF0, 0xB4, 0x9D, 0x62, 0x26, 0xC2, 0xA0, 0x17, 0x71, 0x37, 0x0D,
-	0x7C, 0x7F, 0xA7, 0x5C, 0x67, 0x2D, 0x36, 0x85, 0x47, 0x73, 0x8F, 0x0C,
-	0x3C, 0xA6, 0x0B, 0xC7, 0xB6, 0xE5, 0x59, 0x03, 0xE9, 0x42, 0x48, 0xCF,
-	0x4A, 0xBE, 0x51, 0x7A, 0xB6, 0xE2, 0xAE, 0xAD, 0xA4, 0x39, 0x44, 0xE9,
-	0x0E, 0xFE, 0xBA, 0x14, 0xE6, 0x7F, 0x57, 0x36, 0x0B, 0x25, 0x04, 0x18,
-	0x0F, 0x0D, 0xF7, 0x19, 0x7C, 0x3F, 0x85, 0x28, 0xF3, 0xF4, 0xA2, 0x26,
-	0xE5, 0x5A, 0x5F, 0xC3, 0xF9, 0xAA, 0x09, 0x4D, 0xEA, 0xB1, 0x62, 0xF7,
-	0x68, 0x89, 0x66, 0xD0, 0x5A, 0x2A, 0x3D, 0x05, 0x89, 0x95, 0xA7, 0x73,
-	0xD3, 0x4E, 0x7D, 0x29, 0x2D, 0xD1, 0xC0, 0xF3, 0xFD, 0x67, 0xB8, 0x7E,
-	0x9F, 0xB0, 0x19, 0x57, 0x7C, 0x4B, 0x95, 0x96, 0x87, 0xCB, 0x93, 0x92,
-	0x06, 0x4F, 0x94, 0x68, 0x43, 0xDB, 0x52, 0xC3, 0xFC, 0x6C, 0x30, 0xC7,
-	0xC0, 0xA8, 0xF4, 0x24, 0x11, 0xE0, 0x62, 0x16, 0x73, 0xC8, 0x9F, 0x14,
-	0x96, 0x8D, 0x50, 0x82, 0xBA, 0xC1, 0xB6, 0xA7, 0x09, 0xEC, 0x08, 0xAC,
-	0x0E, 0x06, 0xE3, 0x02, 0xFD, 0xAE, 0xE5, 0xEA, 0x4B, 0xE0, 0xCB, 0x7F,
-	0x85, 0xCE, 0x85, 0xB0, 0x5D, 0x46, 0xCC, 0xBE, 0x2A, 0xAD, 0x75, 0xE0,
-	0xC2, 0x2B, 0x61, 0x64, 0x99, 0x8F, 0x1C, 0xF9, 0x39, 0x50, 0x1C, 0x95,
-	0xE2, 0xE8, 0x51, 0x07, 0xB6, 0x05, 0x21, 0x73, 0xE4, 0x75, 0xE0, 0xB4,
-	0x15, 0xF6, 0x5B, 0xE5, 0x54, 0xD6, 0xA8, 0x69, 0x9E, 0x8D, 0xE9, 0x59,
-	0xE9, 0x2C, 0xE1, 0xFD, 0x10, 0x3E, 0x38, 0x43, 0xDD, 0x8F, 0xC9, 0x13,
-	0xCF, 0xCE, 0x43, 0x12, 0x84, 0xBB, 0x59, 0x20, 0x3E, 0x19, 0xAE, 0x76,
-	0x50, 0x77, 0x9B, 0xAC, 0x5F, 0xE7, 0xA3, 0x52, 0x4F, 0x14, 0xD7, 0x55,
-	0x5C, 0xDC, 0xD4, 0xCB, 0x35, 0x53, 0x0E, 0x3E, 0x62, 0x3E, 0xF3, 0x2C,
-	0x77, 0xCD, 0x8C, 0xF2, 0x41, 0xC0, 0x5D, 0x41, 0xF6, 0x11, 0xCC, 0xB5,
-	0xF0, 0xBB, 0x96, 0x21, 0xDD, 0xC2, 0xAF, 0x7F, 0x0F, 0xFC, 0xE5, 0x67,
-	0xCF, 0x72, 0x26, 0x74, 0xC6, 0x81, 0x9B, 0x3F, 0x29, 0xED, 0x2F, 0x90,
-	0xFB, 0x92, 0xB7, 0x6F, 0x86, 0x6D, 0xD1, 0xBC, 0x80, 0x46, 0xFD, 0x40,
-	0x77, 0xD0, 0x18, 0x5B, 0x5A, 0x75, 0xA0, 0xFD, 0xB3, 0xC1, 0x14, 0x1E,
-	0x57, 0xD6, 0xB4, 0x13, 0xB8, 0xFA, 0x04, 0xE7, 0x5E, 0xC4, 0x52, 0x23,
-	0xCE, 0xEB, 0x92, 0xFE, 0x37, 0x18, 0x3C, 0x35, 0x3A, 0xDA, 0xFE, 0x00,
-	0xBE, 0x2B, 0x0D, 0xE3, 0xC2, 0x10, 0xBD, 0x6E, 0x0C, 0x7F, 0x7B, 0x72,
-	0x94, 0x39, 0x5C, 0x5C, 0x2A, 0x83, 0xBE, 0x25, 0xB4, 0x63, 0x2E, 0x5B,
-	0x25, 0xE3, 0xC4, 0x22, 0xED, 0x18, 0x49, 0x1C, 0x9D, 0xA4, 0x49, 0x9B,
-	0xEE, 0x08, 0x3C, 0xEC, 0x2A, 0xFE, 0xF1, 0x68, 0xA8, 0x1E, 0x94, 0xFB,
-	0xB5, 0x92, 0x94, 0x30, 0x34, 0xC2, 0x6E, 0x67, 0x98, 0x1F, 0x3C, 0x28,
-	0xC4, 0x37, 0x9E, 0xDF, 0x7F, 0x32, 0x7C, 0xFC, 0x0E, 0x5A, 0x97, 0x9E,
-	0x9F, 0x7B, 0x11, 0xEB, 0xB6, 0x62, 0x1C, 0xE4, 0x6F, 0x81, 0xE3, 0x4B,
-	0x8D, 0x7F, 0x32, 0xDC, 0x2E, 0x84, 0x32, 0x13, 0x9E, 0x6B, 0xC5, 0x05,
-	0x8F, 0x0A, 0x44, 0x18, 0x16, 0x8F, 0x9E, 0x97, 0x9F, 0x3D, 0xD1, 0x0B,
-	0x74, 0x77, 0x42, 0x75, 0x52, 0xCA, 0x93, 0xD0, 0x4B, 0x95, 0xD1, 0x2D,
-	0xFC, 0xFA, 0x5E, 0x98, 0x8F, 0x95, 0xEE, 0xC1, 0x70, 0x93, 0x2A, 0xBF,
-	0xBF, 0x34, 0xDC, 0xB5, 0x02, 0xB9, 0x71, 0xFC, 0x23, 0x0D, 0xAC, 0x5A,
-	0xF0, 0x27, 0x2B, 0xFC, 0x21, 0x6A, 0xDA, 0xC8, 0xF3, 0xBD, 0xB0, 0xD9,
-	0x35, 0xA6, 0x90, 0xBA, 0x52, 0xAC, 0x6B, 0xB0, 0xAA, 0x71, 0xA4, 0x68,
-	0x1D, 0x21, 0xEA, 0xE8, 0xF5, 0x22, 0xA4, 0x1B, 0x28, 0x2E, 0x03, 0xD1,
-	0x52, 0x89, 0x96, 0x86, 0x56, 0x1D, 0xB8, 0x5D, 0xC1, 0x8D, 0xF5, 0xEC,
-	0xBA, 0x82, 0x6D, 0x19, 0xAA, 0x54, 0x78, 0x9E, 0x0A, 0xED, 0x38, 0x70,
-	0x7D, 0x54, 0x7A, 0x22, 0x7C, 0x99, 0x18, 0xB8, 0x10, 0x42, 0x1B, 0xDE,
-	0x4C, 0xC0, 0xD7, 0xBF, 0x25, 0xA3, 0xF9, 0xED, 0x67, 0xEE, 0xC0, 0xE9,
-	0x5A, 0x38, 0x5A, 0x45, 0xAD, 0x61, 0xB0, 0x10, 0x92, 0x4A, 0xC9, 0xCF,
-	0x9E, 0xE3, 0xBC, 0xA1, 0x96, 0xFE, 0x3A, 0x53, 0xFE, 0xFA, 0x1A, 0x78,
-	0x58, 0x43, 0x62, 0x95, 0xEF, 0xC6, 0x86, 0x3F, 0x7C, 0x12, 0x3A, 0x1F,
-	0x13, 0x9E, 0x0A, 0xCF, 0xAF, 0x79, 0x4D, 0x14, 0x94, 0x8B, 0x38, 0x62,
-	0xD4, 0x03, 0x4F, 0x60, 0x79, 0xAC, 0xD9, 0xAC, 0x41, 0x9E, 0x94, 0x30,
-	0x73, 0xF4, 0x4E, 0xCA, 0x77, 0x03, 0x58, 0x7B, 0xE1, 0x88, 0xE5, 0x39,
-	0x72, 0xAC, 0x56, 0xCA, 0x28, 0x82, 0xCB, 0x71, 0x03, 0xEA, 0xB8, 0xBE,
-	0xB4, 0x4C, 0xAE, 0x0C, 0x79, 0x2D, 0x44, 0x3F, 0xCD, 0x03, 0xF3, 0x60,
-	0xC8, 0xDE, 0x07, 0xAE, 0xBA, 0x70, 0xDD, 0x0B, 0x9C, 0x7B, 0x15, 0x91,
-	0x6D, 0x30, 0xAF, 0x95, 0xF7, 0xAC, 0x42, 0x40, 0x0E, 0x86, 0xE4, 0x45,
-	0xA9, 0x0F, 0x4A, 0x59, 0x08, 0xC7, 0xC2, 0x33, 0x0B, 0x4D, 0x84, 0xE9,
-	0x26, 0x8D, 0xE8, 0x1D, 0x3C, 0xC7, 0x17, 0x4F, 0x64, 0x85, 0xD1, 0xB5,
-	0xA2, 0x7F, 0x36, 0xB4, 0xEF, 0x2C, 0x31, 0x35, 0xD1, 0x93, 0xD0, 0x57,
-	0xCB, 0xD5, 0x48, 0x48, 0x87, 0x09, 0x2F, 0x75, 0xD5, 0x2C, 0x2A, 0xBE,
-	0x06, 0xD2, 0xAD, 0x70, 0x46, 0xD9, 0x87, 0xC6, 0xD2, 0x51, 0x0E, 0x52,
-	0xD6, 0x85, 0xE7, 0xFF, 0x3E, 0x39, 0x5E, 0x5E, 0x60, 0x7A, 0x82, 0x0B,
-	0x0F, 0xB1, 0xF3, 0x18, 0xE0, 0xA2, 0x0D, 0x17, 0x53, 0x43, 0xF4, 0x2E,
-	0x50, 0x5E, 0x41, 0x5C, 0xC2, 0xFD, 0x41, 0xF9, 0x23, 0x11, 0xDD, 0x97,
-	0x16, 0xFF, 0xD8, 0x56, 0x3C, 0xDA, 0x40, 0xDD, 0x57, 0xE2, 0x2C, 0x22,
-	0xB3, 0x81, 0xBA, 0xF0, 0x9C, 0x57, 0x4A, 0x7E, 0x86, 0x56, 0xDB, 0x70,
-	0x79, 0xAF, 0xB8, 0x6E, 0x4C, 0x74, 0x08, 0x9C, 0xFF, 0x22, 0x6C, 0xDE,
-	0x3C, 0xE3, 0x58, 0x19, 0x8E, 0x03, 0x6F, 0x97, 0x09, 0xBF, 0x76, 0x3D,
-	0x9B, 0xBC, 0x66, 0xF4, 0x20, 0x44, 0xCF, 0x29, 0xDD, 0x53, 0x45, 0xFA,
-	0x77, 0x25, 0x36, 0x35, 0xDD, 0x0E, 0x70, 0x6B, 0x71, 0x77, 0xCA, 0xE9,
-	0x52, 0x70, 0xEF, 0x94, 0x41, 0x07, 0xB2, 0xC4, 0x70, 0xB4, 0x29, 0x9B,
-	0x7D, 0xC9, 0xF6, 0x59, 0xA9, 0xB7, 0xCD, 0x8A, 0x77, 0xF8, 0x5B, 0xF3,
-	0xE9, 0xFA, 0x8B, 0x67, 0x74, 0x6F, 0x99, 0xDF, 0x2A, 0xDB, 0xA0, 0x2C,
-	0x0B, 0x65, 0xB0, 0x06, 0x39, 0x19, 0x34, 0x52, 0xAA, 0x43, 0x60, 0x16,
-	0x9A, 0x75, 0xB2, 0xDE, 0x18, 0x3A, 0x6D, 0xE5, 0xAE, 0x2B, 0xDC, 0xEF,
-	0x84, 0xF4, 0xA1, 0x62, 0x2D, 0x8A, 0x53, 0xA5, 0xDB, 0x85, 0x54, 0x3C,
-	0xFB, 0x22, 0x62, 0x93, 0x37, 0xB5, 0xF4, 0x96, 0x17, 0x6C, 0x27, 0x10,
-	0xB7, 0xE1, 0x0F, 0x3B, 0xB8, 0x59, 0xC2, 0xC7, 0x18, 0x5E, 0xEB, 0x9A,
-	0xD5, 0x05, 0x2C, 0x47, 0x86, 0xEC, 0xBF, 0x05, 0x22, 0x69, 0x4E, 0xE5,
-	0x83, 0x2A, 0x70, 0x74, 0x81, 0xCD, 0xDA, 0xF2, 0xFF, 0x01, 0x94, 0x61,
-	0x40, 0xB9, 0xE2, 0x18, 0xC9, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
-	0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
+const uint32_t DuDv_128x128_pixels[21845] = {
+	0xFF3E6702, 0xFF1F7401, 0xFF367C02, 0xFF767F06, 0xFF968E04, 0xFF8EA300, 0xFF7BB100, 0xFF79A905,
+	0xFF6B9004, 0xFF607403, 0xFF636704, 0xFF6C6002, 0xFF636000, 0xFF516402, 0xFF4C7305, 0xFF5E8800,
+	0xFF729C06, 0xFF7BA305, 0xFF6C8202, 0xFF5C5A00, 0xFF764500, 0xFF9B6507, 0xFFA19402, 0xFF82AB00,
+	0xFF7A9901, 0xFF837201, 0xFF8E5E04, 0xFF8F7100, 0xFF8B8A00, 0xFF7A8601, 0xFF626B00, 0xFF534D05,
+	0xFF5C3702, 0xFF602D00, 0xFF5B3701, 0xFF714E03, 0xFF855B06, 0xFF654C05, 0xFF2C3400, 0xFF202705,
+	0xFF342507, 0xFF462600, 0xFF442800, 0xFF523200, 0xFF8B4409, 0xFFA75B04, 0xFF8A7200, 0xFF4D8900,
+	0xFF3C9605, 0xFF659703, 0xFFA38804, 0xFFB07D03, 0xFF897700, 0xFF5A7400, 0xFF567E04, 0xFF8B8D04,
+	0xFFBC8600, 0xFFAB6E01, 0xFF706103, 0xFF5E7500, 0xFF7C9C01, 0xFF96B700, 0xFF81BD05, 0xFF8A890D,
+	0xFF823E03, 0xFF6D3200, 0xFF913302, 0xFFA04104, 0xFF7F6205, 0xFF4C8900, 0xFF319501, 0xFF3F7905,
+	0xFF5E5600, 0xFF883D00, 0xFF9C2900, 0xFF8C1B03, 0xFF721E01, 0xFF6A3000, 0xFF6F5500, 0xFF848102,
+	0xFF919B07, 0xFF87AA03, 0xFF74A401, 0xFF5F8C01, 0xFF4B6E01, 0xFF445302, 0xFF553F04, 0xFF933201,
+	0xFFD43400, 0xFFE04800, 0xFFB57201, 0xFF798A0A, 0xFF3A8906, 0xFF386D00, 0xFF5D4F01, 0xFF754108,
+	0xFF6C4305, 0xFF6D4A00, 0xFF824F01, 0xFF895703, 0xFF6F6702, 0xFF567308, 0xFF4F6B03, 0xFF725C03,
+	0xFFA15B03, 0xFFA86803, 0xFF7A7402, 0xFF557B01, 0xFF527F04, 0xFF647F01, 0xFF558200, 0xFF418400,
+	0xFF418600, 0xFF418B02, 0xFF508802, 0xFF6F7501, 0xFF975800, 0xFFBA3E00, 0xFFA74000, 0xFF6C5900,
+	0xFF437A01, 0xFF2AAB04, 0xFF26D103, 0xFF55D600, 0xFF9BC200, 0xFFC79E03, 0xFFBB7800, 0xFF795E00,
+	0xFF384500, 0xFF205C01, 0xFF3C6C00, 0xFF7D7401, 0xFFAE8702, 0xFFAD9C02, 0xFF86A505, 0xFF5C9702,
+	0xFF417500, 0xFF435F00, 0xFF5A5F00, 0xFF746C01, 0xFF767B01, 0xFF708D02, 0xFF6FA001, 0xFF6FA301,
+	0xFF6B9F01, 0xFF5C9303, 0xFF427803, 0xFF3D5C01, 0xFF6F4A01, 0xFFAA5809, 0xFFAE7904, 0xFF7C8901,
+	0xFF5A7301, 0xFF625100, 0xFF904100, 0xFFB44D00, 0xFFAD5407, 0xFF765206, 0xFF494800, 0xFF454400,
+	0xFF604000, 0xFF6C3800, 0xFF6E3A00, 0xFF794800, 0xFF784A02, 0xFF503700, 0xFF1E2500, 0xFF141D03,
+	0xFF1C1E00, 0xFF302700, 0xFF3B4200, 0xFF566802, 0xFF857D07, 0xFFA26A05, 0xFF8B5800, 0xFF4F6900,
+	0xFF4A9100, 0xFF6CB104, 0xFF9AAD02, 0xFF9A9800, 0xFF768002, 0xFF597000, 0xFF657201, 0xFF988002,
+	0xFFAD8001, 0xFF956800, 0xFF6F6202, 0xFF6C8002, 0xFF91A404, 0xFF95A503, 0xFF7F8102, 0xFF854400,
+	0xFF903100, 0xFF7D4302, 0xFF863801, 0xFF903A00, 0xFF845400, 0xFF5C7E01, 0xFF329301, 0xFF288303,
+	0xFF476801, 0xFF705101, 0xFF773E05, 0xFF682C03, 0xFF772700, 0xFF953400, 0xFFA35C03, 0xFFB18900,
+	0xFFA5A102, 0xFF6FA003, 0xFF448703, 0xFF2C6D00, 0xFF1A5F00, 0xFF205602, 0xFF4D5300, 0xFF944600,
+	0xFFDB3B03, 0xFFEC4E05, 0xFFC27002, 0xFF797101, 0xFF375900, 0xFF284601, 0xFF424200, 0xFF585200,
+	0xFF636200, 0xFF7E6501, 0xFF9D6103, 0xFFA06304, 0xFF806802, 0xFF586205, 0xFF474F02, 0xFF643900,
+	0xFF9A3000, 0xFFB22E00, 0xFF8C3600, 0xFF5B4F00, 0xFF527000, 0xFF598600, 0xFF4C9103, 0xFF3D9103,
+	0xFF408701, 0xFF458802, 0xFF408801, 0xFF508A01, 0xFF7D8300, 0xFFAA7100, 0xFFBA6002, 0xFFA16A02,
+	0xFF829302, 0xFF63C102, 0xFF43DF05, 0xFF48E200, 0xFF7DC002, 0xFFA18704, 0xFF9A4E01, 0xFF603802,
+	0xFF383D00, 0xFF385700, 0xFF506900, 0xFF867601, 0xFFC08102, 0xFFC08103, 0xFF887A03, 0xFF486C00,
+	0xFF346202, 0xFF4D6600, 0xFF737801, 0xFF888F05, 0xFF8B9D04, 0xFF83A903, 0xFF79AB00, 0xFF659103,
+	0xFF486D05, 0xFF2E5702, 0xFF1F5500, 0xFF2B5802, 0xFF5B5801, 0xFF9E5600, 0xFFB45802, 0xFF7D5A04,
+	0xFF494F00, 0xFF544900, 0xFF8F5403, 0xFFBB5905, 0xFFAC4207, 0xFF703003, 0xFF483900, 0xFF505801,
+	0xFF6B7304, 0xFF746B06, 0xFF745F01, 0xFF735900, 0xFF654E00, 0xFF3A4400, 0xFF1B3200, 0xFF132A00,
+	0xFF162900, 0xFF333400, 0xFF546302, 0xFF669202, 0xFF769100, 0xFF836100, 0xFF7A3C00, 0xFF604C00,
+	0xFF6A8400, 0xFF8DAD05, 0xFFA3B804, 0xFF8DAB05, 0xFF6A8401, 0xFF5C6E00, 0xFF707400, 0xFF9C8503,
+	0xFFA28907, 0xFF7F7602, 0xFF666500, 0xFF717001, 0xFF877809, 0xFF7F6F05, 0xFF645400, 0xFF703500,
+	0xFF893501, 0xFF774D03, 0xFF745101, 0xFF835500, 0xFF8E5F01, 0xFF767602, 0xFF448500, 0xFF2B7C00,
+	0xFF416A00, 0xFF5E6004, 0xFF625605, 0xFF585302, 0xFF745D03, 0xFFAA6C06, 0xFFCE7605, 0xFFC98400,
+	0xFF9A8200, 0xFF547202, 0xFF1F6203, 0xFF0F5D00, 0xFF136200, 0xFF1D7100, 0xFF437F02, 0xFF857500,
+	0xFFC96A03, 0xFFE27008, 0xFFB87703, 0xFF6B6401, 0xFF334800, 0xFF2E4001, 0xFF465504, 0xFF5C6A01,
+	0xFF697801, 0xFF847304, 0xFFA55F03, 0xFF9E4E01, 0xFF6F4300, 0xFF3C3E00, 0xFF303D02, 0xFF613900,
+	0xFFAB2D01, 0xFFC81F01, 0xFFA32500, 0xFF6F4701, 0xFF687401, 0xFF6C8E04, 0xFF579507, 0xFF3B8706,
+	0xFF356701, 0xFF485500, 0xFF4D5F00, 0xFF527E00, 0xFF739402, 0xFF9A9701, 0xFFC28902, 0xFFD68306,
+	0xFFBA9708, 0xFF83AE06, 0xFF44B700, 0xFF2AB200, 0xFF509902, 0xFF7E6A05, 0xFF7D3D02, 0xFF4F3201,
+	0xFF386802, 0xFF4F7000, 0xFF657903, 0xFF8B7B02, 0xFFBC6F02, 0xFFB56100, 0xFF7F5A00, 0xFF4D5B02,
+	0xFF436C01, 0xFF657D02, 0xFF838707, 0xFF878B02, 0xFF888D04, 0xFF7D8F04, 0xFF668000, 0xFF485E00,
+	0xFF293800, 0xFF1A2600, 0xFF203102, 0xFF2E5700, 0xFF537300, 0xFF937300, 0xFFAA6601, 0xFF7E5000,
+	0xFF4A4700, 0xFF544E00, 0xFF8D6207, 0xFFA95F05, 0xFF8C4200, 0xFF582A00, 0xFF4D3800, 0xFF656503,
+	0xFF768B03, 0xFF709505, 0xFF728C02, 0xFF728200, 0xFF587800, 0xFF2F7201, 0xFF1E6203, 0xFF1A5800,
+	0xFF335501, 0xFF606A05, 0xFF788A02, 0xFF719D05, 0xFF5F8402, 0xFF625802, 0xFF704400, 0xFF7E5402,
+	0xFF8F7301, 0xFFA58B01, 0xFFAB9504, 0xFF8D8B06, 0xFF667D01, 0xFF637501, 0xFF807C03, 0xFF918B05,
+	0xFF7F8606, 0xFF597104, 0xFF525D00, 0xFF6F5400, 0xFF7D5100, 0xFF774A00, 0xFF624901, 0xFF6A5300,
+	0xFF7E5400, 0xFF725800, 0xFF6A6A00, 0xFF7B7D03, 0xFF8C8503, 0xFF7E8200, 0xFF567F00, 0xFF3C7700,
+	0xFF496E00, 0xFF676900, 0xFF676D00, 0xFF588500, 0xFF799802, 0xFFA79C02, 0xFFCD8C02, 0xFFC56C01,
+	0xFF854E00, 0xFF433E01, 0xFF1A3F01, 0xFF124C01, 0xFF1C6402, 0xFF338105, 0xFF559502, 0xFF819E02,
+	0xFFB49A02, 0xFFC68C00, 0xFFA07702, 0xFF545E01, 0xFF2D5401, 0xFF3B6100, 0xFF586E03, 0xFF646E03,
+	0xFF676500, 0xFF7A5E00, 0xFF955200, 0xFF884400, 0xFF4F4000, 0xFF264A00, 0xFF2E5E00, 0xFF6B6B01,
+	0xFFB05E01, 0xFFCA4A00, 0xFFB94C00, 0xFF956400, 0xFF867D05, 0xFF7C8308, 0xFF587505, 0xFF315D01,
+	0xFF2A4300, 0xFF4C3901, 0xFF6C4E00, 0xFF6F6F02, 0xFF6D8106, 0xFF8E8503, 0xFFC57E01, 0xFFE37C02,
+	0xFFC67C03, 0xFF7C7207, 0xFF3A6305, 0xFF256100, 0xFF486102, 0xFF736001, 0xFF6E5A00, 0xFF495C00,
+	0xFF418E04, 0xFF4B8703, 0xFF627C04, 0xFF7F7601, 0xFFA56900, 0xFFAF6200, 0xFF8B6B00, 0xFF667B09,
+	0xFF5A8608, 0xFF688300, 0xFF737301, 0xFF756400, 0xFF756100, 0xFF6E5902, 0xFF544803, 0xFF2E2F00,
+	0xFF1A1E00, 0xFF1D1E00, 0xFF313700, 0xFF4E6700, 0xFF709201, 0xFF929C05, 0xFF908B05, 0xFF676706,
+	0xFF444F00, 0xFF565001, 0xFF865101, 0xFF944D00, 0xFF724300, 0xFF4B3B00, 0xFF524701, 0xFF6F6300,
+	0xFF7C7900, 0xFF728F00, 0xFF759F02, 0xFF72AA00, 0xFF52A900, 0xFF2CA603, 0xFF24A003, 0xFF399301,
+	0xFF659103, 0xFF869F02, 0xFF88A101, 0xFF659202, 0xFF497600, 0xFF576703, 0xFF7A6901, 0xFF926F04,
+	0xFF986F01, 0xFFA16800, 0xFFA56201, 0xFF8B5A05, 0xFF696502, 0xFF6B7300, 0xFF7F7303, 0xFF7B7102,
+	0xFF5A6400, 0xFF405D03, 0xFF4D5901, 0xFF745700, 0xFF875600, 0xFF7F5702, 0xFF676402, 0xFF677901,
+	0xFF717201, 0xFF736100, 0xFF7A7101, 0xFF859004, 0xFF8A9800, 0xFF7A8E00, 0xFF5D8604, 0xFF498404,
+	0xFF4C8203, 0xFF668200, 0xFF718C01, 0xFF689E05, 0xFF71A501, 0xFF979700, 0xFFB87A02, 0xFFAF4F02,
+	0xFF722A00, 0xFF3C1F00, 0xFF1E2802, 0xFF1B3F01, 0xFF2D5A03, 0xFF577903, 0xFF749B02, 0xFF90B307,
+	0xFFA9B106, 0xFFA28F01, 0xFF7B6100, 0xFF524700, 0xFF455603, 0xFF497505, 0xFF5A7503, 0xFF5C6400,
+	0xFF5D5800, 0xFF7B5C00, 0xFF996301, 0xFF7F6800, 0xFF3C7401, 0xFF1D8600, 0xFF369B04, 0xFF69A304,
+	0xFF999501, 0xFFC48103, 0xFFC98003, 0xFFAC8701, 0xFF888001, 0xFF696C03, 0xFF475602, 0xFF2F5100,
+	0xFF345300, 0xFF5C5901, 0xFF846302, 0xFF836C01, 0xFF636801, 0xFF785503, 0xFFB35100, 0xFFCF5A00,
+	0xFFAB5201, 0xFF603900, 0xFF362A05, 0xFF363A00, 0xFF695102, 0xFF916601, 0xFF7E7C00, 0xFF5A8B04,
+	0xFF4D7F02, 0xFF3E7D00, 0xFF537A00, 0xFF767900, 0xFF9B7602, 0xFFB27C06, 0xFFA08F02, 0xFF789704,
+	0xFF5B8A02, 0xFF586F01, 0xFF605C00, 0xFF6A4F00, 0xFF6D4200, 0xFF623500, 0xFF4A2902, 0xFF342400,
+	0xFF282C00, 0xFF303901, 0xFF515602, 0xFF7A7C01, 0xFF909C07, 0xFF85A108, 0xFF6A8A03, 0xFF426C03,
+	0xFF2E5900, 0xFF554E00, 0xFF8A4800, 0xFF984D01, 0xFF765A00, 0xFF5B6604, 0xFF5D7000, 0xFF686E00,
+	0xFF766501, 0xFF806D00, 0xFF888A01, 0xFF7BB202, 0xFF58C102, 0xFF2FC105, 0xFF2CBC00, 0xFF58AC00,
+	0xFF87A203, 0xFF949F00, 0xFF758F01, 0xFF487701, 0xFF3D7602, 0xFF5D8701, 0xFF889304, 0xFF948807,
+	0xFF847102, 0xFF825600, 0xFF8D4201, 0xFF7F3E05, 0xFF6D4901, 0xFF705E01, 0xFF7A5F02, 0xFF6B5200,
+	0xFF4C4E00, 0xFF445F00, 0xFF5C7602, 0xFF878004, 0xFF937900, 0xFF806F03, 0xFF637303, 0xFF607E01,
+	0xFF697803, 0xFF756B03, 0xFF947408, 0xFF978802, 0xFF878B00, 0xFF718402, 0xFF5B8504, 0xFF4E8B04,
+	0xFF469303, 0xFF4E9D02, 0xFF66A107, 0xFF6C9607, 0xFF6C7F02, 0xFF866800, 0xFF9E5400, 0xFF9C3C00,
+	0xFF6E2B00, 0xFF482A03, 0xFF353401, 0xFF364600, 0xFF505800, 0xFF766F00, 0xFF938F03, 0xFFABA107,
+	0xFF9B9B05, 0xFF6E7D01, 0xFF5B5800, 0xFF674900, 0xFF695A03, 0xFF5B6E03, 0xFF4F6B00, 0xFF526100,
+	0xFF6A6702, 0xFF977905, 0xFFA69203, 0xFF86A501, 0xFF44BC02, 0xFF21CC05, 0xFF2BCE0B, 0xFF4BC003,
+	0xFF7AA800, 0xFFA99504, 0xFFBC9007, 0xFFA88A03, 0xFF737F00, 0xFF4E6F00, 0xFF3F6700, 0xFF347000,
+	0xFF427A03, 0xFF657E04, 0xFF817B06, 0xFF777102, 0xFF5C5E00, 0xFF694201, 0xFF9F3501, 0xFFB73C01,
+	0xFF863E00, 0xFF4A3800, 0xFF403800, 0xFF624900, 0xFF955D00, 0xFFB56A00, 0xFF9F7A04, 0xFF718304,
+	0xFF5C5B00, 0xFF496F00, 0xFF548401, 0xFF6F8901, 0xFF907E00, 0xFFB27E04, 0xFFA18803, 0xFF727B00,
+	0xFF4D6300, 0xFF525502, 0xFF615801, 0xFF6D5200, 0xFF673F03, 0xFF513B00, 0xFF3D4200, 0xFF404A00,
+	0xFF445200, 0xFF525F07, 0xFF736D0B, 0xFF947B05, 0xFF938102, 0xFF6F7403, 0xFF476102, 0xFF2B5A00,
+	0xFF245F00, 0xFF546200, 0xFF936701, 0xFFB27301, 0xFF9E8600, 0xFF809207, 0xFF639507, 0xFF528306,
+	0xFF5F6A01, 0xFF7C5B00, 0xFFA06905, 0xFF9F8E09, 0xFF71A505, 0xFF3AAF01, 0xFF35A201, 0xFF5E9000,
+	0xFF8E7F00, 0xFF8E6B02, 0xFF5A6003, 0xFF405B02, 0xFF4C6F02, 0xFF749700, 0xFF90A701, 0xFF869703,
+	0xFF6D7C01, 0xFF675900, 0xFF6F3D00, 0xFF6A3800, 0xFF694300, 0xFF735600, 0xFF7D5E01, 0xFF685E01,
+	0xFF4E6402, 0xFF537E01, 0xFF759803, 0xFF8B9905, 0xFF828B02, 0xFF6C7400, 0xFF656900, 0xFF6B7200,
+	0xFF738100, 0xFF818705, 0xFFA48607, 0xFFA07F02, 0xFF7A7401, 0xFF606701, 0xFF596700, 0xFF526F00,
+	0xFF447D01, 0xFF459002, 0xFF539107, 0xFF5D7901, 0xFF666000, 0xFF7F4E00, 0xFFA34201, 0xFF9D4700,
+	0xFF755100, 0xFF605402, 0xFF575A01, 0xFF5B5C03, 0xFF686203, 0xFF766F00, 0xFF8F7A00, 0xFFA27B01,
+	0xFF807300, 0xFF506C00, 0xFF516E01, 0xFF6A7901, 0xFF767B04, 0xFF617103, 0xFF436F00, 0xFF497703,
+	0xFF7A8200, 0xFFB38F01, 0xFFBEA304, 0xFF98BA01, 0xFF5CDA01, 0xFF2CE407, 0xFF21CD08, 0xFF29AE01,
+	0xFF529200, 0xFF8A7E00, 0xFFAE6E03, 0xFFA96603, 0xFF776B00, 0xFF4F7900, 0xFF478300, 0xFF3E8601,
+	0xFF428104, 0xFF587D01, 0xFF6E8003, 0xFF6A7F04, 0xFF567601, 0xFF5F6400, 0xFF9F4D03, 0xFFAE4901,
+	0xFF7C4F00, 0xFF565A01, 0xFF546701, 0xFF706803, 0xFF946702, 0xFFB46200, 0xFFAD5803, 0xFF855601,
+	0xFF705201, 0xFF637005, 0xFF538C04, 0xFF529201, 0xFF777800, 0xFFAB5B01, 0xFF9F5005, 0xFF673E01,
+	0xFF493400, 0xFF634100, 0xFF725500, 0xFF655B01, 0xFF525800, 0xFF476601, 0xFF448204, 0xFF4A8708,
+	0xFF567906, 0xFF6E6605, 0xFF8C5B06, 0xFF9B5C01, 0xFF855800, 0xFF604B00, 0xFF3E5100, 0xFF346000,
+	0xFF3A7900, 0xFF5B9200, 0xFF969E02, 0xFFC1A604, 0xFFB7A001, 0xFF909702, 0xFF5B9104, 0xFF2F8B04,
+	0xFF367602, 0xFF665B01, 0xFFA24B02, 0xFFB35703, 0xFF836B06, 0xFF437801, 0xFF327800, 0xFF556600,
+	0xFF7C5002, 0xFF793603, 0xFF583000, 0xFF513D02, 0xFF6A6201, 0xFF918A00, 0xFF999900, 0xFF719701,
+	0xFF548200, 0xFF536600, 0xFF565900, 0xFF5A5B00, 0xFF716601, 0xFF8A7403, 0xFF8B7B02, 0xFF768402,
+	0xFF609002, 0xFF5D9E00, 0xFF6F9E02, 0xFF759101, 0xFF637E01, 0xFF597100, 0xFF717002, 0xFF878804,
+	0xFF88A801, 0xFF90B002, 0xFFA49C01, 0xFF8E7702, 0xFF645505, 0xFF474400, 0xFF493B01, 0xFF593B02,
+	0xFF5B5100, 0xFF596500, 0xFF556C02, 0xFF4F6800, 0xFF586400, 0xFF7D6103, 0xFFAE5D05, 0xFFA86200,
+	0xFF806E01, 0xFF6A7001, 0xFF677201, 0xFF676F06, 0xFF626D0A, 0xFF627002, 0xFF6E6A00, 0xFF7C5E00,
+	0xFF725E00, 0xFF587400, 0xFF5C8C01, 0xFF6B9E01, 0xFF699D02, 0xFF548D01, 0xFF408800, 0xFF469101,
+	0xFF729300, 0xFFA49600, 0xFFBD9802, 0xFFB1A401, 0xFF74B403, 0xFF32B605, 0xFF0CA402, 0xFF118900,
+	0xFF3A7301, 0xFF786003, 0xFFAB4A00, 0xFFBB3F00, 0xFFA04E01, 0xFF766901, 0xFF537900, 0xFF407800,
+	0xFF3E7200, 0xFF5B7600, 0xFF738600, 0xFF699500, 0xFF509E01, 0xFF609B00, 0xFF9A8D05, 0xFFA88005,
+	0xFF837500, 0xFF5C7301, 0xFF4C7402, 0xFF586A04, 0xFF776203, 0xFF985B01, 0xFFA15200, 0xFF8E4A00,
+	0xFF896702, 0xFF767405, 0xFF4B8902, 0xFF398B00, 0xFF567800, 0xFF825004, 0xFF812904, 0xFF551C01,
+	0xFF562001, 0xFF7D3501, 0xFF884900, 0xFF6B5600, 0xFF5B6800, 0xFF5B8D03, 0xFF57AC03, 0xFF4CA508,
+	0xFF4B7E04, 0xFF6B5700, 0xFF944400, 0xFFA24600, 0xFF8A5200, 0xFF785900, 0xFF646D00, 0xFF568902,
+	0xFF57A403, 0xFF62B603, 0xFF80BC03, 0xFFADAE06, 0xFFB29201, 0xFF857D00, 0xFF4C7900, 0xFF1F7800,
+	0xFF1E6F01, 0xFF4D5C01, 0xFF8B4000, 0xFFA93200, 0xFF8B3A02, 0xFF584F00, 0xFF3A6200, 0xFF4A5C00,
+	0xFF5B4802, 0xFF5C2C02, 0xFF581E00, 0xFF682800, 0xFF894D00, 0xFFA46903, 0xFF957403, 0xFF637C01,
+	0xFF467900, 0xFF3B7700, 0xFF447E01, 0xFF608702, 0xFF839209, 0xFF999806, 0xFF939A02, 0xFF85A102,
+	0xFF6CA600, 0xFF659C01, 0xFF688702, 0xFF617E00, 0xFF5B7900, 0xFF598600, 0xFF7E9302, 0xFF9EAA02,
+	0xFF97BB00, 0xFF8AB402, 0xFF8A9401, 0xFF6A6502, 0xFF453E04, 0xFF342E00, 0xFF452E02, 0xFF683602,
+	0xFF7E4800, 0xFF6E5900, 0xFF5A6301, 0xFF486B00, 0xFF4A7601, 0xFF708205, 0xFF9B7E06, 0xFFA17405,
+	0xFF846F00, 0xFF6A6F00, 0xFF6C6D00, 0xFF687000, 0xFF597503, 0xFF4D7702, 0xFF4E6B00, 0xFF615D00,
+	0xFF6D6300, 0xFF707E00, 0xFF6E9104, 0xFF629605, 0xFF559100, 0xFF498A00, 0xFF458C00, 0xFF489200,
+	0xFF619405, 0xFF848B07, 0xFFB07D05, 0xFFB07701, 0xFF747501, 0xFF357302, 0xFF0B7801, 0xFF0F7F00,
+	0xFF2B7D04, 0xFF636707, 0xFF9D4800, 0xFFC03100, 0xFFC03702, 0xFF9E5300, 0xFF6D6700, 0xFF4E7000,
+	0xFF527900, 0xFF718A00, 0xFF7E9402, 0xFF6E9400, 0xFF5B9700, 0xFF72A701, 0xFF96BF02, 0xFF9BB408,
+	0xFF738B05, 0xFF476300, 0xFF3B4E00, 0xFF4C4D01, 0xFF715D00, 0xFF927202, 0xFF97790A, 0xFF8A6C03,
+	0xFF927F03, 0xFF867B01, 0xFF4C8700, 0xFF249000, 0xFF318901, 0xFF506000, 0xFF543600, 0xFF522702,
+	0xFF722E01, 0xFF913800, 0xFF913B01, 0xFF774900, 0xFF756201, 0xFF798405, 0xFF669305, 0xFF3E8C04,
+	0xFF2F7301, 0xFF5A5900, 0xFF945A00, 0xFFB06C01, 0xFFAA7E00, 0xFFA48700, 0xFF9C9701, 0xFF82AD02,
+	0xFF5CBD03, 0xFF4EB605, 0xFF5BA804, 0xFF859202, 0xFF9D7900, 0xFF816E01, 0xFF506803, 0xFF246605,
+	0xFF126504, 0xFF385403, 0xFF733800, 0xFF942600, 0xFF8F2B00, 0xFF6F4A00, 0xFF516502, 0xFF457002,
+	0xFF416600, 0xFF464800, 0xFF582E03, 0xFF7A2600, 0xFF9C3204, 0xFFAC4205, 0xFF8C4D01, 0xFF5A5E00,
+	0xFF3E6D00, 0xFF387E01, 0xFF459101, 0xFF639C01, 0xFF80A304, 0xFF92A201, 0xFF95A002, 0xFF899F02,
+	0xFF6F9900, 0xFF638600, 0xFF6B7901, 0xFF6B7C00, 0xFF678A00, 0xFF6AA000, 0xFF85A401, 0xFF959F02,
+	0xFF899202, 0xFF6F8201, 0xFF5C6C01, 0xFF465103, 0xFF333D01, 0xFF374001, 0xFF5B5000, 0xFF846200,
+	0xFF9B6E03, 0xFF7C7004, 0xFF536D00, 0xFF396E00, 0xFF357B01, 0xFF558702, 0xFF768407, 0xFF7A7404,
+	0xFF6E6101, 0xFF6D5900, 0xFF796100, 0xFF787202, 0xFF638403, 0xFF408B01, 0xFF337C01, 0xFF486B00,
+	0xFF666800, 0xFF807101, 0xFF707004, 0xFF4E6703, 0xFF485901, 0xFF4B5801, 0xFF526500, 0xFF527100,
+	0xFF527A04, 0xFF737808, 0xFF9D6904, 0xFF945700, 0xFF694500, 0xFF3B4600, 0xFF246700, 0xFF1D8C00,
+	0xFF249802, 0xFF408103, 0xFF725900, 0xFFA93C00, 0xFFBF4500, 0xFFB85E00, 0xFF917500, 0xFF6F8502,
+	0xFF6A9101, 0xFF7A9601, 0xFF748D05, 0xFF617A00, 0xFF677501, 0xFF8E8F05, 0xFFA4B902, 0xFF89B103,
+	0xFF587906, 0xFF344302, 0xFF3D3403, 0xFF674700, 0xFF916C00, 0xFF9D9003, 0xFF889907, 0xFF7D9002,
+	0xFF978803, 0xFF918502, 0xFF508B00, 0xFF208F02, 0xFF188804, 0xFF276B00, 0xFF3A5400, 0xFF5D4801,
+	0xFF7C4801, 0xFF943F01, 0xFF972F03, 0xFF873900, 0xFF8A5200, 0xFF8B6102, 0xFF6D5E03, 0xFF425E00,
+	0xFF326B00, 0xFF5B7D02, 0xFF8D9604, 0xFFACAC04, 0xFFB4B703, 0xFFBEB202, 0xFFB7B403, 0xFF91B605,
+	0xFF59B300, 0xFF35A000, 0xFF458300, 0xFF717201, 0xFF946E04, 0xFF877302, 0xFF5C6C03, 0xFF2A6604,
+	0xFF135A02, 0xFF304601, 0xFF613200, 0xFF8B2700, 0xFF983100, 0xFF894C02, 0xFF706506, 0xFF547503,
+	0xFF3D7D00, 0xFF3C6B00, 0xFF554C02, 0xFF7C3900, 0xFF9C3502, 0xFF9D3802, 0xFF7D4000, 0xFF4E4E00,
+	0xFF336000, 0xFF397B00, 0xFF548F00, 0xFF6E9700, 0xFF789800, 0xFF859500, 0xFF909100, 0xFF868601,
+	0xFF667802, 0xFF5A7200, 0xFF747501, 0xFF858905, 0xFF769C04, 0xFF6B9D01, 0xFF758B01, 0xFF7E6F02,
+	0xFF715B03, 0xFF585600, 0xFF485500, 0xFF475700, 0xFF4C5F03, 0xFF5C7304, 0xFF7B8204, 0xFF9B8E01,
+	0xFFA18F07, 0xFF807C08, 0xFF4D6600, 0xFF295900, 0xFF256402, 0xFF427500, 0xFF5D7B02, 0xFF5E7300,
+	0xFF5A6500, 0xFF725B01, 0xFF8D6201, 0xFF8D7701, 0xFF6D9005, 0xFF409A02, 0xFF268E01, 0xFF387900,
+	0xFF656400, 0xFF775900, 0xFF5F4800, 0xFF3E3802, 0xFF3E2C02, 0xFF582D03, 0xFF603801, 0xFF574900,
+	0xFF585600, 0xFF705902, 0xFF865102, 0xFF7C4100, 0xFF613400, 0xFF4E4800, 0xFF497300, 0xFF389F01,
+	0xFF2EA701, 0xFF308C01, 0xFF5B6C01, 0xFF9A6300, 0xFFBD7501, 0xFFC08904, 0xFFA39101, 0xFF809204,
+	0xFF6D8606, 0xFF697B03, 0xFF607101, 0xFF556600, 0xFF716805, 0xFFA37501, 0xFFAB8302, 0xFF717D02,
+	0xFF385E00, 0xFF2F4300, 0xFF525501, 0xFF9B7401, 0xFFC38804, 0xFFB18503, 0xFF818400, 0xFF768B01,
+	0xFF978506, 0xFF908707, 0xFF4F7F01, 0xFF1C7201, 0xFF0C6A01, 0xFF116900, 0xFF316403, 0xFF5B5D07,
+	0xFF705103, 0xFF7D4100, 0xFF903A00, 0xFFA14500, 0xFFA45504, 0xFF965503, 0xFF714B00, 0xFF585600,
+	0xFF5B7F00, 0xFF6CAB02, 0xFF7AC602, 0xFF8ECF01, 0xFF9CCE03, 0xFFAEC704, 0xFFAEB601, 0xFF88A902,
+	0xFF599C00, 0xFF338700, 0xFF456C00, 0xFF735D02, 0xFF936905, 0xFF877504, 0xFF596D01, 0xFF275F00,
+	0xFF214B00, 0xFF3C3C00, 0xFF5D3901, 0xFF823202, 0xFF943A00, 0xFF974201, 0xFF805602, 0xFF676E02,
+	0xFF4F8100, 0xFF3E8102, 0xFF496F00, 0xFF715E00, 0xFF8D5802, 0xFF845302, 0xFF654F00, 0xFF4A4E00,
+	0xFF405B01, 0xFF4D7904, 0xFF6A8D02, 0xFF7B9100, 0xFF748D01, 0xFF7D8801, 0xFF878401, 0xFF7A7605,
+	0xFF596101, 0xFF535C00, 0xFF7E6500, 0xFF977C06, 0xFF818807, 0xFF697D00, 0xFF676600, 0xFF725100,
+	0xFF6E4D00, 0xFF605801, 0xFF646800, 0xFF6F7703, 0xFF768905, 0xFF789601, 0xFF899B04, 0xFFA19B01,
+	0xFF978903, 0xFF6D6701, 0xFF3C4B00, 0xFF214501, 0xFF2B5601, 0xFF4B6C00, 0xFF597A00, 0xFF527C00,
+	0xFF547600, 0xFF6B6B01, 0xFF8B6203, 0xFF9E6600, 0xFF847701, 0xFF578900, 0xFF3A9301, 0xFF3C8F02,
+	0xFF537D01, 0xFF576600, 0xFF4C4800, 0xFF412900, 0xFF4C1E00, 0xFF6A2502, 0xFF722F01, 0xFF623B00,
+	0xFF614100, 0xFF733900, 0xFF843104, 0xFF7F2B05, 0xFF6F3101, 0xFF685000, 0xFF667F01, 0xFF54A901,
+	0xFF36B200, 0xFF279D00, 0xFF578600, 0xFF9C8700, 0xFFBB9901, 0xFFA89F02, 0xFF868802, 0xFF6F6D03,
+	0xFF615D01, 0xFF5C5D00, 0xFF5A6800, 0xFF5C6E01, 0xFF747101, 0xFF986801, 0xFF965202, 0xFF5C4F00,
+	0xFF2E5B00, 0xFF347700, 0xFF709A03, 0xFFB8A803, 0xFFD68E01, 0xFFB46200, 0xFF855300, 0xFF826806,
+	0xFF9A7203, 0xFF8B7803, 0xFF486600, 0xFF104E00, 0xFF014900, 0xFF095800, 0xFF325E03, 0xFF5C5C04,
+	0xFF685E02, 0xFF686000, 0xFF8C6700, 0xFFB47700, 0xFFB28002, 0xFF957705, 0xFF7D7002, 0xFF818400,
+	0xFF94A702, 0xFF87C903, 0xFF6BD205, 0xFF6BCB03, 0xFF86C100, 0xFF95B500, 0xFF92A100, 0xFF7C8C01,
+	0xFF5B8003, 0xFF407900, 0xFF4F6C00, 0xFF766200, 0xFF876301, 0xFF6E6104, 0xFF405301, 0xFF2B4400,
+	0xFF333E00, 0xFF4B4200, 0xFF635001, 0xFF724F04, 0xFF7C4400, 0xFF863700, 0xFF884200, 0xFF826501,
+	0xFF6C7B00, 0xFF498004, 0xFF4C7C02, 0xFF767C02, 0xFF898103, 0xFF777703, 0xFF5E6101, 0xFF535D00,
+	0xFF5F7302, 0xFF759104, 0xFF7EA302, 0xFF779904, 0xFF718A01, 0xFF7C8200, 0xFF827F05, 0xFF687106,
+	0xFF4A5900, 0xFF4C4E00, 0xFF7D5100, 0xFF9C6101, 0xFF856D02, 0xFF687000, 0xFF666C00, 0xFF716805,
+	0xFF716F04, 0xFF757605, 0xFF8C7E0A, 0xFFA08307, 0xFF958A01, 0xFF7C9500, 0xFF889902, 0xFF969303,
+	0xFF7F7801, 0xFF585200, 0xFF364001, 0xFF2C5100, 0xFF436D01, 0xFF587A03, 0xFF597E01, 0xFF4F7A06,
+	0xFF4E7203, 0xFF576701, 0xFF705505, 0xFF954700, 0xFFA54B00, 0xFF876600, 0xFF6F8002, 0xFF5B9403,
+	0xFF579A02, 0xFF4C8B07, 0xFF406707, 0xFF4A4600, 0xFF6C3A00, 0xFF894500, 0xFF865603, 0xFF685E02,
+	0xFF564F00, 0xFF623600, 0xFF802304, 0xFF912007, 0xFF892A03, 0xFF884000, 0xFF856E01, 0xFF739E03,
+	0xFF3EB200, 0xFF2BA803, 0xFF579202, 0xFF988A00, 0xFFAC8B00, 0xFF7E8000, 0xFF596400, 0xFF575003,
+	0xFF675701, 0xFF6C6801, 0xFF687403, 0xFF5E7902, 0xFF696C00, 0xFF7F5600, 0xFF8B4500, 0xFF695300,
+	0xFF4A7B03, 0xFF49A704, 0xFF77BE03, 0xFFAEB105, 0xFFC28100, 0xFFA44900, 0xFF7F3802, 0xFF855003,
+	0xFFA56500, 0xFF936B00, 0xFF4D5301, 0xFF133702, 0xFF063101, 0xFF164600, 0xFF3F5E00, 0xFF6D6D00,
+	0xFF7E8601, 0xFF879B03, 0xFF9FA703, 0xFFB3A900, 0xFFAAA200, 0xFF889902, 0xFF83A200, 0xFFA7B500,
+	0xFFB9CE01, 0xFF97D408, 0xFF67C20B, 0xFF59AE03, 0xFF769C03, 0xFF7D8900, 0xFF737400, 0xFF6A6301,
+	0xFF665C04, 0xFF606804, 0xFF627101, 0xFF6F7701, 0xFF726900, 0xFF535200, 0xFF2D4000, 0xFF2B3804,
+	0xFF453903, 0xFF664902, 0xFF716200, 0xFF646F02, 0xFF586204, 0xFF5F5100, 0xFF875101, 0xFF996101,
+	0xFF856900, 0xFF5E6B01, 0xFF5D7800, 0xFF7B8D03, 0xFF7E9204, 0xFF638302, 0xFF547400, 0xFF697A04,
+	0xFF889100, 0xFF96A500, 0xFF7FA901, 0xFF679404, 0xFF677D01, 0xFF747500, 0xFF7B7402, 0xFF626E03,
+	0xFF465B00, 0xFF515601, 0xFF845B03, 0xFF9F6301, 0xFF8D7500, 0xFF778600, 0xFF669600, 0xFF649104,
+	0xFF667D04, 0xFF796903, 0xFF9A6305, 0xFFAF6802, 0xFFA17200, 0xFF8F8300, 0xFF8E9100, 0xFF7F9000,
+	0xFF617700, 0xFF4D5A00, 0xFF4B5700, 0xFF547601, 0xFF619202, 0xFF5B8C01, 0xFF4D7706, 0xFF406006,
+	0xFF414E01, 0xFF4B4800, 0xFF5F4601, 0xFF8F4701, 0xFFAD4D00, 0xFFA75802, 0xFF996402, 0xFF827802,
+	0xFF708B01, 0xFF4F8F07, 0xFF3B8107, 0xFF526F00, 0xFF896800, 0xFFA97400, 0xFF9B8A04, 0xFF729002,
+	0xFF4F7500, 0xFF535000, 0xFF7D3200, 0xFFA32401, 0xFF9C2703, 0xFF9C3300, 0xFFA34E00, 0xFF917802,
+	0xFF5E9800, 0xFF399E06, 0xFF548F08, 0xFF8D7600, 0xFF946200, 0xFF605900, 0xFF485400, 0xFF5F5F01,
+	0xFF7A6E03, 0xFF787901, 0xFF657302, 0xFF516900, 0xFF5C5D00, 0xFF795900, 0xFF946000, 0xFF917206,
+	0xFF789409, 0xFF5DAC02, 0xFF5AAF02, 0xFF829902, 0xFFA06F01, 0xFF8B4602, 0xFF6D3B00, 0xFF864901,
+	0xFF9F5800, 0xFF8F5D00, 0xFF4E5101, 0xFF263E01, 0xFF294004, 0xFF455E01, 0xFF6A8300, 0xFF8CA302,
+	0xFF9DB705, 0xFFA2C006, 0xFFA4C504, 0xFF9EBA08, 0xFF8DA203, 0xFF869A00, 0xFFA2A303, 0xFFCAB402,
+	0xFFC4C604, 0xFF94BF05, 0xFF63A501, 0xFF4F8C00, 0xFF696E05, 0xFF6E5901, 0xFF554E00, 0xFF564600,
+	0xFF6D4502, 0xFF7C5403, 0xFF7A6E05, 0xFF728203, 0xFF627C04, 0xFF4A6402, 0xFF2A4F00, 0xFF2D4300,
+	0xFF4E4402, 0xFF745602, 0xFF786800, 0xFF5A7803, 0xFF437E04, 0xFF4F8300, 0xFF7E7D02, 0xFF906D01,
+	0xFF815B01, 0xFF655900, 0xFF6A6B01, 0xFF7F7F03, 0xFF787F01, 0xFF587600, 0xFF547600, 0xFF7D8502,
+	0xFF9C9303, 0xFF979301, 0xFF6E8C00, 0xFF4A7800, 0xFF4A6B00, 0xFF626A00, 0xFF736602, 0xFF616C00,
+	0xFF527000, 0xFF5F7D00, 0xFF888603, 0xFFAA8902, 0xFFA69202, 0xFF889A06, 0xFF5E9D04, 0xFF418C00,
+	0xFF406200, 0xFF684A00, 0xFF974900, 0xFFAD5500, 0xFFAA6A00, 0xFFA77D01, 0xFF958C02, 0xFF688D01,
+	0xFF507D00, 0xFF507300, 0xFF697901, 0xFF7F8D06, 0xFF6D9401, 0xFF418A00, 0xFF326703, 0xFF294400,
+	0xFF313300, 0xFF503800, 0xFF715203, 0xFF976B05, 0xFFAA7406, 0xFFA06404, 0xFF8D5000, 0xFF864601,
+	0xFF755301, 0xFF536300, 0xFF487400, 0xFF5F8300, 0xFF9A8C01, 0xFFBF9502, 0xFFAEA202, 0xFF7CA702,
+	0xFF519101, 0xFF567101, 0xFF7D5803, 0xFF9B4601, 0xFF9C3900, 0xFFA53200, 0xFFB53C01, 0xFFA85303,
+	0xFF6E6E00, 0xFF407C02, 0xFF487B03, 0xFF796400, 0xFF7D4F00, 0xFF554C01, 0xFF525A00, 0xFF706F03,
+	0xFF837705, 0xFF697200, 0xFF4F6500, 0xFF4F6400, 0xFF6D6B00, 0xFF917A02, 0xFFA68003, 0xFFAA7A04,
+	0xFF967F01, 0xFF658C00, 0xFF439000, 0xFF538400, 0xFF736A01, 0xFF6D5203, 0xFF684800, 0xFF824D03,
+	0xFF914700, 0xFF794A01, 0xFF4C5101, 0xFF486100, 0xFF607E02, 0xFF7BA100, 0xFF92BF00, 0xFF9ED101,
+	0xFFA1D402, 0xFF9DCD01, 0xFF8EBE01, 0xFF77A804, 0xFF6C8C01, 0xFF827900, 0xFFAF7906, 0xFFCE7F04,
+	0xFFCB8704, 0xFF947F03, 0xFF5D6F00, 0xFF4C6000, 0xFF595100, 0xFF614A00, 0xFF474C01, 0xFF444B02,
+	0xFF614A01, 0xFF854600, 0xFF915602, 0xFF8A7300, 0xFF6A8701, 0xFF438102, 0xFF326E04, 0xFF3B6001,
+	0xFF546603, 0xFF756F02, 0xFF766B01, 0xFF597101, 0xFF4C8100, 0xFF5C9500, 0xFF749506, 0xFF747E02,
+	0xFF646400, 0xFF5B6000, 0xFF716D01, 0xFF8B6E01, 0xFF7B6400, 0xFF586000, 0xFF5B6700, 0xFF817104,
+	0xFF927208, 0xFF826702, 0xFF585E00, 0xFF3A5A03, 0xFF366101, 0xFF4E6A00, 0xFF697500, 0xFF718200,
+	0xFF6A9600, 0xFF6DA300, 0xFF82A503, 0xFFA8A003, 0xFFA99301, 0xFF798804, 0xFF407407, 0xFF206102,
+	0xFF275500, 0xFF5E5A00, 0xFF996301, 0xFFB66D03, 0xFFC07605, 0xFFB87A07, 0xFF977905, 0xFF647704,
+	0xFF4D7E01, 0xFF5A8801, 0xFF788A03, 0xFF808604, 0xFF687601, 0xFF366900, 0xFF225400, 0xFF253E00,
+	0xFF394300, 0xFF6D5603, 0xFF9D7402, 0xFFA38E05, 0xFF8C8F07, 0xFF6A7002, 0xFF5B4700, 0xFF6E2700,
+	0xFF762600, 0xFF664102, 0xFF696400, 0xFF7F7E01, 0xFFA18E05, 0xFFBF9204, 0xFFB48A01, 0xFF818A02,
+	0xFF549000, 0xFF508C06, 0xFF6D7E09, 0xFF866901, 0xFF925600, 0xFF9F5100, 0xFFAD5500, 0xFFAB5500,
+	0xFF6D5300, 0xFF3D5900, 0xFF415F00, 0xFF595901, 0xFF5A4C01, 0xFF4F4603, 0xFF5D5100, 0xFF766402,
+	0xFF756904, 0xFF596800, 0xFF516F00, 0xFF6B8700, 0xFF939701, 0xFFA39801, 0xFF9D8505, 0xFFA86901,
+	0xFFA46100, 0xFF766D00, 0xFF457702, 0xFF347C00, 0xFF466B00, 0xFF515900, 0xFF6C4B00, 0xFF7C4B02,
+	0xFF855102, 0xFF555A01, 0xFF466E03, 0xFF639100, 0xFF8ABE04, 0xFF9FD901, 0xFF9EDC02, 0xFF94D600,
+	0xFF8ED402, 0xFF84C504, 0xFF70AD02, 0xFF578E00, 0xFF586F00, 0xFF775B00, 0xFF994E01, 0xFFB54600,
+	0xFFB64001, 0xFF883802, 0xFF5D2F00, 0xFF503400, 0xFF5B4103, 0xFF5C5007, 0xFF416001, 0xFF346B03,
+	0xFF4E6501, 0xFF854B00, 0xFFA64300, 0xFF9E5F01, 0xFF787D01, 0xFF488500, 0xFF397A03, 0xFF4E7900,
+	0xFF6A8603, 0xFF7B8604, 0xFF6D7201, 0xFF5A6101, 0xFF656400, 0xFF787400, 0xFF7D8102, 0xFF657F01,
+	0xFF487C03, 0xFF4E8602, 0xFF748503, 0xFF877402, 0xFF755B00, 0xFF5D5202, 0xFF605603, 0xFF745C01,
+	0xFF765502, 0xFF655000, 0xFF4D5300, 0xFF3B5F02, 0xFF3A6F02, 0xFF4C7F04, 0xFF6B9202, 0xFF8A9F03,
+	0xFF86A804, 0xFF6DA004, 0xFF6A9403, 0xFF818501, 0xFF817000, 0xFF5B5B00, 0xFF354901, 0xFF275104,
+	0xFF3A6D03, 0xFF6A8B00, 0xFFA29304, 0xFFC28907, 0xFFC17904, 0xFFB26703, 0xFF985C01, 0xFF6D6606,
+	0xFF527E06, 0xFF5A9600, 0xFF709100, 0xFF6B7200, 0xFF4F5B00, 0xFF335500, 0xFF2D5500, 0xFF3F5B00,
+	0xFF5E6F01, 0xFF8F8004, 0xFFB08801, 0xFF9F8604, 0xFF6A7401, 0xFF356200, 0xFF334400, 0xFF583100,
+	0xFF773801, 0xFF885103, 0xFF927300, 0xFF958704, 0xFFA28806, 0xFFB27900, 0xFFA86301, 0xFF7C5D01,
+	0xFF546E00, 0xFF448202, 0xFF548404, 0xFF687C00, 0xFF837801, 0xFF9E8101, 0xFFA58204, 0xFF8F7002,
+	0xFF655400, 0xFF3B4700, 0xFF324C00, 0xFF3D4A01, 0xFF3E3F01, 0xFF443E00, 0xFF604400, 0xFF784F02,
+	0xFF6A5E02, 0xFF5B7000, 0xFF6D8B02, 0xFF94A603, 0xFFA8B304, 0xFF9BA800, 0xFF8A8D00, 0xFF937C01,
+	0xFF9A7201, 0xFF816701, 0xFF4D6203, 0xFF296401, 0xFF3D5802, 0xFF5A5600, 0xFF7A5501, 0xFF855501,
+	0xFF7B7504, 0xFF488400, 0xFF4AA302, 0xFF75CB04, 0xFF91E802, 0xFF93E403, 0xFF86C703, 0xFF80BB00,
+	0xFF85B601, 0xFF77A502, 0xFF598C04, 0xFF3F6F00, 0xFF4E5A00, 0xFF714E02, 0xFF844802, 0xFF894000,
+	0xFF892C00, 0xFF7C1800, 0xFF680E00, 0xFF611D00, 0xFF6C3704, 0xFF674F07, 0xFF427000, 0xFF348600,
+	0xFF408500, 0xFF766B00, 0xFFA75402, 0xFFA45601, 0xFF7C6603, 0xFF4C7100, 0xFF418000, 0xFF618F00,
+	0xFF809C04, 0xFF849102, 0xFF677100, 0xFF515500, 0xFF714D02, 0xFF985404, 0xFF926102, 0xFF677202,
+	0xFF498701, 0xFF509A02, 0xFF699907, 0xFF707F02, 0xFF685C00, 0xFF684A01, 0xFF694F02, 0xFF655B00,
+	0xFF5E5C00, 0xFF5A6000, 0xFF546301, 0xFF466D01, 0xFF457C03, 0xFF578C06, 0xFF739905, 0xFF889904,
+	0xFF828C04, 0xFF607702, 0xFF486602, 0xFF476100, 0xFF4A5B00, 0xFF564E00, 0xFF574C00, 0xFF4D6404,
+	0xFF598D07, 0xFF7EA901, 0xFFA5AB01, 0xFFB89401, 0xFFB37200, 0xFFA85800, 0xFF9B4C00, 0xFF7C5904,
+	0xFF627706, 0xFF5C8F01, 0xFF588C00, 0xFF516D00, 0xFF3D6300, 0xFF306A00, 0xFF426F03, 0xFF627902,
+	0xFF848404, 0xFFA48503, 0xFFA67801, 0xFF866202, 0xFF575000, 0xFF274E00, 0xFF225700, 0xFF4D5F02,
+	0xFF7C6E01, 0xFFA97900, 0xFFAC8800, 0xFF9B8F02, 0xFFA38901, 0xFFAC7300, 0xFF9A5503, 0xFF6C4300,
+	0xFF494400, 0xFF395A02, 0xFF467000, 0xFF648000, 0xFF889603, 0xFFA39E03, 0xFF9A9308, 0xFF727C04,
+	0xFF4F6200, 0xFF3C5000, 0xFF2F4500, 0xFF343C00, 0xFF393303, 0xFF3F3603, 0xFF603E00, 0xFF814702,
+	0xFF805402, 0xFF756B00, 0xFF868302, 0xFFAD9803, 0xFFB2AA04, 0xFF96B203, 0xFF87AA02, 0xFF8DA307,
+	0xFF8B9104, 0xFF756700, 0xFF534900, 0xFF494700, 0xFF585200, 0xFF7D6100, 0xFF986E03, 0xFF996F03,
+	0xFF809200, 0xFF5CAA02, 0xFF65CD06, 0xFF87EB08, 0xFF8CEA01, 0xFF70C302, 0xFF5B9802, 0xFF6E8600,
+	0xFF8A8200, 0xFF7B7D00, 0xFF4E7100, 0xFF306000, 0xFF535200, 0xFF825601, 0xFF7D6603, 0xFF656402,
+	0xFF584B00, 0xFF5E2B01, 0xFF6B1B00, 0xFF7C2401, 0xFF823500, 0xFF6F4800, 0xFF556501, 0xFF458300,
+	0xFF479303, 0xFF6B8B00, 0xFF967503, 0xFF996103, 0xFF745B00, 0xFF576B00, 0xFF598801, 0xFF709C01,
+	0xFF829D03, 0xFF748402, 0xFF576800, 0xFF535E00, 0xFF795D01, 0xFFA85B00, 0xFFA65A01, 0xFF7C6002,
+	0xFF597100, 0xFF548301, 0xFF538903, 0xFF537600, 0xFF5A5C00, 0xFF6C5000, 0xFF735900, 0xFF6D6602,
+	0xFF636D03, 0xFF5B6E01, 0xFF576D01, 0xFF4E6E02, 0xFF4C7601, 0xFF5B7E01, 0xFF707E01, 0xFF727501,
+	0xFF626603, 0xFF485B00, 0xFF335900, 0xFF2F6103, 0xFF346B01, 0xFF616D03, 0xFF807004, 0xFF7B8301,
+	0xFF799F02, 0xFF87AF01, 0xFFA2AC00, 0xFFAE9D00, 0xFFAE7F00, 0xFFAD6300, 0xFFA25300, 0xFF904D01,
+	0xFF6E5904, 0xFF536A04, 0xFF466A01, 0xFF456601, 0xFF437002, 0xFF408300, 0xFF548703, 0xFF767F05,
+	0xFF8E7801, 0xFF9A7203, 0xFF976302, 0xFF7F5800, 0xFF615A00, 0xFF406000, 0xFF397600, 0xFF539002,
+	0xFF809901, 0xFFA99003, 0xFFB08800, 0xFF9F8F00, 0xFF9C9300, 0xFF928001, 0xFF735900, 0xFF4F3401,
+	0xFF3E2A02, 0xFF453B01, 0xFF575C03, 0xFF7B7D02, 0xFF949902, 0xFF9B9201, 0xFF837E00, 0xFF626F00,
+	0xFF516900, 0xFF446501, 0xFF414D03, 0xFF453A00, 0xFF423703, 0xFF403E02, 0xFF614601, 0xFF8F4503,
+	0xFF994801, 0xFF895C00, 0xFF8C7400, 0xFFAD8700, 0xFFB99C02, 0xFFA8AF05, 0xFF9BBB02, 0xFF95B102,
+	0xFF7D8D01, 0xFF5C5901, 0xFF583A02, 0xFF724501, 0xFF856402, 0xFF987F01, 0xFFA68700, 0xFFA78500,
+	0xFF869300, 0xFF7EA402, 0xFF8BC407, 0xFF97D604, 0xFF7EBB02, 0xFF4B8801, 0xFF3B6500, 0xFF615900,
+	0xFF916302, 0xFF8B7104, 0xFF547500, 0xFF3C7102, 0xFF676903, 0xFF966601, 0xFF8D7102, 0xFF5C7601,
+	0xFF3D6500, 0xFF435403, 0xFF6A5101, 0xFF964D03, 0xFF944602, 0xFF714900, 0xFF5A4D02, 0xFF496400,
+	0xFF477F05, 0xFF5F8A03, 0xFF807D01, 0xFF856601, 0xFF725F00, 0xFF627101, 0xFF6B8904, 0xFF789302,
+	0xFF728601, 0xFF5C6D01, 0xFF4D6402, 0xFF577501, 0xFF7D8402, 0xFFA37F01, 0xFFA36A00, 0xFF875900,
+	0xFF6C5B02, 0xFF596703, 0xFF477000, 0xFF3D6F00, 0xFF496800, 0xFF626200, 0xFF746200, 0xFF6F6502,
+	0xFF626703, 0xFF566401, 0xFF506301, 0xFF4D6701, 0xFF516A00, 0xFF5A6E00, 0xFF646901, 0xFF616401,
+	0xFF546600, 0xFF466C00, 0xFF377700, 0xFF248702, 0xFF2D9003, 0xFF5A9103, 0xFF898E04, 0xFF959100,
+	0xFF909F01, 0xFF91AE01, 0xFF9BB701, 0xFFA7AE02, 0xFFA89502, 0xFFAA7705, 0xFFA75B02, 0xFF914501,
+	0xFF633701, 0xFF403800, 0xFF463D00, 0xFF564701, 0xFF636306, 0xFF5E7D04, 0xFF578605, 0xFF6F7503,
+	0xFF856800, 0xFF906900, 0xFF957300, 0xFF928101, 0xFF848700, 0xFF678E00, 0xFF5A9503, 0xFF61A402,
+	0xFF6CAC02, 0xFF8A9E05, 0xFFA79301, 0xFF9A9901, 0xFF7F9503, 0xFF647D01, 0xFF435500, 0xFF2C3903,
+	0xFF313403, 0xFF573C02, 0xFF7D4F03, 0xFF9D6401, 0xFFA27005, 0xFF8B6701, 0xFF745A00, 0xFF675A02,
+	0xFF606405, 0xFF516803, 0xFF4D5B04, 0xFF554E01, 0xFF4E5000, 0xFF485A00, 0xFF615A00, 0xFF8A4E00,
+	0xFFA34200, 0xFF995400, 0xFF9B7601, 0xFFA89802, 0xFFB5A903, 0xFFB5A803, 0xFFA19E01, 0xFF878600,
+	0xFF646300, 0xFF4B4801, 0xFF614402, 0xFF925C08, 0xFFA77B06, 0xFF989200, 0xFF9D9500, 0xFF9F8E00,
+	0xFF7F8302, 0xFF8C7900, 0xFFAD8502, 0xFFA48D02, 0xFF6C7901, 0xFF325D02, 0xFF355300, 0xFF6E5E00,
+	0xFF9A7703, 0xFF998B07, 0xFF6C9600, 0xFF539305, 0xFF718304, 0xFF9F6701, 0xFF9F5501, 0xFF605A00,
+	0xFF3C6201, 0xFF4C6F01, 0xFF768200, 0xFF9F7F03, 0xFF8E7103, 0xFF625302, 0xFF493E00, 0xFF414400,
+	0xFF465903, 0xFF566E04, 0xFF716A00, 0xFF7D6100, 0xFF746400, 0xFF6E6F02, 0xFF717D03, 0xFF6F7A01,
+	0xFF656B00, 0xFF586300, 0xFF4A7001, 0xFF558D04, 0xFF7FA008, 0xFF9A9A09, 0xFF928202, 0xFF836B00,
+	0xFF786204, 0xFF5F6902, 0xFF4D7100, 0xFF407800, 0xFF497700, 0xFF606D00, 0xFF6D5F00, 0xFF675800,
+	0xFF595900, 0xFF4F5801, 0xFF4F5D04, 0xFF566C02, 0xFF617700, 0xFF5F7D00, 0xFF5C7601, 0xFF606B06,
+	0xFF666D03, 0xFF5E8000, 0xFF509301, 0xFF2BA501, 0xFF28A700, 0xFF50A000, 0xFF809600, 0xFF998F00,
+	0xFFA29A02, 0xFFA9AB03, 0xFFA4B603, 0xFF95A604, 0xFF898804, 0xFF8C6805, 0xFF944903, 0xFF7B3300,
+	0xFF4F2400, 0xFF332300, 0xFF4A2E00, 0xFF7D3900, 0xFF904B02, 0xFF7A6205, 0xFF5A6E01, 0xFF646700,
+	0xFF7B6C00, 0xFF8D7D00, 0xFF9D9201, 0xFFA5A801, 0xFF96AF03, 0xFF7DB404, 0xFF72B202, 0xFF6AAA00,
+	0xFF66AA00, 0xFF80A401, 0xFF97A200, 0xFF8F9C04, 0xFF6B8402, 0xFF436A00, 0xFF265200, 0xFF1D4B00,
+	0xFF2E4C00, 0xFF564900, 0xFF894600, 0xFFA74600, 0xFF984800, 0xFF774701, 0xFF6F4200, 0xFF774501,
+	0xFF734F03, 0xFF635602, 0xFF555F01, 0xFF5F6A00, 0xFF617600, 0xFF598000, 0xFF5F7B00, 0xFF736403,
+	0xFF984801, 0xFFA65300, 0xFFAA8006, 0xFFABAC08, 0xFFA8B100, 0xFF979104, 0xFF786A04, 0xFF5A4B01,
+	0xFF404200, 0xFF3D5200, 0xFF716703, 0xFFAA7405, 0xFFAD8501, 0xFF8F9900, 0xFF8CA000, 0xFF8A9601,
+	0xFF707103, 0xFF8A4F00, 0xFFB24202, 0xFFA74B02, 0xFF735200, 0xFF505700, 0xFF5B6D03, 0xFF818C09,
+	0xFF99A001, 0xFF96A601, 0xFF73A305, 0xFF569708, 0xFF677B02, 0xFF925A00, 0xFF9E3D01, 0xFF723D01,
+	0xFF505400, 0xFF636E01, 0xFF818B03, 0xFF8A9406, 0xFF728002, 0xFF4B5F02, 0xFF383E05, 0xFF3E3101,
+	0xFF473901, 0xFF544B01, 0xFF6D5604, 0xFF7D5906, 0xFF776001, 0xFF6E6402, 0xFF6A6402, 0xFF696200,
+	0xFF656700, 0xFF5D7001, 0xFF448700, 0xFF499F01, 0xFF6FAC01, 0xFF88A903, 0xFF809C01, 0xFF718C01,
+	0xFF6C7F01, 0xFF697900, 0xFF637501, 0xFF577A01, 0xFF567C00, 0xFF667401, 0xFF6C6501, 0xFF635A00,
+	0xFF595D00, 0xFF5A6700, 0xFF687800, 0xFF748D00, 0xFF729F00, 0xFF60A400, 0xFF559400, 0xFF627703,
+	0xFF726B04, 0xFF7C7900, 0xFF6C9300, 0xFF3CAB01, 0xFF26B401, 0xFF41A804, 0xFF6C9505, 0xFF967D00,
+	0xFFB47A01, 0xFFBE8704, 0xFFA68405, 0xFF717101, 0xFF5C5602, 0xFF633E02, 0xFF6F2E01, 0xFF602802,
+	0xFF3B2801, 0xFF323300, 0xFF5D4A02, 0xFF995804, 0xFFA85801, 0xFF885C00, 0xFF676900, 0xFF657B02,
+	0xFF758D02, 0xFF839B00, 0xFF97A705, 0xFFA8AB04, 0xFF9BB005, 0xFF81B908, 0xFF7ABA04, 0xFF6FAE01,
+	0xFF71A300, 0xFF8A9800, 0xFF8E9303, 0xFF7F8603, 0xFF617102, 0xFF3F6000, 0xFF2B5800, 0xFF2A5703,
+	0xFF395703, 0xFF565000, 0xFF764703, 0xFF913D01, 0xFF8A3A00, 0xFF6C3C03, 0xFF6A3B00, 0xFF843601,
+	0xFF8E3503, 0xFF813D02, 0xFF6C5A00, 0xFF677E00, 0xFF6E9700, 0xFF6AA403, 0xFF629703, 0xFF627301,
+	0xFF7B4F00, 0xFFA75400, 0xFFB37F03, 0xFFA5A503, 0xFF879803, 0xFF606902, 0xFF404000, 0xFF302C01,
+	0xFF2E3F05, 0xFF457406, 0xFF739900, 0xFFAAA100, 0xFFBE9C00, 0xFFA2AC00, 0xFF7EB800, 0xFF68A001,
+	0xFF555F00, 0xFF783F01, 0xFFB43904, 0xFFBB4B02, 0xFF976200, 0xFF857E04, 0xFF809A06, 0xFF87A703,
+	0xFF839D02, 0xFF7A8700, 0xFF697A03, 0xFF5A7301, 0xFF656B02, 0xFF8F6200, 0xFFA15B00, 0xFF855700,
+	0xFF6B5401, 0xFF755D01, 0xFF827203, 0xFF737B02, 0xFF5A6C02, 0xFF3C5901, 0xFF304403, 0xFF3A3700,
+	0xFF533700, 0xFF6A4101, 0xFF785306, 0xFF815E04, 0xFF7E5E01, 0xFF6C6200, 0xFF616100, 0xFF6C6900,
+	0xFF737C03, 0xFF618A05, 0xFF4D9601, 0xFF53A200, 0xFF67B102, 0xFF76AC02, 0xFF6D9C00, 0xFF5A8C01,
+	0xFF587C01, 0xFF646E00, 0xFF6B6900, 0xFF727200, 0xFF7B7C02, 0xFF7E7E03, 0xFF757C01, 0xFF5D7602,
+	0xFF597400, 0xFF687F04, 0xFF888E05, 0xFF989D04, 0xFF82B205, 0xFF5CB902, 0xFF46A400, 0xFF4E8301,
+	0xFF6D6F02, 0xFF907500, 0xFF828F00, 0xFF4FA508, 0xFF35A408, 0xFF3D9404, 0xFF547C01, 0xFF826000,
+	0xFFAE4D00, 0xFFB04E00, 0xFF874702, 0xFF533B01, 0xFF412E01, 0xFF4D2601, 0xFF572201, 0xFF432A01,
+	0xFF333F02, 0xFF4C6000, 0xFF7C8402, 0xFFA79307, 0xFFAD8A04, 0xFF948200, 0xFF7D8A00, 0xFF71A204,
+	0xFF72AF06, 0xFF74AE00, 0xFF84A401, 0xFF949608, 0xFF939205, 0xFF879701, 0xFF849E01, 0xFF78A201,
+	0xFF739300, 0xFF807802, 0xFF7E6903, 0xFF746300, 0xFF5D6A01, 0xFF496D02, 0xFF396305, 0xFF3A5605,
+	0xFF4A5103, 0xFF5E4F00, 0xFF6B4E01, 0xFF764602, 0xFF744002, 0xFF654202, 0xFF5F4C00, 0xFF7B4402,
+	0xFFA13104, 0xFFAA2E03, 0xFF934900, 0xFF807600, 0xFF839406, 0xFF82A10B, 0xFF669203, 0xFF536F00,
+	0xFF695B00, 0xFFAA5F01, 0xFFC17600, 0xFF9C7D00, 0xFF646308, 0xFF343F00, 0xFF252A00, 0xFF303300,
+	0xFF425F02, 0xFF5F9C03, 0xFF86C606, 0xFFB2CB03, 0xFFD6BB01, 0xFFC3BA05, 0xFF84B602, 0xFF518E00,
+	0xFF495200, 0xFF7F5600, 0xFFC16B00, 0xFFD58401, 0xFFBF9400, 0xFFA9A301, 0xFF87A402, 0xFF6D8B02,
+	0xFF5E6503, 0xFF635100, 0xFF725500, 0xFF776300, 0xFF817C00, 0xFFA09003, 0xFFA89705, 0xFF858B01,
+	0xFF6A6801, 0xFF7C4D00, 0xFF8A4500, 0xFF764A00, 0xFF4F5101, 0xFF344B01, 0xFF314900, 0xFF454E00,
+	0xFF675500, 0xFF846200, 0xFF927102, 0xFF967A00, 0xFF907F00, 0xFF7A8300, 0xFF6B8100, 0xFF768600,
+	0xFF7D8C01, 0xFF689502, 0xFF5D9804, 0xFF619C01, 0xFF6CA206, 0xFF689303, 0xFF4B7901, 0xFF3A6602,
+	0xFF415A01, 0xFF555600, 0xFF755E00, 0xFF8E7301, 0xFFA18803, 0xFFA49004, 0xFF859400, 0xFF638B01,
+	0xFF588000, 0xFF647D03, 0xFF8E8203, 0xFFA68D02, 0xFF969F06, 0xFF6EAB03, 0xFF44A500, 0xFF3B9601,
+	0xFF658700, 0xFF8F8800, 0xFF859202, 0xFF598D04, 0xFF3C7302, 0xFF3B5F00, 0xFF4F5200, 0xFF7D4800,
+	0xFFA44400, 0xFF9A3D00, 0xFF6B2C01, 0xFF422100, 0xFF3D2200, 0xFF412300, 0xFF423100, 0xFF384901,
+	0xFF476A00, 0xFF6C9500, 0xFF8EB000, 0xFFA8B800, 0xFFAEAD03, 0xFFA3AC00, 0xFF9AB800, 0xFF85C700,
+	0xFF67C802, 0xFF56B800, 0xFF609C00, 0xFF777801, 0xFF856302, 0xFF926102, 0xFF966805, 0xFF887503,
+	0xFF757100, 0xFF6E6400, 0xFF716000, 0xFF726400, 0xFF627301, 0xFF507604, 0xFF435F05, 0xFF454900,
+	0xFF574500, 0xFF6D4900, 0xFF6C4F00, 0xFF5F5301, 0xFF595400, 0xFF565F01, 0xFF587400, 0xFF707000,
+	0xFF965800, 0xFFB34000, 0xFFB63701, 0xFFB04B00, 0xFFA96B04, 0xFF957504, 0xFF686D00, 0xFF4C6900,
+	0xFF6C7601, 0xFFAF8202, 0xFFBB7A01, 0xFF925703, 0xFF4A3800, 0xFF272901, 0xFF343601, 0xFF545D00,
+	0xFF6F9100, 0xFF83C600, 0xFF9DDE06, 0xFFBBD502, 0xFFCDBB06, 0xFFBE9D06, 0xFF798401, 0xFF486404,
+	0xFF616503, 0xFF998A03, 0xFFC29F06, 0xFFD3A104, 0xFFC39701, 0xFFAF8500, 0xFF827000, 0xFF4A5A04,
+	0xFF414C02, 0xFF655000, 0xFF916500, 0xFFA28302, 0xFFAE9E05, 0xFFAFB306, 0xFF9CAB0A, 0xFF709001,
+	0xFF5A6D00, 0xFF765000, 0xFF904000, 0xFF7A3F01, 0xFF4D4801, 0xFF394D01, 0xFF445C02, 0xFF617205,
+	0xFF788700, 0xFF8A9900, 0xFF9AA201, 0xFFA6A802, 0xFFA4AC05, 0xFF8EAD07, 0xFF75A600, 0xFF6E9901,
+	0xFF6B8C04, 0xFF648100, 0xFF6B7E01, 0xFF6E7F02, 0xFF657902, 0xFF446700, 0xFF295400, 0xFF2E4703,
+	0xFF3F4701, 0xFF5D5400, 0xFF856400, 0xFFA08102, 0xFFB29906, 0xFFB19B03, 0xFF8D8F00, 0xFF627E00,
+	0xFF4C7800, 0xFF597600, 0xFF837700, 0xFFA57401, 0xFFA17601, 0xFF7F7F01, 0xFF5C8A00, 0xFF4F9801,
+	0xFF5D9702, 0xFF7A8C03, 0xFF6D8006, 0xFF416501, 0xFF2F4D00, 0xFF3E4200, 0xFF6A4401, 0xFF985904,
+	0xFFA46505, 0xFF825903, 0xFF513901, 0xFF3B2101, 0xFF442602, 0xFF4A3A00, 0xFF4A5700, 0xFF4D7801,
+	0xFF6A9903, 0xFF8AB202, 0xFFA5B803, 0xFFA8B903, 0xFFA4B701, 0xFFB1B501, 0xFFB3BA03, 0xFF9CBF01,
+	0xFF69B801, 0xFF46A701, 0xFF4C8900, 0xFF5B6300, 0xFF6A4D00, 0xFF844201, 0xFF9B3F02, 0xFF924A02,
+	0xFF7B5C00, 0xFF746F00, 0xFF7D7902, 0xFF797F03, 0xFF648101, 0xFF466D00, 0xFF3B4E00, 0xFF533F00,
+	0xFF6E4100, 0xFF784A01, 0xFF6D5002, 0xFF605702, 0xFF5D6402, 0xFF5F7C01, 0xFF5D9401, 0xFF5F9C06,
+	0xFF728A05, 0xFF9C6400, 0xFFB74900, 0xFFC93E00, 0xFFBE4800, 0xFF944E00, 0xFF685300, 0xFF547600,
+	0xFF759B03, 0xFFA1A107, 0xFFA47A06, 0xFF784301, 0xFF3D2700, 0xFF353401, 0xFF555D02, 0xFF889002,
+	0xFFADB803, 0xFFAED506, 0xFF9FD203, 0xFFA4B202, 0xFFA09002, 0xFF8A6400, 0xFF604700, 0xFF504C06,
+	0xFF7E8807, 0xFFA3A305, 0xFFAB9E05, 0xFFA78104, 0xFF9B6502, 0xFF8D4E05, 0xFF713E02, 0xFF474300,
+	0xFF4C5F00, 0xFF7C7D03, 0xFFA99507, 0xFFC49E03, 0xFFCA9C01, 0xFFAF9705, 0xFF798704, 0xFF4D7200,
+	0xFF4C6A00, 0xFF756B00, 0xFF8B6C02, 0xFF6F6304, 0xFF4B5C00, 0xFF466700, 0xFF5E7F01, 0xFF7B9B04,
+	0xFF89B201, 0xFF8FBF00, 0xFF95C902, 0xFFA3CE06, 0xFFA4C704, 0xFF8BB804, 0xFF70A101, 0xFF568802,
+	0xFF457106, 0xFF545A00, 0xFF6D5500, 0xFF6F5700, 0xFF544C02, 0xFF313F02, 0xFF2C4101, 0xFF3F4A01,
+	0xFF535A00, 0xFF6E6A00, 0xFF897D00, 0xFF9F9803, 0xFFA8A505, 0xFF9B9200, 0xFF857100, 0xFF6E6701,
+	0xFF627100, 0xFF607F01, 0xFF737E04, 0xFF8E6A05, 0xFF985603, 0xFF934C00, 0xFF805500, 0xFF606F01,
+	0xFF567C03, 0xFF546F01, 0xFF485C00, 0xFF2D5400, 0xFF235A00, 0xFF456201, 0xFF806D04, 0xFFA77B07,
+	0xFF9F7A09, 0xFF726405, 0xFF444500, 0xFF413700, 0xFF614602, 0xFF706C01, 0xFF6A8F00, 0xFF63AC00,
+	0xFF77BA02, 0xFFA1B902, 0xFFBBB206, 0xFFAFAA04, 0xFFA39E00, 0xFFB29201, 0xFFC08A06, 0xFFA78503,
+	0xFF747A02, 0xFF546F01, 0xFF4A6C00, 0xFF446404, 0xFF466001, 0xFF5E5900, 0xFF814B00, 0xFF8E4200,
+	0xFF8C5000, 0xFF907403, 0xFF8F8F0D, 0xFF7A8D09, 0xFF577501, 0xFF315900, 0xFF364801, 0xFF604702,
+	0xFF7F5101, 0xFF7F5601, 0xFF6E5700, 0xFF6D5E00, 0xFF7E7204, 0xFF7F8503, 0xFF649601, 0xFF47A503,
+	0xFF4EA302, 0xFF838D01, 0xFFA87D01, 0xFFB87002, 0xFFB05B00, 0xFF944E01, 0xFF755E00, 0xFF678E00,
+	0xFF74AD03, 0xFF859806, 0xFF7F6102, 0xFF5A3602, 0xFF373303, 0xFF425C00, 0xFF789203, 0xFFBAB102,
+	0xFFD3BD03, 0xFFBDB80A, 0xFF919F04, 0xFF6A7400, 0xFF565000, 0xFF543900, 0xFF573E01, 0xFF646403,
+	0xFF839509, 0xFF7F8F05, 0xFF7F7501, 0xFF825E00, 0xFF824D00, 0xFF743E01, 0xFF653A00, 0xFF604C01,
+	0xFF6E7203, 0xFF809B03, 0xFF96A107, 0xFFB08E06, 0xFFB97800, 0xFF8F5D00, 0xFF535700, 0xFF386100,
+	0xFF547701, 0xFF818C02, 0xFF859702, 0xFF648E02, 0xFF508000, 0xFF608502, 0xFF779902, 0xFF8FA600,
+	0xFF9DB805, 0xFF9CCD03, 0xFF95D803, 0xFF8CCE07, 0xFF85B500, 0xFF7C9000, 0xFF657500, 0xFF456701,
+	0xFF365502, 0xFF464B00, 0xFF624501, 0xFF6B3E02, 0xFF503601, 0xFF393800, 0xFF444A02, 0xFF576405,
+	0xFF5E7701, 0xFF768200, 0xFF939702, 0xFF9EA805, 0xFF94A001, 0xFF787D03, 0xFF745C00, 0xFF855400,
+	0xFF8F6804, 0xFF7D7E05, 0xFF628401, 0xFF636C03, 0xFF7B4401, 0xFF902D00, 0xFF843500, 0xFF624600,
+	0xFF4C5101, 0xFF494C00, 0xFF4B4B00, 0xFF3E6700, 0xFF368C03, 0xFF4F9707, 0xFF728C02, 0xFF8C7900,
+	0xFF826A02, 0xFF5E5B02, 0xFF4C5500, 0xFF5C6100, 0xFF8C7906, 0xFFA29E06, 0xFF93B703, 0xFF79C301,
+	0xFF7EC103, 0xFFA4B606, 0xFFB3AD06, 0xFFA19B04, 0xFF8F7D00, 0xFF905E00, 0xFFA24901, 0xFF9C3F02,
+	0xFF7B3800, 0xFF683D00, 0xFF595000, 0xFF446703, 0xFF308307, 0xFF3B9003, 0xFF627C00, 0xFF835701,
+	0xFF9F4500, 0xFFAB5B04, 0xFF947508, 0xFF6E7005, 0xFF415B00, 0xFF265700, 0xFF436104, 0xFF796A08,
+	0xFF8F6A02, 0xFF7B6603, 0xFF6C6800, 0xFF7F7500, 0xFF9A7F01, 0xFF8E8003, 0xFF5D8100, 0xFF3B8800,
+	0xFF439800, 0xFF76A302, 0xFF97A806, 0xFF9A9F06, 0xFF8D8703, 0xFF887A01, 0xFF8A8303, 0xFF7A9601,
+	0xFF678F03, 0xFF5E6B01, 0xFF664300, 0xFF553D01, 0xFF435E04, 0xFF538B02, 0xFF86A504, 0xFFC2A802,
+	0xFFCE9900, 0xFFAB7800, 0xFF6A5700, 0xFF3F3A00, 0xFF363200, 0xFF4C4300, 0xFF736A0A, 0xFF819105,
+	0xFF6C8205, 0xFF596D00, 0xFF6B6200, 0xFF876400, 0xFF886600, 0xFF765A00, 0xFF694E01, 0xFF785005,
+	0xFF816504, 0xFF6F7703, 0xFF5D7603, 0xFF746402, 0xFF864F00, 0xFF6B4602, 0xFF405401, 0xFF336C02,
+	0xFF588C01, 0xFF82A301, 0xFF81AB00, 0xFF65A501, 0xFF58A000, 0xFF6B9E02, 0xFF859805, 0xFF999300,
+	0xFFADA002, 0xFFB2B602, 0xFF9EBB02, 0xFF76AF02, 0xFF618A03, 0xFF626200, 0xFF684C00, 0xFF594A01,
+	0xFF434E01, 0xFF3C5501, 0xFF565104, 0xFF644802, 0xFF584400, 0xFF504F01, 0xFF5C6600, 0xFF697D01,
+	0xFF698E00, 0xFF839B00, 0xFFA3AE00, 0xFFA2B000, 0xFF7B9201, 0xFF526C01, 0xFF594E00, 0xFF8F3D00,
+	0xFFAB4705, 0xFF985B06, 0xFF6D6500, 0xFF536101, 0xFF624900, 0xFF7D3500, 0xFF7C3500, 0xFF5E4200,
+	0xFF484C00, 0xFF554F01, 0xFF6D5E01, 0xFF708301, 0xFF569E01, 0xFF429D05, 0xFF428503, 0xFF566A00,
+	0xFF686202, 0xFF5E7000, 0xFF648700, 0xFF7EA101, 0xFFA9AD00, 0xFFC3AF05, 0xFFA4AA04, 0xFF78A700,
+	0xFF7DA603, 0xFF9B9A04, 0xFF9F9404, 0xFF817C02, 0xFF645E01, 0xFF5E4200, 0xFF732A02, 0xFF8A1801,
+	0xFF8B1700, 0xFF852500, 0xFF7D3A00, 0xFF586200, 0xFF3B8C03, 0xFF32AE01, 0xFF49A200, 0xFF6A7500,
+	0xFF944B00, 0xFFAC3F00, 0xFF984000, 0xFF6B3F00, 0xFF3C4C00, 0xFF366E01, 0xFF5A8F00, 0xFF8A9605,
+	0xFF948103, 0xFF777301, 0xFF6E7B01, 0xFF898D01, 0xFF9F8A00, 0xFF847B01, 0xFF497000, 0xFF337700,
+	0xFF4E8600, 0xFF7F9800, 0xFF95A001, 0xFF919A03, 0xFF7B9404, 0xFF7C9603, 0xFF8D9803, 0xFF7B8702,
+	0xFF5B6200, 0xFF524600, 0xFF6F4901, 0xFF7A6C02, 0xFF619404, 0xFF57A506, 0xFF709C01, 0xFF998806,
+	0xFFA66601, 0xFF813E01, 0xFF4B2E03, 0xFF352D00, 0xFF4B4900, 0xFF777404, 0xFF8F9409, 0xFF809705,
+	0xFF566800, 0xFF596C00, 0xFF798704, 0xFF959704, 0xFF8B9003, 0xFF6F7601, 0xFF6E5701, 0xFF7E3F04,
+	0xFF803A00, 0xFF5F3A00, 0xFF3E4100, 0xFF534600, 0xFF6C5001, 0xFF625F01, 0xFF447002, 0xFF418702,
+	0xFF61A104, 0xFF82AF01, 0xFF81B300, 0xFF67AF03, 0xFF5CAC05, 0xFF64A402, 0xFF778D02, 0xFF887B00,
+	0xFFA57F00, 0xFFAF8901, 0xFF958B00, 0xFF628201, 0xFF486406, 0xFF4E5001, 0xFF6E4300, 0xFF704301,
+	0xFF4D5001, 0xFF3F6700, 0xFF527C02, 0xFF5E8201, 0xFF687A02, 0xFF707501, 0xFF738100, 0xFF748F03,
+	0xFF769F02, 0xFF95AF00, 0xFFACB302, 0xFF989B02, 0xFF647503, 0xFF3A5A00, 0xFF484A00, 0xFF7F3E00,
+	0xFF9C3900, 0xFFA03C00, 0xFF8D3E00, 0xFF6E4B00, 0xFF675001, 0xFF734801, 0xFF6D4800, 0xFF545303,
+	0xFF4D5D06, 0xFF736405, 0xFF9B6802, 0xFFA07004, 0xFF727C01, 0xFF3C7C00, 0xFF307100, 0xFF437500,
+	0xFF618601, 0xFF6BA300, 0xFF70BF02, 0xFF7ECD07, 0xFF98C501, 0xFFA8A600, 0xFF958001, 0xFF706B00,
+	0xFF726700, 0xFF8D6502, 0xFF905E02, 0xFF745300, 0xFF534F03, 0xFF4A4C01, 0xFF574502, 0xFF6E3701,
+	0xFF902A00, 0xFF9B2D01, 0xFF8D3D01, 0xFF6A5400, 0xFF547100, 0xFF409B00, 0xFF419F03, 0xFF527C00,
+	0xFF795700, 0xFF943B00, 0xFF952D00, 0xFF723100, 0xFF575000, 0xFF5B8505, 0xFF71A901, 0xFF8BA504,
+	0xFF8B8C05, 0xFF767900, 0xFF768401, 0xFF889302, 0xFF8A8900, 0xFF687300, 0xFF406D00, 0xFF3C8200,
+	0xFF5D8F00, 0xFF819100, 0xFF948300, 0xFF877503, 0xFF757801, 0xFF7D8002, 0xFF887B01, 0xFF6B6301,
+	0xFF534501, 0xFF6C4700, 0xFF976D01, 0xFFA89903, 0xFF84A701, 0xFF549B01, 0xFF527B00, 0xFF645701,
+	0xFF783700, 0xFF6F2C02, 0xFF4D3D01, 0xFF465E00, 0xFF6F8302, 0xFF959907, 0xFF899103, 0xFF697500,
+	0xFF5F5A02, 0xFF7B8300, 0xFF93AB0B, 0xFF8CBA07, 0xFF6DAA04, 0xFF4F8701, 0xFF536100, 0xFF763901,
+	0xFF801E03, 0xFF661A00, 0xFF512900, 0xFF584C00, 0xFF707503, 0xFF718A02, 0xFF5F9700, 0xFF61AB00,
+	0xFF78BA03, 0xFF89BA00, 0xFF7BB000, 0xFF5EA501, 0xFF539D06, 0xFF549001, 0xFF597D00, 0xFF6C6C00,
+	0xFF8C6100, 0xFF956002, 0xFF8A5C02, 0xFF5F5901, 0xFF445600, 0xFF4F5000, 0xFF6D4900, 0xFF704800,
+	0xFF575B00, 0xFF507C00, 0xFF63A301, 0xFF73B602, 0xFF79AC03, 0xFF809A01, 0xFF819200, 0xFF7E9402,
+	0xFF899F03, 0xFFA1A603, 0xFFA5910B, 0xFF806903, 0xFF484E00, 0xFF2C4D00, 0xFF395D03, 0xFF546600,
+	0xFF685F00, 0xFF865504, 0xFF895103, 0xFF864F03, 0xFF834903, 0xFF744701, 0xFF654801, 0xFF535203,
+	0xFF575604, 0xFF835904, 0xFFB04F05, 0xFFAD4505, 0xFF784B01, 0xFF475A00, 0xFF4C7401, 0xFF648E01,
+	0xFF6BA700, 0xFF64B900, 0xFF5ABE04, 0xFF5BC208, 0xFF65B403, 0xFF6B8F02, 0xFF616602, 0xFF564A01,
+	0xFF664301, 0xFF824302, 0xFF8A4100, 0xFF7E4701, 0xFF685900, 0xFF546C02, 0xFF4D7402, 0xFF5B6E02,
+	0xFF846104, 0xFFA55507, 0xFF894F01, 0xFF6A4900, 0xFF5A4F02, 0xFF536201, 0xFF4C6F02, 0xFF4B6D02,
+	0xFF5F6502, 0xFF7A5702, 0xFF854B01, 0xFF824A00, 0xFF826401, 0xFF798B03, 0xFF72A101, 0xFF7A9701,
+	0xFF818400, 0xFF7D8000, 0xFF7E8C00, 0xFF808903, 0xFF707101, 0xFF566100, 0xFF506E00, 0xFF5D8E02,
+	0xFF74A406, 0xFF819A07, 0xFF7D7301, 0xFF685500, 0xFF6D4900, 0xFF744900, 0xFF734701, 0xFF5D4404,
+	0xFF5C5000, 0xFF8F6D04, 0xFFBD8802, 0xFFBA9603, 0xFF8C8F05, 0xFF4E7800, 0xFF3B5600, 0xFF4C3A00,
+	0xFF632F01, 0xFF704601, 0xFF657300, 0xFF63A000, 0xFF75A906, 0xFF838F0C, 0xFF746702, 0xFF614D00,
+	0xFF955B06, 0xFFA78603, 0xFF9A9D07, 0xFF70A602, 0xFF40A600, 0xFF2C9500, 0xFF397D03, 0xFF5A5F03,
+	0xFF733A03, 0xFF7B2B01, 0xFF783B00, 0xFF786802, 0xFF899307, 0xFF8BAA03, 0xFF82B402, 0xFF8ABF07,
+	0xFF90C403, 0xFF87B702, 0xFF699B01, 0xFF4F8400, 0xFF487800, 0xFF507300, 0xFF4F7100, 0xFF566B00,
+	0xFF676201, 0xFF755603, 0xFF744E02, 0xFF645101, 0xFF5A5B00, 0xFF5E6200, 0xFF676401, 0xFF696302,
+	0xFF5F6C01, 0xFF638501, 0xFF82A105, 0xFF8FB204, 0xFF83AE00, 0xFF7E9802, 0xFF7D8402, 0xFF857900,
+	0xFF957F03, 0xFF987C05, 0xFF865D07, 0xFF5C3A01, 0xFF3A3500, 0xFF2C5500, 0xFF358102, 0xFF469F05,
+	0xFF4AA506, 0xFF569B03, 0xFF6A8701, 0xFF7C6B06, 0xFF874C03, 0xFF753B01, 0xFF553701, 0xFF4F4200,
+	0xFF634B00, 0xFF8B4A00, 0xFFB33B01, 0xFFAA2D02, 0xFF753100, 0xFF584D01, 0xFF697507, 0xFF808B03,
+	0xFF6F8F00, 0xFF478801, 0xFF398301, 0xFF338E00, 0xFF319300, 0xFF368601, 0xFF347100, 0xFF3D6604,
+	0xFF616601, 0xFF875F00, 0xFF905500, 0xFF835600, 0xFF796200, 0xFF697201, 0xFF597B00, 0xFF5F8602,
+	0xFF758E0A, 0xFF8C7F06, 0xFF766600, 0xFF5A4A00, 0xFF503903, 0xFF4B3502, 0xFF443F01, 0xFF4F5301,
+	0xFF656901, 0xFF787701, 0xFF7B7700, 0xFF867601, 0xFF8E7C01, 0xFF7F8701, 0xFF688C00, 0xFF678700,
+	0xFF738200, 0xFF839201, 0xFF889904, 0xFF798502, 0xFF5E6400, 0xFF515300, 0xFF646300, 0xFF858705,
+	0xFF90A207, 0xFF769808, 0xFF566A01, 0xFF4C4100, 0xFF572E00, 0xFF5B2F00, 0xFF583A01, 0xFF5A5001,
+	0xFF746C01, 0xFF9F8201, 0xFFB68202, 0xFFAB720B, 0xFF826007, 0xFF476000, 0xFF395D00, 0xFF4A5201,
+	0xFF6C5003, 0xFF846C01, 0xFF7E9500, 0xFF6AAD03, 0xFF539F05, 0xFF516F02, 0xFF544D00, 0xFF704902,
+	0xFFAE7600, 0xFFC37203, 0xFFA06E02, 0xFF577900, 0xFF2E8900, 0xFF199701, 0xFF1AA101, 0xFF399700,
+	0xFF597B00, 0xFF7B5D00, 0xFF985C00, 0xFFA77504, 0xFFA6960A, 0xFF9BA904, 0xFF91AF02, 0xFF93AE04,
+	0xFF8CA004, 0xFF708502, 0xFF4B6400, 0xFF3C5601, 0xFF4D5B00, 0xFF646503, 0xFF5F7503, 0xFF4F7801,
+	0xFF4C7201, 0xFF526900, 0xFF576900, 0xFF636800, 0xFF717201, 0xFF778005, 0xFF708506, 0xFF628102,
+	0xFF587A02, 0xFF6B7A01, 0xFF8D8205, 0xFF988B02, 0xFF908600, 0xFF7A7901, 0xFF726501, 0xFF7E5800,
+	0xFF8D5700, 0xFF895200, 0xFF693C00, 0xFF4A2800, 0xFF453000, 0xFF485E00, 0xFF569602, 0xFF56BB04,
+	0xFF46C303, 0xFF34BD00, 0xFF40A601, 0xFF548303, 0xFF645500, 0xFF643800, 0xFF523800, 0xFF5B4F00,
+	0xFF766201, 0xFF9F6501, 0xFFB44D00, 0xFFA03A00, 0xFF6E3D00, 0xFF654D01, 0xFF7F6705, 0xFF927202,
+	0xFF6F5D02, 0xFF3B4800, 0xFF2F4400, 0xFF2A5200, 0xFF2A6A03, 0xFF2B7F02, 0xFF338C00, 0xFF4C9A00,
+	0xFF6CA500, 0xFF889A02, 0xFF837C04, 0xFF7F6300, 0xFF845B01, 0xFF775F00, 0xFF676500, 0xFF6A7501,
+	0xFF6C8802, 0xFF6D8901, 0xFF647501, 0xFF4E5601, 0xFF3C3E01, 0xFF312E00, 0xFF3E2E00, 0xFF5F4700,
+	0xFF816805, 0xFF8B7B04, 0xFF7A8502, 0xFF7A8805, 0xFF7D8602, 0xFF708701, 0xFF628200, 0xFF608100,
+	0xFF6D8E01, 0xFF82A305, 0xFF87A606, 0xFF728B01, 0xFF566800, 0xFF575B02, 0xFF7C6605, 0xFF9A8008,
+	0xFF938707, 0xFF637102, 0xFF3E4D00, 0xFF3D3400, 0xFF413700, 0xFF474404, 0xFF4E5801, 0xFF676A00,
+	0xFF827700, 0xFF957800, 0xFF9A6501, 0xFF914F03, 0xFF784F00, 0xFF4B6A00, 0xFF348000, 0xFF468707,
+	0xFF718607, 0xFF9A8501, 0xFF898800, 0xFF587D03, 0xFF2F7201, 0xFF226200, 0xFF476202, 0xFF837300,
+	0xFF99A300, 0xFFB77B02, 0xFF9D6101, 0xFF5D6300, 0xFF357500, 0xFF1E8D01, 0xFF20A102, 0xFF2DAA05,
+	0xFF459802, 0xFF677800, 0xFF9B6001, 0xFFBC6900, 0xFFB37C00, 0xFF8D8703, 0xFF7B8201, 0xFF787400,
+	0xFF6D6100, 0xFF535200, 0xFF3B4A00, 0xFF385702, 0xFF586904, 0xFF747605, 0xFF6C8306, 0xFF528102,
+	0xFF427D00, 0xFF427D01, 0xFF508301, 0xFF658800, 0xFF798A02, 0xFF878C06, 0xFF798B06, 0xFF578502,
+	0xFF4D7F02, 0xFF627400, 0xFF7B6D00, 0xFF886D00, 0xFF806B00, 0xFF686400, 0xFF605900, 0xFF725000,
+	0xFF8B4702, 0xFF844101, 0xFF5E3700, 0xFF482C00, 0xFF4A3500, 0xFF6A5800, 0xFF898003, 0xFF849901,
+	0xFF55A300, 0xFF2AA500, 0xFF219D00, 0xFF347D00, 0xFF455500, 0xFF574600, 0xFF6A5604, 0xFF867904,
+	0xFF9E9305, 0xFFAB8F04, 0xFF9C7606, 0xFF7F5804, 0xFF664602, 0xFF6B5100, 0xFF8D6B05, 0xFF987209,
+	0xFF655A02, 0xFF393A00, 0xFF362B00, 0xFF3E3302, 0xFF4C4904, 0xFF4F6701, 0xFF608600, 0xFF76A201,
+	0xFF83B608, 0xFF77AF06, 0xFF5E9204, 0xFF697400, 0xFF7A6601, 0xFF7B5D01, 0xFF725201, 0xFF6D5201,
+	0xFF715900, 0xFF726400, 0xFF5C6701, 0xFF485B02, 0xFF364A01, 0xFF2F3D00, 0xFF4A4200, 0xFF775903,
+	0xFF996A04, 0xFF947204, 0xFF7E7B02, 0xFF688402, 0xFF658102, 0xFF637C01, 0xFF617B01, 0xFF688200,
+	0xFF7C9604, 0xFF89A203, 0xFF829E00, 0xFF688F00, 0xFF567B02, 0xFF697504, 0xFF8E7A05, 0xFF997C07,
+	0xFF776C03, 0xFF464D00, 0xFF333A00, 0xFF463B01, 0xFF555003, 0xFF546803, 0xFF597703, 0xFF707B01,
+	0xFF7E7900, 0xFF7F7600, 0xFF7D6501, 0xFF7F4C00, 0xFF7A4F01, 0xFF5B6802, 0xFF388700, 0xFF3DA101,
+	0xFF639D02, 0xFF928201, 0xFF836401, 0xFF4A4E00, 0xFF234C00, 0xFF176C01, 0xFF409401, 0xFF7AA805,
+	0xFF7BC400, 0xFF98A102, 0xFF918300, 0xFF6F7400, 0xFF477600, 0xFF2C7F00, 0xFF348403, 0xFF378905,
+	0xFF3B8202, 0xFF586B00, 0xFF925100, 0xFFBD4C00, 0xFFB04B03, 0xFF7E4D06, 0xFF5B4902, 0xFF574101,
+	0xFF574403, 0xFF515300, 0xFF506300, 0xFF517704, 0xFF5A8404, 0xFF6D8500, 0xFF6F7B04, 0xFF587601,
+	0xFF477A00, 0xFF498103, 0xFF548B04, 0xFF618F01, 0xFF748801, 0xFF808101, 0xFF7A7C00, 0xFF607D01,
+	0xFF557B02, 0xFF567801, 0xFF607302, 0xFF6A6E02, 0xFF626B01, 0xFF4E6602, 0xFF4A6000, 0xFF5F5800,
+	0xFF784F01, 0xFF744A01, 0xFF573F00, 0xFF443802, 0xFF4E3C03, 0xFF844A00, 0xFFB35906, 0xFFAD6602,
+	0xFF776F00, 0xFF3D7C01, 0xFF277E00, 0xFF2E7001, 0xFF495D00, 0xFF6A5F01, 0xFF8C7E03, 0xFFAA9C01,
+	0xFFB1AB03, 0xFF939E02, 0xFF737C06, 0xFF5C5A04, 0xFF5E4803, 0xFF7C5201, 0xFF9D7303, 0xFF928505,
+	0xFF5D7200, 0xFF364F00, 0xFF423B00, 0xFF643903, 0xFF6E3F05, 0xFF6A5100, 0xFF806800, 0xFF987B01,
+	0xFF978708, 0xFF6B8B03, 0xFF4E8E01, 0xFF508D00, 0xFF658600, 0xFF6F7601, 0xFF6A5903, 0xFF6E3F01,
+	0xFF7D3101, 0xFF823402, 0xFF6D4301, 0xFF504D03, 0xFF3A4F00, 0xFF405700, 0xFF606803, 0xFF8E7807,
+	0xFFA27500, 0xFF917200, 0xFF7D7600, 0xFF637D00, 0xFF547B00, 0xFF557600, 0xFF647700, 0xFF738101,
+	0xFF8B8509, 0xFF918904, 0xFF7E8800, 0xFF648100, 0xFF617B03, 0xFF7B7806, 0xFF927803, 0xFF827300,
+	0xFF546600, 0xFF365600, 0xFF404F00, 0xFF615703, 0xFF716708, 0xFF657504, 0xFF5E7803, 0xFF707B01,
+	0xFF777F00, 0xFF718401, 0xFF657A01, 0xFF635C01, 0xFF704704, 0xFF6B4B05, 0xFF526502, 0xFF548100,
+	0xFF6E8703, 0xFF827102, 0xFF784B00, 0xFF503E00, 0xFF2E5300, 0xFF2E8500, 0xFF44B700, 0xFF5BCD05,
+	0xFF6BCA03, 0xFF87BB01, 0xFF8FA302, 0xFF758609, 0xFF496D05, 0xFF3C6300, 0xFF446100, 0xFF486200,
+	0xFF456900, 0xFF566400, 0xFF865100, 0xFFAF3B01, 0xFFA23002, 0xFF722A01, 0xFF4A2E00, 0xFF543F00,
+	0xFF675D07, 0xFF6E7C04, 0xFF6E8B00, 0xFF628304, 0xFF5A7C04, 0xFF607101, 0xFF676103, 0xFF586203,
+	0xFF4C6F02, 0xFF4D7C00, 0xFF578201, 0xFF5C7F01, 0xFF6C7800, 0xFF727600, 0xFF777502, 0xFF717A02,
+	0xFF647A03, 0xFF547505, 0xFF4F7505, 0xFF557604, 0xFF567500, 0xFF436D00, 0xFF3A6400, 0xFF4D5D00,
+	0xFF6B5402, 0xFF674F01, 0xFF4C4801, 0xFF414800, 0xFF594D01, 0xFF8C5600, 0xFFBA5603, 0xFFBB5401,
+	0xFF905700, 0xFF586406, 0xFF376E04, 0xFF397400, 0xFF617900, 0xFF908601, 0xFFAEA501, 0xFFB5B703,
+	0xFF9CAA01, 0xFF728401, 0xFF595C00, 0xFF644000, 0xFF723A01, 0xFF894401, 0xFFA36000, 0xFF907600,
+	0xFF557700, 0xFF366602, 0xFF515B02, 0xFF7F5801, 0xFF855302, 0xFF7C5102, 0xFF8A5003, 0xFF9E4A03,
+	0xFF934700, 0xFF665600, 0xFF517103, 0xFF468B01, 0xFF509302, 0xFF548100, 0xFF506400, 0xFF614A03,
+	0xFF7E3601, 0xFF8B2A04, 0xFF783001, 0xFF573F00, 0xFF4C5400, 0xFF556E00, 0xFF738903, 0xFF909302,
+	0xFF989003, 0xFF8F8902, 0xFF778600, 0xFF638501, 0xFF548303, 0xFF538403, 0xFF638401, 0xFF787E00,
+	0xFF867602, 0xFF8D7002, 0xFF826801, 0xFF6A6103, 0xFF6B6102, 0xFF7C6500, 0xFF8A6404, 0xFF796102,
+	0xFF4C6500, 0xFF2D6C00, 0xFF457201, 0xFF757401, 0xFF817601, 0xFF697201, 0xFF5D6F00, 0xFF737404,
+	0xFF817D03, 0xFF708000, 0xFF527100, 0xFF435802, 0xFF5A4100, 0xFF7E3F00, 0xFF884F02, 0xFF805F00,
+	0xFF7B6600, 0xFF745D03, 0xFF684701, 0xFF634000, 0xFF5C6603, 0xFF56A103, 0xFF4ECE00, 0xFF48D800,
+	0xFF67C200, 0xFF7EB300, 0xFF849202, 0xFF626F09, 0xFF445205, 0xFF564100, 0xFF674100, 0xFF6C4F00,
+	0xFF5D7100, 0xFF567C00, 0xFF746D05, 0xFF954D06, 0xFF813C00, 0xFF5A3A00, 0xFF524700, 0xFF706404,
+	0xFF8A8804, 0xFF889C01, 0xFF749000, 0xFF5F7402, 0xFF586204, 0xFF605802, 0xFF6A5400, 0xFF605800,
+	0xFF556400, 0xFF547200, 0xFF607500, 0xFF637700, 0xFF677900, 0xFF687B00, 0xFF707902, 0xFF7A7501,
+	0xFF6D7002, 0xFF526600, 0xFF476800, 0xFF507200, 0xFF5A7901, 0xFF4A7503, 0xFF386F01, 0xFF476400,
+	0xFF635603, 0xFF5D5000, 0xFF485300, 0xFF445E00, 0xFF5D6700, 0xFF896900, 0xFFB75E05, 0xFFB85504,
+	0xFF945000, 0xFF5F5702, 0xFF3F6102, 0xFF4D7702, 0xFF7E9800, 0xFFADB100, 0xFFB6C301, 0xFFA1BF08,
+	0xFF779F03, 0xFF547000, 0xFF535100, 0xFF6F3F03, 0xFF843503, 0xFF8F3200, 0xFFA33D01, 0xFF9C5601,
+	0xFF5F6C01, 0xFF387606, 0xFF547803, 0xFF807200, 0xFF7F6800, 0xFF755D00, 0xFF875003, 0xFF933902,
+	0xFF862700, 0xFF762900, 0xFF6C4204, 0xFF5A5F02, 0xFF437101, 0xFF357700, 0xFF3B7701, 0xFF5D7501,
+	0xFF766900, 0xFF7D5100, 0xFF743B00, 0xFF673F00, 0xFF6D5B00, 0xFF7E7F02, 0xFF899702, 0xFF87A600,
+	0xFF84A801, 0xFF87A901, 0xFF7AA200, 0xFF669801, 0xFF5C9200, 0xFF5C9200, 0xFF658D01, 0xFF717D00,
+	0xFF7E6400, 0xFF865200, 0xFF874600, 0xFF754503, 0xFF6A4E02, 0xFF775400, 0xFF865202, 0xFF795101,
+	0xFF565800, 0xFF3C6A00, 0xFF4C8001, 0xFF7F8A00, 0xFF838B00, 0xFF647E00, 0xFF5E6F00, 0xFF716701,
+	0xFF826204, 0xFF6A5D00, 0xFF404F00, 0xFF374605, 0xFF614F03, 0xFF9D6203, 0xFFAC6A01, 0xFF946401,
+	0xFF7D5302, 0xFF6F4402, 0xFF604300, 0xFF6F4A03, 0xFF896C06, 0xFF85AB02, 0xFF64D000, 0xFF50D100,
+	0xFF62AA02, 0xFF659103, 0xFF626901, 0xFF4E5000, 0xFF5F4101, 0xFF853300, 0xFF933D01, 0xFF8E5700,
+	0xFF757800, 0xFF5E8802, 0xFF668004, 0xFF7A6C02, 0xFF715E00, 0xFF5B6400, 0xFF677901, 0xFF8E8C02,
+	0xFF9C9601, 0xFF878E02, 0xFF6B7802, 0xFF5A6500, 0xFF586300, 0xFF5E6401, 0xFF666103, 0xFF625F01,
+	0xFF5C6900, 0xFF647200, 0xFF6F7601, 0xFF687900, 0xFF607A00, 0xFF5C7503, 0xFF656C00, 0xFF775F00,
+	0xFF6E5A02, 0xFF535E00, 0xFF4A6A00, 0xFF5A7800, 0xFF688203, 0xFF5C8502, 0xFF458502, 0xFF437303,
+	0xFF585802, 0xFF664D00, 0xFF625B00, 0xFF597005, 0xFF647006, 0xFF866104, 0xFFA65403, 0xFFA24C02,
+	0xFF7F4600, 0xFF574F00, 0xFF436300, 0xFF558603, 0xFF89A806, 0xFFB5BC03, 0xFFB3BB00, 0xFF84AA02,
+	0xFF578E02, 0xFF457700, 0xFF5B6B02, 0xFF795D04, 0xFF814902, 0xFF8D3B00, 0xFF9E4800, 0xFFA66503,
+	0xFF768003, 0xFF438901, 0xFF4C7D01, 0xFF6A6701, 0xFF775800, 0xFF785400, 0xFF824D00, 0xFF8A3603,
+	0xFF802203, 0xFF861400, 0xFF851A01, 0xFF643002, 0xFF444F00, 0xFF377100, 0xFF499201, 0xFF69A100,
+	0xFF709C01, 0xFF6A7D02, 0xFF6D5A00, 0xFF805300, 0xFF936C02, 0xFF998B02, 0xFF929C00, 0xFF86A903,
+	0xFF7EB001, 0xFF74B300, 0xFF6AA902, 0xFF679504, 0xFF648D00, 0xFF6C8900, 0xFF678201, 0xFF5B7103,
+	0xFF6B5401, 0xFF843E00, 0xFF873900, 0xFF774301, 0xFF685301, 0xFF6C5702, 0xFF754F01, 0xFF714801,
+	0xFF5C4B01, 0xFF515F00, 0xFF638300, 0xFF89A000, 0xFF84AB00, 0xFF5B9401, 0xFF527201, 0xFF694D00,
+	0xFF703D03, 0xFF633700, 0xFF4B3B00, 0xFF4D5602, 0xFF7F7A08, 0xFFA99305, 0xFFA58D02, 0xFF867002,
+	0xFF705201, 0xFF734700, 0xFF6C4F00, 0xFF7A6000, 0xFF9F7A04, 0xFFABA103, 0xFF80B801, 0xFF5CBA00,
+	0xFF537C05, 0xFF4A5B02, 0xFF3A4906, 0xFF3A4F00, 0xFF674E00, 0xFF984801, 0xFFB04E02, 0xFFA56000,
+	0xFF837502, 0xFF687E02, 0xFF647E00, 0xFF6D7E00, 0xFF707C00, 0xFF6C8A05, 0xFF7E9504, 0xFF969700,
+	0xFF898B02, 0xFF697801, 0xFF597003, 0xFF5C7400, 0xFF627A01, 0xFF607B01, 0xFF587404, 0xFF527002,
+	0xFF5B7800, 0xFF757B00, 0xFF7A7E05, 0xFF667C02, 0xFF507301, 0xFF476702, 0xFF575A00, 0xFF6F4F00,
+	0xFF785500, 0xFF6C6C01, 0xFF638404, 0xFF6D8D01, 0xFF778A00, 0xFF6B8600, 0xFF508603, 0xFF3E7F04,
+	0xFF546501, 0xFF7A5601, 0xFF825D02, 0xFF6A6A02, 0xFF626603, 0xFF7D5502, 0xFF914C00, 0xFF8B4600,
+	0xFF704C00, 0xFF556404, 0xFF4F8602, 0xFF54A300, 0xFF78AB05, 0xFFAC9906, 0xFFB07F03, 0xFF7A7003,
+	0xFF486905, 0xFF357C00, 0xFF508B02, 0xFF708302, 0xFF757200, 0xFF8E6C00, 0xFFB08003, 0xFFB59904,
+	0xFF81A700, 0xFF429800, 0xFF386E05, 0xFF574B01, 0xFF7D3700, 0xFF8B3401, 0xFF873D00, 0xFF803602,
+	0xFF851F02, 0xFF941000, 0xFF941001, 0xFF752302, 0xFF614100, 0xFF646F06, 0xFF7C9C04, 0xFF77B000,
+	0xFF5AA901, 0xFF4E8E02, 0xFF647D00, 0xFF997804, 0xFFB08806, 0xFFA79900, 0xFF9E9900, 0xFF939D04,
+	0xFF7EA304, 0xFF659F01, 0xFF568E02, 0xFF597903, 0xFF696C01, 0xFF756800, 0xFF686801, 0xFF555E04,
+	0xFF595300, 0xFF7B4D01, 0xFF854F00, 0xFF755900, 0xFF615B00, 0xFF565501, 0xFF554A01, 0xFF633F01,
+	0xFF644300, 0xFF6A5E02, 0xFF8A8A02, 0xFF9BB500, 0xFF7FC302, 0xFF4FA203, 0xFF366901, 0xFF4D3A00,
+	0xFF632F00, 0xFF6C3D04, 0xFF6E5D01, 0xFF7E8500, 0xFFA1AD02, 0xFF9FB302, 0xFF859702, 0xFF697400,
+	0xFF696500, 0xFF7E6700, 0xFF837002, 0xFF8F7F01, 0xFFA78501, 0xFFB27D03, 0xFF8D7A04, 0xFF618000,
+	0xFF394404, 0xFF2A3700, 0xFF194102, 0xFF255900, 0xFF526F00, 0xFF8A7802, 0xFFAD7502, 0xFFAB7A05,
+	0xFF898404, 0xFF678900, 0xFF618B03, 0xFF6B8501, 0xFF728000, 0xFF7B8504, 0xFF998405, 0xFF8F8201,
+	0xFF697800, 0xFF517500, 0xFF4D7802, 0xFF5E7A07, 0xFF627D04, 0xFF5F7F00, 0xFF527D01, 0xFF4C7D00,
+	0xFF5A8100, 0xFF798200, 0xFF7B8403, 0xFF628401, 0xFF427B01, 0xFF3A7000, 0xFF536700, 0xFF796500,
+	0xFF936E01, 0xFF948202, 0xFF859103, 0xFF778F04, 0xFF708201, 0xFF667100, 0xFF526C00, 0xFF427700,
+	0xFF587400, 0xFF806603, 0xFF8C5605, 0xFF6D5500, 0xFF5F5700, 0xFF765B00, 0xFF8B6400, 0xFF8B6300,
+	0xFF867302, 0xFF7B9507, 0xFF6CB207, 0xFF57B403, 0xFF619700, 0xFF8B6601, 0xFF9F3C04, 0xFF7A3900,
+	0xFF534C01, 0xFF3F7300, 0xFF4E8F00, 0xFF5F9401, 0xFF6F9303, 0xFF979902, 0xFFC1A202, 0xFFBBAC02,
+	0xFF81A101, 0xFF378602, 0xFF146602, 0xFF3D4700, 0xFF7B3200, 0xFF9E2E00, 0xFF9A3901, 0xFF7D3C01,
+	0xFF7E3000, 0xFF932A00, 0xFF9D2801, 0xFF962F01, 0xFF904200, 0xFF966A01, 0xFFA78D07, 0xFF819905,
+	0xFF449700, 0xFF359400, 0xFF619701, 0xFF979F06, 0xFFB29D07, 0xFFA69503, 0xFF978900, 0xFF918500,
+	0xFF787F01, 0xFF517904, 0xFF3D6C01, 0xFF445E00, 0xFF5D5600, 0xFF785400, 0xFF6F5A00, 0xFF5D5F00,
+	0xFF656E04, 0xFF808205, 0xFF857B01, 0xFF676B01, 0xFF4A5601, 0xFF394400, 0xFF403D01, 0xFF5D3E01,
+	0xFF774C00, 0xFF916703, 0xFFAD8906, 0xFFAEA806, 0xFF79AC01, 0xFF3A8E01, 0xFF256400, 0xFF3B4C01,
+	0xFF5F5503, 0xFF806C05, 0xFF958F01, 0xFFAFB703, 0xFFB2C900, 0xFF90BD00, 0xFF6A9D00, 0xFF5A8400,
+	0xFF738101, 0xFF898803, 0xFF8A8A03, 0xFF8F8007, 0xFF986E02, 0xFF9A4D02, 0xFF833A03, 0xFF544300,
+	0xFF393200, 0xFF1F4100, 0xFF125200, 0xFF226C00, 0xFF4A9102, 0xFF85A306, 0xFFA5A605, 0xFFA6A409,
+	0xFF889F02, 0xFF659F00, 0xFF599708, 0xFF5A8201, 0xFF6C7200, 0xFF8B6900, 0xFFA46604, 0xFF8A6502,
+	0xFF556B00, 0xFF427400, 0xFF487501, 0xFF546E02, 0xFF5A7000, 0xFF627D00, 0xFF5F8800, 0xFF568900,
+	0xFF5C8402, 0xFF7D8403, 0xFF838A00, 0xFF6A9300, 0xFF449900, 0xFF3C9600, 0xFF5A9000, 0xFF818E00,
+	0xFFA08C00, 0xFFA58402, 0xFF927B02, 0xFF787003, 0xFF636002, 0xFF5C5502, 0xFF585400, 0xFF506804,
+	0xFF5E7403, 0xFF796302, 0xFF7E4901, 0xFF754300, 0xFF795B00, 0xFF838200, 0xFF8C9900, 0xFF919C00,
+	0xFF9CA300, 0xFFA2B001, 0xFF78B802, 0xFF469D05, 0xFF3F6B01, 0xFF6A4300, 0xFF962E00, 0xFF9B3400,
+	0xFF855200, 0xFF6E7E00, 0xFF619902, 0xFF639A05, 0xFF749905, 0xFF8D9402, 0xFFAF8705, 0xFFAE7803,
+	0xFF706A01, 0xFF2D5F04, 0xFF075F00, 0xFF265C01, 0xFF6D5100, 0xFFA25400, 0xFFA35E00, 0xFF7C6600,
+	0xFF6E6800, 0xFF806200, 0xFF915900, 0xFF9D5100, 0xFFAB5900, 0xFFBF6C00, 0xFFB88203, 0xFF838C03,
+	0xFF408E00, 0xFF2F9300, 0xFF539D00, 0xFF7DA202, 0xFF929206, 0xFF867E02, 0xFF7E7000, 0xFF806A00,
+	0xFF735F00, 0xFF4D5E00, 0xFF335E00, 0xFF3C5900, 0xFF585A01, 0xFF805F01, 0xFF7F6800, 0xFF797B02,
+	0xFF8C9703, 0xFF96A601, 0xFF779A03, 0xFF477702, 0xFF2C4C03, 0xFF2D2F00, 0xFF462F00, 0xFF6C4002,
+	0xFF8F5604, 0xFFA56702, 0xFFB77002, 0xFFB06F09, 0xFF7A6601, 0xFF306606, 0xFF256D02, 0xFF3A7D00,
+	0xFF5E9300, 0xFF84A001, 0xFFA9AF01, 0xFFC6C202, 0xFFC1C905, 0xFF84C102, 0xFF53AF00, 0xFF50A206,
+	0xFF6D9408, 0xFF7D8C05, 0xFF787902, 0xFF705B02, 0xFF733E03, 0xFF732303, 0xFF661C00, 0xFF582500,
+	0xFF5B5F03, 0xFF2F7703, 0xFF238602, 0xFF359600, 0xFF60AB06, 0xFF8CB00A, 0xFF9AA906, 0xFF9D9C02,
+	0xFF819200, 0xFF5E9300, 0xFF498801, 0xFF4B7A00, 0xFF627300, 0xFF906C00, 0xFFA86102, 0xFF835901,
+	0xFF506300, 0xFF3E6E01, 0xFF457003, 0xFF546E00, 0xFF637901, 0xFF769000, 0xFF739A02, 0xFF5D9105,
+	0xFF5A8404, 0xFF7C8002, 0xFF968601, 0xFF849503, 0xFF5FA401, 0xFF49AD00, 0xFF60A500, 0xFF839903,
+	0xFF988703, 0xFF936B01, 0xFF815400, 0xFF6F4300, 0xFF623F00, 0xFF584600, 0xFF554B00, 0xFF515703,
+	0xFF596004, 0xFF655800, 0xFF6E5100, 0xFF885B00, 0xFFA18403, 0xFFA7B302, 0xFF96C201, 0xFF90B903,
+	0xFF98AE01, 0xFF9B9C02, 0xFF708A00, 0xFF376A02, 0xFF315201, 0xFF674D00, 0xFF9C5704, 0xFFBB6704,
+	0xFFB57F02, 0xFF9C9502, 0xFF81A005, 0xFF689305, 0xFF5D7B00, 0xFF676800, 0xFF855303, 0xFF9A3C01,
+	0xFF743B00, 0xFF3C4400, 0xFF146100, 0xFF197F01, 0xFF588903, 0xFFA18A07, 0xFFB78B04, 0xFF8A9600,
+	0xFF619D03, 0xFF629701, 0xFF798B00, 0xFF938201, 0xFFAD8407, 0xFFC68609, 0xFFB88A00, 0xFF848E02,
+	0xFF3E8D01, 0xFF268900, 0xFF408400, 0xFF638100, 0xFF707802, 0xFF6C7000, 0xFF6F6800, 0xFF736300,
+	0xFF715F00, 0xFF5D6100, 0xFF466000, 0xFF496702, 0xFF667705, 0xFF867D01, 0xFF918703, 0xFF9C9309,
+	0xFFAC9D04, 0xFF9C9C03, 0xFF639101, 0xFF327702, 0xFF1F5102, 0xFF313700, 0xFF543500, 0xFF854400,
+	0xFFA05B03, 0xFFA66002, 0xFFAD4E00, 0xFFA23801, 0xFF733501, 0xFF3D5102, 0xFF367301, 0xFF4A9803,
+	0xFF61A901, 0xFF78A900, 0xFFA5A401, 0xFFCEA200, 0xFFC8AD05, 0xFF88B506, 0xFF4CB200, 0xFF45A408,
+	0xFF578508, 0xFF626600, 0xFF5E5000, 0xFF563D00, 0xFF582D02, 0xFF552903, 0xFF5C3502, 0xFF704B01,
+	0xFF789F04, 0xFF45AA03, 0xFF35A806, 0xFF54A900, 0xFF75A701, 0xFF899208, 0xFF867707, 0xFF876300,
+	0xFF7F5F00, 0xFF606800, 0xFF487400, 0xFF468502, 0xFF639104, 0xFF8F8802, 0xFF9B7104, 0xFF756000,
+	0xFF536000, 0xFF477002, 0xFF508001, 0xFF6A8B00, 0xFF809A05, 0xFF8BA501, 0xFF79A002, 0xFF538B03,
+	0xFF4F7B01, 0xFF747400, 0xFFA17500, 0xFFA27F02, 0xFF799101, 0xFF5A9C00, 0xFF639201, 0xFF787B05,
+	0xFF816206, 0xFF774A01, 0xFF663D00, 0xFF603000, 0xFF622E01, 0xFF5C3400, 0xFF583E00, 0xFF504500,
+	0xFF4E5301, 0xFF516705, 0xFF717C00, 0xFFA49700, 0xFFC1B305, 0xFFBDC409, 0xFF9BBF03, 0xFF83A903,
+	0xFF798B04, 0xFF6F6B02, 0xFF595800, 0xFF415200, 0xFF516202, 0xFF7C7D06, 0xFFA39403, 0xFFB99A02,
+	0xFFB69406, 0xFFA88C04, 0xFF838202, 0xFF536C01, 0xFF375001, 0xFF474300, 0xFF723D00, 0xFF983200,
+	0xFF943000, 0xFF664000, 0xFF306C00, 0xFF1C9E00, 0xFF48B605, 0xFF8CB207, 0xFFB7A302, 0xFFA4A200,
+	0xFF65AD01, 0xFF4AB300, 0xFF69B201, 0xFF8DAF03, 0xFFA3A905, 0xFFB09D06, 0xFFA88808, 0xFF817604,
+	0xFF427004, 0xFF277000, 0xFF426C02, 0xFF6B6F03, 0xFF757902, 0xFF717D06, 0xFF647C02, 0xFF5B7600,
+	0xFF5A7000, 0xFF656B00, 0xFF676F00, 0xFF6C7701, 0xFF7D8702, 0xFF839400, 0xFF8A9503, 0xFFA08504,
+	0xFFA67506, 0xFF8C6704, 0xFF646001, 0xFF316E00, 0xFF167502, 0xFF2F6804, 0xFF625A01, 0xFFA35200,
+	0xFFAA5F01, 0xFF9E5F01, 0xFF934901, 0xFF863300, 0xFF6F2C00, 0xFF5B4400, 0xFF5A6800, 0xFF638608,
+	0xFF669207, 0xFF738D00, 0xFF9B8200, 0xFFC77C00, 0xFFC78001, 0xFF8B8702, 0xFF488C00, 0xFF367902,
+	0xFF495A02, 0xFF5F4B00, 0xFF674A00, 0xFF645200, 0xFF575900, 0xFF5B6101, 0xFF777800, 0xFF929200,
+	0xFF6EA704, 0xFF429500, 0xFF449003, 0xFF6A8F00, 0xFF7A8200, 0xFF716500, 0xFF6A5300, 0xFF7A4A00,
+	0xFF834B01, 0xFF675C01, 0xFF537802, 0xFF509602, 0xFF6AA502, 0xFF829C04, 0xFF7A8703, 0xFF636F00,
+	0xFF5B6A00, 0xFF667F02, 0xFF749A01, 0xFF81A903, 0xFF88AE01, 0xFF83A200, 0xFF6D8D00, 0xFF487600,
+	0xFF456900, 0xFF6C6300, 0xFFA25F00, 0xFFB15F02, 0xFF8B6F01, 0xFF647400, 0xFF596801, 0xFF665300,
+	0xFF783F00, 0xFF6F3A00, 0xFF563C00, 0xFF4D3901, 0xFF502E01, 0xFF5D2E00, 0xFF663F00, 0xFF675400,
+	0xFF5E7000, 0xFF669502, 0xFF88B303, 0xFFABC204, 0xFFBBBF05, 0xFFB3A605, 0xFF928D02, 0xFF6C7B01,
+	0xFF566600, 0xFF545900, 0xFF5C5900, 0xFF6B6900, 0xFF818302, 0xFF959D05, 0xFF9CA100, 0xFF9D8702,
+	0xFF986B04, 0xFF8D5C01, 0xFF685002, 0xFF3D4F00, 0xFF2E5201, 0xFF475D00, 0xFF776601, 0xFF9C5E06,
+	0xFFA74A03, 0xFF835000, 0xFF527C02, 0xFF31A201, 0xFF3CB201, 0xFF70AD00, 0xFFAB9700, 0xFFAE8E00,
+	0xFF7E9C00, 0xFF5EB300, 0xFF6CC205, 0xFF83C003, 0xFF86A900, 0xFF858702, 0xFF866107, 0xFF6B4E01,
+	0xFF504C03, 0xFF465900, 0xFF5E6E04, 0xFF888106, 0xFF948F04, 0xFF7F8B05, 0xFF5C8301, 0xFF467C00,
+	0xFF497701, 0xFF627502, 0xFF757900, 0xFF857800, 0xFF8B7501, 0xFF827701, 0xFF786F00, 0xFF7A5C00,
+	0xFF7A4802, 0xFF733B00, 0xFF644300, 0xFF3F6800, 0xFF218D04, 0xFF2F9D06, 0xFF669505, 0xFF9F7B03,
+	0xFFA96D00, 0xFF8E6A02, 0xFF796002, 0xFF775501, 0xFF7B4800, 0xFF744900, 0xFF6D5A00, 0xFF636A03,
+	0xFF5E7003, 0xFF717300, 0xFF9D7900, 0xFFC57102, 0xFFBF6200, 0xFF845B00, 0xFF485300, 0xFF344E02,
+	0xFF4F5502, 0xFF7A6200, 0xFF977304, 0xFF898806, 0xFF689801, 0xFF6D9F02, 0xFF8BA605, 0xFF97A902,
+	0xFF546701, 0xFF345F00, 0xFF456900, 0xFF757000, 0xFF8A6700, 0xFF6E6000, 0xFF615F01, 0xFF756204,
+	0xFF7E6901, 0xFF777503, 0xFF678C04, 0xFF5CA201, 0xFF61A500, 0xFF62A001, 0xFF589200, 0xFF4D8100,
+	0xFF5E7F00, 0xFF838C00, 0xFF919F03, 0xFF8CAA07, 0xFF7CA000, 0xFF6D8800, 0xFF636D00, 0xFF475F00,
+	0xFF415800, 0xFF645800, 0xFF925503, 0xFFAF4706, 0xFF9C4905, 0xFF714C00, 0xFF504B00, 0xFF594400,
+	0xFF763A00, 0xFF793900, 0xFF623A02, 0xFF413F00, 0xFF454200, 0xFF654B01, 0xFF806302, 0xFF8E8203,
+	0xFF8AA500, 0xFF8BBE00, 0xFF97C502, 0xFF99B406, 0xFF8F9304, 0xFF897200, 0xFF7F6100, 0xFF696100,
+	0xFF5A6802, 0xFF606D03, 0xFF757905, 0xFF908902, 0xFF998B01, 0xFF908304, 0xFF7B7201, 0xFF755601,
+	0xFF7D4600, 0xFF7E4100, 0xFF6C3F00, 0xFF535300, 0xFF4B7C00, 0xFF559F01, 0xFF6FA406, 0xFF858C06,
+	0xFF996A02, 0xFF956300, 0xFF747901, 0xFF408001, 0xFF397E00, 0xFF6F7F00, 0xFFAA7D03, 0xFFB47E06,
+	0xFF9F8700, 0xFF889C02, 0xFF7DA808, 0xFF699F07, 0xFF528100, 0xFF485900, 0xFF494000, 0xFF563C00,
+	0xFF664500, 0xFF7E5600, 0xFF947004, 0xFF9D8502, 0xFF9E8902, 0xFF807902, 0xFF506D01, 0xFF3B6B00,
+	0xFF457202, 0xFF607605, 0xFF7A6C03, 0xFF885E02, 0xFF874B06, 0xFF7F4002, 0xFF743E00, 0xFF623E00,
+	0xFF623B00, 0xFF6C3F03, 0xFF684D02, 0xFF596100, 0xFF448301, 0xFF3DA801, 0xFF62B203, 0xFF81A102,
+	0xFF8D8600, 0xFF767B01, 0xFF6A7F00, 0xFF6E8402, 0xFF787D03, 0xFF7A6800, 0xFF705B03, 0xFF5E5C01,
+	0xFF605F00, 0xFF817000, 0xFFA98701, 0xFFC37806, 0xFFAF5703, 0xFF6E4200, 0xFF483C00, 0xFF4B5100,
+	0xFF6A7400, 0xFF9A8C01, 0xFFAFA104, 0xFF99B206, 0xFF70BD02, 0xFF6CB701, 0xFF809A04, 0xFF7A7D03,
+	0xFF503300, 0xFF3B4600, 0xFF526501, 0xFF7C7B05, 0xFF917D03, 0xFF807E00, 0xFF6C8300, 0xFF6E8602,
+	0xFF808802, 0xFF878B04, 0xFF749602, 0xFF62A000, 0xFF59A200, 0xFF4E9C01, 0xFF428E01, 0xFF427C00,
+	0xFF647700, 0xFF977E01, 0xFFA58805, 0xFF868F01, 0xFF6D8100, 0xFF636801, 0xFF5C5A02, 0xFF475B00,
+	0xFF3F5900, 0xFF575C01, 0xFF7E5605, 0xFF994103, 0xFF983A03, 0xFF7D3C00, 0xFF5B4C00, 0xFF545601,
+	0xFF6A5000, 0xFF7D4700, 0xFF6C4501, 0xFF4B5400, 0xFF576E00, 0xFF888605, 0xFFAC9B02, 0xFFB1AC00,
+	0xFFA8B602, 0xFF99AD04, 0xFF849A00, 0xFF6B7F00, 0xFF656600, 0xFF735B02, 0xFF7E6302, 0xFF797104,
+	0xFF6F7F04, 0xFF6E8103, 0xFF7B7E02, 0xFF907700, 0xFF956901, 0xFF775901, 0xFF585300, 0xFF5C5400,
+	0xFF7C5902, 0xFF925A03, 0xFF8A5B00, 0xFF796C01, 0xFF739503, 0xFF69BA04, 0xFF51C602, 0xFF57B200,
+	0xFF839000, 0xFF997D03, 0xFF757100, 0xFF405800, 0xFF424A00, 0xFF7D5503, 0xFFA86D02, 0xFFB17202,
+	0xFFAC7000, 0xFF9F7306, 0xFF7A7007, 0xFF496301, 0xFF2D5200, 0xFF264400, 0xFF274F00, 0xFF495B00,
+	0xFF7E5A00, 0xFFA45601, 0xFFAA5902, 0xFF9C6302, 0xFF945D02, 0xFF715402, 0xFF495301, 0xFF3B5701,
+	0xFF446100, 0xFF5C6400, 0xFF755801, 0xFF7B4B01, 0xFF703F01, 0xFF753800, 0xFF7B3700, 0xFF6F3C00,
+	0xFF6A4701, 0xFF7B5803, 0xFF7C6103, 0xFF636501, 0xFF537600, 0xFF589200, 0xFF69A102, 0xFF6D9D03,
+	0xFF6B8800, 0xFF688000, 0xFF679003, 0xFF69A501, 0xFF70A300, 0xFF6D9004, 0xFF637009, 0xFF5F5D01,
+	0xFF6C6400, 0xFF988302, 0xFFB89008, 0xFFAE7A07, 0xFF805202, 0xFF553B00, 0xFF4C4700, 0xFF616802,
+	0xFF7F8A06, 0xFFA09707, 0xFFADA100, 0xFF99B302, 0xFF6BBC03, 0xFF56A100, 0xFF606D00, 0xFF644000,
+	0xFF7C3800, 0xFF6D5501, 0xFF657D02, 0xFF6D9D06, 0xFF82A105, 0xFF869300, 0xFF6D8D02, 0xFF668800,
+	0xFF808703, 0xFF8B8E07, 0xFF7E9504, 0xFF6B9A00, 0xFF589E00, 0xFF479502, 0xFF357F02, 0xFF356A00,
+	0xFF635E01, 0xFFAA5C03, 0xFFBC6103, 0xFF926700, 0xFF6D6101, 0xFF645507, 0xFF5C5604, 0xFF495D00,
+	0xFF396100, 0xFF486603, 0xFF646303, 0xFF805500, 0xFF8F4C00, 0xFF815200, 0xFF636500, 0xFF577502,
+	0xFF627702, 0xFF727301, 0xFF6C7300, 0xFF6E8101, 0xFF87A307, 0xFFADB907, 0xFFBDB907, 0xFFAFA809,
+	0xFF988A07, 0xFF827003, 0xFF676200, 0xFF5A5C04, 0xFF616003, 0xFF7E6E00, 0xFF8E7C02, 0xFF878406,
+	0xFF738102, 0xFF667400, 0xFF746401, 0xFF8B5A00, 0xFF8E5600, 0xFF755400, 0xFF586300, 0xFF667802,
+	0xFF868C04, 0xFF9A8C08, 0xFF937A02, 0xFF917301, 0xFF968505, 0xFF87A605, 0xFF52C502, 0xFF45CD00,
+	0xFF6FC001, 0xFF80A605, 0xFF5C7202, 0xFF3B3A00, 0xFF542502, 0xFF8F3406, 0xFFAC5003, 0xFFB05704,
+	0xFFA35002, 0xFF8E4601, 0xFF753A00, 0xFF563C02, 0xFF394804, 0xFF2D6401, 0xFF2B8404, 0xFF438B02,
+	0xFF807004, 0xFFAA4A02, 0xFFA53600, 0xFF8C3400, 0xFF7C3700, 0xFF5F3C01, 0xFF444400, 0xFF3B4B01,
+	0xFF4E5001, 0xFF6D5700, 0xFF7C5B00, 0xFF706000, 0xFF626001, 0xFF6D5C03, 0xFF7E5102, 0xFF814B01,
+	0xFF7B5603, 0xFF886702, 0xFF876E02, 0xFF667401, 0xFF557C00, 0xFF6B7E00, 0xFF738004, 0xFF647503,
+	0xFF586E00, 0xFF627502, 0xFF708E05, 0xFF70A803, 0xFF5EB001, 0xFF50A404, 0xFF498903, 0xFF547400,
+	0xFF787501, 0xFFA08706, 0xFFAD7F0B, 0xFF8A5D03, 0xFF563D00, 0xFF423801, 0xFF4E5100, 0xFF697106,
+	0xFF7F8709, 0xFF918A03, 0xFF9A8F00, 0xFF8C9D04, 0xFF649D02, 0xFF498300, 0xFF555900, 0xFF6B3E00,
+	0xFFA97104, 0xFF9B7701, 0xFF778501, 0xFF669402, 0xFF6F9C03, 0xFF6F8E01, 0xFF5C7B03, 0xFF5F7201,
+	0xFF7A7602, 0xFF928203, 0xFF908F03, 0xFF789400, 0xFF5D9301, 0xFF3F8702, 0xFF257600, 0xFF2C5D00,
+	0xFF674600, 0xFFB54000, 0xFFCE4100, 0xFFA74707, 0xFF764A05, 0xFF5F5003, 0xFF5C5001, 0xFF4E5600,
+	0xFF416801, 0xFF4E7901, 0xFF628001, 0xFF7C7D04, 0xFF867903, 0xFF767D03, 0xFF5A8401, 0xFF4F9600,
+	0xFF5BA909, 0xFF70AF06, 0xFF7BAD01, 0xFF8EAE07, 0xFFA6BC0A, 0xFFB0B802, 0xFF9A9E04, 0xFF7E7F05,
+	0xFF6D6104, 0xFF6E5400, 0xFF6B5A00, 0xFF726907, 0xFF7B7909, 0xFF808002, 0xFF7E7F03, 0xFF707602,
+	0xFF5E6700, 0xFF5B6400, 0xFF796402, 0xFF9D6900, 0xFFA17002, 0xFF8E7603, 0xFF788703, 0xFF7CA004,
+	0xFF8BAD03, 0xFF89A603, 0xFF7D8C03, 0xFF8B7400, 0xFFAC7501, 0xFFA29105, 0xFF72AF06, 0xFF4EC604,
+	0xFF4CC706, 0xFF4EAB05, 0xFF3C6800, 0xFF372E02, 0xFF5E1904, 0xFF9D2401, 0xFFC23503, 0xFFB63B04,
+	0xFF923704, 0xFF813001, 0xFF812D00, 0xFF783C02, 0xFF6A6108, 0xFF589109, 0xFF43A80A, 0xFF409D07,
+	0xFF717402, 0xFF9F4600, 0xFF9C2B00, 0xFF7C2100, 0xFF612800, 0xFF4E3602, 0xFF444501, 0xFF435300,
+	0xFF615F00, 0xFF896D01, 0xFF947A03, 0xFF778103, 0xFF558000, 0xFF5B7900, 0xFF766603, 0xFF835B02,
+	0xFF845F01, 0xFF8E6501, 0xFF866F00, 0xFF6C7E01, 0xFF598802, 0xFF647F03, 0xFF606902, 0xFF585200,
+	0xFF545300, 0xFF676802, 0xFF7C7801, 0xFF738202, 0xFF579101, 0xFF479900, 0xFF469800, 0xFF559000,
+	0xFF7C8701, 0xFF997903, 0xFF855C04, 0xFF574100, 0xFF392C00, 0xFF3B3300, 0xFF524B00, 0xFF706001,
+	0xFF7F7100, 0xFF887E00, 0xFF8E8500, 0xFF887F05, 0xFF617B02, 0xFF3D7E00, 0xFF5C7400, 0xFF8F7405,
+	0xFFADA70D, 0xFFA28C01, 0xFF807A00, 0xFF6D7B00, 0xFF698502, 0xFF5C8501, 0xFF4B7800, 0xFF537200,
+	0xFF787200, 0xFFA37503, 0xFFA27F02, 0xFF838500, 0xFF638501, 0xFF427C01, 0xFF217200, 0xFF2E5E00,
+	0xFF6C4C01, 0xFFB63F00, 0xFFD53400, 0xFFAB3702, 0xFF6E3E01, 0xFF524500, 0xFF524600, 0xFF505401,
+	0xFF4F7301, 0xFF628E00, 0xFF76A202, 0xFF85A307, 0xFF70A003, 0xFF549C00, 0xFF419900, 0xFF42AE00,
+	0xFF5BC407, 0xFF76CB05, 0xFF80C701, 0xFF8EBC02, 0xFFA1A302, 0xFF968600, 0xFF6F7000, 0xFF555F00,
+	0xFF525B00, 0xFF6E6301, 0xFF8B6E01, 0xFF987904, 0xFF8B7903, 0xFF667202, 0xFF536601, 0xFF4E5C00,
+	0xFF526400, 0xFF657E00, 0xFF8B9800, 0xFFAFA301, 0xFFABA503, 0xFF949F03, 0xFF869D03, 0xFF84A701,
+	0xFF7FA901, 0xFF6CA100, 0xFF629B00, 0xFF7F9200, 0xFFAB8803, 0xFFAC8407, 0xFF798602, 0xFF479501,
+	0xFF309003, 0xFF2B7203, 0xFF2C4D01, 0xFF413700, 0xFF6D3400, 0xFFAF4000, 0xFFD54900, 0xFFC64A00,
+	0xFFA54A02, 0xFF904D00, 0xFF8F5200, 0xFF975300, 0xFF986905, 0xFF7E8B06, 0xFF519605, 0xFF408903,
+	0xFF617000, 0xFF925101, 0xFF893D02, 0xFF6A3604, 0xFF573A00, 0xFF494B00, 0xFF4B6600, 0xFF558000,
+	0xFF789604, 0xFF989B02, 0xFF959406, 0xFF6A820A, 0xFF3C7701, 0xFF417100, 0xFF636801, 0xFF786402,
+	0xFF836102, 0xFF8E6001, 0xFF886801, 0xFF747702, 0xFF618101, 0xFF4A7B01, 0xFF3D6600, 0xFF4A5600,
+	0xFF5F5700, 0xFF746803, 0xFF7F6401, 0xFF6E5D00, 0xFF5B6200, 0xFF597704, 0xFF569001, 0xFF4E9A00,
+	0xFF658E00, 0xFF7E7300, 0xFF695600, 0xFF434500, 0xFF353F01, 0xFF3D4202, 0xFF5E4500, 0xFF805100,
+	0xFF8C6500, 0xFF907400, 0xFF8C7101, 0xFF7C5C01, 0xFF5A5700, 0xFF407402, 0xFF5C9E02, 0xFF96B110,
+	0xFF8B9E06, 0xFF7B8300, 0xFF737400, 0xFF787A01, 0xFF758901, 0xFF619401, 0xFF4E8F00, 0xFF548704,
+	0xFF737E03, 0xFF9D6C01, 0xFFAA6503, 0xFF8B6F01, 0xFF647302, 0xFF416D03, 0xFF286B01, 0xFF346E00,
+	0xFF616F01, 0xFFA15C02, 0xFFC13E00, 0xFFA13000, 0xFF663B00, 0xFF4B4900, 0xFF455701, 0xFF4F6900,
+	0xFF5A8201, 0xFF779702, 0xFF8AA801, 0xFF8BAB02, 0xFF5FA701, 0xFF319D00, 0xFF2A9903, 0xFF47A401,
+	0xFF63B400, 0xFF73B500, 0xFF76A600, 0xFF7A9000, 0xFF7E7400, 0xFF726300, 0xFF626000, 0xFF526600,
+	0xFF566F00, 0xFF767002, 0xFF986D01, 0xFF9F6401, 0xFF785F01, 0xFF4B6000, 0xFF3D6500, 0xFF577200,
+	0xFF708F01, 0xFF8CB304, 0xFFA2CD04, 0xFFA8D205, 0xFF98C104, 0xFF80AC00, 0xFF779B00, 0xFF778800,
+	0xFF6D7D01, 0xFF5F8400, 0xFF6C9803, 0xFF8AA601, 0xFF9A9A02, 0xFF936E06, 0xFF6C5001, 0xFF3D4600,
+	0xFF273E00, 0xFF273605, 0xFF3D3E03, 0xFF665700, 0xFF937400, 0xFFBA8902, 0xFFD48905, 0xFFD28303,
+	0xFFBF8202, 0xFF9E8200, 0xFF8F7201, 0xFF905600, 0xFF904D01, 0xFF7C5202, 0xFF585A02, 0xFF496400,
+	0xFF666602, 0xFF855F05, 0xFF795702, 0xFF655601, 0xFF5E6501, 0xFF577F02, 0xFF599C02, 0xFF61B600,
+	0xFF73BE05, 0xFF84A908, 0xFF768701, 0xFF496703, 0xFF265E04, 0xFF336200, 0xFF576200, 0xFF6C6100,
+	0xFF735D01, 0xFF825601, 0xFF915202, 0xFF825A03, 0xFF5A6000, 0xFF336600, 0xFF306900, 0xFF4F6F02,
+	0xFF757B04, 0xFF7F7F06, 0xFF726C00, 0xFF635700, 0xFF6A4900, 0xFF755103, 0xFF6C7301, 0xFF578800,
+	0xFF5B8701, 0xFF6D7E00, 0xFF647102, 0xFF476905, 0xFF3A6C02, 0xFF466402, 0xFF705103, 0xFF9B5001,
+	0xFFA35B01, 0xFF8F6200, 0xFF7E5702, 0xFF6C3F00, 0xFF533C00, 0xFF495E01, 0xFF639104, 0xFF82AD0A,
+	0xFF616602, 0xFF5B6200, 0xFF6A6F02, 0xFF898803, 0xFF8C9F03, 0xFF74AB03, 0xFF5EA300, 0xFF589202,
+	0xFF617E01, 0xFF866700, 0xFFA65C00, 0xFF985F00, 0xFF6C6300, 0xFF466001, 0xFF336602, 0xFF357D01,
+	0xFF598B00, 0xFF868002, 0xFF9C5F03, 0xFF8F4201, 0xFF634500, 0xFF4C6000, 0xFF4C7904, 0xFF538402,
+	0xFF578600, 0xFF768F03, 0xFF969808, 0xFF8E9405, 0xFF5C8A01, 0xFF2E8100, 0xFF2D8802, 0xFF4F8E01,
+	0xFF6A8D00, 0xFF6F8500, 0xFF697703, 0xFF666404, 0xFF625700, 0xFF695C00, 0xFF6D6802, 0xFF5B7401,
+	0xFF537A01, 0xFF697000, 0xFF8D6200, 0xFF945A00, 0xFF696700, 0xFF497800, 0xFF4B9200, 0xFF78AD00,
+	0xFF9CC803, 0xFFA5D704, 0xFF9DDA04, 0xFF91D604, 0xFF7CBD09, 0xFF619D02, 0xFF557900, 0xFF565E00,
+	0xFF5C4F00, 0xFF775804, 0xFF91770C, 0xFF8E9604, 0xFF788900, 0xFF5D5600, 0xFF463800, 0xFF2E2400,
+	0xFF252201, 0xFF333602, 0xFF5B5E00, 0xFF958800, 0xFFBAA800, 0xFFB5B901, 0xFFBBBA08, 0xFFBEB307,
+	0xFFADA101, 0xFF928605, 0xFF746101, 0xFF6A3E00, 0xFF6E2F00, 0xFF642F00, 0xFF584000, 0xFF5D5D01,
+	0xFF787102, 0xFF7C7202, 0xFF6D6F00, 0xFF697B01, 0xFF759503, 0xFF6FB101, 0xFF5DC501, 0xFF4EC700,
+	0xFF4DB704, 0xFF549203, 0xFF4C6600, 0xFF315401, 0xFF1A6102, 0xFF2D7000, 0xFF546F00, 0xFF626500,
+	0xFF655A00, 0xFF755300, 0xFF8F4C00, 0xFF8C4901, 0xFF5D4C03, 0xFF315400, 0xFF3C6400, 0xFF6B7D09,
+	0xFF889407, 0xFF819204, 0xFF597C01, 0xFF4A6500, 0xFF635400, 0xFF7E4900, 0xFF795300, 0xFF686600,
+	0xFF727604, 0xFF738604, 0xFF648E02, 0xFF4A8B05, 0xFF398201, 0xFF487700, 0xFF816305, 0xFFAD5C02,
+	0xFFA95B02, 0xFF8B5F00, 0xFF785400, 0xFF664100, 0xFF553A00, 0xFF563F00, 0xFF645603, 0xFF6E6802,
+	0xFF4F3D01, 0xFF535500, 0xFF6E7306, 0xFF938B03, 0xFF979A01, 0xFF7E9F01, 0xFF679802, 0xFF4F8801,
+	0xFF4B7A00, 0xFF6F7300, 0xFF9A6B00, 0xFF976303, 0xFF6C5E03, 0xFF4C5A00, 0xFF476501, 0xFF4D8200,
+	0xFF5E9702, 0xFF789105, 0xFF827707, 0xFF785501, 0xFF5B4F00, 0xFF4E6D00, 0xFF5A8303, 0xFF558B03,
+	0xFF508500, 0xFF678200, 0xFF907F03, 0xFF8D7600, 0xFF646B00, 0xFF416D00, 0xFF3C7600, 0xFF557801,
+	0xFF647102, 0xFF6A6604, 0xFF636104, 0xFF545601, 0xFF565401, 0xFF705C00, 0xFF756802, 0xFF5B7102,
+	0xFF497501, 0xFF5D7600, 0xFF8F7901, 0xFFA48201, 0xFF899501, 0xFF64AF02, 0xFF67C505, 0xFF8FD305,
+	0xFFABD606, 0xFFA1C907, 0xFF84BA00, 0xFF67AC00, 0xFF539504, 0xFF3D7602, 0xFF385800, 0xFF464F00,
+	0xFF5E4700, 0xFF8C4702, 0xFFA15303, 0xFF8E5D01, 0xFF685A00, 0xFF425100, 0xFF2C4903, 0xFF214B02,
+	0xFF255300, 0xFF4A6C00, 0xFF7D8F02, 0xFFA4A303, 0xFFB5A402, 0xFFAFA300, 0xFFA5A502, 0xFF9A9C05,
+	0xFF848401, 0xFF6B5F02, 0xFF564700, 0xFF523D01, 0xFF593D02, 0xFF624900, 0xFF636805, 0xFF6C8606,
+	0xFF7D8B01, 0xFF747E01, 0xFF697700, 0xFF7B8901, 0xFF94A901, 0xFF87BB03, 0xFF5EB904, 0xFF35AF00,
+	0xFF2D9800, 0xFF357500, 0xFF425D03, 0xFF446203, 0xFF2D8401, 0xFF2E9A01, 0xFF499301, 0xFF527E04,
+	0xFF566C02, 0xFF6D6502, 0xFF8A6502, 0xFF8A5E06, 0xFF5E5203, 0xFF334E03, 0xFF455601, 0xFF7E6901,
+	0xFF917B01, 0xFF728102, 0xFF4B7406, 0xFF3E6D00, 0xFF486D00, 0xFF646100, 0xFF795300, 0xFF804F00,
+	0xFF836002, 0xFF7E7804, 0xFF5F8600, 0xFF3D8900, 0xFF387F00, 0xFF4C7501, 0xFF7F6C07, 0xFFA76401,
+	0xFFAE6602, 0xFF8F7100, 0xFF7B6E01, 0xFF686302, 0xFF595100, 0xFF5F3901, 0xFF5F3000, 0xFF5C3100,
+	0xFF624E00, 0xFF656D00, 0xFF717D00, 0xFF867E03, 0xFF807A01, 0xFF767700, 0xFF6A7901, 0xFF577902,
+	0xFF508300, 0xFF698E00, 0xFF878903, 0xFF7C7706, 0xFF5D5F04, 0xFF595501, 0xFF6C6600, 0xFF778301,
+	0xFF6E9402, 0xFF6D9506, 0xFF697E05, 0xFF5E5E00, 0xFF525400, 0xFF5B6500, 0xFF6D7B02, 0xFF5F8301,
+	0xFF518400, 0xFF5A8000, 0xFF797601, 0xFF916602, 0xFF756000, 0xFF566604, 0xFF4F6D03, 0xFF4E6E00,
+	0xFF536401, 0xFF5D5B01, 0xFF555501, 0xFF474D00, 0xFF4F4E00, 0xFF715900, 0xFF786600, 0xFF5B7100,
+	0xFF4B8300, 0xFF689900, 0xFFA6AC06, 0xFFC2B604, 0xFFAFBD01, 0xFF82CC02, 0xFF70CF05, 0xFF82C30D,
+	0xFF94A907, 0xFF878D02, 0xFF697900, 0xFF466800, 0xFF2D5300, 0xFF244601, 0xFF365003, 0xFF556600,
+	0xFF6C7100, 0xFF846200, 0xFF914600, 0xFF923300, 0xFF774001, 0xFF575C00, 0xFF3D6F01, 0xFF2F7D02,
+	0xFF3C8F00, 0xFF66A502, 0xFF8AAA03, 0xFF8E9306, 0xFF917303, 0xFFA76100, 0xFF9C5F00, 0xFF6E5A00,
+	0xFF545601, 0xFF505300, 0xFF585A03, 0xFF616901, 0xFF6C7B04, 0xFF768C04, 0xFF789E05, 0xFF6DAA02,
+	0xFF62A300, 0xFF528C00, 0xFF648300, 0xFF928602, 0xFFAD8E01, 0xFF909202, 0xFF599104, 0xFF2E9300,
+	0xFF248C00, 0xFF3A7C00, 0xFF587B00, 0xFF6C8902, 0xFF5DA308, 0xFF4BAE07, 0xFF3AA404, 0xFF3C8F05,
+	0xFF4C8001, 0xFF6B7B03, 0xFF857902, 0xFF7B6F03, 0xFF4D5801, 0xFF344603, 0xFF503F03, 0xFF844800,
+	0xFF935400, 0xFF745900, 0xFF4C5F00, 0xFF347000, 0xFF397E05, 0xFF4B7405, 0xFF5E6101, 0xFF804900,
+	0xFF8A4700, 0xFF7A5301, 0xFF596200, 0xFF397100, 0xFF3C7B01, 0xFF558209, 0xFF728704, 0xFF957E00,
+	0xFFA97C03, 0xFF9B7E01, 0xFF808002, 0xFF6B7E05, 0xFF617001, 0xFF5C5200, 0xFF5F3701, 0xFF613503,
+	0xFF807E04, 0xFF678A03, 0xFF5E7C00, 0xFF645C00, 0xFF615000, 0xFF725300, 0xFF766100, 0xFF6D7600,
+	0xFF668F01, 0xFF6E9C05, 0xFF749203, 0xFF687300, 0xFF5C5801, 0xFF6C5601, 0xFF8E6402, 0xFF987306,
+	0xFF878005, 0xFF738302, 0xFF5F7601, 0xFF516800, 0xFF516400, 0xFF6A6800, 0xFF7A7602, 0xFF6D7C02,
+	0xFF538401, 0xFF4F8101, 0xFF657401, 0xFF836402, 0xFF835D02, 0xFF6F6202, 0xFF546501, 0xFF3D6300,
+	0xFF425A02, 0xFF4C5301, 0xFF495001, 0xFF484E00, 0xFF575701, 0xFF776D03, 0xFF7D7F01, 0xFF658D00,
+	0xFF5D9C02, 0xFF75B005, 0xFFB2B70B, 0xFFC6B704, 0xFFB1AF00, 0xFF83A801, 0xFF66A001, 0xFF608E03,
+	0xFF677102, 0xFF655C00, 0xFF524800, 0xFF3A3500, 0xFF262800, 0xFF2D2F01, 0xFF4B5401, 0xFF738304,
+	0xFF7F9907, 0xFF708903, 0xFF726100, 0xFF8D4700, 0xFF904E00, 0xFF6E6B04, 0xFF4F7701, 0xFF487F03,
+	0xFF609607, 0xFF7AA203, 0xFF789000, 0xFF696D01, 0xFF744F00, 0xFF993C00, 0xFF923500, 0xFF643D00,
+	0xFF4F5500, 0xFF607A00, 0xFF769903, 0xFF7FA301, 0xFF82A302, 0xFF88A404, 0xFF85A504, 0xFF68AB03,
+	0xFF3FAA00, 0xFF329D00, 0xFF599101, 0xFF938402, 0xFFA27400, 0xFF846700, 0xFF646E00, 0xFF508E01,
+	0xFF4AA006, 0xFF52A207, 0xFF6EA101, 0xFF8C9E02, 0xFF7D9B02, 0xFF5B9003, 0xFF398206, 0xFF2F7601,
+	0xFF4D6A00, 0xFF756B00, 0xFF7C6C01, 0xFF616002, 0xFF414B02, 0xFF353E00, 0xFF533F00, 0xFF814A03,
+	0xFF925605, 0xFF7F5803, 0xFF565D00, 0xFF3D6900, 0xFF397002, 0xFF3A7104, 0xFF426702, 0xFF6D4F00,
+	0xFF844300, 0xFF754401, 0xFF5C4700, 0xFF485B00, 0xFF537504, 0xFF6A8E06, 0xFF769F01, 0xFF889E03,
+	0xFF929204, 0xFF8E7B02, 0xFF797400, 0xFF6D7602, 0xFF6E7805, 0xFF607202, 0xFF646200, 0xFF816504,
+	0xFF869C04, 0xFF548406, 0xFF415B02, 0xFF493801, 0xFF603404, 0xFF7D4101, 0xFF8B5403, 0xFF8B6D03,
+	0xFF7F8601, 0xFF6D9304, 0xFF658202, 0xFF606600, 0xFF6D5A00, 0xFF865C00, 0xFF995D01, 0xFF9A5A02,
+	0xFF945A02, 0xFF835D00, 0xFF676B00, 0xFF527C02, 0xFF578501, 0xFF6E8101, 0xFF7A7801, 0xFF6C7902,
+	0xFF507B05, 0xFF437402, 0xFF4D6700, 0xFF6F5900, 0xFF895501, 0xFF765B00, 0xFF4A5C00, 0xFF355F00,
+	0xFF3A6400, 0xFF4E6600, 0xFF586A00, 0xFF627402, 0xFF768B05, 0xFF889F02, 0xFF85A601, 0xFF63A401,
+	0xFF519B07, 0xFF6E9105, 0xFF9E8106, 0xFFAD7B02, 0xFF957700, 0xFF696F00, 0xFF565F02, 0xFF565700,
+	0xFF5C5601, 0xFF565A01, 0xFF4E5000, 0xFF3D3700, 0xFF342800, 0xFF3D2F02, 0xFF5E5202, 0xFF857904,
+	0xFF8B8E07, 0xFF6C9906, 0xFF668B00, 0xFF8A7801, 0xFFA07606, 0xFF837304, 0xFF5C6600, 0xFF5E5701,
+	0xFF7A5D05, 0xFF8F6401, 0xFF775C00, 0xFF5B5500, 0xFF715901, 0xFF995102, 0xFF924A00, 0xFF705B01,
+	0xFF6C8304, 0xFF83B304, 0xFF88C203, 0xFF76AC01, 0xFF789202, 0xFF8E8203, 0xFF918204, 0xFF698A02,
+	0xFF339600, 0xFF32A100, 0xFF54A604, 0xFF7D9103, 0xFF7A7100, 0xFF745800, 0xFF806000, 0xFF908904,
+	0xFF81AD07, 0xFF61B807, 0xFF66A50A, 0xFF778603, 0xFF726A00, 0xFF515900, 0xFF375300, 0xFF335000,
+	0xFF584E01, 0xFF875204, 0xFF825606, 0xFF514D01, 0xFF3D3C00, 0xFF443A00, 0xFF664E00, 0xFF836706,
+	0xFF8D7103, 0xFF7C6F02, 0xFF5C6002, 0xFF4B5400, 0xFF415400, 0xFF416000, 0xFF4D7401, 0xFF637C03,
+	0xFF717301, 0xFF715A00, 0xFF644400, 0xFF5E4600, 0xFF6C5C02, 0xFF7F7E02, 0xFF799E00, 0xFF6FAD03,
+	0xFF709D01, 0xFF6D7B00, 0xFF6E6001, 0xFF785D00, 0xFF777301, 0xFF6D8B03, 0xFF789700, 0xFF959901,
+	0xFF6E8D00, 0xFF355F00, 0xFF273800, 0xFF453102, 0xFF723B06, 0xFF924603, 0xFFA65503, 0xFFA85D03,
+	0xFF8D6900, 0xFF6D7500, 0xFF5F7603, 0xFF637500, 0xFF7C7905, 0xFF927103, 0xFF885F00, 0xFF804700,
+	0xFF883A00, 0xFF954700, 0xFF856301, 0xFF6A8208, 0xFF608D06, 0xFF638604, 0xFF637400, 0xFF5A6A00,
+	0xFF4E6601, 0xFF406700, 0xFF446400, 0xFF686000, 0xFF866101, 0xFF766302, 0xFF506601, 0xFF3C7601,
+	0xFF4B8504, 0xFF708C03, 0xFF859A00, 0xFF96A103, 0xFF9CAB07, 0xFF8BAE05, 0xFF689F00, 0xFF458501,
+	0xFF3B6B02, 0xFF625800, 0xFF8F4D00, 0xFF994A00, 0xFF705400, 0xFF465801, 0xFF495305, 0xFF695800,
+	0xFF776600, 0xFF687500, 0xFF4E7401, 0xFF475601, 0xFF494100, 0xFF494100, 0xFF594501, 0xFF7B4800,
+	0xFF806000, 0xFF6F8900, 0xFF68A300, 0xFF869E03, 0xFFA38B09, 0xFF8B7002, 0xFF595D00, 0xFF4C4800,
+	0xFF6F3501, 0xFF913600, 0xFF884C00, 0xFF766C00, 0xFF848401, 0xFF9B8303, 0xFF9A7D01, 0xFF898705,
+	0xFF92A40A, 0xFF9CBE0C, 0xFF84B204, 0xFF5A9101, 0xFF5E7900, 0xFF857100, 0xFF8A7100, 0xFF697100,
+	0xFF547D00, 0xFF58A002, 0xFF63BA01, 0xFF67AC06, 0xFF588302, 0xFF675C00, 0xFF975600, 0xFFB26F00,
+	0xFF998C00, 0xFF5F8F01, 0xFF417507, 0xFF4A5901, 0xFF584900, 0xFF4D4A00, 0xFF395700, 0xFF3D5D00,
+	0xFF675B01, 0xFF955707, 0xFF8A5502, 0xFF514D01, 0xFF3C3E01, 0xFF5C3D00, 0xFF825A05, 0xFF887405,
+	0xFF807900, 0xFF6A6C02, 0xFF535401, 0xFF4A4500, 0xFF4C4901, 0xFF595F02, 0xFF668901, 0xFF71B007,
+	0xFF70B007, 0xFF658602, 0xFF5E5701, 0xFF654300, 0xFF924603, 0xFF9C6201, 0xFF808400, 0xFF669600,
+	0xFF5C9100, 0xFF5D7A00, 0xFF656300, 0xFF7D6600, 0xFF8A7D01, 0xFF8F9A01, 0xFF95AD05, 0xFF8DA405,
+	0xFF455F04, 0xFF1D4300, 0xFF2A3A00, 0xFF5A4C00, 0xFF826500, 0xFFA47200, 0xFFB67200, 0xFFAE6300,
+	0xFF925700, 0xFF715B00, 0xFF617001, 0xFF718603, 0xFF7E9406, 0xFF728902, 0xFF586A02, 0xFF4C4800,
+	0xFF713B00, 0xFFA44500, 0xFFAE5400, 0xFF8A6504, 0xFF626803, 0xFF466601, 0xFF465F01, 0xFF4C5B00,
+	0xFF4E6400, 0xFF4B7204, 0xFF487D01, 0xFF5D8400, 0xFF7A8500, 0xFF7E7E01, 0xFF697F02, 0xFF559202,
+	0xFF66A305, 0xFF8BA403, 0xFFA89E01, 0xFFB39B00, 0xFFA49504, 0xFF737D07, 0xFF3B6A01, 0xFF245500,
+	0xFF3A4800, 0xFF724802, 0xFFA24E00, 0xFF975901, 0xFF5C6001, 0xFF336800, 0xFF4E7600, 0xFF8C8200,
+	0xFF9B8B00, 0xFF7C8A01, 0xFF507805, 0xFF4C5F03, 0xFF585801, 0xFF565700, 0xFF4C4800, 0xFF633204,
+	0xFF813600, 0xFF826201, 0xFF798903, 0xFF7E8E04, 0xFF967E05, 0xFF876C04, 0xFF4E6200, 0xFF395300,
+	0xFF604300, 0xFF944E01, 0xFFA87300, 0xFF9F9B00, 0xFF8EAF00, 0xFF92AA01, 0xFF949C01, 0xFF999503,
+	0xFFA49A02, 0xFF979803, 0xFF6F8900, 0xFF517F00, 0xFF5B8300, 0xFF7C8503, 0xFF7E7B00, 0xFF716C00,
+	0xFF767803, 0xFF849C07, 0xFF88B704, 0xFF68B006, 0xFF468A00, 0xFF576300, 0xFF964F01, 0xFFBC5001,
+	0xFF995502, 0xFF565300, 0xFF334900, 0xFF484800, 0xFF665C01, 0xFF687202, 0xFF4F8401, 0xFF4C8801,
+	0xFF707D03, 0xFF936902, 0xFF855200, 0xFF4D4401, 0xFF453F00, 0xFF764700, 0xFFA15707, 0xFF976202,
+	0xFF716401, 0xFF505701, 0xFF404D00, 0xFF434900, 0xFF5E4F00, 0xFF766500, 0xFF7A9501, 0xFF7FBE06,
+	0xFF70C705, 0xFF4AB101, 0xFF448502, 0xFF6B6700, 0xFFA75902, 0xFFB45900, 0xFF8F6600, 0xFF726D00,
+	0xFF646F00, 0xFF587301, 0xFF637A00, 0xFF7F8401, 0xFF9C8C06, 0xFFB39103, 0xFFA28D02, 0xFF6E7A04,
+	0xFF2B4201, 0xFF224E03, 0xFF3E6A02, 0xFF788200, 0xFF9EA000, 0xFFACB002, 0xFFA4A302, 0xFF948607,
+	0xFF7F5E01, 0xFF6C4900, 0xFF665B00, 0xFF787904, 0xFF758608, 0xFF557D02, 0xFF326801, 0xFF2E5E00,
+	0xFF615D00, 0xFF9B6000, 0xFFB55700, 0xFF994B00, 0xFF5D4100, 0xFF314400, 0xFF364C01, 0xFF5C5603,
+	0xFF6E6E04, 0xFF678304, 0xFF579602, 0xFF559B02, 0xFF6B9402, 0xFF7C8601, 0xFF7C7E03, 0xFF728603,
+	0xFF708A01, 0xFF7E8100, 0xFF976B00, 0xFFA25D00, 0xFF895902, 0xFF4D5203, 0xFF1E4E00, 0xFF214F00,
+	0xFF595701, 0xFF936B08, 0xFFAD7109, 0xFF8F6F06, 0xFF556C01, 0xFF427602, 0xFF708E01, 0xFFABA203,
+	0xFFAF9F07, 0xFF777C05, 0xFF4D5A01, 0xFF565100, 0xFF686503, 0xFF5E7303, 0xFF406700, 0xFF4B4901,
+	0xFF803600, 0xFF924101, 0xFF7A5501, 0xFF7A5D01, 0xFF8D5B02, 0xFF875F03, 0xFF536400, 0xFF376702,
+	0xFF667403, 0xFFA68C01, 0xFFC1AC04, 0xFFABC507, 0xFF8FCA01, 0xFF81BE01, 0xFF7DA400, 0xFF8E8F00,
+	0xFF938901, 0xFF858000, 0xFF637900, 0xFF588201, 0xFF669408, 0xFF6A9609, 0xFF627C03, 0xFF6E6400,
+	0xFF906B03, 0xFFA38504, 0xFF919404, 0xFF578701, 0xFF3A7100, 0xFF566100, 0xFF955A00, 0xFFAE5800,
+	0xFF845703, 0xFF4A5400, 0xFF435900, 0xFF6A6B03, 0xFF898307, 0xFF878F03, 0xFF6B9104, 0xFF488805,
+	0xFF557603, 0xFF705900, 0xFF6E3B00, 0xFF513600, 0xFF624400, 0xFF945301, 0xFFB45405, 0xFF9F5202,
+	0xFF605300, 0xFF385A00, 0xFF366203, 0xFF446B01, 0xFF5D6E00, 0xFF846F01, 0xFF948906, 0xFF88A901,
+	0xFF70B400, 0xFF46B102, 0xFF3DA600, 0xFF6D9504, 0xFF9C8508, 0xFFA87603, 0xFF946600, 0xFF7F5500,
+	0xFF775301, 0xFF705D03, 0xFF746F03, 0xFF838102, 0xFF968300, 0xFFA06D01, 0xFF7F5301, 0xFF494300,
+	0xFF2D4400, 0xFF3A7701, 0xFF57A101, 0xFF8EBA00, 0xFFAFC900, 0xFFA8CA01, 0xFF86B904, 0xFF609306,
+	0xFF486401, 0xFF534401, 0xFF6B4204, 0xFF785203, 0xFF6B5A03, 0xFF4D5E01, 0xFF326300, 0xFF407706,
+	0xFF608A05, 0xFF878800, 0xFF9F6F02, 0xFF9A4E03, 0xFF6A3B00, 0xFF3D3D00, 0xFF434400, 0xFF714F04,
+	0xFF8D6405, 0xFF867903, 0xFF6B8204, 0xFF528703, 0xFF597E01, 0xFF697301, 0xFF716901, 0xFF6E6003,
+	0xFF5A5003, 0xFF553D00, 0xFF6C2A02, 0xFF842705, 0xFF733B00, 0xFF4C5B00, 0xFF257200, 0xFF348003,
+	0xFF6A8105, 0xFF948206, 0xFF9B7708, 0xFF756B01, 0xFF566900, 0xFF617302, 0xFF908E03, 0xFFB59B05,
+	0xFF9B8806, 0xFF5E5C04, 0xFF494100, 0xFF6C4A01, 0xFF837004, 0xFF619106, 0xFF2C9400, 0xFF357700,
+	0xFF715305, 0xFF8D3902, 0xFF7C3700, 0xFF783D00, 0xFF904600, 0xFF8F5400, 0xFF586500, 0xFF427E03,
+	0xFF6AA302, 0xFFABC000, 0xFFC5CD04, 0xFFA7D606, 0xFF85D000, 0xFF6DC003, 0xFF5DA804, 0xFF669000,
+	0xFF6C8705, 0xFF658102, 0xFF577F01, 0xFF548704, 0xFF5D8707, 0xFF507903, 0xFF445C01, 0xFF5D4E00,
+	0xFF965101, 0xFFA55F00, 0xFF796300, 0xFF445C03, 0xFF435E03, 0xFF747000, 0xFF9C8C01, 0xFF8F9605,
+	0xFF628B03, 0xFF418101, 0xFF4E8401, 0xFF7D8A03, 0xFF948905, 0xFF8F7505, 0xFF656702, 0xFF356101,
+	0xFF2D5600, 0xFF464601, 0xFF603B03, 0xFF754301, 0xFF8E5702, 0xFFAD5E04, 0xFFB45402, 0xFF9C5001,
+	0xFF6D5D00, 0xFF447600, 0xFF3B9300, 0xFF46A300, 0xFF519C00, 0xFF778E03, 0xFF978805, 0xFF9A8D00,
+	0xFF7F8E00, 0xFF578A02, 0xFF419200, 0xFF5C9803, 0xFF859308, 0xFF928204, 0xFF8E6D00, 0xFF815D00,
+	0xFF814E01, 0xFF894500, 0xFF864B00, 0xFF7A6000, 0xFF7A6600, 0xFF764D00, 0xFF552E00, 0xFF332800,
+	0xFF475701, 0xFF559003, 0xFF6CB300, 0xFF93BF02, 0xFFA1BB01, 0xFF8CA600, 0xFF619002, 0xFF357700,
+	0xFF266000, 0xFF3B5201, 0xFF674004, 0xFF783902, 0xFF6D3F00, 0xFF545000, 0xFF556903, 0xFF6A8605,
+	0xFF6F9D02, 0xFF6F9E02, 0xFF7C8907, 0xFF886007, 0xFF784100, 0xFF553B00, 0xFF563B00, 0xFF7B3E01,
+	0xFF9F4500, 0xFF995500, 0xFF7C5E01, 0xFF5C6700, 0xFF506A00, 0xFF546800, 0xFF5F5F02, 0xFF584D02,
+	0xFF3D3000, 0xFF2B1A00, 0xFF441605, 0xFF7A2A03, 0xFF885C00, 0xFF738B02, 0xFF46A307, 0xFF409C05,
+	0xFF628501, 0xFF836C00, 0xFF855E00, 0xFF6B6300, 0xFF5F6C00, 0xFF6F7701, 0xFF907904, 0xFF966C02,
+	0xFF725900, 0xFF4D4B01, 0xFF584F01, 0xFF886800, 0xFF988C02, 0xFF6AA404, 0xFF2BA902, 0xFF2C9901,
+	0xFF598104, 0xFF7B6003, 0xFF804B00, 0xFF7E4B00, 0xFF9A5201, 0xFF975E05, 0xFF5F7301, 0xFF459301,
+	0xFF70B803, 0xFFAECD00, 0xFFC2CF01, 0xFFA3C704, 0xFF7BB702, 0xFF5BA200, 0xFF429000, 0xFF418300,
+	0xFF4D8002, 0xFF4A7B01, 0xFF426E01, 0xFF426903, 0xFF3D5C03, 0xFF2E4900, 0xFF3B3B00, 0xFF614300,
+	0xFF8B4E00, 0xFF8C5400, 0xFF5D5700, 0xFF465B01, 0xFF647503, 0xFF989606, 0xFFA7AF09, 0xFF7AAF09,
+	0xFF459D01, 0xFF368D00, 0xFF478601, 0xFF667A00, 0xFF786800, 0xFF7D5305, 0xFF654E02, 0xFF3D5500,
+	0xFF275700, 0xFF356001, 0xFF696B02, 0xFF9B7801, 0xFFAB7C01, 0xFFA77204, 0xFFA56301, 0xFF9D6200,
+	0xFF8B6F00, 0xFF679403, 0xFF58B805, 0xFF53C504, 0xFF53C002, 0xFF68AD00, 0xFF8A9900, 0xFF987E01,
+	0xFF7A6600, 0xFF4D5800, 0xFF345D01, 0xFF496800, 0xFF6C6A00, 0xFF8B6700, 0xFF8F6F01, 0xFF7F7102,
+	0xFF806400, 0xFF895400, 0xFF854B00, 0xFF775000, 0xFF6D5700, 0xFF595000, 0xFF453E00, 0xFF413B00,
+	0xFF697600, 0xFF768C06, 0xFF789900, 0xFF7F8F04, 0xFF7D7808, 0xFF625B03, 0xFF404900, 0xFF234900,
+	0xFF1F5200, 0xFF395C00, 0xFF5F5800, 0xFF735100, 0xFF6C5000, 0xFF665000, 0xFF765E04, 0xFF8A7303,
+	0xFF838600, 0xFF619700, 0xFF528C02, 0xFF616401, 0xFF6E4300, 0xFF653901, 0xFF5F3D01, 0xFF7A4202,
+	0xFFA24600, 0xFFAD5100, 0xFF925D05, 0xFF6B6303, 0xFF506400, 0xFF4E6000, 0xFF525D02, 0xFF455200,
+	0xFF2B3E00, 0xFF1B3101, 0xFF413F00, 0xFF8C6300, 0xFFAE9000, 0xFF95AD00, 0xFF5DAA03, 0xFF3C8505,
+	0xFF4E5E01, 0xFF804E00, 0xFF965501, 0xFF826702, 0xFF687400, 0xFF636D02, 0xFF685B06, 0xFF674801,
+	0xFF5C4700, 0xFF5B5C00, 0xFF7E7F01, 0xFFAE9B00, 0xFFABA704, 0xFF72AA02, 0xFF2BA602, 0xFF1FAC02,
+	0xFF43A904, 0xFF659402, 0xFF6D7A00, 0xFF7E6800, 0xFFA15E05, 0xFF9F6609, 0xFF697F01, 0xFF4CA100,
+	0xFF76B704, 0xFFAAC201, 0xFFB0BB01, 0xFF8DA603, 0xFF648204, 0xFF406400, 0xFF305D00, 0xFF3B5F04,
+	0xFF496200, 0xFF456000, 0xFF365802, 0xFF2E5000, 0xFF2B4B01, 0xFF2B4800, 0xFF4C4D02, 0xFF815D04,
+	0xFF9E6C01, 0xFF7F7701, 0xFF4F7900, 0xFF5A7801, 0xFF8F8C02, 0xFFB19F06, 0xFF9C9C06, 0xFF5E8701,
+	0xFF337300, 0xFF306A00, 0xFF396400, 0xFF455A00, 0xFF625100, 0xFF7D5A00, 0xFF7E6800, 0xFF5A7900,
+	0xFF338A00, 0xFF419D00, 0xFF7BAC03, 0xFFA6B003, 0xFFAAA300, 0xFF948F01, 0xFF928700, 0xFFA28400,
+	0xFFA18B03, 0xFF88A205, 0xFF71B105, 0xFF65B705, 0xFF59B702, 0xFF53B000, 0xFF6A9601, 0xFF786B03,
+	0xFF5A4401, 0xFF343601, 0xFF273701, 0xFF3E4000, 0xFF6B4900, 0xFF985700, 0xFFA26A03, 0xFF8F7505,
+	0xFF817F03, 0xFF847701, 0xFF7F6D04, 0xFF776C01, 0xFF766D01, 0xFF666C06, 0xFF4F6B02, 0xFF516C00,
+	0xFF827F02, 0xFF827D03, 0xFF767200, 0xFF686001, 0xFF584505, 0xFF472E03, 0xFF352100, 0xFF282601,
+	0xFF2E3B02, 0xFF485C00, 0xFF687701, 0xFF7A7904, 0xFF696D01, 0xFF5F5D00, 0xFF795300, 0xFF9C4E00,
+	0xFF9D5902, 0xFF697001, 0xFF456E00, 0xFF4C5D00, 0xFF6A5001, 0xFF6F5103, 0xFF5E6001, 0xFF726A00,
+	0xFFA17102, 0xFFB57C02, 0xFF9A7D03, 0xFF657006, 0xFF485C00, 0xFF534800, 0xFF624B06, 0xFF545903,
+	0xFF386802, 0xFF377502, 0xFF6F8500, 0xFFB19600, 0xFFBFA307, 0xFF949706, 0xFF547900, 0xFF2B6101,
+	0xFF435706, 0xFF896301, 0xFFAD7305, 0xFF927505, 0xFF5C6C02, 0xFF4A5D00, 0xFF555801, 0xFF5A5E01,
+	0xFF656901, 0xFF838000, 0xFFA99C03, 0xFFC3A309, 0xFFB69907, 0xFF749101, 0xFF2DA000, 0xFF21B301,
+	0xFF3CB905, 0xFF4EA702, 0xFF538201, 0xFF6E6000, 0xFF984D03, 0xFFA74F01, 0xFF807000, 0xFF699A00,
+	0xFF82B105, 0xFF94AB02, 0xFF839300, 0xFF607201, 0xFF424F02, 0xFF2F3F00, 0xFF374400, 0xFF575100,
+	0xFF665701, 0xFF565802, 0xFF405D01, 0xFF3A6900, 0xFF377500, 0xFF418502, 0xFF698D03, 0xFF9D8902,
+	0xFFAE8403, 0xFF878105, 0xFF557E00, 0xFF618002, 0xFF9D7D04, 0xFFA67200, 0xFF765E00, 0xFF495400,
+	0xFF3C5502, 0xFF486000, 0xFF456600, 0xFF406400, 0xFF636C01, 0xFF987D06, 0xFFA28B07, 0xFF6DA003,
+	0xFF3ABB01, 0xFF4CCD00, 0xFF83D404, 0xFFA9C70A, 0xFFA8B505, 0xFF95AA00, 0xFF91A400, 0xFFA29705,
+	0xFFA28F07, 0xFF8E8902, 0xFF7A8100, 0xFF678001, 0xFF528200, 0xFF3F8300, 0xFF436800, 0xFF4E4300,
+	0xFF3F2F00, 0xFF2F2C01, 0xFF2F3B04, 0xFF4B5901, 0xFF826A02, 0xFFA46C02, 0xFFA96800, 0xFF996C01,
+	0xFF907C01, 0xFF8A8F00, 0xFF819301, 0xFF798F04, 0xFF7B8405, 0xFF747A08, 0xFF557B01, 0xFF578103,
+	0xFF7E7D01, 0xFF7A7800, 0xFF6A6100, 0xFF5C4F00, 0xFF4E4100, 0xFF453100, 0xFF3F2301, 0xFF3F1C00,
+	0xFF4D2901, 0xFF684E00, 0xFF887303, 0xFF84830A, 0xFF627C03, 0xFF526E02, 0xFF646001, 0xFF964700,
+	0xFFA04003, 0xFF7F4903, 0xFF615800, 0xFF5C6400, 0xFF736F00, 0xFF6E8104, 0xFF5A8F01, 0xFF6D9300,
+	0xFFA39201, 0xFFB39D00, 0xFF8B9904, 0xFF4C8102, 0xFF356100, 0xFF574100, 0xFF7F4202, 0xFF7C6104,
+	0xFF5E8704, 0xFF61A003, 0xFF8BA802, 0xFFB09803, 0xFF9D7D0B, 0xFF685904, 0xFF414401, 0xFF365500,
+	0xFF5A7E00, 0xFF93A202, 0xFFA5A101, 0xFF7B8303, 0xFF4C6B02, 0xFF4D6B02, 0xFF687901, 0xFF738901,
+	0xFF778B01, 0xFF8C8900, 0xFFB27903, 0xFFC56E05, 0xFFB26702, 0xFF7D6B00, 0xFF458F00, 0xFF26B005,
+	0xFF28B406, 0xFF319601, 0xFF3E6301, 0xFF5E4300, 0xFF963600, 0xFFB34300, 0xFFA86D02, 0xFF959702,
+	0xFF87A102, 0xFF6A8701, 0xFF536200, 0xFF444F00, 0xFF3D4A00, 0xFF3E4D02, 0xFF5B5903, 0xFF806B03,
+	0xFF857700, 0xFF717800, 0xFF648101, 0xFF629B02, 0xFF54B301, 0xFF52BB04, 0xFF68AD02, 0xFF8E8E04,
+	0xFFA17104, 0xFF8E5E04, 0xFF645D01, 0xFF646101, 0xFF815802, 0xFF7E4501, 0xFF5C3D02, 0xFF4B4C00,
+	0xFF616E03, 0xFF788C05, 0xFF649F00, 0xFF48A700, 0xFF6DA501, 0xFFAE9903, 0xFFB19804, 0xFF72A703,
+	0xFF3EBD02, 0xFF4BCC03, 0xFF6FCB07, 0xFF8DB905, 0xFF9DAE02, 0xFF9BAF00, 0xFF929D01, 0xFF8C7F05,
+	0xFF856407, 0xFF854F02, 0xFF7C4000, 0xFF653B00, 0xFF553E00, 0xFF464500, 0xFF374600, 0xFF313500,
+	0xFF362A00, 0xFF3C3602, 0xFF505F03, 0xFF729202, 0xFF8FA404, 0xFF938F07, 0xFF897001, 0xFF905F00,
+	0xFFA46801, 0xFFA28C01, 0xFF8DA100, 0xFF7A9702, 0xFF748002, 0xFF696E01, 0xFF556C00, 0xFF5B7401,
+	0xFF7B7D00, 0xFF777404, 0xFF696200, 0xFF655D01, 0xFF595F00, 0xFF4F5500, 0xFF554001, 0xFF562B03,
+	0xFF602300, 0xFF843900, 0xFFA65102, 0xFF965E05, 0xFF636800, 0xFF457102, 0xFF4A7303, 0xFF746200,
+	0xFF8A5602, 0xFF8A5603, 0xFF866B03, 0xFF858103, 0xFF7F8D02, 0xFF678F01, 0xFF578A02, 0xFF738800,
+	0xFFAD8400, 0xFFB29300, 0xFF7E9F03, 0xFF3D9C02, 0xFF288701, 0xFF556301, 0xFF924E01, 0xFF9A5C00,
+	0xFF767C00, 0xFF6C8B04, 0xFF858106, 0xFF8E6801, 0xFF694E00, 0xFF493A00, 0xFF473E00, 0xFF5A6701,
+	0xFF7FA104, 0xFF9DC40A, 0xFF87BB03, 0xFF589800, 0xFF518101, 0xFF678705, 0xFF799104, 0xFF789305,
+	0xFF668400, 0xFF687200, 0xFF8D5800, 0xFFB34000, 0xFFBB3500, 0xFF9E4400, 0xFF6A6D00, 0xFF399203,
+	0xFF179601, 0xFF108200, 0xFF296302, 0xFF585000, 0xFFA05000, 0xFFCA6501, 0xFFC98404, 0xFFA49706,
+	0xFF6D8B00, 0xFF456E00, 0xFF3D5904, 0xFF506100, 0xFF636E03, 0xFF617A07, 0xFF738501, 0xFF928C06,
+	0xFF959303, 0xFF879901, 0xFF83A106, 0xFF7CA906, 0xFF6BAE02, 0xFF4CA604, 0xFF428C04, 0xFF616C04,
+	0xFF7D5800, 0xFF885500, 0xFF765501, 0xFF664F03, 0xFF6A4301, 0xFF694100, 0xFF605700, 0xFF6F7501,
+	0xFF929D03, 0xFF98B403, 0xFF76C003, 0xFF54CC02, 0xFF68C903, 0xFFA0B001, 0xFFA39700, 0xFF748A01,
+	0xFF559103, 0xFF4E9B05, 0xFF599405, 0xFF6B8D00, 0xFF8A9500, 0xFF919602, 0xFF787503, 0xFF5F5200,
+	0xFF643802, 0xFF6F2801, 0xFF6A1E00, 0xFF5F1300, 0xFF611800, 0xFF653302, 0xFF435201, 0xFF305603,
+	0xFF424706, 0xFF5C4E04, 0xFF817202, 0xFF9B9A01, 0xFF92A800, 0xFF6A9A02, 0xFF5A7B01, 0xFF866300,
+	0xFFB56C02, 0xFFB68A07, 0xFF8E9506, 0xFF698300, 0xFF5F6F00, 0xFF5C6A00, 0xFF556500, 0xFF616800,
+	0xFF726507, 0xFF604802, 0xFF7B4D00, 0xFF8A5F00, 0xFF6E7704, 0xFF4D8203, 0xFF477900, 0xFF575704,
+	0xFF683B04, 0xFF902F00, 0xFFB12A00, 0xFF9F2C00, 0xFF6A3A00, 0xFF425600, 0xFF456B02, 0xFF627401,
+	0xFF818000, 0xFF968D02, 0xFF969603, 0xFF899807, 0xFF748902, 0xFF596D01, 0xFF515B03, 0xFF835301,
+	0xFFC05103, 0xFFC56403, 0xFF958A01, 0xFF50A708, 0xFF30A506, 0xFF4B8604, 0xFF7F5D01, 0xFF8D4A01,
+	0xFF774E03, 0xFF675102, 0xFF7D4803, 0xFF7A4701, 0xFF575100, 0xFF475603, 0xFF516101, 0xFF767501,
+	0xFFA09406, 0xFFA6AA06, 0xFF77AB01, 0xFF549900, 0xFF5A8D00, 0xFF6E8C01, 0xFF6B8A05, 0xFF5A8103,
+	0xFF497700, 0xFF507001, 0xFF696300, 0xFF904900, 0xFFB63000, 0xFFB92E00, 0xFF8C4800, 0xFF506600,
+	0xFF1C7D01, 0xFF038F02, 0xFF189A00, 0xFF579B01, 0xFFA59901, 0xFFDD9701, 0xFFD49201, 0xFF928303,
+	0xFF4A7801, 0xFF2E7302, 0xFF387905, 0xFF678301, 0xFF808D00, 0xFF779D01, 0xFF76A600, 0xFF8AA204,
+	0xFF8E9C04, 0xFF7C9901, 0xFF7A9107, 0xFF7C8203, 0xFF667201, 0xFF436901, 0xFF326400, 0xFF456500,
+	0xFF6C7200, 0xFF887D03, 0xFF836E03, 0xFF695200, 0xFF704200, 0xFF7D5B00, 0xFF7B8C01, 0xFF85A802,
+	0xFF97AB00, 0xFF9F9B02, 0xFF879603, 0xFF6FAC03, 0xFF6EBE08, 0xFF85AE04, 0xFF848C00, 0xFF6A6801,
+	0xFF5B5701, 0xFF4C5800, 0xFF4E5600, 0xFF665E00, 0xFF857305, 0xFF7B6E04, 0xFF494B01, 0xFF303200,
+	0xFF452701, 0xFF5B2403, 0xFF5F1A01, 0xFF5E0F00, 0xFF781E01, 0xFF8C4502, 0xFF6B7000, 0xFF3F8701,
+	0xFF427F04, 0xFF746F00, 0xFFAA7001, 0xFFB67C05, 0xFF928803, 0xFF518C01, 0xFF4A8900, 0xFF888400,
+	0xFFC18601, 0xFFBF8305, 0xFF847603, 0xFF5C6800, 0xFF617502, 0xFF779100, 0xFF72A107, 0xFF729106,
+	0xFF774408, 0xFF652F00, 0xFF962F00, 0xFFA84101, 0xFF7E6803, 0xFF488F04, 0xFF2D9D03, 0xFF3F7E02,
+	0xFF615804, 0xFF823C00, 0xFF9A2400, 0xFF8C1600, 0xFF711600, 0xFF672C00, 0xFF6D5100, 0xFF817F02,
+	0xFF91A003, 0xFF8EAF01, 0xFF7CA500, 0xFF5E8D02, 0xFF4A6C00, 0xFF3E5100, 0xFF553C01, 0xFF972D01,
+	0xFFD42E01, 0xFFDC4701, 0xFFBD6F04, 0xFF798807, 0xFF3F8902, 0xFF3D7003, 0xFF554F02, 0xFF654200,
+	0xFF6B4101, 0xFF6D4600, 0xFF864A02, 0xFF8A5404, 0xFF6E6A01, 0xFF547407, 0xFF506E03, 0xFF715D00,
+	0xFFA35A00, 0xFF9F6800, 0xFF767301, 0xFF597600, 0xFF528001, 0xFF5D8200, 0xFF538200, 0xFF408400,
+	0xFF398801, 0xFF418B04, 0xFF508804, 0xFF6D7203, 0xFF915700, 0xFFB84000, 0xFFAB3F00, 0xFF6D5400,
+	0xFF417C00, 0xFF28B003, 0xFF25D603, 0xFF55DF01, 0xFF9CCA04, 0xFFCEA104, 0xFFC07900, 0xFF785C01,
+	0xFF366005, 0xFF217402, 0xFF3C7F02, 0xFF718704, 0xFF968F03, 0xFF8FA600, 0xFF7EB401, 0xFF78A603,
+	0xFF6B8F00, 0xFF5F7600, 0xFF596700, 0xFF6A5F00, 0xFF685900, 0xFF536000, 0xFF4A7002, 0xFF568B01,
+	0xFF74A205, 0xFF7EA408, 0xFF6E8407, 0xFF5C5700, 0xFF774400, 0xFF9B6605, 0xFFA09B07, 0xFF82B303,
+	0xFF779A01, 0xFF836900, 0xFF8F5800, 0xFF8F6F00, 0xFF8F8C01, 0xFF7A8A02, 0xFF5D6900, 0xFF504B06,
+	0xFF5C3304, 0xFF5C2600, 0xFF5B3100, 0xFF704A00, 0xFF7D5B01, 0xFF5F4D01, 0xFF273300, 0xFF192300,
+	0xFF322204, 0xFF492601, 0xFF472400, 0xFF573104, 0xFF8D4807, 0xFFA75D01, 0xFF8A7400, 0xFF4D8E00,
+	0xFF3E9C00, 0xFF6C9900, 0xFFAA8501, 0xFFB27801, 0xFF867700, 0xFF537500, 0xFF568403, 0xFF8D9203,
+	0xFFC08A00, 0xFFAC6C00, 0xFF735E02, 0xFF627302, 0xFF7E9F09, 0xFF99BD02, 0xFF8CC005, 0xFF868E07,
+	0xFF8D3701, 0xFF7B4302, 0xFF893600, 0xFF963900, 0xFF875300, 0xFF5B7D01, 0xFF329603, 0xFF2E8500,
+	0xFF496805, 0xFF695204, 0xFF733D01, 0xFF692D02, 0xFF772500, 0xFF973101, 0xFFA85A06, 0xFFB18800,
+	0xFFA4A401, 0xFF72A302, 0xFF478704, 0xFF2A6D01, 0xFF1D6001, 0xFF205902, 0xFF4C5100, 0xFF964200,
+	0xFFDA3C00, 0xFFE55200, 0xFFC66A02, 0xFF7D6A01, 0xFF3D5900, 0xFF244800, 0xFF3A4400, 0xFF585103,
+	0xFF666101, 0xFF7E6400, 0xFF9D6306, 0xFF9E6405, 0xFF806901, 0xFF556302, 0xFF464D02, 0xFF623800,
+	0xFF9D2D02, 0xFFB12B05, 0xFF8B3502, 0xFF5C4F02, 0xFF4F7000, 0xFF548600, 0xFF4E9205, 0xFF3E9205,
+	0xFF3B8E02, 0xFF428A03, 0xFF448903, 0xFF538702, 0xFF768200, 0xFFA77302, 0xFFBD6103, 0xFFA56902,
+	0xFF839300, 0xFF64C501, 0xFF41E106, 0xFF45E601, 0xFF7BC404, 0xFFA38705, 0xFF9D4D01, 0xFF603302,
+	0xFF2E4003, 0xFF1F5C00, 0xFF3E6B00, 0xFF797902, 0xFFB28604, 0xFFB39C02, 0xFF8AA806, 0xFF579503,
+	0xFF407601, 0xFF455E00, 0xFF555F00, 0xFF706A02, 0xFF7C7901, 0xFF738C03, 0xFF719F02, 0xFF6EA804,
+	0xFF68A205, 0xFF5A9301, 0xFF457501, 0xFF405902, 0xFF6F4B01, 0xFFAA5905, 0xFFB57709, 0xFF818804,
+	0xFF577301, 0xFF614F02, 0xFF8E4502, 0xFFB14F00, 0xFFAE5302, 0xFF735003, 0xFF454600, 0xFF464501,
+	0xFF614301, 0xFF6D3800, 0xFF703701, 0xFF7B4701, 0xFF754A01, 0xFF4B3700, 0xFF1F2200, 0xFF161A04,
+	0xFF1D1C02, 0xFF2F2400, 0xFF3D4101, 0xFF576807, 0xFF858005, 0xFFA66F04, 0xFF8C5802, 0xFF516C00,
+	0xFF479300, 0xFF67B303, 0xFF98AE02, 0xFF9A9B00, 0xFF748301, 0xFF567000, 0xFF657101, 0xFF998101,
+	0xFFB08201, 0xFF966701, 0xFF6F6102, 0xFF708404, 0xFF8FA407, 0xFF93A704, 0xFF828000, 0xFF7E4600,
+	0xFF873600, 0xFF744C04, 0xFF745200, 0xFF845600, 0xFF8B6100, 0xFF707802, 0xFF458300, 0xFF2D7B00,
+	0xFF436901, 0xFF625D04, 0xFF615601, 0xFF5A5600, 0xFF745D00, 0xFFA86A04, 0xFFD2790B, 0xFFCB8402,
+	0xFF9B8400, 0xFF547302, 0xFF1D6303, 0xFF0D5C00, 0xFF135F00, 0xFF227000, 0xFF3D7F00, 0xFF837502,
+	0xFFCE6A04, 0xFFDC7401, 0xFFB87701, 0xFF6B6402, 0xFF344901, 0xFF2C4200, 0xFF425402, 0xFF606904,
+	0xFF6A7902, 0xFF807402, 0xFFA26101, 0xFF9C5000, 0xFF724200, 0xFF413E02, 0xFF333C03, 0xFF5C3B00,
+	0xFFA72E03, 0xFFCC1E04, 0xFFAB2401, 0xFF744602, 0xFF657300, 0xFF6B8F02, 0xFF5E9507, 0xFF3E8204,
+	0xFF356801, 0xFF435500, 0xFF4C5F00, 0xFF517D00, 0xFF739302, 0xFF9B9501, 0xFFC18501, 0xFFD78105,
+	0xFFBD9706, 0xFF86AD06, 0xFF47B602, 0xFF2CB100, 0xFF4D9901, 0xFF806A03, 0xFF813C01, 0xFF4F2F00,
+	0xFF313E00, 0xFF315700, 0xFF4F6700, 0xFF887301, 0xFFBF7E02, 0xFFC18202, 0xFF857D01, 0xFF406F00,
+	0xFF336202, 0xFF506500, 0xFF717702, 0xFF858B02, 0xFF869F02, 0xFF82AB04, 0xFF7CA701, 0xFF699103,
+	0xFF4A7101, 0xFF2E5600, 0xFF234F00, 0xFF2C5703, 0xFF5E5802, 0xFFA35300, 0xFFB95500, 0xFF845700,
+	0xFF4C4D00, 0xFF534D02, 0xFF8F5508, 0xFFBD5603, 0xFFAC4201, 0xFF6B2E00, 0xFF493600, 0xFF535701,
+	0xFF6C7203, 0xFF766D06, 0xFF745E01, 0xFF755800, 0xFF6B4F00, 0xFF3F4400, 0xFF1F3300, 0xFF132602,
+	0xFF162501, 0xFF363600, 0xFF556601, 0xFF649300, 0xFF799200, 0xFF876301, 0xFF7A3C01, 0xFF5D4C00,
+	0xFF618301, 0xFF85AE06, 0xFF9FB906, 0xFF8AAB06, 0xFF698701, 0xFF5A6F00, 0xFF727400, 0xFF9C8400,
+	0xFFA18705, 0xFF7F7502, 0xFF636600, 0xFF707001, 0xFF847906, 0xFF7E7104, 0xFF665200, 0xFF723300,
+	0xFF7C5200, 0xFF725700, 0xFF6A6A00, 0xFF7C7D02, 0xFF8C8500, 0xFF798600, 0xFF528000, 0xFF397800,
+	0xFF4A6E00, 0xFF6D6600, 0xFF6C6E00, 0xFF5D8401, 0xFF779600, 0xFFA99F01, 0xFFCF8D06, 0xFFC76C03,
+	0xFF854E00, 0xFF3F3E01, 0xFF134201, 0xFF0F4D03, 0xFF1C6101, 0xFF397F00, 0xFF549800, 0xFF7E9D06,
+	0xFFBD9506, 0xFFC98D00, 0xFFA17601, 0xFF525D01, 0xFF285500, 0xFF3A6202, 0xFF586E05, 0xFF666D00,
+	0xFF676500, 0xFF795D01, 0xFF945303, 0xFF874402, 0xFF523E00, 0xFF294803, 0xFF2F5D00, 0xFF686D02,
+	0xFFAD6002, 0xFFCD4B00, 0xFFBD4E00, 0xFF986500, 0xFF847D01, 0xFF7B840C, 0xFF5B7608, 0xFF325A00,
+	0xFF2C4100, 0xFF483A00, 0xFF684D00, 0xFF706F01, 0xFF718407, 0xFF8F8203, 0xFFC47A00, 0xFFE57B02,
+	0xFFCA7C03, 0xFF817206, 0xFF3D6207, 0xFF255F01, 0xFF456101, 0xFF746100, 0xFF705900, 0xFF475C03,
+	0xFF366805, 0xFF4A7204, 0xFF657901, 0xFF8E7900, 0xFFBA6C01, 0xFFB56000, 0xFF7D5B00, 0xFF496001,
+	0xFF446D02, 0xFF697E02, 0xFF828509, 0xFF868902, 0xFF828F01, 0xFF799003, 0xFF687F04, 0xFF495D01,
+	0xFF293700, 0xFF162500, 0xFF1C3200, 0xFF315900, 0xFF547500, 0xFF937600, 0xFFA66800, 0xFF7C5000,
+	0xFF4F4500, 0xFF535200, 0xFF876107, 0xFFA75B03, 0xFF8D4200, 0xFF562C00, 0xFF4D3501, 0xFF696305,
+	0xFF788C04, 0xFF729506, 0xFF718B02, 0xFF718100, 0xFF587800, 0xFF2F7300, 0xFF206301, 0xFF1B5501,
+	0xFF355402, 0xFF616A05, 0xFF798F01, 0xFF70A000, 0xFF648401, 0xFF635600, 0xFF6D4400, 0xFF7B5305,
+	0xFF8E7201, 0xFFA98D01, 0xFFB09407, 0xFF8F8707, 0xFF647D00, 0xFF627701, 0xFF817D02, 0xFF8F8902,
+	0xFF7F8305, 0xFF5A7104, 0xFF4F5D00, 0xFF6C5400, 0xFF7B5101, 0xFF774C00, 0xFF654A00, 0xFF6B5200,
+	0xFF717002, 0xFF756100, 0xFF7B6F01, 0xFF858F01, 0xFF8B9901, 0xFF7A8F03, 0xFF608702, 0xFF4B8500,
+	0xFF498603, 0xFF638400, 0xFF728F00, 0xFF6B9E05, 0xFF77A302, 0xFF959A00, 0xFFB77A05, 0xFFB14C04,
+	0xFF732A02, 0xFF372100, 0xFF1B2B01, 0xFF1A3D01, 0xFF2F5800, 0xFF5C7700, 0xFF7C9902, 0xFF8EB306,
+	0xFFA3B205, 0xFF9F9102, 0xFF796001, 0xFF524600, 0xFF435500, 0xFF487502, 0xFF5A7605, 0xFF5B6401,
+	0xFF605700, 0xFF7F5B00, 0xFF986404, 0xFF7D6901, 0xFF3F7300, 0xFF238700, 0xFF379C01, 0xFF66A301,
+	0xFF9C9501, 0xFFC78004, 0xFFC78103, 0xFFAA8801, 0xFF8C8202, 0xFF6C6D07, 0xFF485505, 0xFF314F00,
+	0xFF345100, 0xFF585B02, 0xFF846304, 0xFF856805, 0xFF636701, 0xFF795700, 0xFFB65000, 0xFFD15800,
+	0xFFAB5100, 0xFF603A00, 0xFF352904, 0xFF373900, 0xFF6B4F03, 0xFF906801, 0xFF7E7E00, 0xFF558D06,
+	0xFF408F06, 0xFF4D8605, 0xFF617D01, 0xFF827700, 0xFFA76900, 0xFFB05E00, 0xFF8B6B00, 0xFF617F02,
+	0xFF5A870A, 0xFF6B8203, 0xFF6F7402, 0xFF716600, 0xFF775E00, 0xFF715706, 0xFF544804, 0xFF2D3000,
+	0xFF141B00, 0xFF171D00, 0xFF2E3900, 0xFF4C6500, 0xFF709000, 0xFF939C04, 0xFF8E8C07, 0xFF616904,
+	0xFF464E00, 0xFF564E00, 0xFF865401, 0xFF954E01, 0xFF723F02, 0xFF4D3B00, 0xFF514802, 0xFF6F6401,
+	0xFF7F7A01, 0xFF748F00, 0xFF729F01, 0xFF6FAB00, 0xFF51A901, 0xFF2DA604, 0xFF279F01, 0xFF3D9202,
+	0xFF669004, 0xFF849A08, 0xFF85A003, 0xFF649401, 0xFF4B7800, 0xFF566500, 0xFF7A6A01, 0xFF937004,
+	0xFF986D00, 0xFFA36700, 0xFFA66100, 0xFF8D5A03, 0xFF686500, 0xFF6A7400, 0xFF817505, 0xFF7B7004,
+	0xFF5A6401, 0xFF405C02, 0xFF4E5A00, 0xFF745900, 0xFF865500, 0xFF7E5601, 0xFF656302, 0xFF647600,
+	0xFF697503, 0xFF736801, 0xFF947105, 0xFF998902, 0xFF858D03, 0xFF6F8305, 0xFF5E8500, 0xFF518D00,
+	0xFF449701, 0xFF4BA100, 0xFF65A304, 0xFF6E9805, 0xFF717D05, 0xFF816800, 0xFF9C5300, 0xFF9D3800,
+	0xFF6F2A00, 0xFF442C02, 0xFF343501, 0xFF354400, 0xFF485701, 0xFF716E01, 0xFF9C8B03, 0xFFAB9F04,
+	0xFF939C04, 0xFF6B8203, 0xFF5A5700, 0xFF654601, 0xFF6A5900, 0xFF5B6E00, 0xFF4B6E01, 0xFF4D6300,
+	0xFF6D6600, 0xFF9A7900, 0xFFA49403, 0xFF87A702, 0xFF47BB00, 0xFF24CB03, 0xFF2ACE05, 0xFF48C101,
+	0xFF7DA801, 0xFFAD9607, 0xFFBB920A, 0xFFA68B03, 0xFF747E00, 0xFF4D6D00, 0xFF406500, 0xFF3A7101,
+	0xFF427A01, 0xFF628103, 0xFF807C07, 0xFF7A7003, 0xFF5B5A00, 0xFF6B4300, 0xFFA43703, 0xFFB73A01,
+	0xFF853D00, 0xFF483700, 0xFF403900, 0xFF624800, 0xFF965901, 0xFFB46B00, 0xFF9F7D02, 0xFF6F8405,
+	0xFF4C7F02, 0xFF407C01, 0xFF4F7C00, 0xFF777900, 0xFF9C7701, 0xFFB27C04, 0xFF9F8C02, 0xFF729901,
+	0xFF5B8A02, 0xFF586E01, 0xFF5D5E01, 0xFF695201, 0xFF714000, 0xFF643200, 0xFF4A2800, 0xFF322402,
+	0xFF242B00, 0xFF303901, 0xFF515705, 0xFF797B05, 0xFF939B06, 0xFF89A107, 0xFF6B8C05, 0xFF3E6F03,
+	0xFF2F5800, 0xFF564B00, 0xFF884A00, 0xFF984D03, 0xFF785804, 0xFF5E6703, 0xFF5A7100, 0xFF676F01,
+	0xFF766302, 0xFF816C00, 0xFF898E03, 0xFF7AB303, 0xFF5CBF02, 0xFF35BE05, 0xFF2DBB00, 0xFF5AAC02,
+	0xFF89A202, 0xFF969D04, 0xFF769007, 0xFF497B02, 0xFF3C7501, 0xFF5C8600, 0xFF8A9504, 0xFF938806,
+	0xFF837004, 0xFF825600, 0xFF8A4100, 0xFF7E3D02, 0xFF6D4800, 0xFF715D00, 0xFF7B5F03, 0xFF6C5200,
+	0xFF4C4E01, 0xFF435E00, 0xFF5E7702, 0xFF867E03, 0xFF927800, 0xFF7E6E01, 0xFF627103, 0xFF5F7D00,
+	0xFF727F00, 0xFF7F8602, 0xFFA18704, 0xFF9F8102, 0xFF777200, 0xFF5B6400, 0xFF556600, 0xFF506F01,
+	0xFF497D00, 0xFF4A9100, 0xFF559104, 0xFF5D7A00, 0xFF665C00, 0xFF7D4C00, 0xFF9F4400, 0xFF9B4602,
+	0xFF7A4D03, 0xFF605301, 0xFF575801, 0xFF5F5D01, 0xFF646503, 0xFF736E04, 0xFF987503, 0xFF9F7803,
+	0xFF7D7300, 0xFF516F01, 0xFF526E02, 0xFF687601, 0xFF757901, 0xFF637101, 0xFF447000, 0xFF487700,
+	0xFF7A8102, 0xFFAF8E04, 0xFFBAA306, 0xFF9DBE04, 0xFF60D903, 0xFF29E205, 0xFF1AD102, 0xFF29B102,
+	0xFF539300, 0xFF8A8000, 0xFFAF7105, 0xFFA76703, 0xFF786A00, 0xFF4F7700, 0xFF467F02, 0xFF408404,
+	0xFF438103, 0xFF5B7E00, 0xFF6C8200, 0xFF698103, 0xFF5B7403, 0xFF646400, 0xFF9B4F02, 0xFFAA4B00,
+	0xFF7C5000, 0xFF575A02, 0xFF556802, 0xFF706A04, 0xFF956802, 0xFFB65F00, 0xFFAE5702, 0xFF835403,
+	0xFF595A01, 0xFF466F00, 0xFF4C8602, 0xFF6D8A03, 0xFF8C8100, 0xFFB08006, 0xFFA98508, 0xFF717C02,
+	0xFF4B6300, 0xFF525501, 0xFF625702, 0xFF6D5002, 0xFF654000, 0xFF4F3B00, 0xFF3B4300, 0xFF3F4B00,
+	0xFF475200, 0xFF555C04, 0xFF766B08, 0xFF987B05, 0xFF928203, 0xFF6D7504, 0xFF446002, 0xFF265B00,
+	0xFF286101, 0xFF5A6103, 0xFF8D6800, 0xFFB07301, 0xFFA08604, 0xFF7D9008, 0xFF639303, 0xFF558204,
+	0xFF5F6601, 0xFF7B5800, 0xFFA26905, 0xFF9E8B07, 0xFF70A401, 0xFF39AD00, 0xFF35A200, 0xFF5E8F01,
+	0xFF8B8000, 0xFF8E7001, 0xFF5E6004, 0xFF415A01, 0xFF4D6F04, 0xFF759903, 0xFF92A702, 0xFF859506,
+	0xFF6D7D04, 0xFF695B01, 0xFF703F00, 0xFF6B3A00, 0xFF6B4200, 0xFF765501, 0xFF7C5D02, 0xFF685F02,
+	0xFF4E6402, 0xFF527D00, 0xFF759802, 0xFF8D9A07, 0xFF838B03, 0xFF6C7300, 0xFF666A00, 0xFF6D7300,
+	0xFF85A600, 0xFF90AF00, 0xFFA19F03, 0xFF8A7C05, 0xFF615403, 0xFF444200, 0xFF473B03, 0xFF5A3E07,
+	0xFF604F01, 0xFF5D6200, 0xFF556B01, 0xFF4F6800, 0xFF586200, 0xFF7F6202, 0xFFA95F00, 0xFFA66303,
+	0xFF846B04, 0xFF6B7101, 0xFF697202, 0xFF687103, 0xFF627103, 0xFF637004, 0xFF736501, 0xFF795E00,
+	0xFF726000, 0xFF597200, 0xFF5B8C01, 0xFF6B9D01, 0xFF6D9A02, 0xFF588B01, 0xFF3E8900, 0xFF439102,
+	0xFF729305, 0xFFA49505, 0xFFBA9902, 0xFFB1A201, 0xFF77B306, 0xFF33B906, 0xFF07AB00, 0xFF108D00,
+	0xFF387401, 0xFF756102, 0xFFA84B00, 0xFFB94000, 0xFFA14E00, 0xFF776903, 0xFF547803, 0xFF427600,
+	0xFF3F7200, 0xFF5D7600, 0xFF748800, 0xFF689701, 0xFF549E01, 0xFF639A00, 0xFF958F04, 0xFFA38404,
+	0xFF827600, 0xFF5D7301, 0xFF4E7504, 0xFF596B04, 0xFF766103, 0xFF9D5A00, 0xFFA15100, 0xFF8B4800,
+	0xFF6F5101, 0xFF5E6E03, 0xFF538D05, 0xFF578F04, 0xFF747D03, 0xFFA66004, 0xFFA54E09, 0xFF643C02,
+	0xFF473500, 0xFF654200, 0xFF735402, 0xFF675A02, 0xFF515A00, 0xFF456600, 0xFF438301, 0xFF4A8904,
+	0xFF567602, 0xFF6D6302, 0xFF8E5803, 0xFF9D5A00, 0xFF825700, 0xFF5E4C00, 0xFF3C4F00, 0xFF306001,
+	0xFF3D7A01, 0xFF608F00, 0xFF94A002, 0xFFBFA704, 0xFFB8A103, 0xFF8E9804, 0xFF5E9101, 0xFF338A03,
+	0xFF367402, 0xFF645800, 0xFFA44A02, 0xFFB45502, 0xFF806C02, 0xFF437A00, 0xFF327700, 0xFF546500,
+	0xFF795001, 0xFF753901, 0xFF562D00, 0xFF523C00, 0xFF6D6403, 0xFF928A03, 0xFF999902, 0xFF719603,
+	0xFF548300, 0xFF546800, 0xFF575A00, 0xFF5A5B00, 0xFF726401, 0xFF8B7203, 0xFF8A7B02, 0xFF768402,
+	0xFF619102, 0xFF5D9E00, 0xFF6D9D01, 0xFF749101, 0xFF637F02, 0xFF597200, 0xFF707100, 0xFF888705,
+	0xFF90B800, 0xFF90AF06, 0xFF889307, 0xFF676802, 0xFF433F04, 0xFF342F00, 0xFF462D02, 0xFF6C3503,
+	0xFF7F4700, 0xFF705903, 0xFF576202, 0xFF436A00, 0xFF4C7701, 0xFF738206, 0xFF9E7F03, 0xFFA27501,
+	0xFF806C01, 0xFF676E00, 0xFF6B6E00, 0xFF646F00, 0xFF597400, 0xFF4E7601, 0xFF4D6D00, 0xFF5E5E00,
+	0xFF726201, 0xFF777D01, 0xFF6D9004, 0xFF619604, 0xFF529301, 0xFF488B00, 0xFF448D00, 0xFF499406,
+	0xFF629306, 0xFF8A8B00, 0xFFB18200, 0xFFAE7403, 0xFF747303, 0xFF347605, 0xFF0B7602, 0xFF107D00,
+	0xFF287F04, 0xFF606807, 0xFF9B4600, 0xFFBF2E00, 0xFFBF3703, 0xFF9C5403, 0xFF6B6900, 0xFF4F7100,
+	0xFF537900, 0xFF728902, 0xFF7F9504, 0xFF6E9401, 0xFF5A9700, 0xFF72AA03, 0xFF96C004, 0xFF9AB308,
+	0xFF748D03, 0xFF4A6600, 0xFF3B4F00, 0xFF4B4D01, 0xFF705A01, 0xFF927003, 0xFF967803, 0xFF8B6D00,
+	0xFF856801, 0xFF737504, 0xFF4F8A02, 0xFF3D8B00, 0xFF597804, 0xFF7E5306, 0xFF7D2E01, 0xFF571B00,
+	0xFF592100, 0xFF7E3801, 0xFF874801, 0xFF6C5401, 0xFF5D6901, 0xFF5C8D02, 0xFF57AC02, 0xFF4CA50A,
+	0xFF497E05, 0xFF695900, 0xFF964501, 0xFFA24600, 0xFF875300, 0xFF765A00, 0xFF646A00, 0xFF578503,
+	0xFF58A202, 0xFF60B702, 0xFF85BC04, 0xFFAFAD06, 0xFFB29502, 0xFF888200, 0xFF4E7800, 0xFF217700,
+	0xFF1C7101, 0xFF4A5C01, 0xFF8C4002, 0xFFAC3102, 0xFF8C3C02, 0xFF595101, 0xFF396100, 0xFF495C00,
+	0xFF594902, 0xFF5A2C01, 0xFF581E00, 0xFF6B2900, 0xFF884900, 0xFFA36501, 0xFF937603, 0xFF617F00,
+	0xFF457B00, 0xFF3B7800, 0xFF477D02, 0xFF638502, 0xFF809306, 0xFF959803, 0xFF969904, 0xFF87A003,
+	0xFF6BA600, 0xFF649C01, 0xFF6A8703, 0xFF627C00, 0xFF567B00, 0xFF558701, 0xFF7E9202, 0xFFA0A804,
+	0xFF879106, 0xFF757E04, 0xFF5F6B02, 0xFF475200, 0xFF343F00, 0xFF364002, 0xFF5F4F00, 0xFF8A6000,
+	0xFF9B6D04, 0xFF807309, 0xFF516C02, 0xFF346D00, 0xFF367B01, 0xFF568602, 0xFF778406, 0xFF7B7402,
+	0xFF6B6100, 0xFF695800, 0xFF776200, 0xFF787403, 0xFF658203, 0xFF428A00, 0xFF317E01, 0xFF486E01,
+	0xFF6D6800, 0xFF867001, 0xFF707004, 0xFF4D6702, 0xFF445B01, 0xFF4C5D02, 0xFF506301, 0xFF506D03,
+	0xFF527A03, 0xFF787700, 0xFF9F6D00, 0xFF945400, 0xFF674400, 0xFF394900, 0xFF256400, 0xFF1F8A01,
+	0xFF249801, 0xFF418203, 0xFF785600, 0xFFAD3800, 0xFFBD4602, 0xFFB55E00, 0xFF8E7500, 0xFF6F8701,
+	0xFF6A9202, 0xFF7A9503, 0xFF738B09, 0xFF5F7801, 0xFF667500, 0xFF8F9107, 0xFFA3B803, 0xFF88B002,
+	0xFF597B02, 0xFF364602, 0xFF3B3202, 0xFF654500, 0xFF946E02, 0xFF9D8F05, 0xFF849801, 0xFF799000,
+	0xFF8C8200, 0xFF877B00, 0xFF4B8700, 0xFF229200, 0xFF368400, 0xFF515D00, 0xFF563600, 0xFF592501,
+	0xFF742E00, 0xFF903800, 0xFF8F3A01, 0xFF784900, 0xFF776402, 0xFF7A8406, 0xFF679206, 0xFF3C8A06,
+	0xFF2D7502, 0xFF595D01, 0xFF915901, 0xFFAF6C02, 0xFFAB8100, 0xFFA38800, 0xFF9D9401, 0xFF86AA01,
+	0xFF5CBC01, 0xFF4BB806, 0xFF60A804, 0xFF869202, 0xFF9E7C01, 0xFF816F02, 0xFF506701, 0xFF266602,
+	0xFF166502, 0xFF3B5301, 0xFF713901, 0xFF962901, 0xFF922E00, 0xFF6E4901, 0xFF526503, 0xFF456F02,
+	0xFF3F6500, 0xFF454900, 0xFF582E03, 0xFF7C2600, 0xFF9B2F02, 0xFFA94003, 0xFF894F00, 0xFF555E00,
+	0xFF3A6B00, 0xFF367D00, 0xFF479101, 0xFF679C01, 0xFF7FA402, 0xFF8EA300, 0xFF989F05, 0xFF8B9E04,
+	0xFF6D9801, 0xFF618600, 0xFF6E7900, 0xFF6E7D00, 0xFF658E00, 0xFF66A002, 0xFF85A101, 0xFF969D02,
+	0xFF735C07, 0xFF575500, 0xFF485700, 0xFF475A00, 0xFF4B5F01, 0xFF596E01, 0xFF7A8405, 0xFF9A9202,
+	0xFF9E8E03, 0xFF7D7904, 0xFF4C6300, 0xFF2C5B02, 0xFF246403, 0xFF407500, 0xFF5A7A03, 0xFF5C7301,
+	0xFF5F6600, 0xFF755C00, 0xFF8C6402, 0xFF8D7903, 0xFF6F8F08, 0xFF409904, 0xFF278D01, 0xFF397900,
+	0xFF636900, 0xFF725B00, 0xFF5E4700, 0xFF3F3801, 0xFF412800, 0xFF5B2C04, 0xFF613902, 0xFF574800,
+	0xFF5C5500, 0xFF6D5B00, 0xFF865200, 0xFF803C00, 0xFF5E3600, 0xFF4C4A00, 0xFF4B7101, 0xFF3BA004,
+	0xFF29AC01, 0xFF2B9000, 0xFF5F6A00, 0xFF9E6201, 0xFFBC7604, 0xFFBD8B09, 0xFFA29200, 0xFF809102,
+	0xFF6E8705, 0xFF687B01, 0xFF5E6E01, 0xFF576700, 0xFF746801, 0xFFA57600, 0xFFAA8300, 0xFF6E7D00,
+	0xFF385D00, 0xFF304402, 0xFF505202, 0xFF997201, 0xFFC48804, 0xFFB18603, 0xFF7C8800, 0xFF718E00,
+	0xFF968902, 0xFF938401, 0xFF518A01, 0xFF208E03, 0xFF198501, 0xFF266B00, 0xFF395201, 0xFF594907,
+	0xFF7A4901, 0xFF933E01, 0xFF913105, 0xFF853C00, 0xFF8D5300, 0xFF8C6001, 0xFF705E04, 0xFF415D00,
+	0xFF346B00, 0xFF5D7E02, 0xFF8C9803, 0xFFABAE03, 0xFFB4B302, 0xFFBFAE02, 0xFFBBB202, 0xFF94B601,
+	0xFF57B501, 0xFF389D01, 0xFF418100, 0xFF687000, 0xFF936C04, 0xFF877204, 0xFF5B6E01, 0xFF296702,
+	0xFF145902, 0xFF314400, 0xFF5E3300, 0xFF882900, 0xFF993100, 0xFF8B4E04, 0xFF726606, 0xFF557605,
+	0xFF397C00, 0xFF3A6B00, 0xFF564B01, 0xFF7E3B01, 0xFF973803, 0xFF983900, 0xFF7C3E00, 0xFF4C4A00,
+	0xFF365D00, 0xFF3A7900, 0xFF518F00, 0xFF6E9800, 0xFF799700, 0xFF859400, 0xFF8D9000, 0xFF848602,
+	0xFF677902, 0xFF5A7100, 0xFF727601, 0xFF838A03, 0xFF789E02, 0xFF6D9E04, 0xFF718900, 0xFF7A6E00,
+	0xFF665000, 0xFF5C5B00, 0xFF616A00, 0xFF6D7803, 0xFF738402, 0xFF789400, 0xFF889D05, 0xFF9E9C01,
+	0xFF958900, 0xFF6B6500, 0xFF3C4A00, 0xFF244703, 0xFF295601, 0xFF486D00, 0xFF597B00, 0xFF517D02,
+	0xFF567601, 0xFF6C6A01, 0xFF8B6304, 0xFF9C6701, 0xFF837403, 0xFF588802, 0xFF3C9201, 0xFF3C8E02,
+	0xFF4E8001, 0xFF536800, 0xFF4B4800, 0xFF442A00, 0xFF511C00, 0xFF6B2101, 0xFF712F01, 0xFF633B00,
+	0xFF634000, 0xFF6D3E01, 0xFF803100, 0xFF812905, 0xFF6C3502, 0xFF665200, 0xFF687E00, 0xFF56A801,
+	0xFF38B300, 0xFF299F00, 0xFF558500, 0xFF9D8701, 0xFFBB9A03, 0xFFA69F04, 0xFF848A00, 0xFF6F6F01,
+	0xFF645F01, 0xFF5D5E00, 0xFF5A6700, 0xFF607102, 0xFF787301, 0xFF966700, 0xFF945400, 0xFF5C5100,
+	0xFF2E5A00, 0xFF347700, 0xFF719B05, 0xFFB9A802, 0xFFD68D00, 0xFFB56301, 0xFF805500, 0xFF7C6A03,
+	0xFF988502, 0xFF908901, 0xFF537F01, 0xFF1F7103, 0xFF106904, 0xFF146B02, 0xFF316500, 0xFF555E04,
+	0xFF715105, 0xFF804000, 0xFF8E3A00, 0xFF9F4400, 0xFFA55300, 0xFF965300, 0xFF714D00, 0xFF555701,
+	0xFF5D7E00, 0xFF70AB00, 0xFF7CC801, 0xFF8ECF01, 0xFF9BCC04, 0xFFB0C505, 0xFFB0B601, 0xFF88AB01,
+	0xFF589D04, 0xFF378601, 0xFF436A00, 0xFF6E5F01, 0xFF936805, 0xFF877203, 0xFF576E00, 0xFF275F00,
+	0xFF214A00, 0xFF3D3D00, 0xFF5A3B00, 0xFF813603, 0xFF933801, 0xFF974102, 0xFF805602, 0xFF676E01,
+	0xFF4F8301, 0xFF3D8201, 0xFF4A6E00, 0xFF745E01, 0xFF8B5C05, 0xFF825604, 0xFF654D01, 0xFF4A4B00,
+	0xFF465B01, 0xFF4F7904, 0xFF6A9003, 0xFF799300, 0xFF768D03, 0xFF7E8602, 0xFF858403, 0xFF7A7807,
+	0xFF5C6101, 0xFF555B00, 0xFF7E6601, 0xFF977E04, 0xFF828904, 0xFF687D01, 0xFF656600, 0xFF715101,
+	0xFF6C6F00, 0xFF727702, 0xFF8C7F05, 0xFF9C8302, 0xFF938800, 0xFF7F9501, 0xFF879C03, 0xFF939202,
+	0xFF7E7801, 0xFF585200, 0xFF364001, 0xFF2E5300, 0xFF426F01, 0xFF577B03, 0xFF5C7E01, 0xFF537907,
+	0xFF4B7303, 0xFF546802, 0xFF735306, 0xFF954800, 0xFFA54B00, 0xFF8A6700, 0xFF708105, 0xFF5B9306,
+	0xFF599802, 0xFF508A06, 0xFF406B04, 0xFF4A4900, 0xFF6C3C00, 0xFF884601, 0xFF875403, 0xFF685B01,
+	0xFF555200, 0xFF643301, 0xFF822000, 0xFF8E2304, 0xFF862C02, 0xFF854100, 0xFF866E01, 0xFF739B05,
+	0xFF43AF03, 0xFF33A800, 0xFF5A9400, 0xFF9C8702, 0xFFAA8A00, 0xFF7E8100, 0xFF5A6600, 0xFF535200,
+	0xFF675501, 0xFF6F6601, 0xFF657503, 0xFF5E7A04, 0xFF6D6D03, 0xFF815501, 0xFF894400, 0xFF695300,
+	0xFF497A01, 0xFF4BAA03, 0xFF77BF01, 0xFFAEB002, 0xFFC68003, 0xFFA64601, 0xFF7A3501, 0xFF855101,
+	0xFF9E7601, 0xFF8A8001, 0xFF4B6501, 0xFF154B00, 0xFF004702, 0xFF095601, 0xFF306100, 0xFF5D5F01,
+	0xFF6D5905, 0xFF705B00, 0xFF8E6400, 0xFFB47500, 0xFFB37F02, 0xFF937606, 0xFF777103, 0xFF7B8401,
+	0xFF90A502, 0xFF88C803, 0xFF6ED100, 0xFF6CC900, 0xFF85C200, 0xFF90B500, 0xFF8BA200, 0xFF789001,
+	0xFF598104, 0xFF3E7900, 0xFF4F6E00, 0xFF756500, 0xFF866300, 0xFF6E5E02, 0xFF445100, 0xFF2E4201,
+	0xFF333C01, 0xFF4B4300, 0xFF635200, 0xFF745104, 0xFF7D4502, 0xFF843500, 0xFF844500, 0xFF7E6400,
+	0xFF6E7A01, 0xFF4C7F02, 0xFF4C7B02, 0xFF767B04, 0xFF8A8203, 0xFF777802, 0xFF5E6101, 0xFF535D00,
+	0xFF5E7302, 0xFF738F03, 0xFF7EA202, 0xFF759803, 0xFF6F8703, 0xFF7A8000, 0xFF827F05, 0xFF6B7205,
+	0xFF4E5B00, 0xFF4F4E00, 0xFF815200, 0xFFA06200, 0xFF856C01, 0xFF656E00, 0xFF686A00, 0xFF726903,
+	0xFF677C02, 0xFF766D01, 0xFF9E6306, 0xFFB16602, 0xFFA17200, 0xFF918200, 0xFF8C9000, 0xFF7E9200,
+	0xFF627801, 0xFF4C5900, 0xFF4C5700, 0xFF537400, 0xFF5C8F01, 0xFF5C8E02, 0xFF527807, 0xFF425F06,
+	0xFF3F4F01, 0xFF484900, 0xFF634500, 0xFF8E4800, 0xFFAD4F00, 0xFFA75A00, 0xFF986402, 0xFF827703,
+	0xFF738902, 0xFF508B05, 0xFF368001, 0xFF507100, 0xFF886900, 0xFFAA7802, 0xFF9D8B03, 0xFF749000,
+	0xFF4D7601, 0xFF564A00, 0xFF823000, 0xFFA12800, 0xFF982702, 0xFF993200, 0xFFA74D00, 0xFF957604,
+	0xFF619404, 0xFF3E9D00, 0xFF559100, 0xFF917503, 0xFF946201, 0xFF615800, 0xFF4B5400, 0xFF5C6000,
+	0xFF7C6E04, 0xFF7B7702, 0xFF627302, 0xFF4E6A00, 0xFF5D5E00, 0xFF785800, 0xFF945F00, 0xFF927407,
+	0xFF789506, 0xFF5EAE01, 0xFF59AF00, 0xFF839901, 0xFFA56F06, 0xFF8D4206, 0xFF693B00, 0xFF884900,
+	0xFFAA6201, 0xFF916B03, 0xFF4F5203, 0xFF173501, 0xFF053100, 0xFF154400, 0xFF416100, 0xFF6D6E00,
+	0xFF7C8200, 0xFF849802, 0xFF98A800, 0xFFB0AC00, 0xFFACA503, 0xFF899905, 0xFF879E02, 0xFFAEB501,
+	0xFFB3CE02, 0xFF90D40A, 0xFF65C304, 0xFF59B000, 0xFF7B9A05, 0xFF838602, 0xFF737401, 0xFF666001,
+	0xFF645C04, 0xFF5C6802, 0xFF617201, 0xFF6C7600, 0xFF706700, 0xFF535200, 0xFF324000, 0xFF2E3605,
+	0xFF443704, 0xFF664A03, 0xFF736400, 0xFF636E00, 0xFF596400, 0xFF625500, 0xFF835201, 0xFF946002,
+	0xFF856500, 0xFF606900, 0xFF5D7801, 0xFF7A8C05, 0xFF7E9204, 0xFF618200, 0xFF537300, 0xFF687A03,
+	0xFF869000, 0xFF95A500, 0xFF80A901, 0xFF679404, 0xFF647D01, 0xFF727500, 0xFF7C7300, 0xFF646D00,
+	0xFF475B00, 0xFF525500, 0xFF835800, 0xFFA16200, 0xFF8E7400, 0xFF738400, 0xFF689301, 0xFF649002,
+	0xFF446602, 0xFF644F01, 0xFF974A00, 0xFFB35400, 0xFFAB6A00, 0xFFA97B00, 0xFF978A01, 0xFF6B8D02,
+	0xFF4F7D00, 0xFF4F7200, 0xFF697A01, 0xFF7D8B04, 0xFF6F9201, 0xFF468B00, 0xFF316804, 0xFF2A4200,
+	0xFF363200, 0xFF4C3B00, 0xFF725201, 0xFF976C04, 0xFFA87503, 0xFFA06503, 0xFF8C4E00, 0xFF844502,
+	0xFF745401, 0xFF546700, 0xFF437100, 0xFF5B8000, 0xFF998C04, 0xFFBD9504, 0xFFB2A203, 0xFF7EA503,
+	0xFF518F00, 0xFF537000, 0xFF815504, 0xFF9B4501, 0xFF983D00, 0xFFA33300, 0xFFB33B00, 0xFFA65405,
+	0xFF746B03, 0xFF407D00, 0xFF447D00, 0xFF756600, 0xFF7A4D00, 0xFF564A02, 0xFF545A01, 0xFF766C01,
+	0xFF847703, 0xFF697300, 0xFF536301, 0xFF506000, 0xFF696D00, 0xFF8A7A00, 0xFFA68004, 0xFFAD7C05,
+	0xFF978002, 0xFF658B00, 0xFF449100, 0xFF568700, 0xFF726A02, 0xFF6B5304, 0xFF644800, 0xFF7F4C01,
+	0xFFA35501, 0xFF8C5A00, 0xFF4A4F00, 0xFF213E02, 0xFF284201, 0xFF456100, 0xFF6B8501, 0xFF89A104,
+	0xFF9AB906, 0xFFA0C205, 0xFFA2C702, 0xFF9CBB06, 0xFF8FA101, 0xFF899700, 0xFFA3A205, 0xFFCBB404,
+	0xFFC7C904, 0xFF94C004, 0xFF63A200, 0xFF528B00, 0xFF6E6C09, 0xFF755705, 0xFF564D01, 0xFF554501,
+	0xFF6C4601, 0xFF7A5400, 0xFF7C6C03, 0xFF747F02, 0xFF637C04, 0xFF496403, 0xFF285300, 0xFF2B4701,
+	0xFF4C4400, 0xFF745601, 0xFF796901, 0xFF597602, 0xFF437F02, 0xFF508500, 0xFF7E7D03, 0xFF906D02,
+	0xFF825802, 0xFF675600, 0xFF6A6C00, 0xFF7F8101, 0xFF797F03, 0xFF577601, 0xFF557700, 0xFF7E8603,
+	0xFF9B9303, 0xFF999502, 0xFF6E8D00, 0xFF4A7900, 0xFF4A6D00, 0xFF626B00, 0xFF716701, 0xFF606E00,
+	0xFF4F7002, 0xFF5C7B01, 0xFF868703, 0xFFAB8802, 0xFFA69302, 0xFF839B05, 0xFF619B03, 0xFF408A00,
+	0xFF2A5800, 0xFF5B5A00, 0xFF986300, 0xFFBC6C01, 0xFFBF7303, 0xFFB97806, 0xFF9A7A06, 0xFF667905,
+	0xFF4C7E01, 0xFF5A8801, 0xFF778A05, 0xFF808504, 0xFF6B7601, 0xFF386800, 0xFF1F5300, 0xFF273F00,
+	0xFF3E4200, 0xFF695803, 0xFF9B7602, 0xFFA38E02, 0xFF8D9005, 0xFF6C7102, 0xFF5A4500, 0xFF6E2700,
+	0xFF752800, 0xFF664403, 0xFF696404, 0xFF7E7E06, 0xFFA18F09, 0xFFBE9104, 0xFFB58803, 0xFF848804,
+	0xFF558F00, 0xFF4B8B04, 0xFF70790A, 0xFF846801, 0xFF905B00, 0xFF9F5400, 0xFFAC5600, 0xFFA95401,
+	0xFF735101, 0xFF3C5B00, 0xFF3F6001, 0xFF565D02, 0xFF544F01, 0xFF4C4806, 0xFF5A5501, 0xFF776101,
+	0xFF756802, 0xFF596800, 0xFF566E00, 0xFF6E8400, 0xFF8F9902, 0xFF9F9901, 0xFF9E8706, 0xFFA96A01,
+	0xFFA56200, 0xFF766C00, 0xFF467804, 0xFF367D02, 0xFF446B00, 0xFF515B00, 0xFF6B4D00, 0xFF7E4C01,
+	0xFF944802, 0xFF794800, 0xFF465000, 0xFF3D6001, 0xFF5E7F03, 0xFF7DA600, 0xFF91C004, 0xFF9DD106,
+	0xFFA0D402, 0xFF9CCE01, 0xFF8DC003, 0xFF78AA06, 0xFF6F8B01, 0xFF857800, 0xFFAD7B04, 0xFFCE8403,
+	0xFFCB8704, 0xFF937C02, 0xFF5E6D01, 0xFF4D5E01, 0xFF595103, 0xFF5F4801, 0xFF454C00, 0xFF444F01,
+	0xFF5F4D01, 0xFF854A00, 0xFF945501, 0xFF8D7100, 0xFF688501, 0xFF448303, 0xFF2D6E02, 0xFF376300,
+	0xFF526600, 0xFF736D00, 0xFF756902, 0xFF597003, 0xFF4E8201, 0xFF5D9501, 0xFF749509, 0xFF747D03,
+	0xFF666302, 0xFF5E5E00, 0xFF716D00, 0xFF8A6E00, 0xFF7B6301, 0xFF586000, 0xFF5D6900, 0xFF827104,
+	0xFF927208, 0xFF826703, 0xFF575E00, 0xFF3A5B04, 0xFF356101, 0xFF4D6B00, 0xFF677600, 0xFF6F8300,
+	0xFF699603, 0xFF6BA302, 0xFF81A704, 0xFFA7A103, 0xFFA89302, 0xFF768903, 0xFF447304, 0xFF236103,
+	0xFF376B01, 0xFF698A00, 0xFFA09401, 0xFFC28A04, 0xFFC47703, 0xFFB56503, 0xFF945D01, 0xFF696705,
+	0xFF547E04, 0xFF5D9601, 0xFF6F9202, 0xFF6A7100, 0xFF515B00, 0xFF325500, 0xFF2A5400, 0xFF3F5A00,
+	0xFF636B01, 0xFF8D8103, 0xFFA88B01, 0xFFA18505, 0xFF707402, 0xFF375F00, 0xFF314200, 0xFF573000,
+	0xFF733401, 0xFF874F03, 0xFF937202, 0xFF958808, 0xFFA38B05, 0xFFB27B00, 0xFFA66401, 0xFF7E5E00,
+	0xFF576D00, 0xFF478207, 0xFF538307, 0xFF657C00, 0xFF857902, 0xFFA18102, 0xFFAA8101, 0xFF946F00,
+	0xFF615200, 0xFF354B00, 0xFF354A02, 0xFF404905, 0xFF3C4301, 0xFF414000, 0xFF5E4500, 0xFF785004,
+	0xFF715C04, 0xFF5F6B01, 0xFF6D8700, 0xFF96A502, 0xFFAAB307, 0xFF9DA702, 0xFF898E00, 0xFF927D02,
+	0xFF997201, 0xFF826801, 0xFF526104, 0xFF2B6101, 0xFF3B5B03, 0xFF575800, 0xFF795400, 0xFF8A5300,
+	0xFF855100, 0xFF565A00, 0xFF406D00, 0xFF619300, 0xFF8DC009, 0xFFA2DC04, 0xFF9EDC05, 0xFF94D802,
+	0xFF8DD500, 0xFF82C602, 0xFF6DAD00, 0xFF558E00, 0xFF597002, 0xFF785C01, 0xFF995100, 0xFFB54800,
+	0xFFB34000, 0xFF873902, 0xFF5D3201, 0xFF4E3500, 0xFF584400, 0xFF585100, 0xFF415D00, 0xFF366B03,
+	0xFF4B6605, 0xFF804A01, 0xFFA54300, 0xFF9D5E01, 0xFF767C02, 0xFF4A8301, 0xFF3B7502, 0xFF4F7600,
+	0xFF688802, 0xFF788803, 0xFF6C7101, 0xFF5B6201, 0xFF656500, 0xFF797501, 0xFF7D8003, 0xFF637F00,
+	0xFF4A7B02, 0xFF4E8400, 0xFF718402, 0xFF887401, 0xFF765C00, 0xFF5D5202, 0xFF605604, 0xFF715902,
+	0xFF785702, 0xFF655000, 0xFF4D5300, 0xFF3C5F03, 0xFF376E00, 0xFF4A8002, 0xFF6D9103, 0xFF8B9E04,
+	0xFF86A802, 0xFF6DA002, 0xFF6B9402, 0xFF818501, 0xFF7F6E01, 0xFF5A5A00, 0xFF354B00, 0xFF2D5502,
+	0xFF578C08, 0xFF7EAA03, 0xFFA4AC00, 0xFFB99500, 0xFFB87300, 0xFFAA5800, 0xFF994C00, 0xFF7A5A04,
+	0xFF647604, 0xFF5E8D00, 0xFF568A01, 0xFF506E04, 0xFF3E6400, 0xFF306A00, 0xFF416E02, 0xFF647804,
+	0xFF8D8307, 0xFFA48703, 0xFF9E7A01, 0xFF866102, 0xFF5A4D00, 0xFF2A4B00, 0xFF225600, 0xFF4B5E02,
+	0xFF7E6E02, 0xFFA77800, 0xFFA98300, 0xFF9A8E00, 0xFFA58A00, 0xFFAC7400, 0xFF975502, 0xFF6B4200,
+	0xFF4B4300, 0xFF3B5904, 0xFF457102, 0xFF638100, 0xFF8B9604, 0xFFA69C02, 0xFF9B9203, 0xFF737C01,
+	0xFF4B6200, 0xFF335000, 0xFF334400, 0xFF393B00, 0xFF363301, 0xFF3E3701, 0xFF603E00, 0xFF7F4902,
+	0xFF805403, 0xFF756901, 0xFF818403, 0xFFA99A03, 0xFFB4A906, 0xFF97AF03, 0xFF86AB01, 0xFF8CA606,
+	0xFF8B9205, 0xFF776A00, 0xFF584500, 0xFF494300, 0xFF575500, 0xFF7A6300, 0xFF996C01, 0xFF9F6D03,
+	0xFF7E7502, 0xFF488600, 0xFF46A500, 0xFF74D002, 0xFF94E603, 0xFF95E004, 0xFF86CA07, 0xFF7EBB01,
+	0xFF84B701, 0xFF77A901, 0xFF588D00, 0xFF3D6F02, 0xFF4D5A02, 0xFF724F03, 0xFF824803, 0xFF874000,
+	0xFF862D00, 0xFF791800, 0xFF660E00, 0xFF5E1E02, 0xFF6A3B01, 0xFF645100, 0xFF436D00, 0xFF378500,
+	0xFF428503, 0xFF756A01, 0xFFA25600, 0xFFA15B01, 0xFF796605, 0xFF506F01, 0xFF467C00, 0xFF628D00,
+	0xFF7E9E04, 0xFF809303, 0xFF677200, 0xFF525600, 0xFF704C01, 0xFF975303, 0xFF936103, 0xFF667302,
+	0xFF498700, 0xFF519B01, 0xFF679907, 0xFF707E02, 0xFF695C00, 0xFF684B01, 0xFF694E01, 0xFF645A00,
+	0xFF615E00, 0xFF5A6100, 0xFF556401, 0xFF466E02, 0xFF437C00, 0xFF568E02, 0xFF759805, 0xFF8B9804,
+	0xFF848D03, 0xFF617801, 0xFF496701, 0xFF486200, 0xFF4B5B00, 0xFF574D03, 0xFF554F00, 0xFF526801,
+	0xFF749D04, 0xFF86AE01, 0xFFA3AA00, 0xFFB19D00, 0xFFAE8100, 0xFFA96600, 0xFFA75000, 0xFF944B02,
+	0xFF6A5C03, 0xFF4F6902, 0xFF456B01, 0xFF446802, 0xFF447003, 0xFF418400, 0xFF548801, 0xFF778003,
+	0xFF8F7703, 0xFF9E7104, 0xFF966401, 0xFF7E5A00, 0xFF625800, 0xFF446200, 0xFF397500, 0xFF528F01,
+	0xFF839E01, 0xFFAA9202, 0xFFAF8801, 0xFF9E8E00, 0xFF9A9200, 0xFF928000, 0xFF755800, 0xFF4B3600,
+	0xFF3A2C01, 0xFF423B00, 0xFF595B00, 0xFF7E7D01, 0xFF959601, 0xFF9B9100, 0xFF818001, 0xFF617101,
+	0xFF4F6903, 0xFF445F01, 0xFF424E03, 0xFF443D00, 0xFF423600, 0xFF423E00, 0xFF644600, 0xFF8E4501,
+	0xFF954800, 0xFF865C00, 0xFF8A7403, 0xFFAA8700, 0xFFBA9D00, 0xFFABB001, 0xFF9BB902, 0xFF94AF01,
+	0xFF7E8D01, 0xFF5D5901, 0xFF573A02, 0xFF734401, 0xFF896504, 0xFF997E01, 0xFFA78800, 0xFFA98801,
+	0xFF849301, 0xFF5BAA02, 0xFF66CE07, 0xFF86E908, 0xFF8CE500, 0xFF72C005, 0xFF5B9B04, 0xFF6A8700,
+	0xFF888200, 0xFF7B7F00, 0xFF4C7100, 0xFF316000, 0xFF575100, 0xFF835401, 0xFF7D6504, 0xFF656403,
+	0xFF574C00, 0xFF5D2C00, 0xFF6F1800, 0xFF7E2301, 0xFF813800, 0xFF6C4A00, 0xFF566102, 0xFF468002,
+	0xFF449301, 0xFF6A8C00, 0xFF957502, 0xFF976102, 0xFF745D00, 0xFF586800, 0xFF578600, 0xFF719E01,
+	0xFF829C02, 0xFF728401, 0xFF576700, 0xFF525D00, 0xFF7D5C01, 0xFFAB5A01, 0xFFA65B01, 0xFF7C6103,
+	0xFF597100, 0xFF548403, 0xFF548A05, 0xFF527700, 0xFF595A00, 0xFF6C4F00, 0xFF735800, 0xFF6E6603,
+	0xFF646D04, 0xFF5A6E01, 0xFF586D02, 0xFF4F7003, 0xFF4D7602, 0xFF5B7F00, 0xFF6F7C00, 0xFF717500,
+	0xFF636903, 0xFF495E00, 0xFF315B00, 0xFF2F6201, 0xFF3A6900, 0xFF656C02, 0xFF807106, 0xFF7F8405,
+	0xFF8A9B03, 0xFF93AC01, 0xFFA0B502, 0xFFAAAB02, 0xFFA89303, 0xFFA57703, 0xFFAA5902, 0xFF924401,
+	0xFF5F3902, 0xFF3E3900, 0xFF463F00, 0xFF564900, 0xFF646507, 0xFF5D7D05, 0xFF558402, 0xFF6E7501,
+	0xFF846800, 0xFF946700, 0xFF967300, 0xFF8D8100, 0xFF838701, 0xFF698F00, 0xFF5A9503, 0xFF62A401,
+	0xFF6CAC00, 0xFF8B9F02, 0xFFA69202, 0xFF9A9801, 0xFF7F9903, 0xFF677E02, 0xFF465400, 0xFF273B03,
+	0xFF2E3600, 0xFF553C00, 0xFF7E4E00, 0xFF9F6401, 0xFFA46D03, 0xFF8A6601, 0xFF715B00, 0xFF665E03,
+	0xFF61660A, 0xFF566606, 0xFF4E5B01, 0xFF545100, 0xFF4E5100, 0xFF4C5B00, 0xFF645C00, 0xFF8B4E03,
+	0xFFA24101, 0xFF985300, 0xFF9B7401, 0xFFA89701, 0xFFB5A800, 0xFFB7AA00, 0xFFA39D03, 0xFF888401,
+	0xFF656400, 0xFF4B4601, 0xFF604502, 0xFF925C07, 0xFFA87906, 0xFF989100, 0xFF9C9400, 0xFF9C8F00,
+	0xFF889300, 0xFF7EA305, 0xFF8EC50C, 0xFF96D204, 0xFF7FB902, 0xFF508A03, 0xFF3A6300, 0xFF5F5801,
+	0xFF906401, 0xFF8A7102, 0xFF547601, 0xFF3D7203, 0xFF6A6803, 0xFF976400, 0xFF8D7101, 0xFF5D7702,
+	0xFF3D6600, 0xFF445500, 0xFF6F4F00, 0xFF9A4B02, 0xFF914702, 0xFF6F4901, 0xFF5B4B05, 0xFF4B6303,
+	0xFF497F02, 0xFF618901, 0xFF857B04, 0xFF886502, 0xFF715E00, 0xFF626F02, 0xFF6D8A02, 0xFF799601,
+	0xFF728501, 0xFF5D6D01, 0xFF4B6401, 0xFF587501, 0xFF808402, 0xFFA67E01, 0xFFA36A00, 0xFF875800,
+	0xFF6B5A02, 0xFF576602, 0xFF477000, 0xFF3D6F00, 0xFF486700, 0xFF646301, 0xFF756303, 0xFF6F6404,
+	0xFF626703, 0xFF566500, 0xFF506300, 0xFF4C6700, 0xFF536B00, 0xFF5D6F00, 0xFF646800, 0xFF606401,
+	0xFF546800, 0xFF466D01, 0xFF367602, 0xFF248602, 0xFF308D00, 0xFF5E8F00, 0xFF888D06, 0xFF968F02,
+	0xFFA19A01, 0xFFACAA05, 0xFFA6B503, 0xFF96A501, 0xFF888205, 0xFF8A6806, 0xFF924B01, 0xFF773500,
+	0xFF4D2500, 0xFF362200, 0xFF4A2D00, 0xFF7E3900, 0xFF8F4E04, 0xFF766207, 0xFF596F06, 0xFF656904,
+	0xFF7C6E00, 0xFF8C7C00, 0xFF9D9202, 0xFFA3A702, 0xFF96B001, 0xFF7DB602, 0xFF72B203, 0xFF6BAA01,
+	0xFF67A900, 0xFF7CA500, 0xFF9DA102, 0xFF969B05, 0xFF6B8801, 0xFF426C02, 0xFF265302, 0xFF1A4A00,
+	0xFF314902, 0xFF5B4802, 0xFF874600, 0xFFA64600, 0xFF9C4900, 0xFF784600, 0xFF6C4200, 0xFF754702,
+	0xFF764F05, 0xFF665603, 0xFF515F00, 0xFF5A6A00, 0xFF5C7700, 0xFF558102, 0xFF5F7A01, 0xFF736406,
+	0xFF954A02, 0xFFA45400, 0xFFAC8105, 0xFFACAC06, 0xFFA6B100, 0xFF999206, 0xFF796B05, 0xFF5C4B01,
+	0xFF423E00, 0xFF3E4F01, 0xFF6F6702, 0xFFA67404, 0xFFAE8601, 0xFF929A00, 0xFF8CA100, 0xFF859600,
+	0xFF7F8200, 0xFF917C00, 0xFFB08402, 0xFFA38B01, 0xFF6B7C01, 0xFF325F02, 0xFF375300, 0xFF6F5F00,
+	0xFF9B7702, 0xFF998C06, 0xFF6D9801, 0xFF559406, 0xFF738104, 0xFFA06500, 0xFFA05601, 0xFF605B00,
+	0xFF3A6300, 0xFF4B7100, 0xFF778000, 0xFFA17D05, 0xFF906E07, 0xFF645205, 0xFF4A3C00, 0xFF434300,
+	0xFF485701, 0xFF566A02, 0xFF6E6A00, 0xFF7B6000, 0xFF766100, 0xFF6F7104, 0xFF6E7F03, 0xFF6B7A00,
+	0xFF636B00, 0xFF576400, 0xFF4A7001, 0xFF548E03, 0xFF7BA303, 0xFF979C05, 0xFF918202, 0xFF836B01,
+	0xFF7A6306, 0xFF606A03, 0xFF4E7201, 0xFF407900, 0xFF4A7800, 0xFF616E02, 0xFF6F6003, 0xFF675900,
+	0xFF595800, 0xFF505901, 0xFF505F01, 0xFF576D00, 0xFF627701, 0xFF5D7B01, 0xFF5D7600, 0xFF5F6D05,
+	0xFF617005, 0xFF617E00, 0xFF509004, 0xFF29A502, 0xFF2AA800, 0xFF519F00, 0xFF7E9600, 0xFF9A8F01,
+	0xFFB07E01, 0xFFBA8605, 0xFFA58304, 0xFF727501, 0xFF5A5701, 0xFF614002, 0xFF752E00, 0xFF632501,
+	0xFF3A2601, 0xFF363203, 0xFF5F4902, 0xFF9B5805, 0xFFA85802, 0xFF885D00, 0xFF656B00, 0xFF637A02,
+	0xFF748B01, 0xFF829C00, 0xFF97A605, 0xFFA8AB05, 0xFF9BB101, 0xFF81BA03, 0xFF7ABA05, 0xFF70AE01,
+	0xFF71A200, 0xFF859A00, 0xFF929104, 0xFF878505, 0xFF627301, 0xFF3D6105, 0xFF275801, 0xFF2A5903,
+	0xFF3D5407, 0xFF5A4D02, 0xFF744704, 0xFF8E3D01, 0xFF8A3A00, 0xFF6E3C02, 0xFF6A3C01, 0xFF813400,
+	0xFF8F3300, 0xFF823C00, 0xFF6A5B00, 0xFF647F00, 0xFF6D9700, 0xFF68A302, 0xFF659503, 0xFF657100,
+	0xFF7A5100, 0xFFA55500, 0xFFB97F04, 0xFFA8A302, 0xFF849903, 0xFF5E6904, 0xFF3F4000, 0xFF322C01,
+	0xFF323D05, 0xFF467305, 0xFF739B00, 0xFFA8A000, 0xFFBD9B00, 0xFFA2AC00, 0xFF7DB900, 0xFF65A101,
+	0xFF6A6F00, 0xFF8E4D00, 0xFFB33F00, 0xFFA74902, 0xFF705400, 0xFF4D5700, 0xFF5D6D01, 0xFF828B01,
+	0xFF9BA102, 0xFF97A703, 0xFF72A204, 0xFF559708, 0xFF6A7C03, 0xFF935900, 0xFF9F3E01, 0xFF723E00,
+	0xFF4C5600, 0xFF606F00, 0xFF818A07, 0xFF8C920B, 0xFF747E05, 0xFF4C5D04, 0xFF3A3D03, 0xFF3F3100,
+	0xFF483800, 0xFF534900, 0xFF675502, 0xFF7B5704, 0xFF795D01, 0xFF6E6501, 0xFF676601, 0xFF676400,
+	0xFF666801, 0xFF5D6F01, 0xFF468600, 0xFF4AA102, 0xFF6BB000, 0xFF85AC00, 0xFF7F9C00, 0xFF718B01,
+	0xFF6E8202, 0xFF697901, 0xFF637502, 0xFF577B01, 0xFF587D01, 0xFF677403, 0xFF696201, 0xFF635A00,
+	0xFF595B00, 0xFF596700, 0xFF6A7A00, 0xFF758F00, 0xFF739F01, 0xFF60A300, 0xFF569500, 0xFF5F7701,
+	0xFF6C6D05, 0xFF807601, 0xFF6D9201, 0xFF3AAB00, 0xFF26B501, 0xFF40A802, 0xFF6F9705, 0xFF998007,
+	0xFFA85300, 0xFFAC5100, 0xFF894802, 0xFF543A01, 0xFF413100, 0xFF4A2600, 0xFF561F02, 0xFF432902,
+	0xFF333F02, 0xFF4D6200, 0xFF7D8304, 0xFFA59008, 0xFFB08803, 0xFF988100, 0xFF7D8900, 0xFF72A206,
+	0xFF71AF05, 0xFF74AE00, 0xFF82A300, 0xFF939504, 0xFF929102, 0xFF869600, 0xFF86A101, 0xFF7AA300,
+	0xFF759100, 0xFF7B7901, 0xFF7B6C04, 0xFF6F6501, 0xFF5B6A00, 0xFF486D01, 0xFF366300, 0xFF3A5806,
+	0xFF4C4F06, 0xFF5E4B00, 0xFF6A4F01, 0xFF744800, 0xFF724000, 0xFF664301, 0xFF644C01, 0xFF7E4301,
+	0xFF9F3401, 0xFFA73100, 0xFF944900, 0xFF7F7400, 0xFF819505, 0xFF7FA107, 0xFF679101, 0xFF556D00,
+	0xFF685C00, 0xFFA86001, 0xFFBE7600, 0xFF997B00, 0xFF656207, 0xFF364100, 0xFF222B00, 0xFF2A3301,
+	0xFF416002, 0xFF619F03, 0xFF88C205, 0xFFB3C702, 0xFFD1BC02, 0xFFBEBC05, 0xFF87B602, 0xFF548F00,
+	0xFF4F5A00, 0xFF7B3A02, 0xFFB53A05, 0xFFBB4B02, 0xFF946300, 0xFF827F04, 0xFF839A0E, 0xFF88A308,
+	0xFF839C03, 0xFF7C8801, 0xFF697B03, 0xFF5A7401, 0xFF646C02, 0xFF8D6301, 0xFFA15A00, 0xFF845700,
+	0xFF675502, 0xFF735D02, 0xFF837008, 0xFF757904, 0xFF5C6D00, 0xFF3E5900, 0xFF304302, 0xFF3D3600,
+	0xFF523900, 0xFF694301, 0xFF7A5105, 0xFF825C05, 0xFF7D5F02, 0xFF6C6101, 0xFF636300, 0xFF6D6A00,
+	0xFF767A04, 0xFF658806, 0xFF4D9601, 0xFF54A500, 0xFF68B102, 0xFF76AC02, 0xFF6C9C01, 0xFF588A00,
+	0xFF577B00, 0xFF626D00, 0xFF6B6802, 0xFF727200, 0xFF7C7D01, 0xFF7F7F00, 0xFF747C01, 0xFF5F7906,
+	0xFF597500, 0xFF667D02, 0xFF878C04, 0xFF989C03, 0xFF81B106, 0xFF5CB903, 0xFF47A600, 0xFF4E8300,
+	0xFF6F6D02, 0xFF937200, 0xFF868D01, 0xFF4FA308, 0xFF30A606, 0xFF399803, 0xFF577D02, 0xFF835E02,
+	0xFF9E4900, 0xFF984100, 0xFF6D2D00, 0xFF431F01, 0xFF3C2103, 0xFF402000, 0xFF3E2E00, 0xFF374A01,
+	0xFF496C00, 0xFF6C9600, 0xFF8FB001, 0xFFA7B501, 0xFFABB003, 0xFFA2AE00, 0xFF9BB600, 0xFF88C702,
+	0xFF69CB02, 0xFF57BA00, 0xFF619E00, 0xFF787900, 0xFF846301, 0xFF916002, 0xFF956802, 0xFF897402,
+	0xFF767100, 0xFF6A6700, 0xFF6F6300, 0xFF6F6600, 0xFF617301, 0xFF4D7500, 0xFF426100, 0xFF454A02,
+	0xFF5A4403, 0xFF6F4801, 0xFF6C5100, 0xFF5F5500, 0xFF5A5400, 0xFF585F00, 0xFF577500, 0xFF6F7203,
+	0xFF975902, 0xFFB34000, 0xFFBA3600, 0xFFB34900, 0xFFA76A04, 0xFF967507, 0xFF6C6C01, 0xFF4D6601,
+	0xFF6A7802, 0xFFAE8503, 0xFFBA7C03, 0xFF8F5703, 0xFF4D3700, 0xFF2A2A00, 0xFF313601, 0xFF4F5D00,
+	0xFF6E9600, 0xFF84C901, 0xFF9CDB04, 0xFFBBD502, 0xFFC9BF07, 0xFFBB9F07, 0xFF808502, 0xFF486001,
+	0xFF444C00, 0xFF825601, 0xFFC46E02, 0xFFD38300, 0xFFBC9300, 0xFFA6A401, 0xFF88A405, 0xFF6F8906,
+	0xFF5F6604, 0xFF655300, 0xFF725400, 0xFF776300, 0xFF817D00, 0xFFA09104, 0xFFA79505, 0xFF848A02,
+	0xFF686704, 0xFF7A4D01, 0xFF8B4400, 0xFF794A00, 0xFF505000, 0xFF354A00, 0xFF334900, 0xFF494D02,
+	0xFF675700, 0xFF816300, 0xFF927002, 0xFF977900, 0xFF8E7E00, 0xFF7A8100, 0xFF698200, 0xFF728700,
+	0xFF7E8A01, 0xFF6A9203, 0xFF5B9603, 0xFF619C01, 0xFF6BA004, 0xFF669102, 0xFF4D7B02, 0xFF3B6602,
+	0xFF415900, 0xFF555600, 0xFF735B02, 0xFF8D7202, 0xFFA18801, 0xFFA59102, 0xFF889601, 0xFF638A03,
+	0xFF567C00, 0xFF647D03, 0xFF8F8304, 0xFFA88F03, 0xFF959D05, 0xFF6CA902, 0xFF44A600, 0xFF3E9902,
+	0xFF6B8601, 0xFF928500, 0xFF879002, 0xFF5B8C05, 0xFF387402, 0xFF366200, 0xFF4E5200, 0xFF7E4500,
+	0xFF9F6303, 0xFF845903, 0xFF533901, 0xFF3D2001, 0xFF452505, 0xFF4D3803, 0xFF4C5802, 0xFF4C7900,
+	0xFF689801, 0xFF8AB101, 0xFFA7BA02, 0xFFA9BB03, 0xFFA2B601, 0xFFAEB402, 0xFFB4BC03, 0xFF9EC000,
+	0xFF6ABA00, 0xFF46A700, 0xFF4D8B00, 0xFF5D6600, 0xFF6A4C01, 0xFF834101, 0xFF9A3E01, 0xFF914902,
+	0xFF775A00, 0xFF756E00, 0xFF7E7902, 0xFF788004, 0xFF627F03, 0xFF436D00, 0xFF3D5300, 0xFF513E00,
+	0xFF6E4100, 0xFF794A01, 0xFF6C5001, 0xFF615702, 0xFF606401, 0xFF627C00, 0xFF5A9600, 0xFF5C9E06,
+	0xFF718905, 0xFF9A6200, 0xFFB84800, 0xFFCB4000, 0xFFC14900, 0xFF984C00, 0xFF695201, 0xFF507600,
+	0xFF749A02, 0xFFA3A107, 0xFFA97B08, 0xFF794101, 0xFF3C2800, 0xFF313201, 0xFF565D01, 0xFF899002,
+	0xFFACBA06, 0xFFABD606, 0xFF98D601, 0xFFA0B602, 0xFFA38E04, 0xFF8F6100, 0xFF624900, 0xFF464600,
+	0xFF5D6401, 0xFF958E03, 0xFFC2A106, 0xFFCEA101, 0xFFC29600, 0xFFB18700, 0xFF827100, 0xFF4B5A02,
+	0xFF424D03, 0xFF675200, 0xFF916501, 0xFFA18202, 0xFFAE9E05, 0xFFB1B206, 0xFF9CA908, 0xFF718D01,
+	0xFF5F6B00, 0xFF794E00, 0xFF904000, 0xFF793E01, 0xFF4D4800, 0xFF394D00, 0xFF455A02, 0xFF5F7305,
+	0xFF778801, 0xFF8C9901, 0xFF99A602, 0xFFA3AB03, 0xFFA2AE02, 0xFF8BAC04, 0xFF73A601, 0xFF6B9901,
+	0xFF668B00, 0xFF638200, 0xFF6E7E02, 0xFF717E04, 0xFF667A04, 0xFF456700, 0xFF2A5400, 0xFF2E4602,
+	0xFF404801, 0xFF5A5100, 0xFF836200, 0xFFA08202, 0xFFAF9703, 0xFFB29B03, 0xFF8D8F00, 0xFF617D00,
+	0xFF4F7A00, 0xFF5C7900, 0xFF827600, 0xFFA57301, 0xFFA37802, 0xFF7F7F00, 0xFF5D8B00, 0xFF4E9701,
+	0xFF5B9802, 0xFF798F04, 0xFF6C7D04, 0xFF436401, 0xFF344C00, 0xFF3D4100, 0xFF634900, 0xFF955701,
+	0xFF9C7709, 0xFF736104, 0xFF484600, 0xFF443700, 0xFF5E4301, 0xFF716A04, 0xFF6C8E04, 0xFF64AB02,
+	0xFF76B900, 0xFFA0B800, 0xFFBAB204, 0xFFAEAA03, 0xFFA49E02, 0xFFB29004, 0xFFC08A06, 0xFFA88702,
+	0xFF767B02, 0xFF536E01, 0xFF476900, 0xFF456503, 0xFF466103, 0xFF5E5801, 0xFF824B00, 0xFF8E4300,
+	0xFF8B5200, 0xFF937405, 0xFF928F0D, 0xFF798D08, 0xFF537302, 0xFF325A01, 0xFF384A01, 0xFF604703,
+	0xFF805202, 0xFF805700, 0xFF6F5700, 0xFF6F6001, 0xFF817203, 0xFF7F8300, 0xFF629500, 0xFF46A502,
+	0xFF4EA202, 0xFF828D01, 0xFFA87F04, 0xFFB87103, 0xFFB25C00, 0xFF944C00, 0xFF745C00, 0xFF608D00,
+	0xFF74AA02, 0xFF879705, 0xFF826003, 0xFF5C3402, 0xFF373604, 0xFF3E5C00, 0xFF769002, 0xFFBEB303,
+	0xFFD8B903, 0xFFC1B40A, 0xFF90A102, 0xFF697600, 0xFF5B4E02, 0xFF593703, 0xFF553D00, 0xFF5F6300,
+	0xFF7F8D06, 0xFF9FA703, 0xFFAAA005, 0xFFA38102, 0xFF996400, 0xFF8B4B01, 0xFF713C00, 0xFF494400,
+	0xFF4D5F00, 0xFF7C7E03, 0xFFAA9608, 0xFFC39D03, 0xFFCA9D01, 0xFFB19905, 0xFF778902, 0xFF4B7200,
+	0xFF536A01, 0xFF7B6A00, 0xFF8C6C02, 0xFF6D6204, 0xFF4B5C00, 0xFF466600, 0xFF5D7D00, 0xFF799A02,
+	0xFF88B201, 0xFF91C200, 0xFF95CE03, 0xFF9FD007, 0xFFA4C902, 0xFF8BBA03, 0xFF70A403, 0xFF568A04,
+	0xFF427103, 0xFF555E00, 0xFF705500, 0xFF715601, 0xFF564F04, 0xFF334103, 0xFF2B4001, 0xFF404B00,
+	0xFF515900, 0xFF6D6900, 0xFF8B8000, 0xFF9E9601, 0xFFA5A203, 0xFF9B9200, 0xFF867100, 0xFF6F6801,
+	0xFF637200, 0xFF607F01, 0xFF727C04, 0xFF8C6703, 0xFF9B5904, 0xFF954E00, 0xFF825600, 0xFF617000,
+	0xFF517A01, 0xFF517002, 0xFF485900, 0xFF305300, 0xFF275A00, 0xFF466200, 0xFF7A7002, 0xFFA37801,
+	0xFF7F6A03, 0xFF5E5A00, 0xFF4D5400, 0xFF5E6000, 0xFF877C06, 0xFF9EA102, 0xFF95B402, 0xFF7BBD08,
+	0xFF7EC101, 0xFFA6B902, 0xFFB3AC0A, 0xFF9F9806, 0xFF907E00, 0xFF915F00, 0xFFA14900, 0xFF9B3F00,
+	0xFF7D3700, 0xFF693B00, 0xFF5A5100, 0xFF426601, 0xFF2D8203, 0xFF3A9001, 0xFF627C02, 0xFF835803,
+	0xFF9F4600, 0xFFAD5A03, 0xFF977507, 0xFF6C6E03, 0xFF3C5C00, 0xFF295500, 0xFF485E04, 0xFF7D6B04,
+	0xFF916D01, 0xFF7B6601, 0xFF6D6900, 0xFF807500, 0xFF998000, 0xFF8C8106, 0xFF5F7F02, 0xFF3E8800,
+	0xFF439800, 0xFF74A402, 0xFF98A905, 0xFF989F04, 0xFF8A8804, 0xFF877B02, 0xFF8B8303, 0xFF769701,
+	0xFF6A9004, 0xFF606901, 0xFF634200, 0xFF533D01, 0xFF435C03, 0xFF528901, 0xFF81A704, 0xFFC1AB02,
+	0xFFD79700, 0xFFB07304, 0xFF6A5502, 0xFF413A02, 0xFF373200, 0xFF4E4401, 0xFF736907, 0xFF808F05,
+	0xFF849805, 0xFF808D04, 0xFF817501, 0xFF845E00, 0xFF834D01, 0xFF763D02, 0xFF673900, 0xFF624B01,
+	0xFF6F7206, 0xFF809A06, 0xFF95A204, 0xFFAF9001, 0xFFB97600, 0xFF915F00, 0xFF535800, 0xFF386200,
+	0xFF527902, 0xFF7E9003, 0xFF839702, 0xFF648D02, 0xFF507F00, 0xFF5F8401, 0xFF779902, 0xFF8FA600,
+	0xFF9DB705, 0xFF9CCD02, 0xFF94D803, 0xFF8ECE08, 0xFF88B403, 0xFF7E9100, 0xFF677301, 0xFF466502,
+	0xFF365902, 0xFF424E00, 0xFF5F4700, 0xFF683F00, 0xFF4D3400, 0xFF393701, 0xFF424901, 0xFF556203,
+	0xFF5E7701, 0xFF788400, 0xFF949801, 0xFF9FA803, 0xFF94A100, 0xFF767B02, 0xFF735C00, 0xFF865500,
+	0xFF8E6704, 0xFF7E8007, 0xFF628402, 0xFF636C03, 0xFF7C4603, 0xFF912F00, 0xFF843400, 0xFF644701,
+	0xFF4C4F00, 0xFF4A4B01, 0xFF4E4A01, 0xFF3F6601, 0xFF328B03, 0xFF4E9706, 0xFF768A02, 0xFF8A7800,
+	0xFF676104, 0xFF5E6E00, 0xFF668501, 0xFF7FA004, 0xFFA4B201, 0xFFBFB202, 0xFFA9AB02, 0xFF7CA502,
+	0xFF7DA501, 0xFF9C9C02, 0xFF9D9305, 0xFF807B03, 0xFF625D00, 0xFF604300, 0xFF742902, 0xFF8A1700,
+	0xFF8A1601, 0xFF862505, 0xFF823F01, 0xFF586100, 0xFF398A00, 0xFF32AD00, 0xFF49A100, 0xFF6A7401,
+	0xFF944C00, 0xFFB04000, 0xFF993F00, 0xFF693E00, 0xFF385001, 0xFF3A6D02, 0xFF608F02, 0xFF8D9601,
+	0xFF958301, 0xFF777400, 0xFF6D7A00, 0xFF888C00, 0xFF9D8A01, 0xFF837C05, 0xFF4D7003, 0xFF377700,
+	0xFF4E8700, 0xFF7B9700, 0xFF95A000, 0xFF909B00, 0xFF789504, 0xFF7C9905, 0xFF8D9805, 0xFF7A8703,
+	0xFF5B6100, 0xFF534400, 0xFF6C4900, 0xFF786D03, 0xFF639204, 0xFF58A406, 0xFF6EA003, 0xFF958805,
+	0xFFA76301, 0xFF863E01, 0xFF4B2E03, 0xFF362D01, 0xFF4B4900, 0xFF787504, 0xFF8F9508, 0xFF849907,
+	0xFF6A7F01, 0xFF5A6900, 0xFF6D6100, 0xFF8B6600, 0xFF8D6700, 0xFF785900, 0xFF694C00, 0xFF7A4F05,
+	0xFF806308, 0xFF707707, 0xFF607A03, 0xFF746600, 0xFF874F01, 0xFF6D4703, 0xFF3E4F00, 0xFF346A01,
+	0xFF558F01, 0xFF7DA501, 0xFF81AB00, 0xFF66A501, 0xFF569F00, 0xFF6B9E02, 0xFF859805, 0xFF9B9600,
+	0xFFADA001, 0xFFB1B401, 0xFF9FBD03, 0xFF76AE03, 0xFF628905, 0xFF626201, 0xFF6B4900, 0xFF5B4903,
+	0xFF404F01, 0xFF385700, 0xFF535202, 0xFF624901, 0xFF574400, 0xFF504E00, 0xFF5C6700, 0xFF687C01,
+	0xFF6A8D00, 0xFF839B00, 0xFFA2AD00, 0xFFA3B002, 0xFF7E9402, 0xFF526B02, 0xFF584E00, 0xFF913F00,
+	0xFFAE4907, 0xFF995C07, 0xFF6F6701, 0xFF536101, 0xFF624A00, 0xFF7F3700, 0xFF7B3500, 0xFF5D4200,
+	0xFF474C00, 0xFF565102, 0xFF715E03, 0xFF718201, 0xFF55A102, 0xFF429F07, 0xFF478204, 0xFF546900,
+	0xFF618706, 0xFF6BA504, 0xFF73BE00, 0xFF80CB03, 0xFF9BC301, 0xFFA8A301, 0xFF937F02, 0xFF6E6B00,
+	0xFF706700, 0xFF8A6401, 0xFF8D6000, 0xFF715400, 0xFF514F02, 0xFF4D4D02, 0xFF5B4101, 0xFF723600,
+	0xFF8A2F00, 0xFF973401, 0xFF8F3B00, 0xFF6B5201, 0xFF567303, 0xFF449D05, 0xFF419F04, 0xFF537E00,
+	0xFF7C5500, 0xFF9B3C00, 0xFF952C00, 0xFF723200, 0xFF595200, 0xFF5E8607, 0xFF73AA01, 0xFF89A402,
+	0xFF898906, 0xFF787A00, 0xFF768501, 0xFF889203, 0xFF8A8901, 0xFF6A7401, 0xFF426E00, 0xFF3C8100,
+	0xFF5F9101, 0xFF829201, 0xFF948400, 0xFF887601, 0xFF797600, 0xFF807E01, 0xFF847C04, 0xFF676303,
+	0xFF544600, 0xFF6E4A00, 0xFF986F05, 0xFFA89907, 0xFF83A801, 0xFF549A02, 0xFF527901, 0xFF635401,
+	0xFF743800, 0xFF6E2F01, 0xFF4E3D00, 0xFF445C00, 0xFF6C8002, 0xFF949708, 0xFF8A9302, 0xFF677800,
+	0xFF526200, 0xFF5A6C00, 0xFF768702, 0xFF969701, 0xFF938F02, 0xFF757501, 0xFF695801, 0xFF7B4204,
+	0xFF7E3800, 0xFF603900, 0xFF3F4202, 0xFF554800, 0xFF6D5300, 0xFF615D01, 0xFF486E01, 0xFF458701,
+	0xFF60A102, 0xFF82AE00, 0xFF81B301, 0xFF68AF08, 0xFF5DAC05, 0xFF64A402, 0xFF778C03, 0xFF8B7E00,
+	0xFFA57F00, 0xFFAE8702, 0xFF968B00, 0xFF618101, 0xFF466503, 0xFF4E5200, 0xFF714300, 0xFF724202,
+	0xFF4E4F01, 0xFF416500, 0xFF547906, 0xFF618205, 0xFF687B00, 0xFF707600, 0xFF748100, 0xFF748E03,
+	0xFF789F03, 0xFF96AD00, 0xFFABB207, 0xFF999B07, 0xFF627302, 0xFF385900, 0xFF474800, 0xFF7E3D00,
+	0xFF9E3B00, 0xFF9F3B00, 0xFF8E3F00, 0xFF6E4C00, 0xFF674F00, 0xFF734801, 0xFF6C4800, 0xFF555403,
+	0xFF4C5C06, 0xFF706203, 0xFF986A02, 0xFF9F7303, 0xFF707E01, 0xFF377B00, 0xFF307000, 0xFF437B00,
+	0xFF6BA705, 0xFF65B602, 0xFF55C101, 0xFF55C400, 0xFF62B605, 0xFF678F04, 0xFF5E6501, 0xFF554900,
+	0xFF684200, 0xFF854301, 0xFF894100, 0xFF7C4601, 0xFF695A01, 0xFF566E04, 0xFF507101, 0xFF5E6E02,
+	0xFF806502, 0xFF9D5702, 0xFF8B4C03, 0xFF6D4700, 0xFF5A5203, 0xFF526503, 0xFF497003, 0xFF496F02,
+	0xFF626400, 0xFF7D5600, 0xFF854B00, 0xFF834B01, 0xFF826401, 0xFF7A8C04, 0xFF72A201, 0xFF7B9802,
+	0xFF7F8203, 0xFF7D7F00, 0xFF808D00, 0xFF808904, 0xFF717102, 0xFF576101, 0xFF4D6B00, 0xFF5B8C01,
+	0xFF75A407, 0xFF819A06, 0xFF7C7500, 0xFF685500, 0xFF714600, 0xFF784700, 0xFF704900, 0xFF594800,
+	0xFF5E5300, 0xFF906D03, 0xFFC18B09, 0xFFBA9704, 0xFF8A8C01, 0xFF4B7500, 0xFF3B5300, 0xFF4F3A00,
+	0xFF643300, 0xFF6E4700, 0xFF647201, 0xFF629D00, 0xFF76A909, 0xFF84910E, 0xFF736600, 0xFF5C4900,
+	0xFF5D5703, 0xFF7A8501, 0xFF90AC05, 0xFF8BBB03, 0xFF73A904, 0xFF558701, 0xFF4E6100, 0xFF713B03,
+	0xFF811E05, 0xFF661900, 0xFF502800, 0xFF594E01, 0xFF6C7501, 0xFF6D8B00, 0xFF629900, 0xFF62AB00,
+	0xFF77B900, 0xFF88B800, 0xFF7AB000, 0xFF60A704, 0xFF539D05, 0xFF529000, 0xFF597C00, 0xFF6B6B00,
+	0xFF8D6202, 0xFF966003, 0xFF895900, 0xFF5C5700, 0xFF435700, 0xFF505300, 0xFF6F4A00, 0xFF724801,
+	0xFF5B5B00, 0xFF547B01, 0xFF64A005, 0xFF75B506, 0xFF79AB00, 0xFF819B00, 0xFF7F9100, 0xFF7D9301,
+	0xFF889E04, 0xFFA1A603, 0xFFA89309, 0xFF816B02, 0xFF4A5000, 0xFF2D4E01, 0xFF345901, 0xFF516400,
+	0xFF6B6201, 0xFF855403, 0xFF884E02, 0xFF854E02, 0xFF824803, 0xFF734701, 0xFF644801, 0xFF545304,
+	0xFF585705, 0xFF805801, 0xFFAB4F01, 0xFFAA4703, 0xFF784C01, 0xFF445A00, 0xFF487500, 0xFF659204,
+	0xFF738900, 0xFF4D8300, 0xFF338601, 0xFF2B9000, 0xFF2E9300, 0xFF368702, 0xFF317700, 0xFF3A6800,
+	0xFF626501, 0xFF895D05, 0xFF925100, 0xFF855300, 0xFF7B6201, 0xFF6A7303, 0xFF568000, 0xFF5A8803,
+	0xFF798C0D, 0xFF8E7D09, 0xFF776804, 0xFF5A4A00, 0xFF503A00, 0xFF4D3500, 0xFF453E00, 0xFF4B5200,
+	0xFF626D01, 0xFF737A00, 0xFF7C7700, 0xFF877601, 0xFF8E7C01, 0xFF7D8601, 0xFF688C00, 0xFF678700,
+	0xFF748300, 0xFF839101, 0xFF899A04, 0xFF788402, 0xFF5B6100, 0xFF4F5100, 0xFF636100, 0xFF838501,
+	0xFF8FA106, 0xFF759707, 0xFF556A01, 0xFF4B4000, 0xFF572E00, 0xFF5C2F00, 0xFF583B00, 0xFF5A5101,
+	0xFF756C04, 0xFFA08201, 0xFFB78302, 0xFFAC7308, 0xFF7F5F04, 0xFF465D00, 0xFF355D00, 0xFF4B5401,
+	0xFF705102, 0xFF846D00, 0xFF7E9503, 0xFF6AAC06, 0xFF55A005, 0xFF537203, 0xFF524C00, 0xFF6F4302,
+	0xFF955B08, 0xFFA88705, 0xFF9BA004, 0xFF70A801, 0xFF3EA600, 0xFF2B9501, 0xFF397902, 0xFF5B5D02,
+	0xFF743C02, 0xFF782A00, 0xFF793B00, 0xFF776604, 0xFF85930A, 0xFF88AB04, 0xFF7FB600, 0xFF86BF02,
+	0xFF91C405, 0xFF87B704, 0xFF689A00, 0xFF4E8100, 0xFF487700, 0xFF4F7300, 0xFF507100, 0xFF566B00,
+	0xFF676300, 0xFF765902, 0xFF744D01, 0xFF624E00, 0xFF595A00, 0xFF5E6102, 0xFF666603, 0xFF666502,
+	0xFF626C01, 0xFF668400, 0xFF7FA001, 0xFF8EB400, 0xFF85AF00, 0xFF809A04, 0xFF7A8506, 0xFF7F7B00,
+	0xFF8F8000, 0xFF988002, 0xFF8C6002, 0xFF5F3D00, 0xFF3C3800, 0xFF2B5400, 0xFF358001, 0xFF47A005,
+	0xFF4BA607, 0xFF559A02, 0xFF6A8601, 0xFF7B6A04, 0xFF824B02, 0xFF703B00, 0xFF593701, 0xFF534100,
+	0xFF644F00, 0xFF8A4E00, 0xFFB43C00, 0xFFAC2D00, 0xFF793000, 0xFF5C4E01, 0xFF657405, 0xFF7D8D06,
+	0xFF6D5C03, 0xFF3F4900, 0xFF2C4100, 0xFF294F03, 0xFF2C6901, 0xFF2D7F00, 0xFF358C01, 0xFF4D9A01,
+	0xFF69A602, 0xFF879A07, 0xFF867A06, 0xFF836201, 0xFF845A00, 0xFF765F00, 0xFF636900, 0xFF657401,
+	0xFF6F8605, 0xFF708705, 0xFF617401, 0xFF4B5400, 0xFF3C3B00, 0xFF372E00, 0xFF403100, 0xFF5C4900,
+	0xFF7E6C07, 0xFF887F05, 0xFF7B8502, 0xFF7B8805, 0xFF7E8702, 0xFF708701, 0xFF618200, 0xFF618100,
+	0xFF6F9000, 0xFF82A303, 0xFF87A507, 0xFF728B01, 0xFF566800, 0xFF575B00, 0xFF7D6802, 0xFF9B8105,
+	0xFF938707, 0xFF627002, 0xFF3D4E00, 0xFF3E3500, 0xFF413700, 0xFF474504, 0xFF4E5801, 0xFF676A00,
+	0xFF827803, 0xFF967802, 0xFF9A6600, 0xFF915102, 0xFF754E00, 0xFF4C6700, 0xFF328000, 0xFF438604,
+	0xFF728405, 0xFF968500, 0xFF898702, 0xFF5A7E07, 0xFF2C6F00, 0xFF1F6000, 0xFF456203, 0xFF827200,
+	0xFFB17700, 0xFFC47103, 0xFFA06F02, 0xFF587C00, 0xFF2B8900, 0xFF179704, 0xFF1D9E02, 0xFF3E9602,
+	0xFF5A7B00, 0xFF785B00, 0xFF985C02, 0xFFA57304, 0xFFA69703, 0xFF9CAA01, 0xFF92AE00, 0xFF93AF02,
+	0xFF8EA209, 0xFF6F8506, 0xFF4C6500, 0xFF3C5600, 0xFF4C5900, 0xFF646605, 0xFF5D7303, 0xFF4F7800,
+	0xFF4E7400, 0xFF536B00, 0xFF566900, 0xFF626700, 0xFF727003, 0xFF7A7F09, 0xFF6C8506, 0xFF5F8102,
+	0xFF597902, 0xFF6C7900, 0xFF8B8400, 0xFF968D00, 0xFF918600, 0xFF797902, 0xFF6E6704, 0xFF7A5901,
+	0xFF945603, 0xFF905002, 0xFF6D3D03, 0xFF4A2701, 0xFF432D00, 0xFF485E00, 0xFF589803, 0xFF58BD06,
+	0xFF47C403, 0xFF34BE00, 0xFF3FA500, 0xFF538202, 0xFF615600, 0xFF5F3800, 0xFF563700, 0xFF5F4E00,
+	0xFF7A6500, 0xFF9F6400, 0xFFB64E01, 0xFFA23B02, 0xFF6F3900, 0xFF674C01, 0xFF7C6606, 0xFF8A7202,
+	0xFF655A05, 0xFF3B3900, 0xFF382700, 0xFF443101, 0xFF4F4A00, 0xFF4A6500, 0xFF5B8400, 0xFF77A405,
+	0xFF83B605, 0xFF77AF02, 0xFF60940A, 0xFF697403, 0xFF786400, 0xFF7A5B00, 0xFF725102, 0xFF6C5201,
+	0xFF705A00, 0xFF716300, 0xFF5D6902, 0xFF485B03, 0xFF364700, 0xFF323C00, 0xFF454300, 0xFF755B02,
+	0xFF9C6B05, 0xFF967205, 0xFF7B7C02, 0xFF668502, 0xFF658202, 0xFF657D01, 0xFF617A02, 0xFF688200,
+	0xFF7A9501, 0xFF89A201, 0xFF849F00, 0xFF699000, 0xFF587D01, 0xFF697502, 0xFF8E7A06, 0xFF9A7C0B,
+	0xFF796A07, 0xFF4B4E01, 0xFF353B00, 0xFF463900, 0xFF554F02, 0xFF546703, 0xFF587701, 0xFF717B00,
+	0xFF7E7A00, 0xFF7E7800, 0xFF7A6500, 0xFF7F4C01, 0xFF7A5000, 0xFF5B6601, 0xFF3E8701, 0xFF40A003,
+	0xFF629F06, 0xFF8F8302, 0xFF866400, 0xFF4E4F00, 0xFF224B01, 0xFF176C01, 0xFF3E9402, 0xFF78AC03,
+	0xFF9FA601, 0xFFBA7A01, 0xFFA15F00, 0xFF626500, 0xFF327A00, 0xFF198E01, 0xFF20A103, 0xFF2FAA07,
+	0xFF479703, 0xFF697600, 0xFF9B6003, 0xFFBC6901, 0xFFB77E00, 0xFF918800, 0xFF7F8201, 0xFF797400,
+	0xFF686400, 0xFF4F5300, 0xFF3C4B00, 0xFF385700, 0xFF576701, 0xFF747504, 0xFF6A8009, 0xFF528205,
+	0xFF447F00, 0xFF427D00, 0xFF508301, 0xFF648800, 0xFF798A02, 0xFF878B05, 0xFF778B02, 0xFF578601,
+	0xFF4D7F00, 0xFF617300, 0xFF7D6E00, 0xFF886D00, 0xFF7E6900, 0xFF676300, 0xFF5F5900, 0xFF714F02,
+	0xFF8C4705, 0xFF844102, 0xFF5F3501, 0xFF492901, 0xFF4B3200, 0xFF6C5800, 0xFF8A8304, 0xFF819B01,
+	0xFF56A400, 0xFF2BA500, 0xFF219E00, 0xFF367D00, 0xFF485501, 0xFF564300, 0xFF6B5102, 0xFF867502,
+	0xFF9A9103, 0xFFA88E02, 0xFF9B7307, 0xFF7F5506, 0xFF654602, 0xFF685200, 0xFF886B04, 0xFF906F07,
+	0xFF5A7306, 0xFF355100, 0xFF433800, 0xFF633900, 0xFF713F01, 0xFF6D4F00, 0xFF816200, 0xFF9B7802,
+	0xFF968504, 0xFF698A00, 0xFF4B8A02, 0xFF4E8B00, 0xFF658500, 0xFF6D7500, 0xFF695802, 0xFF6F3F01,
+	0xFF7D3200, 0xFF823501, 0xFF6C4300, 0xFF504D03, 0xFF3C4F00, 0xFF3F5400, 0xFF5C6601, 0xFF8B7604,
+	0xFFA57501, 0xFF967400, 0xFF7A7500, 0xFF5F7B00, 0xFF537B00, 0xFF567700, 0xFF637601, 0xFF738002,
+	0xFF8B8305, 0xFF938901, 0xFF808B01, 0xFF678402, 0xFF627C02, 0xFF7A7904, 0xFF927604, 0xFF847402,
+	0xFF596800, 0xFF385300, 0xFF3E4C00, 0xFF615503, 0xFF716607, 0xFF647302, 0xFF5E7802, 0xFF717B00,
+	0xFF778100, 0xFF708500, 0xFF627800, 0xFF615C00, 0xFF704701, 0xFF6A4A02, 0xFF566304, 0xFF577F02,
+	0xFF6B8605, 0xFF7F7202, 0xFF7C4D01, 0xFF513E00, 0xFF2D5100, 0xFF2E8600, 0xFF42B801, 0xFF58CF02,
+	0xFF7FC700, 0xFF9EA101, 0xFF948400, 0xFF737700, 0xFF447700, 0xFF268100, 0xFF338402, 0xFF378807,
+	0xFF3E8003, 0xFF5C6900, 0xFF915001, 0xFFBC4B00, 0xFFB34C03, 0xFF7E4B03, 0xFF5C4901, 0xFF584101,
+	0xFF544404, 0xFF4F5301, 0xFF506400, 0xFF507604, 0xFF5A8302, 0xFF6B8400, 0xFF707B07, 0xFF597604,
+	0xFF467A00, 0xFF498102, 0xFF548B05, 0xFF618D02, 0xFF748801, 0xFF808201, 0xFF7B7D00, 0xFF607D00,
+	0xFF557C00, 0xFF567901, 0xFF5F7103, 0xFF6A6D04, 0xFF646D02, 0xFF4E6501, 0xFF495E00, 0xFF5E5700,
+	0xFF764F02, 0xFF724A01, 0xFF5A4000, 0xFF453603, 0xFF503A02, 0xFF864900, 0xFFB05B07, 0xFFAB6802,
+	0xFF787100, 0xFF3D7B01, 0xFF277E00, 0xFF2F7101, 0xFF4B5E00, 0xFF6A5F01, 0xFF917D04, 0xFFAE9D02,
+	0xFFACAB02, 0xFF92A002, 0xFF767B05, 0xFF5E5902, 0xFF5C4903, 0xFF795301, 0xFF9B7303, 0xFF8B8104,
+	0xFF587405, 0xFF396300, 0xFF4E5F02, 0xFF775E02, 0xFF845404, 0xFF7E5100, 0xFF8B4E00, 0xFFA04903,
+	0xFF924801, 0xFF635400, 0xFF506F00, 0xFF488D00, 0xFF4A9301, 0xFF518200, 0xFF556200, 0xFF644803,
+	0xFF7D3501, 0xFF8B2A03, 0xFF753101, 0xFF574000, 0xFF4F5200, 0xFF596F01, 0xFF748602, 0xFF8F9001,
+	0xFF969103, 0xFF8C8900, 0xFF798400, 0xFF658402, 0xFF568503, 0xFF558402, 0xFF638301, 0xFF797F02,
+	0xFF8B7402, 0xFF926E02, 0xFF836901, 0xFF6A6301, 0xFF676303, 0xFF796600, 0xFF8A6401, 0xFF796001,
+	0xFF496700, 0xFF2A6D00, 0xFF467105, 0xFF787505, 0xFF827601, 0xFF6A7302, 0xFF5C7101, 0xFF737404,
+	0xFF827D04, 0xFF6F7E00, 0xFF517000, 0xFF415600, 0xFF573E00, 0xFF7D3D00, 0xFF874D03, 0xFF7F5E00,
+	0xFF7A6800, 0xFF725F02, 0xFF654902, 0xFF604100, 0xFF5A6403, 0xFF57A204, 0xFF4CCF00, 0xFF46D800,
+	0xFF6DC906, 0xFF8BBA05, 0xFF89A801, 0xFF6E8806, 0xFF4B6A04, 0xFF3F6100, 0xFF446000, 0xFF486301,
+	0xFF466801, 0xFF566401, 0xFF835400, 0xFFAD3E00, 0xFFA12F03, 0xFF702901, 0xFF492E00, 0xFF553E00,
+	0xFF6B5C08, 0xFF727C04, 0xFF6E8A00, 0xFF628304, 0xFF5B7E02, 0xFF607000, 0xFF676200, 0xFF586400,
+	0xFF4C6E04, 0xFF4D7B03, 0xFF578201, 0xFF5C7F01, 0xFF6C7702, 0xFF727602, 0xFF777600, 0xFF717B00,
+	0xFF647B00, 0xFF537503, 0xFF4F7406, 0xFF557607, 0xFF567601, 0xFF426D00, 0xFF396300, 0xFF4E5D00,
+	0xFF6D5400, 0xFF6A4F01, 0xFF4F4801, 0xFF424600, 0xFF564D00, 0xFF8A5700, 0xFFBA5302, 0xFFBB5200,
+	0xFF925901, 0xFF5A6508, 0xFF376E04, 0xFF387300, 0xFF5D7800, 0xFF8E8902, 0xFFB4A603, 0xFFBAB703,
+	0xFF9AAA01, 0xFF6F8501, 0xFF5D5D00, 0xFF674000, 0xFF703B01, 0xFF874500, 0xFFA45F05, 0xFF8F7301,
+	0xFF5E6C00, 0xFF407501, 0xFF587906, 0xFF7C7204, 0xFF806701, 0xFF775D00, 0xFF874D02, 0xFF943903,
+	0xFF892900, 0xFF772A00, 0xFF6B4402, 0xFF586000, 0xFF3E7100, 0xFF337901, 0xFF417802, 0xFF607201,
+	0xFF776800, 0xFF7C5100, 0xFF723C00, 0xFF663F00, 0xFF6F5A00, 0xFF7D7B00, 0xFF899300, 0xFF88A500,
+	0xFF83AA00, 0xFF84A800, 0xFF7CA100, 0xFF699701, 0xFF5E9200, 0xFF5E9201, 0xFF678D03, 0xFF727C01,
+	0xFF7B6501, 0xFF835300, 0xFF894500, 0xFF774604, 0xFF674F03, 0xFF745400, 0xFF885401, 0xFF785000,
+	0xFF505800, 0xFF396D01, 0xFF4E8003, 0xFF7F8601, 0xFF828900, 0xFF667F00, 0xFF5D7000, 0xFF726602,
+	0xFF836006, 0xFF6A5A01, 0xFF414E00, 0xFF344402, 0xFF5F4C03, 0xFF9C6105, 0xFFAE6C05, 0xFF926203,
+	0xFF7B5300, 0xFF6E4701, 0xFF5D4500, 0xFF6A4A03, 0xFF8B6F08, 0xFF88AD04, 0xFF63D100, 0xFF4FD100,
+	0xFF69C203, 0xFF81B302, 0xFF7E9501, 0xFF5B7106, 0xFF475005, 0xFF5B3E00, 0xFF684100, 0xFF6D5101,
+	0xFF5B6F00, 0xFF547B00, 0xFF716E02, 0xFF925002, 0xFF823F00, 0xFF583900, 0xFF4E4500, 0xFF706408,
+	0xFF928706, 0xFF8C9801, 0xFF738E00, 0xFF5E7401, 0xFF576302, 0xFF605900, 0xFF695400, 0xFF615900,
+	0xFF556403, 0xFF547201, 0xFF607600, 0xFF647700, 0xFF667800, 0xFF667900, 0xFF707A01, 0xFF7A7501,
+	0xFF6D7001, 0xFF526600, 0xFF476700, 0xFF517102, 0xFF5B7903, 0xFF497504, 0xFF386F01, 0xFF466300,
+	0xFF645400, 0xFF5F4F00, 0xFF495200, 0xFF455D00, 0xFF5B6800, 0xFF856A00, 0xFFB75B03, 0xFFB95303,
+	0xFF945000, 0xFF615803, 0xFF406202, 0xFF4B7501, 0xFF799600, 0xFFAAB300, 0xFFB9C202, 0xFFA4BE09,
+	0xFF759F02, 0xFF527200, 0xFF555000, 0xFF703D02, 0xFF823603, 0xFF8D3400, 0xFFA23C04, 0xFF9A5503,
+	0xFF717F03, 0xFF488900, 0xFF4F7D02, 0xFF6E6504, 0xFF745800, 0xFF755400, 0xFF834B01, 0xFF903608,
+	0xFF842005, 0xFF881300, 0xFF802001, 0xFF5E3400, 0xFF474B00, 0xFF3B6F00, 0xFF4B9302, 0xFF6AA300,
+	0xFF6F9E01, 0xFF697E01, 0xFF6A5C00, 0xFF7E5400, 0xFF946B01, 0xFF998800, 0xFF969D01, 0xFF8AAA04,
+	0xFF7EB302, 0xFF73B500, 0xFF6DA902, 0xFF669303, 0xFF638D00, 0xFF698900, 0xFF678001, 0xFF5E7003,
+	0xFF695801, 0xFF7D4100, 0xFF863B01, 0xFF7A4408, 0xFF675203, 0xFF6B5601, 0xFF754F01, 0xFF6F4600,
+	0xFF5F4A00, 0xFF525E00, 0xFF618302, 0xFF87A000, 0xFF84AB03, 0xFF5F9505, 0xFF546E00, 0xFF644E00,
+	0xFF6E3C00, 0xFF633700, 0xFF443E00, 0xFF475802, 0xFF837A05, 0xFFAD9404, 0xFFA48E04, 0xFF857003,
+	0xFF715000, 0xFF764500, 0xFF6B5000, 0xFF775F00, 0xFFA27A05, 0xFFB0A004, 0xFF82B601, 0xFF5FBC00,
+	0xFF5EAD00, 0xFF669001, 0xFF606A01, 0xFF495100, 0xFF5B4200, 0xFF823400, 0xFF923C01, 0xFF8F5700,
+	0xFF787701, 0xFF5E8501, 0xFF637E03, 0xFF796E02, 0xFF726100, 0xFF5B6600, 0xFF667902, 0xFF8D8C04,
+	0xFF9D9700, 0xFF878D00, 0xFF6A7702, 0xFF5B6600, 0xFF596300, 0xFF5E6401, 0xFF646100, 0xFF636100,
+	0xFF5C6903, 0xFF657301, 0xFF6F7500, 0xFF687900, 0xFF607B00, 0xFF5C7601, 0xFF666C02, 0xFF775F02,
+	0xFF6E5A02, 0xFF535E00, 0xFF4A6900, 0xFF5A7800, 0xFF698304, 0xFF5C8502, 0xFF458500, 0xFF437301,
+	0xFF565A03, 0xFF624E00, 0xFF625B00, 0xFF5A7005, 0xFF647004, 0xFF846103, 0xFFA65303, 0xFFA14A02,
+	0xFF7E4600, 0xFF574F00, 0xFF436300, 0xFF568604, 0xFF87A705, 0xFFB4BC01, 0xFFB4BB00, 0xFF84AB02,
+	0xFF568E02, 0xFF457700, 0xFF5C6B02, 0xFF795D04, 0xFF824A02, 0xFF8C3A00, 0xFF9A4600, 0xFF9F6500,
+	0xFF81A405, 0xFF459600, 0xFF327100, 0xFF514E01, 0xFF7B3801, 0xFF8A3600, 0xFF893D00, 0xFF823504,
+	0xFF871E05, 0xFF961000, 0xFF971100, 0xFF772300, 0xFF653D00, 0xFF676B05, 0xFF7B9C04, 0xFF78B201,
+	0xFF5AAA02, 0xFF4E9003, 0xFF647E00, 0xFF997A07, 0xFFB18807, 0xFFA99901, 0xFFA29A01, 0xFF969D05,
+	0xFF7CA403, 0xFF629E01, 0xFF568C01, 0xFF587702, 0xFF676E01, 0xFF756C00, 0xFF686601, 0xFF575C03,
+	0xFF5B5701, 0xFF785001, 0xFF845200, 0xFF755601, 0xFF615801, 0xFF555500, 0xFF544B02, 0xFF633D01,
+	0xFF674200, 0xFF6D5D00, 0xFF8A8B03, 0xFF99B700, 0xFF80C507, 0xFF4FA007, 0xFF396700, 0xFF4D4002,
+	0xFF643200, 0xFF6B3D02, 0xFF675F01, 0xFF788802, 0xFFA3AC01, 0xFFA4B501, 0xFF839600, 0xFF687600,
+	0xFF6A6500, 0xFF816600, 0xFF837103, 0xFF8E7F01, 0xFFA98501, 0xFFB67C03, 0xFF917904, 0xFF638201,
+	0xFF4F7D01, 0xFF465A01, 0xFF354802, 0xFF374F00, 0xFF655100, 0xFF934900, 0xFFAF4E01, 0xFFA76100,
+	0xFF867402, 0xFF6B7D03, 0xFF647F00, 0xFF6C7E00, 0xFF727E01, 0xFF6C8904, 0xFF7F9504, 0xFF979800,
+	0xFF898C00, 0xFF687801, 0xFF576E03, 0xFF5D7301, 0xFF637B01, 0xFF607B01, 0xFF577301, 0xFF537100,
+	0xFF5C7801, 0xFF757A01, 0xFF7A7D05, 0xFF657C01, 0xFF517500, 0xFF486900, 0xFF575A00, 0xFF6F5000,
+	0xFF795500, 0xFF6C6D00, 0xFF648406, 0xFF6D8D03, 0xFF768901, 0xFF6C8700, 0xFF528702, 0xFF3E7F04,
+	0xFF516701, 0xFF775600, 0xFF825E02, 0xFF6A6B03, 0xFF616602, 0xFF7D5501, 0xFF904C00, 0xFF8B4600,
+	0xFF714D01, 0xFF546404, 0xFF4F8602, 0xFF56A400, 0xFF77AA05, 0xFFAA9605, 0xFFB07F04, 0xFF7A7103,
+	0xFF486805, 0xFF347B00, 0xFF508B02, 0xFF708302, 0xFF767100, 0xFF8B6900, 0xFFAE8003, 0xFFAE9903,
+	0xFF86A007, 0xFF398800, 0xFF156700, 0xFF364A02, 0xFF7A3203, 0xFFA12E00, 0xFF973701, 0xFF7B3C01,
+	0xFF7E3400, 0xFF922C00, 0xFF9F2500, 0xFF972B00, 0xFF914300, 0xFF986C01, 0xFFA28F07, 0xFF7D9C06,
+	0xFF479500, 0xFF379100, 0xFF649601, 0xFF9AA007, 0xFFB09F08, 0xFFA39502, 0xFF998A00, 0xFF928300,
+	0xFF787C01, 0xFF527803, 0xFF3C6B01, 0xFF425D00, 0xFF605701, 0xFF7C5500, 0xFF6F5800, 0xFF605D00,
+	0xFF6B6C06, 0xFF828008, 0xFF827C00, 0xFF686A01, 0xFF4A5501, 0xFF384400, 0xFF3F3D01, 0xFF5C3D00,
+	0xFF744B00, 0xFF8B6602, 0xFFAB8A04, 0xFFADAA03, 0xFF7AAD01, 0xFF388D01, 0xFF226400, 0xFF3E5001,
+	0xFF615801, 0xFF7F6D02, 0xFF958F01, 0xFFADB405, 0xFFB6C704, 0xFF93BB01, 0xFF689D00, 0xFF598600,
+	0xFF718201, 0xFF878802, 0xFF8C8903, 0xFF948109, 0xFF976E03, 0xFF984B01, 0xFF833803, 0xFF524302,
+	0xFF334401, 0xFF273700, 0xFF164101, 0xFF245900, 0xFF586E01, 0xFF8F7502, 0xFFB07804, 0xFFAD7D06,
+	0xFF858302, 0xFF678A01, 0xFF638B04, 0xFF6C8401, 0xFF748102, 0xFF7B8504, 0xFF9A8503, 0xFF8F8401,
+	0xFF687601, 0xFF4F7300, 0xFF4C7700, 0xFF5E7A04, 0xFF627D04, 0xFF5F7E00, 0xFF527D00, 0xFF4C7D01,
+	0xFF5C8300, 0xFF7B8301, 0xFF7C8503, 0xFF628301, 0xFF447C03, 0xFF3B7100, 0xFF536701, 0xFF796501,
+	0xFF946E03, 0xFF948002, 0xFF859102, 0xFF789002, 0xFF6F8100, 0xFF667100, 0xFF546E02, 0xFF417600,
+	0xFF597201, 0xFF806402, 0xFF8B5705, 0xFF6B5300, 0xFF5E5600, 0xFF785E00, 0xFF8C6501, 0xFF8B6300,
+	0xFF867303, 0xFF7B9507, 0xFF6DB207, 0xFF58B604, 0xFF609500, 0xFF8A6401, 0xFFA03E05, 0xFF7B3A00,
+	0xFF524B00, 0xFF3E7300, 0xFF4D8E00, 0xFF5E9400, 0xFF729102, 0xFF979602, 0xFFBFA203, 0xFFB5A903,
+	0xFF756C03, 0xFF2F5E00, 0xFF0B5E00, 0xFF265B00, 0xFF6E5201, 0xFFA45203, 0xFFA05E01, 0xFF7B6900,
+	0xFF6D6A00, 0xFF7C6100, 0xFF8F5400, 0xFF9C4E00, 0xFFAA5800, 0xFFBE6D00, 0xFFB38303, 0xFF7F8D02,
+	0xFF448E00, 0xFF329100, 0xFF559A00, 0xFF81A102, 0xFF8F9305, 0xFF827F01, 0xFF7F7100, 0xFF826900,
+	0xFF755E00, 0xFF4D5B00, 0xFF315E00, 0xFF395900, 0xFF595801, 0xFF825D01, 0xFF816900, 0xFF7C7C03,
+	0xFF909404, 0xFF99A502, 0xFF779B02, 0xFF497804, 0xFF2D4D03, 0xFF2C2F00, 0xFF462F00, 0xFF6D4103,
+	0xFF8E5605, 0xFFA26703, 0xFFB47101, 0xFFAD7003, 0xFF7B6700, 0xFF306504, 0xFF216C01, 0xFF3A7C00,
+	0xFF5F9300, 0xFF84A100, 0xFFA9AF03, 0xFFC7C205, 0xFFC5C80A, 0xFF88C106, 0xFF50AF00, 0xFF4CA202,
+	0xFF6D9807, 0xFF7C8C03, 0xFF7A7601, 0xFF735A03, 0xFF713E01, 0xFF702302, 0xFF681D01, 0xFF572400,
+	0xFF3B3200, 0xFF1C4100, 0xFF0F5400, 0xFF1F6F00, 0xFF4F8F02, 0xFF8BA106, 0xFFA7A606, 0xFFA4A208,
+	0xFF859F01, 0xFF64A100, 0xFF599505, 0xFF5E8102, 0xFF6E7300, 0xFF8C6A00, 0xFFA26502, 0xFF8A6601,
+	0xFF546A01, 0xFF417200, 0xFF487500, 0xFF536D01, 0xFF5A6F00, 0xFF637D00, 0xFF5E8800, 0xFF548A00,
+	0xFF5C8500, 0xFF7C8200, 0xFF838A00, 0xFF6B9301, 0xFF459A01, 0xFF3D9700, 0xFF5A8F01, 0xFF808D00,
+	0xFFA18E02, 0xFFA58405, 0xFF927B01, 0xFF787001, 0xFF615F00, 0xFF5B5401, 0xFF585401, 0xFF4F6605,
+	0xFF5F7105, 0xFF7B6302, 0xFF804B01, 0xFF754300, 0xFF785B00, 0xFF868401, 0xFF8C9900, 0xFF909A00,
+	0xFF9DA300, 0xFFA4B101, 0xFF79B802, 0xFF459D04, 0xFF416D00, 0xFF6A4200, 0xFF972F00, 0xFF9D3601,
+	0xFF865201, 0xFF6E7D00, 0xFF619801, 0xFF629B06, 0xFF769805, 0xFF929602, 0xFFAC8805, 0xFFA97400,
+	0xFF713600, 0xFF374600, 0xFF166100, 0xFF207D01, 0xFF5C8D02, 0xFFA08805, 0xFFB48B09, 0xFF899706,
+	0xFF649D00, 0xFF659600, 0xFF768B00, 0xFF908301, 0xFFAF8207, 0xFFC98409, 0xFFB68B00, 0xFF838F03,
+	0xFF418D01, 0xFF288800, 0xFF428400, 0xFF658300, 0xFF6E7900, 0xFF6A7200, 0xFF6E6900, 0xFF746502,
+	0xFF715E01, 0xFF5B5C00, 0xFF456000, 0xFF4A6803, 0xFF627303, 0xFF867C01, 0xFF948904, 0xFF9A9309,
+	0xFFA79D05, 0xFF9E9C00, 0xFF688E01, 0xFF307703, 0xFF1F5203, 0xFF303500, 0xFF553500, 0xFF884601,
+	0xFFA15B04, 0xFFA55F03, 0xFFAD4E00, 0xFFA13800, 0xFF783401, 0xFF404F01, 0xFF357401, 0xFF489805,
+	0xFF5EA703, 0xFF79A900, 0xFFA6A601, 0xFFCEA400, 0xFFC4AB05, 0xFF85B207, 0xFF4FB202, 0xFF46A306,
+	0xFF548703, 0xFF5F6700, 0xFF604A01, 0xFF5A3C00, 0xFF583001, 0xFF542C01, 0xFF5D3603, 0xFF724A03,
+	0xFF616101, 0xFF2F7700, 0xFF238504, 0xFF379603, 0xFF5DAB06, 0xFF8AB109, 0xFF9CA804, 0xFF9D9901,
+	0xFF809101, 0xFF5C9300, 0xFF478901, 0xFF487A00, 0xFF647300, 0xFF926B00, 0xFFA55F01, 0xFF845B01,
+	0xFF516400, 0xFF3E6D01, 0xFF447002, 0xFF536E00, 0xFF667900, 0xFF768E00, 0xFF709B01, 0xFF5B9304,
+	0xFF598402, 0xFF7C8001, 0xFF968501, 0xFF839504, 0xFF5FA501, 0xFF49AE00, 0xFF61A602, 0xFF839904,
+	0xFF978801, 0xFF926D00, 0xFF825201, 0xFF724201, 0xFF5E4000, 0xFF554500, 0xFF574B01, 0xFF545703,
+	0xFF585F02, 0xFF665901, 0xFF6E5200, 0xFF875A00, 0xFFA28404, 0xFFA6B201, 0xFF97C201, 0xFF90B904,
+	0xFF9AB002, 0xFF9C9D01, 0xFF6E8700, 0xFF386B02, 0xFF315301, 0xFF664D00, 0xFF9D5903, 0xFFBD6903,
+	0xFFB27D01, 0xFF9B9301, 0xFF81A004, 0xFF6A9508, 0xFF617C02, 0xFF686800, 0xFF805301, 0xFF933A00,
+	0xFF932C03, 0xFF5C4102, 0xFF316F01, 0xFF249E01, 0xFF48B602, 0xFF8DB306, 0xFFB6A507, 0xFFA2A204,
+	0xFF67AC00, 0xFF4EB400, 0xFF67B400, 0xFF8CB204, 0xFFA6AA05, 0xFFB19C05, 0xFFA58707, 0xFF7F7805,
+	0xFF437104, 0xFF276E00, 0xFF436D02, 0xFF6A6F02, 0xFF747A00, 0xFF707F03, 0xFF647B01, 0xFF5B7602,
+	0xFF5B6F04, 0xFF656A01, 0xFF686F00, 0xFF6F7901, 0xFF7A8501, 0xFF829200, 0xFF8A9403, 0xFF9E8504,
+	0xFF9E7605, 0xFF8C6501, 0xFF6A5E03, 0xFF2F6E00, 0xFF147502, 0xFF2F6704, 0xFF625901, 0xFFA45200,
+	0xFFAA5E01, 0xFF9E5E00, 0xFF954B02, 0xFF863301, 0xFF732C00, 0xFF5C4100, 0xFF596602, 0xFF63890C,
+	0xFF65920A, 0xFF718D00, 0xFF9D8600, 0xFFC57D00, 0xFFC38000, 0xFF898701, 0xFF4A8D01, 0xFF397C03,
+	0xFF455B00, 0xFF5B4A00, 0xFF6A4803, 0xFF675001, 0xFF555800, 0xFF596300, 0xFF777A00, 0xFF949001,
+	0xFF80A003, 0xFF44AB02, 0xFF33A807, 0xFF56A702, 0xFF72A802, 0xFF849207, 0xFF887706, 0xFF8B6400,
+	0xFF7F6102, 0xFF5F6900, 0xFF477600, 0xFF438401, 0xFF649003, 0xFF928803, 0xFF9B7205, 0xFF756101,
+	0xFF525F00, 0xFF487103, 0xFF518101, 0xFF6A8B00, 0xFF819900, 0xFF8DA600, 0xFF7DA102, 0xFF548B03,
+	0xFF4F7A04, 0xFF747201, 0xFFA07400, 0xFFA17E01, 0xFF7A9100, 0xFF5C9D00, 0xFF649203, 0xFF7B7B06,
+	0xFF7E6304, 0xFF754B01, 0xFF673B00, 0xFF633000, 0xFF602F00, 0xFF593500, 0xFF5A3E00, 0xFF564700,
+	0xFF4F5400, 0xFF4F6604, 0xFF707B00, 0xFFA29400, 0xFFC1B405, 0xFFBBC207, 0xFF9BC003, 0xFF82A803,
+	0xFF798B05, 0xFF716D04, 0xFF585600, 0xFF415300, 0xFF536501, 0xFF7D7F05, 0xFFA39603, 0xFFB89902,
+	0xFFB69407, 0xFFA88C04, 0xFF828103, 0xFF546D02, 0xFF3A5302, 0xFF494601, 0xFF723C00, 0xFF933401,
+	0xFFA74801, 0xFF864F01, 0xFF4E7D03, 0xFF2FA303, 0xFF3CAD02, 0xFF70AC02, 0xFFAB9900, 0xFFAE8F00,
+	0xFF7E9C00, 0xFF5FB400, 0xFF6BC203, 0xFF82C101, 0xFF8AA900, 0xFF888502, 0xFF836008, 0xFF684E01,
+	0xFF4C4C02, 0xFF445A00, 0xFF5E6E03, 0xFF878005, 0xFF938F04, 0xFF7E8B07, 0xFF5C8201, 0xFF447B00,
+	0xFF497700, 0xFF647703, 0xFF797B04, 0xFF867802, 0xFF8B7601, 0xFF837800, 0xFF7A7100, 0xFF7B5C00,
+	0xFF784900, 0xFF6F3D00, 0xFF664200, 0xFF436500, 0xFF208C00, 0xFF2F9F02, 0xFF659504, 0xFFA07C05,
+	0xFFAA6D00, 0xFF8F6A02, 0xFF776404, 0xFF745902, 0xFF794800, 0xFF744A00, 0xFF705900, 0xFF676A02,
+	0xFF5E7102, 0xFF6E7300, 0xFF997600, 0xFFC47104, 0xFFC06301, 0xFF835800, 0xFF445400, 0xFF315103,
+	0xFF515502, 0xFF7C6200, 0xFF967303, 0xFF888907, 0xFF669A04, 0xFF6BA004, 0xFF8FA508, 0xFF9CA904,
+	0xFF73A601, 0xFF429802, 0xFF3F9302, 0xFF668F00, 0xFF7D8100, 0xFF716500, 0xFF685400, 0xFF7A4C00,
+	0xFF834D00, 0xFF675E00, 0xFF567601, 0xFF529601, 0xFF68A505, 0xFF829D07, 0xFF7D8703, 0xFF646E00,
+	0xFF596700, 0xFF657E03, 0xFF759C01, 0xFF83A902, 0xFF8BAB01, 0xFF89A201, 0xFF728901, 0xFF4C7300,
+	0xFF446800, 0xFF686000, 0xFFA35D01, 0xFFB55F04, 0xFF8F6E04, 0xFF687301, 0xFF5C6600, 0xFF675200,
+	0xFF743F02, 0xFF6C3C00, 0xFF583E00, 0xFF4D3600, 0xFF522D00, 0xFF602D00, 0xFF653F00, 0xFF635500,
+	0xFF5F7100, 0xFF669502, 0xFF88B302, 0xFFACC304, 0xFFBABF05, 0xFFB2A605, 0xFF928E03, 0xFF6C7A02,
+	0xFF576601, 0xFF565C00, 0xFF5E5C00, 0xFF6A6800, 0xFF848602, 0xFF959D04, 0xFF999D01, 0xFF9D8504,
+	0xFF9B6F06, 0xFF905F01, 0xFF6A5102, 0xFF3B4E00, 0xFF275301, 0xFF455F01, 0xFF796801, 0xFF9B5F02,
+	0xFF9A6B00, 0xFF9A6400, 0xFF707901, 0xFF3E8003, 0xFF3A7C01, 0xFF6D7E00, 0xFFA97D00, 0xFFB47E00,
+	0xFF9F8802, 0xFF889C04, 0xFF7EA904, 0xFF6BA103, 0xFF537E00, 0xFF495700, 0xFF494000, 0xFF543C00,
+	0xFF634600, 0xFF7B5700, 0xFF936D03, 0xFF9F8403, 0xFFA08802, 0xFF817B01, 0xFF4F7000, 0xFF386C00,
+	0xFF467400, 0xFF617704, 0xFF796C0A, 0xFF865B08, 0xFF874B02, 0xFF814200, 0xFF733F00, 0xFF613F00,
+	0xFF613C00, 0xFF684004, 0xFF694C03, 0xFF5D5F00, 0xFF458400, 0xFF3CA900, 0xFF63B303, 0xFF83A304,
+	0xFF8D8400, 0xFF747A00, 0xFF668100, 0xFF698503, 0xFF747D04, 0xFF7B6B00, 0xFF755C01, 0xFF5F5900,
+	0xFF605E00, 0xFF827100, 0xFFA68403, 0xFFC27908, 0xFFAD5502, 0xFF6E4000, 0xFF473D01, 0xFF465100,
+	0xFF6C7500, 0xFF9A8C00, 0xFFAD9F03, 0xFF99B307, 0xFF70BF04, 0xFF6BB802, 0xFF849805, 0xFF7E7B04,
+	0xFF4E6501, 0xFF2B6000, 0xFF466900, 0xFF796E00, 0xFF8F6700, 0xFF706000, 0xFF5E6001, 0xFF746305,
+	0xFF7D6900, 0xFF757500, 0xFF698A02, 0xFF5EA200, 0xFF61A504, 0xFF609F05, 0xFF599000, 0xFF4E7F00,
+	0xFF5C7D00, 0xFF828B00, 0xFF92A103, 0xFF8CAA08, 0xFF7F9F03, 0xFF6F8800, 0xFF606B00, 0xFF455D00,
+	0xFF3F5A01, 0xFF615801, 0xFF925404, 0xFFB14607, 0xFF9D4904, 0xFF714B00, 0xFF514C00, 0xFF5A4300,
+	0xFF713A00, 0xFF773B00, 0xFF653B00, 0xFF433F00, 0xFF484200, 0xFF674A00, 0xFF806403, 0xFF898302,
+	0xFF89A400, 0xFF8EC000, 0xFF95C401, 0xFF99B406, 0xFF919605, 0xFF887101, 0xFF7E6000, 0xFF686000,
+	0xFF5A6801, 0xFF616E03, 0xFF757B01, 0xFF8F8900, 0xFF988A01, 0xFF908305, 0xFF7A7103, 0xFF745502,
+	0xFF7C4600, 0xFF7E4200, 0xFF6D3F00, 0xFF535401, 0xFF457D00, 0xFF509F02, 0xFF70A305, 0xFF878C01,
+	0xFF829701, 0xFF968103, 0xFF757100, 0xFF425900, 0xFF3E4D00, 0xFF795801, 0xFFAD6C01, 0xFFB57000,
+	0xFFA97001, 0xFF997207, 0xFF7B7203, 0xFF4C6600, 0xFF2A5100, 0xFF244500, 0xFF294E00, 0xFF4B5A00,
+	0xFF7E5A01, 0xFFA55604, 0xFFA95901, 0xFF9C6200, 0xFF955C00, 0xFF735700, 0xFF465800, 0xFF385B00,
+	0xFF485F00, 0xFF616200, 0xFF715704, 0xFF754B03, 0xFF6F3F00, 0xFF763800, 0xFF7B3501, 0xFF703A01,
+	0xFF6B4700, 0xFF7A5B05, 0xFF7B6408, 0xFF646502, 0xFF537400, 0xFF579000, 0xFF6AA304, 0xFF6D9D04,
+	0xFF6A8700, 0xFF677F00, 0xFF689003, 0xFF6AA502, 0xFF71A401, 0xFF6D8F06, 0xFF627006, 0xFF5D5B00,
+	0xFF6C6401, 0xFF988204, 0xFFB69002, 0xFFAC7A02, 0xFF7F5100, 0xFF583E00, 0xFF4D4900, 0xFF626A02,
+	0xFF808A06, 0xFF9F9505, 0xFFABA100, 0xFF99B402, 0xFF6BBB02, 0xFF58A200, 0xFF656E00, 0xFF673E00,
+	0xFF4F3002, 0xFF384400, 0xFF546300, 0xFF7E7A03, 0xFF937E04, 0xFF807D01, 0xFF6B8100, 0xFF708704,
+	0xFF808801, 0xFF848B00, 0xFF739700, 0xFF649F00, 0xFF5F9F02, 0xFF4D9B04, 0xFF3E8D01, 0xFF417F00,
+	0xFF637700, 0xFF987D01, 0xFFA78806, 0xFF858F02, 0xFF698500, 0xFF5F6B00, 0xFF5B5A02, 0xFF475B00,
+	0xFF3F5A00, 0xFF585C02, 0xFF7E5404, 0xFF983F00, 0xFF923900, 0xFF7A3F00, 0xFF5C4C00, 0xFF555600,
+	0xFF675300, 0xFF7A4900, 0xFF6E4700, 0xFF4E5400, 0xFF586B00, 0xFF888605, 0xFFAA9F04, 0xFFAFAF00,
+	0xFFA8B602, 0xFF99AD04, 0xFF849A00, 0xFF6C7F00, 0xFF666700, 0xFF725B02, 0xFF7D6201, 0xFF7A7104,
+	0xFF6E7E04, 0xFF6F8104, 0xFF7B7F01, 0xFF907800, 0xFF956902, 0xFF775904, 0xFF595301, 0xFF5A5200,
+	0xFF795700, 0xFF8F5701, 0xFF8A5A00, 0xFF7B6D04, 0xFF749404, 0xFF6BB703, 0xFF55C301, 0xFF5CB200,
+	0xFF6BC100, 0xFF77A402, 0xFF5D7202, 0xFF3E3C02, 0xFF4E2600, 0xFF8A3601, 0xFFB45203, 0xFFB55604,
+	0xFFA15102, 0xFF894401, 0xFF753900, 0xFF563A06, 0xFF374804, 0xFF2B6501, 0xFF2C8303, 0xFF458A02,
+	0xFF806F06, 0xFFAC4C03, 0xFFA63800, 0xFF8A3300, 0xFF7A3601, 0xFF603B07, 0xFF474205, 0xFF3E4A02,
+	0xFF514F00, 0xFF705500, 0xFF7D5700, 0xFF715E00, 0xFF626100, 0xFF6C5D00, 0xFF7F5204, 0xFF824B02,
+	0xFF7C5600, 0xFF886903, 0xFF857005, 0xFF667401, 0xFF547B00, 0xFF697C00, 0xFF737F04, 0xFF667602,
+	0xFF596F00, 0xFF637702, 0xFF708E05, 0xFF6EA602, 0xFF5EAF01, 0xFF52A407, 0xFF4A8B02, 0xFF547500,
+	0xFF797503, 0xFFA08509, 0xFFAC8007, 0xFF8A5F00, 0xFF573E00, 0xFF423900, 0xFF4F5100, 0xFF6A7206,
+	0xFF7E8508, 0xFF918A02, 0xFF9B9000, 0xFF8C9E04, 0xFF679F02, 0xFF4B8300, 0xFF555A00, 0xFF6E3D04,
+	0xFF7D3804, 0xFF6F5400, 0xFF697C00, 0xFF6F9A05, 0xFF82A006, 0xFF859301, 0xFF6E8E03, 0xFF678A00,
+	0xFF7F8601, 0xFF8A8E03, 0xFF7E9603, 0xFF6B9A01, 0xFF5D9A01, 0xFF489504, 0xFF327F01, 0xFF336B00,
+	0xFF615D00, 0xFFA85A01, 0xFFBD6105, 0xFF956A03, 0xFF696601, 0xFF5F5702, 0xFF605604, 0xFF4C5B00,
+	0xFF3B6100, 0xFF4A6501, 0xFF666202, 0xFF805400, 0xFF8B4D00, 0xFF7D5400, 0xFF656400, 0xFF587302,
+	0xFF607A01, 0xFF6F7400, 0xFF6C7100, 0xFF718101, 0xFF88A207, 0xFFACB706, 0xFFB9B905, 0xFFACA909,
+	0xFF998B07, 0xFF837103, 0xFF686200, 0xFF5A5C04, 0xFF616003, 0xFF7E6E00, 0xFF8E7C02, 0xFF878406,
+	0xFF738002, 0xFF677500, 0xFF756501, 0xFF8A5A00, 0xFF8E5600, 0xFF745400, 0xFF586200, 0xFF667803,
+	0xFF878D02, 0xFF988C05, 0xFF937903, 0xFF907101, 0xFF988305, 0xFF8AA505, 0xFF58C302, 0xFF45C801,
+	0xFF50C504, 0xFF4DA703, 0xFF3D6702, 0xFF382C03, 0xFF5D1801, 0xFF9E2800, 0xFFC23902, 0xFFB33E04,
+	0xFF943905, 0xFF813100, 0xFF832E00, 0xFF793B03, 0xFF6D6108, 0xFF599008, 0xFF40A90A, 0xFF3D9D08,
+	0xFF6F7302, 0xFF9D4400, 0xFF9D2C00, 0xFF7E2300, 0xFF652701, 0xFF503304, 0xFF424304, 0xFF435402,
+	0xFF636200, 0xFF897001, 0xFF947903, 0xFF767F03, 0xFF558001, 0xFF5A7900, 0xFF736902, 0xFF7E5C01,
+	0xFF815D02, 0xFF8F6502, 0xFF866E00, 0xFF688001, 0xFF588904, 0xFF647E04, 0xFF666902, 0xFF5C4F00,
+	0xFF545200, 0xFF666701, 0xFF797B01, 0xFF718601, 0xFF5C8F01, 0xFF4D9701, 0xFF469700, 0xFF569101,
+	0xFF798300, 0xFF987704, 0xFF8B6209, 0xFF564000, 0xFF3A2D00, 0xFF3C3400, 0xFF504900, 0xFF706001,
+	0xFF807201, 0xFF867D00, 0xFF8E8400, 0xFF897F05, 0xFF617B02, 0xFF3D7C00, 0xFF587400, 0xFF8C7604,
+	0xFFAE7404, 0xFFA27603, 0xFF7A8300, 0xFF669303, 0xFF6D9B04, 0xFF718D01, 0xFF5E7B04, 0xFF5E7202,
+	0xFF7A7700, 0xFF948403, 0xFF8F8E03, 0xFF789400, 0xFF5C9402, 0xFF418904, 0xFF287701, 0xFF2E5D00,
+	0xFF674500, 0xFFB53F00, 0xFFCE4201, 0xFFA94A06, 0xFF784804, 0xFF614B01, 0xFF5E4F01, 0xFF505500,
+	0xFF426601, 0xFF4E7700, 0xFF647F00, 0xFF7D7C04, 0xFF897A06, 0xFF787B06, 0xFF5C8103, 0xFF4E9200,
+	0xFF5AA606, 0xFF70AC03, 0xFF7DAA02, 0xFF8FAE07, 0xFFA4BB09, 0xFFACB600, 0xFF9B9D03, 0xFF7E8105,
+	0xFF6E6204, 0xFF6E5300, 0xFF6A5A00, 0xFF726907, 0xFF7B7909, 0xFF7F8001, 0xFF7E7F03, 0xFF707602,
+	0xFF5E6700, 0xFF5C6400, 0xFF786403, 0xFF9C6901, 0xFFA07001, 0xFF8E7601, 0xFF778702, 0xFF7BA002,
+	0xFF8CAD06, 0xFF89A604, 0xFF7D8B02, 0xFF8B7300, 0xFFAC7601, 0xFFA09104, 0xFF70AF05, 0xFF4AC304,
+	0xFF388F03, 0xFF2D7204, 0xFF2D4B02, 0xFF403400, 0xFF703601, 0xFFB34500, 0xFFD14A00, 0xFFBF4A00,
+	0xFFA54B02, 0xFF924F00, 0xFF905300, 0xFF965200, 0xFF9A6804, 0xFF7E8905, 0xFF4E9606, 0xFF3E8B04,
+	0xFF617000, 0xFF904E01, 0xFF883D00, 0xFF6B3801, 0xFF553C00, 0xFF454B00, 0xFF4A6200, 0xFF588002,
+	0xFF739A03, 0xFF929F02, 0xFF979306, 0xFF6B800A, 0xFF3F7601, 0xFF437000, 0xFF636700, 0xFF756201,
+	0xFF825F05, 0xFF8E5F01, 0xFF8A6600, 0xFF727802, 0xFF608202, 0xFF4B7C01, 0xFF416300, 0xFF4C5100,
+	0xFF5F5600, 0xFF746904, 0xFF7B6702, 0xFF6B5F00, 0xFF616200, 0xFF5C7500, 0xFF578F02, 0xFF4F9B01,
+	0xFF648E00, 0xFF7C7200, 0xFF6A5700, 0xFF454600, 0xFF353F01, 0xFF3E4302, 0xFF604702, 0xFF815200,
+	0xFF8D6600, 0xFF8F7300, 0xFF896F01, 0xFF7C5C01, 0xFF585800, 0xFF3E7401, 0xFF629B02, 0xFF9AB20B,
+	0xFFAEAD06, 0xFF9E8A05, 0xFF817801, 0xFF6C7E00, 0xFF648601, 0xFF598501, 0xFF4E7600, 0xFF546F00,
+	0xFF797400, 0xFFA37602, 0xFFA17D02, 0xFF838400, 0xFF608501, 0xFF427C01, 0xFF237200, 0xFF315E00,
+	0xFF6E4D03, 0xFFB63F01, 0xFFD43300, 0xFFAC3700, 0xFF713B01, 0xFF554000, 0xFF524600, 0xFF505401,
+	0xFF507300, 0xFF628D00, 0xFF76A001, 0xFF87A208, 0xFF76A106, 0xFF579902, 0xFF429801, 0xFF42AB00,
+	0xFF5AC104, 0xFF77C904, 0xFF81C601, 0xFF8FBC02, 0xFF9FA603, 0xFF958700, 0xFF706E00, 0xFF576100,
+	0xFF545F00, 0xFF6E6401, 0xFF8B6E02, 0xFF987805, 0xFF8A7903, 0xFF677303, 0xFF526501, 0xFF4D5C00,
+	0xFF516400, 0xFF657F00, 0xFF8F9602, 0xFFB1A302, 0xFFABA502, 0xFF94A001, 0xFF859D01, 0xFF83A601,
+	0xFF7FA803, 0xFF6CA000, 0xFF619B00, 0xFF7D9200, 0xFFA98802, 0xFFA98407, 0xFF768601, 0xFF459201,
+	0xFF2D3F00, 0xFF253306, 0xFF3E3E05, 0xFF665600, 0xFF957501, 0xFFBA8905, 0xFFD28607, 0xFFD08105,
+	0xFFBF8102, 0xFF9D8000, 0xFF8E7101, 0xFF905600, 0xFF904D00, 0xFF7C5303, 0xFF525C02, 0xFF456600,
+	0xFF696601, 0xFF8B6105, 0xFF7A5B00, 0xFF625700, 0xFF5C6700, 0xFF568301, 0xFF5C9904, 0xFF64B501,
+	0xFF72BF05, 0xFF83A907, 0xFF768501, 0xFF4A6703, 0xFF265D03, 0xFF326000, 0xFF566200, 0xFF6C6400,
+	0xFF745F01, 0xFF815500, 0xFF924F01, 0xFF865803, 0xFF5C6401, 0xFF326600, 0xFF2D6500, 0xFF506E03,
+	0xFF767D01, 0xFF7E8002, 0xFF716B03, 0xFF5F5300, 0xFF664800, 0xFF745402, 0xFF6F7300, 0xFF588801,
+	0xFF588A02, 0xFF688000, 0xFF637200, 0xFF486A03, 0xFF376705, 0xFF456106, 0xFF735506, 0xFF9C5101,
+	0xFFA55900, 0xFF906200, 0xFF795902, 0xFF6A4200, 0xFF543F00, 0xFF485D00, 0xFF649002, 0xFF86AF0A,
+	0xFF8AA607, 0xFF7A8600, 0xFF777300, 0xFF7B7A00, 0xFF738901, 0xFF5F9401, 0xFF508E00, 0xFF558703,
+	0xFF737E02, 0xFF9C6B03, 0xFFAB6505, 0xFF8A6D01, 0xFF637300, 0xFF426F00, 0xFF2A6C00, 0xFF346E00,
+	0xFF647102, 0xFFA25C02, 0xFFC13F00, 0xFFA33200, 0xFF693C03, 0xFF444C04, 0xFF435801, 0xFF506900,
+	0xFF598400, 0xFF769A01, 0xFF8CA902, 0xFF8BAA01, 0xFF5FA600, 0xFF329D00, 0xFF2C9A01, 0xFF4AA600,
+	0xFF64B302, 0xFF73B402, 0xFF79AA00, 0xFF7B9300, 0xFF807701, 0xFF736400, 0xFF605F00, 0xFF536600,
+	0xFF557100, 0xFF767304, 0xFF9B6D04, 0xFFA16202, 0xFF795D01, 0xFF4C5E01, 0xFF3E6400, 0xFF587101,
+	0xFF6B8F01, 0xFF85B303, 0xFFA6CC05, 0xFFAACE04, 0xFF9CC002, 0xFF83AD00, 0xFF769C00, 0xFF768903,
+	0xFF6E7E01, 0xFF608500, 0xFF699A02, 0xFF85A800, 0xFF979A01, 0xFF926E05, 0xFF6D4E01, 0xFF414500,
+	0xFF242201, 0xFF333501, 0xFF5D6001, 0xFF938600, 0xFFB6A500, 0xFFB7BB03, 0xFFBCBA0B, 0xFFC0B408,
+	0xFFAFA302, 0xFF918505, 0xFF736101, 0xFF693D00, 0xFF6C2C00, 0xFF663200, 0xFF534300, 0xFF595E00,
+	0xFF797100, 0xFF7F7200, 0xFF6C7100, 0xFF677B01, 0xFF749400, 0xFF6FB300, 0xFF5EC403, 0xFF4FC601,
+	0xFF4EB805, 0xFF559204, 0xFF4C6700, 0xFF305500, 0xFF185E02, 0xFF2C6F01, 0xFF547101, 0xFF616800,
+	0xFF655C00, 0xFF755400, 0xFF904900, 0xFF8E4600, 0xFF5E4C02, 0xFF325400, 0xFF396300, 0xFF697C07,
+	0xFF8A9704, 0xFF809301, 0xFF5A7A04, 0xFF496301, 0xFF605500, 0xFF7D4C00, 0xFF7A5300, 0xFF696600,
+	0xFF707806, 0xFF6D8603, 0xFF638F00, 0xFF4B8B04, 0xFF3A8203, 0xFF497702, 0xFF816205, 0xFFAB5A02,
+	0xFFAB5901, 0xFF8C5F01, 0xFF745700, 0xFF644300, 0xFF543800, 0xFF573E03, 0xFF635702, 0xFF696800,
+	0xFF616701, 0xFF5D6601, 0xFF6E6F03, 0xFF8A8401, 0xFF8C9E04, 0xFF73AA03, 0xFF60A300, 0xFF599202,
+	0xFF617E02, 0xFF866700, 0xFFA55A00, 0xFF995F00, 0xFF6D6500, 0xFF476300, 0xFF336701, 0xFF357D01,
+	0xFF598C00, 0xFF847F00, 0xFF9D6004, 0xFF904101, 0xFF624501, 0xFF456304, 0xFF4C7A06, 0xFF538401,
+	0xFF568600, 0xFF759101, 0xFF989506, 0xFF8E9204, 0xFF538B00, 0xFF278500, 0xFF2F8B01, 0xFF508E00,
+	0xFF688B01, 0xFF6F8301, 0xFF6A7500, 0xFF686202, 0xFF675B02, 0xFF6B5E00, 0xFF6B6601, 0xFF5A7401,
+	0xFF517A00, 0xFF697100, 0xFF906100, 0xFF985A00, 0xFF6B6600, 0xFF487500, 0xFF4F9202, 0xFF7AAD05,
+	0xFF98C702, 0xFFA2D802, 0xFF98DE04, 0xFF8ED603, 0xFF7ABB03, 0xFF609B01, 0xFF567A02, 0xFF555F03,
+	0xFF5D5000, 0xFF785802, 0xFF8D7808, 0xFF8B9804, 0xFF748800, 0xFF5D5800, 0xFF493801, 0xFF352500,
+	0xFF225100, 0xFF4A6C01, 0xFF809203, 0xFFA3A407, 0xFFB4A303, 0xFFB0A400, 0xFFA5A600, 0xFF9A9D01,
+	0xFF848301, 0xFF6E6204, 0xFF554600, 0xFF503B01, 0xFF583B02, 0xFF644B00, 0xFF646905, 0xFF6B8506,
+	0xFF7A8C00, 0xFF717E00, 0xFF697600, 0xFF7E8901, 0xFF95A903, 0xFF86BC02, 0xFF5DB800, 0xFF35AC03,
+	0xFF2B9700, 0xFF357600, 0xFF425D01, 0xFF436002, 0xFF308100, 0xFF329903, 0xFF4B9201, 0xFF4F7C01,
+	0xFF546B00, 0xFF6E6602, 0xFF876502, 0xFF865E05, 0xFF635104, 0xFF394F05, 0xFF425901, 0xFF7A6900,
+	0xFF917B05, 0xFF738105, 0xFF4A7501, 0xFF3E6E00, 0xFF4B6D00, 0xFF666101, 0xFF775300, 0xFF7E5000,
+	0xFF846104, 0xFF7D7506, 0xFF638401, 0xFF428800, 0xFF398000, 0xFF4E7900, 0xFF7F6C04, 0xFFA66301,
+	0xFFAE6601, 0xFF917200, 0xFF7B6F01, 0xFF676202, 0xFF5A5001, 0xFF5E3801, 0xFF5F2F00, 0xFF592F00,
+	0xFF523900, 0xFF555503, 0xFF717307, 0xFF938901, 0xFF989B01, 0xFF7D9F01, 0xFF649800, 0xFF4D8A02,
+	0xFF4B7B02, 0xFF6F7300, 0xFF9A6B00, 0xFF986402, 0xFF6D5E04, 0xFF4C5A00, 0xFF486501, 0xFF4D8201,
+	0xFF579801, 0xFF739305, 0xFF877709, 0xFF7B5201, 0xFF5A4D00, 0xFF4F6C00, 0xFF5C8701, 0xFF568C00,
+	0xFF528600, 0xFF698201, 0xFF8E7E02, 0xFF8B7700, 0xFF616D00, 0xFF3C6E02, 0xFF387800, 0xFF4F7A00,
+	0xFF5E7300, 0xFF666901, 0xFF625904, 0xFF585202, 0xFF5A5502, 0xFF715D00, 0xFF756801, 0xFF5A7202,
+	0xFF4A7500, 0xFF5D7500, 0xFF8F7900, 0xFFA58100, 0xFF849502, 0xFF62B106, 0xFF6AC803, 0xFF8FD301,
+	0xFFA9D302, 0xFFA2C804, 0xFF85BB00, 0xFF68AE00, 0xFF4C9401, 0xFF387600, 0xFF395801, 0xFF475001,
+	0xFF604600, 0xFF8D4302, 0xFFA05003, 0xFF8F5C03, 0xFF655A00, 0xFF415200, 0xFF314A03, 0xFF264902,
+	0xFF3E8E00, 0xFF67A404, 0xFF8CAA07, 0xFF8F9308, 0xFF937505, 0xFFA55F00, 0xFF995D00, 0xFF6D5A00,
+	0xFF535500, 0xFF515300, 0xFF595B01, 0xFF646B00, 0xFF6C7B03, 0xFF768C03, 0xFF789E05, 0xFF6FAC03,
+	0xFF61A301, 0xFF528D01, 0xFF668100, 0xFF948600, 0xFFAE8F05, 0xFF8D9302, 0xFF599101, 0xFF309305,
+	0xFF268E00, 0xFF3A7B00, 0xFF587B00, 0xFF6C8903, 0xFF5FA300, 0xFF4DAE00, 0xFF3DA404, 0xFF3C8E05,
+	0xFF4B7F01, 0xFF6A7B02, 0xFF837B02, 0xFF796F03, 0xFF535703, 0xFF384503, 0xFF4C4102, 0xFF834C01,
+	0xFF945403, 0xFF745801, 0xFF4B6000, 0xFF357100, 0xFF3B7D04, 0xFF4E7406, 0xFF5D6302, 0xFF7F4C01,
+	0xFF8B4802, 0xFF7B5203, 0xFF5E5F01, 0xFF3C6F00, 0xFF3C7C00, 0xFF568503, 0xFF718703, 0xFF947D00,
+	0xFFA97B02, 0xFF9C7F01, 0xFF818001, 0xFF6C7E05, 0xFF627103, 0xFF5D5200, 0xFF5F3501, 0xFF5E3100,
+	0xFF644C00, 0xFF696C00, 0xFF737D01, 0xFF847B03, 0xFF7E7801, 0xFF777800, 0xFF657900, 0xFF537B00,
+	0xFF508300, 0xFF6B8E00, 0xFF878902, 0xFF7C7704, 0xFF5C5E04, 0xFF575400, 0xFF6D6600, 0xFF768302,
+	0xFF6C9805, 0xFF6A9807, 0xFF6C7D05, 0xFF615C00, 0xFF505200, 0xFF5B6300, 0xFF6C7B00, 0xFF5F8400,
+	0xFF528300, 0xFF5C7E00, 0xFF787803, 0xFF8D6801, 0xFF785E01, 0xFF5B6505, 0xFF506C02, 0xFF4E6D00,
+	0xFF546700, 0xFF5D5D02, 0xFF535303, 0xFF474C00, 0xFF4F4E00, 0xFF6E5700, 0xFF786501, 0xFF5C7100,
+	0xFF4C8200, 0xFF699900, 0xFFA8AD04, 0xFFC3B704, 0xFFACBF03, 0xFF81CE04, 0xFF71D001, 0xFF84C408,
+	0xFF96A905, 0xFF888C03, 0xFF6B7802, 0xFF476800, 0xFF2F5600, 0xFF234601, 0xFF354B04, 0xFF586600,
+	0xFF6E7200, 0xFF856000, 0xFF944501, 0xFF933100, 0xFF764101, 0xFF545C00, 0xFF3E6F00, 0xFF367E05,
+	0xFF659206, 0xFF7D9D04, 0xFF7C8D03, 0xFF6C6C00, 0xFF765100, 0xFF973A01, 0xFF913401, 0xFF633C00,
+	0xFF4F5500, 0xFF627D00, 0xFF789B06, 0xFF7EA103, 0xFF7FA301, 0xFF85A402, 0xFF84A706, 0xFF66AB05,
+	0xFF42A501, 0xFF399C00, 0xFF5A9201, 0xFF938400, 0xFFA07200, 0xFF826500, 0xFF656E00, 0xFF518F01,
+	0xFF4BA006, 0xFF50A106, 0xFF6FA201, 0xFF8B9E02, 0xFF7A9C02, 0xFF5A9203, 0xFF398508, 0xFF2F7802,
+	0xFF4F6D00, 0xFF746B00, 0xFF7E6900, 0xFF656000, 0xFF3C4B00, 0xFF313F00, 0xFF523F00, 0xFF824C04,
+	0xFF915503, 0xFF7D5701, 0xFF555B01, 0xFF3D6900, 0xFF397001, 0xFF3A7303, 0xFF446901, 0xFF6F5100,
+	0xFF854400, 0xFF744304, 0xFF5C4701, 0xFF485A00, 0xFF537604, 0xFF699007, 0xFF739E01, 0xFF869F01,
+	0xFF929204, 0xFF917E04, 0xFF7A7501, 0xFF6C7601, 0xFF6E7901, 0xFF5F7200, 0xFF656000, 0xFF7F6305,
+	0xFF808202, 0xFF6C8D02, 0xFF5F7903, 0xFF665A02, 0xFF624E02, 0xFF715100, 0xFF756400, 0xFF6D7A00,
+	0xFF689002, 0xFF709C06, 0xFF729002, 0xFF667000, 0xFF5D5A01, 0xFF6E5702, 0xFF8B6201, 0xFF987205,
+	0xFF8C7E06, 0xFF778202, 0xFF617801, 0xFF516800, 0xFF506300, 0xFF6A6902, 0xFF7A7601, 0xFF6C7D00,
+	0xFF528401, 0xFF508101, 0xFF657401, 0xFF816301, 0xFF835D00, 0xFF706202, 0xFF576301, 0xFF405F01,
+	0xFF425801, 0xFF4E5102, 0xFF4A5001, 0xFF495101, 0xFF565B02, 0xFF736E03, 0xFF817C01, 0xFF698B01,
+	0xFF599C04, 0xFF71B004, 0xFFB3B704, 0xFFCAB708, 0xFFB3AF00, 0xFF84A700, 0xFF639E03, 0xFF5D8D05,
+	0xFF6B7201, 0xFF665B00, 0xFF4F4801, 0xFF373501, 0xFF2B2800, 0xFF312E00, 0xFF4E5103, 0xFF758207,
+	0xFF7D9B02, 0xFF6F8D00, 0xFF756004, 0xFF8E4400, 0xFF914F01, 0xFF6E6C02, 0xFF4F7700, 0xFF4B8103,
+	0xFF7B5F07, 0xFF8D5F01, 0xFF775900, 0xFF595500, 0xFF6F5801, 0xFF9B5104, 0xFF944A01, 0xFF6F5A00,
+	0xFF6C8602, 0xFF84B402, 0xFF8AC305, 0xFF78AE03, 0xFF769200, 0xFF8C8202, 0xFF8F8404, 0xFF658901,
+	0xFF399400, 0xFF38A000, 0xFF54A503, 0xFF7C9101, 0xFF786F00, 0xFF725600, 0xFF7F5F00, 0xFF8E8702,
+	0xFF81AE07, 0xFF62B808, 0xFF63A208, 0xFF768503, 0xFF716C02, 0xFF4F5B01, 0xFF335300, 0xFF315100,
+	0xFF584F01, 0xFF855203, 0xFF825502, 0xFF544F00, 0xFF393E00, 0xFF403B00, 0xFF654D00, 0xFF846804,
+	0xFF8F7302, 0xFF7C7001, 0xFF5D6005, 0xFF4D5501, 0xFF405400, 0xFF3F6000, 0xFF4D7400, 0xFF647C02,
+	0xFF717202, 0xFF725902, 0xFF634400, 0xFF5C4600, 0xFF6A5E02, 0xFF7F8004, 0xFF78A101, 0xFF6EAD03,
+	0xFF709D02, 0xFF6D7C01, 0xFF6E6002, 0xFF765C00, 0xFF777400, 0xFF6E8C00, 0xFF7A9502, 0xFF989C05,
+	0xFF86A104, 0xFF538304, 0xFF3E5A03, 0xFF4C3D00, 0xFF633404, 0xFF7D4003, 0xFF8C5900, 0xFF8C7100,
+	0xFF808602, 0xFF6C9103, 0xFF648001, 0xFF606600, 0xFF6E5B00, 0xFF885E00, 0xFF985D01, 0xFF9A5901,
+	0xFF975701, 0xFF895C00, 0xFF696D01, 0xFF527D02, 0xFF578401, 0xFF708204, 0xFF7B7A03, 0xFF6C7901,
+	0xFF4F7B05, 0xFF447503, 0xFF4D6600, 0xFF705B00, 0xFF895700, 0xFF755B00, 0xFF4D5B00, 0xFF375E00,
+	0xFF3A6300, 0xFF4F6500, 0xFF5B6C00, 0xFF647603, 0xFF728A03, 0xFF85A002, 0xFF8AA401, 0xFF67A201,
+	0xFF4E9A09, 0xFF6A9303, 0xFF9E8302, 0xFFAF7B05, 0xFF947400, 0xFF6A6D00, 0xFF556203, 0xFF565800,
+	0xFF5F5500, 0xFF585900, 0xFF4C5000, 0xFF3D3800, 0xFF372800, 0xFF422F02, 0xFF615205, 0xFF857605,
+	0xFF8A9103, 0xFF6A9C00, 0xFF688A01, 0xFF8D7803, 0xFF9F7403, 0xFF827301, 0xFF5D6600, 0xFF615900,
+	0xFF723703, 0xFF953600, 0xFF834D00, 0xFF736E00, 0xFF838403, 0xFF9C8406, 0xFF9B7D01, 0xFF888801,
+	0xFF8FA80A, 0xFF97BE0B, 0xFF87B001, 0xFF5F9100, 0xFF607900, 0xFF897100, 0xFF8F7200, 0xFF6B7200,
+	0xFF557F00, 0xFF59A100, 0xFF62B900, 0xFF66AC06, 0xFF588204, 0xFF655A01, 0xFF975601, 0xFFB37000,
+	0xFF978B00, 0xFF5E8E01, 0xFF437707, 0xFF495900, 0xFF5A4900, 0xFF514B00, 0xFF3A5500, 0xFF3F5C00,
+	0xFF685D04, 0xFF965808, 0xFF8A5501, 0xFF514C02, 0xFF3B3D03, 0xFF5E3F02, 0xFF825B02, 0xFF887501,
+	0xFF817B00, 0xFF6A6E02, 0xFF555503, 0xFF494300, 0xFF4A4800, 0xFF595F00, 0xFF638B01, 0xFF6DB109,
+	0xFF74AE0A, 0xFF698302, 0xFF595A00, 0xFF614600, 0xFF8D4501, 0xFF9A6200, 0xFF838400, 0xFF6A9602,
+	0xFF5E9200, 0xFF5D7B00, 0xFF676402, 0xFF7D6500, 0xFF897C01, 0xFF909B00, 0xFF97AE01, 0xFF94A902,
+	0xFF6E8A03, 0xFF355E04, 0xFF273802, 0xFF453000, 0xFF703B01, 0xFF914901, 0xFFA55702, 0xFFA85F02,
+	0xFF8D6900, 0xFF6D7400, 0xFF5F7603, 0xFF637600, 0xFF7B7804, 0xFF917004, 0xFF885F00, 0xFF804700,
+	0xFF883A00, 0xFF944600, 0xFF866302, 0xFF6A8208, 0xFF608C04, 0xFF638602, 0xFF637405, 0xFF586701,
+	0xFF4D6500, 0xFF416700, 0xFF446401, 0xFF686000, 0xFF876101, 0xFF746301, 0xFF506601, 0xFF3B7601,
+	0xFF4B8702, 0xFF708E01, 0xFF859A00, 0xFF99A405, 0xFF9DAC09, 0xFF88AC04, 0xFF69A001, 0xFF468601,
+	0xFF3B6800, 0xFF635700, 0xFF8D5000, 0xFF984C00, 0xFF715400, 0xFF4A5801, 0xFF485305, 0xFF675901,
+	0xFF7B6600, 0xFF6D7402, 0xFF527103, 0xFF4A5402, 0xFF474300, 0xFF454401, 0xFF574601, 0xFF7B4A00,
+	0xFF825F01, 0xFF708701, 0xFF64A400, 0xFF839F02, 0xFFA18A03, 0xFF8B7201, 0xFF5A5C00, 0xFF534802,
+	0xFF664300, 0xFF9A5102, 0xFFA67A01, 0xFF9B9F02, 0xFF90B103, 0xFF92AA03, 0xFF939A00, 0xFF999600,
+	0xFFA19B02, 0xFF979B05, 0xFF708801, 0xFF517C00, 0xFF5C8301, 0xFF7D8504, 0xFF7F7A00, 0xFF736C00,
+	0xFF777801, 0xFF84A002, 0xFF88B903, 0xFF68AF07, 0xFF468903, 0xFF556000, 0xFF964F01, 0xFFBD5101,
+	0xFF985401, 0xFF545100, 0xFF354C00, 0xFF484801, 0xFF665900, 0xFF6A7002, 0xFF518500, 0xFF4D8700,
+	0xFF6D7C03, 0xFF926802, 0xFF845100, 0xFF4D4402, 0xFF463F01, 0xFF764601, 0xFF9F5602, 0xFF976200,
+	0xFF6F6301, 0xFF505901, 0xFF434F01, 0xFF444A00, 0xFF5D4F00, 0xFF766600, 0xFF769702, 0xFF7BC008,
+	0xFF74C505, 0xFF4FAF02, 0xFF418801, 0xFF646900, 0xFFA25800, 0xFFB35A00, 0xFF916300, 0xFF746A00,
+	0xFF657000, 0xFF5A7601, 0xFF637A00, 0xFF7D8100, 0xFF9C8B06, 0xFFB49205, 0xFFA48F00, 0xFF757F02,
+	0xFF415D00, 0xFF1D4401, 0xFF2A3B00, 0xFF5C4B01, 0xFF816600, 0xFFA27400, 0xFFB57202, 0xFFAF6601,
+	0xFF935901, 0xFF6F5B00, 0xFF606E00, 0xFF728502, 0xFF7F9407, 0xFF748B03, 0xFF586A02, 0xFF4C4800,
+	0xFF713A00, 0xFFA34400, 0xFFAE5400, 0xFF8A6503, 0xFF626902, 0xFF456600, 0xFF465E01, 0xFF4C5A00,
+	0xFF4E6400, 0xFF4A7203, 0xFF487D01, 0xFF5E8501, 0xFF7B8600, 0xFF7D7F00, 0xFF697F03, 0xFF559203,
+	0xFF63A103, 0xFF8CA603, 0xFFA89E04, 0xFFB29903, 0xFFA59504, 0xFF747F07, 0xFF396800, 0xFF245500,
+	0xFF3A4700, 0xFF714500, 0xFFA05002, 0xFF945903, 0xFF5C6200, 0xFF366A00, 0xFF4A7600, 0xFF878000,
+	0xFF9E8B02, 0xFF828A03, 0xFF547504, 0xFF4E5D03, 0xFF555801, 0xFF515800, 0xFF494800, 0xFF603203,
+	0xFF823401, 0xFF835F00, 0xFF788B05, 0xFF7D9205, 0xFF957E02, 0xFF876C02, 0xFF506200, 0xFF3F5203,
+	0xFF667201, 0xFFA58E02, 0xFFC2B005, 0xFFA9C405, 0xFF92C601, 0xFF84BB03, 0xFF7DA401, 0xFF8C9000,
+	0xFF958800, 0xFF878000, 0xFF627900, 0xFF578401, 0xFF669708, 0xFF679807, 0xFF617E05, 0xFF6F6701,
+	0xFF916B04, 0xFFA58605, 0xFF919403, 0xFF588700, 0xFF3A7200, 0xFF576200, 0xFF965B00, 0xFFB05A01,
+	0xFF845703, 0xFF4A5400, 0xFF425800, 0xFF696A03, 0xFF8B8107, 0xFF898F03, 0xFF679202, 0xFF448903,
+	0xFF537503, 0xFF715A00, 0xFF6E3C00, 0xFF523700, 0xFF5F4100, 0xFF925100, 0xFFB15302, 0xFF9D5001,
+	0xFF655201, 0xFF3E5900, 0xFF336101, 0xFF436E00, 0xFF627100, 0xFF876D03, 0xFF908803, 0xFF88AC01,
+	0xFF73B400, 0xFF48AF00, 0xFF3BA701, 0xFF6A9503, 0xFF9D8405, 0xFFA87301, 0xFF906500, 0xFF805700,
+	0xFF785101, 0xFF705C03, 0xFF716E01, 0xFF7F8101, 0xFF968001, 0xFFA26C04, 0xFF825503, 0xFF464400,
+	0xFF204300, 0xFF1F5203, 0xFF406A02, 0xFF7C8504, 0xFFA0A203, 0xFFABB004, 0xFFA7A502, 0xFF918403,
+	0xFF7C5C01, 0xFF6A4A00, 0xFF675901, 0xFF7A7503, 0xFF778807, 0xFF567F01, 0xFF326801, 0xFF2E5E00,
+	0xFF615C01, 0xFF9B6000, 0xFFB55700, 0xFF994B00, 0xFF5D4100, 0xFF314400, 0xFF374E00, 0xFF5C5701,
+	0xFF6E6F02, 0xFF658703, 0xFF569503, 0xFF589A04, 0xFF689501, 0xFF798500, 0xFF7C7B04, 0xFF728302,
+	0xFF708700, 0xFF808000, 0xFF936B02, 0xFF9D5D00, 0xFF885A00, 0xFF4E5301, 0xFF214C00, 0xFF254E00,
+	0xFF555802, 0xFF8C6904, 0xFFAC7102, 0xFF8F6E07, 0xFF546E01, 0xFF407701, 0xFF6F8F03, 0xFFAAA306,
+	0xFFAE9E04, 0xFF797D02, 0xFF4D5B00, 0xFF585200, 0xFF6A6304, 0xFF5E7103, 0xFF3E6700, 0xFF4A4B01,
+	0xFF7C3600, 0xFF8E4000, 0xFF7C5A03, 0xFF795E03, 0xFF925804, 0xFF885A00, 0xFF526200, 0xFF3C6901,
+	0xFF67A200, 0xFFA7BC00, 0xFFC3CC03, 0xFFA5D403, 0xFF8ACE00, 0xFF71BD03, 0xFF5EA602, 0xFF669200,
+	0xFF6D8A03, 0xFF658101, 0xFF597B00, 0xFF598504, 0xFF5B8A05, 0xFF4D7C01, 0xFF435D02, 0xFF5A4D00,
+	0xFF965203, 0xFFA65F02, 0xFF786100, 0xFF445B02, 0xFF456003, 0xFF757200, 0xFF9C8B01, 0xFF8F9604,
+	0xFF628C03, 0xFF438301, 0xFF4F8502, 0xFF7D8B03, 0xFF958805, 0xFF8F7505, 0xFF636802, 0xFF336301,
+	0xFF2E5601, 0xFF474601, 0xFF5F3A02, 0xFF764300, 0xFF8C5702, 0xFFAC5D03, 0xFFB65604, 0xFF9C5001,
+	0xFF6E5B00, 0xFF467300, 0xFF399200, 0xFF47A500, 0xFF569D00, 0xFF798C04, 0xFF948801, 0xFF998F00,
+	0xFF828F00, 0xFF588A01, 0xFF3E9200, 0xFF5C9903, 0xFF848F04, 0xFF937E01, 0xFF8D6F00, 0xFF805F01,
+	0xFF834E02, 0xFF8A4500, 0xFF854E00, 0xFF796200, 0xFF7B6200, 0xFF774800, 0xFF552F00, 0xFF2D2500,
+	0xFF254400, 0xFF387A00, 0xFF5AA204, 0xFF90B803, 0xFFAFC803, 0xFFAACC05, 0xFF87BB02, 0xFF5E9202,
+	0xFF496704, 0xFF544504, 0xFF6B4003, 0xFF774F01, 0xFF6B5A02, 0xFF4A5B01, 0xFF326400, 0xFF407805,
+	0xFF608908, 0xFF878702, 0xFF9F6F02, 0xFF9A4E01, 0xFF6A3B00, 0xFF3D3E00, 0xFF444500, 0xFF704F02,
+	0xFF8D6404, 0xFF827A02, 0xFF698105, 0xFF538503, 0xFF578001, 0xFF677300, 0xFF706702, 0xFF6D5D01,
+	0xFF5B5001, 0xFF573E00, 0xFF6B2B02, 0xFF802804, 0xFF733E00, 0xFF4C5C00, 0xFF2C7200, 0xFF397F04,
+	0xFF6A840A, 0xFF918405, 0xFF9A7701, 0xFF766A01, 0xFF546900, 0xFF617504, 0xFF908F06, 0xFFB39B06,
+	0xFF9A8702, 0xFF5D5C01, 0xFF4A4300, 0xFF6D4B00, 0xFF877004, 0xFF628E05, 0xFF289200, 0xFF347801,
+	0xFF715703, 0xFF8B3A00, 0xFF7B3800, 0xFF773D00, 0xFF934300, 0xFF8F5000, 0xFF576600, 0xFF4A8203,
+	0xFF72B402, 0xFFAFCB05, 0xFFC1CF02, 0xFFA2C804, 0xFF7BB704, 0xFF5AA100, 0xFF439000, 0xFF438500,
+	0xFF4B8100, 0xFF487A00, 0xFF436E01, 0xFF456A03, 0xFF3C5E02, 0xFF2F4A00, 0xFF3B3900, 0xFF603E00,
+	0xFF8D5001, 0xFF8F5701, 0xFF5D5800, 0xFF455A00, 0xFF647502, 0xFF989607, 0xFFA7AE09, 0xFF78AE09,
+	0xFF44A002, 0xFF348E00, 0xFF498502, 0xFF677801, 0xFF766800, 0xFF7A5405, 0xFF674E03, 0xFF3E5400,
+	0xFF275700, 0xFF346000, 0xFF696A02, 0xFF9C7903, 0xFFAC7D01, 0xFFA77305, 0xFFA86602, 0xFF9C6200,
+	0xFF867000, 0xFF659804, 0xFF59B904, 0xFF52C305, 0xFF51BE06, 0xFF67AE01, 0xFF889A02, 0xFF967E04,
+	0xFF7B6800, 0xFF4E5A00, 0xFF305C02, 0xFF466700, 0xFF6C6600, 0xFF8D6500, 0xFF8D7001, 0xFF7E7302,
+	0xFF826501, 0xFF8A5200, 0xFF864B00, 0xFF795000, 0xFF6F5700, 0xFF5E5102, 0xFF473E01, 0xFF403400,
+	0xFF4E5600, 0xFF5B9002, 0xFF6FB106, 0xFF91BD01, 0xFFA2BB01, 0xFF8FA702, 0xFF5B9002, 0xFF327A00,
+	0xFF296002, 0xFF3D4F01, 0xFF644000, 0xFF743A00, 0xFF6C3E00, 0xFF544E00, 0xFF556902, 0xFF6A8604,
+	0xFF709C06, 0xFF709D06, 0xFF7C8906, 0xFF886004, 0xFF774000, 0xFF563B00, 0xFF563B00, 0xFF793D00,
+	0xFFA04601, 0xFF985500, 0xFF7A5F00, 0xFF5D6601, 0xFF516805, 0xFF546601, 0xFF5D5F00, 0xFF564C01,
+	0xFF3F3000, 0xFF301B01, 0xFF441605, 0xFF762802, 0xFF875903, 0xFF708905, 0xFF41A501, 0xFF3CA102,
+	0xFF628401, 0xFF856B00, 0xFF865E00, 0xFF6B6200, 0xFF616B00, 0xFF717601, 0xFF8D7A01, 0xFF936D00,
+	0xFF705900, 0xFF4C4A00, 0xFF584E02, 0xFF896800, 0xFF9C8C03, 0xFF6EA406, 0xFF28A902, 0xFF2B9B01,
+	0xFF5E8203, 0xFF7D5E01, 0xFF7C4900, 0xFF7C4D00, 0xFF9B5300, 0xFF975E02, 0xFF5C7601, 0xFF489B05,
+	0xFF79B502, 0xFFAEC305, 0xFFB1BD03, 0xFF8DA804, 0xFF618105, 0xFF3D6300, 0xFF306000, 0xFF3A6003,
+	0xFF496104, 0xFF445D02, 0xFF335402, 0xFF2D5102, 0xFF2A4901, 0xFF2D4700, 0xFF4F4D03, 0xFF815B06,
+	0xFF9E6D03, 0xFF7F7700, 0xFF527C00, 0xFF5B7B01, 0xFF908D03, 0xFFB09E06, 0xFF9B9B05, 0xFF5E8702,
+	0xFF307600, 0xFF2A6A00, 0xFF3B6100, 0xFF485800, 0xFF5F5200, 0xFF7C5D00, 0xFF836900, 0xFF5B7600,
+	0xFF318800, 0xFF429E00, 0xFF7EAD05, 0xFFA7B105, 0xFFAAA200, 0xFF969102, 0xFF908400, 0xFF9E8000,
+	0xFFA38C00, 0xFF8BA303, 0xFF6EB304, 0xFF60B806, 0xFF58B804, 0xFF54B200, 0xFF6A9705, 0xFF766B05,
+	0xFF594703, 0xFF343802, 0xFF263802, 0xFF3B3F00, 0xFF6D4900, 0xFF995600, 0xFF9F6A02, 0xFF8D7604,
+	0xFF817E03, 0xFF857701, 0xFF826C04, 0xFF776B02, 0xFF6E7000, 0xFF5F7005, 0xFF4E6902, 0xFF516700,
+	0xFF6D7500, 0xFF7F8B06, 0xFF789602, 0xFF7E8D02, 0xFF7E7809, 0xFF665C03, 0xFF3D4800, 0xFF204902,
+	0xFF215200, 0xFF3C5A00, 0xFF605C00, 0xFF735300, 0xFF6D5101, 0xFF685300, 0xFF775F04, 0xFF8A7302,
+	0xFF838501, 0xFF619602, 0xFF528C01, 0xFF616501, 0xFF6D4200, 0xFF663904, 0xFF5E3C03, 0xFF784001,
+	0xFFA34603, 0xFFAC5102, 0xFF8E5E00, 0xFF6B6303, 0xFF536103, 0xFF4F5F00, 0xFF505D01, 0xFF455200,
+	0xFF2D3D00, 0xFF1E3101, 0xFF3F4100, 0xFF876301, 0xFFAE8D03, 0xFF97AE04, 0xFF59AC01, 0xFF388702,
+	0xFF4F5E00, 0xFF824D00, 0xFF985606, 0xFF856804, 0xFF6C7300, 0xFF656C03, 0xFF685D05, 0xFF664A00,
+	0xFF5D4900, 0xFF5C5D00, 0xFF7E8002, 0xFFAC9801, 0xFFAAA403, 0xFF73A801, 0xFF2CA903, 0xFF1FAF01,
+	0xFF46A801, 0xFF679402, 0xFF697800, 0xFF7C6700, 0xFFA15F03, 0xFF9E6807, 0xFF668301, 0xFF4CA700,
+	0xFF84AB02, 0xFF95AB00, 0xFF849303, 0xFF637102, 0xFF404D01, 0xFF2D3E00, 0xFF364500, 0xFF575200,
+	0xFF675503, 0xFF575603, 0xFF405D01, 0xFF396800, 0xFF357400, 0xFF408304, 0xFF698C05, 0xFF9E8904,
+	0xFFAF8402, 0xFF858101, 0xFF578100, 0xFF638202, 0xFF9C7C04, 0xFFA87401, 0xFF775F00, 0xFF475300,
+	0xFF395602, 0xFF476100, 0xFF486500, 0xFF446401, 0xFF616D00, 0xFF957E01, 0xFFA48A08, 0xFF709E05,
+	0xFF37BB01, 0xFF4DD000, 0xFF88D303, 0xFFA5C604, 0xFFA6B503, 0xFF96AB00, 0xFF91A301, 0xFFA29607,
+	0xFFA28D03, 0xFF908800, 0xFF7A8104, 0xFF658001, 0xFF538400, 0xFF3F8300, 0xFF446902, 0xFF4D4201,
+	0xFF3B2E01, 0xFF2D2C01, 0xFF333B02, 0xFF4D5800, 0xFF806D03, 0xFFA07003, 0xFFA96900, 0xFF996B00,
+	0xFF907C03, 0xFF8B9002, 0xFF839404, 0xFF788E06, 0xFF778601, 0xFF717C03, 0xFF547B01, 0xFF598101,
+	0xFF7F8207, 0xFF837E04, 0xFF757400, 0xFF665E01, 0xFF564605, 0xFF462E02, 0xFF381D00, 0xFF252801,
+	0xFF2D3F01, 0xFF475C00, 0xFF6B7602, 0xFF7B7804, 0xFF677100, 0xFF616002, 0xFF7D5301, 0xFFA04E01,
+	0xFF9A5B01, 0xFF657200, 0xFF456E00, 0xFF4D5E00, 0xFF694F01, 0xFF705204, 0xFF5E6102, 0xFF726A01,
+	0xFFA26F04, 0xFFB47B02, 0xFF977D01, 0xFF647004, 0xFF475C01, 0xFF524801, 0xFF624B01, 0xFF575A00,
+	0xFF3C6703, 0xFF387302, 0xFF698804, 0xFFAB9A04, 0xFFBCA203, 0xFF959803, 0xFF557901, 0xFF2A6001,
+	0xFF415602, 0xFF8A6300, 0xFFAE7308, 0xFF917406, 0xFF5C6C01, 0xFF4C5F00, 0xFF565902, 0xFF585D01,
+	0xFF676A05, 0xFF827E03, 0xFFA89B02, 0xFFC4A409, 0xFFB39C06, 0xFF729300, 0xFF2DA200, 0xFF21B500,
+	0xFF3AB903, 0xFF4CA701, 0xFF537F01, 0xFF705D00, 0xFF984C02, 0xFFA54F01, 0xFF817200, 0xFF6D9E00,
+	0xFF8B9C02, 0xFF6C8801, 0xFF566202, 0xFF454D01, 0xFF3E4B01, 0xFF3F4E02, 0xFF5B5702, 0xFF816B02,
+	0xFF857400, 0xFF747800, 0xFF638300, 0xFF5E9B00, 0xFF54B203, 0xFF53B807, 0xFF68AC01, 0xFF8F8F04,
+	0xFFA27202, 0xFF8D5E00, 0xFF645D00, 0xFF656201, 0xFF805802, 0xFF7E4501, 0xFF5D3E03, 0xFF4B4D00,
+	0xFF5F6F02, 0xFF778D06, 0xFF669F00, 0xFF48A600, 0xFF69A300, 0xFFAB9800, 0xFFB29605, 0xFF74A404,
+	0xFF3DBF02, 0xFF4DCF03, 0xFF72C905, 0xFF8ABA03, 0xFF9BAE00, 0xFF9CAF00, 0xFF969F06, 0xFF8D8007,
+	0xFF846402, 0xFF845000, 0xFF7C3F04, 0xFF653A00, 0xFF553F00, 0xFF464500, 0xFF374500, 0xFF313502,
+	0xFF332A00, 0xFF3B3603, 0xFF525E01, 0xFF759100, 0xFF8BA604, 0xFF909208, 0xFF897102, 0xFF915F00,
+	0xFFA56802, 0xFFA38D05, 0xFF8DA101, 0xFF7A9702, 0xFF728200, 0xFF697000, 0xFF536C00, 0xFF5C7400,
+	0xFF7D7D03, 0xFF7A7801, 0xFF6A6401, 0xFF584E00, 0xFF4B3F00, 0xFF453000, 0xFF422101, 0xFF3F1E00,
+	0xFF4A2B00, 0xFF684F00, 0xFF8A7204, 0xFF858009, 0xFF5E7E01, 0xFF4F6E02, 0xFF675E02, 0xFF984700,
+	0xFF9D4302, 0xFF7C4C01, 0xFF605800, 0xFF5D6400, 0xFF746F00, 0xFF6F8203, 0xFF5A8E01, 0xFF6E9300,
+	0xFFA59401, 0xFFB39D00, 0xFF8A9A04, 0xFF4E8301, 0xFF336100, 0xFF564200, 0xFF814300, 0xFF7D6200,
+	0xFF608703, 0xFF629F03, 0xFF8DA706, 0xFFB29706, 0xFF9C7C04, 0xFF685901, 0xFF414202, 0xFF355400,
+	0xFF5A8000, 0xFF94A300, 0xFFA5A001, 0xFF798203, 0xFF4C6C01, 0xFF4C6B01, 0xFF677900, 0xFF738802,
+	0xFF788B05, 0xFF8A8601, 0xFFB27803, 0xFFC67006, 0xFFAF6901, 0xFF7C6F00, 0xFF449000, 0xFF23AF04,
+	0xFF26B408, 0xFF309501, 0xFF3E6101, 0xFF624100, 0xFF953400, 0xFFB34300, 0xFFA66B02, 0xFF939604,
+	0xFF728B04, 0xFF456C00, 0xFF3E5901, 0xFF536300, 0xFF627103, 0xFF607B08, 0xFF768301, 0xFF938904,
+	0xFF949307, 0xFF869903, 0xFF7F9F04, 0xFF7BAA03, 0xFF6CB201, 0xFF4DA901, 0xFF448C03, 0xFF626D03,
+	0xFF7E5B01, 0xFF845400, 0xFF745601, 0xFF654E03, 0xFF6A4100, 0xFF6A4000, 0xFF625700, 0xFF727802,
+	0xFF929D02, 0xFF9AB303, 0xFF77C004, 0xFF54CA03, 0xFF6BC603, 0xFFA2AE01, 0xFF9F9400, 0xFF718802,
+	0xFF578F03, 0xFF509804, 0xFF579304, 0xFF6E9100, 0xFF899200, 0xFF8D9202, 0xFF787503, 0xFF5E5200,
+	0xFF623800, 0xFF6E2901, 0xFF681E03, 0xFF5E1301, 0xFF621A00, 0xFF663400, 0xFF465201, 0xFF305701,
+	0xFF3F4A02, 0xFF585102, 0xFF7F7403, 0xFF9A9901, 0xFF91A800, 0xFF6D9902, 0xFF5A7902, 0xFF866201,
+	0xFFB96C02, 0xFFB98805, 0xFF8D9302, 0xFF698400, 0xFF637101, 0xFF5E6A00, 0xFF566600, 0xFF636700,
+	0xFF827802, 0xFF7C7305, 0xFF6B6301, 0xFF655B04, 0xFF595A02, 0xFF515500, 0xFF554100, 0xFF592D02,
+	0xFF612800, 0xFF823C00, 0xFFA35201, 0xFF945E05, 0xFF616603, 0xFF496D04, 0xFF4C7205, 0xFF716300,
+	0xFF895701, 0xFF895802, 0xFF836B03, 0xFF838004, 0xFF818A04, 0xFF698C02, 0xFF578901, 0xFF728600,
+	0xFFAB8600, 0xFFB59000, 0xFF819B04, 0xFF439B02, 0xFF278600, 0xFF556402, 0xFF904F03, 0xFF965C02,
+	0xFF747D00, 0xFF688900, 0xFF867E03, 0xFF926702, 0xFF694E00, 0xFF493C00, 0xFF473F00, 0xFF5A6602,
+	0xFF82A103, 0xFF9FC309, 0xFF89BB06, 0xFF599701, 0xFF508000, 0xFF658504, 0xFF789204, 0xFF759202,
+	0xFF648600, 0xFF677400, 0xFF8B5802, 0xFFB04102, 0xFFBC3600, 0xFFA14500, 0xFF6A6C01, 0xFF389007,
+	0xFF1D9404, 0xFF138100, 0xFF246500, 0xFF545300, 0xFF9D5000, 0xFFCB6603, 0xFFC68205, 0xFF9D9106,
+	0xFF4D7502, 0xFF2F6A02, 0xFF387700, 0xFF6A8300, 0xFF829001, 0xFF789D02, 0xFF7CA001, 0xFF8E9D04,
+	0xFF889A04, 0xFF739801, 0xFF749203, 0xFF7A8502, 0xFF677800, 0xFF467001, 0xFF386800, 0xFF4B6600,
+	0xFF6C7200, 0xFF857904, 0xFF816C01, 0xFF685200, 0xFF6E4401, 0xFF7F5C00, 0xFF7E8A02, 0xFF88A505,
+	0xFF97A500, 0xFF9E9701, 0xFF859604, 0xFF6BA704, 0xFF72B70A, 0xFF88A904, 0xFF7E8800, 0xFF676700,
+	0xFF5E5701, 0xFF4D5700, 0xFF495500, 0xFF686000, 0xFF826F07, 0xFF776704, 0xFF494B00, 0xFF2F3100,
+	0xFF432600, 0xFF582301, 0xFF5D1A00, 0xFF5F1300, 0xFF772400, 0xFF8C4802, 0xFF6A6F00, 0xFF3F8600,
+	0xFF447F01, 0xFF747200, 0xFFA87404, 0xFFB47F09, 0xFF908903, 0xFF508C01, 0xFF4B8700, 0xFF8B8204,
+	0xFFC28502, 0xFFBD8002, 0xFF837501, 0xFF606B00, 0xFF687503, 0xFF798D02, 0xFF759907, 0xFF798C05,
+	0xFF785F06, 0xFF674703, 0xFF794C00, 0xFF895E02, 0xFF717408, 0xFF518005, 0xFF447700, 0xFF555803,
+	0xFF653D07, 0xFF8E3201, 0xFFAA2C00, 0xFF992E00, 0xFF6D3900, 0xFF495303, 0xFF486E03, 0xFF667901,
+	0xFF858000, 0xFF948B01, 0xFF929104, 0xFF86940B, 0xFF728604, 0xFF596B01, 0xFF525B01, 0xFF7E5400,
+	0xFFBB5300, 0xFFCA6201, 0xFF998501, 0xFF54A104, 0xFF2DA001, 0xFF458401, 0xFF7C5C01, 0xFF8B4A01,
+	0xFF755102, 0xFF675501, 0xFF804801, 0xFF7B4600, 0xFF595200, 0xFF485502, 0xFF525F01, 0xFF757203,
+	0xFF9E9204, 0xFFA6A403, 0xFF77A502, 0xFF559600, 0xFF5C8C00, 0xFF6C8D01, 0xFF6A8A05, 0xFF598102,
+	0xFF497900, 0xFF517101, 0xFF6A6300, 0xFF904B00, 0xFFB83200, 0xFFBA3100, 0xFF8A4A01, 0xFF516702,
+	0xFF257C02, 0xFF098D02, 0xFF1C9D00, 0xFF589E02, 0xFFA49803, 0xFFDA9201, 0xFFCE8E01, 0xFF8C7F04,
+	0xFF2D5F01, 0xFF597702, 0xFFA09502, 0xFF76A603, 0xFF547602, 0xFF676502, 0xFF677301, 0xFF629002,
+	0xFF6D9C04, 0xFF526C02, 0xFF8B5304, 0xFF939002, 0xFF6E7401, 0xFF985701, 0xFF8A6E04, 0xFF515101,
+	0xFF623701, 0xFF6D4201, 0xFF6D4A03, 0xFF202702, 0xFF322402, 0xFF4A4101, 0xFF966206, 0xFF6C6F00,
+	0xFF569C03, 0xFFA29302, 0xFF6D7701, 0xFF787F03, 0xFFAA7701, 0xFF6A6E02, 0xFF8EA702, 0xFF848305,
+	0xFF7F3901, 0xFF923A02, 0xFF6B6F02, 0xFF338903, 0xFF675301, 0xFF822C03, 0xFF7A2A00, 0xFF926F01,
+	0xFF8BA204, 0xFF518901, 0xFF325E01, 0xFF724301, 0xFFDF4102, 0xFF9A7704, 0xFF346502, 0xFF5B4902,
+	0xFF6F5502, 0xFF925B03, 0xFF676904, 0xFF5B5402, 0xFFA54802, 0xFF6E5D01, 0xFF587D01, 0xFF488A02,
+	0xFF428801, 0xFF548401, 0xFF9E6300, 0xFF9C5901, 0xFF559E02, 0xFF42DA02, 0xFFA0AA02, 0xFF8C5701,
+	0xFF3E5B01, 0xFF727502, 0xFFBC7502, 0xFF676701, 0xFF4A6C01, 0xFF818604, 0xFF859904, 0xFF638701,
+	0xFF2E4902, 0xFF264D01, 0xFF786500, 0xFF965A02, 0xFF4F4B00, 0xFFA05C05, 0xFF803803, 0xFF534C01,
+	0xFF718005, 0xFF737201, 0xFF4A5F00, 0xFF1A4601, 0xFF374702, 0xFF698703, 0xFF6F7401, 0xFF724801,
+	0xFF8B8C02, 0xFF9AA105, 0xFF647901, 0xFF878003, 0xFF7E7E05, 0xFF666200, 0xFF7F6104, 0xFF684900,
+	0xFF7C4C01, 0xFF776301, 0xFF847702, 0xFF407E00, 0xFF546801, 0xFF5E6702, 0xFF907F03, 0xFFCA7D02,
+	0xFF6E6001, 0xFF175301, 0xFF206E02, 0xFF688A02, 0xFFC98003, 0xFF866C02, 0xFF324F01, 0xFF586703,
+	0xFF746C01, 0xFF985101, 0xFF484300, 0xFF4B5001, 0xFFBB3D01, 0xFF984700, 0xFF768105, 0xFF477C05,
+	0xFF3D4E01, 0xFF5F6701, 0xFF828C03, 0xFFD08203, 0xFFA08D06, 0xFF338B01, 0xFF627103, 0xFF614901,
+	0xFF468402, 0xFF6B7901, 0xFFA86F02, 0xFF828304, 0xFF5D8103, 0xFF6D6100, 0xFF6D4C01, 0xFF403101,
+	0xFF242800, 0xFF535C01, 0xFF869B05, 0xFF697A04, 0xFF475200, 0xFF8F4D01, 0xFF645001, 0xFF626200,
+	0xFF797700, 0xFF7BA101, 0xFF41B403, 0xFF38A701, 0xFF829C02, 0xFF6B8E01, 0xFF4F7702, 0xFF8A7D04,
+	0xFF906801, 0xFF8F4F03, 0xFF6C6001, 0xFF786502, 0xFF4B5C01, 0xFF696A02, 0xFF866501, 0xFF647402,
+	0xFF716E02, 0xFF8B7F04, 0xFF7F8D01, 0xFF548704, 0xFF528D02, 0xFF6B9805, 0xFF7F8901, 0xFFA85601,
+	0xFF592801, 0xFF293801, 0xFF536702, 0xFF91A005, 0xFF959603, 0xFF645200, 0xFF556504, 0xFF566901,
+	0xFF766502, 0xFF918101, 0xFF30A102, 0xFF45B306, 0xFFA09502, 0xFFB68804, 0xFF6D7701, 0xFF3A6001,
+	0xFF4E6902, 0xFF806F03, 0xFF685701, 0xFFB64701, 0xFF774000, 0xFF443901, 0xFF916001, 0xFF7A8103,
+	0xFF5E6302, 0xFF5A8B02, 0xFF997401, 0xFF866402, 0xFF534B01, 0xFF695701, 0xFF544E01, 0xFF436503,
+	0xFF576405, 0xFF8C6806, 0xFF7A6601, 0xFF395B01, 0xFF437300, 0xFFA78802, 0xFF999403, 0xFF508D05,
+	0xFF5E6601, 0xFFA56605, 0xFF5C8E03, 0xFF478400, 0xFF845C02, 0xFF514A02, 0xFF6F7D01, 0xFF889C01,
+	0xFF5F6F00, 0xFF624A00, 0xFF765D01, 0xFF7A6F02, 0xFF588401, 0xFF799803, 0xFF6B7C01, 0xFF727502,
+	0xFF839802, 0xFF9E8603, 0xFF615D02, 0xFF535301, 0xFF4F7101, 0xFF557803, 0xFF6F5D01, 0xFFA65202,
+	0xFF706101, 0xFF606603, 0xFF696C04, 0xFF876F00, 0xFF676C00, 0xFF618401, 0xFF658603, 0xFF458001,
+	0xFF918F00, 0xFFB1A602, 0xFF4CCA04, 0xFF1AAA03, 0xFF647901, 0xFFAF5702, 0xFF776701, 0xFF467F00,
+	0xFF4D7A01, 0xFF6D8702, 0xFF598501, 0xFFA46904, 0xFF6C6401, 0xFF5A6B03, 0xFF966202, 0xFF985301,
+	0xFF867503, 0xFF3D8B01, 0xFF566C01, 0xFF5F2902, 0xFF762F01, 0xFF7F4900, 0xFF697702, 0xFF529C05,
+	0xFF506801, 0xFF9F5400, 0xFF946C00, 0xFF768F01, 0xFF59B304, 0xFF83A904, 0xFF957E01, 0xFF387002,
+	0xFF2D6102, 0xFF8F3400, 0xFF784001, 0xFF476501, 0xFF504901, 0xFF652701, 0xFF9D4B03, 0xFF786701,
+	0xFF3E7700, 0xFF538D01, 0xFF8C9C05, 0xFF8E9F02, 0xFF699800, 0xFF687F01, 0xFF618A00, 0xFF8EA002,
+	0xFF86A101, 0xFF666E02, 0xFF393A02, 0xFF634601, 0xFF816002, 0xFF4C6A00, 0xFF517F02, 0xFF8B7B06,
+	0xFF726600, 0xFF716C01, 0xFF527F02, 0xFF4B6C00, 0xFF716F00, 0xFF648004, 0xFF4C7301, 0xFF4C7D00,
+	0xFF6B8406, 0xFFA46D03, 0xFF535D01, 0xFF177B00, 0xFF3D7F04, 0xFF9E4400, 0xFFB54B01, 0xFF6F7401,
+	0xFF6A8B01, 0xFF708C02, 0xFF719102, 0xFF98B704, 0xFF526B03, 0xFF4B4601, 0xFF8C7301, 0xFF8A8406,
+	0xFF948605, 0xFF378301, 0xFF177201, 0xFF495703, 0xFF7F4601, 0xFF943A01, 0xFF945702, 0xFF5E5701,
+	0xFF558501, 0xFF90B603, 0xFFAFC003, 0xFFA0B203, 0xFF479E00, 0xFF5C7001, 0xFF8D7004, 0xFF426802,
+	0xFF284A01, 0xFF733101, 0xFF933E01, 0xFF6B6803, 0xFF427B01, 0xFF635501, 0xFF934602, 0xFF5F4B00,
+	0xFF3E6C01, 0xFF6A9101, 0xFF7C9101, 0xFF868402, 0xFF5B6A01, 0xFF847803, 0xFF739003, 0xFF736C01,
+	0xFF665601, 0xFF596301, 0xFF667C03, 0xFF909203, 0xFF897F05, 0xFF355400, 0xFF376701, 0xFF5A7901,
+	0xFF636801, 0xFF916801, 0xFF628B02, 0xFF358A01, 0xFF626800, 0xFF4B3C01, 0xFF532702, 0xFF633B01,
+	0xFF674A01, 0xFF813C03, 0xFF623F00, 0xFF4F8F01, 0xFF2FA101, 0xFF7A7700, 0xFFB88E02, 0xFF868603,
+	0xFF656F03, 0xFF5B6B01, 0xFF886E02, 0xFF846802, 0xFF325D00, 0xFF858302, 0xFFC07F02, 0xFF807302,
+	0xFF976F02, 0xFF2E5001, 0xFF0A4600, 0xFF4F6102, 0xFF757802, 0xFFA58C01, 0xFF9E8D02, 0xFF8A9301,
+	0xFF9BC504, 0xFF66C306, 0xFF84A701, 0xFF7B8101, 0xFF586F03, 0xFF666E01, 0xFF6F6001, 0xFF314401,
+	0xFF4A4101, 0xFF6B5C02, 0xFF6E4C01, 0xFF8B5601, 0xFF667401, 0xFF677F02, 0xFF788303, 0xFF5C6B01,
+	0xFF7D8F02, 0xFF779E03, 0xFF728001, 0xFF727504, 0xFF4B5600, 0xFF8F5C01, 0xFF7C7601, 0xFF687F02,
+	0xFF717304, 0xFF9D7306, 0xFF908500, 0xFF8B9301, 0xFF616700, 0xFF405801, 0xFF568102, 0xFF4D7405,
+	0xFF4C5C01, 0xFF7D4A02, 0xFFA05601, 0xFF797C02, 0xFF599004, 0xFF466704, 0xFF8A5700, 0xFF7F7403,
+	0xFF575300, 0xFF8C2603, 0xFF923102, 0xFF8B7502, 0xFF40A402, 0xFF748803, 0xFF887200, 0xFF565A01,
+	0xFF716A02, 0xFF5F7202, 0xFF6F5E00, 0xFF865B02, 0xFF5A9905, 0xFF80AE03, 0xFFA46001, 0xFF7E4302,
+	0xFF8E5200, 0xFF425001, 0xFF526F02, 0xFF8AAE01, 0xFF9FC604, 0xFF92B904, 0xFF809001, 0xFFBA9404,
+	0xFFAEA304, 0xFF578000, 0xFF645902, 0xFF4E4B01, 0xFF744A02, 0xFF826E03, 0xFF567A02, 0xFF315801,
+	0xFF635C02, 0xFF686F01, 0xFF4F8601, 0xFF7E7F03, 0xFF695E00, 0xFF797102, 0xFF696E00, 0xFF6B7502,
+	0xFF928004, 0xFF536F01, 0xFF4C6800, 0xFF6C7201, 0xFF628A00, 0xFF979503, 0xFF949203, 0xFF408003,
+	0xFF4B5700, 0xFFA55C01, 0xFFB27603, 0xFF7E8203, 0xFF527E01, 0xFF788604, 0xFF537F01, 0xFF294F01,
+	0xFF4A4101, 0xFF927004, 0xFF907605, 0xFF774100, 0xFF694701, 0xFF647600, 0xFFAE9003, 0xFF989702,
+	0xFF538802, 0xFF836104, 0xFF9D4500, 0xFFAD4E01, 0xFF566601, 0xFF576601, 0xFF5F4B01, 0xFF656001,
+	0xFF6F6F02, 0xFF577000, 0xFF8D8501, 0xFFA57A03, 0xFF857600, 0xFF448201, 0xFF5E6001, 0xFF754B01,
+	0xFF676902, 0xFF5A9B02, 0xFF93D903, 0xFF8ECD01, 0xFF84BD02, 0xFF588E02, 0xFF645D01, 0xFF974701,
+	0xFF912F01, 0xFF5E2400, 0xFF634605, 0xFF3B7001, 0xFF626800, 0xFFA45301, 0xFF627601, 0xFF4A8101,
+	0xFF7A8E03, 0xFF606601, 0xFF7A5E02, 0xFF777502, 0xFF4C8902, 0xFF758404, 0xFF695501, 0xFF695702,
+	0xFF655801, 0xFF496101, 0xFF497E04, 0xFF7C9904, 0xFF759304, 0xFF5F7802, 0xFF5F5D00, 0xFF405302,
+	0xFF5F8C03, 0xFFB09703, 0xFFB46B02, 0xFF875A03, 0xFF5B8703, 0xFF617F00, 0xFF3C5F00, 0xFF446601,
+	0xFF857E03, 0xFF9F7A02, 0xFF475D00, 0xFF3F4B01, 0xFF895C01, 0xFF9C8402, 0xFFA97F02, 0xFF8B5601,
+	0xFF476401, 0xFF5A7C01, 0xFF938B02, 0xFF908005, 0xFF4B5300, 0xFF354600, 0xFF3F3A02, 0xFF6E4601,
+	0xFF6F6301, 0xFF8D9303, 0xFFA3AE03, 0xFF8C9603, 0xFF877402, 0xFF455601, 0xFF5B5801, 0xFF8C6202,
+	0xFF789D01, 0xFF84D506, 0xFF71BC02, 0xFF597701, 0xFF887502, 0xFF446E01, 0xFF755E01, 0xFF736C02,
+	0xFF4E4C01, 0xFF7A3701, 0xFF7E4301, 0xFF4F6601, 0xFF568A03, 0xFF8D6E02, 0xFF686600, 0xFF6B9002,
+	0xFF718502, 0xFF546801, 0xFF906F01, 0xFF935F01, 0xFF5D6E02, 0xFF4B7801, 0xFF5C5E00, 0xFF716201,
+	0xFF5E6A02, 0xFF516901, 0xFF557301, 0xFF6A7001, 0xFF516501, 0xFF2F6E01, 0xFF477E03, 0xFF868502,
+	0xFF88A701, 0xFFA5AC01, 0xFFAB7C02, 0xFF9B5001, 0xFF594D02, 0xFF4A5501, 0xFF517503, 0xFF648004,
+	0xFF8F6F01, 0xFF8F6C01, 0xFF637400, 0xFF529002, 0xFF889D03, 0xFFA49101, 0xFF848901, 0xFF4C4701,
+	0xFF433502, 0xFF7B6302, 0xFF978102, 0xFF706801, 0xFF526702, 0xFF4A4C02, 0xFF464801, 0xFF774D01,
+	0xFF984F00, 0xFF9F8201, 0xFFB3A703, 0xFF96A401, 0xFF626401, 0xFF6F4803, 0xFF977C02, 0xFFA28C00,
+	0xFF816F01, 0xFFAB6802, 0xFF586001, 0xFF606B03, 0xFF999203, 0xFF629905, 0xFF827002, 0xFF844A01,
+	0xFF4F6501, 0xFF888803, 0xFF6B6902, 0xFF403C02, 0xFF4E5302, 0xFF765F03, 0xFF726601, 0xFF6D6F02,
+	0xFF606900, 0xFF4B8902, 0xFF84A405, 0xFF828501, 0xFF6B7102, 0xFF527601, 0xFF597500, 0xFF695E00,
+	0xFF575D00, 0xFF607402, 0xFF658E00, 0xFF5D7B03, 0xFF6D7402, 0xFF499E01, 0xFF38A901, 0xFF878E01,
+	0xFFAF9203, 0xFF949403, 0xFF756103, 0xFF783502, 0xFF3C2900, 0xFF6F4202, 0xFF8F5802, 0xFF636E01,
+	0xFF808401, 0xFFA0A303, 0xFF8CB305, 0xFF71B102, 0xFF78A200, 0xFF8D9603, 0xFF547001, 0xFF265301,
+	0xFF454F01, 0xFF8E4401, 0xFF814101, 0xFF753E01, 0xFF794603, 0xFF626800, 0xFF658C01, 0xFF667A02,
+	0xFF985000, 0xFFAB9405, 0xFF8A9102, 0xFF514802, 0xFF3C5203, 0xFF8E8502, 0xFFA79A00, 0xFF7FA401,
+	0xFF655200, 0xFFC15D02, 0xFFA18601, 0xFF7F9C03, 0xFF707701, 0xFF6B6901, 0xFF857601, 0xFF957502,
+	0xFF725A01, 0xFF7D5F01, 0xFF465801, 0xFF384501, 0xFF6A4C00, 0xFF886703, 0xFF7D7100, 0xFF6C7400,
+	0xFF6E8A03, 0xFF589B02, 0xFF6CA503, 0xFF538201, 0xFF556701, 0xFF786B00, 0xFF908503, 0xFF6F8401,
+	0xFF5F7C02, 0xFF958F04, 0xFF79AD04, 0xFF459901, 0xFF7C7D01, 0xFF6C9504, 0xFF3A8304, 0xFF695E00,
+	0xFFA74700, 0xFF623401, 0xFF432601, 0xFF453201, 0xFF4D6801, 0xFF96A002, 0xFFA59902, 0xFF83AB01,
+	0xFF69B702, 0xFF7C9403, 0xFF8C7B03, 0xFF878703, 0xFF767801, 0xFF756401, 0xFF567002, 0xFF3F5804,
+	0xFF5B4C01, 0xFF6B4E01, 0xFF624D01, 0xFF695D01, 0xFFA53E02, 0xFF9E5000, 0xFF918506, 0xFF5B7601,
+	0xFF8C6D01, 0xFFAB7101, 0xFF424102, 0xFF373C00, 0xFF659501, 0xFFA4D104, 0xFFC9B305, 0xFF668B02,
+	0xFF878705, 0xFFBA9805, 0xFFA77402, 0xFF615302, 0xFF5C5E01, 0xFFA88703, 0xFFB6A104, 0xFF758D04,
+	0xFF646500, 0xFF815402, 0xFF465601, 0xFF607A03, 0xFF87A400, 0xFF9EB803, 0xFF98B605, 0xFF6A9A01,
+	0xFF5A7603, 0xFF6D6A01, 0xFF4C5B02, 0xFF314A01, 0xFF575800, 0xFF937F01, 0xFFAA9B04, 0xFF797900,
+	0xFF5A7800, 0xFF8A7503, 0xFF936601, 0xFF637A01, 0xFF608402, 0xFF496502, 0xFF355300, 0xFF8A6104,
+	0xFF8E6706, 0xFF443601, 0xFF584501, 0xFF598300, 0xFF83B002, 0xFFAEB304, 0xFFABA701, 0xFFAEA203,
+	0xFF5E9201, 0xFF4D6F01, 0xFF655201, 0xFF8F4601, 0xFF836401, 0xFF808507, 0xFF4D6F01, 0xFF494701,
+	0xFF794D01, 0xFF6A5701, 0xFF6E7603, 0xFF5A9B03, 0xFF788802, 0xFFB85D01, 0xFFA65000, 0xFF666D00,
+	0xFF84A005, 0xFF7D5503, 0xFF3B3B01, 0xFF848C02, 0xFFBBC106, 0xFF90A602, 0xFF755F01, 0xFF5B4D03,
+	0xFF728505, 0xFF7D6600, 0xFF7D5300, 0xFF6A4902, 0xFF787A03, 0xFF868205, 0xFF8E5B01, 0xFF405E01,
+	0xFF6C8D01, 0xFF749D01, 0xFF5D9101, 0xFF899B02, 0xFFA6B703, 0xFF8DC404, 0xFF718C01, 0xFF5B5D01,
+	0xFF3F5101, 0xFF624702, 0xFF4C4001, 0xFF586402, 0xFF708900, 0xFF9EA702, 0xFF768702, 0xFF784F00,
+	0xFF946205, 0xFF616E01, 0xFF7B3C00, 0xFF703D00, 0xFF4D4E01, 0xFF5A6501, 0xFF479804, 0xFF667D01,
+	0xFF6A6602, 0xFF637800, 0xFFA79D04, 0xFF8AB302, 0xFF8FAE04, 0xFF9D9604, 0xFF785F00, 0xFF8F3302,
+	0xFF7D2C00, 0xFF5D5501, 0xFF369304, 0xFF667B00, 0xFFA34B01, 0xFF815903, 0xFF365B00, 0xFF687C04,
+	0xFF857102, 0xFF797901, 0xFF938101, 0xFF457C00, 0xFF629601, 0xFF96A004, 0xFF838B03, 0xFF838E02,
+	0xFF5D6901, 0xFF694D01, 0xFF548904, 0xFF949C03, 0xFFA86D01, 0xFF4A3B01, 0xFF514D01, 0xFF818A07,
+	0xFF626C01, 0xFF8BA107, 0xFF6E8E02, 0xFF6D4C02, 0xFF712B01, 0xFF4F3F00, 0xFF6C6C02, 0xFF518E01,
+	0xFF79B102, 0xFF70AE01, 0xFF5A9F04, 0xFF717C01, 0xFF9D7201, 0xFF787101, 0xFF4A5702, 0xFF6F4600,
+	0xFF4D6400, 0xFF629602, 0xFF748D02, 0xFF7A8E01, 0xFF8DA502, 0xFF9A9205, 0xFF455B01, 0xFF555301,
+	0xFF8B4A01, 0xFF834A02, 0xFF744A02, 0xFF5E4D02, 0xFF675C05, 0xFFA65B04, 0xFF5B6701, 0xFF497A01,
+	0xFF67A200, 0xFF69C305, 0xFF84AC02, 0xFF6F6701, 0xFF7A5501, 0xFF834E01, 0xFF565802, 0xFF5B5802,
+	0xFF954303, 0xFF7B4A01, 0xFF506F01, 0xFF4B7E02, 0xFF7A5401, 0xFF843D00, 0xFF6B7102, 0xFF7AA202,
+	0xFF808201, 0xFF7F8B02, 0xFF6E7400, 0xFF4A7B01, 0xFF759803, 0xFF807001, 0xFF756301, 0xFF715A02,
+	0xFF6B5201, 0xFFAE8902, 0xFF6D9202, 0xFF4F5900, 0xFF6F3601, 0xFF576C00, 0xFF7F9507, 0xFF726F01,
+	0xFFAB7203, 0xFF808B03, 0xFF2D9700, 0xFF3A8502, 0xFF714F01, 0xFF8C5D02, 0xFF959F06, 0xFF8CB404,
+	0xFF85A803, 0xFF507601, 0xFF526B01, 0xFF557201, 0xFF5F6501, 0xFF655C01, 0xFF686C02, 0xFF697303,
+	0xFF617901, 0xFF8E9804, 0xFF839101, 0xFF7D6F01, 0xFF916902, 0xFF653F02, 0xFF3D4600, 0xFF4A9C03,
+	0xFF47B003, 0xFF5F8703, 0xFF714501, 0xFF544000, 0xFF815701, 0xFFAC3C01, 0xFF684201, 0xFF7F7604,
+	0xFF586F01, 0xFF316A00, 0xFF2F8102, 0xFF3C7F01, 0xFF778101, 0xFF856301, 0xFF776401, 0xFF627701,
+	0xFF778805, 0xFF615F01, 0xFF423702, 0xFF4C4201, 0xFF7A7103, 0xFF7D7F02, 0xFF7F8401, 0xFF648600,
+	0xFF799102, 0xFF7F9403, 0xFF575F01, 0xFF807405, 0xFF7F8D06, 0xFF474B00, 0xFF4F3601, 0xFF5A5301,
+	0xFF8B7701, 0xFFA36A04, 0xFF635E02, 0xFF3F6E02, 0xFF7F7203, 0xFF729202, 0xFF3D7902, 0xFF645B01,
+	0xFF99A101, 0xFF7F6F00, 0xFF327E00, 0xFF2E9604, 0xFF507F01, 0xFFAA5A00, 0xFF9C6703, 0xFF696001,
+	0xFF5A5301, 0xFF455F02, 0xFF657A03, 0xFF617D03, 0xFF457D01, 0xFF5B8902, 0xFF7D8803, 0xFF6B8202,
+	0xFF577A01, 0xFF736F01, 0xFF666801, 0xFF5F5800, 0xFF7F4801, 0xFF503701, 0xFF624501, 0xFF9B7603,
+	0xFF4D8D00, 0xFF2B8200, 0xFF545600, 0xFF8A7A03, 0xFFA39B04, 0xFF7B6905, 0xFF6B4C02, 0xFF957506,
+	0xFF4C5501, 0xFF473501, 0xFF5D5003, 0xFF7C8301, 0xFF7F9E06, 0xFF598801, 0xFF727001, 0xFF6E4F02,
+	0xFF794901, 0xFF585502, 0xFF384B00, 0xFF6C5F03, 0xFF987102, 0xFF727D01, 0xFF5C7C01, 0xFF687D01,
+	0xFF889205, 0xFF738E00, 0xFF677904, 0xFF8F7804, 0xFF525D01, 0xFF474701, 0xFF606505, 0xFF667902,
+	0xFF797D00, 0xFF716201, 0xFF6C5203, 0xFF478401, 0xFF798602, 0xFF654F00, 0xFF266400, 0xFF56B003,
+	0xFF76BF01, 0xFF7B8B06, 0xFF485903, 0xFF585500, 0xFF546F00, 0xFF905203, 0xFF7C3401, 0xFF584601,
+	0xFF7A7F04, 0xFF698502, 0xFF5D6A03, 0xFF625C02, 0xFF517001, 0xFF5E7B01, 0xFF6B7900, 0xFF757702,
+	0xFF5E7103, 0xFF4F7102, 0xFF4F7401, 0xFF426500, 0xFF655202, 0xFF465000, 0xFF735D00, 0xFFB95703,
+	0xFF775902, 0xFF3F6F02, 0xFF879200, 0xFFAFB803, 0xFF768F01, 0xFF604B01, 0xFF843901, 0xFF9D5A01,
+	0xFF497002, 0xFF696702, 0xFF7D5A01, 0xFF914903, 0xFF7D3B00, 0xFF576703, 0xFF477F01, 0xFF526701,
+	0xFF7F4701, 0xFF6B3A00, 0xFF636701, 0xFF859602, 0xFF8D9B02, 0xFF6F9101, 0xFF588B02, 0xFF6C8301,
+	0xFF866701, 0xFF7A5502, 0xFF725A01, 0xFF815A02, 0xFF436500, 0xFF617C01, 0xFF747C01, 0xFF686E01,
+	0xFF776F02, 0xFF435802, 0xFF764C02, 0xFF925F01, 0xFF775702, 0xFF674501, 0xFF708804, 0xFF53D200,
+	0xFF598503, 0xFF495402, 0xFF794301, 0xFF9E5101, 0xFF707D02, 0xFF6C7A02, 0xFF6A7201, 0xFF828C02,
+	0xFF858A02, 0xFF5F7001, 0xFF5E6F01, 0xFF5D6903, 0xFF647400, 0xFF6E7A02, 0xFF557202, 0xFF695D00,
+	0xFF695E01, 0xFF5D7D01, 0xFF6A8601, 0xFF467F03, 0xFF635801, 0xFF6A6502, 0xFF726304, 0xFF994D01,
+	0xFF675101, 0xFF4F8501, 0xFF99AA05, 0xFF989502, 0xFF467B02, 0xFF657603, 0xFF845901, 0xFFAA7203,
+	0xFF5F9201, 0xFF516702, 0xFF7E4600, 0xFF853E01, 0xFF881901, 0xFF7D1F02, 0xFF505C02, 0xFF69A001,
+	0xFF619402, 0xFF7B6901, 0xFFA18603, 0xFF929F02, 0xFF75A902, 0xFF609103, 0xFF6C7B00, 0xFF606E02,
+	0xFF714D01, 0xFF7E4900, 0xFF635701, 0xFF684801, 0xFF5F5301, 0xFF849901, 0xFF6BA902, 0xFF505901,
+	0xFF693802, 0xFF615D01, 0xFF9A9B04, 0xFF868202, 0xFF735900, 0xFF7E6801, 0xFFA98703, 0xFF739B01,
+	0xFF2F3C01, 0xFF1D5601, 0xFF6B8703, 0xFFA98E05, 0xFF779302, 0xFF608A03, 0xFF797801, 0xFF967403,
+	0xFF547300, 0xFF527503, 0xFF5F7A01, 0xFF558300, 0xFF6B8301, 0xFF738901, 0xFF3F8700, 0xFF6A7B00,
+	0xFF9B8001, 0xFF828303, 0xFF656A01, 0xFF4F6801, 0xFF6C6C02, 0xFF7B4E02, 0xFF746400, 0xFF8D7F00,
+	0xFF909703, 0xFF60AF04, 0xFF656B01, 0xFF933601, 0xFF616400, 0xFF5C9602, 0xFF829603, 0xFFB69303,
+	0xFF557C02, 0xFF205A01, 0xFF8A4100, 0xFF8E4E01, 0xFF804900, 0xFF984001, 0xFFA45C00, 0xFF998D05,
+	0xFF3A9300, 0xFF729D02, 0xFF9C9105, 0xFF8A7A00, 0xFF626D01, 0xFF3C6000, 0xFF6B5901, 0xFF716701,
+	0xFF828B03, 0xFF6B7E02, 0xFF374501, 0xFF543B01, 0xFF8F5C02, 0xFFB18406, 0xFF578202, 0xFF306701,
+	0xFF707D02, 0xFFADAE02, 0xFFA2C402, 0xFF5A9D02, 0xFF7A8A04, 0xFF807804, 0xFF864703, 0xFF653001,
+	0xFF528803, 0xFF389B02, 0xFF7BA506, 0xFF918804, 0xFF707B00, 0xFF497F01, 0xFF797E02, 0xFF8F6302,
+	0xFF4A6801, 0xFF557A01, 0xFF799202, 0xFF679603, 0xFF667D02, 0xFF978402, 0xFF5FA001, 0xFF709302,
+	0xFF896803, 0xFF6E4100, 0xFF5E3A00, 0xFF544901, 0xFF575D03, 0xFF837000, 0xFFB2AC05, 0xFF91B903,
+	0xFF879002, 0xFF506801, 0xFF596002, 0xFFAD7B03, 0xFFAC8D04, 0xFF708803, 0xFF515E00, 0xFF8A4001,
+	0xFF6B3C00, 0xFF1E7B00, 0xFF739F06, 0xFFA79A02, 0xFF5DA501, 0xFF819C01, 0xFFB29407, 0xFF998604,
+	0xFF337E01, 0xFF547801, 0xFF717803, 0xFF686F01, 0xFF636700, 0xFF596B01, 0xFF7B8402, 0xFF968D05,
+	0xFF9F8504, 0xFF4B7601, 0xFF255902, 0xFF784900, 0xFFA45E02, 0xFF9A4101, 0xFF5F3E01, 0xFF4F7E03,
+	0xFF6D9C02, 0xFFB59100, 0xFFA99A04, 0xFF449703, 0xFF586403, 0xFF604A00, 0xFF584402, 0xFF756301,
+	0xFF4E8101, 0xFF5A7E01, 0xFF796C00, 0xFF6F5801, 0xFF786102, 0xFF5A8F02, 0xFF6CA202, 0xFF618201,
+	0xFF697D01, 0xFF85A304, 0xFF7D9E00, 0xFF587400, 0xFF565F00, 0xFFA55703, 0xFF7F5E02, 0xFF5A5300,
+	0xFF763B00, 0xFF523C01, 0xFF563A01, 0xFF775E01, 0xFF769A01, 0xFF99BC04, 0xFFA29B04, 0xFF7A7301,
+	0xFF596501, 0xFF737102, 0xFF908C03, 0xFF8A7C01, 0xFF885401, 0xFF594C01, 0xFF457301, 0xFF827D05,
+	0xFF965A01, 0xFF4E8601, 0xFF559700, 0xFFAE8802, 0xFF819D01, 0xFF75B206, 0xFF698301, 0xFF644B02,
+	0xFF5F5001, 0xFF867904, 0xFF8C8703, 0xFF4B7601, 0xFF547503, 0xFF7F6F01, 0xFF855E03, 0xFF725200,
+	0xFF6F3F01, 0xFF595601, 0xFF349503, 0xFF7A9903, 0xFF8F7601, 0xFF726E01, 0xFF785E01, 0xFF685F02,
+	0xFF6C6D01, 0xFFB47A02, 0xFF985601, 0xFF444C01, 0xFF736E01, 0xFF9A9405, 0xFF6CAB02, 0xFF879A04,
+	0xFF5D4200, 0xFF687F04, 0xFF868C02, 0xFF6B8801, 0xFF858A04, 0xFF709902, 0xFF529C01, 0xFF3C7D01,
+	0xFF826C01, 0xFF9E7802, 0xFF686802, 0xFF525A02, 0xFF465F01, 0xFF7F5403, 0xFF894501, 0xFF5A5F01,
+	0xFF6F6001, 0xFF646301, 0xFF859405, 0xFFB2AA05, 0xFF979704, 0xFF6C7601, 0xFF6E6401, 0xFF837504,
+	0xFF6E7D02, 0xFF836D01, 0xFF845B01, 0xFF5D6101, 0xFF8C7304, 0xFF8A6D01, 0xFF7E9F04, 0xFF50C301,
+	0xFF839D02, 0xFF535D01, 0xFF693E03, 0xFFAD6203, 0xFF9F5E02, 0xFF645203, 0xFF2E5101, 0xFF386E02,
+	0xFF935B02, 0xFF9E4A01, 0xFF784901, 0xFF414E01, 0xFF575B00, 0xFF775801, 0xFF6D4D01, 0xFF7A4401,
+	0xFF7A5702, 0xFF736A02, 0xFF5B8100, 0xFF6B8D03, 0xFF637B01, 0xFF6C9B03, 0xFF63A202, 0xFF587303,
+	0xFF877902, 0xFFA77A07, 0xFF5B4101, 0xFF595C02, 0xFF8C8D06, 0xFF9BA002, 0xFF5C9F01, 0xFF615100,
+	0xFFA58705, 0xFF738401, 0xFF698D02, 0xFF567601, 0xFF8A7802, 0xFF8B8A01, 0xFF508701, 0xFF286900,
+	0xFF904400, 0xFFBD3D02, 0xFF654702, 0xFF535001, 0xFF507901, 0xFF769104, 0xFF708D02, 0xFF4B9800,
+	0xFF67BA07, 0xFF86B803, 0xFFA3A704, 0xFF777B02, 0xFF675D01, 0xFF806B03, 0xFF7B7904, 0xFF646E02,
+	0xFF5C6B00, 0xFF948201, 0xFF9C8B03, 0xFF809B03, 0xFF80A702, 0xFF7A8B01, 0xFFA98504, 0xFF60A403,
+	0xFF3D9D04, 0xFF384701, 0xFF862C01, 0xFFC54102, 0xFF924002, 0xFF884401, 0xFF767A07, 0xFF459906,
+	0xFF815F01, 0xFF833002, 0xFF543901, 0xFF4A6000, 0xFF7F7F02, 0xFF838406, 0xFF4B7800, 0xFF756302,
+	0xFF896101, 0xFF7C7301, 0xFF5A8102, 0xFF505E01, 0xFF645F01, 0xFF776F01, 0xFF558101, 0xFF509500,
+	0xFF7E8001, 0xFF624E01, 0xFF3A3801, 0xFF685000, 0xFF897200, 0xFF887402, 0xFF4E7101, 0xFF778E06,
+	0xFF717A02, 0xFF787902, 0xFF769A02, 0xFF569302, 0xFF7E7401, 0xFF9D6401, 0xFF566902, 0xFF316F01,
+	0xFF787601, 0xFFA34401, 0xFF584A00, 0xFF4D6F02, 0xFF688C02, 0xFF8EA004, 0xFF479401, 0xFF3B9502,
+	0xFF6C9F00, 0xFF708402, 0xFF6F6300, 0xFF5F6901, 0xFF627201, 0xFF966301, 0xFF5D6800, 0xFF568600,
+	0xFF8FB803, 0xFF9ED404, 0xFF7DB204, 0xFF667F00, 0xFF686A01, 0xFF859305, 0xFF817A02, 0xFF473D00,
+	0xFF2A3302, 0xFF655F01, 0xFFAF9801, 0xFFC89E06, 0xFFA78B02, 0xFF7F5A01, 0xFF783F01, 0xFF565701,
+	0xFF786A03, 0xFF6D6601, 0xFF668B02, 0xFF59B801, 0xFF66AC05, 0xFF4F6A01, 0xFF286402, 0xFF5E6600,
+	0xFF745801, 0xFF8C5002, 0xFF475A01, 0xFF4A6E03, 0xFF7F8805, 0xFF5E6900, 0xFF704E01, 0xFF696D00,
+	0xFF6B8002, 0xFF567D04, 0xFF407201, 0xFF8E5803, 0xFF9A5E01, 0xFF724B01, 0xFF524500, 0xFF6E7F05,
+	0xFF5A5300, 0xFF7E7E03, 0xFF838B01, 0xFF5E8502, 0xFF5D8000, 0xFF8D7403, 0xFF5C5B02, 0xFF5E7401,
+	0xFF6C9404, 0xFF706A03, 0xFF565D00, 0xFF5F8302, 0xFF598300, 0xFF8A7402, 0xFF5C6801, 0xFF4C7201,
+	0xFF606602, 0xFF555602, 0xFF625600, 0xFF696C01, 0xFF568200, 0xFFA79703, 0xFF88B302, 0xFF7ACB07,
+	0xFF9AB506, 0xFF679200, 0xFF386902, 0xFF425701, 0xFF775801, 0xFF954A01, 0xFF5E5200, 0xFF2E6002,
+	0xFF447D01, 0xFF8E9C04, 0xFFA78701, 0xFF927F02, 0xFF656301, 0xFF585201, 0xFF676303, 0xFF6D8E05,
+	0xFF698E01, 0xFF778201, 0xFF96A102, 0xFF47A302, 0xFF308500, 0xFF537102, 0xFF419C04, 0xFF449104,
+	0xFF5F7302, 0xFF856B03, 0xFF455003, 0xFF665201, 0xFF836A01, 0xFF426C02, 0xFF4C7003, 0xFF765300,
+	0xFF815D02, 0xFF4C7900, 0xFF457C03, 0xFF8B7503, 0xFFA07402, 0xFF747403, 0xFF5D5301, 0xFF5F3301,
+	0xFF708A04, 0xFF535B01, 0xFF6C4601, 0xFF7E6602, 0xFF709103, 0xFF687B01, 0xFF6F5901, 0xFF966403,
+	0xFF846F02, 0xFF5A7101, 0xFF607501, 0xFF737902, 0xFF4D7D02, 0xFF696601, 0xFF7C5C01, 0xFF446100,
+	0xFF465E01, 0xFF535F01, 0xFF737C03, 0xFF739601, 0xFF649E05, 0xFFB19B06, 0xFF8D8F00, 0xFF5D7902,
+	0xFF605F01, 0xFF464100, 0xFF312C01, 0xFF686903, 0xFF7A9206, 0xFF7C6B00, 0xFF886904, 0xFF546D01,
+	0xFF797E04, 0xFF6D6C00, 0xFF864D01, 0xFF7E4600, 0xFF688102, 0xFF7DAB02, 0xFF849703, 0xFF7A9703,
+	0xFF36A000, 0xFF6F9303, 0xFF856900, 0xFF717901, 0xFF60AA07, 0xFF769B04, 0xFF677C01, 0xFF356702,
+	0xFF685D01, 0xFF6C5C03, 0xFF3E4001, 0xFF6F5002, 0xFF876403, 0xFF4F5F01, 0xFF3D6502, 0xFF586A02,
+	0xFF775501, 0xFF5A4B00, 0xFF6A7704, 0xFF7AA202, 0xFF7F8902, 0xFF736A01, 0xFF6D7A03, 0xFF7D7E01,
+	0xFF416401, 0xFF3C3C01, 0xFF8B5602, 0xFFAD6202, 0xFF7F6400, 0xFF657802, 0xFF808204, 0xFF6B5601,
+	0xFF8D4000, 0xFF8A6803, 0xFF5B7804, 0xFF546600, 0xFF4A6901, 0xFF547100, 0xFF7D7201, 0xFF537B02,
+	0xFF6B9604, 0xFF9E9D01, 0xFF909B06, 0xFF437901, 0xFF525501, 0xFF985000, 0xFF515D01, 0xFF636901,
+	0xFF7E7C00, 0xFF4C6803, 0xFF504C00, 0xFF614201, 0xFF7D6000, 0xFF799603, 0xFF937905, 0xFF4B5700,
+	0xFF7D3F01, 0xFF917200, 0xFF909801, 0xFF948D03, 0xFF9AA507, 0xFF689301, 0xFF6F7D01, 0xFF797200,
+	0xFF6A8C03, 0xFF6FB304, 0xFF577301, 0xFFA75901, 0xFF7A7101, 0xFF425802, 0xFF5D5801, 0xFF447001,
+	0xFF806603, 0xFF6B4E01, 0xFF554000, 0xFF916205, 0xFF6B6801, 0xFF484C00, 0xFF5E5701, 0xFF74A304,
+	0xFF64AC04, 0xFF5D6201, 0xFFA25702, 0xFF7A7B00, 0xFF5D7B00, 0xFF717200, 0xFF9A8D03, 0xFF8D9604,
+	0xFF2D5301, 0xFF679201, 0xFFA8B901, 0xFF889D05, 0xFF625401, 0xFF705A03, 0xFF616F04, 0xFF356802,
+	0xFF797401, 0xFFA25801, 0xFF4D3F00, 0xFF524D02, 0xFF7A7404, 0xFF5A8F03, 0xFF6A8301, 0xFF737303,
+	0xFF676601, 0xFF8A4602, 0xFF655001, 0xFF266401, 0xFF7B7105, 0xFF937106, 0xFF547001, 0xFF989603,
+	0xFF888006, 0xFF564E01, 0xFF6B7604, 0xFF3B6F00, 0xFF844102, 0xFF7A4A01, 0xFF8D5501, 0xFF496C01,
+	0xFF889902, 0xFFB6C505, 0xFF81C601, 0xFF749B01, 0xFF7A8402, 0xFF5A8002, 0xFF5F8B07, 0xFF5C6301,
+	0xFF9C6802, 0xFF697702, 0xFF526801, 0xFF9C7502, 0xFF5C6E02, 0xFF5E7502, 0xFF8D8405, 0xFF537803,
+	0xFF4E5B01, 0xFF653C01, 0xFF8C5302, 0xFFA95303, 0xFF526000, 0xFF3F8101, 0xFF6A8201, 0xFF939203,
+	0xFF639F01, 0xFF529902, 0xFF978406, 0xFF896100, 0xFF7C5101, 0xFF7E6701, 0xFF8A6900, 0xFF543B00,
+	0xFF5F7A03, 0xFF7EA702, 0xFF838D03, 0xFF3E6601, 0xFF2E5800, 0xFF6C4902, 0xFF654C00, 0xFF707004,
+	0xFF719601, 0xFF6E7604, 0xFF683E00, 0xFF6B3E01, 0xFFA24C00, 0xFF756102, 0xFF516600, 0xFF545702,
+	0xFF2C2E00, 0xFF633902, 0xFF908901, 0xFF489C05, 0xFF6D6701, 0xFF825F01, 0xFF667101, 0xFF7D6203,
+	0xFF5E5200, 0xFF837401, 0xFF88A003, 0xFF28A502, 0xFF5F8803, 0xFF7A5E00, 0xFF9C5D05, 0xFF568A01,
+	0xFF90C002, 0xFFA9BE02, 0xFF5F9002, 0xFF3C7401, 0xFF496F01, 0xFF3A6002, 0xFF304E01, 0xFF5A4A02,
+	0xFF8D6101, 0xFF536901, 0xFF8F8E04, 0xFF87A006, 0xFF388200, 0xFF4B7000, 0xFF755A01, 0xFF5F6101,
+	0xFF347800, 0xFF899002, 0xFFA48802, 0xFF9E7400, 0xFF878C03, 0xFF60B905, 0xFF5AB501, 0xFF818601,
+	0xFF554E01, 0xFF394F01, 0xFF7F5C00, 0xFF907003, 0xFF846C01, 0xFF7D5D01, 0xFF696002, 0xFF4A5401,
+	0xFF7F7C02, 0xFF696100, 0xFF4D3902, 0xFF372201, 0xFF4B4401, 0xFF7C7A05, 0xFF5F6D02, 0xFF845200,
+	0xFF895502, 0xFF546200, 0xFF6F6402, 0xFF667B01, 0xFFAB8701, 0xFF768204, 0xFF4A5200, 0xFF6C5204,
+	0xFF4C8103, 0xFF979701, 0xFF968407, 0xFF3E5D01, 0xFF6E7702, 0xFF988304, 0xFF506802, 0xFF636E01,
+	0xFF7B7F01, 0xFFB98A05, 0xFF967F03, 0xFF2EA502, 0xFF39AB04, 0xFF576201, 0xFFA24501, 0xFF8A8401,
+	0xFF82A103, 0xFF5F6E00, 0xFF3B4901, 0xFF5A5602, 0xFF6D6801, 0xFF507901, 0xFF489A02, 0xFF7F9403,
+	0xFF997504, 0xFF606F01, 0xFF916302, 0xFF5A4F01, 0xFF576C03, 0xFF4C8400, 0xFF868A03, 0xFF8D9B04,
+	0xFF44C402, 0xFF8AC807, 0xFF9DAF02, 0xFF949603, 0xFF8F7305, 0xFF715F00, 0xFF4B6200, 0xFF3E4A00,
+	0xFF382F01, 0xFF4F6103, 0xFF928204, 0xFF976901, 0xFF988001, 0xFF809702, 0xFF737B04, 0xFF577701,
+	0xFF716803, 0xFF755B00, 0xFF596B02, 0xFF524F02, 0xFF773201, 0xFFA34102, 0xFF555A01, 0xFF596D02,
+	0xFF8B6E02, 0xFF8B8704, 0xFF6D8502, 0xFF687002, 0xFFB97302, 0xFF689B04, 0xFF3E8503, 0xFF8E5401,
+	0xFF706A02, 0xFF835E03, 0xFF544C01, 0xFF5A5F01, 0xFF99A907, 0xFF6BA601, 0xFF608802, 0xFF6E8C04,
+	0xFF5A7700, 0xFF8E5100, 0xFFB23600, 0xFF606B01, 0xFF128901, 0xFF3C7A01, 0xFFBB7901, 0xFFB58C04,
+	0xFF4B7901, 0xFF4B6E03, 0xFF6F8503, 0xFF819603, 0xFF8A9802, 0xFF7D9706, 0xFF588C02, 0xFF477002,
+	0xFF7E6701, 0xFF725902, 0xFF704800, 0xFF748001, 0xFF98A602, 0xFF70B403, 0xFF7FB904, 0xFF818501,
+	0xFF537702, 0xFF5E7501, 0xFF878303, 0xFF545101, 0xFF5D2B02, 0xFF621700, 0xFF732C01, 0xFF476801,
+	0xFF556104, 0xFF9F7E02, 0xFF789602, 0xFF6D7B00, 0xFFBB8004, 0xFF767E02, 0xFF657801, 0xFF678003,
+	0xFF793B03, 0xFF973800, 0xFF6A7202, 0xFF338E02, 0xFF655403, 0xFF812901, 0xFF7A2600, 0xFF926D02,
+	0xFF8DA602, 0xFF538A02, 0xFF315E01, 0xFF743F01, 0xFFDC4101, 0xFF9E7304, 0xFF376701, 0xFF534A01,
+	0xFF6F5301, 0xFF935904, 0xFF666B03, 0xFF5A5401, 0xFFA44702, 0xFF6E5B01, 0xFF557E00, 0xFF488B03,
+	0xFF3E8B03, 0xFF558303, 0xFF9A6301, 0xFF9F5701, 0xFF54A101, 0xFF40DF03, 0xFFA2AE04, 0xFF8D5501,
+	0xFF295C03, 0xFF597B02, 0xFFA39602, 0xFF76A603, 0xFF547600, 0xFF626401, 0xFF6B7001, 0xFF609102,
+	0xFF6D9F05, 0xFF546A03, 0xFF8B5403, 0xFF969306, 0xFF6D7101, 0xFF975701, 0xFF8B6E02, 0xFF4E5002,
+	0xFF623501, 0xFF6E3E01, 0xFF674A01, 0xFF1D2501, 0xFF322202, 0xFF4D4003, 0xFF986504, 0xFF6D7201,
+	0xFF569F01, 0xFFA49201, 0xFF697800, 0xFF788202, 0xFFAD7801, 0xFF6D6E03, 0xFF8EAA06, 0xFF858503,
+	0xFF7A4B01, 0xFF786401, 0xFF807901, 0xFF3F7E00, 0xFF576701, 0xFF616801, 0xFF8F7F01, 0xFFCD7E06,
+	0xFF6D6101, 0xFF135402, 0xFF236C00, 0xFF658A02, 0xFFCC8003, 0xFF866C01, 0xFF315101, 0xFF586603,
+	0xFF736C01, 0xFF965202, 0xFF4C4201, 0xFF4A5001, 0xFFBB3E02, 0xFF9D4701, 0xFF748104, 0xFF4A7A05,
+	0xFF3B4E00, 0xFF5D6600, 0xFF848C03, 0xFFD07F02, 0xFFA48D05, 0xFF358A03, 0xFF627101, 0xFF624801,
+	0xFF395C02, 0xFF737301, 0xFFBC7301, 0xFF636A01, 0xFF4C6D02, 0xFF808404, 0xFF819A03, 0xFF668502,
+	0xFF2E4900, 0xFF274C01, 0xFF7A6601, 0xFF985900, 0xFF504C01, 0xFF9F5A05, 0xFF7F3800, 0xFF554902,
+	0xFF738005, 0xFF737101, 0xFF4C6000, 0xFF1B4401, 0xFF394602, 0xFF698A01, 0xFF727401, 0xFF704802,
+	0xFF878C02, 0xFF9AA007, 0xFF627B01, 0xFF888001, 0xFF7E7C04, 0xFF646200, 0xFF7D6203, 0xFF6A4800,
+	0xFF716C02, 0xFF8B7E02, 0xFF7E8E03, 0xFF578801, 0xFF4F9101, 0xFF6C9A04, 0xFF808902, 0xFFA85402,
+	0xFF572801, 0xFF283801, 0xFF516501, 0xFF949E04, 0xFF909804, 0xFF635101, 0xFF546401, 0xFF536B02,
+	0xFF7A6400, 0xFF908203, 0xFF33A001, 0xFF44B402, 0xFFA39503, 0xFFB58A04, 0xFF6E7702, 0xFF3D5F02,
+	0xFF4C6A02, 0xFF816E05, 0xFF695700, 0xFFB94601, 0xFF764000, 0xFF443901, 0xFF915F01, 0xFF788303,
+	0xFF468404, 0xFF6A7A00, 0xFFA96F01, 0xFF7F8401, 0xFF5E8004, 0xFF6A6301, 0xFF6F4A02, 0xFF3F3102,
+	0xFF202700, 0xFF515C03, 0xFF889A04, 0xFF667C05, 0xFF485000, 0xFF8F4E01, 0xFF654E02, 0xFF606301,
+	0xFF7B7601, 0xFF79A302, 0xFF44B303, 0xFF3BA601, 0xFF829A05, 0xFF6A9003, 0xFF4E7600, 0xFF8B7E04,
+	0xFF906701, 0xFF8F4E01, 0xFF6C6000, 0xFF796603, 0xFF4A5B01, 0xFF6A6A01, 0xFF856401, 0xFF637201,
+	0xFF829701, 0xFF9B8904, 0xFF5E5B01, 0xFF525403, 0xFF547000, 0xFF567801, 0xFF6F5B01, 0xFFA25301,
+	0xFF725F02, 0xFF626602, 0xFF676D04, 0xFF896C02, 0xFF666D00, 0xFF608301, 0xFF678401, 0xFF438001,
+	0xFF908E04, 0xFFB1A703, 0xFF4DCA05, 0xFF17AF01, 0xFF637A01, 0xFFAE5902, 0xFF786601, 0xFF477C02,
+	0xFF4F7A01, 0xFF6C8901, 0xFF5E8401, 0xFF9F6B03, 0xFF6D6501, 0xFF5B6D04, 0xFF986101, 0xFF975101,
+	0xFF5B6201, 0xFF598B04, 0xFF967803, 0xFF896305, 0xFF524C00, 0xFF6A5502, 0xFF534F00, 0xFF426701,
+	0xFF586202, 0xFF8E6604, 0xFF786702, 0xFF365B01, 0xFF487301, 0xFFA48902, 0xFF999405, 0xFF528C03,
+	0xFF5D6301, 0xFFA66504, 0xFF5B8E01, 0xFF468300, 0xFF825E01, 0xFF524901, 0xFF707E03, 0xFF889B03,
+	0xFF607101, 0xFF634C00, 0xFF785B01, 0xFF796F02, 0xFF588401, 0xFF799803, 0xFF6B7C01, 0xFF737501,
+	0xFF879E04, 0xFF656E03, 0xFF383B02, 0xFF674401, 0xFF836004, 0xFF486901, 0xFF537F03, 0xFF8D7B03,
+	0xFF6F6500, 0xFF706D01, 0xFF547E01, 0xFF496E01, 0xFF776E01, 0xFF637F04, 0xFF4B7601, 0xFF4B7C03,
+	0xFF6E8402, 0xFFA56E01, 0xFF525E02, 0xFF187801, 0xFF3B8004, 0xFFA04100, 0xFFB34C02, 0xFF6E7600,
+	0xFF6A8A02, 0xFF708B04, 0xFF709203, 0xFF97B704, 0xFF536D02, 0xFF4A4501, 0xFF8D7203, 0xFF888301,
+	0xFF837701, 0xFF3E8C01, 0xFF586B03, 0xFF612901, 0xFF773000, 0xFF7F4801, 0xFF6B7803, 0xFF529B06,
+	0xFF4E6A02, 0xFF9E5401, 0xFF936E00, 0xFF788B01, 0xFF58B303, 0xFF87A904, 0xFF968101, 0xFF396F01,
+	0xFF2E6101, 0xFF903502, 0xFF794101, 0xFF466401, 0xFF4E4901, 0xFF662701, 0xFF9C4702, 0xFF756901,
+	0xFF3C7700, 0xFF568C02, 0xFF899D03, 0xFF909E04, 0xFF679801, 0xFF6A7E01, 0xFF5E8C01, 0xFF8E9E02,
+	0xFF635702, 0xFF576501, 0xFF647901, 0xFF8F9403, 0xFF877D02, 0xFF365401, 0xFF356701, 0xFF587902,
+	0xFF666901, 0xFF906A03, 0xFF638904, 0xFF368A01, 0xFF5E6B00, 0xFF4B3C00, 0xFF562401, 0xFF633B01,
+	0xFF664C00, 0xFF823A01, 0xFF5F4201, 0xFF518E02, 0xFF2DA400, 0xFF7C7601, 0xFFB78F05, 0xFF858701,
+	0xFF667002, 0xFF5C6B01, 0xFF8A6E01, 0xFF826900, 0xFF335D01, 0xFF858203, 0xFFC08002, 0xFF7A7501,
+	0xFF948702, 0xFF398202, 0xFF197102, 0xFF465803, 0xFF804602, 0xFF913B01, 0xFF955600, 0xFF5E5801,
+	0xFF588501, 0xFF90B702, 0xFFB0BD03, 0xFFA2B201, 0xFF489D02, 0xFF576F00, 0xFF8D6E04, 0xFF416901,
+	0xFF294901, 0xFF703301, 0xFF943E02, 0xFF6C6804, 0xFF407B01, 0xFF655501, 0xFF8F4903, 0xFF5E4800,
+	0xFF416B01, 0xFF699301, 0xFF7D9001, 0xFF848503, 0xFF5D6A01, 0xFF837902, 0xFF749103, 0xFF706C00,
+	0xFF6F7401, 0xFF9E7304, 0xFF918400, 0xFF899401, 0xFF616701, 0xFF415800, 0xFF548202, 0xFF517405,
+	0xFF4A5D02, 0xFF7E4A02, 0xFFA15700, 0xFF797C04, 0xFF5B8E04, 0xFF446901, 0xFF8A5901, 0xFF807302,
+	0xFF575101, 0xFF8D2701, 0xFF8F3201, 0xFF8D7303, 0xFF45A202, 0xFF778801, 0xFF877100, 0xFF555B00,
+	0xFF736802, 0xFF5D7302, 0xFF715E01, 0xFF865B02, 0xFF5B9A03, 0xFF80AE01, 0xFFA85E04, 0xFF7C4301,
+	0xFF997102, 0xFF324E01, 0xFF094501, 0xFF4F6400, 0xFF777402, 0xFFA38B00, 0xFF9F8D04, 0xFF8A9202,
+	0xFF97C404, 0xFF66C301, 0xFF85A602, 0xFF778201, 0xFF567003, 0xFF646F00, 0xFF6E5F01, 0xFF354202,
+	0xFF4A4002, 0xFF6B5D01, 0xFF6F4D01, 0xFF865701, 0xFF687201, 0xFF667F03, 0xFF788402, 0xFF5B6B01,
+	0xFF7B8E01, 0xFF779E03, 0xFF707E01, 0xFF737403, 0xFF4E5600, 0xFF915C00, 0xFF7B7500, 0xFF6A7E02,
+	0xFF4B5A01, 0xFFA85B00, 0xFFB37402, 0xFF818304, 0xFF517D01, 0xFF778504, 0xFF567F01, 0xFF284F01,
+	0xFF4A4201, 0xFF927102, 0xFF907703, 0xFF764001, 0xFF694A01, 0xFF617503, 0xFFAD9005, 0xFF9A9603,
+	0xFF518601, 0xFF845F04, 0xFF9B4800, 0xFFAC4E02, 0xFF596501, 0xFF546801, 0xFF5C4C02, 0xFF675F01,
+	0xFF6F6F01, 0xFF5A6D00, 0xFF888601, 0xFFA77B04, 0xFF867601, 0xFF468302, 0xFF5D6102, 0xFF734B01,
+	0xFF8F5001, 0xFF3C4F01, 0xFF527201, 0xFF89AE04, 0xFF9EC704, 0xFF91BB04, 0xFF838F01, 0xFFBA9504,
+	0xFFAEA304, 0xFF587E01, 0xFF675705, 0xFF4D4B01, 0xFF734C01, 0xFF846C02, 0xFF567A03, 0xFF2E5B01,
+	0xFF615B00, 0xFF686E02, 0xFF508701, 0xFF7E7F04, 0xFF6B5C01, 0xFF797200, 0xFF696E01, 0xFF6D7602,
+	0xFF928004, 0xFF527001, 0xFF4C6900, 0xFF6A7400, 0xFF608902, 0xFF969603, 0xFF929303, 0xFF427E03,
+	0xFF5D8B03, 0xFFB09801, 0xFFB76A02, 0xFF845B03, 0xFF5D8602, 0xFF607F02, 0xFF3C6000, 0xFF446502,
+	0xFF887E04, 0xFF9B7B02, 0xFF4B5B01, 0xFF3D4A01, 0xFF885A02, 0xFF9B8303, 0xFFAA8101, 0xFF8A5601,
+	0xFF496303, 0xFF587C02, 0xFF968B03, 0xFF938001, 0xFF455400, 0xFF384502, 0xFF3C3B01, 0xFF6D4702,
+	0xFF716102, 0xFF8B9302, 0xFFA5AD05, 0xFF8B9702, 0xFF877602, 0xFF485301, 0xFF595B01, 0xFF8F6001,
+	0xFF686A01, 0xFF579D01, 0xFF96D905, 0xFF8ECE04, 0xFF83BF01, 0xFF568E01, 0xFF645D02, 0xFF964801,
+	0xFF8E3001, 0xFF5C2501, 0xFF604800, 0xFF3C6F01, 0xFF616803, 0xFFA15501, 0xFF627502, 0xFF4D7D01,
+	0xFF789003, 0xFF606701, 0xFF795E01, 0xFF767502, 0xFF4D8801, 0xFF748403, 0xFF695501, 0xFF685602,
+	0xFF665A01, 0xFF496102, 0xFF477E01, 0xFF7E9804, 0xFF769302, 0xFF5F7901, 0xFF5F5C01, 0xFF425601,
+	0xFF86A502, 0xFFA8AA01, 0xFFA97C02, 0xFF9E4E01, 0xFF564E02, 0xFF495701, 0xFF527604, 0xFF648002,
+	0xFF916E02, 0xFF8E6D00, 0xFF657400, 0xFF528F01, 0xFF899F01, 0xFFA39001, 0xFF858A01, 0xFF4B4701,
+	0xFF403600, 0xFF7D6301, 0xFF987F01, 0xFF6E6B01, 0xFF536505, 0xFF4A4E01, 0xFF484800, 0xFF784D01,
+	0xFF954E00, 0xFF9E8201, 0xFFB4A800, 0xFF97A202, 0xFF636401, 0xFF6F4803, 0xFF997B03, 0xFFA28D00,
+	0xFF799D02, 0xFF84D408, 0xFF73BA03, 0xFF587701, 0xFF877601, 0xFF446E01, 0xFF775C01, 0xFF736C03,
+	0xFF4D4D00, 0xFF7E3501, 0xFF7B4501, 0xFF516403, 0xFF568A01, 0xFF8E6E03, 0xFF686501, 0xFF6C9101,
+	0xFF718501, 0xFF536701, 0xFF946E01, 0xFF936001, 0xFF5C6D02, 0xFF4B7801, 0xFF5C5D00, 0xFF716103,
+	0xFF5E6A02, 0xFF516A01, 0xFF567401, 0xFF696F00, 0xFF526701, 0xFF2F6E01, 0xFF4B7C01, 0xFF878405,
+	0xFFAE9203, 0xFF959502, 0xFF736004, 0xFF783501, 0xFF3D2801, 0xFF714202, 0xFF8D5903, 0xFF626F03,
+	0xFF808400, 0xFFA0A304, 0xFF8CB402, 0xFF72B103, 0xFF76A300, 0xFF939504, 0xFF537202, 0xFF245402,
+	0xFF494D03, 0xFF8C4401, 0xFF834101, 0xFF733E01, 0xFF7B4502, 0xFF5E6900, 0xFF628D01, 0xFF677903,
+	0xFF965101, 0xFFAE9404, 0xFF889103, 0xFF524902, 0xFF3E4F03, 0xFF8C8602, 0xFFA89A00, 0xFF7DA400,
+	0xFF826F00, 0xFFAB6601, 0xFF576201, 0xFF616B01, 0xFF9A9303, 0xFF629905, 0xFF846F02, 0xFF844B01,
+	0xFF4C6600, 0xFF898606, 0xFF6D6705, 0xFF423B01, 0xFF4E5101, 0xFF735E02, 0xFF736502, 0xFF6A7101,
+	0xFF5F6A01, 0xFF4C8902, 0xFF81A702, 0xFF818501, 0xFF6C7203, 0xFF527701, 0xFF5B7602, 0xFF695D01,
+	0xFF575D00, 0xFF627500, 0xFF658D01, 0xFF5C7C02, 0xFF6C7403, 0xFF489D02, 0xFF38A901, 0xFF888F03,
+	0xFFA34C00, 0xFF633401, 0xFF422601, 0xFF443001, 0xFF4D6901, 0xFF969E04, 0xFFA59A02, 0xFF85AA02,
+	0xFF69B902, 0xFF7C9401, 0xFF8B7B01, 0xFF888801, 0xFF747900, 0xFF726701, 0xFF547001, 0xFF3E5A02,
+	0xFF5D4A03, 0xFF6A4F00, 0xFF634E00, 0xFF6A5E01, 0xFFA44001, 0xFFA04F00, 0xFF8F8506, 0xFF5D7401,
+	0xFF8A6E02, 0xFFA87102, 0xFF454102, 0xFF333C01, 0xFF659802, 0xFFA5CE03, 0xFFC5B605, 0xFF698B01,
+	0xFF644E01, 0xFFC25E02, 0xFF9E8601, 0xFF819B08, 0xFF717702, 0xFF6B6A01, 0xFF857702, 0xFF947402,
+	0xFF6F5A02, 0xFF7F5E03, 0xFF485800, 0xFF3A4401, 0xFF694E00, 0xFF896603, 0xFF7C7001, 0xFF6B7600,
+	0xFF718804, 0xFF579B01, 0xFF6CA403, 0xFF538201, 0xFF546600, 0xFF776A02, 0xFF908501, 0xFF708503,
+	0xFF5E7B01, 0xFF968F04, 0xFF78AC04, 0xFF469A01, 0xFF807B01, 0xFF6E9304, 0xFF368503, 0xFF6A5D01,
+	0xFF8D6505, 0xFF473601, 0xFF584303, 0xFF5A8302, 0xFF82AF01, 0xFFAEB403, 0xFFAAA602, 0xFFAFA303,
+	0xFF5E9301, 0xFF4E7001, 0xFF645202, 0xFF8F4501, 0xFF836401, 0xFF808507, 0xFF4B6E02, 0xFF4A4901,
+	0xFF7A4D01, 0xFF6B5801, 0xFF717501, 0xFF589C02, 0xFF778702, 0xFFB95E02, 0xFFA84F00, 0xFF636C00,
+	0xFF859F04, 0xFF805404, 0xFF393B01, 0xFF858C02, 0xFFBCBF06, 0xFF8CA901, 0xFF7A5D02, 0xFF574C00,
+	0xFF848A03, 0xFFB79904, 0xFFA67300, 0xFF625301, 0xFF5D5F02, 0xFFA88704, 0xFFB7A204, 0xFF748C03,
+	0xFF6A6300, 0xFF815302, 0xFF465600, 0xFF5F7902, 0xFF87A501, 0xFF9CBC04, 0xFF97B703, 0xFF699B02,
+	0xFF587701, 0xFF706A02, 0xFF4D5C03, 0xFF314901, 0xFF565700, 0xFF937F01, 0xFFA89A02, 0xFF797900,
+	0xFF5C7900, 0xFF897302, 0xFF956802, 0xFF647A00, 0xFF5E8402, 0xFF4A6301, 0xFF385200, 0xFF856201,
+	0xFF696502, 0xFF647601, 0xFFA2A003, 0xFF8DB004, 0xFF8FAF02, 0xFF9C9506, 0xFF795F00, 0xFF8F3201,
+	0xFF7E2B02, 0xFF5E5601, 0xFF359201, 0xFF667A02, 0xFFA44B01, 0xFF815803, 0xFF365C01, 0xFF6D7C03,
+	0xFF867301, 0xFF797900, 0xFF918203, 0xFF487C01, 0xFF609701, 0xFF95A102, 0xFF818C04, 0xFF828E03,
+	0xFF5E6801, 0xFF674D01, 0xFF548704, 0xFF919F04, 0xFFAD6B02, 0xFF4B3B02, 0xFF524D01, 0xFF828A07,
+	0xFF728303, 0xFF7F6700, 0xFF805301, 0xFF6B4802, 0xFF787A07, 0xFF868502, 0xFF905B01, 0xFF3F5D00,
+	0xFF698F02, 0xFF749D01, 0xFF5C9001, 0xFF8A9B02, 0xFFA6B602, 0xFF8EC404, 0xFF738C02, 0xFF5D5B02,
+	0xFF3C5301, 0xFF5F4801, 0xFF4B3F00, 0xFF576401, 0xFF718900, 0xFF9EA702, 0xFF778702, 0xFF795000,
+	0xFF956306, 0xFF626E02, 0xFF7C3E01, 0xFF703D00, 0xFF4D4E01, 0xFF5C6402, 0xFF469905, 0xFF677B02,
+	0xFF67A204, 0xFF67C401, 0xFF83AB03, 0xFF6D6601, 0xFF7A5401, 0xFF814F00, 0xFF575902, 0xFF5F5601,
+	0xFF904801, 0xFF7D4801, 0xFF527204, 0xFF4A7F02, 0xFF7E5300, 0xFF843D00, 0xFF6D7203, 0xFF7AA202,
+	0xFF7F8102, 0xFF808B02, 0xFF6F7401, 0xFF4A7A00, 0xFF769804, 0xFF807100, 0xFF796000, 0xFF6D5C02,
+	0xFF6C5401, 0xFFAF8B06, 0xFF6B9101, 0xFF505701, 0xFF6D3800, 0xFF566A00, 0xFF7F9408, 0xFF706F01,
+	0xFF616B01, 0xFF8AA103, 0xFF748D02, 0xFF694E02, 0xFF712A01, 0xFF4F4001, 0xFF6A6C01, 0xFF548E01,
+	0xFF78B001, 0xFF71AE03, 0xFF5A9F03, 0xFF727C01, 0xFF9E7202, 0xFF776F00, 0xFF4A5801, 0xFF714601,
+	0xFF506301, 0xFF649406, 0xFF758E00, 0xFF798D01, 0xFF8EA403, 0xFF9B9306, 0xFF445B01, 0xFF535100,
+	0xFF8B4B01, 0xFF824A01, 0xFF744A01, 0xFF5E4E02, 0xFF655B04, 0xFFA35D02, 0xFF596801, 0xFF487D01,
+	0xFF5B6C01, 0xFF2D6A01, 0xFF2F8101, 0xFF3B8101, 0xFF778104, 0xFF886002, 0xFF786401, 0xFF5E7901,
+	0xFF7A8608, 0xFF5F5F01, 0xFF443600, 0xFF4B4300, 0xFF777503, 0xFF7E7F02, 0xFF7E8401, 0xFF648600,
+	0xFF7A9201, 0xFF7F9404, 0xFF565D00, 0xFF807402, 0xFF7E8C06, 0xFF474B00, 0xFF4F3601, 0xFF5A5401,
+	0xFF8B7803, 0xFFA46B03, 0xFF625C01, 0xFF3D6E01, 0xFF7F7202, 0xFF739205, 0xFF3D7802, 0xFF625901,
+	0xFFAD7304, 0xFF818D02, 0xFF2B9701, 0xFF3C8302, 0xFF704F01, 0xFF8B5C03, 0xFF94A005, 0xFF8BB501,
+	0xFF85A906, 0xFF507600, 0xFF526A01, 0xFF557201, 0xFF606701, 0xFF645B00, 0xFF696B04, 0xFF667403,
+	0xFF637901, 0xFF8C9900, 0xFF849202, 0xFF787003, 0xFF936A02, 0xFF694002, 0xFF3D4600, 0xFF4B9D04,
+	0xFF47B103, 0xFF5E8602, 0xFF6D4501, 0xFF583F00, 0xFF825A00, 0xFFAE3D01, 0xFF6B4101, 0xFF7A7605,
+	0xFF4C5603, 0xFF493200, 0xFF5E4F00, 0xFF7C8102, 0xFF7E9D03, 0xFF598704, 0xFF716E00, 0xFF6E4F02,
+	0xFF784900, 0xFF585502, 0xFF394A00, 0xFF685F02, 0xFF9B7203, 0xFF6F7C01, 0xFF5D7C01, 0xFF687D01,
+	0xFF889102, 0xFF759001, 0xFF677A02, 0xFF907806, 0xFF555D02, 0xFF474501, 0xFF606404, 0xFF667901,
+	0xFF797E00, 0xFF6F6100, 0xFF6C5201, 0xFF4B8203, 0xFF778704, 0xFF685000, 0xFF256401, 0xFF54B202,
+	0xFF9EA201, 0xFF837000, 0xFF2D8000, 0xFF2E9605, 0xFF537E02, 0xFFA95901, 0xFF9E6702, 0xFF6B6001,
+	0xFF575401, 0xFF455F01, 0xFF647902, 0xFF617D06, 0xFF457E01, 0xFF5A8902, 0xFF7D8802, 0xFF6A8301,
+	0xFF567A00, 0xFF746E02, 0xFF666801, 0xFF5E5701, 0xFF7E4803, 0xFF523501, 0xFF634301, 0xFF9A7804,
+	0xFF4E8D00, 0xFF2B8300, 0xFF555501, 0xFF8C7803, 0xFFA09B02, 0xFF7C6705, 0xFF694D02, 0xFF907405,
+	0xFF4C6E02, 0xFF666A04, 0xFF7E5A01, 0xFF924702, 0xFF7D3C00, 0xFF576801, 0xFF438001, 0xFF576502,
+	0xFF7F4601, 0xFF693B00, 0xFF656600, 0xFF859401, 0xFF8A9B01, 0xFF719001, 0xFF5A8B02, 0xFF6D8302,
+	0xFF876701, 0xFF7B5602, 0xFF6F5B02, 0xFF815A01, 0xFF3F6600, 0xFF637B04, 0xFF757C01, 0xFF686F02,
+	0xFF786D03, 0xFF425601, 0xFF744A02, 0xFF925E03, 0xFF755801, 0xFF634601, 0xFF718905, 0xFF51D200,
+	0xFF79BE04, 0xFF748E04, 0xFF4B5602, 0xFF585501, 0xFF536E01, 0xFF8D5401, 0xFF7B3401, 0xFF574502,
+	0xFF7F7E05, 0xFF688401, 0xFF5D6B01, 0xFF625D00, 0xFF517003, 0xFF5E7C01, 0xFF6B7801, 0xFF757801,
+	0xFF5E7201, 0xFF4F7104, 0xFF4F7402, 0xFF416500, 0xFF675200, 0xFF484F00, 0xFF705E00, 0xFFB95502,
+	0xFF785A03, 0xFF3F6E02, 0xFF849301, 0xFFB3B704, 0xFF749001, 0xFF624B01, 0xFF823B01, 0xFF9C5903,
+	0xFF609102, 0xFF506802, 0xFF7C4700, 0xFF883D03, 0xFF8A1803, 0xFF7B2200, 0xFF545901, 0xFF6AA102,
+	0xFF609602, 0xFF796A02, 0xFFA28502, 0xFF96A003, 0xFF74AB02, 0xFF609002, 0xFF6A7C00, 0xFF616D02,
+	0xFF6E5001, 0xFF7E4A03, 0xFF625501, 0xFF674701, 0xFF615200, 0xFF839901, 0xFF6DA906, 0xFF505901,
+	0xFF683901, 0xFF5B5F01, 0xFF9E9C03, 0xFF858302, 0xFF755800, 0xFF7D6801, 0xFFAC8703, 0xFF759B02,
+	0xFF568501, 0xFF455501, 0xFF754400, 0xFF9E5101, 0xFF727B02, 0xFF6B7A01, 0xFF6B7401, 0xFF828D03,
+	0xFF858A00, 0xFF5E7002, 0xFF5F6F01, 0xFF5C6A00, 0xFF657402, 0xFF6E7A02, 0xFF557400, 0xFF695D01,
+	0xFF6A5F01, 0xFF5D7D02, 0xFF6A8602, 0xFF468002, 0xFF605901, 0xFF6A6503, 0xFF726303, 0xFF994C01,
+	0xFF675201, 0xFF508502, 0xFF97A904, 0xFF999602, 0xFF467A02, 0xFF657603, 0xFF845801, 0xFFA57102,
+	0xFF597D03, 0xFF1F5B01, 0xFF8B4102, 0xFF8B4F01, 0xFF7E4B00, 0xFF983D00, 0xFFA45D00, 0xFF948F05,
+	0xFF3D9100, 0xFF759C03, 0xFF999204, 0xFF8B7A00, 0xFF636B01, 0xFF3A6000, 0xFF6E5801, 0xFF736701,
+	0xFF868905, 0xFF6B7E02, 0xFF374501, 0xFF543B01, 0xFF8C5C03, 0xFFAE8503, 0xFF578202, 0xFF2F6701,
+	0xFF717E01, 0xFFADAD04, 0xFFA6C305, 0xFF579D01, 0xFF788C03, 0xFF837704, 0xFF844702, 0xFF652F02,
+	0xFF2C3C00, 0xFF1A5700, 0xFF708503, 0xFFAA8F06, 0xFF759301, 0xFF628903, 0xFF7A7902, 0xFF957502,
+	0xFF537101, 0xFF517501, 0xFF607A01, 0xFF548300, 0xFF6C8300, 0xFF738901, 0xFF408801, 0xFF6A7A01,
+	0xFF9C8003, 0xFF828302, 0xFF646900, 0xFF4F6802, 0xFF6D6B03, 0xFF7B4E02, 0xFF756500, 0xFF8D7F00,
+	0xFF919703, 0xFF61AF04, 0xFF656A00, 0xFF943702, 0xFF616300, 0xFF5C9502, 0xFF849503, 0xFFB29203,
+	0xFF663A01, 0xFF237B01, 0xFF74A004, 0xFFA59A07, 0xFF60A500, 0xFF7E9D01, 0xFFB49307, 0xFF978604,
+	0xFF357D01, 0xFF557901, 0xFF6F7901, 0xFF687001, 0xFF636502, 0xFF5A6C01, 0xFF798201, 0xFF968D05,
+	0xFF9C8503, 0xFF4C7402, 0xFF255902, 0xFF794A01, 0xFFA45E02, 0xFF9A4101, 0xFF623C01, 0xFF4E7F05,
+	0xFF6B9C03, 0xFFB69300, 0xFFA59903, 0xFF469803, 0xFF556501, 0xFF634801, 0xFF574601, 0xFF776302,
+	0xFF558902, 0xFF399B04, 0xFF77A606, 0xFF938703, 0xFF6F7C01, 0xFF467F01, 0xFF7B7E02, 0xFF8E6302,
+	0xFF4A6801, 0xFF557B01, 0xFF7B9200, 0xFF679703, 0xFF667C02, 0xFF978302, 0xFF60A000, 0xFF719304,
+	0xFF876902, 0xFF704001, 0xFF5B3A00, 0xFF574A01, 0xFF575D02, 0xFF826F00, 0xFFB1AB04, 0xFF91B903,
+	0xFF889103, 0xFF506701, 0xFF5A6102, 0xFFAD7C03, 0xFFAB8C03, 0xFF708904, 0xFF535F01, 0xFF863F01,
+	0xFF985A01, 0xFF4B8603, 0xFF559501, 0xFFAE8900, 0xFF819D02, 0xFF76B303, 0xFF6C8101, 0xFF624B02,
+	0xFF5C5101, 0xFF867804, 0xFF8D8704, 0xFF4A7600, 0xFF557602, 0xFF806F06, 0xFF865F01, 0xFF725300,
+	0xFF6C4101, 0xFF5C5501, 0xFF349601, 0xFF7B9A04, 0xFF8F7501, 0xFF6F7102, 0xFF775F01, 0xFF6B5E01,
+	0xFF6C6D01, 0xFFB17904, 0xFF985401, 0xFF414D01, 0xFF756E01, 0xFF999405, 0xFF6BAC04, 0xFF8B9805,
+	0xFF4C8101, 0xFF597E01, 0xFF7B6B00, 0xFF6D5902, 0xFF776200, 0xFF5C8E01, 0xFF6BA205, 0xFF628101,
+	0xFF677B01, 0xFF86A404, 0xFF819D01, 0xFF597100, 0xFF535F01, 0xFFA75604, 0xFF815D02, 0xFF5C5200,
+	0xFF723C01, 0xFF533C00, 0xFF583A00, 0xFF745F01, 0xFF779B01, 0xFF99BC03, 0xFFA19B04, 0xFF797201,
+	0xFF5A6601, 0xFF737200, 0xFF908C03, 0xFF897A03, 0xFF895602, 0xFF594D01, 0xFF407401, 0xFF837E02,
+	0xFF7F9F02, 0xFF555E01, 0xFF644001, 0xFFB36102, 0xFF9B5E03, 0xFF655302, 0xFF2C5101, 0xFF396D01,
+	0xFF945B04, 0xFF9D4A00, 0xFF794902, 0xFF415002, 0xFF5B5900, 0xFF755602, 0xFF6D4D00, 0xFF7B4302,
+	0xFF7A5802, 0xFF736B04, 0xFF5A7F00, 0xFF6C8D04, 0xFF637B01, 0xFF6C9A03, 0xFF64A204, 0xFF577302,
+	0xFF877804, 0xFFA67A03, 0xFF5C4200, 0xFF5A5E02, 0xFF8C8C05, 0xFF9BA102, 0xFF5DA001, 0xFF645101,
+	0xFF5D4002, 0xFF6B7D02, 0xFF878C03, 0xFF6C8802, 0xFF838A01, 0xFF709A01, 0xFF549A03, 0xFF397E01,
+	0xFF816B01, 0xFFA07904, 0xFF646B01, 0xFF545A02, 0xFF475F01, 0xFF7F5202, 0xFF854600, 0xFF5C5E01,
+	0xFF6C6300, 0xFF666300, 0xFF859305, 0xFFB0AC05, 0xFF979804, 0xFF6D7601, 0xFF6E6401, 0xFF837503,
+	0xFF6E7D03, 0xFF836E01, 0xFF845B02, 0xFF5C6001, 0xFF8A7202, 0xFF8A6C02, 0xFF809D04, 0xFF54C001,
+	0xFF419B04, 0xFF394502, 0xFF882F01, 0xFFC14302, 0xFF934102, 0xFF894401, 0xFF787906, 0xFF429A07,
+	0xFF7F5D01, 0xFF843100, 0xFF543801, 0xFF4A5E02, 0xFF7C8302, 0xFF838306, 0xFF4C7801, 0xFF726401,
+	0xFF886003, 0xFF7B7301, 0xFF5A8103, 0xFF545B01, 0xFF635E01, 0xFF747201, 0xFF5A7F01, 0xFF519501,
+	0xFF7C7F01, 0xFF645002, 0xFF3A3901, 0xFF685101, 0xFF897200, 0xFF877402, 0xFF4D7101, 0xFF788E04,
+	0xFFA78805, 0xFF738301, 0xFF678D02, 0xFF587502, 0xFF8B7901, 0xFF8B8901, 0xFF508802, 0xFF2B6900,
+	0xFF904401, 0xFFBE3E02, 0xFF684402, 0xFF545001, 0xFF517700, 0xFF788F03, 0xFF748C05, 0xFF4C9601,
+	0xFF67B704, 0xFF87B703, 0xFFA1A803, 0xFF787B02, 0xFF685E01, 0xFF806A04, 0xFF7B7904, 0xFF636E02,
+	0xFF5C6C00, 0xFF958202, 0xFF9B8B01, 0xFF7F9B02, 0xFF80A703, 0xFF7A8B01, 0xFFA88504, 0xFF5DA303,
+	0xFF2A3202, 0xFF655F02, 0xFFAF9802, 0xFFC89D08, 0xFFA78A02, 0xFF7F5901, 0xFF784001, 0xFF515901,
+	0xFF7B6B02, 0xFF6C6800, 0xFF658C00, 0xFF5BB602, 0xFF66AD05, 0xFF4F6A01, 0xFF276302, 0xFF5E6800,
+	0xFF745900, 0xFF8E4E01, 0xFF485B01, 0xFF486D03, 0xFF808A02, 0xFF5D6702, 0xFF6E4F01, 0xFF6B6D00,
+	0xFF678203, 0xFF567E02, 0xFF407004, 0xFF8F5904, 0xFF9B5D01, 0xFF6F4D01, 0xFF524501, 0xFF6E8004,
+	0xFF717E02, 0xFF7B7801, 0xFF749902, 0xFF589301, 0xFF7E7402, 0xFF9D6302, 0xFF566B00, 0xFF327001,
+	0xFF797601, 0xFFA44501, 0xFF554C03, 0xFF4D7002, 0xFF678D01, 0xFF8F9F03, 0xFF439500, 0xFF3D9601,
+	0xFF6C9D02, 0xFF728501, 0xFF716501, 0xFF5E6801, 0xFF617401, 0xFF996302, 0xFF5E6601, 0xFF588502,
+	0xFF8BB802, 0xFF9ED404, 0xFF7EB102, 0xFF668002, 0xFF696B01, 0xFF829504, 0xFF7F7A02, 0xFF4B3C01,
+	0xFF447C01, 0xFF909D06, 0xFFA78702, 0xFF917F00, 0xFF666301, 0xFF595201, 0xFF686302, 0xFF6E8E05,
+	0xFF688F01, 0xFF788200, 0xFF96A203, 0xFF47A202, 0xFF308600, 0xFF527002, 0xFF449B01, 0xFF459003,
+	0xFF5E7301, 0xFF826B03, 0xFF4A4F04, 0xFF635401, 0xFF836A04, 0xFF426D00, 0xFF4F7003, 0xFF745501,
+	0xFF825C04, 0xFF507701, 0xFF467F01, 0xFF8B7502, 0xFFA17501, 0xFF747402, 0xFF5E5301, 0xFF5D3100,
+	0xFF5D5201, 0xFF7F7D03, 0xFF838B01, 0xFF5A8601, 0xFF5D8001, 0xFF8D7402, 0xFF5B5B02, 0xFF5E7401,
+	0xFF689705, 0xFF746904, 0xFF555C00, 0xFF5F8500, 0xFF5A8200, 0xFF887502, 0xFF5C6802, 0xFF497301,
+	0xFF5D6801, 0xFF555302, 0xFF625601, 0xFF696C01, 0xFF578100, 0xFFA89802, 0xFF85B504, 0xFF7CCC03,
+	0xFF9AB404, 0xFF689201, 0xFF366A01, 0xFF435602, 0xFF785701, 0xFF964902, 0xFF5C5200, 0xFF336003,
+	0xFF7B7B05, 0xFF6E6A01, 0xFF864D02, 0xFF7E4501, 0xFF688301, 0xFF7EAB04, 0xFF829701, 0xFF789804,
+	0xFF3B9D00, 0xFF6F9301, 0xFF836700, 0xFF717901, 0xFF60AA07, 0xFF759A04, 0xFF657D02, 0xFF336803,
+	0xFF685E01, 0xFF6E5B01, 0xFF3A4100, 0xFF6F5002, 0xFF866402, 0xFF4F5E02, 0xFF3D6601, 0xFF596B01,
+	0xFF775502, 0xFF594B00, 0xFF697904, 0xFF78A302, 0xFF808A03, 0xFF736A01, 0xFF6D7B00, 0xFF7E7D03,
+	0xFF718D03, 0xFF545B02, 0xFF6D4502, 0xFF7F6A00, 0xFF719103, 0xFF677A01, 0xFF705B01, 0xFF956302,
+	0xFF896D02, 0xFF5B7301, 0xFF607502, 0xFF737A01, 0xFF4D7D03, 0xFF696601, 0xFF7C5C01, 0xFF475F01,
+	0xFF465C01, 0xFF556101, 0xFF707D03, 0xFF779301, 0xFF619E05, 0xFFB39B05, 0xFF8D8E00, 0xFF5B7903,
+	0xFF625F00, 0xFF444101, 0xFF352B01, 0xFF6A6705, 0xFF789501, 0xFF7E6A02, 0xFF886902, 0xFF566E01,
+	0xFF824001, 0xFF8E7501, 0xFF909904, 0xFF948D01, 0xFF98A707, 0xFF6A9101, 0xFF717D01, 0xFF7B7300,
+	0xFF6A8E01, 0xFF6EB304, 0xFF567102, 0xFFA75A01, 0xFF787001, 0xFF425902, 0xFF5F5701, 0xFF466F00,
+	0xFF7F6604, 0xFF6B4E01, 0xFF554002, 0xFF906201, 0xFF6B6901, 0xFF494C01, 0xFF5E5700, 0xFF70A505,
+	0xFF68A905, 0xFF586400, 0xFF9F5600, 0xFF7D7A01, 0xFF5F7D00, 0xFF717101, 0xFF9A8D03, 0xFF919901,
+	0xFF406202, 0xFF3D3C01, 0xFF895801, 0xFFAC6402, 0xFF7F6400, 0xFF657801, 0xFF808205, 0xFF6B5601,
+	0xFF8C4000, 0xFF8A6803, 0xFF5B7802, 0xFF536502, 0xFF4A6901, 0xFF557201, 0xFF7D7201, 0xFF527B02,
+	0xFF6B9702, 0xFF9E9D03, 0xFF909B06, 0xFF437901, 0xFF525300, 0xFF965101, 0xFF535E00, 0xFF606902,
+	0xFF827C02, 0xFF506603, 0xFF4D4E01, 0xFF5F4301, 0xFF7E5E01, 0xFF779803, 0xFF927A02, 0xFF4F5601,
+	0xFF869801, 0xFFB5C504, 0xFF84C302, 0xFF739B01, 0xFF7C8501, 0xFF5B7F01, 0xFF5D8D05, 0xFF5B6402,
+	0xFF9D6904, 0xFF697601, 0xFF536A01, 0xFF9C7602, 0xFF5D6F02, 0xFF5E7502, 0xFF8E8305, 0xFF507A02,
+	0xFF4E5B01, 0xFF653C01, 0xFF8A5201, 0xFFA85202, 0xFF565E00, 0xFF3E8200, 0xFF6E8202, 0xFF919301,
+	0xFF659F00, 0xFF509A02, 0xFF978103, 0xFF876300, 0xFF7D5002, 0xFF7C6801, 0xFF8B6601, 0xFF533B01,
+	0xFF275501, 0xFF6A9203, 0xFFA9BA04, 0xFF879E02, 0xFF615502, 0xFF715702, 0xFF616F03, 0xFF356902,
+	0xFF797303, 0xFFA25801, 0xFF4D4000, 0xFF524E01, 0xFF797503, 0xFF5B8D04, 0xFF688301, 0xFF737102,
+	0xFF696500, 0xFF874702, 0xFF655200, 0xFF2B6301, 0xFF777205, 0xFF937003, 0xFF527102, 0xFF979705,
+	0xFF888002, 0xFF574F00, 0xFF6C7504, 0xFF396F01, 0xFF824201, 0xFF7A4B02, 0xFF8F5101, 0xFF4C6D01,
+	0xFF92BE04, 0xFFA8BF03, 0xFF5D8F02, 0xFF3C7501, 0xFF486E02, 0xFF3A5F02, 0xFF314E01, 0xFF5B4802,
+	0xFF8E6301, 0xFF546A00, 0xFF8F8E05, 0xFF86A006, 0xFF358401, 0xFF4D6E01, 0xFF735B01, 0xFF616001,
+	0xFF347700, 0xFF8B9004, 0xFFA58902, 0xFF9D7301, 0xFF868E02, 0xFF5EBA05, 0xFF59B603, 0xFF808704,
+	0xFF565001, 0xFF364F01, 0xFF805B00, 0xFF8E7102, 0xFF856B01, 0xFF7E5D02, 0xFF676202, 0xFF4A5101,
+	0xFF657A02, 0xFF7EA403, 0xFF858E04, 0xFF3B6701, 0xFF315701, 0xFF6B4A00, 0xFF654C00, 0xFF707003,
+	0xFF719504, 0xFF6E7703, 0xFF683E01, 0xFF693D01, 0xFFA24D02, 0xFF746201, 0xFF526402, 0xFF525701,
+	0xFF2F2E01, 0xFF603902, 0xFF8F8704, 0xFF449E02, 0xFF6E6700, 0xFF846003, 0xFF697001, 0xFF7C6402,
+	0xFF5D5200, 0xFF837401, 0xFF8A9F03, 0xFF28A702, 0xFF628702, 0xFF775D00, 0xFF9C5E03, 0xFF568F02,
+	0xFF849F01, 0xFF616D02, 0xFF3B4901, 0xFF5A5601, 0xFF6E6602, 0xFF4F7900, 0xFF479804, 0xFF809404,
+	0xFF997501, 0xFF617101, 0xFF916302, 0xFF5A4F01, 0xFF566D03, 0xFF4F8400, 0xFF838A00, 0xFF8F9906,
+	0xFF44C602, 0xFF8AC704, 0xFF9DAF01, 0xFF969605, 0xFF8F7201, 0xFF705F02, 0xFF4B6300, 0xFF3E4901,
+	0xFF362F01, 0xFF526101, 0xFF8F8505, 0xFF976901, 0xFF998003, 0xFF819703, 0xFF717D01, 0xFF577701,
+	0xFF7E7D04, 0xFF676101, 0xFF4B3902, 0xFF382101, 0xFF4A4500, 0xFF7D7805, 0xFF5D6F01, 0xFF875201,
+	0xFF865701, 0xFF546200, 0xFF6F6502, 0xFF667B01, 0xFFAC8702, 0xFF758303, 0xFF495201, 0xFF6E5300,
+	0xFF4E8003, 0xFF959805, 0xFF958403, 0xFF3D5C01, 0xFF6E7701, 0xFF978205, 0xFF506901, 0xFF626E01,
+	0xFF7B7E04, 0xFFB98A05, 0xFF948202, 0xFF2DA601, 0xFF37AA03, 0xFF596001, 0xFFA14501, 0xFF8A8402,
+	0xFF4D7602, 0xFF4D6E00, 0xFF6F8604, 0xFF859203, 0xFF859804, 0xFF7A9803, 0xFF5A9101, 0xFF4A7202,
+	0xFF7D6701, 0xFF715901, 0xFF704800, 0xFF778002, 0xFF98A302, 0xFF6FB204, 0xFF82B505, 0xFF7D8301,
+	0xFF557502, 0xFF5E7601, 0xFF847F03, 0xFF545101, 0xFF5B2B01, 0xFF611801, 0xFF732F01, 0xFF486801,
+	0xFF546301, 0xFF9D8004, 0xFF789602, 0xFF6E7902, 0xFFBC7E03, 0xFF767E01, 0xFF697702, 0xFF6A7D03,
+	0xFF776404, 0xFF755A02, 0xFF5B6904, 0xFF524F01, 0xFF763502, 0xFF9F4302, 0xFF585803, 0xFF5B6F02,
+	0xFF8B6F01, 0xFF888406, 0xFF6D8203, 0xFF667001, 0xFFB97300, 0xFF6C9703, 0xFF3C8401, 0xFF8B5402,
+	0xFF6E6B01, 0xFF855D02, 0xFF554C01, 0xFF5A5E02, 0xFF99A705, 0xFF6CA302, 0xFF5F8801, 0xFF6C8C03,
+	0xFF597900, 0xFF8D5201, 0xFFB43800, 0xFF5F6B03, 0xFF188802, 0xFF3B7D01, 0xFFBA7802, 0xFFAF8804,
+	0xFF4E6A02, 0xFF8E8602, 0xFF627302, 0xFF6C8902, 0xFF456802, 0xFF8B6902, 0xFF7D5D02, 0xFF6C5102,
+	0xFF6D5B02, 0xFF3C4602, 0xFF474D02, 0xFF796302, 0xFF879703, 0xFF747C02, 0xFF7E7102, 0xFF7E7503,
+	0xFF814901, 0xFF597B02, 0xFF675402, 0xFF9A6502, 0xFF587802, 0xFF4B6602, 0xFFB26903, 0xFF465902,
+	0xFF835B02, 0xFF555402, 0xFF9A4A01, 0xFF578103, 0xFF4D7001, 0xFFA37302, 0xFF5BA403, 0xFF7C6F02,
+	0xFF5A7B02, 0xFF927302, 0xFF626101, 0xFF514C02, 0xFF575403, 0xFF697603, 0xFF706701, 0xFF6C7502,
+	0xFF7E7902, 0xFF479B02, 0xFF717402, 0xFF748302, 0xFF785C01, 0xFF756402, 0xFF617902, 0xFF727302,
+	0xFF878303, 0xFF627102, 0xFF588403, 0xFF8F6401, 0xFF554A02, 0xFF757903, 0xFF707601, 0xFF557502,
+	0xFF928701, 0xFF37B204, 0xFF9A7B02, 0xFF596F01, 0xFF627602, 0xFF876302, 0xFF605201, 0xFF8E6602,
+	0xFF648203, 0xFF455802, 0xFF823E01, 0xFF6B7003, 0xFF757E01, 0xFF969B02, 0xFF609B02, 0xFF677202,
+	0xFF564401, 0xFF6F5302, 0xFF575001, 0xFF825102, 0xFF4E8001, 0xFF879403, 0xFF6C7E01, 0xFF758A02,
+	0xFF6B7201, 0xFF656402, 0xFF636702, 0xFF5B7703, 0xFF766901, 0xFF4D8001, 0xFF616501, 0xFF545501,
+	0xFF7E5E03, 0xFF476A01, 0xFF617701, 0xFF997502, 0xFF677C02, 0xFF858803, 0xFF556402, 0xFF967A03,
+	0xFF655801, 0xFF4D7101, 0xFF93A103, 0xFF999102, 0xFF82AB04, 0xFF6C7301, 0xFF6D6502, 0xFF4A5E01,
+	0xFF605A02, 0xFF726A02, 0xFF6C7101, 0xFF6A7402, 0xFF768703, 0xFF677402, 0xFF757401, 0xFF6E8202,
+	0xFF806603, 0xFF938402, 0xFF5B7102, 0xFF487102, 0xFF695602, 0xFF886202, 0xFF5B6D02, 0xFF947D02,
+	0xFF6E5902, 0xFF9A4E01, 0xFF587E02, 0xFF695E01, 0xFF666F02, 0xFF8A6E02, 0xFF699002, 0xFF7D5401,
+	0xFF6F9E03, 0xFF7BB602, 0xFF6A8C02, 0xFF795C01, 0xFF6E3601, 0xFF5B5802, 0xFF7A6D02, 0xFF607B01,
+	0xFF687802, 0xFF856802, 0xFF5A7D02, 0xFF685B01, 0xFF576301, 0xFF617F03, 0xFF557802, 0xFF5B6D02,
+	0xFF8F9E02, 0xFFA06402, 0xFF586A02, 0xFF4D6F02, 0xFF917502, 0xFF4F6B01, 0xFF948402, 0xFF816901,
+	0xFF585E02, 0xFF8B7D03, 0xFF475301, 0xFF5B4501, 0xFF8D7201, 0xFF9EA403, 0xFF675E02, 0xFF887101,
+	0xFF956201, 0xFF767B02, 0xFF768303, 0xFF886902, 0xFF726A02, 0xFF4A5102, 0xFF6E5902, 0xFF726F01,
+	0xFF5C8602, 0xFF719403, 0xFF636E01, 0xFF707701, 0xFF6B7702, 0xFF609402, 0xFF688902, 0xFF598602,
+	0xFF936802, 0xFF5D3C02, 0xFF645D01, 0xFF878302, 0xFF819D02, 0xFF849A03, 0xFF7C8501, 0xFF446302,
+	0xFF664B01, 0xFF704A01, 0xFF884F01, 0xFF6E8003, 0xFF9F7102, 0xFF555602, 0xFF758F03, 0xFF959F02,
+	0xFF8C8304, 0xFF7C5902, 0xFF817803, 0xFF7E7A03, 0xFF717901, 0xFF637F02, 0xFF96B603, 0xFF748E02,
+	0xFF5A5E02, 0xFF485202, 0xFF7E8201, 0xFF847B02, 0xFF766F02, 0xFF785601, 0xFF546702, 0xFF5B7202,
+	0xFF685F02, 0xFF798602, 0xFF97AA04, 0xFF987702, 0xFF616101, 0xFF646A02, 0xFF8A6303, 0xFF4D6302,
+	0xFF786401, 0xFF688402, 0xFF8A8702, 0xFF857601, 0xFF726B03, 0xFF6A7B03, 0xFF8F8403, 0xFF696103,
+	0xFF868304, 0xFF517E02, 0xFF6F4601, 0xFF789303, 0xFF709F02, 0xFF5D7E02, 0xFF766901, 0xFF635F02,
+	0xFF688302, 0xFF7C8701, 0xFF877803, 0xFF486401, 0xFF6D7302, 0xFF664701, 0xFF8F5303, 0xFF636602,
+	0xFF569002, 0xFF588502, 0xFF7E6201, 0xFF636302, 0xFF7A5D03, 0xFF4A5A02, 0xFF7D6002, 0xFF728701,
+	0xFF7E8D02, 0xFF647102, 0xFF6F7803, 0xFF645201, 0xFF926F02, 0xFF586E02, 0xFF6E6A02, 0xFF657603,
+	0xFF829702, 0xFF407102, 0xFF786701, 0xFF765002, 0xFF616E02, 0xFF616F03, 0xFF547C01, 0xFF727F02,
+	0xFF5E7302, 0xFF566601, 0xFF5F4801, 0xFF8A5C02, 0xFF4C7601, 0xFF858702, 0xFF7D7803, 0xFF885503,
+	0xFF515802, 0xFF7A5E02, 0xFF6B7203, 0xFF5E6901, 0xFF6F4801, 0xFF636A02, 0xFF828702, 0xFF628201,
+	0xFF7F7702, 0xFF7A6903, 0xFF4F6101, 0xFF697202, 0xFF696A01, 0xFF6F6002, 0xFF6F5C01, 0xFF509C02,
+	0xFF3C5B02, 0xFF8B6A03, 0xFF6D8502, 0xFF7F7B02, 0xFF637902, 0xFF5C7501, 0xFF6C7F01, 0xFF5A7401,
+	0xFF797802, 0xFF597602, 0xFF6D5E02, 0xFF836501, 0xFF6A8702, 0xFF8A7802, 0xFF5A7B02, 0xFF9A7D03,
+	0xFF497402, 0xFF874501, 0xFF873001, 0xFF7E7902, 0xFF628B01, 0xFF968C03, 0xFF5D8202, 0xFF6A6A01,
+	0xFF776802, 0xFF564801, 0xFF897303, 0xFF517B02, 0xFF7A7002, 0xFF87A003, 0xFF7B7102, 0xFF826602,
+	0xFF4D8902, 0xFF7D7C03, 0xFF637B01, 0xFF758102, 0xFF638102, 0xFF6D8F01, 0xFF7E6E02, 0xFF6A7901,
+	0xFF704801, 0xFF604701, 0xFF7A8902, 0xFF989D03, 0xFF697402, 0xFF887902, 0xFF7F6D02, 0xFF696402,
+	0xFF5B6601, 0xFF879603, 0xFF75A402, 0xFF867A04, 0xFF5B7002, 0xFF6C7902, 0xFF646E01, 0xFF827003,
+	0xFF6D6402, 0xFF537402, 0xFF906101, 0xFF645E02, 0xFF918501, 0xFF727502, 0xFF716C02, 0xFF707B02,
+	0xFF777303, 0xFF6C8602, 0xFF838902, 0xFF428201, 0xFF9B5901, 0xFF5D5602, 0xFF636F02, 0xFF687201,
+	0xFF708D03, 0xFF949804, 0xFF7B7502, 0xFF747003, 0xFF787601, 0xFF7F7902, 0xFF848502, 0xFF76A303,
+	0xFF537802, 0xFF984302, 0xFF874D02, 0xFF487504, 0xFF8D4D02, 0xFF564C01, 0xFF746E02, 0xFF6A5B01,
+	0xFF7D6502, 0xFF5C7B02, 0xFF6B7902, 0xFF588B02, 0xFF847003, 0xFF564901, 0xFF8E8503, 0xFF617C02,
+	0xFF707102, 0xFF6B8F02, 0xFF817301, 0xFF506A02, 0xFF7E6E02, 0xFF576601, 0xFF768902, 0xFF4B8101,
+	0xFF647802, 0xFF666401, 0xFF7D7C01, 0xFF6D9B02, 0xFF8CB503, 0xFF577C02, 0xFF7E6802, 0xFF555A01,
+	0xFF586B02, 0xFFAC8F03, 0xFF796701, 0xFF696203, 0xFF717802, 0xFF67A202, 0xFF4E8302, 0xFF437E03,
+	0xFF796202, 0xFF4F5B02, 0xFF697202, 0xFF676001, 0xFF647502, 0xFF686F03, 0xFF886402, 0xFF5F5302,
+	0xFF506102, 0xFF895902, 0xFF6F7A02, 0xFF7C6502, 0xFF7D6202, 0xFF617302, 0xFF556F01, 0xFF646B01,
+	0xFF697C02, 0xFF6E8A03, 0xFF807803, 0xFF687401, 0xFF5C6101, 0xFF534901, 0xFF7B7D02, 0xFF6F6A03,
+	0xFF7D6701, 0xFF8A6E01, 0xFF7A9903, 0xFF7A8702, 0xFF609D03, 0xFF7D6C01, 0xFF658404, 0xFF4F6B01,
+	0xFF705B02, 0xFF654D02, 0xFF625E01, 0xFF5A7202, 0xFF656C02, 0xFF807B02, 0xFF707801, 0xFF848703,
+	0xFF5C8202, 0xFF7C9203, 0xFF5B5402, 0xFF5B6503, 0xFF7F7602, 0xFF5D4201, 0xFF7B6C02, 0xFF616D02,
+	0xFF604501, 0xFF597602, 0xFF7F6A03, 0xFF747602, 0xFF706502, 0xFF568B02, 0xFF765C02, 0xFF726A02,
+	0xFF9EB703, 0xFF649901, 0xFF567502, 0xFF516203, 0xFF796A02, 0xFF818303, 0xFF4F7501, 0xFF6D6E03,
+	0xFF5C6801, 0xFF9E6902, 0xFF5E8A02, 0xFF769402, 0xFF517501, 0xFF8C6C02, 0xFF7F6001, 0xFF645601,
+	0xFF746801, 0xFF4C4502, 0xFF784C02, 0xFF646201, 0xFF7D6B02, 0xFF6B7502, 0xFF918603, 0xFF615F02,
+	0xFF767802, 0xFF616303, 0xFF839204, 0xFF607B02, 0xFF877402, 0xFF767102, 0xFF388402, 0xFFA77402,
+	0xFF5E7E02, 0xFF616F02, 0xFF718403, 0xFF5A8B02, 0xFF7A6902, 0xFF745F01, 0xFF6B9302, 0xFF859903,
+	0xFF609E03, 0xFF838602, 0xFF704502, 0xFF515001, 0xFF5F5C03, 0xFF847F02, 0xFF928502, 0xFF667B02,
+	0xFF814901, 0xFF577E01, 0xFF685302, 0xFF9A6402, 0xFF587902, 0xFF4B6501, 0xFFB36802, 0xFF455A02,
+	0xFF835B02, 0xFF565402, 0xFF9B4A02, 0xFF578103, 0xFF4B7102, 0xFFA37102, 0xFF5BA603, 0xFF7D6F02,
+	0xFF4C6A02, 0xFF8E8602, 0xFF617302, 0xFF6D8802, 0xFF466802, 0xFF8D6A03, 0xFF7D5C02, 0xFF6B5002,
+	0xFF6E5902, 0xFF3B4501, 0xFF484D02, 0xFF7A6502, 0xFF879703, 0xFF737D01, 0xFF7F7102, 0xFF7F7603,
+	0xFF868302, 0xFF617102, 0xFF598502, 0xFF8E6302, 0xFF554902, 0xFF757703, 0xFF6E7602, 0xFF547501,
+	0xFF938703, 0xFF37B302, 0xFF9A7D03, 0xFF5B6E02, 0xFF627702, 0xFF886301, 0xFF615302, 0xFF8E6502,
+	0xFF597B02, 0xFF927403, 0xFF616102, 0xFF514C01, 0xFF565302, 0xFF677603, 0xFF716701, 0xFF6C7403,
+	0xFF7E7802, 0xFF489B01, 0xFF707403, 0xFF748303, 0xFF795D01, 0xFF766402, 0xFF617802, 0xFF727201,
+	0xFF6A7203, 0xFF656302, 0xFF626702, 0xFF5B7702, 0xFF756901, 0xFF4E8002, 0xFF616501, 0xFF545402,
+	0xFF7F5E01, 0xFF476A02, 0xFF617701, 0xFF977602, 0xFF677C02, 0xFF858802, 0xFF556402, 0xFF947B02,
+	0xFF648302, 0xFF465702, 0xFF823E01, 0xFF6C7003, 0xFF757F02, 0xFF979A01, 0xFF609A02, 0xFF677202,
+	0xFF564501, 0xFF705302, 0xFF565001, 0xFF805002, 0xFF4F8001, 0xFF879403, 0xFF6C7E01, 0xFF748A02,
+	0xFF806702, 0xFF948402, 0xFF5B7002, 0xFF497102, 0xFF695702, 0xFF886302, 0xFF5A6E02, 0xFF947D03,
+	0xFF6E5702, 0xFF994F02, 0xFF5A7E01, 0xFF685E01, 0xFF666E01, 0xFF8A6F02, 0xFF6A9002, 0xFF7D5302,
+	0xFF665801, 0xFF4D7202, 0xFF92A003, 0xFF9A9103, 0xFF81AA03, 0xFF6C7302, 0xFF6C6602, 0xFF4A5E02,
+	0xFF605A01, 0xFF716B02, 0xFF6D7001, 0xFF6A7502, 0xFF768702, 0xFF667401, 0xFF757401, 0xFF6E8102,
+	0xFF8F9D02, 0xFFA16402, 0xFF576B02, 0xFF4E6F02, 0xFF917502, 0xFF506A01, 0xFF948302, 0xFF816A01,
+	0xFF585E02, 0xFF8C7D02, 0xFF475302, 0xFF5A4601, 0xFF8C7101, 0xFF9FA402, 0xFF685D02, 0xFF897101,
+	0xFF6F9E03, 0xFF7CB603, 0xFF698C01, 0xFF795B02, 0xFF6D3601, 0xFF5A5801, 0xFF7A6D02, 0xFF617A01,
+	0xFF677902, 0xFF866801, 0xFF5A7C02, 0xFF685A02, 0xFF586402, 0xFF617E02, 0xFF567801, 0xFF5D6D02,
+	0xFF926A02, 0xFF5C3B02, 0xFF645C02, 0xFF868303, 0xFF819D02, 0xFF849A02, 0xFF7C8601, 0xFF426402,
+	0xFF674B02, 0xFF714B01, 0xFF874F01, 0xFF6D8003, 0xFF9E7102, 0xFF555602, 0xFF758F03, 0xFF95A002,
+	0xFF956001, 0xFF767C03, 0xFF768303, 0xFF886902, 0xFF716903, 0xFF4C5002, 0xFF6D5902, 0xFF716F01,
+	0xFF5D8602, 0xFF709502, 0xFF626E02, 0xFF717702, 0xFF6B7701, 0xFF609402, 0xFF698803, 0xFF588702,
+	0xFF685E02, 0xFF788603, 0xFF97AA03, 0xFF987702, 0xFF626101, 0xFF646902, 0xFF8A6303, 0xFF4E6402,
+	0xFF796401, 0xFF698402, 0xFF898702, 0xFF847502, 0xFF736A03, 0xFF697B03, 0xFF908403, 0xFF696003,
+	0xFF8B8303, 0xFF7D5801, 0xFF817904, 0xFF7F7A02, 0xFF727901, 0xFF637F01, 0xFF96B703, 0xFF748E02,
+	0xFF595F01, 0xFF485201, 0xFF7E8201, 0xFF847B01, 0xFF776F03, 0xFF795701, 0xFF546602, 0xFF5B7202,
+	0xFF568F02, 0xFF578502, 0xFF7F6102, 0xFF636301, 0xFF7A5D03, 0xFF4B5B02, 0xFF7E6101, 0xFF728802,
+	0xFF7E8D02, 0xFF647001, 0xFF6F7803, 0xFF645201, 0xFF937103, 0xFF576D01, 0xFF6D6A02, 0xFF647503,
+	0xFF868303, 0xFF517D02, 0xFF6F4502, 0xFF779402, 0xFF709F03, 0xFF5D7E02, 0xFF766901, 0xFF635F02,
+	0xFF698202, 0xFF7B8702, 0xFF897803, 0xFF486401, 0xFF6D7302, 0xFF664701, 0xFF8E5402, 0xFF626702,
+	0xFF525802, 0xFF7B5C01, 0xFF6B7202, 0xFF5E6901, 0xFF6E4801, 0xFF636901, 0xFF818602, 0xFF638202,
+	0xFF807802, 0xFF7A6A03, 0xFF506102, 0xFF697202, 0xFF696901, 0xFF6F5F02, 0xFF6E5D02, 0xFF4F9C02,
+	0xFF849802, 0xFF407002, 0xFF776601, 0xFF775002, 0xFF616D02, 0xFF617002, 0xFF547D02, 0xFF727F01,
+	0xFF5E7302, 0xFF556601, 0xFF604801, 0xFF8A5C02, 0xFF4C7601, 0xFF868602, 0xFF7D7702, 0xFF865503,
+	0xFF4A7402, 0xFF874502, 0xFF873101, 0xFF7E7A02, 0xFF638B02, 0xFF978C02, 0xFF5C8201, 0xFF6B6A01,
+	0xFF776803, 0xFF554701, 0xFF887302, 0xFF517B03, 0xFF787102, 0xFF88A003, 0xFF7B7102, 0xFF836602,
+	0xFF385B01, 0xFF8B6A03, 0xFF6D8402, 0xFF7F7C02, 0xFF627801, 0xFF5C7601, 0xFF6D7F01, 0xFF5A7501,
+	0xFF797802, 0xFF597602, 0xFF6D5E02, 0xFF836501, 0xFF6A8703, 0xFF8A7802, 0xFF5A7A02, 0xFF987C02,
+	0xFF5B6502, 0xFF879603, 0xFF75A502, 0xFF867904, 0xFF5B7002, 0xFF6C7A02, 0xFF656E03, 0xFF827002,
+	0xFF6C6402, 0xFF537502, 0xFF8F6102, 0xFF655E02, 0xFF908502, 0xFF717502, 0xFF726C02, 0xFF717B03,
+	0xFF4D8902, 0xFF7D7C03, 0xFF627B01, 0xFF768103, 0xFF638102, 0xFF6F8E01, 0xFF7E6D02, 0xFF6C7902,
+	0xFF6F4801, 0xFF604701, 0xFF7A8902, 0xFF979C03, 0xFF697401, 0xFF887903, 0xFF7F6E03, 0xFF676401,
+	0xFF547702, 0xFF984502, 0xFF874E02, 0xFF487404, 0xFF8D4D01, 0xFF564C02, 0xFF746D03, 0xFF6A5B01,
+	0xFF7C6603, 0xFF5D7A02, 0xFF6A7902, 0xFF5A8A02, 0xFF837003, 0xFF564B01, 0xFF8E8502, 0xFF627C02,
+	0xFF797203, 0xFF6D8602, 0xFF828A01, 0xFF428202, 0xFF9C5A02, 0xFF5D5602, 0xFF646E02, 0xFF687202,
+	0xFF708D02, 0xFF949904, 0xFF7B7603, 0xFF747003, 0xFF797602, 0xFF7F7802, 0xFF848402, 0xFF76A103,
+	0xFF596B03, 0xFFAC8F03, 0xFF796601, 0xFF686302, 0xFF727901, 0xFF67A202, 0xFF4E8302, 0xFF447E02,
+	0xFF796101, 0xFF4F5B02, 0xFF697202, 0xFF676001, 0xFF647503, 0xFF686F03, 0xFF886501, 0xFF5F5202,
+	0xFF727102, 0xFF6A8F01, 0xFF817302, 0xFF506B01, 0xFF7E6F03, 0xFF566701, 0xFF768902, 0xFF498201,
+	0xFF647702, 0xFF676401, 0xFF7E7C01, 0xFF6E9B03, 0xFF8BB503, 0xFF577C02, 0xFF7E6802, 0xFF565A02,
+	0xFF7E6702, 0xFF8A6E02, 0xFF7A9A03, 0xFF7A8802, 0xFF619C02, 0xFF7C6B01, 0xFF648304, 0xFF4F6B02,
+	0xFF705B02, 0xFF644D01, 0xFF625E02, 0xFF597302, 0xFF646B02, 0xFF7F7B02, 0xFF717901, 0xFF868802,
+	0xFF516202, 0xFF885B01, 0xFF6F7A01, 0xFF7C6602, 0xFF7F6202, 0xFF607302, 0xFF557002, 0xFF656A01,
+	0xFF697C02, 0xFF6F8903, 0xFF7F7703, 0xFF677401, 0xFF5E6102, 0xFF534902, 0xFF7B7D02, 0xFF706A02,
+	0xFF9DB703, 0xFF649902, 0xFF567402, 0xFF516203, 0xFF7A6B02, 0xFF818404, 0xFF4F7602, 0xFF6D6E02,
+	0xFF5D6802, 0xFF9D6802, 0xFF5E8A02, 0xFF769503, 0xFF507601, 0xFF8B6C01, 0xFF7F6002, 0xFF645501,
+	0xFF5D8102, 0xFF7C9303, 0xFF5C5301, 0xFF5B6502, 0xFF7F7603, 0xFF5C4201, 0xFF7B6C03, 0xFF606C02,
+	0xFF604501, 0xFF597702, 0xFF7F6A03, 0xFF747703, 0xFF706501, 0xFF568B03, 0xFF755C01, 0xFF736B02,
+	0xFF607C01, 0xFF626E02, 0xFF6F8402, 0xFF5B8C03, 0xFF7A6A01, 0xFF755F01, 0xFF6B9202, 0xFF849703,
+	0xFF609E02, 0xFF838503, 0xFF6F4501, 0xFF515101, 0xFF5E5D02, 0xFF837F03, 0xFF938503, 0xFF677A02,
+	0xFF746703, 0xFF4C4502, 0xFF774D02, 0xFF666202, 0xFF7B6B02, 0xFF6A7502, 0xFF928502, 0xFF605F01,
+	0xFF767803, 0xFF606302, 0xFF839103, 0xFF5F7B02, 0xFF877503, 0xFF757302, 0xFF398402, 0xFFA57202,
+	0xFF727802, 0xFF606A02, 0xFF646703, 0xFF716302, 0xFF5C6D02, 0xFF696A02, 0xFF7A7502, 0xFF747502,
+	0xFF716E02, 0xFF7A6802, 0xFF5B6802, 0xFF6F6B02, 0xFF687A02, 0xFF796D02, 0xFF766F02, 0xFF717302,
+	0xFF576902, 0xFF867802, 0xFF7E8E02, 0xFF607402, 0xFF665702, 0xFF6C6202, 0xFF6D8402, 0xFF718002,
+	0xFF797002, 0xFF587002, 0xFF6D6802, 0xFF696902, 0xFF735C02, 0xFF6F7202, 0xFF777802, 0xFF747102,
+	0xFF7D8C02, 0xFF787502, 0xFF615202, 0xFF6F6C02, 0xFF6F7F02, 0xFF656F01, 0xFF617B02, 0xFF5C7D02,
+	0xFF886A02, 0xFF646E02, 0xFF798602, 0xFF757502, 0xFF6E5C02, 0xFF665A02, 0xFF887702, 0xFF7E7F02,
+	0xFF787703, 0xFF7A7303, 0xFF688502, 0xFF798302, 0xFF626F02, 0xFF747602, 0xFF706002, 0xFF686502,
+	0xFF647F02, 0xFF847A02, 0xFF626102, 0xFF726B02, 0xFF717A02, 0xFF797202, 0xFF727103, 0xFF737103,
+	0xFF627302, 0xFF776E02, 0xFF607302, 0xFF637C01, 0xFF627202, 0xFF765A02, 0xFF717F02, 0xFF7E7103,
+	0xFF675C02, 0xFF746102, 0xFF737202, 0xFF6B7D02, 0xFF726402, 0xFF657002, 0xFF767702, 0xFF6F7402,
+	0xFF6B8003, 0xFF678202, 0xFF727002, 0xFF6D7202, 0xFF756D02, 0xFF808303, 0xFF7A7702, 0xFF797E02,
+	0xFF736E02, 0xFF737803, 0xFF6B6102, 0xFF716A02, 0xFF666E02, 0xFF6E7102, 0xFF776D02, 0xFF747A02,
+	0xFF6D6F02, 0xFF6F6F02, 0xFF6D6A02, 0xFF5F7901, 0xFF687902, 0xFF758102, 0xFF657702, 0xFF6F6A02,
+	0xFF837402, 0xFF767A02, 0xFF6D8902, 0xFF517C03, 0xFF675902, 0xFF636902, 0xFF6C7302, 0xFF776E02,
+	0xFF667002, 0xFF655A02, 0xFF716602, 0xFF747002, 0xFF646602, 0xFF767B03, 0xFF717502, 0xFF727002,
+	0xFF708F02, 0xFF5D7A03, 0xFF7A6D02, 0xFF6B8402, 0xFF777D02, 0xFF656D02, 0xFF706F02, 0xFF776E02,
+	0xFF706F02, 0xFF7A6802, 0xFF5B6802, 0xFF6F6B02, 0xFF697A02, 0xFF7A6E03, 0xFF766F02, 0xFF727302,
+	0xFF717802, 0xFF606A02, 0xFF646703, 0xFF716202, 0xFF5C6C02, 0xFF6A6A03, 0xFF7A7502, 0xFF747402,
+	0xFF797002, 0xFF587002, 0xFF6D6902, 0xFF696902, 0xFF735C02, 0xFF6F7201, 0xFF777802, 0xFF747102,
+	0xFF576902, 0xFF877803, 0xFF7E8E02, 0xFF5F7402, 0xFF665702, 0xFF6B6102, 0xFF6D8402, 0xFF717F02,
+	0xFF886A02, 0xFF646E02, 0xFF7A8602, 0xFF757602, 0xFF6F5C02, 0xFF655A02, 0xFF887702, 0xFF7F7F02,
+	0xFF7E8C03, 0xFF787502, 0xFF615202, 0xFF6E6C02, 0xFF6F7F02, 0xFF656F02, 0xFF617B02, 0xFF5D7D02,
+	0xFF637E02, 0xFF847902, 0xFF636102, 0xFF726C02, 0xFF717902, 0xFF787202, 0xFF727103, 0xFF737103,
+	0xFF787702, 0xFF7A7303, 0xFF698502, 0xFF798302, 0xFF616F02, 0xFF757602, 0xFF716002, 0xFF686502,
+	0xFF685B02, 0xFF746202, 0xFF737202, 0xFF6B7D02, 0xFF726402, 0xFF657002, 0xFF767602, 0xFF6F7402,
+	0xFF627302, 0xFF776E02, 0xFF607302, 0xFF637C01, 0xFF617202, 0xFF775A02, 0xFF727F02, 0xFF7D7102,
+	0xFF746E02, 0xFF737803, 0xFF6B6102, 0xFF716A02, 0xFF666E02, 0xFF6E7102, 0xFF776D02, 0xFF757A02,
+	0xFF6C7F03, 0xFF678202, 0xFF737002, 0xFF6E7202, 0xFF756D02, 0xFF808303, 0xFF7A7702, 0xFF787E02,
+	0xFF837403, 0xFF757B02, 0xFF6E8902, 0xFF517C03, 0xFF675902, 0xFF636902, 0xFF6C7303, 0xFF786E02,
+	0xFF6D6F02, 0xFF6F7002, 0xFF6D6B02, 0xFF5E7902, 0xFF697802, 0xFF758102, 0xFF657702, 0xFF706A02,
+	0xFF718F02, 0xFF5C7A03, 0xFF7B6E02, 0xFF6B8302, 0xFF777D02, 0xFF656D02, 0xFF6F7002, 0xFF776D02,
+	0xFF667003, 0xFF655A02, 0xFF706602, 0xFF736F02, 0xFF646602, 0xFF757B03, 0xFF717602, 0xFF726F02,
+	0xFF6C7102, 0xFF6D7302, 0xFF666402, 0xFF737C02, 0xFF6F6E02, 0xFF686902, 0xFF716D02, 0xFF757302,
+	0xFF7A7B03, 0xFF6C7202, 0xFF6B7502, 0xFF656F02, 0xFF757402, 0xFF717202, 0xFF706902, 0xFF7B7603,
+	0xFF6B7902, 0xFF697402, 0xFF736F02, 0xFF797902, 0xFF706902, 0xFF6F6F02, 0xFF6B6D02, 0xFF747502,
+	0xFF6A6A02, 0xFF6C6E02, 0xFF6E7702, 0xFF6E7202, 0xFF727E02, 0xFF697E02, 0xFF6A6B02, 0xFF737002,
+	0xFF6F6E02, 0xFF686902, 0xFF716E02, 0xFF757302, 0xFF6C7102, 0xFF6D7302, 0xFF666402, 0xFF737B02,
+	0xFF757402, 0xFF717202, 0xFF6F6802, 0xFF7B7603, 0xFF7A7B03, 0xFF6C7202, 0xFF6B7502, 0xFF666F02,
+	0xFF716902, 0xFF6F6F02, 0xFF6B6D02, 0xFF747402, 0xFF6B7902, 0xFF697402, 0xFF736F02, 0xFF787902,
+	0xFF717E03, 0xFF697E02, 0xFF6A6B02, 0xFF737002, 0xFF6A6A02, 0xFF6C6E02, 0xFF6E7702, 0xFF6E7202,
+	0xFF707402, 0xFF6A7102, 0xFF6F6F02, 0xFF747002, 0xFF6B7102, 0xFF727402, 0xFF6F7502, 0xFF6F6F02,
+	0xFF6F6F02, 0xFF747002, 0xFF707402, 0xFF6B7102, 0xFF6F7502, 0xFF6F6F02, 0xFF6B7102, 0xFF727402,
+	0xFF6E7302, 0xFF707102, 0xFF707102, 0xFF6E7302, 0xFF6F7202
 };
+
+const GfxRawTexture DuDv_128x128 = { 128, 128, 8, DuDv_128x128_pixels };
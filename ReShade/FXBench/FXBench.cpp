@@ -0,0 +1,338 @@
+// Runs the ReShadeFX preprocessor, parser and HLSL code generator on the effects in Resources outside the game
+//
+// Every effect is compiled with every macro set a number of times. The tool reports the fastest time of each stage and
+// the heap high-water mark of a compile. It also compares the generated HLSL against the golden files, so changes to
+// the front end or to the effects show up as a diff. Nothing here touches D3D, so it builds and runs on Linux as
+// well (see README.md).
+//
+// Usage: FXBench [options] [effect.fx ...]
+//   -I <dir>          directory the effects are read from (default: Resources)
+//   -D <NAME[=VALUE]> definition added to every macro set
+//   -s <name>:<defs>  adds a macro set, defs are comma separated NAME[=VALUE] like PreprocessorDefinitions in ReShade.ini
+//   -n <runs>         compiles per effect and macro set (default: 10)
+//   -r <WxH>          value of BUFFER_WIDTH and BUFFER_HEIGHT (default: 1024x768)
+//   -g <dir>          golden output directory (default: ReShade/FXBench/Golden)
+//   -u                writes the golden outputs instead of comparing against them
+
+#include "effect_parser.hpp"
+#include "effect_codegen.hpp"
+#include "effect_preprocessor.hpp"
+#include "Resources/Resource.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+	// Heap bytes currently allocated through operator new and the most there were since the last reset
+	size_t heap_current = 0;
+	size_t heap_peak = 0;
+
+	// Allocations carry their size in front, so delete knows how much to take off
+	constexpr size_t heap_header = alignof(std::max_align_t);
+
+	void *heap_alloc(size_t size)
+	{
+		unsigned char *const block = static_cast<unsigned char *>(std::malloc(size + heap_header));
+		if (block == nullptr)
+			throw std::bad_alloc();
+		std::memcpy(block, &size, sizeof(size));
+
+		heap_current += size;
+		heap_peak = std::max(heap_peak, heap_current);
+		return block + heap_header;
+	}
+	void heap_free(void *ptr)
+	{
+		if (ptr == nullptr)
+			return;
+		unsigned char *const block = static_cast<unsigned char *>(ptr) - heap_header;
+		size_t size;
+		std::memcpy(&size, block, sizeof(size));
+
+		heap_current -= size;
+		std::free(block);
+	}
+
+	struct macro_set
+	{
+		std::string name;
+		std::vector<std::pair<std::string, std::string>> macros;
+	};
+
+	// Fastest time of each stage over all runs and the highest heap usage of a single compile
+	struct compile_stats
+	{
+		double preprocess_ms = std::numeric_limits<double>::max();
+		double parse_ms = std::numeric_limits<double>::max(); // The parser drives the code generator, so this includes HLSL generation
+		double write_ms = std::numeric_limits<double>::max();
+		size_t peak_heap = 0;
+	};
+
+	struct compile_result
+	{
+		bool success = false;
+		std::string hlsl;
+		std::string errors;
+	};
+
+	void add_definitions(const std::string &definitions, std::vector<std::pair<std::string, std::string>> &macros)
+	{
+		for (size_t offset = 0; offset <= definitions.size();)
+		{
+			const size_t end = std::min(definitions.find(',', offset), definitions.size());
+			const std::string definition = definitions.substr(offset, end - offset);
+			offset = end + 1;
+
+			if (definition.empty())
+				continue;
+
+			if (const size_t equals_index = definition.find('='); equals_index != std::string::npos)
+				macros.emplace_back(definition.substr(0, equals_index), definition.substr(equals_index + 1));
+			else
+				macros.emplace_back(definition, "1");
+		}
+	}
+
+	bool read_file(const std::filesystem::path &path, std::string &data)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file)
+			return false;
+
+		std::stringstream stream;
+		stream << file.rdbuf();
+		data = stream.str();
+
+		// Remove BOM, like 'read_resource' does for the embedded copies
+		if (data.size() >= 3 && data.compare(0, 3, "\xef\xbb\xbf") == 0)
+			data.erase(0, 3);
+		return true;
+	}
+
+	// Same steps as 'reshade::runtime::load_effect' for the D3D9 renderer, timing each of them
+	compile_result compile(const std::string &name, const std::string &source, const std::vector<std::pair<std::string, std::string>> &macros, compile_stats &stats)
+	{
+		using clock = std::chrono::high_resolution_clock;
+		const auto ms = [](clock::duration duration) { return std::chrono::duration<double, std::milli>(duration).count(); };
+
+		compile_result result;
+		heap_peak = heap_current;
+		const size_t heap_start = heap_current;
+
+		const auto preprocess_start = clock::now();
+		reshadefx::preprocessor pp;
+		for (const auto &macro : macros)
+			pp.add_macro_definition(macro.first, macro.second);
+		pp.append_string(
+			"#define tex2Doffset(s, coords, offset) tex2D(s, coords, offset)\n"
+			"#define tex2Dlodoffset(s, coords, offset) tex2Dlod(s, coords, offset)\n"
+			"#define tex2Dgather(s, t, c) tex2Dgather##c(s, t)\n"
+			"#define tex2Dgatheroffset(s, t, o, c) tex2Dgather##c(s, t, o)\n"
+			"#define tex2Dgather0 tex2DgatherR\n"
+			"#define tex2Dgather1 tex2DgatherG\n"
+			"#define tex2Dgather2 tex2DgatherB\n"
+			"#define tex2Dgather3 tex2DgatherA\n");
+		pp.push(source, name);
+		result.success = pp.parse();
+
+		const auto parse_start = clock::now();
+		// Shader model 3.0 without debug info, so the output does not depend on where the effects are read from
+		std::unique_ptr<reshadefx::codegen> codegen(reshadefx::create_codegen_hlsl(30, false, false));
+		reshadefx::parser parser;
+		result.success &= parser.parse(std::move(pp.output()), codegen.get());
+
+		const auto write_start = clock::now();
+		reshadefx::module module;
+		codegen->write_result(module);
+		const auto write_end = clock::now();
+
+		result.hlsl = std::move(module.hlsl);
+		result.errors = std::move(pp.errors()) + std::move(parser.errors());
+
+		stats.preprocess_ms = std::min(stats.preprocess_ms, ms(parse_start - preprocess_start));
+		stats.parse_ms = std::min(stats.parse_ms, ms(write_start - parse_start));
+		stats.write_ms = std::min(stats.write_ms, ms(write_end - write_start));
+		stats.peak_heap = std::max(stats.peak_heap, heap_peak - heap_start);
+		return result;
+	}
+
+	// Golden files hold the generated HLSL followed by the preprocessor and parser messages, if there were any
+	std::string golden_text(const compile_result &result)
+	{
+		std::string text = result.hlsl;
+		if (!result.errors.empty())
+			text += "\n/* Errors and warnings:\n" + result.errors + "*/\n";
+		return text;
+	}
+
+	// Prints the first line that differs between a golden file and the new output
+	void compare_golden(const std::string &expected, const std::string &actual)
+	{
+		std::istringstream expected_stream(expected), actual_stream(actual);
+		std::string expected_line, actual_line;
+		for (size_t line = 1; ; ++line)
+		{
+			const bool has_expected = static_cast<bool>(std::getline(expected_stream, expected_line));
+			const bool has_actual = static_cast<bool>(std::getline(actual_stream, actual_line));
+			if (!has_expected && !has_actual)
+				break;
+
+			if (!has_expected || !has_actual || expected_line != actual_line)
+			{
+				std::printf("    first difference at line %zu\n", line);
+				std::printf("    - %s\n", has_expected ? expected_line.c_str() : "<end of file>");
+				std::printf("    + %s\n", has_actual ? actual_line.c_str() : "<end of file>");
+				break;
+			}
+		}
+	}
+}
+
+void *operator new(size_t size) { return heap_alloc(size); }
+void *operator new[](size_t size) { return heap_alloc(size); }
+void operator delete(void *ptr) noexcept { heap_free(ptr); }
+void operator delete[](void *ptr) noexcept { heap_free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { heap_free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { heap_free(ptr); }
+
+int main(int argc, char *argv[])
+{
+	std::filesystem::path effect_dir = "Resources";
+	std::filesystem::path golden_dir = "ReShade/FXBench/Golden";
+	std::vector<std::string> effects;
+	std::vector<std::pair<std::string, std::string>> common_macros;
+	std::vector<macro_set> macro_sets;
+	unsigned int runs = 10, width = 1024, height = 768;
+	bool update_golden = false;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const char *const arg = argv[i];
+		const bool has_value = i + 1 < argc;
+
+		if (!std::strcmp(arg, "-I") && has_value)
+			effect_dir = std::filesystem::u8path(argv[++i]);
+		else if (!std::strcmp(arg, "-D") && has_value)
+			add_definitions(argv[++i], common_macros);
+		else if (!std::strcmp(arg, "-s") && has_value)
+		{
+			const std::string value = argv[++i];
+			const size_t colon_index = value.find(':');
+			macro_set &set = macro_sets.emplace_back();
+			set.name = value.substr(0, colon_index);
+			if (colon_index != std::string::npos)
+				add_definitions(value.substr(colon_index + 1), set.macros);
+		}
+		else if (!std::strcmp(arg, "-n") && has_value)
+			runs = std::max(1, std::atoi(argv[++i]));
+		else if (!std::strcmp(arg, "-r") && has_value)
+			std::sscanf(argv[++i], "%ux%u", &width, &height);
+		else if (!std::strcmp(arg, "-g") && has_value)
+			golden_dir = std::filesystem::u8path(argv[++i]);
+		else if (!std::strcmp(arg, "-u"))
+			update_golden = true;
+		else if (arg[0] == '-')
+		{
+			std::printf("usage: FXBench [-I <dir>] [-D <NAME[=VALUE]>] [-s <name>:<defs>] [-n <runs>] [-r <WxH>] [-g <dir>] [-u] [effect.fx ...]\n");
+			return 1;
+		}
+		else
+			effects.push_back(arg);
+	}
+
+	if (effects.empty())
+		effects = { "SMAA.fx", "PirateBloom.fx", "Frutbunn.fx", "Lottes.fx", "Refresh.fx" };
+	if (macro_sets.empty())
+		macro_sets.push_back({ "default", {} });
+
+	// Same predefined macros as 'reshade::runtime::load_effect' on D3D9 outside of performance mode
+	const std::vector<std::pair<std::string, std::string>> runtime_macros = {
+		{ "__RESHADE__", std::to_string(RESHADE_MAJOR * 10000 + RESHADE_MINOR * 100 + RESHADE_REVISION) },
+		{ "__RESHADE_PERFORMANCE_MODE__", "0" },
+		{ "__VENDOR__", "0" },
+		{ "__DEVICE__", "0" },
+		{ "__RENDERER__", std::to_string(0x9000) },
+		{ "BUFFER_WIDTH", std::to_string(width) },
+		{ "BUFFER_HEIGHT", std::to_string(height) },
+		{ "BUFFER_RCP_WIDTH", "(1.0 / BUFFER_WIDTH)" },
+		{ "BUFFER_RCP_HEIGHT", "(1.0 / BUFFER_HEIGHT)" },
+		{ "BUFFER_COLOR_BIT_DEPTH", "8" },
+	};
+
+	if (update_golden)
+	{
+		std::error_code error_code;
+		std::filesystem::create_directories(golden_dir, error_code);
+	}
+
+	std::printf("%-16s %-12s %12s %12s %12s %12s %12s %10s  %s\n", "effect", "macro set", "preprocess", "parse", "write", "total", "peak heap", "hlsl", "golden");
+
+	unsigned int failures = 0, missing = 0;
+	for (const std::string &effect : effects)
+	{
+		std::string source;
+		if (!read_file(effect_dir / std::filesystem::u8path(effect), source))
+		{
+			std::printf("%-16s could not be read from '%s'\n", effect.c_str(), effect_dir.u8string().c_str());
+			++failures;
+			continue;
+		}
+
+		for (const macro_set &set : macro_sets)
+		{
+			std::vector<std::pair<std::string, std::string>> macros = runtime_macros;
+			macros.insert(macros.end(), common_macros.begin(), common_macros.end());
+			macros.insert(macros.end(), set.macros.begin(), set.macros.end());
+
+			compile_stats stats;
+			compile_result result;
+			for (unsigned int run = 0; run < runs; ++run)
+				result = compile(effect, source, macros, stats);
+
+			const std::filesystem::path golden_path = golden_dir / std::filesystem::u8path(std::filesystem::u8path(effect).stem().u8string() + '.' + set.name + ".hlsl");
+			const std::string actual = golden_text(result);
+			std::string expected;
+			const char *status = "match";
+			if (!result.success)
+				status = "compile failed";
+			else if (update_golden)
+				status = std::ofstream(golden_path, std::ios::binary | std::ios::trunc).write(actual.data(), actual.size()) ? "written" : "write failed";
+			else if (!read_file(golden_path, expected))
+				status = "missing";
+			else if (expected != actual)
+				status = "DIFFERS";
+			const bool matches = !std::strcmp(status, "match") || !std::strcmp(status, "written");
+
+			std::printf("%-16s %-12s %9.3f ms %9.3f ms %9.3f ms %9.3f ms %8zu KiB %6zu KiB  %s\n", effect.c_str(), set.name.c_str(),
+				stats.preprocess_ms, stats.parse_ms, stats.write_ms, stats.preprocess_ms + stats.parse_ms + stats.write_ms,
+				stats.peak_heap / 1024, result.hlsl.size() / 1024, status);
+
+			if (!result.success)
+				std::printf("%s", result.errors.c_str());
+			else if (!matches && !expected.empty())
+				compare_golden(expected, actual);
+
+			failures += !matches;
+			missing += !std::strcmp(status, "missing");
+		}
+	}
+
+	// A fresh checkout has no golden files until they are written once with the same options
+	if (missing != 0)
+		std::printf("%u golden files are missing from '%s', run again with -u to write them\n", missing, golden_dir.u8string().c_str());
+
+	return failures != 0;
+}
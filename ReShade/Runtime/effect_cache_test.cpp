@@ -0,0 +1,152 @@
+// Checks the cache of ReShadeFX front end results on the embedded effects
+//
+// Reloading with nothing changed must not run the preprocessor and parser again and must give the same effects as the
+// first load. A definition only invalidates the effects whose source mentions it, directly or through the value of
+// another definition they use, while a resolution change invalidates all of them. The cache key is checked on its own
+// as well, and the least recently used entry has to be the one dropped once the cache is full.
+//
+// Usage: run from the repository root of a Windows checkout, with a built d3d8.dll for the embedded resources
+//   cl /std:c++17 /EHsc /O2 /I. /IResources /IExternal\reshade\deps\stb /IExternal\reshade\deps\stb_image_dds /DSTBI_NO_STDIO /DSTBI_NO_LINEAR /D_CRT_SECURE_NO_WARNINGS
+//      ReShade\Runtime\effect_cache_test.cpp ReShade\Runtime\runtime_config.cpp ReShade\stb\stb_impl.c
+//      External\reshade\source\effect_codegen_hlsl.cpp External\reshade\source\effect_expression.cpp External\reshade\source\effect_lexer.cpp
+//      External\reshade\source\effect_parser.cpp External\reshade\source\effect_preprocessor.cpp External\reshade\source\effect_symbol_table.cpp
+//   effect_cache_test [bin\Release\d3d8.dll]
+
+#include "runtime_test.hpp"
+
+using namespace reshade;
+
+// Every effect that went through the front end stored a new entry, nothing is evicted with this few of them
+static size_t cache_size()
+{
+	const std::lock_guard<std::mutex> lock(effect_cache_mutex);
+	return effect_cache.size();
+}
+
+// What a load produced for each effect, compared between a load through the front end and one from the cache
+static std::string describe_effects(const runtime_test &runtime)
+{
+	std::string result;
+	for (const effect &effect : runtime._effects)
+	{
+		result += effect.source_file.u8string() + ' ' + std::to_string(effect.compiled) + ' ' + effect.errors + ' ';
+		result += std::to_string(effect.module.uniforms.size()) + '/' + std::to_string(effect.module.textures.size()) + '/' + std::to_string(effect.module.techniques.size()) + '/' + std::to_string(effect.module.total_uniform_size) + ' ';
+		result += std::to_string(effect.uniform_data_storage.size()) + ' ' + std::to_string(effect.definitions.size()) + '\n';
+	}
+	return result + runtime.layout();
+}
+
+// Loads all effects and returns how many of them ran through the front end
+static size_t load(runtime_test &runtime)
+{
+	const size_t size_before = cache_size();
+	runtime.load_all();
+	return cache_size() - size_before;
+}
+
+int main(int argc, char *argv[])
+{
+	if (!load_resource_module(argc, argv))
+		return 1;
+
+	// The key only depends on the definitions the source can see
+	{
+		const std::string source = "float4 main() : COLOR { return USED_A + USED_B; }";
+		const std::vector<std::pair<std::string, std::string>> macros = { { "USED_A", "1" }, { "USED_B", "INDIRECT" }, { "INDIRECT", "2" }, { "UNUSED", "3" } };
+		const uint64_t key = effect_cache_key("A.fx", source, macros, 0x9000, true, false);
+
+		auto reordered = macros;
+		std::reverse(reordered.begin(), reordered.end());
+		CHECK(effect_cache_key("A.fx", source, reordered, 0x9000, true, false) == key);
+
+		auto unused_changed = macros;
+		unused_changed[3].second = "4";
+		unused_changed.emplace_back("ANOTHER_UNUSED", "1");
+		CHECK(effect_cache_key("A.fx", source, unused_changed, 0x9000, true, false) == key);
+
+		// Only used through the value of 'USED_B'
+		auto indirect_changed = macros;
+		indirect_changed[2].second = "5";
+		CHECK(effect_cache_key("A.fx", source, indirect_changed, 0x9000, true, false) != key);
+
+		// A later definition of the same name overrides the earlier one, so their order matters
+		auto redefined = macros;
+		redefined.emplace_back("USED_A", "6");
+		auto redefined_swapped = redefined;
+		std::swap(redefined_swapped[0], redefined_swapped.back());
+		CHECK(effect_cache_key("A.fx", source, redefined, 0x9000, true, false) != key);
+		CHECK(effect_cache_key("A.fx", source, redefined, 0x9000, true, false) != effect_cache_key("A.fx", source, redefined_swapped, 0x9000, true, false));
+
+		CHECK(effect_cache_key("B.fx", source, macros, 0x9000, true, false) != key);
+		CHECK(effect_cache_key("A.fx", source + ' ', macros, 0x9000, true, false) != key);
+		CHECK(effect_cache_key("A.fx", source, macros, 0xb000, true, false) != key);
+		CHECK(effect_cache_key("A.fx", source, macros, 0x9000, false, false) != key);
+		CHECK(effect_cache_key("A.fx", source, macros, 0x9000, true, true) != key);
+	}
+
+	// Full cache drops the entry that was used last the longest time ago
+	{
+		effect placeholder;
+		for (uint64_t key = 1; key <= effect_cache_max_entries; ++key)
+			store_cached_effect(key, placeholder);
+		CHECK(find_cached_effect(1) != nullptr);
+
+		store_cached_effect(effect_cache_max_entries + 1, placeholder);
+		CHECK(cache_size() == effect_cache_max_entries);
+		CHECK(find_cached_effect(1) != nullptr && find_cached_effect(2) == nullptr && find_cached_effect(effect_cache_max_entries + 1) != nullptr);
+
+		// Storing a key that is already there replaces it without evicting anything
+		store_cached_effect(3, placeholder);
+		CHECK(cache_size() == effect_cache_max_entries && find_cached_effect(4) != nullptr);
+
+		const std::lock_guard<std::mutex> lock(effect_cache_mutex);
+		effect_cache.clear();
+	}
+
+	runtime_test runtime;
+
+	const auto start = std::chrono::high_resolution_clock::now();
+	CHECK(load(runtime) == shaderList.size());
+	const auto first_loaded = std::chrono::high_resolution_clock::now();
+	const std::string reference = describe_effects(runtime);
+	runtime.on_reset(false);
+
+	CHECK(load(runtime) == 0);
+	const auto second_loaded = std::chrono::high_resolution_clock::now();
+	CHECK(describe_effects(runtime) == reference);
+	runtime.on_reset(false);
+
+	printf("first load %.2f ms, second load from the cache %.2f ms\n",
+		std::chrono::duration<double, std::milli>(first_loaded - start).count(), std::chrono::duration<double, std::milli>(second_loaded - first_loaded).count());
+
+	// Only the effects that can see a definition are loaded again when it changes
+	size_t smaa_effects = 0;
+	for (const FILELIST &item : shaderList)
+		smaa_effects += item.value == IDR_SMAA_FX;
+
+	const auto original_definitions = runtime._global_preprocessor_definitions;
+	runtime._global_preprocessor_definitions.push_back("NOT_USED_ANYWHERE=1");
+	CHECK(load(runtime) == 0);
+	runtime.on_reset(false);
+
+	runtime._global_preprocessor_definitions.push_back("SMAA_PRESET_ULTRA");
+	CHECK(load(runtime) == smaa_effects);
+	runtime.on_reset(false);
+	CHECK(load(runtime) == 0);
+	runtime.on_reset(false);
+
+	runtime._width = 1920;
+	runtime._height = 1080;
+	CHECK(load(runtime) == shaderList.size());
+	runtime.on_reset(false);
+
+	runtime._width = 1280;
+	runtime._height = 720;
+	runtime._global_preprocessor_definitions = original_definitions;
+	CHECK(load(runtime) == 0);
+	CHECK(describe_effects(runtime) == reference);
+
+	if (failures == 0)
+		printf("All effect cache checks passed\n");
+	return failures != 0;
+}
@@ -0,0 +1,86 @@
+// Checks loading the embedded effects on the worker pool
+//
+// The render thread must not wait for the effects to compile, the pool never has more threads than effects or cores,
+// and the textures and techniques end up in the same order whichever worker finishes first. Resetting the runtime
+// while the workers are still busy has to stop them and leave nothing behind, and loading again afterwards gives the
+// same result. Also prints how long the first frame took and when all effects were ready.
+//
+// Usage: run from the repository root of a Windows checkout, with a built d3d8.dll for the embedded resources
+//   cl /std:c++17 /EHsc /O2 /I. /IResources /IExternal\reshade\deps\stb /IExternal\reshade\deps\stb_image_dds /DSTBI_NO_STDIO /DSTBI_NO_LINEAR /D_CRT_SECURE_NO_WARNINGS
+//      ReShade\Runtime\effect_loading_test.cpp ReShade\Runtime\runtime_config.cpp ReShade\stb\stb_impl.c
+//      External\reshade\source\effect_codegen_hlsl.cpp External\reshade\source\effect_expression.cpp External\reshade\source\effect_lexer.cpp
+//      External\reshade\source\effect_parser.cpp External\reshade\source\effect_preprocessor.cpp External\reshade\source\effect_symbol_table.cpp
+//   effect_loading_test [bin\Release\d3d8.dll]
+
+#include "runtime_test.hpp"
+
+using namespace reshade;
+
+static double milliseconds(std::chrono::high_resolution_clock::duration duration)
+{
+	return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+int main(int argc, char *argv[])
+{
+	if (!load_resource_module(argc, argv))
+		return 1;
+
+	const size_t max_workers = std::min<size_t>(shaderList.size(), std::max<size_t>(std::thread::hardware_concurrency(), 2u) - 1);
+
+	// The layout is the same on every run, no matter which worker finishes first
+	std::string reference;
+	for (int run = 0; run < 10; ++run)
+	{
+		runtime_test runtime;
+		runtime.on_init(nullptr);
+
+		const auto start = std::chrono::high_resolution_clock::now();
+		runtime.update_and_render_effects();
+		const auto first_frame = std::chrono::high_resolution_clock::now();
+		CHECK(runtime._worker_threads.size() >= 1 && runtime._worker_threads.size() <= max_workers);
+		runtime.on_present();
+
+		while (runtime.is_loading())
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			runtime.update_and_render_effects();
+			runtime.on_present();
+		}
+		const auto loaded = std::chrono::high_resolution_clock::now();
+		CHECK(runtime._worker_threads.empty());
+		CHECK(runtime._effects.size() == shaderList.size());
+
+		if (run == 0)
+		{
+			reference = runtime.layout();
+			printf("%zu effects on up to %zu workers, first frame %.2f ms, loaded after %.2f ms\n", runtime._effects.size(), max_workers, milliseconds(first_frame - start), milliseconds(loaded - start));
+			printf("layout: %s\n", reference.c_str());
+		}
+		CHECK(!reference.empty() && runtime.layout() == reference);
+
+		runtime.on_reset();
+	}
+
+	// Resetting mid-load stops the workers, and a full load afterwards still gives the same layout
+	for (int run = 0; run < 50; ++run)
+	{
+		runtime_test runtime;
+		runtime.on_init(nullptr);
+		runtime.update_and_render_effects();
+		runtime.on_present();
+		if (run % 2)
+			std::this_thread::sleep_for(std::chrono::microseconds(200 * (run % 7)));
+
+		runtime.on_reset(false);
+		CHECK(runtime._worker_threads.empty());
+		CHECK(runtime._effects.empty() && runtime._textures.empty() && runtime._techniques.empty());
+
+		runtime.load_all();
+		CHECK(runtime.layout() == reference);
+	}
+
+	if (failures == 0)
+		printf("All effect loading checks passed\n");
+	return failures != 0;
+}
@@ -0,0 +1,106 @@
+// Checks the hashed preset technique lists against the linear search they replace
+//
+// On random lists with duplicates, preset_technique_index has to return the same position as searching the list from
+// the front for the unique name and then for the plain name. Loading the embedded effects then has to order the
+// techniques by their position in the preset's sorting list, keeping the load order among those at the same position
+// and for the ones missing from it at the end, and enable exactly the ones the preset lists.
+//
+// Usage: run from the repository root of a Windows checkout, with a built d3d8.dll for the embedded resources
+//   cl /std:c++17 /EHsc /O2 /I. /IResources /IExternal\reshade\deps\stb /IExternal\reshade\deps\stb_image_dds /DSTBI_NO_STDIO /DSTBI_NO_LINEAR /D_CRT_SECURE_NO_WARNINGS
+//      ReShade\Runtime\preset_technique_test.cpp ReShade\Runtime\runtime_config.cpp ReShade\stb\stb_impl.c
+//      External\reshade\source\effect_codegen_hlsl.cpp External\reshade\source\effect_expression.cpp External\reshade\source\effect_lexer.cpp
+//      External\reshade\source\effect_parser.cpp External\reshade\source\effect_preprocessor.cpp External\reshade\source\effect_symbol_table.cpp
+//   preset_technique_test [bin\Release\d3d8.dll]
+
+#include "runtime_test.hpp"
+#include <random>
+
+using namespace reshade;
+
+// What load_current_preset did before the lists were hashed
+static size_t linear_find(const std::vector<std::string> &list, const std::string &unique_name, const std::string &name)
+{
+	if (const auto it = std::find(list.begin(), list.end(), unique_name); it != list.end())
+		return it - list.begin();
+	if (const auto it = std::find(list.begin(), list.end(), name); it != list.end())
+		return it - list.begin();
+	return std::numeric_limits<size_t>::max();
+}
+
+int main(int argc, char *argv[])
+{
+	if (!load_resource_module(argc, argv))
+		return 1;
+
+	// Random lists of plain and unique names, drawn from few enough names that most of them repeat
+	{
+		const char *const names[] = { "SMAA", "Bloom", "CRT", "Sharpen", "" };
+		const char *const effects[] = { "SMAA.fx", "Bloom.fx", "CRT.fx" };
+
+		std::mt19937 rng(1);
+		const auto random_name = [&](bool unique) {
+			std::string name = names[rng() % std::size(names)];
+			if (unique)
+				name += '@' + std::string(effects[rng() % std::size(effects)]);
+			return name;
+		};
+
+		size_t found = 0, lookups = 0;
+		for (int round = 0; round < 2000; ++round)
+		{
+			std::vector<std::string> list(rng() % 12);
+			for (std::string &entry : list)
+				entry = random_name(rng() % 2 != 0);
+
+			const preset_technique_index index(list);
+			for (int lookup = 0; lookup < 20; ++lookup, ++lookups)
+			{
+				const std::string name = random_name(false);
+				const std::string unique_name = name + '@' + effects[rng() % std::size(effects)];
+				const size_t position = index.find(unique_name, name);
+				CHECK(position == linear_find(list, unique_name, name));
+				found += position != std::numeric_limits<size_t>::max();
+			}
+		}
+		printf("%zu lookups on random lists, %zu of them found\n", lookups, found);
+	}
+
+	// The embedded preset applied to the embedded effects
+	{
+		runtime_test runtime;
+		runtime.load_all();
+
+		std::vector<std::string> technique_list, sorted_technique_list;
+		const ini_file &preset = ini_file::load_cache();
+		preset.get({}, "Techniques", technique_list);
+		preset.get({}, "TechniqueSorting", sorted_technique_list);
+		if (sorted_technique_list.empty())
+			sorted_technique_list = technique_list;
+
+		std::string order;
+		size_t last_position = 0, last_effect_index = 0;
+		for (const technique &technique : runtime._techniques)
+		{
+			const std::string unique_name = technique.name + '@' + runtime._effects[technique.effect_index].source_file.filename().u8string();
+
+			const size_t position = linear_find(sorted_technique_list, unique_name, technique.name);
+			CHECK(position >= last_position);
+			// Techniques at the same position, like those missing from the list, stay in load order
+			if (position == last_position)
+				CHECK(technique.effect_index >= last_effect_index);
+			last_position = position;
+			last_effect_index = technique.effect_index;
+
+			const bool listed = linear_find(technique_list, unique_name, technique.name) != std::numeric_limits<size_t>::max();
+			CHECK(technique.enabled == (listed || technique.annotation_as_int("enabled") != 0));
+
+			order += unique_name + (technique.enabled ? " " : " (disabled) ");
+		}
+
+		printf("techniques in preset order: %s\n", order.c_str());
+	}
+
+	if (failures == 0)
+		printf("All preset technique checks passed\n");
+	return failures != 0;
+}
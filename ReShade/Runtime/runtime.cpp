@@ -24,12 +24,14 @@
 #include "Resource.h"
 #include "Logging\Logging.h"
 #include "Common\Settings.h"
+#include "Common\Hash.h"
 #include "External\reshade\source\effect_parser.hpp"
 #include "External\reshade\source\effect_codegen.hpp"
 #include "External\reshade\source\effect_preprocessor.hpp"
 #include <thread>
 #include <cassert>
 #include <algorithm>
+#include <map>
 #include "stb_image.h"
 #include "stb_image_dds.h"
 #include "stb_image_write.h"
@@ -59,6 +61,135 @@
 	return true;
 }
 
+namespace
+{
+	// Result of the ReShadeFX front end (preprocessor, parser and code generation) for one effect
+	struct effect_cache_entry
+	{
+		bool compiled = false;
+		std::string errors;
+		std::vector<std::pair<std::string, std::string>> definitions;
+		std::vector<std::filesystem::path> included_files;
+		reshadefx::module module;
+	};
+
+	// Shared by all runtimes, so it also survives the device being recreated
+	constexpr size_t effect_cache_max_entries = 32;
+	std::mutex effect_cache_mutex;
+	uint64_t effect_cache_clock = 0;
+	std::unordered_map<uint64_t, std::pair<std::shared_ptr<const effect_cache_entry>, uint64_t>> effect_cache; // Entry and the clock value of its last use
+
+	uint64_t effect_cache_key(const std::string &name, const std::string &source, std::vector<std::pair<std::string, std::string>> macros, unsigned int renderer_id, bool debug_info, bool performance_mode)
+	{
+		// Effects are loaded from a single resource without includes, so only definitions whose name appears in the source (or in the value of another one that does) can be used by it
+		// This also covers names only tested with '#ifdef', which 'used_macro_definitions' does not report while they are undefined
+		std::vector<bool> used(macros.size());
+		for (bool changed = true; changed;)
+		{
+			changed = false;
+			for (size_t i = 0; i < macros.size(); ++i)
+			{
+				if (used[i])
+					continue;
+
+				used[i] = source.find(macros[i].first) != std::string::npos;
+				for (size_t k = 0; k < macros.size() && !used[i]; ++k)
+					used[i] = used[k] && macros[k].second.find(macros[i].first) != std::string::npos;
+				changed |= used[i];
+			}
+		}
+
+		for (size_t i = macros.size(); i-- > 0;)
+			if (!used[i])
+				macros.erase(macros.begin() + i);
+		// Sort by name, but keep later definitions of the same name after earlier ones, since those override them
+		std::stable_sort(macros.begin(), macros.end(),
+			[](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+
+		uint64_t key = Hash64(source.data(), source.size());
+		key = Hash64(name.data(), name.size(), key);
+		for (const auto &macro : macros)
+		{
+			key = Hash64(macro.first.data(), macro.first.size(), key);
+			key = Hash64(macro.second.data(), macro.second.size(), key);
+		}
+		const uint32_t options[3] = { renderer_id, debug_info, performance_mode };
+		return Hash64(options, sizeof(options), key);
+	}
+
+	std::shared_ptr<const effect_cache_entry> find_cached_effect(uint64_t key)
+	{
+		const std::lock_guard<std::mutex> lock(effect_cache_mutex);
+
+		const auto it = effect_cache.find(key);
+		if (it == effect_cache.end())
+			return nullptr;
+
+		it->second.second = ++effect_cache_clock;
+		return it->second.first;
+	}
+
+	void store_cached_effect(uint64_t key, const reshade::effect &effect)
+	{
+		auto entry = std::make_shared<effect_cache_entry>();
+		entry->compiled = effect.compiled;
+		entry->errors = effect.errors;
+		entry->definitions = effect.definitions;
+		entry->included_files = effect.included_files;
+		entry->module = effect.module;
+
+		const std::lock_guard<std::mutex> lock(effect_cache_mutex);
+
+		// Drop the least recently used entry, old ones pile up with every resolution or preset definition change
+		if (effect_cache.size() >= effect_cache_max_entries && effect_cache.find(key) == effect_cache.end())
+			effect_cache.erase(std::min_element(effect_cache.begin(), effect_cache.end(),
+				[](const auto &lhs, const auto &rhs) { return lhs.second.second < rhs.second.second; }));
+
+		effect_cache[key] = { std::move(entry), ++effect_cache_clock };
+	}
+
+	// Decoded RGBA8 pixels of texture source images, already resized to the texture dimensions
+	// The images are embedded resources which never change, so reloading effects or resetting the device only has to upload them again
+	std::mutex texture_source_cache_mutex;
+	std::map<std::tuple<DWORD, uint32_t, uint32_t>, std::shared_ptr<const std::vector<uint8_t>>> texture_source_cache; // Keyed by resource id, width and height
+
+	DWORD find_texture_source(const std::string &name)
+	{
+		static const std::unordered_map<std::string, DWORD> resource_ids = []() {
+			std::unordered_map<std::string, DWORD> resource_ids;
+			for (const auto &item : textureList)
+				resource_ids.emplace(item.name, item.value);
+			return resource_ids;
+		}();
+
+		const auto it = resource_ids.find(name);
+		return it != resource_ids.end() ? it->second : 0;
+	}
+
+	// Technique list of a preset, hashed so matching it against the loaded techniques is a lookup per technique instead of a search
+	struct preset_technique_index
+	{
+		explicit preset_technique_index(const std::vector<std::string> &list)
+		{
+			positions.reserve(list.size());
+			for (size_t i = 0; i < list.size(); ++i)
+				positions.emplace(list[i], i); // First occurrence wins, like a linear search from the front
+		}
+
+		// Returns the position of a technique in the list, matching its unique name first and then its plain name
+		size_t find(const std::string &unique_name, const std::string &name) const
+		{
+			if (const auto it = positions.find(unique_name); it != positions.end())
+				return it->second;
+			if (const auto it = positions.find(name); it != positions.end())
+				return it->second;
+			return std::numeric_limits<size_t>::max();
+		}
+
+		std::unordered_map<std::string, size_t> positions;
+	};
+}
+
 reshade::runtime::runtime() :
 	_start_time(std::chrono::high_resolution_clock::now()),
 	_last_present_time(std::chrono::high_resolution_clock::now()),
@@ -135,10 +266,11 @@ bool reshade::runtime::load_effect(const std::string &name, DWORD id, size_t eff
 	const std::string effect_name = name;
 	effect = {};
 	effect.compiled = true;
+	effect.source_file.assign(effect_name);
 
-	if (_effect_load_skipping && !_load_option_disable_skipping && !_worker_threads.empty()) // Only skip during 'load_effects'
+	if (_effect_load_skipping && !_load_option_disable_skipping)
 	{
-		const ini_file &preset = ini_file::load_cache(); // ini_file::load_cache is not thread-safe, so load from file here
+		const ini_file &preset = ini_file::load_cache(); // Only read here, the cache was loaded by 'load_effects' before any worker thread started
 
 		if (std::vector<std::string> techniques;
 			preset.get({}, "Techniques", techniques))
@@ -156,18 +288,18 @@ bool reshade::runtime::load_effect(const std::string &name, DWORD id, size_t eff
 	}
 
 	{ // Load, pre-process and compile the source file
-		reshadefx::preprocessor pp;
-
-		pp.add_macro_definition("__RESHADE__", std::to_string(RESHADE_MAJOR * 10000 + RESHADE_MINOR * 100 + RESHADE_REVISION));
-		pp.add_macro_definition("__RESHADE_PERFORMANCE_MODE__", _performance_mode ? "1" : "0");
-		pp.add_macro_definition("__VENDOR__", std::to_string(_vendor_id));
-		pp.add_macro_definition("__DEVICE__", std::to_string(_device_id));
-		pp.add_macro_definition("__RENDERER__", std::to_string(_renderer_id));
-		pp.add_macro_definition("BUFFER_WIDTH", std::to_string(_width));
-		pp.add_macro_definition("BUFFER_HEIGHT", std::to_string(_height));
-		pp.add_macro_definition("BUFFER_RCP_WIDTH", "(1.0 / BUFFER_WIDTH)");
-		pp.add_macro_definition("BUFFER_RCP_HEIGHT", "(1.0 / BUFFER_HEIGHT)");
-		pp.add_macro_definition("BUFFER_COLOR_BIT_DEPTH", std::to_string(_color_bit_depth));
+		std::vector<std::pair<std::string, std::string>> macros = {
+			{ "__RESHADE__", std::to_string(RESHADE_MAJOR * 10000 + RESHADE_MINOR * 100 + RESHADE_REVISION) },
+			{ "__RESHADE_PERFORMANCE_MODE__", _performance_mode ? "1" : "0" },
+			{ "__VENDOR__", std::to_string(_vendor_id) },
+			{ "__DEVICE__", std::to_string(_device_id) },
+			{ "__RENDERER__", std::to_string(_renderer_id) },
+			{ "BUFFER_WIDTH", std::to_string(_width) },
+			{ "BUFFER_HEIGHT", std::to_string(_height) },
+			{ "BUFFER_RCP_WIDTH", "(1.0 / BUFFER_WIDTH)" },
+			{ "BUFFER_RCP_HEIGHT", "(1.0 / BUFFER_HEIGHT)" },
+			{ "BUFFER_COLOR_BIT_DEPTH", std::to_string(_color_bit_depth) },
+		};
 
 		std::vector<std::string> preprocessor_definitions = _global_preprocessor_definitions;
 		preprocessor_definitions.insert(preprocessor_definitions.end(), _preset_preprocessor_definitions.begin(), _preset_preprocessor_definitions.end());
@@ -179,90 +311,111 @@ bool reshade::runtime::load_effect(const std::string &name, DWORD id, size_t eff
 
 			const size_t equals_index = definition.find('=');
 			if (equals_index != std::string::npos)
-				pp.add_macro_definition(
+				macros.emplace_back(
 					definition.substr(0, equals_index),
 					definition.substr(equals_index + 1));
 			else
-				pp.add_macro_definition(definition);
+				macros.emplace_back(definition, "1");
 		}
 
-		// Add some conversion macros for compatibility with older versions of ReShade
-		pp.append_string(
-			"#define tex2Doffset(s, coords, offset) tex2D(s, coords, offset)\n"
-			"#define tex2Dlodoffset(s, coords, offset) tex2Dlod(s, coords, offset)\n"
-			"#define tex2Dgather(s, t, c) tex2Dgather##c(s, t)\n"
-			"#define tex2Dgatheroffset(s, t, o, c) tex2Dgather##c(s, t, o)\n"
-			"#define tex2Dgather0 tex2DgatherR\n"
-			"#define tex2Dgather1 tex2DgatherG\n"
-			"#define tex2Dgather2 tex2DgatherB\n"
-			"#define tex2Dgather3 tex2DgatherA\n");
+		std::string data;
+		const bool source_loaded = read_resource(id, data);
 
-		effect.source_file.assign(effect_name);
+		// Reuse the result of an earlier load if neither the source nor any definition it can refer to changed since
+		const uint64_t cache_key = source_loaded ? effect_cache_key(effect_name, data, macros, _renderer_id, !_no_debug_info, _performance_mode) : 0;
 
-		std::string data;
-		if (read_resource(id, data))
+		if (const std::shared_ptr<const effect_cache_entry> cached = source_loaded ? find_cached_effect(cache_key) : nullptr)
 		{
-			pp.push(std::move(data), name);
-			pp.parse();
+			effect.compiled = cached->compiled;
+			effect.errors = cached->errors;
+			effect.definitions = cached->definitions;
+			effect.included_files = cached->included_files;
+			effect.module = cached->module;
 		}
 		else
 		{
-			effect.compiled = false;
-		}
+			reshadefx::preprocessor pp;
+
+			for (const auto &macro : macros)
+				pp.add_macro_definition(macro.first, macro.second);
+
+			// Add some conversion macros for compatibility with older versions of ReShade
+			pp.append_string(
+				"#define tex2Doffset(s, coords, offset) tex2D(s, coords, offset)\n"
+				"#define tex2Dlodoffset(s, coords, offset) tex2Dlod(s, coords, offset)\n"
+				"#define tex2Dgather(s, t, c) tex2Dgather##c(s, t)\n"
+				"#define tex2Dgatheroffset(s, t, o, c) tex2Dgather##c(s, t, o)\n"
+				"#define tex2Dgather0 tex2DgatherR\n"
+				"#define tex2Dgather1 tex2DgatherG\n"
+				"#define tex2Dgather2 tex2DgatherB\n"
+				"#define tex2Dgather3 tex2DgatherA\n");
+
+			if (source_loaded)
+			{
+				pp.push(std::move(data), name);
+				pp.parse();
+			}
+			else
+			{
+				effect.compiled = false;
+			}
 
-		unsigned shader_model;
-		if (_renderer_id == 0x9000)
-			shader_model = 30; // D3D9
-		else if (_renderer_id < 0xa100)
-			shader_model = 40; // D3D10 (including feature level 9)
-		else if (_renderer_id < 0xb000)
-			shader_model = 41; // D3D10.1
-		else if (_renderer_id < 0xc000)
-			shader_model = 50; // D3D11
-		else
-			shader_model = 60; // D3D12
+			unsigned shader_model;
+			if (_renderer_id == 0x9000)
+				shader_model = 30; // D3D9
+			else if (_renderer_id < 0xa100)
+				shader_model = 40; // D3D10 (including feature level 9)
+			else if (_renderer_id < 0xb000)
+				shader_model = 41; // D3D10.1
+			else if (_renderer_id < 0xc000)
+				shader_model = 50; // D3D11
+			else
+				shader_model = 60; // D3D12
 
-		std::unique_ptr<reshadefx::codegen> codegen;
-		if ((_renderer_id & 0xF0000) == 0)
-			codegen.reset(reshadefx::create_codegen_hlsl(shader_model, !_no_debug_info, _performance_mode));
-		else if (_renderer_id < 0x20000)
-			codegen.reset(reshadefx::create_codegen_glsl(!_no_debug_info, _performance_mode, false));
-		else // Vulkan uses SPIR-V input
-			codegen.reset(reshadefx::create_codegen_spirv(true, !_no_debug_info, _performance_mode, false, true));
+			std::unique_ptr<reshadefx::codegen> codegen;
+			if ((_renderer_id & 0xF0000) == 0)
+				codegen.reset(reshadefx::create_codegen_hlsl(shader_model, !_no_debug_info, _performance_mode));
+			else if (_renderer_id < 0x20000)
+				codegen.reset(reshadefx::create_codegen_glsl(!_no_debug_info, _performance_mode, false));
+			else // Vulkan uses SPIR-V input
+				codegen.reset(reshadefx::create_codegen_spirv(true, !_no_debug_info, _performance_mode, false, true));
 
-		reshadefx::parser parser;
+			reshadefx::parser parser;
 
-		// Compile the pre-processed source code (try the compile even if the preprocessor step failed to get additional error information)
-		if (!parser.parse(std::move(pp.output()), codegen.get()) || !effect.compiled)
-		{
-			Logging::Log() << "Failed to compile " << name << ":\n" << pp.errors() << parser.errors();
-			effect.compiled = false;
-		}
+			// Compile the pre-processed source code (try the compile even if the preprocessor step failed to get additional error information)
+			if (!parser.parse(std::move(pp.output()), codegen.get()))
+			{
+				effect.compiled = false;
+			}
 
-		// Append preprocessor and parser errors to the error list
-		effect.errors = std::move(pp.errors()) + std::move(parser.errors());
+			// Append preprocessor and parser errors to the error list
+			effect.errors = std::move(pp.errors()) + std::move(parser.errors());
 
-		// Keep track of used preprocessor definitions (so they can be displayed in the GUI)
-		for (const auto &definition : pp.used_macro_definitions())
-		{
-			if (definition.first.size() <= 10 || definition.first[0] == '_' || !definition.first.compare(0, 8, "RESHADE_") || !definition.first.compare(0, 7, "BUFFER_"))
-				continue;
+			// Keep track of used preprocessor definitions (so they can be displayed in the GUI)
+			for (const auto &definition : pp.used_macro_definitions())
+			{
+				if (definition.first.size() <= 10 || definition.first[0] == '_' || !definition.first.compare(0, 8, "RESHADE_") || !definition.first.compare(0, 7, "BUFFER_"))
+					continue;
 
-			effect.definitions.push_back({ definition.first, trim(definition.second) });
-		}
+				effect.definitions.push_back({ definition.first, trim(definition.second) });
+			}
+
+			// Keep track of included files
+			effect.included_files = pp.included_files();
+			std::sort(effect.included_files.begin(), effect.included_files.end()); // Sort file names alphabetically
 
-		// Keep track of included files
-		effect.included_files = pp.included_files();
-		std::sort(effect.included_files.begin(), effect.included_files.end()); // Sort file names alphabetically
+			// Write result to effect module
+			codegen->write_result(effect.module);
 
-		// Write result to effect module
-		codegen->write_result(effect.module);
+			if (source_loaded)
+				store_cached_effect(cache_key, effect);
+		}
 	}
 
 	// Fill all specialization constants with values from the current preset
 	if (_performance_mode && effect.compiled)
 	{
-		const ini_file &preset = ini_file::load_cache(); // ini_file::load_cache is not thread-safe, so load from file here
+		const ini_file &preset = ini_file::load_cache(); // Only read here, the cache was loaded by 'load_effects' before any worker thread started
 
 		for (reshadefx::uniform_info &constant : effect.module.spec_constants)
 		{
@@ -353,9 +506,58 @@ bool reshade::runtime::load_effect(const std::string &name, DWORD id, size_t eff
 		else if (special == "bufready_depth")
 			var.special = special_uniform::bufready_depth;
 
+		switch (var.special)
+		{
+			case special_uniform::frame_time:
+			case special_uniform::frame_count:
+			case special_uniform::date:
+			case special_uniform::timer:
+			case special_uniform::bufready_depth:
+			{
+				uniform_update &update = effect.uniform_updates.emplace_back();
+				update.uniform_index = effect.uniforms.size();
+				update.special = var.special;
+				break;
+			}
+			case special_uniform::random:
+			{
+				uniform_update &update = effect.uniform_updates.emplace_back();
+				update.uniform_index = effect.uniforms.size();
+				update.special = var.special;
+				update.random_min = var.annotation_as_int("min", 0, 0);
+				update.random_max = var.annotation_as_int("max", 0, RAND_MAX);
+				break;
+			}
+			case special_uniform::ping_pong:
+			{
+				uniform_update &update = effect.uniform_updates.emplace_back();
+				update.uniform_index = effect.uniforms.size();
+				update.special = var.special;
+				update.ping_pong_min = var.annotation_as_float("min", 0, 0.0f);
+				update.ping_pong_max = var.annotation_as_float("max", 0, 1.0f);
+				update.ping_pong_step[0] = var.annotation_as_float("step", 0);
+				update.ping_pong_step[1] = var.annotation_as_float("step", 1);
+				update.ping_pong_smoothing = var.annotation_as_float("smoothing");
+				break;
+			}
+		}
+
 		effect.uniforms.push_back(std::move(var));
 	}
 
+	// Textures and techniques are added to the global lists in 'link_effect' once all effects finished loading
+	_reload_remaining_effects--;
+
+	return effect.compiled;
+}
+void reshade::runtime::link_effect(size_t effect_index)
+{
+	effect &effect = _effects[effect_index];
+	if (effect.skipped)
+		return;
+
+	const std::string name = effect.source_file.u8string();
+
 	std::vector<texture> new_textures;
 	new_textures.reserve(effect.module.textures.size());
 	std::vector<technique> new_techniques;
@@ -365,55 +567,50 @@ bool reshade::runtime::load_effect(const std::string &name, DWORD id, size_t eff
 	{
 		texture.effect_index = effect_index;
 
-		{	const std::lock_guard<std::mutex> lock(_reload_mutex); // Protect access to global texture list
-
-			// Try to share textures with the same name across effects
-			if (const auto existing_texture = std::find_if(_textures.begin(), _textures.end(),
-				[&texture](const auto &item) { return item.unique_name == texture.unique_name; });
-				existing_texture != _textures.end())
+		// Try to share textures with the same name across effects
+		if (const auto existing_texture = std::find_if(_textures.begin(), _textures.end(),
+			[&texture](const auto &item) { return item.unique_name == texture.unique_name; });
+			existing_texture != _textures.end())
+		{
+			// Cannot share texture if this is a normal one, but the existing one is a reference and vice versa
+			if (texture.semantic.empty() != (existing_texture->impl_reference == texture_reference::none))
 			{
-				// Cannot share texture if this is a normal one, but the existing one is a reference and vice versa
-				if (texture.semantic.empty() != (existing_texture->impl_reference == texture_reference::none))
-				{
-					effect.errors += "error: " + texture.unique_name + ": another effect (";
-					effect.errors += _effects[existing_texture->effect_index].source_file.filename().u8string();
-					effect.errors += ") already created a texture with the same name but different usage; rename the variable to fix this error\n";
-					effect.compiled = false;
-					break;
-				}
-				else if (texture.semantic.empty() && !existing_texture->matches_description(texture))
-				{
-					effect.errors += "warning: " + texture.unique_name + ": another effect (";
-					effect.errors += _effects[existing_texture->effect_index].source_file.filename().u8string();
-					effect.errors += ") already created a texture with the same name but different dimensions; textures are shared across all effects, so either rename the variable or adjust the dimensions so they match\n";
-				}
+				effect.errors += "error: " + texture.unique_name + ": another effect (";
+				effect.errors += _effects[existing_texture->effect_index].source_file.filename().u8string();
+				effect.errors += ") already created a texture with the same name but different usage; rename the variable to fix this error\n";
+				effect.compiled = false;
+				break;
+			}
+			else if (texture.semantic.empty() && !existing_texture->matches_description(texture))
+			{
+				effect.errors += "warning: " + texture.unique_name + ": another effect (";
+				effect.errors += _effects[existing_texture->effect_index].source_file.filename().u8string();
+				effect.errors += ") already created a texture with the same name but different dimensions; textures are shared across all effects, so either rename the variable or adjust the dimensions so they match\n";
+			}
 
-				if (_color_bit_depth != 8)
+			if (_color_bit_depth != 8)
+			{
+				for (const auto &sampler_info : effect.module.samplers)
 				{
-					for (const auto &sampler_info : effect.module.samplers)
+					if (sampler_info.srgb && sampler_info.texture_name == texture.unique_name)
 					{
-						if (sampler_info.srgb && sampler_info.texture_name == texture.unique_name)
-						{
-							effect.errors += "error: " + sampler_info.unique_name + ": texture does not support sRGB sampling (back buffer format is not RGBA8)";
-							effect.compiled = false;
-						}
+						effect.errors += "error: " + sampler_info.unique_name + ": texture does not support sRGB sampling (back buffer format is not RGBA8)";
+						effect.compiled = false;
 					}
 				}
+			}
 
-				if (std::find(existing_texture->shared.begin(), existing_texture->shared.end(), effect_index) == existing_texture->shared.end())
-					existing_texture->shared.push_back(effect_index);
+			if (std::find(existing_texture->shared.begin(), existing_texture->shared.end(), effect_index) == existing_texture->shared.end())
+				existing_texture->shared.push_back(effect_index);
 
-				// Always make shared textures render targets, since they may be used as such in a different effect
-				existing_texture->render_target = true;
-				existing_texture->storage_access = true;
-				continue;
-			}
+			// Always make shared textures render targets, since they may be used as such in a different effect
+			existing_texture->render_target = true;
+			existing_texture->storage_access = true;
+			continue;
 		}
 
 		if (texture.annotation_as_int("pooled"))
 		{
-			const std::lock_guard<std::mutex> lock(_reload_mutex);
-
 			// Try to find another pooled texture to share with
 			if (const auto existing_texture = std::find_if(_textures.begin(), _textures.end(),
 				[&texture](const auto &item) { return item.annotation_as_int("pooled") && item.matches_description(texture); });
@@ -463,21 +660,17 @@ bool reshade::runtime::load_effect(const std::string &name, DWORD id, size_t eff
 		new_techniques.push_back(std::move(technique));
 	}
 
-	if (effect.compiled)
-		if (effect.errors.empty())
-			Logging::Log() << "Successfully loaded " << name;
-		else
-			Logging::Log() << "Successfully loaded " << name << " with warnings:\n" << effect.errors;
-
-	{	const std::lock_guard<std::mutex> lock(_reload_mutex);
-		std::move(new_textures.begin(), new_textures.end(), std::back_inserter(_textures));
-		std::move(new_techniques.begin(), new_techniques.end(), std::back_inserter(_techniques));
+	if (!effect.compiled)
+		Logging::Log() << "Failed to compile " << name << ":\n" << effect.errors;
+	else if (effect.errors.empty())
+		Logging::Log() << "Successfully loaded " << name;
+	else
+		Logging::Log() << "Successfully loaded " << name << " with warnings:\n" << effect.errors;
 
-		_last_shader_reload_successfull &= effect.compiled;
-		_reload_remaining_effects--;
-	}
+	std::move(new_textures.begin(), new_textures.end(), std::back_inserter(_textures));
+	std::move(new_techniques.begin(), new_techniques.end(), std::back_inserter(_techniques));
 
-	return effect.compiled;
+	_last_shader_reload_successfull &= effect.compiled;
 }
 void reshade::runtime::load_effects()
 {
@@ -516,21 +709,19 @@ void reshade::runtime::load_effects()
 	_effects.resize(_reload_total_effects);
 
 	// Now that we have a list of files, load them in parallel
-	// Split workload into batches instead of launching a thread for every file to avoid launch overhead and stutters due to too many threads being in flight
-	//const size_t num_splits = std::min<size_t>(effects_no.size(), std::max<size_t>(std::thread::hardware_concurrency(), 2u) - 1);
+	// Use a small pool of threads that pull the next effect from a shared counter instead of launching a thread for every file, to avoid launch overhead and stutters due to too many threads being in flight
+	const size_t num_workers = std::min<size_t>(effects_no.size(), std::max<size_t>(std::thread::hardware_concurrency(), 2u) - 1);
+	_reload_next_effect = 0;
 
 	// Keep track of the spawned threads, so the runtime cannot be destroyed while they are still running
-	//for (size_t n = 0; n < num_splits; ++n)
-		//_worker_threads.emplace_back([this, effects_no, num_splits, n](){
+	for (size_t n = 0; n < num_workers; ++n)
+		_worker_threads.emplace_back([this, effects_no]() {
 			// Abort loading when initialization state changes (indicating that 'on_reset' was called in the meantime)
-			for (size_t i = 0; i < effects_no.size() && _is_initialized; ++i)
+			for (size_t i; _is_initialized && (i = _reload_next_effect++) < effects_no.size();)
 			{
-				//if (i * num_splits / effects_no.size() == n)
-				{
-					load_effect(effects_no[i].name, effects_no[i].value, i);
-				}
+				load_effect(effects_no[i].name, effects_no[i].value, i);
 			}
-		//});
+		});
 }
 void reshade::runtime::load_textures()
 {
@@ -553,16 +744,7 @@ void reshade::runtime::load_textures()
 		}
 
 		// Search for image
-		DWORD id = 0;
-		for (auto &item : textureList)
-		{
-			if (item.name.compare(texture_name) == 0)
-			{
-				id = item.value;
-				break;
-			}
-		}
-
+		const DWORD id = find_texture_source(texture_name);
 		if (!id)
 		{
 			Logging::Log() << "Source " << texture_name << " for texture '" << texture.unique_name << "' could not be found.";
@@ -570,43 +752,60 @@ void reshade::runtime::load_textures()
 			continue;
 		}
 
-		// Read texture data into memory
-		std::string mem;
-		read_resource(id, mem);
-
-		unsigned char * filedata = nullptr;
-		int width = 0, height = 0, channels = 0;
-		if (stbi_dds_test_memory((stbi_uc*)&mem[0], static_cast<int>(mem.size())))
-		{
-			filedata = stbi_dds_load_from_memory((stbi_uc*)&mem[0], static_cast<int>(mem.size()), &width, &height, &channels, STBI_rgb_alpha);
-		}
-		else
+		std::shared_ptr<const std::vector<uint8_t>> pixels;
 		{
-			filedata = stbi_load_from_memory((stbi_uc*)&mem[0], static_cast<int>(mem.size()), &width, &height, &channels, STBI_rgb_alpha);
+			const std::lock_guard<std::mutex> lock(texture_source_cache_mutex);
+			if (const auto it = texture_source_cache.find({ id, texture.width, texture.height }); it != texture_source_cache.end())
+				pixels = it->second;
 		}
 
-		if (filedata == nullptr)
+		if (pixels == nullptr)
 		{
-			Logging::Log() << "Source " << texture_name << " for texture '" << texture.unique_name << "' could not be loaded! Make sure it is of a compatible file format.";
-			_last_texture_reload_successfull = false;
-			continue;
-		}
+			// Read texture data into memory
+			std::string mem;
+			read_resource(id, mem);
 
-		// Need to potentially resize image data to the texture dimensions
-		if (texture.width != uint32_t(width) || texture.height != uint32_t(height))
-		{
-			Logging::Log() << "Resizing image data for texture '" << texture.unique_name << "' from " << width << "x" << height << " to " << texture.width << "x" << texture.height << " ...";
+			unsigned char * filedata = nullptr;
+			int width = 0, height = 0, channels = 0;
+			if (stbi_dds_test_memory((stbi_uc*)&mem[0], static_cast<int>(mem.size())))
+			{
+				filedata = stbi_dds_load_from_memory((stbi_uc*)&mem[0], static_cast<int>(mem.size()), &width, &height, &channels, STBI_rgb_alpha);
+			}
+			else
+			{
+				filedata = stbi_load_from_memory((stbi_uc*)&mem[0], static_cast<int>(mem.size()), &width, &height, &channels, STBI_rgb_alpha);
+			}
 
-			std::vector<uint8_t> resized(texture.width * texture.height * 4);
-			stbir_resize_uint8(filedata, width, height, 0, resized.data(), texture.width, texture.height, 0, 4);
-			upload_texture(texture, resized.data());
-		}
-		else
-		{
-			upload_texture(texture, filedata);
+			if (filedata == nullptr)
+			{
+				Logging::Log() << "Source " << texture_name << " for texture '" << texture.unique_name << "' could not be loaded! Make sure it is of a compatible file format.";
+				_last_texture_reload_successfull = false;
+				continue;
+			}
+
+			auto decoded = std::make_shared<std::vector<uint8_t>>(texture.width * texture.height * 4);
+
+			// Need to potentially resize image data to the texture dimensions
+			if (texture.width != uint32_t(width) || texture.height != uint32_t(height))
+			{
+				Logging::Log() << "Resizing image data for texture '" << texture.unique_name << "' from " << width << "x" << height << " to " << texture.width << "x" << texture.height << " ...";
+
+				stbir_resize_uint8(filedata, width, height, 0, decoded->data(), texture.width, texture.height, 0, 4);
+			}
+			else
+			{
+				std::copy_n(filedata, decoded->size(), decoded->data());
+			}
+
+			stbi_image_free(filedata);
+
+			pixels = decoded;
+
+			const std::lock_guard<std::mutex> lock(texture_source_cache_mutex);
+			texture_source_cache[{ id, texture.width, texture.height }] = std::move(decoded);
 		}
 
-		stbi_image_free(filedata);
+		upload_texture(texture, pixels->data());
 
 		texture.loaded = true;
 	}
@@ -647,7 +846,9 @@ void reshade::runtime::unload_effect(size_t effect_index)
 	effect.definitions.clear();
 	effect.assembly.clear();
 	effect.uniforms.clear();
+	effect.uniform_updates.clear();
 	effect.uniform_data_storage.clear();
+	effect.uniform_dirty_begin = effect.uniform_dirty_end = 0;
 }
 void reshade::runtime::unload_effects()
 {
@@ -683,6 +884,10 @@ void reshade::runtime::update_and_render_effects()
 				thread.join(); // Threads have exited, but still need to join them prior to destruction
 		_worker_threads.clear();
 
+		// Add textures and techniques in effect list order, so that texture sharing does not depend on which thread finished first
+		for (size_t effect_index = 0; effect_index < _effects.size(); ++effect_index)
+			link_effect(effect_index);
+
 		// Finished loading effects, so apply preset to figure out which ones need compiling
 		load_current_preset();
 
@@ -780,9 +985,11 @@ void reshade::runtime::update_and_render_effects()
 		if (!effect.rendering)
 			continue;
 
-		for (uniform &variable : effect.uniforms)
+		for (const uniform_update &update : effect.uniform_updates)
 		{
-			switch (variable.special)
+			uniform &variable = effect.uniforms[update.uniform_index];
+
+			switch (update.special)
 			{
 				case special_uniform::frame_time:
 				{
@@ -799,19 +1006,19 @@ void reshade::runtime::update_and_render_effects()
 				}
 				case special_uniform::random:
 				{
-					const int min = variable.annotation_as_int("min", 0, 0);
-					const int max = variable.annotation_as_int("max", 0, RAND_MAX);
+					const int min = update.random_min;
+					const int max = update.random_max;
 					set_uniform_value(variable, min + (std::rand() % (std::abs(max - min) + 1)));
 					break;
 				}
 				case special_uniform::ping_pong:
 				{
-					const float min = variable.annotation_as_float("min", 0, 0.0f);
-					const float max = variable.annotation_as_float("max", 0, 1.0f);
-					const float step_min = variable.annotation_as_float("step", 0);
-					const float step_max = variable.annotation_as_float("step", 1);
+					const float min = update.ping_pong_min;
+					const float max = update.ping_pong_max;
+					const float step_min = update.ping_pong_step[0];
+					const float step_max = update.ping_pong_step[1];
 					float increment = step_max == 0 ? step_min : (step_min + std::fmodf(static_cast<float>(std::rand()), step_max - step_min + 1));
-					const float smoothing = variable.annotation_as_float("smoothing");
+					const float smoothing = update.ping_pong_smoothing;
 
 					float value[2] = { 0, 0 };
 					get_uniform_value(variable, value, 2);
@@ -948,8 +1155,15 @@ void reshade::runtime::load_current_preset()
 {
 	_preset_save_success = true;
 
-	const ini_file config = ini_file::load_cache(); // Copy config, because reference becomes invalid in the next line
-	const ini_file &preset = ini_file::load_cache();
+	// Settings and preset are the same cached file, so both are only read from here
+	const ini_file &config = ini_file::load_cache();
+	const ini_file &preset = config;
+
+	// Build the file names once instead of for every technique and uniform below
+	std::vector<std::string> effect_names;
+	effect_names.reserve(_effects.size());
+	for (const effect &effect : _effects)
+		effect_names.push_back(effect.source_file.filename().u8string());
 
 	std::vector<std::string> technique_list;
 	preset.get({}, "Techniques", technique_list);
@@ -968,14 +1182,18 @@ void reshade::runtime::load_current_preset()
 			return; // Preset values are loaded in 'update_and_render_effects' during effect loading
 		}
 
-		if (std::find_if(technique_list.begin(), technique_list.end(), [this](const std::string &technique) {
+		std::unordered_map<std::string_view, size_t> effect_indices;
+		effect_indices.reserve(effect_names.size());
+		for (size_t effect_index = 0; effect_index < effect_names.size(); ++effect_index)
+			effect_indices.emplace(effect_names[effect_index], effect_index);
+
+		if (std::find_if(technique_list.begin(), technique_list.end(), [this, &effect_indices](const std::string &technique) {
 				if (const size_t at_pos = technique.find('@'); at_pos == std::string::npos)
 					return true;
-				else if (const auto it = std::find_if(_effects.begin(), _effects.end(),
-					[effect_name = static_cast<std::string_view>(technique).substr(at_pos + 1)](const effect &effect) { return effect_name == effect.source_file.filename().u8string(); }); it == _effects.end())
+				else if (const auto it = effect_indices.find(static_cast<std::string_view>(technique).substr(at_pos + 1)); it == effect_indices.end())
 					return true;
 				else
-					return it->skipped; }) != technique_list.end())
+					return _effects[it->second].skipped; }) != technique_list.end())
 		{
 			load_effects();
 			return;
@@ -987,17 +1205,28 @@ void reshade::runtime::load_current_preset()
 	if (sorted_technique_list.empty())
 		sorted_technique_list = technique_list;
 
-	// Reorder techniques
-	std::sort(_techniques.begin(), _techniques.end(), [this, &sorted_technique_list](const technique &lhs, const technique &rhs) {
-		const std::string lhs_unique = lhs.name + '@' + _effects[lhs.effect_index].source_file.filename().u8string();
-		const std::string rhs_unique = rhs.name + '@' + _effects[rhs.effect_index].source_file.filename().u8string();
-		auto lhs_it = std::find(sorted_technique_list.begin(), sorted_technique_list.end(), lhs_unique);
-		auto rhs_it = std::find(sorted_technique_list.begin(), sorted_technique_list.end(), rhs_unique);
-		if (lhs_it == sorted_technique_list.end())
-			lhs_it = std::find(sorted_technique_list.begin(), sorted_technique_list.end(), lhs.name);
-		if (rhs_it == sorted_technique_list.end())
-			rhs_it = std::find(sorted_technique_list.begin(), sorted_technique_list.end(), rhs.name);
-		return lhs_it < rhs_it; });
+	const preset_technique_index enabled_techniques(technique_list);
+	const preset_technique_index technique_order(sorted_technique_list);
+
+	// Reorder techniques, looking up the position of each one only once instead of in every comparison
+	{
+		std::vector<std::pair<size_t, size_t>> order; // Position in the sorted list and current index
+		order.reserve(_techniques.size());
+		for (size_t technique_index = 0; technique_index < _techniques.size(); ++technique_index)
+		{
+			const technique &technique = _techniques[technique_index];
+			order.emplace_back(technique_order.find(technique.name + '@' + effect_names[technique.effect_index], technique.name), technique_index);
+		}
+
+		// Techniques missing from the list keep their relative order at the end
+		std::sort(order.begin(), order.end());
+
+		std::vector<technique> sorted_techniques;
+		sorted_techniques.reserve(_techniques.size());
+		for (const auto &[position, technique_index] : order)
+			sorted_techniques.push_back(std::move(_techniques[technique_index]));
+		_techniques = std::move(sorted_techniques);
+	}
 
 	// Compute times since the transition has started and how much is left till it should end
 	auto transition_time = std::chrono::duration_cast<std::chrono::microseconds>(_last_present_time - _last_preset_switching_time).count();
@@ -1007,13 +1236,15 @@ void reshade::runtime::load_current_preset()
 	if (_is_in_between_presets_transition && transition_ms_left <= 0)
 		_is_in_between_presets_transition = false;
 
-	for (effect &effect : _effects)
+	for (size_t effect_index = 0; effect_index < _effects.size(); ++effect_index)
 	{
+		effect &effect = _effects[effect_index];
+		const std::string &section = effect_names[effect_index];
+
 		for (uniform &variable : effect.uniforms)
 		{
 			if (variable.special != special_uniform::none)
 				continue;
-			const std::string section = effect.source_file.filename().u8string();
 
 			if (variable.supports_toggle_key())
 			{
@@ -1062,12 +1293,11 @@ void reshade::runtime::load_current_preset()
 	for (technique &technique : _techniques)
 	{
 		const std::string unique_name =
-			technique.name + '@' + _effects[technique.effect_index].source_file.filename().u8string();
+			technique.name + '@' + effect_names[technique.effect_index];
 
 		// Ignore preset if "enabled" annotation is set
 		if ((technique.annotation_as_int("enabled") ||
-			std::find(technique_list.begin(), technique_list.end(), unique_name) != technique_list.end() ||
-			std::find(technique_list.begin(), technique_list.end(), technique.name) != technique_list.end()))
+			enabled_techniques.find(unique_name, technique.name) != std::numeric_limits<size_t>::max()))
 		{
 			enable_technique(technique);
 		}
@@ -1127,13 +1357,13 @@ void reshade::runtime::save_current_preset() const
 			continue;
 
 		const effect &effect = _effects[effect_index];
+		const std::string section = effect.source_file.filename().u8string();
 
 		for (const uniform &variable : effect.uniforms)
 		{
 			if (variable.special != special_uniform::none)
 				continue;
 
-			const std::string section = effect.source_file.filename().u8string();
 			const unsigned int components = variable.type.components();
 			reshadefx::constant values;
 
@@ -1267,9 +1497,13 @@ void reshade::runtime::set_uniform_value(uniform &variable, const uint8_t *data,
 	size = std::min(size, static_cast<size_t>(variable.size));
 	assert(data != nullptr && (size % 4) == 0);
 
-	auto &data_storage = _effects[variable.effect_index].uniform_data_storage;
+	effect &effect = _effects[variable.effect_index];
+	auto &data_storage = effect.uniform_data_storage;
 	assert(variable.offset + size <= data_storage.size());
 
+	// Uploads only need the registers of this variable, the whole variable is marked instead of tracking the exact elements written
+	effect.mark_uniforms_dirty(variable.offset, variable.size);
+
 	const size_t array_length = (variable.type.is_array() ? variable.type.array_length : 1);
 	assert(base_index < array_length);
 
@@ -1366,7 +1600,9 @@ void reshade::runtime::reset_uniform_value(uniform &variable)
 {
 	if (!variable.has_initializer_value)
 	{
-		std::memset(_effects[variable.effect_index].uniform_data_storage.data() + variable.offset, 0, variable.size);
+		effect &effect = _effects[variable.effect_index];
+		std::memset(effect.uniform_data_storage.data() + variable.offset, 0, variable.size);
+		effect.mark_uniforms_dirty(variable.offset, variable.size);
 		return;
 	}
 
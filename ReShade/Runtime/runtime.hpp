@@ -97,8 +97,10 @@ namespace reshade
 		// Callback function called every frame.
 		void on_present();
 
-		// Compile effect from the specified source file and initialize textures, uniforms and techniques.
+		// Compile effect from the specified source file and initialize uniforms. Safe to call from worker threads.
 		bool load_effect(const std::string &name, DWORD id, size_t effect_index);
+		// Add textures and techniques of a loaded effect to the global lists.
+		void link_effect(size_t effect_index);
 		// Load all effects found in the effect search paths.
 		void load_effects();
 		// Initialize resources for the effect and load the effect module.
@@ -119,7 +121,7 @@ namespace reshade
 		// Returns the texture object corresponding to the passed "unique_name".
 		texture &look_up_texture_by_name(const std::string &unique_name);
 
-		bool _is_initialized = false;
+		std::atomic<bool> _is_initialized = false;
 		bool _performance_mode = false;
 		bool _has_depth_texture = false;
 		unsigned int _width = 0;
@@ -140,6 +142,9 @@ namespace reshade
 		std::vector<technique> _techniques;
 
 	private:
+		// Drives effect loading and looks at its state in the runtime tests.
+		friend class runtime_test;
+
 		// Compare current version against the latest published one.
 		bool is_loading() const { return _reload_remaining_effects != std::numeric_limits<size_t>::max(); }
 
@@ -186,6 +191,7 @@ namespace reshade
 		size_t _reload_total_effects = 1;
 		std::vector<size_t> _reload_compile_queue;
 		std::atomic<size_t> _reload_remaining_effects = 0;
+		std::atomic<size_t> _reload_next_effect = 0;
 		std::mutex _reload_mutex;
 		std::vector<std::thread> _worker_threads;
 		std::vector<std::string> _global_preprocessor_definitions;
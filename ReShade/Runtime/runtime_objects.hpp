@@ -162,6 +162,15 @@ namespace reshade
 		uint32_t toggle_key_data[4] = {};
 	};
 
+	struct uniform_update final
+	{
+		size_t uniform_index = 0;
+		special_uniform special = special_uniform::none;
+		// Annotation values of 'random' and 'pingpong' sources, resolved once when the effect is loaded
+		int random_min = 0, random_max = 0;
+		float ping_pong_min = 0.0f, ping_pong_max = 0.0f, ping_pong_step[2] = {}, ping_pong_smoothing = 0.0f;
+	};
+
 	struct technique final : reshadefx::technique_info
 	{
 		technique(const reshadefx::technique_info &init) : technique_info(init) {}
@@ -211,6 +220,23 @@ namespace reshade
 		std::vector<std::pair<std::string, std::string>> definitions;
 		std::unordered_map<std::string, std::string> assembly;
 		std::vector<uniform> uniforms;
+		std::vector<uniform_update> uniform_updates; // Uniforms with a source that is updated every frame
 		std::vector<unsigned char> uniform_data_storage;
+		size_t uniform_dirty_begin = 0, uniform_dirty_end = 0; // Byte range of the storage written since the last upload
+
+		void mark_uniforms_dirty(size_t offset, size_t size)
+		{
+			if (uniform_dirty_begin >= uniform_dirty_end)
+				uniform_dirty_begin = offset, uniform_dirty_end = offset + size;
+			else
+				uniform_dirty_begin = std::min(uniform_dirty_begin, offset), uniform_dirty_end = std::max(uniform_dirty_end, offset + size);
+		}
+		// Get the 16-byte registers covering the dirty range and mark the storage clean
+		void take_dirty_registers(size_t &first_register, size_t &register_count)
+		{
+			first_register = uniform_dirty_begin / 16;
+			register_count = uniform_dirty_begin < uniform_dirty_end ? (uniform_dirty_end + 15) / 16 - first_register : 0;
+			uniform_dirty_begin = uniform_dirty_end = 0;
+		}
 	};
 }
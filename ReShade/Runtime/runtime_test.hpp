@@ -0,0 +1,123 @@
+// Shared by the runtime tests: a runtime that creates no graphics resources, and the globals the game DLL defines
+//
+// The effects, ReShade.ini and the texture sources are the resources embedded in a built d3d8.dll, which is loaded as a
+// data file. runtime.cpp is included rather than linked, so the tests can look at the caches it keeps in an anonymous
+// namespace. This needs the Windows resource functions, so unlike texture_aliasing_test these only build with MSVC.
+
+#pragma once
+
+#include "runtime.cpp"
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+std::ofstream LOG;
+HMODULE m_hModule = nullptr;
+DWORD GammaLevel = 0;
+bool EnableSMAA = true, EnableCRTShader = true, CRTNonCurveShader = true, CRTCurveShader = true;
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do { if (!(condition)) { failures++; printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); } } while (0)
+
+// Loads the embedded resources from the d3d8.dll given as the first argument, or from the release build
+static bool load_resource_module(int argc, char *argv[])
+{
+	const char *const path = argc > 1 ? argv[1] : "bin\\Release\\d3d8.dll";
+	m_hModule = LoadLibraryExA(path, nullptr, LOAD_LIBRARY_AS_DATAFILE | LOAD_LIBRARY_AS_IMAGE_RESOURCE);
+	if (m_hModule == nullptr)
+		printf("Could not load the embedded resources from %s\n", path);
+	return m_hModule != nullptr;
+}
+
+namespace reshade
+{
+	// Runtime for the tests, textures and techniques get a placeholder implementation so effects are linked, compiled and rendered like in the game
+	class runtime_test : public runtime
+	{
+	public:
+		using runtime::on_init;
+		using runtime::on_reset;
+		using runtime::on_present;
+		using runtime::update_and_render_effects;
+		using runtime::is_loading;
+
+		using runtime::_width;
+		using runtime::_height;
+		using runtime::_effects;
+		using runtime::_textures;
+		using runtime::_techniques;
+		using runtime::_worker_threads;
+		using runtime::_global_preprocessor_definitions;
+		using runtime::_last_texture_reload_successfull;
+
+		explicit runtime_test(unsigned int width = 1280, unsigned int height = 720)
+		{
+			_width = width;
+			_height = height;
+			_renderer_id = 0x9000;
+		}
+		~runtime_test()
+		{
+			on_reset();
+		}
+
+		bool init_texture(texture &texture) override
+		{
+			texture.impl = &texture;
+			return true;
+		}
+		void upload_texture(const texture &, const uint8_t *) override {}
+		void destroy_texture(texture &texture) override
+		{
+			texture.impl = nullptr;
+		}
+
+		bool init_effect(size_t effect_index) override
+		{
+			for (technique &technique : _techniques)
+				if (technique.effect_index == effect_index)
+					technique.impl = &technique;
+			return true;
+		}
+		void render_technique(technique &) override {}
+
+		// Goes through the first frames after a device reset: loads all effects, compiles those with an enabled technique one per frame and then loads the textures
+		void load_all()
+		{
+			on_init(nullptr);
+			update_and_render_effects();
+			on_present();
+			while (is_loading())
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				update_and_render_effects();
+				on_present();
+			}
+			while (!_reload_compile_queue.empty())
+			{
+				update_and_render_effects();
+				on_present();
+			}
+			update_and_render_effects();
+			on_present();
+		}
+
+		// Names of the textures and techniques with the effect they belong to, in list order
+		std::string layout() const
+		{
+			std::string result;
+			for (const texture &texture : _textures)
+			{
+				result += texture.unique_name + '#' + std::to_string(texture.effect_index) + ':';
+				for (const size_t effect_index : texture.shared)
+					result += std::to_string(effect_index) + ',';
+				result += ' ';
+			}
+			for (const technique &technique : _techniques)
+				result += technique.name + '#' + std::to_string(technique.effect_index) + ' ';
+			return result;
+		}
+	};
+}
@@ -0,0 +1,101 @@
+/**
+* Copyright (C) 2014 Patrick Mours. All rights reserved.
+* License: https://github.com/crosire/reshade#license
+*
+* Copyright (C) 2024 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "texture_aliasing.hpp"
+#include <cassert>
+#include <limits>
+#include <numeric>
+#include <algorithm>
+
+reshade::alias_plan reshade::plan_texture_aliases(const std::vector<alias_texture_desc> &textures, const std::vector<alias_pass_desc> &passes)
+{
+	constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+	alias_plan plan;
+	plan.memory_of.resize(textures.size());
+	std::iota(plan.memory_of.begin(), plan.memory_of.end(), size_t(0));
+
+	// Find the first and last pass accessing each texture
+	std::vector<size_t> first_pass(textures.size(), npos), last_pass(textures.size(), npos);
+	std::vector<bool> transient(textures.size(), false);
+	for (size_t pass_index = 0; pass_index < passes.size(); ++pass_index)
+	{
+		const alias_pass_desc &pass = passes[pass_index];
+
+		// Reads come first, so that a texture which is read and written by the same pass keeps its contents
+		for (const size_t index : pass.reads)
+		{
+			assert(index < textures.size());
+			if (first_pass[index] == npos)
+				first_pass[index] = pass_index;
+			last_pass[index] = pass_index;
+		}
+		for (const size_t index : pass.writes)
+		{
+			assert(index < textures.size());
+			if (first_pass[index] == npos)
+				first_pass[index] = pass_index,
+				transient[index] = pass.overwrites_render_targets;
+			last_pass[index] = pass_index;
+		}
+	}
+
+	std::vector<size_t> candidates;
+	for (size_t index = 0; index < textures.size(); ++index)
+	{
+		plan.memory_before += textures[index].memory_size;
+
+		if (textures[index].aliasable && transient[index])
+			candidates.push_back(index);
+	}
+
+	// Assign textures to shared memory in order of their first use, reusing memory whose previous lifetime ended before (which is optimal for intervals)
+	std::stable_sort(candidates.begin(), candidates.end(),
+		[&first_pass](size_t lhs, size_t rhs) { return first_pass[lhs] < first_pass[rhs]; });
+
+	struct memory_slot { size_t owner, last_pass; };
+	std::vector<memory_slot> slots;
+	for (const size_t index : candidates)
+	{
+		const alias_texture_desc &desc = textures[index];
+
+		const auto slot = std::find_if(slots.begin(), slots.end(),
+			[&](const memory_slot &slot) {
+				const alias_texture_desc &owner = textures[slot.owner];
+				return slot.last_pass < first_pass[index] &&
+					owner.width == desc.width && owner.height == desc.height && owner.levels == desc.levels && owner.format == desc.format;
+			});
+
+		if (slot != slots.end())
+		{
+			plan.memory_of[index] = slot->owner;
+			slot->last_pass = last_pass[index];
+		}
+		else
+		{
+			slots.push_back({ index, last_pass[index] });
+		}
+	}
+
+	for (size_t index = 0; index < textures.size(); ++index)
+		if (plan.memory_of[index] == index)
+			plan.memory_after += textures[index].memory_size;
+
+	return plan;
+}
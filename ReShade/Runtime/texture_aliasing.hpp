@@ -0,0 +1,52 @@
+/**
+* Copyright (C) 2014 Patrick Mours. All rights reserved.
+* License: https://github.com/crosire/reshade#license
+*
+* Copyright (C) 2024 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace reshade
+{
+	struct alias_texture_desc
+	{
+		bool aliasable = false; // Textures whose contents have to be kept, like ones loaded from a file or referencing the back buffer, are never aliased
+		uint32_t width = 0, height = 0, levels = 0, format = 0; // Only textures that match in all of these can share memory
+		size_t memory_size = 0;
+	};
+
+	struct alias_pass_desc
+	{
+		std::vector<size_t> reads; // Indices of the textures sampled in this pass
+		std::vector<size_t> writes; // Indices of the textures used as render targets in this pass
+		bool overwrites_render_targets = false; // Every pixel of the render targets is cleared or written without depending on the previous contents
+	};
+
+	struct alias_plan
+	{
+		std::vector<size_t> memory_of; // Index of the texture whose memory each texture uses, which is the texture itself if it is not aliased
+		size_t memory_before = 0, memory_after = 0;
+	};
+
+	// Find the textures that are only live between passes of a frame and let those with the same description and lifetimes that do not overlap share memory.
+	// A texture is transient when the first pass accessing it in the frame overwrites it completely, its lifetime then ends with the last pass accessing it.
+	// The passes have to be in the order they are rendered each frame.
+	alias_plan plan_texture_aliases(const std::vector<alias_texture_desc> &textures, const std::vector<alias_pass_desc> &passes);
+}
@@ -0,0 +1,278 @@
+// Checks the texture aliasing planner on synthetic pass graphs and on the pass graphs of the embedded effects
+//
+// Every plan is checked against the invariants the runtime relies on: textures only share memory with an identical
+// description, both are aliasable and fully overwritten by their first write, and their lifetimes do not overlap.
+// Random graphs are also compared against the lower bound of the peak number of live textures per description, so a
+// change that plans worse than before fails as well. Nothing here touches D3D, so it builds and runs on Linux.
+//
+// Usage: run from the repository root
+//   g++ -std=c++17 -O2 -IReShade/Runtime -o texture_aliasing_test ReShade/Runtime/texture_aliasing_test.cpp ReShade/Runtime/texture_aliasing.cpp
+//   ./texture_aliasing_test
+
+#include "texture_aliasing.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace reshade;
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do { if (!(condition)) { failures++; printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); } } while (0)
+
+static alias_texture_desc make_texture(uint32_t width, uint32_t height, uint32_t format, bool aliasable = true)
+{
+	alias_texture_desc desc;
+	desc.aliasable = aliasable;
+	desc.width = width;
+	desc.height = height;
+	desc.format = format;
+	desc.levels = 1;
+	desc.memory_size = size_t(width) * height * 4;
+	return desc;
+}
+
+static alias_pass_desc make_pass(std::vector<size_t> reads, std::vector<size_t> writes, bool overwrites_render_targets = true)
+{
+	alias_pass_desc desc;
+	desc.reads = std::move(reads);
+	desc.writes = std::move(writes);
+	desc.overwrites_render_targets = overwrites_render_targets;
+	return desc;
+}
+
+// Computes the first and last pass using each texture and whether its first use is a full overwrite
+static void compute_lifetimes(size_t texture_count, const std::vector<alias_pass_desc> &passes, std::vector<size_t> &first, std::vector<size_t> &last, std::vector<bool> &transient)
+{
+	first.assign(texture_count, SIZE_MAX);
+	last.assign(texture_count, SIZE_MAX);
+	transient.assign(texture_count, false);
+
+	for (size_t pass = 0; pass < passes.size(); pass++)
+	{
+		for (size_t index : passes[pass].reads)
+		{
+			if (first[index] == SIZE_MAX)
+				first[index] = pass;
+			last[index] = pass;
+		}
+		for (size_t index : passes[pass].writes)
+		{
+			if (first[index] == SIZE_MAX)
+			{
+				first[index] = pass;
+				transient[index] = passes[pass].overwrites_render_targets;
+			}
+			last[index] = pass;
+		}
+	}
+}
+
+// Checks the invariants every plan has to satisfy and returns the number of distinct memory blocks
+static size_t validate(const std::vector<alias_texture_desc> &textures, const std::vector<alias_pass_desc> &passes, const alias_plan &plan)
+{
+	std::vector<size_t> first, last;
+	std::vector<bool> transient;
+	compute_lifetimes(textures.size(), passes, first, last, transient);
+
+	size_t blocks = 0, memory_before = 0, memory_after = 0;
+
+	for (size_t i = 0; i < textures.size(); i++)
+	{
+		memory_before += textures[i].memory_size;
+
+		const size_t owner = plan.memory_of[i];
+		CHECK(plan.memory_of[owner] == owner);
+
+		if (owner == i)
+		{
+			blocks++;
+			memory_after += textures[i].memory_size;
+			continue;
+		}
+
+		const alias_texture_desc &a = textures[i], &b = textures[owner];
+		CHECK(a.aliasable && transient[i] && b.aliasable && transient[owner]);
+		CHECK(a.width == b.width && a.height == b.height && a.format == b.format && a.levels == b.levels);
+	}
+
+	for (size_t i = 0; i < textures.size(); i++)
+		for (size_t k = i + 1; k < textures.size(); k++)
+			if (plan.memory_of[i] == plan.memory_of[k])
+				CHECK(last[i] < first[k] || last[k] < first[i]);
+
+	CHECK(plan.memory_before == memory_before && plan.memory_after == memory_after);
+
+	return blocks;
+}
+
+static void test_chain()
+{
+	// A -> B -> C -> D, each read only by the next pass, so two blocks are enough
+	const std::vector<alias_texture_desc> textures = { make_texture(64, 64, 1), make_texture(64, 64, 1), make_texture(64, 64, 1), make_texture(64, 64, 1) };
+	const std::vector<alias_pass_desc> passes = { make_pass({}, { 0 }), make_pass({ 0 }, { 1 }), make_pass({ 1 }, { 2 }), make_pass({ 2 }, { 3 }), make_pass({ 3 }, {}) };
+
+	const alias_plan plan = plan_texture_aliases(textures, passes);
+	CHECK(validate(textures, passes, plan) == 2);
+	CHECK(plan.memory_of[2] == 0 && plan.memory_of[3] == 1);
+
+	printf("chain: %zu -> %zu bytes\n", plan.memory_before, plan.memory_after);
+}
+
+static void test_excluded_textures()
+{
+	// Read before written (feedback from the previous frame), partially written, not aliasable and a different format are never aliased
+	const std::vector<alias_texture_desc> textures = {
+		make_texture(64, 64, 1), make_texture(64, 64, 1), make_texture(64, 64, 1), make_texture(64, 64, 1, false), make_texture(64, 64, 2), make_texture(64, 64, 1) };
+	const std::vector<alias_pass_desc> passes = {
+		make_pass({ 0 }, { 5 }), make_pass({ 5 }, { 0 }),
+		make_pass({}, { 1 }, false), make_pass({ 1 }, {}),
+		make_pass({}, { 3 }), make_pass({ 3 }, {}),
+		make_pass({}, { 4 }), make_pass({ 4 }, {}),
+		make_pass({}, { 2 }), make_pass({ 2 }, {}) };
+
+	const alias_plan plan = plan_texture_aliases(textures, passes);
+	validate(textures, passes, plan);
+	CHECK(plan.memory_of[0] == 0 && plan.memory_of[1] == 1 && plan.memory_of[3] == 3 && plan.memory_of[4] == 4);
+	// Only the fully overwritten texture used after the lifetime of 5 ended can reuse its memory
+	CHECK(plan.memory_of[2] == 5);
+
+	// A texture read and written by the same pass keeps its contents and an unused texture keeps its memory
+	const std::vector<alias_texture_desc> textures2 = { make_texture(8, 8, 1), make_texture(8, 8, 1), make_texture(8, 8, 1) };
+	const std::vector<alias_pass_desc> passes2 = { make_pass({ 0 }, { 0 }), make_pass({}, { 1 }), make_pass({ 1 }, {}) };
+
+	const alias_plan plan2 = plan_texture_aliases(textures2, passes2);
+	validate(textures2, passes2, plan2);
+	CHECK(plan2.memory_of[0] == 0 && plan2.memory_of[1] == 1 && plan2.memory_of[2] == 2);
+}
+
+static void test_embedded_effects()
+{
+	// Techniques of the embedded effects in their default order: SMAA, Pirate_Bloom with BLOOM_PASSES 2 and the CRT effects, which only use the back buffer
+	// Formats are the ones 'init_texture' maps to: depthTex R16F, edgesTex X8R8G8B8, blendTex and the bloom textures A8R8G8B8
+	enum { backbuffer, depthbuffer, depthTex, edgesTex, blendTex, areaTex, searchTex, TexBloomH, TexBloomV, texture_count };
+
+	for (const float bloom_size : { 0.25f, 1.0f })
+	{
+		const uint32_t width = 1280, height = 720;
+		const uint32_t bloom_width = uint32_t(width * bloom_size), bloom_height = uint32_t(height * bloom_size);
+
+		std::vector<alias_texture_desc> textures(texture_count);
+		textures[depthTex] = make_texture(width, height, 111);
+		textures[edgesTex] = make_texture(width, height, 22);
+		textures[blendTex] = make_texture(width, height, 21);
+		textures[areaTex] = make_texture(160, 560, 22, false);
+		textures[searchTex] = make_texture(64, 16, 22, false);
+		textures[TexBloomH] = make_texture(bloom_width, bloom_height, 21);
+		textures[TexBloomV] = make_texture(bloom_width, bloom_height, 21);
+
+		const std::vector<alias_pass_desc> passes = {
+			// SMAA: LinearizeDepthPass, EdgeDetectionPass, BlendWeightCalculationPass, NeighborhoodBlendingPass
+			make_pass({ depthbuffer }, { depthTex }),
+			make_pass({ depthTex, backbuffer }, { edgesTex }),
+			make_pass({ edgesTex, areaTex, searchTex }, { blendTex }),
+			make_pass({ backbuffer, blendTex }, {}),
+			// Pirate_Bloom: BloomH, BloomV, BloomH2, BloomV2, Combine
+			make_pass({ backbuffer }, { TexBloomH }),
+			make_pass({ TexBloomH }, { TexBloomV }),
+			make_pass({ TexBloomV }, { TexBloomH }),
+			make_pass({ TexBloomH }, { TexBloomV }),
+			make_pass({ backbuffer, TexBloomV }, {}),
+			// CRTFrutbunn, CRT_Lottes, CRTRefresh
+			make_pass({ backbuffer }, {}),
+			make_pass({ backbuffer }, {}),
+			make_pass({ backbuffer }, {}) };
+
+		const alias_plan plan = plan_texture_aliases(textures, passes);
+		validate(textures, passes, plan);
+
+		printf("embedded effects, bloom size %.2f: %zu KiB -> %zu KiB", bloom_size, plan.memory_before / 1024, plan.memory_after / 1024);
+		for (size_t i = 0; i < texture_count; i++)
+			if (plan.memory_of[i] != i)
+				printf(", %zu shares %zu", i, plan.memory_of[i]);
+		printf("\n");
+
+		// The bloom textures only match the SMAA textures in size at full resolution
+		if (bloom_size < 1.0f)
+			CHECK(plan.memory_after == plan.memory_before);
+		else
+			CHECK(plan.memory_of[TexBloomH] == blendTex && plan.memory_of[TexBloomV] == TexBloomV);
+	}
+}
+
+static void test_random_graphs()
+{
+	std::mt19937 rng(7);
+	size_t memory_before = 0, memory_after = 0;
+
+	for (int iteration = 0; iteration < 20000; iteration++)
+	{
+		const size_t texture_count = 1 + rng() % 12, pass_count = 1 + rng() % 16;
+
+		std::vector<alias_texture_desc> textures;
+		for (size_t i = 0; i < texture_count; i++)
+			textures.push_back(make_texture(64 << (rng() % 2), 64, rng() % 2, rng() % 8 != 0));
+
+		std::vector<alias_pass_desc> passes(pass_count);
+		for (alias_pass_desc &pass : passes)
+		{
+			for (size_t k = rng() % 3; k--;)
+				pass.reads.push_back(rng() % texture_count);
+			for (size_t k = rng() % 3; k--;)
+				pass.writes.push_back(rng() % texture_count);
+			pass.overwrites_render_targets = rng() % 4 != 0;
+		}
+
+		const alias_plan plan = plan_texture_aliases(textures, passes);
+		const size_t blocks = validate(textures, passes, plan);
+
+		// Lower bound: own memory for every texture that cannot be aliased plus the peak number of live transient textures per description
+		std::vector<size_t> first, last;
+		std::vector<bool> transient;
+		compute_lifetimes(texture_count, passes, first, last, transient);
+
+		size_t bound = 0;
+		for (size_t i = 0; i < texture_count; i++)
+			if (!(textures[i].aliasable && transient[i]))
+				bound++;
+
+		for (const uint32_t width : { 64u, 128u })
+		{
+			for (const uint32_t format : { 0u, 1u })
+			{
+				size_t peak = 0;
+				for (size_t pass = 0; pass < pass_count; pass++)
+				{
+					size_t live = 0;
+					for (size_t i = 0; i < texture_count; i++)
+						if (textures[i].aliasable && transient[i] && textures[i].width == width && textures[i].format == format && first[i] <= pass && pass <= last[i])
+							live++;
+					peak = std::max(peak, live);
+				}
+				bound += peak;
+			}
+		}
+
+		CHECK(blocks == bound);
+
+		memory_before += plan.memory_before;
+		memory_after += plan.memory_after;
+	}
+
+	printf("random graphs: %.1f%% of the memory remains\n", 100.0 * memory_after / memory_before);
+}
+
+int main()
+{
+	test_chain();
+	test_excluded_textures();
+	test_embedded_effects();
+	test_random_graphs();
+
+	printf("%s (%d failures)\n", failures ? "FAILED" : "passed", failures);
+
+	return failures != 0;
+}
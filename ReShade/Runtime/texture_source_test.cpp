@@ -0,0 +1,106 @@
+// Checks the cache of decoded texture source images on the embedded effects
+//
+// The first load decodes every source image once for each size it is used at. Reloading the effects or resetting the
+// device afterwards has to upload every texture with a source again, from the same cache entries and without decoding
+// anything, and the pixels have to be the ones uploaded the first time.
+//
+// Usage: run from the repository root of a Windows checkout, with a built d3d8.dll for the embedded resources
+//   cl /std:c++17 /EHsc /O2 /I. /IResources /IExternal\reshade\deps\stb /IExternal\reshade\deps\stb_image_dds /DSTBI_NO_STDIO /DSTBI_NO_LINEAR /D_CRT_SECURE_NO_WARNINGS
+//      ReShade\Runtime\texture_source_test.cpp ReShade\Runtime\runtime_config.cpp ReShade\stb\stb_impl.c
+//      External\reshade\source\effect_codegen_hlsl.cpp External\reshade\source\effect_expression.cpp External\reshade\source\effect_lexer.cpp
+//      External\reshade\source\effect_parser.cpp External\reshade\source\effect_preprocessor.cpp External\reshade\source\effect_symbol_table.cpp
+//   texture_source_test [bin\Release\d3d8.dll]
+
+#include "runtime_test.hpp"
+
+using namespace reshade;
+
+// Remembers the pixels each texture got the first time and compares every later upload against them
+class upload_runtime : public runtime_test
+{
+public:
+	void upload_texture(const texture &texture, const uint8_t *pixels) override
+	{
+		uploads++;
+		uploaded_from.push_back(pixels);
+
+		const size_t size = texture.width * texture.height * 4;
+		const auto it = first_pixels.find(texture.unique_name);
+		if (it == first_pixels.end())
+			first_pixels.emplace(texture.unique_name, std::vector<uint8_t>(pixels, pixels + size));
+		else
+			mismatches += it->second.size() != size || std::memcmp(it->second.data(), pixels, size) != 0;
+	}
+
+	size_t sourced_textures() const
+	{
+		return std::count_if(_textures.begin(), _textures.end(),
+			[](const texture &texture) { return !texture.annotation_as_string("source").empty(); });
+	}
+
+	std::map<std::string, std::vector<uint8_t>> first_pixels;
+	std::vector<const uint8_t *> uploaded_from;
+	size_t uploads = 0;
+	size_t mismatches = 0;
+};
+
+// The decoded images in the cache, which have to stay the same objects once they are there
+static std::vector<const std::vector<uint8_t> *> cache_entries()
+{
+	std::vector<const std::vector<uint8_t> *> entries;
+	const std::lock_guard<std::mutex> lock(texture_source_cache_mutex);
+	for (const auto &[key, pixels] : texture_source_cache)
+		entries.push_back(pixels.get());
+	return entries;
+}
+
+// Every upload passes the cached pixels themselves, not a copy of them
+static bool uploaded_from_cache(const upload_runtime &runtime, const std::vector<const std::vector<uint8_t> *> &entries)
+{
+	return std::all_of(runtime.uploaded_from.begin(), runtime.uploaded_from.end(), [&entries](const uint8_t *pixels) {
+		return std::any_of(entries.begin(), entries.end(), [pixels](const std::vector<uint8_t> *entry) { return entry->data() == pixels; }); });
+}
+
+int main(int argc, char *argv[])
+{
+	if (!load_resource_module(argc, argv))
+		return 1;
+
+	upload_runtime runtime;
+	runtime.load_all();
+
+	const size_t sourced_textures = runtime.sourced_textures();
+	const std::vector<const std::vector<uint8_t> *> entries = cache_entries();
+	printf("%zu textures with a source image, %zu decoded images in the cache\n", sourced_textures, entries.size());
+
+	CHECK(sourced_textures != 0 && runtime.uploads == sourced_textures);
+	CHECK(!entries.empty() && entries.size() <= sourced_textures);
+	CHECK(runtime._last_texture_reload_successfull);
+	CHECK(uploaded_from_cache(runtime, entries));
+
+	// Reloading effects, resetting the device or both, several times over
+	for (int round = 0; round < 6; ++round)
+	{
+		runtime.uploads = 0;
+		runtime.uploaded_from.clear();
+
+		runtime.on_reset(round % 3 != 2);
+		if (round % 3 == 1)
+		{
+			runtime_test other;
+			other.load_all();
+		}
+		runtime.load_all();
+
+		CHECK(runtime.sourced_textures() == sourced_textures && runtime.uploads == sourced_textures);
+		CHECK(cache_entries() == entries);
+		CHECK(runtime._last_texture_reload_successfull);
+		CHECK(uploaded_from_cache(runtime, entries));
+	}
+
+	CHECK(runtime.mismatches == 0);
+
+	if (failures == 0)
+		printf("All texture source checks passed\n");
+	return failures != 0;
+}
@@ -0,0 +1,174 @@
+// Checks the per-frame uniform updates and the dirty constant upload on the embedded effects
+//
+// Every uniform with a per-frame source has exactly one update record, with its annotations resolved at load. Setting a
+// uniform marks just the registers it covers. Rendering goes through the same upload as runtime_d3d9::render_technique
+// into a register file that the application overwrites every frame, and the registers have to hold the storage of the
+// effect at each technique. Also prints the constant bytes uploaded per frame with several techniques per effect,
+// rendered one after another and interleaved with the other effects.
+//
+// Usage: run from the repository root of a Windows checkout, with a built d3d8.dll for the embedded resources
+//   cl /std:c++17 /EHsc /O2 /I. /IResources /IExternal\reshade\deps\stb /IExternal\reshade\deps\stb_image_dds /DSTBI_NO_STDIO /DSTBI_NO_LINEAR /D_CRT_SECURE_NO_WARNINGS
+//      ReShade\Runtime\uniform_upload_test.cpp ReShade\Runtime\runtime_config.cpp ReShade\stb\stb_impl.c
+//      External\reshade\source\effect_codegen_hlsl.cpp External\reshade\source\effect_expression.cpp External\reshade\source\effect_lexer.cpp
+//      External\reshade\source\effect_parser.cpp External\reshade\source\effect_preprocessor.cpp External\reshade\source\effect_symbol_table.cpp
+//   uniform_upload_test [bin\Release\d3d8.dll]
+
+#include "runtime_test.hpp"
+
+using namespace reshade;
+
+// Keeps the pixel shader constant registers like the device would, uploads the same registers as runtime_d3d9 does
+class upload_runtime : public runtime_test
+{
+public:
+	void render_technique(technique &technique) override
+	{
+		effect &effect = _effects[technique.effect_index];
+		const size_t constant_register_count = (effect.uniform_data_storage.size() + 15) / 16;
+		if (constant_register_count == 0)
+			return;
+
+		size_t first_register, register_count;
+		effect.take_dirty_registers(first_register, register_count);
+		if (constants_effect_index != technique.effect_index || constant_register_count > 255)
+			first_register = 0, register_count = constant_register_count;
+		constants_effect_index = technique.effect_index;
+
+		if (register_count != 0)
+		{
+			std::memcpy(registers[first_register], effect.uniform_data_storage.data() + first_register * 16, std::min(register_count * 16, effect.uniform_data_storage.size() - first_register * 16));
+			uploaded_bytes += register_count * 16;
+		}
+
+		mismatches += std::memcmp(registers, effect.uniform_data_storage.data(), effect.uniform_data_storage.size()) != 0;
+	}
+
+	// The application sets its own constants between two frames
+	void present()
+	{
+		on_present();
+		for (float *reg : registers)
+			std::fill_n(reg, 4, -12345.0f);
+		constants_effect_index = std::numeric_limits<size_t>::max();
+	}
+
+	float registers[256][4] = {};
+	size_t constants_effect_index = std::numeric_limits<size_t>::max();
+	size_t uploaded_bytes = 0;
+	size_t mismatches = 0;
+};
+
+// Renders a number of frames with every technique enabled, each in the list 'copies' times, and returns the constant bytes uploaded per frame
+static size_t render_frames(upload_runtime &runtime, const std::vector<technique> &techniques, size_t copies, bool interleaved)
+{
+	runtime._techniques.clear();
+	for (size_t c = 0; c < copies && interleaved; ++c)
+		runtime._techniques.insert(runtime._techniques.end(), techniques.begin(), techniques.end());
+	for (size_t t = 0; t < techniques.size() && !interleaved; ++t)
+		runtime._techniques.insert(runtime._techniques.end(), copies, techniques[t]);
+
+	runtime.uploaded_bytes = 0;
+	const int frames = 100;
+	for (int frame = 0; frame < frames; ++frame)
+	{
+		runtime.update_and_render_effects();
+		runtime.present();
+	}
+	return runtime.uploaded_bytes / frames;
+}
+
+int main(int argc, char *argv[])
+{
+	if (!load_resource_module(argc, argv))
+		return 1;
+
+	upload_runtime runtime;
+	runtime.load_all();
+
+	// One update record per uniform with a per-frame source, pointing back at it
+	size_t storage_size = 0, per_frame_uniforms = 0;
+	for (const effect &effect : runtime._effects)
+	{
+		storage_size += effect.uniform_data_storage.size();
+		for (size_t index = 0; index < effect.uniforms.size(); ++index)
+		{
+			const uniform &variable = effect.uniforms[index];
+			const size_t records = std::count_if(effect.uniform_updates.begin(), effect.uniform_updates.end(),
+				[index](const uniform_update &update) { return update.uniform_index == index; });
+
+			switch (variable.special)
+			{
+			case special_uniform::frame_time:
+			case special_uniform::frame_count:
+			case special_uniform::date:
+			case special_uniform::timer:
+			case special_uniform::bufready_depth:
+			case special_uniform::random:
+			case special_uniform::ping_pong:
+				per_frame_uniforms++;
+				CHECK(records == 1);
+				break;
+			default:
+				CHECK(records == 0);
+				break;
+			}
+		}
+
+		for (const uniform_update &update : effect.uniform_updates)
+		{
+			CHECK(update.uniform_index < effect.uniforms.size() && update.special == effect.uniforms[update.uniform_index].special);
+			const uniform &variable = effect.uniforms[update.uniform_index];
+			if (update.special == special_uniform::random)
+				CHECK(update.random_min == variable.annotation_as_int("min", 0, 0) && update.random_max == variable.annotation_as_int("max", 0, RAND_MAX));
+			if (update.special == special_uniform::ping_pong)
+				CHECK(update.ping_pong_max == variable.annotation_as_float("max", 0, 1.0f) && update.ping_pong_step[1] == variable.annotation_as_float("step", 1));
+		}
+	}
+	CHECK(per_frame_uniforms != 0);
+
+	// Setting a uniform marks only its own registers, and taking them marks the storage clean again
+	for (effect &effect : runtime._effects)
+	{
+		size_t first_register, register_count;
+		effect.take_dirty_registers(first_register, register_count);
+
+		for (uniform &variable : effect.uniforms)
+		{
+			std::vector<uint8_t> data(variable.size);
+			runtime.get_uniform_value(variable, data.data(), data.size(), 0);
+			runtime.set_uniform_value(variable, data.data(), data.size(), 0);
+
+			effect.take_dirty_registers(first_register, register_count);
+			CHECK(first_register == variable.offset / 16 && first_register + register_count == (variable.offset + variable.size + 15) / 16);
+			effect.take_dirty_registers(first_register, register_count);
+			CHECK(register_count == 0);
+		}
+	}
+
+	// Render every technique, including the ones the preset leaves disabled
+	std::vector<technique> techniques = runtime._techniques;
+	for (technique &technique : techniques)
+	{
+		technique.impl = &technique;
+		technique.enabled = true;
+		runtime._effects[technique.effect_index].rendering = 1;
+	}
+
+	const size_t single = render_frames(runtime, techniques, 1, false);
+	const size_t consecutive = render_frames(runtime, techniques, 3, false);
+	const size_t interleaved = render_frames(runtime, techniques, 3, true);
+	printf("%zu techniques, %zu bytes of uniform storage, %zu per-frame uniforms\n", techniques.size(), storage_size, per_frame_uniforms);
+	printf("constant bytes per frame: %zu with one technique per effect, %zu with three in a row, %zu with three interleaved\n", single, consecutive, interleaved);
+
+	CHECK(runtime.mismatches == 0);
+	// Later techniques of the same effect find their values still in the registers, unless another effect was rendered in between
+	CHECK(single != 0 && consecutive == single && interleaved == 3 * single);
+
+	runtime._techniques = techniques;
+	for (technique &technique : runtime._techniques)
+		technique.impl = nullptr, technique.enabled = false;
+
+	if (failures == 0)
+		printf("All uniform upload checks passed\n");
+	return failures != 0;
+}
@@ -0,0 +1,62 @@
+// Converts a glTF model to the preprocessed binary format ModelGLTF loads without any glTF parsing
+//
+// The output goes next to the glTF with the .sh2m extension, which is where ModelGLTF::LoadFromFile looks for it.
+// The converted file remembers the size and last write time of the glTF, so it is ignored (and the glTF parsed again)
+// once the glTF changes, run the converter again after editing a model.
+//
+// Usage: ModelConvert <input.glb|input.gltf> [output.sh2m] [-color]
+//   -color  convert for ModelGLTF::VertexType::PosNormalColorTexcoord instead of PosNormalTexcoord
+
+#include "Common/ModelFile.h"
+
+#include <cstdio>
+#include <cstring>
+
+int main(int argc, char* argv[]) {
+    const char* input = nullptr;
+    const char* output = nullptr;
+    ModelFile::VertexLayout layout = ModelFile::VertexLayout::PosNormalTexcoord;
+
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "-color")) {
+            layout = ModelFile::VertexLayout::PosNormalColorTexcoord;
+        } else if (!input) {
+            input = argv[i];
+        } else if (!output) {
+            output = argv[i];
+        }
+    }
+
+    if (!input) {
+        std::printf("usage: ModelConvert <input.glb|input.gltf> [output.sh2m] [-color]\n");
+        return 1;
+    }
+
+    ModelFile::Model model;
+    if (!ModelFile::ImportGLTF(input, layout, model)) {
+        std::printf("failed to import '%s'\n", input);
+        return 1;
+    }
+
+    std::filesystem::path outputPath;
+    if (output) {
+        outputPath = std::filesystem::u8path(output);
+    } else {
+        outputPath = std::filesystem::u8path(input);
+        outputPath.replace_extension(ModelFile::kExtension);
+    }
+
+    ModelFile::Source source;
+    if (!ModelFile::GetSource(std::filesystem::u8path(input), source)) {
+        std::printf("failed to read '%s'\n", input);
+        return 1;
+    }
+    if (!ModelFile::Save(outputPath, model, source)) {
+        std::printf("failed to write '%s'\n", outputPath.u8string().c_str());
+        return 1;
+    }
+
+    std::printf("%s: %zu vertices, %zu indices, %zu nodes, %zu animation keys, %zu images\n", outputPath.u8string().c_str(),
+                model.vertices.size() / ModelFile::GetVertexSize(layout), model.indices.size(), model.nodes.size(), model.timeline.size(), model.images.size());
+    return 0;
+}
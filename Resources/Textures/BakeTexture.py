@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+#
+# Bakes a PNG into a C++ header holding the decoded A8R8G8B8 pixels and the full mip chain, so the texture can be
+# uploaded with GfxCreateTextureFromRaw without decoding anything at runtime.
+#
+# The mips use the same 2x2 box filter as MipChain::Build, so baked and runtime built chains are identical.
+#
+# Usage: BakeTexture.py <input.png> <output.h> <symbol>
+#   e.g. BakeTexture.py dudv128.png ..\..\Patches\WaterEnhancement_dudv.h DuDv_128x128
+
+import os
+import struct
+import sys
+import zlib
+
+
+def decode_png(data):
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('not a PNG file')
+
+    pos, idat, header = 8, b'', None
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            header = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'IDAT':
+            idat += chunk
+        elif kind == b'IEND':
+            break
+
+    width, height, depth, color, _, _, interlace = header
+    channels = {0: 1, 2: 3, 4: 2, 6: 4}.get(color)
+    if depth != 8 or not channels or interlace:
+        raise ValueError('only non-interlaced 8-bit gray, gray+alpha, RGB and RGBA images are supported')
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    prev = bytearray(stride)
+    rows = []
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        row = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for x in range(stride):
+            a = row[x - channels] if x >= channels else 0
+            b = prev[x]
+            c = prev[x - channels] if x >= channels else 0
+            if kind == 1:
+                row[x] = (row[x] + a) & 0xFF
+            elif kind == 2:
+                row[x] = (row[x] + b) & 0xFF
+            elif kind == 3:
+                row[x] = (row[x] + ((a + b) >> 1)) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                row[x] = (row[x] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        rows.append(row)
+        prev = row
+
+    # expand to (r, g, b, a) the same way stbi_load does with STBI_rgb_alpha
+    pixels = []
+    for row in rows:
+        for x in range(width):
+            px = row[x * channels:(x + 1) * channels]
+            if channels == 1:
+                pixels.append((px[0], px[0], px[0], 255))
+            elif channels == 2:
+                pixels.append((px[0], px[0], px[0], px[1]))
+            elif channels == 3:
+                pixels.append((px[0], px[1], px[2], 255))
+            else:
+                pixels.append(tuple(px))
+    return width, height, pixels
+
+
+def downsample(pixels, width, height):
+    dst_w, dst_h = max(width >> 1, 1), max(height >> 1, 1)
+    step_x, step_y = (1 if width > 1 else 0), (1 if height > 1 else 0)
+    result = []
+    for y in range(dst_h):
+        y0 = y * 2 * step_y
+        for x in range(dst_w):
+            x0 = x * 2 * step_x
+            quad = (pixels[y0 * width + x0], pixels[y0 * width + x0 + step_x],
+                    pixels[(y0 + step_y) * width + x0], pixels[(y0 + step_y) * width + x0 + step_x])
+            result.append(tuple((sum(p[c] for p in quad) + 2) >> 2 for c in range(4)))
+    return result, dst_w, dst_h
+
+
+def main():
+    if len(sys.argv) != 4:
+        print('usage: BakeTexture.py <input.png> <output.h> <symbol>')
+        return 1
+
+    src, dst, symbol = sys.argv[1:]
+    with open(src, 'rb') as f:
+        width, height, level = decode_png(f.read())
+
+    words, num_mips, w, h = [], 0, width, height
+    while True:
+        words += ['0x%02X%02X%02X%02X' % (a, r, g, b) for r, g, b, a in level]
+        num_mips += 1
+        if w == 1 and h == 1:
+            break
+        level, w, h = downsample(level, w, h)
+
+    with open(dst, 'w', newline='\n') as f:
+        f.write('/* %s, baked by Resources/Textures/BakeTexture.py, do not edit\n' % os.path.basename(src))
+        f.write('   %ux%u A8R8G8B8, %u mips */\n\n' % (width, height, num_mips))
+        f.write('const uint32_t %s_pixels[%u] = {\n' % (symbol, len(words)))
+        for i in range(0, len(words), 8):
+            f.write('\t' + ', '.join(words[i:i + 8]) + (',\n' if i + 8 < len(words) else '\n'))
+        f.write('};\n\n')
+        f.write('const GfxRawTexture %s = { %u, %u, %u, %s_pixels };\n' % (symbol, width, height, num_mips, symbol))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
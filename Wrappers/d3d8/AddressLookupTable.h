@@ -2,8 +2,82 @@
 
 #include <unordered_map>
 #include <algorithm>
+#include <vector>
+#include <new>
+#include <type_traits>
+#include "Logging\Logging.h"
 
 constexpr UINT MaxD8Index = 11;
+constexpr UINT D8PoolSlabSize = 256;
+
+// Slab allocator for wrapper objects, released slots go on a free list and are only handed back to the heap when the pool is destroyed
+template <typename T>
+class AddressPoolD3d8
+{
+public:
+	struct POOLSTATS
+	{
+		UINT Live = 0;
+		UINT Peak = 0;
+		UINT Slabs = 0;
+		DWORD Allocations = 0;
+		DWORD Recycled = 0;
+	};
+
+	AddressPoolD3d8() {}
+	AddressPoolD3d8(const AddressPoolD3d8&) = delete;
+	AddressPoolD3d8& operator=(const AddressPoolD3d8&) = delete;
+	~AddressPoolD3d8()
+	{
+		for (auto& Slab : Slabs)
+		{
+			::operator delete(Slab);
+		}
+	}
+
+	void *Allocate()
+	{
+		Stats.Allocations++;
+		Stats.Live++;
+		Stats.Peak = max(Stats.Peak, Stats.Live);
+
+		if (!FreeSlots.empty())
+		{
+			void *Storage = FreeSlots.back();
+			FreeSlots.pop_back();
+			Stats.Recycled++;
+			return Storage;
+		}
+
+		if (Slabs.empty() || SlabUsed == D8PoolSlabSize)
+		{
+			Slabs.push_back(::operator new(sizeof(T) * D8PoolSlabSize));
+			SlabUsed = 0;
+			Stats.Slabs++;
+		}
+		return static_cast<T*>(Slabs.back()) + SlabUsed++;
+	}
+
+	void Free(void *Storage)
+	{
+		FreeSlots.push_back(Storage);
+		Stats.Live--;
+	}
+
+	void CountRecycled()
+	{
+		Stats.Allocations++;
+		Stats.Recycled++;
+	}
+
+	const POOLSTATS& GetStats() const { return Stats; }
+
+private:
+	std::vector<void*> Slabs;
+	std::vector<void*> FreeSlots;
+	UINT SlabUsed = 0;
+	POOLSTATS Stats;
+};
 
 template <typename D>
 class AddressLookupTableD3d8
@@ -14,11 +88,19 @@ public:
 	{
 		ConstructorFlag = true;
 
-		for (const auto& cache : g_map)
+		for (UINT x = 0; x < MaxD8Index; x++)
 		{
-			for (const auto& entry : cache)
+			for (const auto& entry : g_map[x])
 			{
-				entry.second->DeleteMe();
+				if (IsPooledIndex(x))
+				{
+					// Memory is owned by the slabs
+					entry.second->~AddressLookupTableD3d8Object();
+				}
+				else
+				{
+					entry.second->DeleteMe();
+				}
 			}
 		}
 	}
@@ -62,7 +144,60 @@ public:
 			return static_cast<T *>(it->second);
 		}
 
-		return new T(static_cast<T *>(Proxy), pDevice);
+		return CreateInterface<T>(Proxy);
+	}
+
+	// Creates a new wrapper, reusing the slot of a stale wrapper when the proxy address has been handed out again before its wrapper was released
+	template <typename T>
+	T *CreateInterface(void *Proxy)
+	{
+		AddressPoolD3d8<T> *pPool = GetPool<T>();
+		if (!pPool || !Proxy)
+		{
+			return new T(static_cast<T *>(Proxy), pDevice);
+		}
+
+		constexpr UINT CacheIndex = AddressCacheIndex<T>::CacheIndex;
+		auto it = g_map[CacheIndex].find(Proxy);
+
+		void *Storage = nullptr;
+		if (it != std::end(g_map[CacheIndex]))
+		{
+			// The old object was released so the runtime could reuse its address, rebuild the wrapper in place
+			T *pStale = static_cast<T *>(it->second);
+			g_map[CacheIndex].erase(it);
+			pStale->~T();
+			Storage = pStale;
+			pPool->CountRecycled();
+		}
+		else
+		{
+			Storage = pPool->Allocate();
+		}
+
+		return new (Storage) T(static_cast<T *>(Proxy), pDevice);
+	}
+
+	// Destroys a pooled wrapper once its proxy has been released for the last time and puts its slot on the free list
+	template <typename T>
+	void ReleaseInterface(T *Wrapper, void *Proxy)
+	{
+		AddressPoolD3d8<T> *pPool = GetPool<T>();
+		if (!pPool || !Wrapper || ConstructorFlag)
+		{
+			return;
+		}
+
+		constexpr UINT CacheIndex = AddressCacheIndex<T>::CacheIndex;
+		auto it = g_map[CacheIndex].find(Proxy);
+
+		if (it != std::end(g_map[CacheIndex]) && it->second == Wrapper)
+		{
+			g_map[CacheIndex].erase(it);
+		}
+
+		Wrapper->~T();
+		pPool->Free(Wrapper);
 	}
 
 	template <typename T>
@@ -75,6 +210,46 @@ public:
 		}
 	}
 
+	template <typename T>
+	AddressPoolD3d8<T> *GetPool()
+	{
+		if constexpr (std::is_same_v<T, m_IDirect3DTexture8>)
+		{
+			return &TexturePool;
+		}
+		else if constexpr (std::is_same_v<T, m_IDirect3DSurface8>)
+		{
+			return &SurfacePool;
+		}
+		else if constexpr (std::is_same_v<T, m_IDirect3DVertexBuffer8>)
+		{
+			return &VertexBufferPool;
+		}
+		else if constexpr (std::is_same_v<T, m_IDirect3DIndexBuffer8>)
+		{
+			return &IndexBufferPool;
+		}
+		else
+		{
+			return nullptr;
+		}
+	}
+
+	void LogPoolStats(const char *Caller)
+	{
+		LARGE_INTEGER Frequency = {}, Now = {};
+		QueryPerformanceFrequency(&Frequency);
+		QueryPerformanceCounter(&Now);
+		const double Seconds = (LastStatsTime.QuadPart && Frequency.QuadPart) ? (double)(Now.QuadPart - LastStatsTime.QuadPart) / Frequency.QuadPart : 0.0;
+
+		LogPool(Caller, "texture", TexturePool.GetStats(), LastAllocations[0], Seconds);
+		LogPool(Caller, "surface", SurfacePool.GetStats(), LastAllocations[1], Seconds);
+		LogPool(Caller, "vertex buffer", VertexBufferPool.GetStats(), LastAllocations[2], Seconds);
+		LogPool(Caller, "index buffer", IndexBufferPool.GetStats(), LastAllocations[3], Seconds);
+
+		LastStatsTime = Now;
+	}
+
 	template <typename T>
 	void DeleteAddress(T *Wrapper)
 	{
@@ -94,9 +269,36 @@ public:
 	}
 
 private:
+	static constexpr bool IsPooledIndex(UINT CacheIndex)
+	{
+		return CacheIndex == AddressCacheIndex<m_IDirect3DTexture8>::CacheIndex ||
+			CacheIndex == AddressCacheIndex<m_IDirect3DSurface8>::CacheIndex ||
+			CacheIndex == AddressCacheIndex<m_IDirect3DVertexBuffer8>::CacheIndex ||
+			CacheIndex == AddressCacheIndex<m_IDirect3DIndexBuffer8>::CacheIndex;
+	}
+
+	template <typename S>
+	static void LogPool(const char *Caller, const char *Name, const S& Stats, DWORD& LastAllocations, double Seconds)
+	{
+		const DWORD NewAllocations = Stats.Allocations - LastAllocations;
+		LastAllocations = Stats.Allocations;
+
+		Logging::Log() << Caller << " Wrapper pool " << Name << ": live " << Stats.Live << " peak " << Stats.Peak <<
+			" slabs " << Stats.Slabs << " allocations " << Stats.Allocations << " recycled " << Stats.Recycled <<
+			" rate " << (Seconds > 0.0 ? NewAllocations / Seconds : 0.0) << "/s";
+	}
+
 	bool ConstructorFlag = false;
 	D *const pDevice;
 	std::unordered_map<void*, class AddressLookupTableD3d8Object*> g_map[MaxD8Index];
+
+	// Pools for the wrapper types that get created in bulk on every room change
+	AddressPoolD3d8<m_IDirect3DTexture8> TexturePool;
+	AddressPoolD3d8<m_IDirect3DSurface8> SurfacePool;
+	AddressPoolD3d8<m_IDirect3DVertexBuffer8> VertexBufferPool;
+	AddressPoolD3d8<m_IDirect3DIndexBuffer8> IndexBufferPool;
+	DWORD LastAllocations[4] = {};
+	LARGE_INTEGER LastStatsTime = {};
 };
 
 class AddressLookupTableD3d8Object
@@ -0,0 +1,257 @@
+/**
+* Copyright (C) 2024 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "d3d8wrapper.h"
+#include "CallRecorder.h"
+#include "Common\Hash.h"
+#include <shlwapi.h>
+#include <chrono>
+#include <ctime>
+
+CallRecorder DeviceCallRecorder;
+
+void CallRecorder::WriteVarint(uint32_t Value)
+{
+	while (Value >= 0x80)
+	{
+		Stream.push_back(static_cast<uint8_t>(Value | 0x80));
+		Value >>= 7;
+	}
+	Stream.push_back(static_cast<uint8_t>(Value));
+}
+
+void CallRecorder::Record(CALLID Call, std::initializer_list<uint32_t> Args)
+{
+	if (!Recording)
+	{
+		return;
+	}
+
+	Stream.push_back(Call);
+	Stream.push_back(static_cast<uint8_t>(Args.size()));
+	for (const uint32_t Arg : Args)
+	{
+		WriteVarint(Arg);
+	}
+}
+
+void CallRecorder::WriteHash(const void *pData, size_t Size)
+{
+	const uint64_t Hash = (pData && Size) ? Hash64(pData, Size) : 0;
+
+	WriteVarint(static_cast<uint32_t>(Hash));
+	WriteVarint(static_cast<uint32_t>(Hash >> 32));
+}
+
+void CallRecorder::RecordWithHash(CALLID Call, std::initializer_list<uint32_t> Args, const void *pData, size_t Size)
+{
+	if (!Recording)
+	{
+		return;
+	}
+
+	Stream.push_back(Call);
+	Stream.push_back(static_cast<uint8_t>(Args.size() + 2));
+	for (const uint32_t Arg : Args)
+	{
+		WriteVarint(Arg);
+	}
+	WriteHash(pData, Size);
+}
+
+void CallRecorder::RecordWithHash(CALLID Call, std::initializer_list<uint32_t> Args, const void *pData, size_t Size, const void *pData2, size_t Size2)
+{
+	if (!Recording)
+	{
+		return;
+	}
+
+	Stream.push_back(Call);
+	Stream.push_back(static_cast<uint8_t>(Args.size() + 4));
+	for (const uint32_t Arg : Args)
+	{
+		WriteVarint(Arg);
+	}
+	WriteHash(pData, Size);
+	WriteHash(pData2, Size2);
+}
+
+uint32_t CallRecorder::GetResourceId(const void *pResource)
+{
+	if (!pResource)
+	{
+		return 0;
+	}
+
+	auto it = ResourceIds.find(pResource);
+	if (it != ResourceIds.end())
+	{
+		return it->second;
+	}
+
+	const uint32_t Id = NextResourceId++;
+	ResourceIds[pResource] = Id;
+	return Id;
+}
+
+void CallRecorder::OnCreate(CALLID Call, const void *pResource, std::initializer_list<uint32_t> Args)
+{
+	if (!Recording || !pResource)
+	{
+		return;
+	}
+
+	// Wrapper slots can be reused, so a creation always gets a new id
+	const uint32_t Id = NextResourceId++;
+	ResourceIds[pResource] = Id;
+
+	Stream.push_back(Call);
+	Stream.push_back(static_cast<uint8_t>(Args.size() + 1));
+	WriteVarint(Id);
+	for (const uint32_t Arg : Args)
+	{
+		WriteVarint(Arg);
+	}
+}
+
+uint32_t CallRecorder::GetVertexCount(uint32_t PrimitiveType, uint32_t PrimitiveCount)
+{
+	switch (PrimitiveType)
+	{
+	case D3DPT_POINTLIST:
+		return PrimitiveCount;
+	case D3DPT_LINELIST:
+		return PrimitiveCount * 2;
+	case D3DPT_LINESTRIP:
+		return PrimitiveCount + 1;
+	case D3DPT_TRIANGLELIST:
+		return PrimitiveCount * 3;
+	case D3DPT_TRIANGLESTRIP:
+	case D3DPT_TRIANGLEFAN:
+		return PrimitiveCount + 2;
+	default:
+		return 0;
+	}
+}
+
+void CallRecorder::OnLock(const void *pResource, uint32_t Level, const void *pData, size_t Size, const void *pContainer, uint32_t ContainerLevel)
+{
+	if (Recording && pResource && pData && Size)
+	{
+		LockedData[reinterpret_cast<uintptr_t>(pResource) ^ (static_cast<uint64_t>(Level) << 48)] =
+			{ pData, Size, pContainer ? pContainer : pResource, pContainer ? ContainerLevel : Level };
+	}
+}
+
+void CallRecorder::OnUnlock(const void *pResource, uint32_t Level)
+{
+	if (!Recording)
+	{
+		return;
+	}
+
+	auto it = LockedData.find(reinterpret_cast<uintptr_t>(pResource) ^ (static_cast<uint64_t>(Level) << 48));
+	if (it != LockedData.end())
+	{
+		RecordWithHash(CALL_UPDATERESOURCE, { GetResourceId(it->second.pResource), it->second.Level }, it->second.pData, it->second.Size);
+		LockedData.erase(it);
+	}
+}
+
+void CallRecorder::Begin()
+{
+	Stream.clear();
+	Stream.reserve(16 * 1024 * 1024);
+	ResourceIds.clear();
+	LockedData.clear();
+	NextResourceId = 1;
+	FramesLeft = CaptureFrames;
+	FramesRecorded = 0;
+	Recording = true;
+
+	Logging::Log() << __FUNCTION__ << " Recording device calls for " << CaptureFrames << " frames...";
+}
+
+bool CallRecorder::End()
+{
+	Recording = false;
+
+	// Get current time and date
+	const std::time_t t = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+	tm tm; localtime_s(&tm, &t);
+
+	char timestamp[21];
+	sprintf_s(timestamp, " %.4d-%.2d-%.2d %.2d-%.2d-%.2d", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec);
+	std::string name("CallStream" + std::string(timestamp) + ".bin");
+
+	// Get Silent Hill 2 folder
+	wchar_t path[MAX_PATH] = {};
+	bool ret = GetSH2FolderPath(path, MAX_PATH);
+	wchar_t* pdest = wcsrchr(path, '\\');
+	if (ret && pdest)
+	{
+		*pdest = '\0';
+		wcscat_s(path, MAX_PATH, L"\\callstreams\\");
+		if (!PathFileExists(path))
+		{
+			CreateDirectory(path, nullptr);
+		}
+	}
+	std::wstring filename(path + std::wstring(name.begin(), name.end()));
+
+	FILE *file = nullptr;
+	if (_wfopen_s(&file, filename.c_str(), L"wb") != 0 || !file)
+	{
+		Logging::Log() << __FUNCTION__ << " Error: Failed to create call stream file!";
+		Stream.clear();
+		Stream.shrink_to_fit();
+		return false;
+	}
+
+	Logging::Log() << "Saving " << FramesRecorded << " frames of device calls (" << Stream.size() << " bytes) to " << filename.c_str() << " ...";
+
+	fwrite("SH2CALLS", 1, 8, file);
+	fwrite(&Version, sizeof(Version), 1, file);
+	fwrite(&FramesRecorded, sizeof(FramesRecorded), 1, file);
+	fwrite(Stream.data(), 1, Stream.size(), file);
+	fclose(file);
+
+	// Release memory
+	Stream.clear();
+	Stream.shrink_to_fit();
+	ResourceIds.clear();
+	LockedData.clear();
+
+	return true;
+}
+
+void CallRecorder::OnPresent()
+{
+	if (Recording)
+	{
+		Record(CALL_PRESENT, {});
+		FramesRecorded++;
+		if (--FramesLeft == 0)
+		{
+			End();
+		}
+	}
+	else if (CaptureRequested)
+	{
+		CaptureRequested = false;
+		Begin();
+	}
+}
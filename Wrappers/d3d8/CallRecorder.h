@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+#include <initializer_list>
+#include <atomic>
+
+// Records the calls going through m_IDirect3DDevice8 into a compact binary stream
+//
+// File layout:
+//   header:  "SH2CALLS", uint32 version, uint32 frame count
+//   packet:  uint8 call id, uint8 argument count, arguments as unsigned LEB128 varints
+//
+// Resources are referenced by sequential ids assigned on creation or first use, id 0 is null.
+// Buffers, textures and constants are never stored, only their 64-bit content hash as two arguments.
+class CallRecorder
+{
+public:
+	static constexpr uint32_t Version = 2;
+	static constexpr uint32_t CaptureFrames = 300;
+
+	enum CALLID : uint8_t
+	{
+		CALL_PRESENT = 0,
+		CALL_BEGINSCENE,
+		CALL_ENDSCENE,
+		CALL_CLEAR,
+		CALL_SETRENDERSTATE,
+		CALL_SETTEXTURESTAGESTATE,
+		CALL_SETTEXTURE,
+		CALL_SETSTREAMSOURCE,
+		CALL_SETINDICES,
+		CALL_SETVERTEXSHADER,
+		CALL_SETPIXELSHADER,
+		CALL_SETVERTEXSHADERCONSTANT,
+		CALL_SETPIXELSHADERCONSTANT,
+		CALL_SETTRANSFORM,
+		CALL_SETVIEWPORT,
+		CALL_SETRENDERTARGET,
+		CALL_DRAWPRIMITIVE,
+		CALL_DRAWINDEXEDPRIMITIVE,
+		CALL_DRAWPRIMITIVEUP,
+		CALL_DRAWINDEXEDPRIMITIVEUP,
+		CALL_CREATETEXTURE,
+		CALL_CREATEVERTEXBUFFER,
+		CALL_CREATEINDEXBUFFER,
+		CALL_CREATESURFACE,
+		CALL_UPDATERESOURCE,
+	};
+
+	bool IsRecording() const { return Recording; }
+	void RequestCapture() { CaptureRequested = true; }
+	void OnPresent();
+
+	void Record(CALLID Call, std::initializer_list<uint32_t> Args);
+	void RecordWithHash(CALLID Call, std::initializer_list<uint32_t> Args, const void *pData, size_t Size);
+	void RecordWithHash(CALLID Call, std::initializer_list<uint32_t> Args, const void *pData, size_t Size, const void *pData2, size_t Size2);
+	uint32_t GetResourceId(const void *pResource);
+	void OnCreate(CALLID Call, const void *pResource, std::initializer_list<uint32_t> Args);
+	static uint32_t GetVertexCount(uint32_t PrimitiveType, uint32_t PrimitiveCount);
+
+	// Content hashing for locked resources, updates of a texture level surface are recorded against the texture
+	void OnLock(const void *pResource, uint32_t Level, const void *pData, size_t Size, const void *pContainer = nullptr, uint32_t ContainerLevel = 0);
+	void OnUnlock(const void *pResource, uint32_t Level);
+
+private:
+	void WriteVarint(uint32_t Value);
+	void WriteHash(const void *pData, size_t Size);
+	void Begin();
+	bool End();
+
+	struct LOCKEDDATA
+	{
+		const void *pData;
+		size_t Size;
+		const void *pResource;
+		uint32_t Level;
+	};
+
+	std::atomic<bool> CaptureRequested { false };
+	bool Recording = false;
+	uint32_t FramesLeft = 0;
+	uint32_t FramesRecorded = 0;
+	uint32_t NextResourceId = 1;
+	std::vector<uint8_t> Stream;
+	std::unordered_map<const void*, uint32_t> ResourceIds;
+	std::unordered_map<uint64_t, LOCKEDDATA> LockedData;
+};
+
+extern CallRecorder DeviceCallRecorder;
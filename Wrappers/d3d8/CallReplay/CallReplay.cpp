@@ -0,0 +1,256 @@
+// Replays the call streams CallRecorder writes (Ctrl + F10 with EnableCallRecorder) against NullDevice
+//
+// The replay runs outside the game and needs neither D3D8 nor D3D9. It checks that the stream is well formed and
+// consistent, measures how long decoding and replaying a frame takes, and prints a summary of the calls. The summary
+// ends with a digest of every draw and the state it used, so saving it with -u and checking it with -e afterwards
+// shows whether a change to the wrapper altered what the game ends up drawing.
+//
+// On Windows the stream is also replayed through the d3d8 wrapper itself, on top of StubDevice8 instead of D3D, and
+// the time that takes is printed as well. That time is the wrapper's own work, so it is what to compare between
+// builds when changing the wrapper.
+//
+// Usage: CallReplay [-n <runs>] [-r <width>x<height>] [-e <summary.txt>] [-u] <stream.bin>
+//   -n  replays of the whole stream, the fastest one is reported (default: 10)
+//   -r  back buffer size of the wrapper replay (default: 1280x720)
+//   -e  compares the summary against this file, or writes it with -u
+
+#include "CallStream.h"
+#include "NullDevice.h"
+#ifdef _WIN32
+#include "WrapperDevice.h"
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+	// Counts the calls of each kind, kept apart from NullDevice so the timed replays do not pay for it
+	class CallCounter : public ReplayDevice
+	{
+	public:
+		uint64_t Counts[CallRecorder::CALL_UPDATERESOURCE + 1] = {};
+
+		void Present() override { Counts[CallRecorder::CALL_PRESENT]++; }
+		void BeginScene() override { Counts[CallRecorder::CALL_BEGINSCENE]++; }
+		void EndScene() override { Counts[CallRecorder::CALL_ENDSCENE]++; }
+		void Clear(uint32_t, uint32_t, uint32_t, float, uint32_t) override { Counts[CallRecorder::CALL_CLEAR]++; }
+		void SetRenderState(uint32_t, uint32_t) override { Counts[CallRecorder::CALL_SETRENDERSTATE]++; }
+		void SetTextureStageState(uint32_t, uint32_t, uint32_t) override { Counts[CallRecorder::CALL_SETTEXTURESTAGESTATE]++; }
+		void SetTexture(uint32_t, uint32_t) override { Counts[CallRecorder::CALL_SETTEXTURE]++; }
+		void SetStreamSource(uint32_t, uint32_t, uint32_t) override { Counts[CallRecorder::CALL_SETSTREAMSOURCE]++; }
+		void SetIndices(uint32_t, uint32_t) override { Counts[CallRecorder::CALL_SETINDICES]++; }
+		void SetVertexShader(uint32_t) override { Counts[CallRecorder::CALL_SETVERTEXSHADER]++; }
+		void SetPixelShader(uint32_t) override { Counts[CallRecorder::CALL_SETPIXELSHADER]++; }
+		void SetVertexShaderConstant(uint32_t, uint32_t, uint64_t) override { Counts[CallRecorder::CALL_SETVERTEXSHADERCONSTANT]++; }
+		void SetPixelShaderConstant(uint32_t, uint32_t, uint64_t) override { Counts[CallRecorder::CALL_SETPIXELSHADERCONSTANT]++; }
+		void SetTransform(uint32_t, uint64_t) override { Counts[CallRecorder::CALL_SETTRANSFORM]++; }
+		void SetViewport(uint32_t, uint32_t, uint32_t, uint32_t, float, float) override { Counts[CallRecorder::CALL_SETVIEWPORT]++; }
+		void SetRenderTarget(uint32_t, uint32_t) override { Counts[CallRecorder::CALL_SETRENDERTARGET]++; }
+		void DrawPrimitive(uint32_t, uint32_t, uint32_t) override { Counts[CallRecorder::CALL_DRAWPRIMITIVE]++; }
+		void DrawIndexedPrimitive(uint32_t, uint32_t, uint32_t, uint32_t, uint32_t) override { Counts[CallRecorder::CALL_DRAWINDEXEDPRIMITIVE]++; }
+		void DrawPrimitiveUP(uint32_t, uint32_t, uint32_t, uint64_t) override { Counts[CallRecorder::CALL_DRAWPRIMITIVEUP]++; }
+		void DrawIndexedPrimitiveUP(uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint64_t, uint64_t) override { Counts[CallRecorder::CALL_DRAWINDEXEDPRIMITIVEUP]++; }
+		void CreateTexture(uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t) override { Counts[CallRecorder::CALL_CREATETEXTURE]++; }
+		void CreateVertexBuffer(uint32_t, uint32_t, uint32_t, uint32_t, uint32_t) override { Counts[CallRecorder::CALL_CREATEVERTEXBUFFER]++; }
+		void CreateIndexBuffer(uint32_t, uint32_t, uint32_t, uint32_t, uint32_t) override { Counts[CallRecorder::CALL_CREATEINDEXBUFFER]++; }
+		void CreateSurface(uint32_t, uint32_t, uint32_t, uint32_t, uint32_t) override { Counts[CallRecorder::CALL_CREATESURFACE]++; }
+		void UpdateResource(uint32_t, uint32_t, uint64_t) override { Counts[CallRecorder::CALL_UPDATERESOURCE]++; }
+	};
+
+	// Everything that does not depend on the machine, so it can be compared between runs
+	std::string GetSummary(const CallStream &Stream, const CallCounter &Counter, const NullDevice &Device)
+	{
+		const NullDevice::STATS &Stats = Device.GetStats();
+		const double Frames = std::max<uint32_t>(Stats.Frames, 1);
+		char Line[256];
+		std::string Summary;
+
+		snprintf(Line, sizeof(Line), "version %u, %u frames, %zu bytes\n", Stream.GetVersion(), Stream.GetFrameCount(), Stream.GetSize());
+		Summary += Line;
+
+		for (uint8_t Call = 0; Call <= CallRecorder::CALL_UPDATERESOURCE; Call++)
+		{
+			if (Counter.Counts[Call])
+			{
+				snprintf(Line, sizeof(Line), "  %-24s %10" PRIu64 " %10.1f per frame\n", CallStream::GetCallName(Call), Counter.Counts[Call], Counter.Counts[Call] / Frames);
+				Summary += Line;
+			}
+		}
+
+		snprintf(Line, sizeof(Line), "draws %u, primitives %" PRIu64 ", state changes %u, redundant states %u, updates %u, creates %u\n",
+			Stats.Draws, Stats.Primitives, Stats.StateChanges, Stats.RedundantStates, Stats.Updates, Stats.Creates);
+		Summary += Line;
+		snprintf(Line, sizeof(Line), "errors %u\n", Stats.Errors);
+		Summary += Line;
+		for (const std::string &Error : Device.GetErrors())
+		{
+			Summary += "  " + Error + "\n";
+		}
+		snprintf(Line, sizeof(Line), "digest %016" PRIx64 "\n", Stats.Digest);
+		Summary += Line;
+
+		return Summary;
+	}
+
+	bool ReadFile(const char *pPath, std::string &Data)
+	{
+		std::ifstream File(pPath, std::ios::binary);
+		if (!File)
+		{
+			return false;
+		}
+		std::stringstream Buffer;
+		Buffer << File.rdbuf();
+		Data = Buffer.str();
+		return true;
+	}
+
+	void PrintFirstDifference(const std::string &Expected, const std::string &Actual)
+	{
+		std::istringstream ExpectedLines(Expected), ActualLines(Actual);
+		std::string ExpectedLine, ActualLine;
+		for (unsigned LineNumber = 1; ; LineNumber++)
+		{
+			const bool HasExpected = static_cast<bool>(std::getline(ExpectedLines, ExpectedLine));
+			const bool HasActual = static_cast<bool>(std::getline(ActualLines, ActualLine));
+			if (!HasExpected && !HasActual)
+			{
+				return;
+			}
+			if (!HasExpected || !HasActual || ExpectedLine != ActualLine)
+			{
+				printf("line %u differs:\n  expected: %s\n  actual:   %s\n", LineNumber, HasExpected ? ExpectedLine.c_str() : "<end of file>", HasActual ? ActualLine.c_str() : "<end of file>");
+				return;
+			}
+		}
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	const char *pInput = nullptr;
+	const char *pExpected = nullptr;
+	bool Update = false;
+	unsigned Runs = 10;
+	unsigned Width = 1280, Height = 720;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-n") && i + 1 < argc)
+		{
+			Runs = std::max(1, atoi(argv[++i]));
+		}
+		else if (!strcmp(argv[i], "-r") && i + 1 < argc)
+		{
+			if (sscanf(argv[++i], "%ux%u", &Width, &Height) != 2 || !Width || !Height)
+			{
+				pInput = nullptr;
+				break;
+			}
+		}
+		else if (!strcmp(argv[i], "-e") && i + 1 < argc)
+		{
+			pExpected = argv[++i];
+		}
+		else if (!strcmp(argv[i], "-u"))
+		{
+			Update = true;
+		}
+		else if (!pInput)
+		{
+			pInput = argv[i];
+		}
+	}
+
+	if (!pInput || (Update && !pExpected))
+	{
+		printf("usage: CallReplay [-n <runs>] [-r <width>x<height>] [-e <summary.txt>] [-u] <stream.bin>\n");
+		return 1;
+	}
+
+	CallStream Stream;
+	std::string Error;
+	if (!Stream.Load(pInput, Error))
+	{
+		printf("%s: %s\n", pInput, Error.c_str());
+		return 1;
+	}
+
+	CallCounter Counter;
+	if (!Stream.Replay(Counter, Error))
+	{
+		printf("%s: %s\n", pInput, Error.c_str());
+		return 1;
+	}
+
+	// Each run starts from an empty device, so every run does the same work
+	NullDevice Device;
+	double BestMs = 0.0;
+	for (unsigned Run = 0; Run < Runs; Run++)
+	{
+		Device.Reset();
+		const auto Start = std::chrono::steady_clock::now();
+		Stream.Replay(Device, Error);
+		const double Ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+		BestMs = Run ? std::min(BestMs, Ms) : Ms;
+	}
+
+	const std::string Summary = GetSummary(Stream, Counter, Device);
+	const uint32_t Frames = std::max<uint32_t>(Device.GetStats().Frames, 1);
+	printf("%s: %s", pInput, Summary.c_str());
+	printf("replay %.3f ms, %.2f us per frame (fastest of %u runs)\n", BestMs, BestMs * 1000.0 / Frames, Runs);
+
+#ifdef _WIN32
+	// Same again through the wrapper, the difference to the replay above is what the wrapper costs
+	{
+		WrapperDevice Wrapper(Width, Height);
+		double WrapperBestMs = 0.0;
+		for (unsigned Run = 0; Run < Runs; Run++)
+		{
+			Wrapper.Reset();
+			const auto Start = std::chrono::steady_clock::now();
+			Stream.Replay(Wrapper, Error);
+			const double Ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+			WrapperBestMs = Run ? std::min(WrapperBestMs, Ms) : Ms;
+		}
+		printf("wrapper replay %.3f ms, %.2f us per frame (fastest of %u runs at %ux%u)\n", WrapperBestMs, WrapperBestMs * 1000.0 / Frames, Runs, Width, Height);
+	}
+#endif
+
+	int Result = Device.GetStats().Errors ? 1 : 0;
+	if (pExpected && Update)
+	{
+		std::ofstream File(pExpected, std::ios::binary);
+		File << Summary;
+		if (!File)
+		{
+			printf("%s: cannot write the summary\n", pExpected);
+			return 1;
+		}
+	}
+	else if (pExpected)
+	{
+		std::string Expected;
+		if (!ReadFile(pExpected, Expected))
+		{
+			printf("%s: cannot read the summary\n", pExpected);
+			return 1;
+		}
+		if (Expected != Summary)
+		{
+			printf("summary differs from %s\n", pExpected);
+			PrintFirstDifference(Expected, Summary);
+			Result = 1;
+		}
+	}
+
+	return Result;
+}
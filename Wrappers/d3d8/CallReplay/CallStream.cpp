@@ -0,0 +1,224 @@
+#include "CallStream.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+	struct CALLINFO
+	{
+		const char *Name;
+		uint8_t ArgCount;
+	};
+
+	// Indexed by CallRecorder::CALLID, hashes count as two arguments
+	constexpr CALLINFO CallInfo[] =
+	{
+		{ "Present", 0 },
+		{ "BeginScene", 0 },
+		{ "EndScene", 0 },
+		{ "Clear", 5 },
+		{ "SetRenderState", 2 },
+		{ "SetTextureStageState", 3 },
+		{ "SetTexture", 2 },
+		{ "SetStreamSource", 3 },
+		{ "SetIndices", 2 },
+		{ "SetVertexShader", 1 },
+		{ "SetPixelShader", 1 },
+		{ "SetVertexShaderConstant", 4 },
+		{ "SetPixelShaderConstant", 4 },
+		{ "SetTransform", 3 },
+		{ "SetViewport", 6 },
+		{ "SetRenderTarget", 2 },
+		{ "DrawPrimitive", 3 },
+		{ "DrawIndexedPrimitive", 5 },
+		{ "DrawPrimitiveUP", 5 },
+		{ "DrawIndexedPrimitiveUP", 10 },
+		{ "CreateTexture", 7 },
+		{ "CreateVertexBuffer", 5 },
+		{ "CreateIndexBuffer", 5 },
+		{ "CreateSurface", 5 },
+		{ "UpdateResource", 4 },
+	};
+	static_assert(std::size(CallInfo) == CallRecorder::CALL_UPDATERESOURCE + 1, "CallInfo must list every call");
+
+	inline uint64_t GetHash(const uint32_t *pArgs)
+	{
+		return pArgs[0] | (static_cast<uint64_t>(pArgs[1]) << 32);
+	}
+
+	inline float GetFloat(uint32_t Arg)
+	{
+		float Value;
+		memcpy(&Value, &Arg, sizeof(Value));
+		return Value;
+	}
+}
+
+const char *CallStream::GetCallName(uint8_t Call)
+{
+	return Call < std::size(CallInfo) ? CallInfo[Call].Name : "Unknown";
+}
+
+bool CallStream::Load(const char *pPath, std::string &Error)
+{
+	std::ifstream File(pPath, std::ios::binary);
+	if (!File)
+	{
+		Error = "cannot open file";
+		return false;
+	}
+
+	char Magic[8] = {};
+	File.read(Magic, sizeof(Magic));
+	File.read(reinterpret_cast<char*>(&Version), sizeof(Version));
+	File.read(reinterpret_cast<char*>(&FrameCount), sizeof(FrameCount));
+	if (!File || memcmp(Magic, "SH2CALLS", sizeof(Magic)) != 0)
+	{
+		Error = "not a call stream";
+		return false;
+	}
+	if (Version == 0 || Version > CallRecorder::Version)
+	{
+		Error = "unsupported version " + std::to_string(Version);
+		return false;
+	}
+
+	Packets.assign(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+	return true;
+}
+
+bool CallStream::Replay(ReplayDevice &Device, std::string &Error) const
+{
+	uint32_t Args[255];
+	const uint8_t *pData = Packets.data();
+	const uint8_t *const pEnd = pData + Packets.size();
+
+	while (pData != pEnd)
+	{
+		const size_t Offset = pData - Packets.data();
+		if (pEnd - pData < 2)
+		{
+			Error = "truncated packet at offset " + std::to_string(Offset);
+			return false;
+		}
+
+		const uint8_t Call = *pData++;
+		const uint8_t ArgCount = *pData++;
+
+		for (uint32_t i = 0; i < ArgCount; i++)
+		{
+			uint32_t Value = 0;
+			for (uint32_t Shift = 0; ; Shift += 7)
+			{
+				if (pData == pEnd || Shift > 28)
+				{
+					Error = "bad argument in packet at offset " + std::to_string(Offset);
+					return false;
+				}
+				const uint8_t Byte = *pData++;
+				Value |= static_cast<uint32_t>(Byte & 0x7F) << Shift;
+				if (!(Byte & 0x80))
+				{
+					break;
+				}
+			}
+			Args[i] = Value;
+		}
+
+		// Version 1 did not hash the vertices of DrawIndexedPrimitiveUP
+		uint8_t Expected = Call < std::size(CallInfo) ? CallInfo[Call].ArgCount : 0;
+		if (Call == CallRecorder::CALL_DRAWINDEXEDPRIMITIVEUP && Version == 1)
+		{
+			Expected = 8;
+			Args[8] = Args[9] = 0;
+		}
+		if (Call >= std::size(CallInfo) || ArgCount != Expected)
+		{
+			Error = std::string("unexpected ") + GetCallName(Call) + " packet with " + std::to_string(ArgCount) + " arguments at offset " + std::to_string(Offset);
+			return false;
+		}
+
+		switch (Call)
+		{
+		case CallRecorder::CALL_PRESENT:
+			Device.Present();
+			break;
+		case CallRecorder::CALL_BEGINSCENE:
+			Device.BeginScene();
+			break;
+		case CallRecorder::CALL_ENDSCENE:
+			Device.EndScene();
+			break;
+		case CallRecorder::CALL_CLEAR:
+			Device.Clear(Args[0], Args[1], Args[2], GetFloat(Args[3]), Args[4]);
+			break;
+		case CallRecorder::CALL_SETRENDERSTATE:
+			Device.SetRenderState(Args[0], Args[1]);
+			break;
+		case CallRecorder::CALL_SETTEXTURESTAGESTATE:
+			Device.SetTextureStageState(Args[0], Args[1], Args[2]);
+			break;
+		case CallRecorder::CALL_SETTEXTURE:
+			Device.SetTexture(Args[0], Args[1]);
+			break;
+		case CallRecorder::CALL_SETSTREAMSOURCE:
+			Device.SetStreamSource(Args[0], Args[1], Args[2]);
+			break;
+		case CallRecorder::CALL_SETINDICES:
+			Device.SetIndices(Args[0], Args[1]);
+			break;
+		case CallRecorder::CALL_SETVERTEXSHADER:
+			Device.SetVertexShader(Args[0]);
+			break;
+		case CallRecorder::CALL_SETPIXELSHADER:
+			Device.SetPixelShader(Args[0]);
+			break;
+		case CallRecorder::CALL_SETVERTEXSHADERCONSTANT:
+			Device.SetVertexShaderConstant(Args[0], Args[1], GetHash(&Args[2]));
+			break;
+		case CallRecorder::CALL_SETPIXELSHADERCONSTANT:
+			Device.SetPixelShaderConstant(Args[0], Args[1], GetHash(&Args[2]));
+			break;
+		case CallRecorder::CALL_SETTRANSFORM:
+			Device.SetTransform(Args[0], GetHash(&Args[1]));
+			break;
+		case CallRecorder::CALL_SETVIEWPORT:
+			Device.SetViewport(Args[0], Args[1], Args[2], Args[3], GetFloat(Args[4]), GetFloat(Args[5]));
+			break;
+		case CallRecorder::CALL_SETRENDERTARGET:
+			Device.SetRenderTarget(Args[0], Args[1]);
+			break;
+		case CallRecorder::CALL_DRAWPRIMITIVE:
+			Device.DrawPrimitive(Args[0], Args[1], Args[2]);
+			break;
+		case CallRecorder::CALL_DRAWINDEXEDPRIMITIVE:
+			Device.DrawIndexedPrimitive(Args[0], Args[1], Args[2], Args[3], Args[4]);
+			break;
+		case CallRecorder::CALL_DRAWPRIMITIVEUP:
+			Device.DrawPrimitiveUP(Args[0], Args[1], Args[2], GetHash(&Args[3]));
+			break;
+		case CallRecorder::CALL_DRAWINDEXEDPRIMITIVEUP:
+			Device.DrawIndexedPrimitiveUP(Args[0], Args[1], Args[2], Args[3], Args[4], Args[5], GetHash(&Args[6]), GetHash(&Args[8]));
+			break;
+		case CallRecorder::CALL_CREATETEXTURE:
+			Device.CreateTexture(Args[0], Args[1], Args[2], Args[3], Args[4], Args[5], Args[6]);
+			break;
+		case CallRecorder::CALL_CREATEVERTEXBUFFER:
+			Device.CreateVertexBuffer(Args[0], Args[1], Args[2], Args[3], Args[4]);
+			break;
+		case CallRecorder::CALL_CREATEINDEXBUFFER:
+			Device.CreateIndexBuffer(Args[0], Args[1], Args[2], Args[3], Args[4]);
+			break;
+		case CallRecorder::CALL_CREATESURFACE:
+			Device.CreateSurface(Args[0], Args[1], Args[2], Args[3], Args[4]);
+			break;
+		case CallRecorder::CALL_UPDATERESOURCE:
+			Device.UpdateResource(Args[0], Args[1], GetHash(&Args[2]));
+			break;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Wrappers/d3d8/CallRecorder.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Receives the calls of a recorded stream in the order the game made them
+//
+// Resources are the ids CallRecorder assigned, buffer, texture and constant contents are their 64-bit hashes.
+// Every method does nothing by default, so a device only overrides the calls it cares about.
+class ReplayDevice
+{
+public:
+	virtual ~ReplayDevice() {}
+
+	virtual void Present() {}
+	virtual void BeginScene() {}
+	virtual void EndScene() {}
+	virtual void Clear(uint32_t /*Count*/, uint32_t /*Flags*/, uint32_t /*Color*/, float /*Z*/, uint32_t /*Stencil*/) {}
+	virtual void SetRenderState(uint32_t /*State*/, uint32_t /*Value*/) {}
+	virtual void SetTextureStageState(uint32_t /*Stage*/, uint32_t /*Type*/, uint32_t /*Value*/) {}
+	virtual void SetTexture(uint32_t /*Stage*/, uint32_t /*Texture*/) {}
+	virtual void SetStreamSource(uint32_t /*StreamNumber*/, uint32_t /*VertexBuffer*/, uint32_t /*Stride*/) {}
+	virtual void SetIndices(uint32_t /*IndexBuffer*/, uint32_t /*BaseVertexIndex*/) {}
+	virtual void SetVertexShader(uint32_t /*Handle*/) {}
+	virtual void SetPixelShader(uint32_t /*Handle*/) {}
+	virtual void SetVertexShaderConstant(uint32_t /*Register*/, uint32_t /*ConstantCount*/, uint64_t /*Hash*/) {}
+	virtual void SetPixelShaderConstant(uint32_t /*Register*/, uint32_t /*ConstantCount*/, uint64_t /*Hash*/) {}
+	virtual void SetTransform(uint32_t /*State*/, uint64_t /*Hash*/) {}
+	virtual void SetViewport(uint32_t /*X*/, uint32_t /*Y*/, uint32_t /*Width*/, uint32_t /*Height*/, float /*MinZ*/, float /*MaxZ*/) {}
+	virtual void SetRenderTarget(uint32_t /*RenderTarget*/, uint32_t /*ZStencil*/) {}
+	virtual void DrawPrimitive(uint32_t /*PrimitiveType*/, uint32_t /*StartVertex*/, uint32_t /*PrimitiveCount*/) {}
+	virtual void DrawIndexedPrimitive(uint32_t /*PrimitiveType*/, uint32_t /*MinVertexIndex*/, uint32_t /*NumVertices*/, uint32_t /*StartIndex*/, uint32_t /*PrimitiveCount*/) {}
+	virtual void DrawPrimitiveUP(uint32_t /*PrimitiveType*/, uint32_t /*PrimitiveCount*/, uint32_t /*Stride*/, uint64_t /*VertexHash*/) {}
+	// Streams of version 1 have no vertex hash, it is zero then
+	virtual void DrawIndexedPrimitiveUP(uint32_t /*PrimitiveType*/, uint32_t /*MinIndex*/, uint32_t /*NumVertices*/, uint32_t /*PrimitiveCount*/, uint32_t /*IndexFormat*/, uint32_t /*Stride*/, uint64_t /*IndexHash*/, uint64_t /*VertexHash*/) {}
+	virtual void CreateTexture(uint32_t /*Texture*/, uint32_t /*Width*/, uint32_t /*Height*/, uint32_t /*Levels*/, uint32_t /*Usage*/, uint32_t /*Format*/, uint32_t /*Pool*/) {}
+	virtual void CreateVertexBuffer(uint32_t /*VertexBuffer*/, uint32_t /*Length*/, uint32_t /*Usage*/, uint32_t /*FVF*/, uint32_t /*Pool*/) {}
+	virtual void CreateIndexBuffer(uint32_t /*IndexBuffer*/, uint32_t /*Length*/, uint32_t /*Usage*/, uint32_t /*Format*/, uint32_t /*Pool*/) {}
+	virtual void CreateSurface(uint32_t /*Surface*/, uint32_t /*Width*/, uint32_t /*Height*/, uint32_t /*Format*/, uint32_t /*Usage*/) {}
+	virtual void UpdateResource(uint32_t /*Resource*/, uint32_t /*Level*/, uint64_t /*Hash*/) {}
+};
+
+// A call stream file written by CallRecorder, loaded into memory so replays only measure the decoding and the device
+class CallStream
+{
+public:
+	bool Load(const char *pPath, std::string &Error);
+
+	uint32_t GetVersion() const { return Version; }
+	uint32_t GetFrameCount() const { return FrameCount; }
+	size_t GetSize() const { return Packets.size(); }
+
+	// Feeds every call to the device, stops at the first malformed packet
+	bool Replay(ReplayDevice &Device, std::string &Error) const;
+
+	static const char *GetCallName(uint8_t Call);
+
+private:
+	uint32_t Version = 0;
+	uint32_t FrameCount = 0;
+	std::vector<uint8_t> Packets;
+};
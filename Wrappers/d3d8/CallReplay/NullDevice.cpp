@@ -0,0 +1,385 @@
+#include "NullDevice.h"
+#include "Common/Hash.h"
+
+#include <cstring>
+
+namespace
+{
+	inline uint64_t Mix(uint64_t Slot, uint64_t Value)
+	{
+		const uint64_t Pair[2] = { Slot, Value };
+		return Hash64(Pair, sizeof(Pair));
+	}
+}
+
+void NullDevice::Reset()
+{
+	*this = NullDevice();
+}
+
+void NullDevice::Error(const std::string &Message)
+{
+	Stats.Errors++;
+	if (Errors.size() < MaxErrorMessages)
+	{
+		Errors.push_back("frame " + std::to_string(Stats.Frames) + ": " + Message);
+	}
+}
+
+NullDevice::RESOURCE *NullDevice::Use(uint32_t Id, RESOURCETYPE Type, const char *pCall)
+{
+	if (!Id)
+	{
+		return nullptr;
+	}
+	if (Id >= Resources.size())
+	{
+		Resources.resize(Id + 1);
+	}
+
+	RESOURCE &Resource = Resources[Id];
+	if (Resource.Type == RESOURCE_UNKNOWN)
+	{
+		Resource.Type = Type;
+	}
+	// Render targets can be textures or surfaces, so only buffers are checked for their own kind
+	else if (Resource.Type != Type && Type != RESOURCE_UNKNOWN &&
+		(Resource.Type == RESOURCE_VERTEXBUFFER || Resource.Type == RESOURCE_INDEXBUFFER || Type == RESOURCE_VERTEXBUFFER || Type == RESOURCE_INDEXBUFFER))
+	{
+		Error(std::string(pCall) + " uses resource " + std::to_string(Id) + " as the wrong kind of resource");
+	}
+	return &Resource;
+}
+
+void NullDevice::Create(uint32_t Id, RESOURCETYPE Type, uint32_t Levels, const char *pCall)
+{
+	Stats.Creates++;
+
+	// Ids are handed out in order, so a create never names an id that was seen before
+	if (!Id || Id < Resources.size())
+	{
+		Error(std::string(pCall) + " reuses resource id " + std::to_string(Id));
+	}
+	if (Id >= Resources.size())
+	{
+		Resources.resize(Id + 1);
+	}
+	Resources[Id] = { Type, Levels, 0 };
+}
+
+uint64_t NullDevice::GetContent(uint32_t Id) const
+{
+	return Id ? Mix(Id, Resources[Id].Hash) : 0;
+}
+
+void NullDevice::Set(uint32_t &Slot, uint32_t Value)
+{
+	if (Slot == Value)
+	{
+		Stats.RedundantStates++;
+		return;
+	}
+	Slot = Value;
+	Stats.StateChanges++;
+}
+
+void NullDevice::SetSlot(uint64_t *pSlots, uint64_t &Combined, uint32_t Slot, uint64_t Value)
+{
+	// The combination is a xor of every slot, so changing one slot does not rehash the others
+	const uint64_t New = Value ? Mix(Slot, Value) : 0;
+	Combined ^= pSlots[Slot] ^ New;
+	pSlots[Slot] = New;
+}
+
+void NullDevice::Draw(const char *pCall, uint32_t PrimitiveCount, uint64_t DataHash)
+{
+	if (!InScene)
+	{
+		Error(std::string(pCall) + " outside of BeginScene and EndScene");
+	}
+	if (!PrimitiveCount)
+	{
+		Error(std::string(pCall) + " without primitives");
+	}
+
+	// Contents can change between draws without a bind, so they are read at the draw
+	for (uint32_t Stage = 0; Stage < MaxTextureStages; Stage++)
+	{
+		State.Textures[Stage] = GetContent(TextureIds[Stage]);
+	}
+	for (uint32_t Stream = 0; Stream < MaxStreams; Stream++)
+	{
+		State.Streams[Stream] = GetContent(StreamIds[Stream]);
+	}
+	State.Indices = GetContent(IndicesId);
+	State.Data = DataHash;
+
+	Stats.Draws++;
+	Stats.Primitives += PrimitiveCount;
+	Stats.Digest = Hash64(&State, sizeof(State), Stats.Digest);
+}
+
+void NullDevice::Present()
+{
+	if (InScene)
+	{
+		Error("Present inside of BeginScene and EndScene");
+	}
+	Stats.Frames++;
+}
+
+void NullDevice::BeginScene()
+{
+	if (InScene)
+	{
+		Error("BeginScene inside of BeginScene and EndScene");
+	}
+	InScene = true;
+}
+
+void NullDevice::EndScene()
+{
+	if (!InScene)
+	{
+		Error("EndScene without BeginScene");
+	}
+	InScene = false;
+}
+
+void NullDevice::Clear(uint32_t Count, uint32_t Flags, uint32_t Color, float Z, uint32_t Stencil)
+{
+	if (!Flags)
+	{
+		Error("Clear without flags");
+	}
+	const uint32_t Values[4] = { Count, Flags, Color, Stencil };
+	Stats.Digest = Hash64(Values, sizeof(Values), Hash64(&Z, sizeof(Z), Stats.Digest));
+}
+
+void NullDevice::SetRenderState(uint32_t State, uint32_t Value)
+{
+	if (State >= MaxRenderStates)
+	{
+		Error("SetRenderState with render state " + std::to_string(State));
+		return;
+	}
+	Set(this->State.RenderStates[State], Value);
+}
+
+void NullDevice::SetTextureStageState(uint32_t Stage, uint32_t Type, uint32_t Value)
+{
+	if (Stage >= MaxTextureStages || Type >= MaxStageStates)
+	{
+		Error("SetTextureStageState with stage " + std::to_string(Stage) + " and type " + std::to_string(Type));
+		return;
+	}
+	Set(State.TextureStageStates[Stage][Type], Value);
+}
+
+void NullDevice::SetTexture(uint32_t Stage, uint32_t Texture)
+{
+	if (Stage >= MaxTextureStages)
+	{
+		Error("SetTexture with stage " + std::to_string(Stage));
+		return;
+	}
+	Use(Texture, RESOURCE_TEXTURE, "SetTexture");
+	Set(TextureIds[Stage], Texture);
+}
+
+void NullDevice::SetStreamSource(uint32_t StreamNumber, uint32_t VertexBuffer, uint32_t Stride)
+{
+	if (StreamNumber >= MaxStreams)
+	{
+		Error("SetStreamSource with stream " + std::to_string(StreamNumber));
+		return;
+	}
+	Use(VertexBuffer, RESOURCE_VERTEXBUFFER, "SetStreamSource");
+	Set(StreamIds[StreamNumber], VertexBuffer);
+	Set(State.StreamStrides[StreamNumber], Stride);
+}
+
+void NullDevice::SetIndices(uint32_t IndexBuffer, uint32_t BaseVertexIndex)
+{
+	Use(IndexBuffer, RESOURCE_INDEXBUFFER, "SetIndices");
+	Set(IndicesId, IndexBuffer);
+	Set(State.BaseVertexIndex, BaseVertexIndex);
+}
+
+void NullDevice::SetVertexShader(uint32_t Handle)
+{
+	Set(State.VertexShader, Handle);
+}
+
+void NullDevice::SetPixelShader(uint32_t Handle)
+{
+	Set(State.PixelShader, Handle);
+}
+
+void NullDevice::SetVertexShaderConstant(uint32_t Register, uint32_t ConstantCount, uint64_t Hash)
+{
+	if (Register + ConstantCount > MaxConstants || Register + ConstantCount < Register)
+	{
+		Error("SetVertexShaderConstant with registers " + std::to_string(Register) + " to " + std::to_string(Register + ConstantCount));
+		return;
+	}
+	Stats.StateChanges++;
+	for (uint32_t i = 0; i < ConstantCount; i++)
+	{
+		SetSlot(VertexConstants, State.VertexConstants, Register + i, Mix(Hash, i));
+	}
+}
+
+void NullDevice::SetPixelShaderConstant(uint32_t Register, uint32_t ConstantCount, uint64_t Hash)
+{
+	if (Register + ConstantCount > MaxConstants || Register + ConstantCount < Register)
+	{
+		Error("SetPixelShaderConstant with registers " + std::to_string(Register) + " to " + std::to_string(Register + ConstantCount));
+		return;
+	}
+	Stats.StateChanges++;
+	for (uint32_t i = 0; i < ConstantCount; i++)
+	{
+		SetSlot(PixelConstants, State.PixelConstants, Register + i, Mix(Hash, i));
+	}
+}
+
+void NullDevice::SetTransform(uint32_t State, uint64_t Hash)
+{
+	if (State >= MaxTransforms)
+	{
+		Error("SetTransform with transform " + std::to_string(State));
+		return;
+	}
+	Stats.StateChanges++;
+	SetSlot(Transforms, this->State.Transforms, State, Hash);
+}
+
+void NullDevice::SetViewport(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height, float MinZ, float MaxZ)
+{
+	if (!Width || !Height || MinZ > MaxZ)
+	{
+		Error("SetViewport with an empty viewport");
+	}
+	uint32_t Z[2];
+	memcpy(&Z[0], &MinZ, sizeof(Z[0]));
+	memcpy(&Z[1], &MaxZ, sizeof(Z[1]));
+
+	const uint32_t Viewport[6] = { X, Y, Width, Height, Z[0], Z[1] };
+	if (memcmp(State.Viewport, Viewport, sizeof(Viewport)) == 0)
+	{
+		Stats.RedundantStates++;
+		return;
+	}
+	memcpy(State.Viewport, Viewport, sizeof(Viewport));
+	Stats.StateChanges++;
+}
+
+void NullDevice::SetRenderTarget(uint32_t RenderTarget, uint32_t ZStencil)
+{
+	Use(RenderTarget, RESOURCE_UNKNOWN, "SetRenderTarget");
+	Use(ZStencil, RESOURCE_SURFACE, "SetRenderTarget");
+	Set(State.RenderTarget, RenderTarget);
+	Set(State.ZStencil, ZStencil);
+}
+
+void NullDevice::DrawPrimitive(uint32_t PrimitiveType, uint32_t StartVertex, uint32_t PrimitiveCount)
+{
+	if (!StreamIds[0])
+	{
+		Error("DrawPrimitive without a vertex buffer");
+	}
+	const uint32_t Values[3] = { PrimitiveType, StartVertex, PrimitiveCount };
+	Draw("DrawPrimitive", PrimitiveCount, Hash64(Values, sizeof(Values)));
+}
+
+void NullDevice::DrawIndexedPrimitive(uint32_t PrimitiveType, uint32_t MinVertexIndex, uint32_t NumVertices, uint32_t StartIndex, uint32_t PrimitiveCount)
+{
+	if (!StreamIds[0] || !IndicesId)
+	{
+		Error("DrawIndexedPrimitive without a vertex or index buffer");
+	}
+	const uint32_t Values[5] = { PrimitiveType, MinVertexIndex, NumVertices, StartIndex, PrimitiveCount };
+	Draw("DrawIndexedPrimitive", PrimitiveCount, Hash64(Values, sizeof(Values)));
+}
+
+void NullDevice::DrawPrimitiveUP(uint32_t PrimitiveType, uint32_t PrimitiveCount, uint32_t Stride, uint64_t VertexHash)
+{
+	if (!Stride)
+	{
+		Error("DrawPrimitiveUP without a stride");
+	}
+	const uint32_t Values[3] = { PrimitiveType, PrimitiveCount, Stride };
+	Draw("DrawPrimitiveUP", PrimitiveCount, Hash64(Values, sizeof(Values), VertexHash));
+
+	// Like D3D8, user pointer draws unbind stream 0 and the indices
+	StreamIds[0] = 0;
+	State.StreamStrides[0] = 0;
+}
+
+void NullDevice::DrawIndexedPrimitiveUP(uint32_t PrimitiveType, uint32_t MinIndex, uint32_t NumVertices, uint32_t PrimitiveCount, uint32_t IndexFormat, uint32_t Stride, uint64_t IndexHash, uint64_t VertexHash)
+{
+	if (!Stride || !NumVertices)
+	{
+		Error("DrawIndexedPrimitiveUP without a stride or vertices");
+	}
+	const uint32_t Values[5] = { PrimitiveType, MinIndex, NumVertices, IndexFormat, Stride };
+	Draw("DrawIndexedPrimitiveUP", PrimitiveCount, Hash64(Values, sizeof(Values), IndexHash ^ Mix(VertexHash, 1)));
+
+	StreamIds[0] = 0;
+	State.StreamStrides[0] = 0;
+	IndicesId = 0;
+}
+
+void NullDevice::CreateTexture(uint32_t Texture, uint32_t Width, uint32_t Height, uint32_t Levels, uint32_t, uint32_t, uint32_t)
+{
+	if (!Width || !Height)
+	{
+		Error("CreateTexture with an empty size");
+	}
+	Create(Texture, RESOURCE_TEXTURE, Levels, "CreateTexture");
+}
+
+void NullDevice::CreateVertexBuffer(uint32_t VertexBuffer, uint32_t Length, uint32_t, uint32_t, uint32_t)
+{
+	if (!Length)
+	{
+		Error("CreateVertexBuffer with an empty size");
+	}
+	Create(VertexBuffer, RESOURCE_VERTEXBUFFER, 1, "CreateVertexBuffer");
+}
+
+void NullDevice::CreateIndexBuffer(uint32_t IndexBuffer, uint32_t Length, uint32_t, uint32_t, uint32_t)
+{
+	if (!Length)
+	{
+		Error("CreateIndexBuffer with an empty size");
+	}
+	Create(IndexBuffer, RESOURCE_INDEXBUFFER, 1, "CreateIndexBuffer");
+}
+
+void NullDevice::CreateSurface(uint32_t Surface, uint32_t Width, uint32_t Height, uint32_t, uint32_t)
+{
+	if (!Width || !Height)
+	{
+		Error("CreateSurface with an empty size");
+	}
+	Create(Surface, RESOURCE_SURFACE, 1, "CreateSurface");
+}
+
+void NullDevice::UpdateResource(uint32_t Resource, uint32_t Level, uint64_t Hash)
+{
+	RESOURCE *pResource = Use(Resource, RESOURCE_UNKNOWN, "UpdateResource");
+	if (!pResource)
+	{
+		Error("UpdateResource without a resource");
+		return;
+	}
+	// Levels of textures created before the recording are not known
+	if (pResource->Levels && Level >= pResource->Levels && pResource->Type == RESOURCE_TEXTURE)
+	{
+		Error("UpdateResource of level " + std::to_string(Level) + " of resource " + std::to_string(Resource));
+	}
+	Stats.Updates++;
+	pResource->Hash = Mix(pResource->Hash ^ Level, Hash);
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "CallStream.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// A device that renders nothing, it only keeps the bound state and checks the stream against it
+//
+// Every draw folds the state it would render with into a digest, so two streams that draw the same things with the
+// same resources and states get the same digest, however many redundant calls either of them makes.
+class NullDevice : public ReplayDevice
+{
+public:
+	struct STATS
+	{
+		uint32_t Frames = 0;
+		uint32_t Draws = 0;
+		uint64_t Primitives = 0;
+		uint32_t StateChanges = 0;
+		uint32_t RedundantStates = 0;
+		uint32_t Updates = 0;
+		uint32_t Creates = 0;
+		uint32_t Errors = 0;
+		uint64_t Digest = 0;
+	};
+
+	void Reset();
+	const STATS &GetStats() const { return Stats; }
+	// First few problems found, the rest are only counted
+	const std::vector<std::string> &GetErrors() const { return Errors; }
+
+	void Present() override;
+	void BeginScene() override;
+	void EndScene() override;
+	void Clear(uint32_t Count, uint32_t Flags, uint32_t Color, float Z, uint32_t Stencil) override;
+	void SetRenderState(uint32_t State, uint32_t Value) override;
+	void SetTextureStageState(uint32_t Stage, uint32_t Type, uint32_t Value) override;
+	void SetTexture(uint32_t Stage, uint32_t Texture) override;
+	void SetStreamSource(uint32_t StreamNumber, uint32_t VertexBuffer, uint32_t Stride) override;
+	void SetIndices(uint32_t IndexBuffer, uint32_t BaseVertexIndex) override;
+	void SetVertexShader(uint32_t Handle) override;
+	void SetPixelShader(uint32_t Handle) override;
+	void SetVertexShaderConstant(uint32_t Register, uint32_t ConstantCount, uint64_t Hash) override;
+	void SetPixelShaderConstant(uint32_t Register, uint32_t ConstantCount, uint64_t Hash) override;
+	void SetTransform(uint32_t State, uint64_t Hash) override;
+	void SetViewport(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height, float MinZ, float MaxZ) override;
+	void SetRenderTarget(uint32_t RenderTarget, uint32_t ZStencil) override;
+	void DrawPrimitive(uint32_t PrimitiveType, uint32_t StartVertex, uint32_t PrimitiveCount) override;
+	void DrawIndexedPrimitive(uint32_t PrimitiveType, uint32_t MinVertexIndex, uint32_t NumVertices, uint32_t StartIndex, uint32_t PrimitiveCount) override;
+	void DrawPrimitiveUP(uint32_t PrimitiveType, uint32_t PrimitiveCount, uint32_t Stride, uint64_t VertexHash) override;
+	void DrawIndexedPrimitiveUP(uint32_t PrimitiveType, uint32_t MinIndex, uint32_t NumVertices, uint32_t PrimitiveCount, uint32_t IndexFormat, uint32_t Stride, uint64_t IndexHash, uint64_t VertexHash) override;
+	void CreateTexture(uint32_t Texture, uint32_t Width, uint32_t Height, uint32_t Levels, uint32_t Usage, uint32_t Format, uint32_t Pool) override;
+	void CreateVertexBuffer(uint32_t VertexBuffer, uint32_t Length, uint32_t Usage, uint32_t FVF, uint32_t Pool) override;
+	void CreateIndexBuffer(uint32_t IndexBuffer, uint32_t Length, uint32_t Usage, uint32_t Format, uint32_t Pool) override;
+	void CreateSurface(uint32_t Surface, uint32_t Width, uint32_t Height, uint32_t Format, uint32_t Usage) override;
+	void UpdateResource(uint32_t Resource, uint32_t Level, uint64_t Hash) override;
+
+private:
+	static constexpr uint32_t MaxRenderStates = 256;
+	static constexpr uint32_t MaxTextureStages = 8;
+	static constexpr uint32_t MaxStageStates = 32;
+	static constexpr uint32_t MaxStreams = 16;
+	static constexpr uint32_t MaxConstants = 96;
+	static constexpr uint32_t MaxTransforms = 512;
+	static constexpr size_t MaxErrorMessages = 20;
+
+	// Resources used before the recording started have no create call, their type is learned from the first use
+	enum RESOURCETYPE : uint8_t
+	{
+		RESOURCE_UNKNOWN = 0,
+		RESOURCE_TEXTURE,
+		RESOURCE_VERTEXBUFFER,
+		RESOURCE_INDEXBUFFER,
+		RESOURCE_SURFACE,
+	};
+
+	struct RESOURCE
+	{
+		RESOURCETYPE Type = RESOURCE_UNKNOWN;
+		uint32_t Levels = 0;
+		uint64_t Hash = 0;
+	};
+
+	// The state a draw renders with, hashed as a whole so it has no padding
+	struct DRAWSTATE
+	{
+		uint32_t RenderStates[MaxRenderStates];
+		uint32_t TextureStageStates[MaxTextureStages][MaxStageStates];
+		uint64_t Textures[MaxTextureStages];
+		uint64_t Streams[MaxStreams];
+		uint64_t Indices;
+		uint64_t VertexConstants;
+		uint64_t PixelConstants;
+		uint64_t Transforms;
+		uint64_t Data;
+		uint32_t StreamStrides[MaxStreams];
+		uint32_t BaseVertexIndex;
+		uint32_t VertexShader;
+		uint32_t PixelShader;
+		uint32_t RenderTarget;
+		uint32_t ZStencil;
+		uint32_t Viewport[6];
+		uint32_t Reserved;
+	};
+	static_assert(sizeof(DRAWSTATE) % sizeof(uint64_t) == 0, "DRAWSTATE must not have tail padding");
+
+	void Error(const std::string &Message);
+	RESOURCE *Use(uint32_t Id, RESOURCETYPE Type, const char *pCall);
+	void Create(uint32_t Id, RESOURCETYPE Type, uint32_t Levels, const char *pCall);
+	void Set(uint32_t &Slot, uint32_t Value);
+	void SetSlot(uint64_t *pSlots, uint64_t &Combined, uint32_t Slot, uint64_t Value);
+	uint64_t GetContent(uint32_t Id) const;
+	void Draw(const char *pCall, uint32_t PrimitiveCount, uint64_t DataHash);
+
+	STATS Stats;
+	std::vector<std::string> Errors;
+	std::vector<RESOURCE> Resources;
+	DRAWSTATE State = {};
+	uint32_t TextureIds[MaxTextureStages] = {};
+	uint32_t StreamIds[MaxStreams] = {};
+	uint32_t IndicesId = 0;
+	// Per slot hashes, the draw state only keeps their combination
+	uint64_t VertexConstants[MaxConstants] = {};
+	uint64_t PixelConstants[MaxConstants] = {};
+	uint64_t Transforms[MaxTransforms] = {};
+	bool InScene = false;
+};
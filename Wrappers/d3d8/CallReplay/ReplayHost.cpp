@@ -0,0 +1,18 @@
+// What dllmain.cpp provides to the rest of the wrapper, for linking the wrapper into CallReplay instead of the game
+//
+// CallReplay links every object of the d3d8 project except dllmain.obj, so nothing here loads settings, installs hooks
+// or patches the game. The game addresses the hooks look up are not found outside the game, so they do nothing.
+
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#include "Patches\Patches.h"
+#include "Common\Settings.h"
+
+HMODULE m_hModule = nullptr;
+SH2VERSION GameVersion = SH2V_UNKNOWN;
+bool CustomExeStrSet = false;
+bool EnableCustomShaders = false;
+bool IsUpdating = false;
+bool m_StopThreadFlag = false;
+
+void DelayedStart() {}
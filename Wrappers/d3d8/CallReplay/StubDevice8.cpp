@@ -0,0 +1,736 @@
+#include "StubDevice8.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	// Bytes per row of blocks and rows of blocks of a surface, DXT formats are stored in 4x4 blocks
+	void GetSurfaceLayout(D3DFORMAT Format, UINT Width, UINT Height, UINT &Pitch, UINT &Rows)
+	{
+		switch (Format)
+		{
+		case D3DFMT_DXT1:
+			Pitch = std::max(1u, (Width + 3) / 4) * 8;
+			Rows = std::max(1u, (Height + 3) / 4);
+			return;
+		case D3DFMT_DXT2:
+		case D3DFMT_DXT3:
+		case D3DFMT_DXT4:
+		case D3DFMT_DXT5:
+			Pitch = std::max(1u, (Width + 3) / 4) * 16;
+			Rows = std::max(1u, (Height + 3) / 4);
+			return;
+		case D3DFMT_A8:
+		case D3DFMT_L8:
+		case D3DFMT_P8:
+		case D3DFMT_A4L4:
+			Pitch = Width;
+			break;
+		case D3DFMT_R5G6B5:
+		case D3DFMT_X1R5G5B5:
+		case D3DFMT_A1R5G5B5:
+		case D3DFMT_A4R4G4B4:
+		case D3DFMT_X4R4G4B4:
+		case D3DFMT_A8L8:
+		case D3DFMT_A8P8:
+		case D3DFMT_D16:
+		case D3DFMT_D16_LOCKABLE:
+		case D3DFMT_D15S1:
+			Pitch = Width * 2;
+			break;
+		case D3DFMT_R8G8B8:
+			Pitch = Width * 3;
+			break;
+		default:
+			Pitch = Width * 4;
+			break;
+		}
+		Rows = Height;
+	}
+}
+
+StubSurface8::StubSurface8(StubDevice8 *pDevice, UINT Width, UINT Height, D3DFORMAT Format, DWORD Usage, D3DPOOL Pool, StubTexture8 *pContainer) :
+	m_pDevice(pDevice), m_pContainer(pContainer)
+{
+	Desc.Format = Format;
+	Desc.Type = D3DRTYPE_SURFACE;
+	Desc.Usage = Usage;
+	Desc.Pool = Pool;
+	Desc.MultiSampleType = D3DMULTISAMPLE_NONE;
+	Desc.Width = Width;
+	Desc.Height = Height;
+	GetSurfaceLayout(Format, Width, Height, Pitch, Rows);
+	Desc.Size = Pitch * Rows;
+}
+
+ULONG StubSurface8::AddRef()
+{
+	return m_pContainer ? m_pContainer->AddRef() : StubObject::AddRef();
+}
+
+ULONG StubSurface8::Release()
+{
+	return m_pContainer ? m_pContainer->Release() : StubObject::Release();
+}
+
+HRESULT StubSurface8::GetDevice(IDirect3DDevice8** ppDevice)
+{
+	if (!ppDevice)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	m_pDevice->AddRef();
+	*ppDevice = m_pDevice;
+	return D3D_OK;
+}
+
+HRESULT StubSurface8::GetContainer(REFIID riid, void** ppContainer)
+{
+	if (!ppContainer)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	if (m_pContainer && (riid == IID_IDirect3DTexture8 || riid == IID_IDirect3DBaseTexture8))
+	{
+		m_pContainer->AddRef();
+		*ppContainer = static_cast<IDirect3DTexture8*>(m_pContainer);
+		return D3D_OK;
+	}
+	if (riid == IID_IDirect3DDevice8)
+	{
+		return GetDevice(reinterpret_cast<IDirect3DDevice8**>(ppContainer));
+	}
+	*ppContainer = nullptr;
+	return E_NOINTERFACE;
+}
+
+HRESULT StubSurface8::GetDesc(D3DSURFACE_DESC *pDesc)
+{
+	if (!pDesc)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	*pDesc = Desc;
+	return D3D_OK;
+}
+
+HRESULT StubSurface8::LockRect(D3DLOCKED_RECT* pLockedRect, CONST RECT* pRect, DWORD)
+{
+	if (!pLockedRect)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+
+	// Only surfaces that get locked need memory
+	if (Data.empty())
+	{
+		Data.resize(static_cast<size_t>(Pitch) * Rows);
+	}
+
+	size_t Offset = 0;
+	if (pRect)
+	{
+		const bool IsBlock = Desc.Format == D3DFMT_DXT1 || Desc.Format == D3DFMT_DXT2 || Desc.Format == D3DFMT_DXT3 || Desc.Format == D3DFMT_DXT4 || Desc.Format == D3DFMT_DXT5;
+		const UINT Columns = IsBlock ? std::max(1u, (Desc.Width + 3) / 4) : Desc.Width;
+		const UINT Row = IsBlock ? pRect->top / 4 : pRect->top;
+		const UINT Column = IsBlock ? pRect->left / 4 : pRect->left;
+		if (Row >= Rows || Column >= Columns)
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		Offset = static_cast<size_t>(Row) * Pitch + Column * (Pitch / Columns);
+	}
+
+	pLockedRect->Pitch = Pitch;
+	pLockedRect->pBits = Data.data() + Offset;
+	return D3D_OK;
+}
+
+StubTexture8::StubTexture8(StubDevice8 *pDevice, UINT Width, UINT Height, UINT LevelCount, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool) : m_pDevice(pDevice)
+{
+	// Zero levels means the full chain down to 1x1
+	for (UINT Level = 0; LevelCount == 0 || Level < LevelCount; Level++)
+	{
+		Levels.push_back(new StubSurface8(pDevice, Width, Height, Format, Usage, Pool, this));
+		if (Width == 1 && Height == 1)
+		{
+			break;
+		}
+		Width = std::max(1u, Width / 2);
+		Height = std::max(1u, Height / 2);
+	}
+}
+
+StubTexture8::~StubTexture8()
+{
+	for (StubSurface8 *pSurface : Levels)
+	{
+		delete pSurface;
+	}
+}
+
+HRESULT StubTexture8::GetDevice(IDirect3DDevice8** ppDevice)
+{
+	if (!ppDevice)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	m_pDevice->AddRef();
+	*ppDevice = m_pDevice;
+	return D3D_OK;
+}
+
+HRESULT StubTexture8::GetLevelDesc(UINT Level, D3DSURFACE_DESC *pDesc)
+{
+	if (Level >= Levels.size())
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	return Levels[Level]->GetDesc(pDesc);
+}
+
+HRESULT StubTexture8::GetSurfaceLevel(UINT Level, IDirect3DSurface8** ppSurfaceLevel)
+{
+	if (Level >= Levels.size() || !ppSurfaceLevel)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	Levels[Level]->AddRef();
+	*ppSurfaceLevel = Levels[Level];
+	return D3D_OK;
+}
+
+HRESULT StubTexture8::LockRect(UINT Level, D3DLOCKED_RECT* pLockedRect, CONST RECT* pRect, DWORD Flags)
+{
+	if (Level >= Levels.size())
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	return Levels[Level]->LockRect(pLockedRect, pRect, Flags);
+}
+
+HRESULT StubTexture8::UnlockRect(UINT Level)
+{
+	if (Level >= Levels.size())
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	return Levels[Level]->UnlockRect();
+}
+
+StubDevice8::StubDevice8(UINT Width, UINT Height) : Width(Width), Height(Height)
+{
+	pBackBuffer = new StubSurface8(this, Width, Height, D3DFMT_X8R8G8B8, D3DUSAGE_RENDERTARGET, D3DPOOL_DEFAULT);
+	pDepthStencil = new StubSurface8(this, Width, Height, D3DFMT_D24S8, D3DUSAGE_DEPTHSTENCIL, D3DPOOL_DEFAULT);
+	Bind(pRenderTarget, pBackBuffer);
+	Bind(pZStencil, pDepthStencil);
+	Viewport.Width = Width;
+	Viewport.Height = Height;
+	Viewport.MaxZ = 1.0f;
+}
+
+StubDevice8::~StubDevice8()
+{
+	for (auto& pTexture : Textures)
+	{
+		Bind<IDirect3DBaseTexture8>(pTexture, nullptr);
+	}
+	for (auto& pStream : Streams)
+	{
+		Bind<IDirect3DVertexBuffer8>(pStream, nullptr);
+	}
+	Bind<IDirect3DIndexBuffer8>(pIndices, nullptr);
+	Bind<IDirect3DSurface8>(pRenderTarget, nullptr);
+	Bind<IDirect3DSurface8>(pZStencil, nullptr);
+	pBackBuffer->Release();
+	pDepthStencil->Release();
+}
+
+template <typename T>
+void StubDevice8::Bind(T *&pSlot, T *pObject)
+{
+	if (pObject)
+	{
+		pObject->AddRef();
+	}
+	if (pSlot)
+	{
+		pSlot->Release();
+	}
+	pSlot = pObject;
+}
+
+template <typename T>
+HRESULT StubDevice8::Return(T *pObject, T **ppObject)
+{
+	if (!ppObject)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	if (pObject)
+	{
+		pObject->AddRef();
+	}
+	*ppObject = pObject;
+	return pObject ? D3D_OK : D3DERR_NOTFOUND;
+}
+
+HRESULT StubDevice8::NewHandle(DWORD *pHandle)
+{
+	if (!pHandle)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	// Real handles are pointers and never collide with the FVF codes the game also passes as vertex shaders
+	*pHandle = 0x80000000 | (NextHandle++ << 1);
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetDirect3D(IDirect3D8** ppD3D8)
+{
+	if (ppD3D8)
+	{
+		*ppD3D8 = nullptr;
+	}
+	return D3DERR_NOTAVAILABLE;
+}
+
+HRESULT StubDevice8::GetDeviceCaps(D3DCAPS8* pCaps)
+{
+	if (!pCaps)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	memset(pCaps, 0, sizeof(*pCaps));
+	pCaps->DeviceType = D3DDEVTYPE_HAL;
+	pCaps->MaxTextureWidth = 4096;
+	pCaps->MaxTextureHeight = 4096;
+	pCaps->MaxSimultaneousTextures = MaxTextureStages;
+	pCaps->MaxTextureBlendStages = MaxTextureStages;
+	pCaps->MaxStreams = MaxStreams;
+	pCaps->MaxActiveLights = 8;
+	pCaps->MaxUserClipPlanes = 6;
+	pCaps->MaxAnisotropy = 16;
+	pCaps->MaxPrimitiveCount = 0xFFFFF;
+	pCaps->MaxVertexIndex = 0xFFFFF;
+	pCaps->MaxStreamStride = 255;
+	pCaps->VertexShaderVersion = D3DVS_VERSION(1, 1);
+	pCaps->MaxVertexShaderConst = 96;
+	pCaps->PixelShaderVersion = D3DPS_VERSION(1, 4);
+	pCaps->MaxPixelShaderValue = 8.0f;
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetDisplayMode(D3DDISPLAYMODE* pMode)
+{
+	if (!pMode)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	pMode->Width = Width;
+	pMode->Height = Height;
+	pMode->RefreshRate = 60;
+	pMode->Format = D3DFMT_X8R8G8B8;
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetCreationParameters(D3DDEVICE_CREATION_PARAMETERS *pParameters)
+{
+	if (!pParameters)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	memset(pParameters, 0, sizeof(*pParameters));
+	pParameters->DeviceType = D3DDEVTYPE_HAL;
+	pParameters->BehaviorFlags = D3DCREATE_HARDWARE_VERTEXPROCESSING;
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetBackBuffer(UINT, D3DBACKBUFFER_TYPE, IDirect3DSurface8** ppBackBuffer)
+{
+	return Return(pBackBuffer, ppBackBuffer);
+}
+
+HRESULT StubDevice8::GetRasterStatus(D3DRASTER_STATUS* pRasterStatus)
+{
+	if (!pRasterStatus)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	pRasterStatus->InVBlank = FALSE;
+	pRasterStatus->ScanLine = 0;
+	return D3D_OK;
+}
+
+void StubDevice8::GetGammaRamp(D3DGAMMARAMP* pRamp)
+{
+	if (pRamp)
+	{
+		for (UINT i = 0; i < 256; i++)
+		{
+			pRamp->red[i] = pRamp->green[i] = pRamp->blue[i] = static_cast<WORD>(i * 257);
+		}
+	}
+}
+
+HRESULT StubDevice8::CreateTexture(UINT Width, UINT Height, UINT Levels, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, IDirect3DTexture8** ppTexture)
+{
+	if (!ppTexture || !Width || !Height)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	*ppTexture = new StubTexture8(this, Width, Height, Levels, Usage, Format, Pool);
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::CreateVertexBuffer(UINT Length, DWORD Usage, DWORD FVF, D3DPOOL Pool, IDirect3DVertexBuffer8** ppVertexBuffer)
+{
+	if (!ppVertexBuffer || !Length)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	*ppVertexBuffer = new StubVertexBuffer8(this, D3DRTYPE_VERTEXBUFFER, Length, Usage, D3DFMT_VERTEXDATA, FVF, Pool);
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::CreateIndexBuffer(UINT Length, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, IDirect3DIndexBuffer8** ppIndexBuffer)
+{
+	if (!ppIndexBuffer || !Length)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	*ppIndexBuffer = new StubIndexBuffer8(this, D3DRTYPE_INDEXBUFFER, Length, Usage, Format, 0, Pool);
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::CreateRenderTarget(UINT Width, UINT Height, D3DFORMAT Format, D3DMULTISAMPLE_TYPE, BOOL, IDirect3DSurface8** ppSurface)
+{
+	if (!ppSurface || !Width || !Height)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	*ppSurface = new StubSurface8(this, Width, Height, Format, D3DUSAGE_RENDERTARGET, D3DPOOL_DEFAULT);
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::CreateDepthStencilSurface(UINT Width, UINT Height, D3DFORMAT Format, D3DMULTISAMPLE_TYPE, IDirect3DSurface8** ppSurface)
+{
+	if (!ppSurface || !Width || !Height)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	*ppSurface = new StubSurface8(this, Width, Height, Format, D3DUSAGE_DEPTHSTENCIL, D3DPOOL_DEFAULT);
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::CreateImageSurface(UINT Width, UINT Height, D3DFORMAT Format, IDirect3DSurface8** ppSurface)
+{
+	if (!ppSurface || !Width || !Height)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	*ppSurface = new StubSurface8(this, Width, Height, Format, 0, D3DPOOL_SYSTEMMEM);
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::SetRenderTarget(IDirect3DSurface8* pNewRenderTarget, IDirect3DSurface8* pNewZStencil)
+{
+	if (pNewRenderTarget)
+	{
+		Bind(pRenderTarget, pNewRenderTarget);
+	}
+	Bind(pZStencil, pNewZStencil);
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetRenderTarget(IDirect3DSurface8** ppRenderTarget)
+{
+	return Return(pRenderTarget, ppRenderTarget);
+}
+
+HRESULT StubDevice8::GetDepthStencilSurface(IDirect3DSurface8** ppZStencilSurface)
+{
+	return Return(pZStencil, ppZStencilSurface);
+}
+
+HRESULT StubDevice8::GetTransform(D3DTRANSFORMSTATETYPE, D3DMATRIX* pMatrix)
+{
+	if (!pMatrix)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	memset(pMatrix, 0, sizeof(*pMatrix));
+	pMatrix->_11 = pMatrix->_22 = pMatrix->_33 = pMatrix->_44 = 1.0f;
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::SetViewport(CONST D3DVIEWPORT8* pViewport)
+{
+	if (!pViewport)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	Viewport = *pViewport;
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetViewport(D3DVIEWPORT8* pViewport)
+{
+	if (!pViewport)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	*pViewport = Viewport;
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetMaterial(D3DMATERIAL8* pMaterial)
+{
+	if (!pMaterial)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	memset(pMaterial, 0, sizeof(*pMaterial));
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetLight(DWORD, D3DLIGHT8* pLight)
+{
+	if (!pLight)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	memset(pLight, 0, sizeof(*pLight));
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetLightEnable(DWORD, BOOL* pEnable)
+{
+	if (!pEnable)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	*pEnable = FALSE;
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetClipPlane(DWORD, float* pPlane)
+{
+	if (!pPlane)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	memset(pPlane, 0, sizeof(float) * 4);
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::SetRenderState(D3DRENDERSTATETYPE State, DWORD Value)
+{
+	if (static_cast<DWORD>(State) < MaxRenderStates)
+	{
+		RenderStates[State] = Value;
+	}
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetRenderState(D3DRENDERSTATETYPE State, DWORD* pValue)
+{
+	if (!pValue)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	*pValue = static_cast<DWORD>(State) < MaxRenderStates ? RenderStates[State] : 0;
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetClipStatus(D3DCLIPSTATUS8* pClipStatus)
+{
+	if (!pClipStatus)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	memset(pClipStatus, 0, sizeof(*pClipStatus));
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetTexture(DWORD Stage, IDirect3DBaseTexture8** ppTexture)
+{
+	if (Stage >= MaxTextureStages || !ppTexture)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	if (Textures[Stage])
+	{
+		Textures[Stage]->AddRef();
+	}
+	*ppTexture = Textures[Stage];
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::SetTexture(DWORD Stage, IDirect3DBaseTexture8* pTexture)
+{
+	if (Stage >= MaxTextureStages)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	Bind(Textures[Stage], pTexture);
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetTextureStageState(DWORD Stage, D3DTEXTURESTAGESTATETYPE Type, DWORD* pValue)
+{
+	if (Stage >= MaxTextureStages || !pValue)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	*pValue = static_cast<DWORD>(Type) < MaxStageStates ? TextureStageStates[Stage][Type] : 0;
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::SetTextureStageState(DWORD Stage, D3DTEXTURESTAGESTATETYPE Type, DWORD Value)
+{
+	if (Stage >= MaxTextureStages)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	if (static_cast<DWORD>(Type) < MaxStageStates)
+	{
+		TextureStageStates[Stage][Type] = Value;
+	}
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::ValidateDevice(DWORD* pNumPasses)
+{
+	if (pNumPasses)
+	{
+		*pNumPasses = 1;
+	}
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetCurrentTexturePalette(UINT *pPaletteNumber)
+{
+	if (!pPaletteNumber)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	*pPaletteNumber = 0;
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetVertexShader(DWORD* pHandle)
+{
+	if (!pHandle)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	*pHandle = VertexShader;
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetVertexShaderConstant(DWORD, void* pConstantData, DWORD ConstantCount)
+{
+	if (!pConstantData)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	memset(pConstantData, 0, ConstantCount * 4 * sizeof(float));
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetVertexShaderDeclaration(DWORD, void*, DWORD* pSizeOfData)
+{
+	if (pSizeOfData)
+	{
+		*pSizeOfData = 0;
+	}
+	return D3DERR_INVALIDCALL;
+}
+
+HRESULT StubDevice8::GetVertexShaderFunction(DWORD, void*, DWORD* pSizeOfData)
+{
+	if (pSizeOfData)
+	{
+		*pSizeOfData = 0;
+	}
+	return D3DERR_INVALIDCALL;
+}
+
+HRESULT StubDevice8::SetStreamSource(UINT StreamNumber, IDirect3DVertexBuffer8* pStreamData, UINT Stride)
+{
+	if (StreamNumber >= MaxStreams)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	Bind(Streams[StreamNumber], pStreamData);
+	StreamStrides[StreamNumber] = Stride;
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetStreamSource(UINT StreamNumber, IDirect3DVertexBuffer8** ppStreamData, UINT* pStride)
+{
+	if (StreamNumber >= MaxStreams || !ppStreamData || !pStride)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	if (Streams[StreamNumber])
+	{
+		Streams[StreamNumber]->AddRef();
+	}
+	*ppStreamData = Streams[StreamNumber];
+	*pStride = StreamStrides[StreamNumber];
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::SetIndices(IDirect3DIndexBuffer8* pIndexData, UINT NewBaseVertexIndex)
+{
+	Bind(pIndices, pIndexData);
+	BaseVertexIndex = NewBaseVertexIndex;
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetIndices(IDirect3DIndexBuffer8** ppIndexData, UINT* pBaseVertexIndex)
+{
+	if (!ppIndexData || !pBaseVertexIndex)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	if (pIndices)
+	{
+		pIndices->AddRef();
+	}
+	*ppIndexData = pIndices;
+	*pBaseVertexIndex = BaseVertexIndex;
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetPixelShader(DWORD* pHandle)
+{
+	if (!pHandle)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	*pHandle = PixelShader;
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetPixelShaderConstant(DWORD, void* pConstantData, DWORD ConstantCount)
+{
+	if (!pConstantData)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	memset(pConstantData, 0, ConstantCount * 4 * sizeof(float));
+	return D3D_OK;
+}
+
+HRESULT StubDevice8::GetPixelShaderFunction(DWORD, void*, DWORD* pSizeOfData)
+{
+	if (pSizeOfData)
+	{
+		*pSizeOfData = 0;
+	}
+	return D3DERR_INVALIDCALL;
+}
@@ -0,0 +1,299 @@
+#pragma once
+
+#include "Wrappers\d3d8\d3d8wrapper.h"
+
+#include <cstdint>
+#include <vector>
+
+// Stands in for the device under the d3d8 wrapper, so a replay runs the wrapper's code without D3D or a GPU
+//
+// It keeps reference counts, surfaces of textures and lockable memory, and hands out shader handles. Everything else
+// succeeds and does nothing, so the time a replay takes is the wrapper's own.
+template <typename I>
+class StubObject : public I
+{
+public:
+	virtual ~StubObject() {}
+
+	STDMETHOD(QueryInterface)(THIS_ REFIID, void** ppvObj)
+	{
+		if (ppvObj)
+		{
+			*ppvObj = nullptr;
+		}
+		return E_NOINTERFACE;
+	}
+	STDMETHOD_(ULONG, AddRef)(THIS) { return ++RefCount; }
+	STDMETHOD_(ULONG, Release)(THIS)
+	{
+		const ULONG Ref = --RefCount;
+		if (Ref == 0)
+		{
+			delete this;
+		}
+		return Ref;
+	}
+
+protected:
+	ULONG RefCount = 1;
+};
+
+class StubDevice8;
+class StubTexture8;
+
+class StubSurface8 : public StubObject<IDirect3DSurface8>
+{
+public:
+	StubSurface8(StubDevice8 *pDevice, UINT Width, UINT Height, D3DFORMAT Format, DWORD Usage, D3DPOOL Pool, StubTexture8 *pContainer = nullptr);
+
+	// Surfaces of a texture share its reference count, like they do in D3D
+	STDMETHOD_(ULONG, AddRef)(THIS);
+	STDMETHOD_(ULONG, Release)(THIS);
+
+	STDMETHOD(GetDevice)(THIS_ IDirect3DDevice8** ppDevice);
+	STDMETHOD(SetPrivateData)(THIS_ REFGUID, CONST void*, DWORD, DWORD) { return D3D_OK; }
+	STDMETHOD(GetPrivateData)(THIS_ REFGUID, void*, DWORD*) { return D3DERR_NOTFOUND; }
+	STDMETHOD(FreePrivateData)(THIS_ REFGUID) { return D3D_OK; }
+	STDMETHOD(GetContainer)(THIS_ REFIID riid, void** ppContainer);
+	STDMETHOD(GetDesc)(THIS_ D3DSURFACE_DESC *pDesc);
+	STDMETHOD(LockRect)(THIS_ D3DLOCKED_RECT* pLockedRect, CONST RECT* pRect, DWORD Flags);
+	STDMETHOD(UnlockRect)(THIS) { return D3D_OK; }
+
+private:
+	StubDevice8 *m_pDevice;
+	StubTexture8 *m_pContainer;
+	D3DSURFACE_DESC Desc = {};
+	UINT Pitch = 0;
+	UINT Rows = 0;
+	std::vector<uint8_t> Data;
+};
+
+class StubTexture8 : public StubObject<IDirect3DTexture8>
+{
+public:
+	StubTexture8(StubDevice8 *pDevice, UINT Width, UINT Height, UINT Levels, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool);
+	~StubTexture8();
+
+	STDMETHOD(GetDevice)(THIS_ IDirect3DDevice8** ppDevice);
+	STDMETHOD(SetPrivateData)(THIS_ REFGUID, CONST void*, DWORD, DWORD) { return D3D_OK; }
+	STDMETHOD(GetPrivateData)(THIS_ REFGUID, void*, DWORD*) { return D3DERR_NOTFOUND; }
+	STDMETHOD(FreePrivateData)(THIS_ REFGUID) { return D3D_OK; }
+	STDMETHOD_(DWORD, SetPriority)(THIS_ DWORD) { return 0; }
+	STDMETHOD_(DWORD, GetPriority)(THIS) { return 0; }
+	STDMETHOD_(void, PreLoad)(THIS) {}
+	STDMETHOD_(D3DRESOURCETYPE, GetType)(THIS) { return D3DRTYPE_TEXTURE; }
+	STDMETHOD_(DWORD, SetLOD)(THIS_ DWORD) { return 0; }
+	STDMETHOD_(DWORD, GetLOD)(THIS) { return 0; }
+	STDMETHOD_(DWORD, GetLevelCount)(THIS) { return static_cast<DWORD>(Levels.size()); }
+	STDMETHOD(GetLevelDesc)(THIS_ UINT Level, D3DSURFACE_DESC *pDesc);
+	STDMETHOD(GetSurfaceLevel)(THIS_ UINT Level, IDirect3DSurface8** ppSurfaceLevel);
+	STDMETHOD(LockRect)(THIS_ UINT Level, D3DLOCKED_RECT* pLockedRect, CONST RECT* pRect, DWORD Flags);
+	STDMETHOD(UnlockRect)(THIS_ UINT Level);
+	STDMETHOD(AddDirtyRect)(THIS_ CONST RECT*) { return D3D_OK; }
+
+private:
+	StubDevice8 *m_pDevice;
+	std::vector<StubSurface8*> Levels;
+};
+
+template <typename I, typename D>
+class StubBuffer8 : public StubObject<I>
+{
+public:
+	StubBuffer8(StubDevice8 *pDevice, D3DRESOURCETYPE Type, UINT Length, DWORD Usage, D3DFORMAT Format, DWORD FVF, D3DPOOL Pool) : m_pDevice(pDevice), Data(Length)
+	{
+		Desc.Format = Format;
+		Desc.Type = Type;
+		Desc.Usage = Usage;
+		Desc.Pool = Pool;
+		Desc.Size = Length;
+		SetFVF(Desc, FVF);
+	}
+
+	STDMETHOD(GetDevice)(THIS_ IDirect3DDevice8** ppDevice);
+	STDMETHOD(SetPrivateData)(THIS_ REFGUID, CONST void*, DWORD, DWORD) { return D3D_OK; }
+	STDMETHOD(GetPrivateData)(THIS_ REFGUID, void*, DWORD*) { return D3DERR_NOTFOUND; }
+	STDMETHOD(FreePrivateData)(THIS_ REFGUID) { return D3D_OK; }
+	STDMETHOD_(DWORD, SetPriority)(THIS_ DWORD) { return 0; }
+	STDMETHOD_(DWORD, GetPriority)(THIS) { return 0; }
+	STDMETHOD_(void, PreLoad)(THIS) {}
+	STDMETHOD_(D3DRESOURCETYPE, GetType)(THIS) { return Desc.Type; }
+	STDMETHOD(Lock)(THIS_ UINT OffsetToLock, UINT, BYTE** ppbData, DWORD)
+	{
+		if (!ppbData || OffsetToLock > Data.size())
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		*ppbData = Data.data() + OffsetToLock;
+		return D3D_OK;
+	}
+	STDMETHOD(Unlock)(THIS) { return D3D_OK; }
+	STDMETHOD(GetDesc)(THIS_ D *pDesc)
+	{
+		if (!pDesc)
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		*pDesc = Desc;
+		return D3D_OK;
+	}
+
+private:
+	static void SetFVF(D3DVERTEXBUFFER_DESC &VertexDesc, DWORD FVF) { VertexDesc.FVF = FVF; }
+	static void SetFVF(D3DINDEXBUFFER_DESC &, DWORD) {}
+
+	StubDevice8 *m_pDevice;
+	D Desc = {};
+	std::vector<uint8_t> Data;
+};
+
+typedef StubBuffer8<IDirect3DVertexBuffer8, D3DVERTEXBUFFER_DESC> StubVertexBuffer8;
+typedef StubBuffer8<IDirect3DIndexBuffer8, D3DINDEXBUFFER_DESC> StubIndexBuffer8;
+
+class StubDevice8 : public StubObject<IDirect3DDevice8>
+{
+public:
+	StubDevice8(UINT Width, UINT Height);
+	~StubDevice8();
+
+	// Owned by the replay, which deletes it once the wrapper has released it
+	STDMETHOD_(ULONG, Release)(THIS) { return RefCount ? --RefCount : 0; }
+
+	STDMETHOD(TestCooperativeLevel)(THIS) { return D3D_OK; }
+	STDMETHOD_(UINT, GetAvailableTextureMem)(THIS) { return 512 * 1024 * 1024; }
+	STDMETHOD(ResourceManagerDiscardBytes)(THIS_ DWORD) { return D3D_OK; }
+	STDMETHOD(GetDirect3D)(THIS_ IDirect3D8** ppD3D8);
+	STDMETHOD(GetDeviceCaps)(THIS_ D3DCAPS8* pCaps);
+	STDMETHOD(GetDisplayMode)(THIS_ D3DDISPLAYMODE* pMode);
+	STDMETHOD(GetCreationParameters)(THIS_ D3DDEVICE_CREATION_PARAMETERS *pParameters);
+	STDMETHOD(SetCursorProperties)(THIS_ UINT, UINT, IDirect3DSurface8*) { return D3D_OK; }
+	STDMETHOD_(void, SetCursorPosition)(THIS_ UINT, UINT, DWORD) {}
+	STDMETHOD_(BOOL, ShowCursor)(THIS_ BOOL) { return FALSE; }
+	STDMETHOD(CreateAdditionalSwapChain)(THIS_ D3DPRESENT_PARAMETERS*, IDirect3DSwapChain8**) { return D3DERR_NOTAVAILABLE; }
+	STDMETHOD(Reset)(THIS_ D3DPRESENT_PARAMETERS*) { return D3D_OK; }
+	STDMETHOD(Present)(THIS_ CONST RECT*, CONST RECT*, HWND, CONST RGNDATA*) { return D3D_OK; }
+	STDMETHOD(GetBackBuffer)(THIS_ UINT, D3DBACKBUFFER_TYPE, IDirect3DSurface8** ppBackBuffer);
+	STDMETHOD(GetRasterStatus)(THIS_ D3DRASTER_STATUS* pRasterStatus);
+	STDMETHOD_(void, SetGammaRamp)(THIS_ DWORD, CONST D3DGAMMARAMP*) {}
+	STDMETHOD_(void, GetGammaRamp)(THIS_ D3DGAMMARAMP* pRamp);
+	STDMETHOD(CreateTexture)(THIS_ UINT Width, UINT Height, UINT Levels, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, IDirect3DTexture8** ppTexture);
+	STDMETHOD(CreateVolumeTexture)(THIS_ UINT, UINT, UINT, UINT, DWORD, D3DFORMAT, D3DPOOL, IDirect3DVolumeTexture8**) { return D3DERR_NOTAVAILABLE; }
+	STDMETHOD(CreateCubeTexture)(THIS_ UINT, UINT, DWORD, D3DFORMAT, D3DPOOL, IDirect3DCubeTexture8**) { return D3DERR_NOTAVAILABLE; }
+	STDMETHOD(CreateVertexBuffer)(THIS_ UINT Length, DWORD Usage, DWORD FVF, D3DPOOL Pool, IDirect3DVertexBuffer8** ppVertexBuffer);
+	STDMETHOD(CreateIndexBuffer)(THIS_ UINT Length, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, IDirect3DIndexBuffer8** ppIndexBuffer);
+	STDMETHOD(CreateRenderTarget)(THIS_ UINT Width, UINT Height, D3DFORMAT Format, D3DMULTISAMPLE_TYPE, BOOL, IDirect3DSurface8** ppSurface);
+	STDMETHOD(CreateDepthStencilSurface)(THIS_ UINT Width, UINT Height, D3DFORMAT Format, D3DMULTISAMPLE_TYPE, IDirect3DSurface8** ppSurface);
+	STDMETHOD(CreateImageSurface)(THIS_ UINT Width, UINT Height, D3DFORMAT Format, IDirect3DSurface8** ppSurface);
+	STDMETHOD(CopyRects)(THIS_ IDirect3DSurface8*, CONST RECT*, UINT, IDirect3DSurface8*, CONST POINT*) { return D3D_OK; }
+	STDMETHOD(UpdateTexture)(THIS_ IDirect3DBaseTexture8*, IDirect3DBaseTexture8*) { return D3D_OK; }
+	STDMETHOD(GetFrontBuffer)(THIS_ IDirect3DSurface8*) { return D3D_OK; }
+	STDMETHOD(SetRenderTarget)(THIS_ IDirect3DSurface8* pRenderTarget, IDirect3DSurface8* pNewZStencil);
+	STDMETHOD(GetRenderTarget)(THIS_ IDirect3DSurface8** ppRenderTarget);
+	STDMETHOD(GetDepthStencilSurface)(THIS_ IDirect3DSurface8** ppZStencilSurface);
+	STDMETHOD(BeginScene)(THIS) { return D3D_OK; }
+	STDMETHOD(EndScene)(THIS) { return D3D_OK; }
+	STDMETHOD(Clear)(THIS_ DWORD, CONST D3DRECT*, DWORD, D3DCOLOR, float, DWORD) { return D3D_OK; }
+	STDMETHOD(SetTransform)(THIS_ D3DTRANSFORMSTATETYPE, CONST D3DMATRIX*) { return D3D_OK; }
+	STDMETHOD(GetTransform)(THIS_ D3DTRANSFORMSTATETYPE, D3DMATRIX* pMatrix);
+	STDMETHOD(MultiplyTransform)(THIS_ D3DTRANSFORMSTATETYPE, CONST D3DMATRIX*) { return D3D_OK; }
+	STDMETHOD(SetViewport)(THIS_ CONST D3DVIEWPORT8* pViewport);
+	STDMETHOD(GetViewport)(THIS_ D3DVIEWPORT8* pViewport);
+	STDMETHOD(SetMaterial)(THIS_ CONST D3DMATERIAL8*) { return D3D_OK; }
+	STDMETHOD(GetMaterial)(THIS_ D3DMATERIAL8* pMaterial);
+	STDMETHOD(SetLight)(THIS_ DWORD, CONST D3DLIGHT8*) { return D3D_OK; }
+	STDMETHOD(GetLight)(THIS_ DWORD, D3DLIGHT8* pLight);
+	STDMETHOD(LightEnable)(THIS_ DWORD, BOOL) { return D3D_OK; }
+	STDMETHOD(GetLightEnable)(THIS_ DWORD, BOOL* pEnable);
+	STDMETHOD(SetClipPlane)(THIS_ DWORD, CONST float*) { return D3D_OK; }
+	STDMETHOD(GetClipPlane)(THIS_ DWORD, float* pPlane);
+	STDMETHOD(SetRenderState)(THIS_ D3DRENDERSTATETYPE State, DWORD Value);
+	STDMETHOD(GetRenderState)(THIS_ D3DRENDERSTATETYPE State, DWORD* pValue);
+	STDMETHOD(BeginStateBlock)(THIS) { return D3D_OK; }
+	STDMETHOD(EndStateBlock)(THIS_ DWORD* pToken) { return NewHandle(pToken); }
+	STDMETHOD(ApplyStateBlock)(THIS_ DWORD) { return D3D_OK; }
+	STDMETHOD(CaptureStateBlock)(THIS_ DWORD) { return D3D_OK; }
+	STDMETHOD(DeleteStateBlock)(THIS_ DWORD) { return D3D_OK; }
+	STDMETHOD(CreateStateBlock)(THIS_ D3DSTATEBLOCKTYPE, DWORD* pToken) { return NewHandle(pToken); }
+	STDMETHOD(SetClipStatus)(THIS_ CONST D3DCLIPSTATUS8*) { return D3D_OK; }
+	STDMETHOD(GetClipStatus)(THIS_ D3DCLIPSTATUS8* pClipStatus);
+	STDMETHOD(GetTexture)(THIS_ DWORD Stage, IDirect3DBaseTexture8** ppTexture);
+	STDMETHOD(SetTexture)(THIS_ DWORD Stage, IDirect3DBaseTexture8* pTexture);
+	STDMETHOD(GetTextureStageState)(THIS_ DWORD Stage, D3DTEXTURESTAGESTATETYPE Type, DWORD* pValue);
+	STDMETHOD(SetTextureStageState)(THIS_ DWORD Stage, D3DTEXTURESTAGESTATETYPE Type, DWORD Value);
+	STDMETHOD(ValidateDevice)(THIS_ DWORD* pNumPasses);
+	STDMETHOD(GetInfo)(THIS_ DWORD, void*, DWORD) { return S_FALSE; }
+	STDMETHOD(SetPaletteEntries)(THIS_ UINT, CONST PALETTEENTRY*) { return D3D_OK; }
+	STDMETHOD(GetPaletteEntries)(THIS_ UINT, PALETTEENTRY*) { return D3D_OK; }
+	STDMETHOD(SetCurrentTexturePalette)(THIS_ UINT) { return D3D_OK; }
+	STDMETHOD(GetCurrentTexturePalette)(THIS_ UINT *pPaletteNumber);
+	STDMETHOD(DrawPrimitive)(THIS_ D3DPRIMITIVETYPE, UINT, UINT) { return D3D_OK; }
+	STDMETHOD(DrawIndexedPrimitive)(THIS_ D3DPRIMITIVETYPE, UINT, UINT, UINT, UINT) { return D3D_OK; }
+	STDMETHOD(DrawPrimitiveUP)(THIS_ D3DPRIMITIVETYPE, UINT, CONST void*, UINT) { return D3D_OK; }
+	STDMETHOD(DrawIndexedPrimitiveUP)(THIS_ D3DPRIMITIVETYPE, UINT, UINT, UINT, CONST void*, D3DFORMAT, CONST void*, UINT) { return D3D_OK; }
+	STDMETHOD(ProcessVertices)(THIS_ UINT, UINT, UINT, IDirect3DVertexBuffer8*, DWORD) { return D3D_OK; }
+	STDMETHOD(CreateVertexShader)(THIS_ CONST DWORD*, CONST DWORD*, DWORD* pHandle, DWORD) { return NewHandle(pHandle); }
+	STDMETHOD(SetVertexShader)(THIS_ DWORD Handle) { VertexShader = Handle; return D3D_OK; }
+	STDMETHOD(GetVertexShader)(THIS_ DWORD* pHandle);
+	STDMETHOD(DeleteVertexShader)(THIS_ DWORD) { return D3D_OK; }
+	STDMETHOD(SetVertexShaderConstant)(THIS_ DWORD, CONST void*, DWORD) { return D3D_OK; }
+	STDMETHOD(GetVertexShaderConstant)(THIS_ DWORD, void* pConstantData, DWORD ConstantCount);
+	STDMETHOD(GetVertexShaderDeclaration)(THIS_ DWORD, void*, DWORD* pSizeOfData);
+	STDMETHOD(GetVertexShaderFunction)(THIS_ DWORD, void*, DWORD* pSizeOfData);
+	STDMETHOD(SetStreamSource)(THIS_ UINT StreamNumber, IDirect3DVertexBuffer8* pStreamData, UINT Stride);
+	STDMETHOD(GetStreamSource)(THIS_ UINT, IDirect3DVertexBuffer8** ppStreamData, UINT* pStride);
+	STDMETHOD(SetIndices)(THIS_ IDirect3DIndexBuffer8* pIndexData, UINT BaseVertexIndex);
+	STDMETHOD(GetIndices)(THIS_ IDirect3DIndexBuffer8** ppIndexData, UINT* pBaseVertexIndex);
+	STDMETHOD(CreatePixelShader)(THIS_ CONST DWORD*, DWORD* pHandle) { return NewHandle(pHandle); }
+	STDMETHOD(SetPixelShader)(THIS_ DWORD Handle) { PixelShader = Handle; return D3D_OK; }
+	STDMETHOD(GetPixelShader)(THIS_ DWORD* pHandle);
+	STDMETHOD(DeletePixelShader)(THIS_ DWORD) { return D3D_OK; }
+	STDMETHOD(SetPixelShaderConstant)(THIS_ DWORD, CONST void*, DWORD) { return D3D_OK; }
+	STDMETHOD(GetPixelShaderConstant)(THIS_ DWORD, void* pConstantData, DWORD ConstantCount);
+	STDMETHOD(GetPixelShaderFunction)(THIS_ DWORD, void*, DWORD* pSizeOfData);
+	STDMETHOD(DrawRectPatch)(THIS_ UINT, CONST float*, CONST D3DRECTPATCH_INFO*) { return D3D_OK; }
+	STDMETHOD(DrawTriPatch)(THIS_ UINT, CONST float*, CONST D3DTRIPATCH_INFO*) { return D3D_OK; }
+	STDMETHOD(DeletePatch)(THIS_ UINT) { return D3D_OK; }
+
+private:
+	static constexpr DWORD MaxRenderStates = 256;
+	static constexpr DWORD MaxTextureStages = 8;
+	static constexpr DWORD MaxStageStates = 32;
+	static constexpr DWORD MaxStreams = 16;
+
+	HRESULT NewHandle(DWORD *pHandle);
+	// Bound objects are referenced by the device, like they are in D3D8
+	template <typename T>
+	static void Bind(T *&pSlot, T *pObject);
+	template <typename T>
+	static HRESULT Return(T *pObject, T **ppObject);
+
+	UINT Width;
+	UINT Height;
+	IDirect3DSurface8 *pBackBuffer = nullptr;
+	IDirect3DSurface8 *pDepthStencil = nullptr;
+	IDirect3DSurface8 *pRenderTarget = nullptr;
+	IDirect3DSurface8 *pZStencil = nullptr;
+	IDirect3DBaseTexture8 *Textures[MaxTextureStages] = {};
+	IDirect3DVertexBuffer8 *Streams[MaxStreams] = {};
+	UINT StreamStrides[MaxStreams] = {};
+	IDirect3DIndexBuffer8 *pIndices = nullptr;
+	UINT BaseVertexIndex = 0;
+	DWORD RenderStates[MaxRenderStates] = {};
+	DWORD TextureStageStates[MaxTextureStages][MaxStageStates] = {};
+	D3DVIEWPORT8 Viewport = {};
+	DWORD VertexShader = 0;
+	DWORD PixelShader = 0;
+	DWORD NextHandle = 1;
+};
+
+template <typename I, typename D>
+HRESULT StubBuffer8<I, D>::GetDevice(IDirect3DDevice8** ppDevice)
+{
+	if (!ppDevice)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	m_pDevice->AddRef();
+	*ppDevice = m_pDevice;
+	return D3D_OK;
+}
@@ -0,0 +1,364 @@
+#include "WrapperDevice.h"
+
+#include <cstring>
+
+namespace
+{
+	UINT GetVertexCount(uint32_t PrimitiveType, uint32_t PrimitiveCount)
+	{
+		switch (PrimitiveType)
+		{
+		case D3DPT_POINTLIST:
+			return PrimitiveCount;
+		case D3DPT_LINELIST:
+			return PrimitiveCount * 2;
+		case D3DPT_LINESTRIP:
+			return PrimitiveCount + 1;
+		case D3DPT_TRIANGLELIST:
+			return PrimitiveCount * 3;
+		default:
+			return PrimitiveCount + 2;
+		}
+	}
+
+	template <typename T>
+	void ReleaseInterface(T *&pInterface)
+	{
+		if (pInterface)
+		{
+			pInterface->Release();
+			pInterface = nullptr;
+		}
+	}
+}
+
+WrapperDevice::WrapperDevice(UINT Width, UINT Height) : Width(Width), Height(Height)
+{
+	// Replays run as fast as they can and do not record themselves
+	LimitPerFrameFPS = 0.0f;
+	EnableCallRecorder = false;
+
+	Reset();
+}
+
+WrapperDevice::~WrapperDevice()
+{
+	Release();
+}
+
+void WrapperDevice::Reset()
+{
+	Release();
+
+	// The wrapper sizes its scaled surfaces from the back buffer the game asked for
+	BufferWidth = Width;
+	BufferHeight = Height;
+
+	pStub = new StubDevice8(Width, Height);
+	pDevice = new m_IDirect3DDevice8(pStub, nullptr);
+}
+
+void WrapperDevice::Release()
+{
+	if (!pDevice)
+	{
+		return;
+	}
+
+	// Unbind everything first, so the wrappers of the resources go away with their last reference
+	for (DWORD Stage = 0; Stage < 8; Stage++)
+	{
+		pDevice->SetTexture(Stage, nullptr);
+	}
+	for (UINT Stream = 0; Stream < 16; Stream++)
+	{
+		pDevice->SetStreamSource(Stream, nullptr, 0);
+	}
+	pDevice->SetIndices(nullptr, 0);
+
+	for (RESOURCE &Resource : Resources)
+	{
+		ReleaseInterface(Resource.pTexture);
+		ReleaseInterface(Resource.pVertexBuffer);
+		ReleaseInterface(Resource.pIndexBuffer);
+		ReleaseInterface(Resource.pSurface);
+	}
+	Resources.clear();
+
+	// The wrapper and its hooks may still hold references of their own
+	while (pDevice->Release() != 0) {}
+	pDevice = nullptr;
+
+	delete pStub;
+	pStub = nullptr;
+}
+
+WrapperDevice::RESOURCE &WrapperDevice::Get(uint32_t Id)
+{
+	if (Id >= Resources.size())
+	{
+		Resources.resize(Id + 1);
+	}
+	return Resources[Id];
+}
+
+IDirect3DTexture8 *WrapperDevice::GetTexture(uint32_t Id)
+{
+	if (!Id)
+	{
+		return nullptr;
+	}
+	RESOURCE &Resource = Get(Id);
+	if (!Resource.pTexture && FAILED(pDevice->CreateTexture(DefaultTextureSize, DefaultTextureSize, 0, 0, D3DFMT_A8R8G8B8, D3DPOOL_MANAGED, &Resource.pTexture)))
+	{
+		Resource.pTexture = nullptr;
+	}
+	return Resource.pTexture;
+}
+
+IDirect3DVertexBuffer8 *WrapperDevice::GetVertexBuffer(uint32_t Id)
+{
+	if (!Id)
+	{
+		return nullptr;
+	}
+	RESOURCE &Resource = Get(Id);
+	if (!Resource.pVertexBuffer && FAILED(pDevice->CreateVertexBuffer(DefaultBufferSize, D3DUSAGE_WRITEONLY, 0, D3DPOOL_MANAGED, &Resource.pVertexBuffer)))
+	{
+		Resource.pVertexBuffer = nullptr;
+	}
+	return Resource.pVertexBuffer;
+}
+
+IDirect3DIndexBuffer8 *WrapperDevice::GetIndexBuffer(uint32_t Id)
+{
+	if (!Id)
+	{
+		return nullptr;
+	}
+	RESOURCE &Resource = Get(Id);
+	if (!Resource.pIndexBuffer && FAILED(pDevice->CreateIndexBuffer(DefaultBufferSize, D3DUSAGE_WRITEONLY, D3DFMT_INDEX16, D3DPOOL_MANAGED, &Resource.pIndexBuffer)))
+	{
+		Resource.pIndexBuffer = nullptr;
+	}
+	return Resource.pIndexBuffer;
+}
+
+IDirect3DSurface8 *WrapperDevice::GetSurface(uint32_t Id, DWORD Usage)
+{
+	if (!Id)
+	{
+		return nullptr;
+	}
+	RESOURCE &Resource = Get(Id);
+	if (!Resource.pSurface)
+	{
+		const HRESULT hr = (Usage == D3DUSAGE_DEPTHSTENCIL) ?
+			pDevice->CreateDepthStencilSurface(Width, Height, D3DFMT_D24S8, D3DMULTISAMPLE_NONE, &Resource.pSurface) :
+			pDevice->CreateRenderTarget(Width, Height, D3DFMT_X8R8G8B8, D3DMULTISAMPLE_NONE, FALSE, &Resource.pSurface);
+		if (FAILED(hr))
+		{
+			Resource.pSurface = nullptr;
+		}
+	}
+	return Resource.pSurface;
+}
+
+const void *WrapperDevice::GetScratch(size_t Size)
+{
+	if (Scratch.size() < Size)
+	{
+		Scratch.resize(Size);
+	}
+	return Scratch.data();
+}
+
+void WrapperDevice::Present()
+{
+	pDevice->Present(nullptr, nullptr, nullptr, nullptr);
+}
+
+void WrapperDevice::BeginScene()
+{
+	pDevice->BeginScene();
+}
+
+void WrapperDevice::EndScene()
+{
+	pDevice->EndScene();
+}
+
+void WrapperDevice::Clear(uint32_t, uint32_t Flags, uint32_t Color, float Z, uint32_t Stencil)
+{
+	// The rectangles are not recorded, so the whole target is cleared
+	pDevice->Clear(0, nullptr, Flags, Color, Z, Stencil);
+}
+
+void WrapperDevice::SetRenderState(uint32_t State, uint32_t Value)
+{
+	pDevice->SetRenderState((D3DRENDERSTATETYPE)State, Value);
+}
+
+void WrapperDevice::SetTextureStageState(uint32_t Stage, uint32_t Type, uint32_t Value)
+{
+	pDevice->SetTextureStageState(Stage, (D3DTEXTURESTAGESTATETYPE)Type, Value);
+}
+
+void WrapperDevice::SetTexture(uint32_t Stage, uint32_t Texture)
+{
+	pDevice->SetTexture(Stage, GetTexture(Texture));
+}
+
+void WrapperDevice::SetStreamSource(uint32_t StreamNumber, uint32_t VertexBuffer, uint32_t Stride)
+{
+	pDevice->SetStreamSource(StreamNumber, GetVertexBuffer(VertexBuffer), Stride);
+}
+
+void WrapperDevice::SetIndices(uint32_t IndexBuffer, uint32_t BaseVertexIndex)
+{
+	pDevice->SetIndices(GetIndexBuffer(IndexBuffer), BaseVertexIndex);
+}
+
+void WrapperDevice::SetVertexShader(uint32_t Handle)
+{
+	pDevice->SetVertexShader(Handle);
+}
+
+void WrapperDevice::SetPixelShader(uint32_t Handle)
+{
+	pDevice->SetPixelShader(Handle);
+}
+
+void WrapperDevice::SetVertexShaderConstant(uint32_t Register, uint32_t ConstantCount, uint64_t)
+{
+	pDevice->SetVertexShaderConstant(Register, GetScratch(ConstantCount * 4 * sizeof(float)), ConstantCount);
+}
+
+void WrapperDevice::SetPixelShaderConstant(uint32_t Register, uint32_t ConstantCount, uint64_t)
+{
+	pDevice->SetPixelShaderConstant(Register, GetScratch(ConstantCount * 4 * sizeof(float)), ConstantCount);
+}
+
+void WrapperDevice::SetTransform(uint32_t State, uint64_t)
+{
+	D3DMATRIX Matrix = {};
+	Matrix._11 = Matrix._22 = Matrix._33 = Matrix._44 = 1.0f;
+	pDevice->SetTransform((D3DTRANSFORMSTATETYPE)State, &Matrix);
+}
+
+void WrapperDevice::SetViewport(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height, float MinZ, float MaxZ)
+{
+	D3DVIEWPORT8 Viewport = { X, Y, Width, Height, MinZ, MaxZ };
+	pDevice->SetViewport(&Viewport);
+}
+
+void WrapperDevice::SetRenderTarget(uint32_t RenderTarget, uint32_t ZStencil)
+{
+	pDevice->SetRenderTarget(GetSurface(RenderTarget, D3DUSAGE_RENDERTARGET), GetSurface(ZStencil, D3DUSAGE_DEPTHSTENCIL));
+}
+
+void WrapperDevice::DrawPrimitive(uint32_t PrimitiveType, uint32_t StartVertex, uint32_t PrimitiveCount)
+{
+	pDevice->DrawPrimitive((D3DPRIMITIVETYPE)PrimitiveType, StartVertex, PrimitiveCount);
+}
+
+void WrapperDevice::DrawIndexedPrimitive(uint32_t PrimitiveType, uint32_t MinVertexIndex, uint32_t NumVertices, uint32_t StartIndex, uint32_t PrimitiveCount)
+{
+	pDevice->DrawIndexedPrimitive((D3DPRIMITIVETYPE)PrimitiveType, MinVertexIndex, NumVertices, StartIndex, PrimitiveCount);
+}
+
+void WrapperDevice::DrawPrimitiveUP(uint32_t PrimitiveType, uint32_t PrimitiveCount, uint32_t Stride, uint64_t)
+{
+	const size_t Size = (size_t)GetVertexCount(PrimitiveType, PrimitiveCount) * Stride;
+	pDevice->DrawPrimitiveUP((D3DPRIMITIVETYPE)PrimitiveType, PrimitiveCount, GetScratch(Size), Stride);
+}
+
+void WrapperDevice::DrawIndexedPrimitiveUP(uint32_t PrimitiveType, uint32_t MinIndex, uint32_t NumVertices, uint32_t PrimitiveCount, uint32_t IndexFormat, uint32_t Stride, uint64_t, uint64_t)
+{
+	// Zero indices all point at the first vertex, one scratch buffer holds both
+	const size_t IndexSize = (size_t)GetVertexCount(PrimitiveType, PrimitiveCount) * (IndexFormat == D3DFMT_INDEX32 ? 4 : 2);
+	const size_t VertexSize = (size_t)(MinIndex + NumVertices) * Stride;
+	const void *pData = GetScratch(IndexSize > VertexSize ? IndexSize : VertexSize);
+	pDevice->DrawIndexedPrimitiveUP((D3DPRIMITIVETYPE)PrimitiveType, MinIndex, NumVertices, PrimitiveCount, pData, (D3DFORMAT)IndexFormat, pData, Stride);
+}
+
+void WrapperDevice::CreateTexture(uint32_t Texture, uint32_t Width, uint32_t Height, uint32_t Levels, uint32_t Usage, uint32_t Format, uint32_t Pool)
+{
+	RESOURCE &Resource = Get(Texture);
+	ReleaseInterface(Resource.pTexture);
+	if (FAILED(pDevice->CreateTexture(Width, Height, Levels, Usage, (D3DFORMAT)Format, (D3DPOOL)Pool, &Resource.pTexture)))
+	{
+		Resource.pTexture = nullptr;
+	}
+}
+
+void WrapperDevice::CreateVertexBuffer(uint32_t VertexBuffer, uint32_t Length, uint32_t Usage, uint32_t FVF, uint32_t Pool)
+{
+	RESOURCE &Resource = Get(VertexBuffer);
+	ReleaseInterface(Resource.pVertexBuffer);
+	if (FAILED(pDevice->CreateVertexBuffer(Length, Usage, FVF, (D3DPOOL)Pool, &Resource.pVertexBuffer)))
+	{
+		Resource.pVertexBuffer = nullptr;
+	}
+}
+
+void WrapperDevice::CreateIndexBuffer(uint32_t IndexBuffer, uint32_t Length, uint32_t Usage, uint32_t Format, uint32_t Pool)
+{
+	RESOURCE &Resource = Get(IndexBuffer);
+	ReleaseInterface(Resource.pIndexBuffer);
+	if (FAILED(pDevice->CreateIndexBuffer(Length, Usage, (D3DFORMAT)Format, (D3DPOOL)Pool, &Resource.pIndexBuffer)))
+	{
+		Resource.pIndexBuffer = nullptr;
+	}
+}
+
+void WrapperDevice::CreateSurface(uint32_t Surface, uint32_t Width, uint32_t Height, uint32_t Format, uint32_t Usage)
+{
+	RESOURCE &Resource = Get(Surface);
+	ReleaseInterface(Resource.pSurface);
+	HRESULT hr;
+	if (Usage == D3DUSAGE_DEPTHSTENCIL)
+	{
+		hr = pDevice->CreateDepthStencilSurface(Width, Height, (D3DFORMAT)Format, D3DMULTISAMPLE_NONE, &Resource.pSurface);
+	}
+	else if (Usage == D3DUSAGE_RENDERTARGET)
+	{
+		hr = pDevice->CreateRenderTarget(Width, Height, (D3DFORMAT)Format, D3DMULTISAMPLE_NONE, FALSE, &Resource.pSurface);
+	}
+	else
+	{
+		hr = pDevice->CreateImageSurface(Width, Height, (D3DFORMAT)Format, &Resource.pSurface);
+	}
+	if (FAILED(hr))
+	{
+		Resource.pSurface = nullptr;
+	}
+}
+
+void WrapperDevice::UpdateResource(uint32_t Resource, uint32_t Level, uint64_t)
+{
+	// A resource first seen here has an unknown type, it has nothing to lock until a later call shows what it is
+	if (!Resource || Resource >= Resources.size())
+	{
+		return;
+	}
+	RESOURCE &Entry = Resources[Resource];
+	D3DLOCKED_RECT Rect;
+	BYTE *pData;
+	if (Entry.pTexture && SUCCEEDED(Entry.pTexture->LockRect(Level, &Rect, nullptr, 0)))
+	{
+		Entry.pTexture->UnlockRect(Level);
+	}
+	else if (Entry.pVertexBuffer && SUCCEEDED(Entry.pVertexBuffer->Lock(0, 0, &pData, 0)))
+	{
+		Entry.pVertexBuffer->Unlock();
+	}
+	else if (Entry.pIndexBuffer && SUCCEEDED(Entry.pIndexBuffer->Lock(0, 0, &pData, 0)))
+	{
+		Entry.pIndexBuffer->Unlock();
+	}
+	else if (Entry.pSurface && SUCCEEDED(Entry.pSurface->LockRect(&Rect, nullptr, 0)))
+	{
+		Entry.pSurface->UnlockRect();
+	}
+}
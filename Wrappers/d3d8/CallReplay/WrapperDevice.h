@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CallStream.h"
+#include "StubDevice8.h"
+
+#include <cstdint>
+#include <vector>
+
+// Replays a stream through the d3d8 wrapper, with StubDevice8 under it in place of D3D
+//
+// Every call goes to m_IDirect3DDevice8 and every resource is one of its wrappers, so the time a replay takes is the
+// wrapper's own work per call: its state tracking, lookup tables, game hooks and the recorder checks. The stream only
+// has hashes of buffer and constant contents, so those are passed as zeros.
+class WrapperDevice : public ReplayDevice
+{
+public:
+	WrapperDevice(UINT Width, UINT Height);
+	~WrapperDevice();
+
+	// Starts again from a new wrapper, so every run does the same work
+	void Reset();
+
+	void Present() override;
+	void BeginScene() override;
+	void EndScene() override;
+	void Clear(uint32_t Count, uint32_t Flags, uint32_t Color, float Z, uint32_t Stencil) override;
+	void SetRenderState(uint32_t State, uint32_t Value) override;
+	void SetTextureStageState(uint32_t Stage, uint32_t Type, uint32_t Value) override;
+	void SetTexture(uint32_t Stage, uint32_t Texture) override;
+	void SetStreamSource(uint32_t StreamNumber, uint32_t VertexBuffer, uint32_t Stride) override;
+	void SetIndices(uint32_t IndexBuffer, uint32_t BaseVertexIndex) override;
+	void SetVertexShader(uint32_t Handle) override;
+	void SetPixelShader(uint32_t Handle) override;
+	void SetVertexShaderConstant(uint32_t Register, uint32_t ConstantCount, uint64_t Hash) override;
+	void SetPixelShaderConstant(uint32_t Register, uint32_t ConstantCount, uint64_t Hash) override;
+	void SetTransform(uint32_t State, uint64_t Hash) override;
+	void SetViewport(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height, float MinZ, float MaxZ) override;
+	void SetRenderTarget(uint32_t RenderTarget, uint32_t ZStencil) override;
+	void DrawPrimitive(uint32_t PrimitiveType, uint32_t StartVertex, uint32_t PrimitiveCount) override;
+	void DrawIndexedPrimitive(uint32_t PrimitiveType, uint32_t MinVertexIndex, uint32_t NumVertices, uint32_t StartIndex, uint32_t PrimitiveCount) override;
+	void DrawPrimitiveUP(uint32_t PrimitiveType, uint32_t PrimitiveCount, uint32_t Stride, uint64_t VertexHash) override;
+	void DrawIndexedPrimitiveUP(uint32_t PrimitiveType, uint32_t MinIndex, uint32_t NumVertices, uint32_t PrimitiveCount, uint32_t IndexFormat, uint32_t Stride, uint64_t IndexHash, uint64_t VertexHash) override;
+	void CreateTexture(uint32_t Texture, uint32_t Width, uint32_t Height, uint32_t Levels, uint32_t Usage, uint32_t Format, uint32_t Pool) override;
+	void CreateVertexBuffer(uint32_t VertexBuffer, uint32_t Length, uint32_t Usage, uint32_t FVF, uint32_t Pool) override;
+	void CreateIndexBuffer(uint32_t IndexBuffer, uint32_t Length, uint32_t Usage, uint32_t Format, uint32_t Pool) override;
+	void CreateSurface(uint32_t Surface, uint32_t Width, uint32_t Height, uint32_t Format, uint32_t Usage) override;
+	void UpdateResource(uint32_t Resource, uint32_t Level, uint64_t Hash) override;
+
+private:
+	// Resources used before the recording started have no create call, they get one of these on first use
+	static constexpr UINT DefaultTextureSize = 256;
+	static constexpr UINT DefaultBufferSize = 64 * 1024;
+
+	struct RESOURCE
+	{
+		IDirect3DTexture8 *pTexture = nullptr;
+		IDirect3DVertexBuffer8 *pVertexBuffer = nullptr;
+		IDirect3DIndexBuffer8 *pIndexBuffer = nullptr;
+		IDirect3DSurface8 *pSurface = nullptr;
+	};
+
+	RESOURCE &Get(uint32_t Id);
+	IDirect3DTexture8 *GetTexture(uint32_t Id);
+	IDirect3DVertexBuffer8 *GetVertexBuffer(uint32_t Id);
+	IDirect3DIndexBuffer8 *GetIndexBuffer(uint32_t Id);
+	IDirect3DSurface8 *GetSurface(uint32_t Id, DWORD Usage);
+	const void *GetScratch(size_t Size);
+	void Release();
+
+	UINT Width;
+	UINT Height;
+	StubDevice8 *pStub = nullptr;
+	m_IDirect3DDevice8 *pDevice = nullptr;
+	std::vector<RESOURCE> Resources;
+	std::vector<BYTE> Scratch;
+};
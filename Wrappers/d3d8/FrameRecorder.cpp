@@ -0,0 +1,137 @@
+/**
+* Copyright (C) 2024 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "d3d8wrapper.h"
+#include "FrameRecorder.h"
+#include <shlwapi.h>
+#include <chrono>
+#include <ctime>
+
+FrameRecorder FrameTimeRecorder;
+
+void FrameRecorder::Enable()
+{
+	if (Enabled)
+	{
+		return;
+	}
+
+	// Allocate the full ring up front so recording never allocates
+	Records.resize(MaxRecords);
+	Head = 0;
+	Count = 0;
+	InFrame = false;
+	Current = {};
+	Enabled = true;
+
+	Logging::Log() << __FUNCTION__ << " Frame time recorder enabled, capacity: " << MaxRecords << " frames";
+}
+
+void FrameRecorder::OnBeginScene(int64_t NowNs)
+{
+	if (Enabled && !InFrame)
+	{
+		InFrame = true;
+		SceneStartNs = NowNs;
+	}
+}
+
+void FrameRecorder::OnPresent(int64_t PresentStartNs, int64_t PresentEndNs, int64_t LimiterEndNs, uint32_t RoomID, uint32_t CutsceneID)
+{
+	if (!Enabled)
+	{
+		return;
+	}
+
+	Current.Frame = FrameCount++;
+	Current.TimeNs = PresentStartNs;
+	Current.SceneMs = InFrame ? (PresentStartNs - SceneStartNs) / 1000000.0f : 0.0f;
+	Current.PresentMs = (PresentEndNs - PresentStartNs) / 1000000.0f;
+	Current.LimiterMs = (LimiterEndNs - PresentEndNs) / 1000000.0f;
+	Current.RoomID = RoomID;
+	Current.CutsceneID = CutsceneID;
+
+	// Overwrite the oldest record once the ring is full
+	Records[(Head + Count) % MaxRecords] = Current;
+	if (Count < MaxRecords)
+	{
+		Count++;
+	}
+	else
+	{
+		Head = (Head + 1) % MaxRecords;
+	}
+
+	InFrame = false;
+	Current = {};
+}
+
+bool FrameRecorder::Dump()
+{
+	DumpRequested = false;
+
+	if (!Enabled || !Count)
+	{
+		return false;
+	}
+
+	// Get current time and date
+	const std::time_t t = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+	tm tm; localtime_s(&tm, &t);
+
+	char timestamp[21];
+	sprintf_s(timestamp, " %.4d-%.2d-%.2d %.2d-%.2d-%.2d", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec);
+	std::string name("FrameTimes" + std::string(timestamp) + ".csv");
+
+	// Get Silent Hill 2 folder
+	wchar_t path[MAX_PATH] = {};
+	bool ret = GetSH2FolderPath(path, MAX_PATH);
+	wchar_t* pdest = wcsrchr(path, '\\');
+	if (ret && pdest)
+	{
+		*pdest = '\0';
+		wcscat_s(path, MAX_PATH, L"\\frametimes\\");
+		if (!PathFileExists(path))
+		{
+			CreateDirectory(path, nullptr);
+		}
+	}
+	std::wstring filename(path + std::wstring(name.begin(), name.end()));
+
+	FILE *file = nullptr;
+	if (_wfopen_s(&file, filename.c_str(), L"w") != 0 || !file)
+	{
+		Logging::Log() << __FUNCTION__ << " Error: Failed to create frame time file!";
+		return false;
+	}
+
+	Logging::Log() << "Saving " << Count << " frame times to " << filename.c_str() << " ...";
+
+	fprintf(file, "frame,time_ms,scene_ms,present_ms,limiter_ms,draw_calls,state_changes,room_id,cutscene_id\n");
+	const int64_t FirstNs = Records[Head].TimeNs;
+	for (size_t x = 0; x < Count; x++)
+	{
+		const FRAMERECORD& Record = Records[(Head + x) % MaxRecords];
+		fprintf(file, "%llu,%.3f,%.3f,%.3f,%.3f,%u,%u,0x%X,0x%X\n",
+			static_cast<unsigned long long>(Record.Frame), (Record.TimeNs - FirstNs) / 1000000.0,
+			Record.SceneMs, Record.PresentMs, Record.LimiterMs,
+			Record.DrawCalls, Record.StateChanges, Record.RoomID, Record.CutsceneID);
+	}
+
+	fclose(file);
+
+	return true;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <atomic>
+
+// Opt-in per frame timing recorder, records are kept in a preallocated ring and written out as CSV
+class FrameRecorder
+{
+public:
+	static constexpr size_t MaxRecords = 60 * 60 * 15;	// 15 minutes at 60 FPS
+
+	struct FRAMERECORD
+	{
+		uint64_t Frame;
+		int64_t TimeNs;
+		float SceneMs;			// First BeginScene to Present
+		float PresentMs;		// Present until the frame limiter
+		float LimiterMs;		// Frame limiter
+		uint32_t DrawCalls;
+		uint32_t StateChanges;
+		uint32_t RoomID;
+		uint32_t CutsceneID;
+	};
+
+	bool IsEnabled() const { return Enabled; }
+	void Enable();
+
+	void OnBeginScene(int64_t NowNs);
+	void OnDraw() { if (Enabled) { Current.DrawCalls++; } }
+	void OnStateChange() { if (Enabled) { Current.StateChanges++; } }
+	void OnPresent(int64_t PresentStartNs, int64_t PresentEndNs, int64_t LimiterEndNs, uint32_t RoomID, uint32_t CutsceneID);
+
+	void RequestDump() { DumpRequested = true; }
+	bool IsDumpRequested() const { return DumpRequested; }
+	bool Dump();
+
+private:
+	bool Enabled = false;
+	std::atomic<bool> DumpRequested { false };
+	bool InFrame = false;
+	int64_t SceneStartNs = 0;
+	uint64_t FrameCount = 0;
+	FRAMERECORD Current = {};
+
+	std::vector<FRAMERECORD> Records;
+	size_t Head = 0;
+	size_t Count = 0;
+};
+
+extern FrameRecorder FrameTimeRecorder;
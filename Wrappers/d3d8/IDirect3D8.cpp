@@ -32,6 +32,7 @@ bool SetSSAA = false;
 bool SetATOC = false;
 bool IsWindowShrunk = false;
 bool TakeScreenShot = false;
+bool ToggleScreenShotBurst = false;
 D3DMULTISAMPLE_TYPE DeviceMultiSampleType = D3DMULTISAMPLE_NONE;
 
 HRESULT m_IDirect3D8::QueryInterface(REFIID riid, LPVOID *ppvObj)
@@ -330,6 +331,12 @@ HRESULT m_IDirect3D8::CreateDevice(UINT Adapter, D3DDEVTYPE DeviceType, HWND hFo
 		RUNCODEONCE(CreateThread(nullptr, 0, SaveScreenshotFile, nullptr, 0, nullptr));
 	}
 
+	// Start recording frame times
+	if (EnableFrameTimeRecorder)
+	{
+		FrameTimeRecorder.Enable();
+	}
+
 	GameWindowHandle = DeviceWindow;
 
 	return hr;
@@ -703,7 +710,25 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
 	case WM_KEYUP:
 		if (wParam == VK_SNAPSHOT && EnableScreenshots)
 		{
-			TakeScreenShot = true;
+			if (GetKeyState(VK_SHIFT) & 0x8000)
+			{
+				ToggleScreenShotBurst = true;
+			}
+			else
+			{
+				TakeScreenShot = true;
+			}
+		}
+		else if (wParam == VK_F11 && (GetKeyState(VK_CONTROL) & 0x8000) && EnableFrameTimeRecorder)
+		{
+			FrameTimeRecorder.RequestDump();
+		}
+		break;
+	case WM_SYSKEYUP:
+		// F10 is a system key, so it never arrives as WM_KEYUP
+		if (wParam == VK_F10 && (GetKeyState(VK_CONTROL) & 0x8000) && EnableCallRecorder)
+		{
+			DeviceCallRecorder.RequestCapture();
 		}
 		break;
 	case WM_MOVE:
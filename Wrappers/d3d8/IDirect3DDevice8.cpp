@@ -19,10 +19,13 @@
 #include <shlwapi.h>
 #include <chrono>
 #include <array>
-#include <deque>
 #include <ctime>
 #include <numeric>
 #include "Common\Utils.h"
+#include "Common\FramePacer.h"
+#include "Common\FrameSlotPool.h"
+#include "Common\GfxUtils.h"
+#include "Common\ImageEncoder.h"
 #include "stb_image.h"
 #include "stb_image_dds.h"
 #include "stb_image_write.h"
@@ -139,20 +142,14 @@ bool TextureSet = false;
 DWORD TextureNum = 0;
 Overlay OverlayRef;
 double AverageFPSCounter = 0.0;
+FrameTimeStats FrameStats;
+FramePacer FrameLimiter;
 
-struct SCREENSHOTSTRUCT
-{
-	bool Enabled = false;
-	std::vector<BYTE> buffer;
-	std::vector<BYTE> bufferRaw;
-	std::wstring filename;
-	DWORD size = 0;
-	INT Pitch = 0;
-	LONG Width = 0;
-	LONG Height = 0;
-};
-
-std::vector<SCREENSHOTSTRUCT> ScreenshotVector;
+// Preallocated frames handed from the render thread to the screenshot thread, bounded to keep memory use in check
+// Single screenshots keep a couple of frames, bursts grow the pool up to the budget until their last frame is read back
+constexpr size_t ScreenshotPoolBudget = 128 * 1024 * 1024;
+constexpr uint32_t ScreenshotPoolSlots = 2;
+FrameSlotPool ScreenshotPool(ScreenshotPoolBudget);
 
 std::vector<IDirect3DTexture8*> RenderTextureVector;
 
@@ -204,6 +201,16 @@ HRESULT m_IDirect3DDevice8::Reset(D3DPRESENT_PARAMETERS *pPresentationParameters
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	ProxyAddressLookupTableD3d8->LogPoolStats(__FUNCTION__);
+
+	GfxLogTextureCacheStats();
+
+	InvalidateFrameState();
+
+	// Frame deadlines and frame times from before the mode change do not carry over to the new one
+	FrameLimiter.Reset();
+	FrameStats.Reset();
+
 	DeviceLost = false;
 
 	isInScene = false;
@@ -220,6 +227,10 @@ HRESULT m_IDirect3DDevice8::Reset(D3DPRESENT_PARAMETERS *pPresentationParameters
 
 	UseFrontBufferControl = FrontBufferControl;
 
+	// Finish pending screenshots before the default pool surfaces are lost
+	ProcessScreenShotReadback(true);
+	ReleaseScreenShotReadback();
+
 	if (pAutoRenderTarget)
 	{
 		ProxyInterface->SetRenderTarget(pAutoRenderTarget, nullptr);
@@ -409,6 +420,11 @@ HRESULT m_IDirect3DDevice8::EndScene()
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.Record(CallRecorder::CALL_ENDSCENE, {});
+	}
+
 	// Removes James' weapon during cutscenes (needs to run in EndSecene before skipping the scene)
 	if (CutsceneUnequip)
 	{
@@ -588,7 +604,11 @@ HRESULT m_IDirect3DDevice8::CreateDepthStencilSurface(THIS_ UINT Width, UINT Hei
 
 	if (SUCCEEDED(hr) && ppSurface)
 	{
-		*ppSurface = new m_IDirect3DSurface8(*ppSurface, this);
+		*ppSurface = ProxyAddressLookupTableD3d8->CreateInterface<m_IDirect3DSurface8>(*ppSurface);
+		if (DeviceCallRecorder.IsRecording())
+		{
+			DeviceCallRecorder.OnCreate(CallRecorder::CALL_CREATESURFACE, *ppSurface, { Width, Height, static_cast<uint32_t>(Format), D3DUSAGE_DEPTHSTENCIL });
+		}
 	}
 
 	if (FAILED(hr))
@@ -607,7 +627,11 @@ HRESULT m_IDirect3DDevice8::CreateIndexBuffer(THIS_ UINT Length, DWORD Usage, D3
 
 	if (SUCCEEDED(hr) && ppIndexBuffer)
 	{
-		*ppIndexBuffer = new m_IDirect3DIndexBuffer8(*ppIndexBuffer, this);
+		*ppIndexBuffer = ProxyAddressLookupTableD3d8->CreateInterface<m_IDirect3DIndexBuffer8>(*ppIndexBuffer);
+		if (DeviceCallRecorder.IsRecording())
+		{
+			DeviceCallRecorder.OnCreate(CallRecorder::CALL_CREATEINDEXBUFFER, *ppIndexBuffer, { Length, Usage, static_cast<uint32_t>(Format), static_cast<uint32_t>(Pool) });
+		}
 	}
 
 	if (FAILED(hr))
@@ -632,7 +656,11 @@ HRESULT m_IDirect3DDevice8::CreateRenderTarget(THIS_ UINT Width, UINT Height, D3
 
 	if (SUCCEEDED(hr) && ppSurface)
 	{
-		*ppSurface = new m_IDirect3DSurface8(*ppSurface, this);
+		*ppSurface = ProxyAddressLookupTableD3d8->CreateInterface<m_IDirect3DSurface8>(*ppSurface);
+		if (DeviceCallRecorder.IsRecording())
+		{
+			DeviceCallRecorder.OnCreate(CallRecorder::CALL_CREATESURFACE, *ppSurface, { Width, Height, static_cast<uint32_t>(Format), D3DUSAGE_RENDERTARGET });
+		}
 		if (IsScaledResolutionsEnabled())
 		{
 			(*ppSurface)->QueryInterface(IID_SetSurfaceOfTexture, nullptr);
@@ -663,7 +691,11 @@ HRESULT m_IDirect3DDevice8::CreateTexture(THIS_ UINT Width, UINT Height, UINT Le
 	if (SUCCEEDED(hr) && ppTexture)
 	{
 		IDirect3DTexture8 *pCreatedTexture = *ppTexture;
-		*ppTexture = new m_IDirect3DTexture8(*ppTexture, this);
+		*ppTexture = ProxyAddressLookupTableD3d8->CreateInterface<m_IDirect3DTexture8>(*ppTexture);
+		if (DeviceCallRecorder.IsRecording())
+		{
+			DeviceCallRecorder.OnCreate(CallRecorder::CALL_CREATETEXTURE, *ppTexture, { Width, Height, Levels, Usage, static_cast<uint32_t>(Format), static_cast<uint32_t>(Pool) });
+		}
 
 		if (!pInitialRenderTexture && Usage == D3DUSAGE_RENDERTARGET && Width == (UINT)BufferWidth && Height == (UINT)BufferHeight)
 		{
@@ -743,7 +775,11 @@ HRESULT m_IDirect3DDevice8::CreateVertexBuffer(THIS_ UINT Length, DWORD Usage, D
 
 	if (SUCCEEDED(hr) && ppVertexBuffer)
 	{
-		*ppVertexBuffer = new m_IDirect3DVertexBuffer8(*ppVertexBuffer, this);
+		*ppVertexBuffer = ProxyAddressLookupTableD3d8->CreateInterface<m_IDirect3DVertexBuffer8>(*ppVertexBuffer);
+		if (DeviceCallRecorder.IsRecording())
+		{
+			DeviceCallRecorder.OnCreate(CallRecorder::CALL_CREATEVERTEXBUFFER, *ppVertexBuffer, { Length, Usage, FVF, static_cast<uint32_t>(Pool) });
+		}
 	}
 
 	if (FAILED(hr))
@@ -784,6 +820,8 @@ HRESULT m_IDirect3DDevice8::CreateStateBlock(THIS_ D3DSTATEBLOCKTYPE Type, DWORD
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	InvalidateFrameState();
+
 	return ProxyInterface->CreateStateBlock(Type, pToken);
 }
 
@@ -791,6 +829,8 @@ HRESULT m_IDirect3DDevice8::ApplyStateBlock(THIS_ DWORD Token)
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	InvalidateFrameState();
+
 	return ProxyInterface->ApplyStateBlock(Token);
 }
 
@@ -879,6 +919,13 @@ HRESULT m_IDirect3DDevice8::SetRenderState(D3DRENDERSTATETYPE State, DWORD Value
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.Record(CallRecorder::CALL_SETRENDERSTATE, { static_cast<uint32_t>(State), Value });
+	}
+
+	FrameTimeRecorder.OnStateChange();
+
 	// Fix for 2D Fog, light switches, pictures and glow around the flashlight lens
 	if (d3d8to9 && State == D3DRS_ZBIAS)
 	{
@@ -889,30 +936,30 @@ HRESULT m_IDirect3DDevice8::SetRenderState(D3DRENDERSTATETYPE State, DWORD Value
 	if (EnableXboxShadows && State == D3DRS_STENCILPASS && Value == D3DSTENCILOP_REPLACE)
 	{
 		// Special handling for room 54
-		if (GetCutsceneID() == CS_HTL_ALT_RPT_BOSS_INTRO && (IsEnabledForCutscene54 || GetCutscenePos() == -19521.60742f))
+		if (GetFrameState().CutsceneID == CS_HTL_ALT_RPT_BOSS_INTRO && (IsEnabledForCutscene54 || GetFrameState().CutscenePos == -19521.60742f))
 		{
 			IsEnabledForCutscene54 = true;
 			Value = D3DSTENCILOP_ZERO; // Restore self shadows
 		}
 		// Main scenario
-		else if (GetChapterID() == CHAPTER_MAIN_SCENARIO)
+		else if (GetFrameState().ChapterID == CHAPTER_MAIN_SCENARIO)
 		{
 			IsEnabledForCutscene54 = false;
-			if (GetCutsceneID() == CS_HTL_LAURA_PIANO || (GetSpecializedLight1() != 0x01 && GetSpecializedLight2() != 0x01))	// Exclude specialized lighting zone unless in specific cutscene
+			if (GetFrameState().CutsceneID == CS_HTL_LAURA_PIANO || (GetFrameState().SpecializedLight1 != 0x01 && GetFrameState().SpecializedLight2 != 0x01))	// Exclude specialized lighting zone unless in specific cutscene
 			{
-				if (GetRoomID() != R_HTL_RM_202_204) // Exclude Hotel Room 202-204 completely from restored self shadows
+				if (GetFrameState().RoomID != R_HTL_RM_202_204) // Exclude Hotel Room 202-204 completely from restored self shadows
 				{
 					Value = D3DSTENCILOP_ZERO; // Restore self shadows
 				}
 			}
 		}
 		// Born From a Wish chapter
-		else if (GetChapterID() == CHAPTER_BORN_FROM_A_WISH)
+		else if (GetFrameState().ChapterID == CHAPTER_BORN_FROM_A_WISH)
 		{
 			IsEnabledForCutscene54 = false;
-			if (GetSpecializedLight1() != 0x01) // If not in a specialized lighting zone
+			if (GetFrameState().SpecializedLight1 != 0x01) // If not in a specialized lighting zone
 			{
-				if (GetRoomID() != R_APT_W_STAIRCASE_S && GetRoomID() != R_APT_W_HALLWAY_1F && GetRoomID() != R_APT_W_HALLWAY_2F) // Exclude Blue Creek hallways/staircase completely from restored self shadows
+				if (GetFrameState().RoomID != R_APT_W_STAIRCASE_S && GetFrameState().RoomID != R_APT_W_HALLWAY_1F && GetFrameState().RoomID != R_APT_W_HALLWAY_2F) // Exclude Blue Creek hallways/staircase completely from restored self shadows
 				{
 					Value = D3DSTENCILOP_ZERO; // Restore self shadows
 				}
@@ -943,6 +990,11 @@ HRESULT m_IDirect3DDevice8::SetRenderTarget(THIS_ IDirect3DSurface8* pRenderTarg
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.Record(CallRecorder::CALL_SETRENDERTARGET, { DeviceCallRecorder.GetResourceId(pRenderTarget), DeviceCallRecorder.GetResourceId(pNewZStencil) });
+	}
+
 	// Check if surface should be copied
 	if (ReplacedLastRenderTarget)
 	{
@@ -1015,6 +1067,13 @@ HRESULT m_IDirect3DDevice8::SetTransform(D3DTRANSFORMSTATETYPE State, CONST D3DM
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.RecordWithHash(CallRecorder::CALL_SETTRANSFORM, { static_cast<uint32_t>(State) }, pMatrix, sizeof(D3DMATRIX));
+	}
+
+	FrameTimeRecorder.OnStateChange();
+
 	return ProxyInterface->SetTransform(State, pMatrix);
 }
 
@@ -1100,6 +1159,13 @@ HRESULT m_IDirect3DDevice8::SetIndices(THIS_ IDirect3DIndexBuffer8* pIndexData,
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.Record(CallRecorder::CALL_SETINDICES, { DeviceCallRecorder.GetResourceId(pIndexData), BaseVertexIndex });
+	}
+
+	FrameTimeRecorder.OnStateChange();
+
 	if (pIndexData)
 	{
 		pIndexData = static_cast<m_IDirect3DIndexBuffer8 *>(pIndexData)->GetProxyInterface();
@@ -1178,6 +1244,8 @@ HRESULT m_IDirect3DDevice8::LightEnable(DWORD LightIndex, BOOL bEnable)
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	FrameTimeRecorder.OnStateChange();
+
 	return ProxyInterface->LightEnable(LightIndex, bEnable);
 }
 
@@ -1185,6 +1253,8 @@ HRESULT m_IDirect3DDevice8::SetLight(DWORD Index, CONST D3DLIGHT8 *pLight)
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	FrameTimeRecorder.OnStateChange();
+
 	return ProxyInterface->SetLight(Index, pLight);
 }
 
@@ -1192,6 +1262,8 @@ HRESULT m_IDirect3DDevice8::SetMaterial(CONST D3DMATERIAL8 *pMaterial)
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	FrameTimeRecorder.OnStateChange();
+
 	return ProxyInterface->SetMaterial(pMaterial);
 }
 
@@ -1199,6 +1271,8 @@ HRESULT m_IDirect3DDevice8::MultiplyTransform(D3DTRANSFORMSTATETYPE State, CONST
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	FrameTimeRecorder.OnStateChange();
+
 	return ProxyInterface->MultiplyTransform(State, pMatrix);
 }
 
@@ -1220,6 +1294,8 @@ HRESULT m_IDirect3DDevice8::TestCooperativeLevel()
 
 	if (DeviceLost)
 	{
+		InvalidateFrameState();
+
 		return D3DERR_DEVICENOTRESET;
 	}
 
@@ -1228,6 +1304,9 @@ HRESULT m_IDirect3DDevice8::TestCooperativeLevel()
 	if (hr == D3DERR_DEVICELOST || hr == D3DERR_DEVICENOTRESET)
 	{
 		DetectAltTab = true;
+
+		// The game keeps running its logic while the device is lost
+		InvalidateFrameState();
 	}
 
 	return hr;
@@ -1302,6 +1381,13 @@ HRESULT m_IDirect3DDevice8::SetPixelShader(THIS_ DWORD Handle)
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.Record(CallRecorder::CALL_SETPIXELSHADER, { Handle });
+	}
+
+	FrameTimeRecorder.OnStateChange();
+
 	return ProxyInterface->SetPixelShader(Handle);
 }
 
@@ -1321,53 +1407,24 @@ HRESULT m_IDirect3DDevice8::GetPixelShaderFunction(THIS_ DWORD Handle, void* pDa
 
 static void CalculateFPS()
 {
-	// Define a constant for the desired duration of FPS calculation
-	static const std::chrono::seconds FPS_CALCULATION_WINDOW(1);
-
-	// Store frame times in a deque
-	static std::deque<std::pair<std::chrono::steady_clock::time_point, std::chrono::duration<double>>> frameTimes;
-
-	// Store start time for PFS counter
-	static auto startTime = std::chrono::steady_clock::now();
+	static int64_t LastFrameNs = 0;
 
 	// Calculate frame time
-	auto endTime = std::chrono::steady_clock::now();
-	auto newstart = std::chrono::steady_clock::now();
-	std::chrono::duration<double> frameTime = endTime - startTime;
-	startTime = newstart;
-
-	// Store the frame time along with the time it occurred
-	frameTimes.emplace_back(endTime, frameTime);
-
-	// Remove frame times older than FPS_CALCULATION_WINDOW
-	while (!frameTimes.empty() && (endTime - frameTimes.front().first) > FPS_CALCULATION_WINDOW)
+	const int64_t NowNs = PacerClock::NowNs();
+	if (LastFrameNs)
 	{
-		frameTimes.pop_front();
+		FrameStats.AddFrame(NowNs, NowNs - LastFrameNs);
 	}
-
-	if (frameTimes.empty())
-	{
-		// No frame times available
-		return;
-	}
-
-	double totalTime = 0.0;
-	for (const auto& entry : frameTimes)
-	{
-		totalTime += entry.second.count();
-	}
-
-	// Calculate average frame time
-	double averageFrameTime = totalTime / frameTimes.size();
+	LastFrameNs = NowNs;
 
 	// Calculate FPS
-	if (averageFrameTime > 0.0)
+	if (FrameStats.GetFrameCount())
 	{
-		AverageFPSCounter = 1.0 / averageFrameTime;
+		AverageFPSCounter = FrameStats.GetFPS();
 	}
 
 	// Output FPS
-	Logging::LogDebug() << "Frames: " << frameTimes.size() << " Average time: " << averageFrameTime << " FPS: " << AverageFPSCounter;
+	Logging::LogDebug() << "Frames: " << FrameStats.GetFrameCount() << " Average time: " << FrameStats.GetMeanMs() << "ms FPS: " << AverageFPSCounter;
 }
 
 // repeats CUSTOMVERTEX_TEX1 layout
@@ -1632,48 +1689,22 @@ bool m_IDirect3DDevice8::FixPauseMenuOnPresent()
 
 void m_IDirect3DDevice8::LimitFrameRate()
 {
-	// Count the number of frames
-	Counter.FrameCounter++;
-
-	// Get performance frequency once
-	static const LARGE_INTEGER Frequency = [] {
-		LARGE_INTEGER freq = {};
-		QueryPerformanceFrequency(&freq);
-		return freq;
-		}();
-	static const LONGLONG TicksPerMS = Frequency.QuadPart / 1000;
-
-	// Calculate time per frame in ticks
-	static long double PerFrameFPS = LimitPerFrameFPS;
-	static LONGLONG PerFrameTicks = static_cast<LONGLONG>(static_cast<long double>(Frequency.QuadPart) / PerFrameFPS);
-
-	// Get current time
-	LARGE_INTEGER ClickTime = {};
-	QueryPerformanceCounter(&ClickTime);
-
-	LONGLONG TargetEndTicks = Counter.LastPresentTime.QuadPart + PerFrameTicks;
-
-	// First frame or if we fell behind, reset base time
-	if (Counter.LastPresentTime.QuadPart == 0 || ClickTime.QuadPart >= TargetEndTicks)
+	// Sleep for most of the frame and spin only for the calibrated margin
+	if (FrameLimiter.WaitForNextFrame(LimitPerFrameFPS))
 	{
-		Counter.LastPresentTime.QuadPart = ClickTime.QuadPart;
-		return;
-	}
-
-	// Wait until target time
-	while (true)
-	{
-		QueryPerformanceCounter(&ClickTime);
-		LONGLONG RemainingTicks = TargetEndTicks - ClickTime.QuadPart;
-
-		if (RemainingTicks <= 0) break;
-
-		// Busy wait until we reach the target time
-		BusyWaitYield(static_cast<DWORD>(RemainingTicks / TicksPerMS));
+		Logging::LogDebug() << __FUNCTION__ << " Missed frame deadline! Total: " << FrameLimiter.GetMissedDeadlines();
 	}
+}
 
-	// Store target time for next frame
-	Counter.LastPresentTime.QuadPart = TargetEndTicks;
+void m_IDirect3DDevice8::UpdateFrameState()
+{
+	FrameState.RoomID = GetRoomID();
+	FrameState.CutsceneID = GetCutsceneID();
+	FrameState.CutscenePos = GetCutscenePos();
+	FrameState.ChapterID = GetChapterID();
+	FrameState.SpecializedLight1 = GetSpecializedLight1();
+	FrameState.SpecializedLight2 = GetSpecializedLight2();
+	FrameState.Valid = true;
 }
 
 HRESULT m_IDirect3DDevice8::Present(CONST RECT* pSourceRect, CONST RECT* pDestRect, HWND hDestWindowOverride, CONST RGNDATA* pDirtyRegion)
@@ -1686,6 +1717,8 @@ HRESULT m_IDirect3DDevice8::Present(CONST RECT* pSourceRect, CONST RECT* pDestRe
 		return D3D_OK;
 	}
 
+	const int64_t PresentStartNs = FrameTimeRecorder.IsEnabled() ? PacerClock::NowNs() : 0;
+
 	// Disable antialiasing before present
 	DisableAntiAliasing();
 
@@ -1772,25 +1805,76 @@ HRESULT m_IDirect3DDevice8::Present(CONST RECT* pSourceRect, CONST RECT* pDestRe
 
 		if (SUCCEEDED(hr))
 		{
+			const int64_t PresentEndNs = FrameTimeRecorder.IsEnabled() ? PacerClock::NowNs() : 0;
+
 			if (LimitPerFrameFPS && ScreenMode != EXCLUSIVE_FULLSCREEN)
 			{
 				LimitFrameRate();
 			}
 
 			CalculateFPS();
+
+			// Record frame times
+			if (FrameTimeRecorder.IsEnabled())
+			{
+				FrameTimeRecorder.OnPresent(PresentStartNs, PresentEndNs, PacerClock::NowNs(), GetRoomID(), GetCutsceneID());
+
+				if (FrameTimeRecorder.IsDumpRequested())
+				{
+					FrameTimeRecorder.Dump();
+				}
+			}
+
+			// Record device calls
+			if (EnableCallRecorder)
+			{
+				DeviceCallRecorder.OnPresent();
+			}
 		}
 	}
 
+	// Upload textures finished by the loader threads
+	GfxPumpTextureLoads();
+
+	// Read back screenshots captured in earlier frames
+	ProcessScreenShotReadback();
+
+	// Start or stop burst capture
+	if (ToggleScreenShotBurst)
+	{
+		ToggleScreenShotBurst = false;
+		if (ScreenshotBurst.Active)
+		{
+			StopScreenShotBurst();
+		}
+		else
+		{
+			StartScreenShotBurst();
+		}
+	}
+	const bool TakeBurstFrame = ScreenshotBurst.Active && (ScreenshotBurst.FrameCounter++ % max(1, ScreenshotBurstInterval)) == 0;
+
 	// Take screenshot
-	if (TakeScreenShot)
+	if (TakeScreenShot || TakeBurstFrame)
 	{
 		if (!isInScene)
 		{
 			isInScene = true;
 			ProxyInterface->BeginScene();
 		}
-		TakeScreenShot = false;
-		CaptureScreenShot();
+		if (TakeScreenShot)
+		{
+			TakeScreenShot = false;
+			CaptureScreenShot();
+		}
+		if (TakeBurstFrame)
+		{
+			CaptureScreenShot(true);
+			if (ScreenshotBurst.FrameIndex >= (DWORD)ScreenshotBurstLength)
+			{
+				StopScreenShotBurst();
+			}
+		}
 	}
 
 	// Fix inventory snapshot in Hotel Employee Elevator Room
@@ -1838,6 +1922,9 @@ HRESULT m_IDirect3DDevice8::Present(CONST RECT* pSourceRect, CONST RECT* pDestRe
 	EndSceneCounter = 0;
 	PresentFlag = false;
 
+	// Game logic runs between frames so the snapshot is stale after present
+	InvalidateFrameState();
+
 	return hr;
 }
 
@@ -1845,6 +1932,13 @@ HRESULT m_IDirect3DDevice8::DrawIndexedPrimitive(THIS_ D3DPRIMITIVETYPE Type, UI
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.Record(CallRecorder::CALL_DRAWINDEXEDPRIMITIVE, { static_cast<uint32_t>(Type), MinVertexIndex, NumVertices, startIndex, primCount });
+	}
+
+	FrameTimeRecorder.OnDraw();
+
 	IsDrawCalled = true;
 
 	// Drawing opaque map geometry and dynamic objects
@@ -1866,7 +1960,7 @@ HRESULT m_IDirect3DDevice8::DrawIndexedPrimitive(THIS_ D3DPRIMITIVETYPE Type, UI
 	}
 
 	// Exclude Woodside Room 208 TV static geometry from receiving shadows
-	if (EnableSoftShadows && GetRoomID() == R_APT_E_RM_208 && GetModelID() == ModelID::chr_item_noa)
+	if (EnableSoftShadows && GetFrameState().RoomID == R_APT_E_RM_208 && GetModelID() == ModelID::chr_item_noa)
 	{
 		DWORD stencilPass = 0;
 		ProxyInterface->GetRenderState(D3DRS_STENCILPASS, &stencilPass);
@@ -1881,9 +1975,9 @@ HRESULT m_IDirect3DDevice8::DrawIndexedPrimitive(THIS_ D3DPRIMITIVETYPE Type, UI
 	}
 	// Exclude windows in Heaven's Night, Hotel 2F Room Hallway and Hotel Storeroom from receiving shadows
 	else if (EnableSoftShadows &&
-		((GetRoomID() == R_HEAVENS_NIGHT_BACK && Type == D3DPT_TRIANGLESTRIP && MinVertexIndex == 0 && NumVertices == 18 && startIndex == 0 && primCount == 21) ||
-		(GetRoomID() == R_HTL_W_ROOM_HALL_2F && Type == D3DPT_TRIANGLESTRIP && MinVertexIndex == 0 && NumVertices == 10 && startIndex == 0 && primCount == 10) ||
-		(GetRoomID() == R_HTL_STORE_RM_1F && Type == D3DPT_TRIANGLESTRIP && MinVertexIndex == 0 && NumVertices == 8 && startIndex == 0 && primCount == 8)))
+		((GetFrameState().RoomID == R_HEAVENS_NIGHT_BACK && Type == D3DPT_TRIANGLESTRIP && MinVertexIndex == 0 && NumVertices == 18 && startIndex == 0 && primCount == 21) ||
+		(GetFrameState().RoomID == R_HTL_W_ROOM_HALL_2F && Type == D3DPT_TRIANGLESTRIP && MinVertexIndex == 0 && NumVertices == 10 && startIndex == 0 && primCount == 10) ||
+		(GetFrameState().RoomID == R_HTL_STORE_RM_1F && Type == D3DPT_TRIANGLESTRIP && MinVertexIndex == 0 && NumVertices == 8 && startIndex == 0 && primCount == 8)))
 	{
 		DWORD stencilPass, stencilRef = 0;
 
@@ -1904,7 +1998,7 @@ HRESULT m_IDirect3DDevice8::DrawIndexedPrimitive(THIS_ D3DPRIMITIVETYPE Type, UI
 		return hr;
 	}
 	// Exclude refrigerator interior in hospital from receiving shadows
-	else if (EnableSoftShadows && GetRoomID() == R_HSP_ALT_DAY_ROOM && Type == D3DPT_TRIANGLESTRIP && MinVertexIndex == 0 && NumVertices == 1037 && startIndex == 0 && primCount == 1580)
+	else if (EnableSoftShadows && GetFrameState().RoomID == R_HSP_ALT_DAY_ROOM && Type == D3DPT_TRIANGLESTRIP && MinVertexIndex == 0 && NumVertices == 1037 && startIndex == 0 && primCount == 1580)
 	{
 		DWORD stencilPass = 0;
 
@@ -1945,7 +2039,7 @@ HRESULT m_IDirect3DDevice8::DrawIndexedPrimitive(THIS_ D3DPRIMITIVETYPE Type, UI
 	if (EnemyRevealLighting)
 	{
 		// Darken the lying figure in the tunnel radio cutscene
-		if (GetCutsceneID() == CS_TUNNEL_RADIO && GetCutsceneTimer() < 705.5f && GetModelID() == ModelID::chr_scu_scu)
+		if (GetFrameState().CutsceneID == CS_TUNNEL_RADIO && GetCutsceneTimer() < 705.5f && GetModelID() == ModelID::chr_scu_scu)
 		{
 			constexpr float shaderConstants[][4] =
 			{
@@ -1959,7 +2053,7 @@ HRESULT m_IDirect3DDevice8::DrawIndexedPrimitive(THIS_ D3DPRIMITIVETYPE Type, UI
 		}
 
 		// Disable specular highlights for the mannequin in apartments room 205 before acquring the flashlight
-		if (GetRoomID() == R_APT_E_RM_205 && !GetFlashLightAcquired() && GetModelID() == ModelID::chr_mkn_mkn)
+		if (GetFrameState().RoomID == R_APT_E_RM_205 && !GetFlashLightAcquired() && GetModelID() == ModelID::chr_mkn_mkn)
 		{
 			constexpr float shaderConstants[] = { 0.0f, 0.0f, 0.0f, 0.0f }; // Specular, Game default: 0.4f, 0.4f, 0.4f, GARBAGE
 
@@ -1974,6 +2068,15 @@ HRESULT m_IDirect3DDevice8::DrawIndexedPrimitiveUP(D3DPRIMITIVETYPE PrimitiveTyp
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.RecordWithHash(CallRecorder::CALL_DRAWINDEXEDPRIMITIVEUP, { static_cast<uint32_t>(PrimitiveType), MinIndex, NumVertices, PrimitiveCount, static_cast<uint32_t>(IndexDataFormat), VertexStreamZeroStride },
+			pIndexData, CallRecorder::GetVertexCount(PrimitiveType, PrimitiveCount) * (IndexDataFormat == D3DFMT_INDEX32 ? 4 : 2),
+			pVertexStreamZeroData, (MinIndex + NumVertices) * VertexStreamZeroStride);
+	}
+
+	FrameTimeRecorder.OnDraw();
+
 	IsDrawCalled = true;
 
 	return ProxyInterface->DrawIndexedPrimitiveUP(PrimitiveType, MinIndex, NumVertices, PrimitiveCount, pIndexData, IndexDataFormat, pVertexStreamZeroData, VertexStreamZeroStride);
@@ -1983,19 +2086,26 @@ HRESULT m_IDirect3DDevice8::DrawPrimitive(D3DPRIMITIVETYPE PrimitiveType, UINT S
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.Record(CallRecorder::CALL_DRAWPRIMITIVE, { static_cast<uint32_t>(PrimitiveType), StartVertex, PrimitiveCount });
+	}
+
+	FrameTimeRecorder.OnDraw();
+
 	IsDrawCalled = true;
 
 	// Set pillar boxes to black (removes game images from pillars)
-	if (LastFrameFullscreenImage && !IsInFullscreenImage && GetRoomID() != R_NONE && GetCutsceneID() == CS_NONE)
+	if (LastFrameFullscreenImage && !IsInFullscreenImage && GetFrameState().RoomID != R_NONE && GetFrameState().CutsceneID == CS_NONE)
 	{
-		if (GetRoomID() == R_TOWN_WEST)
+		if (GetFrameState().RoomID == R_TOWN_WEST)
 		{
 			DontModifyClear = true;
 		}
 		return ProxyInterface->Clear(0x00, nullptr, D3DCLEAR_TARGET | D3DCLEAR_STENCIL | D3DCLEAR_ZBUFFER, D3DCOLOR_ARGB(0xFF, 0x00, 0x00, 0x00), 1.0f, 0x80);
 	}
 	// Set pillar boxes to black (removes street decals from West Town fullscreen images)
-	else if (IsInFullscreenImage && PrimitiveType == D3DPT_TRIANGLESTRIP && PrimitiveCount == 2 && GetRoomID() == R_TOWN_WEST)
+	else if (IsInFullscreenImage && PrimitiveType == D3DPT_TRIANGLESTRIP && PrimitiveCount == 2 && GetFrameState().RoomID == R_TOWN_WEST)
 	{
 		return D3D_OK;
 	}
@@ -2009,12 +2119,12 @@ HRESULT m_IDirect3DDevice8::DrawPrimitive(D3DPRIMITIVETYPE PrimitiveType, UINT S
 	}
 
 	// Disable shadow on the Labyrinth Valve
-	if (EnableSoftShadows && GetCutsceneID() == CS_PS_HANDLE_TURN && PrimitiveType == D3DPT_TRIANGLELIST && PrimitiveCount > 496 && PrimitiveCount < 536)
+	if (EnableSoftShadows && GetFrameState().CutsceneID == CS_PS_HANDLE_TURN && PrimitiveType == D3DPT_TRIANGLELIST && PrimitiveCount > 496 && PrimitiveCount < 536)
 	{
 		return D3D_OK;
 	}
 	// Top Down Shadow
-	else if (EnableSoftShadows && ((GetRoomID() == R_OBSV_DECK || GetRoomID() == R_APT_W_RM_109_2 || GetRoomID() == R_EDI_BOSS_RM_1 || GetRoomID() == R_EDI_BOSS_RM_2) || GetCutsceneID() == CS_END_LEAVE_LETTER))
+	else if (EnableSoftShadows && ((GetFrameState().RoomID == R_OBSV_DECK || GetFrameState().RoomID == R_APT_W_RM_109_2 || GetFrameState().RoomID == R_EDI_BOSS_RM_1 || GetFrameState().RoomID == R_EDI_BOSS_RM_2) || GetFrameState().CutsceneID == CS_END_LEAVE_LETTER))
 	{
 		DWORD stencilPass = 0;
 		ProxyInterface->GetRenderState(D3DRS_STENCILPASS, &stencilPass);
@@ -2147,6 +2257,14 @@ HRESULT m_IDirect3DDevice8::DrawPrimitiveUP(D3DPRIMITIVETYPE PrimitiveType, UINT
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.RecordWithHash(CallRecorder::CALL_DRAWPRIMITIVEUP, { static_cast<uint32_t>(PrimitiveType), PrimitiveCount, VertexStreamZeroStride },
+			pVertexStreamZeroData, CallRecorder::GetVertexCount(PrimitiveType, PrimitiveCount) * VertexStreamZeroStride);
+	}
+
+	FrameTimeRecorder.OnDraw();
+
 	IsDrawCalled = true;
 
 	LastDrawPrimitiveUPStride += VertexStreamZeroStride;
@@ -2183,7 +2301,7 @@ HRESULT m_IDirect3DDevice8::DrawPrimitiveUP(D3DPRIMITIVETYPE PrimitiveType, UINT
 	}
 
 	// Fix bowling cutscene fading
-	if (GetCutsceneID() == CS_BOWL_LAURA_EDDIE && PrimitiveType == D3DPT_TRIANGLELIST && PrimitiveCount == 2 && VertexStreamZeroStride == 28 && pVertexStreamZeroData &&
+	if (GetFrameState().CutsceneID == CS_BOWL_LAURA_EDDIE && PrimitiveType == D3DPT_TRIANGLELIST && PrimitiveCount == 2 && VertexStreamZeroStride == 28 && pVertexStreamZeroData &&
 		((CUSTOMVERTEX_DIF_TEX1*)pVertexStreamZeroData)[0].z == 0.01f && ((CUSTOMVERTEX_DIF_TEX1*)pVertexStreamZeroData)[1].z == 0.01f && ((CUSTOMVERTEX_DIF_TEX1*)pVertexStreamZeroData)[2].z == 0.01f)
 	{
 		IsInFakeFadeout = true;
@@ -2214,7 +2332,7 @@ HRESULT m_IDirect3DDevice8::DrawPrimitiveUP(D3DPRIMITIVETYPE PrimitiveType, UINT
 			PillarBoxBottom = ((CUSTOMVERTEX_DIF_TEX1*)pVertexStreamZeroData)[2].y;
 		}
 		// Clip artifacts that protrude into pillarbox
-		else if (PillarBoxLeft && PillarBoxRight && GetRoomID() != R_NONE && GetCutsceneID() == CS_NONE && (GetEventIndex() == EVENT_IN_GAME || GetEventIndex() == EVENT_MAP))
+		else if (PillarBoxLeft && PillarBoxRight && GetFrameState().RoomID != R_NONE && GetFrameState().CutsceneID == CS_NONE && (GetEventIndex() == EVENT_IN_GAME || GetEventIndex() == EVENT_MAP))
 		{
 			// Clip green player marker
 			if (pVertexStreamZeroData && ((((CUSTOMVERTEX_DIF_TEX1*)pVertexStreamZeroData)[1].x != ((CUSTOMVERTEX_DIF_TEX1*)pVertexStreamZeroData)[2].x ||
@@ -2328,7 +2446,7 @@ HRESULT m_IDirect3DDevice8::DrawPrimitiveUP(D3DPRIMITIVETYPE PrimitiveType, UINT
 		IsInFullscreenImage = true;
 	}
 	// Set pillar boxes to black (removes fog from West Town fullscreen images)
-	else if (IsInFullscreenImage && PrimitiveType == D3DPT_TRIANGLEFAN && PrimitiveCount == 4 && VertexStreamZeroStride == 24 && GetRoomID() == R_TOWN_WEST)
+	else if (IsInFullscreenImage && PrimitiveType == D3DPT_TRIANGLEFAN && PrimitiveCount == 4 && VertexStreamZeroStride == 24 && GetFrameState().RoomID == R_TOWN_WEST)
 	{
 		return D3D_OK;
 	}
@@ -2573,6 +2691,14 @@ HRESULT m_IDirect3DDevice8::BeginScene()
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.Record(CallRecorder::CALL_BEGINSCENE, {});
+	}
+
+	// Take a fresh game state snapshot for this scene
+	UpdateFrameState();
+
 	if (EndSceneCounter == 0)
 	{
 		// Skip frames in specific cutscenes to prevent flickering
@@ -2581,6 +2707,11 @@ HRESULT m_IDirect3DDevice8::BeginScene()
 			return D3D_OK;
 		}
 
+		if (FrameTimeRecorder.IsEnabled())
+		{
+			FrameTimeRecorder.OnBeginScene(PacerClock::NowNs());
+		}
+
 		ClassReleaseFlag = false;
 		LastFrameFullscreenImage = IsInFullscreenImage;
 		IsInFullscreenImage = false;
@@ -2588,16 +2719,16 @@ HRESULT m_IDirect3DDevice8::BeginScene()
 		// Enable Xbox shadows
 		if (EnableSoftShadows)
 		{
-			EnableXboxShadows = !((GetRoomID() == R_OBSV_DECK || GetRoomID() == R_APT_W_RM_109_2 || GetRoomID() == R_EDI_BOSS_RM_1 || GetRoomID() == R_EDI_BOSS_RM_2) || GetCutsceneID() == CS_END_LEAVE_LETTER);
+			EnableXboxShadows = !((GetFrameState().RoomID == R_OBSV_DECK || GetFrameState().RoomID == R_APT_W_RM_109_2 || GetFrameState().RoomID == R_EDI_BOSS_RM_1 || GetFrameState().RoomID == R_EDI_BOSS_RM_2) || GetFrameState().CutsceneID == CS_END_LEAVE_LETTER);
 		}
 
 		// Fix cutscene James final blow to his wife
-		if (GetRoomID() == R_FINAL_BOSS_RM && GetGlobalFadeHoldValue() == 2.0f)
+		if (GetFrameState().RoomID == R_FINAL_BOSS_RM && GetGlobalFadeHoldValue() == 2.0f)
 		{
 			IsInFakeFadeout = true;
 		}
 		// Bowling cutscene fading
-		else if (IsInFakeFadeout && GetCutsceneID() != CS_BOWL_LAURA_EDDIE)
+		else if (IsInFakeFadeout && GetFrameState().CutsceneID != CS_BOWL_LAURA_EDDIE)
 		{
 			IsInFakeFadeout = false;
 		}
@@ -2810,6 +2941,13 @@ HRESULT m_IDirect3DDevice8::SetStreamSource(THIS_ UINT StreamNumber, IDirect3DVe
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.Record(CallRecorder::CALL_SETSTREAMSOURCE, { StreamNumber, DeviceCallRecorder.GetResourceId(pStreamData), Stride });
+	}
+
+	FrameTimeRecorder.OnStateChange();
+
 	if (pStreamData)
 	{
 		pStreamData = static_cast<m_IDirect3DVertexBuffer8 *>(pStreamData)->GetProxyInterface();
@@ -2906,6 +3044,13 @@ HRESULT m_IDirect3DDevice8::SetTexture(DWORD Stage, IDirect3DBaseTexture8 *pText
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.Record(CallRecorder::CALL_SETTEXTURE, { Stage, DeviceCallRecorder.GetResourceId(pTexture) });
+	}
+
+	FrameTimeRecorder.OnStateChange();
+
 	if (Stage == 0)
 	{
 		TextureNum = 0;
@@ -2956,6 +3101,13 @@ HRESULT m_IDirect3DDevice8::SetTextureStageState(DWORD Stage, D3DTEXTURESTAGESTA
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.Record(CallRecorder::CALL_SETTEXTURESTAGESTATE, { Stage, static_cast<uint32_t>(Type), Value });
+	}
+
+	FrameTimeRecorder.OnStateChange();
+
 	// Setup Anisotropy Filtering
 	if (AnisotropyFlag && (Type == D3DTSS_MAXANISOTROPY || ((Type == D3DTSS_MINFILTER || Type == D3DTSS_MAGFILTER) && Value == D3DTEXF_LINEAR)))
 	{
@@ -3097,6 +3249,8 @@ HRESULT m_IDirect3DDevice8::SetClipPlane(DWORD Index, CONST float *pPlane)
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	FrameTimeRecorder.OnStateChange();
+
 	return ProxyInterface->SetClipPlane(Index, pPlane);
 }
 
@@ -3104,6 +3258,11 @@ HRESULT m_IDirect3DDevice8::Clear(DWORD Count, CONST D3DRECT *pRects, DWORD Flag
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.Record(CallRecorder::CALL_CLEAR, { Count, Flags, Color, *reinterpret_cast<DWORD*>(&Z), Stencil });
+	}
+
 	// Change first Clear call to match Xbox version
 	if (EnableXboxShadows && Flags == (D3DCLEAR_TARGET | D3DCLEAR_STENCIL | D3DCLEAR_ZBUFFER) && Color == D3DCOLOR_ARGB(124, 0, 0, 0))
 	{
@@ -3130,6 +3289,14 @@ HRESULT m_IDirect3DDevice8::SetViewport(CONST D3DVIEWPORT8 *pViewport)
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording() && pViewport)
+	{
+		DeviceCallRecorder.Record(CallRecorder::CALL_SETVIEWPORT, { pViewport->X, pViewport->Y, pViewport->Width, pViewport->Height,
+			*reinterpret_cast<const DWORD*>(&pViewport->MinZ), *reinterpret_cast<const DWORD*>(&pViewport->MaxZ) });
+	}
+
+	FrameTimeRecorder.OnStateChange();
+
 	return ProxyInterface->SetViewport(pViewport);
 }
 
@@ -3211,6 +3378,13 @@ HRESULT m_IDirect3DDevice8::SetVertexShader(THIS_ DWORD Handle)
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.Record(CallRecorder::CALL_SETVERTEXSHADER, { Handle });
+	}
+
+	FrameTimeRecorder.OnStateChange();
+
 	return ProxyInterface->SetVertexShader(Handle);
 }
 
@@ -3239,6 +3413,13 @@ HRESULT m_IDirect3DDevice8::SetPixelShaderConstant(THIS_ DWORD Register, CONST v
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.RecordWithHash(CallRecorder::CALL_SETPIXELSHADERCONSTANT, { Register, ConstantCount }, pConstantData, ConstantCount * 4 * sizeof(float));
+	}
+
+	FrameTimeRecorder.OnStateChange();
+
 	// We want to skip the first call to SetPixelShaderConstant when fixing Specular highlights and only adjust the second
 	if (SpecularFix && SpecularFlag == 1)
 	{
@@ -3361,6 +3542,13 @@ HRESULT m_IDirect3DDevice8::SetVertexShaderConstant(THIS_ DWORD Register, CONST
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.RecordWithHash(CallRecorder::CALL_SETVERTEXSHADERCONSTANT, { Register, ConstantCount }, pConstantData, ConstantCount * 4 * sizeof(float));
+	}
+
+	FrameTimeRecorder.OnStateChange();
+
 	return ProxyInterface->SetVertexShaderConstant(Register, pConstantData, ConstantCount);
 }
 
@@ -3386,7 +3574,11 @@ HRESULT m_IDirect3DDevice8::CreateImageSurface(THIS_ UINT Width, UINT Height, D3
 
 	if (SUCCEEDED(hr) && ppSurface)
 	{
-		*ppSurface = new m_IDirect3DSurface8(*ppSurface, this);
+		*ppSurface = ProxyAddressLookupTableD3d8->CreateInterface<m_IDirect3DSurface8>(*ppSurface);
+		if (DeviceCallRecorder.IsRecording())
+		{
+			DeviceCallRecorder.OnCreate(CallRecorder::CALL_CREATESURFACE, *ppSurface, { Width, Height, static_cast<uint32_t>(Format), 0 });
+		}
 	}
 
 	if (FAILED(hr))
@@ -4476,72 +4668,193 @@ void m_IDirect3DDevice8::SetScaledBackbuffer()
 	Logging::Log() << "Silent Hill 2 display resolution set to: " << Desc.Width << "x" << Desc.Height;
 }
 
+// Returns the screenshot folder, creating it if needed
+static std::wstring GetScreenshotFolder()
+{
+	// Get Silent Hill 2 folder
+	wchar_t path[MAX_PATH] = {};
+	bool ret = GetSH2FolderPath(path, MAX_PATH);
+	wchar_t* pdest = wcsrchr(path, '\\');
+	if (ret && pdest)
+	{
+		*pdest = '\0';
+		wcscat_s(path, MAX_PATH, L"\\imgs\\");
+		if (!PathFileExists(path))
+		{
+			CreateDirectory(path, nullptr);
+		}
+	}
+	return path;
+}
+
+static std::wstring GetScreenshotTimestamp()
+{
+	// Get current time and date
+	const std::time_t t = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+	tm tm; localtime_s(&tm, &t);
+
+	wchar_t timestamp[21];
+	swprintf_s(timestamp, L" %.4d-%.2d-%.2d %.2d-%.2d-%.2d", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec);
+	return timestamp;
+}
+
+// Appends a line to the frames.csv file next to a burst frame
+static void WriteBurstMetadata(const FrameSlotPool::SLOT& Frame)
+{
+	const size_t pos = Frame.Path.find_last_of(L'\\');
+	const std::wstring csv(Frame.Path.substr(0, pos + 1) + L"frames.csv");
+	const bool NewFile = !PathFileExists(csv.c_str());
+
+	if (FILE *file; _wfopen_s(&file, csv.c_str(), L"a") == 0)
+	{
+		if (NewFile)
+		{
+			fprintf(file, "frame,time_ms,dropped_before,file\n");
+		}
+		fprintf(file, "%u,%.3f,%u,%ls\n", Frame.FrameIndex, Frame.TimeNs / 1000000.0, Frame.DroppedBefore, Frame.Path.c_str() + pos + 1);
+		fclose(file);
+	}
+}
+
 DWORD WINAPI SaveScreenshotFile(LPVOID)
 {
+	std::vector<BYTE> buffer;
+
 	// Wait for new screenshot
 	while (!m_StopThreadFlag)
 	{
-		if (ScreenshotVector.size() && ScreenshotVector[0].Enabled)
+		FrameSlotPool::SLOT *pFrame = ScreenshotPool.WaitReady(std::chrono::milliseconds(100));
+		if (!pFrame)
 		{
-			if (ScreenshotVector[0].filename.size() && ScreenshotVector[0].bufferRaw.size() && ScreenshotVector[0].Width && ScreenshotVector[0].Height)
-			{
-				ScreenshotVector[0].buffer.resize(ScreenshotVector[0].size);
-				BYTE *bufferIn = ScreenshotVector[0].bufferRaw.data();
-				BYTE *bufferOut = ScreenshotVector[0].buffer.data();
+			continue;
+		}
+		const FrameSlotPool::SLOT& Frame = *pFrame;
 
-				// Transcode buffer into RGB for image conversion
-				for (int y = 0; y < ScreenshotVector[0].Height; y++)
+		if (Frame.Path.size() && Frame.Data.size() && Frame.Width && Frame.Height)
+		{
+			// Encode image, burst frames always use QOI to keep up with the game
+			bool ret = false;
+			if (Frame.Burst || ScreenshotFormat == SCREENSHOT_QOI)
+			{
+				ret = ImageEncoder::EncodeQOI(Frame.Data.data(), Frame.Width, Frame.Height, Frame.Pitch, buffer);
+			}
+			else if (ScreenshotCompression <= ImageEncoder::PNG_BALANCED)
+			{
+				ret = ImageEncoder::EncodePNG(Frame.Data.data(), Frame.Width, Frame.Height, Frame.Pitch, ScreenshotCompression, buffer);
+			}
+			else
+			{
+				// Smallest files, single threaded and much slower
+				std::vector<BYTE> bufferRGBA(Frame.Width * Frame.Height * 4);
+				for (UINT y = 0; y < Frame.Height; y++)
 				{
-					for (int x = 0; x < ScreenshotVector[0].Width; x++)
-					{
-						DWORD loc = x * 4;
-						bufferOut[3] = 0xFF;				// Alpha - bufferIn[loc + 3];
-						bufferOut[0] = bufferIn[loc + 2];	// Red
-						bufferOut[1] = bufferIn[loc + 1];	// Green
-						bufferOut[2] = bufferIn[loc + 0];	// Blue
-						bufferOut += 4;
-					}
-					bufferIn += ScreenshotVector[0].Pitch;
+					ImageEncoder::SwizzleBGRAToRGBA(Frame.Data.data() + y * Frame.Pitch, bufferRGBA.data() + y * Frame.Width * 4, Frame.Width);
 				}
 
-				// Write PNG buffer to disk
-				if (FILE *file; _wfopen_s(&file, ScreenshotVector[0].filename.c_str(), L"wb") == 0)
+				const auto write_callback = [](void *context, void *data, int size) {
+					auto &out = *static_cast<std::vector<BYTE> *>(context);
+					out.insert(out.end(), static_cast<BYTE *>(data), static_cast<BYTE *>(data) + size);
+				};
+
+				buffer.clear();
+				stbi_write_png_compression_level = min(ScreenshotCompression, 9);
+				ret = stbi_write_png_to_func(write_callback, &buffer, Frame.Width, Frame.Height, 4, bufferRGBA.data(), 0) != 0;
+			}
+
+			// Write image buffer to disk
+			if (!ret)
+			{
+				LOG_LIMIT(3, __FUNCTION__ << " Error encoding screenshot!");
+			}
+			else if (FILE *file; _wfopen_s(&file, Frame.Path.c_str(), L"wb") == 0)
+			{
+				if (!Frame.Burst)
 				{
-					const auto write_callback = [](void *context, void *data, int size) {
-						fwrite(data, 1, size, static_cast<FILE *>(context));
-					};
+					Logging::Log() << "Saving screenshot to " << Frame.Path.c_str() << " ...";
+				}
 
-					Logging::Log() << "Saving screenshot to " << ScreenshotVector[0].filename.c_str() << " ...";
+				fwrite(buffer.data(), 1, buffer.size(), file);
 
-					stbi_write_png_to_func(write_callback, file, ScreenshotVector[0].Width, ScreenshotVector[0].Height, 4, ScreenshotVector[0].buffer.data(), 0);
+				fclose(file);
 
-					fclose(file);
-				}
-				else
+				if (Frame.Burst)
 				{
-					LOG_LIMIT(3, __FUNCTION__ << " Error creating screenshot file!");
+					WriteBurstMetadata(Frame);
 				}
 			}
 			else
 			{
-				LOG_LIMIT(3, __FUNCTION__ << " Error with data in screenshot vector!");
+				LOG_LIMIT(3, __FUNCTION__ << " Error creating screenshot file!");
 			}
-			// Remove item from vector
-			ScreenshotVector.erase(ScreenshotVector.begin());
 		}
-		Sleep(100);
+		else
+		{
+			LOG_LIMIT(3, __FUNCTION__ << " Error with data in screenshot pool!");
+		}
+
+		// Return frame to the pool
+		ScreenshotPool.Release(pFrame);
 	}
 
 	return S_OK;
 }
 
-void m_IDirect3DDevice8::CaptureScreenShot()
+void m_IDirect3DDevice8::StartScreenShotBurst()
+{
+	ScreenshotBurst.Folder = GetScreenshotFolder() + L"Burst" + GetScreenshotTimestamp() + L"\\";
+	if (!PathFileExists(ScreenshotBurst.Folder.c_str()))
+	{
+		CreateDirectory(ScreenshotBurst.Folder.c_str(), nullptr);
+	}
+
+	ScreenshotBurst.FrameCounter = 0;
+	ScreenshotBurst.FrameIndex = 0;
+	ScreenshotBurst.Dropped = 0;
+	ScreenshotBurst.StartNs = PacerClock::NowNs();
+	ScreenshotBurst.Active = true;
+
+	Logging::Log() << "Starting burst capture to " << ScreenshotBurst.Folder.c_str() << " every " << max(1, ScreenshotBurstInterval) << " frames, up to " << ScreenshotBurstLength << " frames ...";
+}
+
+void m_IDirect3DDevice8::StopScreenShotBurst()
+{
+	ScreenshotBurst.Active = false;
+
+	Logging::Log() << "Burst capture finished: " << ScreenshotBurst.FrameIndex - ScreenshotBurst.Dropped << " frames captured, " << ScreenshotBurst.Dropped << " dropped";
+}
+
+void m_IDirect3DDevice8::CaptureScreenShot(bool Burst)
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	const DWORD FrameIndex = Burst ? ScreenshotBurst.FrameIndex++ : 0;
+
+	// Find a free readback slot
+	SCREENSHOTREADBACK *pSlot = nullptr;
+	for (auto& Slot : ScreenshotReadback)
+	{
+		if (!Slot.Pending)
+		{
+			pSlot = &Slot;
+			break;
+		}
+	}
+	if (!pSlot)
+	{
+		if (Burst)
+		{
+			ScreenshotBurst.Dropped++;
+		}
+		else
+		{
+			LOG_LIMIT(3, __FUNCTION__ << " Screenshot readback is busy, skipping capture!");
+		}
+		return;
+	}
+
 	// Get BackBuffer
-	IDirect3DSurface8 *pDestSurface = nullptr;
-	if (FAILED(ProxyInterface->GetBackBuffer(0, D3DBACKBUFFER_TYPE_MONO, &pDestSurface)))
+	IDirect3DSurface8 *pBackBuffer = nullptr;
+	if (FAILED(ProxyInterface->GetBackBuffer(0, D3DBACKBUFFER_TYPE_MONO, &pBackBuffer)))
 	{
 		LOG_LIMIT(3, __FUNCTION__ << " Failed to get back buffer!");
 		return;
@@ -4549,70 +4862,134 @@ void m_IDirect3DDevice8::CaptureScreenShot()
 
 	// Get surface size
 	D3DSURFACE_DESC Desc = {};
-	if (FAILED(pDestSurface->GetDesc(&Desc)))
+	if (FAILED(pBackBuffer->GetDesc(&Desc)))
 	{
 		LOG_LIMIT(3, __FUNCTION__ << " Failed to get surface desc!");
-		pDestSurface->Release();
+		pBackBuffer->Release();
 		return;
 	}
 
-	// Lock surface, read it into a memory buffer and add it to a queue (vector)
-	D3DLOCKED_RECT LockedRect = {};
-	if (SUCCEEDED(pDestSurface->LockRect(&LockedRect, nullptr, D3DLOCK_READONLY)) && LockedRect.pBits)
+	// Recreate the copy surfaces if the back buffer changed
+	if (pSlot->pCopySurface && (pSlot->Desc.Width != Desc.Width || pSlot->Desc.Height != Desc.Height || pSlot->Desc.Format != Desc.Format))
 	{
-		// Set variables
-		SCREENSHOTSTRUCT scElement;
-		ScreenshotVector.push_back(scElement);
-		ScreenshotVector.back().Width = Desc.Width;
-		ScreenshotVector.back().Height = Desc.Height;
-		ScreenshotVector.back().size = LockedRect.Pitch * ScreenshotVector.back().Height;
-		ScreenshotVector.back().Pitch = LockedRect.Pitch;
-		ScreenshotVector.back().bufferRaw.resize(ScreenshotVector.back().size);
+		ReleaseInterface(&pSlot->pCopySurface);
+		ReleaseInterface(&pSlot->pSysMemSurface);
+	}
+	if (!pSlot->pCopySurface &&
+		(FAILED(ProxyInterface->CreateRenderTarget(Desc.Width, Desc.Height, Desc.Format, D3DMULTISAMPLE_NONE, FALSE, &pSlot->pCopySurface)) ||
+		FAILED(ProxyInterface->CreateImageSurface(Desc.Width, Desc.Height, Desc.Format, &pSlot->pSysMemSurface))))
+	{
+		LOG_LIMIT(3, __FUNCTION__ << " Failed to create screenshot surfaces!");
+		ReleaseInterface(&pSlot->pCopySurface);
+		ReleaseInterface(&pSlot->pSysMemSurface);
+		pBackBuffer->Release();
+		return;
+	}
+	pSlot->Desc = Desc;
 
-		// Copy memory
-		memcpy(ScreenshotVector.back().bufferRaw.data(), LockedRect.pBits, ScreenshotVector.back().size);
+	// Queue a GPU copy of the back buffer, it is read back once the copy has had time to finish
+	HRESULT hr = ProxyInterface->CopyRects(pBackBuffer, nullptr, 0, pSlot->pCopySurface, nullptr);
 
-		// Unlock surface
-		pDestSurface->UnlockRect();
-
-		// Get current time and date
-		const std::time_t t = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-		tm tm; localtime_s(&tm, &t);
-
-		// Get file name
-		char timestamp[21];
-		sprintf_s(timestamp, " %.4d-%.2d-%.2d %.2d-%.2d-%.2d", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec);
-		std::string name("Screenshot" + std::string(timestamp) + ".png");
-
-		// Get Silent Hill 2 folder
-		wchar_t path[MAX_PATH] = {};
-		bool ret = GetSH2FolderPath(path, MAX_PATH);
-		wchar_t* pdest = wcsrchr(path, '\\');
-		if (ret && pdest)
-		{
-			*pdest = '\0';
-			wcscat_s(path, MAX_PATH, L"\\imgs\\");
-			if (!PathFileExists(path))
-			{
-				CreateDirectory(path, nullptr);
-			}
-		}
+	// Release surface
+	pBackBuffer->Release();
 
-		// File name
-		ScreenshotVector.back().filename.assign(path + std::wstring(name.begin(), name.end()));
+	if (FAILED(hr))
+	{
+		LOG_LIMIT(3, __FUNCTION__ << " Failed to copy back buffer!");
+		return;
+	}
 
-		// Enable item in vector
-		ScreenshotVector.back().Enabled = true;
+	// File name
+	if (Burst)
+	{
+		wchar_t name[32];
+		swprintf_s(name, L"Frame %.6u.qoi", FrameIndex);
+		pSlot->filename.assign(ScreenshotBurst.Folder + name);
+		pSlot->TimeNs = PacerClock::NowNs() - ScreenshotBurst.StartNs;
 	}
 	else
 	{
-		LOG_LIMIT(3, __FUNCTION__ << " Failed to lock back buffer!");
+		pSlot->filename.assign(GetScreenshotFolder() + L"Screenshot" + GetScreenshotTimestamp() + (ScreenshotFormat == SCREENSHOT_QOI ? L".qoi" : L".png"));
+		pSlot->TimeNs = 0;
 	}
+	pSlot->Burst = Burst;
+	pSlot->FrameIndex = FrameIndex;
 
-	// Release surface
-	pDestSurface->Release();
+	pSlot->FramesLeft = ScreenshotReadbackLatency;
+	pSlot->Pending = true;
+}
+
+void m_IDirect3DDevice8::ProcessScreenShotReadback(bool Flush)
+{
+	// Size the pool for bursts, it shrinks again as the screenshot thread hands the burst frames back
+	bool Burst = ScreenshotBurst.Active;
+	for (const auto& Slot : ScreenshotReadback)
+	{
+		Burst |= Slot.Pending && Slot.Burst;
+	}
+	ScreenshotPool.SetSlotCount(Burst ? FrameSlotPool::MaxSlots : ScreenshotPoolSlots);
+
+	for (auto& Slot : ScreenshotReadback)
+	{
+		if (!Slot.Pending || (!Flush && --Slot.FramesLeft))
+		{
+			continue;
+		}
+		Slot.Pending = false;
+
+		// Copy to system memory and lock
+		D3DLOCKED_RECT LockedRect = {};
+		if (FAILED(ProxyInterface->CopyRects(Slot.pCopySurface, nullptr, 0, Slot.pSysMemSurface, nullptr)) ||
+			FAILED(Slot.pSysMemSurface->LockRect(&LockedRect, nullptr, D3DLOCK_READONLY)) || !LockedRect.pBits)
+		{
+			LOG_LIMIT(3, __FUNCTION__ << " Failed to read back screenshot!");
+			continue;
+		}
+
+		// Take a preallocated frame from the pool, frames are dropped if the screenshot thread falls behind
+		const size_t Size = LockedRect.Pitch * Slot.Desc.Height;
+		ScreenshotPool.SetSlotBytes(Size);
+		FrameSlotPool::SLOT *pFrame = ScreenshotPool.Acquire();
+		if (pFrame)
+		{
+			pFrame->Width = Slot.Desc.Width;
+			pFrame->Height = Slot.Desc.Height;
+			pFrame->Pitch = LockedRect.Pitch;
+			memcpy(pFrame->Data.data(), LockedRect.pBits, Size);
+			pFrame->Burst = Slot.Burst;
+			pFrame->FrameIndex = Slot.FrameIndex;
+			pFrame->TimeNs = Slot.TimeNs;
+			pFrame->DroppedBefore = ScreenshotBurst.Dropped;
+			pFrame->Path = std::move(Slot.filename);
+		}
 
-	return;
+		// Unlock surface
+		Slot.pSysMemSurface->UnlockRect();
+
+		// Hand it to the screenshot thread
+		if (pFrame)
+		{
+			ScreenshotPool.Submit(pFrame);
+		}
+		else if (Slot.Burst)
+		{
+			ScreenshotBurst.Dropped++;
+		}
+		else
+		{
+			LOG_LIMIT(3, __FUNCTION__ << " Screenshot pool is full, dropping screenshot!");
+		}
+	}
+}
+
+void m_IDirect3DDevice8::ReleaseScreenShotReadback()
+{
+	for (auto& Slot : ScreenshotReadback)
+	{
+		ReleaseInterface(&Slot.pCopySurface);
+		ReleaseInterface(&Slot.pSysMemSurface);
+		Slot.Pending = false;
+	}
 }
 
 // Function to create an emulated surface with a compatible DC
@@ -88,6 +88,18 @@ private:
 	bool OverrideTextureLoop = false;
 	bool PresentFlag = false;
 
+	// Game state read once per scene instead of on every hook
+	struct GAMESTATE
+	{
+		bool Valid = false;
+		DWORD RoomID = 0;
+		DWORD CutsceneID = 0;
+		float CutscenePos = 0.0f;
+		BYTE ChapterID = 0;
+		DWORD SpecializedLight1 = 0;
+		DWORD SpecializedLight2 = 0;
+	} FrameState;
+
     // Enhanced water rendering
     bool NeedToGrabScreenForWater = true;
     // Cockroaches replacement
@@ -99,6 +111,33 @@ private:
     IDirect3DTexture8* ScreenCopy = nullptr;
     D3DGAMMARAMP CachedRamp = {};
 
+	// Screenshots are copied on the GPU and read back a few frames later so Present never waits on the copy
+	static constexpr UINT ScreenshotReadbackSlots = 3;
+	static constexpr DWORD ScreenshotReadbackLatency = 2;
+	struct SCREENSHOTREADBACK
+	{
+		bool Pending = false;
+		DWORD FramesLeft = 0;
+		IDirect3DSurface8 *pCopySurface = nullptr;		// Default pool render target
+		IDirect3DSurface8 *pSysMemSurface = nullptr;	// Lockable system memory surface
+		D3DSURFACE_DESC Desc = {};
+		std::wstring filename;
+		bool Burst = false;
+		DWORD FrameIndex = 0;
+		int64_t TimeNs = 0;
+	} ScreenshotReadback[ScreenshotReadbackSlots];
+
+	// Burst capture takes every ScreenshotBurstInterval frames until ScreenshotBurstLength frames are reached
+	struct SCREENSHOTBURST
+	{
+		bool Active = false;
+		DWORD FrameCounter = 0;
+		DWORD FrameIndex = 0;
+		DWORD Dropped = 0;
+		int64_t StartNs = 0;
+		std::wstring Folder;
+	} ScreenshotBurst;
+
 	IDirect3DTexture8 *pInTexture = nullptr;
 	IDirect3DSurface8 *pInSurface = nullptr;
 	IDirect3DSurface8 *pInRender = nullptr;
@@ -219,12 +258,6 @@ private:
 		UINT stream0Stride;
 	};
 
-	// Limit frame rate
-	struct {
-		DWORD FrameCounter = 0;
-		LARGE_INTEGER LastPresentTime = {};
-	} Counter;
-
 	// Helper functions
 	void EnableAntiAliasing();
 	void DisableAntiAliasing();
@@ -238,10 +271,23 @@ private:
 	DWORD GetShadowIntensity();
 	void SetShadowFading();
 	void SetScaledBackbuffer();
-	void CaptureScreenShot();
+	void CaptureScreenShot(bool Burst = false);
+	void StartScreenShotBurst();
+	void StopScreenShotBurst();
+	void ProcessScreenShotReadback(bool Flush = false);
+	void ReleaseScreenShotReadback();
 	HRESULT CreateDCSurface(EMUSURFACE& surface, LONG Width, LONG Height);
 	void ReleaseDCSurface(EMUSURFACE& surface);
 	void LimitFrameRate();
+	void UpdateFrameState();
+	const GAMESTATE& GetFrameState()
+	{
+		if (!FrameState.Valid)
+		{
+			UpdateFrameState();
+		}
+		return FrameState;
+	}
 
 public:
 	m_IDirect3DDevice8(LPDIRECT3DDEVICE8 pDevice, m_IDirect3D8* pD3D) : ProxyInterface(pDevice), m_pD3D(pD3D)
@@ -265,10 +311,19 @@ public:
 		ReleaseDCSurface(CacheSurface);
 		ReleaseDCSurface(CacheSurfaceStretch);
 
+		// Save recorded frame times on exit
+		if (FrameTimeRecorder.IsEnabled())
+		{
+			FrameTimeRecorder.Dump();
+		}
+
+		ProxyAddressLookupTableD3d8->LogPoolStats(__FUNCTION__);
 		delete ProxyAddressLookupTableD3d8;
 	}
 
 	LPDIRECT3DDEVICE8 GetProxyInterface() const { return ProxyInterface; }
+	// Call when the game state may have changed in the middle of a frame: after present, Reset, state blocks and while the device is lost
+	void InvalidateFrameState() { FrameState.Valid = false; }
 	AddressLookupTableD3d8<m_IDirect3DDevice8> *ProxyAddressLookupTableD3d8;
 
 	/*** IUnknown methods ***/
@@ -55,6 +55,9 @@ ULONG m_IDirect3DIndexBuffer8::Release(THIS)
 	if (Ref == 0)
 	{
 		ClassReleaseFlag = true;
+
+		// Nothing may touch the members after this
+		m_pDevice->ProxyAddressLookupTableD3d8->ReleaseInterface(this, ProxyInterface);
 	}
 
 	return Ref;
@@ -129,13 +132,31 @@ HRESULT m_IDirect3DIndexBuffer8::Lock(THIS_ UINT OffsetToLock, UINT SizeToLock,
 {
 	Logging::LogDebug() << __FUNCTION__;
 
-	return ProxyInterface->Lock(OffsetToLock, SizeToLock, ppbData, Flags);
+	HRESULT hr = ProxyInterface->Lock(OffsetToLock, SizeToLock, ppbData, Flags);
+
+	// Remember the locked range so its contents can be hashed on unlock
+	if (SUCCEEDED(hr) && ppbData && DeviceCallRecorder.IsRecording())
+	{
+		D3DINDEXBUFFER_DESC Desc = {};
+		if (!SizeToLock && SUCCEEDED(ProxyInterface->GetDesc(&Desc)))
+		{
+			SizeToLock = Desc.Size - OffsetToLock;
+		}
+		DeviceCallRecorder.OnLock(this, 0, *ppbData, SizeToLock);
+	}
+
+	return hr;
 }
 
 HRESULT m_IDirect3DIndexBuffer8::Unlock(THIS)
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.OnUnlock(this, 0);
+	}
+
 	return ProxyInterface->Unlock();
 }
 
@@ -115,7 +115,8 @@ ULONG m_IDirect3DSurface8::Release(THIS)
 {
 	Logging::LogDebug() << __FUNCTION__;
 
-	ULONG ref = ProxyInterface->Release();
+	const ULONG ProxyRef = ProxyInterface->Release();
+	ULONG ref = ProxyRef;
 
 	if (IsTextureOfSurface)
 	{
@@ -129,6 +130,13 @@ ULONG m_IDirect3DSurface8::Release(THIS)
 		pEmuSurface = nullptr;
 	}
 
+	// The wrapper lives as long as the proxy, not the count reported to the game
+	if (ProxyRef == 0)
+	{
+		// Nothing may touch the members after this
+		m_pDevice->ProxyAddressLookupTableD3d8->ReleaseInterface(this, ProxyInterface);
+	}
+
 	return ref;
 }
 
@@ -190,6 +198,47 @@ HRESULT m_IDirect3DSurface8::GetDesc(THIS_ D3DSURFACE_DESC *pDesc)
 	return ProxyInterface->GetDesc(pDesc);
 }
 
+// Remember the locked rows so their contents can be hashed on unlock
+void m_IDirect3DSurface8::RecordLock(CONST D3DLOCKED_RECT* pLockedRect, CONST RECT* pRect)
+{
+	D3DSURFACE_DESC Desc = {};
+	if (!pLockedRect || !pLockedRect->pBits || FAILED(ProxyInterface->GetDesc(&Desc)))
+	{
+		return;
+	}
+
+	UINT Rows = pRect ? pRect->bottom - pRect->top : Desc.Height;
+	if (Desc.Format == D3DFMT_DXT1 || Desc.Format == D3DFMT_DXT2 || Desc.Format == D3DFMT_DXT3 || Desc.Format == D3DFMT_DXT4 || Desc.Format == D3DFMT_DXT5)
+	{
+		Rows = (Rows + 3) / 4;
+	}
+
+	// Texture levels locked through GetSurfaceLevel are recorded as updates of the texture the draws bind
+	const void *pContainer = nullptr;
+	UINT ContainerLevel = 0;
+	IDirect3DTexture8 *pTexture = nullptr;
+	if (SUCCEEDED(ProxyInterface->GetContainer(IID_IDirect3DTexture8, (void**)&pTexture)) && pTexture)
+	{
+		for (UINT Level = 0; Level < pTexture->GetLevelCount(); Level++)
+		{
+			IDirect3DSurface8 *pLevel = nullptr;
+			if (SUCCEEDED(pTexture->GetSurfaceLevel(Level, &pLevel)) && pLevel)
+			{
+				pLevel->Release();
+				if (pLevel == ProxyInterface)
+				{
+					pContainer = m_pDevice->ProxyAddressLookupTableD3d8->FindAddress<m_IDirect3DTexture8>(pTexture);
+					ContainerLevel = Level;
+					break;
+				}
+			}
+		}
+		pTexture->Release();
+	}
+
+	DeviceCallRecorder.OnLock(this, 0, pLockedRect->pBits, static_cast<size_t>(pLockedRect->Pitch) * Rows, pContainer, ContainerLevel);
+}
+
 HRESULT m_IDirect3DSurface8::LockRect(THIS_ D3DLOCKED_RECT* pLockedRect, CONST RECT* pRect, DWORD Flags)
 {
 	Logging::LogDebug() << __FUNCTION__;
@@ -226,6 +275,10 @@ HRESULT m_IDirect3DSurface8::LockRect(THIS_ D3DLOCKED_RECT* pLockedRect, CONST R
 					{
 						pLockedRect->pBits = LockedRect.pBits;
 						pLockedRect->Pitch = LockedRect.Pitch;
+						if (DeviceCallRecorder.IsRecording())
+						{
+							RecordLock(pLockedRect, pRect);
+						}
 						return D3D_OK;
 					}
 					else
@@ -253,6 +306,11 @@ HRESULT m_IDirect3DSurface8::LockRect(THIS_ D3DLOCKED_RECT* pLockedRect, CONST R
 	else if (SUCCEEDED(hr))
 	{
 		IsLocked = true;
+
+		if (DeviceCallRecorder.IsRecording())
+		{
+			RecordLock(pLockedRect, pRect);
+		}
 	}
 
 	return hr;
@@ -264,6 +322,11 @@ HRESULT m_IDirect3DSurface8::UnlockRect(THIS)
 
 	HRESULT hr = D3D_OK;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.OnUnlock(this, 0);
+	}
+
 	// Copy data back from emulated surface
 	if (pEmuSurface)
 	{
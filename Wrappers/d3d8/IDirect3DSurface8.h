@@ -17,6 +17,8 @@ private:
 	RECT EmuRect = { NULL };
 	IDirect3DSurface8* pEmuSurface = nullptr;
 
+	void RecordLock(CONST D3DLOCKED_RECT* pLockedRect, CONST RECT* pRect);
+
 public:
 	m_IDirect3DSurface8(LPDIRECT3DSURFACE8 pSurface8, m_IDirect3DDevice8* pDevice) : ProxyInterface(pSurface8), m_pDevice(pDevice)
 	{
@@ -55,6 +55,9 @@ ULONG m_IDirect3DTexture8::Release(THIS)
 	if (Ref == 0)
 	{
 		ClassReleaseFlag = true;
+
+		// Nothing may touch the members after this
+		m_pDevice->ProxyAddressLookupTableD3d8->ReleaseInterface(this, ProxyInterface);
 	}
 
 	return Ref;
@@ -178,13 +181,35 @@ HRESULT m_IDirect3DTexture8::LockRect(THIS_ UINT Level, D3DLOCKED_RECT* pLockedR
 {
 	Logging::LogDebug() << __FUNCTION__;
 
-	return ProxyInterface->LockRect(Level, pLockedRect, pRect, Flags);
+	HRESULT hr = ProxyInterface->LockRect(Level, pLockedRect, pRect, Flags);
+
+	// Remember the locked rows so their contents can be hashed on unlock
+	if (SUCCEEDED(hr) && pLockedRect && pLockedRect->pBits && DeviceCallRecorder.IsRecording())
+	{
+		D3DSURFACE_DESC Desc = {};
+		if (SUCCEEDED(ProxyInterface->GetLevelDesc(Level, &Desc)))
+		{
+			UINT Rows = pRect ? pRect->bottom - pRect->top : Desc.Height;
+			if (Desc.Format == D3DFMT_DXT1 || Desc.Format == D3DFMT_DXT2 || Desc.Format == D3DFMT_DXT3 || Desc.Format == D3DFMT_DXT4 || Desc.Format == D3DFMT_DXT5)
+			{
+				Rows = (Rows + 3) / 4;
+			}
+			DeviceCallRecorder.OnLock(this, Level, pLockedRect->pBits, static_cast<size_t>(pLockedRect->Pitch) * Rows);
+		}
+	}
+
+	return hr;
 }
 
 HRESULT m_IDirect3DTexture8::UnlockRect(THIS_ UINT Level)
 {
 	Logging::LogDebug() << __FUNCTION__;
 
+	if (DeviceCallRecorder.IsRecording())
+	{
+		DeviceCallRecorder.OnUnlock(this, Level);
+	}
+
 	return ProxyInterface->UnlockRect(Level);
 }
 
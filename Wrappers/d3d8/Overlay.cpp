@@ -137,6 +137,8 @@ void Overlay::DrawDebugOverlay(LPDIRECT3DDEVICE8 ProxyInterface)
 	if (std::chrono::duration_cast<std::chrono::milliseconds>(currentTime - lastUpdateTime).count() >= 500)
 	{
 		LastFPS = (float)AverageFPSCounter;
+		LastFrameTime = (float)FrameStats.GetMeanMs();
+		LastFrameTimeP99 = (float)FrameStats.GetPercentileMs(99.0);
 		lastUpdateTime = currentTime;
 	}
 
@@ -165,6 +167,15 @@ void Overlay::DrawDebugOverlay(LPDIRECT3DDEVICE8 ProxyInterface)
 	OvlString.append("\rFPS: ");
 	OvlString.append(FloatToStr(LastFPS, FPSFloatPrecision));
 
+	OvlString.append("\rFrame Time: ");
+	OvlString.append(FloatToStr(LastFrameTime, FPSFloatPrecision));
+	OvlString.append("ms (99%: ");
+	OvlString.append(FloatToStr(LastFrameTimeP99, FPSFloatPrecision));
+	OvlString.append("ms)");
+
+	OvlString.append("\rMissed Frames: ");
+	OvlString.append(std::to_string(FrameLimiter.GetMissedDeadlines()));
+
 	OvlString.append("\rGame Resolution: ");
 	OvlString.append(std::to_string(LastWidth));
 	OvlString.append("x");
@@ -17,6 +17,7 @@
 #pragma once
 #include "d3d8wrapper.h"
 #include "Patches\InputTweaks.h"
+#include "Common\FramePacer.h"
 #include <sstream>
 #include <chrono>
 #include <iomanip>
@@ -89,6 +90,8 @@ private:
 	const int DropShadowOffset = 1;
 
 	float LastFPS;
+	float LastFrameTime = 0.0f;
+	float LastFrameTimeP99 = 0.0f;
 	float LastCharYPos;
 
 	LPCSTR FontName = "Arial";
@@ -116,3 +119,5 @@ extern bool ControllerConnectedFlag;
 extern int JoystickX;
 extern int JoystickY;
 extern double AverageFPSCounter;
+extern FrameTimeStats FrameStats;
+extern FramePacer FrameLimiter;
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+#
+# Summarises the CSV files FrameRecorder writes (Ctrl + F11 or on exit) into per room percentile tables.
+#
+# The frame time of a record is the time since the previous Present, so it is only known when the previous frame is
+# in the file as well. With several files, the frames of all of them are pooled, e.g. several runs of the same route.
+# With --baseline, every room also shows how much its percentiles moved against the frames of another build.
+#
+# Usage: SummarizeFrameTimes.py [--baseline <old.csv>] ... [--cutscenes] <new.csv> ...
+#   --baseline   frames of the build to compare against, repeat it for several files
+#   --cutscenes  groups by room and cutscene instead of by room only
+
+import argparse
+import csv
+import sys
+
+PERCENTILES = (50, 90, 99)
+COLUMNS = ('frame_ms', 'scene_ms', 'present_ms', 'limiter_ms')
+
+
+def read_frames(paths, by_cutscene):
+    groups = {}
+    for path in paths:
+        with open(path, newline='') as file:
+            previous = None
+            for row in csv.DictReader(file):
+                frame, time_ms = int(row['frame']), float(row['time_ms'])
+                if previous is not None and frame == previous[0] + 1:
+                    key = (row['room_id'], row['cutscene_id'] if by_cutscene else '')
+                    group = groups.setdefault(key, {name: [] for name in COLUMNS + ('draw_calls', 'state_changes')})
+                    group['frame_ms'].append(time_ms - previous[1])
+                    for name in ('scene_ms', 'present_ms', 'limiter_ms'):
+                        group[name].append(float(row[name]))
+                    for name in ('draw_calls', 'state_changes'):
+                        group[name].append(int(row[name]))
+                previous = (frame, time_ms)
+    return groups
+
+
+def percentile(values, p):
+    # Nearest rank, so every reported value is a frame that was actually recorded
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, max(0, -(-len(ordered) * p // 100) - 1))]
+
+
+def summarise(group):
+    stats = {'frames': len(group['frame_ms'])}
+    for name in COLUMNS:
+        stats[name] = [percentile(group[name], p) for p in PERCENTILES]
+    stats['draw_calls'] = sum(group['draw_calls']) / len(group['draw_calls'])
+    stats['state_changes'] = sum(group['state_changes']) / len(group['state_changes'])
+    return stats
+
+
+def print_table(groups, baseline):
+    header = '%-10s %-10s %7s' % ('room', 'cutscene', 'frames')
+    for name in COLUMNS:
+        header += ' | %-23s' % (name + ' p' + '/'.join(str(p) for p in PERCENTILES))
+    header += ' | %8s %8s' % ('draws', 'states')
+    print(header)
+    print('-' * len(header))
+
+    for key in sorted(groups):
+        stats = summarise(groups[key])
+        line = '%-10s %-10s %7d' % (key[0], key[1] or '-', stats['frames'])
+        for name in COLUMNS:
+            line += ' | %-23s' % '/'.join('%.2f' % value for value in stats[name])
+        line += ' | %8.1f %8.1f' % (stats['draw_calls'], stats['state_changes'])
+        print(line)
+
+        if baseline is not None:
+            if key not in baseline:
+                print('%-29s not in the baseline' % '')
+                continue
+            old = summarise(baseline[key])
+            line = '%-10s %-10s %7d' % ('', 'change', stats['frames'] - old['frames'])
+            for name in COLUMNS:
+                line += ' | %-23s' % '/'.join('%+.2f' % (new - prev) for new, prev in zip(stats[name], old[name]))
+            line += ' | %+8.1f %+8.1f' % (stats['draw_calls'] - old['draw_calls'], stats['state_changes'] - old['state_changes'])
+            print(line)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Per room frame time percentiles from FrameRecorder CSV files')
+    parser.add_argument('--baseline', action='append', metavar='CSV', help='frames of the build to compare against, can be repeated')
+    parser.add_argument('--cutscenes', action='store_true', help='group by room and cutscene')
+    parser.add_argument('files', nargs='+', metavar='CSV')
+    args = parser.parse_args()
+
+    groups = read_frames(args.files, args.cutscenes)
+    if not groups:
+        print('no consecutive frames in the input', file=sys.stderr)
+        return 1
+
+    print_table(groups, read_frames(args.baseline, args.cutscenes) if args.baseline else None)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
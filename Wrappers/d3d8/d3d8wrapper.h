@@ -73,8 +73,11 @@ extern bool CopyRenderTarget;
 extern bool SetSSAA;
 extern bool SetATOC;
 extern bool TakeScreenShot;
+extern bool ToggleScreenShotBurst;
 extern D3DMULTISAMPLE_TYPE DeviceMultiSampleType;
 
+#include "FrameRecorder.h"
+#include "CallRecorder.h"
 #include "IDirect3D8.h"
 #include "IDirect3DDevice8.h"
 #include "IDirect3DCubeTexture8.h"
@@ -405,7 +405,14 @@ HRESULT m_IDirect3DDevice9::CreateOffscreenPlainSurface(UINT Width, UINT Height,
 
 HRESULT m_IDirect3DDevice9::SetRenderTarget(DWORD RenderTargetIndex, IDirect3DSurface9 *pRenderTarget)
 {
-	return ProxyInterface->SetRenderTarget(RenderTargetIndex, pRenderTarget);
+	const HRESULT hr = ProxyInterface->SetRenderTarget(RenderTargetIndex, pRenderTarget);
+
+	if (SUCCEEDED(hr))
+	{
+		_buffer_detection.on_set_render_target(RenderTargetIndex, pRenderTarget);
+	}
+
+	return hr;
 }
 
 HRESULT m_IDirect3DDevice9::GetRenderTarget(DWORD RenderTargetIndex, IDirect3DSurface9 **ppRenderTarget)
@@ -478,7 +485,16 @@ HRESULT m_IDirect3DDevice9::MultiplyTransform(D3DTRANSFORMSTATETYPE State, const
 
 HRESULT m_IDirect3DDevice9::SetViewport(const D3DVIEWPORT9 *pViewport)
 {
-	return ProxyInterface->SetViewport(pViewport);
+	const HRESULT hr = ProxyInterface->SetViewport(pViewport);
+
+	if (SUCCEEDED(hr))
+	{
+		assert(pViewport != nullptr);
+
+		_buffer_detection.on_set_viewport(*pViewport);
+	}
+
+	return hr;
 }
 
 HRESULT m_IDirect3DDevice9::GetViewport(D3DVIEWPORT9 *pViewport)
@@ -538,16 +554,22 @@ HRESULT m_IDirect3DDevice9::GetRenderState(D3DRENDERSTATETYPE State, DWORD *pVal
 
 HRESULT m_IDirect3DDevice9::CreateStateBlock(D3DSTATEBLOCKTYPE Type, IDirect3DStateBlock9 **ppSB)
 {
+	_buffer_detection.on_create_state_block(Type);
+
 	return ProxyInterface->CreateStateBlock(Type, ppSB);
 }
 
 HRESULT m_IDirect3DDevice9::BeginStateBlock()
 {
+	_buffer_detection.on_begin_state_block();
+
 	return ProxyInterface->BeginStateBlock();
 }
 
 HRESULT m_IDirect3DDevice9::EndStateBlock(IDirect3DStateBlock9 **ppSB)
 {
+	_buffer_detection.on_end_state_block();
+
 	return ProxyInterface->EndStateBlock(ppSB);
 }
 
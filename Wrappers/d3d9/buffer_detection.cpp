@@ -30,6 +30,7 @@ void reshade::d3d9::buffer_detection::reset(bool release_resources)
 	_stats = { 0, 0 };
 
 	_counters_per_used_depth_surface.clear();
+	_current_counters = nullptr;
 
 	if (release_resources)
 	{
@@ -39,21 +40,35 @@ void reshade::d3d9::buffer_detection::reset(bool release_resources)
 		}
 		_depthstencil_original.reset(); // Reset this after all replacements have been released, so that 'update_depthstencil_replacement' was able to bind it if necessary
 		_depthstencil_replacement.clear();
+
+		// The device is being reset or destroyed, which also resets the bound depth-stencil surface and viewport
+		set_current_depthstencil(nullptr);
+		_depthstencil_known = false;
+		_viewport_known = false;
 	}
-	else if (preserve_depth_buffers && !_depthstencil_replacement.empty() && _depthstencil_replacement[0] != nullptr)
+	else
 	{
+		// Query the device once per frame, so the tracked depth-stencil surface cannot drift from it for longer than that
 		com_ptr<IDirect3DSurface9> depthstencil;
 		_device->GetDepthStencilSurface(&depthstencil);
+		set_current_depthstencil(depthstencil.get());
 
-		// Clear the first replacement at the end of the frame, since any clear performed by the application was redirected to a different one
-		// Do not have to do this to the others, since the first operation on any of them is a clear anyway (see 'on_clear_depthstencil')
-		_device->SetDepthStencilSurface(_depthstencil_replacement[0].get());
-		_device->Clear(0, nullptr, D3DCLEAR_ZBUFFER, 0, 1.0f, 0);
-
-		// Keep the depth-stencil surface set to the first replacement (because of the above 'SetDepthStencilSurface' call) if the original one we want to replace was set, so starting next frame it is the one used again
-		if (depthstencil != _depthstencil_original)
+		if (preserve_depth_buffers && !_depthstencil_replacement.empty() && _depthstencil_replacement[0] != nullptr)
 		{
-			_device->SetDepthStencilSurface(depthstencil.get());
+			// Clear the first replacement at the end of the frame, since any clear performed by the application was redirected to a different one
+			// Do not have to do this to the others, since the first operation on any of them is a clear anyway (see 'on_clear_depthstencil')
+			_device->SetDepthStencilSurface(_depthstencil_replacement[0].get());
+			_device->Clear(0, nullptr, D3DCLEAR_ZBUFFER, 0, 1.0f, 0);
+
+			// Keep the depth-stencil surface set to the first replacement (because of the above 'SetDepthStencilSurface' call) if the original one we want to replace was set, so starting next frame it is the one used again
+			if (depthstencil != _depthstencil_original)
+			{
+				_device->SetDepthStencilSurface(depthstencil.get());
+			}
+			else
+			{
+				set_current_depthstencil(_depthstencil_replacement[0].get());
+			}
 		}
 	}
 }
@@ -80,20 +95,27 @@ void reshade::d3d9::buffer_detection::on_draw(D3DPRIMITIVETYPE type, UINT vertic
 	_stats.vertices += vertices;
 	_stats.drawcalls += 1;
 
-	com_ptr<IDirect3DSurface9> depthstencil;
-	_device->GetDepthStencilSurface(&depthstencil);
+	query_current_depthstencil();
 
-	if (depthstencil == nullptr)
+	if (_current_depthstencil == nullptr)
 	{
 		return; // This is a draw call with no depth-stencil bound
 	}
-	if (std::find(_depthstencil_replacement.begin(), _depthstencil_replacement.end(), depthstencil) != _depthstencil_replacement.end())
+
+	// Only look up the statistics entry again after the depth-stencil surface (or its replacement) changed
+	if (_current_counters == nullptr)
 	{
-		depthstencil = _depthstencil_original;
+		com_ptr<IDirect3DSurface9> depthstencil = _current_depthstencil;
+		if (std::find(_depthstencil_replacement.begin(), _depthstencil_replacement.end(), depthstencil) != _depthstencil_replacement.end())
+		{
+			depthstencil = _depthstencil_original;
+		}
+
+		_current_counters = &_counters_per_used_depth_surface[depthstencil];
 	}
 
 	// Update draw statistics for tracked depth-stencil surfaces
-	auto &counters = _counters_per_used_depth_surface[depthstencil];
+	auto &counters = *_current_counters;
 	counters.total_stats.vertices += vertices;
 	counters.total_stats.drawcalls += 1;
 
@@ -101,25 +123,31 @@ void reshade::d3d9::buffer_detection::on_draw(D3DPRIMITIVETYPE type, UINT vertic
 	{
 		counters.current_stats.vertices += vertices;
 		counters.current_stats.drawcalls += 1;
-		_device->GetViewport(&counters.current_stats.viewport);
+
+		if (!_viewport_known)
+		{
+			_device->GetViewport(&_current_viewport);
+			_viewport_known = !_viewport_in_state_blocks && !_recording_state_block;
+		}
+		counters.current_stats.viewport = _current_viewport;
 	}
 }
 
 void reshade::d3d9::buffer_detection::on_set_depthstencil(IDirect3DSurface9 *&depthstencil)
 {
-	if (depthstencil == nullptr || depthstencil != _depthstencil_original)
+	if (depthstencil != nullptr && depthstencil == _depthstencil_original)
 	{
-		return;
-	}
-
-	const size_t replacement_index = preserve_depth_buffers ?
-		_counters_per_used_depth_surface[_depthstencil_original].clears.size() : 0;
+		const size_t replacement_index = preserve_depth_buffers ?
+			_counters_per_used_depth_surface[_depthstencil_original].clears.size() : 0;
 
-	// Replace application depth-stencil surface with our custom one
-	if (_depthstencil_replacement[replacement_index] != nullptr)
-	{
-		depthstencil = _depthstencil_replacement[replacement_index].get();
+		// Replace application depth-stencil surface with our custom one
+		if (_depthstencil_replacement[replacement_index] != nullptr)
+		{
+			depthstencil = _depthstencil_replacement[replacement_index].get();
+		}
 	}
+
+	set_current_depthstencil(depthstencil);
 }
 void reshade::d3d9::buffer_detection::on_get_depthstencil(IDirect3DSurface9 *&depthstencil)
 {
@@ -143,8 +171,9 @@ void reshade::d3d9::buffer_detection::on_clear_depthstencil(UINT clear_flags)
 		return; // Ignore clears that do not affect the depth buffer (e.g. color or stencil clears)
 	}
 
-	com_ptr<IDirect3DSurface9> depthstencil;
-	_device->GetDepthStencilSurface(&depthstencil);
+	query_current_depthstencil();
+
+	IDirect3DSurface9 *const depthstencil = _current_depthstencil;
 	assert(depthstencil != nullptr);
 
 	if (std::find(_depthstencil_replacement.begin(), _depthstencil_replacement.end(), depthstencil) == _depthstencil_replacement.end() && depthstencil != _depthstencil_original)
@@ -172,8 +201,62 @@ void reshade::d3d9::buffer_detection::on_clear_depthstencil(UINT clear_flags)
 	{
 		// Bind it immediately so the clear is not performed on the previous one, but the new one instead
 		_device->SetDepthStencilSurface(_depthstencil_replacement[replacement_index].get());
+		set_current_depthstencil(_depthstencil_replacement[replacement_index].get());
+	}
+}
+
+void reshade::d3d9::buffer_detection::on_set_render_target(DWORD index, IDirect3DSurface9 *render_target)
+{
+	// Setting the first render target also sets the viewport to its full size
+	if (index != 0 || render_target == nullptr)
+	{
+		return;
+	}
+
+	if (_recording_state_block)
+	{
+		_viewport_known = false;
+		return;
+	}
+
+	D3DSURFACE_DESC desc;
+	render_target->GetDesc(&desc);
+
+	_current_viewport = { 0, 0, desc.Width, desc.Height, 0.0f, 1.0f };
+	_viewport_known = !_viewport_in_state_blocks;
+}
+void reshade::d3d9::buffer_detection::on_set_viewport(const D3DVIEWPORT9 &viewport)
+{
+	if (_recording_state_block)
+	{
+		// The viewport is recorded, so it changes again whenever that state block is applied
+		_viewport_in_state_blocks = true;
+		_viewport_known = false;
+		return;
+	}
+
+	_current_viewport = viewport;
+	_viewport_known = !_viewport_in_state_blocks;
+}
+void reshade::d3d9::buffer_detection::on_create_state_block(D3DSTATEBLOCKTYPE type)
+{
+	// Pixel and vertex state blocks do not include the viewport, but applying a block of all states does, without going through the hooks
+	if (type == D3DSBT_ALL)
+	{
+		_viewport_in_state_blocks = true;
+		_viewport_known = false;
 	}
 }
+void reshade::d3d9::buffer_detection::on_begin_state_block()
+{
+	_recording_state_block = true;
+	_viewport_known = false;
+}
+void reshade::d3d9::buffer_detection::on_end_state_block()
+{
+	_recording_state_block = false;
+	_viewport_known = false;
+}
 
 bool reshade::d3d9::buffer_detection::update_depthstencil_replacement(com_ptr<IDirect3DSurface9> depthstencil, size_t index)
 {
@@ -186,12 +269,16 @@ bool reshade::d3d9::buffer_detection::update_depthstencil_replacement(com_ptr<ID
 		std::move(_depthstencil_replacement[index]);
 	assert(_depthstencil_replacement[index] == nullptr);
 
+	// The original surface and its replacements change below, so the current statistics entry may too
+	_current_counters = nullptr;
+
 	// First unbind the depth-stencil replacement from the device, since it may be destroyed below
 	com_ptr<IDirect3DSurface9> current_depthstencil;
 	_device->GetDepthStencilSurface(&current_depthstencil);
 	if (current_depthstencil != nullptr && current_depthstencil == current_replacement)
 	{
 		_device->SetDepthStencilSurface(_depthstencil_original.get());
+		set_current_depthstencil(_depthstencil_original.get());
 	}
 
 	if (depthstencil == nullptr)
@@ -278,11 +365,30 @@ bool reshade::d3d9::buffer_detection::update_depthstencil_replacement(com_ptr<ID
 	if (current_depthstencil == _depthstencil_original)
 	{
 		_device->SetDepthStencilSurface(_depthstencil_replacement[index].get());
+		set_current_depthstencil(_depthstencil_replacement[index].get());
 	}
 
 	return true;
 }
 
+void reshade::d3d9::buffer_detection::set_current_depthstencil(IDirect3DSurface9 *depthstencil)
+{
+	_current_depthstencil = depthstencil;
+	_current_counters = nullptr;
+	_depthstencil_known = true;
+}
+void reshade::d3d9::buffer_detection::query_current_depthstencil()
+{
+	if (_depthstencil_known)
+	{
+		return;
+	}
+
+	com_ptr<IDirect3DSurface9> depthstencil;
+	_device->GetDepthStencilSurface(&depthstencil);
+	set_current_depthstencil(depthstencil.get());
+}
+
 bool reshade::d3d9::buffer_detection::check_aspect_ratio(UINT width_to_check, UINT height_to_check, UINT width, UINT height)
 {
 	return (width_to_check >= std::floor(width * 0.95f) && width_to_check <= std::ceil(width * 1.05f))
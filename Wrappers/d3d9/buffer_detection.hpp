@@ -58,6 +58,12 @@ namespace reshade::d3d9
 		void on_get_depthstencil(IDirect3DSurface9 *&depthstencil);
 		void on_clear_depthstencil(UINT clear_flags);
 
+		void on_set_render_target(DWORD index, IDirect3DSurface9 *render_target);
+		void on_set_viewport(const D3DVIEWPORT9 &viewport);
+		void on_create_state_block(D3DSTATEBLOCKTYPE type);
+		void on_begin_state_block();
+		void on_end_state_block();
+
 		// Detection Settings
 		bool disable_intz = false;
 		bool preserve_depth_buffers = false;
@@ -78,9 +84,20 @@ namespace reshade::d3d9
 		bool check_texture_format(const D3DSURFACE_DESC &desc);
 
 		bool update_depthstencil_replacement(com_ptr<IDirect3DSurface9> depthstencil, size_t index);
+		void set_current_depthstencil(IDirect3DSurface9 *depthstencil);
+		void query_current_depthstencil();
 
 		com_ptr<IDirect3DSurface9> _depthstencil_original;
 		std::vector<com_ptr<IDirect3DSurface9>> _depthstencil_replacement;
 		std::unordered_map<com_ptr<IDirect3DSurface9>, depthstencil_info> _counters_per_used_depth_surface;
+
+		// Device state tracked from the hooks, so that draw calls do not have to query it
+		IDirect3DSurface9 *_current_depthstencil = nullptr; // Not referenced, the device keeps it alive while it is bound
+		bool _depthstencil_known = false; // Not known after creating or resetting the device, which binds the automatic depth-stencil surface without going through the hooks
+		depthstencil_info *_current_counters = nullptr; // Entry the current depth-stencil counts into, looked up again on the next draw when cleared
+		D3DVIEWPORT9 _current_viewport = {};
+		bool _viewport_known = false;
+		bool _recording_state_block = false;
+		bool _viewport_in_state_blocks = false; // Applying a state block changes the viewport without going through the hooks
 	};
 }
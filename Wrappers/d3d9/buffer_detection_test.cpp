@@ -0,0 +1,342 @@
+// Checks the depth-stencil and viewport tracking of buffer_detection on a real device
+//
+// Random frames of depth-stencil, render target, viewport, clear, state block and draw calls go through the hooks in
+// the same order as m_IDirect3DDevice9, while the present picks a depth surface to replace like runtime_d3d9 does and
+// now and then the device is reset instead. After every draw, the statistics entry it counted into has to belong to the
+// surface the device really has bound (the original one when a replacement is bound), and with depth buffers preserved
+// the viewport recorded for it has to be the one the device really uses, also after state blocks were applied behind
+// the hooks. The application must never get a replacement back from GetDepthStencilSurface.
+//
+// Usage: run from the repository root of a Windows checkout
+//   cl /std:c++17 /EHsc /O2 /I. Wrappers\d3d9\buffer_detection_test.cpp Wrappers\d3d9\buffer_detection.cpp d3d9.lib user32.lib
+//   buffer_detection_test
+
+#include "Logging\Logging.h"
+#include "buffer_detection.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <unordered_map>
+
+std::ofstream LOG;
+
+// Stands in for the one in Logging.cpp, which would pull in the rest of the game
+std::ostream &operator<<(std::ostream &os, const D3DERR &ErrCode)
+{
+	return os << static_cast<long>(ErrCode);
+}
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do { if (!(condition)) { failures++; printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); } } while (0)
+
+using namespace reshade::d3d9;
+
+static constexpr auto D3DFMT_INTZ = static_cast<D3DFORMAT>(MAKEFOURCC('I', 'N', 'T', 'Z'));
+
+// Calls the hooks around the device calls in the same order as m_IDirect3DDevice9
+struct hooked_device
+{
+	explicit hooked_device(IDirect3DDevice9 *device) : device(device), detection(device) {}
+
+	void set_render_target(DWORD index, IDirect3DSurface9 *render_target)
+	{
+		if (SUCCEEDED(device->SetRenderTarget(index, render_target)))
+			detection.on_set_render_target(index, render_target);
+	}
+	void set_depth_stencil_surface(IDirect3DSurface9 *depthstencil)
+	{
+		detection.on_set_depthstencil(depthstencil);
+		device->SetDepthStencilSurface(depthstencil);
+	}
+	com_ptr<IDirect3DSurface9> get_depth_stencil_surface()
+	{
+		IDirect3DSurface9 *depthstencil = nullptr;
+		if (SUCCEEDED(device->GetDepthStencilSurface(&depthstencil)))
+			detection.on_get_depthstencil(depthstencil);
+		return com_ptr<IDirect3DSurface9>(depthstencil, true);
+	}
+	void clear(DWORD flags)
+	{
+		if (flags != D3DCLEAR_TARGET)
+			detection.on_clear_depthstencil(flags);
+		device->Clear(0, nullptr, flags, 0, 1.0f, 0);
+	}
+	void set_viewport(const D3DVIEWPORT9 &viewport)
+	{
+		if (SUCCEEDED(device->SetViewport(&viewport)))
+			detection.on_set_viewport(viewport);
+	}
+	com_ptr<IDirect3DStateBlock9> create_state_block(D3DSTATEBLOCKTYPE type)
+	{
+		detection.on_create_state_block(type);
+		com_ptr<IDirect3DStateBlock9> block;
+		device->CreateStateBlock(type, &block);
+		return block;
+	}
+	void begin_state_block()
+	{
+		detection.on_begin_state_block();
+		device->BeginStateBlock();
+	}
+	com_ptr<IDirect3DStateBlock9> end_state_block()
+	{
+		detection.on_end_state_block();
+		com_ptr<IDirect3DStateBlock9> block;
+		device->EndStateBlock(&block);
+		return block;
+	}
+
+	IDirect3DDevice9 *const device;
+	buffer_detection detection;
+};
+
+static com_ptr<IDirect3DSurface9> create_depth_surface(IDirect3DDevice9 *device, UINT width, UINT height, D3DFORMAT format)
+{
+	com_ptr<IDirect3DSurface9> surface;
+	if (format == D3DFMT_INTZ)
+	{
+		com_ptr<IDirect3DTexture9> texture;
+		if (SUCCEEDED(device->CreateTexture(width, height, 1, D3DUSAGE_DEPTHSTENCIL, format, D3DPOOL_DEFAULT, &texture, nullptr)))
+			texture->GetSurfaceLevel(0, &surface);
+	}
+	else
+	{
+		device->CreateDepthStencilSurface(width, height, format, D3DMULTISAMPLE_NONE, 0, FALSE, &surface, nullptr);
+	}
+	return surface;
+}
+
+static UINT vertices_of(D3DPRIMITIVETYPE type, UINT primitives)
+{
+	switch (type)
+	{
+	case D3DPT_LINELIST:
+		return primitives * 2;
+	case D3DPT_LINESTRIP:
+		return primitives + 1;
+	case D3DPT_TRIANGLELIST:
+		return primitives * 3;
+	case D3DPT_TRIANGLESTRIP:
+	case D3DPT_TRIANGLEFAN:
+		return primitives + 2;
+	default:
+		return primitives;
+	}
+}
+
+static void run(IDirect3DDevice9 *device, bool preserve_depth_buffers, unsigned int seed)
+{
+	std::mt19937 rng(seed);
+	const auto random = [&rng](UINT count) { return static_cast<UINT>(rng() % count); };
+
+	// Depth-stencil surfaces and render targets of the application
+	com_ptr<IDirect3DSurface9> back_buffer, auto_depthstencil;
+	device->GetRenderTarget(0, &back_buffer);
+	device->GetDepthStencilSurface(&auto_depthstencil);
+
+	std::vector<com_ptr<IDirect3DSurface9>> depthstencils = { auto_depthstencil, create_depth_surface(device, 1280, 720, D3DFMT_D24S8), create_depth_surface(device, 640, 360, D3DFMT_D24S8) };
+	if (com_ptr<IDirect3DSurface9> intz = create_depth_surface(device, 1280, 720, D3DFMT_INTZ); intz != nullptr)
+		depthstencils.push_back(std::move(intz));
+	depthstencils.push_back(nullptr);
+
+	com_ptr<IDirect3DSurface9> small_target;
+	device->CreateRenderTarget(640, 360, D3DFMT_X8R8G8B8, D3DMULTISAMPLE_NONE, 0, FALSE, &small_target, nullptr);
+	IDirect3DSurface9 *const render_targets[] = { back_buffer.get(), small_target.get() };
+
+	hooked_device hooked(device);
+	hooked.detection.preserve_depth_buffers = preserve_depth_buffers;
+
+	const auto is_application_surface = [&depthstencils](IDirect3DSurface9 *surface) {
+		return std::find(depthstencils.begin(), depthstencils.end(), surface) != depthstencils.end();
+	};
+	// What the counters are keyed on for the surface that is really bound
+	const auto counted_surface = [&]() {
+		com_ptr<IDirect3DSurface9> bound;
+		device->GetDepthStencilSurface(&bound);
+		return is_application_surface(bound.get()) ? bound : com_ptr<IDirect3DSurface9>(hooked.detection.current_depth_surface());
+	};
+
+	std::vector<com_ptr<IDirect3DStateBlock9>> state_blocks;
+	std::unordered_map<IDirect3DSurface9 *, buffer_detection::draw_stats> expected;
+	buffer_detection::draw_stats expected_total;
+	size_t draws = 0, replaced_draws = 0;
+
+	for (int frame = 0; frame < 300; ++frame)
+	{
+		for (int op = 0; op < 40; ++op)
+		{
+			switch (random(10))
+			{
+			case 0:
+				hooked.set_depth_stencil_surface(depthstencils[random(static_cast<UINT>(depthstencils.size()))].get());
+				break;
+			case 1:
+			{
+				const com_ptr<IDirect3DSurface9> depthstencil = hooked.get_depth_stencil_surface();
+				CHECK(is_application_surface(depthstencil.get()));
+				CHECK(depthstencil == counted_surface() || depthstencil == nullptr);
+				break;
+			}
+			case 2:
+				hooked.set_render_target(0, render_targets[random(2)]);
+				break;
+			case 3:
+			{
+				com_ptr<IDirect3DSurface9> render_target;
+				device->GetRenderTarget(0, &render_target);
+				D3DSURFACE_DESC desc;
+				render_target->GetDesc(&desc);
+				const DWORD x = random(desc.Width / 2), y = random(desc.Height / 2);
+				hooked.set_viewport({ x, y, 1 + random(desc.Width - x), 1 + random(desc.Height - y), 0.0f, 1.0f });
+				break;
+			}
+			case 4:
+			{
+				// Clearing depth or stencil needs a depth-stencil surface
+				com_ptr<IDirect3DSurface9> bound;
+				device->GetDepthStencilSurface(&bound);
+				const DWORD flags[] = { D3DCLEAR_TARGET, D3DCLEAR_ZBUFFER, D3DCLEAR_ZBUFFER | D3DCLEAR_STENCIL, D3DCLEAR_TARGET | D3DCLEAR_ZBUFFER, D3DCLEAR_STENCIL };
+				hooked.clear(flags[bound != nullptr ? random(5) : 0]);
+				break;
+			}
+			case 5:
+			{
+				const D3DSTATEBLOCKTYPE type = random(2) ? D3DSBT_ALL : D3DSBT_PIXELSTATE;
+				state_blocks.push_back(hooked.create_state_block(type));
+				break;
+			}
+			case 6:
+			{
+				hooked.begin_state_block();
+				if (random(2))
+					hooked.set_viewport({ random(64), random(64), 64 + random(512), 64 + random(256), 0.0f, 1.0f });
+				state_blocks.push_back(hooked.end_state_block());
+				break;
+			}
+			case 7:
+				// Not hooked, so the tracked viewport cannot know about it
+				if (!state_blocks.empty())
+					state_blocks[random(static_cast<UINT>(state_blocks.size()))]->Apply();
+				break;
+			default:
+			{
+				const D3DPRIMITIVETYPE type = static_cast<D3DPRIMITIVETYPE>(D3DPT_POINTLIST + random(6));
+				const UINT primitives = 1 + random(1000);
+				hooked.detection.on_draw(type, primitives);
+
+				const UINT vertices = vertices_of(type, primitives);
+				expected_total.vertices += vertices;
+				expected_total.drawcalls += 1;
+				draws++;
+
+				const com_ptr<IDirect3DSurface9> surface = counted_surface();
+				if (surface == nullptr)
+					break;
+
+				com_ptr<IDirect3DSurface9> bound;
+				device->GetDepthStencilSurface(&bound);
+				replaced_draws += bound != surface;
+
+				buffer_detection::draw_stats &stats = expected[surface.get()];
+				stats.vertices += vertices;
+				stats.drawcalls += 1;
+
+				const auto &counters = hooked.detection.depth_buffer_counters();
+				const auto it = counters.find(surface);
+				CHECK(it != counters.end());
+				if (it == counters.end())
+					break;
+				CHECK(it->second.total_stats.vertices == stats.vertices && it->second.total_stats.drawcalls == stats.drawcalls);
+
+				if (preserve_depth_buffers)
+				{
+					D3DVIEWPORT9 viewport;
+					device->GetViewport(&viewport);
+					CHECK(std::memcmp(&it->second.current_stats.viewport, &viewport, sizeof(viewport)) == 0);
+				}
+				break;
+			}
+			}
+
+			if (state_blocks.size() > 8)
+				state_blocks.erase(state_blocks.begin() + random(static_cast<UINT>(state_blocks.size())));
+		}
+
+		CHECK(hooked.detection.total_vertices() == expected_total.vertices && hooked.detection.total_drawcalls() == expected_total.drawcalls);
+
+		if (frame % 100 == 99)
+		{
+			// Resetting the device binds the back buffer and the automatic depth-stencil surface again, without going through the hooks
+			hooked.detection.reset(true);
+			state_blocks.clear();
+			device->SetRenderTarget(0, back_buffer.get());
+			device->SetDepthStencilSurface(auto_depthstencil.get());
+		}
+		else
+		{
+			// Like runtime_d3d9::on_present, with the override set to a different surface now and then
+			hooked.detection.find_best_depth_surface(1280, 720, depthstencils[(frame / 50) % (depthstencils.size() - 1)]);
+			hooked.detection.reset(false);
+		}
+		expected.clear();
+		expected_total = {};
+	}
+
+	// Releasing the replacements puts the original surface back
+	hooked.detection.reset(true);
+	com_ptr<IDirect3DSurface9> bound;
+	device->GetDepthStencilSurface(&bound);
+	CHECK(is_application_surface(bound.get()));
+
+	printf("%s depth buffers: %zu draws, %zu of them with a replacement bound\n", preserve_depth_buffers ? "preserving" : "not preserving", draws, replaced_draws);
+
+	state_blocks.clear();
+	device->SetRenderTarget(0, back_buffer.get());
+	device->SetDepthStencilSurface(auto_depthstencil.get());
+}
+
+int main()
+{
+	const HWND window = CreateWindowExA(0, "STATIC", "buffer_detection_test", WS_OVERLAPPEDWINDOW, 0, 0, 1280, 720, nullptr, nullptr, nullptr, nullptr);
+
+	com_ptr<IDirect3D9> d3d(Direct3DCreate9(D3D_SDK_VERSION), true);
+	if (d3d == nullptr)
+	{
+		printf("Could not create the Direct3D 9 object\n");
+		return 1;
+	}
+
+	D3DPRESENT_PARAMETERS pp = {};
+	pp.BackBufferWidth = 1280;
+	pp.BackBufferHeight = 720;
+	pp.BackBufferFormat = D3DFMT_X8R8G8B8;
+	pp.SwapEffect = D3DSWAPEFFECT_DISCARD;
+	pp.hDeviceWindow = window;
+	pp.Windowed = TRUE;
+	pp.EnableAutoDepthStencil = TRUE;
+	pp.AutoDepthStencilFormat = D3DFMT_D24S8;
+
+	com_ptr<IDirect3DDevice9> device;
+	if (FAILED(d3d->CreateDevice(D3DADAPTER_DEFAULT, D3DDEVTYPE_HAL, window, D3DCREATE_SOFTWARE_VERTEXPROCESSING, &pp, &device)))
+	{
+		printf("Could not create a Direct3D 9 device\n");
+		return 1;
+	}
+
+	for (unsigned int seed = 1; seed <= 4; ++seed)
+	{
+		run(device.get(), false, seed);
+		run(device.get(), true, seed);
+	}
+
+	device.reset();
+	d3d.reset();
+	DestroyWindow(window);
+
+	if (failures == 0)
+		printf("All buffer detection checks passed\n");
+	return failures != 0;
+}
@@ -21,6 +21,9 @@
 #include "d3d9wrapper.h"
 #include "d3dx9.h"
 #include "Resource.h"
+#include "Common\Utils.h"
+#include "Common\ShaderCache.h"
+#include "ReShade\Runtime\texture_aliasing.hpp"
 
 namespace reshade::d3d9
 {
@@ -28,15 +31,22 @@ namespace reshade::d3d9
 	{
 		com_ptr<IDirect3DTexture9> texture;
 		com_ptr<IDirect3DSurface9> surface;
+		// Creation parameters, so that the texture can be created again when it stops sharing memory with other transient textures
+		UINT levels = 0;
+		DWORD usage = 0;
+		D3DFORMAT format = D3DFMT_UNKNOWN;
+		bool aliased = false;
 	};
 
 	struct d3d9_pass_data
 	{
-		com_ptr<IDirect3DStateBlock9> stateblock;
+		std::vector<std::pair<D3DRENDERSTATETYPE, DWORD>> render_states;
 		com_ptr<IDirect3DPixelShader9> pixel_shader;
 		com_ptr<IDirect3DVertexShader9> vertex_shader;
 		IDirect3DSurface9 *render_targets[8] = {};
 		IDirect3DTexture9 *sampler_textures[16] = {};
+		DWORD sampler_mask = 0xFFFF; // Samplers declared by the vertex or pixel shader
+		bool discards = true; // Pixel shader uses 'discard' or 'clip'
 	};
 
 	struct d3d9_technique_data
@@ -49,6 +59,91 @@ namespace reshade::d3d9
 	};
 }
 
+// Find the samplers a shader declares and whether it can discard pixels, by walking the instruction tokens of the compiled byte code
+static void scan_shader_bytecode(const std::vector<BYTE> &bytecode, DWORD &sampler_mask, bool &discards)
+{
+	const DWORD *token = reinterpret_cast<const DWORD *>(bytecode.data()) + 1; // Skip version token
+	const DWORD *const end = reinterpret_cast<const DWORD *>(bytecode.data()) + bytecode.size() / sizeof(DWORD);
+
+	for (; token < end && *token != D3DSIO_END; ++token)
+	{
+		const DWORD opcode = *token & D3DSI_OPCODE_MASK;
+		const DWORD length = opcode == D3DSIO_COMMENT ?
+			(*token & D3DSI_COMMENTSIZE_MASK) >> D3DSI_COMMENTSIZE_SHIFT :
+			(*token & D3DSI_INSTLENGTH_MASK) >> D3DSI_INSTLENGTH_SHIFT;
+		if (token + length >= end)
+			break; // Truncated instruction
+
+		if (opcode == D3DSIO_DCL && length == 2)
+		{
+			const DWORD param = token[2];
+			const DWORD type = ((param & D3DSP_REGTYPE_MASK) >> D3DSP_REGTYPE_SHIFT) | ((param & D3DSP_REGTYPE_MASK2) >> D3DSP_REGTYPE_SHIFT2);
+			if (type == D3DSPR_SAMPLER)
+				sampler_mask |= 1 << (param & D3DSP_REGNUM_MASK);
+		}
+		else if (opcode == D3DSIO_TEXKILL)
+		{
+			discards = true;
+		}
+
+		token += length;
+	}
+
+	// Assume the worst if the byte code could not be walked to the end
+	if (token >= end || *token != D3DSIO_END)
+	{
+		sampler_mask = 0xFFFF;
+		discards = true;
+	}
+}
+
+static size_t texture_memory_size(UINT width, UINT height, UINT levels, D3DFORMAT format)
+{
+	size_t bytes_per_pixel = 4;
+	switch (format)
+	{
+	case D3DFMT_R16F:
+		bytes_per_pixel = 2;
+		break;
+	case D3DFMT_G32R32F:
+	case D3DFMT_A16B16G16R16:
+	case D3DFMT_A16B16G16R16F:
+		bytes_per_pixel = 8;
+		break;
+	case D3DFMT_A32B32G32R32F:
+		bytes_per_pixel = 16;
+		break;
+	}
+
+	// Zero levels means a full mipmap chain (used for auto-generated mipmaps)
+	size_t size = 0;
+	for (UINT level = 0; levels == 0 || level < levels; ++level)
+	{
+		size += static_cast<size_t>(width) * height * bytes_per_pixel;
+		if (width == 1 && height == 1)
+			break;
+		width = std::max(width / 2, 1u);
+		height = std::max(height / 2, 1u);
+	}
+	return size;
+}
+
+// Compiled shaders are stored next to the game executable, so they survive restarts as well as device resets
+static ShaderCache &get_shader_cache()
+{
+	static ShaderCache cache = []() {
+		std::filesystem::path path;
+		if (wchar_t sh2_path[MAX_PATH] = {}; GetSH2FolderPath(sh2_path, MAX_PATH))
+		{
+			if (wchar_t *pdest = wcsrchr(sh2_path, L'\\'))
+				*pdest = L'\0';
+			path = std::filesystem::path(sh2_path) / L"cache" / L"shaders";
+		}
+		return ShaderCache(path, static_cast<size_t>(std::max(ShaderCacheSizeMB, 0)) * 1024 * 1024);
+	}();
+	return cache;
+}
+
 reshade::d3d9::runtime_d3d9::runtime_d3d9(IDirect3DDevice9 *device, IDirect3DSwapChain9 *swapchain, buffer_detection *bdc) :
 	_device(device), _swapchain(swapchain), _buffer_detection(bdc),
 	_app_state(device)
@@ -207,8 +302,10 @@ void reshade::d3d9::runtime_d3d9::on_present()
 	_buffer_detection->disable_intz = _disable_intz;
 
 	update_depth_texture_bindings(_buffer_detection->find_best_depth_surface(_filter_aspect_ratio ? _width : 0, _height, _depth_surface_override));
+	update_texture_aliases();
 
 	_app_state.capture();
+	_constants_effect_index = std::numeric_limits<size_t>::max(); // The application has been setting its own constants since the last frame
 	BOOL software_rendering_enabled = FALSE;
 	if ((_behavior_flags & D3DCREATE_MIXED_VERTEXPROCESSING) != 0)
 	{
@@ -261,12 +358,13 @@ bool reshade::d3d9::runtime_d3d9::init_effect(size_t index)
 	const std::string hlsl_ps = effect.preamble + "#define POSITION VPOS\n" + effect.module.hlsl;
 
 	std::unordered_map<std::string, com_ptr<IUnknown>> entry_points;
+	std::unordered_map<std::string, std::pair<DWORD, bool>> entry_point_usage; // Samplers declared and whether pixels can be discarded
+
+	const UINT compile_flags = _performance_mode ? D3DCOMPILE_OPTIMIZATION_LEVEL3 : D3DCOMPILE_OPTIMIZATION_LEVEL1;
 
 	// Compile the generated HLSL source code to DX byte code
-	DWORD loop_count = 0;
 	for (const reshadefx::entry_point &entry_point : effect.module.entry_points)
 	{
-		DWORD entry_index = (index << 16) + loop_count;
 		size_t hlsl_size = 0;
 		const char *profile = nullptr, *hlsl = nullptr;
 		com_ptr<ID3DBlob> compiled, d3d_errors;
@@ -293,14 +391,18 @@ bool reshade::d3d9::runtime_d3d9::init_effect(size_t index)
 
 		HRESULT hr = D3D_OK;
 
-		if (_compile_cache[entry_index].size() == 0)
+		// Key by the source that is actually compiled, since it changes with resolution and performance mode
+		const uint64_t cache_key = ShaderCache::MakeKey(hlsl, hlsl_size, entry_point.name.c_str(), profile, compile_flags);
+		std::vector<BYTE> &bytecode = _compile_cache[cache_key];
+
+		if (bytecode.empty() && !(EnableShaderCache && get_shader_cache().Load(cache_key, bytecode)))
 		{
 			hr = D3DCompile(
 				hlsl, hlsl_size,
 				nullptr, nullptr, nullptr,
 				entry_point.name.c_str(),
 				profile,
-				_performance_mode ? D3DCOMPILE_OPTIMIZATION_LEVEL3 : D3DCOMPILE_OPTIMIZATION_LEVEL1, 0,
+				compile_flags, 0,
 				&compiled, &d3d_errors);
 
 			if (d3d_errors != nullptr) // Append warnings to the output error string as well
@@ -324,17 +426,18 @@ bool reshade::d3d9::runtime_d3d9::init_effect(size_t index)
 				Logging::Log() << "Error: Failed to failed to disassemble shader! HRESULT is: " << (D3DERR)hr << '.';
 			}
 
-			// Cashe shader
-			_compile_cache[entry_index].resize(compiled->GetBufferSize());
-			memcpy(&_compile_cache[entry_index][0], compiled->GetBufferPointer(), compiled->GetBufferSize());
+			// Cache shader
+			bytecode.assign(static_cast<const BYTE *>(compiled->GetBufferPointer()), static_cast<const BYTE *>(compiled->GetBufferPointer()) + compiled->GetBufferSize());
 
-			compiled_buffer = compiled->GetBufferPointer();
-		}
-		else
-		{
-			compiled_buffer = &_compile_cache[entry_index][0];
+			if (EnableShaderCache)
+				get_shader_cache().Store(cache_key, bytecode);
 		}
 
+		compiled_buffer = bytecode.data();
+
+		auto &[sampler_mask, discards] = entry_point_usage[entry_point.name];
+		scan_shader_bytecode(bytecode, sampler_mask, discards);
+
 		// Create runtime shader objects from the compiled DX byte code
 		switch (entry_point.type)
 		{
@@ -351,8 +454,6 @@ bool reshade::d3d9::runtime_d3d9::init_effect(size_t index)
 			Logging::Log() << "Error: Failed to create shader for entry point '" << entry_point.name << "'! HRESULT is " << (D3DERR)hr << '.';
 			return false;
 		}
-
-		++loop_count;
 	}
 
 	d3d9_technique_data technique_init;
@@ -412,6 +513,9 @@ bool reshade::d3d9::runtime_d3d9::init_effect(size_t index)
 			entry_points.at(pass_info.ps_entry_point)->QueryInterface(&pass_data.pixel_shader);
 			entry_points.at(pass_info.vs_entry_point)->QueryInterface(&pass_data.vertex_shader);
 
+			pass_data.sampler_mask = entry_point_usage.at(pass_info.vs_entry_point).first | entry_point_usage.at(pass_info.ps_entry_point).first;
+			pass_data.discards = entry_point_usage.at(pass_info.ps_entry_point).second;
+
 			pass_data.render_targets[0] = _backbuffer_resolved.get();
 
 			for (UINT k = 0; k < ARRAYSIZE(pass_data.sampler_textures); ++k)
@@ -436,12 +540,7 @@ bool reshade::d3d9::runtime_d3d9::init_effect(size_t index)
 				pass_data.render_targets[k] = tex_impl->surface.get();
 			}
 
-			HRESULT hr = _device->BeginStateBlock();
-			if (SUCCEEDED(hr))
-			{
-				_device->SetVertexShader(pass_data.vertex_shader.get());
-				_device->SetPixelShader(pass_data.pixel_shader.get());
-
+			{ // Render states are applied through '_app_state' in 'render_technique', so that only the ones changed are saved and restored
 				const auto convert_blend_op = [](reshadefx::pass_blend_op value) {
 					switch (value)
 					{
@@ -498,51 +597,51 @@ bool reshade::d3d9::runtime_d3d9::init_effect(size_t index)
 					}
 				};
 
-				_device->SetRenderState(D3DRS_ZENABLE, FALSE);
-				_device->SetRenderState(D3DRS_FILLMODE, D3DFILL_SOLID);
+				pass_data.render_states.emplace_back(D3DRS_ZENABLE, FALSE);
+				pass_data.render_states.emplace_back(D3DRS_FILLMODE, D3DFILL_SOLID);
 				// D3DRS_SHADEMODE
-				_device->SetRenderState(D3DRS_ZWRITEENABLE, TRUE);
-				_device->SetRenderState(D3DRS_ALPHATESTENABLE, FALSE);
-				_device->SetRenderState(D3DRS_LASTPIXEL, TRUE);
-				_device->SetRenderState(D3DRS_SRCBLEND, convert_blend_func(pass_info.src_blend));
-				_device->SetRenderState(D3DRS_DESTBLEND, convert_blend_func(pass_info.dest_blend));
-				_device->SetRenderState(D3DRS_CULLMODE, D3DCULL_NONE);
-				_device->SetRenderState(D3DRS_ZFUNC, D3DCMP_ALWAYS);
+				pass_data.render_states.emplace_back(D3DRS_ZWRITEENABLE, TRUE);
+				pass_data.render_states.emplace_back(D3DRS_ALPHATESTENABLE, FALSE);
+				pass_data.render_states.emplace_back(D3DRS_LASTPIXEL, TRUE);
+				pass_data.render_states.emplace_back(D3DRS_SRCBLEND, convert_blend_func(pass_info.src_blend));
+				pass_data.render_states.emplace_back(D3DRS_DESTBLEND, convert_blend_func(pass_info.dest_blend));
+				pass_data.render_states.emplace_back(D3DRS_CULLMODE, D3DCULL_NONE);
+				pass_data.render_states.emplace_back(D3DRS_ZFUNC, D3DCMP_ALWAYS);
 				// D3DRS_ALPHAREF
 				// D3DRS_ALPHAFUNC
-				_device->SetRenderState(D3DRS_DITHERENABLE, FALSE);
-				_device->SetRenderState(D3DRS_ALPHABLENDENABLE, pass_info.blend_enable);
-				_device->SetRenderState(D3DRS_FOGENABLE, FALSE);
-				_device->SetRenderState(D3DRS_SPECULARENABLE, FALSE);
+				pass_data.render_states.emplace_back(D3DRS_DITHERENABLE, FALSE);
+				pass_data.render_states.emplace_back(D3DRS_ALPHABLENDENABLE, pass_info.blend_enable);
+				pass_data.render_states.emplace_back(D3DRS_FOGENABLE, FALSE);
+				pass_data.render_states.emplace_back(D3DRS_SPECULARENABLE, FALSE);
 				// D3DRS_FOGCOLOR
 				// D3DRS_FOGTABLEMODE
 				// D3DRS_FOGSTART
 				// D3DRS_FOGEND
 				// D3DRS_FOGDENSITY
 				// D3DRS_RANGEFOGENABLE
-				_device->SetRenderState(D3DRS_STENCILENABLE, pass_info.stencil_enable);
-				_device->SetRenderState(D3DRS_STENCILFAIL, convert_stencil_op(pass_info.stencil_op_fail));
-				_device->SetRenderState(D3DRS_STENCILZFAIL, convert_stencil_op(pass_info.stencil_op_depth_fail));
-				_device->SetRenderState(D3DRS_STENCILPASS, convert_stencil_op(pass_info.stencil_op_pass));
-				_device->SetRenderState(D3DRS_STENCILFUNC, convert_stencil_func(pass_info.stencil_comparison_func));
-				_device->SetRenderState(D3DRS_STENCILREF, pass_info.stencil_reference_value);
-				_device->SetRenderState(D3DRS_STENCILMASK, pass_info.stencil_read_mask);
-				_device->SetRenderState(D3DRS_STENCILWRITEMASK, pass_info.stencil_write_mask);
+				pass_data.render_states.emplace_back(D3DRS_STENCILENABLE, pass_info.stencil_enable);
+				pass_data.render_states.emplace_back(D3DRS_STENCILFAIL, convert_stencil_op(pass_info.stencil_op_fail));
+				pass_data.render_states.emplace_back(D3DRS_STENCILZFAIL, convert_stencil_op(pass_info.stencil_op_depth_fail));
+				pass_data.render_states.emplace_back(D3DRS_STENCILPASS, convert_stencil_op(pass_info.stencil_op_pass));
+				pass_data.render_states.emplace_back(D3DRS_STENCILFUNC, convert_stencil_func(pass_info.stencil_comparison_func));
+				pass_data.render_states.emplace_back(D3DRS_STENCILREF, pass_info.stencil_reference_value);
+				pass_data.render_states.emplace_back(D3DRS_STENCILMASK, pass_info.stencil_read_mask);
+				pass_data.render_states.emplace_back(D3DRS_STENCILWRITEMASK, pass_info.stencil_write_mask);
 				// D3DRS_TEXTUREFACTOR
 				// D3DRS_WRAP0 - D3DRS_WRAP7
-				_device->SetRenderState(D3DRS_CLIPPING, FALSE);
-				_device->SetRenderState(D3DRS_LIGHTING, FALSE);
+				pass_data.render_states.emplace_back(D3DRS_CLIPPING, FALSE);
+				pass_data.render_states.emplace_back(D3DRS_LIGHTING, FALSE);
 				// D3DRS_AMBIENT
 				// D3DRS_FOGVERTEXMODE
-				_device->SetRenderState(D3DRS_COLORVERTEX, FALSE);
+				pass_data.render_states.emplace_back(D3DRS_COLORVERTEX, FALSE);
 				// D3DRS_LOCALVIEWER
-				_device->SetRenderState(D3DRS_NORMALIZENORMALS, FALSE);
-				_device->SetRenderState(D3DRS_DIFFUSEMATERIALSOURCE, D3DMCS_COLOR1);
-				_device->SetRenderState(D3DRS_SPECULARMATERIALSOURCE, D3DMCS_COLOR2);
-				_device->SetRenderState(D3DRS_AMBIENTMATERIALSOURCE, D3DMCS_MATERIAL);
-				_device->SetRenderState(D3DRS_EMISSIVEMATERIALSOURCE, D3DMCS_MATERIAL);
-				_device->SetRenderState(D3DRS_VERTEXBLEND, D3DVBF_DISABLE);
-				_device->SetRenderState(D3DRS_CLIPPLANEENABLE, 0);
+				pass_data.render_states.emplace_back(D3DRS_NORMALIZENORMALS, FALSE);
+				pass_data.render_states.emplace_back(D3DRS_DIFFUSEMATERIALSOURCE, D3DMCS_COLOR1);
+				pass_data.render_states.emplace_back(D3DRS_SPECULARMATERIALSOURCE, D3DMCS_COLOR2);
+				pass_data.render_states.emplace_back(D3DRS_AMBIENTMATERIALSOURCE, D3DMCS_MATERIAL);
+				pass_data.render_states.emplace_back(D3DRS_EMISSIVEMATERIALSOURCE, D3DMCS_MATERIAL);
+				pass_data.render_states.emplace_back(D3DRS_VERTEXBLEND, D3DVBF_DISABLE);
+				pass_data.render_states.emplace_back(D3DRS_CLIPPLANEENABLE, 0);
 				// D3DRS_POINTSIZE
 				// D3DRS_POINTSIZE_MIN
 				// D3DRS_POINTSPRITEENABLE
@@ -554,42 +653,34 @@ bool reshade::d3d9::runtime_d3d9::init_effect(size_t index)
 				// D3DRS_DEBUGMONITORTOKEN
 				// D3DRS_POINTSIZE_MAX
 				// D3DRS_INDEXEDVERTEXBLENDENABLE
-				_device->SetRenderState(D3DRS_COLORWRITEENABLE, pass_info.color_write_mask);
+				pass_data.render_states.emplace_back(D3DRS_COLORWRITEENABLE, pass_info.color_write_mask);
 				// D3DRS_TWEENFACTOR
-				_device->SetRenderState(D3DRS_BLENDOP, convert_blend_op(pass_info.blend_op));
+				pass_data.render_states.emplace_back(D3DRS_BLENDOP, convert_blend_op(pass_info.blend_op));
 				// D3DRS_POSITIONDEGREE
 				// D3DRS_NORMALDEGREE
-				_device->SetRenderState(D3DRS_SCISSORTESTENABLE, FALSE);
-				_device->SetRenderState(D3DRS_SLOPESCALEDEPTHBIAS, 0);
-				_device->SetRenderState(D3DRS_ANTIALIASEDLINEENABLE, FALSE);
+				pass_data.render_states.emplace_back(D3DRS_SCISSORTESTENABLE, FALSE);
+				pass_data.render_states.emplace_back(D3DRS_SLOPESCALEDEPTHBIAS, 0);
+				pass_data.render_states.emplace_back(D3DRS_ANTIALIASEDLINEENABLE, FALSE);
 				// D3DRS_MINTESSELLATIONLEVEL
 				// D3DRS_MAXTESSELLATIONLEVEL
 				// D3DRS_ADAPTIVETESS_X - D3DRS_ADAPTIVETESS_W
-				_device->SetRenderState(D3DRS_ENABLEADAPTIVETESSELLATION, FALSE);
-				_device->SetRenderState(D3DRS_TWOSIDEDSTENCILMODE, FALSE);
+				pass_data.render_states.emplace_back(D3DRS_ENABLEADAPTIVETESSELLATION, FALSE);
+				pass_data.render_states.emplace_back(D3DRS_TWOSIDEDSTENCILMODE, FALSE);
 				// D3DRS_CCW_STENCILFAIL
 				// D3DRS_CCW_STENCILZFAIL
 				// D3DRS_CCW_STENCILPASS
 				// D3DRS_CCW_STENCILFUNC
-				_device->SetRenderState(D3DRS_COLORWRITEENABLE1, pass_info.color_write_mask); // See https://docs.microsoft.com/en-us/windows/win32/direct3d9/multiple-render-targets
-				_device->SetRenderState(D3DRS_COLORWRITEENABLE2, pass_info.color_write_mask);
-				_device->SetRenderState(D3DRS_COLORWRITEENABLE3, pass_info.color_write_mask);
-				_device->SetRenderState(D3DRS_BLENDFACTOR, 0xFFFFFFFF);
-				_device->SetRenderState(D3DRS_SRGBWRITEENABLE, pass_info.srgb_write_enable);
-				_device->SetRenderState(D3DRS_DEPTHBIAS, 0);
+				pass_data.render_states.emplace_back(D3DRS_COLORWRITEENABLE1, pass_info.color_write_mask); // See https://docs.microsoft.com/en-us/windows/win32/direct3d9/multiple-render-targets
+				pass_data.render_states.emplace_back(D3DRS_COLORWRITEENABLE2, pass_info.color_write_mask);
+				pass_data.render_states.emplace_back(D3DRS_COLORWRITEENABLE3, pass_info.color_write_mask);
+				pass_data.render_states.emplace_back(D3DRS_BLENDFACTOR, 0xFFFFFFFF);
+				pass_data.render_states.emplace_back(D3DRS_SRGBWRITEENABLE, pass_info.srgb_write_enable);
+				pass_data.render_states.emplace_back(D3DRS_DEPTHBIAS, 0);
 				// D3DRS_WRAP8 - D3DRS_WRAP15
-				_device->SetRenderState(D3DRS_SEPARATEALPHABLENDENABLE, TRUE);
-				_device->SetRenderState(D3DRS_SRCBLENDALPHA, convert_blend_func(pass_info.src_blend_alpha));
-				_device->SetRenderState(D3DRS_DESTBLENDALPHA, convert_blend_func(pass_info.dest_blend_alpha));
-				_device->SetRenderState(D3DRS_BLENDOPALPHA, convert_blend_op(pass_info.blend_op_alpha));
-
-				hr = _device->EndStateBlock(&pass_data.stateblock);
-			}
-
-			if (FAILED(hr))
-			{
-				Logging::Log() << "Error: Failed to create state block for pass " << pass_index << " in technique '" << technique.name << "'! HRESULT is " << (D3DERR)hr << '.';
-				return false;
+				pass_data.render_states.emplace_back(D3DRS_SEPARATEALPHABLENDENABLE, TRUE);
+				pass_data.render_states.emplace_back(D3DRS_SRCBLENDALPHA, convert_blend_func(pass_info.src_blend_alpha));
+				pass_data.render_states.emplace_back(D3DRS_DESTBLENDALPHA, convert_blend_func(pass_info.dest_blend_alpha));
+				pass_data.render_states.emplace_back(D3DRS_BLENDOPALPHA, convert_blend_op(pass_info.blend_op_alpha));
 			}
 		}
 	}
@@ -613,6 +704,9 @@ bool reshade::d3d9::runtime_d3d9::init_effect(size_t index)
 		_max_vertices = max_vertices;
 	}
 
+	// The new techniques are rendered right away, so plan texture memory with their passes now
+	update_texture_aliases();
+
 	return true;
 }
 void reshade::d3d9::runtime_d3d9::unload_effect(size_t index)
@@ -626,6 +720,8 @@ void reshade::d3d9::runtime_d3d9::unload_effect(size_t index)
 		tech.impl = nullptr;
 	}
 
+	_texture_aliases_dirty = true;
+
 	runtime::unload_effect(index);
 }
 void reshade::d3d9::runtime_d3d9::unload_effects()
@@ -636,6 +732,8 @@ void reshade::d3d9::runtime_d3d9::unload_effects()
 		tech.impl = nullptr;
 	}
 
+	_texture_aliases_dirty = true;
+
 	runtime::unload_effects();
 }
 
@@ -729,19 +827,32 @@ bool reshade::d3d9::runtime_d3d9::init_texture(texture &texture)
 		}
 	}
 
-	HRESULT hr = _device->CreateTexture(texture.width, texture.height, levels, usage, format, D3DPOOL_DEFAULT, &impl->texture, nullptr);
+	impl->levels = levels;
+	impl->usage = usage;
+	impl->format = format;
+
+	_texture_aliases_dirty = true;
+
+	return create_texture(texture, impl);
+}
+bool reshade::d3d9::runtime_d3d9::create_texture(const texture &texture, d3d9_tex_data *impl)
+{
+	com_ptr<IDirect3DTexture9> d3d_texture;
+	HRESULT hr = _device->CreateTexture(texture.width, texture.height, impl->levels, impl->usage, impl->format, D3DPOOL_DEFAULT, &d3d_texture, nullptr);
 	if (FAILED(hr))
 	{
 		Logging::Log() << "Error: Failed to create texture '" << texture.unique_name << "'! HRESULT is " << (D3DERR)hr << '.';
-		Logging::Log() << "> Details: Width = " << texture.width << ", Height = " << texture.height << ", Levels = " << levels << ", Usage = " << usage << ", Format = " << format;
+		Logging::Log() << "> Details: Width = " << texture.width << ", Height = " << texture.height << ", Levels = " << impl->levels << ", Usage = " << impl->usage << ", Format = " << impl->format;
 		return false;
 	}
 
+	impl->texture = std::move(d3d_texture);
+	impl->surface.reset();
 	hr = impl->texture->GetSurfaceLevel(0, &impl->surface);
 	assert(SUCCEEDED(hr));
 
 	// Clear texture to zero since by default its contents are undefined
-	if (usage & D3DUSAGE_RENDERTARGET)
+	if (impl->usage & D3DUSAGE_RENDERTARGET)
 		_device->ColorFill(impl->surface.get(), nullptr, D3DCOLOR_ARGB(0, 0, 0, 0));
 
 	return true;
@@ -808,6 +919,8 @@ void reshade::d3d9::runtime_d3d9::destroy_texture(texture &texture)
 {
 	delete static_cast<d3d9_tex_data *>(texture.impl);
 	texture.impl = nullptr;
+
+	_texture_aliases_dirty = true;
 }
 
 void reshade::d3d9::runtime_d3d9::render_technique(technique &technique)
@@ -815,15 +928,28 @@ void reshade::d3d9::runtime_d3d9::render_technique(technique &technique)
 	const auto impl = static_cast<d3d9_technique_data *>(technique.impl);
 
 	// Setup vertex input (used to have a vertex ID as vertex shader input)
-	_device->SetStreamSource(0, _effect_vertex_buffer.get(), 0, sizeof(float));
-	_device->SetVertexDeclaration(_effect_vertex_layout.get());
+	_app_state.set_stream_source(_effect_vertex_buffer.get(), 0, sizeof(float));
+	_app_state.set_vertex_declaration(_effect_vertex_layout.get());
 
 	// Setup shader constants
 	if (impl->constant_register_count != 0)
 	{
-		const auto uniform_storage_data = reinterpret_cast<const float *>(_effects[technique.effect_index].uniform_data_storage.data());
-		_device->SetPixelShaderConstantF(0, uniform_storage_data, impl->constant_register_count);
-		_device->SetVertexShaderConstantF(0, uniform_storage_data, impl->constant_register_count);
+		effect &effect = _effects[technique.effect_index];
+
+		// Registers still hold the values of the last effect that was rendered, so when that was this one only what changed since then needs to be uploaded
+		// Register 255 is overwritten with the texel size below, so effects reaching it always upload everything
+		size_t first_register, register_count;
+		effect.take_dirty_registers(first_register, register_count);
+		if (_constants_effect_index != technique.effect_index || impl->constant_register_count > 255)
+			first_register = 0, register_count = impl->constant_register_count;
+		_constants_effect_index = technique.effect_index;
+
+		if (register_count != 0)
+		{
+			const auto uniform_storage_data = reinterpret_cast<const float *>(effect.uniform_data_storage.data()) + first_register * 4;
+			_app_state.set_pixel_shader_constant_f(static_cast<UINT>(first_register), uniform_storage_data, static_cast<UINT>(register_count));
+			_app_state.set_vertex_shader_constant_f(static_cast<UINT>(first_register), uniform_storage_data, static_cast<UINT>(register_count));
+		}
 	}
 
 	bool is_effect_stencil_cleared = false;
@@ -841,34 +967,37 @@ void reshade::d3d9::runtime_d3d9::render_technique(technique &technique)
 		const reshadefx::pass_info &pass_info = technique.passes[pass_index];
 
 		// Setup state
-		pass_data.stateblock->Apply();
+		_app_state.set_vertex_shader(pass_data.vertex_shader.get());
+		_app_state.set_pixel_shader(pass_data.pixel_shader.get());
+		for (const auto &[state, value] : pass_data.render_states)
+			_app_state.set_render_state(state, value);
 
 		// Setup shader resources
 		for (DWORD s = 0; s < impl->num_samplers; s++)
 		{
-			_device->SetTexture(s, pass_data.sampler_textures[s]);
+			_app_state.set_texture(s, pass_data.sampler_textures[s]);
 
 			// Need to bind textures to vertex shader samplers too
 			// See https://docs.microsoft.com/windows/win32/direct3d9/vertex-textures-in-vs-3-0
 			if (s < 4)
-				_device->SetTexture(D3DVERTEXTEXTURESAMPLER0 + s, pass_data.sampler_textures[s]);
+				_app_state.set_texture(D3DVERTEXTEXTURESAMPLER0 + s, pass_data.sampler_textures[s]);
 
 			for (DWORD state = D3DSAMP_ADDRESSU; state <= D3DSAMP_SRGBTEXTURE; state++)
 			{
-				_device->SetSamplerState(s, static_cast<D3DSAMPLERSTATETYPE>(state), impl->sampler_states[s][state]);
+				_app_state.set_sampler_state(s, static_cast<D3DSAMPLERSTATETYPE>(state), impl->sampler_states[s][state]);
 
 				if (s < 4) // vs_3_0 supports up to four samplers in vertex shaders
-					_device->SetSamplerState(D3DVERTEXTEXTURESAMPLER0 + s, static_cast<D3DSAMPLERSTATETYPE>(state), impl->sampler_states[s][state]);
+					_app_state.set_sampler_state(D3DVERTEXTEXTURESAMPLER0 + s, static_cast<D3DSAMPLERSTATETYPE>(state), impl->sampler_states[s][state]);
 			}
 		}
 
 		// Setup render targets (and viewport, which is implicitly updated by 'SetRenderTarget')
 		for (DWORD target = 0; target < _num_simultaneous_rendertargets; target++)
-			_device->SetRenderTarget(target, pass_data.render_targets[target]);
+			_app_state.set_render_target(target, pass_data.render_targets[target]);
 
 		D3DVIEWPORT9 viewport;
 		_device->GetViewport(&viewport);
-		_device->SetDepthStencilSurface(viewport.Width == _width && viewport.Height == _height && pass_info.stencil_enable ? _effect_stencil.get() : nullptr);
+		_app_state.set_depth_stencil_surface(viewport.Width == _width && viewport.Height == _height && pass_info.stencil_enable ? _effect_stencil.get() : nullptr);
 
 		if (pass_info.stencil_enable && viewport.Width == _width && viewport.Height == _height && !is_effect_stencil_cleared)
 		{
@@ -886,7 +1015,7 @@ void reshade::d3d9::runtime_d3d9::render_technique(technique &technique)
 			-1.0f / viewport.Width,
 			 1.0f / viewport.Height
 		};
-		_device->SetVertexShaderConstantF(255, texel_size, 1);
+		_app_state.set_vertex_shader_constant_f(255, texel_size, 1);
 
 		// Draw primitives
 		UINT primitive_count = pass_info.num_vertices;
@@ -990,3 +1119,142 @@ void reshade::d3d9::runtime_d3d9::update_depth_texture_bindings(com_ptr<IDirect3
 		tex_impl->surface = _depth_surface;
 	}
 }
+
+void reshade::d3d9::runtime_d3d9::update_texture_aliases()
+{
+	// Passes are rendered in the order of the enabled techniques, so only need to plan again when that changes or textures were created or destroyed
+	std::vector<const void *> technique_order;
+	for (const technique &tech : _techniques)
+		if (tech.impl != nullptr && tech.enabled)
+			technique_order.push_back(tech.impl);
+
+	if (!_texture_aliases_dirty && technique_order == _texture_alias_order)
+		return;
+	_texture_aliases_dirty = false;
+	_texture_alias_order = std::move(technique_order);
+
+	std::unordered_map<std::string, size_t> texture_indices;
+	std::vector<alias_texture_desc> textures(_textures.size());
+	for (size_t index = 0; index < _textures.size(); ++index)
+	{
+		const texture &tex = _textures[index];
+		const auto tex_impl = static_cast<d3d9_tex_data *>(tex.impl);
+		if (tex_impl == nullptr)
+			continue;
+
+		texture_indices[tex.unique_name] = index;
+
+		if (tex.impl_reference != texture_reference::none)
+			continue;
+
+		alias_texture_desc &desc = textures[index];
+		// Textures loaded from an image file are never rendered to, so would not be transient anyway
+		desc.aliasable = tex_impl->texture != nullptr && (tex_impl->usage & D3DUSAGE_RENDERTARGET) != 0 && tex.annotation_as_string("source").empty();
+		desc.width = tex.width;
+		desc.height = tex.height;
+		desc.levels = tex_impl->levels;
+		desc.format = tex_impl->format;
+		desc.memory_size = texture_memory_size(tex.width, tex.height, tex_impl->levels, tex_impl->format);
+	}
+
+	std::vector<alias_pass_desc> passes;
+	for (const technique &tech : _techniques)
+	{
+		const auto tech_impl = static_cast<d3d9_technique_data *>(tech.impl);
+		if (tech_impl == nullptr || !tech.enabled)
+			continue;
+
+		const effect &effect = _effects[tech.effect_index];
+
+		for (size_t pass_index = 0; pass_index < tech.passes.size(); ++pass_index)
+		{
+			const d3d9_pass_data &pass_data = tech_impl->passes[pass_index];
+			const reshadefx::pass_info &pass_info = tech.passes[pass_index];
+			alias_pass_desc &pass = passes.emplace_back();
+
+			for (UINT k = 0; k < _num_simultaneous_rendertargets && !pass_info.render_target_names[k].empty(); ++k)
+				if (const auto it = texture_indices.find(pass_info.render_target_names[k]); it != texture_indices.end())
+					pass.writes.push_back(it->second);
+
+			// Only count samplers the shaders actually declare, textures that are render targets in this pass are unbound from them in 'init_effect'
+			for (const reshadefx::sampler_info &info : effect.module.samplers)
+				if (const auto it = texture_indices.find(info.texture_name); it != texture_indices.end() &&
+					info.binding < 16 && (pass_data.sampler_mask & (1 << info.binding)) != 0 &&
+					std::find(pass.writes.begin(), pass.writes.end(), it->second) == pass.writes.end())
+					pass.reads.push_back(it->second);
+
+			// Clears and the full screen triangle only reach pixels inside the viewport and scissor rectangle. 'SetRenderTarget' sets the viewport to the size of the first render target, so other targets of a different size are not fully covered.
+			bool covers_render_targets = std::find(pass_data.render_states.begin(), pass_data.render_states.end(), std::pair<D3DRENDERSTATETYPE, DWORD>(D3DRS_SCISSORTESTENABLE, FALSE)) != pass_data.render_states.end();
+			for (const size_t index : pass.writes)
+				covers_render_targets &= _textures[index].width == _textures[pass.writes[0]].width && _textures[index].height == _textures[pass.writes[0]].height;
+
+			// Anything but the default full screen triangle may leave pixels untouched, as may blending, write masks, stencil testing and discarding pixels
+			pass.overwrites_render_targets = covers_render_targets && (pass_info.clear_render_targets || (
+				!pass_info.blend_enable && !pass_info.stencil_enable && (pass_info.color_write_mask & 0xF) == 0xF && !pass_data.discards &&
+				pass_info.num_vertices == 3 && pass_info.topology == reshadefx::primitive_topology::triangle_list));
+		}
+	}
+
+	const alias_plan plan = plan_texture_aliases(textures, passes);
+
+	// Textures that stop sharing memory need their own again first, since other textures may share theirs now
+	for (size_t index = 0; index < _textures.size(); ++index)
+	{
+		const auto tex_impl = static_cast<d3d9_tex_data *>(_textures[index].impl);
+		if (tex_impl == nullptr || !tex_impl->aliased || plan.memory_of[index] != index)
+			continue;
+
+		if (create_texture(_textures[index], tex_impl))
+			tex_impl->aliased = false;
+	}
+	for (size_t index = 0; index < _textures.size(); ++index)
+	{
+		const auto tex_impl = static_cast<d3d9_tex_data *>(_textures[index].impl);
+		if (tex_impl == nullptr || plan.memory_of[index] == index)
+			continue;
+
+		// This releases the memory of the texture if it had its own
+		const auto owner_impl = static_cast<d3d9_tex_data *>(_textures[plan.memory_of[index]].impl);
+		tex_impl->texture = owner_impl->texture;
+		tex_impl->surface = owner_impl->surface;
+		tex_impl->aliased = true;
+	}
+
+	// Update references in technique list
+	for (const technique &tech : _techniques)
+	{
+		const auto tech_impl = static_cast<d3d9_technique_data *>(tech.impl);
+		if (tech_impl == nullptr)
+			continue;
+
+		for (const reshadefx::sampler_info &info : _effects[tech.effect_index].module.samplers)
+			if (const auto it = texture_indices.find(info.texture_name); it != texture_indices.end() && info.binding < 16)
+				tech_impl->sampler_textures[info.binding] = static_cast<d3d9_tex_data *>(_textures[it->second].impl)->texture.get();
+
+		for (size_t pass_index = 0; pass_index < tech.passes.size(); ++pass_index)
+		{
+			d3d9_pass_data &pass_data = tech_impl->passes[pass_index];
+			const reshadefx::pass_info &pass_info = tech.passes[pass_index];
+
+			std::copy_n(tech_impl->sampler_textures, 16, pass_data.sampler_textures);
+
+			for (UINT k = 0; k < 8 && k <= _num_simultaneous_rendertargets && !pass_info.render_target_names[k].empty(); ++k)
+			{
+				const auto it = texture_indices.find(pass_info.render_target_names[k]);
+				if (it == texture_indices.end())
+					continue;
+				const auto tex_impl = static_cast<d3d9_tex_data *>(_textures[it->second].impl);
+
+				// Unset textures that are used as render target
+				for (DWORD s = 0; s < tech_impl->num_samplers; ++s)
+					if (tex_impl->texture == pass_data.sampler_textures[s])
+						pass_data.sampler_textures[s] = nullptr;
+
+				pass_data.render_targets[k] = tex_impl->surface.get();
+			}
+		}
+	}
+
+	if (plan.memory_before != 0)
+		Logging::Log() << "Effect textures use " << (plan.memory_after / 1024) << " KiB of video memory after sharing it between transient ones (" << (plan.memory_before / 1024) << " KiB before).";
+}
@@ -25,6 +25,8 @@
 
 namespace reshade::d3d9
 {
+	struct d3d9_tex_data;
+
 	class runtime_d3d9 : public runtime
 	{
 	public:
@@ -46,6 +48,8 @@ namespace reshade::d3d9
 
 		void render_technique(technique &technique) override;
 
+		bool create_texture(const texture &texture, d3d9_tex_data *impl);
+
 		state_block _app_state;
 		com_ptr<IDirect3D9> _d3d;
 		const com_ptr<IDirect3DDevice9> _device;
@@ -68,9 +72,14 @@ namespace reshade::d3d9
 		com_ptr<IDirect3DVertexBuffer9> _effect_vertex_buffer;
 		com_ptr<IDirect3DVertexDeclaration9> _effect_vertex_layout;
 
-		std::unordered_map<DWORD, std::vector<BYTE>> _compile_cache;
+		std::unordered_map<uint64_t, std::vector<BYTE>> _compile_cache;
+		size_t _constants_effect_index = std::numeric_limits<size_t>::max(); // Effect whose uniforms are in the shader constant registers
 
 		void update_depth_texture_bindings(com_ptr<IDirect3DSurface9> surface);
+		void update_texture_aliases();
+
+		bool _texture_aliases_dirty = true;
+		std::vector<const void *> _texture_alias_order; // Enabled techniques in render order when texture aliases were last planned
 
 		com_ptr<IDirect3DTexture9> _depth_texture;
 		com_ptr<IDirect3DSurface9> _depth_surface;
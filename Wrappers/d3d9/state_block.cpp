@@ -18,14 +18,12 @@
 */
 
 #include "state_block.hpp"
+#include <cassert>
 #include <algorithm>
 
-reshade::d3d9::state_block::state_block(IDirect3DDevice9 *device)
+reshade::d3d9::state_block::state_block(IDirect3DDevice9 *device) :
+	_device(device)
 {
-	ZeroMemory(this, sizeof(*this));
-
-	_device = device;
-
 	D3DCAPS9 caps;
 	device->GetDeviceCaps(&caps);
 	_num_simultaneous_rendertargets = std::min(caps.NumSimultaneousRTs, DWORD(8));
@@ -37,39 +35,379 @@ reshade::d3d9::state_block::~state_block()
 
 void reshade::d3d9::state_block::capture()
 {
+	// Everything else is saved when it is first changed
+	if (_state_block == nullptr)
+		return;
+
 	_state_block->Capture();
 
 	_device->GetViewport(&_viewport);
+	_device->GetScissorRect(&_scissor_rect);
+	_viewport_saved = true;
 
 	for (DWORD target = 0; target < _num_simultaneous_rendertargets; target++)
+	{
 		_device->GetRenderTarget(target, &_render_targets[target]);
+		_render_target_saved.set(target);
+	}
 	_device->GetDepthStencilSurface(&_depth_stencil);
+	_depth_stencil_saved = true;
 }
 void reshade::d3d9::state_block::apply_and_release()
 {
-	_state_block->Apply();
+	if (_state_block != nullptr)
+	{
+		_state_block->Apply();
+	}
+	else
+	{
+		for (const D3DRENDERSTATETYPE state : _saved_render_states)
+			if (_render_states[state][1] != _render_states[state][0])
+				_device->SetRenderState(state, _render_states[state][0]);
+
+		for (const auto &[sampler, type] : _saved_sampler_states)
+			if (const DWORD *const values = _sampler_states[sampler_slot(sampler)][type]; values[1] != values[0])
+				_device->SetSamplerState(sampler, type, values[0]);
+
+		for (DWORD slot = 0; slot < num_samplers; slot++)
+			if (_texture_saved[slot] && _current_textures[slot] != _textures[slot])
+				_device->SetTexture(slot < 16 ? slot : D3DVERTEXTEXTURESAMPLER0 + (slot - 16), _textures[slot].get());
+
+		if (_shaders_saved[0] && _current_vertex_shader != _vertex_shader)
+			_device->SetVertexShader(_vertex_shader.get());
+		if (_shaders_saved[1] && _current_pixel_shader != _pixel_shader)
+			_device->SetPixelShader(_pixel_shader.get());
+
+		// Setting the declaration resets the FVF, so restore whichever of the two the application used
+		if (_vertex_input_saved[0])
+		{
+			if (_fvf != 0)
+				_device->SetFVF(_fvf);
+			else if (_current_vertex_declaration != _vertex_declaration)
+				_device->SetVertexDeclaration(_vertex_declaration.get());
+		}
+		if (_vertex_input_saved[1] && (_current_stream_source != _stream_source || _current_stream_offset != _stream_offset || _current_stream_stride != _stream_stride))
+			_device->SetStreamSource(0, _stream_source.get(), _stream_offset, _stream_stride);
+
+		for (int pixel_shader = 0; pixel_shader < 2; pixel_shader++)
+		{
+			// Restore contiguous runs of saved registers with a single call each
+			for (UINT first = 0, last; first < num_constant_registers; first = last)
+			{
+				for (; first < num_constant_registers && !_constants_saved[pixel_shader][first]; first++)
+					continue;
+				for (last = first; last < num_constant_registers && _constants_saved[pixel_shader][last]; last++)
+					continue;
+				if (first == last)
+					break;
+
+				if (pixel_shader)
+					_device->SetPixelShaderConstantF(first, _constants[1][first], last - first);
+				else
+					_device->SetVertexShaderConstantF(first, _constants[0][first], last - first);
+			}
+		}
+	}
 
 	for (DWORD target = 0; target < _num_simultaneous_rendertargets; target++)
-		_device->SetRenderTarget(target, _render_targets[target].get());
-	_device->SetDepthStencilSurface(_depth_stencil.get());
+		if (_render_target_saved[target])
+			_device->SetRenderTarget(target, _render_targets[target].get());
+	if (_depth_stencil_saved)
+		_device->SetDepthStencilSurface(_depth_stencil.get());
 
 	// Set viewport after render targets have been set, since 'SetRenderTarget' causes the viewport to be set to the full size of the render target
-	_device->SetViewport(&_viewport);
+	if (_viewport_saved)
+	{
+		_device->SetViewport(&_viewport);
+		_device->SetScissorRect(&_scissor_rect);
+	}
 
 	release_all_device_objects();
 }
 
 bool reshade::d3d9::state_block::init_state_block()
 {
+	// Pure devices do not return most state, so have to capture all of it there
+	D3DDEVICE_CREATION_PARAMETERS cp;
+	if (SUCCEEDED(_device->GetCreationParameters(&cp)) && (cp.BehaviorFlags & D3DCREATE_PUREDEVICE) == 0)
+		return true;
+
 	return SUCCEEDED(_device->CreateStateBlock(D3DSBT_ALL, &_state_block));
 }
 void reshade::d3d9::state_block::release_state_block()
 {
 	_state_block.reset();
 }
+
+void reshade::d3d9::state_block::set_render_state(D3DRENDERSTATETYPE state, DWORD value)
+{
+	if (_state_block != nullptr)
+	{
+		_device->SetRenderState(state, value);
+		return;
+	}
+
+	assert(state < num_render_states);
+	DWORD *const values = _render_states[state];
+	if (!_render_state_saved[state])
+	{
+		_device->GetRenderState(state, &values[0]);
+		values[1] = values[0];
+		_render_state_saved.set(state);
+		_saved_render_states.push_back(state);
+	}
+
+	if (values[1] != value)
+	{
+		_device->SetRenderState(state, value);
+		values[1] = value;
+	}
+}
+void reshade::d3d9::state_block::set_sampler_state(DWORD sampler, D3DSAMPLERSTATETYPE type, DWORD value)
+{
+	if (_state_block != nullptr)
+	{
+		_device->SetSamplerState(sampler, type, value);
+		return;
+	}
+
+	assert(type < num_sampler_states);
+	const DWORD slot = sampler_slot(sampler);
+	DWORD *const values = _sampler_states[slot][type];
+	if (!_sampler_state_saved[slot * num_sampler_states + type])
+	{
+		_device->GetSamplerState(sampler, type, &values[0]);
+		values[1] = values[0];
+		_sampler_state_saved.set(slot * num_sampler_states + type);
+		_saved_sampler_states.emplace_back(sampler, type);
+	}
+
+	if (values[1] != value)
+	{
+		_device->SetSamplerState(sampler, type, value);
+		values[1] = value;
+	}
+}
+void reshade::d3d9::state_block::set_texture(DWORD sampler, IDirect3DBaseTexture9 *texture)
+{
+	if (_state_block != nullptr)
+	{
+		_device->SetTexture(sampler, texture);
+		return;
+	}
+
+	const DWORD slot = sampler_slot(sampler);
+	if (!_texture_saved[slot])
+	{
+		_device->GetTexture(sampler, &_textures[slot]);
+		_current_textures[slot] = _textures[slot].get();
+		_texture_saved.set(slot);
+	}
+
+	if (_current_textures[slot] != texture)
+	{
+		_device->SetTexture(sampler, texture);
+		_current_textures[slot] = texture;
+	}
+}
+void reshade::d3d9::state_block::set_vertex_shader(IDirect3DVertexShader9 *shader)
+{
+	if (_state_block != nullptr)
+	{
+		_device->SetVertexShader(shader);
+		return;
+	}
+
+	if (!_shaders_saved[0])
+	{
+		_device->GetVertexShader(&_vertex_shader);
+		_current_vertex_shader = _vertex_shader.get();
+		_shaders_saved[0] = true;
+	}
+
+	if (_current_vertex_shader != shader)
+	{
+		_device->SetVertexShader(shader);
+		_current_vertex_shader = shader;
+	}
+}
+void reshade::d3d9::state_block::set_pixel_shader(IDirect3DPixelShader9 *shader)
+{
+	if (_state_block != nullptr)
+	{
+		_device->SetPixelShader(shader);
+		return;
+	}
+
+	if (!_shaders_saved[1])
+	{
+		_device->GetPixelShader(&_pixel_shader);
+		_current_pixel_shader = _pixel_shader.get();
+		_shaders_saved[1] = true;
+	}
+
+	if (_current_pixel_shader != shader)
+	{
+		_device->SetPixelShader(shader);
+		_current_pixel_shader = shader;
+	}
+}
+void reshade::d3d9::state_block::set_vertex_declaration(IDirect3DVertexDeclaration9 *declaration)
+{
+	if (_state_block != nullptr)
+	{
+		_device->SetVertexDeclaration(declaration);
+		return;
+	}
+
+	if (!_vertex_input_saved[0])
+	{
+		_device->GetFVF(&_fvf);
+		_device->GetVertexDeclaration(&_vertex_declaration);
+		_current_vertex_declaration = _vertex_declaration.get();
+		_vertex_input_saved[0] = true;
+
+		// Always set the declaration when an FVF is active, since it is not current then
+		if (_fvf != 0)
+			_current_vertex_declaration = nullptr;
+	}
+
+	if (_current_vertex_declaration != declaration)
+	{
+		_device->SetVertexDeclaration(declaration);
+		_current_vertex_declaration = declaration;
+	}
+}
+void reshade::d3d9::state_block::set_stream_source(IDirect3DVertexBuffer9 *buffer, UINT offset, UINT stride)
+{
+	if (_state_block != nullptr)
+	{
+		_device->SetStreamSource(0, buffer, offset, stride);
+		return;
+	}
+
+	if (!_vertex_input_saved[1])
+	{
+		_device->GetStreamSource(0, &_stream_source, &_stream_offset, &_stream_stride);
+		_current_stream_source = _stream_source.get();
+		_current_stream_offset = _stream_offset;
+		_current_stream_stride = _stream_stride;
+		_vertex_input_saved[1] = true;
+	}
+
+	if (_current_stream_source != buffer || _current_stream_offset != offset || _current_stream_stride != stride)
+	{
+		_device->SetStreamSource(0, buffer, offset, stride);
+		_current_stream_source = buffer;
+		_current_stream_offset = offset;
+		_current_stream_stride = stride;
+	}
+}
+void reshade::d3d9::state_block::set_vertex_shader_constant_f(UINT first_register, const float *data, UINT register_count)
+{
+	if (_state_block == nullptr)
+		save_constants(false, first_register, register_count);
+
+	_device->SetVertexShaderConstantF(first_register, data, register_count);
+}
+void reshade::d3d9::state_block::set_pixel_shader_constant_f(UINT first_register, const float *data, UINT register_count)
+{
+	if (_state_block == nullptr)
+		save_constants(true, first_register, register_count);
+
+	_device->SetPixelShaderConstantF(first_register, data, register_count);
+}
+void reshade::d3d9::state_block::set_render_target(DWORD index, IDirect3DSurface9 *surface)
+{
+	if (_state_block == nullptr)
+	{
+		if (!_render_target_saved[index])
+		{
+			_device->GetRenderTarget(index, &_render_targets[index]);
+			_render_target_saved.set(index);
+		}
+
+		// Setting the first render target also resets the viewport and scissor rectangle
+		if (index == 0 && !_viewport_saved)
+		{
+			_device->GetViewport(&_viewport);
+			_device->GetScissorRect(&_scissor_rect);
+			_viewport_saved = true;
+		}
+	}
+
+	// Always set render targets, even if unchanged, since that also resets the viewport to their size
+	_device->SetRenderTarget(index, surface);
+}
+void reshade::d3d9::state_block::set_depth_stencil_surface(IDirect3DSurface9 *surface)
+{
+	if (_state_block == nullptr && !_depth_stencil_saved)
+	{
+		_device->GetDepthStencilSurface(&_depth_stencil);
+		_depth_stencil_saved = true;
+	}
+
+	_device->SetDepthStencilSurface(surface);
+}
+
+DWORD reshade::d3d9::state_block::sampler_slot(DWORD sampler)
+{
+	assert(sampler < 16 || (sampler >= D3DVERTEXTEXTURESAMPLER0 && sampler <= D3DVERTEXTEXTURESAMPLER3));
+	return sampler < 16 ? sampler : 16 + (sampler - D3DVERTEXTEXTURESAMPLER0);
+}
+
+void reshade::d3d9::state_block::save_constants(bool pixel_shader, UINT first_register, UINT register_count)
+{
+	assert(first_register + register_count <= num_constant_registers);
+	std::bitset<num_constant_registers> &saved = _constants_saved[pixel_shader];
+
+	// Only read registers that were not saved before, in as few calls as possible
+	for (UINT first = first_register, last, end = first_register + register_count; first < end; first = last)
+	{
+		for (; first < end && saved[first]; first++)
+			continue;
+		for (last = first; last < end && !saved[last]; last++)
+			saved.set(last);
+		if (first == last)
+			break;
+
+		if (pixel_shader)
+			_device->GetPixelShaderConstantF(first, _constants[1][first], last - first);
+		else
+			_device->GetVertexShaderConstantF(first, _constants[0][first], last - first);
+	}
+}
+
 void reshade::d3d9::state_block::release_all_device_objects()
 {
+	_saved_render_states.clear();
+	_render_state_saved.reset();
+	_saved_sampler_states.clear();
+	_sampler_state_saved.reset();
+
+	for (DWORD slot = 0; slot < num_samplers; slot++)
+		_textures[slot].reset(), _current_textures[slot] = nullptr;
+	_texture_saved.reset();
+
+	_vertex_shader.reset();
+	_pixel_shader.reset();
+	_current_vertex_shader = nullptr;
+	_current_pixel_shader = nullptr;
+	_shaders_saved[0] = _shaders_saved[1] = false;
+
+	_vertex_declaration.reset();
+	_current_vertex_declaration = nullptr;
+	_stream_source.reset();
+	_current_stream_source = nullptr;
+	_vertex_input_saved[0] = _vertex_input_saved[1] = false;
+
+	_constants_saved[0].reset();
+	_constants_saved[1].reset();
+
 	_depth_stencil.reset();
 	for (auto &render_target : _render_targets)
 		render_target.reset();
+	_render_target_saved.reset();
+	_depth_stencil_saved = false;
+	_viewport_saved = false;
 }
@@ -22,6 +22,8 @@
 #define NOMINMAX
 #define WIN32_LEAN_AND_MEAN
 #include <d3d9.h>
+#include <bitset>
+#include <vector>
 #include "com_ptr.hpp"
 
 namespace reshade::d3d9
@@ -38,13 +40,71 @@ namespace reshade::d3d9
 		void capture();
 		void apply_and_release();
 
+		// State changed through these between 'capture' and 'apply_and_release' is saved from the device before it is changed the first time and restored afterwards
+		// Values are shadowed as well, so setting the value that is already current does not call into the device again
+		void set_render_state(D3DRENDERSTATETYPE state, DWORD value);
+		void set_sampler_state(DWORD sampler, D3DSAMPLERSTATETYPE type, DWORD value);
+		void set_texture(DWORD sampler, IDirect3DBaseTexture9 *texture);
+		void set_vertex_shader(IDirect3DVertexShader9 *shader);
+		void set_pixel_shader(IDirect3DPixelShader9 *shader);
+		void set_vertex_declaration(IDirect3DVertexDeclaration9 *declaration);
+		void set_stream_source(IDirect3DVertexBuffer9 *buffer, UINT offset, UINT stride); // Stream 0
+		void set_vertex_shader_constant_f(UINT first_register, const float *data, UINT register_count);
+		void set_pixel_shader_constant_f(UINT first_register, const float *data, UINT register_count);
+		void set_render_target(DWORD index, IDirect3DSurface9 *surface);
+		void set_depth_stencil_surface(IDirect3DSurface9 *surface);
+
 	private:
+		static constexpr DWORD num_render_states = D3DRS_BLENDOPALPHA + 1;
+		static constexpr DWORD num_samplers = 16 + 4; // Pixel shader samplers followed by 'D3DVERTEXTEXTURESAMPLER0' to 'D3DVERTEXTEXTURESAMPLER3'
+		static constexpr DWORD num_sampler_states = D3DSAMP_DMAPOFFSET + 1;
+		static constexpr UINT num_constant_registers = 256;
+
+		static DWORD sampler_slot(DWORD sampler);
+
+		void save_constants(bool pixel_shader, UINT first_register, UINT register_count);
 		void release_all_device_objects();
 
 		com_ptr<IDirect3DDevice9> _device;
-		com_ptr<IDirect3DStateBlock9> _state_block;
-		UINT _num_simultaneous_rendertargets;
-		D3DVIEWPORT9 _viewport;
+		com_ptr<IDirect3DStateBlock9> _state_block; // Only used on pure devices, which cannot return most of the state
+		UINT _num_simultaneous_rendertargets = 0;
+
+		// Application state saved before the first change, and the value last set on the device
+		std::vector<D3DRENDERSTATETYPE> _saved_render_states;
+		std::bitset<num_render_states> _render_state_saved;
+		DWORD _render_states[num_render_states][2] = {};
+
+		std::vector<std::pair<DWORD, D3DSAMPLERSTATETYPE>> _saved_sampler_states;
+		std::bitset<num_samplers * num_sampler_states> _sampler_state_saved;
+		DWORD _sampler_states[num_samplers][num_sampler_states][2] = {};
+
+		std::bitset<num_samplers> _texture_saved;
+		com_ptr<IDirect3DBaseTexture9> _textures[num_samplers];
+		IDirect3DBaseTexture9 *_current_textures[num_samplers] = {};
+
+		bool _shaders_saved[2] = {};
+		com_ptr<IDirect3DVertexShader9> _vertex_shader;
+		com_ptr<IDirect3DPixelShader9> _pixel_shader;
+		IDirect3DVertexShader9 *_current_vertex_shader = nullptr;
+		IDirect3DPixelShader9 *_current_pixel_shader = nullptr;
+
+		bool _vertex_input_saved[2] = {};
+		DWORD _fvf = 0;
+		com_ptr<IDirect3DVertexDeclaration9> _vertex_declaration;
+		IDirect3DVertexDeclaration9 *_current_vertex_declaration = nullptr;
+		com_ptr<IDirect3DVertexBuffer9> _stream_source;
+		UINT _stream_offset = 0, _stream_stride = 0;
+		IDirect3DVertexBuffer9 *_current_stream_source = nullptr;
+		UINT _current_stream_offset = 0, _current_stream_stride = 0;
+
+		std::bitset<num_constant_registers> _constants_saved[2]; // Vertex shader and pixel shader registers
+		float _constants[2][num_constant_registers][4] = {};
+
+		std::bitset<8> _render_target_saved;
+		bool _depth_stencil_saved = false;
+		bool _viewport_saved = false;
+		D3DVIEWPORT9 _viewport = {};
+		RECT _scissor_rect = {};
 		com_ptr<IDirect3DSurface9> _depth_stencil;
 		com_ptr<IDirect3DSurface9> _render_targets[8];
 	};
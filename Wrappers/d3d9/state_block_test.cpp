@@ -0,0 +1,431 @@
+// Checks that state_block gives the application back exactly the device state it had
+//
+// Every round sets random application state on a real device, captures it, changes it through the state block like
+// runtime_d3d9::render_technique does and then applies the state block again. Each change has to reach the device, and
+// afterwards everything has to read back the same as before: render and sampler states, textures, shaders, the vertex
+// declaration or FVF, stream source, shader constants, render targets, depth-stencil surface, viewport and scissor
+// rectangle. The same state block is used for all rounds, like the runtime keeps one for every frame. Pure devices use
+// a full state block instead, which cannot be read back, so this uses a device with software vertex processing.
+//
+// Usage: run from the repository root of a Windows checkout
+//   cl /std:c++17 /EHsc /O2 /I. Wrappers\d3d9\state_block_test.cpp Wrappers\d3d9\state_block.cpp d3d9.lib user32.lib
+//   state_block_test
+
+#include "state_block.hpp"
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do { if (!(condition)) { failures++; printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); } } while (0)
+
+using namespace reshade::d3d9;
+
+// States ReShade sets while rendering, with the values that are valid for each
+static const struct { D3DRENDERSTATETYPE state; DWORD min, max; } render_states[] = {
+	{ D3DRS_ZENABLE, 0, 1 }, { D3DRS_FILLMODE, 1, 3 }, { D3DRS_ZWRITEENABLE, 0, 1 }, { D3DRS_ALPHATESTENABLE, 0, 1 },
+	{ D3DRS_SRCBLEND, 1, 13 }, { D3DRS_DESTBLEND, 1, 13 }, { D3DRS_CULLMODE, 1, 3 }, { D3DRS_ZFUNC, 1, 8 },
+	{ D3DRS_ALPHAREF, 0, 255 }, { D3DRS_ALPHAFUNC, 1, 8 }, { D3DRS_ALPHABLENDENABLE, 0, 1 }, { D3DRS_FOGENABLE, 0, 1 },
+	{ D3DRS_STENCILENABLE, 0, 1 }, { D3DRS_STENCILFUNC, 1, 8 }, { D3DRS_STENCILREF, 0, 255 }, { D3DRS_STENCILMASK, 0, 255 },
+	{ D3DRS_STENCILWRITEMASK, 0, 255 }, { D3DRS_STENCILPASS, 1, 8 }, { D3DRS_CLIPPING, 0, 1 }, { D3DRS_COLORWRITEENABLE, 0, 15 },
+	{ D3DRS_BLENDOP, 1, 5 }, { D3DRS_SCISSORTESTENABLE, 0, 1 }, { D3DRS_SRGBWRITEENABLE, 0, 1 }, { D3DRS_BLENDOPALPHA, 1, 5 },
+};
+static const struct { D3DSAMPLERSTATETYPE type; DWORD min, max; } sampler_states[] = {
+	{ D3DSAMP_ADDRESSU, 1, 5 }, { D3DSAMP_ADDRESSV, 1, 5 }, { D3DSAMP_ADDRESSW, 1, 5 }, { D3DSAMP_MAGFILTER, 1, 2 },
+	{ D3DSAMP_MINFILTER, 1, 2 }, { D3DSAMP_MIPFILTER, 0, 2 }, { D3DSAMP_MAXMIPLEVEL, 0, 3 }, { D3DSAMP_SRGBTEXTURE, 0, 1 },
+};
+static const DWORD samplers[] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	D3DVERTEXTEXTURESAMPLER0, D3DVERTEXTEXTURESAMPLER1, D3DVERTEXTEXTURESAMPLER2, D3DVERTEXTEXTURESAMPLER3,
+};
+static constexpr UINT num_vertex_constants = 256;
+static constexpr UINT num_pixel_constants = 224;
+
+// 'vs_1_1: dcl_position v0; mov oPos, v0' and 'ps_1_1: mov r0, v0'
+static const DWORD vertex_shader_code[] = { 0xfffe0101, 0x0000001f, 0x80000000, 0x900f0000, 0x00000001, 0xc00f0000, 0x90e40000, 0x0000ffff };
+static const DWORD pixel_shader_code[] = { 0xffff0101, 0x00000001, 0x800f0000, 0x90e40000, 0x0000ffff };
+
+// Objects the state refers to, each list includes 'nullptr' where the device accepts it
+struct resources
+{
+	std::vector<com_ptr<IDirect3DBaseTexture9>> textures;
+	std::vector<com_ptr<IDirect3DVertexShader9>> vertex_shaders;
+	std::vector<com_ptr<IDirect3DPixelShader9>> pixel_shaders;
+	std::vector<com_ptr<IDirect3DVertexDeclaration9>> declarations;
+	std::vector<com_ptr<IDirect3DVertexBuffer9>> vertex_buffers;
+	std::vector<com_ptr<IDirect3DSurface9>> render_targets; // All the size of the back buffer, so they can be combined
+	std::vector<com_ptr<IDirect3DSurface9>> depth_stencils;
+};
+
+// Everything state_block may change, read back from the device
+struct device_state
+{
+	DWORD render_state_values[std::size(render_states)];
+	DWORD sampler_state_values[std::size(samplers)][std::size(sampler_states)];
+	com_ptr<IDirect3DBaseTexture9> textures[std::size(samplers)];
+	com_ptr<IDirect3DVertexShader9> vertex_shader;
+	com_ptr<IDirect3DPixelShader9> pixel_shader;
+	DWORD fvf;
+	com_ptr<IDirect3DVertexDeclaration9> declaration;
+	com_ptr<IDirect3DVertexBuffer9> stream_source;
+	UINT stream_offset, stream_stride;
+	float vertex_constants[num_vertex_constants][4];
+	float pixel_constants[num_pixel_constants][4];
+	com_ptr<IDirect3DSurface9> render_targets[4];
+	com_ptr<IDirect3DSurface9> depth_stencil;
+	D3DVIEWPORT9 viewport;
+	RECT scissor_rect;
+};
+
+static void read_state(IDirect3DDevice9 *device, DWORD num_render_targets, device_state &state)
+{
+	for (size_t i = 0; i < std::size(render_states); ++i)
+		device->GetRenderState(render_states[i].state, &state.render_state_values[i]);
+	for (size_t s = 0; s < std::size(samplers); ++s)
+	{
+		for (size_t i = 0; i < std::size(sampler_states); ++i)
+			device->GetSamplerState(samplers[s], sampler_states[i].type, &state.sampler_state_values[s][i]);
+		state.textures[s].reset();
+		device->GetTexture(samplers[s], &state.textures[s]);
+	}
+
+	state.vertex_shader.reset();
+	device->GetVertexShader(&state.vertex_shader);
+	state.pixel_shader.reset();
+	device->GetPixelShader(&state.pixel_shader);
+	device->GetFVF(&state.fvf);
+	state.declaration.reset();
+	device->GetVertexDeclaration(&state.declaration);
+	state.stream_source.reset();
+	device->GetStreamSource(0, &state.stream_source, &state.stream_offset, &state.stream_stride);
+	device->GetVertexShaderConstantF(0, state.vertex_constants[0], num_vertex_constants);
+	device->GetPixelShaderConstantF(0, state.pixel_constants[0], num_pixel_constants);
+
+	for (DWORD target = 0; target < num_render_targets; ++target)
+	{
+		state.render_targets[target].reset();
+		device->GetRenderTarget(target, &state.render_targets[target]);
+	}
+	state.depth_stencil.reset();
+	device->GetDepthStencilSurface(&state.depth_stencil);
+	device->GetViewport(&state.viewport);
+	device->GetScissorRect(&state.scissor_rect);
+}
+
+static void check_same_state(const device_state &before, const device_state &after, DWORD num_render_targets)
+{
+	CHECK(std::memcmp(before.render_state_values, after.render_state_values, sizeof(before.render_state_values)) == 0);
+	CHECK(std::memcmp(before.sampler_state_values, after.sampler_state_values, sizeof(before.sampler_state_values)) == 0);
+	CHECK(std::equal(std::begin(before.textures), std::end(before.textures), std::begin(after.textures)));
+	CHECK(before.vertex_shader == after.vertex_shader && before.pixel_shader == after.pixel_shader);
+	// Setting an FVF makes the device use a declaration of its own, so compare that instead then
+	CHECK(before.fvf == after.fvf && (before.fvf != 0 || before.declaration == after.declaration));
+	CHECK(before.stream_source == after.stream_source && before.stream_offset == after.stream_offset && before.stream_stride == after.stream_stride);
+	CHECK(std::memcmp(before.vertex_constants, after.vertex_constants, sizeof(before.vertex_constants)) == 0);
+	CHECK(std::memcmp(before.pixel_constants, after.pixel_constants, sizeof(before.pixel_constants)) == 0);
+	CHECK(std::equal(before.render_targets, before.render_targets + num_render_targets, after.render_targets));
+	CHECK(before.depth_stencil == after.depth_stencil);
+	CHECK(std::memcmp(&before.viewport, &after.viewport, sizeof(before.viewport)) == 0);
+	CHECK(std::memcmp(&before.scissor_rect, &after.scissor_rect, sizeof(before.scissor_rect)) == 0);
+}
+
+int main()
+{
+	const HWND window = CreateWindowExA(0, "STATIC", "state_block_test", WS_OVERLAPPEDWINDOW, 0, 0, 1280, 720, nullptr, nullptr, nullptr, nullptr);
+
+	com_ptr<IDirect3D9> d3d(Direct3DCreate9(D3D_SDK_VERSION), true);
+	if (d3d == nullptr)
+	{
+		printf("Could not create the Direct3D 9 object\n");
+		return 1;
+	}
+
+	D3DPRESENT_PARAMETERS pp = {};
+	pp.BackBufferWidth = 1280;
+	pp.BackBufferHeight = 720;
+	pp.BackBufferFormat = D3DFMT_X8R8G8B8;
+	pp.SwapEffect = D3DSWAPEFFECT_DISCARD;
+	pp.hDeviceWindow = window;
+	pp.Windowed = TRUE;
+	pp.EnableAutoDepthStencil = TRUE;
+	pp.AutoDepthStencilFormat = D3DFMT_D24S8;
+
+	com_ptr<IDirect3DDevice9> device;
+	if (FAILED(d3d->CreateDevice(D3DADAPTER_DEFAULT, D3DDEVTYPE_HAL, window, D3DCREATE_SOFTWARE_VERTEXPROCESSING, &pp, &device)))
+	{
+		printf("Could not create a Direct3D 9 device\n");
+		return 1;
+	}
+
+	D3DCAPS9 caps;
+	device->GetDeviceCaps(&caps);
+	const DWORD num_render_targets = std::min(caps.NumSimultaneousRTs, DWORD(4));
+
+	resources objects;
+	objects.textures.push_back(nullptr);
+	for (UINT size = 1; size <= 4; ++size)
+	{
+		com_ptr<IDirect3DTexture9> texture;
+		if (SUCCEEDED(device->CreateTexture(size * 4, size * 4, 1, 0, D3DFMT_A8R8G8B8, D3DPOOL_MANAGED, &texture, nullptr)))
+			objects.textures.push_back(com_ptr<IDirect3DBaseTexture9>(texture.get()));
+	}
+	objects.vertex_shaders.push_back(nullptr);
+	objects.pixel_shaders.push_back(nullptr);
+	for (int i = 0; i < 2; ++i)
+	{
+		com_ptr<IDirect3DVertexShader9> vertex_shader;
+		if (SUCCEEDED(device->CreateVertexShader(vertex_shader_code, &vertex_shader)))
+			objects.vertex_shaders.push_back(std::move(vertex_shader));
+		com_ptr<IDirect3DPixelShader9> pixel_shader;
+		if (SUCCEEDED(device->CreatePixelShader(pixel_shader_code, &pixel_shader)))
+			objects.pixel_shaders.push_back(std::move(pixel_shader));
+	}
+	const D3DVERTEXELEMENT9 position_elements[] = {
+		{ 0, 0, D3DDECLTYPE_FLOAT3, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_POSITION, 0 },
+		D3DDECL_END()
+	};
+	const D3DVERTEXELEMENT9 texcoord_elements[] = {
+		{ 0, 0, D3DDECLTYPE_FLOAT1, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_TEXCOORD, 0 },
+		D3DDECL_END()
+	};
+	for (const D3DVERTEXELEMENT9 *elements : { position_elements, texcoord_elements })
+	{
+		com_ptr<IDirect3DVertexDeclaration9> declaration;
+		if (SUCCEEDED(device->CreateVertexDeclaration(elements, &declaration)))
+			objects.declarations.push_back(std::move(declaration));
+	}
+	objects.vertex_buffers.push_back(nullptr);
+	for (int i = 0; i < 3; ++i)
+	{
+		com_ptr<IDirect3DVertexBuffer9> buffer;
+		if (SUCCEEDED(device->CreateVertexBuffer(1024, D3DUSAGE_WRITEONLY, 0, D3DPOOL_DEFAULT, &buffer, nullptr)))
+			objects.vertex_buffers.push_back(std::move(buffer));
+	}
+	objects.render_targets.emplace_back();
+	device->GetRenderTarget(0, &objects.render_targets.back());
+	for (int i = 0; i < 3; ++i)
+	{
+		com_ptr<IDirect3DSurface9> surface;
+		if (SUCCEEDED(device->CreateRenderTarget(1280, 720, D3DFMT_X8R8G8B8, D3DMULTISAMPLE_NONE, 0, FALSE, &surface, nullptr)))
+			objects.render_targets.push_back(std::move(surface));
+	}
+	objects.depth_stencils.push_back(nullptr);
+	objects.depth_stencils.emplace_back();
+	device->GetDepthStencilSurface(&objects.depth_stencils.back());
+	{
+		com_ptr<IDirect3DSurface9> surface;
+		if (SUCCEEDED(device->CreateDepthStencilSurface(1280, 720, D3DFMT_D24S8, D3DMULTISAMPLE_NONE, 0, FALSE, &surface, nullptr)))
+			objects.depth_stencils.push_back(std::move(surface));
+	}
+
+	if (objects.vertex_shaders.size() < 2 || objects.pixel_shaders.size() < 2 || objects.declarations.size() < 2 || objects.vertex_buffers.size() < 2 || objects.render_targets.size() < 2)
+	{
+		printf("Could not create the objects to set on the device\n");
+		return 1;
+	}
+
+	std::mt19937 rng(1);
+	const auto random = [&rng](size_t count) { return static_cast<UINT>(rng() % count); };
+	const auto random_value = [&rng](DWORD min, DWORD max) { return min + static_cast<DWORD>(rng() % (max - min + 1)); };
+	const auto random_constants = [&rng](float *values, UINT register_count) {
+		for (UINT i = 0; i < register_count * 4; ++i)
+			values[i] = static_cast<float>(rng() % 2001) / 1000.0f - 1.0f;
+	};
+	const auto random_viewport = [&random]() {
+		const DWORD x = random(640), y = random(360);
+		return D3DVIEWPORT9 { x, y, 1 + random(1280 - x), 1 + random(720 - y), 0.0f, 1.0f };
+	};
+
+	state_block app_state(device.get());
+	CHECK(app_state.init_state_block());
+
+	device_state before = {}, after = {}, current = {};
+	float constants[num_vertex_constants][4];
+
+	const int rounds = 1000;
+	for (int round = 0; round < rounds; ++round)
+	{
+		// Random application state, set on the device directly
+		for (size_t i = 0; i < std::size(render_states); ++i)
+			if (random(2))
+				device->SetRenderState(render_states[i].state, random_value(render_states[i].min, render_states[i].max));
+		for (size_t s = 0; s < std::size(samplers); ++s)
+		{
+			for (size_t i = 0; i < std::size(sampler_states); ++i)
+				if (random(4) == 0)
+					device->SetSamplerState(samplers[s], sampler_states[i].type, random_value(sampler_states[i].min, sampler_states[i].max));
+			if (random(2))
+				device->SetTexture(samplers[s], objects.textures[random(objects.textures.size())].get());
+		}
+		device->SetVertexShader(objects.vertex_shaders[random(objects.vertex_shaders.size())].get());
+		device->SetPixelShader(objects.pixel_shaders[random(objects.pixel_shaders.size())].get());
+		if (random(2))
+			device->SetFVF(random(2) ? D3DFVF_XYZ : D3DFVF_XYZ | D3DFVF_TEX1);
+		else
+			device->SetVertexDeclaration(objects.declarations[random(objects.declarations.size())].get());
+		device->SetStreamSource(0, objects.vertex_buffers[random(objects.vertex_buffers.size())].get(), 4 * random(16), 4 * (1 + random(8)));
+		random_constants(constants[0], num_vertex_constants);
+		device->SetVertexShaderConstantF(0, constants[0], num_vertex_constants);
+		random_constants(constants[0], num_pixel_constants);
+		device->SetPixelShaderConstantF(0, constants[0], num_pixel_constants);
+		device->SetRenderTarget(0, objects.render_targets[random(objects.render_targets.size())].get());
+		for (DWORD target = 1; target < num_render_targets; ++target)
+			device->SetRenderTarget(target, random(2) ? objects.render_targets[random(objects.render_targets.size())].get() : nullptr);
+		device->SetDepthStencilSurface(objects.depth_stencils[random(objects.depth_stencils.size())].get());
+		const D3DVIEWPORT9 viewport = random_viewport();
+		device->SetViewport(&viewport);
+		const RECT scissor_rect = { static_cast<LONG>(random(640)), static_cast<LONG>(random(360)), static_cast<LONG>(640 + random(640)), static_cast<LONG>(360 + random(360)) };
+		device->SetScissorRect(&scissor_rect);
+
+		read_state(device.get(), num_render_targets, before);
+
+		// Change some of it through the state block, each change has to reach the device
+		app_state.capture();
+		for (int change = 0, changes = random(60); change < changes; ++change)
+		{
+			switch (random(11))
+			{
+			case 0:
+			{
+				const auto &entry = render_states[random(std::size(render_states))];
+				const DWORD value = random_value(entry.min, entry.max);
+				app_state.set_render_state(entry.state, value);
+				DWORD result = 0;
+				device->GetRenderState(entry.state, &result);
+				CHECK(result == value);
+				break;
+			}
+			case 1:
+			{
+				const DWORD sampler = samplers[random(std::size(samplers))];
+				const auto &entry = sampler_states[random(std::size(sampler_states))];
+				const DWORD value = random_value(entry.min, entry.max);
+				app_state.set_sampler_state(sampler, entry.type, value);
+				DWORD result = 0;
+				device->GetSamplerState(sampler, entry.type, &result);
+				CHECK(result == value);
+				break;
+			}
+			case 2:
+			{
+				const DWORD sampler = samplers[random(std::size(samplers))];
+				IDirect3DBaseTexture9 *const texture = objects.textures[random(objects.textures.size())].get();
+				app_state.set_texture(sampler, texture);
+				com_ptr<IDirect3DBaseTexture9> result;
+				device->GetTexture(sampler, &result);
+				CHECK(result == texture);
+				break;
+			}
+			case 3:
+			{
+				IDirect3DVertexShader9 *const vertex_shader = objects.vertex_shaders[random(objects.vertex_shaders.size())].get();
+				IDirect3DPixelShader9 *const pixel_shader = objects.pixel_shaders[random(objects.pixel_shaders.size())].get();
+				app_state.set_vertex_shader(vertex_shader);
+				app_state.set_pixel_shader(pixel_shader);
+				read_state(device.get(), num_render_targets, current);
+				CHECK(current.vertex_shader == vertex_shader && current.pixel_shader == pixel_shader);
+				break;
+			}
+			case 4:
+			{
+				IDirect3DVertexDeclaration9 *const declaration = objects.declarations[random(objects.declarations.size())].get();
+				app_state.set_vertex_declaration(declaration);
+				com_ptr<IDirect3DVertexDeclaration9> result;
+				device->GetVertexDeclaration(&result);
+				CHECK(result == declaration);
+				break;
+			}
+			case 5:
+			{
+				IDirect3DVertexBuffer9 *const buffer = objects.vertex_buffers[random(objects.vertex_buffers.size())].get();
+				const UINT offset = 4 * random(16), stride = 4 * (1 + random(8));
+				app_state.set_stream_source(buffer, offset, stride);
+				com_ptr<IDirect3DVertexBuffer9> result;
+				UINT result_offset = 0, result_stride = 0;
+				device->GetStreamSource(0, &result, &result_offset, &result_stride);
+				CHECK(result == buffer && result_offset == offset && result_stride == stride);
+				break;
+			}
+			case 6:
+			case 7:
+			{
+				const bool pixel_shader = random(2) != 0;
+				const UINT num_constants = pixel_shader ? num_pixel_constants : num_vertex_constants;
+				const UINT first = random(num_constants), count = 1 + random(std::min(num_constants - first, 32u));
+				random_constants(constants[0], count);
+				float result[32][4];
+				if (pixel_shader)
+				{
+					app_state.set_pixel_shader_constant_f(first, constants[0], count);
+					device->GetPixelShaderConstantF(first, result[0], count);
+				}
+				else
+				{
+					app_state.set_vertex_shader_constant_f(first, constants[0], count);
+					device->GetVertexShaderConstantF(first, result[0], count);
+				}
+				CHECK(std::memcmp(result, constants, count * sizeof(*result)) == 0);
+				break;
+			}
+			case 8:
+			{
+				// Like the runtime, do not bind a surface that another slot still has
+				const DWORD target = random(num_render_targets);
+				IDirect3DSurface9 *surface = objects.render_targets[random(objects.render_targets.size())].get();
+				for (DWORD other = 0; other < num_render_targets; ++other)
+				{
+					com_ptr<IDirect3DSurface9> bound;
+					device->GetRenderTarget(other, &bound);
+					if (other != target && bound == surface)
+						surface = nullptr;
+				}
+				if (target == 0 && surface == nullptr)
+					break;
+				app_state.set_render_target(target, surface);
+				com_ptr<IDirect3DSurface9> result;
+				device->GetRenderTarget(target, &result);
+				CHECK(result == surface);
+				break;
+			}
+			case 9:
+			{
+				IDirect3DSurface9 *const surface = objects.depth_stencils[random(objects.depth_stencils.size())].get();
+				app_state.set_depth_stencil_surface(surface);
+				com_ptr<IDirect3DSurface9> result;
+				device->GetDepthStencilSurface(&result);
+				CHECK(result == surface);
+				break;
+			}
+			default:
+			{
+				// The runtime sets the viewport itself after the render targets, without going through the state block
+				const D3DVIEWPORT9 effect_viewport = random_viewport();
+				app_state.set_render_target(0, objects.render_targets[random(objects.render_targets.size())].get());
+				device->SetViewport(&effect_viewport);
+				break;
+			}
+			}
+		}
+		app_state.apply_and_release();
+
+		read_state(device.get(), num_render_targets, after);
+		check_same_state(before, after, num_render_targets);
+	}
+
+	printf("%d rounds on %u simultaneous render targets\n", rounds, num_render_targets);
+
+	before = {};
+	after = {};
+	current = {};
+	app_state.release_state_block();
+	objects = {};
+	device.reset();
+	d3d.reset();
+	DestroyWindow(window);
+
+	if (failures == 0)
+		printf("All state block checks passed\n");
+	return failures != 0;
+}